@@ -34,10 +34,11 @@ message(STATUS "Particle data layout: " ${PARTICLE_DATA_LAYOUT} "(-major)")
 # Configure data layout for mesh field data
 
 # Available options
-set(FIELD_DATA_LAYOUT_VALUES "field" "equation")
+set(FIELD_DATA_LAYOUT_VALUES "field" "equation" "block")
 # Initialize all to off
 set(FIELD_DATA_LAYOUT_AS_FIELD_MAJOR off)  # 0
 set(FIELD_DATA_LAYOUT_AS_EQUATION_MAJOR off)  # 1
+set(FIELD_DATA_LAYOUT_AS_BLOCK_MAJOR off)  # 2
 # Set default and select from list
 set(FIELD_DATA_LAYOUT "field" CACHE STRING "Mesh field data layout. Default: (field-major). Available options: ${FIELD_DATA_LAYOUT_VALUES}(-major).")
 SET_PROPERTY (CACHE FIELD_DATA_LAYOUT PROPERTY STRINGS ${FIELD_DATA_LAYOUT_VALUES})
@@ -48,7 +49,24 @@ IF (${FIELD_DATA_LAYOUT_INDEX} EQUAL 0)
   set(FIELD_DATA_LAYOUT_AS_FIELD_MAJOR on)
 ELSEIF (${FIELD_DATA_LAYOUT_INDEX} EQUAL 1)
   set(FIELD_DATA_LAYOUT_AS_EQUATION_MAJOR on)
+ELSEIF (${FIELD_DATA_LAYOUT_INDEX} EQUAL 2)
+  set(FIELD_DATA_LAYOUT_AS_BLOCK_MAJOR on)
 ELSEIF (${FIELD_DATA_LAYOUT_INDEX} EQUAL -1)
   MESSAGE(FATAL_ERROR "Mesh field data layout '${FIELD_DATA_LAYOUT}' not supported, valid entries are ${FIELD_DATA_LAYOUT_VALUES}(-major).")
 ENDIF()
 message(STATUS "Mesh field data layout: " ${FIELD_DATA_LAYOUT} "(-major)")
+
+# Configure huge pages for large data arrays
+
+set(DATA_HUGE_PAGES off CACHE BOOL "Back large field and particle data arrays by transparent huge pages (Linux only).")
+message(STATUS "Transparent huge pages for large data arrays: ${DATA_HUGE_PAGES}")
+
+# Configure reduced (single) precision storage for selected mesh field data
+
+set(FIELD_REDUCED_PRECISION off CACHE BOOL "Store selected mesh field data, e.g., nodal gradients and lumped mass matrices, in single precision, while computing in double precision.")
+message(STATUS "Reduced precision storage for selected mesh fields: ${FIELD_REDUCED_PRECISION}")
+
+# Configure 32-bit local ids in compact mesh connectivity
+
+set(LOCAL_INDEX_32 off CACHE BOOL "Store local ids of compact mesh connectivity, e.g., the edges of the edge-based finite element scheme, in 32 bits.")
+message(STATUS "32-bit local ids in compact mesh connectivity: ${LOCAL_INDEX_32}")
@@ -229,6 +229,20 @@ else()
   PrintMissing(meshconv "CHARM_FOUND;SEACASExodus_FOUND;EXODIFF_FOUND;PEGTL_FOUND;PUGIXML_FOUND;HDF5_FOUND;Boost_FOUND;BRIGAND_FOUND;HIGHWAYHASH_FOUND")
 endif()
 
+if (ENABLE_INCITER AND ENABLE_MESHCONV)
+  set(ENABLE_AMRBENCH "true")
+  set(AMRBENCH_EXECUTABLE amrbench)
+else()
+  PrintMissing(amrbench "ENABLE_INCITER;ENABLE_MESHCONV")
+endif()
+
+if (ENABLE_INCITER)
+  set(ENABLE_MICROBENCH "true")
+  set(MICROBENCH_EXECUTABLE microbench)
+else()
+  PrintMissing(microbench "ENABLE_INCITER")
+endif()
+
 if (CHARM_FOUND AND SEACASExodus_FOUND AND EXODIFF_FOUND AND PEGTL_FOUND AND
     BRIGAND_FOUND AND HDF5_FOUND AND RANDOM123_FOUND AND Boost_FOUND AND
     (MKL_FOUND OR LAPACKE_FOUND) AND HIGHWAYHASH_FOUND AND H5Part_FOUND)
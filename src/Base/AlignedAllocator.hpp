@@ -0,0 +1,128 @@
+// *****************************************************************************
+/*!
+  \file      src/Base/AlignedAllocator.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Aligned allocator for large data arrays
+  \details   Aligned allocator for large data arrays, used as the default
+    allocator policy of tk::Data. Memory is aligned to (at least) a cache line,
+    which is also the width of the widest SIMD registers, and large allocations
+    can optionally be backed by transparent huge pages. This file also defines
+    tk::CacheLinePadded, which pads small per-thread objects to a cache line.
+*/
+// *****************************************************************************
+#ifndef AlignedAllocator_h
+#define AlignedAllocator_h
+
+#include <new>
+#include <cstdlib>
+#include <cstddef>
+#include <limits>
+
+#include "QuinoaConfig.hpp"
+
+#if defined(DATA_HUGE_PAGES) && !defined(__APPLE__)
+  #include <sys/mman.h>
+#endif
+
+namespace tk {
+
+//! Default alignment, in bytes, of large data arrays: one cache line, which is
+//! also the width of AVX-512 vector registers
+const std::size_t DataAlign = 64;
+
+//! Alignment, in bytes, of allocations backed by transparent huge pages
+const std::size_t HugePageSize = 2*1024*1024;
+
+//! \brief Allocator aligning memory to Align bytes
+//! \details Besides alignment, this allocator also determines page placement
+//!   on NUMA systems: memory returned is not touched by the allocator, so pages
+//!   are placed (by the operating system's first-touch policy) on the NUMA
+//!   domain of the thread that first writes it. Since std::vector
+//!   value-initializes its elements in its constructor and resize(), a
+//!   container (e.g., tk::Data) constructed or unpacked (after migration) by
+//!   the worker thread that owns a chare in Charm++'s SMP mode will be placed
+//!   local to that thread. If DATA_HUGE_PAGES is configured (Linux only), large
+//!   allocations are aligned to huge pages and advised to be backed by
+//!   transparent huge pages, reducing TLB misses for large fields.
+//! \tparam T Type of objects to allocate
+//! \tparam Align Alignment in bytes, must be a power of two and a multiple of
+//!   sizeof(void*)
+template< class T, std::size_t Align = DataAlign >
+class AlignedAllocator {
+
+  static_assert( Align >= alignof(T), "Alignment less than that of type" );
+  static_assert( (Align & (Align-1)) == 0, "Alignment not a power of two" );
+
+  public:
+    using value_type = T;
+
+    //! Rebind to a different value type (required by std::allocator_traits)
+    template< class U >
+    struct rebind { using other = AlignedAllocator< U, Align >; };
+
+    //! Default constructor
+    AlignedAllocator() noexcept = default;
+
+    //! Converting copy constructor
+    template< class U >
+    // cppcheck-suppress noExplicitConstructor
+    AlignedAllocator( const AlignedAllocator< U, Align >& ) noexcept {}
+
+    //! Allocate aligned memory
+    //! \param[in] n Number of objects to allocate memory for
+    //! \return Pointer to uninitialized, aligned memory
+    T* allocate( std::size_t n ) {
+      if (n == 0) return nullptr;
+      if (n > std::numeric_limits< std::size_t >::max() / sizeof(T))
+        throw std::bad_alloc();
+      const auto bytes = n * sizeof(T);
+      auto align = Align;
+      #if defined(DATA_HUGE_PAGES) && defined(MADV_HUGEPAGE)
+      if (bytes >= HugePageSize) align = HugePageSize;
+      #endif
+      void* p = nullptr;
+      if (posix_memalign( &p, align, bytes ) != 0) throw std::bad_alloc();
+      #if defined(DATA_HUGE_PAGES) && defined(MADV_HUGEPAGE)
+      if (bytes >= HugePageSize) madvise( p, bytes, MADV_HUGEPAGE );
+      #endif
+      return static_cast< T* >( p );
+    }
+
+    //! Deallocate memory
+    //! \param[in] p Pointer to memory previously returned by allocate()
+    void deallocate( T* p, std::size_t ) noexcept { std::free( p ); }
+};
+
+//! \brief Object padded to and aligned at a cache line
+//! \details Arrays of per-thread state, indexed by thread id, e.g., random
+//!   number generator states, place the states of neighboring threads in the
+//!   same cache line if the states are small. Then every update of the state
+//!   by a thread invalidates the cache line in the cores of the other threads
+//!   (false sharing), which serializes threads that only write their own
+//!   state. Storing the states as CacheLinePadded puts each in its own cache
+//!   line. Deriving from T keeps the interface of T, e.g., a pointer to a
+//!   CacheLinePadded< T > converts to a pointer to T. Arrays of
+//!   CacheLinePadded allocated by std::vector or new[] are aligned via the
+//!   alignment-aware allocation of C++17.
+//! \tparam T Type of object to pad, must be a class type
+template< class T >
+struct alignas( DataAlign ) CacheLinePadded : T {};
+
+//! Equality of two aligned allocators: all instances are interchangeable
+template< class T, class U, std::size_t Align >
+bool operator==( const AlignedAllocator< T, Align >&,
+                 const AlignedAllocator< U, Align >& ) noexcept
+{ return true; }
+
+//! Inequality of two aligned allocators: all instances are interchangeable
+template< class T, class U, std::size_t Align >
+bool operator!=( const AlignedAllocator< T, Align >&,
+                 const AlignedAllocator< U, Align >& ) noexcept
+{ return false; }
+
+} // tk::
+
+#endif // AlignedAllocator_h
@@ -0,0 +1,118 @@
+// *****************************************************************************
+/*!
+  \file      src/Base/Arnoldi.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Small dense least-squares problem of the GMRES algorithm
+  \details   Small dense least-squares problem of the GMRES algorithm: the
+    upper Hessenberg matrix of the Arnoldi process reduced to upper triangular
+    form by Givens rotations as it is built column by column.
+*/
+// *****************************************************************************
+#ifndef Arnoldi_h
+#define Arnoldi_h
+
+#include <cmath>
+#include <vector>
+
+#include "Types.hpp"
+#include "Exception.hpp"
+
+namespace tk {
+
+//! \brief Small dense least-squares problem of the GMRES algorithm
+//! \details This class stores the part of GMRES that does not depend on the
+//!   size of the (potentially distributed) linear system: the upper Hessenberg
+//!   matrix H, whose columns are given by the Arnoldi process, reduced to
+//!   upper triangular form by Givens rotations applied as each column is
+//!   added, and the correspondingly rotated right hand side beta*e1. This
+//!   gives the norm of the residual of the linear system after each
+//!   iteration for free, and the coefficients, y, of the solution in the
+//!   Krylov basis, minimizing ||beta*e1 - H*y||, by back substitution. The
+//!   Krylov basis vectors and the matrix-vector products are left to the
+//!   caller. Since every operation is deterministic, callers that compute
+//!   the same dot products (e.g., via a reduction) build identical
+//!   least-squares problems.
+class Arnoldi {
+
+  public:
+    //! Start a new Krylov subspace
+    //! \param[in] beta Norm of the initial residual
+    void start( real beta ) {
+      m_r.clear();
+      m_cs.clear();
+      m_sn.clear();
+      m_g.assign( 1, beta );
+      m_beta = beta;
+    }
+
+    //! Add the next column of the Hessenberg matrix
+    //! \param[in] h Dot products of the new Krylov vector with all previous
+    //!   basis vectors (after orthogonalization, the first j+1 entries of
+    //!   column j of H)
+    //! \param[in] hnext Norm of the new Krylov vector after orthogonalization
+    //!   (the subdiagonal entry of column j of H)
+    //! \return Norm of the residual of the linear system after this iteration
+    real add( std::vector< real > h, real hnext ) {
+      Assert( !m_g.empty(), "Arnoldi::start() must be called first" );
+      const auto j = m_r.size();
+      Assert( h.size() == j+1, "Size mismatch" );
+      // apply previous rotations to the new column
+      for (std::size_t i=0; i<j; ++i) {
+        auto t = m_cs[i]*h[i] + m_sn[i]*h[i+1];
+        h[i+1] = -m_sn[i]*h[i] + m_cs[i]*h[i+1];
+        h[i] = t;
+      }
+      // compute new rotation eliminating the subdiagonal entry
+      auto r = std::hypot( h[j], hnext );
+      real c = 1.0, s = 0.0;
+      if (r > 0.0) { c = h[j]/r; s = hnext/r; }
+      h[j] = r;
+      m_cs.push_back( c );
+      m_sn.push_back( s );
+      m_g.push_back( -s*m_g[j] );
+      m_g[j] *= c;
+      m_r.push_back( std::move(h) );
+      return std::abs( m_g.back() );
+    }
+
+    //! Number of columns (iterations) added since the last start()
+    //! \return Number of Hessenberg columns
+    std::size_t size() const { return m_r.size(); }
+
+    //! Norm of the initial residual
+    //! \return Norm of the initial residual given to start()
+    real beta() const { return m_beta; }
+
+    //! Solve the least-squares problem
+    //! \return Coefficients of the solution in the Krylov basis, one for each
+    //!   column added
+    std::vector< real > solve() const {
+      const auto n = m_r.size();
+      std::vector< real > y( n, 0.0 );
+      for (std::size_t k=n; k-->0; ) {
+        auto s = m_g[k];
+        for (std::size_t i=k+1; i<n; ++i) s -= m_r[i][k] * y[i];
+        if (std::abs(m_r[k][k]) > 0.0) y[k] = s / m_r[k][k];
+      }
+      return y;
+    }
+
+  private:
+    //! Columns of the rotated (upper triangular) Hessenberg matrix
+    std::vector< std::vector< real > > m_r;
+    //! Cosines of the Givens rotations
+    std::vector< real > m_cs;
+    //! Sines of the Givens rotations
+    std::vector< real > m_sn;
+    //! Rotated right hand side, beta*e1
+    std::vector< real > m_g;
+    //! Norm of the initial residual
+    real m_beta = 0.0;
+};
+
+} // tk::
+
+#endif // Arnoldi_h
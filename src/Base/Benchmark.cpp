@@ -0,0 +1,69 @@
+// *****************************************************************************
+/*!
+  \file      src/Base/Benchmark.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Timing harness for microbenchmarks
+  \details   Timing harness for microbenchmarks.
+*/
+// *****************************************************************************
+
+#include <iomanip>
+
+#include "Benchmark.hpp"
+
+namespace tk {
+
+//! Quote a string for JSON
+//! \param[in] s String to quote
+//! \return String with quotes and backslashes escaped, in quotes
+static std::string quote( const std::string& s ) {
+  std::string q( "\"" );
+  for (auto c : s) {
+    if (c == '"' || c == '\\') q += '\\';
+    q += c;
+  }
+  return q + '"';
+}
+
+} // tk::
+
+void
+tk::Benchmark::json(
+  std::ostream& os,
+  const std::vector< std::pair< std::string, std::string > >& context ) const
+// *****************************************************************************
+//  Write results in JSON
+//! \param[in,out] os Stream to write to
+//! \param[in] context Pairs of names and values describing the run, e.g., the
+//!   executable, the date, and the host
+//! \details The fields follow the output of Google Benchmark, i.e., real_time
+//!   is the time per operation in time_unit, and iterations is the number of
+//!   repetitions of a batch, so that tools comparing its results across
+//!   commits can be reused. The number of operations and bytes per
+//!   repetition, and the bandwidth, are written as additional fields.
+// *****************************************************************************
+{
+  os << "{\n  \"context\": {";
+  for (std::size_t i=0; i<context.size(); ++i)
+    os << (i ? ",\n    " : "\n    ") << quote( context[i].first ) << ": "
+       << quote( context[i].second );
+  os << "\n  },\n  \"benchmarks\": [";
+  os << std::setprecision(6);
+  for (std::size_t i=0; i<m_result.size(); ++i) {
+    const auto& r = m_result[i];
+    os << (i ? ",\n    {" : "\n    {")
+       << "\"name\": " << quote( r.name )
+       << ", \"run_type\": \"iteration\""
+       << ", \"iterations\": " << r.reps
+       << ", \"real_time\": " << r.nsop()
+       << ", \"time_unit\": \"ns\""
+       << ", \"ops\": " << r.ops
+       << ", \"bytes\": " << r.bytes
+       << ", \"bytes_per_second\": " << r.gbs() * 1.0e9
+       << ", \"GB_per_s\": " << r.gbs() << '}';
+  }
+  os << "\n  ]\n}\n";
+}
@@ -0,0 +1,148 @@
+// *****************************************************************************
+/*!
+  \file      src/Base/Benchmark.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Timing harness for microbenchmarks
+  \details   Timing harness for microbenchmarks. A benchmark is a callable
+    that performs a given number of operations, e.g., Riemann problems solved
+    or elements visited, touching a given number of bytes of memory. The
+    harness first doubles the number of repetitions of the callable until a
+    batch of repetitions takes at least a tenth of the minimum time configured,
+    then repeats such batches until the minimum time is spent, and records the
+    time per repetition of the fastest batch, which is the least disturbed by
+    other processes, frequency scaling, and the like. The results are reported
+    as nanoseconds per operation and gigabytes per second, and can be written
+    in a JSON format compatible with that of Google Benchmark, understood by
+    tools that track benchmark results across commits.
+*/
+// *****************************************************************************
+#ifndef Benchmark_h
+#define Benchmark_h
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <limits>
+#include <ostream>
+#include <utility>
+#include <algorithm>
+
+#include "Types.hpp"
+
+namespace tk {
+
+//! \brief Prevent the compiler from optimizing away the computation of a value
+//! \param[in] v Value whose computation must not be optimized away
+template< class T >
+inline void doNotOptimize( const T& v ) {
+  #if defined(__GNUC__) || defined(__clang__)
+  asm volatile( "" : : "g"(&v) : "memory" );
+  #else
+  static volatile const void* sink;
+  sink = &v;
+  #endif
+}
+
+//! Result of a microbenchmark
+struct BenchResult {
+  std::string name;     //!< Benchmark name
+  std::size_t ops;      //!< Number of operations per repetition
+  std::size_t bytes;    //!< Number of bytes touched per repetition
+  std::size_t reps;     //!< Number of repetitions per batch timed
+  tk::real time;        //!< Time of the fastest repetition in seconds
+
+  //! Compute time per operation
+  //! \return Nanoseconds per operation
+  tk::real nsop() const
+  { return ops ? time * 1.0e9 / static_cast< tk::real >( ops ) : 0.0; }
+
+  //! Compute memory bandwidth
+  //! \return Gigabytes per second
+  tk::real gbs() const {
+    return time > 0.0 ? static_cast< tk::real >( bytes ) / time / 1.0e9 : 0.0;
+  }
+};
+
+//! Timing harness for microbenchmarks
+class Benchmark {
+
+  private:
+    using clock = std::chrono::steady_clock;
+
+  public:
+    //! Constructor
+    //! \param[in] mintime Minimum time in seconds spent in each benchmark
+    //! \param[in] filter Only benchmarks whose name contains this are run,
+    //!   all if empty
+    explicit Benchmark( tk::real mintime = 0.1,
+                        const std::string& filter = {} ) :
+      m_mintime( mintime ), m_filter( filter ), m_result() {}
+
+    //! Query if a benchmark is selected by the filter
+    //! \param[in] name Benchmark name
+    //! \return True if the benchmark is to be run
+    bool selected( const std::string& name ) const
+    { return m_filter.empty() || name.find( m_filter ) != std::string::npos; }
+
+    //! Run a benchmark and record its result, if selected
+    //! \param[in] name Benchmark name
+    //! \param[in] ops Number of operations per call of f
+    //! \param[in] bytes Number of bytes touched per call of f
+    //! \param[in] f Callable to benchmark, called without arguments
+    //! \return True if the benchmark was run
+    template< class F >
+    bool run( const std::string& name, std::size_t ops, std::size_t bytes,
+              F&& f )
+    {
+      if (!selected( name )) return false;
+      f();      // warm up caches and branch predictors
+      std::size_t reps = 1;
+      while (batch( reps, f ) < m_mintime/10.0 &&
+             reps < std::numeric_limits< std::size_t >::max()/2 )
+        reps *= 2;
+      auto best = std::numeric_limits< tk::real >::max();
+      tk::real elapsed = 0.0;
+      do {
+        auto t = batch( reps, f );
+        best = std::min( best, t / static_cast< tk::real >( reps ) );
+        elapsed += t;
+      } while (elapsed < m_mintime);
+      m_result.push_back( { name, ops, bytes, reps, best } );
+      return true;
+    }
+
+    //! Accessor to results recorded
+    //! \return Results of the benchmarks run, in the order run
+    const std::vector< BenchResult >& results() const { return m_result; }
+
+    //! Write results in JSON
+    void json( std::ostream& os,
+               const std::vector< std::pair< std::string, std::string > >&
+                 context ) const;
+
+  private:
+    //! Minimum time in seconds spent in each benchmark
+    const tk::real m_mintime;
+    //! Only benchmarks whose name contains this are run
+    const std::string m_filter;
+    //! Results recorded
+    std::vector< BenchResult > m_result;
+
+    //! Time a batch of repetitions
+    //! \param[in] reps Number of repetitions
+    //! \param[in] f Callable to call reps times
+    //! \return Time of the batch in seconds
+    template< class F >
+    static tk::real batch( std::size_t reps, F& f ) {
+      const auto t0 = clock::now();
+      for (std::size_t r=0; r<reps; ++r) f();
+      return std::chrono::duration< tk::real >( clock::now() - t0 ).count();
+    }
+};
+
+} // tk::
+
+#endif // Benchmark_h
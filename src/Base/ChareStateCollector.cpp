@@ -11,14 +11,17 @@
 // *****************************************************************************
 
 #include <vector>
+#include <fstream>
 #include <unordered_map>
 
 #include "ChareStateCollector.hpp"
 #include "HashMapReducer.hpp"
+#include "Exception.hpp"
 
 namespace tk {
 
 static CkReduction::reducerType stateMerger;
+static CkReduction::reducerType ctrMerger;
 
 } // tk::
 
@@ -37,6 +40,8 @@ ChareStateCollector::registerReducers()
 {
   stateMerger =
     CkReduction::addReducer( tk::mergeHashMap< int, decltype(m_state) > );
+  ctrMerger = CkReduction::addReducer(
+    tk::mergeHashMap< std::string, std::vector< tk::real > > );
 }
 
 void
@@ -75,4 +80,36 @@ ChareStateCollector::collect( bool error, CkCallback cb )
   contribute( stream.first, stream.second.get(), stateMerger, cb );
 }
 
+void
+ChareStateCollector::dumptrace( const std::string& prefix, CkCallback cb )
+// *****************************************************************************
+//  Write trace events recorded on this PE to file
+//! \param[in] prefix File name prefix, the file written is <prefix>.<pe>.json
+//! \param[in] cb Callback to reduce to after all PEs have written their file
+//! \details Each PE writes its own file, so that the trace of thousands of PEs
+//!   is neither gathered on a single PE nor written by a single PE.
+// *****************************************************************************
+{
+  if (m_trace.enabled()) {
+    const auto name = prefix + '.' + std::to_string( CkMyPe() ) + ".json";
+    std::ofstream f( name );
+    ErrChk( f.good(), "Failed to open trace file: " + name );
+    m_trace.write( f, CkMyPe() );
+  }
+
+  contribute( cb );
+}
+
+void
+ChareStateCollector::counters( CkCallback cb )
+// *****************************************************************************
+//  Collect performance counters sampled on this PE
+//! \param[in] cb Callback to reduce to with the rows of all PEs concatenated
+//!   per region name, see tk::perfRows()
+// *****************************************************************************
+{
+  auto stream = tk::serialize( tk::perfRows( CkMyPe() ) );
+  contribute( stream.first, stream.second.get(), ctrMerger, cb );
+}
+
 #include "NoWarning/charestatecollector.def.h"
@@ -16,6 +16,8 @@
 
 #include "Timer.hpp"
 #include "ChareState.hpp"
+#include "TraceBuffer.hpp"
+#include "PerfCounter.hpp"
 
 #include "NoWarning/charestatecollector.decl.h"
 
@@ -35,7 +37,15 @@ class ChareStateCollector : public CBase_ChareStateCollector {
     #endif
     //! Constructor
     //! \details Start timer when constructor is called
-    explicit ChareStateCollector() : m_state(), m_timer() {}
+    explicit ChareStateCollector() : m_state(), m_timer(), m_trace() {}
+
+    //! Constructor recording a trace of events and performance counters
+    //! \param[in] tracebuf Number of most recent trace events held on each PE
+    //! \param[in] perfctr True to sample hardware performance counters around
+    //!   the regions instrumented by tk::PerfRegion on each PE
+    explicit ChareStateCollector( std::size_t tracebuf, bool perfctr ) :
+      m_state(), m_timer(), m_trace( tracebuf )
+    { if (perfctr) tk::perfCounters( true ); }
 
     //! Migrate constructor
     explicit ChareStateCollector( CkMigrateMessage* m ) :
@@ -54,6 +64,26 @@ class ChareStateCollector : public CBase_ChareStateCollector {
     //! Collect chare state
     void collect( bool error, CkCallback cb );
 
+    //! Query if trace events are recorded
+    //! \return True if recording trace events
+    bool tracing() const { return m_trace.enabled(); }
+
+    //! Record a trace event, see tk::TraceBuffer::record()
+    //! \param[in] ev Kind of event, see tk::traceEvent()
+    //! \param[in] id Chare id
+    //! \param[in] it Iteration count
+    //! \param[in] t0 Start time in seconds, e.g., by CkWallTimer()
+    //! \param[in] t1 End time in seconds
+    void trace( std::uint32_t ev, int id, uint64_t it, tk::real t0,
+                tk::real t1 )
+    { m_trace.record( ev, id, it, t0, t1 ); }
+
+    //! Write trace events recorded on this PE to file
+    void dumptrace( const std::string& prefix, CkCallback cb );
+
+    //! Collect performance counters sampled on this PE
+    void counters( CkCallback cb );
+
     /** @name Charm++ pack/unpack serializer member functions */
     ///@{
     //! \brief Pack/Unpack serialize member function
@@ -63,6 +93,7 @@ class ChareStateCollector : public CBase_ChareStateCollector {
     void pup( PUP::er &p ) override {
       p | m_state;
       p | m_timer;
+      p | m_trace;
     }
     //! \brief Pack/Unpack serialize operator|
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
@@ -73,6 +104,7 @@ class ChareStateCollector : public CBase_ChareStateCollector {
   private:
     std::vector< ChareState > m_state;  //!< Chare states
     Timer m_timer;                      //!< Timer for getting time stamps
+    TraceBuffer m_trace;                //!< Trace events
 };
 
 } // tk::
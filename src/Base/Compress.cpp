@@ -0,0 +1,131 @@
+// *****************************************************************************
+/*!
+  \file      src/Base/Compress.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Light-weight lossless compression of binary data
+  \details   Light-weight lossless compression of binary data.
+*/
+// *****************************************************************************
+
+#include <cstring>
+#include <algorithm>
+#include <cstdint>
+
+#include "Compress.hpp"
+#include "Exception.hpp"
+
+namespace tk {
+
+//! Size of a word whose bytes are shuffled into byte planes
+static const std::size_t g_wordsize = 8;
+
+//! Maximum length of a run of literal or of repeated bytes
+static const std::size_t g_maxrun = 128;
+
+std::vector< char >
+compress( const char* data, std::size_t size )
+// *****************************************************************************
+//  Compress binary data
+//! \param[in] data Pointer to data to compress
+//! \param[in] size Number of bytes to compress
+//! \return Compressed data: the original size followed by the run-length
+//!   encoded byte planes
+//! \details The run-length encoding consists of a control byte c followed by
+//!   c+1 literal bytes if c < 128, or, if c >= 128, a single byte repeated
+//!   c-126 times.
+// *****************************************************************************
+{
+  // Shuffle bytes of words into byte planes, the trailing bytes not filling a
+  // word are left in place
+  const auto nword = size / g_wordsize;
+  std::vector< unsigned char > s( size );
+  for (std::size_t w=0; w<nword; ++w)
+    for (std::size_t b=0; b<g_wordsize; ++b)
+      s[ b*nword + w ] = static_cast< unsigned char >( data[ w*g_wordsize+b ] );
+  std::memcpy( s.data() + nword*g_wordsize, data + nword*g_wordsize,
+               size - nword*g_wordsize );
+
+  // Store original size
+  std::vector< char > c( sizeof(uint64_t) );
+  auto n = static_cast< uint64_t >( size );
+  std::memcpy( c.data(), &n, sizeof(uint64_t) );
+  c.reserve( c.size() + size/4 );
+
+  // Run-length encode shuffled bytes
+  std::size_t i = 0, lit = 0;   // position, and start of pending literals
+  auto literals = [&]( std::size_t end ){
+    while (lit < end) {
+      auto l = std::min( g_maxrun, end - lit );
+      c.push_back( static_cast< char >( l-1 ) );
+      c.insert( c.end(), s.begin() + static_cast< std::ptrdiff_t >( lit ),
+                s.begin() + static_cast< std::ptrdiff_t >( lit + l ) );
+      lit += l;
+    }
+  };
+  while (i < size) {
+    std::size_t r = 1;
+    while (i+r < size && r < g_maxrun+1 && s[i+r] == s[i]) ++r;
+    if (r >= 3) {
+      literals( i );
+      auto ctl = static_cast< unsigned char >( r+126 );
+      c.push_back( static_cast< char >( ctl ) );
+      c.push_back( static_cast< char >( s[i] ) );
+      i += r;
+      lit = i;
+    } else {
+      i += r;
+    }
+  }
+  literals( size );
+
+  return c;
+}
+
+std::vector< char >
+decompress( const std::vector< char >& data )
+// *****************************************************************************
+//  Decompress binary data compressed by tk::compress()
+//! \param[in] data Compressed data
+//! \return Decompressed data
+// *****************************************************************************
+{
+  ErrChk( data.size() >= sizeof(uint64_t), "Compressed data corrupt" );
+  uint64_t n;
+  std::memcpy( &n, data.data(), sizeof(uint64_t) );
+  const auto size = static_cast< std::size_t >( n );
+
+  // Decode runs into shuffled bytes
+  std::vector< unsigned char > s;
+  s.reserve( size );
+  for (std::size_t i=sizeof(uint64_t); i<data.size(); ) {
+    auto ctl = static_cast< unsigned char >( data[i++] );
+    if (ctl < g_maxrun) {
+      std::size_t l = ctl + 1UL;
+      ErrChk( i+l <= data.size(), "Compressed data corrupt" );
+      s.insert( s.end(), data.begin() + static_cast< std::ptrdiff_t >( i ),
+                data.begin() + static_cast< std::ptrdiff_t >( i + l ) );
+      i += l;
+    } else {
+      ErrChk( i < data.size(), "Compressed data corrupt" );
+      auto b = static_cast< unsigned char >( data[i++] );
+      s.insert( s.end(), ctl - 126UL, b );
+    }
+  }
+  ErrChk( s.size() == size, "Compressed data corrupt" );
+
+  // Unshuffle byte planes into words
+  const auto nword = size / g_wordsize;
+  std::vector< char > d( size );
+  for (std::size_t w=0; w<nword; ++w)
+    for (std::size_t b=0; b<g_wordsize; ++b)
+      d[ w*g_wordsize+b ] = static_cast< char >( s[ b*nword + w ] );
+  std::memcpy( d.data() + nword*g_wordsize, s.data() + nword*g_wordsize,
+               size - nword*g_wordsize );
+
+  return d;
+}
+
+} // tk::
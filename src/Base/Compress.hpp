@@ -0,0 +1,37 @@
+// *****************************************************************************
+/*!
+  \file      src/Base/Compress.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Light-weight lossless compression of binary data
+  \details   Light-weight, dependency-free, lossless compression of binary
+    data consisting mostly of arrays of 8-byte words, e.g., serialized mesh
+    connectivity, global ids, and node coordinates. The bytes of consecutive
+    8-byte words are first shuffled into byte planes, i.e., all first bytes,
+    then all second bytes, etc., which collects the (mostly zero) high bytes
+    of integers and the (slowly varying) exponent bytes of floating point
+    numbers into long runs, then the runs of repeated bytes are run-length
+    encoded. This is the byte-shuffle filter of blosc/HDF5 followed by a
+    simple run-length encoder, which, as opposed to a general-purpose
+    compressor, requires no third-party library.
+*/
+// *****************************************************************************
+#ifndef Compress_h
+#define Compress_h
+
+#include <vector>
+#include <cstddef>
+
+namespace tk {
+
+//! Compress binary data
+std::vector< char > compress( const char* data, std::size_t size );
+
+//! Decompress binary data compressed by tk::compress()
+std::vector< char > decompress( const std::vector< char >& data );
+
+} // tk::
+
+#endif // Compress_h
@@ -18,11 +18,15 @@
 #include <cstdint>
 #include <vector>
 #include <set>
+#include <limits>
 #include <algorithm>
+#include <functional>
+#include <type_traits>
 
 #include "Types.hpp"
 #include "Keywords.hpp"
 #include "Exception.hpp"
+#include "AlignedAllocator.hpp"
 
 #include "NoWarning/pup_stl.hpp"
 
@@ -31,10 +35,228 @@ namespace tk {
 //! Tags for selecting data layout policies
 const uint8_t UnkEqComp = 0;
 const uint8_t EqCompUnk = 1;
+const uint8_t BlkEqCompUnk = 2;
+
+//! \brief Number of unknowns stored contiguously per component in a block of
+//!   the BlkEqCompUnk (blocked, array-of-structures-of-arrays) data layout
+//! \details With this layout unknowns are grouped into blocks of DataBlkWidth
+//!   unknowns. Each block stores all components of its unknowns, and within a
+//!   block the unknowns of a single component are contiguous, so that a single
+//!   vector load can fetch DataBlkWidth unknowns of a component while all
+//!   components of the block remain close in memory.
+const std::size_t DataBlkWidth = 8;
+
+template< uint8_t Layout, class Alloc = AlignedAllocator< tk::real > >
+class Data;
+
+//! \brief Base class of expressions over Data objects, evaluated lazily
+//! \details Arithmetic between Data objects and scalars does not evaluate
+//!   immediately but creates a lightweight expression object. The expression
+//!   is evaluated in a single fused loop once assigned to (or used to
+//!   construct) a Data object, which avoids a full-size temporary (and a pass
+//!   over memory) for every sub-expression, e.g., in u = un + c*dt*rhs/lhs.
+//!   Expressions refer to their Data operands by reference, so an
+//!   expression must be evaluated before its Data operands go out of scope,
+//!   i.e., do not hold on to an expression via auto, assign it to a Data.
+//! \see T. Veldhuizen, Expression Templates, C++ Report, 7(5):26-31, 1995.
+template< class E >
+class DataExpr {
+  public:
+    //! Access the derived expression (CRTP)
+    //! \return Const reference to the derived expression object
+    const E& self() const { return static_cast< const E& >( *this ); }
+};
+
+//! Scalar operand of an expression over Data objects
+class DataScalar : public DataExpr< DataScalar > {
+  public:
+    //! Constructor
+    //! \param[in] v Scalar value
+    explicit DataScalar( tk::real v ) : m_v( v ) {}
+    //! Evaluate the scalar at any raw index
+    //! \return Scalar value
+    tk::real ev( std::size_t ) const { return m_v; }
+  private:
+    tk::real m_v;       //!< Scalar value
+};
+
+//! Type used to hold an operand in an expression: Data by reference, others
+//! (sub-expressions and scalars, which are cheap to copy) by value
+template< class E > struct DataOperand { using type = const E; };
+template< uint8_t L, class A > struct DataOperand< Data< L, A > >
+{ using type = const Data< L, A >&; };
+
+//! Binary expression over Data objects (and scalars)
+//! \tparam L Type of left operand
+//! \tparam R Type of right operand
+//! \tparam Op Binary operation to apply entry by entry
+template< class L, class R, class Op >
+class DataBinExpr : public DataExpr< DataBinExpr< L, R, Op > > {
+  public:
+    //! Constructor
+    //! \param[in] l Left operand
+    //! \param[in] r Right operand
+    DataBinExpr( const L& l, const R& r ) : m_l( l ), m_r( r ) {
+      if constexpr( !std::is_same_v< L, DataScalar > &&
+                    !std::is_same_v< R, DataScalar > )
+      {
+        Assert( l.nunk() == r.nunk(), "Number of unknowns unequal" );
+        Assert( l.nprop() == r.nprop(), "Number of properties unequal" );
+      }
+    }
+    //! Evaluate the expression at a raw index
+    //! \param[in] i Raw index into the underlying storage
+    //! \return Value of the expression at raw index i
+    tk::real ev( std::size_t i ) const { return Op()( m_l.ev(i), m_r.ev(i) ); }
+    //! Number of unknowns of the expression
+    //! \return Number of unknowns of the (non-scalar) operands
+    std::size_t nunk() const {
+      if constexpr( std::is_same_v< L, DataScalar > ) return m_r.nunk();
+      else return m_l.nunk();
+    }
+    //! Number of properties of the expression
+    //! \return Number of properties of the (non-scalar) operands
+    std::size_t nprop() const {
+      if constexpr( std::is_same_v< L, DataScalar > ) return m_r.nprop();
+      else return m_l.nprop();
+    }
+  private:
+    typename DataOperand< L >::type m_l;        //!< Left operand
+    typename DataOperand< R >::type m_r;        //!< Right operand
+};
+
+//! \brief Non-owning view of a single component of all unknowns of Data
+//! \details The stride between consecutive unknowns is encoded at compile time
+//!   via the data layout: unit stride for EqCompUnk, unit stride within blocks
+//!   of DataBlkWidth unknowns for BlkEqCompUnk, and nprop for UnkEqComp. This
+//!   exposes the memory access pattern to the compiler in loops over unknowns,
+//!   unlike chained calls to Data::cptr() and Data::var().
+//! \tparam Layout Data layout policy
+//! \tparam T Type of data viewed, const-qualified for read-only views
+template< uint8_t Layout, class T >
+class DataCompView {
+  public:
+    //! Constructor
+    //! \param[in] ptr Pointer to the first unknown of the component
+    //! \param[in] nunk Number of unknowns
+    //! \param[in] nprop Number of properties of the Data object viewed
+    explicit DataCompView( T* ptr, std::size_t nunk, std::size_t nprop ) :
+      m_ptr( ptr ), m_nunk( nunk ), m_nprop( nprop ) {}
+    //! Access component of an unknown
+    //! \param[in] unknown Unknown index
+    //! \return Reference to data of unknown
+    T& operator[]( std::size_t unknown ) const {
+      Assert( unknown < m_nunk, "Out-of-bounds access: unknown < number of "
+              "unknowns" );
+      if constexpr( Layout == UnkEqComp )
+        return m_ptr[ unknown*m_nprop ];
+      else if constexpr( Layout == EqCompUnk )
+        return m_ptr[ unknown ];
+      else
+        return m_ptr[ (unknown/DataBlkWidth)*DataBlkWidth*m_nprop +
+                      unknown%DataBlkWidth ];
+    }
+    //! Number of unknowns viewed
+    //! \return Number of unknowns
+    std::size_t size() const noexcept { return m_nunk; }
+  private:
+    T* const m_ptr;             //!< Pointer to first unknown
+    const std::size_t m_nunk;   //!< Number of unknowns
+    const std::size_t m_nprop;  //!< Number of properties
+};
+
+//! \brief Non-owning view of all components (starting at an offset) of a
+//!   single unknown of Data
+//! \details The stride between consecutive components is encoded at compile
+//!   time via the data layout: unit stride for UnkEqComp, DataBlkWidth for
+//!   BlkEqCompUnk, and nunk for EqCompUnk.
+//! \tparam Layout Data layout policy
+//! \tparam T Type of data viewed, const-qualified for read-only views
+template< uint8_t Layout, class T >
+class DataUnkView {
+  public:
+    //! Constructor
+    //! \param[in] ptr Pointer to the first component viewed of the unknown
+    //! \param[in] nunk Number of unknowns of the Data object viewed
+    //! \param[in] ncomp Number of components viewed
+    explicit DataUnkView( T* ptr, std::size_t nunk, std::size_t ncomp ) :
+      m_ptr( ptr ), m_nunk( nunk ), m_ncomp( ncomp ) {}
+    //! Access a component of the unknown
+    //! \param[in] component Component index relative to the offset viewed
+    //! \return Reference to data of component
+    T& operator[]( std::size_t component ) const {
+      Assert( component < m_ncomp, "Out-of-bounds access: component < number "
+              "of components" );
+      if constexpr( Layout == UnkEqComp )
+        return m_ptr[ component ];
+      else if constexpr( Layout == EqCompUnk )
+        return m_ptr[ component*m_nunk ];
+      else
+        return m_ptr[ component*DataBlkWidth ];
+    }
+    //! Number of components viewed
+    //! \return Number of components
+    std::size_t size() const noexcept { return m_ncomp; }
+  private:
+    T* const m_ptr;             //!< Pointer to first component
+    const std::size_t m_nunk;   //!< Number of unknowns
+    const std::size_t m_ncomp;  //!< Number of components
+};
+
+//! \brief Non-owning view of a system of components, i.e., all components
+//!   (starting at an offset) of all unknowns of Data
+//! \details Equivalent to Data's function call operator with the offset
+//!   applied once at construction, and the address computed by the view
+//!   inline with the layout known at compile time.
+//! \tparam Layout Data layout policy
+//! \tparam T Type of data viewed, const-qualified for read-only views
+template< uint8_t Layout, class T >
+class DataSysView {
+  public:
+    //! Constructor
+    //! \param[in] ptr Pointer to the first component viewed of the first
+    //!   unknown
+    //! \param[in] nunk Number of unknowns
+    //! \param[in] nprop Number of properties of the Data object viewed
+    //! \param[in] ncomp Number of components viewed
+    explicit DataSysView( T* ptr, std::size_t nunk, std::size_t nprop,
+                          std::size_t ncomp ) :
+      m_ptr( ptr ), m_nunk( nunk ), m_nprop( nprop ), m_ncomp( ncomp ) {}
+    //! Access a component of an unknown
+    //! \param[in] unknown Unknown index
+    //! \param[in] component Component index relative to the offset viewed
+    //! \return Reference to data of component of unknown
+    T& operator()( std::size_t unknown, std::size_t component ) const {
+      Assert( component < m_ncomp, "Out-of-bounds access: component < number "
+              "of components" );
+      Assert( unknown < m_nunk, "Out-of-bounds access: unknown < number of "
+              "unknowns" );
+      if constexpr( Layout == UnkEqComp )
+        return m_ptr[ unknown*m_nprop + component ];
+      else if constexpr( Layout == EqCompUnk )
+        return m_ptr[ component*m_nunk + unknown ];
+      else
+        return m_ptr[ (unknown/DataBlkWidth)*DataBlkWidth*m_nprop +
+                      component*DataBlkWidth + unknown%DataBlkWidth ];
+    }
+    //! Number of unknowns viewed
+    //! \return Number of unknowns
+    std::size_t nunk() const noexcept { return m_nunk; }
+    //! Number of components viewed
+    //! \return Number of components
+    std::size_t ncomp() const noexcept { return m_ncomp; }
+  private:
+    T* const m_ptr;             //!< Pointer to first component of first unknown
+    const std::size_t m_nunk;   //!< Number of unknowns
+    const std::size_t m_nprop;  //!< Number of properties
+    const std::size_t m_ncomp;  //!< Number of components
+};
 
 //! Zero-runtime-cost data-layout wrappers with type-based compile-time dispatch
-template< uint8_t Layout >
-class Data {
+//! \tparam Layout Data layout policy
+//! \tparam Alloc Allocator policy used for the underlying storage
+template< uint8_t Layout, class Alloc >
+class Data : public DataExpr< Data< Layout, Alloc > > {
 
   private:
     //! \brief Inherit type of number of components from keyword 'ncomp', used
@@ -42,6 +264,13 @@ class Data {
     using ncomp_t = kw::ncomp::info::expect::type;
 
   public:
+    //! Type of the values stored, determined by the allocator policy
+    //! \details This is tk::real by default but can be, e.g., float, to store
+    //!   selected fields in reduced precision. Data access then returns
+    //!   references to value_type, while arithmetic, e.g., expressions, are
+    //!   evaluated in tk::real.
+    using value_type = typename Alloc::value_type;
+
     //! Default constructor (required for Charm++ migration)
     explicit Data() : m_vec(), m_nunk(), m_nprop() {}
 
@@ -50,7 +279,7 @@ class Data {
     //! \param[in] np Total number of properties, i.e., scalar variables or
     //!   components, per unknown
     explicit Data( ncomp_t nu, ncomp_t np ) :
-      m_vec( nu*np ),
+      m_vec( capacity( nu, int2type< Layout >() ) * np ),
       m_nunk( nu ),
       m_nprop( np ) {}
 
@@ -67,8 +296,8 @@ class Data {
     //!   a system
     //! \param[in] offset System offset specifying the position of the system of
     //!   equations among other systems
-    //! \return Const reference to data of type tk::real
-    const tk::real&
+    //! \return Const reference to data of type value_type
+    const value_type&
     operator()( ncomp_t unknown, ncomp_t component, ncomp_t offset ) const
     { return access( unknown, component, offset, int2type< Layout >() ); }
 
@@ -85,12 +314,12 @@ class Data {
     //!   a system
     //! \param[in] offset System offset specifying the position of the system of
     //!   equations among other systems
-    //! \return Non-const reference to data of type tk::real
+    //! \return Non-const reference to data of type value_type
     //! \see "Avoid Duplication in const and Non-const Member Function," and
     //!   "Use const whenever possible," Scott Meyers, Effective C++, 3d ed.
-    tk::real&
+    value_type&
     operator()( ncomp_t unknown, ncomp_t component, ncomp_t offset ) {
-      return const_cast< tk::real& >(
+      return const_cast< value_type& >(
                static_cast< const Data& >( *this ).
                  operator()( unknown, component, offset ) );
     }
@@ -116,10 +345,10 @@ class Data {
     //!   a system
     //! \param[in] offset System offset specifying the position of the system of
     //!   equations among other systems
-    //! \return Pointer to data of type tk::real for use with var()
+    //! \return Pointer to data of type value_type for use with var()
     //! \see Example client code in Statistics::setupOrdinary() and
     //!   Statistics::accumulateOrd() in Statistics/Statistics.C.
-    const tk::real*
+    const value_type*
     cptr( ncomp_t component, ncomp_t offset ) const
     { return cptr( component, offset, int2type< Layout >() ); }
 
@@ -140,13 +369,13 @@ class Data {
     //!     const real& value = var( p, unk ); or real& value = var( p, unk );
     //!   Requirement: unknown < nunk, enforced with an assert in DEBUG mode,
     //!   see also the constructor.
-    //! \param[in] pt Pointer to data of type tk::real as returned from cptr()
+    //! \param[in] pt Pointer to data of type value_type as returned from cptr()
     //! \param[in] unknown Unknown index
-    //! \return Const reference to data of type tk::real
+    //! \return Const reference to data of type value_type
     //! \see Example client code in Statistics::setupOrdinary() and
     //!   Statistics::accumulateOrd() in Statistics/Statistics.C.
-    const tk::real&
-    var( const tk::real* pt, ncomp_t unknown ) const
+    const value_type&
+    var( const value_type* pt, ncomp_t unknown ) const
     { return var( pt, unknown, int2type< Layout >() ); }
 
     //! Non-const-ref data-access dispatch
@@ -166,19 +395,99 @@ class Data {
     //!     const real& value = var( p, unk ); or real& value = var( p, unk );
     //!   Requirement: unknown < nunk, enforced with an assert in DEBUG mode,
     //!   see also the constructor.
-    //! \param[in] pt Pointer to data of type tk::real as returned from cptr()
+    //! \param[in] pt Pointer to data of type value_type as returned from cptr()
     //! \param[in] unknown Unknown index
-    //! \return Non-const reference to data of type tk::real
+    //! \return Non-const reference to data of type value_type
     //! \see Example client code in Statistics::setupOrdinary() and
     //!   Statistics::accumulateOrd() in Statistics/Statistics.C.
     //! \see "Avoid Duplication in const and Non-const Member Function," and
     //!   "Use const whenever possible," Scott Meyers, Effective C++, 3d ed.
-    tk::real&
-    var( const tk::real* pt, ncomp_t unknown ) {
-      return const_cast< tk::real& >(
+    value_type&
+    var( const value_type* pt, ncomp_t unknown ) {
+      return const_cast< value_type& >(
                static_cast< const Data& >( *this ).var( pt, unknown ) );
     }
 
+    //! Const view of a component of all unknowns
+    //! \details Requirement: offset + component < nprop, enforced with an
+    //!   assert in DEBUG mode, see also the constructor.
+    //! \param[in] component Component index, i.e., position of a scalar within
+    //!   a system
+    //! \param[in] offset System offset specifying the position of the system of
+    //!   equations among other systems
+    //! \return Read-only view of the component, indexed by unknown
+    DataCompView< Layout, const value_type >
+    cview( ncomp_t component, ncomp_t offset ) const {
+      return DataCompView< Layout, const value_type >
+               ( cptr( component, offset ), m_nunk, m_nprop );
+    }
+
+    //! Non-const view of a component of all unknowns
+    //! \details Requirement: offset + component < nprop, enforced with an
+    //!   assert in DEBUG mode, see also the constructor.
+    //! \param[in] component Component index, i.e., position of a scalar within
+    //!   a system
+    //! \param[in] offset System offset specifying the position of the system of
+    //!   equations among other systems
+    //! \return Read-write view of the component, indexed by unknown
+    DataCompView< Layout, value_type >
+    cview( ncomp_t component, ncomp_t offset ) {
+      return DataCompView< Layout, value_type >
+               ( const_cast< value_type* >( cptr( component, offset ) ),
+                 m_nunk, m_nprop );
+    }
+
+    //! Const view of all components of an unknown starting at an offset
+    //! \details Requirement: offset < nprop, unknown < nunk, enforced with an
+    //!   assert in DEBUG mode, see also the constructor.
+    //! \param[in] unknown Unknown index
+    //! \param[in] offset System offset specifying the position of the system of
+    //!   equations among other systems
+    //! \return Read-only view of the unknown, indexed by component
+    DataUnkView< Layout, const value_type >
+    uview( ncomp_t unknown, ncomp_t offset ) const {
+      return DataUnkView< Layout, const value_type >
+               ( &var( cptr( 0, offset ), unknown ), m_nunk, m_nprop-offset );
+    }
+
+    //! Non-const view of all components of an unknown starting at an offset
+    //! \details Requirement: offset < nprop, unknown < nunk, enforced with an
+    //!   assert in DEBUG mode, see also the constructor.
+    //! \param[in] unknown Unknown index
+    //! \param[in] offset System offset specifying the position of the system of
+    //!   equations among other systems
+    //! \return Read-write view of the unknown, indexed by component
+    DataUnkView< Layout, value_type >
+    uview( ncomp_t unknown, ncomp_t offset ) {
+      return DataUnkView< Layout, value_type >
+               ( &var( cptr( 0, offset ), unknown ), m_nunk, m_nprop-offset );
+    }
+
+    //! Const view of all components starting at an offset of all unknowns
+    //! \details Requirement: offset < nprop, enforced with an assert in DEBUG
+    //!   mode, see also the constructor.
+    //! \param[in] offset System offset specifying the position of the system of
+    //!   equations among other systems
+    //! \return Read-only view of the system, indexed by (unknown, component)
+    DataSysView< Layout, const value_type >
+    sview( ncomp_t offset ) const {
+      return DataSysView< Layout, const value_type >
+               ( cptr( 0, offset ), m_nunk, m_nprop, m_nprop-offset );
+    }
+
+    //! Non-const view of all components starting at an offset of all unknowns
+    //! \details Requirement: offset < nprop, enforced with an assert in DEBUG
+    //!   mode, see also the constructor.
+    //! \param[in] offset System offset specifying the position of the system of
+    //!   equations among other systems
+    //! \return Read-write view of the system, indexed by (unknown, component)
+    DataSysView< Layout, value_type >
+    sview( ncomp_t offset ) {
+      return DataSysView< Layout, value_type >
+               ( const_cast< value_type* >( cptr( 0, offset ) ),
+                 m_nunk, m_nprop, m_nprop-offset );
+    }
+
     //! Access to number of unknowns
     //! \return Number of unknowns
     ncomp_t nunk() const noexcept { return m_nunk; }
@@ -301,113 +610,115 @@ class Data {
 
     //! Const-ref accessor to underlying raw data
     //! \return Constant reference to underlying raw data
-    const std::vector< tk::real >& data() const { return m_vec; }
+    const std::vector< value_type, Alloc >& data() const { return m_vec; }
 
     //! Non-const-ref accessor to underlying raw data
     //! \return Non-constant reference to underlying raw data
-    std::vector< tk::real >& data() { return m_vec; }
+    std::vector< value_type, Alloc >& data() { return m_vec; }
+
+    //! Construct from a (lazily evaluated) expression of Data objects
+    //! \param[in] e Expression to evaluate into the new Data object
+    //! \details The expression is evaluated in a single fused loop without
+    //!   allocating temporaries for the sub-expressions.
+    template< class E >
+    // cppcheck-suppress noExplicitConstructor
+    Data( const DataExpr< E >& e ) :
+      m_vec( capacity( e.self().nunk(), int2type< Layout >() ) *
+             e.self().nprop() ),
+      m_nunk( e.self().nunk() ),
+      m_nprop( e.self().nprop() )
+    { evaluate( e.self(), []( value_type& d, tk::real s )
+                { d = static_cast< value_type >( s ); } ); }
+
+    //! Assign a (lazily evaluated) expression of Data objects
+    //! \param[in] e Expression to evaluate
+    //! \return Reference to ourselves after assignment
+    //! \details If the expression has the same size as this object, the
+    //!   expression is evaluated in place in a single fused loop, which also
+    //!   allows the expression to refer to this object, e.g., u = u + du. If
+    //!   the size differs, a new object is constructed.
+    template< class E >
+    Data& operator= ( const DataExpr< E >& e ) {
+      const auto& x = e.self();
+      if (x.nunk() == m_nunk && x.nprop() == m_nprop)
+        evaluate( x, []( value_type& d, tk::real s )
+                { d = static_cast< value_type >( s ); } );
+      else
+        *this = Data( e );
+      return *this;
+    }
 
     //! Compound operator-=
-    //! \param[in] rhs Data object to subtract
+    //! \param[in] rhs Data object (or expression) to subtract
     //! \return Reference to ourselves after subtraction
-    Data< Layout >& operator-= ( const Data< Layout >& rhs ) {
-      Assert( rhs.nunk() == m_nunk, "Incorrect number of unknowns" );
-      Assert( rhs.nprop() == m_nprop, "Incorrect number of properties" );
-      std::transform( rhs.data().cbegin(), rhs.data().cend(),
-                      m_vec.cbegin(), m_vec.begin(),
-                      []( tk::real s, tk::real d ){ return d-s; } );
+    template< class E >
+    Data& operator-= ( const DataExpr< E >& rhs ) {
+      Assert( rhs.self().nunk() == m_nunk, "Incorrect number of unknowns" );
+      Assert( rhs.self().nprop() == m_nprop, "Incorrect number of properties" );
+      evaluate( rhs.self(), []( value_type& d, tk::real s )
+                { d = static_cast< value_type >( d - s ); } );
       return *this;
     }
-    //! Operator -
-    //! \param[in] rhs Data object to subtract
-    //! \return Copy of Data object after rhs has been subtracted
-    //! \details Implemented in terms of compound operator-=
-    Data< Layout > operator- ( const Data< Layout >& rhs )
-    const { return Data< Layout >( *this ) -= rhs; }
 
     //! Compound operator+=
-    //! \param[in] rhs Data object to add
+    //! \param[in] rhs Data object (or expression) to add
     //! \return Reference to ourselves after addition
-    Data< Layout >& operator+= ( const Data< Layout >& rhs ) {
-      Assert( rhs.nunk() == m_nunk, "Incorrect number of unknowns" );
-      Assert( rhs.nprop() == m_nprop, "Incorrect number of properties" );
-      std::transform( rhs.data().cbegin(), rhs.data().cend(),
-                      m_vec.cbegin(), m_vec.begin(),
-                      []( tk::real s, tk::real d ){ return d+s; } );
+    template< class E >
+    Data& operator+= ( const DataExpr< E >& rhs ) {
+      Assert( rhs.self().nunk() == m_nunk, "Incorrect number of unknowns" );
+      Assert( rhs.self().nprop() == m_nprop, "Incorrect number of properties" );
+      evaluate( rhs.self(), []( value_type& d, tk::real s )
+                { d = static_cast< value_type >( d + s ); } );
       return *this;
     }
-    //! Operator +
-    //! \param[in] rhs Data object to add
-    //! \return Copy of Data object after rhs has been multiplied with
-    //! \details Implemented in terms of compound operator+=
-    Data< Layout > operator+ ( const Data< Layout >& rhs )
-    const { return Data< Layout >( *this ) += rhs; }
 
-    //! Compound operator*= multiplying by another Data object item by item
-    //! \param[in] rhs Data object to multiply with
+    //! \brief Compound operator*= multiplying by another Data object (or
+    //!   expression) item by item
+    //! \param[in] rhs Data object (or expression) to multiply with
     //! \return Reference to ourselves after multiplication
-    Data< Layout >& operator*= ( const Data< Layout >& rhs ) {
-      Assert( rhs.nunk() == m_nunk, "Incorrect number of unknowns" );
-      Assert( rhs.nprop() == m_nprop, "Incorrect number of properties" );
-      std::transform( rhs.data().cbegin(), rhs.data().cend(),
-                      m_vec.cbegin(), m_vec.begin(),
-                      []( tk::real s, tk::real d ){ return d*s; } );
+    template< class E >
+    Data& operator*= ( const DataExpr< E >& rhs ) {
+      Assert( rhs.self().nunk() == m_nunk, "Incorrect number of unknowns" );
+      Assert( rhs.self().nprop() == m_nprop, "Incorrect number of properties" );
+      evaluate( rhs.self(), []( value_type& d, tk::real s )
+                { d = static_cast< value_type >( d * s ); } );
       return *this;
     }
-    //! Operator * multiplying by another Data object item by item
-    //! \param[in] rhs Data object to multiply with
-    //! \return Copy of Data object after rhs has been multiplied with
-    //! \details Implemented in terms of compound operator*=
-    Data< Layout > operator* ( const Data< Layout >& rhs )
-    const { return Data< Layout >( *this ) *= rhs; }
 
     //! Compound operator*= multiplying all items by a scalar
     //! \param[in] rhs Scalar to multiply with
     //! \return Reference to ourselves after multiplication
-    Data< Layout >& operator*= ( tk::real rhs ) {
+    Data& operator*= ( tk::real rhs ) {
       // cppcheck-suppress useStlAlgorithm
-      for (auto& v : m_vec) v *= rhs;
+      for (auto& v : m_vec) v = static_cast< value_type >( v * rhs );
       return *this;
     }
-    //! Operator * multiplying all items by a scalar
-    //! \param[in] rhs Scalar to multiply with
-    //! \return Copy of Data object after rhs has been multiplied with
-    //! \details Implemented in terms of compound operator*=
-    Data< Layout > operator* ( tk::real rhs )
-    const { return Data< Layout >( *this ) *= rhs; }
 
     //! Compound operator/=
-    //! \param[in] rhs Data object to divide by
+    //! \param[in] rhs Data object (or expression) to divide by
     //! \return Reference to ourselves after division
-    Data< Layout >& operator/= ( const Data< Layout >& rhs ) {
-      Assert( rhs.nunk() == m_nunk, "Incorrect number of unknowns" );
-      Assert( rhs.nprop() == m_nprop, "Incorrect number of properties" );
-      std::transform( rhs.data().cbegin(), rhs.data().cend(),
-                      m_vec.cbegin(), m_vec.begin(),
-                      []( tk::real s, tk::real d ){ return d/s; } );
+    template< class E >
+    Data& operator/= ( const DataExpr< E >& rhs ) {
+      Assert( rhs.self().nunk() == m_nunk, "Incorrect number of unknowns" );
+      Assert( rhs.self().nprop() == m_nprop, "Incorrect number of properties" );
+      evaluate( rhs.self(), []( value_type& d, tk::real s )
+                { d = static_cast< value_type >( d / s ); } );
       return *this;
     }
-    //! Operator /
-    //! \param[in] rhs Data object to divide by
-    //! \return Copy of Data object after rhs has been divided by
-    //! \details Implemented in terms of compound operator/=
-    Data< Layout > operator/ ( const Data< Layout >& rhs )
-    const { return Data< Layout >( *this ) /= rhs; }
 
     //! Compound operator/= dividing all items by a scalar
     //! \param[in] rhs Scalar to divide with
     //! \return Reference to ourselves after division
-    Data< Layout >& operator/= ( tk::real rhs ) {
+    Data& operator/= ( tk::real rhs ) {
       // cppcheck-suppress useStlAlgorithm
-      for (auto& v : m_vec) v /= rhs;
+      for (auto& v : m_vec) v = static_cast< value_type >( v / rhs );
       return *this;
     }
-    //! Operator / dividing all items by a scalar
-    //! \param[in] rhs Scalar to divide with
-    //! \return Copy of Data object after rhs has been divided by
-    //! \details Implemented in terms of compound operator/=
-    Data< Layout > operator/ ( tk::real rhs )
-    const { return Data< Layout >( *this ) /= rhs; }
+
+    //! Evaluate a single raw entry (used by expression templates)
+    //! \param[in] i Raw index into the underlying storage
+    //! \return Value stored at raw index i
+    tk::real ev( std::size_t i ) const { return m_vec[i]; }
 
     //! Add new unknown at the end of the container
     //! \param[in] prop Vector of properties to initialize the new unknown with
@@ -422,22 +733,99 @@ class Data {
     void resize( std::size_t count, tk::real value = 0.0 )
     { resize( count, value, int2type< Layout >() ); }
 
+    //! Add new unknowns at the end of the container
+    //! \param[in] block Properties to initialize the new unknowns with: all
+    //!   properties of the first new unknown, followed by those of the second,
+    //!   etc.
+    //! \details Storage is enlarged once for all new unknowns, so this is
+    //!   preferred over calling push_back() for each.
+    void append( const std::vector< tk::real >& block ) {
+      Assert( m_nprop > 0 && block.size() % m_nprop == 0,
+              "Block size must be divisible by the number of properties" );
+      auto u = m_nunk;
+      resize( m_nunk + block.size()/m_nprop, 0.0, int2type< Layout >() );
+      for (std::size_t i=0; i<block.size(); ++u)
+        for (ncomp_t c=0; c<m_nprop; ++c)
+          operator()( u, c, 0 ) = static_cast< value_type >( block[i++] );
+    }
+
     //! Remove a number of unknowns
     //! \param[in] unknown Set of indices of unknowns to remove
     void rm( const std::set< ncomp_t >& unknown ) {
-      auto remove = [ &unknown ]( std::size_t i ) -> bool {
-        if (unknown.find(i) != end(unknown)) return true;
-        return false;
-      };
-      std::size_t last = 0;
-      for(std::size_t i=0; i<m_nunk; ++i, ++last) {
-        while( remove(i) ) ++i;
-        if (i >= m_nunk) break;
-        for (ncomp_t p = 0; p<m_nprop; ++p)
-          m_vec[ last*m_nprop+p ] = m_vec[ i*m_nprop+p ];
+      compact( [&]( ncomp_t i ){ return unknown.find(i) != end(unknown); },
+               int2type< Layout >() );
+    }
+
+    //! Remove a number of unknowns given by a sorted list
+    //! \param[in] unknown Indices of unknowns to remove in increasing order
+    void rmsorted( const std::vector< ncomp_t >& unknown ) {
+      Assert( std::is_sorted( begin(unknown), end(unknown) ),
+              "Indices of unknowns to remove must be sorted" );
+      std::size_t r = 0;
+      compact( [&]( ncomp_t i ){
+                 if (r < unknown.size() && unknown[r] == i) {
+                   while (r < unknown.size() && unknown[r] == i) ++r;
+                   return true;
+                 }
+                 return false; },
+               int2type< Layout >() );
+    }
+
+    //! Remove unknowns flagged
+    //! \param[in] flag Nonzero for each unknown to remove
+    void rmflagged( const std::vector< char >& flag ) {
+      Assert( flag.size() == m_nunk, "Size must equal number of unknowns" );
+      compact( [&]( ncomp_t i ){ return flag[i] != 0; },
+               int2type< Layout >() );
+    }
+
+    //! Reorder unknowns, moving all properties of an unknown together
+    //! \param[in] map Mapping of unknowns: old->new, a permutation of the
+    //!   unknown indices
+    //! \details The permutation is applied in place by following its cycles,
+    //!   so only the properties of two unknowns are stored temporarily.
+    void reorder( const std::vector< std::size_t >& map ) {
+      Assert( map.size() == m_nunk, "Map size must equal number of unknowns" );
+      std::vector< char > done( m_nunk, 0 );
+      std::vector< value_type > a( m_nprop ), b( m_nprop );
+      for (ncomp_t s=0; s<m_nunk; ++s) {
+        if (done[s]) continue;
+        for (ncomp_t c=0; c<m_nprop; ++c) a[c] = operator()( s, c, 0 );
+        auto u = s;
+        do {
+          u = map[u];
+          Assert( u < m_nunk && !done[u], "Map must be a permutation" );
+          for (ncomp_t c=0; c<m_nprop; ++c) {
+            b[c] = operator()( u, c, 0 );
+            operator()( u, c, 0 ) = a[c];
+          }
+          std::swap( a, b );
+          done[u] = 1;
+        } while (u != s);
       }
-      m_vec.resize( last*m_nprop );
-      m_nunk -= unknown.size();
+    }
+
+    //! Renumber unknowns, removing and adding unknowns, e.g., after mesh
+    //!   refinement
+    //! \param[in] map Mapping of unknowns: old->new, unknowns mapped to
+    //!   std::numeric_limits< std::size_t >::max() are removed
+    //! \param[in] nunk Number of unknowns after renumbering
+    //! \param[in] value Value to initialize unknowns not mapped to with
+    //! \details Unlike reorder(), the renumbered data is assembled in new
+    //!   storage, allocated once, as the map need not be a permutation.
+    void remap( const std::vector< std::size_t >& map, std::size_t nunk,
+                tk::real value = 0.0 )
+    {
+      Assert( map.size() == m_nunk, "Map size must equal number of unknowns" );
+      Data d( nunk, m_nprop );
+      d.fill( value );
+      for (ncomp_t u=0; u<m_nunk; ++u) {
+        if (map[u] == std::numeric_limits< std::size_t >::max()) continue;
+        Assert( map[u] < nunk, "Renumbered unknown out of bounds" );
+        for (ncomp_t c=0; c<m_nprop; ++c)
+          d( map[u], c, 0 ) = operator()( u, c, 0 );
+      }
+      *this = std::move( d );
     }
 
     //! Fill vector of unknowns with the same value
@@ -450,13 +838,17 @@ class Data {
     //! \param[in] value Value to fill vector of unknowns with
     inline void fill( ncomp_t component, ncomp_t offset, tk::real value ) {
       auto p = cptr( component, offset );
-      for (ncomp_t i=0; i<m_nunk; ++i) var(p,i) = value;
+      const auto v = static_cast< value_type >( value );
+      for (ncomp_t i=0; i<m_nunk; ++i) var(p,i) = v;
     }
 
     //! Fill full data storage with value
     //! \param[in] value Value to fill data with
-    void fill( tk::real value )
-    { std::fill( begin(m_vec), end(m_vec), value ); }
+    void fill( tk::real value ) {
+      const auto v = static_cast< value_type >( value );
+      segments( [&]( std::size_t b, std::size_t e ){
+        std::fill( begin(m_vec)+b, begin(m_vec)+e, v ); } );
+    }
 
     //! Check if vector of unknowns is empty
     bool empty() const noexcept { return m_vec.empty(); }
@@ -470,7 +862,11 @@ class Data {
     //! \brief Pack/Unpack serialize member function
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
     void pup( PUP::er &p ) {
-      p | m_vec;
+      // The storage uses a custom allocator, so pack the raw array explicitly
+      auto n = m_vec.size();
+      p | n;
+      if (p.isUnpacking()) m_vec.resize( n );
+      PUParray( p, m_vec.data(), n );
       p | m_nunk;
       p | m_nprop;
     }
@@ -486,6 +882,46 @@ class Data {
     //!   Patterns Applied, Addison-Wesley Professional, 2001.
     template< uint8_t m > struct int2type { enum { value = m }; };
 
+    //! Number of unknowns storage is allocated for, given number of unknowns
+    //! \param[in] nu Number of unknowns
+    //! \return Number of unknowns to allocate storage for
+    //! \details The blocked layout pads storage to a whole number of blocks.
+    static std::size_t capacity( std::size_t nu, int2type< UnkEqComp > )
+    { return nu; }
+    static std::size_t capacity( std::size_t nu, int2type< EqCompUnk > )
+    { return nu; }
+    static std::size_t capacity( std::size_t nu, int2type< BlkEqCompUnk > )
+    { return (nu + DataBlkWidth - 1) / DataBlkWidth * DataBlkWidth; }
+
+    //! Call a function for each contiguous range of raw storage holding data
+    //! \param[in] f Function to call with the begin and end raw indices
+    //! \details This skips the padding of the blocked layout, which is kept
+    //!   zero, so that, e.g., an element-wise division does not divide zero by
+    //!   zero.
+    template< class F >
+    void segments( F&& f ) const { segments( f, int2type< Layout >() ); }
+    template< class F, uint8_t L >
+    void segments( F&& f, int2type< L > ) const { f( 0, m_nunk*m_nprop ); }
+    template< class F >
+    void segments( F&& f, int2type< BlkEqCompUnk > ) const {
+      const auto W = DataBlkWidth;
+      const auto full = m_nunk / W;
+      const auto rem = m_nunk % W;
+      if (full > 0) f( 0, full*W*m_nprop );
+      if (rem > 0)
+        for (ncomp_t c=0; c<m_nprop; ++c)
+          f( full*W*m_nprop + c*W, full*W*m_nprop + c*W + rem );
+    }
+
+    //! Evaluate an expression entry by entry into this object in a fused loop
+    //! \param[in] x Expression to evaluate
+    //! \param[in] op Operation combining the evaluated entry with our entry
+    template< class E, class Op >
+    void evaluate( const E& x, Op op ) {
+      segments( [&]( std::size_t b, std::size_t e ){
+        for (auto i=b; i<e; ++i) op( m_vec[i], x.ev(i) ); } );
+    }
+
     //! Overloads for the various const data accesses
     //! \details Requirement: offset + component < nprop, unknown < nunk,
     //!   enforced with an assert in DEBUG mode, see also the constructor.
@@ -494,10 +930,10 @@ class Data {
     //!   a system
     //! \param[in] offset System offset specifying the position of the system of
     //!   equations among other systems
-    //! \return Const reference to data of type tk::real
+    //! \return Const reference to data of type value_type
     //! \see A. Alexandrescu, Modern C++ Design: Generic Programming and Design
     //!   Patterns Applied, Addison-Wesley Professional, 2001.
-    const tk::real&
+    const value_type&
     access( ncomp_t unknown, ncomp_t component, ncomp_t offset,
             int2type< UnkEqComp > ) const
     {
@@ -507,7 +943,7 @@ class Data {
               "unknowns" );
       return m_vec[ unknown*m_nprop + offset + component ];
     }
-    const tk::real&
+    const value_type&
     access( ncomp_t unknown, ncomp_t component, ncomp_t offset,
             int2type< EqCompUnk > ) const
     {
@@ -517,6 +953,17 @@ class Data {
               "unknowns" );
       return m_vec[ (offset+component)*m_nunk + unknown ];
     }
+    const value_type&
+    access( ncomp_t unknown, ncomp_t component, ncomp_t offset,
+            int2type< BlkEqCompUnk > ) const
+    {
+      Assert( offset + component < m_nprop, "Out-of-bounds access: offset + "
+              "component < number of properties" );
+      Assert( unknown < m_nunk, "Out-of-bounds access: unknown < number of "
+              "unknowns" );
+      return m_vec[ (unknown/DataBlkWidth)*DataBlkWidth*m_nprop +
+                    (offset+component)*DataBlkWidth + unknown%DataBlkWidth ];
+    }
 
     // Overloads for the various const ptr to physical variable accesses
     //! \details Requirement: offset + component < nprop, unknown < nunk,
@@ -525,75 +972,197 @@ class Data {
     //!   a system
     //! \param[in] offset System offset specifying the position of the system of
     //!   equations among other systems
-    //! \return Pointer to data of type tk::real for use with var()
+    //! \return Pointer to data of type value_type for use with var()
     //! \see A. Alexandrescu, Modern C++ Design: Generic Programming and Design
     //!   Patterns Applied, Addison-Wesley Professional, 2001.
-    const tk::real*
+    const value_type*
     cptr( ncomp_t component, ncomp_t offset, int2type< UnkEqComp > ) const {
       Assert( offset + component < m_nprop, "Out-of-bounds access: offset + "
               "component < number of properties" );
       return m_vec.data() + component + offset;
     }
-    const tk::real*
+    const value_type*
     cptr( ncomp_t component, ncomp_t offset, int2type< EqCompUnk > ) const {
       Assert( offset + component < m_nprop, "Out-of-bounds access: offset + "
               "component < number of properties" );
       return m_vec.data() + (offset+component)*m_nunk;
     }
+    const value_type*
+    cptr( ncomp_t component, ncomp_t offset, int2type< BlkEqCompUnk > ) const {
+      Assert( offset + component < m_nprop, "Out-of-bounds access: offset + "
+              "component < number of properties" );
+      return m_vec.data() + (offset+component)*DataBlkWidth;
+    }
 
     // Overloads for the various const physical variable accesses
     //!   Requirement: unknown < nunk, enforced with an assert in DEBUG mode,
     //!   see also the constructor.
-    //! \param[in] pt Pointer to data of type tk::real as returned from cptr()
+    //! \param[in] pt Pointer to data of type value_type as returned from cptr()
     //! \param[in] unknown Unknown index
-    //! \return Const reference to data of type tk::real
+    //! \return Const reference to data of type value_type
     //! \see A. Alexandrescu, Modern C++ Design: Generic Programming and Design
     //!   Patterns Applied, Addison-Wesley Professional, 2001.
-    inline const tk::real&
-    var( const tk::real* const pt, ncomp_t unknown, int2type< UnkEqComp > )
+    inline const value_type&
+    var( const value_type* const pt, ncomp_t unknown, int2type< UnkEqComp > )
     const {
       Assert( unknown < m_nunk, "Out-of-bounds access: unknown < number of "
               "unknowns" );
       return *(pt + unknown*m_nprop);
     }
-    inline const tk::real&
-    var( const tk::real* const pt, ncomp_t unknown, int2type< EqCompUnk > )
+    inline const value_type&
+    var( const value_type* const pt, ncomp_t unknown, int2type< EqCompUnk > )
     const {
       Assert( unknown < m_nunk, "Out-of-bounds access: unknown < number of "
               "unknowns" );
       return *(pt + unknown);
     }
+    inline const value_type&
+    var( const value_type* const pt, ncomp_t unknown,
+         int2type< BlkEqCompUnk > ) const {
+      Assert( unknown < m_nunk, "Out-of-bounds access: unknown < number of "
+              "unknowns" );
+      return *(pt + (unknown/DataBlkWidth)*DataBlkWidth*m_nprop +
+                    unknown%DataBlkWidth);
+    }
 
     //! Add new unknown
     //! \param[in] prop Vector of properties to initialize the new unknown with
-    //! \note Only the UnkEqComp overload is provided as this operation would be
-    //!   too inefficient with the EqCompUnk data layout.
     void push_back( const std::vector< tk::real >& prop, int2type< UnkEqComp > )
     {
       Assert( prop.size() == m_nprop, "Incorrect number of properties" );
       m_vec.resize( (m_nunk+1) * m_nprop );
       ncomp_t u = m_nunk;
       ++m_nunk;
-      for (ncomp_t i=0; i<m_nprop; ++i) operator()( u, i, 0 ) = prop[i];
+      for (ncomp_t i=0; i<m_nprop; ++i)
+        operator()( u, i, 0 ) = static_cast< value_type >( prop[i] );
     }
 
-    void push_back( const std::vector< tk::real >&, int2type< EqCompUnk > )
-    { Throw( "Not implented. It would be inefficient" ); }
+    //! \details With the EqCompUnk data layout this moves all components but
+    //!   the first, so use append() to add more than a single unknown.
+    void push_back( const std::vector< tk::real >& prop, int2type< EqCompUnk > )
+    {
+      Assert( prop.size() == m_nprop, "Incorrect number of properties" );
+      resize( m_nunk+1, 0.0, int2type< EqCompUnk >() );
+      for (ncomp_t i=0; i<m_nprop; ++i)
+        operator()( m_nunk-1, i, 0 ) = static_cast< value_type >( prop[i] );
+    }
+
+    void push_back( const std::vector< tk::real >& prop,
+                    int2type< BlkEqCompUnk > )
+    {
+      Assert( prop.size() == m_nprop, "Incorrect number of properties" );
+      m_vec.resize( capacity( m_nunk+1, int2type< BlkEqCompUnk >() ) *
+                    m_nprop );
+      ncomp_t u = m_nunk;
+      ++m_nunk;
+      for (ncomp_t i=0; i<m_nprop; ++i)
+        operator()( u, i, 0 ) = static_cast< value_type >( prop[i] );
+    }
 
     //! Resize data store to contain 'count' elements
     //! \param[in] count Resize store to contain 'count' elements
     //! \param[in] value Value to initialize new data with
-    //! \note Only the UnkEqComp overload is provided as this operation would be
-    //!   too inefficient with the EqCompUnk data layout.
     //! \note This works for both shrinking and enlarging, as this simply
     //!   translates to std::vector::resize().
     void resize( std::size_t count, tk::real value, int2type< UnkEqComp > ) {
-      m_vec.resize( count * m_nprop, value );
+      m_vec.resize( count * m_nprop, static_cast< value_type >( value ) );
       m_nunk = count;
     }
 
-    void resize( std::size_t, tk::real, int2type< EqCompUnk > ) {
-      Throw( "Not implented. It would be inefficient" );
+    //! \details With the EqCompUnk data layout the components are moved in
+    //!   place to their new positions: forward when shrinking, backward
+    //!   (after enlarging the storage) when enlarging.
+    void resize( std::size_t count, tk::real value, int2type< EqCompUnk > ) {
+      const auto old = m_nunk;
+      if (count < old) {
+        for (ncomp_t c=1; c<m_nprop; ++c)
+          std::copy( begin(m_vec) + c*old, begin(m_vec) + c*old + count,
+                     begin(m_vec) + c*count );
+        m_vec.resize( count * m_nprop );
+      } else if (count > old) {
+        m_vec.resize( count * m_nprop );
+        const auto v = static_cast< value_type >( value );
+        for (auto c=m_nprop; c-- > 0; ) {
+          if (c > 0)
+            std::copy_backward( begin(m_vec) + c*old,
+                                begin(m_vec) + (c+1)*old,
+                                begin(m_vec) + c*count + old );
+          std::fill( begin(m_vec) + c*count + old,
+                     begin(m_vec) + (c+1)*count, v );
+        }
+      }
+      m_nunk = count;
+    }
+
+    //! \details Since the position of an unknown in the blocked layout only
+    //!   depends on its own index (and not on the number of unknowns), existing
+    //!   data stays in place. Padding in the last block is kept zero.
+    void resize( std::size_t count, tk::real value, int2type< BlkEqCompUnk > )
+    {
+      auto old = m_nunk;
+      m_vec.resize( capacity( count, int2type< BlkEqCompUnk >() ) * m_nprop );
+      m_nunk = count;
+      if (count > old) {
+        // initialize new unknowns, including those in the old partial block
+        for (auto u=old; u<count; ++u)
+          for (ncomp_t c=0; c<m_nprop; ++c)
+            operator()( u, c, 0 ) = static_cast< value_type >( value );
+      } else {
+        // zero padding of the new partial block
+        auto e = capacity( count, int2type< BlkEqCompUnk >() );
+        for (auto u=count; u<e; ++u)
+          for (ncomp_t c=0; c<m_nprop; ++c)
+            m_vec[ (u/DataBlkWidth)*DataBlkWidth*m_nprop + c*DataBlkWidth +
+                   u%DataBlkWidth ] = 0.0;
+      }
+    }
+
+    //! Remove unknowns, keeping the order of the rest, in a single pass
+    //! \param[in] remove Function returning true if the unknown whose index
+    //!   it is called with is to be removed, called once for each unknown in
+    //!   increasing order
+    template< class F >
+    void compact( F&& remove, int2type< UnkEqComp > ) {
+      std::size_t last = 0;
+      for (std::size_t i=0; i<m_nunk; ++i) {
+        if (remove(i)) continue;
+        if (i != last)
+          std::copy( begin(m_vec) + i*m_nprop, begin(m_vec) + (i+1)*m_nprop,
+                     begin(m_vec) + last*m_nprop );
+        ++last;
+      }
+      m_vec.resize( last*m_nprop );
+      m_nunk = last;
+    }
+
+    //! \details The EqCompUnk data layout first collects the unknowns kept,
+    //!   then moves each component to its new position, which never follows
+    //!   its old one.
+    template< class F >
+    void compact( F&& remove, int2type< EqCompUnk > ) {
+      std::vector< std::size_t > keep;
+      for (std::size_t i=0; i<m_nunk; ++i) if (!remove(i)) keep.push_back( i );
+      const auto n = keep.size();
+      for (ncomp_t c=0; c<m_nprop; ++c)
+        for (std::size_t k=0; k<n; ++k)
+          m_vec[ c*n + k ] = m_vec[ c*m_nunk + keep[k] ];
+      m_vec.resize( n*m_nprop );
+      m_nunk = n;
+    }
+
+    //! \details The blocked layout compacts unknowns via the generic data
+    //!   access, as unknowns are not stored contiguously.
+    template< class F >
+    void compact( F&& remove, int2type< BlkEqCompUnk > ) {
+      std::size_t last = 0;
+      for (std::size_t i=0; i<m_nunk; ++i) {
+        if (remove(i)) continue;
+        if (i != last)
+          for (ncomp_t p=0; p<m_nprop; ++p)
+            operator()( last, p, 0 ) = operator()( i, p, 0 );
+        ++last;
+      }
+      resize( last, 0.0, int2type< BlkEqCompUnk >() );
     }
 
     // Overloads for the name-queries of data lauouts
@@ -604,20 +1173,76 @@ class Data {
     { return "unknown-major"; }
     static std::string layout( int2type< EqCompUnk > )
     { return "equation-major"; }
+    static std::string layout( int2type< BlkEqCompUnk > )
+    { return "block-major"; }
 
-    std::vector< tk::real > m_vec;      //!< Data pointer
+    std::vector< value_type, Alloc > m_vec; //!< Data pointer
     ncomp_t m_nunk;                     //!< Number of unknowns
     ncomp_t m_nprop;                    //!< Number of properties/unknown
 };
 
+//! Operator + between two Data objects (or expressions), evaluated lazily
+//! \param[in] l Left operand
+//! \param[in] r Right operand
+//! \return Expression adding the operands entry by entry
+template< class L, class R >
+DataBinExpr< L, R, std::plus< tk::real > >
+operator+ ( const DataExpr< L >& l, const DataExpr< R >& r )
+{ return { l.self(), r.self() }; }
+
+//! Operator - between two Data objects (or expressions), evaluated lazily
+//! \param[in] l Left operand
+//! \param[in] r Right operand
+//! \return Expression subtracting the operands entry by entry
+template< class L, class R >
+DataBinExpr< L, R, std::minus< tk::real > >
+operator- ( const DataExpr< L >& l, const DataExpr< R >& r )
+{ return { l.self(), r.self() }; }
+
+//! Operator * between two Data objects (or expressions), evaluated lazily
+//! \param[in] l Left operand
+//! \param[in] r Right operand
+//! \return Expression multiplying the operands entry by entry
+template< class L, class R >
+DataBinExpr< L, R, std::multiplies< tk::real > >
+operator* ( const DataExpr< L >& l, const DataExpr< R >& r )
+{ return { l.self(), r.self() }; }
+
+//! Operator / between two Data objects (or expressions), evaluated lazily
+//! \param[in] l Left operand
+//! \param[in] r Right operand
+//! \return Expression dividing the operands entry by entry
+template< class L, class R >
+DataBinExpr< L, R, std::divides< tk::real > >
+operator/ ( const DataExpr< L >& l, const DataExpr< R >& r )
+{ return { l.self(), r.self() }; }
+
+//! Operator * multiplying all items by a scalar from the right
+//! \param[in] l Data object (or expression) to multiply
+//! \param[in] r Scalar to multiply with
+//! \return Expression with all items multipled with r
+template< class L >
+DataBinExpr< L, DataScalar, std::multiplies< tk::real > >
+operator* ( const DataExpr< L >& l, tk::real r )
+{ return { l.self(), DataScalar( r ) }; }
+
 //! Operator * multiplying all items by a scalar from the left
-//! \param[in] lhs Scalar to multiply with
-//! \param[in] rhs Date object to multiply
-//! \return New Data object with all items multipled with lhs
-template< uint8_t Layout >
-Data< Layout > operator* ( tk::real lhs, const Data< Layout >& rhs ) {
-  return Data< Layout >( rhs ) *= lhs;
-}
+//! \param[in] l Scalar to multiply with
+//! \param[in] r Data object (or expression) to multiply
+//! \return Expression with all items multipled with l
+template< class R >
+DataBinExpr< DataScalar, R, std::multiplies< tk::real > >
+operator* ( tk::real l, const DataExpr< R >& r )
+{ return { DataScalar( l ), r.self() }; }
+
+//! Operator / dividing all items by a scalar
+//! \param[in] l Data object (or expression) to divide
+//! \param[in] r Scalar to divide with
+//! \return Expression with all items divided by r
+template< class L >
+DataBinExpr< L, DataScalar, std::divides< tk::real > >
+operator/ ( const DataExpr< L >& l, tk::real r )
+{ return { l.self(), DataScalar( r ) }; }
 
 //! Operator min between two Data objects
 //! \param[in] a 1st Data object
@@ -628,11 +1253,12 @@ Data< Layout > operator* ( tk::real lhs, const Data< Layout >& rhs ) {
 //!   unknowns and properties.
 //! \note As opposed to std::min, this function creates and returns a new object
 //!   instead of returning a reference to one of the operands.
-template< uint8_t Layout >
-Data< Layout > min( const Data< Layout >& a, const Data< Layout >& b ) {
+template< uint8_t Layout, class Alloc >
+Data< Layout, Alloc >
+min( const Data< Layout, Alloc >& a, const Data< Layout, Alloc >& b ) {
   Assert( a.nunk() == b.nunk(), "Number of unknowns unequal" );
   Assert( a.nprop() == b.nprop(), "Number of properties unequal" );
-  Data< Layout > r( a.nunk(), a.nprop() );
+  Data< Layout, Alloc > r( a.nunk(), a.nprop() );
   std::transform( a.data().cbegin(), a.data().cend(),
                   b.data().cbegin(), r.data().begin(),
                   []( tk::real s, tk::real d ){ return std::min(s,d); } );
@@ -649,11 +1275,12 @@ Data< Layout > min( const Data< Layout >& a, const Data< Layout >& b ) {
 //!   unknowns and properties.
 //! \note As opposed to std::max, this function creates and returns a new object
 //!   instead of returning a reference to one of the operands.
-template< uint8_t Layout >
-Data< Layout > max( const Data< Layout >& a, const Data< Layout >& b ) {
+template< uint8_t Layout, class Alloc >
+Data< Layout, Alloc >
+max( const Data< Layout, Alloc >& a, const Data< Layout, Alloc >& b ) {
   Assert( a.nunk() == b.nunk(), "Number of unknowns unequal" );
   Assert( a.nprop() == b.nprop(), "Number of properties unequal" );
-  Data< Layout > r( a.nunk(), a.nprop() );
+  Data< Layout, Alloc > r( a.nunk(), a.nprop() );
   std::transform( a.data().cbegin(), a.data().cend(),
                   b.data().cbegin(), r.data().begin(),
                   []( tk::real s, tk::real d ){ return std::max(s,d); } );
@@ -664,8 +1291,10 @@ Data< Layout > max( const Data< Layout >& a, const Data< Layout >& b ) {
 //! \param[in] lhs Data object to compare
 //! \param[in] rhs Data object to compare
 //! \return True if all entries are equal up to epsilon
-template< uint8_t Layout >
-bool operator== ( const Data< Layout >& lhs, const Data< Layout >& rhs ) {
+template< uint8_t Layout, class Alloc >
+bool operator== ( const Data< Layout, Alloc >& lhs,
+                  const Data< Layout, Alloc >& rhs )
+{
   Assert( rhs.nunk() == lhs.nunk(), "Incorrect number of unknowns" );
   Assert( rhs.nprop() == lhs.nprop(), "Incorrect number of properties" );
   auto l = lhs.data().cbegin();
@@ -682,8 +1311,9 @@ bool operator== ( const Data< Layout >& lhs, const Data< Layout >& rhs ) {
 //! \param[in] lhs Data object to compare
 //! \param[in] rhs Data object to compare
 //! \return True if all entries are unequal up to epsilon
-template< uint8_t Layout >
-bool operator!= ( const Data< Layout >& lhs, const Data< Layout >& rhs )
+template< uint8_t Layout, class Alloc >
+bool operator!= ( const Data< Layout, Alloc >& lhs,
+                  const Data< Layout, Alloc >& rhs )
 { return !(lhs == rhs); }
 
 //! Compute the maximum difference between the elements of two Data objects
@@ -697,9 +1327,9 @@ bool operator!= ( const Data< Layout >& lhs, const Data< Layout >& rhs )
 //!   is returned.
 //! \note The Data objects _lhs_ and _rhs_ must have the same number of
 //!   unknowns and properties.
-template< uint8_t Layout >
+template< uint8_t Layout, class Alloc >
 std::pair< std::size_t, tk::real >
-maxdiff( const Data< Layout >& lhs, const Data< Layout >& rhs ) {
+maxdiff( const Data< Layout, Alloc >& lhs, const Data< Layout, Alloc >& rhs ) {
   Assert( lhs.nunk() == rhs.nunk(), "Number of unknowns unequal" );
   Assert( lhs.nprop() == rhs.nprop(), "Number of properties unequal" );
   auto l = lhs.data().cbegin();
@@ -0,0 +1,137 @@
+// *****************************************************************************
+/*!
+  \file      src/Base/ExternalSort.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Sorting of binary files of fixed-size records larger than memory
+  \details   Sorting of binary files of fixed-size, trivially copyable records
+    that may be larger than the memory available. tk::externalSort() sorts the
+    file in chunks of records that fit in memory, writes each sorted chunk, a
+    run, to a temporary file, and merges the runs into the sorted output file.
+    The memory required is bounded by the chunk size and the number of runs.
+*/
+// *****************************************************************************
+#ifndef ExternalSort_h
+#define ExternalSort_h
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <queue>
+#include <cstdio>
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+
+#include "Exception.hpp"
+
+namespace tk {
+
+//! Read a chunk of records from a binary stream
+//! \param[in,out] is Stream to read from
+//! \param[out] rec Records read, resized to the number of records read
+//! \param[in] n Maximum number of records to read
+//! \return True if at least a single record has been read
+template< class Record >
+bool readRecords( std::istream& is, std::vector< Record >& rec, std::size_t n )
+{
+  static_assert( std::is_trivially_copyable_v< Record >,
+                 "Record must be trivially copyable" );
+  rec.resize( n );
+  is.read( reinterpret_cast< char* >( rec.data() ),
+           static_cast< std::streamsize >( n * sizeof(Record) ) );
+  rec.resize( static_cast< std::size_t >( is.gcount() ) / sizeof(Record) );
+  return !rec.empty();
+}
+
+//! Write records to a binary stream
+//! \param[in,out] os Stream to write to
+//! \param[in] rec Records to write
+template< class Record >
+void writeRecords( std::ostream& os, const std::vector< Record >& rec ) {
+  static_assert( std::is_trivially_copyable_v< Record >,
+                 "Record must be trivially copyable" );
+  os.write( reinterpret_cast< const char* >( rec.data() ),
+            static_cast< std::streamsize >( rec.size() * sizeof(Record) ) );
+}
+
+//! Sort a binary file of records that may not fit in memory
+//! \param[in] in Name of the file to sort
+//! \param[in] out Name of the file to write the sorted records to, different
+//!   from in. Runs are written to temporary files named out.run<k>.
+//! \param[in] chunk Number of records to sort in memory at a time
+//! \param[in] less Comparator defining the order of records
+//! \details The sort is stable: records comparing equal keep their order in
+//!   the input file.
+template< class Record, class Less >
+void externalSort( const std::string& in,
+                   const std::string& out,
+                   std::size_t chunk,
+                   Less less )
+{
+  Assert( chunk > 0, "Chunk size must be positive" );
+
+  // Sort chunks of records and write them to runs
+  std::vector< std::string > runs;
+  {
+    std::ifstream is( in, std::ios::binary );
+    ErrChk( is.good(), "Failed to open file: " + in );
+    std::vector< Record > rec;
+    while (readRecords( is, rec, chunk )) {
+      std::stable_sort( begin(rec), end(rec), less );
+      runs.push_back( out + ".run" + std::to_string( runs.size() ) );
+      std::ofstream os( runs.back(), std::ios::binary );
+      writeRecords( os, rec );
+      ErrChk( !os.bad(), "Failed to write to file: " + runs.back() );
+    }
+  }
+
+  // Merge runs, reading a chunk of records of each run at a time, keeping
+  // the order of runs for records comparing equal
+  const auto nrun = runs.size();
+  const auto nbuf = std::max< std::size_t >( 1, chunk / (nrun + 1) );
+  std::vector< std::ifstream > is( nrun );
+  std::vector< std::vector< Record > > buf( nrun );
+  std::vector< std::size_t > pos( nrun, 0 );
+  using Head = std::pair< Record, std::size_t >;
+  auto greater = [&]( const Head& a, const Head& b ){
+    if (less( b.first, a.first )) return true;
+    if (less( a.first, b.first )) return false;
+    return a.second > b.second; };
+  std::priority_queue< Head, std::vector< Head >, decltype(greater) >
+    heads( greater );
+  for (std::size_t r=0; r<nrun; ++r) {
+    is[r].open( runs[r], std::ios::binary );
+    ErrChk( is[r].good(), "Failed to open file: " + runs[r] );
+    if (readRecords( is[r], buf[r], nbuf )) heads.emplace( buf[r][0], r );
+  }
+
+  std::ofstream os( out, std::ios::binary );
+  ErrChk( os.good(), "Failed to open file: " + out );
+  std::vector< Record > merged;
+  merged.reserve( nbuf );
+  while (!heads.empty()) {
+    auto r = heads.top().second;
+    merged.push_back( heads.top().first );
+    heads.pop();
+    if (merged.size() == nbuf) { writeRecords( os, merged ); merged.clear(); }
+    if (++pos[r] == buf[r].size()) {
+      pos[r] = 0;
+      if (!readRecords( is[r], buf[r], nbuf )) continue;
+    }
+    heads.emplace( buf[r][ pos[r] ], r );
+  }
+  writeRecords( os, merged );
+  ErrChk( !os.bad(), "Failed to write to file: " + out );
+
+  for (std::size_t r=0; r<nrun; ++r) {
+    is[r].close();
+    std::remove( runs[r].c_str() );
+  }
+}
+
+} // tk::
+
+#endif // ExternalSort_h
@@ -22,9 +22,27 @@ namespace tk {
 
 //! Select data layout policy for mesh node properties at compile-time
 #if   defined FIELD_DATA_LAYOUT_AS_FIELD_MAJOR
-using Fields = Data< UnkEqComp >;
+const uint8_t FieldLayout = UnkEqComp;
 #elif defined FIELD_DATA_LAYOUT_AS_EQUATION_MAJOR
-using Fields = Data< EqCompUnk >;
+const uint8_t FieldLayout = EqCompUnk;
+#elif defined FIELD_DATA_LAYOUT_AS_BLOCK_MAJOR
+const uint8_t FieldLayout = BlkEqCompUnk;
+#endif
+
+//! Fields used to store data associated to mesh entities
+using Fields = Data< FieldLayout >;
+
+//! \brief Fields stored in reduced (single) precision to save memory bandwidth
+//! \details ReducedFields uses the same data layout as Fields, but if
+//!   FIELD_REDUCED_PRECISION is configured, stores its entries as float. Entries
+//!   are promoted to tk::real whenever read, so arithmetic (and accumulation)
+//!   remains in tk::real, and only the stores are rounded. Suitable for derived
+//!   quantities that are recomputed often, e.g., nodal gradients or the lumped
+//!   mass matrix, but not for the solution itself.
+#if defined FIELD_REDUCED_PRECISION
+using ReducedFields = Data< FieldLayout, AlignedAllocator< float > >;
+#else
+using ReducedFields = Fields;
 #endif
 
 } // tk::
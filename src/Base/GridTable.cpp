@@ -0,0 +1,51 @@
+// *****************************************************************************
+/*!
+  \file      src/Base/GridTable.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Discrete functions of two variables on a uniform grid
+  \details   Discrete functions of two variables on a uniform grid, see
+    GridTable.hpp.
+*/
+// *****************************************************************************
+
+#include <string>
+#include <utility>
+
+#include "GridTable.hpp"
+
+tk::GridTable::GridTable( std::size_t nfunc,
+                          const std::array< tk::real, 2 >& xrange,
+                          std::size_t nx,
+                          const std::array< tk::real, 2 >& yrange,
+                          std::size_t ny,
+                          std::vector< tk::real > values ) : m_data()
+// *****************************************************************************
+//  Constructor: store functions tabulated on a uniform grid
+//! \param[in] nfunc Number of functions tabulated
+//! \param[in] xrange Smallest and largest x of the grid
+//! \param[in] nx Number of grid points in x, at least two
+//! \param[in] yrange Smallest and largest y of the grid
+//! \param[in] ny Number of grid points in y, at least two
+//! \param[in] values Function values at the grid points, index:
+//!   (i*ny + j)*nfunc + k for function k at the grid point (i,j), i.e., at
+//!   x = xrange[0] + i*(xrange[1]-xrange[0])/(nx-1) and y likewise
+// *****************************************************************************
+{
+  ErrChk( nfunc > 0, "No functions to tabulate" );
+  ErrChk( nx > 1 && ny > 1, "Grid table needs at least two points in each "
+          "direction" );
+  ErrChk( xrange[1] > xrange[0] && yrange[1] > yrange[0],
+          "Grid table range must be increasing" );
+  ErrChk( values.size() == nx*ny*nfunc, "Number of values tabulated, " +
+          std::to_string( values.size() ) + ", inconsistent with grid size, " +
+          std::to_string( nx*ny*nfunc ) );
+
+  m_data = std::make_shared< const Data >( Data{ nfunc, nx, ny,
+    xrange, yrange,
+    static_cast< tk::real >( nx - 1 ) / (xrange[1] - xrange[0]),
+    static_cast< tk::real >( ny - 1 ) / (yrange[1] - yrange[0]),
+    std::move( values ) } );
+}
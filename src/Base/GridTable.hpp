@@ -0,0 +1,175 @@
+// *****************************************************************************
+/*!
+  \file      src/Base/GridTable.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Discrete functions of two variables on a uniform grid
+  \details   Storage and bilinear interpolation of a few discrete functions
+    f_k(x,y) tabulated on the same uniform grid, e.g., the pressure, speed of
+    sound, and temperature of a tabulated equation of state. The values of
+    all functions at a grid point are stored next to each other, and the grid
+    points of a row in y are contiguous, so interpolating all functions at a
+    point reads two short contiguous runs of memory. The table is immutable
+    once built and is shared by the copies of a tk::GridTable.
+*/
+// *****************************************************************************
+#ifndef GridTable_h
+#define GridTable_h
+
+#include <array>
+#include <vector>
+#include <memory>
+#include <algorithm>
+
+#include "Types.hpp"
+#include "Exception.hpp"
+
+namespace tk {
+
+//! Discrete functions of two variables on a uniform grid
+class GridTable {
+
+  public:
+    //! Empty table
+    explicit GridTable() = default;
+
+    //! Constructor: store functions tabulated on a uniform grid
+    explicit GridTable( std::size_t nfunc,
+                        const std::array< tk::real, 2 >& xrange,
+                        std::size_t nx,
+                        const std::array< tk::real, 2 >& yrange,
+                        std::size_t ny,
+                        std::vector< tk::real > values );
+
+    //! Query if the table is empty
+    //! \return True if no functions have been tabulated
+    bool empty() const noexcept { return !m_data; }
+
+    //! Number of functions tabulated
+    //! \return Number of functions tabulated
+    std::size_t nfunc() const noexcept { return m_data ? m_data->nfunc : 0; }
+
+    //! Accessor to the range of x tabulated
+    //! \return Smallest and largest x of the grid
+    const std::array< tk::real, 2 >& xrange() const
+    { Assert( m_data, "Empty table" ); return m_data->xrange; }
+
+    //! Accessor to the range of y tabulated
+    //! \return Smallest and largest y of the grid
+    const std::array< tk::real, 2 >& yrange() const
+    { Assert( m_data, "Empty table" ); return m_data->yrange; }
+
+    //! Sample function k at (x,y)
+    //! \param[in] x Value of the first variable
+    //! \param[in] y Value of the second variable
+    //! \param[in] k Index of the function to sample
+    //! \return Bilinearly interpolated value of function k
+    //! \details Outside of the grid the value at the nearest point of the
+    //!   boundary of the grid is returned, no extrapolation is performed.
+    tk::real sample( tk::real x, tk::real y, std::size_t k ) const {
+      Assert( m_data && k < m_data->nfunc, "Function index out of bounds" );
+      const auto c = cell( x, y );
+      const auto& v = m_data->values;
+      const auto nf = m_data->nfunc;
+      const auto o = c.n + k;
+      return (1.0-c.s) * ((1.0-c.t)*v[o] + c.t*v[o+nf])
+             + c.s * ((1.0-c.t)*v[o+c.dx] + c.t*v[o+c.dx+nf]);
+    }
+
+    //! Sample all functions at (x,y)
+    //! \tparam Out Container type of the function values, indexed by function
+    //! \param[in] x Value of the first variable
+    //! \param[in] y Value of the second variable
+    //! \param[in,out] f Function values sampled, must hold at least nfunc()
+    //!   entries
+    //! \details The grid cell and the interpolation weights are computed once
+    //!   for all functions. See also the single-function sample().
+    template< class Out >
+    void sample( tk::real x, tk::real y, Out& f ) const {
+      Assert( m_data, "Empty table" );
+      const auto c = cell( x, y );
+      const auto& v = m_data->values;
+      const auto nf = m_data->nfunc;
+      for (std::size_t k=0; k<nf; ++k) {
+        const auto o = c.n + k;
+        f[k] = (1.0-c.s) * ((1.0-c.t)*v[o] + c.t*v[o+nf])
+               + c.s * ((1.0-c.t)*v[o+c.dx] + c.t*v[o+c.dx+nf]);
+      }
+    }
+
+    //! Sample function k at a batch of points
+    //! \tparam X Container type of the first variables, indexed by point
+    //! \tparam Y Container type of the second variables, indexed by point
+    //! \tparam Out Container type of the function values, indexed by point
+    //! \param[in] n Number of points
+    //! \param[in] x Values of the first variable
+    //! \param[in] y Values of the second variable
+    //! \param[in] k Index of the function to sample
+    //! \param[in,out] f Function values sampled, must hold at least n entries
+    //! \details Locating the grid cell of a point involves no branches, so
+    //!   the loop over the points carries no dependencies and can be
+    //!   vectorized, with gathers of the tabulated values.
+    template< class X, class Y, class Out >
+    void sample( std::size_t n, const X& x, const Y& y, std::size_t k, Out& f )
+    const {
+      Assert( m_data && k < m_data->nfunc, "Function index out of bounds" );
+      #pragma omp simd
+      for (std::size_t i=0; i<n; ++i) f[i] = sample( x[i], y[i], k );
+    }
+
+  private:
+    //! Grid cell containing a point and interpolation weights in the cell
+    struct Cell {
+      std::size_t n;            //!< Offset of the values at the lower corner
+      std::size_t dx;           //!< Offset of the next grid point in x
+      tk::real s;               //!< Weight of the upper grid point in x
+      tk::real t;               //!< Weight of the upper grid point in y
+    };
+
+    //! Tabulated functions, read-only once constructed
+    struct Data {
+      //! Number of functions tabulated
+      std::size_t nfunc;
+      //! Number of grid points in x and y
+      std::size_t nx, ny;
+      //! Smallest and largest x of the grid
+      std::array< tk::real, 2 > xrange;
+      //! Smallest and largest y of the grid
+      std::array< tk::real, 2 > yrange;
+      //! Inverse grid spacing in x and y
+      tk::real rdx, rdy;
+      //! Function values, index: (i*ny + j)*nfunc + k for function k at the
+      //! grid point (i,j)
+      std::vector< tk::real > values;
+    };
+
+    //! Table data shared among copies
+    std::shared_ptr< const Data > m_data;
+
+    //! Find the grid cell containing a point
+    //! \param[in] x Value of the first variable
+    //! \param[in] y Value of the second variable
+    //! \return Grid cell containing (x,y), clipped to the grid
+    //! \details The coordinates are clipped to the grid and the cell index is
+    //!   clipped to the last cell using min and max only, which compile to
+    //!   branch-free instructions, so the cost of the lookup does not depend
+    //!   on the data.
+    Cell cell( tk::real x, tk::real y ) const noexcept {
+      const auto& d = *m_data;
+      const auto mx = static_cast< tk::real >( d.nx - 1 );
+      const auto my = static_cast< tk::real >( d.ny - 1 );
+      const auto u = std::min( std::max( (x-d.xrange[0])*d.rdx, 0.0 ), mx );
+      const auto w = std::min( std::max( (y-d.yrange[0])*d.rdy, 0.0 ), my );
+      const auto i = std::min( static_cast< std::size_t >( u ), d.nx - 2 );
+      const auto j = std::min( static_cast< std::size_t >( w ), d.ny - 2 );
+      return { (i*d.ny + j)*d.nfunc, d.ny*d.nfunc,
+               u - static_cast< tk::real >( i ),
+               w - static_cast< tk::real >( j ) };
+    }
+};
+
+} // tk::
+
+#endif // GridTable_h
@@ -0,0 +1,37 @@
+// *****************************************************************************
+/*!
+  \file      src/Base/ISA.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Instruction set dispatch of hot loops
+  \details   Instruction set dispatch of hot loops, see ISA.hpp.
+*/
+// *****************************************************************************
+
+#include "ISA.hpp"
+
+std::string
+tk::isa()
+// *****************************************************************************
+//  Query the instruction set selected for multiversioned functions
+//! \return Name of the instruction set whose variants of the functions marked
+//!   with TK_MULTIVERSION run on this host
+//! \details The instruction sets are queried in the order of preference of
+//!   the dispatch, see TK_MULTIVERSION.
+// *****************************************************************************
+{
+#if defined(STRICT_GNUC) && defined(__linux__) && defined(__x86_64__)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports( "avx512f" )) return "avx512f";
+  if (__builtin_cpu_supports( "avx2" )) return "avx2";
+  return "default";
+#elif defined(STRICT_GNUC) && defined(__linux__) && defined(__aarch64__) && \
+      __GNUC__ >= 14
+  if (__builtin_cpu_supports( "sve" )) return "sve";
+  return "default";
+#else
+  return "default (no multiversioning)";
+#endif
+}
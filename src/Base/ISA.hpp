@@ -0,0 +1,48 @@
+// *****************************************************************************
+/*!
+  \file      src/Base/ISA.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Instruction set dispatch of hot loops
+  \details   Instruction set dispatch of hot loops. A single executable built
+    for the lowest common instruction set can run on hosts with wider SIMD
+    units: functions marked with TK_MULTIVERSION are compiled for each
+    instruction set listed and the variant for the widest one supported by
+    the host is selected once, by the dynamic loader, at startup.
+*/
+// *****************************************************************************
+#ifndef ISA_h
+#define ISA_h
+
+#include <string>
+
+#include "Macro.hpp"
+
+//! \brief Compile a function for several instruction sets and dispatch to the
+//!   widest one the host supports at runtime
+//! \details Uses function multiversioning via target_clones, which requires
+//!   ifunc support of the dynamic loader, so it is only enabled with gcc on
+//!   Linux. It works on functions in translation units as well as on inline
+//!   functions and function templates in headers. Functions called by a
+//!   multiversioned function are compiled for its instruction set if
+//!   inlined, so it is enough to mark the outermost function of a hot loop.
+#if defined(STRICT_GNUC) && defined(__linux__) && defined(__x86_64__)
+  #define TK_MULTIVERSION \
+    __attribute__(( target_clones( "avx512f", "avx2", "default" ) ))
+#elif defined(STRICT_GNUC) && defined(__linux__) && defined(__aarch64__) && \
+      __GNUC__ >= 14
+  #define TK_MULTIVERSION __attribute__(( target_clones( "sve", "default" ) ))
+#else
+  #define TK_MULTIVERSION
+#endif
+
+namespace tk {
+
+//! Query the instruction set selected for multiversioned functions
+std::string isa();
+
+} // tk::
+
+#endif // ISA_h
@@ -12,6 +12,8 @@
 // *****************************************************************************
 
 #include <limits>
+#include <cmath>
+#include <algorithm>
 
 #include "Types.hpp"
 #include "LoadDistributor.hpp"
@@ -90,4 +92,76 @@ linearLoadDistributor( real virtualization,
   return nchare;
 }
 
+real
+autoVirtualization( uint64_t load,
+                    int npe,
+                    real loadcost,
+                    real latency,
+                    real overhead,
+                    std::size_t nphase )
+// *****************************************************************************
+//  Compute the degree of virtualization minimizing the modeled time of a time
+//  step
+//! \param[in] load Total load, e.g., number of mesh cells
+//! \param[in] npe Number of processing elements to distribute the load to
+//! \param[in] loadcost Time (in seconds) of computing a time step for a unit
+//!   of load, e.g., measured right hand side time per mesh cell
+//! \param[in] latency Message latency in seconds
+//! \param[in] overhead Time in seconds a processing element spends on sending
+//!   or receiving a message
+//! \param[in] nphase Number of communication phases per time step, i.e.,
+//!   number of times per time step chares wait for their neighbors
+//! \return Degree of virtualization [0.0...1.0], to be passed to
+//!   linearLoadDistributor()
+//! \details The time of a time step on a processing element with k chares is
+//!   modeled as
+//!
+//!   T(k) = w (1 + s) + p max(0, L - w/p (k-1)/k) + p k d o,
+//!
+//!   where
+//!    - w = load/npe * loadcost, the computational work of a PE,
+//!    - s = 6 (load/(npe k))^(-1/3), the (approximate) fraction of the work of
+//!      a chare on its boundary, done twice by neighboring chares,
+//!    - p = nphase, L = latency, o = overhead,
+//!    - d = min(14, npe k - 1), the number of neighbors of a chare.
+//!
+//!   The second term is the exposed latency: while a chare waits for its
+//!   neighbors, the other k-1 chares on the PE can compute, hiding (part of)
+//!   the latency. The third term is the cost of messages sent by all chares.
+//!   Thus over-decomposition pays if the latency is large compared to the
+//!   work between communication phases and messages are cheap. The number of
+//!   chares per PE is searched among 1...min(load/npe,1024).
+// *****************************************************************************
+{
+  Assert( npe > 0, "Number of processing elements must be larger than zero" );
+  Assert( nphase > 0, "Number of communication phases must be positive" );
+
+  // Compute load per PE
+  const auto n = static_cast< real >( load ) / npe;
+  if (n < 2.0) return 0.0;
+
+  const auto w = n * loadcost;
+  const auto p = static_cast< real >( nphase );
+  const auto kmax = static_cast< uint64_t >( std::min( n, 1024.0 ) );
+
+  auto best = std::numeric_limits< real >::max();
+  uint64_t bestk = 1;
+  for (uint64_t k=1; k<=kmax; ++k) {
+    const auto K = static_cast< real >( k );
+    const auto d = std::min( 14.0, npe*K - 1.0 );
+    const auto s = d > 0.0 ? 6.0 / std::cbrt( n/K ) : 0.0;
+    const auto hide = w / p * (K - 1.0) / K;
+    const auto L = d > 0.0 ? std::max( 0.0, latency - hide ) : 0.0;
+    const auto t = w * (1.0 + s) + p * L + p * K * d * overhead;
+    if (t < best) {
+      best = t;
+      bestk = k;
+    }
+  }
+
+  // Virtualization for which linearLoadDistributor() yields n/bestk load
+  // per work unit
+  return (n - n / static_cast< real >( bestk )) / (n - 1.0);
+}
+
 } // tk::
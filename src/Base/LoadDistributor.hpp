@@ -14,6 +14,7 @@
 #define LoadDistributor_h
 
 #include <cstdint>
+#include <cstddef>
 
 #include "Types.hpp"
 
@@ -27,6 +28,16 @@ linearLoadDistributor( tk::real virtualization,
                        uint64_t& chunksize,
                        uint64_t& remainder );
 
+//! \brief Compute the degree of virtualization minimizing the modeled time of
+//!   a time step
+real
+autoVirtualization( uint64_t load,
+                    int npe,
+                    real loadcost,
+                    real latency,
+                    real overhead,
+                    std::size_t nphase );
+
 } // tk::
 
 #endif // LoadDistributor_h
@@ -0,0 +1,53 @@
+// *****************************************************************************
+/*!
+  \file      src/Base/Memory.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Memory accounting of the process
+  \details   Memory accounting of the process. The resident set size is read
+    from /proc/self/statm, available on Linux, and its high-water mark is
+    queried by getrusage(), which reports it in kilobytes on Linux and in bytes
+    on Mac OS. Where the queries are not available, they return zero.
+*/
+// *****************************************************************************
+
+#include <fstream>
+
+#include <unistd.h>
+#include <sys/resource.h>
+
+#include "Memory.hpp"
+
+std::size_t
+tk::rss()
+// *****************************************************************************
+//  Query the resident set size of the process
+//! \return Resident set size of the process in bytes, zero if not available
+// *****************************************************************************
+{
+  std::size_t size = 0, resident = 0;
+  std::ifstream statm( "/proc/self/statm" );
+  if (statm >> size >> resident)
+    return resident * static_cast< std::size_t >( sysconf( _SC_PAGESIZE ) );
+  return 0;
+}
+
+std::size_t
+tk::rsshwm()
+// *****************************************************************************
+//  Query the high-water mark of the resident set size of the process
+//! \return High-water mark of the resident set size of the process in bytes,
+//!   zero if not available
+// *****************************************************************************
+{
+  struct rusage usage;
+  if (getrusage( RUSAGE_SELF, &usage )) return 0;
+  const auto maxrss = static_cast< std::size_t >( usage.ru_maxrss );
+  #ifdef __APPLE__
+  return maxrss;
+  #else
+  return maxrss * 1024;
+  #endif
+}
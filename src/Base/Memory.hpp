@@ -0,0 +1,174 @@
+// *****************************************************************************
+/*!
+  \file      src/Base/Memory.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Memory accounting of containers and the process
+  \details   Memory accounting of containers and the process. tk::bytes()
+    estimates the number of bytes a (nested) container occupies, including
+    its heap storage, and tk::rss() and tk::rsshwm() query the resident set
+    size of the process and its high-water mark. The container estimates
+    count the storage allocated for elements (also unused capacity) and the
+    per-node and per-bucket pointers of node-based containers, but not the
+    bookkeeping of the memory allocator.
+*/
+// *****************************************************************************
+#ifndef Memory_h
+#define Memory_h
+
+#include <map>
+#include <set>
+#include <array>
+#include <vector>
+#include <string>
+#include <utility>
+#include <cstddef>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "Data.hpp"
+
+namespace tk {
+
+//! Resident set size of the process in bytes
+std::size_t rss();
+
+//! High-water mark of the resident set size of the process in bytes
+std::size_t rsshwm();
+
+//! Number of bytes of a value of a type without heap storage
+//! \param[in] t Value
+//! \return Number of bytes t occupies
+template< class T >
+std::enable_if_t< std::is_trivially_copyable_v< T >, std::size_t >
+bytes( const T& t ) { return sizeof(t); }
+
+//! Number of bytes of a value of a type that accounts for its own storage
+//! \param[in] t Value
+//! \return Number of bytes t occupies, as reported by t.bytes()
+template< class T >
+auto bytes( const T& t ) -> decltype( t.bytes() ) { return t.bytes(); }
+
+template< class T, class A >
+std::size_t bytes( const std::vector< T, A >& v );
+template< class T, std::size_t N >
+std::enable_if_t< !std::is_trivially_copyable_v< T >, std::size_t >
+bytes( const std::array< T, N >& a );
+template< class A, class B >
+std::enable_if_t< !std::is_trivially_copyable_v< std::pair< A, B > >,
+                  std::size_t >
+bytes( const std::pair< A, B >& p );
+template< class K, class V, class H, class E, class A >
+std::size_t bytes( const std::unordered_map< K, V, H, E, A >& m );
+template< class K, class H, class E, class A >
+std::size_t bytes( const std::unordered_set< K, H, E, A >& s );
+template< class K, class V, class C, class A >
+std::size_t bytes( const std::map< K, V, C, A >& m );
+template< class K, class C, class A >
+std::size_t bytes( const std::set< K, C, A >& s );
+
+//! Number of bytes of a string
+//! \param[in] s String
+//! \return Number of bytes s occupies, including its heap storage
+inline std::size_t bytes( const std::string& s )
+{ return sizeof(s) + s.capacity(); }
+
+//! Number of bytes of tk::Data, e.g., tk::Fields
+//! \param[in] d Data object
+//! \return Number of bytes d occupies, including its heap storage
+template< uint8_t Layout, class A >
+std::size_t bytes( const Data< Layout, A >& d ) { return bytes( d.data() ); }
+
+//! Number of bytes occupied by the elements of a container
+//! \param[in] c Container
+//! \return Number of bytes the elements occupy, including their heap storage
+//! \details Containers of values without heap storage are not traversed.
+template< class C >
+std::size_t elembytes( const C& c ) {
+  using T = typename C::value_type;
+  if constexpr( std::is_trivially_copyable_v< T > ) {
+    return c.size() * sizeof(T);
+  } else {
+    std::size_t b = 0;
+    for (const auto& e : c) b += bytes( e );
+    return b;
+  }
+}
+
+//! Number of bytes of a std::vector
+//! \param[in] v Vector
+//! \return Number of bytes v occupies, including its heap storage
+template< class T, class A >
+std::size_t bytes( const std::vector< T, A >& v ) {
+  return sizeof(v) + (v.capacity() - v.size()) * sizeof(T) + elembytes( v );
+}
+
+//! Number of bytes of a std::array of values with heap storage
+//! \param[in] a Array
+//! \return Number of bytes a occupies, including its heap storage
+template< class T, std::size_t N >
+std::enable_if_t< !std::is_trivially_copyable_v< T >, std::size_t >
+bytes( const std::array< T, N >& a ) { return elembytes( a ); }
+
+//! Number of bytes of a std::pair of values with heap storage
+//! \param[in] p Pair
+//! \return Number of bytes p occupies, including its heap storage
+template< class A, class B >
+std::enable_if_t< !std::is_trivially_copyable_v< std::pair< A, B > >,
+                  std::size_t >
+bytes( const std::pair< A, B >& p ) {
+  return bytes( p.first ) + bytes( p.second );
+}
+
+//! Number of bytes of a std::unordered_map
+//! \param[in] m Hash map
+//! \return Number of bytes m occupies, including its heap storage
+//! \details Each node holds a pointer to the next node and the hash value.
+template< class K, class V, class H, class E, class A >
+std::size_t bytes( const std::unordered_map< K, V, H, E, A >& m ) {
+  return sizeof(m) + m.bucket_count() * sizeof(void*) +
+         m.size() * 2 * sizeof(void*) + elembytes( m );
+}
+
+//! Number of bytes of a std::unordered_set
+//! \param[in] s Hash set
+//! \return Number of bytes s occupies, including its heap storage
+template< class K, class H, class E, class A >
+std::size_t bytes( const std::unordered_set< K, H, E, A >& s ) {
+  return sizeof(s) + s.bucket_count() * sizeof(void*) +
+         s.size() * 2 * sizeof(void*) + elembytes( s );
+}
+
+//! Number of bytes of a std::map
+//! \param[in] m Map
+//! \return Number of bytes m occupies, including its heap storage
+//! \details Each node of the red-black tree holds three pointers and a color.
+template< class K, class V, class C, class A >
+std::size_t bytes( const std::map< K, V, C, A >& m ) {
+  return sizeof(m) + m.size() * 4 * sizeof(void*) + elembytes( m );
+}
+
+//! Number of bytes of a std::set
+//! \param[in] s Set
+//! \return Number of bytes s occupies, including its heap storage
+template< class K, class C, class A >
+std::size_t bytes( const std::set< K, C, A >& s ) {
+  return sizeof(s) + s.size() * 4 * sizeof(void*) + elembytes( s );
+}
+
+//! Number of bytes of multiple containers
+//! \param[in] a First container
+//! \param[in] b Second container
+//! \param[in] c Further containers
+//! \return Sum of the number of bytes the containers occupy
+template< class A, class B, class... C >
+std::size_t bytes( const A& a, const B& b, const C&... c ) {
+  return bytes( a ) + (bytes( b ) + ... + bytes( c ));
+}
+
+} // tk::
+
+#endif // Memory_h
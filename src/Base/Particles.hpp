@@ -26,6 +26,13 @@ using Particles = Data< UnkEqComp >;
 using Particles = Data< EqCompUnk >;
 #endif
 
+//! \brief Number of particles advanced at a time by the differential equation
+//!   kernels
+//! \details Within a block of particles the kernels loop over the particles
+//!   of one component at a time, which is a unit-stride and vectorizable loop
+//!   with the equation-major layout.
+const std::size_t ParticleBlkWidth = 256;
+
 } // tk::
 
 #endif // Particles_h
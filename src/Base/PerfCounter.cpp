@@ -0,0 +1,270 @@
+// *****************************************************************************
+/*!
+  \file      src/Base/PerfCounter.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Hardware performance counters sampled around code regions
+  \details   Hardware performance counters sampled around code regions. The
+    counters of a thread are opened as a single perf_event group, so that all
+    of them are read by a single system call at the start and end of a region.
+    The registry of region names is shared by all threads of the process and
+    is guarded by a mutex, while the accumulators are thread-local.
+*/
+// *****************************************************************************
+
+#include <mutex>
+#include <atomic>
+#include <limits>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+
+#ifdef __linux__
+  #include <unistd.h>
+  #include <sys/ioctl.h>
+  #include <sys/syscall.h>
+  #include <linux/perf_event.h>
+#endif
+
+#include "PerfCounter.hpp"
+
+namespace tk {
+
+//! True if sampling counters in the regions of this process
+static std::atomic< bool > g_perfon( false );
+
+//! Mutex guarding the registry of regions
+static std::mutex g_perfmutex;
+
+//! Names of regions registered in this process
+static std::vector< std::string > g_perfname;
+
+//! Ids of regions registered in this process
+static std::unordered_map< std::string, std::uint32_t > g_perfid;
+
+//! Accumulators of a region
+struct PerfAcc {
+  std::uint64_t calls = 0;                              //!< Number of calls
+  tk::real time = 0.0;                                  //!< Time in seconds
+  std::array< std::uint64_t, NUMPERFCTR > ctr{};        //!< Counters
+};
+
+//! Performance counters and accumulators of a thread
+struct PerfThread {
+  bool opened = false;                  //!< True if tried opening counters
+  int leader = -1;                      //!< File descriptor of group leader
+  std::vector< std::size_t > ctr;       //!< Counters opened in group order
+  std::vector< PerfAcc > acc;           //!< Accumulators per region id
+};
+
+//! Performance counters and accumulators of this thread
+static thread_local PerfThread t_perf;
+
+//! Open the hardware performance counters of this thread
+//! \details Counters that cannot be opened are left out, and if none can be
+//!   opened, only calls and times are accumulated.
+static void perfOpen() {
+  t_perf.opened = true;
+  #ifdef __linux__
+  const std::array< std::pair< std::uint32_t, std::uint64_t >, NUMPERFCTR >
+    cfg{{ { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+          { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+          { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D |
+                                (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+          { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES } }};
+  for (std::size_t c=0; c<NUMPERFCTR; ++c) {
+    perf_event_attr a{};
+    a.size = sizeof(a);
+    a.type = cfg[c].first;
+    a.config = cfg[c].second;
+    a.disabled = t_perf.leader < 0 ? 1 : 0;
+    a.exclude_kernel = 1;
+    a.exclude_hv = 1;
+    a.read_format = PERF_FORMAT_GROUP;
+    auto fd = static_cast< int >(
+      syscall( __NR_perf_event_open, &a, 0, -1, t_perf.leader, 0 ) );
+    if (fd < 0) continue;
+    if (t_perf.leader < 0) t_perf.leader = fd;
+    t_perf.ctr.push_back( c );
+  }
+  if (t_perf.leader >= 0) {
+    ioctl( t_perf.leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP );
+    ioctl( t_perf.leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP );
+  }
+  #endif
+}
+
+//! Read the hardware performance counters of this thread
+//! \return Counter values, zero for counters not available
+static std::array< std::uint64_t, NUMPERFCTR > perfRead() {
+  std::array< std::uint64_t, NUMPERFCTR > v{};
+  if (!t_perf.opened) perfOpen();
+  #ifdef __linux__
+  if (t_perf.leader >= 0) {
+    // group read format: number of counters followed by their values
+    std::array< std::uint64_t, NUMPERFCTR+1 > buf{};
+    auto n = t_perf.ctr.size();
+    auto b = static_cast< ssize_t >( (n+1) * sizeof(std::uint64_t) );
+    if (read( t_perf.leader, buf.data(), static_cast< std::size_t >(b) ) == b)
+      for (std::size_t i=0; i<n; ++i) v[ t_perf.ctr[i] ] = buf[i+1];
+  }
+  #endif
+  return v;
+}
+
+} // tk::
+
+void
+tk::perfCounters( bool enable )
+// *****************************************************************************
+//  Enable or disable sampling counters in the regions of this process
+//! \param[in] enable True to enable sampling
+// *****************************************************************************
+{
+  g_perfon.store( enable, std::memory_order_relaxed );
+}
+
+std::uint32_t
+tk::perfRegion( const std::string& name )
+// *****************************************************************************
+//  Register a region by name
+//! \param[in] name Name of the region
+//! \return Id of the region, the same for the same name
+//! \details Ids are only unique within a process, regions are reported by
+//!   name, see perfRows().
+// *****************************************************************************
+{
+  std::lock_guard< std::mutex > lock( g_perfmutex );
+  auto e = g_perfid.emplace( name, g_perfname.size() );
+  if (e.second) g_perfname.push_back( name );
+  return e.first->second;
+}
+
+std::unordered_map< std::string, std::vector< tk::real > >
+tk::perfRows( int pe )
+// *****************************************************************************
+//  Rows of the performance counter report of the regions of this thread
+//! \param[in] pe PE of this thread, stored in the rows
+//! \return Row of accumulators, see PerfRow, associated to region names for
+//!   the regions entered by this thread
+//! \details The rows of multiple PEs associated to the same region name can
+//!   be concatenated, e.g., by tk::mergeHashMap, into the input of
+//!   perfSummary().
+// *****************************************************************************
+{
+  std::vector< std::string > name;
+  {
+    std::lock_guard< std::mutex > lock( g_perfmutex );
+    name = g_perfname;
+  }
+
+  std::unordered_map< std::string, std::vector< tk::real > > rows;
+  for (std::size_t r=0; r<t_perf.acc.size(); ++r) {
+    const auto& a = t_perf.acc[r];
+    if (a.calls == 0) continue;
+    auto& row = rows[ name[r] ];
+    row.resize( PRSTRIDE );
+    row[PRPE] = pe;
+    row[PRCALLS] = static_cast< tk::real >( a.calls );
+    row[PRTIME] = a.time;
+    for (std::size_t c=0; c<NUMPERFCTR; ++c)
+      row[PRCTR+c] = static_cast< tk::real >( a.ctr[c] );
+  }
+  return rows;
+}
+
+std::vector< std::pair< std::string, std::string > >
+tk::perfSummary(
+  const std::unordered_map< std::string, std::vector< tk::real > >& rows )
+// *****************************************************************************
+//  Summarize the performance counter report of regions across PEs
+//! \param[in] rows Rows of accumulators of all PEs, see PerfRow, associated to
+//!   region names
+//! \return Summary strings associated to region names, in order of decreasing
+//!   time: the number of calls and the time summed across PEs, the
+//!   instructions per cycle (IPC), also its minimum and maximum across PEs, L1
+//!   data cache misses per 1000 instructions, the bandwidth implied by last
+//!   level cache misses assuming 64-byte cache lines, and instructions per
+//!   byte of that traffic as a proxy of arithmetic intensity
+// *****************************************************************************
+{
+  struct Sum {
+    std::string name;
+    std::array< tk::real, PRSTRIDE > s{};
+    tk::real ipcmin = std::numeric_limits< tk::real >::max();
+    tk::real ipcmax = 0.0;
+  };
+
+  std::vector< Sum > sums;
+  for (const auto& [ name, r ] : rows) {
+    Sum s;
+    s.name = name;
+    for (std::size_t i=0; i+PRSTRIDE<=r.size(); i+=PRSTRIDE) {
+      for (std::size_t j=PRCALLS; j<PRSTRIDE; ++j) s.s[j] += r[i+j];
+      if (r[i+PRCTR+PCYCLES] > 0.0) {
+        auto ipc = r[i+PRCTR+PINSTR] / r[i+PRCTR+PCYCLES];
+        s.ipcmin = std::min( s.ipcmin, ipc );
+        s.ipcmax = std::max( s.ipcmax, ipc );
+      }
+    }
+    sums.push_back( s );
+  }
+  std::sort( begin(sums), end(sums),
+    []( const Sum& a, const Sum& b ){ return a.s[PRTIME] > b.s[PRTIME]; } );
+
+  std::vector< std::pair< std::string, std::string > > summary;
+  for (const auto& s : sums) {
+    std::stringstream ss;
+    ss << std::setprecision(3) << s.s[PRCALLS] << " calls, " << s.s[PRTIME]
+       << " s";
+    const auto cycles = s.s[PRCTR+PCYCLES];
+    const auto instr = s.s[PRCTR+PINSTR];
+    if (cycles > 0.0) {
+      const auto bytes = 64.0 * s.s[PRCTR+PLLCMISS];
+      ss << ", IPC " << instr/cycles << " (min " << s.ipcmin << ", max "
+         << s.ipcmax << ")";
+      if (instr > 0.0)
+        ss << ", L1D miss/kinstr " << 1000.0 * s.s[PRCTR+PL1DMISS] / instr;
+      if (s.s[PRTIME] > 0.0)
+        ss << ", LLC " << bytes / s.s[PRTIME] / 1.0e9 << " GB/s/PE";
+      if (bytes > 0.0) ss << ", instr/B " << instr / bytes;
+    } else {
+      ss << ", counters not available";
+    }
+    summary.emplace_back( s.name, ss.str() );
+  }
+  return summary;
+}
+
+tk::PerfRegion::PerfRegion( std::uint32_t id ) :
+  m_id( id ),
+  m_on( g_perfon.load( std::memory_order_relaxed ) ),
+  m_t0(),
+  m_c0()
+// *****************************************************************************
+//  Constructor: start sampling the region, if enabled
+//! \param[in] id Region id, see perfRegion()
+// *****************************************************************************
+{
+  if (!m_on) return;
+  m_c0 = perfRead();
+  m_t0 = clock::now();
+}
+
+tk::PerfRegion::~PerfRegion()
+// *****************************************************************************
+//  Destructor: accumulate counters of the region, if enabled
+// *****************************************************************************
+{
+  if (!m_on) return;
+  const auto t1 = clock::now();
+  const auto c1 = perfRead();
+  if (t_perf.acc.size() <= m_id) t_perf.acc.resize( m_id+1 );
+  auto& a = t_perf.acc[ m_id ];
+  ++a.calls;
+  a.time += std::chrono::duration< tk::real >( t1 - m_t0 ).count();
+  for (std::size_t c=0; c<NUMPERFCTR; ++c) a.ctr[c] += c1[c] - m_c0[c];
+}
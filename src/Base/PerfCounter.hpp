@@ -0,0 +1,89 @@
+// *****************************************************************************
+/*!
+  \file      src/Base/PerfCounter.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Hardware performance counters sampled around code regions
+  \details   Hardware performance counters sampled around code regions. A
+    region, e.g., a solver kernel, is registered by name once per process and
+    is instrumented by a PerfRegion object constructed at its start, whose
+    destructor accumulates the number of calls, the wall-clock time, and the
+    differences of the hardware counters of the calling thread, i.e., the PE,
+    in the region. The counters are read via Linux perf_event, opened by each
+    thread at its first region, and only if enabled by perfCounters(). Where
+    perf_event is not available or not permitted, e.g., due to the setting of
+    /proc/sys/kernel/perf_event_paranoid, only the calls and times are
+    accumulated.
+*/
+// *****************************************************************************
+#ifndef PerfCounter_h
+#define PerfCounter_h
+
+#include <array>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <unordered_map>
+
+#include "Types.hpp"
+
+namespace tk {
+
+//! Hardware performance counters sampled
+enum PerfCtr : std::size_t { PCYCLES=0,         //!< CPU cycles
+                             PINSTR,            //!< Instructions retired
+                             PL1DMISS,          //!< L1 data cache read misses
+                             PLLCMISS,          //!< Last level cache misses
+                             NUMPERFCTR };      //!< Number of counters
+
+//! \brief Entries of a row of the performance counter report of a region,
+//!   one row per PE, see perfRows()
+enum PerfRow : std::size_t { PRPE=0,            //!< PE
+                             PRCALLS,           //!< Number of calls
+                             PRTIME,            //!< Wall-clock time in seconds
+                             PRCTR,             //!< First counter, see PerfCtr
+                             PRSTRIDE=PRCTR+NUMPERFCTR };  //!< Row length
+
+//! Enable or disable sampling counters in the regions of this process
+void perfCounters( bool enable );
+
+//! Register a region by name
+std::uint32_t perfRegion( const std::string& name );
+
+//! Rows of the performance counter report of the regions of this thread
+std::unordered_map< std::string, std::vector< tk::real > > perfRows( int pe );
+
+//! Summarize the performance counter report of regions across PEs
+std::vector< std::pair< std::string, std::string > >
+perfSummary(
+  const std::unordered_map< std::string, std::vector< tk::real > >& rows );
+
+//! Code region whose hardware performance counters are sampled
+class PerfRegion {
+
+  private:
+    using clock = std::chrono::steady_clock;
+
+  public:
+    //! Constructor: start sampling the region, if enabled
+    explicit PerfRegion( std::uint32_t id );
+
+    //! Destructor: accumulate counters of the region, if enabled
+    ~PerfRegion();
+
+    PerfRegion( const PerfRegion& ) = delete;
+    PerfRegion& operator=( const PerfRegion& ) = delete;
+
+  private:
+    std::uint32_t m_id;                                 //!< Region id
+    bool m_on;                                          //!< True if sampling
+    clock::time_point m_t0;                             //!< Start time
+    std::array< std::uint64_t, NUMPERFCTR > m_c0;       //!< Start counters
+};
+
+} // tk::
+
+#endif // PerfCounter_h
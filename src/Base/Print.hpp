@@ -734,6 +734,74 @@ class Print {
       << std::endl;
     }
 
+    //! Print AMRBench header. Text ASCII Art Generator used for executable
+    //! names: http://patorjk.com/software/taag, Picture ASCII Art Generator
+    //! used for converting the logo text "Quinoa": http://picascii.com.
+    template< Style s = VERBOSE >
+    void headerAMRBench() const {
+      stream<s>() << R"(
+      ,::,`                                                            `.
+   .;;;'';;;:                                                          ;;#
+  ;;;@+   +;;;  ;;;;;,   ;;;;. ;;;;;, ;;;;      ;;;;   `;;;;;;:        ;;;
+ :;;@`     :;;' .;;;@,    ,;@, ,;;;@: .;;;'     .;+;. ;;;@#:';;;      ;;;;'
+ ;;;#       ;;;: ;;;'      ;:   ;;;'   ;;;;;     ;#  ;;;@     ;;;     ;+;;'
+.;;+        ;;;# ;;;'      ;:   ;;;'   ;#;;;`    ;#  ;;@      `;;+   .;#;;;.
+;;;#        :;;' ;;;'      ;:   ;;;'   ;# ;;;    ;# ;;;@       ;;;   ;# ;;;+
+;;;#        .;;; ;;;'      ;:   ;;;'   ;# ,;;;   ;# ;;;#       ;;;:  ;@  ;;;
+;;;#        .;;' ;;;'      ;:   ;;;'   ;#  ;;;;  ;# ;;;'       ;;;+ ;',  ;;;@
+;;;+        ,;;+ ;;;'      ;:   ;;;'   ;#   ;;;' ;# ;;;'       ;;;' ;':::;;;;
+`;;;        ;;;@ ;;;'      ;:   ;;;'   ;#    ;;;';# ;;;@       ;;;:,;+++++;;;'
+ ;;;;       ;;;@ ;;;#     .;.   ;;;'   ;#     ;;;;# `;;+       ;;# ;#     ;;;'
+ .;;;      :;;@  ,;;+     ;+    ;;;'   ;#      ;;;#  ;;;      ;;;@ ;@      ;;;.
+  ';;;    ;;;@,   ;;;;``.;;@    ;;;'   ;+      .;;#   ;;;    :;;@ ;;;      ;;;+
+   :;;;;;;;+@`     ';;;;;'@    ;;;;;, ;;;;      ;;+    +;;;;;;#@ ;;;;.   .;;;;;;
+     .;;#@'         `#@@@:     ;::::; ;::::      ;@      '@@@+   ;:::;    ;::::::
+    :;;;;;;.
+   .;@+@';;;;;;'
+    `     '#''@`
+       _____      _____  ____________________                       .__
+      /  _  \    /     \ \______   \______   \ ____    ____   ____  |  |__
+     /  /_\  \  /  \ /  \ |       _/|    |  _// __ \  /    \_/ ___\ |  |  \
+    /    |    \/    Y    \|    |   \|    |   \  ___/ |   |  \  \___ |   Y  \
+    \____|__  /\____|__  /|____|_  /|______  /\___  >|___|  /\___  >|___|  /
+            \/         \/        \/        \/     \/      \/     \/      \/)"
+      << std::endl;
+    }
+
+    //! Print MicroBench header. Text ASCII Art Generator used for executable
+    //! names: http://patorjk.com/software/taag, Picture ASCII Art Generator
+    //! used for converting the logo text "Quinoa": http://picascii.com.
+    template< Style s = VERBOSE >
+    void headerMicroBench() const {
+      stream<s>() << R"(
+      ,::,`                                                            `.
+   .;;;'';;;:                                                          ;;#
+  ;;;@+   +;;;  ;;;;;,   ;;;;. ;;;;;, ;;;;      ;;;;   `;;;;;;:        ;;;
+ :;;@`     :;;' .;;;@,    ,;@, ,;;;@: .;;;'     .;+;. ;;;@#:';;;      ;;;;'
+ ;;;#       ;;;: ;;;'      ;:   ;;;'   ;;;;;     ;#  ;;;@     ;;;     ;+;;'
+.;;+        ;;;# ;;;'      ;:   ;;;'   ;#;;;`    ;#  ;;@      `;;+   .;#;;;.
+;;;#        :;;' ;;;'      ;:   ;;;'   ;# ;;;    ;# ;;;@       ;;;   ;# ;;;+
+;;;#        .;;; ;;;'      ;:   ;;;'   ;# ,;;;   ;# ;;;#       ;;;:  ;@  ;;;
+;;;#        .;;' ;;;'      ;:   ;;;'   ;#  ;;;;  ;# ;;;'       ;;;+ ;',  ;;;@
+;;;+        ,;;+ ;;;'      ;:   ;;;'   ;#   ;;;' ;# ;;;'       ;;;' ;':::;;;;
+`;;;        ;;;@ ;;;'      ;:   ;;;'   ;#    ;;;';# ;;;@       ;;;:,;+++++;;;'
+ ;;;;       ;;;@ ;;;#     .;.   ;;;'   ;#     ;;;;# `;;+       ;;# ;#     ;;;'
+ .;;;      :;;@  ,;;+     ;+    ;;;'   ;#      ;;;#  ;;;      ;;;@ ;@      ;;;.
+  ';;;    ;;;@,   ;;;;``.;;@    ;;;'   ;+      .;;#   ;;;    :;;@ ;;;      ;;;+
+   :;;;;;;;+@`     ';;;;;'@    ;;;;;, ;;;;      ;;+    +;;;;;;#@ ;;;;.   .;;;;;;
+     .;;#@'         `#@@@:     ;::::; ;::::      ;@      '@@@+   ;:::;    ;::::::
+    :;;;;;;.
+   .;@+@';;;;;;'
+    `     '#''@`
+    _____  .__                      __________                       .__
+   /     \ |__| ____ _______  ____  \______   \ ____    ____   ____  |  |__
+  /  \ /  \|  |/ ___\\_  __ \/  _ \  |    |  _// __ \  /    \_/ ___\ |  |  \
+ /    Y    \  \  \___ |  | \(  <_> ) |    |   \  ___/ |   |  \  \___ |   Y  \
+ \____|__  /__|\___  >|__|   \____/  |______  /\___  >|___|  /\___  >|___|  /
+         \/        \/                       \/     \/      \/     \/      \/)"
+      << std::endl;
+    }
+
     //! Print Walker header. Text ASCII Art Generator used for executable names:
     //! http://patorjk.com/software/taag, Picture ASCII Art Generator used for
     //! converting the logo text "Quinoa": http://picascii.com.
@@ -0,0 +1,127 @@
+// *****************************************************************************
+/*!
+  \file      src/Base/StepControl.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Error-controlled time step size selection for Runge-Kutta schemes
+  \details   Error-controlled time step size selection for explicit
+    Runge-Kutta schemes whose first stage is a (scaled) forward Euler step,
+    which then serves as the embedded first order scheme: the local error is
+    estimated by the difference of the solutions of the two schemes and the
+    next time step size is selected by a proportional-integral controller.
+*/
+// *****************************************************************************
+#ifndef StepControl_h
+#define StepControl_h
+
+#include <cmath>
+#include <algorithm>
+
+#include "NoWarning/pup.hpp"
+#include "Types.hpp"
+#include "Exception.hpp"
+
+namespace tk {
+
+//! \brief Error-controlled time step size selection for Runge-Kutta schemes
+//! \details The first stage of the explicit Runge-Kutta schemes used by the
+//!   solvers computes u1 = un + c0 dt R(un), so un + (u1-un)/c0 is the
+//!   solution of the forward Euler scheme, embedded at no cost in the
+//!   higher order scheme. The difference of the two is an estimate of the
+//!   local error of the Euler scheme, O(dt^2), which is scaled by the
+//!   tolerance and the magnitude of the solution, so that one is an
+//!   acceptable error. The time step size of the next step is selected from
+//!   the last two error estimates by the PI controller of Gustafsson, with
+//!   the parameters recommended by Hairer & Wanner, Solving Ordinary
+//!   Differential Equations II, Springer, 1996, Sec. IV.2. Steps are not
+//!   rejected: the controller only selects the size of subsequent steps.
+class StepControl {
+
+  public:
+    //! Constructor
+    //! \param[in] tol Error tolerance, zero disables error control
+    explicit StepControl( real tol = 0.0 ) : m_tol( tol ) {}
+
+    //! Query if error control is enabled
+    //! \return True if the time step size is selected by the error estimate
+    bool enabled() const { return m_tol > 0.0; }
+
+    //! Estimate the scaled local error of a time step
+    //! \tparam Field Field type, e.g., tk::Fields
+    //! \param[in] u Solution at the end of the step
+    //! \param[in] un Solution at the start of the step
+    //! \param[in] u1 Solution after the first stage of the step
+    //! \param[in] c0 Coefficient of dt R(un) in the first stage
+    //! \param[in] nunk Number of unknowns to estimate the error in, e.g., only
+    //!   the elements owned
+    //! \param[in] stride Only estimate the error in every stride-th component,
+    //!   e.g., in the cell averages of a DG solution
+    //! \return Largest error across all unknowns and components estimated,
+    //!   scaled so that one is the tolerance
+    template< class Field >
+    real error( const Field& u, const Field& un, const Field& u1, real c0,
+                std::size_t nunk, std::size_t stride = 1 ) const
+    {
+      Assert( enabled(), "Error control not enabled" );
+      Assert( c0 > 0.0, "First stage coefficient must be positive" );
+      Assert( stride > 0, "Component stride must be positive" );
+      Assert( u.nprop() == un.nprop() && u.nprop() == u1.nprop() &&
+              nunk <= u.nunk() && nunk <= un.nunk() && nunk <= u1.nunk(),
+              "Size mismatch" );
+      real e = 0.0;
+      for (std::size_t i=0; i<nunk; ++i)
+        for (std::size_t c=0; c<u.nprop(); c+=stride) {
+          auto n = un(i,c,0);
+          auto d = u(i,c,0) - n - (u1(i,c,0) - n) / c0;
+          auto s = m_tol * (1.0 + std::max( std::abs(u(i,c,0)), std::abs(n) ));
+          e = std::max( e, std::abs(d) / s );
+        }
+      return e;
+    }
+
+    //! Select the size of the next time step
+    //! \param[in] dt Size of the time step the error has been estimated for
+    //! \param[in] err Scaled error estimate of the step, see error()
+    //! \return Size of the next time step
+    //! \details The previous error estimate is updated, so this must be called
+    //!   once per step.
+    real dt( real dt, real err ) {
+      Assert( enabled(), "Error control not enabled" );
+      // exponents of the PI controller for an error estimate of O(dt^2)
+      constexpr real k = 2.0;
+      constexpr real beta = 0.4 / k;
+      constexpr real alpha = 1.0 / k - 0.75 * beta;
+      // safety factor and bounds of the ratio of consecutive step sizes
+      constexpr real safety = 0.9, minfac = 0.2, maxfac = 2.0;
+      err = std::max( err, 1.0e-10 );
+      auto f = safety * std::pow( err, -alpha ) * std::pow( m_errold, beta );
+      m_errold = err;
+      return dt * std::min( maxfac, std::max( minfac, f ) );
+    }
+
+    /** @name Pack/Unpack: Serialize StepControl object for Charm++ */
+    ///@{
+    //! \brief Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    void pup( PUP::er& p ) {
+      p | m_tol;
+      p | m_errold;
+    }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] s StepControl object reference
+    friend void operator|( PUP::er& p, StepControl& s ) { s.pup(p); }
+    ///@}
+
+  private:
+    //! Error tolerance, zero if error control is disabled
+    real m_tol;
+    //! Scaled error estimate of the previous step
+    real m_errold = 1.0;
+};
+
+} // tk::
+
+#endif // StepControl_h
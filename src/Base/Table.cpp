@@ -8,11 +8,12 @@
   \brief     Basic functionality for storing and sampling a discrete y = f(x)
              function
   \details   Basic functionality for storing and sampling a discrete y = f(x)
-             function.
+             function, see Table.hpp.
 */
 // *****************************************************************************
 
 #include <utility>
+#include <limits>
 #include <stddef.h>
 
 #include "Table.hpp"
@@ -30,7 +31,7 @@ tk::sample( tk::real x, const tk::Table& table )
 //!   no extrapolation is performed. If x falls between the first/lowest and the
 //!   last/largest value in the table, linear interpolation is used to compute a
 //!   sample between the two closest x values of the table around the abscissa
-//!   given.
+//!   given. At an x value of the table, its function value is returned.
 //! \return Sampled value from discrete table
 //! \note The x column in the table is assumed to be in increasing order.
 //! \see walker::invhts_eq_A005H, walker::prod_A005H for example tables
@@ -41,7 +42,7 @@ tk::sample( tk::real x, const tk::Table& table )
   if (x < table.front().first) return table.front().second;
 
   for (std::size_t i=0; i<table.size()-1; ++i) {
-    if (table[i].first < x && x < table[i+1].first) {
+    if (table[i].first <= x && x < table[i+1].first) {
       auto t1 = table[i].first;
       auto y1 = table[i].second;
       auto t2 = table[i+1].first;
@@ -52,3 +53,74 @@ tk::sample( tk::real x, const tk::Table& table )
 
   return table.back().second;
 }
+
+tk::IndexedTable::IndexedTable( tk::Table table ) : m_data()
+// *****************************************************************************
+//  Constructor: index the segments of a table
+//! \param[in] table Discrete y = f(x) function table to index, x increasing
+//! \details The range of x of the table is divided into uniform buckets, a
+//!   few per segment of the table, and for each bucket the segment containing
+//!   the left end of the bucket is stored. Finding the segment around x then
+//!   only requires the division to compute the bucket of x and, if the knots
+//!   of the table are not uniformly spaced, a short scan forward from the
+//!   segment stored for the bucket. The table and its index are stored in a
+//!   single object that copies of this IndexedTable share, as they never
+//!   change after construction.
+// *****************************************************************************
+{
+  auto d = std::make_shared< Data >();
+  d->table = std::move( table );
+  m_data = d;
+
+  const auto& t = d->table;
+  if (t.size() < 2) return;
+
+  const auto x0 = t.front().first;
+  const auto len = t.back().first - x0;
+  if (!(len > 0.0)) return;
+
+  const auto nb = m_bucketfactor * (t.size() - 1);
+  d->rdx = static_cast< tk::real >( nb ) / len;
+  d->bucket.resize( nb );
+  std::size_t i = 0;
+  for (std::size_t j=0; j<nb; ++j) {
+    const auto x = x0 + static_cast< tk::real >( j ) / d->rdx;
+    while (i+2 < t.size() && !(t[i+1].first > x)) ++i;
+    d->bucket[j] = i;
+  }
+}
+
+tk::IndexedTable::Window
+tk::IndexedTable::window( tk::real x ) const
+// *****************************************************************************
+//  Find the linear segment of the table around x
+//! \param[in] x Value of abscissa to find the segment of the table around
+//! \return Linear segment of the table containing x. Below the first and
+//!   beyond the last x value in the table the segment is constant, taking the
+//!   first and the last function value, respectively, consistent with
+//!   tk::sample().
+// *****************************************************************************
+{
+  const auto& t = m_data->table;
+  const auto& bucket = m_data->bucket;
+  Assert( !t.empty(), "Empty table to sample from" );
+
+  const auto inf = std::numeric_limits< tk::real >::infinity();
+  const auto& f = t.front();
+  const auto& b = t.back();
+
+  if (x < f.first) return { -inf, f.first, f.first, f.second, 0.0 };
+  if (bucket.empty() || !(x < b.first))
+    return { b.first, inf, b.first, b.second, 0.0 };
+
+  auto j = static_cast< std::size_t >( (x - f.first) * m_data->rdx );
+  if (j >= bucket.size()) j = bucket.size() - 1;
+  auto i = bucket[j];
+  // correct for roundoff in computing the bucket and skip knots in bucket
+  while (i > 0 && t[i].first > x) --i;
+  while (i+2 < t.size() && !(t[i+1].first > x)) ++i;
+
+  const auto& [x1,y1] = t[i];
+  const auto& [x2,y2] = t[i+1];
+  return { x1, x2, x1, y1, (y2-y1)/(x2-x1) };
+}
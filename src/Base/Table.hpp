@@ -8,13 +8,24 @@
   \brief     Basic functionality for storing and sampling a discrete y = f(x)
              function
   \details   Basic functionality for storing and sampling a discrete y = f(x)
-             function.
+             function. tk::sample() finds the segment of the table to
+             interpolate in by a linear search, which is fine for sampling a
+             table once in a while. tk::IndexedTable augments a table with a
+             uniform index of its segments, computed once at construction,
+             that finds the segment in constant time, and hands out the linear
+             segment around x as a tk::IndexedTable::Window, which callers,
+             sampling a table at consecutive times, can cache and reuse until
+             x leaves it. The table and its index are immutable once built and
+             are shared by the copies of a tk::IndexedTable, e.g., those of
+             the per-thread copies of the differential equations in walker.
 */
 // *****************************************************************************
 #ifndef Table_h
 #define Table_h
 
 #include <vector>
+#include <limits>
+#include <memory>
 #include <utility>
 
 #include "Types.hpp"
@@ -27,6 +38,72 @@ using Table = std::vector< std::pair< tk::real, tk::real > >;
 //! Sample a discrete y = f(x) function at x
 tk::real sample( tk::real x, const tk::Table& table );
 
+//! Discrete y = f(x) function with constant-time lookup of its segments
+class IndexedTable {
+
+  public:
+    //! Linear segment of a table, y = y1 + slope*(x-x1), valid in [lo,hi)
+    struct Window {
+      tk::real lo = 0.0;        //!< Lowest abscissa the segment is valid at
+      tk::real hi = 0.0;        //!< Abscissa the segment is valid below
+      tk::real x1 = 0.0;        //!< Abscissa of left end point of segment
+      tk::real y1 = 0.0;        //!< Ordinate of left end point of segment
+      tk::real slope = 0.0;     //!< Slope of segment
+
+      //! Query if x is within the segment, false for a default Window
+      //! \param[in] x Value of abscissa to query
+      //! \return True if the segment is valid at x
+      bool contains( tk::real x ) const noexcept { return x >= lo && x < hi; }
+
+      //! Sample the segment at x
+      //! \param[in] x Value of abscissa at which to sample
+      //! \return Sampled value
+      tk::real sample( tk::real x ) const noexcept
+      { return y1 + slope*(x-x1); }
+    };
+
+    //! Constructor: index the segments of a table
+    explicit IndexedTable( tk::Table table = tk::Table() );
+
+    //! Find the linear segment of the table around x
+    Window window( tk::real x ) const;
+
+    //! Sample the table at x, yielding the same value as tk::sample()
+    //! \param[in] x Value of abscissa at which to sample y = f(x)
+    //! \return Sampled value from discrete table
+    tk::real sample( tk::real x ) const { return window( x ).sample( x ); }
+
+    //! Sample the table at x, reusing a segment found for a previous x
+    //! \param[in] x Value of abscissa at which to sample y = f(x)
+    //! \param[in,out] w Segment found previously, replaced if not around x
+    //! \return Sampled value from discrete table
+    tk::real sample( tk::real x, Window& w ) const {
+      if (!w.contains( x )) w = window( x );
+      return w.sample( x );
+    }
+
+    //! Accessor to the table indexed
+    //! \return Discrete function table
+    const tk::Table& table() const noexcept { return m_data->table; }
+
+  private:
+    //! Number of index buckets per segment of the table
+    static constexpr std::size_t m_bucketfactor = 4;
+
+    //! Table and its index, read-only once constructed
+    struct Data {
+      //! Discrete function table
+      tk::Table table;
+      //! Inverse width of the uniform index buckets of the abscissa
+      tk::real rdx = 0.0;
+      //! Index of the segment containing the left end of each bucket
+      std::vector< std::size_t > bucket;
+    };
+
+    //! Table data shared among copies
+    std::shared_ptr< const Data > m_data;
+};
+
 } // tk::
 
 #endif // Table_h
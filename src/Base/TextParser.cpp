@@ -0,0 +1,65 @@
+// *****************************************************************************
+/*!
+  \file      src/Base/TextParser.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Fast, chunked, and multi-threaded parsing of text files
+  \details   Fast, chunked, and multi-threaded parsing of text files.
+*/
+// *****************************************************************************
+
+#include <cstdlib>
+
+#include "TextParser.hpp"
+
+namespace tk {
+
+const char*
+parseReal( const char* p, tk::real& v )
+// *****************************************************************************
+//  Parse a real number in a line of text
+//! \param[in] p Position in text, leading blanks are skipped
+//! \param[out] v Real number parsed
+//! \return Position after the number parsed, nullptr if there is no number in
+//!   the line at p
+//! \details Numbers are parsed by std::strtod(), which, as opposed to
+//!   std::istream::operator>>, does not construct a sentry, look up the
+//!   locale's facets, and buffer the characters of the number per call.
+// *****************************************************************************
+{
+  p = skipBlanks( p );
+  if (*p == '\n' || *p == '\0') return nullptr;
+  char* e;
+  v = std::strtod( p, &e );
+  return e == p ? nullptr : e;
+}
+
+const char*
+endOfLines( const char* begin,
+            const char* end,
+            std::size_t nline,
+            std::size_t& n )
+// *****************************************************************************
+//  Find the end of the first number of lines in a range of text
+//! \param[in] begin Beginning of text
+//! \param[in] end End of text
+//! \param[in] nline Number of lines to find
+//! \param[out] n Number of lines found terminated by a new line, at most nline
+//! \return Position after the new line terminating the last line found
+// *****************************************************************************
+{
+  n = 0;
+  const char* p = begin;
+  while (n < nline) {
+    auto nl = static_cast< const char* >(
+      std::memchr( p, '\n', static_cast< std::size_t >( end - p ) ) );
+    if (!nl) break;
+    p = nl + 1;
+    ++n;
+  }
+  return p;
+}
+
+} // tk::
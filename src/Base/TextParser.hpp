@@ -0,0 +1,178 @@
+// *****************************************************************************
+/*!
+  \file      src/Base/TextParser.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Fast, chunked, and multi-threaded parsing of text files
+  \details   Fast, chunked, and multi-threaded parsing of text files, e.g.,
+    ASCII mesh files, consisting of a number of lines of records, one record
+    per line. As opposed to extracting numbers one by one using the
+    formatted-input operator>> of std::istream, tk::parseLines() reads the
+    file in large chunks of bytes into memory, splits each chunk into
+    ranges of whole lines, and parses the ranges in parallel, if OpenMP is
+    enabled, using the light-weight number parsers tk::parseInt() and
+    tk::parseReal(), which do not go through the locale machinery of
+    iostreams. The memory required is bounded by the chunk size and is
+    independent of the file size.
+*/
+// *****************************************************************************
+#ifndef TextParser_h
+#define TextParser_h
+
+#include <istream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+#include <type_traits>
+
+#include "Types.hpp"
+
+namespace tk {
+
+//! Skip blanks (but not new lines) in a line of text
+//! \param[in] p Position in text
+//! \return Position of the first non-blank character starting from p
+inline const char* skipBlanks( const char* p ) {
+  while (*p == ' ' || *p == '\t' || *p == '\r') ++p;
+  return p;
+}
+
+//! Parse an integer in a line of text
+//! \param[in] p Position in text, leading blanks are skipped
+//! \param[out] v Integer parsed
+//! \return Position after the integer parsed, nullptr if there is no integer
+//!   in the line at p
+template< typename T >
+const char* parseInt( const char* p, T& v ) {
+  static_assert( std::is_integral_v< T >, "Integer type required" );
+  p = skipBlanks( p );
+  bool neg = false;
+  if (*p == '-' || *p == '+') neg = (*p++ == '-');
+  if (*p < '0' || *p > '9') return nullptr;
+  T r = 0;
+  while (*p >= '0' && *p <= '9')
+    r = static_cast< T >( r*10 + static_cast< T >( *p++ - '0' ) );
+  if constexpr( std::is_signed_v< T > ) v = neg ? -r : r;
+  else v = r;
+  return p;
+}
+
+//! Parse a real number in a line of text
+const char* parseReal( const char* p, tk::real& v );
+
+//! Find the end of the first number of lines in a range of text
+const char* endOfLines( const char* begin,
+                        const char* end,
+                        std::size_t nline,
+                        std::size_t& n );
+
+//! Read and parse a number of lines of text from a stream in parallel
+//! \tparam Output Type of the data parsed from a range of lines, default
+//!   constructible
+//! \param[in,out] is Stream to read from, which must be seekable, positioned
+//!   at the beginning of the first line to parse. On successful return, it is
+//!   positioned at the beginning of the line after the last line parsed.
+//! \param[in] nline Number of lines to parse
+//! \param[in] parse Function called for each line as parse(line,out), with
+//!   line pointing to the beginning of the line, terminated by a new line or
+//!   a null character, and out the data the line is to be appended to,
+//!   returning false if the line cannot be parsed
+//! \param[in] merge Function called as merge(out) with the data parsed from
+//!   the ranges of lines in the order of the lines
+//! \param[in] chunksize Number of bytes read from the stream at a time
+//! \return True if all lines have been parsed, false if a line could not be
+//!   parsed or the stream ended before all lines have been read
+//! \details Lines are split into at most 64 ranges per chunk of bytes read,
+//!   parsed in parallel if OpenMP is enabled, yielding an Output object per
+//!   range, which are then merged in order.
+template< class Output, class Parse, class Merge >
+bool parseLines( std::istream& is,
+                 std::size_t nline,
+                 Parse&& parse,
+                 Merge&& merge,
+                 std::size_t chunksize = 1UL << 24 )
+{
+  const auto start = is.tellg();
+  std::size_t consumed = 0, done = 0;
+  // Bytes read but not yet parsed, null-terminated, not value-initialized
+  std::size_t cap = chunksize, size = 0;
+  std::unique_ptr< char[] > buf( new char[ cap+1 ] );
+  bool eof = false;
+
+  while (done < nline) {
+
+    // Read the next chunk of bytes after the partial line left over
+    if (!eof) {
+      is.read( buf.get() + size, static_cast< std::streamsize >( cap - size ) );
+      auto got = static_cast< std::size_t >( is.gcount() );
+      eof = got < cap - size;
+      size += got;
+      buf[ size ] = '\0';
+    }
+
+    // Find the range of the whole lines to parse, including a last line that
+    // is not terminated by a new line at the end of the stream
+    const char* b = buf.get();
+    const char* e = b + size;
+    std::size_t n = 0;
+    const char* cut = endOfLines( b, e, nline-done, n );
+    if (eof && n < nline-done && cut < e) { cut = e; ++n; }
+    if (n == 0) {
+      if (eof) return false;
+      // a line longer than the buffer: grow the buffer
+      std::unique_ptr< char[] > bigger( new char[ 2*cap+1 ] );
+      std::memcpy( bigger.get(), buf.get(), size );
+      buf = std::move( bigger );
+      cap *= 2;
+      continue;
+    }
+
+    // Split the lines into ranges of roughly equal number of bytes
+    auto len = static_cast< std::size_t >( cut - b );
+    auto nrange = std::min< std::size_t >( 64, n/1024 + 1 );
+    std::vector< const char* > range( nrange+1, cut );
+    range[0] = b;
+    for (std::size_t r=1; r<nrange; ++r) {
+      auto q = std::max( range[r-1], b + r*len/nrange );
+      auto nl = static_cast< const char* >(
+        std::memchr( q, '\n', static_cast< std::size_t >( cut - q ) ) );
+      range[r] = nl ? nl+1 : cut;
+    }
+
+    // Parse the ranges of lines in parallel
+    std::vector< Output > out( nrange );
+    std::vector< char > ok( nrange, 1 );
+    auto nr = static_cast< std::ptrdiff_t >( nrange );
+    #pragma omp parallel for schedule(dynamic)
+    for (std::ptrdiff_t ir=0; ir<nr; ++ir) {
+      auto r = static_cast< std::size_t >( ir );
+      for (const char* p = range[r]; p < range[r+1]; ) {
+        if (!parse( p, out[r] )) { ok[r] = 0; break; }
+        auto nl = static_cast< const char* >( std::memchr(
+                    p, '\n', static_cast< std::size_t >( range[r+1] - p ) ) );
+        p = nl ? nl+1 : range[r+1];
+      }
+    }
+    if (std::find( begin(ok), end(ok), 0 ) != end(ok)) return false;
+    for (auto& o : out) merge( o );
+
+    done += n;
+    consumed += len;
+    size -= len;
+    std::memmove( buf.get(), buf.get() + len, size );
+  }
+
+  // Position stream after the last line parsed
+  is.clear();
+  is.seekg( start + static_cast< std::streamoff >( consumed ) );
+  return true;
+}
+
+} // tk::
+
+#endif // TextParser_h
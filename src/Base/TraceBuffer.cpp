@@ -0,0 +1,79 @@
+// *****************************************************************************
+/*!
+  \file      src/Base/TraceBuffer.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Fixed-size ring buffer of trace events
+  \details   Fixed-size ring buffer of trace events. The registry of the kinds
+    of events is shared by all threads of the process, e.g., by the PEs of a
+    Charm++ SMP process, and is thus guarded by a mutex, which is only locked
+    when registering and when writing the events, not when recording them.
+*/
+// *****************************************************************************
+
+#include <mutex>
+#include <iomanip>
+#include <unordered_map>
+
+#include "TraceBuffer.hpp"
+
+namespace tk {
+
+//! Mutex guarding the registry of kinds of trace events
+static std::mutex g_tracemutex;
+
+//! Names of kinds of trace events registered in this process
+static std::vector< std::string > g_tracename;
+
+//! Ids of kinds of trace events registered in this process
+static std::unordered_map< std::string, std::uint32_t > g_traceid;
+
+} // tk::
+
+std::uint32_t
+tk::traceEvent( const std::string& name )
+// *****************************************************************************
+//  Register a kind of trace events by name
+//! \param[in] name Name of the kind of events
+//! \return Id of the kind of events, the same for the same name
+//! \details Ids are only unique within a process, the names are written with
+//!   the events.
+// *****************************************************************************
+{
+  std::lock_guard< std::mutex > lock( g_tracemutex );
+  auto e = g_traceid.emplace( name, g_tracename.size() );
+  if (e.second) g_tracename.push_back( name );
+  return e.first->second;
+}
+
+void
+tk::TraceBuffer::write( std::ostream& os, int pe ) const
+// *****************************************************************************
+//  Write events held in the Chrome trace event format
+//! \param[in,out] os Stream to write to
+//! \param[in] pe PE whose events are written, used as the process id, while
+//!   chare ids are used as thread ids, so that each chare gets its own
+//!   timeline within its PE
+//! \details Times are written in microseconds, as required by the format.
+// *****************************************************************************
+{
+  // Look up the names once, not per event
+  std::vector< std::string > name;
+  {
+    std::lock_guard< std::mutex > lock( g_tracemutex );
+    name = g_tracename;
+  }
+
+  os << "{\"displayTimeUnit\":\"ms\",\"otherData\":{\"pe\":" << pe
+     << ",\"dropped\":" << dropped() << "},\"traceEvents\":[\n"
+     << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << pe
+     << ",\"args\":{\"name\":\"PE " << pe << "\"}}";
+  os << std::fixed << std::setprecision(3);
+  visit( [&]( const TraceEvent& e ){
+    os << ",\n{\"name\":\"" << name[ e.ev ] << "\",\"ph\":\"X\",\"ts\":"
+       << e.t0 * 1.0e6 << ",\"dur\":" << e.dur * 1.0e6 << ",\"pid\":" << pe
+       << ",\"tid\":" << e.id << ",\"args\":{\"it\":" << e.it << "}}"; } );
+  os << "\n]}\n";
+}
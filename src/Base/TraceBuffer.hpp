@@ -0,0 +1,123 @@
+// *****************************************************************************
+/*!
+  \file      src/Base/TraceBuffer.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Fixed-size ring buffer of trace events
+  \details   Fixed-size ring buffer of trace events. Kinds of events are
+    registered by name once per process, e.g., at the first use of a call
+    site, and are then recorded by their compact integer ids together with the
+    chare id, the iteration count, and the start and end times of the event.
+    The buffer is allocated once with its capacity, thus recording an event
+    does not allocate, and when the buffer is full, the oldest events are
+    overwritten. Since each event holds both its start and end time, events
+    overwritten do not leave unmatched begin or end events behind. The
+    events are written in the Chrome trace event format, which Perfetto and
+    chrome://tracing display as a timeline.
+*/
+// *****************************************************************************
+#ifndef TraceBuffer_h
+#define TraceBuffer_h
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <ostream>
+#include <algorithm>
+
+#include "Types.hpp"
+#include "PUPUtil.hpp"
+
+namespace tk {
+
+//! Register a kind of trace events by name
+std::uint32_t traceEvent( const std::string& name );
+
+//! Trace event
+struct TraceEvent {
+  tk::real t0;          //!< Start time in seconds
+  tk::real dur;         //!< Duration in seconds
+  uint64_t it;          //!< Iteration count
+  int id;               //!< Chare id (thisIndex)
+  std::uint32_t ev;     //!< Kind of event, see traceEvent()
+};
+
+//! Fixed-size ring buffer of trace events
+class TraceBuffer {
+
+  public:
+    //! Constructor
+    //! \param[in] capacity Number of most recent events held, zero disables
+    //!   recording events
+    explicit TraceBuffer( std::size_t capacity = 0 ) :
+      m_event( capacity ), m_next( 0 ), m_count( 0 ) {}
+
+    //! Query if events are recorded
+    //! \return True if the buffer can hold events
+    bool enabled() const { return !m_event.empty(); }
+
+    //! Record an event
+    //! \param[in] ev Kind of event, see traceEvent()
+    //! \param[in] id Chare id
+    //! \param[in] it Iteration count
+    //! \param[in] t0 Start time in seconds
+    //! \param[in] t1 End time in seconds
+    void record( std::uint32_t ev, int id, uint64_t it, tk::real t0,
+                 tk::real t1 )
+    {
+      if (m_event.empty()) return;
+      m_event[ m_next ] = { t0, t1-t0, it, id, ev };
+      if (++m_next == m_event.size()) m_next = 0;
+      ++m_count;
+    }
+
+    //! Query number of events held
+    //! \return Number of events held
+    std::size_t size() const { return std::min( m_count, m_event.size() ); }
+
+    //! Query number of events overwritten
+    //! \return Number of events recorded but no longer held
+    std::size_t dropped() const { return m_count - size(); }
+
+    //! Visit events held, oldest first
+    //! \param[in] f Function called as f(e) for each event e held
+    template< class F >
+    void visit( F&& f ) const {
+      auto first = m_count > m_event.size() ? m_next : 0;
+      for (std::size_t i=0; i<size(); ++i)
+        f( m_event[ (first + i) % m_event.size() ] );
+    }
+
+    //! Write events held in the Chrome trace event format
+    void write( std::ostream& os, int pe ) const;
+
+    /** @name Charm++ pack/unpack serializer member functions */
+    ///@{
+    //! \brief Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \details Only the capacity migrates, events are not.
+    void pup( PUP::er &p ) {
+      auto capacity = m_event.size();
+      p | capacity;
+      if (p.isUnpacking()) {
+        m_event.resize( capacity );
+        m_next = m_count = 0;
+      }
+    }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] t TraceBuffer object reference
+    friend void operator|( PUP::er& p, TraceBuffer& t ) { t.pup(p); }
+    //@}
+
+  private:
+    std::vector< TraceEvent > m_event;  //!< Ring buffer of events
+    std::size_t m_next;                 //!< Slot of next event
+    std::size_t m_count;                //!< Number of events recorded
+};
+
+} // tk::
+
+#endif // TraceBuffer_h
@@ -12,12 +12,28 @@
 #ifndef Types_h
 #define Types_h
 
+#include <cstdint>
+#include <cstddef>
+
+#include "QuinoaConfig.hpp"
+
 namespace tk {
 
 //! Real number type used throughout the whole code.
 // TODO Test with single precision and possibly others.
 using real = double;
 
+//! Local id type of compact connectivity of a mesh chunk, e.g., edges
+//! \details This is 32 bits if LOCAL_INDEX_32 is configured, which halves
+//!   the memory and the index traffic of loops gathering and scattering via
+//!   these ids, since a mesh chunk of a single chare has far less than 2^32
+//!   entities. Global ids are always std::size_t.
+#if defined LOCAL_INDEX_32
+using lid_t = uint32_t;
+#else
+using lid_t = std::size_t;
+#endif
+
 } // tk::
 
 #endif // Types_h
@@ -335,6 +335,34 @@ cramer( const std::array< std::array< tk::real, 3 >, 3>& a,
   return x;
 }
 
+//! Compute the inverse of a 3x3 matrix
+//!  \param[in] a 3x3 matrix
+//!  \return Inverse of the 3x3 matrix, computed from its adjugate
+//!  \details Multiplying a vector b by the inverse gives the same solution
+//!    as cramer( a, b ), but the inverse can be computed once and applied to
+//!    many right hand sides.
+inline std::array< std::array< tk::real, 3 >, 3 >
+inverse( const std::array< std::array< tk::real, 3 >, 3 >& a )
+{
+  auto de = determinant( a );
+
+  std::array< std::array< tk::real, 3 >, 3 > ai;
+
+  ai[0][0] =  (a[1][1]*a[2][2] - a[1][2]*a[2][1]) / de;
+  ai[0][1] = -(a[0][1]*a[2][2] - a[0][2]*a[2][1]) / de;
+  ai[0][2] =  (a[0][1]*a[1][2] - a[0][2]*a[1][1]) / de;
+
+  ai[1][0] = -(a[1][0]*a[2][2] - a[1][2]*a[2][0]) / de;
+  ai[1][1] =  (a[0][0]*a[2][2] - a[0][2]*a[2][0]) / de;
+  ai[1][2] = -(a[0][0]*a[1][2] - a[0][2]*a[1][0]) / de;
+
+  ai[2][0] =  (a[1][0]*a[2][1] - a[1][1]*a[2][0]) / de;
+  ai[2][1] = -(a[0][0]*a[2][1] - a[0][1]*a[2][0]) / de;
+  ai[2][2] =  (a[0][0]*a[1][1] - a[0][1]*a[1][0]) / de;
+
+  return ai;
+}
+
 } // tk::
 
 #endif // Vector_h
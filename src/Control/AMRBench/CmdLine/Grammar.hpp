@@ -0,0 +1,115 @@
+// *****************************************************************************
+/*!
+  \file      src/Control/AMRBench/CmdLine/Grammar.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     AMRBench's command line grammar definition
+  \details   Grammar definition for parsing the command line. We use the Parsing
+  Expression Grammar Template Library (PEGTL) to create the grammar and the
+  associated parser. Word of advice: read from the bottom up.
+*/
+// *****************************************************************************
+#ifndef AMRBenchCmdLineGrammar_h
+#define AMRBenchCmdLineGrammar_h
+
+#include "CommonGrammar.hpp"
+#include "Keywords.hpp"
+
+namespace amrbench {
+//! Mesh refinement benchmark command line grammar definition
+namespace cmd {
+
+  using namespace tao;
+
+  //! \brief Specialization of tk::grm::use for AMRBench's command line parser
+  template< typename keyword >
+  using use = tk::grm::use< keyword, ctr::CmdLine::keywords::set >;
+
+  // AMRBench's CmdLine state
+
+  // AMRBench's CmdLine grammar
+
+  //! brief Match and set verbose switch (i.e., verbose or quiet output)
+  struct verbose :
+         tk::grm::process_cmd_switch< use, kw::verbose, tag::verbose > {};
+
+  //! Match and set chare state switch
+  struct charestate :
+         tk::grm::process_cmd_switch< use, kw::charestate,
+                                      tag::chare > {};
+
+  //! Match and set number of mesh refinement cycles
+  struct ncycle :
+         tk::grm::process_cmd< use, kw::ncycle_cmd,
+                               tk::grm::Store< tag::ncycle >,
+                               tk::grm::number,
+                               tag::ncycle > {};
+
+  //! Match and set uniform refinement switch
+  struct uniform :
+         tk::grm::process_cmd_switch< use, kw::uniform_cmd, tag::uniform > {};
+
+  //! \brief Match and set io parameter
+  template< typename keyword, typename io_tag >
+  struct io :
+         tk::grm::process_cmd< use, keyword,
+                               tk::grm::Store< tag::io, io_tag >,
+                               pegtl::any,
+                               tag::io, io_tag > {};
+
+  //! \brief Match help on command-line parameters
+  struct help :
+         tk::grm::process_cmd_switch< use, kw::help, tag::help > {};
+
+  //! \brief Match help on a single command-line or control file keyword
+  struct helpkw :
+         tk::grm::process_cmd< use, kw::helpkw,
+                               tk::grm::helpkw,
+                               pegtl::alnum,
+                               tag::discr /* = unused */ > {};
+
+  //! Match help on control file keywords
+  struct quiescence :
+         tk::grm::process_cmd_switch< use, kw::quiescence,
+                                      tag::quiescence > {};
+
+  //! Match switch on trace output
+  struct trace :
+         tk::grm::process_cmd_switch< use, kw::trace,
+                                      tag::trace > {};
+
+  //! Match switch on version output
+  struct version :
+         tk::grm::process_cmd_switch< use, kw::version,
+                                      tag::version > {};
+
+  //! Match switch on license output
+  struct license :
+         tk::grm::process_cmd_switch< use, kw::license,
+                                      tag::license > {};
+
+  //! \brief Match all command line keywords
+  struct keywords :
+         pegtl::sor< verbose,
+                     charestate,
+                     ncycle,
+                     uniform,
+                     help,
+                     helpkw,
+                     quiescence,
+                     trace,
+                     version,
+                     license,
+                     io< kw::input, tag::input >,
+                     io< kw::screen, tag::screen > > {};
+
+  //! \brief Grammar entry point: parse keywords until end of string
+  struct read_string :
+         tk::grm::read_string< keywords > {};
+
+} // cmd::
+} // amrbench::
+
+#endif // AMRBenchCmdLineGrammar_h
@@ -0,0 +1,38 @@
+// *****************************************************************************
+/*!
+  \file      src/Control/AMRBench/CmdLine/Parser.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     AMRBench's command line parser
+  \details   This file declares the command-line argument parser for the mesh
+     refinement benchmark, AMRBench.
+*/
+// *****************************************************************************
+#ifndef AMRBenchCmdLineParser_h
+#define AMRBenchCmdLineParser_h
+
+#include "StringParser.hpp"
+#include "AMRBench/CmdLine/CmdLine.hpp"
+
+namespace tk { class Print; }
+
+namespace amrbench {
+
+//! \brief Command-line parser for AMRBench.
+//! \details This class is used to interface with PEGTL, for the purpose of
+//!   parsing command-line arguments for the mesh refinement benchmark, AMRBench.
+class CmdLineParser : public tk::StringParser {
+
+  public:
+    //! Constructor
+    explicit CmdLineParser( int argc,
+                            char** argv,
+                            const tk::Print& print,
+                            ctr::CmdLine& cmdline );
+};
+
+} // amrbench::
+
+#endif // AMRBenchCmdLineParser_h
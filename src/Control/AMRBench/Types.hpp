@@ -0,0 +1,40 @@
+// *****************************************************************************
+/*!
+  \file      src/Control/AMRBench/Types.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Types for AMRBench's parsers
+  \details   Types for AMRBench's parsers. This file defines the components of
+    the tagged tuple that stores heterogeneous objects in a hierarchical way.
+    These components are therefore part of the grammar stack that is filled
+    during command-line argument parsing.
+*/
+// *****************************************************************************
+#ifndef AMRBenchTypes_h
+#define AMRBenchTypes_h
+
+#include "TaggedTuple.hpp"
+#include "Tags.hpp"
+#include "Keyword.hpp"
+
+namespace amrbench {
+namespace ctr {
+
+using namespace tao;
+
+//! IO parameters storage
+using ios = tk::TaggedTuple< brigand::list<
+    tag::nrestart,  int                             //!< Number of restarts
+  , tag::input,     std::string                     //!< Input filename
+  , tag::screen,    kw::screen::info::expect::type  //!< Screen output filename
+> >;
+
+//! PEGTL location/position type to use throughout all of AMRBench's parsers
+using Location = pegtl::position;
+
+} // ctr::
+} // amrbench::
+
+#endif // AMRBenchTypes_h
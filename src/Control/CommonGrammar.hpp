@@ -25,6 +25,7 @@
 #include "Tags.hpp"
 #include "StatCtr.hpp"
 #include "Options/PDFFile.hpp"
+#include "Options/StatFile.hpp"
 #include "Options/PDFPolicy.hpp"
 #include "Options/PDFCentering.hpp"
 #include "Options/TxtFloatFormat.hpp"
@@ -108,6 +109,7 @@ namespace grm {
     EOSGAMMA,           //!< Wrong number of EOS gamma parameters
     EOSCV,              //!< Wrong number of EOS cv parameters
     EOSPSTIFF,          //!< Wrong number of EOS pstiff parameters
+    EOSTABLE,           //!< Wrong number of EOS table files
     NORNG,              //!< No RNG selected
     NODT,               //!< No time-step-size policy selected
     MULDT,              //!< Multiple time-step-size policies selected
@@ -154,6 +156,7 @@ namespace grm {
     T0REFNOOP,          //!< AMR t<0 refinement will be no-op
     DTREFNOOP,          //!< AMR t>0 refinement will be no-op
     PREFTOL,            //!< p-refinement tolerance out of bounds
+    PREFFREQ,           //!< p-refinement frequency zero
     CHARMARG,           //!< Argument inteded for the Charm++ runtime system
     OPTIONAL };         //!< Message key used to indicate of something optional
 
@@ -228,6 +231,11 @@ namespace grm {
       "... end' sub-block. The number of components between 'pstiff ... end' "
       "is incorrect, whose size must equal the number of materials set by "
       "keyword 'nmat'." },
+    { MsgKey::EOSTABLE, "Incorrect number of multi-material tabulated equation "
+      "of state (EOS) files configured in the preceding block's 'material ... "
+      "end' sub-block. The number of file names between 'eos_table ... end' "
+      "is incorrect, whose size must equal the number of materials set by "
+      "keyword 'nmat'." },
     { MsgKey::NORNG, "The random number generator has not been specified in "
       "the block preceding this position. This is mandatory for the preceding "
       "block. Use the keyword 'rng' to specify the random number generator." },
@@ -419,6 +427,8 @@ namespace grm {
       "e.g., '" + kw::amr_refvar::string() + " c end'." },
     { MsgKey::PREFTOL, "The p-refinement tolerance must be a real number "
       "between 0.0 and 1.0, both inclusive." },
+    { MsgKey::PREFFREQ, "The p-refinement frequency must be a positive "
+      "integer." },
     { MsgKey::CHARMARG, "Arguments starting with '+' are assumed to be inteded "
       "for the Charm++ runtime system. Did you forget to prefix the command "
       "line with charmrun? If this warning persists even after running with "
@@ -1692,12 +1702,23 @@ namespace grm {
                          block< use< kw::end >,
                                 interval< use< kw::interval >,
                                           tag::stat >,
+                                process< use< kw::filetype >,
+                                         store< tk::ctr::StatFile,
+                                                tag::selected,
+                                                tag::statfile >,
+                                         pegtl::alpha >,
                                 process< use< kw::txt_float_format >,
                                          store< tk::ctr::TxtFloatFormat,
                                                 tag::flformat,
                                                 tag::stat >,
                                          pegtl::alpha >,
                                 precision< use, tag::stat >,
+                                process< use< kw::lazy >,
+                                         Store< tag::discr, tag::lazy >,
+                                         pegtl::alpha >,
+                                process< use< kw::async >,
+                                         Store< tag::discr, tag::async >,
+                                         pegtl::alpha >,
                                 parse_expectations > > {};
 
   //! Parse diagnostics ... end block
@@ -1864,6 +1885,8 @@ namespace grm {
                                 tag::flformat,
                                 tag::pdf > >,
              precision< use, tag::pdf >,
+             control< use< kw::pdf_sample >, pegtl::digit,
+                      tag::discr, tag::pdfsample >,
              parse_pdf > > {};
 
   //! \brief Ensure that a grammar only uses keywords from a pool of
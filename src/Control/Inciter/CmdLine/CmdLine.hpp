@@ -46,7 +46,15 @@ using CmdLineMembers = brigand::list<
   , tag::helpkw,         tk::ctr::HelpKw
   , tag::error,          std::vector< std::string >
   , tag::lbfreq,         kw::lbfreq::info::expect::type
+  , tag::perffreq,       kw::perffreq::info::expect::type
+  , tag::tracebuf,       kw::tracebuf::info::expect::type
+  , tag::perfctr,        bool
   , tag::rsfreq,         kw::rsfreq::info::expect::type
+  , tag::memfreq,        kw::memfreq::info::expect::type
+  , tag::ckptincr,       bool
+  , tag::ckptcompress,   bool
+  , tag::iobench,        kw::iobench::info::expect::type
+  , tag::iofields,       kw::iofields::info::expect::type
 >;
 
 //! \brief CmdLine : Control< specialized to Inciter >
@@ -75,7 +83,15 @@ class CmdLine : public tk::TaggedTuple< CmdLineMembers > {
                                      , kw::diagnostics_cmd
                                      , kw::quiescence
                                      , kw::lbfreq
+                                     , kw::perffreq
+                                     , kw::tracebuf
+                                     , kw::perfctr
                                      , kw::rsfreq
+                                     , kw::memfreq
+                                     , kw::ckptincr
+                                     , kw::ckptcompress
+                                     , kw::iobench
+                                     , kw::iofields
                                      , kw::trace
                                      , kw::version
                                      , kw::license
@@ -125,6 +141,7 @@ class CmdLine : public tk::TaggedTuple< CmdLineMembers > {
         tk::baselogname( tk::inciter_executable() );
       get< tag::io, tag::diag >() = "diag";
       get< tag::io, tag::particles >() = "track.h5part";
+      get< tag::io, tag::perf >() = "perf";
       get< tag::io, tag::restart >() = "restart";
       get< tag::virtualization >() = 0.0;
       get< tag::verbose >() = false; // Quiet output by default
@@ -133,7 +150,15 @@ class CmdLine : public tk::TaggedTuple< CmdLineMembers > {
       get< tag::benchmark >() = false; // No benchmark mode by default
       get< tag::feedback >() = false; // No detailed feedback by default
       get< tag::lbfreq >() = 1; // Load balancing every time-step by default
+      get< tag::perffreq >() = 0; // No performance report by default
+      get< tag::tracebuf >() = 0; // No tracing by default
+      get< tag::perfctr >() = false; // No performance counters by default
       get< tag::rsfreq >() = 1000;// Chkpt/restart after this many time steps
+      get< tag::memfreq >() = 0; // No in-memory checkpoints by default
+      get< tag::ckptincr >() = false; // Full checkpoints by default
+      get< tag::ckptcompress >() = false; // Uncompressed checkpoints by default
+      get< tag::iobench >() = 0; // No I/O benchmark by default
+      get< tag::iofields >() = 8; // Fields per output in I/O benchmark
       get< tag::trace >() = true; // Output call and stack trace by default
       get< tag::version >() = false; // Do not display version info by default
       get< tag::license >() = false; // Do not display license info by default
@@ -100,6 +100,25 @@ namespace cmd {
                                tk::grm::number,
                                tag::lbfreq > {};
 
+  //! Match and set performance report frequency
+  struct perffreq :
+         tk::grm::process_cmd< use, kw::perffreq,
+                               tk::grm::Store< tag::perffreq >,
+                               tk::grm::number,
+                               tag::perffreq > {};
+
+  //! Match and set trace buffer size
+  struct tracebuf :
+         tk::grm::process_cmd< use, kw::tracebuf,
+                               tk::grm::Store< tag::tracebuf >,
+                               tk::grm::number,
+                               tag::tracebuf > {};
+
+  //! Match switch on hardware performance counters
+  struct perfctr :
+         tk::grm::process_cmd_switch< use, kw::perfctr,
+                                      tag::perfctr > {};
+
   //! Match and set checkpoint/restartfrequency
   struct rsfreq :
          tk::grm::process_cmd< use, kw::rsfreq,
@@ -107,6 +126,37 @@ namespace cmd {
                                tk::grm::number,
                                tag::rsfreq > {};
 
+  //! Match and set in-memory checkpoint frequency
+  struct memfreq :
+         tk::grm::process_cmd< use, kw::memfreq,
+                               tk::grm::Store< tag::memfreq >,
+                               tk::grm::number,
+                               tag::memfreq > {};
+
+  //! Match and set incremental checkpoints switch
+  struct ckptincr :
+         tk::grm::process_cmd_switch< use, kw::ckptincr,
+                                      tag::ckptincr > {};
+
+  //! Match and set checkpoint compression switch
+  struct ckptcompress :
+         tk::grm::process_cmd_switch< use, kw::ckptcompress,
+                                      tag::ckptcompress > {};
+
+  //! Match and set number of field outputs of I/O benchmark
+  struct iobench :
+         tk::grm::process_cmd< use, kw::iobench,
+                               tk::grm::Store< tag::iobench >,
+                               tk::grm::number,
+                               tag::iobench > {};
+
+  //! Match and set number of fields written by I/O benchmark
+  struct iofields :
+         tk::grm::process_cmd< use, kw::iofields,
+                               tk::grm::Store< tag::iofields >,
+                               tk::grm::number,
+                               tag::iofields > {};
+
   //! Match switch on trace output
   struct trace :
          tk::grm::process_cmd_switch< use, kw::trace,
@@ -135,7 +185,15 @@ namespace cmd {
                      helpkw,
                      quiescence,
                      lbfreq,
+                     perffreq,
+                     tracebuf,
+                     perfctr,
                      rsfreq,
+                     memfreq,
+                     ckptincr,
+                     ckptcompress,
+                     iobench,
+                     iofields,
                      trace,
                      version,
                      license,
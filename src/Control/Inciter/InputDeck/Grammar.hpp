@@ -392,6 +392,13 @@ namespace grm {
       if (gamma.empty() || gamma.back().size() != nmat.back())
         Message< Stack, ERROR, MsgKey::EOSGAMMA >( stack, in );
 
+      // If tabulated equations of state are not given, use stiffened gas,
+      // otherwise require one per material
+      auto& eostable = stack.template get< param, eq, tag::eostable >();
+      if (eostable.size() != neq.get< eq >()) eostable.push_back( {} );
+      if (!eostable.back().empty() && eostable.back().size() != nmat.back())
+        Message< Stack, ERROR, MsgKey::EOSTABLE >( stack, in );
+
       // If pressure relaxation is not specified, default to 'false'
       auto& prelax = stack.template get< param, eq, tag::prelax >();
       if (prelax.empty() || prelax.size() != neq.get< eq >())
@@ -684,6 +691,8 @@ namespace grm {
       auto& tolref = stack.template get< tag::pref, tag::tolref >();
       if (tolref < 0.0 || tolref > 1.0)
         Message< Stack, ERROR, MsgKey::PREFTOL >( stack, in );
+      if (stack.template get< tag::pref, tag::dtfreq >() == 0)
+        Message< Stack, ERROR, MsgKey::PREFFREQ >( stack, in );
     }
   };
 
@@ -754,6 +763,13 @@ namespace deck {
            tk::grm::discrparam< use, kw::t0, tag::t0 >,
            tk::grm::discrparam< use, kw::dt, tag::dt >,
            tk::grm::discrparam< use, kw::cfl, tag::cfl >,
+           tk::grm::discrparam< use, kw::lagged_dt, tag::laggeddt >,
+           tk::grm::discrparam< use, kw::rk_tol, tag::rktol >,
+           tk::grm::discrparam< use, kw::rk_stages, tag::rkstages >,
+           tk::grm::discrparam< use, kw::dt_levels, tag::dtlevels >,
+           tk::grm::process< use< kw::lagged_diag >,
+                             tk::grm::Store< tag::discr, tag::laggeddiag >,
+                             pegtl::alpha >,
            tk::grm::discrparam< use, kw::residual, tag::residual >,
            tk::grm::discrparam< use, kw::rescomp, tag::rescomp >,
            tk::grm::process< use< kw::fcteps >,
@@ -761,6 +777,9 @@ namespace deck {
            tk::grm::process< use< kw::fctclip >,
                              tk::grm::Store< tag::discr, tag::fctclip >,
                              pegtl::alpha >,
+           tk::grm::process< use< kw::fctedge >,
+                             tk::grm::Store< tag::discr, tag::fctedge >,
+                             pegtl::alpha >,
            tk::grm::process< use< kw::fct >,
                              tk::grm::Store< tag::discr, tag::fct >,
                              pegtl::alpha >,
@@ -772,13 +791,36 @@ namespace deck {
            tk::grm::process< use< kw::operator_reorder >,
                              tk::grm::Store< tag::discr, tag::operator_reorder >,
                              pegtl::alpha >,
+           tk::grm::process< use< kw::elem_reorder >,
+                             tk::grm::Store< tag::discr, tag::elem_reorder >,
+                             pegtl::alpha >,
+           tk::grm::process< use< kw::fused_edgeflux >,
+                             tk::grm::Store< tag::discr, tag::fused_edgeflux >,
+                             pegtl::alpha >,
            tk::grm::process< use< kw::steady_state >,
                              tk::grm::Store< tag::discr, tag::steady_state >,
                              pegtl::alpha >,
+           tk::grm::process< use< kw::implicit >,
+                             tk::grm::Store< tag::discr, tag::implicit >,
+                             pegtl::alpha >,
+           tk::grm::discrparam< use, kw::krylov_maxit, tag::krylov_maxit >,
+           tk::grm::discrparam< use, kw::krylov_tol, tag::krylov_tol >,
+           tk::grm::process< use< kw::multigrid >,
+                             tk::grm::Store< tag::discr, tag::multigrid >,
+                             pegtl::alpha >,
+           tk::grm::discrparam< use, kw::mg_levels, tag::mg_levels >,
+           tk::grm::process< use< kw::freeze_grad >,
+                             tk::grm::Store< tag::discr, tag::freeze_grad >,
+                             pegtl::alpha >,
+           tk::grm::discrparam< use, kw::irs_sweeps, tag::irs_sweeps >,
+           tk::grm::discrparam< use, kw::irs_eps, tag::irs_eps >,
            tk::grm::interval< use< kw::ttyi >, tag::tty >,
            discroption< use, kw::scheme, inciter::ctr::Scheme, tag::scheme >,
            discroption< use, kw::limiter, inciter::ctr::Limiter, tag::limiter >,
-           tk::grm::discrparam< use, kw::cweight, tag::cweight >
+           discroption< use, kw::node_reorder, inciter::ctr::Reorder,
+                        tag::node_reorder >,
+           tk::grm::discrparam< use, kw::cweight, tag::cweight >,
+           tk::grm::discrparam< use, kw::limtol, tag::limtol >
          > {};
 
   //! PDE parameter vector
@@ -975,8 +1017,21 @@ namespace deck {
   struct material_property :
          pde_parameter_vector< keyword, eq, property > {};
 
+  //! put in tabulated equation of state file names for equation
+  template< typename eq >
+  struct material_eostable :
+         tk::grm::vector< use< kw::mat_eostable >,
+                          tk::grm::Store_back_back< tag::param, eq,
+                                                    tag::eostable >,
+                          use< kw::end >,
+                          tk::grm::start_vector< tag::param, eq,
+                                                 tag::eostable >,
+                          pegtl::not_one< '#' > > {};
+
   //! Material properties block for compressible flow
-  template< class eq >
+  //! \details Additional material properties, only configurable for some
+  //!   equation types, can be passed in via 'extra'.
+  template< class eq, class... extra >
   struct material_properties :
          pegtl::if_must<
            tk::grm::readkw< use< kw::material >::pegtl_string >,
@@ -986,7 +1041,8 @@ namespace deck {
              material_property< eq, kw::mat_pstiff, tag::pstiff >,
              material_property< eq, kw::mat_mu, tag::mu >,
              material_property< eq, kw::mat_cv, tag::cv >,
-             material_property< eq, kw::mat_k, tag::k > > > {};
+             material_property< eq, kw::mat_k, tag::k >,
+             extra... > > {};
 
   //! transport equation for scalars
   struct transport :
@@ -1121,7 +1177,8 @@ namespace deck {
                                                            tag::multimat,
                                                            tag::flux >,
                              pegtl::alpha >,
-                           material_properties< tag::multimat >,
+                           material_properties< tag::multimat,
+                             material_eostable< tag::multimat > >,
                            parameter< tag::multimat,
                                       kw::pde_alpha,
                                       tag::alpha >,
@@ -1165,6 +1222,57 @@ namespace deck {
                                tk::ctr::PartitioningAlgorithm,
                                tag::selected,
                                tag::partitioner >,
+                             pegtl::alpha >,
+                           tk::grm::control< use< kw::bface_weight >,
+                                             pegtl::digit,
+                                             tag::discr,
+                                             tag::bfaceweight >,
+                           tk::grm::process< use< kw::hierarchical >,
+                             tk::grm::Store< tag::discr, tag::hierarchical >,
+                             pegtl::alpha >,
+                           tk::grm::process< use< kw::graph_map >,
+                             tk::grm::Store< tag::discr, tag::graphmap >,
+                             pegtl::alpha >,
+                           tk::grm::control< use< kw::dist_chunk >,
+                                             pegtl::digit,
+                                             tag::discr,
+                                             tag::distchunk >,
+                           tk::grm::process< use< kw::mesh_cache >,
+                             tk::grm::Store< tag::discr, tag::meshcache >,
+                             pegtl::graph >,
+                           tk::grm::process< use< kw::part_field >,
+                             tk::grm::Store< tag::discr, tag::partfield >,
+                             pegtl::graph >,
+                           tk::grm::process< use< kw::reduced_ghost >,
+                             tk::grm::Store< tag::discr, tag::reducedghost >,
+                             pegtl::alpha >,
+                           tk::grm::process< use< kw::reduced_halo >,
+                             tk::grm::Store< tag::discr, tag::reducedhalo >,
+                             pegtl::alpha >,
+                           tk::grm::process< use< kw::cost_lb >,
+                             tk::grm::Store< tag::discr, tag::costlb >,
+                             pegtl::alpha >,
+                           tk::grm::control< use< kw::migration_cost >,
+                                             pegtl::digit,
+                                             tag::discr,
+                                             tag::migcost >,
+                           tk::grm::process< use< kw::auto_virtualization >,
+                             tk::grm::Store< tag::discr, tag::autovirt >,
+                             pegtl::alpha >,
+                           tk::grm::control< use< kw::elem_cost >,
+                                             pegtl::digit,
+                                             tag::discr,
+                                             tag::elemcost >,
+                           tk::grm::control< use< kw::msg_latency >,
+                                             pegtl::digit,
+                                             tag::discr,
+                                             tag::msglatency >,
+                           tk::grm::control< use< kw::msg_overhead >,
+                                             pegtl::digit,
+                                             tag::discr,
+                                             tag::msgoverhead >,
+                           tk::grm::process< use< kw::msg_priority >,
+                             tk::grm::Store< tag::discr, tag::msgprio >,
                              pegtl::alpha > > > {};
 
   //! equation types
@@ -1212,12 +1320,26 @@ namespace deck {
                                              pegtl::digit,
                                              tag::amr,
                                              tag::tolderef >,
+                           tk::grm::control< use< kw::amr_lbimbalance >,
+                                             pegtl::digit,
+                                             tag::amr,
+                                             tag::lbimbalance >,
+                           tk::grm::control< use< kw::amr_buffer >,
+                                             pegtl::digit,
+                                             tag::amr,
+                                             tag::buffer >,
                            tk::grm::process< use< kw::amr_t0ref >,
                              tk::grm::Store< tag::amr, tag::t0ref >,
                              pegtl::alpha >,
                            tk::grm::process< use< kw::amr_dtref_uniform >,
                              tk::grm::Store< tag::amr, tag::dtref_uniform >,
                              pegtl::alpha >,
+                           tk::grm::process< use< kw::amr_qdcorr >,
+                             tk::grm::Store< tag::amr, tag::qdcorr >,
+                             pegtl::alpha >,
+                           tk::grm::process< use< kw::amr_t0ref_weight >,
+                             tk::grm::Store< tag::amr, tag::t0refweight >,
+                             pegtl::alpha >,
                            tk::grm::process< use< kw::amr_dtref >,
                              tk::grm::Store< tag::amr, tag::dtref >,
                              pegtl::alpha >,
@@ -1240,6 +1362,9 @@ namespace deck {
                                              pegtl::digit,
                                              tag::pref,
                                              tag::ndofmax >,
+                           tk::grm::process< use< kw::pref_dtfreq >,
+                             tk::grm::Store< tag::pref, tag::dtfreq >,
+                             pegtl::digit >,
                            tk::grm::process<
                              use< kw::pref_indicator >,
                              tk::grm::store_inciter_option<
@@ -1261,7 +1386,43 @@ namespace deck {
                                  tag::selected,
                                  tag::filetype >,
                                pegtl::alpha >,
+             tk::grm::process< use< kw::aggregate >,
+                               tk::grm::Store< tag::discr, tag::aggregate >,
+                               pegtl::alpha >,
+             tk::grm::process< use< kw::async_write >,
+                               tk::grm::Store< tag::discr, tag::asyncwrite >,
+                               pegtl::alpha >,
+             tk::grm::process< use< kw::persistent_files >,
+                               tk::grm::Store< tag::discr, tag::persistent >,
+                               pegtl::alpha >,
+             tk::grm::discrparam< use, kw::compression, tag::compression >,
+             tk::grm::discrparam< use, kw::lossy_tolerance, tag::lossytol >,
              tk::grm::interval< use< kw::interval >, tag::field >,
+             tk::grm::interval< use< kw::surface_interval >, tag::surface >,
+             tk::grm::interval< use< kw::slice_interval >, tag::slice >,
+             tk::grm::discrparam< use, kw::time_average, tag::tavg >,
+             pegtl::if_must<
+               tk::grm::vector<
+                 use< kw::covariance >,
+                 tk::grm::Store_back< tag::discr, tag::covariance >,
+                 use< kw::end > > >,
+             pegtl::if_must<
+               tk::grm::vector<
+                 use< kw::slice >,
+                 tk::grm::Store_back< tag::discr, tag::slice >,
+                 use< kw::end > > >,
+             pegtl::if_must<
+               tk::grm::vector<
+                 use< kw::isosurface >,
+                 tk::grm::Store_back< tag::discr, tag::isosurface >,
+                 use< kw::end > > >,
+             pegtl::if_must<
+               tk::grm::vector<
+                 use< kw::outvar >,
+                 tk::grm::Store_back< tag::discr, tag::outvar >,
+                 use< kw::end >,
+                 tk::grm::noop,
+                 pegtl::not_one< '#' > > >,
              pegtl::if_must<
                tk::grm::vector<
                  use< kw::sideset >,
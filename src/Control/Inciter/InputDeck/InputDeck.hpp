@@ -75,6 +75,8 @@ class InputDeck : public tk::TaggedTuple< InputDeckMembers > {
                                    kw::rib,
                                    kw::hsfc,
                                    kw::phg,
+                                   kw::sfc,
+                                   kw::parmetis,
                                    kw::inciter,
                                    kw::ncomp,
                                    kw::nmat,
@@ -118,6 +120,7 @@ class InputDeck : public tk::TaggedTuple< InputDeckMembers > {
                                    kw::mat_mu,
                                    kw::mat_cv,
                                    kw::mat_k,
+                                   kw::mat_eostable,
                                    kw::npar,
                                    kw::physics,
                                    kw::advection,
@@ -144,6 +147,18 @@ class InputDeck : public tk::TaggedTuple< InputDeckMembers > {
                                    kw::rayleigh_taylor,
                                    kw::taylor_green,
                                    kw::filetype,
+                                   kw::aggregate,
+                                   kw::async_write,
+                                   kw::persistent_files,
+                                   kw::compression,
+                                   kw::lossy_tolerance,
+                                   kw::surface_interval,
+                                   kw::time_average,
+                                   kw::slice,
+                                   kw::isosurface,
+                                   kw::outvar,
+                                   kw::slice_interval,
+                                   kw::covariance,
                                    kw::exodusii,
                                    kw::root,
                                    kw::error,
@@ -151,12 +166,49 @@ class InputDeck : public tk::TaggedTuple< InputDeckMembers > {
                                    kw::linf,
                                    kw::fct,
                                    kw::fctclip,
+                                   kw::fctedge,
                                    kw::fcteps,
                                    kw::sysfct,
                                    kw::sysfctvar,
                                    kw::pelocal_reorder,
+                                   kw::bface_weight,
+                                   kw::hierarchical,
+                                   kw::graph_map,
+                                   kw::dist_chunk,
+                                   kw::mesh_cache,
+                                   kw::part_field,
+                                   kw::reduced_ghost,
+                                   kw::reduced_halo,
+                                   kw::cost_lb,
+                                   kw::migration_cost,
+                                   kw::auto_virtualization,
+                                   kw::elem_cost,
+                                   kw::msg_latency,
+                                   kw::msg_overhead,
+                                   kw::msg_priority,
                                    kw::operator_reorder,
+                                   kw::node_reorder,
+                                   kw::operator_access,
+                                   kw::advancing_front,
+                                   kw::rcm,
+                                   kw::morton,
+                                   kw::hilbert,
+                                   kw::elem_reorder,
+                                   kw::fused_edgeflux,
                                    kw::steady_state,
+                                   kw::implicit,
+                                   kw::krylov_maxit,
+                                   kw::krylov_tol,
+                                   kw::lagged_dt,
+                                   kw::rk_tol,
+                                   kw::rk_stages,
+                                   kw::dt_levels,
+                                   kw::lagged_diag,
+                                   kw::multigrid,
+                                   kw::mg_levels,
+                                   kw::freeze_grad,
+                                   kw::irs_sweeps,
+                                   kw::irs_eps,
                                    kw::residual,
                                    kw::rescomp,
                                    kw::amr,
@@ -175,6 +227,10 @@ class InputDeck : public tk::TaggedTuple< InputDeckMembers > {
                                    kw::amr_refvar,
                                    kw::amr_tolref,
                                    kw::amr_tolderef,
+                                   kw::amr_lbimbalance,
+                                   kw::amr_buffer,
+                                   kw::amr_qdcorr,
+                                   kw::amr_t0ref_weight,
                                    kw::amr_edgelist,
                                    kw::amr_coordref,
                                    kw::amr_xminus,
@@ -189,6 +245,7 @@ class InputDeck : public tk::TaggedTuple< InputDeckMembers > {
                                    kw::pref_non_conformity,
                                    kw::pref_ndofmax,
                                    kw::pref_tolref,
+                                   kw::pref_dtfreq,
                                    kw::scheme,
                                    kw::diagcg,
                                    kw::alecg,
@@ -205,6 +262,7 @@ class InputDeck : public tk::TaggedTuple< InputDeckMembers > {
                                    kw::hll,
                                    kw::limiter,
                                    kw::cweight,
+                                   kw::limtol,
                                    kw::nolimiter,
                                    kw::wenop1,
                                    kw::superbeep1,
@@ -252,20 +310,60 @@ class InputDeck : public tk::TaggedTuple< InputDeckMembers > {
       get< tag::discr, tag::t0 >() = 0.0;
       get< tag::discr, tag::dt >() = 0.0;
       get< tag::discr, tag::cfl >() = 0.0;
+      get< tag::discr, tag::laggeddt >() = 0.0;
+      get< tag::discr, tag::rktol >() = 0.0;
+      get< tag::discr, tag::rkstages >() = 3;
+      get< tag::discr, tag::dtlevels >() = 0;
+      get< tag::discr, tag::laggeddiag >() = false;
+      get< tag::discr, tag::tavg >() =
+        std::numeric_limits< kw::time_average::info::expect::type >::max();
       get< tag::discr, tag::fct >() = true;
       get< tag::discr, tag::fctclip >() = false;
+      get< tag::discr, tag::fctedge >() = false;
       get< tag::discr, tag::ctau >() = 1.0;
       get< tag::discr, tag::fcteps >() =
         std::numeric_limits< tk::real >::epsilon();
       get< tag::discr, tag::pelocal_reorder >() = false;
+      get< tag::discr, tag::bfaceweight >() = 0.0;
+      get< tag::discr, tag::hierarchical >() = false;
+      get< tag::discr, tag::graphmap >() = false;
+      get< tag::discr, tag::distchunk >() = 0;
+      get< tag::discr, tag::meshcache >() = "";
+      get< tag::discr, tag::partfield >() = "";
+      get< tag::discr, tag::reducedghost >() = false;
+      get< tag::discr, tag::reducedhalo >() = false;
+      get< tag::discr, tag::costlb >() = false;
+      get< tag::discr, tag::migcost >() = 1.0e-9;
+      get< tag::discr, tag::autovirt >() = false;
+      get< tag::discr, tag::elemcost >() = 1.0e-6;
+      get< tag::discr, tag::msglatency >() = 2.0e-5;
+      get< tag::discr, tag::msgoverhead >() = 1.0e-6;
+      get< tag::discr, tag::msgprio >() = false;
+      get< tag::discr, tag::aggregate >() = false;
+      get< tag::discr, tag::asyncwrite >() = false;
+      get< tag::discr, tag::persistent >() = false;
+      get< tag::discr, tag::compression >() = 0;
+      get< tag::discr, tag::lossytol >() = 0.0;
       get< tag::discr, tag::operator_reorder >() = false;
+      get< tag::discr, tag::node_reorder >() = ReorderType::OPERATOR;
+      get< tag::discr, tag::elem_reorder >() = false;
+      get< tag::discr, tag::fused_edgeflux >() = false;
       get< tag::discr, tag::steady_state >() = false;
+      get< tag::discr, tag::implicit >() = false;
+      get< tag::discr, tag::krylov_maxit >() = 20;
+      get< tag::discr, tag::krylov_tol >() = 1.0e-2;
+      get< tag::discr, tag::multigrid >() = false;
+      get< tag::discr, tag::mg_levels >() = 2;
+      get< tag::discr, tag::freeze_grad >() = false;
+      get< tag::discr, tag::irs_sweeps >() = 0;
+      get< tag::discr, tag::irs_eps >() = 0.5;
       get< tag::discr, tag::residual >() = 1.0e-8;
       get< tag::discr, tag::rescomp >() = 1;
       get< tag::discr, tag::scheme >() = SchemeType::DiagCG;
       get< tag::discr, tag::ndof >() = 1;
       get< tag::discr, tag::limiter >() = LimiterType::NOLIMITER;
       get< tag::discr, tag::cweight >() = 1.0;
+      get< tag::discr, tag::limtol >() = 0.0;
       get< tag::discr, tag::ndof >() = 1;
       get< tag::discr, tag::rdof >() = 1;
       // Default field output file type
@@ -279,6 +377,10 @@ class InputDeck : public tk::TaggedTuple< InputDeckMembers > {
       get< tag::amr, tag::error >() = AMRErrorType::JUMP;
       get< tag::amr, tag::tolref >() = 0.2;
       get< tag::amr, tag::tolderef >() = 0.05;
+      get< tag::amr, tag::lbimbalance >() = 0.0;
+      get< tag::amr, tag::buffer >() = 0;
+      get< tag::amr, tag::qdcorr >() = false;
+      get< tag::amr, tag::t0refweight >() = false;
       auto rmax =
         std::numeric_limits< kw::amr_xminus::info::expect::type >::max() / 100;
       get< tag::amr, tag::xminus >() = rmax;
@@ -292,6 +394,7 @@ class InputDeck : public tk::TaggedTuple< InputDeckMembers > {
       get< tag::pref, tag::indicator >() = PrefIndicatorType::SPECTRAL_DECAY;
       get< tag::pref, tag::ndofmax >() = 10;
       get< tag::pref, tag::tolref >() = 0.5;
+      get< tag::pref, tag::dtfreq >() = 1;
       // Default txt floating-point output precision in digits
       get< tag::prec, tag::diag >() = std::cout.precision();
       get< tag::prec, tag::history >() = std::cout.precision();
@@ -300,6 +403,8 @@ class InputDeck : public tk::TaggedTuple< InputDeckMembers > {
       get< tag::interval, tag::field >() = 1;
       get< tag::interval, tag::diag >() = 1;
       get< tag::interval, tag::history >() = 1;
+      get< tag::interval, tag::surface >() = 0;
+      get< tag::interval, tag::slice >() = 1;
       // Initialize help: fill own keywords
       const auto& ctrinfoFill = tk::ctr::Info( get< tag::cmd, tag::ctrinfo >() );
       brigand::for_each< keywords >( ctrinfoFill );
@@ -332,6 +437,19 @@ class InputDeck : public tk::TaggedTuple< InputDeckMembers > {
       return ids;
     }
 
+    //! Query if a field is selected for output
+    //! \param[in] name Field name, without the system prefix
+    //! \return True if the field is to be output, see kw::outvar
+    bool outvar( const std::string& name ) const {
+      const auto& v = get< tag::discr, tag::outvar >();
+      if (v.empty()) return true;
+      for (const auto& s : v)
+        if (name.compare( 0, s.size(), s ) == 0 &&
+            (name.size() == s.size() || name[ s.size() ] == '_'))
+          return true;
+      return false;
+    }
+
     //! Query special point BC configuration
     //! \tparam eq PDE type to query
     //! \tparam bc  Special BC type to query, e.g., stagnation, skip
@@ -0,0 +1,73 @@
+// *****************************************************************************
+/*!
+  \file      src/Control/Inciter/Options/Reorder.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Local mesh node reordering options for inciter
+  \details   Local mesh node reordering options for inciter
+*/
+// *****************************************************************************
+#ifndef ReorderOptions_h
+#define ReorderOptions_h
+
+#include <brigand/sequences/list.hpp>
+
+#include "Toggle.hpp"
+#include "Keywords.hpp"
+#include "PUPUtil.hpp"
+
+namespace inciter {
+namespace ctr {
+
+//! Local mesh node reordering types
+enum class ReorderType : uint8_t { OPERATOR
+                                 , ADVANCINGFRONT
+                                 , RCM
+                                 , MORTON
+                                 , HILBERT };
+
+//! Pack/Unpack ReorderType: forward overload to generic enum class packer
+inline void operator|( PUP::er& p, ReorderType& e ) { PUP::pup( p, e ); }
+
+//! \brief Local mesh node reordering options: outsource to base templated on
+//!   enum type
+class Reorder : public tk::Toggle< ReorderType > {
+
+  public:
+    //! Valid expected choices to make them also available at compile-time
+    using keywords = brigand::list< kw::operator_access
+                                  , kw::advancing_front
+                                  , kw::rcm
+                                  , kw::morton
+                                  , kw::hilbert
+                                  >;
+
+    //! \brief Options constructor
+    //! \details Simply initialize in-line and pass associations to base, which
+    //!    will handle client interactions
+    explicit Reorder() :
+      tk::Toggle< ReorderType >(
+        //! Group, i.e., options, name
+        kw::node_reorder::name(),
+        //! Enums -> names (if defined, policy codes, if not, name)
+        { { ReorderType::OPERATOR, kw::operator_access::name() },
+          { ReorderType::ADVANCINGFRONT, kw::advancing_front::name() },
+          { ReorderType::RCM, kw::rcm::name() },
+          { ReorderType::MORTON, kw::morton::name() },
+          { ReorderType::HILBERT, kw::hilbert::name() } },
+        //! keywords -> Enums
+        { { kw::operator_access::string(), ReorderType::OPERATOR },
+          { kw::advancing_front::string(), ReorderType::ADVANCINGFRONT },
+          { kw::rcm::string(), ReorderType::RCM },
+          { kw::morton::string(), ReorderType::MORTON },
+          { kw::hilbert::string(), ReorderType::HILBERT } } )
+    {}
+
+};
+
+} // ctr::
+} // inciter::
+
+#endif // ReorderOptions_h
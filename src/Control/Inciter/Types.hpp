@@ -27,6 +27,7 @@
 #include "Inciter/Options/AMRInitial.hpp"
 #include "Inciter/Options/AMRError.hpp"
 #include "Inciter/Options/PrefIndicator.hpp"
+#include "Inciter/Options/Reorder.hpp"
 #include "Options/PartitioningAlgorithm.hpp"
 #include "Options/TxtFloatFormat.hpp"
 #include "Options/FieldFile.hpp"
@@ -58,6 +59,10 @@ using amr = tk::TaggedTuple< brigand::list<
   , tag::error,   AMRErrorType                    //!< Error estimator for AMR
   , tag::tolref,  tk::real                        //!< Refine tolerance
   , tag::tolderef, tk::real                       //!< De-refine tolerance
+  , tag::lbimbalance, tk::real                    //!< Load imbalance threshold
+  , tag::buffer,  kw::amr_buffer::info::expect::type //!< Buffer edge layers
+  , tag::qdcorr,  bool                            //!< Neighbor-only correction
+  , tag::t0refweight, bool                        //!< Partition t0ref weights
   //! List of edges-node pairs
   , tag::edge,    std::vector< kw::amr_edgelist::info::expect::type >
   //! Refinement tagging edges with end-point coordinates lower than x coord
@@ -80,6 +85,7 @@ using pref = tk::TaggedTuple< brigand::list<
   , tag::indicator,   PrefIndicatorType   //!< Choice of adaptive indicator
   , tag::ndofmax,     std::size_t         //!< Max number of degree of freedom
   , tag::tolref,      tk::real            //!< Threshold of p-refinement
+  , tag::dtfreq,      kw::pref_dtfreq::info::expect::type //!< Frequency
 > >;
 
 //! Discretization parameters storage
@@ -89,18 +95,66 @@ using discretization = tk::TaggedTuple< brigand::list<
   , tag::t0,     kw::t0::info::expect::type     //!< Starting time
   , tag::dt,     kw::dt::info::expect::type     //!< Size of time step
   , tag::cfl,    kw::cfl::info::expect::type    //!< CFL coefficient
+  , tag::laggeddt, kw::lagged_dt::info::expect::type //!< Lagged dt safety
+  , tag::rktol, kw::rk_tol::info::expect::type  //!< RK error tolerance
+  , tag::rkstages, kw::rk_stages::info::expect::type //!< Number of RK stages
+  , tag::dtlevels, kw::dt_levels::info::expect::type //!< Number of dt levels
+  , tag::laggeddiag, bool                       //!< Diagnostics with next dt
   , tag::pelocal_reorder, bool                  //!< PE-locality reordering
+  , tag::bfaceweight, kw::bface_weight::info::expect::type //!< Bface cost
+  , tag::hierarchical, bool                     //!< Two-level partitioning
+  , tag::graphmap, bool                         //!< Comm-graph chare map
+  , tag::distchunk, kw::dist_chunk::info::expect::type //!< Dist msg size
+  , tag::meshcache, kw::mesh_cache::info::expect::type //!< Cache prefix
+  , tag::partfield, kw::part_field::info::expect::type //!< Partition field
+  , tag::reducedghost, bool                     //!< Single-prec DG ghosts
+  , tag::reducedhalo, bool                      //!< Single-prec node halos
+  , tag::costlb, bool                           //!< Cost-driven LB
+  , tag::migcost, kw::migration_cost::info::expect::type //!< LB byte cost
+  , tag::autovirt, bool                         //!< Auto-tune virtualization
+  , tag::elemcost, kw::elem_cost::info::expect::type //!< Element cost
+  , tag::msglatency, kw::msg_latency::info::expect::type //!< Msg latency
+  , tag::msgoverhead, kw::msg_overhead::info::expect::type //!< Msg overhead
+  , tag::msgprio, bool                          //!< Message priorities
+  , tag::aggregate, bool                        //!< Aggregate field output
+    //! Time to start accumulating time averages and variances from
+  , tag::tavg, kw::time_average::info::expect::type
+    //! Solution component pairs whose covariances to accumulate
+  , tag::covariance, std::vector< kw::covariance::info::expect::type >
+    //! Planes along which to slice the volume fields, 6 reals per plane
+  , tag::slice, std::vector< kw::slice::info::expect::type >
+    //! Iso-surfaces along which to output the volume fields, 2 per surface
+  , tag::isosurface, std::vector< kw::isosurface::info::expect::type >
+    //! Names of the derived variables output, all if empty
+  , tag::outvar, std::vector< kw::outvar::info::expect::type >
+  , tag::asyncwrite, bool                       //!< Async field output
+  , tag::persistent, bool                       //!< Keep output files open
+  , tag::compression, kw::compression::info::expect::type //!< Deflate lvl
+  , tag::lossytol, kw::lossy_tolerance::info::expect::type //!< Lossy
   , tag::operator_reorder, bool                 //!< Operator-access reordering
+  , tag::node_reorder, inciter::ctr::ReorderType //!< Node reordering algorithm
+  , tag::elem_reorder, bool                     //!< Element reordering
+  , tag::fused_edgeflux, bool                   //!< Fused edge flux+scatter
   , tag::steady_state, bool                     //!< March to steady state
+  , tag::implicit, bool                         //!< Implicit time stepping
+  , tag::krylov_maxit, kw::krylov_maxit::info::expect::type //!< Max Krylov its
+  , tag::krylov_tol, kw::krylov_tol::info::expect::type //!< Krylov tolerance
+  , tag::multigrid, bool                        //!< Multigrid on/off
+  , tag::mg_levels, kw::mg_levels::info::expect::type //!< Multigrid levels
+  , tag::freeze_grad, bool                      //!< Frozen gradients on/off
+  , tag::irs_sweeps, kw::irs_sweeps::info::expect::type //!< Smoothing sweeps
+  , tag::irs_eps, kw::irs_eps::info::expect::type //!< Smoothing coefficient
   , tag::residual, kw::residual::info::expect::type //!< Convergence residual
   , tag::rescomp, kw::rescomp::info::expect::type //!< Convergence residual comp
   , tag::fct,    bool                           //!< FCT on/off
   , tag::fctclip,bool                           //!< FCT clipping limiter on/off
+  , tag::fctedge,bool                           //!< Edge-based FCT diffusion
   , tag::fcteps, kw::fcteps::info::expect::type //!< FCT small number
   , tag::ctau,   kw::ctau::info::expect::type   //!< FCT mass diffisivity
   , tag::scheme, inciter::ctr::SchemeType       //!< Spatial discretization type
   , tag::limiter,inciter::ctr::LimiterType      //!< Limiter type
   , tag::cweight,kw::cweight::info::expect::type//!< WENO central stencil weight
+  , tag::limtol, kw::limtol::info::expect::type //!< Troubled-cell tolerance
   , tag::rdof,   std::size_t          //!< Number of reconstructed solution DOFs
   , tag::ndof,   std::size_t                   //!< Number of solution DOFs
 > >;
@@ -125,6 +179,10 @@ using intervals = tk::TaggedTuple< brigand::list<
   , tag::field,   kw::interval::info::expect::type  //!< Field output interval
   , tag::history, kw::interval::info::expect::type  //!< History output interval
   , tag::diag,    kw::interval::info::expect::type  //!< Diags output interval
+  //! Surface field output interval, 0: with field output
+  , tag::surface, kw::surface_interval::info::expect::type
+  //! Slice and iso-surface output interval
+  , tag::slice,   kw::slice_interval::info::expect::type
 > >;
 
 //! History output parameters storage
@@ -145,6 +203,7 @@ using ios = tk::TaggedTuple< brigand::list<
     //! Diagnostics filename
   , tag::diag,      kw::diagnostics_cmd::info::expect::type
   , tag::particles, std::string                     //!< Particles filename
+  , tag::perf,      std::string                     //!< Performance log name
   , tag::restart,   kw::restart::info::expect::type //!< Restart dirname
 > >;
 
@@ -351,6 +410,9 @@ using MultiMatPDEParameters = tk::TaggedTuple< brigand::list<
     //! Heat conductivity
   , tag::k,             std::vector<
                           std::vector< kw::mat_k::info::expect::type > >
+    //! Tabulated equation of state file names
+  , tag::eostable,      std::vector<
+                          std::vector< kw::mat_eostable::info::expect::type > >
   //! number of materials
   , tag::nmat,          std::vector< kw::nmat::info::expect::type >
   //! pressure relaxation toggle
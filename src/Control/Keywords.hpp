@@ -858,6 +858,61 @@ struct seqlen_info {
 };
 using seqlen = keyword< seqlen_info, TAOCPP_PEGTL_STRING("seqlen") >;
 
+struct gauss_library_info {
+  static std::string name() { return "library"; }
+  static std::string shortDescription() { return
+    "Select the Gaussian transform of the RNG library"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select generating Gaussian random numbers by the
+    method of the library that implements the random number generator, e.g.,
+    the method selected by 'gaussian_method' for an Intel MKL generator, the
+    standard library's std::normal_distribution for an RNGSSE2 generator, or
+    the Box-Muller transform for a Random123 generator.)";
+  }
+};
+using gauss_library =
+  keyword< gauss_library_info, TAOCPP_PEGTL_STRING("library") >;
+
+struct ziggurat_info {
+  static std::string name() { return "ziggurat"; }
+  static std::string shortDescription() { return
+    "Select the ziggurat method to generate Gaussian random numbers"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select generating Gaussian random numbers by the
+    ziggurat method of Marsaglia and Tsang, see
+    https://doi.org/10.18637/jss.v005.i08, from uniform random numbers
+    generated in bulk by the random number generator, independent of the
+    library that implements the generator. Most Gaussian numbers then take two
+    uniform numbers, a multiplication, and a comparison.)";
+  }
+};
+using ziggurat = keyword< ziggurat_info, TAOCPP_PEGTL_STRING("ziggurat") >;
+
+struct gaussian_transform_info {
+  static std::string name() { return "Gaussian transform"; }
+  static std::string shortDescription() { return
+    "Select the transform generating Gaussian random numbers"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select how Gaussian random numbers are generated
+    from uniform ones by a random number generator of any library. Valid
+    options are 'library', which uses the transform of the library that
+    implements the generator, and 'ziggurat', which selects a
+    library-independent implementation of the ziggurat method, yielding about
+    the same Gaussian throughput whatever library is used. Example:
+    "r123_philox gaussian_transform ziggurat end".)";
+  }
+  struct expect {
+    static std::string description() { return "string"; }
+    static std::string choices() {
+      return '\'' + gauss_library::string() + "\' | \'"
+                  + ziggurat::string() + '\'';
+    }
+  };
+};
+using gaussian_transform =
+  keyword< gaussian_transform_info,
+           TAOCPP_PEGTL_STRING("gaussian_transform") >;
+
 struct r123_threefry_info {
   static std::string name() { return "Random123 ThreeFry"; }
   static std::string shortDescription() { return
@@ -947,6 +1002,22 @@ struct gmshbin_info {
 };
 using gmshbin = keyword< gmshbin_info, TAOCPP_PEGTL_STRING("gmshbin") >;
 
+struct binary_info {
+  static std::string name() { return "binary"; }
+  static std::string shortDescription() { return
+    "Select raw binary output for outputing statistics or PDFs"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select the raw binary output file type of
+    statistics within a statistics ... end block or of a requested probability
+    density function (PDF) within a pdfs ... end block. Example: "filetype
+    binary". A binary file starts with a short text header describing its
+    contents, followed by a record appended at each output, which avoids the
+    cost of formatting floating-point numbers as text. For more info on the
+    structure of the records, see tk::BinStatWriter and
+    tk::PDFWriter::writeBin().)"; }
+};
+using binary = keyword< binary_info, TAOCPP_PEGTL_STRING("binary") >;
+
 struct exodusii_info {
   static std::string name() { return "exo"; }
   static std::string shortDescription() { return
@@ -985,14 +1056,16 @@ struct filetype_info {
     mesh-based field output in a plotvar ... end block. Example:
     "filetype exodusii", which selects ExodusII output. Valid options depend on
     which block the keyword is used: in a pdfs ... end the valid choices are
-    'txt', 'gmshtxt', 'gmshbin', and 'exodusii', in a plotvar ... end  block the
-    valid choices are 'exodusii' and 'root'.)"; }
+    'txt', 'gmshtxt', 'gmshbin', 'exodusii', and 'binary', in a statistics ...
+    end block 'txt' and 'binary', in a plotvar ... end  block the valid
+    choices are 'exodusii' and 'root'.)"; }
   struct expect {
     static std::string description() { return "string"; }
     static std::string choices() {
       return '\'' + txt::string() + "\' | \'"
                   + gmshtxt::string() + "\' | \'"
                   + gmshbin::string() + "\' | \'"
+                  + binary::string() + "\' | \'"
                   + root::string() + "\' | \'"
                   + exodusii::string() + '\'';
     }
@@ -1222,6 +1295,28 @@ struct centering_info {
 };
 using pdf_centering = keyword< centering_info, TAOCPP_PEGTL_STRING("centering") >;
 
+struct pdf_sample_info {
+  static std::string name() { return "sample"; }
+  static std::string shortDescription() { return
+    "Set fraction of particles sampled for PDF estimation"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to set the fraction of particles used to estimate
+    probability density functions (PDFs), within a pdfs ... end block. Example:
+    "sample 0.1", which estimates the PDFs from every 10th particle only. Since
+    the particles are independent samples, a fraction of them still yields an
+    unbiased, if noisier, estimate of the PDFs, at a fraction of the cost of
+    binning all samples. The default is 1.0, i.e., all particles are sampled.
+    Statistical moments are always estimated from all particles.)";
+  }
+  struct expect {
+    using type = tk::real;
+    static constexpr type lower = 0.0;
+    static constexpr type upper = 1.0;
+    static std::string description() { return "real"; }
+  };
+};
+using pdf_sample = keyword< pdf_sample_info, TAOCPP_PEGTL_STRING("sample") >;
+
 struct raw_info {
   using code = Code< R >;
   static std::string name() { return "raw"; }
@@ -1663,6 +1758,57 @@ struct npar_info {
 };
 using npar = keyword< npar_info, TAOCPP_PEGTL_STRING("npar") >;
 
+struct chunk_info {
+  static std::string name() { return "chunk"; }
+  static std::string shortDescription() { return
+    "Set number of particles per work unit"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to specify the number of particles advanced by a
+    work unit, i.e., a Charm++ chare. Since each work unit, and each thread of
+    a work unit, draws random numbers from its own stream, the random numbers
+    a particle receives only depend on the decomposition of the particles into
+    work units and threads, not on the processing element (PE) a work unit is
+    advanced on. Fixing the number of particles per work unit thus yields the
+    same results independent of the number of PEs, as long as the number of
+    threads is the same, and allows migrating work units between PEs for load
+    balancing without changing results. The default is 0, in which case the
+    number of work units is computed from the number of PEs and the degree of
+    virtualization, see also 'virtualization'. Example: "chunk 100000".)";
+  }
+  struct expect {
+    using type = uint64_t;
+    static constexpr type lower = 0;
+    static std::string description() { return "uint"; }
+  };
+};
+using chunk = keyword< chunk_info, TAOCPP_PEGTL_STRING("chunk") >;
+
+struct fuse_info {
+  static std::string name() { return "fuse"; }
+  static std::string shortDescription() { return
+    "Set number of particles advanced by all equations together"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select fused advance of the differential
+    equations and to specify the number of particles of a block advanced by
+    all equations together. By default, i.e., 0, each equation advances all
+    particles of a thread before the next equation is advanced, so equations
+    coupled to each other, e.g., position, velocity, and dissipation, stream
+    the properties of all particles through memory once per equation. With
+    fused advance, the properties of a block of particles are copied to a
+    buffer small enough to stay in cache, all equations advance the block,
+    which is then copied back. The random numbers received by a particle then
+    depend on the block size, but the statistics do not. Blocks of a few
+    thousand particles are a good start, e.g., "fuse 4096", so that the
+    buffer fits in the level-2 cache.)";
+  }
+  struct expect {
+    using type = uint64_t;
+    static constexpr type lower = 0;
+    static std::string description() { return "uint"; }
+  };
+};
+using fuse = keyword< fuse_info, TAOCPP_PEGTL_STRING("fuse") >;
+
 struct nstep_info {
   static std::string name() { return "nstep"; }
   static std::string shortDescription() { return
@@ -1816,6 +1962,29 @@ struct pari_info {
 };
 using pari = keyword< pari_info, TAOCPP_PEGTL_STRING("pari") >;
 
+struct sorti_info {
+  static std::string name() { return "sorti"; }
+  static std::string shortDescription() { return
+    "Set particle sorting interval"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to specify the interval in time steps for sorting
+    the particles in memory along the Hilbert space-filling curve through their
+    positions during a simulation. Particles close in space are then also close
+    in memory, which makes accessing particle properties by position, e.g.,
+    binning joint PDFs involving positions, more cache-friendly. All particle
+    properties are moved together. Sorting only has an effect if a position
+    equation is configured. The default is 0, i.e., particles are not sorted.
+    Note that sorting changes which particle the particle ids, e.g., in
+    particles output, refer to.)";
+  }
+  struct expect {
+    using type = uint32_t;
+    static constexpr type lower = 0;
+    static std::string description() { return "uint"; }
+  };
+};
+using sorti = keyword< sorti_info, TAOCPP_PEGTL_STRING("sorti") >;
+
 struct interval_info {
   static std::string name() { return "interval"; }
   static std::string shortDescription() { return
@@ -1846,6 +2015,55 @@ struct statistics_info {
 };
 using statistics = keyword< statistics_info, TAOCPP_PEGTL_STRING("statistics") >;
 
+struct lazy_info {
+  static std::string name() { return "lazy"; }
+  static std::string shortDescription() { return
+    "Estimate statistics only when they are output"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to turn on/off lazy estimation of statistics, within
+    a statistics ... end block. Example: "lazy true". By default, statistical
+    moments are estimated in every time step, requiring passes over all
+    particles and reductions across all integrators. If lazy estimation is
+    turned on, statistical moments and PDFs are only estimated in those time
+    steps in which they are written to file, given by the statistics and pdfs
+    output intervals. Lazy estimation is ignored, i.e., statistics are
+    estimated in every time step, if any of the differential equations
+    configured, e.g., those whose coefficients depend on statistics, such as
+    the mix beta, mix Dirichlet, velocity, and dissipation models, are coupled
+    to the statistical moments.)"; }
+  struct expect {
+    using type = bool;
+    static std::string description() { return "string"; }
+    static std::string choices() { return "true | false"; }
+  };
+};
+using lazy = keyword< lazy_info, TAOCPP_PEGTL_STRING("lazy") >;
+
+struct async_info {
+  static std::string name() { return "async"; }
+  static std::string shortDescription() { return
+    "Estimate statistics while the particles are advanced"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to turn on/off asynchronous estimation of
+    statistics, within a statistics ... end block. Example: "async true". By
+    default, the particles are advanced in a time step only after the
+    statistics of the previous time step have been reduced across all
+    integrators and output to file. If asynchronous estimation is turned on,
+    the integrators only contribute their partial sums and continue with the
+    next time step, while the reductions and the output complete in the
+    background. Differential equations whose coefficients depend on
+    statistical moments then use the moments of the time step before the
+    previous one, i.e., moments lagged by one time step, except in the first
+    time step. Asynchronous estimation requires single-pass statistics, see
+    the command line switch singlepass, and is ignored otherwise.)"; }
+  struct expect {
+    using type = bool;
+    static std::string description() { return "string"; }
+    static std::string choices() { return "true | false"; }
+  };
+};
+using async = keyword< async_info, TAOCPP_PEGTL_STRING("async") >;
+
 struct history_info {
   static std::string name() { return "history"; }
   static std::string shortDescription() { return
@@ -1868,6 +2086,284 @@ struct plotvar_info {
 };
 using plotvar = keyword< plotvar_info, TAOCPP_PEGTL_STRING("plotvar") >;
 
+struct aggregate_info {
+  static std::string name() { return "aggregate"; }
+  static std::string shortDescription() { return
+    "Aggregate field output of all chares on a compute node into one file"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to aggregate mesh-based field output in a
+    plotvar ... end block. By default, every chare (work unit) writes its own
+    file at every field output with a new mesh, which, with many chares,
+    creates a large number of files. If 'aggregate true' is set, the output of
+    all chares on a compute node is stitched together, using global mesh node
+    ids, and written into a single file per compute node (one file per PE in
+    Charm++'s non-SMP mode). Compute nodes without chares write no file.
+    Example: "plotvar aggregate true end".)"; }
+  struct expect {
+    using type = bool;
+    static std::string description() { return "string"; }
+    static std::string choices() { return "true | false"; }
+  };
+};
+using aggregate = keyword< aggregate_info, TAOCPP_PEGTL_STRING("aggregate") >;
+
+struct async_write_info {
+  static std::string name() { return "async_write"; }
+  static std::string shortDescription() { return
+    "Continue time stepping while field output is written"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to write mesh-based field output, configured in a
+    plotvar ... end block, asynchronously. By default, time stepping
+    continues only after the field output has been written to file. If
+    'async_write true' is set, time stepping continues right after the
+    field output has been handed over to the writer, which writes it to file
+    in the background. A chare continues in the background with at most one
+    write of its field output unfinished: if the previous write has not
+    finished by the next field output, time stepping waits for it. Before
+    checkpointing and finishing, all writes are completed.
+    Example: "plotvar async_write true end".)"; }
+  struct expect {
+    using type = bool;
+    static std::string description() { return "string"; }
+    static std::string choices() { return "true | false"; }
+  };
+};
+using async_write =
+  keyword< async_write_info, TAOCPP_PEGTL_STRING("async_write") >;
+
+struct persistent_files_info {
+  static std::string name() { return "persistent_files"; }
+  static std::string shortDescription() { return
+    "Keep field output files open across field outputs of the same mesh"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to keep the ExodusII files of mesh-based field
+    output, configured in a plotvar ... end block, open across field outputs.
+    By default, a file is created and its mesh written at the first field
+    output with a new mesh, and at every field output the file is opened
+    again, the fields appended, and the file closed. If
+    'persistent_files true' is set, the file created is kept open and the
+    fields of the following field outputs with the same mesh are appended
+    without opening it again, flushing the data to the file after each
+    field output. The files are closed once a new mesh is written, e.g.,
+    after mesh refinement. Example: "plotvar persistent_files true end".)"; }
+  struct expect {
+    using type = bool;
+    static std::string description() { return "string"; }
+    static std::string choices() { return "true | false"; }
+  };
+};
+using persistent_files =
+  keyword< persistent_files_info, TAOCPP_PEGTL_STRING("persistent_files") >;
+
+struct compression_info {
+  static std::string name() { return "compression"; }
+  static std::string shortDescription() { return
+    "Set the compression level of field output files"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to compress the ExodusII files of mesh-based field
+    output, configured in a plotvar ... end block. If a compression level
+    larger than zero is set, the files are written in the NetCDF-4 (HDF5)
+    format with all of their data, i.e., node coordinates, element
+    connectivity, and fields, deflated by the given level of zlib (gzip)
+    compression: 1 is fastest, 9 compresses most. Zero, the default, writes
+    uncompressed files in the classic NetCDF format. The compression is
+    lossless, unless a relative tolerance is also set by lossy_tolerance.
+    Example: "plotvar compression 4 end".)"; }
+  struct expect {
+    using type = uint32_t;
+    static constexpr type lower = 0;
+    static constexpr type upper = 9;
+    static std::string description() { return "uint"; }
+  };
+};
+using compression =
+  keyword< compression_info, TAOCPP_PEGTL_STRING("compression") >;
+
+struct lossy_tolerance_info {
+  static std::string name() { return "lossy_tolerance"; }
+  static std::string shortDescription() { return
+    "Set the relative error tolerated in compressed field output"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to configure error-bounded lossy compression of
+    the node and element fields of mesh-based field output, configured in a
+    plotvar ... end block. If a relative tolerance larger than zero is set,
+    each field value written is rounded to the fewest significant bits of
+    its mantissa that keep the relative error of the value below the given
+    tolerance. Since the trailing bits of the rounded values are zero, they
+    compress much better, see also compression. The mesh is always written
+    exactly. Zero, the default, writes the fields without rounding.
+    Example: "plotvar compression 4 lossy_tolerance 1.0e-6 end".)"; }
+  struct expect {
+    using type = tk::real;
+    static constexpr type lower = 0.0;
+    static constexpr type upper = 0.5;
+    static std::string description() { return "real"; }
+  };
+};
+using lossy_tolerance =
+  keyword< lossy_tolerance_info, TAOCPP_PEGTL_STRING("lossy_tolerance") >;
+
+struct surface_interval_info {
+  static std::string name() { return "surface_interval"; }
+  static std::string shortDescription() { return
+    "Set the interval of surface field output independent of volume output"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to write the surface fields of the side sets
+    selected by sideset in a plotvar ... end block at their own interval in
+    time steps, independently of the volume field output, whose interval is
+    set by interval. This makes sampling the surface fields, e.g., pressure,
+    at a high frequency possible without writing the volume fields as
+    often. The surface files have their own time steps and are written with
+    their usual names. Zero, the default, writes the surface fields together
+    with the volume fields. Only used by node-centered schemes.
+    Example: "plotvar interval 1000 surface_interval 10 sideset 1 end end".)"; }
+  struct expect {
+    using type = uint32_t;
+    static constexpr type lower = 0;
+    static std::string description() { return "uint"; }
+  };
+};
+using surface_interval =
+  keyword< surface_interval_info, TAOCPP_PEGTL_STRING("surface_interval") >;
+
+struct time_average_info {
+  static std::string name() { return "time_average"; }
+  static std::string shortDescription() { return
+    "Accumulate time averages and variances of the solution from a time on"; }
+  static std::string longDescription() { return
+    R"(This keyword is used in a plotvar ... end block to accumulate running
+    time averages and variances of all scalar components of the numerical
+    solution in mesh nodes, starting at the given physical time. The samples
+    are added after every time step, weighted by the time step size, and the
+    statistics are output with the volume field output as the fields
+    <var>_mean and <var>_variance, where <var> is the name of the variable
+    in the diagnostics file. Covariances of selected pairs of components can
+    be added by covariance. The statistics are checkpointed and restarted
+    with the solution. Accumulating starts over after mesh refinement. Only
+    used by node-centered schemes, i.e., DiagCG and ALECG. By default, no
+    statistics are accumulated.
+    Example: "plotvar time_average 0.5 end".)"; }
+  struct expect {
+    using type = tk::real;
+    static std::string description() { return "real"; }
+  };
+};
+using time_average =
+  keyword< time_average_info, TAOCPP_PEGTL_STRING("time_average") >;
+
+struct covariance_info {
+  static std::string name() { return "covariance"; }
+  static std::string shortDescription() { return
+    "List pairs of solution components whose covariances to accumulate"; }
+  static std::string longDescription() { return
+    R"(This keyword is used in a plotvar ... end block, together with
+    time_average, to start a list of pairs of scalar solution component
+    indices whose running covariances to accumulate and output as
+    <var1>_<var2>_covariance. The components are numbered starting from 1,
+    in the order of the variables in the diagnostics file. The list is
+    closed by end.
+    Example: "plotvar time_average 0.5 covariance 2 3 2 4 end end", which
+    requests the covariances of components 2 and 3, and 2 and 4.)"; }
+  struct expect {
+    using type = std::size_t;
+    static constexpr type lower = 1;
+    static std::string description() { return "uints"; }
+  };
+};
+using covariance =
+  keyword< covariance_info, TAOCPP_PEGTL_STRING("covariance") >;
+
+struct slice_info {
+  static std::string name() { return "slice"; }
+  static std::string shortDescription() { return
+    "List planes along which to output slices of the volume fields"; }
+  static std::string longDescription() { return
+    R"(This keyword is used in a plotvar ... end block to start a list of
+    planes along which the volume node fields are extracted in-situ and
+    output at the interval set by slice_interval. Each plane is given by 6
+    reals: the coordinates of a point of the plane followed by the
+    components of its normal vector. The slices are triangulated surfaces
+    whose nodes are the intersections of the plane with the mesh edges, and
+    the fields are interpolated linearly along the edges. Slice k, counting
+    from 1, is written into files named <output>-slice.<k>.e-s.*, a new file
+    at every output. The list is closed by end. Only used by node-centered
+    schemes, i.e., DiagCG and ALECG.
+    Example: "plotvar slice 0 0 0 1 0 0  0 0 0.5 0 0 1 end end", which
+    requests two slices: the x = 0 and the z = 0.5 planes.)"; }
+  struct expect {
+    using type = tk::real;
+    static std::string description() { return "6 reals per plane"; }
+  };
+};
+using slice = keyword< slice_info, TAOCPP_PEGTL_STRING("slice") >;
+
+struct isosurface_info {
+  static std::string name() { return "isosurface"; }
+  static std::string shortDescription() { return
+    "List iso-surfaces along which to output the volume fields"; }
+  static std::string longDescription() { return
+    R"(This keyword is used in a plotvar ... end block to start a list of
+    iso-surfaces of scalar solution components along which the volume node
+    fields are extracted in-situ and output at the interval set by
+    slice_interval. Each iso-surface is given by a pair of numbers: the
+    index of the solution component, counting from 1 in the order of the
+    variables in the diagnostics file, and the iso-value. The fields are
+    interpolated linearly along the mesh edges intersected. Iso-surface k,
+    counting from 1, is written into files named <output>-iso.<k>.e-s.*, a
+    new file at every output. The list is closed by end. Only used by
+    node-centered schemes, i.e., DiagCG and ALECG.
+    Example: "plotvar isosurface 1 0.5 end end", which requests the
+    iso-surface of the first component at the value of 0.5.)"; }
+  struct expect {
+    using type = tk::real;
+    static std::string description() { return "2 reals per iso-surface"; }
+  };
+};
+using isosurface =
+  keyword< isosurface_info, TAOCPP_PEGTL_STRING("isosurface") >;
+
+struct outvar_info {
+  static std::string name() { return "fields"; }
+  static std::string shortDescription() { return
+    "List the derived variables output as mesh-based fields"; }
+  static std::string longDescription() { return
+    R"(This keyword is used in a plotvar ... end block to start a list of
+    the names of the variables output as mesh-based fields, closed by end. A
+    field is output if its name, without the system prefix, equals one of
+    the names listed, or starts with one of them followed by '_'. E.g.,
+    'pressure' selects both pressure_numerical and pressure_analytical of
+    single-material flow, but not pressure1_numerical, the pressure of
+    material 1 of multi-material flow. Only the fields selected are computed
+    at each output. If no list is given, all fields are output. Only used by
+    compressible single- and multi-material flow.
+    Example: "plotvar fields density x-velocity pressure end end".)"; }
+  struct expect {
+    using type = std::string;
+    static std::string description() { return "string"; }
+  };
+};
+using outvar = keyword< outvar_info, TAOCPP_PEGTL_STRING("fields") >;
+
+struct slice_interval_info {
+  static std::string name() { return "slice_interval"; }
+  static std::string shortDescription() { return
+    "Set the interval of slice and iso-surface output"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to set the interval in time steps at which the
+    slices and iso-surfaces, selected by slice and isosurface in a
+    plotvar ... end block, are output, independently of the volume field
+    output. Since these are much smaller than the volume fields, they can be
+    output much more often. The default is 1, i.e., every time step.
+    Example: "plotvar slice_interval 10 slice 0 0 0 1 0 0 end end".)"; }
+  struct expect {
+    using type = uint32_t;
+    static constexpr type lower = 1;
+    static std::string description() { return "uint"; }
+  };
+};
+using slice_interval =
+  keyword< slice_interval_info, TAOCPP_PEGTL_STRING("slice_interval") >;
+
 struct rngs_info {
   static std::string name() { return "rngs"; }
   static std::string shortDescription() { return
@@ -3784,6 +4280,23 @@ struct bigcrush_info {
 };
 using bigcrush = keyword< bigcrush_info, TAOCPP_PEGTL_STRING("bigcrush") >;
 
+struct benchmark_info {
+  static std::string name() { return "Benchmark"; }
+  static std::string shortDescription() { return
+    "Select RNG throughput benchmark"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to introduce the description of the random number
+    generator throughput benchmark. Instead of testing the statistical quality
+    of the generators, the benchmark measures the number of random numbers
+    generated per second per core, through the same interface the generators
+    are used in the physics codes, for uniform, Gaussian, multi-variate
+    Gaussian (MKL only), beta, and gamma distributions, for a range of batch
+    sizes, i.e., number of random numbers requested in a single call, and
+    thread counts, if OpenMP is enabled.)";
+  }
+};
+using benchmark = keyword< benchmark_info, TAOCPP_PEGTL_STRING("benchmark") >;
+
 struct verbose_info {
   static std::string name() { return "verbose"; }
   static std::string shortDescription() { return
@@ -3870,16 +4383,22 @@ struct lbfreq_info {
 };
 using lbfreq = keyword< lbfreq_info, TAOCPP_PEGTL_STRING("lbfreq") >;
 
-struct rsfreq_info {
-  static std::string name() { return "Checkpoint/restart frequency"; }
+struct perffreq_info {
+  static std::string name() { return "Performance report frequency"; }
   static std::string shortDescription()
-  { return "Set checkpoint/restart frequency during time stepping"; }
+  { return "Set frequency of reporting time step phase timers"; }
   static std::string longDescription() { return
-    R"(This keyword is used to set the frequency of dumping checkpoint/restart
-       files during time stepping. The default is 1000, which means that
-       checkpoint/restart files are dumped at every 1000th time step.)";
+    R"(This keyword is used to set the frequency of reporting the wall-clock
+       time spent in the phases of the time step, e.g., computing the
+       right-hand side, waiting for communication, or output, accumulated
+       across the given number of time steps. The minimum, maximum, and
+       average across all worker chares are output to screen and appended to
+       the performance log file, together with the load imbalance, i.e., the
+       max/avg ratio of the time not spent waiting across chares and PEs, the
+       fraction of the time on the critical path, and the slowest chares. The
+       default is 0, which disables the report.)";
   }
-  using alias = Alias< r >;
+  using alias = Alias< P >;
   struct expect {
     using type = std::size_t;
     static constexpr type lower = 1;
@@ -3891,62 +4410,257 @@ struct rsfreq_info {
     }
   };
 };
-using rsfreq = keyword< rsfreq_info, TAOCPP_PEGTL_STRING("rsfreq") >;
+using perffreq = keyword< perffreq_info, TAOCPP_PEGTL_STRING("perffreq") >;
 
-struct feedback_info {
-  static std::string name() { return "feedback"; }
-  static std::string shortDescription() { return "Enable on-screen feedback"; }
+struct tracebuf_info {
+  static std::string name() { return "Trace buffer size"; }
+  static std::string shortDescription()
+  { return "Enable tracing chare entry methods with a given buffer size"; }
   static std::string longDescription() { return
-    R"(This keyword is used to enable more detailed on-screen feedback on
-       particular tasks and sub-tasks as they happen. This is useful for large
-       problems and debugging.)";
+    R"(This keyword is used to enable recording a trace of the stages of the
+       time step executed by each worker chare, e.g., computing the right-hand
+       side or waiting for communication, into a fixed-size ring buffer
+       preallocated on each PE, holding the given number of most recent
+       events. At the end of the run each PE writes its events to a file in
+       the Chrome trace event format, named after the performance log, which
+       can be viewed as a timeline by Perfetto or chrome://tracing. The
+       default is 0, which disables tracing.)";
   }
-  using alias = Alias< f >;
+  using alias = Alias< B >;
+  struct expect {
+    using type = std::size_t;
+    static constexpr type lower = 1;
+    static constexpr type upper = std::numeric_limits< type >::max()-1;
+    static std::string description() { return "int"; }
+    static std::string choices() {
+      return "integer between [" + std::to_string(lower) + "..." +
+             std::to_string(upper) + "] (both inclusive)";
+    }
+  };
 };
-using feedback = keyword< feedback_info, TAOCPP_PEGTL_STRING("feedback") >;
+using tracebuf = keyword< tracebuf_info, TAOCPP_PEGTL_STRING("tracebuf") >;
 
-struct version_info {
-  static std::string name() { return "Show version"; }
-  static std::string shortDescription() { return "Show version information"; }
+struct perfctr_info {
+  static std::string name() { return "Performance counters"; }
+  static std::string shortDescription()
+  { return "Sample hardware performance counters around solver kernels"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to enable sampling the hardware performance
+       counters of each PE, i.e., cycles, instructions, L1 data cache and last
+       level cache misses, around the solver kernels, e.g., the domain and
+       boundary integrals, the reconstruction, and the limiter. At the end of
+       the run a summary of the instructions per cycle, the cache miss rates,
+       the implied memory bandwidth, and the instructions per byte of memory
+       traffic of each kernel is printed to screen and the rows of all PEs are
+       written to a file named after the performance log. The counters are
+       read via Linux perf_event, and if they are not available, e.g., due to
+       the setting of /proc/sys/kernel/perf_event_paranoid, only the number of
+       calls and the time spent in the kernels are reported.)";
+  }
+  using alias = Alias< K >;
+};
+using perfctr = keyword< perfctr_info, TAOCPP_PEGTL_STRING("perfctr") >;
+
+struct ckptincr_info {
+  static std::string name() { return "checkpoint_incremental"; }
+  static std::string shortDescription()
+  { return "Select incremental checkpoints"; }
   static std::string longDescription() { return
-    R"(This keyword is used to display version information for the
-       executable/tool on the standard output and exit successfully.)";
+    R"(This keyword is used to select incremental checkpoints. Without it,
+       each checkpoint contains the full state of all chares, including the
+       mesh connectivity, coordinates, and derived mesh data. With it, mesh
+       data that only changes with the mesh, e.g., due to mesh refinement, is
+       written to separate files in the restart directory once per mesh
+       epoch, and subsequent checkpoints contain only the data that changes
+       during time stepping, e.g., the solution, time, and history.)";
   }
-  using alias = Alias< V >;
+  using alias = Alias< k >;
 };
-using version = keyword< version_info, TAOCPP_PEGTL_STRING("version") >;
+using ckptincr =
+  keyword< ckptincr_info, TAOCPP_PEGTL_STRING("checkpoint_incremental") >;
 
-struct license_info {
-  static std::string name() { return "Show license"; }
-  static std::string shortDescription() { return "Show license information"; }
+struct ckptcompress_info {
+  static std::string name() { return "checkpoint_compress"; }
+  static std::string shortDescription()
+  { return "Compress mesh data of incremental checkpoints"; }
   static std::string longDescription() { return
-    R"(This keyword is used to display license information for the
-       executable/tool on the standard output and exit successfully.)";
+    R"(This keyword is used to compress the mesh data written once per mesh
+       epoch by incremental checkpoints, see also the checkpoint_incremental
+       keyword. The compression is lossless: the bytes of 8-byte words are
+       shuffled into byte planes which are then run-length encoded.)";
   }
-  using alias = Alias< L >;
-};
-using license = keyword< license_info, TAOCPP_PEGTL_STRING("license") >;
-
-struct trace_info {
-  static std::string name() { return "trace"; }
-  static std::string shortDescription()
-  { return "Disable call and stack trace"; }
-  static std::string longDescription() { return R"(This keyword can be used to
-    disable the on-screen call trace and stack trace after an exception is
-    thrown. Trace output is on by default and in some cases, the call and
-    stack trace can be huge and not very helpful, hence this command line
-    option.)"; }
-  using alias = Alias< t >;
+  using alias = Alias< z >;
 };
-using trace = keyword< trace_info, TAOCPP_PEGTL_STRING("trace") >;
+using ckptcompress =
+  keyword< ckptcompress_info, TAOCPP_PEGTL_STRING("checkpoint_compress") >;
 
-struct quiescence_info {
-  static std::string name() { return "quiescence"; }
+struct rsfreq_info {
+  static std::string name() { return "Checkpoint/restart frequency"; }
   static std::string shortDescription()
-  { return "Enable quiescence detection"; }
+  { return "Set checkpoint/restart frequency during time stepping"; }
   static std::string longDescription() { return
-    R"(This keyword is used to enable the quiescence detection feature of
-       Charm++, used to catch logic errors in the asynchronous control flow,
+    R"(This keyword is used to set the frequency of dumping checkpoint/restart
+       files during time stepping. The default is 1000, which means that
+       checkpoint/restart files are dumped at every 1000th time step.)";
+  }
+  using alias = Alias< r >;
+  struct expect {
+    using type = std::size_t;
+    static constexpr type lower = 1;
+    static constexpr type upper = std::numeric_limits< type >::max()-1;
+    static std::string description() { return "int"; }
+    static std::string choices() {
+      return "integer between [" + std::to_string(lower) + "..." +
+             std::to_string(upper) + "] (both inclusive)";
+    }
+  };
+};
+using rsfreq = keyword< rsfreq_info, TAOCPP_PEGTL_STRING("rsfreq") >;
+
+struct memfreq_info {
+  static std::string name() { return "In-memory checkpoint frequency"; }
+  static std::string shortDescription()
+  { return "Set in-memory checkpoint frequency during time stepping"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to set the frequency of double in-memory
+       checkpoints during time stepping. An in-memory checkpoint stores the
+       state of each object in the memory of its own and of a buddy compute
+       node, which is much cheaper than writing checkpoint/restart files, so
+       it can be taken much more frequently than those, see also the rsfreq
+       keyword. If a compute node fails, the run is automatically restarted
+       on the remaining nodes from the last in-memory checkpoint. The default
+       is 0, which means that no in-memory checkpoints are taken. A time step
+       at which checkpoint/restart files are written takes no in-memory
+       checkpoint. This requires Charm++ built with fault tolerance support,
+       i.e., with the syncft build option.)";
+  }
+  using alias = Alias< y >;
+  struct expect {
+    using type = std::size_t;
+    static constexpr type lower = 0;
+    static constexpr type upper = std::numeric_limits< type >::max()-1;
+    static std::string description() { return "int"; }
+    static std::string choices() {
+      return "integer between [" + std::to_string(lower) + "..." +
+             std::to_string(upper) + "] (both inclusive)";
+    }
+  };
+};
+using memfreq = keyword< memfreq_info, TAOCPP_PEGTL_STRING("memfreq") >;
+
+struct iobench_info {
+  static std::string name() { return "I/O benchmark"; }
+  static std::string shortDescription()
+  { return "Select I/O benchmark mode with a given number of field outputs"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select I/O benchmark mode. In I/O benchmark mode
+       no physics is computed: once the mesh is distributed across the worker
+       chares, as it would be for time stepping, each worker writes the given
+       number of field outputs of synthetic data through the mesh writer, as
+       configured in the control file, e.g., aggregating or compressing the
+       output, followed by a checkpoint. The aggregate throughput, the time
+       spent creating and opening files, and the skew of the time spent in
+       the individual writers are reported after each field output, and the
+       throughput of the checkpoint at the end. The size of the data written
+       is set by the keyword iobench_fields. This mode overrides benchmark
+       mode, which turns off large file output. The default is 0, which
+       disables the I/O benchmark.)";
+  }
+  using alias = Alias< I >;
+  struct expect {
+    using type = std::size_t;
+    static constexpr type lower = 1;
+    static constexpr type upper = std::numeric_limits< type >::max()-1;
+    static std::string description() { return "int"; }
+    static std::string choices() {
+      return "integer between [" + std::to_string(lower) + "..." +
+             std::to_string(upper) + "] (both inclusive)";
+    }
+  };
+};
+using iobench = keyword< iobench_info, TAOCPP_PEGTL_STRING("iobench") >;
+
+struct iofields_info {
+  static std::string name() { return "I/O benchmark fields"; }
+  static std::string shortDescription()
+  { return "Set number of fields written by the I/O benchmark"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to set the number of synthetic scalar fields
+       written in each field output of the I/O benchmark, see also the keyword
+       iobench. The given number of fields are written both in mesh nodes and
+       in mesh elements. The default is 8.)";
+  }
+  using alias = Alias< J >;
+  struct expect {
+    using type = std::size_t;
+    static constexpr type lower = 1;
+    static constexpr type upper = std::numeric_limits< type >::max()-1;
+    static std::string description() { return "int"; }
+    static std::string choices() {
+      return "integer between [" + std::to_string(lower) + "..." +
+             std::to_string(upper) + "] (both inclusive)";
+    }
+  };
+};
+using iofields =
+  keyword< iofields_info, TAOCPP_PEGTL_STRING("iobench_fields") >;
+
+struct feedback_info {
+  static std::string name() { return "feedback"; }
+  static std::string shortDescription() { return "Enable on-screen feedback"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to enable more detailed on-screen feedback on
+       particular tasks and sub-tasks as they happen, including the memory
+       footprint and the minimum and maximum wall-clock times across
+       processors of the setup phases. This is useful for large problems and
+       debugging.)";
+  }
+  using alias = Alias< f >;
+};
+using feedback = keyword< feedback_info, TAOCPP_PEGTL_STRING("feedback") >;
+
+struct version_info {
+  static std::string name() { return "Show version"; }
+  static std::string shortDescription() { return "Show version information"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to display version information for the
+       executable/tool on the standard output and exit successfully.)";
+  }
+  using alias = Alias< V >;
+};
+using version = keyword< version_info, TAOCPP_PEGTL_STRING("version") >;
+
+struct license_info {
+  static std::string name() { return "Show license"; }
+  static std::string shortDescription() { return "Show license information"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to display license information for the
+       executable/tool on the standard output and exit successfully.)";
+  }
+  using alias = Alias< L >;
+};
+using license = keyword< license_info, TAOCPP_PEGTL_STRING("license") >;
+
+struct trace_info {
+  static std::string name() { return "trace"; }
+  static std::string shortDescription()
+  { return "Disable call and stack trace"; }
+  static std::string longDescription() { return R"(This keyword can be used to
+    disable the on-screen call trace and stack trace after an exception is
+    thrown. Trace output is on by default and in some cases, the call and
+    stack trace can be huge and not very helpful, hence this command line
+    option.)"; }
+  using alias = Alias< t >;
+};
+using trace = keyword< trace_info, TAOCPP_PEGTL_STRING("trace") >;
+
+struct quiescence_info {
+  static std::string name() { return "quiescence"; }
+  static std::string shortDescription()
+  { return "Enable quiescence detection"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to enable the quiescence detection feature of
+       Charm++, used to catch logic errors in the asynchronous control flow,
        resulting in deadlocks. This is useful for automated testing and
        debugging and does have some overhead, so it is off by default.)";
   }
@@ -3989,6 +4703,55 @@ struct virtualization_info {
 using virtualization =
   keyword< virtualization_info, TAOCPP_PEGTL_STRING("virtualization") >;
 
+struct threads_info {
+  static std::string name() { return "threads"; }
+  static std::string shortDescription() { return
+    R"(Set number of threads advancing the particles of an integrator)"; }
+  static std::string longDescription() { return
+    R"(This option is used to set the number of threads, each with its own
+    random number generator stream, that advance the particles and accumulate
+    the statistics of a single integrator in parallel if OpenMP is enabled.
+    This allows running fewer, larger integrators, i.e., less
+    over-decomposition, per compute node, which reduces the overhead of
+    collecting statistics from the integrators.)";
+  }
+  using alias = Alias< w >;
+  struct expect {
+    using type = std::size_t;
+    static constexpr type lower = 1;
+    static constexpr type upper = std::numeric_limits< type >::max()-1;
+    static std::string description() { return "int"; }
+    static std::string choices() {
+      return "integer between [" + std::to_string(lower) + "..." +
+             std::to_string(upper) + "] (both inclusive)";
+    }
+  };
+};
+using threads = keyword< threads_info, TAOCPP_PEGTL_STRING("threads") >;
+
+struct singlepass_info {
+  static std::string name() { return "single_pass"; }
+  static std::string shortDescription() { return
+    R"(Estimate statistical moments in a single pass over the particles)"; }
+  static std::string longDescription() { return
+    R"(This option is used to estimate the ordinary and the central statistical
+    moments in a single pass over the particles, followed by a single
+    reduction across all integrators, instead of first estimating the means
+    and then, in a second pass, the central moments about them. The central
+    moments are accumulated by numerically stable, mergeable updates of the
+    means and co-moments, which are combined across threads, integrators, and
+    compute nodes. This halves the number of passes over the particle data and
+    the number of reductions per time step. Only central moments of up to
+    second order, i.e., variances and covariances, can be estimated this way
+    and central PDFs require the means beforehand, so if higher-order central
+    moments or central PDFs are requested, the statistics are estimated in two
+    passes regardless of this option.)";
+  }
+  using alias = Alias< a >;
+};
+using singlepass =
+  keyword< singlepass_info, TAOCPP_PEGTL_STRING("single_pass") >;
+
 struct pdf_info {
   static std::string name() { return "pdf"; }
   static std::string shortDescription() { return
@@ -4037,6 +4800,29 @@ struct particles_info {
 };
 using particles = keyword< particles_info, TAOCPP_PEGTL_STRING("particles") >;
 
+struct ensemble_info {
+  static std::string name() { return "ensemble"; }
+  static std::string shortDescription() { return
+    "Specify the name of the parameter table of an ensemble of runs"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to specify the name of a parameter table file
+    describing an ensemble of runs, executed one after the other without
+    restarting the executable. The first line of the table lists the names of
+    the parameters, each further line gives the values of the parameters for a
+    run, separated by white space. For each run, the control file, used as a
+    template, is copied to a file whose name is the control file name appended
+    by '.' and the index of the run, replacing each '${name}' with the value
+    of parameter 'name'. The run's output file names are appended by '_' and
+    the index of the run in front of their extension.)";
+  }
+  using alias = Alias< E >;
+  struct expect {
+    using type = std::string;
+    static std::string description() { return "string"; }
+  };
+};
+using ensemble = keyword< ensemble_info, TAOCPP_PEGTL_STRING("ensemble") >;
+
 struct input_info {
   static std::string name() { return "input"; }
   static std::string shortDescription() { return "Specify the input file"; }
@@ -4089,6 +4875,26 @@ struct screen_info {
 };
 using screen = keyword< screen_info, TAOCPP_PEGTL_STRING("screen") >;
 
+struct testcost_info {
+  static std::string name() { return "testcost"; }
+  static std::string shortDescription() {
+    return "Specify the file storing the run times of statistical tests"; }
+  static std::string longDescription() { return
+    R"(This option is used to set the name of the file in which the run times
+    of the statistical tests of a random number generator test battery are
+    stored at the end of a run and from which they are read at the start of
+    the next one. The run times are used to distribute the tests across PEs so
+    that the longest tests start first and the PEs finish at about the same
+    time. The default is "<executable>_testcost.txt".)";
+  }
+  using alias = Alias< T >;
+  struct expect {
+    using type = std::string;
+    static std::string description() { return "string"; }
+  };
+};
+using testcost = keyword< testcost_info, TAOCPP_PEGTL_STRING("testcost") >;
+
 struct restart_info {
   static std::string name() { return "checkpoint/restart directory name"; }
   static std::string shortDescription()
@@ -4198,6 +5004,134 @@ struct reorder_cmd_info {
 };
 using reorder_cmd = keyword< reorder_cmd_info, TAOCPP_PEGTL_STRING("reorder") >;
 
+struct stream_cmd_info {
+  static std::string name() { return "stream"; }
+  static std::string shortDescription()
+  { return "Convert mesh by streaming it in chunks"; }
+  static std::string longDescription() { return
+    R"(This keyword is used as a command line argument to instruct the mesh
+    converter to convert the mesh by streaming its nodes and elements in
+    chunks through temporary files, instead of holding the whole mesh in
+    memory, enabling the conversion of meshes larger than the memory
+    available. Streaming is supported between the Gmsh and Netgen formats
+    and without reordering; otherwise the mesh is converted in memory.)";
+  }
+  using alias = Alias< m >;
+  struct expect {
+    using type = bool;
+    static std::string description() { return "string"; }
+  };
+};
+using stream_cmd = keyword< stream_cmd_info, TAOCPP_PEGTL_STRING("stream") >;
+
+struct ncycle_cmd_info {
+  static std::string name() { return "cycles"; }
+  static std::string shortDescription()
+  { return "Set number of mesh refinement cycles"; }
+  static std::string longDescription() { return
+    R"(This keyword is used as a command line argument to set the number of
+    mesh refinement cycles the AMR benchmark, amrbench, performs. Each cycle
+    consists of a refinement and a derefinement step. The default is 1.)";
+  }
+  using alias = Alias< n >;
+  struct expect {
+    using type = std::size_t;
+    static constexpr type lower = 1;
+    static std::string description() { return "int"; }
+  };
+};
+using ncycle_cmd = keyword< ncycle_cmd_info, TAOCPP_PEGTL_STRING("cycles") >;
+
+struct uniform_cmd_info {
+  static std::string name() { return "uniform"; }
+  static std::string shortDescription()
+  { return "Select uniform mesh refinement"; }
+  static std::string longDescription() { return
+    R"(This keyword is used as a command line argument to instruct the AMR
+    benchmark, amrbench, to refine and derefine all cells of the mesh in each
+    cycle, instead of the default error-based refinement and derefinement
+    that follows a front sweeping across the mesh.)";
+  }
+  using alias = Alias< u >;
+};
+using uniform_cmd = keyword< uniform_cmd_info, TAOCPP_PEGTL_STRING("uniform") >;
+
+struct json_cmd_info {
+  static std::string name() { return "json"; }
+  static std::string shortDescription()
+  { return "Specify the JSON output file of benchmark results"; }
+  static std::string longDescription() { return
+    R"(This keyword is used as a command line argument to specify the name of
+    the file the microbenchmark suite, microbench, writes its results to in
+    JSON, compatible with the output of Google Benchmark, so that the results
+    can be tracked across commits. The default is microbench.json.)";
+  }
+  using alias = Alias< j >;
+  struct expect {
+    using type = std::string;
+    static std::string description() { return "string"; }
+  };
+};
+using json_cmd = keyword< json_cmd_info, TAOCPP_PEGTL_STRING("json") >;
+
+struct filter_cmd_info {
+  static std::string name() { return "filter"; }
+  static std::string shortDescription()
+  { return "Select benchmarks by name"; }
+  static std::string longDescription() { return
+    R"(This keyword is used as a command line argument to select the
+    benchmarks the microbenchmark suite, microbench, runs: only those whose
+    name contains the given string are run, e.g., 'riemann' or 'data:'. By
+    default all benchmarks are run.)";
+  }
+  using alias = Alias< F >;
+  struct expect {
+    using type = std::string;
+    static std::string description() { return "string"; }
+  };
+};
+using filter_cmd = keyword< filter_cmd_info, TAOCPP_PEGTL_STRING("filter") >;
+
+struct mintime_cmd_info {
+  static std::string name() { return "mintime"; }
+  static std::string shortDescription()
+  { return "Set minimum time spent in each benchmark"; }
+  static std::string longDescription() { return
+    R"(This keyword is used as a command line argument to set the minimum
+    wall-clock time in milliseconds the microbenchmark suite, microbench,
+    spends repeating each benchmark, of which the fastest repetition is
+    reported. The default is 200.)";
+  }
+  using alias = Alias< M >;
+  struct expect {
+    using type = std::size_t;
+    static constexpr type lower = 1;
+    static std::string description() { return "int"; }
+  };
+};
+using mintime_cmd = keyword< mintime_cmd_info, TAOCPP_PEGTL_STRING("mintime") >;
+
+struct boxsize_cmd_info {
+  static std::string name() { return "boxsize"; }
+  static std::string shortDescription()
+  { return "Set size of the benchmark mesh"; }
+  static std::string longDescription() { return
+    R"(This keyword is used as a command line argument to set the number of
+    cubes along each direction of the box mesh, each cube split into six
+    tetrahedra, the microbenchmark suite, microbench, generates and runs the
+    mesh-based benchmarks on. The number of states of the pointwise
+    benchmarks, e.g., Riemann solvers, equals the number of tetrahedra. The
+    default is 24.)";
+  }
+  using alias = Alias< N >;
+  struct expect {
+    using type = std::size_t;
+    static constexpr type lower = 1;
+    static std::string description() { return "int"; }
+  };
+};
+using boxsize_cmd = keyword< boxsize_cmd_info, TAOCPP_PEGTL_STRING("boxsize") >;
+
 struct pelocal_reorder_info {
   static std::string name() { return "PE-local reorder"; }
   static std::string shortDescription() { return "PE-local reorder"; }
@@ -4232,23 +5166,466 @@ struct operator_reorder_info {
     static std::string description() { return "string"; }
   };
 };
-using operator_reorder =
-  keyword< operator_reorder_info, TAOCPP_PEGTL_STRING("operator_reorder") >;
+using operator_reorder =
+  keyword< operator_reorder_info, TAOCPP_PEGTL_STRING("operator_reorder") >;
+
+struct operator_access_info {
+  static std::string name() { return "operator access"; }
+  static std::string shortDescription() { return
+    "Select operator-access mesh node reordering"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select the mesh node reordering that numbers
+    mesh nodes in the order they are first accessed by the PDE operators, i.e.,
+    by a loop over the edges (or elements) of the mesh. See
+    Control/Inciter/Options/Reorder.hpp for other valid options.)"; }
+};
+using operator_access =
+  keyword< operator_access_info, TAOCPP_PEGTL_STRING("operator_access") >;
+
+struct advancing_front_info {
+  static std::string name() { return "advancing front"; }
+  static std::string shortDescription() { return
+    "Select advancing front mesh node reordering"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select the advancing front mesh node reordering,
+    which numbers mesh nodes layer by layer, starting from a single node, using
+    the graph of points surrounding points. See
+    Control/Inciter/Options/Reorder.hpp for other valid options.)"; }
+};
+using advancing_front =
+  keyword< advancing_front_info, TAOCPP_PEGTL_STRING("advancing_front") >;
+
+struct rcm_info {
+  static std::string name() { return "reverse Cuthill-McKee"; }
+  static std::string shortDescription() { return
+    "Select reverse Cuthill-McKee mesh node reordering"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select the reverse Cuthill-McKee mesh node
+    reordering, which reduces the bandwidth of the graph of points surrounding
+    points, and thus improves the cache reuse of edge and element loops
+    gathering and scattering nodal data. See
+    Control/Inciter/Options/Reorder.hpp for other valid options.)"; }
+};
+using rcm = keyword< rcm_info, TAOCPP_PEGTL_STRING("rcm") >;
+
+struct morton_info {
+  static std::string name() { return "Morton"; }
+  static std::string shortDescription() { return
+    "Select Morton space-filling-curve mesh node reordering"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select the mesh node reordering that numbers
+    mesh nodes along the Morton (Z-order) space-filling curve based on the node
+    coordinates. See Control/Inciter/Options/Reorder.hpp for other valid
+    options.)"; }
+};
+using morton = keyword< morton_info, TAOCPP_PEGTL_STRING("morton") >;
+
+struct hilbert_info {
+  static std::string name() { return "Hilbert"; }
+  static std::string shortDescription() { return
+    "Select Hilbert space-filling-curve mesh node reordering"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select the mesh node reordering that numbers
+    mesh nodes along the Hilbert space-filling curve based on the node
+    coordinates. See Control/Inciter/Options/Reorder.hpp for other valid
+    options.)"; }
+};
+using hilbert = keyword< hilbert_info, TAOCPP_PEGTL_STRING("hilbert") >;
+
+struct node_reorder_info {
+  static std::string name() { return "node_reorder"; }
+  static std::string shortDescription() { return
+    "Select local mesh node reordering algorithm"; }
+  static std::string longDescription() { return
+    R"(This keyword is used in inciter as a keyword in the inciter...end block
+    to select the algorithm used for the local mesh node reordering enabled by
+    'operator_reorder true'. The default is 'operator_access'. See
+    Control/Inciter/Options/Reorder.hpp for valid options.)"; }
+  struct expect {
+    static std::string description() { return "string"; }
+    static std::string choices() {
+      return '\'' + operator_access::string() + "\' | \'"
+                  + advancing_front::string() + "\' | \'"
+                  + rcm::string() + "\' | \'"
+                  + morton::string() + "\' | \'"
+                  + hilbert::string() + '\'';
+    }
+  };
+};
+using node_reorder =
+  keyword< node_reorder_info, TAOCPP_PEGTL_STRING("node_reorder") >;
+
+struct elem_reorder_info {
+  static std::string name() { return "elem_reorder"; }
+  static std::string shortDescription() { return "Element reorder"; }
+  static std::string longDescription() { return
+    R"(This keyword is used in inciter as a keyword in the inciter...end block
+    as "elem_reorder true" (or false) to do (or not do) a local reordering of
+    mesh elements, consistent with the order of mesh nodes, so that element
+    loops access nodal data in the order it is stored. With continuous Galerkin
+    schemes elements are reordered after the (optional) local mesh node
+    reordering. With discontinuous Galerkin schemes elements are only
+    reordered if AMR is off. This reordering is optional.)";
+  }
+  struct expect {
+    using type = bool;
+    static std::string choices() { return "true | false"; }
+    static std::string description() { return "string"; }
+  };
+};
+using elem_reorder =
+  keyword< elem_reorder_info, TAOCPP_PEGTL_STRING("elem_reorder") >;
+
+struct fused_edgeflux_info {
+  static std::string name() { return "fused_edgeflux"; }
+  static std::string shortDescription() { return
+    "Fused edge flux computation and scatter"; }
+  static std::string longDescription() { return
+    R"(This keyword is used in inciter as a keyword in the inciter...end block
+    as "fused_edgeflux true" (or false) to select the single-pass domain-edge
+    integral of the ALECG scheme, which adds the flux of each edge to the
+    right hand side of both edge-end points right after it is computed, in
+    the order of the edge list. The default (false) first stores the fluxes
+    of all edges and then gathers them into the points, which works on data
+    twice but is shared among threads if OpenMP is enabled. Which one is
+    faster depends on the mesh size relative to the cache. This choice is
+    optional.)";
+  }
+  struct expect {
+    using type = bool;
+    static std::string choices() { return "true | false"; }
+    static std::string description() { return "string"; }
+  };
+};
+using fused_edgeflux =
+  keyword< fused_edgeflux_info, TAOCPP_PEGTL_STRING("fused_edgeflux") >;
+
+struct steady_state_info {
+  static std::string name() { return "steady_state"; }
+  static std::string shortDescription() { return "March to steady state"; }
+  static std::string longDescription() { return
+    R"(This keyword is used indicate that local time stepping should be used
+       towards a stationary solution. With DG the (pseudo) time is local to
+       each partition, so the march only stops if the maximum number of time
+       steps (nstep) is reached or the residual (see rescomp and residual)
+       has converged.)"; }
+  struct expect {
+    using type = bool;
+    static std::string choices() { return "true | false"; }
+    static std::string description() { return "string"; }
+  };
+};
+using steady_state =
+  keyword< steady_state_info, TAOCPP_PEGTL_STRING("steady_state") >;
+
+struct implicit_info {
+  static std::string name() { return "implicit"; }
+  static std::string shortDescription() { return
+    "Implicit (Newton-Krylov) pseudo-time stepping"; }
+  static std::string longDescription() { return
+    R"(This keyword is used in inciter as a keyword in the inciter...end block
+    as "implicit true" (or false) to select implicit pseudo-time stepping
+    instead of explicit Runge-Kutta for the ALECG and DG schemes. Each time
+    step then does a single Newton iteration of the backward-Euler
+    discretization in (pseudo-)time, whose linear system is solved by
+    matrix-free GMRES: the Jacobian is applied by finite differences of the
+    right hand side and the system is preconditioned by the diagonal (lumped)
+    mass matrix divided by the time step size. For DG the preconditioner also
+    includes an estimate of the spectral radius of the flux Jacobian of each
+    element, and p-adaptive DG is not supported. Combined with steady_state
+    (local time stepping) this allows much larger CFL numbers marching to
+    steady state. See also
+    krylov_maxit and krylov_tol. The default is false.)";
+  }
+  struct expect {
+    using type = bool;
+    static std::string choices() { return "true | false"; }
+    static std::string description() { return "string"; }
+  };
+};
+using implicit = keyword< implicit_info, TAOCPP_PEGTL_STRING("implicit") >;
+
+struct krylov_maxit_info {
+  static std::string name() { return "krylov_maxit"; }
+  static std::string shortDescription() { return
+    "Maximum number of Krylov iterations per implicit time step"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to specify the maximum number of GMRES iterations,
+    i.e., the maximum size of the Krylov subspace, in a single Newton
+    iteration of implicit time stepping. Each GMRES iteration costs one
+    evaluation of the right hand side. See also implicit.)";
+  }
+  struct expect {
+    using type = uint32_t;
+    static constexpr type lower = 1;
+    static std::string description() { return "uint"; }
+  };
+};
+using krylov_maxit =
+  keyword< krylov_maxit_info, TAOCPP_PEGTL_STRING("krylov_maxit") >;
+
+struct krylov_tol_info {
+  static std::string name() { return "krylov_tol"; }
+  static std::string shortDescription() { return
+    "Relative convergence tolerance of the Krylov solver"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to specify the relative convergence tolerance of
+    GMRES in implicit time stepping: the Krylov iterations of a time step stop
+    when the norm of the linear residual is reduced by this factor. Since a
+    single (inexact) Newton iteration is done per time step, a loose
+    tolerance is usually most efficient. See also implicit.)";
+  }
+  struct expect {
+    using type = tk::real;
+    static constexpr type lower = 1.0e-14;
+    static constexpr type upper = 1.0;
+    static std::string description() { return "real"; }
+  };
+};
+using krylov_tol =
+  keyword< krylov_tol_info, TAOCPP_PEGTL_STRING("krylov_tol") >;
+
+struct lagged_dt_info {
+  static std::string name() { return "lagged_dt"; }
+  static std::string shortDescription() { return
+    "Take time steps with the lagged global time step size"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to take the global minimum of the time step size,
+    computed from the CFL condition, off the critical path of time stepping.
+    Instead of waiting for the global minimum of the time step size computed
+    at the start of a time step, the step is taken with the minimum computed
+    at the start of the previous step, multiplied by the safety factor given
+    by this keyword, while the global minimum of the current step is
+    computed in the background. When the minimum of the current step
+    arrives it is checked against the time step size taken and if the step
+    size taken was larger, the next step waits for the global minimum.
+    Setting zero, the default, waits for the global minimum at every time
+    step. Only used with a time step size computed from the CFL condition,
+    without local time stepping. Example: "lagged_dt 0.9".)";
+  }
+  struct expect {
+    using type = tk::real;
+    static constexpr type lower = 0.0;
+    static constexpr type upper = 1.0;
+    static std::string description() { return "real"; }
+  };
+};
+using lagged_dt = keyword< lagged_dt_info, TAOCPP_PEGTL_STRING("lagged_dt") >;
+
+struct rk_tol_info {
+  static std::string name() { return "rk_tol"; }
+  static std::string shortDescription() { return
+    "Select the time step size by an estimate of the local time error"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to configure the tolerance of the local error of
+    time stepping, which, if positive, selects the time step size instead of
+    CFL condition alone. The error is estimated by the difference of the
+    solution of the Runge-Kutta scheme and that of the forward Euler scheme
+    embedded in its first stage, and the time step size is selected by a
+    proportional-integral controller from the error estimates of the last two
+    time steps. The time step size is still bounded by the one computed from
+    the CFL coefficient, which then serves as the stability limit rather than
+    as a safety margin, so it is usually configured to be larger. Setting
+    zero, the default, selects the time step size by the CFL condition
+    alone. Not used with a constant time step size or with local time
+    stepping. Example: "rk_tol 1.0e-4".)";
+  }
+  struct expect {
+    using type = tk::real;
+    static constexpr type lower = 0.0;
+    static std::string description() { return "real"; }
+  };
+};
+using rk_tol = keyword< rk_tol_info, TAOCPP_PEGTL_STRING("rk_tol") >;
+
+struct rk_stages_info {
+  static std::string name() { return "rk_stages"; }
+  static std::string shortDescription() { return
+    "Select the number of stages of explicit Runge-Kutta time stepping"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select the number of stages of the explicit
+    Runge-Kutta schemes used for time stepping by ALECG and DG. Schemes with
+    more stages have larger stability regions per stage, so a larger CFL
+    number can be set for CFL-limited runs, which advances more simulated
+    time per right hand side evaluation. ALECG uses the two-register
+    multistage schemes of Jameson: 3 stages (the default) are stable up to
+    a CFL of 1.73 along the imaginary axis, 4 stages up to 2.83, and 5
+    stages up to 4.0. DG uses the strong stability preserving schemes of
+    Shu and Osher and of Spiteri and Ruuth: 3 stages (the default, SSP
+    coefficient 1) and 4 stages (third order with SSP coefficient 2).
+    Example: "rk_stages 4".)";
+  }
+  struct expect {
+    using type = std::size_t;
+    static constexpr type lower = 3;
+    static constexpr type upper = 5;
+    static std::string description() { return "uint"; }
+  };
+};
+using rk_stages = keyword< rk_stages_info, TAOCPP_PEGTL_STRING("rk_stages") >;
+
+struct dt_levels_info {
+  static std::string name() { return "dt_levels"; }
+  static std::string shortDescription() { return
+    "Set the number of time step size levels of multi-rate time stepping"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to set the number of time step size levels
+    mesh nodes are grouped into for multi-rate time stepping. Level l holds
+    the nodes whose stable time step size is at least 2^l times the global
+    minimum, with the levels of neighboring nodes differing by at most one.
+    At the start of time stepping the number of nodes on each level and the
+    estimated speedup of advancing each level with its own time step size
+    over advancing all nodes with the global minimum are reported. This is
+    used to judge whether multi-rate time stepping pays off on a mesh with
+    widely varying cell sizes. The default, 0, disables the grouping. Only
+    used by ALECG with CFL-based time stepping, not marching to steady
+    state. Example: "dt_levels 4".)";
+  }
+  struct expect {
+    using type = std::size_t;
+    static constexpr type lower = 0;
+    static constexpr type upper = 16;
+    static std::string description() { return "uint"; }
+  };
+};
+using dt_levels = keyword< dt_levels_info, TAOCPP_PEGTL_STRING("dt_levels") >;
+
+struct lagged_diag_info {
+  static std::string name() { return "lagged_diag"; }
+  static std::string shortDescription() { return
+    "Reduce diagnostics together with the next time step size"; }
+  static std::string longDescription() { return
+    R"(This keyword is used in inciter as a keyword in the inciter...end block
+    as "lagged_diag true" (or false) to save a global collective at every
+    time step at which diagnostics are computed by the node-centered schemes,
+    DiagCG and ALECG. Instead of waiting for the diagnostics to be aggregated
+    across all workers before continuing, the partial diagnostics of a
+    worker are kept until the next time step and are sent along with the
+    time step size, whose global minimum is computed at the start of the next
+    time step. The diagnostics file is then written one time step later, with
+    the same content. Not used with steady_state, which needs the residual
+    to decide whether to continue, nor with lagged_dt. The default is
+    false.)";
+  }
+  struct expect {
+    using type = bool;
+    static std::string choices() { return "true | false"; }
+    static std::string description() { return "string"; }
+  };
+};
+using lagged_diag =
+  keyword< lagged_diag_info, TAOCPP_PEGTL_STRING("lagged_diag") >;
+
+struct multigrid_info {
+  static std::string name() { return "multigrid"; }
+  static std::string shortDescription() { return
+    "Agglomeration multigrid acceleration of steady-state convergence"; }
+  static std::string longDescription() { return
+    R"(This keyword is used in inciter as a keyword in the inciter...end block
+    as "multigrid true" (or false) to accelerate convergence to steady state
+    of the ALECG scheme with explicit local time stepping by a full
+    approximation storage (FAS) multigrid V-cycle in every time step. Coarse
+    levels are built by agglomerating the dual cells of neighboring mesh
+    nodes of each mesh partition; nodes along the mesh boundary and along
+    partition boundaries are not agglomerated and receive no coarse-level
+    correction. Each coarse level is smoothed by a single three-stage
+    Runge-Kutta step of a first-order edge-based residual. Only used with
+    steady_state and without implicit. See also mg_levels. The default is
+    false.)";
+  }
+  struct expect {
+    using type = bool;
+    static std::string choices() { return "true | false"; }
+    static std::string description() { return "string"; }
+  };
+};
+using multigrid = keyword< multigrid_info, TAOCPP_PEGTL_STRING("multigrid") >;
+
+struct mg_levels_info {
+  static std::string name() { return "mg_levels"; }
+  static std::string shortDescription() { return
+    "Number of coarse levels of agglomeration multigrid"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to specify the number of coarse levels, below the
+    mesh, used by agglomeration multigrid. Each level has roughly a fifth to
+    a tenth as many nodes as the one above it. See also multigrid.)";
+  }
+  struct expect {
+    using type = uint32_t;
+    static constexpr type lower = 1;
+    static constexpr type upper = 10;
+    static std::string description() { return "uint"; }
+  };
+};
+using mg_levels =
+  keyword< mg_levels_info, TAOCPP_PEGTL_STRING("mg_levels") >;
+
+struct freeze_grad_info {
+  static std::string name() { return "freeze_grad"; }
+  static std::string shortDescription() { return
+    "Reuse the gradients of the first Runge-Kutta stage in later stages"; }
+  static std::string longDescription() { return
+    R"(This keyword is used in inciter as a keyword in the inciter...end block
+    as "freeze_grad true" (or false) to compute the nodal gradients used by
+    the MUSCL reconstruction of the ALECG scheme only in the first stage of
+    each explicit Runge-Kutta time step and reuse them in the later two
+    stages. This saves the gradient computation and its communication round
+    in two of the three stages. Since the converged steady state does not
+    depend on the stages, it is only used with steady_state and without
+    implicit. The default is false.)";
+  }
+  struct expect {
+    using type = bool;
+    static std::string choices() { return "true | false"; }
+    static std::string description() { return "string"; }
+  };
+};
+using freeze_grad =
+  keyword< freeze_grad_info, TAOCPP_PEGTL_STRING("freeze_grad") >;
 
-struct steady_state_info {
-  static std::string name() { return "steady_state"; }
-  static std::string shortDescription() { return "March to steady state"; }
+struct irs_sweeps_info {
+  static std::string name() { return "irs_sweeps"; }
+  static std::string shortDescription() { return
+    "Number of Jacobi sweeps of implicit residual smoothing"; }
   static std::string longDescription() { return
-    R"(This keyword is used indicate that local time stepping should be used
-       towards a stationary solution.)"; }
+    R"(This keyword is used to specify the number of Jacobi sweeps of implicit
+    residual smoothing, which accelerates convergence to steady state of the
+    ALECG scheme with explicit local time stepping. Before every Runge-Kutta
+    update the nodal residual R is replaced by the approximate solution Rs of
+    Rs - eps * L(Rs) = R, with L the graph Laplacian over the edges of the
+    mesh, which allows a larger CFL number, usually two to three times the
+    one without smoothing. Each sweep takes one communication round among
+    chares sharing mesh nodes. Zero, the default, disables smoothing. Only
+    used with steady_state and without implicit. See also irs_eps.)";
+  }
   struct expect {
-    using type = bool;
-    static std::string choices() { return "true | false"; }
-    static std::string description() { return "string"; }
+    using type = uint32_t;
+    static constexpr type lower = 0;
+    static constexpr type upper = 10;
+    static std::string description() { return "uint"; }
   };
 };
-using steady_state =
-  keyword< steady_state_info, TAOCPP_PEGTL_STRING("steady_state") >;
+using irs_sweeps =
+  keyword< irs_sweeps_info, TAOCPP_PEGTL_STRING("irs_sweeps") >;
+
+struct irs_eps_info {
+  static std::string name() { return "irs_eps"; }
+  static std::string shortDescription() { return
+    "Smoothing coefficient of implicit residual smoothing"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to specify the smoothing coefficient, eps, of
+    implicit residual smoothing. Larger values smooth more and allow larger
+    CFL numbers but slow down the convergence of the Jacobi sweeps. The
+    default is 0.5. See also irs_sweeps.)";
+  }
+  struct expect {
+    using type = tk::real;
+    static constexpr type lower = 0.0;
+    static constexpr type upper = 10.0;
+    static std::string description() { return "real"; }
+  };
+};
+using irs_eps = keyword< irs_eps_info, TAOCPP_PEGTL_STRING("irs_eps") >;
 
 struct residual_info {
   static std::string name() { return "residual"; }
@@ -5088,6 +6465,31 @@ struct cweight_info {
 };
 using cweight = keyword< cweight_info, TAOCPP_PEGTL_STRING("cweight") >;
 
+struct limtol_info {
+  static std::string name() { return "limtol"; }
+  static std::string shortDescription() { return
+    R"(Set tolerance of the troubled-cell indicator used by DG limiters)"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to set the tolerance of the troubled-cell indicator
+    that selects the elements limited by the limiters for discontinuous
+    Galerkin (DG) methods. An element is limited if, for any scalar component,
+    the ratio of the squared L2 norms of the P1 part of the solution and the
+    full solution in the element, a spectral-decay measure, is not smaller than
+    limtol. The default, 0.0, limits all elements. Example: "limtol 1.0e-4".)";
+  }
+  struct expect {
+    using type = tk::real;
+    static constexpr type lower = 0.0;
+    static constexpr type upper = 1.0;
+    static std::string description() { return "real"; }
+    static std::string choices() {
+      return "real between [" + std::to_string(lower) + "..." +
+             std::to_string(upper) + "]";
+    }
+  };
+};
+using limtol = keyword< limtol_info, TAOCPP_PEGTL_STRING("limtol") >;
+
 struct sideset_info {
   static std::string name() { return "sideset"; }
   static std::string shortDescription() { return
@@ -5425,6 +6827,30 @@ struct mat_k_info {
 };
 using mat_k = keyword< mat_k_info, TAOCPP_PEGTL_STRING("k") >;
 
+struct mat_eostable_info {
+  static std::string name() { return "eos_table"; }
+  static std::string shortDescription() { return
+    "tabulated equation of state"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to specify the names of files containing tabulated
+       equations of state, one per material, used instead of the stiffened-gas
+       equation of state. Each file is an ASCII table, whose lines starting
+       with '#' are comments, giving the number of density and specific
+       internal energy grid points, nrho ne, followed by the ranges of the
+       uniform grid, rho_min rho_max e_min e_max, followed by nrho*ne lines of
+       pressure, speed of sound, and temperature, p c T, with e varying
+       fastest. The pressure must increase with energy at all densities.
+       Materials still require the stiffened-gas parameters, which are not
+       used. Example: "eos_table water.eos products.eos end".)";
+  }
+  struct expect {
+    using type = std::string;
+    static std::string description() { return "string"; }
+  };
+};
+using mat_eostable =
+  keyword< mat_eostable_info, TAOCPP_PEGTL_STRING("eos_table") >;
+
 struct material_info {
   static std::string name() { return "Material properties block"; }
   static std::string shortDescription() { return
@@ -5552,6 +6978,21 @@ struct hsfc_info {
 };
 using hsfc = keyword< hsfc_info, TAOCPP_PEGTL_STRING("hsfc") >;
 
+struct sfc_info {
+  static std::string name() { return "native space filling curve"; }
+  static std::string shortDescription() { return
+    "Select the built-in Hilbert space filling curve mesh partitioner"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select the built-in Hilbert space filling curve
+    (SFC) mesh partitioner. Unlike the other partitioners, which are provided
+    by Zoltan2, this partitioner orders the mesh cells along the Hilbert curve
+    and cuts the curve into pieces of equal weight found by a distributed
+    histogram sort using only a few collective reductions, so its cost grows
+    linearly with the mesh size. See Control/Options/PartitioningAlgorithm.hpp
+    for other valid options.)"; }
+};
+using sfc = keyword< sfc_info, TAOCPP_PEGTL_STRING("sfc") >;
+
 struct mj_info {
   static std::string name() { return "multi-jagged"; }
   static std::string shortDescription() { return
@@ -5576,6 +7017,22 @@ struct phg_info {
 };
 using phg = keyword< phg_info, TAOCPP_PEGTL_STRING("phg") >;
 
+struct parmetis_info {
+  static std::string name() { return "ParMETIS"; }
+  static std::string shortDescription() { return
+    "Select parallel graph mesh partitioner"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select the ParMETIS parallel graph mesh
+    partitioner, via Zoltan2, which requires Trilinos configured with
+    ParMETIS. The graph partitioned is that of the mesh cells connected by
+    their shared nodes, minimizing the number of nodes shared among the
+    partitions. Like the hypergraph partitioner, phg, this takes the mesh
+    connectivity and is thus slower than the geometric partitioners, but
+    yields smaller chare boundaries. See
+    Control/Options/PartitioningAlgorithm.hpp for other valid options.)"; }
+};
+using parmetis = keyword< parmetis_info, TAOCPP_PEGTL_STRING("parmetis") >;
+
 struct algorithm_info {
   static std::string name() { return "algorithm"; }
   static std::string shortDescription() { return
@@ -5590,12 +7047,333 @@ struct algorithm_info {
                   + rib::string() + "\' | \'"
                   + hsfc::string() + "\' | \'"
                   + mj::string() + "\' | \'"
-                  + phg::string() + '\'';
+                  + phg::string() + "\' | \'"
+                  + sfc::string() + "\' | \'"
+                  + parmetis::string() + '\'';
     }
   };
 };
 using algorithm = keyword< algorithm_info, TAOCPP_PEGTL_STRING("algorithm") >;
 
+struct bface_weight_info {
+  static std::string name() { return "boundary face weight"; }
+  static std::string shortDescription() { return
+    "Configure the partitioning weight of mesh cells per boundary face"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to set the additional computational cost of a mesh
+    cell per boundary face it has (i.e., per face on a side set), relative to
+    the cost of a mesh cell in the interior of the domain, whose cost is unity.
+    If nonzero, the cells are weighted by their cost estimated this way when
+    the mesh is partitioned, so that the partitions are balanced in the
+    estimated cost instead of the number of cells. The default is zero, which
+    partitions the mesh with equal cell weights. Example: "bface_weight 0.5",
+    which estimates a cell with two boundary faces to cost twice as much as
+    an interior cell.)"; }
+  struct expect {
+    using type = tk::real;
+    static constexpr type lower = 0.0;
+    static std::string description() { return "real"; }
+  };
+};
+using bface_weight =
+  keyword< bface_weight_info, TAOCPP_PEGTL_STRING("bface_weight") >;
+
+struct hierarchical_info {
+  static std::string name() { return "hierarchical partitioning"; }
+  static std::string shortDescription() { return
+    "Partition the mesh hierarchically: first across compute nodes"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to configure two-level, hierarchical, mesh
+    partitioning, as "hierarchical true" (or false). If true, the mesh is
+    first partitioned into as many parts as compute nodes, using the selected
+    partitioning algorithm, then each compute node splits its part into the
+    chares it creates, along the Hilbert space-filling curve. This keeps most
+    of the communication among chares within compute nodes, in shared memory,
+    when running in SMP mode with multiple PEs per compute node. The default
+    is false, which partitions the mesh directly into chares.)"; }
+  struct expect {
+    using type = bool;
+    static std::string choices() { return "true | false"; }
+    static std::string description() { return "string"; }
+  };
+};
+using hierarchical =
+  keyword< hierarchical_info, TAOCPP_PEGTL_STRING("hierarchical") >;
+
+struct graph_map_info {
+  static std::string name() { return "communication-graph-aware chare map"; }
+  static std::string shortDescription() { return
+    "Remap chares to PEs based on their communication graph after setup"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to configure the placement of worker chares to
+    PEs, as "graph_map true" (or false). If true, after setup, and before time
+    stepping starts, the chares are migrated once, to PEs computed from the
+    chare communication graph, i.e., the number of mesh nodes each chare
+    shares with each of its neighbors, and their number of mesh cells, so
+    that heavily communicating chares are placed onto the same PE and compute
+    node. The default is false, which keeps the chares on the PEs they were
+    created on.)"; }
+  struct expect {
+    using type = bool;
+    static std::string choices() { return "true | false"; }
+    static std::string description() { return "string"; }
+  };
+};
+using graph_map = keyword< graph_map_info, TAOCPP_PEGTL_STRING("graph_map") >;
+
+struct dist_chunk_info {
+  static std::string name() { return "mesh distribution chunk size"; }
+  static std::string shortDescription() { return
+    "Configure the max number of mesh cells per mesh distribution message"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to bound the size of the messages distributing the
+    mesh to compute nodes after mesh partitioning. If nonzero, the mesh sent
+    by a compute node to the chares of another compute node is streamed in
+    chunks of at most this many mesh cells, with only a few chunks in flight
+    per sender at a time, to bound the transient memory required during mesh
+    distribution. The default is zero, which sends all mesh cells for a
+    compute node in a single message. Example: "dist_chunk 100000".)"; }
+  struct expect {
+    using type = std::size_t;
+    static constexpr type lower = 0;
+    static std::string description() { return "uint"; }
+  };
+};
+using dist_chunk =
+  keyword< dist_chunk_info, TAOCPP_PEGTL_STRING("dist_chunk") >;
+
+struct mesh_cache_info {
+  static std::string name() { return "partitioned mesh cache"; }
+  static std::string shortDescription() { return
+    "Configure the file name prefix of the partitioned mesh cache"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to cache the mesh after it has been read,
+    partitioned, and distributed to chares, in binary files named starting
+    with the prefix given, e.g., "mesh_cache /scratch/box". The cache is keyed
+    by the mesh file (name, size, and modification time), the partitioning
+    configuration, the virtualization, the side sets used by boundary
+    conditions, and the number of compute nodes and PEs. If a cache matching
+    all of them exists, e.g., in a parameter sweep on the same mesh and
+    number of PEs, only the mesh chunks of the chares are loaded from the
+    cache and reading the mesh cells and partitioning the mesh is skipped.
+    Otherwise the mesh is read and partitioned and the cache is written. The
+    default is an empty prefix, which disables caching.)"; }
+  struct expect {
+    using type = std::string;
+    static std::string description() { return "string"; }
+  };
+};
+using mesh_cache =
+  keyword< mesh_cache_info, TAOCPP_PEGTL_STRING("mesh_cache") >;
+
+struct part_field_info {
+  static std::string name() { return "partition field"; }
+  static std::string shortDescription() { return
+    "Read the mesh partition from an element variable of the mesh file"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to name the element variable of the ExodusII mesh
+    file that stores the compute node of each mesh cell, e.g., "part_field
+    node". If given, each compute node reads exactly the cells assigned to it
+    and the mesh is neither partitioned nor distributed across compute nodes:
+    the mesh of each compute node is only split into its chares locally, the
+    same way as with 'hierarchical true'. The variable is read at the last
+    time step in the file and must assign all cells to compute nodes in the
+    range [0, N), where N is the number of compute nodes the code is run on.
+    An Omega_h mesh file is always read by its own partitions, so this
+    keyword only causes the partitioning across compute nodes to be skipped.
+    The default is empty, i.e., the mesh is partitioned after reading.)"; }
+  struct expect {
+    using type = std::string;
+    static std::string description() { return "string"; }
+  };
+};
+using part_field =
+  keyword< part_field_info, TAOCPP_PEGTL_STRING("part_field") >;
+
+struct reduced_ghost_info {
+  static std::string name() { return "reduced-precision DG ghost data"; }
+  static std::string shortDescription() { return
+    "Send high-order modes of DG ghost data in single precision"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select whether the DG schemes send the
+    high-order modes of the solution and the primitive quantities of ghost
+    elements to neighbor chares in single precision, as "reduced_ghost true"
+    (or false). The cell averages, used by the limiters and determining
+    conservation, are always sent in double precision. With P2 (ten degrees
+    of freedom) this almost halves the ghost data communicated. The default is
+    false.)"; }
+  struct expect {
+    using type = bool;
+    static std::string choices() { return "true | false"; }
+    static std::string description() { return "string"; }
+  };
+};
+using reduced_ghost =
+  keyword< reduced_ghost_info, TAOCPP_PEGTL_STRING("reduced_ghost") >;
+
+struct reduced_halo_info {
+  static std::string name() { return "reduced-precision node halo data"; }
+  static std::string shortDescription() { return
+    "Send chare-boundary node contributions in single precision"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select whether the node-centered schemes send
+    the partial contributions to the gradients and the right hand side at
+    mesh nodes shared by chares in single precision, as "reduced_halo true"
+    (or false). Contributions are rounded before they are sent and are added
+    in double precision on receipt. The largest rounding error of the data
+    sent is reported with the communication statistics, which allows
+    comparing with the magnitude of the solution increments, e.g., before
+    using this in network-bandwidth bound configurations. The default is
+    false.)"; }
+  struct expect {
+    using type = bool;
+    static std::string choices() { return "true | false"; }
+    static std::string description() { return "string"; }
+  };
+};
+using reduced_halo =
+  keyword< reduced_halo_info, TAOCPP_PEGTL_STRING("reduced_halo") >;
+
+struct cost_lb_info {
+  static std::string name() { return "measurement-driven load balancing"; }
+  static std::string shortDescription() { return
+    "Balance load by solver-measured costs instead of Charm++ strategies"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select the load balancing strategy used during
+    time stepping, as "cost_lb true" (or false). If true, when load balancing
+    is due, instead of handing over to the Charm++ load balancer selected on
+    the command line, the chares report their costs measured by the solver,
+    i.e., the time spent computing right hand sides and transferring the
+    solution after mesh refinement, the size of their data, and their
+    communication graph, based on which chares are moved off the most loaded
+    PEs if the reduction in the makespan is worth more than migrating them,
+    see also the keyword 'migration_cost'. The default is false.)"; }
+  struct expect {
+    using type = bool;
+    static std::string choices() { return "true | false"; }
+    static std::string description() { return "string"; }
+  };
+};
+using cost_lb = keyword< cost_lb_info, TAOCPP_PEGTL_STRING("cost_lb") >;
+
+struct migration_cost_info {
+  static std::string name() { return "migration cost"; }
+  static std::string shortDescription() { return
+    "Configure the cost of migrating data for load balancing"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to set the cost, in seconds per byte, of migrating
+    the data of a chare, weighed against the reduction in the time spent by
+    the most loaded PE, when load balancing with 'cost_lb true'. The default
+    is 1.0e-9, i.e., a migration bandwidth of 1 GB/s. Example:
+    "migration_cost 1.0e-8".)"; }
+  struct expect {
+    using type = tk::real;
+    static constexpr type lower = 0.0;
+    static std::string description() { return "real"; }
+  };
+};
+using migration_cost =
+  keyword< migration_cost_info, TAOCPP_PEGTL_STRING("migration_cost") >;
+
+struct auto_virtualization_info {
+  static std::string name() { return "auto-tuned virtualization"; }
+  static std::string shortDescription() { return
+    "Choose the degree of virtualization by modeling the time step"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to enable auto-tuning the degree of
+    virtualization, i.e., the number of chares the mesh is partitioned into,
+    as "auto_virtualization true" (or false). If true, the virtualization given
+    on the command line is ignored and the number of chares is chosen to
+    minimize the modeled time of a time step, given the cost of computing an
+    element and the latency and overhead of messages, see the keywords
+    'elem_cost', 'msg_latency', and 'msg_overhead'. Over-decomposition pays if
+    the latency is large compared to the work of a PE between two
+    communication phases of the time step, which it can then hide. The default
+    is false.)"; }
+  struct expect {
+    using type = bool;
+    static std::string choices() { return "true | false"; }
+    static std::string description() { return "string"; }
+  };
+};
+using auto_virtualization = keyword< auto_virtualization_info,
+  TAOCPP_PEGTL_STRING("auto_virtualization") >;
+
+struct elem_cost_info {
+  static std::string name() { return "element cost"; }
+  static std::string shortDescription() { return
+    "Configure the time of computing a mesh element for auto-tuning"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to set the time, in seconds, of computing a time
+    step for a single mesh element, used to auto-tune the degree of
+    virtualization with 'auto_virtualization true'. It can be measured, e.g.,
+    as the right hand side time per element reported by a previous run. The
+    default is 1.0e-6. Example: "elem_cost 2.0e-6".)"; }
+  struct expect {
+    using type = tk::real;
+    static constexpr type lower = 0.0;
+    static std::string description() { return "real"; }
+  };
+};
+using elem_cost = keyword< elem_cost_info, TAOCPP_PEGTL_STRING("elem_cost") >;
+
+struct msg_latency_info {
+  static std::string name() { return "message latency"; }
+  static std::string shortDescription() { return
+    "Configure the message latency for auto-tuning"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to set the latency, in seconds, of a message
+    between chares, used to auto-tune the degree of virtualization with
+    'auto_virtualization true'. The default is 2.0e-5. Example:
+    "msg_latency 5.0e-6".)"; }
+  struct expect {
+    using type = tk::real;
+    static constexpr type lower = 0.0;
+    static std::string description() { return "real"; }
+  };
+};
+using msg_latency =
+  keyword< msg_latency_info, TAOCPP_PEGTL_STRING("msg_latency") >;
+
+struct msg_overhead_info {
+  static std::string name() { return "message overhead"; }
+  static std::string shortDescription() { return
+    "Configure the message overhead for auto-tuning"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to set the time, in seconds, a PE spends on
+    sending or receiving a message, used to auto-tune the degree of
+    virtualization with 'auto_virtualization true'. The default is 1.0e-6.
+    Example: "msg_overhead 2.0e-6".)"; }
+  struct expect {
+    using type = tk::real;
+    static constexpr type lower = 0.0;
+    static std::string description() { return "real"; }
+  };
+};
+using msg_overhead =
+  keyword< msg_overhead_info, TAOCPP_PEGTL_STRING("msg_overhead") >;
+
+struct msg_priority_info {
+  static std::string name() { return "message priorities"; }
+  static std::string shortDescription() { return
+    "Prioritize halo exchanges over output and bookkeeping messages"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select whether messages between chares are
+    sent with Charm++ priorities per kind of message, as "msg_priority true"
+    (or false). Halo exchanges of the current stage, e.g., right hand sides,
+    gradients, and DG ghost data, are then delivered first, while mesh
+    refinement bookkeeping and mesh and field output yield to all other
+    messages, so a PE busy with output does not delay the halo data its
+    neighbors wait for. The default is false.)"; }
+  struct expect {
+    using type = bool;
+    static std::string choices() { return "true | false"; }
+    static std::string description() { return "string"; }
+  };
+};
+using msg_priority =
+  keyword< msg_priority_info, TAOCPP_PEGTL_STRING("msg_priority") >;
+
 struct partitioning_info {
   static std::string name() { return "partitioning"; }
   static std::string shortDescription() { return
@@ -5604,7 +7382,19 @@ struct partitioning_info {
     R"(This keyword is used to introduce a partitioning ... end block, used to
     specify the configuration for mesh partitioning. Keywords allowed
     in a partitioning ... end block: )" + std::string("\'")
-    + algorithm::string() + "\'.";
+    + algorithm::string() + "\' | \'"
+    + bface_weight::string() + "\' | \'"
+    + hierarchical::string() + "\' | \'"
+    + graph_map::string() + "\' | \'"
+    + dist_chunk::string() + "\' | \'"
+    + mesh_cache::string() + "\' | \'"
+    + cost_lb::string() + "\' | \'"
+    + migration_cost::string() + "\' | \'"
+    + auto_virtualization::string() + "\' | \'"
+    + elem_cost::string() + "\' | \'"
+    + msg_latency::string() + "\' | \'"
+    + msg_overhead::string() + "\' | \'"
+    + msg_priority::string() + "\'.";
   }
 };
 using partitioning = keyword< partitioning_info, TAOCPP_PEGTL_STRING("partitioning") >;
@@ -6013,6 +7803,98 @@ struct amr_tolderef_info {
 using amr_tolderef =
   keyword< amr_tolderef_info, TAOCPP_PEGTL_STRING("tol_derefine") >;
 
+struct amr_lbimbalance_info {
+  static std::string name() { return "load imbalance threshold"; }
+  static std::string shortDescription() { return
+    "Configure load imbalance threshold triggering load balancing after AMR"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to set the threshold on the load imbalance, the
+    ratio of the maximum to the mean number of mesh cells per chare, above
+    which load balancing is performed right after a mesh refinement step
+    during time stepping, instead of waiting for the next load balancing step
+    configured by the load balancing frequency. The default is zero, which
+    disables load balancing triggered by mesh refinement.)"; }
+  struct expect {
+    using type = tk::real;
+    static constexpr type lower = 0.0;
+    static std::string description() { return "real"; }
+  };
+};
+using amr_lbimbalance =
+  keyword< amr_lbimbalance_info, TAOCPP_PEGTL_STRING("lb_imbalance") >;
+
+struct amr_buffer_info {
+  static std::string name() { return "refinement buffer layers"; }
+  static std::string shortDescription() { return
+    "Configure number of edge layers of buffer zones ahead of refinement"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to set the number of layers of edges by which the
+    region tagged for refinement by the error indicator during time stepping is
+    extended into a buffer zone. The buffer is grown along the direction of
+    the flow velocity, where the solution carries one, so that features
+    propagating with the flow remain in refined cells for a number of time
+    steps, allowing mesh refinement to be performed less frequently (see also
+    the keyword dtfreq). For systems without a velocity, e.g., scalar
+    transport, the buffer zone is grown isotropically. The default is zero,
+    i.e., no buffer zone.)"; }
+  struct expect {
+    using type = std::size_t;
+    static constexpr type lower = 0;
+    static std::string description() { return "uint"; }
+  };
+};
+using amr_buffer =
+  keyword< amr_buffer_info, TAOCPP_PEGTL_STRING("buffer") >;
+
+struct amr_qdcorr_info {
+  static std::string name() { return "Neighbor-only AMR correction"; }
+  static std::string shortDescription() { return
+    "Converge chare-boundary mesh refinement correction among neighbors only"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select how the refinement tags of edges shared
+    by multiple chares are made consistent, yielding a conforming mesh across
+    chare boundaries. By default (false), each iteration of the correction
+    algorithm ends with global reductions deciding whether another iteration
+    is needed. If true, chares only exchange messages with their neighbors,
+    each chare resending its edge tags whenever they change, and convergence
+    is detected by quiescence detection, followed by a single global check.
+    If quiescence detection is used to catch logic errors (see the command
+    line argument -q), global reductions are used regardless.)";
+  }
+  struct expect {
+    using type = bool;
+    static std::string choices() { return "true | false"; }
+    static std::string description() { return "string"; }
+  };
+};
+using amr_qdcorr =
+  keyword< amr_qdcorr_info, TAOCPP_PEGTL_STRING("qd_correction") >;
+
+struct amr_t0ref_weight_info {
+  static std::string name() { return "Refinement-aware partitioning"; }
+  static std::string shortDescription() { return
+    "Weight the initial mesh partition by the predicted initial refinement"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to balance the initial mesh partition in the
+    number of elements after initial (t<0) mesh refinement instead of before
+    it. If true, the number of elements each mesh cell will be refined into
+    is predicted on the coarse mesh before partitioning and used as its
+    partitioning weight, multiplying the boundary face weight, if any. The
+    prediction evaluates the uniform, coordinate-based, and edge-list
+    refinement steps on the coarse mesh, ignoring the refinement needed to
+    keep the mesh conforming. Refinement based on the initial conditions is
+    not predicted, as it requires the solution and its error estimate.
+    Ignored if t0ref is false.)";
+  }
+  struct expect {
+    using type = bool;
+    static std::string choices() { return "true | false"; }
+    static std::string description() { return "string"; }
+  };
+};
+using amr_t0ref_weight =
+  keyword< amr_t0ref_weight_info, TAOCPP_PEGTL_STRING("t0ref_weight") >;
+
 struct amr_info {
   static std::string name() { return "AMR"; }
   static std::string shortDescription() { return
@@ -6029,6 +7911,10 @@ struct amr_info {
     + amr_refvar::string() + "\' | \'"
     + amr_tolref::string() + "\' | \'"
     + amr_tolderef::string() + "\' | \'"
+    + amr_lbimbalance::string() + "\' | \'"
+    + amr_buffer::string() + "\' | \'"
+    + amr_qdcorr::string() + "\' | \'"
+    + amr_t0ref_weight::string() + "\' | \'"
     + amr_error::string() + "\' | \'"
     + amr_coordref::string() + "\' | \'"
     + amr_edgelist::string() + "\'.";
@@ -6122,6 +8008,29 @@ struct pref_tolref_info {
 };
 using pref_tolref = keyword< pref_tolref_info, TAOCPP_PEGTL_STRING("tolref") >;
 
+struct pref_dtfreq_info {
+  static std::string name() { return "p-refinement frequency"; }
+  static std::string shortDescription() { return
+    "Set the frequency of p-refinement during time stepping"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to configure the frequency of evaluating the
+    p-refinement indicator and adapting the number of degrees of freedom
+    during time stepping. The keyword must be used in pref ... end block. The
+    default is 1, which means that p-refinement is performed every time step.
+    Example specification: 'dtfreq 5'.)"; }
+  struct expect {
+    using type = std::size_t;
+    static constexpr type lower = 1;
+    static constexpr type upper = std::numeric_limits< type >::max();
+    static std::string description() { return "int"; }
+    static std::string choices() {
+      return "integer between [" + std::to_string(lower) + "..." +
+             std::to_string(upper) + "] (both inclusive)";
+    }
+  };
+};
+using pref_dtfreq = keyword< pref_dtfreq_info, TAOCPP_PEGTL_STRING("dtfreq") >;
+
 struct pref_info {
   static std::string name() { return "pref"; }
   static std::string shortDescription() { return
@@ -6132,7 +8041,8 @@ struct pref_info {
     in this block: )" + std::string("\'")
     + pref_indicator::string() + "\' | \'"
     + pref_ndofmax::string() + "\' | \'"
-    + pref_tolref::string() + "\' | \'";
+    + pref_tolref::string() + "\' | \'"
+    + pref_dtfreq::string() + "\'";
   }
 };
 using pref = keyword< pref_info, TAOCPP_PEGTL_STRING("pref") >;
@@ -6440,6 +8350,29 @@ struct fctclip_info {
 };
 using fctclip = keyword< fctclip_info, TAOCPP_PEGTL_STRING("fctclip") >;
 
+struct fctedge_info {
+  static std::string name() { return "Edge-based FCT mass diffusion"; }
+  static std::string shortDescription() { return
+    "Assemble the FCT mass diffusion over mesh edges"; }
+  static std::string longDescription() { return
+    R"(This keyword can be used to turn on/off assembling the mass diffusion
+    term of the low order system of flux-corrected transport (FCT) over the
+    edges of the mesh instead of over its elements. The difference of the
+    lumped and the consistent mass matrix of a tetrahedron only couples the
+    two end-points of each of its edges by the same weight, so the weights of
+    the edges, summed over the elements sharing an edge, are computed once
+    per mesh and each time step only loops over the edges, without computing
+    the element Jacobians and gathering the solution at the four nodes of
+    every element. The result equals that of the element-based assembly up
+    to round-off. Only used with the diagcg scheme.)"; }
+  struct expect {
+    using type = bool;
+    static std::string description() { return "string"; }
+    static std::string choices() { return "true | false"; }
+  };
+};
+using fctedge = keyword< fctedge_info, TAOCPP_PEGTL_STRING("fctedge") >;
+
 struct sysfct_info {
   static std::string name() { return "Flux-corrected transport for systems"; }
   static std::string shortDescription() { return
@@ -19,6 +19,8 @@
   #include "Options/MKLUniformMethod.hpp"
 #endif
 
+#include "Options/GaussianTransform.hpp"
+
 namespace tk {
 //! Toolkit, grammar definition for Intel's Math Kernel Library
 namespace mkl {
@@ -100,6 +102,16 @@ namespace mkl {
                           tag::gamma_method,
                           sel, vec, tags... > {};
 
+  //! \brief Match and set MKL RNG Gaussian transform
+  template< template< class > class use, typename sel,
+            typename vec, typename... tags >
+  struct gaussian_transform :
+         grm::rng_option< use,
+                          use< kw::gaussian_transform >,
+                          ctr::GaussianTransform,
+                          tag::gaussian_transform,
+                          sel, vec, tags... > {};
+
   //! \brief Match MKL RNGs in an rngs ... end block
   //! \see walker::deck::rngs
   template< template< class > class use, typename sel,
@@ -116,7 +128,8 @@ namespace mkl {
                            gaussian_method< use, sel, vec, tags... >,
                            gaussianmv_method< use, sel, vec, tags... >,
                            beta_method< use, sel, vec, tags... >,
-                           gamma_method< use, sel, vec, tags... > > >
+                           gamma_method< use, sel, vec, tags... >,
+                           gaussian_transform< use, sel, vec, tags... > > >
   {};
 
 } // mkl::
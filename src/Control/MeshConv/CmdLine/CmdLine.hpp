@@ -33,6 +33,7 @@ using CmdLineMembers = brigand::list<
   , tag::verbose,    bool
   , tag::chare,      bool
   , tag::reorder,    bool
+  , tag::stream,     bool
   , tag::help,       bool
   , tag::quiescence, bool
   , tag::trace,      bool
@@ -62,6 +63,7 @@ class CmdLine : public tk::TaggedTuple< CmdLineMembers > {
                                      , kw::output
                                      , kw::screen
                                      , kw::reorder_cmd
+                                     , kw::stream_cmd
                                      , kw::quiescence
                                      , kw::trace
                                      , kw::version
@@ -86,6 +88,7 @@ class CmdLine : public tk::TaggedTuple< CmdLineMembers > {
       get< tag::verbose >() = false; // Use quiet output by default
       get< tag::chare >() = false; // No chare state output by default
       get< tag::reorder >() = false; // Do not reorder by default
+      get< tag::stream >() = false; // Convert in memory by default
       get< tag::trace >() = true; // Output call and stack trace by default
       get< tag::version >() = false; // Do not display version info by default
       get< tag::license >() = false; // Do not display license info by default
@@ -44,6 +44,10 @@ namespace cmd {
   struct reorder :
          tk::grm::process_cmd_switch< use, kw::reorder_cmd, tag::reorder > {};
 
+  //! brief Match and set stream switch (i.e., convert mesh in chunks or not)
+  struct stream :
+         tk::grm::process_cmd_switch< use, kw::stream_cmd, tag::stream > {};
+
   //! \brief Match and set io parameter
   template< typename keyword, typename io_tag >
   struct io :
@@ -88,6 +92,7 @@ namespace cmd {
          pegtl::sor< verbose,
                      charestate,
                      reorder,
+                     stream,
                      help,
                      helpkw,
                      quiescence,
@@ -0,0 +1,128 @@
+// *****************************************************************************
+/*!
+  \file      src/Control/MicroBench/CmdLine/CmdLine.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     MicroBench's command line definition
+  \details   This file defines the heterogeneous stack that is used for storing
+     the data from user input during the command-line parsing of the
+     microbenchmark suite, MicroBench.
+*/
+// *****************************************************************************
+#ifndef MicroBenchCmdLine_h
+#define MicroBenchCmdLine_h
+
+#include <string>
+
+#include <brigand/algorithms/for_each.hpp>
+
+#include "Macro.hpp"
+#include "Keywords.hpp"
+#include "HelpFactory.hpp"
+#include "MicroBench/Types.hpp"
+
+namespace microbench {
+//! Microbenchmark suite control facilitating user input to internal data
+//! transfer
+namespace ctr {
+
+//! Member data for tagged tuple
+using CmdLineMembers = brigand::list<
+    tag::io,         ios
+  , tag::verbose,    bool
+  , tag::chare,      bool
+  , tag::filter,     kw::filter_cmd::info::expect::type
+  , tag::mintime,    kw::mintime_cmd::info::expect::type
+  , tag::boxsize,    kw::boxsize_cmd::info::expect::type
+  , tag::help,       bool
+  , tag::quiescence, bool
+  , tag::trace,      bool
+  , tag::version,    bool
+  , tag::license,    bool
+  , tag::cmdinfo,    tk::ctr::HelpFactory
+  , tag::ctrinfo,    tk::ctr::HelpFactory
+  , tag::helpkw,     tk::ctr::HelpKw
+  , tag::error,      std::vector< std::string >
+>;
+
+//! \brief CmdLine is a TaggedTuple specialized to MicroBench
+//! \details The stack is a tagged tuple, a hierarchical heterogeneous data
+//!    structure where all parsed information is stored.
+//! \see Base/TaggedTuple.h
+//! \see Control/MicroBench/Types.h
+class CmdLine : public tk::TaggedTuple< CmdLineMembers > {
+
+  public:
+    //! \brief MicroBench command-line keywords
+    //! \see tk::grm::use and its documentation
+    using keywords = tk::cmd_keywords< kw::verbose
+                                     , kw::charestate
+                                     , kw::help
+                                     , kw::helpkw
+                                     , kw::screen
+                                     , kw::json_cmd
+                                     , kw::filter_cmd
+                                     , kw::mintime_cmd
+                                     , kw::boxsize_cmd
+                                     , kw::quiescence
+                                     , kw::trace
+                                     , kw::version
+                                     , kw::license
+                                     >;
+
+    //! Set of tags to ignore when printing this CmdLine
+    using ignore =
+      brigand::set< tag::cmdinfo
+                  , tag::ctrinfo
+                  , tag::helpkw >;
+
+    //! \brief Constructor: set defaults.
+    //! \details Anything not set here is initialized by the compiler using the
+    //!   default constructor for the corresponding type. While there is a
+    //!   ctrinfo parameter, it is unused here, since microbench does not have a
+    //!   control file parser.
+    //! \see walker::ctr::CmdLine
+    CmdLine() {
+      get< tag::io, tag::screen >() =
+        tk::baselogname( tk::microbench_executable() );
+      get< tag::verbose >() = false; // Use quiet output by default
+      get< tag::chare >() = false; // No chare state output by default
+      get< tag::io, tag::json >() = "microbench.json";
+      get< tag::mintime >() = 200; // Milliseconds spent in each benchmark
+      get< tag::boxsize >() = 24; // 24^3 cubes, 6 tetrahedra each
+      get< tag::trace >() = true; // Output call and stack trace by default
+      get< tag::version >() = false; // Do not display version info by default
+      get< tag::license >() = false; // Do not display license info by default
+      // Initialize help: fill from own keywords
+      brigand::for_each< keywords::set >( tk::ctr::Info(get<tag::cmdinfo>()) );
+    }
+
+    /** @name Pack/Unpack: Serialize CmdLine object for Charm++ */
+    ///@{
+    //! \brief Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    void pup( PUP::er& p ) { tk::TaggedTuple< CmdLineMembers >::pup(p); }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] c CmdLine object reference
+    friend void operator|( PUP::er& p, CmdLine& c ) { c.pup(p); }
+    //@}
+
+    //! Compute and return log file name
+    //! \param[in] def Default log file name (so we don't mess with user's)
+    //! \param[in] nrestart Number of times restarted
+    //! \return Log file name
+    std::string logname( const std::string& def, int nrestart ) const {
+      if (get< tag::io, tag::screen >() != def)
+        return get< tag::io, tag::screen >();
+      else
+        return tk::logname( tk::microbench_executable(), nrestart );
+    }
+};
+
+} // ctr::
+} // microbench::
+
+#endif // MicroBenchCmdLine_h
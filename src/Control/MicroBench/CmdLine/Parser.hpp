@@ -0,0 +1,38 @@
+// *****************************************************************************
+/*!
+  \file      src/Control/MicroBench/CmdLine/Parser.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     MicroBench's command line parser
+  \details   This file declares the command-line argument parser for the mesh
+     microbenchmark suite, MicroBench.
+*/
+// *****************************************************************************
+#ifndef MicroBenchCmdLineParser_h
+#define MicroBenchCmdLineParser_h
+
+#include "StringParser.hpp"
+#include "MicroBench/CmdLine/CmdLine.hpp"
+
+namespace tk { class Print; }
+
+namespace microbench {
+
+//! \brief Command-line parser for MicroBench.
+//! \details This class is used to interface with PEGTL, for the purpose of
+//!   parsing command-line arguments for the microbenchmark suite, MicroBench.
+class CmdLineParser : public tk::StringParser {
+
+  public:
+    //! Constructor
+    explicit CmdLineParser( int argc,
+                            char** argv,
+                            const tk::Print& print,
+                            ctr::CmdLine& cmdline );
+};
+
+} // microbench::
+
+#endif // MicroBenchCmdLineParser_h
@@ -0,0 +1,40 @@
+// *****************************************************************************
+/*!
+  \file      src/Control/MicroBench/Types.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Types for MicroBench's parsers
+  \details   Types for MicroBench's parsers. This file defines the components of
+    the tagged tuple that stores heterogeneous objects in a hierarchical way.
+    These components are therefore part of the grammar stack that is filled
+    during command-line argument parsing.
+*/
+// *****************************************************************************
+#ifndef MicroBenchTypes_h
+#define MicroBenchTypes_h
+
+#include "TaggedTuple.hpp"
+#include "Tags.hpp"
+#include "Keyword.hpp"
+
+namespace microbench {
+namespace ctr {
+
+using namespace tao;
+
+//! IO parameters storage
+using ios = tk::TaggedTuple< brigand::list<
+    tag::nrestart,  int                             //!< Number of restarts
+  , tag::screen,    kw::screen::info::expect::type  //!< Screen output filename
+  , tag::json,      kw::json_cmd::info::expect::type  //!< JSON output filename
+> >;
+
+//! PEGTL location/position type to use throughout all of MicroBench's parsers
+using Location = pegtl::position;
+
+} // ctr::
+} // microbench::
+
+#endif // MicroBenchTypes_h
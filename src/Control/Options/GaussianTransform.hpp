@@ -0,0 +1,61 @@
+// *****************************************************************************
+/*!
+  \file      src/Control/Options/GaussianTransform.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Gaussian transform options
+  \details   Gaussian transform options
+*/
+// *****************************************************************************
+#ifndef GaussianTransformOptions_h
+#define GaussianTransformOptions_h
+
+#include <brigand/sequences/list.hpp>
+
+#include "Toggle.hpp"
+#include "Keywords.hpp"
+#include "PUPUtil.hpp"
+
+namespace tk {
+namespace ctr {
+
+//! Gaussian transform options
+enum class GaussianTransformType : uint8_t { LIBRARY,
+                                             ZIGGURAT };
+
+//! \brief Pack/Unpack GaussianTransformType: forward overload to generic enum
+//!   class packer
+inline void operator|( PUP::er& p, GaussianTransformType& e )
+{ PUP::pup( p, e ); }
+
+//! \brief GaussianTransform options: outsource searches to base templated on
+//!   enum type
+class GaussianTransform : public tk::Toggle< GaussianTransformType > {
+
+  public:
+    //! Valid expected choices to make them also available at compile-time
+    using keywords = brigand::list< kw::gauss_library
+                                  , kw::ziggurat
+                                  >;
+
+    //! \brief Options constructor
+    //! \details Simply initialize in-line and pass associations to base, which
+    //!    will handle client interactions
+    explicit GaussianTransform() :
+      tk::Toggle< GaussianTransformType >(
+        //! Group, i.e., options, name
+        "Gaussian transform",
+        //! Enums -> names
+        { { GaussianTransformType::LIBRARY, kw::gauss_library::name() },
+          { GaussianTransformType::ZIGGURAT, kw::ziggurat::name() } },
+        //! keywords -> Enums
+        { { kw::gauss_library::string(), GaussianTransformType::LIBRARY },
+          { kw::ziggurat::string(), GaussianTransformType::ZIGGURAT } } ) {}
+};
+
+} // ctr::
+} // tk::
+
+#endif // GaussianTransformOptions_h
@@ -25,7 +25,8 @@ namespace ctr {
 enum class PDFFileType : uint8_t { TXT=0,
                                    GMSHTXT,
                                    GMSHBIN,
-                                   EXODUSII };
+                                   EXODUSII,
+                                   BINARY };
 
 //! \brief Pack/Unpack PDFFileType: forward overload to generic enum class
 //!   packer
@@ -41,6 +42,7 @@ class PDFFile : public tk::Toggle< PDFFileType > {
                                   , kw::gmshtxt
                                   , kw::gmshbin
                                   , kw::exodusii
+                                  , kw::binary
                                   >;
 
     //! \brief Options constructor
@@ -54,12 +56,14 @@ class PDFFile : public tk::Toggle< PDFFileType > {
         { { PDFFileType::TXT, kw::txt::name() },
           { PDFFileType::GMSHTXT, kw::gmshtxt::name() },
           { PDFFileType::GMSHBIN, kw::gmshbin::name() },
-          { PDFFileType::EXODUSII, kw::exodusii::name() } },
+          { PDFFileType::EXODUSII, kw::exodusii::name() },
+          { PDFFileType::BINARY, kw::binary::name() } },
         //! keywords -> Enums
         { { kw::txt::string(), PDFFileType::TXT },
           { kw::gmshtxt::string(), PDFFileType::GMSHTXT },
           { kw::gmshbin::string(), PDFFileType::GMSHBIN },
-          { kw::exodusii::string(), PDFFileType::EXODUSII } } ) {}
+          { kw::exodusii::string(), PDFFileType::EXODUSII },
+          { kw::binary::string(), PDFFileType::BINARY } } ) {}
 };
 
 } // ctr::
@@ -28,7 +28,9 @@ enum class PartitioningAlgorithmType : uint8_t { RCB,
                                                  RIB,
                                                  HSFC,
                                                  MJ,
-                                                 PHG };
+                                                 PHG,
+                                                 SFC,
+                                                 PARMETIS };
 
 //! \brief Pack/Unpack PartitioningAlgorithmType: forward overload to generic
 //!   enum class packer
@@ -48,6 +50,8 @@ class PartitioningAlgorithm : public tk::Toggle< PartitioningAlgorithmType > {
                                   , kw::hsfc
                                   , kw::mj
                                   , kw::phg
+                                  , kw::sfc
+                                  , kw::parmetis
                                   >;
 
     //! \brief Options constructor
@@ -62,13 +66,18 @@ class PartitioningAlgorithm : public tk::Toggle< PartitioningAlgorithmType > {
           { PartitioningAlgorithmType::RIB, kw::rib::name() },
           { PartitioningAlgorithmType::HSFC, kw::hsfc::name() },
           { PartitioningAlgorithmType::MJ, kw::mj::name() },
-          { PartitioningAlgorithmType::PHG, kw::phg::name() } },
+          { PartitioningAlgorithmType::PHG, kw::phg::name() },
+          { PartitioningAlgorithmType::SFC, kw::sfc::name() },
+          { PartitioningAlgorithmType::PARMETIS, kw::parmetis::name() } },
         //! keywords -> Enums
         { { kw::rcb::string(), PartitioningAlgorithmType::RCB },
           { kw::rib::string(), PartitioningAlgorithmType::RIB },
           { kw::hsfc::string(), PartitioningAlgorithmType::HSFC },
           { kw::mj::string(), PartitioningAlgorithmType::MJ },
-          { kw::phg::string(), PartitioningAlgorithmType::PHG } } ) {}
+          { kw::phg::string(), PartitioningAlgorithmType::PHG },
+          { kw::sfc::string(), PartitioningAlgorithmType::SFC },
+          { kw::parmetis::string(), PartitioningAlgorithmType::PARMETIS } } )
+    {}
 
     //! \brief Return parameter based on Enum
     //! \details Here 'parameter' is the library-specific identifier of the
@@ -91,20 +100,23 @@ class PartitioningAlgorithm : public tk::Toggle< PartitioningAlgorithmType > {
       if ( m == PartitioningAlgorithmType::RCB ||
            m == PartitioningAlgorithmType::RIB ||
            m == PartitioningAlgorithmType::HSFC ||
-           m == PartitioningAlgorithmType::MJ )
+           m == PartitioningAlgorithmType::MJ ||
+           m == PartitioningAlgorithmType::SFC )
         return true;
       else
        return false;
     }
 
   private:
-    //! Enums -> Zoltan partitioning algorithm parameters
+    //! \brief Enums -> Zoltan partitioning algorithm parameters
+    //! \details SFC is not a Zoltan partitioner, see tk::SFCSplitter.
     std::map< PartitioningAlgorithmType, ParamType > method {
       { PartitioningAlgorithmType::RCB, "rcb" },
       { PartitioningAlgorithmType::RIB, "rib" },
       { PartitioningAlgorithmType::HSFC, "hsfc" },
       { PartitioningAlgorithmType::MJ, "multijagged" },
-      { PartitioningAlgorithmType::PHG, "phg" }
+      { PartitioningAlgorithmType::PHG, "phg" },
+      { PartitioningAlgorithmType::PARMETIS, "parmetis" }
     };
 };
 
@@ -0,0 +1,60 @@
+// *****************************************************************************
+/*!
+  \file      src/Control/Options/StatFile.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Statistics output file type options
+  \details   Statistics output file type options
+*/
+// *****************************************************************************
+#ifndef StatFileOptions_h
+#define StatFileOptions_h
+
+#include <brigand/sequences/list.hpp>
+
+#include "Toggle.hpp"
+#include "Keywords.hpp"
+#include "PUPUtil.hpp"
+
+namespace tk {
+namespace ctr {
+
+//! Statistics output file types
+enum class StatFileType : uint8_t { TXT=0,
+                                    BINARY };
+
+//! \brief Pack/Unpack StatFileType: forward overload to generic enum class
+//!   packer
+inline void operator|( PUP::er& p, StatFileType& e ) { PUP::pup( p, e ); }
+
+//! \brief StatFileType options: outsource searches to base templated on enum
+//!   type
+class StatFile : public tk::Toggle< StatFileType > {
+
+  public:
+    //! Valid expected choices to make them also available at compile-time
+    using keywords = brigand::list< kw::txt
+                                  , kw::binary
+                                  >;
+
+    //! \brief Options constructor
+    //! \details Simply initialize in-line and pass associations to base, which
+    //!    will handle client interactions
+    explicit StatFile() :
+      tk::Toggle< StatFileType >(
+        //! Group, i.e., options, name 
+        "Statistics output file type",
+        //! Enums -> names
+        { { StatFileType::TXT, kw::txt::name() },
+          { StatFileType::BINARY, kw::binary::name() } },
+        //! keywords -> Enums
+        { { kw::txt::string(), StatFileType::TXT },
+          { kw::binary::string(), StatFileType::BINARY } } ) {}
+};
+
+} // ctr::
+} // tk:::
+
+#endif // StatFileOptions_h
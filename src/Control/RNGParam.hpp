@@ -16,6 +16,7 @@
 #include "Tags.hpp"
 #include "Options/RNG.hpp"
 #include "Options/RNGSSESeqLen.hpp"
+#include "Options/GaussianTransform.hpp"
 #include "QuinoaConfig.hpp"
 
 #ifdef HAS_MKL
@@ -33,6 +34,8 @@ namespace ctr {
 using RNGSSEParam = tk::TaggedTuple< brigand::list<
    tag::seed,          kw::seed::info::expect::type  //!< seed
  , tag::seqlen,        RNGSSESeqLenType              //!< sequence length type
+   //! Gaussian transform type
+ , tag::gaussian_transform, GaussianTransformType
 > >;
 //! RNGSSE parameters bundle associating RNG types and their parameters
 using RNGSSEParameters = std::map< RNGType, RNGSSEParam >;
@@ -40,6 +43,8 @@ using RNGSSEParameters = std::map< RNGType, RNGSSEParam >;
 //! Random123 random number generator parameters storage
 using RNGRandom123Param = tk::TaggedTuple< brigand::list<
   tag::seed,          kw::seed::info::expect::type   //!< seed
+  //! Gaussian transform type
+, tag::gaussian_transform, GaussianTransformType
 > >;
 //! Random123 parameters bundle associating RNG types and their parameters
 using RNGRandom123Parameters = std::map< RNGType, RNGRandom123Param >;
@@ -54,6 +59,8 @@ using RNGMKLParam = tk::TaggedTuple< brigand::list<
   , tag::gaussianmv_method, MKLGaussianMVMethodType
   , tag::beta_method,       MKLBetaMethodType            //!< beta method type
   , tag::gamma_method,      MKLGammaMethodType           //!< gamma method type
+    //! Gaussian transform type
+  , tag::gaussian_transform, GaussianTransformType
 > >;
 //! MKL RNG parameters bundle associating RNG types and their parameters
 using RNGMKLParameters = std::map< RNGType, RNGMKLParam >;
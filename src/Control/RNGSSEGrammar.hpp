@@ -16,6 +16,7 @@
 #include <brigand/algorithms/for_each.hpp>
 
 #include "CommonGrammar.hpp"
+#include "Options/GaussianTransform.hpp"
 
 namespace tk {
 namespace grm {
@@ -104,6 +105,16 @@ namespace rngsse {
                      tag::seqlen,
                      sel, vec, tags... > {};
 
+  //! \brief Match and set RNGSSE RNG Gaussian transform
+  template< template< class > class use, typename sel,
+            typename vec, typename... tags >
+  struct gaussian_transform :
+         grm::rng_option< use,
+                          use< kw::gaussian_transform >,
+                          ctr::GaussianTransform,
+                          tag::gaussian_transform,
+                          sel, vec, tags... > {};
+
   //! \brief Match RNGSSE RNGs in an rngs ... end block
   //! \see walker::deck::rngs
   template< template< class > class use, typename sel,
@@ -116,7 +127,8 @@ namespace rngsse {
                                                       sel, vec > >,
            tk::grm::block< use< kw::end >,
                            seed< use, sel, vec, tags... >,
-                           seqlen< use, sel, vec, tags... > > > {};
+                           seqlen< use, sel, vec, tags... >,
+                           gaussian_transform< use, sel, vec, tags... > > > {};
 
 } // rngsse::
 } // tk::
@@ -57,6 +57,7 @@ class CmdLine : public tk::TaggedTuple< CmdLineMembers > {
                                      , kw::helpctr
                                      , kw::helpkw
                                      , kw::screen
+                                     , kw::testcost
                                      , kw::quiescence
                                      , kw::trace
                                      , kw::version
@@ -103,6 +104,8 @@ class CmdLine : public tk::TaggedTuple< CmdLineMembers > {
     CmdLine( tk::ctr::HelpFactory ctrinfo = tk::ctr::HelpFactory() ) {
       get< tag::io, tag::screen >() =
         tk::baselogname( tk::rngtest_executable() );
+      get< tag::io, tag::testcost >() =
+        tk::rngtest_executable() + "_testcost.txt";
       get< tag::verbose >() = false; // Use quiet output by default
       get< tag::chare >() = false; // No chare state output by default
       get< tag::trace >() = true; // Output call and stack trace by default
@@ -97,6 +97,7 @@ namespace cmd {
                      version,
                      license,
                      io< kw::screen, tag::screen >,
+                     io< kw::testcost, tag::testcost >,
                      io< kw::control, tag::control > > {};
 
   //! \brief Grammar entry point: parse keywords until end of string
@@ -97,7 +97,7 @@ namespace deck {
                                           tag::selected, tag::rng,
                                           tag::param, tag::rng123 > > {};
 
-  // \brief Match TestU01 batteries
+  // \brief Match TestU01 batteries and the throughput benchmark
   template< typename battery_kw >
   struct testu01 :
          pegtl::if_must<
@@ -113,7 +113,8 @@ namespace deck {
   struct battery :
          pegtl::sor< testu01< use< kw::smallcrush > >,
                      testu01< use< kw::crush > >,
-                     testu01< use< kw::bigcrush > > > {};
+                     testu01< use< kw::bigcrush > >,
+                     testu01< use< kw::benchmark > > > {};
 
   //! \brief All keywords
   struct keywords :
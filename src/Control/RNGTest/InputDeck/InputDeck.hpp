@@ -49,6 +49,7 @@ class InputDeck : public tk::TaggedTuple< InputDeckMembers > {
                                  , kw::smallcrush
                                  , kw::crush
                                  , kw::bigcrush
+                                 , kw::benchmark
                                  , kw::cja
                                  , kw::cja_accurate
                                  #ifdef HAS_RNGSSE2
@@ -88,6 +89,9 @@ class InputDeck : public tk::TaggedTuple< InputDeckMembers > {
                                  , kw::icdf
                                  #endif
                                  , kw::seed
+                                 , kw::gaussian_transform
+                                 , kw::gauss_library
+                                 , kw::ziggurat
                                  , kw::r123_threefry
                                  , kw::r123_philox
                                  , kw::gamma_method
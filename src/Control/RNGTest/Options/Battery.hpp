@@ -25,7 +25,8 @@ namespace ctr {
 enum class BatteryType : uint8_t { NO_BATTERY=0,
                                    SMALLCRUSH,
                                    CRUSH,
-                                   BIGCRUSH };
+                                   BIGCRUSH,
+                                   BENCHMARK };
 
 //! Pack/Unpack BatteryType: forward overload to generic enum class packer
 inline void operator|( PUP::er& p, BatteryType& e ) { PUP::pup( p, e ); }
@@ -38,6 +39,7 @@ class Battery : public tk::Toggle< BatteryType > {
     using keywords = brigand::list< kw::smallcrush
                                   , kw::crush
                                   , kw::bigcrush
+                                  , kw::benchmark
                                   >;
 
     //! \brief Options constructor
@@ -51,12 +53,14 @@ class Battery : public tk::Toggle< BatteryType > {
         { { BatteryType::NO_BATTERY, "n/a" },
           { BatteryType::SMALLCRUSH, kw::smallcrush::name() },
           { BatteryType::CRUSH, kw::crush::name() },
-          { BatteryType::BIGCRUSH, kw::bigcrush::name() } },
+          { BatteryType::BIGCRUSH, kw::bigcrush::name() },
+          { BatteryType::BENCHMARK, kw::benchmark::name() } },
         //! keywords -> Enums
         { { "no_battery", BatteryType::NO_BATTERY },
           { kw::smallcrush::string(), BatteryType::SMALLCRUSH },
           { kw::crush::string(), BatteryType::CRUSH },
-          { kw::bigcrush::string(), BatteryType::BIGCRUSH } } ) {}
+          { kw::bigcrush::string(), BatteryType::BIGCRUSH },
+          { kw::benchmark::string(), BatteryType::BENCHMARK } } ) {}
 };
 
 } // ctr::
@@ -14,6 +14,7 @@
 #define Random123Grammar_h
 
 #include "CommonGrammar.hpp"
+#include "Options/GaussianTransform.hpp"
 
 namespace tk {
 //! Toolkit, grammar definition for the Random123 library
@@ -36,6 +37,16 @@ namespace random123 {
          tk::grm::process< use< kw::seed >,
                            tk::grm::insert_seed< sel, vec, tags... > > {};
 
+  //! \brief Match and set Random123 RNG Gaussian transform
+  template< template< class > class use, typename sel,
+            typename vec, typename... tags >
+  struct gaussian_transform :
+         grm::rng_option< use,
+                          use< kw::gaussian_transform >,
+                          ctr::GaussianTransform,
+                          tag::gaussian_transform,
+                          sel, vec, tags... > {};
+
   //! \brief Match Random123 RNGs in an rngs ... end block
   //! \see walker::deck::rngs
   template< template< class > class use, typename sel,
@@ -47,7 +58,8 @@ namespace random123 {
                                                       ctr::RNG,
                                                       sel, vec > >,
            tk::grm::block< use< kw::end >,
-                           seed< use, sel, vec, tags... > > > {};
+                           seed< use, sel, vec, tags... >,
+                           gaussian_transform< use, sel, vec, tags... > > > {};
 
 } // random123::
 } // tk::
@@ -27,6 +27,7 @@ struct license { static std::string name() { return "license"; } };
 struct input { static std::string name() { return "input"; } };
 struct output { static std::string name() { return "output"; } };
 struct screen { static std::string name() { return "screen"; } };
+struct testcost { static std::string name() { return "testcost"; } };
 struct restart { static std::string name() { return "restart"; } };
 struct nrestart { static std::string name() { return "nrestart"; } };
 struct diag { static std::string name() { return "diag"; } };
@@ -37,6 +38,8 @@ struct uniform_method {
   static std::string name() { return "uniform_method"; } };
 struct gaussian_method {
   static std::string name() { return "gaussian_method"; } };
+struct gaussian_transform {
+  static std::string name() { return "gaussian_transform"; } };
 struct gaussianmv_method {
   static std::string name() { return "gaussianmv_method"; } };
 struct gaussian { static std::string name() { return "gaussian"; } };
@@ -60,16 +63,73 @@ struct benchmark { static std::string name() { return "benchmark"; } };
 struct lboff {};
 struct feedback { static std::string name() { return "feedback"; } };
 struct reorder { static std::string name() { return "reorder"; } };
+struct stream { static std::string name() { return "stream"; } };
+struct ncycle { static std::string name() { return "ncycle"; } };
+struct uniform { static std::string name() { return "uniform"; } };
+struct json { static std::string name() { return "json"; } };
+struct filter { static std::string name() { return "filter"; } };
+struct mintime { static std::string name() { return "mintime"; } };
+struct boxsize { static std::string name() { return "boxsize"; } };
+struct bfaceweight { static std::string name() { return "bfaceweight"; } };
+struct hierarchical {
+  static std::string name() { return "hierarchical"; } };
+struct graphmap { static std::string name() { return "graphmap"; } };
+struct distchunk { static std::string name() { return "distchunk"; } };
+struct meshcache { static std::string name() { return "meshcache"; } };
+struct partfield { static std::string name() { return "partfield"; } };
+struct reducedghost {
+  static std::string name() { return "reducedghost"; } };
+struct reducedhalo { static std::string name() { return "reducedhalo"; } };
+struct costlb { static std::string name() { return "costlb"; } };
+struct migcost { static std::string name() { return "migcost"; } };
+struct autovirt { static std::string name() { return "autovirt"; } };
+struct elemcost { static std::string name() { return "elemcost"; } };
+struct msglatency { static std::string name() { return "msglatency"; } };
+struct msgoverhead { static std::string name() { return "msgoverhead"; } };
+struct msgprio { static std::string name() { return "msgprio"; } };
 struct pelocal_reorder {
   static std::string name() { return "pelocal_reorder"; } };
 struct operator_reorder {
   static std::string name() { return "operator_reorder"; } };
+struct node_reorder {
+  static std::string name() { return "node_reorder"; } };
+struct elem_reorder {
+  static std::string name() { return "elem_reorder"; } };
+struct fused_edgeflux {
+  static std::string name() { return "fused_edgeflux"; } };
 struct steady_state {
   static std::string name() { return "steady_state"; } };
+struct implicit { static std::string name() { return "implicit"; } };
+struct krylov_maxit {
+  static std::string name() { return "krylov_maxit"; } };
+struct krylov_tol { static std::string name() { return "krylov_tol"; } };
+struct laggeddt { static std::string name() { return "laggeddt"; } };
+struct rktol { static std::string name() { return "rktol"; } };
+struct rkstages { static std::string name() { return "rkstages"; } };
+struct dtlevels { static std::string name() { return "dtlevels"; } };
+struct laggeddiag { static std::string name() { return "laggeddiag"; } };
+struct tavg { static std::string name() { return "tavg"; } };
+struct covariance { static std::string name() { return "covariance"; } };
+struct slice { static std::string name() { return "slice"; } };
+struct isosurface { static std::string name() { return "isosurface"; } };
+struct outvar { static std::string name() { return "outvar"; } };
+struct multigrid { static std::string name() { return "multigrid"; } };
+struct mg_levels { static std::string name() { return "mg_levels"; } };
+struct freeze_grad { static std::string name() { return "freeze_grad"; } };
+struct irs_sweeps { static std::string name() { return "irs_sweeps"; } };
+struct irs_eps { static std::string name() { return "irs_eps"; } };
 struct residual { static std::string name() { return "residual"; } };
 struct error { static std::string name() { return "error"; } };
 struct lbfreq { static std::string name() { return "lbfreq"; } };
+struct perffreq { static std::string name() { return "perffreq"; } };
+struct tracebuf { static std::string name() { return "tracebuf"; } };
+struct perfctr { static std::string name() { return "perfctr"; } };
+struct ckptincr { static std::string name() { return "ckptincr"; } };
+struct ckptcompress { static std::string name() { return "ckptcompress"; } };
 struct rsfreq { static std::string name() { return "rsfreq"; } };
+struct memfreq { static std::string name() { return "memfreq"; } };
+struct iobench { static std::string name() { return "iobench"; } };
+struct iofields { static std::string name() { return "iofields"; } };
 struct dtfreq { static std::string name() { return "dtfreq"; } };
 struct pdf { static std::string name() { return "pdf"; } };
 struct ordpdf {};
@@ -77,6 +137,12 @@ struct cenpdf {};
 struct nchare {};
 struct bounds {};
 struct filetype { static std::string name() { return "filetype"; } };
+struct statfile { static std::string name() { return "statfile"; } };
+struct aggregate { static std::string name() { return "aggregate"; } };
+struct asyncwrite { static std::string name() { return "asyncwrite"; } };
+struct persistent { static std::string name() { return "persistent"; } };
+struct compression { static std::string name() { return "compression"; } };
+struct lossytol { static std::string name() { return "lossytol"; } };
 struct pdfpolicy { static std::string name() { return "pdfpolicy"; } };
 struct pdfctr { static std::string name() { return "pdfctr"; } };
 struct pdfnames { static std::string name() { return "pdfnames"; } };
@@ -86,6 +152,9 @@ struct ordinary {};
 struct central {};
 struct binsize { static std::string name() { return "binsize"; } };
 struct extent { static std::string name() { return "extent"; } };
+struct lazy { static std::string name() { return "lazy"; } };
+struct async { static std::string name() { return "async"; } };
+struct pdfsample { static std::string name() { return "pdfsample"; } };
 struct dirichlet { static std::string name() { return "dirichlet"; } };
 struct mixdirichlet { static std::string name() { return "mixdirichlet"; } };
 struct gendir { static std::string name() { return "gendir"; } };
@@ -120,6 +189,11 @@ struct ndofmax { static std::string name() { return "ndofmax"; } };
 struct indicator{ static std::string name() { return "indicator"; } };
 struct amr { static std::string name() { return "amr"; } };
 struct tolderef { static std::string name() { return "tolderef"; } };
+struct lbimbalance {
+  static std::string name() { return "lbimbalance"; } };
+struct buffer { static std::string name() { return "buffer"; } };
+struct qdcorr { static std::string name() { return "qdcorr"; } };
+struct t0refweight { static std::string name() { return "t0refweight"; } };
 struct t0ref { static std::string name() { return "t0ref"; } };
 struct dtref { static std::string name() { return "dtref"; } };
 struct dtref_uniform { static std::string name() { return "dtref_uniform"; } };
@@ -135,17 +209,22 @@ struct dt { static std::string name() { return "dt"; } };
 struct cfl { static std::string name() { return "cfl"; } };
 struct fct { static std::string name() { return "fct"; } };
 struct fctclip { static std::string name() { return "fctclip"; } };
+struct fctedge { static std::string name() { return "fctedge"; } };
 struct sysfct { static std::string name() { return "sysfct"; } };
 struct sysfctvar { static std::string name() { return "sysfctvar"; } };
 struct fcteps { static std::string name() { return "fcteps"; } };
 struct ctau { static std::string name() { return "ctau"; } };
 struct npar { static std::string name() { return "npar"; } };
+struct chunk { static std::string name() { return "chunk"; } };
+struct fuse { static std::string name() { return "fuse"; } };
 struct refined {};
 struct matched {};
 struct compatibility {};
 struct bndint {};
 struct part { static std::string name() { return "part"; } };
 struct particles { static std::string name() { return "particles"; } };
+struct perf { static std::string name() { return "perf"; } };
+struct sort { static std::string name() { return "sort"; } };
 struct centroid {};
 struct ncomp { static std::string name() { return "ncomp"; } };
 struct nmat { static std::string name() { return "nmat"; } };
@@ -158,6 +237,7 @@ struct plot {};
 struct glob {};
 struct control { static std::string name() { return "control"; } };
 struct stat { static std::string name() { return "stat"; } };
+struct ensemble { static std::string name() { return "ensemble"; } };
 struct field { static std::string name() { return "field"; } };
 struct surface { static std::string name() { return "surface"; } };
 struct atwood {};
@@ -190,6 +270,8 @@ struct timescale { static std::string name() { return "timescale"; } };
 struct depvar { static std::string name() { return "depvar"; } };
 struct refvar { static std::string name() { return "refvar"; } };
 struct virtualization {static std::string name() { return "virtualization"; }};
+struct threads { static std::string name() { return "threads"; } };
+struct singlepass { static std::string name() { return "singlepass"; } };
 struct omega { static std::string name() { return "omega"; } };
 struct slm { static std::string name() { return "slm"; } };
 struct glm { static std::string name() { return "glm"; } };
@@ -263,6 +345,7 @@ struct mixmassfracbeta_id {
 struct edge { static std::string name() { return "edge"; } };
 struct cv { static std::string name() { return "cv"; } };
 struct k { static std::string name() { return "k"; } };
+struct eostable { static std::string name() { return "eostable"; } };
 struct com {};
 struct queried {};
 struct responded {};
@@ -282,6 +365,7 @@ struct ndof{ static std::string name() { return "ndof"; } };
 struct rdof{ static std::string name() { return "rdof"; } };
 struct limiter { static std::string name() { return "limiter"; } };
 struct cweight { static std::string name() { return "cweight"; } };
+struct limtol { static std::string name() { return "limtol"; } };
 struct update {};
 struct ch {};
 struct pe {};
@@ -29,6 +29,10 @@ namespace ctr {
 using CmdLineMembers = brigand::list<
     tag::io,             ios
   , tag::virtualization, kw::virtualization::info::expect::type
+  , tag::threads,        kw::threads::info::expect::type
+  , tag::singlepass,     bool
+  , tag::rsfreq,         kw::rsfreq::info::expect::type
+  , tag::memfreq,        kw::memfreq::info::expect::type
   , tag::verbose,        bool
   , tag::chare,          bool
   , tag::help,           bool
@@ -51,6 +55,10 @@ class CmdLine : public tk::TaggedTuple< CmdLineMembers > {
     using keywords = tk::cmd_keywords< kw::verbose
                                      , kw::charestate
                                      , kw::virtualization
+                                     , kw::threads
+                                     , kw::singlepass
+                                     , kw::rsfreq
+                                     , kw::memfreq
                                      , kw::help
                                      , kw::helpctr
                                      , kw::helpkw
@@ -59,6 +67,8 @@ class CmdLine : public tk::TaggedTuple< CmdLineMembers > {
                                      , kw::pdf
                                      , kw::stat
                                      , kw::particles
+                                     , kw::restart
+                                     , kw::ensemble
                                      , kw::quiescence
                                      , kw::trace
                                      , kw::version
@@ -113,7 +123,12 @@ class CmdLine : public tk::TaggedTuple< CmdLineMembers > {
       get< tag::io, tag::pdf >() = "pdf";
       get< tag::io, tag::stat >() = "stat.txt";
       get< tag::io, tag::particles >() = "particles.h5part";
+      get< tag::io, tag::restart >() = "restart";
       get< tag::virtualization >() = 0.0;
+      get< tag::threads >() = 1; // Single-threaded integrators by default
+      get< tag::singlepass >() = false; // Two-pass statistics by default
+      get< tag::rsfreq >() = 1000; // Checkpoint every 1000 time steps
+      get< tag::memfreq >() = 0; // No in-memory checkpoints by default
       get< tag::verbose >() = false; // Quiet output by default
       get< tag::chare >() = false; // No chare state output by default
       get< tag::trace >() = true; // Output call and stack trace by default
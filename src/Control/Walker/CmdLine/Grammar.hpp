@@ -46,6 +46,13 @@ namespace cmd {
                                tk::grm::number,
                                tag::virtualization > {};
 
+  //! number of threads per integrator
+  struct threads :
+         tk::grm::process_cmd< use, kw::threads,
+                               tk::grm::Store< tag::threads >,
+                               tk::grm::number,
+                               tag::threads > {};
+
   //! io parameter
   template< typename keyword, typename io_tag >
   struct io :
@@ -70,6 +77,25 @@ namespace cmd {
                                pegtl::alnum,
                                tag::discr /* = unused */ > {};
 
+  //! Match switch on single-pass estimation of statistics
+  struct singlepass :
+         tk::grm::process_cmd_switch< use, kw::singlepass,
+                                      tag::singlepass > {};
+
+  //! Match and set checkpoint/restart frequency
+  struct rsfreq :
+         tk::grm::process_cmd< use, kw::rsfreq,
+                               tk::grm::Store< tag::rsfreq >,
+                               tk::grm::number,
+                               tag::rsfreq > {};
+
+  //! Match and set in-memory checkpoint frequency
+  struct memfreq :
+         tk::grm::process_cmd< use, kw::memfreq,
+                               tk::grm::Store< tag::memfreq >,
+                               tk::grm::number,
+                               tag::memfreq > {};
+
   //! Match switch on quiescence
   struct quiescence :
          tk::grm::process_cmd_switch< use, kw::quiescence,
@@ -98,6 +124,10 @@ namespace cmd {
                      helpctr,
                      helpkw,
                      virtualization,
+                     threads,
+                     singlepass,
+                     rsfreq,
+                     memfreq,
                      quiescence,
                      trace,
                      version,
@@ -106,7 +136,9 @@ namespace cmd {
                      io< kw::pdf, tag::pdf >,
                      io< kw::stat, tag::stat >,
                      io< kw::screen, tag::screen >,
-                     io< kw::particles, tag::particles > > {};
+                     io< kw::particles, tag::particles >,
+                     io< kw::restart, tag::restart >,
+                     io< kw::ensemble, tag::ensemble > > {};
 
   //! entry point: parse keywords and until end of string
   struct read_string :
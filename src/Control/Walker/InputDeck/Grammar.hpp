@@ -703,11 +703,14 @@ namespace deck {
   //! Discretization parameters
   struct discretization_parameters :
          pegtl::sor< tk::grm::discrparam< use, kw::npar, tag::npar >,
+                     tk::grm::discrparam< use, kw::chunk, tag::chunk >,
+                     tk::grm::discrparam< use, kw::fuse, tag::fuse >,
                      tk::grm::discrparam< use, kw::nstep, tag::nstep >,
                      tk::grm::discrparam< use, kw::term, tag::term >,
                      tk::grm::discrparam< use, kw::dt, tag::dt >,
                      tk::grm::interval< use< kw::ttyi >, tag::tty >,
-                     tk::grm::interval< use< kw::pari >, tag::particles >
+                     tk::grm::interval< use< kw::pari >, tag::particles >,
+                     tk::grm::interval< use< kw::sorti >, tag::sort >
                    > {};
 
   //! rngs
@@ -13,6 +13,7 @@
 #define WalkerInputDeck_h
 
 #include <limits>
+#include <algorithm>
 #include <iostream>
 
 #include <brigand/algorithms/for_each.hpp>
@@ -21,6 +22,7 @@
 
 #include "QuinoaConfig.hpp"
 #include "TaggedTuple.hpp"
+#include "LoadDistributor.hpp"
 #include "HelpFactory.hpp"
 #include "Walker/CmdLine/CmdLine.hpp"
 #include "Walker/Components.hpp"
@@ -60,13 +62,19 @@ class InputDeck : public tk::TaggedTuple< InputDeckMembers > {
                                  , kw::filetype
                                  , kw::pdf_policy
                                  , kw::pdf_centering
+                                 , kw::pdf_sample
+                                 , kw::lazy
+                                 , kw::async
                                  , kw::txt_float_format
                                  , kw::npar
+                                 , kw::chunk
+                                 , kw::fuse
                                  , kw::nstep
                                  , kw::term
                                  , kw::dt
                                  , kw::ttyi
                                  , kw::pari
+                                 , kw::sorti
                                  , kw::rngs
                                  , kw::ncomp
                                  , kw::rng
@@ -120,6 +128,9 @@ class InputDeck : public tk::TaggedTuple< InputDeckMembers > {
                                  , kw::velocitysde
                                  , kw::inst_velocity
                                  , kw::seed
+                                 , kw::gaussian_transform
+                                 , kw::gauss_library
+                                 , kw::ziggurat
                                  #ifdef HAS_MKL
                                  , kw::mkl_mcg31
                                  , kw::mkl_r250
@@ -152,6 +163,7 @@ class InputDeck : public tk::TaggedTuple< InputDeckMembers > {
                                  , kw::gmshtxt
                                  , kw::gmshbin
                                  , kw::exodusii
+                                 , kw::binary
                                  , kw::overwrite
                                  , kw::multiple
                                  , kw::evolution
@@ -246,10 +258,15 @@ class InputDeck : public tk::TaggedTuple< InputDeckMembers > {
       get< tag::cmd >() = cl;
       // Default discretization parameters
       get< tag::discr, tag::npar >() = 1;
+      get< tag::discr, tag::chunk >() = 0;
+      get< tag::discr, tag::fuse >() = 0;
       get< tag::discr, tag::nstep >() =
         std::numeric_limits< kw::nstep::info::expect::type >::max();
       get< tag::discr, tag::term >() = 1.0;
       get< tag::discr, tag::dt >() = 0.5;
+      get< tag::discr, tag::lazy >() = false;
+      get< tag::discr, tag::async >() = false;
+      get< tag::discr, tag::pdfsample >() = 1.0;
       // Default txt floating-point output precision in digits
       get< tag::prec, tag::stat >() = std::cout.precision();
       get< tag::prec, tag::pdf >() = std::cout.precision();
@@ -257,6 +274,7 @@ class InputDeck : public tk::TaggedTuple< InputDeckMembers > {
       get< tag::interval, tag::tty >() = 1;
       get< tag::interval, tag::stat >() = 1;
       get< tag::interval, tag::particles >() = 10000;
+      get< tag::interval, tag::sort >() = 0;
       get< tag::interval, tag::pdf >() = 1;
       // Default requested statistics
       get< tag::stat >() = std::vector< tk::ctr::Product >();
@@ -289,6 +307,74 @@ class InputDeck : public tk::TaggedTuple< InputDeckMembers > {
     //! \return True if there are any PDFs to estimate
     bool pdf() { return !get< tag::pdf >().empty(); }
 
+    //! Query if statistics are to be estimated in a single pass
+    //! \return True if single-pass estimation is configured and possible,
+    //!   i.e., all central moments are of at most second order and no central
+    //!   PDFs are requested, since the latter require the means before the
+    //!   samples are binned, see tk::Statistics::accumulateFused()
+    bool singlepass() {
+      if (!get< tag::cmd, tag::singlepass >()) return false;
+      for (const auto& product : get< tag::stat >())
+        if (tk::ctr::central( product ) && product.size() > 2) return false;
+      for (const auto& probability : get< tag::pdf >())
+        if (!tk::ctr::ordinary( probability )) return false;
+      return true;
+    }
+
+    //! \brief Query if statistics are to be estimated while the particles
+    //!   are advanced in the next time step
+    //! \return True if asynchronous estimation is configured and possible,
+    //!   i.e., the statistics are estimated in a single pass, so the
+    //!   integrators need not wait for the ordinary moments to estimate the
+    //!   central ones
+    bool async() {
+      return get< tag::discr, tag::async >() && singlepass();
+    }
+
+    //! Query if statistics are to be estimated only when they are output
+    //! \return True if lazy estimation is configured and possible, i.e., none
+    //!   of the differential equations configured may depend on statistical
+    //!   moments, which are then required in every time step
+    bool lazy() {
+      if (!get< tag::discr, tag::lazy >()) return false;
+      return get< tag::param, tag::mixdirichlet, tag::depvar >().empty() &&
+             get< tag::param, tag::mixnumfracbeta, tag::depvar >().empty() &&
+             get< tag::param, tag::mixmassfracbeta, tag::depvar >().empty() &&
+             get< tag::param, tag::velocity, tag::depvar >().empty() &&
+             get< tag::param, tag::dissipation, tag::depvar >().empty();
+    }
+
+    //! Compute the load distribution of the particles among work units
+    //! \param[in] npe Number of processing elements
+    //! \param[out] chunksize Number of particles per work unit
+    //! \param[out] remainder Number of particles left over, see
+    //!   tk::linearLoadDistributor()
+    //! \return Number of work units
+    //! \details If the number of particles per work unit is configured, the
+    //!   load distribution is independent of the number of PEs.
+    uint64_t workunits( int npe, uint64_t& chunksize, uint64_t& remainder )
+    const {
+      const auto npar = get< tag::discr, tag::npar >();
+      const auto chunk = get< tag::discr, tag::chunk >();
+      if (chunk > 0) {
+        chunksize = std::min( chunk, npar );
+        remainder = npar % chunksize;
+        return npar / chunksize;
+      }
+      return tk::linearLoadDistributor( get< tag::cmd, tag::virtualization >(),
+                                        npar, npe, chunksize, remainder );
+    }
+
+    //! \brief Compute the number of random number generator streams, one for
+    //!   each thread of each work unit
+    //! \param[in] npe Number of processing elements
+    //! \return Number of random number generator streams
+    std::size_t nstream( int npe ) const {
+      uint64_t chunksize = 0, remainder = 0;
+      return workunits( npe, chunksize, remainder ) *
+             get< tag::cmd, tag::threads >();
+    }
+
     /** @name Pack/Unpack: Serialize InputDeck object for Charm++ */
     ///@{
     //! \brief Pack/Unpack serialize member function
@@ -24,6 +24,7 @@
 #include "Walker/Options/HydroTimeScales.hpp"
 #include "Walker/Options/HydroProductions.hpp"
 #include "Options/PDFFile.hpp"
+#include "Options/StatFile.hpp"
 #include "Options/PDFPolicy.hpp"
 #include "Options/PDFCentering.hpp"
 #include "Options/TxtFloatFormat.hpp"
@@ -41,6 +42,7 @@ using selects = tk::TaggedTuple< brigand::list<
     tag::diffeq,       std::vector< ctr::DiffEqType >  //!< Differential eqs
   , tag::rng,          std::vector< tk::ctr::RNGType > //!< RNGs
   , tag::filetype,     tk::ctr::PDFFileType      //!< PDF output file type
+  , tag::statfile,     tk::ctr::StatFileType     //!< Stat output file type
   , tag::pdfpolicy,    tk::ctr::PDFPolicyType    //!< PDF output file policy
   , tag::pdfctr,       tk::ctr::PDFCenteringType //!< PDF output file centering
 > >;
@@ -48,11 +50,16 @@ using selects = tk::TaggedTuple< brigand::list<
 //! Discretization parameters storage
 using discretization = tk::TaggedTuple< brigand::list<
     tag::npar,      kw::npar::info::expect::type  //!< Total number of particles
+  , tag::chunk,     kw::chunk::info::expect::type   //!< Particles per work unit
+  , tag::fuse,      kw::fuse::info::expect::type    //!< Fused block size
   , tag::nstep,     kw::nstep::info::expect::type   //!< Number of time steps
   , tag::term,      kw::term::info::expect::type    //!< Termination time
   , tag::dt,        kw::dt::info::expect::type      //!< Size of time step
   , tag::binsize,   std::vector< std::vector< tk::real > >  //!< PDF binsizes
   , tag::extent,    std::vector< std::vector< tk::real > >  //!< PDF extents
+  , tag::lazy,      kw::lazy::info::expect::type   //!< Lazy statistics
+  , tag::async,     kw::async::info::expect::type  //!< Async statistics
+  , tag::pdfsample, kw::pdf_sample::info::expect::type  //!< PDF sample fraction
 > >;
 
 //! ASCII output floating-point precision in digits
@@ -75,6 +82,8 @@ using intervals = tk::TaggedTuple< brigand::list<
   , tag::stat, kw::interval::info::expect::type
     //! Particles output interval
   , tag::particles, kw::interval::info::expect::type
+    //! Particles sorting interval
+  , tag::sort, kw::sorti::info::expect::type
     //! PDF output interval
   , tag::pdf,  kw::interval::info::expect::type
 > >;
@@ -89,6 +98,8 @@ using ios = tk::TaggedTuple< brigand::list<
   , tag::pdf,       kw::pdf::info::expect::type     //!< PDF filename
   , tag::stat,      kw::stat::info::expect::type    //!< Statistics filename
   , tag::particles, std::string                     //!< Particles filename
+  , tag::restart,   kw::restart::info::expect::type //!< Restart dirname
+  , tag::ensemble,  kw::ensemble::info::expect::type //!< Parameter table
   , tag::pdfnames,  std::vector< std::string >      //!< PDF identifiers
 > >;
 
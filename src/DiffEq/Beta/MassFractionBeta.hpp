@@ -66,10 +66,12 @@
 
 #include <vector>
 #include <cmath>
+#include <algorithm>
 
 #include "InitPolicy.hpp"
 #include "MassFractionBetaCoeffPolicy.hpp"
 #include "RNG.hpp"
+#include "RNGBlock.hpp"
 #include "Particles.hpp"
 
 namespace walker {
@@ -106,6 +108,7 @@ class MassFractionBeta {
         g_inputdeck.get< tag::component >().offset< tag::massfracbeta >(c) ),
       m_rng( g_rng.at( tk::ctr::raw(
         g_inputdeck.get< tag::param, tag::massfracbeta, tag::rng >().at(c) ) ) ),
+      m_dW( m_rng ),
       m_b(),
       m_S(),
       m_k(),
@@ -143,19 +146,27 @@ class MassFractionBeta {
     {
       // Advance particles
       const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
+      for (ncomp_t p0=0; p0<npar; p0+=tk::ParticleBlkWidth) {
+        const auto n = std::min( tk::ParticleBlkWidth, npar-p0 );
         // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
-        // Advance all m_ncomp scalars
+        const auto dW = m_dW.gaussian( stream, n*m_ncomp );
+        // Advance all m_ncomp scalars of a block of particles
         for (ncomp_t i=0; i<m_ncomp; ++i) {
-          tk::real& Y = particles( p, i, m_offset );
-          tk::real d = m_k[i] * Y * (1.0 - Y) * dt;
-          d = (d > 0.0 ? std::sqrt(d) : 0.0);
-          Y += 0.5*m_b[i]*(m_S[i] - Y)*dt + d*dW[i];
-          // Compute instantaneous values derived from updated Y
-          particles( p, m_ncomp+i, m_offset ) = rho( Y, i );
-          particles( p, m_ncomp*2+i, m_offset ) = vol( Y, i );
+          auto par = particles.cview( i, m_offset );
+          auto r = particles.cview( m_ncomp+i, m_offset );
+          auto v = particles.cview( m_ncomp*2+i, m_offset );
+          const auto k = m_k[i], b = m_b[i], S = m_S[i];
+          const auto dWi = dW + i*n;
+          #pragma omp simd
+          for (ncomp_t q=0; q<n; ++q) {
+            tk::real& Y = par[ p0+q ];
+            tk::real d = k * Y * (1.0 - Y) * dt;
+            d = (d > 0.0 ? std::sqrt(d) : 0.0);
+            Y += 0.5*b*(S - Y)*dt + d*dWi[q];
+            // Compute instantaneous values derived from updated Y
+            r[ p0+q ] = rho( Y, i );
+            v[ p0+q ] = vol( Y, i );
+          }
         }
       }
     }
@@ -166,6 +177,7 @@ class MassFractionBeta {
     const ncomp_t m_ncomp;              //!< Number of components
     const ncomp_t m_offset;             //!< Offset SDE operates from
     const tk::RNG& m_rng;               //!< Random number generator
+    tk::RNGBlock m_dW;                  //!< Blocks of Gaussian random numbers
 
     //! Coefficients
     std::vector< kw::sde_b::info::expect::type > m_b;
@@ -84,6 +84,7 @@
 #include "InitPolicy.hpp"
 #include "MixMassFractionBetaCoeffPolicy.hpp"
 #include "RNG.hpp"
+#include "RNGBlock.hpp"
 #include "Particles.hpp"
 #include "Table.hpp"
 #include "CoupledEq.hpp"
@@ -133,6 +134,7 @@ class MixMassFractionBeta {
       m_offset( g_inputdeck.get< tag::component >().offset< eq >(c) ),
       m_rng( g_rng.at( tk::ctr::raw(
         g_inputdeck.get< tag::param, eq, tag::rng >().at(c) ) ) ),
+      m_dW( m_rng ),
       m_solve( g_inputdeck.get< tag::param, eq, tag::solve >().at(c) ),
       m_velocity_coupled( coupled< eq, tag::velocity >( c ) ),
       m_velocity_depvar( depvar< eq, tag::velocity >( c ) ),
@@ -173,7 +175,7 @@ class MixMassFractionBeta {
           g_inputdeck.get< tag::param, eq, tag::hydrotimescales >().at(c);
         ctr::HydroTimeScales ot;
         // cppcheck-suppress useStlAlgorithm
-        for (auto t : hts) m_hts.push_back( ot.table(t) );
+        for (auto t : hts) m_hts.emplace_back( ot.table(t) );
         Assert( m_hts.size() == m_ncomp, "Number of inverse hydro time scale "
           "tables associated does not match the components integrated" );
 
@@ -182,7 +184,7 @@ class MixMassFractionBeta {
           g_inputdeck.get< tag::param, eq, tag::hydroproductions >().at(c);
         ctr::HydroProductions op;
         // cppcheck-suppress useStlAlgorithm
-        for (auto t : hp) m_hp.push_back( op.table(t) );
+        for (auto t : hp) m_hp.emplace_back( op.table(t) );
         Assert( m_hp.size() == m_ncomp, "Number of hydro "
           "production/dissipation tables associated does not match the "
           "components integrated" );
@@ -230,8 +232,7 @@ class MixMassFractionBeta {
       const auto npar = particles.nunk();
       for (auto p=decltype(npar){0}; p<npar; ++p) {
         // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
+        const auto dW = m_dW.gaussian( stream, m_ncomp );
 
         // Access coupled particle velocity
         tk::real u = 0.0, v = 0.0, w = 0.0;
@@ -261,6 +262,7 @@ class MixMassFractionBeta {
     const ncomp_t m_ncomp;              //!< Number of components
     const ncomp_t m_offset;             //!< Offset SDE operates from
     const tk::RNG& m_rng;               //!< Random number generator
+    tk::RNGBlock m_dW;                  //!< Blocks of Gaussian random numbers
     const ctr::DepvarType m_solve;      //!< Depndent variable to solve for
 
     const bool m_velocity_coupled;      //!< True if coupled to velocity
@@ -290,12 +292,12 @@ class MixMassFractionBeta {
     //! Selected inverse hydrodynamics time scales (if used) for each component
     //! \details This is only used if the coefficients policy is
     //!   MixMassFracBetaCoeffHydroTimeScale. See constructor.
-    std::vector< tk::Table > m_hts;
+    std::vector< tk::IndexedTable > m_hts;
 
     //! Selected hydrodynamics production/dissipation (if used) for each comp.
     //! \details This is only used if the coefficients policy is
     //!   MixMassFracBetaCoeffHydroTimeScale. See constructor.
-    std::vector< tk::Table > m_hp;
+    std::vector< tk::IndexedTable > m_hp;
 
     //! \brief Return density for mass fraction
     //! \details Functional wrapper around the dependent variable of the beta
@@ -90,8 +90,8 @@ walker::MixMassFracBetaCoeffDecay::update(
   const std::vector< kw::sde_kappaprime::info::expect::type >& kprime,
   const std::vector< kw::sde_rho2::info::expect::type >&,
   const std::vector< kw::sde_r::info::expect::type >&,
-  const std::vector< tk::Table >&,
-  const std::vector< tk::Table >&,
+  const std::vector< tk::IndexedTable >&,
+  const std::vector< tk::IndexedTable >&,
   std::vector< kw::sde_b::info::expect::type  >& b,
   std::vector< kw::sde_kappa::info::expect::type >& k,
   std::vector< kw::sde_S::info::expect::type >&,
@@ -188,8 +188,8 @@ walker::MixMassFracBetaCoeffHomDecay::update(
   const std::vector< kw::sde_kappaprime::info::expect::type >& kprime,
   const std::vector< kw::sde_rho2::info::expect::type >& rho2,
   const std::vector< kw::sde_r::info::expect::type >& r,
-  const std::vector< tk::Table >&,
-  const std::vector< tk::Table >&,
+  const std::vector< tk::IndexedTable >&,
+  const std::vector< tk::IndexedTable >&,
   std::vector< kw::sde_b::info::expect::type  >& b,
   std::vector< kw::sde_kappa::info::expect::type >& k,
   std::vector< kw::sde_S::info::expect::type >& S,
@@ -327,8 +327,8 @@ walker::MixMassFracBetaCoeffMonteCarloHomDecay::update(
   const std::vector< kw::sde_kappaprime::info::expect::type >& kprime,
   const std::vector< kw::sde_rho2::info::expect::type >& rho2,
   const std::vector< kw::sde_r::info::expect::type >& r,
-  const std::vector< tk::Table >&,
-  const std::vector< tk::Table >&,
+  const std::vector< tk::IndexedTable >&,
+  const std::vector< tk::IndexedTable >&,
   std::vector< kw::sde_b::info::expect::type  >& b,
   std::vector< kw::sde_kappa::info::expect::type >& k,
   std::vector< kw::sde_S::info::expect::type >& S,
@@ -479,8 +479,8 @@ walker::MixMassFracBetaCoeffHydroTimeScale::update(
   const std::vector< kw::sde_kappaprime::info::expect::type >& kprime,
   const std::vector< kw::sde_rho2::info::expect::type >& rho2,
   const std::vector< kw::sde_r::info::expect::type >& r,
-  const std::vector< tk::Table >& hts,
-  const std::vector< tk::Table >& hp,
+  const std::vector< tk::IndexedTable >& hts,
+  const std::vector< tk::IndexedTable >& hp,
   std::vector< kw::sde_b::info::expect::type  >& b,
   std::vector< kw::sde_kappa::info::expect::type >& k,
   std::vector< kw::sde_S::info::expect::type >& S,
@@ -557,8 +557,8 @@ walker::MixMassFracBetaCoeffHydroTimeScale::update(
     tk::real yt = ry/d;
 
     // Sample hydrodynamics timescale and prod/diss at time t
-    auto ts = hydrotimescale( t, hts[c] );  // eps/k
-    auto pe = hydroproduction( t, hp[c] );  // P/eps = (dk/dt+eps)/eps
+    auto ts = hydrotimescale( t, c, hts[c] );  // eps/k
+    auto pe = hydroproduction( t, c, hp[c] );  // P/eps = (dk/dt+eps)/eps
 
     tk::real a = r[c]/(1.0+r[c]*yt);
     tk::real bnm = a*a*yt*(1.0-yt);
@@ -683,8 +683,8 @@ walker::MixMassFracBetaCoeffInstVel::update(
   const std::vector< kw::sde_kappaprime::info::expect::type >& kprime,
   const std::vector< kw::sde_rho2::info::expect::type >& rho2,
   const std::vector< kw::sde_r::info::expect::type >& r,
-  const std::vector< tk::Table >&,
-  const std::vector< tk::Table >&,
+  const std::vector< tk::IndexedTable >&,
+  const std::vector< tk::IndexedTable >&,
   std::vector< kw::sde_b::info::expect::type  >& b,
   std::vector< kw::sde_kappa::info::expect::type >& k,
   std::vector< kw::sde_S::info::expect::type >& S,
@@ -65,8 +65,8 @@
           const std::vector< kw::sde_kappaprime::info::expect::type >& kprime,
           const std::vector< kw::sde_rho2::info::expect::type >& rho2,
           const std::vector< kw::sde_r::info::expect::type >& r,
-          const std::vector< tk::Table >& hts,
-          const std::vector< tk::Table >& hp,
+          const std::vector< tk::IndexedTable >& hts,
+          const std::vector< tk::IndexedTable >& hp,
           std::vector< kw::sde_b::info::expect::type  >& b,
           std::vector< kw::sde_kappa::info::expect::type >& k,
           std::vector< kw::sde_S::info::expect::type >& S ) const {}
@@ -160,8 +160,8 @@ class MixMassFracBetaCoeffDecay {
       const std::vector< kw::sde_kappaprime::info::expect::type >& kprime,
       const std::vector< kw::sde_rho2::info::expect::type >&,
       const std::vector< kw::sde_r::info::expect::type >&,
-      const std::vector< tk::Table >&,
-      const std::vector< tk::Table >&,
+      const std::vector< tk::IndexedTable >&,
+      const std::vector< tk::IndexedTable >&,
       std::vector< kw::sde_b::info::expect::type  >& b,
       std::vector< kw::sde_kappa::info::expect::type >& k,
       std::vector< kw::sde_S::info::expect::type >&,
@@ -210,8 +210,8 @@ class MixMassFracBetaCoeffHomDecay {
       const std::vector< kw::sde_kappaprime::info::expect::type >& kprime,
       const std::vector< kw::sde_rho2::info::expect::type >& rho2,
       const std::vector< kw::sde_r::info::expect::type >& r,
-      const std::vector< tk::Table >&,
-      const std::vector< tk::Table >&,
+      const std::vector< tk::IndexedTable >&,
+      const std::vector< tk::IndexedTable >&,
       std::vector< kw::sde_b::info::expect::type  >& b,
       std::vector< kw::sde_kappa::info::expect::type >& k,
       std::vector< kw::sde_S::info::expect::type >& S,
@@ -264,8 +264,8 @@ class MixMassFracBetaCoeffMonteCarloHomDecay {
       const std::vector< kw::sde_kappaprime::info::expect::type >& kprime,
       const std::vector< kw::sde_rho2::info::expect::type >& rho2,
       const std::vector< kw::sde_r::info::expect::type >& r,
-      const std::vector< tk::Table >&,
-      const std::vector< tk::Table >&,
+      const std::vector< tk::IndexedTable >&,
+      const std::vector< tk::IndexedTable >&,
       std::vector< kw::sde_b::info::expect::type  >& b,
       std::vector< kw::sde_kappa::info::expect::type >& k,
       std::vector< kw::sde_S::info::expect::type >& S,
@@ -318,8 +318,8 @@ class MixMassFracBetaCoeffHydroTimeScale {
       const std::vector< kw::sde_kappaprime::info::expect::type >& kprime,
       const std::vector< kw::sde_rho2::info::expect::type >& rho2,
       const std::vector< kw::sde_r::info::expect::type >& r,
-      const std::vector< tk::Table >& hts,
-      const std::vector< tk::Table >& hp,
+      const std::vector< tk::IndexedTable >& hts,
+      const std::vector< tk::IndexedTable >& hp,
       std::vector< kw::sde_b::info::expect::type  >& b,
       std::vector< kw::sde_kappa::info::expect::type >& k,
       std::vector< kw::sde_S::info::expect::type >& S,
@@ -327,19 +327,39 @@ class MixMassFracBetaCoeffHydroTimeScale {
 
     //! Sample the inverse hydrodynamics time scale at time t
     //! \param[in] t Time at which to sample inverse hydrodynamics time scale
+    //! \param[in] c Scalar component whose time scale to sample
     //! \param[in] ts Hydro time scale table to sample
     //! \return Sampled value from discrete table of inverse hydro time scale
-    tk::real hydrotimescale( tk::real t, const tk::Table& ts ) const
-    { return tk::sample( t, ts ); }
+    //! \details The table segment around t is cached per component and only
+    //!   looked up again once t leaves it.
+    tk::real hydrotimescale( tk::real t,
+                             ncomp_t c,
+                             const tk::IndexedTable& ts ) const
+    {
+      if (m_hts_win.size() <= c) m_hts_win.resize( c+1 );
+      return ts.sample( t, m_hts_win[c] );
+    }
 
     //! Sample the hydrodynamics production/dissipation rate (P/e) at time t
     //! \param[in] t Time at which to sample hydrodynamics P/e
+    //! \param[in] c Scalar component whose P/e to sample
     //! \param[in] p P/e table to sample
     //! \return Sampled value from discrete table of P/e
-    tk::real hydroproduction( tk::real t, const tk::Table& p ) const
-    { return tk::sample( t, p ); }
+    //! \details The table segment around t is cached per component and only
+    //!   looked up again once t leaves it.
+    tk::real hydroproduction( tk::real t,
+                              ncomp_t c,
+                              const tk::IndexedTable& p ) const
+    {
+      if (m_hp_win.size() <= c) m_hp_win.resize( c+1 );
+      return p.sample( t, m_hp_win[c] );
+    }
 
     mutable std::size_t m_it = 0;
+    //! Table segments of hydro time scales cached per component
+    mutable std::vector< tk::IndexedTable::Window > m_hts_win;
+    //! Table segments of hydro P/e cached per component
+    mutable std::vector< tk::IndexedTable::Window > m_hp_win;
     mutable std::vector< tk::real > m_s;
     mutable std::string m_extra_out_filename;
 };
@@ -386,8 +406,8 @@ class MixMassFracBetaCoeffInstVel {
       const std::vector< kw::sde_kappaprime::info::expect::type >& kprime,
       const std::vector< kw::sde_rho2::info::expect::type >& rho2,
       const std::vector< kw::sde_r::info::expect::type >& r,
-      const std::vector< tk::Table >&,
-      const std::vector< tk::Table >&,
+      const std::vector< tk::IndexedTable >&,
+      const std::vector< tk::IndexedTable >&,
       std::vector< kw::sde_b::info::expect::type  >& b,
       std::vector< kw::sde_kappa::info::expect::type >& k,
       std::vector< kw::sde_S::info::expect::type >& S,
@@ -85,6 +85,7 @@
 #include "InitPolicy.hpp"
 #include "MixNumberFractionBetaCoeffPolicy.hpp"
 #include "RNG.hpp"
+#include "RNGBlock.hpp"
 #include "Particles.hpp"
 
 namespace walker {
@@ -124,6 +125,7 @@ class MixNumberFractionBeta {
       m_rng( g_rng.at( tk::ctr::raw(
         g_inputdeck.get< tag::param, tag::mixnumfracbeta, tag::rng >().at(c) ) )
       ),
+      m_dW( m_rng ),
       m_bprime(),
       m_S(),
       m_kprime(),
@@ -168,8 +170,7 @@ class MixNumberFractionBeta {
       const auto npar = particles.nunk();
       for (auto p=decltype(npar){0}; p<npar; ++p) {
         // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
+        const auto dW = m_dW.gaussian( stream, m_ncomp );
         // Advance all m_ncomp scalars
         for (ncomp_t i=0; i<m_ncomp; ++i) {
           tk::real& X = particles( p, i, m_offset );
@@ -189,6 +190,7 @@ class MixNumberFractionBeta {
     const ncomp_t m_ncomp;              //!< Number of components
     const ncomp_t m_offset;             //!< Offset SDE operates from
     const tk::RNG& m_rng;               //!< Random number generator
+    tk::RNGBlock m_dW;                  //!< Blocks of Gaussian random numbers
 
     //! Coefficients
     std::vector< kw::sde_bprime::info::expect::type > m_bprime;
@@ -54,10 +54,12 @@
 
 #include <vector>
 #include <cmath>
+#include <algorithm>
 
 #include "InitPolicy.hpp"
 #include "NumberFractionBetaCoeffPolicy.hpp"
 #include "RNG.hpp"
+#include "RNGBlock.hpp"
 #include "Particles.hpp"
 
 namespace walker {
@@ -94,6 +96,7 @@ class NumberFractionBeta {
         g_inputdeck.get< tag::component >().offset< tag::numfracbeta >(c) ),
       m_rng( g_rng.at( tk::ctr::raw(
         g_inputdeck.get< tag::param, tag::numfracbeta, tag::rng >().at(c) ) ) ),
+      m_dW( m_rng ),
       m_b(),
       m_S(),
       m_k(),
@@ -130,19 +133,27 @@ class NumberFractionBeta {
     {
       // Advance particles
       const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
+      for (ncomp_t p0=0; p0<npar; p0+=tk::ParticleBlkWidth) {
+        const auto n = std::min( tk::ParticleBlkWidth, npar-p0 );
         // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
-        // Advance all m_ncomp scalars
+        const auto dW = m_dW.gaussian( stream, n*m_ncomp );
+        // Advance all m_ncomp scalars of a block of particles
         for (ncomp_t i=0; i<m_ncomp; ++i) {
-          tk::real& X = particles( p, i, m_offset );
-          tk::real d = m_k[i] * X * (1.0 - X) * dt;
-          d = (d > 0.0 ? std::sqrt(d) : 0.0);
-          X += 0.5*m_b[i]*(m_S[i] - X)*dt + d*dW[i];
-          // Compute instantaneous values derived from updated X
-          particles( p, m_ncomp+i, m_offset ) = rho( X, i );
-          particles( p, m_ncomp*2+i, m_offset ) = vol( X, i );
+          auto par = particles.cview( i, m_offset );
+          auto r = particles.cview( m_ncomp+i, m_offset );
+          auto v = particles.cview( m_ncomp*2+i, m_offset );
+          const auto k = m_k[i], b = m_b[i], S = m_S[i];
+          const auto dWi = dW + i*n;
+          #pragma omp simd
+          for (ncomp_t q=0; q<n; ++q) {
+            tk::real& X = par[ p0+q ];
+            tk::real d = k * X * (1.0 - X) * dt;
+            d = (d > 0.0 ? std::sqrt(d) : 0.0);
+            X += 0.5*b*(S - X)*dt + d*dWi[q];
+            // Compute instantaneous values derived from updated X
+            r[ p0+q ] = rho( X, i );
+            v[ p0+q ] = vol( X, i );
+          }
         }
       }
     }
@@ -153,6 +164,7 @@ class NumberFractionBeta {
     const ncomp_t m_ncomp;              //!< Number of components
     const ncomp_t m_offset;             //!< Offset SDE operates from
     const tk::RNG& m_rng;               //!< Random number generator
+    tk::RNGBlock m_dW;                  //!< Blocks of Gaussian random numbers
 
     //! Coefficients
     std::vector< kw::sde_b::info::expect::type > m_b;
@@ -20,6 +20,9 @@
 #include <string>
 #include <functional>
 #include <memory>
+#include <type_traits>
+
+#include "NoWarning/pup.hpp"
 
 #include "Types.hpp"
 #include "Particles.hpp"
@@ -27,6 +30,18 @@
 
 namespace walker {
 
+//! Detect if a differential equation defines function 'pupstate( PUP::er& )'
+template< typename, typename = std::void_t<> >
+struct HasFunction_pupstate : std::false_type {};
+
+template< typename T >
+struct HasFunction_pupstate< T,
+  std::void_t< decltype(std::declval<T&>().pupstate(
+                 std::declval<PUP::er&>() )) > > : std::true_type {};
+
+template < typename T >
+inline constexpr bool HasFunction_pupstate_v = HasFunction_pupstate< T >::value;
+
 //! \brief Differential equation
 //! \details This class uses runtime polymorphism without client-side
 //!   inheritance: inheritance is confined to the internals of the this class,
@@ -83,6 +98,12 @@ class DiffEq {
                   const std::map< tk::ctr::Product, tk::real >& moments ) const
     { self->advance( particles, stream, dt, t, moments ); }
 
+    //! \brief Public interface to packing/unpacking the state of the diff eq
+    //!   kept between time steps, e.g., random numbers generated in advance
+    //! \details Used for checkpoint/restart. Differential equations that keep
+    //!   no such state need not define pupstate().
+    void pupstate( PUP::er& p ) const { self->pupstate( p ); }
+
     //! Copy assignment
     DiffEq& operator=( const DiffEq& x )
     { DiffEq tmp(x); *this = std::move(tmp); return *this; }
@@ -107,6 +128,7 @@ class DiffEq {
                             tk::real,
                             tk::real,
                             const std::map< tk::ctr::Product, tk::real >& ) = 0;
+      virtual void pupstate( PUP::er& ) = 0;
     };
 
     //! \brief Model models the Concept above by deriving from it and overriding
@@ -123,6 +145,8 @@ class DiffEq {
                     tk::real t,
                     const std::map< tk::ctr::Product, tk::real >& moments )
       override { data.advance( particles, stream, dt, t, moments ); }
+      void pupstate( [[maybe_unused]] PUP::er& p ) override
+      { if constexpr( HasFunction_pupstate_v< T > ) data.pupstate( p ); }
       T data;
     };
 
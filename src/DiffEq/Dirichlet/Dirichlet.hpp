@@ -49,12 +49,15 @@
 #ifndef Dirichlet_h
 #define Dirichlet_h
 
+#include <array>
 #include <vector>
 #include <cmath>
+#include <algorithm>
 
 #include "InitPolicy.hpp"
 #include "DirichletCoeffPolicy.hpp"
 #include "RNG.hpp"
+#include "RNGBlock.hpp"
 #include "Particles.hpp"
 
 namespace walker {
@@ -90,6 +93,7 @@ class Dirichlet {
         g_inputdeck.get< tag::component >().offset< tag::dirichlet >(c) ),
       m_rng( g_rng.at( tk::ctr::raw(
         g_inputdeck.get< tag::param, tag::dirichlet, tag::rng >().at(c) ) ) ),
+      m_dW( m_rng ),
       m_b(),
       m_S(),
       m_k(),
@@ -120,22 +124,33 @@ class Dirichlet {
                   const std::map< tk::ctr::Product, tk::real >& )
     {
       const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
-        // Compute Nth scalar
-        tk::real yn = 1.0 - particles(p, 0, m_offset);
-        for (ncomp_t i=1; i<m_ncomp; ++i)
-          yn -= particles( p, i, m_offset );
+      std::array< tk::real, tk::ParticleBlkWidth > yn;
+      for (ncomp_t p0=0; p0<npar; p0+=tk::ParticleBlkWidth) {
+        const auto n = std::min( tk::ParticleBlkWidth, npar-p0 );
+
+        // Compute Nth scalar of a block of particles
+        std::fill( begin(yn), end(yn), 1.0 );
+        for (ncomp_t i=0; i<m_ncomp; ++i) {
+          const auto par = particles.cview( i, m_offset );
+          #pragma omp simd
+          for (ncomp_t q=0; q<n; ++q) yn[q] -= par[ p0+q ];
+        }
 
         // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
+        const auto dW = m_dW.gaussian( stream, n*m_ncomp );
 
-        // Advance first m_ncomp (K=N-1) scalars
+        // Advance first m_ncomp (K=N-1) scalars of a block of particles
         for (ncomp_t i=0; i<m_ncomp; ++i) {
-          tk::real& par = particles( p, i, m_offset );
-          tk::real d = m_k[i] * par * yn * dt;
-          d = (d > 0.0 ? std::sqrt(d) : 0.0);
-          par += 0.5*m_b[i]*( m_S[i]*yn - (1.0-m_S[i]) * par )*dt + d*dW[i];
+          auto par = particles.cview( i, m_offset );
+          const auto k = m_k[i], b = m_b[i], S = m_S[i];
+          const auto dWi = dW + i*n;
+          #pragma omp simd
+          for (ncomp_t q=0; q<n; ++q) {
+            tk::real& y = par[ p0+q ];
+            tk::real d = k * y * yn[q] * dt;
+            d = (d > 0.0 ? std::sqrt(d) : 0.0);
+            y += 0.5*b*( S*yn[q] - (1.0-S) * y )*dt + d*dWi[q];
+          }
         }
       }
     }
@@ -146,6 +161,7 @@ class Dirichlet {
     const ncomp_t m_ncomp;              //!< Number of components
     const ncomp_t m_offset;             //!< Offset SDE operates from
     const tk::RNG& m_rng;               //!< Random number generator
+    tk::RNGBlock m_dW;                  //!< Blocks of Gaussian random numbers
 
     //! Coefficients
     std::vector< kw::sde_b::info::expect::type > m_b;
@@ -89,6 +89,7 @@
 #include "InitPolicy.hpp"
 #include "GeneralizedDirichletCoeffPolicy.hpp"
 #include "RNG.hpp"
+#include "RNGBlock.hpp"
 #include "Particles.hpp"
 
 namespace walker {
@@ -122,6 +123,7 @@ class GeneralizedDirichlet {
       m_offset( g_inputdeck.get< tag::component >().offset< tag::gendir >(c) ),
       m_rng( g_rng.at( tk::ctr::raw(
         g_inputdeck.get< tag::param, tag::gendir, tag::rng >().at(c) ) ) ),
+      m_dW( m_rng ),
       m_b(),
       m_S(),
       m_k(),
@@ -170,8 +172,7 @@ class GeneralizedDirichlet {
         }
 
         // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
+        const auto dW = m_dW.gaussian( stream, m_ncomp );
 
         // Advance first m_ncomp (K=N-1) scalars
         ncomp_t k=0;
@@ -193,6 +194,7 @@ class GeneralizedDirichlet {
     const ncomp_t m_ncomp;              //!< Number of components
     const ncomp_t m_offset;             //!< Offset SDE operates from
     const tk::RNG& m_rng;               //!< Random number generator
+    tk::RNGBlock m_dW;                  //!< Blocks of Gaussian random numbers
 
     //! Coefficients
     std::vector< kw::sde_b::info::expect::type > m_b;
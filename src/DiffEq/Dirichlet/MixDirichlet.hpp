@@ -53,11 +53,13 @@
 
 #include <vector>
 #include <cmath>
+#include <algorithm>
 #include <cfenv>
 
 #include "InitPolicy.hpp"
 #include "MixDirichletCoeffPolicy.hpp"
 #include "RNG.hpp"
+#include "RNGBlock.hpp"
 #include "Particles.hpp"
 
 namespace walker {
@@ -98,6 +100,7 @@ class MixDirichlet {
         g_inputdeck.get< tag::component >().offset< eq >(c) ),
       m_rng( g_rng.at( tk::ctr::raw(
         g_inputdeck.get< tag::param, eq, tag::rng >().at(c) ) ) ),
+      m_dW( m_rng ),
       m_norm( g_inputdeck.get< tag::param, eq, tag::normalization >().at(c) ),
       m_b(),
       m_S(),
@@ -165,24 +168,31 @@ class MixDirichlet {
 
       // Advance particles
       const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
+      auto yn = particles.cview( m_ncomp, m_offset );
+      for (ncomp_t p0=0; p0<npar; p0+=tk::ParticleBlkWidth) {
+        const auto n = std::min( tk::ParticleBlkWidth, npar-p0 );
         // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
+        const auto dW = m_dW.gaussian( stream, n*m_ncomp );
 
-        // Advance all m_ncomp (=N=K+1) scalars
-        auto& yn = particles( p, m_ncomp, m_offset );
+        // Advance all m_ncomp (=N=K+1) scalars of a block of particles
         for (ncomp_t i=0; i<m_ncomp; ++i) {
-          auto& y = particles( p, i, m_offset );
-          tk::real d = m_k[i] * y * yn * dt;
-          if (d < 0.0) d = 0.0;
-          d = std::sqrt( d );
-          auto dy = 0.5*m_b[i]*( m_S[i]*yn - (1.0-m_S[i])*y )*dt + d*dW[i];
-          y += dy;
-          yn -= dy;
+          auto par = particles.cview( i, m_offset );
+          const auto k = m_k[i], b = m_b[i], S = m_S[i];
+          const auto dWi = dW + i*n;
+          #pragma omp simd
+          for (ncomp_t q=0; q<n; ++q) {
+            auto& y = par[ p0+q ];
+            auto& z = yn[ p0+q ];
+            tk::real d = k * y * z * dt;
+            if (d < 0.0) d = 0.0;
+            d = std::sqrt( d );
+            auto dy = 0.5*b*( S*z - (1.0-S)*y )*dt + d*dWi[q];
+            y += dy;
+            z -= dy;
+          }
         }
         // Compute derived instantaneous variables
-        derived( particles, p );
+        for (ncomp_t p=p0; p<p0+n; ++p) derived( particles, p );
       }
 
       feclearexcept( FE_UNDERFLOW );
@@ -200,6 +210,7 @@ class MixDirichlet {
     const ncomp_t m_ncomp;              //!< Number of components, K = N-1
     const ncomp_t m_offset;             //!< Offset SDE operates from
     const tk::RNG& m_rng;               //!< Random number generator
+    tk::RNGBlock m_dW;                  //!< Blocks of Gaussian random numbers
     const ctr::NormalizationType m_norm;//!< Normalization type
 
     //! Coefficients
@@ -22,6 +22,7 @@
 #include "InitPolicy.hpp"
 #include "DissipationCoeffPolicy.hpp"
 #include "RNG.hpp"
+#include "RNGBlock.hpp"
 #include "Particles.hpp"
 #include "CoupledEq.hpp"
 
@@ -56,6 +57,7 @@ class Dissipation {
       m_offset( g_inputdeck.get< tag::component >().offset< eq >(c) ),
       m_rng( g_rng.at( tk::ctr::raw(
         g_inputdeck.get< tag::param, eq, tag::rng >().at(c) ) ) ),
+      m_dW( m_rng ),
       m_velocity_coupled( coupled< eq, tag::velocity >( c ) ),
       m_velocity_depvar( depvar< eq, tag::velocity >( c ) ),
       m_velocity_offset( offset< eq, tag::velocity, tag::velocity_id >( c ) ),
@@ -129,8 +131,7 @@ class Dissipation {
       const auto npar = particles.nunk();
       for (auto p=decltype(npar){0}; p<npar; ++p) {
         // Generate a Gaussian random number with zero mean and unit variance
-        tk::real dW;
-        m_rng.gaussian( stream, m_ncomp, &dW );
+        const auto dW = *m_dW.gaussian( stream, m_ncomp );
         // Advance particle frequency
         tk::real& Op = particles( p, 0, m_offset );
         tk::real d = 2.0*m_c3*m_c4*O*O*Op*dt;
@@ -139,12 +140,17 @@ class Dissipation {
       }
     }
 
+    //! Pack/Unpack random numbers not yet used kept between time steps
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    void pupstate( PUP::er& p ) { p | m_dW; }
+
   private:
     const ncomp_t m_c;                  //!< Equation system index
     const char m_depvar;                //!< Dependent variable
     const ncomp_t m_ncomp;              //!< Number of components
     const ncomp_t m_offset;             //!< Offset SDE operates from
     const tk::RNG& m_rng;               //!< Random number generator
+    tk::RNGBlock m_dW;                  //!< Blocks of Gaussian random numbers
 
     const bool m_velocity_coupled;      //!< True if coupled to velocity
     const char m_velocity_depvar;       //!< Coupled velocity dependent variable
@@ -42,10 +42,12 @@
 
 #include <vector>
 #include <cmath>
+#include <algorithm>
 
 #include "InitPolicy.hpp"
 #include "GammaCoeffPolicy.hpp"
 #include "RNG.hpp"
+#include "RNGBlock.hpp"
 #include "Particles.hpp"
 
 namespace walker {
@@ -78,6 +80,7 @@ class Gamma {
       m_offset( g_inputdeck.get< tag::component >().offset< tag::gamma >(c) ),
       m_rng( g_rng.at( tk::ctr::raw(
         g_inputdeck.get< tag::param, tag::gamma, tag::rng >().at(c) ) ) ),
+      m_dW( m_rng ),
       m_b(),
       m_S(),
       m_k(),
@@ -108,27 +111,38 @@ class Gamma {
                   const std::map< tk::ctr::Product, tk::real >& )
     {
       const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
+      for (ncomp_t p0=0; p0<npar; p0+=tk::ParticleBlkWidth) {
+        const auto n = std::min( tk::ParticleBlkWidth, npar-p0 );
         // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
+        const auto dW = m_dW.gaussian( stream, n*m_ncomp );
 
-        // Advance all m_ncomp scalars
+        // Advance all m_ncomp scalars of a block of particles
         for (ncomp_t i=0; i<m_ncomp; ++i) {
-          tk::real& par = particles( p, i, m_offset );
-          tk::real d = m_k[i] * par * dt;
-          d = (d > 0.0 ? std::sqrt(d) : 0.0);
-          par += 0.5*m_b[i]*(m_S[i] - (1.0 - m_S[i])*par)*dt + d*dW[i];
+          auto par = particles.cview( i, m_offset );
+          const auto k = m_k[i], b = m_b[i], S = m_S[i];
+          const auto dWi = dW + i*n;
+          #pragma omp simd
+          for (ncomp_t q=0; q<n; ++q) {
+            tk::real& y = par[ p0+q ];
+            tk::real d = k * y * dt;
+            d = (d > 0.0 ? std::sqrt(d) : 0.0);
+            y += 0.5*b*(S - (1.0 - S)*y)*dt + d*dWi[q];
+          }
         }
       }
     }
 
+    //! Pack/Unpack random numbers not yet used kept between time steps
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    void pupstate( PUP::er& p ) { p | m_dW; }
+
   private:
     const ncomp_t m_c;                  //!< Equation system index
     const char m_depvar;                //!< Dependent variable
     const ncomp_t m_ncomp;              //!< Number of components
     const ncomp_t m_offset;             //!< Offset SDE operates from
     const tk::RNG& m_rng;               //!< Random number generator
+    tk::RNGBlock m_dW;                  //!< Blocks of Gaussian random numbers
 
     //! Coefficients
     std::vector< kw::sde_b::info::expect::type > m_b;
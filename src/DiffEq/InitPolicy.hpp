@@ -168,6 +168,7 @@ struct InitBeta {
     const ncomp_t size = std::min( ncomp, betapdf.size() );
 
     const auto eps = std::numeric_limits< tk::real >::epsilon();
+    std::vector< tk::real > r( particles.nunk() );
 
     for (ncomp_t c=0; c<size; ++c) {
       // get vector of betapdf parameters for component c
@@ -175,13 +176,11 @@ struct InitBeta {
 
       for (ncomp_t s=0; s<bc.size(); s+=4) {
         // generate beta random numbers for all particles using parameters in bc
-        for (ncomp_t p=0; p<particles.nunk(); ++p) {
-          rng.beta( stream, 1, bc[s], bc[s+1], bc[s+2], bc[s+3],
-                    &particles( p, c, offset ) );
-          auto& v = particles( p, c, offset );
-          if (v < eps) v = eps;
-          if (v > 1.0-eps) v = 1.0-eps;
-        }
+        rng.beta( stream, r.size(), bc[s], bc[s+1], bc[s+2], bc[s+3],
+                  r.data() );
+        for (ncomp_t p=0; p<particles.nunk(); ++p)
+          particles( p, c, offset ) = std::min( std::max( r[p], eps ),
+                                                1.0-eps );
       }
     }
 
@@ -213,20 +212,20 @@ struct InitGaussian {
     // use only the first ncomp gaussian if there are more than the equation is
     // configured for
     const ncomp_t size = std::min( ncomp, gaussian.size() );
+    std::vector< tk::real > r( particles.nunk() );
 
     for (ncomp_t c=0; c<size; ++c) {
       // get vector of gaussian pdf parameters for component c
       const auto& gc = gaussian[c];
 
       for (ncomp_t s=0; s<gc.size(); s+=2) {
-        // generate Gaussian random numbers for all particles using parameters
-        for (ncomp_t p=0; p<particles.nunk(); ++p) {
-          auto& par = particles( p, c, offset );
-          // sample from Gaussian with zero mean and unit variance
-          rng.gaussian( stream, 1, &par );
-          // scale to given mean and variance
-          par = par * sqrt(gc[s+1]) + gc[s];
-        }
+        // sample from Gaussian with zero mean and unit variance for all
+        // particles at once
+        rng.gaussian( stream, r.size(), r.data() );
+        // scale to given mean and variance
+        const auto sd = sqrt( gc[s+1] );
+        for (ncomp_t p=0; p<particles.nunk(); ++p)
+          particles( p, c, offset ) = r[p] * sd + gc[s];
       }
     }
 
@@ -305,14 +304,17 @@ struct InitGamma {
     // use only the first ncomp gamma if there are more than the equation is
     // configured for
     const ncomp_t size = std::min( ncomp, gamma.size() );
+    std::vector< tk::real > r( particles.nunk() );
 
     for (ncomp_t c=0; c<size; ++c) {
       // get vector of gamma pdf parameters for component c
       const auto& gc = gamma[c];
       // generate gamma random numbers for all particles using parameters in gc
-      for (ncomp_t s=0; s<gc.size(); s+=2)
+      for (ncomp_t s=0; s<gc.size(); s+=2) {
+        rng.gamma( stream, r.size(), gc[s], gc[s+1], r.data() );
         for (ncomp_t p=0; p<particles.nunk(); ++p)
-          rng.gamma( stream, 1, gc[s], gc[s+1], &particles( p, c, offset ) );
+          particles( p, c, offset ) = r[p];
+      }
     }
 
   }
@@ -79,10 +79,12 @@
 
 #include <vector>
 #include <cmath>
+#include <algorithm>
 
 #include "InitPolicy.hpp"
 #include "DiagOrnsteinUhlenbeckCoeffPolicy.hpp"
 #include "RNG.hpp"
+#include "RNGBlock.hpp"
 #include "Particles.hpp"
 
 namespace walker {
@@ -117,6 +119,7 @@ class DiagOrnsteinUhlenbeck {
       m_offset( g_inputdeck.get< tag::component >().offset< tag::diagou >(c) ),
       m_rng( g_rng.at( tk::ctr::raw(
         g_inputdeck.get< tag::param, tag::diagou, tag::rng >().at(c) ) ) ),
+      m_dW( m_rng ),
       m_sigmasq(),
       m_theta(),
       m_mu(),
@@ -148,17 +151,23 @@ class DiagOrnsteinUhlenbeck {
                   const std::map< tk::ctr::Product, tk::real >& )
     {
       const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
+      for (ncomp_t p0=0; p0<npar; p0+=tk::ParticleBlkWidth) {
+        const auto n = std::min( tk::ParticleBlkWidth, npar-p0 );
         // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
+        const auto dW = m_dW.gaussian( stream, n*m_ncomp );
 
-        // Advance all m_ncomp scalars
+        // Advance all m_ncomp scalars of a block of particles
         for (ncomp_t i=0; i<m_ncomp; ++i) {
-          tk::real& par = particles( p, i, m_offset );
+          auto par = particles.cview( i, m_offset );
           tk::real d = m_sigmasq[i] * dt;
           d = (d > 0.0 ? std::sqrt(d) : 0.0);
-          par += m_theta[i]*(m_mu[i] - par)*dt + d*dW[i];
+          const auto theta = m_theta[i], mu = m_mu[i];
+          const auto dWi = dW + i*n;
+          #pragma omp simd
+          for (ncomp_t q=0; q<n; ++q) {
+            tk::real& y = par[ p0+q ];
+            y += theta*(mu - y)*dt + d*dWi[q];
+          }
         }
       }
     }
@@ -169,6 +178,7 @@ class DiagOrnsteinUhlenbeck {
     const ncomp_t m_ncomp;              //!< Number of components
     const ncomp_t m_offset;             //!< Offset SDE operates from
     const tk::RNG& m_rng;               //!< Random number generator
+    tk::RNGBlock m_dW;                  //!< Blocks of Gaussian random numbers
 
     //! Coefficients
     std::vector< kw::sde_sigmasq::info::expect::type > m_sigmasq;
@@ -76,6 +76,7 @@
 
 #include <vector>
 #include <cmath>
+#include <algorithm>
 
 #include "QuinoaConfig.hpp"
 
@@ -88,6 +89,7 @@
 #include "InitPolicy.hpp"
 #include "OrnsteinUhlenbeckCoeffPolicy.hpp"
 #include "RNG.hpp"
+#include "RNGBlock.hpp"
 #include "Particles.hpp"
 
 namespace walker {
@@ -121,6 +123,7 @@ class OrnsteinUhlenbeck {
       m_offset( g_inputdeck.get< tag::component >().offset< tag::ou >(c) ),
       m_rng( g_rng.at( tk::ctr::raw(
         g_inputdeck.get< tag::param, tag::ou, tag::rng >().at(c) ) ) ),
+      m_dW( m_rng ),
       m_sigma(),
       m_theta(),
       m_mu(),
@@ -161,18 +164,25 @@ class OrnsteinUhlenbeck {
                   const std::map< tk::ctr::Product, tk::real >& )
     {
       const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
+      for (ncomp_t p0=0; p0<npar; p0+=tk::ParticleBlkWidth) {
+        const auto n = std::min( tk::ParticleBlkWidth, npar-p0 );
         // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
+        const auto dW = m_dW.gaussian( stream, n*m_ncomp );
 
-        // Advance all m_ncomp scalars
+        // Advance all m_ncomp scalars of a block of particles
         for (ncomp_t i=0; i<m_ncomp; ++i) {
-          tk::real& par = particles( p, i, m_offset );
-          par += m_theta[i]*(m_mu[i] - par)*dt;
+          auto par = particles.cview( i, m_offset );
+          const auto theta = m_theta[i], mu = m_mu[i];
+          #pragma omp simd
+          for (ncomp_t q=0; q<n; ++q) {
+            tk::real& y = par[ p0+q ];
+            y += theta*(mu - y)*dt;
+          }
           for (ncomp_t j=0; j<m_ncomp; ++j) {
             tk::real d = m_sigma[ j*m_ncomp+i ] * sqrt(dt);     // use transpose
-            par += d*dW[j];
+            const auto dWj = dW + j*n;
+            #pragma omp simd
+            for (ncomp_t q=0; q<n; ++q) par[ p0+q ] += d*dWj[q];
           }
         }
       }
@@ -184,6 +194,7 @@ class OrnsteinUhlenbeck {
     const ncomp_t m_ncomp;              //!< Number of components
     const ncomp_t m_offset;             //!< Offset SDE operates from
     const tk::RNG& m_rng;               //!< Random number generator
+    tk::RNGBlock m_dW;                  //!< Blocks of Gaussian random numbers
 
     //! Coefficients
     std::vector< kw::sde_sigmasq::info::expect::type > m_sigma;
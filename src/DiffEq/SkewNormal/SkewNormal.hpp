@@ -75,6 +75,7 @@
 #include "InitPolicy.hpp"
 #include "SkewNormalCoeffPolicy.hpp"
 #include "RNG.hpp"
+#include "RNGBlock.hpp"
 #include "Particles.hpp"
 
 namespace walker {
@@ -110,6 +111,7 @@ class SkewNormal {
         g_inputdeck.get< tag::component >().offset< tag::skewnormal >(c) ),
       m_rng( g_rng.at( tk::ctr::raw(
         g_inputdeck.get< tag::param, tag::skewnormal, tag::rng >().at(c) ) ) ),
+      m_dW( m_rng ),
       m_T(),
       m_sigmasq(),
       m_lambda(),
@@ -146,8 +148,7 @@ class SkewNormal {
       const auto npar = particles.nunk();
       for (auto p=decltype(npar){0}; p<npar; ++p) {
         // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
+        const auto dW = m_dW.gaussian( stream, m_ncomp );
 
         // Advance all m_ncomp scalars
         for (ncomp_t i=0; i<m_ncomp; ++i) {
@@ -167,12 +168,17 @@ class SkewNormal {
       feupdateenv( &fe );
     }
 
+    //! Pack/Unpack random numbers not yet used kept between time steps
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    void pupstate( PUP::er& p ) { p | m_dW; }
+
   private:
     const ncomp_t m_c;                    //!< Equation system index
     const char m_depvar;                  //!< Dependent variable
     const ncomp_t m_ncomp;                //!< Number of components
     const ncomp_t m_offset;               //!< Offset SDE operates from
     const tk::RNG& m_rng;                 //!< Random number generator
+    tk::RNGBlock m_dW;                    //!< Blocks of Gaussian random numbers
 
     //! Coefficients
     std::vector< kw::sde_T::info::expect::type > m_T;
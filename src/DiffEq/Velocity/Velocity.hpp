@@ -20,10 +20,12 @@
 #include <array>
 #include <vector>
 #include <cmath>
+#include <algorithm>
 
 #include "InitPolicy.hpp"
 #include "VelocityCoeffPolicy.hpp"
 #include "RNG.hpp"
+#include "RNGBlock.hpp"
 #include "Particles.hpp"
 #include "CoupledEq.hpp"
 
@@ -73,6 +75,7 @@ class Velocity {
         g_inputdeck.get< tag::component >().offset< eq >(c) ),
       m_rng( g_rng.at( tk::ctr::raw(
         g_inputdeck.get< tag::param, eq, tag::rng >().at(c) ) ) ),
+      m_dW( m_rng ),
       m_position_coupled( coupled< eq, tag::position >( c ) ),
       m_position_depvar( depvar< eq, tag::position >( c ) ),
       m_position_offset( offset< eq, tag::position, tag::position_id >( c ) ),
@@ -99,7 +102,7 @@ class Velocity {
           g_inputdeck.get< tag::param, eq, tag::hydrotimescales >().at(c);
         Assert( hts.size() == 1,
                 "Velocity eq Hydrotimescales vector size must be 1" );
-        m_hts = ctr::HydroTimeScales().table( hts[0] );
+        m_hts = tk::IndexedTable( ctr::HydroTimeScales().table( hts[0] ) );
       }
       // Initialize gravity body force if configured
       const auto& gravity =
@@ -195,27 +198,41 @@ class Velocity {
         }
       }
 
+      // Compute diffusion
+      tk::real d = m_c0 * eps * dt;
+      d = (d > 0.0 ? std::sqrt(d) : 0.0);
+      const auto& G = m_G;
+
       const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
+      auto Ub = particles.cview( 0, m_offset );
+      auto Vb = particles.cview( 1, m_offset );
+      auto Wb = particles.cview( 2, m_offset );
+      for (ncomp_t p0=0; p0<npar; p0+=tk::ParticleBlkWidth) {
+        const auto n = std::min( tk::ParticleBlkWidth, npar-p0 );
         // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
-        // Access particle velocity
-        tk::real& Up = particles( p, 0, m_offset );
-        tk::real& Vp = particles( p, 1, m_offset );
-        tk::real& Wp = particles( p, 2, m_offset );
-        // Compute diffusion
-        tk::real d = m_c0 * eps * dt;
-        d = (d > 0.0 ? std::sqrt(d) : 0.0);
-        // Compute velocity fluctuation
-        tk::real u = Up - U[0];
-        tk::real v = Vp - U[1];
-        tk::real w = Wp - U[2];
-        // Update particle velocity based on Langevin model
-        Up += (m_G[0]*u + m_G[1]*v + m_G[2]*w)*dt + d*dW[0];
-        Vp += (m_G[3]*u + m_G[4]*v + m_G[5]*w)*dt + d*dW[1];
-        Wp += (m_G[6]*u + m_G[7]*v + m_G[8]*w)*dt + d*dW[2];
-        // Add gravity
+        const auto dW = m_dW.gaussian( stream, n*m_ncomp );
+        // Update velocity of a block of particles based on Langevin model
+        #pragma omp simd
+        for (ncomp_t q=0; q<n; ++q) {
+          // Access particle velocity
+          tk::real& Up = Ub[ p0+q ];
+          tk::real& Vp = Vb[ p0+q ];
+          tk::real& Wp = Wb[ p0+q ];
+          // Compute velocity fluctuation
+          tk::real u = Up - U[0];
+          tk::real v = Vp - U[1];
+          tk::real w = Wp - U[2];
+          Up += (G[0]*u + G[1]*v + G[2]*w)*dt + d*dW[q];
+          Vp += (G[3]*u + G[4]*v + G[5]*w)*dt + d*dW[n+q];
+          Wp += (G[6]*u + G[7]*v + G[8]*w)*dt + d*dW[2*n+q];
+        }
+      }
+
+      // Add gravity
+      for (auto p=decltype(npar){0}; p<npar; ++p) {
+        tk::real& Up = Ub[p];
+        tk::real& Vp = Vb[p];
+        tk::real& Wp = Wb[p];
         if (m_solve == ctr::DepvarType::PRODUCT ||
             m_solve == ctr::DepvarType::FLUCTUATING_MOMENTUM)
         {
@@ -240,6 +257,10 @@ class Velocity {
       }
     }
 
+    //! Pack/Unpack random numbers not yet used kept between time steps
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    void pupstate( PUP::er& p ) { p | m_dW; }
+
   private:
     const ncomp_t m_c;                  //!< Equation system index
     const char m_depvar;                //!< Dependent variable
@@ -258,6 +279,7 @@ class Velocity {
     const ncomp_t m_ncomp;              //!< Number of components
     const ncomp_t m_offset;             //!< Offset SDE operates from
     const tk::RNG& m_rng;               //!< Random number generator
+    tk::RNGBlock m_dW;                  //!< Blocks of Gaussian random numbers
 
     const bool m_position_coupled;      //!< True if coupled to position
     const char m_position_depvar;       //!< Coupled position dependent variable
@@ -275,7 +297,7 @@ class Velocity {
     //! Selected inverse hydrodynamics time scale (if used)
     //! \details This is only used if the coefficients policy is
     //!   VelocityCoeffHydroTimeScale. See constructor.
-    tk::Table m_hts;
+    tk::IndexedTable m_hts;
 
     //! Coefficients
     kw::sde_c0::info::expect::type m_c0;
@@ -38,7 +38,7 @@ walker::VelocityCoeffConstShear::update(
   char depvar,
   char dissipation_depvar,
   const std::map< tk::ctr::Product, tk::real >& moments,
-  const tk::Table&,
+  const tk::IndexedTable&,
   ctr::DepvarType solve,
   ctr::VelocityVariantType variant,
   kw::sde_c0::info::expect::type C0,
@@ -104,7 +104,7 @@ walker::VelocityCoeffStationary::update(
   char,
   char,
   const std::map< tk::ctr::Product, tk::real >&,
-  const tk::Table&,
+  const tk::IndexedTable&,
   ctr::DepvarType,
   ctr::VelocityVariantType,
   kw::sde_c0::info::expect::type C0,
@@ -160,7 +160,7 @@ walker::VelocityCoeffHydroTimeScale::update(
   char depvar,
   char,
   const std::map< tk::ctr::Product, tk::real >& moments,
-  const tk::Table& hts,
+  const tk::IndexedTable& hts,
   ctr::DepvarType solve,
   ctr::VelocityVariantType,
   kw::sde_c0::info::expect::type C0,
@@ -186,7 +186,7 @@ walker::VelocityCoeffHydroTimeScale::update(
   auto k = tke( depvar, solve, moments );
 
   // Sample the inverse hydrodynamics timescale at time t
-  auto ts = tk::sample( t, hts );  // eps/k
+  auto ts = hts.sample( t, m_hts_win );  // eps/k
 
   // compute turbulent kinetic energy dissipation rate
   eps = ts * k;
@@ -32,7 +32,7 @@
         void update( char depvar,
                      char dissipation_depvar,
                      const std::map< tk::ctr::Product, tk::real >& moments,
-                     const tk::Table& hts,
+                     const tk::IndexedTable& hts,
                      ctr::DepvarType solve,
                      ctr::VelocityVariantType variant,
                      kw::sde_c0::info::expect::type C0,
@@ -95,7 +95,7 @@ class VelocityCoeffConstShear {
     void update( char depvar,
                  char dissipation_depvar,
                  const std::map< tk::ctr::Product, tk::real >& moments,
-                 const tk::Table&,
+                 const tk::IndexedTable&,
                  ctr::DepvarType solve,
                  ctr::VelocityVariantType variant,
                  kw::sde_c0::info::expect::type C0,
@@ -127,7 +127,7 @@ class VelocityCoeffStationary {
     void update( char /*depvar*/,
                  char,
                  const std::map< tk::ctr::Product, tk::real >&,
-                 const tk::Table&,
+                 const tk::IndexedTable&,
                  ctr::DepvarType,
                  ctr::VelocityVariantType,
                  kw::sde_c0::info::expect::type C0,
@@ -155,13 +155,17 @@ class VelocityCoeffHydroTimeScale {
     void update( char depvar,
                  char,
                  const std::map< tk::ctr::Product, tk::real >& moments,
-                 const tk::Table& hts,
+                 const tk::IndexedTable& hts,
                  ctr::DepvarType solve,
                  ctr::VelocityVariantType,
                  kw::sde_c0::info::expect::type C0,
                  tk::real t,
                  tk::real& eps,
                  std::array< tk::real, 9 >& G ) const;
+
+  private:
+    //! Table segment of hydro time scale cached, looked up again once t leaves
+    mutable tk::IndexedTable::Window m_hts_win;
 };
 
 //! List of all Velocity's coefficients policies
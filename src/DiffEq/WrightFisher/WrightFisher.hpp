@@ -31,6 +31,7 @@
 #include "InitPolicy.hpp"
 #include "WrightFisherCoeffPolicy.hpp"
 #include "RNG.hpp"
+#include "RNGBlock.hpp"
 #include "Particles.hpp"
 
 namespace walker {
@@ -79,6 +80,7 @@ class WrightFisher {
         g_inputdeck.get< tag::component >().offset< tag::wrightfisher >(c) ),
       m_rng( g_rng.at( tk::ctr::raw(
         g_inputdeck.get< tag::param, tag::wrightfisher, tag::rng >().at(c) ) ) ),
+      m_dW( m_rng ),
       m_omega(),
       coeff(
         m_ncomp,
@@ -229,8 +231,7 @@ class WrightFisher {
             // lower triangle (diffusion matrix)
             for (ncomp_t j=0; j<m_ncomp-1; ++j)
               if (j<=i) {
-                tk::real dW;
-                m_rng.gaussian( stream, 1, &dW );
+                const auto dW = *m_dW.gaussian( stream, 1 );
                 par += B[i][j] * sqrt(dt) * dW;
               }
           }
@@ -250,12 +251,17 @@ class WrightFisher {
       #endif
     }
 
+    //! Pack/Unpack random numbers not yet used kept between time steps
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    void pupstate( PUP::er& p ) { p | m_dW; }
+
   private:
     const ncomp_t m_c;                  //!< Equation system index
     const char m_depvar;                //!< Dependent variable
     const ncomp_t m_ncomp;              //!< Number of components
     const ncomp_t m_offset;             //!< Offset SDE operates from
     const tk::RNG& m_rng;               //!< Random number generator
+    tk::RNGBlock m_dW;                  //!< Blocks of Gaussian random numbers
 
     //! Coefficients
     std::vector< kw::sde_omega::info::expect::type > m_omega;
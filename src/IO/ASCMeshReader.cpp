@@ -22,6 +22,7 @@
 #include "UnsMesh.hpp"
 #include "Reorder.hpp"
 #include "ASCMeshReader.hpp"
+#include "TextParser.hpp"
 
 using tk::ASCMeshReader;
 
@@ -84,16 +85,30 @@ ASCMeshReader::readNodes( UnsMesh& mesh )
   ErrChk( nnode > 0,
           "Number of nodes must be greater than zero in file " + m_filename  );
 
+  getline( m_inFile, s );  // finish reading the line
+
   // Read in node coordinates: x-coord y-coord z-coord, ignore node IDs, assume
   // sorted
-  for (int i=0; i<nnode; ++i) {
-    int n;
-    tk::real x, y, z;
-    m_inFile >> n >> x >> y >> z;
-    mesh.x().push_back( x );
-    mesh.y().push_back( y );
-    mesh.z().push_back( z );
-  }
+  auto& x = mesh.x();
+  auto& y = mesh.y();
+  auto& z = mesh.z();
+  using Coords = std::array< std::vector< tk::real >, 3 >;
+  auto ok = tk::parseLines< Coords >( m_inFile,
+                                      static_cast< std::size_t >( nnode ),
+    []( const char* p, Coords& c ){
+      int n;
+      if (!(p = tk::parseInt( p, n ))) return false;
+      for (std::size_t d=0; d<3; ++d) {
+        tk::real r;
+        if (!(p = tk::parseReal( p, r ))) return false;
+        c[d].push_back( r );
+      }
+      return true; },
+    [&]( const Coords& c ){
+      x.insert( end(x), begin(c[0]), end(c[0]) );
+      y.insert( end(y), begin(c[1]), end(c[1]) );
+      z.insert( end(z), begin(c[2]), end(c[2]) ); } );
+  ErrChk( ok, "Failed to read nodes in file " + m_filename );
 }
 
 void
@@ -113,18 +128,29 @@ ASCMeshReader::readElements( UnsMesh& mesh )
   ErrChk( nel > 0,
           "Number of cells must be greater than zero in file " + m_filename  );
 
-  // Read in tetrahedra element tags and connectivity
-  for (int i=0; i<nel; ++i) {
-    int a, b, c;
-    std::array< std::size_t, 4 > n;
-    // ignore cell id, a, b
-    m_inFile >> a >> b >> c >> n[3] >> n[0] >> n[1] >> n[2];
-    mesh.tetinpoel().push_back( n[0] );
-    mesh.tetinpoel().push_back( n[1] );
-    // switch nodes 2 and 3 to enforce positive volume
-    mesh.tetinpoel().push_back( n[3] );
-    mesh.tetinpoel().push_back( n[2] );
-  }
+  getline( m_inFile, s );  // finish reading the line
+
+  // Read in tetrahedra element tags and connectivity: ignore cell id, a, b
+  auto& tetinpoel = mesh.tetinpoel();
+  auto ok = tk::parseLines< std::vector< std::size_t > >( m_inFile,
+    static_cast< std::size_t >( nel ),
+    []( const char* p, std::vector< std::size_t >& inpoel ){
+      int a;
+      std::array< std::size_t, 4 > n;
+      for (std::size_t j=0; j<3; ++j)
+        if (!(p = tk::parseInt( p, a ))) return false;
+      if (!(p = tk::parseInt( p, n[3] ))) return false;
+      for (std::size_t j=0; j<3; ++j)
+        if (!(p = tk::parseInt( p, n[j] ))) return false;
+      inpoel.push_back( n[0] );
+      inpoel.push_back( n[1] );
+      // switch nodes 2 and 3 to enforce positive volume
+      inpoel.push_back( n[3] );
+      inpoel.push_back( n[2] );
+      return true; },
+    [&]( const std::vector< std::size_t >& inpoel ){
+      tetinpoel.insert( end(tetinpoel), begin(inpoel), end(inpoel) ); } );
+  ErrChk( ok, "Failed to read cells in file " + m_filename );
 
   // Shift node IDs to start from zero
   shiftToZero( mesh.tetinpoel() );
@@ -0,0 +1,90 @@
+// *****************************************************************************
+/*!
+  \file      src/IO/BinStatWriter.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Binary statistics writer definition
+  \details   This file defines the binary statistics writer class that
+     facilitates outputing statistics to raw columnar binary files.
+*/
+// *****************************************************************************
+
+#include "BinStatWriter.hpp"
+#include "Exception.hpp"
+
+using tk::BinStatWriter;
+
+BinStatWriter::BinStatWriter( const std::string& filename,
+                              std::ios_base::openmode mode ) :
+  Writer( filename, mode | std::ios_base::binary )
+// *****************************************************************************
+//  Constructor
+//! \param[in] filename Output filename to which output the statistics
+//! \param[in] mode Configure file open mode
+// *****************************************************************************
+{
+}
+
+void
+BinStatWriter::header( const std::vector< std::string >& nameOrd,
+                       const std::vector< std::string >& nameCen,
+                       const std::vector< std::string >& nameExt ) const
+// *****************************************************************************
+//  Write out statistics file header
+//! \param[in] nameOrd Vector of strings with the names of ordinary moments
+//! \param[in] nameCen Vector of strings with the names of central moments
+//! \param[in] nameExt Vector of strings with the names of extra data
+// *****************************************************************************
+{
+  m_outFile << "quinoa binary statistics 1\n"
+            << 2 + nameOrd.size() + nameCen.size() + nameExt.size() << '\n'
+            << "it\nt\n";
+
+  for (const auto& n : nameOrd) m_outFile << '<' << n << ">\n";
+  for (const auto& c : nameCen) m_outFile << '<' << c << ">\n";
+  for (const auto& c : nameExt) m_outFile << '<' << c << ">\n";
+
+  m_outFile << "end\n";
+  m_outFile.flush();
+}
+
+std::size_t
+BinStatWriter::stat( uint64_t it,
+                     tk::real t,
+                     const std::vector< tk::real >& ordinary,
+                     const std::vector< tk::real >& central,
+                     const std::vector< tk::real >& extra )
+// *****************************************************************************
+//  Write out statistics
+//! \param[in] it Iteration counter
+//! \param[in] t Time
+//! \param[in] ordinary Vector with the ordinary moment statistics
+//! \param[in] central Vector with the central moment statistics
+//! \param[in] extra Vector with extra data to be also written (besides stats)
+//! \return The total number of statistics written to the output file
+// *****************************************************************************
+{
+  const auto n = ordinary.size() + central.size() + extra.size();
+
+  // nothing to write to if the file was not opened, see tk::Writer
+  if (m_filename.empty()) return n;
+
+  const auto real = static_cast< std::streamsize >( sizeof(tk::real) );
+
+  write( reinterpret_cast< const char* >( &it ), sizeof(uint64_t) );
+  write( reinterpret_cast< const char* >( &t ), real );
+
+  auto out = [&]( const std::vector< tk::real >& v ){
+    write( reinterpret_cast< const char* >( v.data() ),
+           static_cast< std::streamsize >( v.size() ) * real );
+  };
+  out( ordinary );
+  out( central );
+  out( extra );
+
+  ErrChk( !m_outFile.bad(), "Failed to write to file: " + m_filename );
+
+  return n;
+}
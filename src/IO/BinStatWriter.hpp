@@ -0,0 +1,58 @@
+// *****************************************************************************
+/*!
+  \file      src/IO/BinStatWriter.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Binary statistics writer declaration
+  \details   This file declares the binary statistics writer class that
+     facilitates outputing statistics to raw columnar binary files. The file
+     starts with a text header: the line "quinoa binary statistics 1", the
+     number of columns, and the name of each column in a separate line, closed
+     by a line "end". The header is followed by a fixed-size record for each
+     output: the iteration count as a 64-bit unsigned integer and a 64-bit
+     floating-point number for each further column, starting with the time,
+     all in native byte order. The records can thus be read without parsing,
+     e.g., by numpy.fromfile() with a structured dtype and an offset of the
+     size of the header.
+*/
+// *****************************************************************************
+#ifndef BinStatWriter_h
+#define BinStatWriter_h
+
+#include <string>
+#include <vector>
+
+#include "Types.hpp"
+#include "Writer.hpp"
+
+namespace tk {
+
+//! \brief BinStatWriter : tk::Writer
+//! \details Binary statistics writer class that facilitates outputing
+//!   statistics to raw columnar binary files, appending a record at each
+//!   output, avoiding the cost of formatting floating-point numbers.
+class BinStatWriter : public tk::Writer {
+
+  public:
+    //! Constructor
+    explicit BinStatWriter( const std::string& filename,
+                            std::ios_base::openmode mode = std::ios_base::out );
+
+    //! Write out statistics file header
+    void header( const std::vector< std::string >& nameOrd,
+                 const std::vector< std::string >& nameCen,
+                 const std::vector< std::string >& nameExt ) const;
+
+    //! Write statistics file
+    std::size_t stat( uint64_t it,
+                      tk::real t,
+                      const std::vector< tk::real >& ordinary,
+                      const std::vector< tk::real >& central,
+                      const std::vector< tk::real >& extra );
+};
+
+} // tk::
+
+#endif // BinStatWriter_h
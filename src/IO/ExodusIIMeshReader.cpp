@@ -10,6 +10,8 @@
 */
 // *****************************************************************************
 
+#include <algorithm>
+#include <cmath>
 #include <numeric>
 
 #include "NoWarning/exodusII.hpp"
@@ -18,6 +20,7 @@
 #include "ContainerUtil.hpp"
 #include "Exception.hpp"
 #include "UnsMesh.hpp"
+#include "PrimitiveTable.hpp"
 #include "Reorder.hpp"
 
 using tk::ExodusIIMeshReader;
@@ -38,7 +41,8 @@ ExodusIIMeshReader::ExodusIIMeshReader( const std::string& filename,
   m_blockid_by_type( ExoNnpe.size() ),
   m_nel( ExoNnpe.size() ),
   m_elemblocks(),
-  m_tri()
+  m_tri(),
+  m_tet()
 // *****************************************************************************
 //  Constructor: open Exodus II file
 //! \param[in] filename File to open as ExodusII file
@@ -105,7 +109,8 @@ ExodusIIMeshReader::readMeshPart(
   std::vector< std::size_t >& triinp,
   std::unordered_map< std::size_t, std::size_t >& lid,
   tk::UnsMesh::Coords& coord,
-  int numpes, int mype )
+  int numpes, int mype, bool readtri,
+  const std::string& partvar )
 // *****************************************************************************
 //  Read a part of the mesh (graph and coordinates) from ExodusII file
 //! \param[in,out] ginpoel Container to store element connectivity of this PE's
@@ -113,13 +118,24 @@ ExodusIIMeshReader::readMeshPart(
 //! \param[in,out] inpoel Container to store element connectivity with local
 //!   node IDs of this PE's mesh chunk
 //! \param[in,out] triinp Container to store triangle element connectivity
-//!   (if exists in file) with global node indices
+//!   (if exists in file) with global node indices of the triangles that are
+//!   faces of this PE's mesh chunk
 //! \param[in,out] lid Container to store global->local node IDs of elements of
 //!   this PE's mesh chunk
 //! \param[in,out] coord Container to store coordinates of mesh nodes of this
 //!   PE's mesh chunk
 //! \param[in] numpes Total number of PEs (default n = 1, for a single-CPU read)
 //! \param[in] mype This PE (default m = 0, for a single-CPU read)
+//! \param[in] readtri True to read the triangles that are faces of this PE's
+//!   mesh chunk. This reads all triangle elements in the file, so for reading
+//!   in parallel, pass false and distribute the triangles read in chunks by
+//!   readTriangleChunk() instead, then pass the triangles found to be faces
+//!   of the mesh chunk to ownTriangles().
+//! \param[in] partvar Name of the element variable storing the PE of each
+//!   tetrahedron, e.g., written by a previous partitioning of the mesh. If
+//!   empty, the tetrahedra are read in equal contiguous chunks of element ids
+//!   among the PEs. If given, each PE reads the tetrahedra assigned to it,
+//!   thus the mesh read needs no redistribution.
 // *****************************************************************************
 {
   Assert( mype < numpes, "Invalid input: PE id must be lower than NumPEs" );
@@ -132,16 +148,36 @@ ExodusIIMeshReader::readMeshPart(
   // Get number of number of tetrahedron elements in file
   auto nel = nelem( tk::ExoElemType::TET );
 
-  // Compute extents of element IDs of this PE's mesh chunk to read
   auto npes = static_cast< std::size_t >( numpes );
   auto pe = static_cast< std::size_t >( mype );
-  auto chunk = nel / npes;
-  m_from = pe * chunk;
-  m_till = m_from + chunk;
-  if (pe == npes-1) m_till += nel % npes;
 
-  // Read tetrahedron connectivity between from and till
-  readElements( {{m_from, m_till-1}}, tk::ExoElemType::TET, ginpoel );
+  if (partvar.empty()) {
+
+    // Compute extents of element IDs of this PE's mesh chunk to read
+    auto chunk = nel / npes;
+    m_from = pe * chunk;
+    m_till = m_from + chunk;
+    if (pe == npes-1) m_till += nel % npes;
+
+    // Read tetrahedron connectivity between from and till
+    readElements( {{m_from, m_till-1}}, tk::ExoElemType::TET, ginpoel );
+
+  } else {
+
+    // Read tetrahedron connectivity assigned to this PE, in runs of
+    // consecutive element ids
+    auto tetid = readPartition( partvar, npes, pe );
+    m_from = m_till = 0;
+    m_tet.clear();
+    for (std::size_t i=0; i<tetid.size(); ) {
+      auto j = i;
+      while (j+1 < tetid.size() && tetid[j+1] == tetid[j]+1) ++j;
+      readElements( {{tetid[i], tetid[j]}}, tk::ExoElemType::TET, ginpoel );
+      i = j+1;
+    }
+    for (std::size_t t=0; t<tetid.size(); ++t) m_tet[ tetid[t] ] = t;
+
+  }
 
   // Compute local data from global mesh connectivity
   std::vector< std::size_t > gid;
@@ -150,33 +186,82 @@ ExodusIIMeshReader::readMeshPart(
   // Read this PE's chunk of the mesh node coordinates from file
   coord = readCoords( gid );
 
-  // Generate set of unique faces
-  tk::UnsMesh::FaceSet faces;
+  if (!readtri) return;
+
+  // Generate table of unique faces
+  tk::FaceTable faces;
+  faces.reserve( ginpoel.size() );
   for (std::size_t e=0; e<ginpoel.size()/4; ++e)
     for (std::size_t f=0; f<4; ++f) {
       const auto& tri = tk::expofa[f];
-      faces.insert( {{{ ginpoel[ e*4+tri[0] ],
-                        ginpoel[ e*4+tri[1] ],
-                        ginpoel[ e*4+tri[2] ] }}} );
+      faces.insert( {{ ginpoel[ e*4+tri[0] ],
+                       ginpoel[ e*4+tri[1] ],
+                       ginpoel[ e*4+tri[2] ] }} );
     }
+  faces.finalize();
 
   // Read triangle element connectivity (all triangle blocks in file)
-  auto ntri = nelem( tk::ExoElemType::TRI );
-  if ( ntri !=0 ) readElements( {{0,ntri-1}}, tk::ExoElemType::TRI, triinp );
+  readTriangleChunk( triinp, 1, 0 );
 
   // Keep triangles shared in (partially-read) tetrahedron mesh
-  std::vector< std::size_t > triinp_own;
-  std::size_t ltrid = 0;        // local triangle id
+  std::vector< std::size_t > triinp_own, triid;
   for (std::size_t e=0; e<triinp.size()/3; ++e) {
-    auto i = faces.find( {{ triinp[e*3+0], triinp[e*3+1], triinp[e*3+2] }} );
-    if (i != end(faces)) {
-      m_tri[e] = ltrid++;       // generate global->local triangle ids
+    if (faces.contains( {{ triinp[e*3+0], triinp[e*3+1], triinp[e*3+2] }} )) {
+      triid.push_back( e );
       triinp_own.push_back( triinp[e*3+0] );
       triinp_own.push_back( triinp[e*3+1] );
       triinp_own.push_back( triinp[e*3+2] );
     }
   }
   triinp = std::move(triinp_own);
+  ownTriangles( triid );
+}
+
+std::size_t
+ExodusIIMeshReader::readTriangleChunk( std::vector< std::size_t >& triinp,
+                                       int numpes,
+                                       int mype ) const
+// *****************************************************************************
+//  Read a chunk of the triangle elements from ExodusII file
+//! \param[in,out] triinp Container to store triangle element connectivity of
+//!   this PE's chunk of the triangles with global node indices
+//! \param[in] numpes Total number of PEs the triangles are read by
+//! \param[in] mype This PE
+//! \return Triangle element id (counting all triangle blocks in file) of the
+//!   first triangle read, the ids of the triangles read are consecutive
+//! \details The triangles are split into equal contiguous chunks among the
+//!   PEs, the same way as the tetrahedra in readMeshPart(), with the last PE
+//!   also reading the remainder.
+//! \note Must be preceded by a call to readElemBlockIDs()
+// *****************************************************************************
+{
+  Assert( mype < numpes, "Invalid input: PE id must be lower than NumPEs" );
+
+  auto ntri = nelem( tk::ExoElemType::TRI );
+  auto npes = static_cast< std::size_t >( numpes );
+  auto pe = static_cast< std::size_t >( mype );
+  auto chunk = ntri / npes;
+  auto from = pe * chunk;
+  auto till = from + chunk;
+  if (pe == npes-1) till += ntri % npes;
+
+  if (till > from)
+    readElements( {{from, till-1}}, tk::ExoElemType::TRI, triinp );
+
+  return from;
+}
+
+void
+ExodusIIMeshReader::ownTriangles( const std::vector< std::size_t >& triid )
+// *****************************************************************************
+//  Store the triangle elements that are faces of this PE's mesh chunk
+//! \param[in] triid Triangle element ids (counting all triangle blocks in
+//!   file) of the triangles that are faces of this PE's mesh chunk, in the
+//!   order of their connectivity passed to triinpoel()
+// *****************************************************************************
+{
+  m_tri.clear();
+  for (std::size_t t=0; t<triid.size(); ++t) m_tri[ triid[t] ] = t;
 }
 
 std::array< std::vector< tk::real >, 3 >
@@ -305,13 +390,58 @@ ExodusIIMeshReader::readNodes( const std::vector< std::size_t >& gid ) const
 // *****************************************************************************
 //  Read coordinates of a number of mesh nodes from ExodusII file
 //! \param[in] gid Node IDs whose coordinates to read
-//! \return Mesh node coordinates
+//! \return Mesh node coordinates, in the order of gid
+//! \details Instead of reading the nodes one by one, the node ids are sorted
+//!   and coalesced into ranges of consecutive ids, each of which is read by a
+//!   single partial read. Ranges are merged across gaps of ids not requested
+//!   if the gap is small, as reading a few extra nodes is cheaper than
+//!   starting another read, and ranges are limited in length, which bounds
+//!   the size of the read buffers. The coordinates read are then scattered
+//!   into the order of gid.
 // *****************************************************************************
 {
+  // Largest number of node ids not requested read to merge two ranges
+  const std::size_t maxgap = 64;
+  // Largest number of nodes read at once
+  const std::size_t maxrange = 1UL << 20;
+
   std::vector< tk::real > px( gid.size() ), py( gid.size() ), pz( gid.size() );
 
-  std::size_t i=0;
-  for (auto g : gid) readNode( g, i++, px, py, pz );
+  // Order of node ids sorted
+  std::vector< std::size_t > order( gid.size() );
+  std::iota( begin(order), end(order), 0 );
+  std::sort( begin(order), end(order),
+             [&]( std::size_t a, std::size_t b ){ return gid[a] < gid[b]; } );
+
+  std::vector< tk::real > x, y, z;
+  for (std::size_t i=0; i<order.size(); ) {
+    // Find range of node ids [first,last] to read
+    const auto first = gid[ order[i] ];
+    auto j = i+1;
+    while (j < order.size() && gid[order[j]] - gid[order[j-1]] <= maxgap+1 &&
+           gid[order[j]] - first < maxrange) ++j;
+    const auto last = gid[ order[j-1] ];
+
+    // Read range of nodes
+    const auto n = last - first + 1;
+    x.resize( n );
+    y.resize( n );
+    z.resize( n );
+    ErrChk(
+      ex_get_partial_coord( m_inFile, static_cast<int64_t>(first)+1,
+                            static_cast<int64_t>(n), x.data(), y.data(),
+                            z.data() ) == 0,
+      "Failed to read coordinates of nodes " + std::to_string(first) + "-" +
+      std::to_string(last) + " from ExodusII file: " + m_filename );
+
+    // Scatter nodes requested into the order of gid
+    for (; i<j; ++i) {
+      const auto k = gid[ order[i] ] - first;
+      px[ order[i] ] = x[k];
+      py[ order[i] ] = y[k];
+      pz[ order[i] ] = z[k];
+    }
+  }
 
   return {{ std::move(px), std::move(py), std::move(pz) }};
 }
@@ -739,6 +869,92 @@ ExodusIIMeshReader::blkRelElemId( std::size_t id ) const
   Throw( " Exodus internal element id not found" );
 }
 
+std::vector< std::size_t >
+ExodusIIMeshReader::readPartition( const std::string& partvar,
+                                   std::size_t npes,
+                                   std::size_t pe ) const
+// *****************************************************************************
+//  Read the ids of the tetrahedra assigned to a PE by an element variable
+//! \param[in] partvar Name of the element variable storing the PE of each
+//!   tetrahedron
+//! \param[in] npes Total number of PEs the mesh is read by
+//! \param[in] pe PE whose tetrahedra to return
+//! \return Tetrahedron element ids (counting all tetrahedron blocks in file)
+//!   whose partvar equals pe at the last time step in file, in increasing order
+//! \details The variable is read in chunks of bounded size, so reading it
+//!   requires memory proportional to the PE's share of the mesh only.
+//! \note Must be preceded by a call to readElemBlockIDs()
+// *****************************************************************************
+{
+  int numvars = 0;
+  ErrChk(
+    ex_get_variable_param( m_inFile, EX_ELEM_BLOCK, &numvars ) == 0,
+    "Failed to read element variable parameters from ExodusII file: " +
+    m_filename );
+
+  // Find element variable id of the partition
+  int varid = 0;
+  if (numvars) {
+    auto nv = static_cast< std::size_t >( numvars );
+    std::vector< std::vector< char > > buf( nv,
+      std::vector< char >( MAX_STR_LENGTH+1, 0 ) );
+    std::vector< char* > names;
+    for (auto& b : buf) names.push_back( b.data() );
+    ErrChk( ex_get_variable_names( m_inFile,
+                                   EX_ELEM_BLOCK,
+                                   numvars,
+                                   names.data() ) == 0,
+            "Failed to read element variable names from ExodusII file: " +
+            m_filename );
+    for (std::size_t i=0; i<nv; ++i)
+      if (partvar == names[i]) varid = static_cast< int >( i+1 );
+  }
+  ErrChk( varid > 0, "Element variable '" + partvar + "' storing the mesh "
+          "partition not found in ExodusII file: " + m_filename );
+
+  auto nstep = static_cast< int >( ex_inquire_int( m_inFile, EX_INQ_TIME ) );
+  ErrChk( nstep > 0, "Element variable '" + partvar + "' storing the mesh "
+          "partition has no time steps in ExodusII file: " + m_filename );
+
+  const auto e = static_cast< std::size_t >( tk::ExoElemType::TET );
+  const auto& nel = m_nel[e];
+  const auto& bid = m_blockid_by_type[e];
+  const std::size_t chunk = 1048576;
+
+  std::vector< std::size_t > tetid;
+  std::vector< tk::real > part;
+  std::size_t offset = 0;
+  for (std::size_t b=0; b<nel.size(); ++b) {
+    for (std::size_t from=0; from<nel[b]; from+=chunk) {
+      part.resize( std::min( chunk, nel[b]-from ) );
+      ErrChk( ex_get_partial_var( m_inFile,
+                                  nstep,
+                                  EX_ELEM_BLOCK,
+                                  varid,
+                                  bid[b],
+                                  static_cast< int64_t >( from+1 ),
+                                  static_cast< int64_t >( part.size() ),
+                                  part.data() ) == 0,
+              "Failed to read element variable '" + partvar + "' of element "
+              "block " + std::to_string(bid[b]) + " from ExodusII file: " +
+              m_filename );
+      for (std::size_t i=0; i<part.size(); ++i) {
+        auto p = std::lround( part[i] );
+        ErrChk( p >= 0 && static_cast< std::size_t >( p ) < npes,
+                "Element variable '" + partvar + "' in ExodusII file " +
+                m_filename + " assigns a tetrahedron to PE " +
+                std::to_string(p) + ", but the mesh is read by " +
+                std::to_string(npes) + " PEs" );
+        if (static_cast< std::size_t >( p ) == pe)
+          tetid.push_back( offset + from + i );
+      }
+    }
+    offset += nel[b];
+  }
+
+  return tetid;
+}
+
 std::vector< std::size_t >
 ExodusIIMeshReader::triinpoel(
   std::map< int, std::vector< std::size_t > >& belem,
@@ -762,7 +978,7 @@ ExodusIIMeshReader::triinpoel(
 //! \note Must be preceded by a call to readElemBlockIDs()
 // *****************************************************************************
 {
-  Assert( !(m_from == 0 && m_till == 0),
+  Assert( !m_tet.empty() || !(m_from == 0 && m_till == 0),
           "Lower and upper tetrahedron id bounds must not both be zero" );
 
   // This will contain one of our final results: face (triangle) connectivity
@@ -804,10 +1020,16 @@ ExodusIIMeshReader::triinpoel(
 
       } else if (r.first == tk::ExoElemType::TET) {
 
-        if (r.second >= m_from && r.second < m_till) {  // if tet is on this PE
-          auto t = r.second - m_from;
-          Assert( t < ginpoel.size()/4,
-                  "Indexing out of tetrahedron connectivity" );
+        // find local tet id, if tet is on this PE
+        auto t = ginpoel.size()/4;
+        if (!m_tet.empty()) {
+          auto i = m_tet.find( r.second );
+          if (i != end(m_tet)) t = i->second;
+        } else if (r.second >= m_from && r.second < m_till) {
+          t = r.second - m_from;
+        }
+
+        if (t < ginpoel.size()/4) {  // if tet is on this PE
           // get ExodusII face-node numbering for side sets, see ExodusII
           // manual figure on "Sideset side Numbering"
           const auto& tri = tk::expofa[ face[s] ];
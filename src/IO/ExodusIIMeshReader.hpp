@@ -73,7 +73,16 @@ class ExodusIIMeshReader {
                        std::vector< std::size_t >& triinp,
                        std::unordered_map< std::size_t, std::size_t >& lid,
                        tk::UnsMesh::Coords& coord,
-                       int numpes=1, int mype=0 );
+                       int numpes=1, int mype=0, bool readtri=true,
+                       const std::string& partvar = {} );
+
+    //! Read a chunk of the triangle elements from ExodusII file
+    std::size_t readTriangleChunk( std::vector< std::size_t >& triinp,
+                                   int numpes,
+                                   int mype ) const;
+
+    //! Store the triangle elements that are faces of this PE's mesh chunk
+    void ownTriangles( const std::vector< std::size_t >& triid );
 
     //! Read coordinates of a number of mesh nodes from ExodusII file
     std::array< std::vector< tk::real >, 3 >
@@ -158,6 +167,7 @@ class ExodusIIMeshReader {
       m_nel = x.m_nel;
       m_elemblocks = x.m_elemblocks;
       m_tri = x.m_tri;
+      m_tet = x.m_tet;
       return *this;
     }
 
@@ -186,6 +196,7 @@ class ExodusIIMeshReader {
       m_nel = x.m_nel;
       m_elemblocks = x.m_elemblocks;
       m_tri = x.m_tri;
+      m_tet = x.m_tet;
       x.m_cpuwordsize = sizeof(double);
       x.m_iowordsize = sizeof(double);
       x.m_inFile = ex_open( m_filename.c_str(), EX_READ, &x.m_cpuwordsize,
@@ -201,6 +212,7 @@ class ExodusIIMeshReader {
       x.m_nel.resize( ExoNnpe.size() );
       x.m_elemblocks.clear();
       x.m_tri.clear();
+      x.m_tet.clear();
       return *this;
     }
 
@@ -219,7 +231,8 @@ class ExodusIIMeshReader {
       m_blockid_by_type(),
       m_nel(),
       m_elemblocks(),
-      m_tri()
+      m_tri(),
+      m_tet()
     { *this = std::move(x); }
 
   private:
@@ -242,6 +255,9 @@ class ExodusIIMeshReader {
     std::vector< std::pair< ExoElemType, std::size_t > > m_elemblocks;
     //! Global->local triangle element ids on this PE
     std::unordered_map< std::size_t, std::size_t > m_tri;
+    //! \brief Global->local tetrahedron ids on this PE if read by partition,
+    //!   empty if the contiguous range [m_from, m_till) is read
+    std::unordered_map< std::size_t, std::size_t > m_tet;
 
     //! Read ExodusII header without setting mesh size
     std::size_t readHeader();
@@ -262,6 +278,12 @@ class ExodusIIMeshReader {
     //! Compute element-block-relative element id and element type
     std::pair< tk::ExoElemType, std::size_t >
     blkRelElemId( std::size_t id ) const;
+
+    //! Read the ids of the tetrahedra assigned to a PE by an element variable
+    std::vector< std::size_t >
+    readPartition( const std::string& partvar,
+                   std::size_t npes,
+                   std::size_t pe ) const;
 };
 
 } // tk::
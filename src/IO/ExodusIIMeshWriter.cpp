@@ -10,6 +10,9 @@
 */
 // *****************************************************************************
 
+#include <cmath>
+#include <cstring>
+#include <algorithm>
 #include <numeric>
 
 #include "NoWarning/exodusII.hpp"
@@ -22,15 +25,23 @@ using tk::ExodusIIMeshWriter;
 
 ExodusIIMeshWriter::ExodusIIMeshWriter( const std::string& filename,
                                         ExoWriter mode,
+                                        uint32_t compression,
+                                        tk::real lossytol,
                                         int cpuwordsize,
                                         int iowordsize ) :
-  m_filename( filename ), m_outFile( 0 )
+  m_filename( filename ), m_outFile( 0 ), m_lossytol( lossytol )
 // *****************************************************************************
 //  Constructor: create/open Exodus II file
 //! \param[in] filename File to open as ExodusII file
 //! \param[in] mode ExodusII writer constructor mode: ExoWriter::CREATE for
 //!   creating a new file, ExoWriter::OPEN for opening an existing file for
 //!   appending
+//! \param[in] compression Deflate level (1-9) of the data written, 0: write
+//!   uncompressed. Compression requires the NetCDF-4 (HDF5) file format,
+//!   selected when creating the file if compression is nonzero, so a file
+//!   opened for appending with compression must have been created with it.
+//! \param[in] lossytol Relative tolerance of rounding node and element field
+//!   values written, see roundMantissa(), 0: write exact values
 //! \param[in] cpuwordsize Set CPU word size, see ExodusII documentation
 //! \param[in] iowordsize Set I/O word size, see ExodusII documentation
 // *****************************************************************************
@@ -43,7 +54,8 @@ ExodusIIMeshWriter::ExodusIIMeshWriter( const std::string& filename,
   if (mode == ExoWriter::CREATE) {
 
     m_outFile = ex_create( filename.c_str(),
-                           EX_CLOBBER | EX_LARGE_MODEL,
+                           EX_CLOBBER | EX_LARGE_MODEL |
+                             (compression > 0 ? EX_NETCDF4 : 0),
                            &cpuwordsize,
                            &iowordsize );
 
@@ -59,6 +71,12 @@ ExodusIIMeshWriter::ExodusIIMeshWriter( const std::string& filename,
   } else Throw( "Unknown ExodusII writer constructor mode" );
 
   ErrChk( m_outFile > 0, "Failed to create/open ExodusII file: " + filename );
+
+  // Deflate all variables defined from now on
+  if (compression > 0)
+    ErrChk( ex_set_option( m_outFile, EX_OPT_COMPRESSION_LEVEL,
+                           static_cast< int >( compression ) ) == 0,
+            "Failed to set compression of ExodusII file: " + filename );
 }
 
 ExodusIIMeshWriter::~ExodusIIMeshWriter() noexcept
@@ -366,6 +384,18 @@ ExodusIIMeshWriter::writeTimeStamp( uint64_t it, tk::real time ) const
           "Failed to write time stamp to ExodusII file: " + m_filename );
 }
 
+void
+ExodusIIMeshWriter::update() const
+// *****************************************************************************
+//  Flush data buffered to ExodusII file
+//! \details Used if the file is kept open across multiple writes, so that
+//!   the data written is readable before the file is closed.
+// *****************************************************************************
+{
+  ErrChk( ex_update( m_outFile ) == 0,
+          "Failed to update ExodusII file: " + m_filename );
+}
+
 void
 ExodusIIMeshWriter::writeTimeValues( const std::vector< tk::real >& tv ) const
 // *****************************************************************************
@@ -502,13 +532,14 @@ ExodusIIMeshWriter::writeNodeScalar( uint64_t it,
 // *****************************************************************************
 {
   if (!var.empty()) {
+    std::vector< tk::real > rounded;
     ErrChk( ex_put_var( m_outFile,
                         static_cast< int >( it ),
                         EX_NODE_BLOCK,
                         varid,
                         1,
                         static_cast< int64_t >( var.size() ),
-                        var.data() ) == 0,
+                        lossy( var, rounded ).data() ) == 0,
             "Failed to write node scalar to ExodusII file: " + m_filename );
   }
 }
@@ -525,13 +556,72 @@ ExodusIIMeshWriter::writeElemScalar( uint64_t it,
 // *****************************************************************************
 {
   if (!var.empty()) {
+    std::vector< tk::real > rounded;
     ErrChk( ex_put_var( m_outFile,
                         static_cast< int >( it ),
                         EX_ELEM_BLOCK,
                         varid,
                         1,
                         static_cast< int64_t >( var.size() ),
-                        var.data() ) == 0,
+                        lossy( var, rounded ).data() ) == 0,
             "Failed to write elem scalar to ExodusII file: " + m_filename );
   }
 }
+
+const std::vector< tk::real >&
+ExodusIIMeshWriter::lossy( const std::vector< tk::real >& var,
+                           std::vector< tk::real >& rounded ) const
+// *****************************************************************************
+//  Round field values to within the relative tolerance configured
+//! \param[in] var Field values to write
+//! \param[in,out] rounded Storage for the rounded values
+//! \return The field values to write: var if no rounding is configured, the
+//!   rounded values otherwise
+// *****************************************************************************
+{
+  if (!(m_lossytol > 0.0)) return var;
+  rounded = var;
+  roundMantissa( rounded, m_lossytol );
+  return rounded;
+}
+
+void
+tk::roundMantissa( std::vector< tk::real >& v, tk::real reltol )
+// *****************************************************************************
+//  Round values to the fewest mantissa bits within a relative tolerance
+//! \param[in,out] v Values to round
+//! \param[in] reltol Largest relative error allowed of a rounded value
+//! \details Rounding to the nearest value with m explicit mantissa bits errs
+//!   at most 2^-(m+1) relative to the value, so the fewest bits m with
+//!   2^-(m+1) <= reltol are kept and the trailing bits are zeroed. Zeroing
+//!   the trailing bits makes field data compress much better, while the
+//!   rounded values are still ordinary IEEE 754 numbers that need no
+//!   decoding by readers. Non-finite values and values that would round to
+//!   infinity are left alone. The relative error bound does not hold for
+//!   subnormal numbers, for which the absolute error is negligible.
+// *****************************************************************************
+{
+  Assert( reltol > 0.0 && reltol < 1.0, "Relative tolerance out of range" );
+  static_assert( sizeof(tk::real) == sizeof(uint64_t), "Not a 64-bit real" );
+
+  // Number of explicit mantissa bits of a 64-bit IEEE 754 real
+  const int nbits = 52;
+  auto m = std::max( 0,
+             static_cast< int >( std::ceil( -std::log2( reltol ) ) ) - 1 );
+  if (m >= nbits) return;
+
+  auto drop = static_cast< unsigned >( nbits - m );
+  const uint64_t half = uint64_t(1) << (drop - 1);
+  const uint64_t mask = ~((uint64_t(1) << drop) - 1);
+
+  for (auto& x : v) {
+    if (!std::isfinite(x)) continue;
+    uint64_t b;
+    std::memcpy( &b, &x, sizeof(b) );
+    // a carry into the exponent rounds up to the next power of two
+    b = (b + half) & mask;
+    tk::real r;
+    std::memcpy( &r, &b, sizeof(r) );
+    if (std::isfinite(r)) x = r;
+  }
+}
@@ -37,6 +37,8 @@ class ExodusIIMeshWriter {
     //! Constructor: create/open ExodusII file
     explicit ExodusIIMeshWriter( const std::string& filename,
                                  ExoWriter mode,
+                                 uint32_t compression = 0,
+                                 tk::real lossytol = 0.0,
                                  int cpuwordsize = sizeof(double),
                                  int iowordsize = sizeof(double) );
 
@@ -75,6 +77,9 @@ class ExodusIIMeshWriter {
     //!  Write time stamp to ExodusII file
     void writeTimeStamp( uint64_t it, tk::real time ) const;
 
+    //! Flush data buffered to ExodusII file
+    void update() const;
+
     //! Write time values to ExodusII file
     void writeTimeValues( const std::vector< tk::real >& tv ) const;
 
@@ -131,10 +136,20 @@ class ExodusIIMeshWriter {
     //! Write side sets and their node list to ExodusII file
     void writeNodesets( const UnsMesh& mesh ) const;
 
+    //! Round field values to within the relative tolerance configured
+    const std::vector< tk::real >&
+    lossy( const std::vector< tk::real >& var,
+           std::vector< tk::real >& rounded ) const;
+
     const std::string m_filename;          //!< File name
     int m_outFile;                         //!< ExodusII file handle
+    //! Relative tolerance of rounding fields, 0: no rounding
+    const tk::real m_lossytol;
 };
 
+//! Round values to the fewest mantissa bits within a relative tolerance
+void roundMantissa( std::vector< tk::real >& v, tk::real reltol );
+
 } // tk::
 
 #endif // ExodusIIMeshWriter_h
@@ -49,6 +49,8 @@ FileConvWriter::FileConvWriter( const std::string& file_root,
   } else {
     // the tree is named as ctree in the RootMeshWriter
     m_tree_local = static_cast< TTree* >( m_infile->Get( "ctree" ) );
+    // only read the branches asked for, see readEntry()
+    m_tree_local->SetBranchStatus( "*", 0 );
   }
 
 }
@@ -77,6 +79,23 @@ FileConvWriter::convertFiles()
 
 }
 
+void
+FileConvWriter::readEntry( const std::vector< std::string >& branches )
+//*****************************************************************************
+//  Read the first entry of only some branches of the ROOT tree
+//! \param[in] branches Names of the branches to read, whose addresses have
+//!   been set by the caller
+//! \details All branches of the tree are disabled in the constructor and
+//!   only those passed in are enabled while the entry is read. Reading the
+//!   entry with all branches enabled would read every time step and field
+//!   in the file, for each field converted.
+//*****************************************************************************
+{
+  for (const auto& b : branches) m_tree_local->SetBranchStatus( b.c_str(), 1 );
+  m_tree_local->GetEntry( 0 );
+  for (const auto& b : branches) m_tree_local->SetBranchStatus( b.c_str(), 0 );
+}
+
 void
 FileConvWriter::writeHeader() 
 //*****************************************************************************
@@ -89,7 +108,7 @@ FileConvWriter::writeHeader()
   m_tree_local->SetBranchAddress( "trian", &connect );
   m_tree_local->SetBranchAddress( "coord", &coord );
 
-  m_tree_local->GetEntry( 0 );
+  readEntry( { "trian", "coord" } );
   m_emw->writeHeader( "Data copied from ROOT",
                  3, 
 		 coord,
@@ -107,18 +126,18 @@ FileConvWriter::writeCoordinates()
 //*****************************************************************************
 {
 
-  std::vector< tk::real > *mx = nullptr;
-  std::vector< tk::real > *my = nullptr;
-  std::vector< tk::real > *mz = nullptr;
+  // read into vectors owned here, instead of vectors allocated by ROOT
+  std::vector< tk::real > x, y, z;
+  auto mx = &x, my = &y, mz = &z;
 
   m_tree_local->SetBranchAddress( "x_coord", &mx );
   m_tree_local->SetBranchAddress( "y_coord", &my );
   m_tree_local->SetBranchAddress( "z_coord", &mz );
 
-  m_tree_local->GetEntry( 0 );
+  readEntry( { "x_coord", "y_coord", "z_coord" } );
 
   // write to ExodusII
-  m_emw->writeNodes( *mx, *my, *mz );
+  m_emw->writeNodes( x, y, z );
   m_tree_local->ResetBranchAddresses();
 
 }
@@ -134,12 +153,13 @@ FileConvWriter::writeConnectivity()
   // param[1] - vertices, 4 is the number of vertices of Tetrahedron
   // param[2] - string literal TETRAHEDRA/TRIANGLES
   int elclass = 0;
-  std::vector<std::size_t> *tets_number = nullptr;
+  std::vector< std::size_t > tets;
+  auto tets_number = &tets;
 
   m_tree_local->SetBranchAddress( "tetconnect", &tets_number );
-  m_tree_local->GetEntry( 0 );
+  readEntry( { "tetconnect" } );
 
-  m_emw->writeElemBlock( elclass, 4, "TETRAHEDRA", *tets_number );
+  m_emw->writeElemBlock( elclass, 4, "TETRAHEDRA", tets );
   m_tree_local->ResetBranchAddresses();
 
 }
@@ -150,13 +170,14 @@ FileConvWriter::writeVarNames()
 //  Write the Variables names
 //*****************************************************************************
 {
-  std::vector<std::string> *var_copy = nullptr;
-  
+  std::vector< std::string > names;
+  auto var_copy = &names;
+
   m_tree_local->SetBranchAddress( "variables", &var_copy );
-  m_tree_local->GetEntry(0);
+  readEntry( { "variables" } );
 
-  m_emw->writeNodeVarNames( *var_copy );
-  m_nodal_size = var_copy->size();
+  m_emw->writeNodeVarNames( names );
+  m_nodal_size = names.size();
   m_tree_local->ResetBranchAddresses();
 
 }
@@ -168,7 +189,12 @@ FileConvWriter::writeData()
 //*****************************************************************************
 {
 
-  std::size_t timestep = 1; 
+  // Field data read one field at a time, so only a single field of a single
+  // time step is held in memory, reused across all fields
+  std::vector< double > field;
+  auto var_fields = &field;
+
+  std::size_t timestep = 1;
   while( true ) {
     double dt = 0;
 
@@ -176,27 +202,23 @@ FileConvWriter::writeData()
     if( m_tree_local->GetBranch( time_branch.c_str() ) == nullptr )
       break;
 
+    m_tree_local->SetBranchAddress( time_branch.c_str(), &dt );
+    readEntry( { time_branch } );
+
     for (std::size_t var_id=1; var_id<=m_nodal_size; ++var_id) {
       std::string branch_var = "branch_" + std::to_string(timestep) + "_field_"
-			      + std::to_string(var_id);
+                              + std::to_string(var_id);
 
       if( m_tree_local->GetBranch( branch_var.c_str() ) == nullptr )
-	break;
-      else {
+        break;
 
-	std::vector< double> *var_fields   = nullptr;
+      m_tree_local->SetBranchAddress( branch_var.c_str(), &var_fields );
+      readEntry( { branch_var } );
 
-	m_tree_local->SetBranchAddress( branch_var.c_str(), &var_fields );
-	m_tree_local->SetBranchAddress(time_branch.c_str(), &dt );
-	m_tree_local->GetEntry(0);
-	
-	m_emw->writeNodeScalar( timestep,
-                                static_cast<int>(var_id),
-                                *var_fields );
-      }	
+      m_emw->writeNodeScalar( timestep, static_cast<int>(var_id), field );
 
     } // End the variables loop.
-    
+
     // Write the timestamp variable, once per timestep
     m_emw->writeTimeStamp( timestep, dt );
     ++timestep;
@@ -15,6 +15,7 @@
 
 #include <cstddef>
 #include <iosfwd>
+#include <string>
 #include <vector>
 
 #include "NoWarning/TFile.hpp"
@@ -52,6 +53,9 @@ class FileConvWriter {
     //! ROOT tree handle
     TTree* m_tree_local = nullptr;
 
+    //! Read the first entry of only some branches of the ROOT tree
+    void readEntry( const std::vector< std::string >& branches );
+
     //! Write the timestamp and the variables data
     void writeHeader();
     void writeCoordinates();
@@ -13,8 +13,11 @@
 
 #include <limits>
 #include <array>
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <cstring>
+#include <map>
 #include <istream>
 #include <string>
 #include <utility>
@@ -25,6 +28,7 @@
 #include "GmshMeshIO.hpp"
 #include "Reorder.hpp"
 #include "PrintUtil.hpp"
+#include "TextParser.hpp"
 
 using tk::GmshMeshReader;
 
@@ -34,6 +38,35 @@ GmshMeshReader::readMesh( UnsMesh& mesh )
 //  Public interface for read a Gmsh mesh from file
 //! \param[in] mesh Unstructured mesh object
 // *****************************************************************************
+{
+  readMesh(
+    [&]( const UnsMesh::Coords& c ){
+      mesh.x().insert( end(mesh.x()), begin(c[0]), end(c[0]) );
+      mesh.y().insert( end(mesh.y()), begin(c[1]), end(c[1]) );
+      mesh.z().insert( end(mesh.z()), begin(c[2]), end(c[2]) ); },
+    [&]( std::size_t nnpe, const std::vector< std::size_t >& inpoel ){
+      auto& conn = nnpe == 2 ? mesh.lininpoel() :
+                   nnpe == 3 ? mesh.triinpoel() : mesh.tetinpoel();
+      conn.insert( end(conn), begin(inpoel), end(inpoel) ); },
+    std::numeric_limits< std::size_t >::max() );
+
+  // Shift node IDs to start from zero (gmsh likes one-based node ids)
+  shiftToZero( mesh.lininpoel() );
+  shiftToZero( mesh.triinpoel() );
+  shiftToZero( mesh.tetinpoel() );
+}
+
+void
+GmshMeshReader::readMesh( const NodeChunkFn& nodes,
+                          const ElemChunkFn& elems,
+                          std::size_t chunk )
+// *****************************************************************************
+//  Public interface for read a Gmsh mesh from file in chunks
+//! \param[in] nodes Function to pass chunks of node coordinates to
+//! \param[in] elems Function to pass chunks of element connectivity to, with
+//!   node ids as in the file, i.e., one-based
+//! \param[in] chunk Maximum number of nodes or elements passed at a time
+// *****************************************************************************
 {
   // Read in mandatory "$MeshFormat" section
   readMeshFormat();
@@ -44,9 +77,9 @@ GmshMeshReader::readMesh( UnsMesh& mesh )
     std::string s;
     getline( m_inFile, s );
     if ( s == "$Nodes" )
-      readNodes( mesh );
+      readNodes( nodes, chunk );
     else if ( s == "$Elements" )
-      readElements( mesh );
+      readElements( elems, chunk );
     else if ( s == "$PhysicalNames" )
       readPhysicalNames();
   }
@@ -108,10 +141,13 @@ GmshMeshReader::readMeshFormat()
 }
 
 void
-GmshMeshReader::readNodes( UnsMesh& mesh )
+GmshMeshReader::readNodes( const NodeChunkFn& nodes, std::size_t chunk )
 // *****************************************************************************
 //  Read "$Nodes--$EndNodes" section
-//! \param[in] mesh Unstructured mesh object
+//! \param[in] nodes Function to pass chunks of node coordinates to
+//! \param[in] chunk Maximum number of nodes passed at a time
+//! \details ASCII node lines are parsed in parallel, see tk::parseLines().
+//!   Binary node records are read in a single read.
 // *****************************************************************************
 {
   // Read in number of nodes in this node set
@@ -120,33 +156,63 @@ GmshMeshReader::readNodes( UnsMesh& mesh )
   ErrChk( nnode > 0,
           "Number of nodes must be greater than zero in file " + m_filename  );
   std::string s;
-  if (isBinary()) getline( m_inFile, s );  // finish reading the line
+  getline( m_inFile, s );  // finish reading the line
+
+  UnsMesh::Coords coord;
+  auto flush = [&]( std::size_t n ){
+    if (coord[0].size() < n) return;
+    nodes( coord );
+    for (auto& x : coord) x.clear();
+  };
 
   // Read in node ids and coordinates: node-number x-coord y-coord z-coord
-  for ( std::size_t i=0; i<nnode; ++i ) {
-    int id;
-    std::array< tk::real, 3 > coord;
-
-    if (isASCII()) {
-      m_inFile >> id >> coord[0] >> coord[1] >> coord[2];
-    } else {
-      m_inFile.read( reinterpret_cast<char*>(&id), sizeof(int) );
-      #ifdef __bg__
-      id = tk::swap_endian< int >( id );
-      #endif
-      m_inFile.read( reinterpret_cast<char*>(coord.data()), 3*sizeof(double) );
-      #ifdef __bg__
-      coord[0] = tk::swap_endian< double >( coord[0] );
-      coord[1] = tk::swap_endian< double >( coord[1] );
-      coord[2] = tk::swap_endian< double >( coord[2] );
-      #endif
+  if (isASCII()) {
+
+    using Coords = std::array< std::vector< tk::real >, 3 >;
+    auto ok = tk::parseLines< Coords >( m_inFile, nnode,
+      []( const char* p, Coords& c ){
+        int id;
+        tk::real r[3];
+        if (!(p = tk::parseInt( p, id ))) return false;
+        for (std::size_t d=0; d<3; ++d) {
+          if (!(p = tk::parseReal( p, r[d] ))) return false;
+          c[d].push_back( r[d] );
+        }
+        return true; },
+      [&]( const Coords& c ){
+        for (std::size_t d=0; d<3; ++d)
+          coord[d].insert( end(coord[d]), begin(c[d]), end(c[d]) );
+        flush( chunk ); } );
+    ErrChk( ok, "Failed to read nodes in file " + m_filename );
+
+  } else {
+
+    // Each node record is an int id followed by 3 doubles, read in chunks
+    const std::size_t rec = sizeof(int) + 3*sizeof(double);
+    const auto nbuf = std::min( nnode, chunk );
+    std::vector< char > buf( nbuf * rec );
+    for (std::size_t b=0; b<nnode; b+=nbuf) {
+      auto n = std::min( nbuf, nnode-b );
+      m_inFile.read( buf.data(), static_cast< std::streamsize >( n*rec ) );
+      ErrChk( m_inFile.good(), "Failed to read nodes in file " + m_filename );
+      for (std::size_t i=0; i<n; ++i) {
+        std::array< tk::real, 3 > c;
+        std::memcpy( c.data(), buf.data() + i*rec + sizeof(int),
+                     3*sizeof(double) );
+        for (std::size_t d=0; d<3; ++d) {
+          #ifdef __bg__
+          c[d] = tk::swap_endian< double >( c[d] );
+          #endif
+          coord[d].push_back( c[d] );
+        }
+      }
+      flush( chunk );
     }
+    getline( m_inFile, s );  // finish reading the last line
 
-    mesh.x().push_back( coord[0] );
-    mesh.y().push_back( coord[1] );
-    mesh.z().push_back( coord[2] );
   }
-  getline( m_inFile, s );  // finish reading the last line
+
+  flush( 1 );
 
   // Read in end of header: $EndNodes
   getline( m_inFile, s );
@@ -155,10 +221,14 @@ GmshMeshReader::readNodes( UnsMesh& mesh )
 }
 
 void
-GmshMeshReader::readElements( UnsMesh& mesh )
+GmshMeshReader::readElements( const ElemChunkFn& elems, std::size_t chunk )
 // *****************************************************************************
 //  Read "$Elements--$EndElements" section
-//! \param[in] mesh Unstructured mesh object
+//! \param[in] elems Function to pass chunks of element connectivity to
+//! \param[in] chunk Maximum number of elements passed at a time
+//! \details ASCII element lines are parsed in parallel, see
+//!   tk::parseLines(). Binary element records of a block of elements of the
+//!   same type and number of tags are read in a single read.
 // *****************************************************************************
 {
   using tk::operator<<;
@@ -172,15 +242,61 @@ GmshMeshReader::readElements( UnsMesh& mesh )
           m_filename );
   getline( m_inFile, s );  // finish reading the last line
 
-  // Read in element ids, tags, and element connectivity (node list)
-  int n=1;
-  for (int i=0; i<nel; i+=n) {
-    int id, elmtype, ntags;
+  // Element connectivity for different types of elements, passed on in chunks,
+  // associated to the number of nodes per element
+  std::map< std::size_t, std::vector< std::size_t > > conn;
+  auto flush = [&]( std::size_t n ){
+    for (auto& [ nnpe, inpoel ] : conn)
+      if (!inpoel.empty() && inpoel.size()/nnpe >= n) {
+        elems( nnpe, inpoel );
+        inpoel.clear();
+      }
+  };
+  auto add = [&]( int elmtype, const int* nodes, std::size_t nnode ) {
+    if (elmtype == GmshElemType::PNT) return;  // ignore 'point element' type
+    auto& inpoel =
+      conn[ static_cast< std::size_t >( m_elemNodes.at( elmtype ) ) ];
+    for (std::size_t j=0; j<nnode; ++j)
+      inpoel.push_back( static_cast< std::size_t >( nodes[j] ) );
+  };
+
+  if (isASCII()) {
+
+    // elm-number elm-type number-of-tags < tag > ... node-number-list
+    using Conn = std::map< int, std::vector< int > >;
+    const auto& elemNodes = m_elemNodes;
+    auto ok = tk::parseLines< Conn >( m_inFile,
+                                      static_cast< std::size_t >( nel ),
+      [&]( const char* p, Conn& c ){
+        int id, elmtype, ntags, tag;
+        if (!(p = tk::parseInt( p, id ))) return false;
+        if (!(p = tk::parseInt( p, elmtype ))) return false;
+        if (!(p = tk::parseInt( p, ntags ))) return false;
+        const auto it = elemNodes.find( elmtype );
+        if (it == elemNodes.end()) return false;
+        for (int j=0; j<ntags; ++j)
+          if (!(p = tk::parseInt( p, tag ))) return false;
+        auto& inpoel = c[ elmtype ];
+        for (int j=0; j<it->second; ++j) {
+          int n;
+          if (!(p = tk::parseInt( p, n ))) return false;
+          inpoel.push_back( n );
+        }
+        return true; },
+      [&]( const Conn& c ){
+        for (const auto& [ elmtype, inpoel ] : c)
+          add( elmtype, inpoel.data(), inpoel.size() );
+        flush( chunk ); } );
+    ErrChk( ok, "Failed to read elements, or unsupported element type, in "
+                "file " + m_filename );
+
+  } else {
+
+    // Read in element ids, tags, and element connectivity (node list)
+    int n = 1;
+    for (int i=0; i<nel; i+=n) {
+      int elmtype, ntags;
 
-    if (isASCII()) {
-      // elm-number elm-type number-of-tags < tag > ... node-number-list
-      m_inFile >> id >> elmtype >> ntags;
-    } else {
       // elm-type num-of-elm-follow number-of-tags
       m_inFile.read( reinterpret_cast<char*>(&elmtype), sizeof(int) );
       m_inFile.read( reinterpret_cast<char*>(&n), sizeof(int) );
@@ -190,79 +306,40 @@ GmshMeshReader::readElements( UnsMesh& mesh )
       n = tk::swap_endian< int >( n );
       ntags = tk::swap_endian< int >( ntags );
       #endif
-    }
-
-    // Find element type, throw exception if not supported
-    const auto it = m_elemNodes.find( elmtype );
-    ErrChk( it != m_elemNodes.end(),
-            std::string("Unsupported element type ") << elmtype <<
-            " in mesh file: " << m_filename );
+      ErrChk( m_inFile.good() && n > 0 && ntags >= 0,
+              "Failed to read elements in file " + m_filename );
 
-    for (int e=0; e<n; ++e) {
-      // Read element id if binary
-      if (isBinary()) {
-        m_inFile.read( reinterpret_cast<char*>(&id), sizeof(int) );
-        #ifdef __bg__
-        id = tk::swap_endian< int >( id );
-        #endif
-      }
+      // Find element type, throw exception if not supported
+      const auto it = m_elemNodes.find( elmtype );
+      ErrChk( it != m_elemNodes.end(),
+              std::string("Unsupported element type ") << elmtype <<
+              " in mesh file: " << m_filename );
 
-      // Read and ignore element tags
-      std::vector< int > tags( static_cast<std::size_t>(ntags), 0 );
-      if (isASCII()) {
-        for (std::size_t j=0; j<static_cast<std::size_t>(ntags); j++)
-          m_inFile >> tags[j];
-      } else {
-        m_inFile.read(
-          reinterpret_cast<char*>(tags.data()),
-          static_cast<std::streamsize>(
-            static_cast<std::size_t>(ntags) * sizeof(int) ) );
+      // Read the block of elements: element id, tags, and node list each, in
+      // chunks of elements
+      auto nnode = static_cast< std::size_t >( it->second );
+      auto rec = 1 + static_cast< std::size_t >( ntags ) + nnode;
+      auto nb = static_cast< std::size_t >( n );
+      std::vector< int > blk( std::min( nb, chunk ) * rec );
+      for (std::size_t b=0; b<nb; b+=blk.size()/rec) {
+        auto m = std::min( blk.size()/rec, nb-b );
+        m_inFile.read( reinterpret_cast< char* >( blk.data() ),
+          static_cast< std::streamsize >( m * rec * sizeof(int) ) );
+        ErrChk( m_inFile.good(), "Failed to read elements in file " +
+                m_filename );
         #ifdef __bg__
-        for (auto& t : tags) t = tk::swap_endian< int >( t );
+        for (auto& j : blk) j = tk::swap_endian< int >( j );
         #endif
-      }
-
-      // Read and add element node list (i.e. connectivity)
-      std::size_t nnode = static_cast< std::size_t >( it->second );
-      std::vector< std::size_t > nodes( nnode, 0 );
-      if (isASCII()) {
-        for (std::size_t j=0; j<nnode; j++)
-          m_inFile >> nodes[j];
-      } else {
-        std::vector< int > nds( nnode, 0 );
-        m_inFile.read(
-          reinterpret_cast< char* >( nds.data() ),
-          static_cast< std::streamsize >( nnode * sizeof(int) ) );
-        #ifdef __bg__
-        for (auto& j : nds) j = tk::swap_endian< int >( j );
-        #endif
-        for (std::size_t j=0; j<nnode; j++)
-          nodes[j] = static_cast< std::size_t >( nds[j] );
-      }
-      // Put in element connectivity for different types of elements
-      switch ( elmtype ) {
-        case GmshElemType::LIN:
-          for (const auto& j : nodes) mesh.lininpoel().push_back( j );
-          break;
-        case GmshElemType::TRI:
-          for (const auto& j : nodes) mesh.triinpoel().push_back( j );
-          break;
-        case GmshElemType::TET:
-          for (const auto& j : nodes) mesh.tetinpoel().push_back( j );
-          break;
-        case GmshElemType::PNT:
-          break;     // ignore 1-node 'point element' type
-        default: Throw( std::string("Unsupported element type ") << elmtype <<
-                        " in mesh file: " << m_filename );
+        for (std::size_t e=0; e<m; ++e)
+          add( elmtype, blk.data() + e*rec + rec - nnode, nnode );
+        flush( chunk );
       }
     }
+    getline( m_inFile, s );  // finish reading the last line
+
   }
-  getline( m_inFile, s );  // finish reading the last line
 
-  // Shift node IDs to start from zero (gmsh likes one-based node ids)
-  shiftToZero( mesh.lininpoel() );
-  shiftToZero( mesh.triinpoel() );
-  shiftToZero( mesh.tetinpoel() );
+  flush( 1 );
 
   // Read in end of header: $EndNodes
   getline( m_inFile, s );
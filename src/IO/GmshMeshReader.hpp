@@ -19,12 +19,11 @@
 #include "Types.hpp"
 #include "Reader.hpp"
 #include "GmshMeshIO.hpp"
+#include "MeshStream.hpp"
 #include "Exception.hpp"
 
 namespace tk {
 
-class UnsMesh;
-
 //! Gmsh mesh reader
 //! \details Mesh reader class facilitating reading a mesh from a file saved by
 //!   the Gmsh mesh generator: http://geuz.org/gmsh.
@@ -42,15 +41,20 @@ class GmshMeshReader : public Reader {
     //! Read Gmsh mesh
     void readMesh( UnsMesh& mesh );
 
+    //! Read Gmsh mesh in chunks
+    void readMesh( const NodeChunkFn& nodes,
+                   const ElemChunkFn& elems,
+                   std::size_t chunk );
+
   private:
     //! Read mandatory "$MeshFormat--$EndMeshFormat" section
     void readMeshFormat();
 
     //! Read "$Nodes--$EndNodes" section
-    void readNodes( UnsMesh& mesh );
+    void readNodes( const NodeChunkFn& nodes, std::size_t chunk );
 
     //! Read "$Elements--$EndElements" section
-    void readElements( UnsMesh& mesh );
+    void readElements( const ElemChunkFn& elems, std::size_t chunk );
 
     //! Read "$PhysicalNames--$EndPhysicalNames" section
     void readPhysicalNames() __attribute__ ((noreturn));
@@ -11,7 +11,6 @@
 */
 // *****************************************************************************
 
-#include <iterator>
 #include <iomanip>
 #include <algorithm>
 #include <cstddef>
@@ -79,36 +78,70 @@ GmshMeshWriter::writeNodes( const UnsMesh& mesh )
 //  Write "$Nodes--$EndNodes" section
 //! \param[in] mesh Unstructured mesh object
 // *****************************************************************************
+{
+  writeNodeHeader( mesh.nnode() );
+  writeNodeChunk( mesh.x(), mesh.y(), mesh.z(), 0 );
+  writeNodeFooter();
+}
+
+void
+GmshMeshWriter::writeNodeHeader( std::size_t nnode )
+// *****************************************************************************
+//  Write beginning of "$Nodes--$EndNodes" section
+//! \param[in] nnode Number of nodes to be written
+// *****************************************************************************
 {
   m_outFile << "$Nodes" << std::endl;
 
   // Write out number of nodes
-  m_outFile << mesh.nnode() << std::endl;
+  m_outFile << nnode << std::endl;
+}
 
+void
+GmshMeshWriter::writeNodeChunk( const std::vector< tk::real >& x,
+                                const std::vector< tk::real >& y,
+                                const std::vector< tk::real >& z,
+                                std::size_t offset )
+// *****************************************************************************
+//  Write a chunk of nodes of "$Nodes--$EndNodes" section
+//! \param[in] x X coordinates of nodes to write
+//! \param[in] y Y coordinates of nodes to write
+//! \param[in] z Z coordinates of nodes to write
+//! \param[in] offset Zero-based id of the first node of the chunk
+// *****************************************************************************
+{
   // Write node ids and coordinates: node-number x-coord y-coord z-coord
   if (isASCII()) {
-    for (std::size_t i=0; i<mesh.nnode(); ++i) {
-      m_outFile << i+1 << " " << std::setprecision(16)
-                << mesh.x()[i] << " "
-                << mesh.y()[i] << " "
-                << mesh.z()[i] << std::endl;
+    for (std::size_t i=0; i<x.size(); ++i) {
+      m_outFile << offset+i+1 << " " << std::setprecision(16)
+                << x[i] << " "
+                << y[i] << " "
+                << z[i] << '\n';
     }
   } else {
-    for (std::size_t i=0; i<mesh.nnode(); ++i) {
+    for (std::size_t i=0; i<x.size(); ++i) {
       // gmsh likes one-based node ids
-      int I = static_cast< int >( i+1 );
+      int I = static_cast< int >( offset+i+1 );
       m_outFile.write(
         reinterpret_cast<const char*>(&I), sizeof(int) );
       m_outFile.write(
-        reinterpret_cast<const char*>(&mesh.x()[i]), sizeof(double) );
+        reinterpret_cast<const char*>(&x[i]), sizeof(double) );
       m_outFile.write(
-        reinterpret_cast<const char*>(&mesh.y()[i]), sizeof(double) );
+        reinterpret_cast<const char*>(&y[i]), sizeof(double) );
       m_outFile.write(
-        reinterpret_cast<const char*>(&mesh.z()[i]), sizeof(double) );
+        reinterpret_cast<const char*>(&z[i]), sizeof(double) );
     }
-    m_outFile << std::endl;
   }
+  ErrChk( !m_outFile.bad(), "Failed to write to file: " + m_filename );
+}
 
+void
+GmshMeshWriter::writeNodeFooter()
+// *****************************************************************************
+//  Write end of "$Nodes--$EndNodes" section
+// *****************************************************************************
+{
+  if (isBinary()) m_outFile << std::endl;
   m_outFile << "$EndNodes" << std::endl;
 }
 
@@ -119,13 +152,10 @@ GmshMeshWriter::writeElements( const UnsMesh& mesh )
 //! \param[in] mesh Unstructured mesh object
 // *****************************************************************************
 {
-  m_outFile << "$Elements" << std::endl;
-
   // Write out number of elements
-  m_outFile << mesh.lininpoel().size()/2 +
-               mesh.triinpoel().size()/3 +
-               mesh.tetinpoel().size()/4
-            << std::endl;
+  writeElemHeader( mesh.lininpoel().size()/2 +
+                   mesh.triinpoel().size()/3 +
+                   mesh.tetinpoel().size()/4 );
 
   // Write out line element ids and connectivity (node list)
   writeElemBlock( 2, GmshElemType::LIN, mesh.lininpoel() );
@@ -136,6 +166,28 @@ GmshMeshWriter::writeElements( const UnsMesh& mesh )
   // Write out terahedron element ids and connectivity (node list)
   writeElemBlock( 4, GmshElemType::TET, mesh.tetinpoel() );
 
+  writeElemFooter();
+}
+
+void
+GmshMeshWriter::writeElemHeader( std::size_t nelem )
+// *****************************************************************************
+//  Write beginning of "$Elements--$EndElements" section
+//! \param[in] nelem Total number of elements to be written
+// *****************************************************************************
+{
+  m_outFile << "$Elements" << std::endl;
+
+  // Write out number of elements
+  m_outFile << nelem << std::endl;
+}
+
+void
+GmshMeshWriter::writeElemFooter()
+// *****************************************************************************
+//  Write end of "$Elements--$EndElements" section
+// *****************************************************************************
+{
   if (isBinary()) m_outFile << std::endl;
   m_outFile << "$EndElements" << std::endl;
 }
@@ -158,51 +210,79 @@ GmshMeshWriter::writeElemBlock( std::size_t nnpe,
   Assert( *std::minmax_element( begin(inpoel), end(inpoel) ).first == 0,
           "node ids should start from zero" );
 
-  // Get number of elements in mesh
+  writeElemBlockHeader( type, inpoel.size()/nnpe );
+  writeElemChunk( nnpe, type, inpoel, 0 );
+}
+
+void
+GmshMeshWriter::writeElemBlockHeader( GmshElemType type, std::size_t nelem )
+// *****************************************************************************
+//  Write beginning of an element block
+//! \param[in] type Element type
+//! \param[in] nelem Number of elements in block
+//! \details Element blocks are only delimited in binary files, in which a
+//!   block of elements is preceded by its element type, number of elements,
+//!   and number of tags.
+// *****************************************************************************
+{
+  if (isASCII()) return;
+
+  int ntags = 1;
+  int nel = static_cast< int >( nelem );
+  // elm-type num-of-elm-follow number-of-tags
+  m_outFile.write( reinterpret_cast<char*>(&type), sizeof(int) );
+  m_outFile.write( reinterpret_cast<char*>(&nel), sizeof(int) );
+  m_outFile.write( reinterpret_cast<char*>(&ntags), sizeof(int) );
+}
+
+void
+GmshMeshWriter::writeElemChunk( std::size_t nnpe,
+                                GmshElemType type,
+                                const std::vector< std::size_t >& inpoel,
+                                std::size_t offset )
+// *****************************************************************************
+//  Write a chunk of elements of an element block
+//! \param[in] nnpe Number of nodes per element
+//! \param[in] type Element type
+//! \param[in] inpoel Element connectivity (zero-based node ids)
+//! \param[in] offset Zero-based id of the first element of the chunk within
+//!   its element block
+// *****************************************************************************
+{
+  // Get number of elements in chunk
   auto n = inpoel.size()/nnpe;
 
   // Ignore element tags
-  std::vector< std::vector< int > > tg;
-  tg.resize( n );
-  for (auto& t : tg) t.push_back( 0 );
+  const int tag = 0;
 
   if (isASCII()) {
 
     for (std::size_t i=0; i<n; i++) {
       // elm-number elm-type number-of-tags < tag > ... node-number-list
-      m_outFile << i+1 << " " << type << " " << tg[i].size() << " ";
-      copy( tg[i].begin(), tg[i].end()-1,
-            std::ostream_iterator< int >( m_outFile, " " ) );
-      m_outFile << tg[i].back() << " ";
+      m_outFile << offset+i+1 << " " << type << " " << 1 << " " << tag << " ";
 
       // gmsh likes one-based node ids
       for (std::size_t k=0; k<nnpe; k++) m_outFile << inpoel[i*nnpe+k]+1 << " ";
-      m_outFile << std::endl;
+      m_outFile << '\n';
     }
 
   } else {
 
-    int ntags = static_cast< int >( tg[0].size() );
-    int nel = static_cast< int >( n );
-    // elm-type num-of-elm-follow number-of-tags
-    m_outFile.write( reinterpret_cast<char*>(&type), sizeof(int) );
-    m_outFile.write( reinterpret_cast<char*>(&nel), sizeof(int) );
-    m_outFile.write( reinterpret_cast<char*>(&ntags), sizeof(int) );
+    std::vector< int > Inpoel( nnpe );
     for (std::size_t i=0; i<n; i++) {
-      int I = static_cast< int >( i );
+      int I = static_cast< int >( offset+i );
       // gmsh likes one-based node ids
-      std::vector< int > Inpoel;
       for (std::size_t k=0; k<nnpe; ++k)
-         Inpoel.push_back( static_cast< int >( inpoel[i*nnpe+k]+1 ) );
+         Inpoel[k] = static_cast< int >( inpoel[i*nnpe+k]+1 );
       // element id
       m_outFile.write( reinterpret_cast<const char*>(&I), sizeof(int) );
       // element tags
-      m_outFile.write( reinterpret_cast<const char*>(tg[i].data()),
-                       static_cast<std::streamsize>(tg[i].size()*sizeof(int)) );
+      m_outFile.write( reinterpret_cast<const char*>(&tag), sizeof(int) );
       // element node list (i.e. connectivity)
       m_outFile.write( reinterpret_cast<const char*>(Inpoel.data()),
                        static_cast<std::streamsize>(nnpe*sizeof(int)) );
     }
 
   }
+  ErrChk( !m_outFile.bad(), "Failed to write to file: " + m_filename );
 }
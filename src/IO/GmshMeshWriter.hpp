@@ -40,6 +40,33 @@ class GmshMeshWriter : public Writer {
     //! Write Gmsh mesh to file
     void writeMesh( const UnsMesh& mesh );
 
+    //! Write beginning of "$Nodes--$EndNodes" section
+    void writeNodeHeader( std::size_t nnode );
+
+    //! Write a chunk of nodes of "$Nodes--$EndNodes" section
+    void writeNodeChunk( const std::vector< tk::real >& x,
+                         const std::vector< tk::real >& y,
+                         const std::vector< tk::real >& z,
+                         std::size_t offset );
+
+    //! Write end of "$Nodes--$EndNodes" section
+    void writeNodeFooter();
+
+    //! Write beginning of "$Elements--$EndElements" section
+    void writeElemHeader( std::size_t nelem );
+
+    //! Write beginning of an element block
+    void writeElemBlockHeader( GmshElemType type, std::size_t nelem );
+
+    //! Write a chunk of elements of an element block
+    void writeElemChunk( std::size_t nnpe,
+                         GmshElemType type,
+                         const std::vector< std::size_t >& inpoel,
+                         std::size_t offset );
+
+    //! Write end of "$Elements--$EndElements" section
+    void writeElemFooter();
+
   private:
     //! Write "$Nodes--$EndNodes" section
     void writeNodes( const UnsMesh& mesh );
@@ -54,22 +54,41 @@ H5PartWriter::H5PartWriter( const std::string& filename ) :
 }
 
 void
-H5PartWriter::writeCoords( uint64_t it,
-                           const std::vector< tk::real >& x,
-                           const std::vector< tk::real >& y,
-                           const std::vector< tk::real >& z ) const
+H5PartWriter::writeParticles(
+  uint64_t it,
+  const std::vector< tk::real >& x,
+  const std::vector< tk::real >& y,
+  const std::vector< tk::real >& z,
+  const std::vector< std::string >& names,
+  const std::vector< std::vector< tk::real > >& fields,
+  const std::vector< uint64_t >& id ) const
 // *****************************************************************************
-//  Write particle coordinates to H5Part file
+//  Write particle coordinates, fields, and ids to H5Part file
 //! \param[in] it Iteration number
 //! \param[in] x X coordinates of particles
 //! \param[in] y Y coordinates of particles
 //! \param[in] z Z coordinates of particles
+//! \param[in] names Names of particle fields
+//! \param[in] fields Particle fields to output, one per name, each of the size
+//!   of the coordinate arrays
+//! \param[in] id Particle ids, empty or of the size of the coordinate arrays
+//! \details This function must be called collectively by all members of the
+//!   MPI communicator, each with its own particles. The file is opened once
+//!   for the coordinates, the fields, and the ids. Setting the number of
+//!   particles exchanges the number of particles among all ranks and selects
+//!   the hyperslab of each rank in the datasets at the offset given by the
+//!   prefix sum of the number of particles, so that the datasets of a step are
+//!   written collectively via MPI-IO, with each rank writing its contiguous
+//!   range of particles.
 // *****************************************************************************
 {
   if (m_filename.empty()) return;
 
   Assert( x.size() == y.size() && y.size() == z.size(),
           "Particle coordinates array sizes mismatch" );
+  Assert( names.size() == fields.size(),
+          "Number of particle field names and fields mismatch" );
+  Assert( id.empty() || id.size() == x.size(), "Particle id size mismatch" );
 
   #if defined(__clang__)
     #pragma clang diagnostic push
@@ -99,6 +118,19 @@ H5PartWriter::writeCoords( uint64_t it,
   ErrChk( H5PartWriteDataFloat64( f, "z", z.data() ) == H5PART_SUCCESS,
           "Failed to write z particle coordinates to file " + m_filename );
 
+  for (std::size_t i=0; i<names.size(); ++i) {
+    Assert( fields[i].size() == x.size(), "Particle field size mismatch" );
+    ErrChk( H5PartWriteDataFloat64( f, names[i].c_str(), fields[i].data() ) ==
+            H5PART_SUCCESS, "Failed to write particle field " + names[i] +
+                            " to file " + m_filename );
+  }
+
+  if (!id.empty()) {
+    std::vector< h5part_int64_t > i64( begin(id), end(id) );
+    ErrChk( H5PartWriteDataInt64( f, "id", i64.data() ) == H5PART_SUCCESS,
+            "Failed to write particle ids to file " + m_filename );
+  }
+
   ErrChk( H5PartCloseFile( f ) == H5PART_SUCCESS,
           "Failed to close file " + m_filename );
 }
@@ -18,6 +18,8 @@
 #include <string>
 #include <cstdint>
 
+#include "NoWarning/pup.hpp"
+
 #include "Types.hpp"
 
 namespace tk {
@@ -33,14 +35,29 @@ class H5PartWriter {
     //! Constructor: create/open H5Part file
     explicit H5PartWriter( const std::string& filename );
 
-    //! Write particle coordinates to H5Part file
-    void writeCoords( uint64_t it,
-                      const std::vector< tk::real >& x,
-                      const std::vector< tk::real >& y,
-                      const std::vector< tk::real >& z ) const;
+    //! Write particle coordinates, fields, and ids to H5Part file
+    void writeParticles( uint64_t it,
+                         const std::vector< tk::real >& x,
+                         const std::vector< tk::real >& y,
+                         const std::vector< tk::real >& z,
+                         const std::vector< std::string >& names,
+                         const std::vector< std::vector< tk::real > >& fields,
+                         const std::vector< uint64_t >& id ) const;
+
+    /** @name Pack/Unpack: Serialize H5PartWriter object for Charm++ */
+    ///@{
+    //! \brief Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \note Unpacking does not truncate the file, unlike the constructor.
+    void pup( PUP::er& p ) { p | m_filename; }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] w H5PartWriter object reference
+    friend void operator|( PUP::er& p, H5PartWriter& w ) { w.pup(p); }
+    ///@}
 
   private:
-    const std::string m_filename;               //!< File name
+    std::string m_filename;                     //!< File name
 };
 
 } // tk::
@@ -11,6 +11,10 @@
 // *****************************************************************************
 
 #include <string>
+#include <array>
+#include <fstream>
+#include <limits>
+#include <cstdio>
 
 #include "MeshFactory.hpp"
 #include "MeshDetect.hpp"
@@ -28,6 +32,8 @@
 #include "ExodusIIMeshWriter.hpp"
 #include "DerivedData.hpp"
 #include "Reorder.hpp"
+#include "MeshStream.hpp"
+#include "ExternalSort.hpp"
 #include "QuinoaConfig.hpp"
 
 #ifdef HAS_OMEGA_H
@@ -178,4 +184,262 @@ writeUnsMesh( const tk::Print& print,
   return times;
 }
 
+bool
+streamable( const std::string& input, const std::string& output )
+// *****************************************************************************
+//  Query if a mesh conversion can be done by streaming the mesh in chunks
+//! \param[in] input Filename to read mesh from
+//! \param[in] output Filename to write mesh to
+//! \return True if streamUnsMesh() supports the formats of input and output
+//! \details Streaming requires a mesh reader that can pass the mesh in chunks
+//!   and a mesh writer that can write the mesh in chunks, which are available
+//!   for the Gmsh and the Netgen formats.
+// *****************************************************************************
+{
+  const auto in = detectInput( input );
+  const auto out = pickOutput( output );
+  return (in == MeshReaderType::GMSH || in == MeshReaderType::NETGEN) &&
+         (out == MeshWriterType::GMSH || out == MeshWriterType::NETGEN);
+}
+
+std::vector< std::pair< std::string, tk::real > >
+streamUnsMesh( const tk::Print& print,
+               const std::string& input,
+               const std::string& output,
+               std::size_t chunk )
+// *****************************************************************************
+//  Convert unstructured mesh from file to file in chunks
+//! \param[in] print Pretty printer
+//! \param[in] input Filename to read mesh from
+//! \param[in] output Filename to write mesh to
+//! \param[in] chunk Number of nodes or elements held in memory at a time
+//! \return Vector of time stamps consisting of a timer label (a string), and a
+//!   time state (a tk::real in seconds) measuring the mesh read, surface mesh
+//!   generation, and the mesh write time
+//! \details As opposed to readUnsMesh() followed by writeUnsMesh(), the mesh
+//!   is never held in memory as a whole: its nodes and elements are spooled in
+//!   chunks from the input file into binary temporary files, named after the
+//!   output file, from which the output file is written in chunks. The memory
+//!   required is thus bounded by the chunk size, independent of the mesh size.
+//!   The output is the same as that of writeUnsMesh() without reordering. If
+//!   the mesh has tetrahedra but no triangles, the boundary triangles are
+//!   generated from the stream of tetrahedron faces sorted externally, see
+//!   tk::externalSort(), yielding the faces in the same order as
+//!   tk::genEsuelTet() would.
+// *****************************************************************************
+{
+  std::vector< std::pair< std::string, tk::real > > times;
+
+  tk::Timer t;
+
+  print.diagstart( "Streaming mesh from file '" + input + "' ..." );
+
+  // Spool nodes and elements to temporary files, elements in separate files
+  // for lines, triangles, and tetrahedra, recording their number, and the
+  // smallest node id each element type refers to
+  struct Spool {
+    std::string name;
+    std::size_t n = 0;
+    std::size_t min = std::numeric_limits< std::size_t >::max();
+  };
+  using Point = std::array< tk::real, 3 >;
+  Spool coord{ output + ".coord" };
+  std::array< Spool, 3 > conn{{ { output + ".lin" }, { output + ".tri" },
+                                { output + ".tet" } }};
+  {
+    std::ofstream cf( coord.name, std::ios::binary );
+    std::array< std::ofstream, 3 > ef;
+    for (std::size_t i=0; i<3; ++i)
+      ef[i].open( conn[i].name, std::ios::binary );
+
+    auto nodes = [&]( const UnsMesh::Coords& c ){
+      std::vector< Point > p( c[0].size() );
+      for (std::size_t i=0; i<p.size(); ++i)
+        p[i] = {{ c[0][i], c[1][i], c[2][i] }};
+      writeRecords( cf, p );
+      coord.n += p.size(); };
+    auto elems = [&]( std::size_t nnpe, const std::vector< std::size_t >& e ){
+      auto& s = conn[ nnpe-2 ];
+      writeRecords( ef[ nnpe-2 ], e );
+      s.n += e.size() / nnpe;
+      s.min = std::min( s.min, *std::min_element( begin(e), end(e) ) ); };
+
+    const auto meshtype = detectInput( input );
+    if (meshtype == MeshReaderType::GMSH)
+      GmshMeshReader( input ).readMesh( nodes, elems, chunk );
+    else if (meshtype == MeshReaderType::NETGEN)
+      NetgenMeshReader( input ).readMesh( nodes, elems, chunk );
+    else
+      Throw( "Mesh format of file '" + input + "' cannot be streamed" );
+
+    ErrChk( !cf.bad() && !ef[0].bad() && !ef[1].bad() && !ef[2].bad(),
+            "Failed to write temporary files of " + output );
+  }
+
+  print.diagend( "done" );
+  times.emplace_back( "Stream mesh from file '" + input + '\'', t.dsec() );
+  t.zero();
+
+  auto& tri = conn[1];
+  const auto& tet = conn[2];
+
+  // If mesh has tetrahedra but no triangles, generate triangle connectivity
+  if (tet.n > 0 && tri.n == 0) {
+    print.diagstart( "Generating missing surface mesh ..." );
+
+    // Tetrahedron face: sorted node ids, face id, and oriented node ids
+    struct Face {
+      std::array< std::size_t, 3 > key;
+      std::size_t id;
+      std::array< std::size_t, 3 > node;
+    };
+    const auto face = output + ".face";
+    const auto sorted = output + ".face.sorted";
+    {
+      std::ifstream is( tet.name, std::ios::binary );
+      std::ofstream os( face, std::ios::binary );
+      std::vector< std::size_t > inpoel;
+      std::vector< Face > f;
+      for (std::size_t e=0; readRecords( is, inpoel, chunk*4 );
+           e += inpoel.size()/4)
+      {
+        f.clear();
+        for (std::size_t i=0; i<inpoel.size()/4; ++i)
+          for (std::size_t l=0; l<4; ++l) {
+            Face g;
+            g.id = (e+i)*4 + l;
+            for (std::size_t n=0; n<3; ++n)
+              g.node[n] = inpoel[ i*4 + tk::lpofa[l][n] ];
+            g.key = g.node;
+            std::sort( begin(g.key), end(g.key) );
+            f.push_back( g );
+          }
+        writeRecords( os, f );
+      }
+    }
+
+    // Sort faces by their nodes and keep the faces not shared by tetrahedra
+    externalSort< Face >( face, sorted, chunk*4,
+      []( const Face& a, const Face& b ){ return a.key < b.key; } );
+    {
+      std::ifstream is( sorted, std::ios::binary );
+      std::ofstream os( face, std::ios::binary );
+      std::vector< Face > f, bnd;
+      Face prev{};
+      std::size_t nprev = 0;
+      while (readRecords( is, f, chunk )) {
+        bnd.clear();
+        for (const auto& g : f) {
+          if (nprev > 0 && g.key == prev.key) { ++nprev; continue; }
+          if (nprev == 1) bnd.push_back( prev );
+          prev = g;
+          nprev = 1;
+        }
+        writeRecords( os, bnd );
+      }
+      if (nprev == 1) writeRecords( os, std::vector< Face >{ prev } );
+    }
+
+    // Sort boundary faces by face id, i.e., by tetrahedron and face, and
+    // spool them as triangles, referring to the node ids of tetrahedra
+    externalSort< Face >( face, sorted, chunk,
+      []( const Face& a, const Face& b ){ return a.id < b.id; } );
+    {
+      std::ifstream is( sorted, std::ios::binary );
+      std::ofstream os( tri.name, std::ios::binary );
+      std::vector< Face > f;
+      std::vector< std::size_t > inpoel;
+      while (readRecords( is, f, chunk )) {
+        inpoel.clear();
+        for (const auto& g : f)
+          inpoel.insert( end(inpoel), begin(g.node), end(g.node) );
+        writeRecords( os, inpoel );
+        tri.n += f.size();
+      }
+      tri.min = tet.min;
+    }
+    std::remove( face.c_str() );
+    std::remove( sorted.c_str() );
+
+    print.diagend( "done" );
+    times.emplace_back( "Generate surface mesh", t.dsec() );
+    t.zero();
+  }
+
+  print.diagstart( "Writing mesh to file '" + output + "' ..." );
+
+  // Read spooled nodes in chunks and pass them on
+  auto nodes = [&]( const auto& write ){
+    std::ifstream is( coord.name, std::ios::binary );
+    std::vector< Point > p;
+    std::array< std::vector< tk::real >, 3 > c;
+    for (std::size_t offset=0; readRecords( is, p, chunk );
+         offset += p.size())
+    {
+      for (auto& x : c) x.resize( p.size() );
+      for (std::size_t i=0; i<p.size(); ++i)
+        for (std::size_t d=0; d<3; ++d) c[d][i] = p[i][d];
+      write( c, offset );
+    }
+  };
+  // Read spooled elements in chunks, shift node ids to start from zero, and
+  // pass them on
+  auto elems = [&]( std::size_t nnpe, const auto& write ){
+    const auto& s = conn[ nnpe-2 ];
+    std::ifstream is( s.name, std::ios::binary );
+    std::vector< std::size_t > inpoel;
+    for (std::size_t offset=0; readRecords( is, inpoel, chunk*nnpe );
+         offset += inpoel.size()/nnpe)
+    {
+      for (auto& p : inpoel) p -= s.min;
+      write( inpoel, offset );
+    }
+  };
+
+  const auto meshtype = pickOutput( output );
+
+  if (meshtype == MeshWriterType::GMSH) {
+
+    GmshMeshWriter w( output );
+    w.writeNodeHeader( coord.n );
+    nodes( [&]( const UnsMesh::Coords& c, std::size_t offset ){
+      w.writeNodeChunk( c[0], c[1], c[2], offset ); } );
+    w.writeNodeFooter();
+    w.writeElemHeader( conn[0].n + conn[1].n + conn[2].n );
+    const std::array< GmshElemType, 3 >
+      type{{ GmshElemType::LIN, GmshElemType::TRI, GmshElemType::TET }};
+    for (std::size_t nnpe=2; nnpe<=4; ++nnpe) {
+      if (conn[ nnpe-2 ].n == 0) continue;
+      w.writeElemBlockHeader( type[ nnpe-2 ], conn[ nnpe-2 ].n );
+      elems( nnpe,
+             [&]( const std::vector< std::size_t >& e, std::size_t offset ){
+               w.writeElemChunk( nnpe, type[ nnpe-2 ], e, offset ); } );
+    }
+    w.writeElemFooter();
+
+  } else if (meshtype == MeshWriterType::NETGEN) {
+
+    NetgenMeshWriter w( output );
+    w.writeCount( coord.n );
+    nodes( [&]( const UnsMesh::Coords& c, std::size_t ){
+      w.writeNodeChunk( c[0], c[1], c[2] ); } );
+    // Triangles are only written if there are tetrahedra
+    for (std::size_t nnpe : { 4UL, 3UL }) {
+      if (conn[2].n == 0 || conn[ nnpe-2 ].n == 0) continue;
+      w.writeCount( conn[ nnpe-2 ].n );
+      elems( nnpe, [&]( const std::vector< std::size_t >& e, std::size_t ){
+        w.writeElemChunk( nnpe, e ); } );
+    }
+
+  } else Throw( "Mesh format of file '" + output + "' cannot be streamed" );
+
+  std::remove( coord.name.c_str() );
+  for (const auto& s : conn) std::remove( s.name.c_str() );
+
+  print.diagend( "done" );
+  times.emplace_back( "Write mesh to file", t.dsec() );
+
+  return times;
+}
+
 } // tk::
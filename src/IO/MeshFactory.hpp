@@ -34,6 +34,17 @@ writeUnsMesh( const tk::Print& print,
               UnsMesh& mesh,
               bool reorder );
 
+//! Query if a mesh conversion can be done by streaming the mesh in chunks
+bool
+streamable( const std::string& input, const std::string& output );
+
+//! Convert unstructured mesh from file to file in chunks
+std::vector< std::pair< std::string, tk::real > >
+streamUnsMesh( const tk::Print& print,
+               const std::string& input,
+               const std::string& output,
+               std::size_t chunk );
+
 } // tk::
 
 #endif // MeshFactory_h
@@ -62,14 +62,29 @@ class MeshReader {
 
     //! Public interface to read part of the mesh (graph and coords) from file
     //! \details Total number of PEs defaults to 1 for a single-CPU read, this
-    //!    PE defaults to 0 for a single-CPU read.
+    //!    PE defaults to 0 for a single-CPU read. If readtri is false, the
+    //!    triangle elements are not read, see readTriangleChunk(). If partvar
+    //!    is not empty, it names the element variable in the file storing the
+    //!    PE of each element, and each PE reads the elements assigned to it.
     void readMeshPart( std::vector< std::size_t >& ginpoel,
                        std::vector< std::size_t >& inpoel,
                        std::vector< std::size_t >& triinp,
                        std::unordered_map< std::size_t, std::size_t >& lid,
                        tk::UnsMesh::Coords& coord, 
-                       int numpes=1, int mype=0 )
-    { self->readMeshPart( ginpoel, inpoel, triinp, lid, coord, numpes, mype ); }
+                       int numpes=1, int mype=0, bool readtri=true,
+                       const std::string& partvar = {} )
+    { self->readMeshPart( ginpoel, inpoel, triinp, lid, coord, numpes, mype,
+                          readtri, partvar ); }
+
+    //! Public interface to read a chunk of the triangle elements from file
+    std::size_t readTriangleChunk( std::vector< std::size_t >& triinp,
+                                   int numpes, int mype ) const
+    { return self->readTriangleChunk( triinp, numpes, mype ); }
+
+    //! \brief Public interface to store the triangle elements that are faces
+    //!   of this PE's mesh chunk
+    void ownTriangles( const std::vector< std::size_t >& triid )
+    { self->ownTriangles( triid ); }
     //! ...
     std::vector< std::size_t > triinpoel(
      std::map< int, std::vector< std::size_t > >& bface,
@@ -117,7 +132,10 @@ class MeshReader {
                      std::vector< std::size_t >&,
                      std::unordered_map< std::size_t, std::size_t >&,
                      tk::UnsMesh::Coords&,
-                     int, int ) = 0;
+                     int, int, bool, const std::string& ) = 0;
+      virtual std::size_t
+        readTriangleChunk( std::vector< std::size_t >&, int, int ) const = 0;
+      virtual void ownTriangles( const std::vector< std::size_t >& ) = 0;
       virtual void
         readSidesetFaces( std::map< int, std::vector< std::size_t > >&,
                           std::map< int, std::vector< std::size_t > >& ) = 0;
@@ -143,9 +161,15 @@ class MeshReader {
                          std::vector< std::size_t >& triinp,
                          std::unordered_map< std::size_t, std::size_t >& lid,
                          tk::UnsMesh::Coords& coord, 
-                         int numpes, int mype ) override
+                         int numpes, int mype, bool readtri,
+                         const std::string& partvar ) override
         { data.readMeshPart( ginpoel, inpoel, triinp, lid, coord, numpes,
-                             mype ); }
+                             mype, readtri, partvar ); }
+      std::size_t readTriangleChunk( std::vector< std::size_t >& triinp,
+                                     int numpes, int mype ) const override
+        { return data.readTriangleChunk( triinp, numpes, mype ); }
+      void ownTriangles( const std::vector< std::size_t >& triid ) override
+        { data.ownTriangles( triid ); }
       std::vector< std::size_t > triinpoel(
         std::map< int, std::vector< std::size_t > >& bface,
         const std::map< int, std::vector< std::size_t > >& faceid,
@@ -0,0 +1,39 @@
+// *****************************************************************************
+/*!
+  \file      src/IO/MeshStream.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Types used to stream meshes in chunks through mesh readers
+  \details   Types used to stream meshes in chunks through mesh readers. Mesh
+    readers supporting streaming hand the mesh they read over in bounded
+    chunks of nodes and elements to functions of these types, instead of
+    storing the whole mesh in a tk::UnsMesh, so that mesh files larger than
+    the memory available can be converted, see tk::streamUnsMesh().
+*/
+// *****************************************************************************
+#ifndef MeshStream_h
+#define MeshStream_h
+
+#include <functional>
+#include <vector>
+#include <cstddef>
+
+#include "UnsMesh.hpp"
+
+namespace tk {
+
+//! Function receiving a chunk of node coordinates, in the order of the nodes
+//!   in the file
+using NodeChunkFn = std::function< void( const UnsMesh::Coords& ) >;
+
+//! \brief Function receiving a chunk of element connectivity, as the number
+//!   of nodes per element (2: line, 3: triangle, 4: tetrahedron) and node ids
+//!   as in the file, i.e., not shifted to start from zero
+using ElemChunkFn =
+  std::function< void( std::size_t, const std::vector< std::size_t >& ) >;
+
+} // tk::
+
+#endif // MeshStream_h
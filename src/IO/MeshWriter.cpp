@@ -13,10 +13,16 @@
 */
 // *****************************************************************************
 
+#include <memory>
+#include <cstdint>
+#include <unordered_map>
+#include <algorithm>
+
 #include "QuinoaConfig.hpp"
 #include "MeshWriter.hpp"
 #include "Reorder.hpp"
 #include "ExodusIIMeshWriter.hpp"
+#include "Timer.hpp"
 
 #ifdef HAS_ROOT
   #include "RootMeshWriter.hpp"
@@ -26,11 +32,24 @@ using tk::MeshWriter;
 
 MeshWriter::MeshWriter( ctr::FieldFileType filetype,
                         Centering bnd_centering,
-                        bool benchmark ) :
+                        bool benchmark,
+                        bool aggregate,
+                        bool persistent,
+                        uint32_t compression,
+                        tk::real lossytol ) :
   m_filetype( filetype ),
   m_bndCentering( bnd_centering ),
   m_benchmark( benchmark ),
-  m_nchare( 0 )
+  m_nchare( 0 ),
+  m_aggregate( aggregate ),
+  m_persistent( persistent ),
+  m_compression( compression ),
+  m_lossytol( lossytol ),
+  m_exo(),
+  m_iostat( {{ 0.0, 0.0, 0.0 }} ),
+  m_dump(),
+  m_nexpect( -1 ),
+  m_part()
 // *****************************************************************************
 //  Constructor: set some defaults that stay constant at all times
 //! \param[in] filetype Output file format type
@@ -40,6 +59,14 @@ MeshWriter::MeshWriter( ctr::FieldFileType filetype,
 //! \param[in] benchmark True of benchmark mode. No field output happens in
 //!   benchmark mode. This (and associated if tests) are here so client code
 //!   does not have to deal with this.
+//! \param[in] aggregate True if aggregating the output of all chares on a
+//!   compute node into a single file per compute node
+//! \param[in] persistent True if keeping ExodusII files open across field
+//!   outputs of the same mesh
+//! \param[in] compression Deflate level (1-9) of ExodusII files written, 0:
+//!   write uncompressed
+//! \param[in] lossytol Relative tolerance of rounding node and element fields
+//!   written to ExodusII files for better compression, 0: write exact values
 // *****************************************************************************
 {
 }
@@ -54,17 +81,76 @@ MeshWriter::nchare( int n )
   m_nchare = n;
 }
 
+void
+MeshWriter::close( int id )
+// *****************************************************************************
+// Close the files kept open of a chare
+//! \param[in] id Chare id whose files to close
+//! \details Called by a chare whose writes have moved to another compute
+//!   node, e.g., due to migration. Since the files are updated after every
+//!   field output, closing them does not interfere with the writer opening
+//!   them on the other compute node.
+// *****************************************************************************
+{
+  for (auto e = begin(m_exo); e != end(m_exo); )
+    if (e->first.first == id) e = m_exo.erase( e ); else ++e;
+}
+
+void
+MeshWriter::iostat( CkCallback c )
+// *****************************************************************************
+// Contribute the I/O statistics of this writer since the last call
+//! \param[in] c Function to send the statistics of all writers to
+//! \details Only the first PE of a compute node receives writes, so each of
+//!   those fills in its own slot of a vector indexed by compute node ids, and
+//!   the reduction target receives the statistics of each writer. The
+//!   statistics are zeroed for the next call.
+// *****************************************************************************
+{
+  auto n = static_cast< std::size_t >( CkNumNodes() );
+  std::vector< tk::real > s( NUMIOSTAT*n, 0.0 );
+  if (CkMyPe() == CkNodeFirst( CkMyNode() ))
+    std::copy( begin(m_iostat), end(m_iostat),
+      begin(s) + static_cast< std::ptrdiff_t >( NUMIOSTAT*CkMyNode() ) );
+  m_iostat.fill( 0.0 );
+
+  contribute( s, CkReduction::sum_double, c );
+}
+
+void
+MeshWriter::nwrite( [[maybe_unused]] int n, int* cnt )
+// *****************************************************************************
+// Receive the number of chares writing on each compute node
+//! \param[in] n Number of compute nodes
+//! \param[in] cnt Number of chares writing in this output dump on each compute
+//!   node
+//! \details This is a reduction target broadcast to all PEs, but only the
+//!   first PE of a compute node, which receives the writes, uses it.
+// *****************************************************************************
+{
+  Assert( n == CkNumNodes(), "Size mismatch" );
+
+  if (CkMyPe() != CkNodeFirst( CkMyNode() )) return;
+
+  m_nexpect = cnt[ CkMyNode() ];
+  aggregate();
+}
+
 void
 MeshWriter::write(
   bool meshoutput,
   bool fieldoutput,
+  bool surfmeshoutput,
+  bool surffieldoutput,
   uint64_t itr,
   uint64_t itf,
+  uint64_t itsf,
   tk::real time,
   int chareid,
   const std::string& basefilename,
   const std::vector< std::size_t >& inpoel,
   const UnsMesh::Coords& coord,
+  const std::vector< std::size_t >& gid,
   const std::map< int, std::vector< std::size_t > >& bface,
   const std::map< int, std::vector< std::size_t > >& bnode,
   const std::vector< std::size_t >& triinpoel,
@@ -78,17 +164,22 @@ MeshWriter::write(
   CkCallback c )
 // *****************************************************************************
 //  Output unstructured mesh into file
-//! \param[in] meshoutput True if mesh is to be written
-//! \param[in] fieldoutput True if field data is to be written
+//! \param[in] meshoutput True if the volume mesh is to be written
+//! \param[in] fieldoutput True if volume field data is to be written
+//! \param[in] surfmeshoutput True if the surface meshes are to be written
+//! \param[in] surffieldoutput True if surface field data is to be written
 //! \param[in] itr Iteration count since a new mesh. New mesh in this context
 //!   means that either the mesh is moved and/or its topology has changed.
-//! \param[in] itf Field output iteration count
+//! \param[in] itf Volume field output iteration count
+//! \param[in] itsf Surface field output iteration count
 //! \param[in] time Physical time this at this field output dump
 //! \param[in] chareid The chare id the write-to-file request is coming from
 //! \param[in] basefilename String to use as the base of the filename
 //! \param[in] inpoel Mesh connectivity for the mesh chunk to be written with
 //!   local ids
 //! \param[in] coord Node coordinates of the mesh chunk to be written
+//! \param[in] gid Global ids of the nodes of the mesh chunk to be written,
+//!   only used if aggregating the output of chares
 //! \param[in] bface Map of boundary-face lists mapped to corresponding side set
 //!   ids for this mesh chunk
 //! \param[in] bnode Map of boundary-node lists mapped to corresponding side set
@@ -104,137 +195,516 @@ MeshWriter::write(
 //! \param[in] outsets Unique set of surface side set ids along which to save
 //!   solution field variables
 //! \param[in] c Function to continue with after the write
+//! \details If aggregating the output of chares, the data is buffered until
+//!   all chares on this compute node have sent theirs, see nwrite(), and the
+//!   function to continue with is called after the aggregated write.
 // *****************************************************************************
 {
-  if (!m_benchmark) {
-
-    // Generate filenames for volume and surface field output
-    auto vf = filename( basefilename, itr, chareid );
-  
-    if (meshoutput) {
-      #ifdef HAS_ROOT
-      if (m_filetype == ctr::FieldFileType::ROOT) {
-
-        RootMeshWriter rmw( vf, 0 );
-        rmw.writeMesh( UnsMesh( inpoel, coord ) );
-        rmw.writeNodeVarNames( nodefieldnames );
-
-      } else
-      #endif
-      if (m_filetype == ctr::FieldFileType::EXODUSII) {
-
-        // Write volume mesh and field names
-        ExodusIIMeshWriter ev( vf, ExoWriter::CREATE );
-        // Write chare mesh (do not write side sets in parallel)
-        if (m_nchare == 1) {
-
-          if (m_bndCentering == Centering::ELEM)
-            ev.writeMesh( inpoel, coord, bface, triinpoel );
-          else if (m_bndCentering == Centering::NODE)
-            ev.writeMesh( inpoel, coord, bnode );
-          else Throw( "Centering not handled for writing mesh" );
-
-        } else {
-          ev.writeMesh< 4 >( inpoel, coord );
-        }
-        ev.writeElemVarNames( elemfieldnames );
-        Assert( nodefieldnames.size() == nodefields.size(), "Size mismatch" );
-        ev.writeNodeVarNames( nodefieldnames );
-
-        // Write surface meshes and surface variable field names
-        for (auto s : outsets) {
-          auto sf = filename( basefilename, itr, chareid, s );
-          ExodusIIMeshWriter es( sf, ExoWriter::CREATE );
-          auto b = bface.find(s);
-          if (b == end(bface)) {
-            // If a side set does not exist on a chare, write out a
-            // connectivity for a single triangle with its node coordinates of
-            // zero. This is so the paraview series reader can load side sets
-            // distributed across multiple files. See also
-            // https://www.paraview.org/Wiki/Restarted_Simulation_Readers.
-            es.writeMesh< 3 >( std::vector< std::size_t >{1,2,3},
-              UnsMesh::Coords{{ {{0,0,0}}, {{0,0,0}}, {{0,0,0}} }} );
-            es.writeNodeVarNames( nodesurfnames );
-            continue;
-          }
-          std::vector< std::size_t > nodes;
-          for (auto f : b->second) {
-            nodes.push_back( triinpoel[f*3+0] );
-            nodes.push_back( triinpoel[f*3+1] );
-            nodes.push_back( triinpoel[f*3+2] );
-          }
-          auto [inp,gid,lid] = tk::global2local( nodes );
-          tk::unique( nodes );
-          auto nnode = nodes.size();
-          UnsMesh::Coords scoord;
-          scoord[0].resize( nnode );
-          scoord[1].resize( nnode );
-          scoord[2].resize( nnode );
-          std::size_t j = 0;
-          for (auto i : nodes) {
-            scoord[0][j] = coord[0][i];
-            scoord[1][j] = coord[1][i];
-            scoord[2][j] = coord[2][i];
-            ++j;
-          }
-          es.writeMesh< 3 >( inp, scoord );
-          es.writeNodeVarNames( nodesurfnames );
-        }
+  if (!m_benchmark && m_aggregate) {
+
+    m_dump = { meshoutput, fieldoutput, surfmeshoutput, surffieldoutput, itr,
+               itf, itsf, time, basefilename, elemfieldnames, nodefieldnames,
+               nodesurfnames, outsets };
+    m_part.push_back( { chareid, inpoel, coord, gid, bface, bnode, triinpoel,
+                        elemfields, nodefields, nodesurfs, c } );
+    aggregate();
+
+  } else {
+
+    if (!m_benchmark)
+      output( meshoutput, fieldoutput, surfmeshoutput, surffieldoutput, itr,
+              itf, itsf, time, chareid, basefilename, inpoel, coord, bface,
+              bnode, triinpoel, elemfieldnames, nodefieldnames, nodesurfnames,
+              elemfields, nodefields, nodesurfs, outsets );
+
+    c.send();
+
+  }
+}
+
+void
+MeshWriter::writeLocal( uint64_t req )
+// *****************************************************************************
+//  Output unstructured mesh into file, taking over a write request
+//! \param[in] req Address of a write request allocated with new by a chare
+//!   on this compute node, whose ownership is taken over
+//! \details Chares only write through the mesh writer on the first PE of
+//!   their own compute node, i.e., in their own address space, so instead of
+//!   serializing the mesh chunk and fields into a message, which is then
+//!   copied again to the arguments of write(), they hand over the address of
+//!   a request they own no longer. The request is released after the write,
+//!   or, if aggregating, its mesh chunk and fields are moved to the buffer of
+//!   the dump being aggregated.
+// *****************************************************************************
+{
+  std::unique_ptr< Request >
+    r( reinterpret_cast< Request* >( static_cast< std::uintptr_t >( req ) ) );
+  auto& d = r->dump;
+  auto& p = r->part;
+
+  if (!m_benchmark && m_aggregate) {
+
+    m_dump = std::move( d );
+    m_part.push_back( std::move( p ) );
+    aggregate();
 
+  } else {
+
+    write( d.meshoutput, d.fieldoutput, d.surfmeshoutput, d.surffieldoutput,
+           d.itr, d.itf, d.itsf, d.time, p.chareid, d.basefilename, p.inpoel,
+           p.coord, p.gid, p.bface, p.bnode, p.triinpoel, d.elemfieldnames,
+           d.nodefieldnames, d.nodesurfnames, p.elemfields, p.nodefields,
+           p.nodesurfs, d.outsets, p.c );
+
+  }
+}
+
+void
+MeshWriter::aggregate()
+// *****************************************************************************
+//  Stitch the mesh chunks and fields of all chares on this compute node
+//  together and output them into file(s) if all have arrived
+//! \details The chunks are stitched in the order of chare ids, their nodes
+//!   numbered in the order the global ids first appear in. Nodes shared by
+//!   multiple chares are written once, taking the node field values of the
+//!   last of these chares.
+// *****************************************************************************
+{
+  if (m_nexpect < 0 || m_part.size() != static_cast< std::size_t >(m_nexpect))
+    return;
+
+  if (!m_part.empty()) {
+
+    std::sort( begin(m_part), end(m_part),
+      []( const Part& a, const Part& b ){ return a.chareid < b.chareid; } );
+
+    // Number the unique global node ids of all chunks and collect coordinates
+    std::unordered_map< std::size_t, std::size_t > gl;
+    std::vector< std::vector< std::size_t > > lid( m_part.size() );
+    UnsMesh::Coords coord;
+    for (std::size_t p=0; p<m_part.size(); ++p) {
+      const auto& x = m_part[p].coord;
+      const auto& gid = m_part[p].gid;
+      Assert( gid.size() >= x[0].size(), "Size mismatch" );
+      lid[p].resize( x[0].size() );
+      for (std::size_t i=0; i<x[0].size(); ++i) {
+        auto l = gl.emplace( gid[i], gl.size() );
+        if (l.second)
+          for (std::size_t j=0; j<3; ++j) coord[j].push_back( x[j][i] );
+        lid[p][i] = l.first->second;
       }
     }
+    auto npoin = coord[0].size();
 
-    if (fieldoutput) {
-      #ifdef HAS_ROOT
-      if (m_filetype == ctr::FieldFileType::ROOT) {
-
-        RootMeshWriter rw( vf, 1 );
-        rw.writeTimeStamp( itf, time );
-        int varid = 0;
-        for (const auto& v : nodefields) rw.writeNodeScalar( itf, ++varid, v );
-
-      } else
-      #endif
-      if (m_filetype == ctr::FieldFileType::EXODUSII) {
-
-        // Write volume variable fields
-        ExodusIIMeshWriter ev( vf, ExoWriter::OPEN );
-        ev.writeTimeStamp( itf, time );
-        // Write volume element variable fields
-        int varid = 0;
-        for (const auto& v : elemfields) ev.writeElemScalar( itf, ++varid, v );
-        // Write volume node variable fields
-        varid = 0;
-        for (const auto& v : nodefields) ev.writeNodeScalar( itf, ++varid, v );
-
-        // Write surface node variable fields
-        std::size_t j = 0;
-        auto nvar = static_cast< int >( nodesurfnames.size() ) ;
-        for (auto s : outsets) {
-          auto sf = filename( basefilename, itr, chareid, s );
-          ExodusIIMeshWriter es( sf, ExoWriter::OPEN );
-          es.writeTimeStamp( itf, time );
-          if (bface.find(s) == end(bface)) {
-            // If a side set does not exist on a chare, write out a
-            // a node field for a single triangle with zeros. This is so the
-            // paraview series reader can load side sets distributed across
-            // multiple files. See also
-            // https://www.paraview.org/Wiki/Restarted_Simulation_Readers.
-            for (int i=1; i<=nvar; ++i) es.writeNodeScalar( itf, i, {0,0,0} );
-            continue;
-          }
-          for (int i=1; i<=nvar; ++i)
-            es.writeNodeScalar( itf, i, nodesurfs[j++] );
+    // Concatenate connectivities, boundary faces, and element fields, and
+    // collect node and surface node fields
+    std::vector< std::size_t > inpoel, triinpoel;
+    std::map< int, std::vector< std::size_t > > bface;
+    std::vector< std::vector< tk::real > >
+      elemfields( m_part[0].elemfields.size() ),
+      nodefields( m_part[0].nodefields.size(),
+                  std::vector< tk::real >( npoin, 0.0 ) );
+    auto nvar = m_dump.nodesurfnames.size();
+    std::map< int, std::map< std::size_t, std::vector< tk::real > > > surf;
+    for (std::size_t p=0; p<m_part.size(); ++p) {
+      const auto& part = m_part[p];
+      const auto& l = lid[p];
+      for (auto i : part.inpoel) inpoel.push_back( l[i] );
+      auto nf = triinpoel.size() / 3;
+      for (auto i : part.triinpoel) triinpoel.push_back( l[i] );
+      for (const auto& [s,faces] : part.bface) {
+        auto& b = bface[s];
+        for (auto f : faces) b.push_back( nf + f );
+      }
+      Assert( part.elemfields.size() == elemfields.size() &&
+              part.nodefields.size() == nodefields.size(), "Size mismatch" );
+      for (std::size_t v=0; v<elemfields.size(); ++v)
+        elemfields[v].insert( end(elemfields[v]), begin(part.elemfields[v]),
+                              end(part.elemfields[v]) );
+      for (std::size_t v=0; v<nodefields.size(); ++v)
+        for (std::size_t i=0; i<l.size(); ++i)
+          nodefields[v][ l[i] ] = part.nodefields[v][i];
+      // Surface node fields are given at the unique nodes of the side sets
+      // present on the chunk in ascending order of local ids
+      std::size_t j = 0;
+      for (auto s : m_dump.outsets) {
+        auto b = part.bface.find( s );
+        if (b == end(part.bface)) continue;
+        std::vector< std::size_t > nodes;
+        for (auto f : b->second)
+          for (std::size_t k=0; k<3; ++k)
+            nodes.push_back( part.triinpoel[f*3+k] );
+        tk::unique( nodes );
+        auto& sv = surf[s];
+        for (std::size_t n=0; n<nodes.size(); ++n) {
+          auto& v = sv[ l[nodes[n]] ];
+          v.resize( nvar );
+          for (std::size_t i=0; i<nvar; ++i)
+            v[i] = part.nodesurfs[j+i][n];
         }
+        j += nvar;
+      }
+    }
+
+    // Order surface node fields as given by a single chunk
+    std::vector< std::vector< tk::real > > nodesurfs;
+    for (auto s : m_dump.outsets) {
+      auto sv = surf.find( s );
+      if (sv == end(surf)) continue;
+      for (std::size_t i=0; i<nvar; ++i) {
+        nodesurfs.emplace_back();
+        for (const auto& n : sv->second)
+          nodesurfs.back().push_back( n.second[i] );
+      }
+    }
+
+    // Side sets are only written with a single chunk, whose nodes are not
+    // renumbered
+    output( m_dump.meshoutput, m_dump.fieldoutput, m_dump.surfmeshoutput,
+            m_dump.surffieldoutput, m_dump.itr, m_dump.itf, m_dump.itsf,
+            m_dump.time, CkMyNode(), m_dump.basefilename, inpoel, coord,
+            bface, m_part.size() == 1 ? m_part[0].bnode :
+                   std::map< int, std::vector< std::size_t > >(),
+            triinpoel, m_dump.elemfieldnames, m_dump.nodefieldnames,
+            m_dump.nodesurfnames, elemfields, nodefields, nodesurfs,
+            m_dump.outsets );
+
+  }
+
+  // Continue with the chares after the write and get ready for the next dump
+  auto part = std::move( m_part );
+  m_part.clear();
+  m_nexpect = -1;
+  for (auto& p : part) p.c.send();
+}
+
+void
+MeshWriter::output(
+  bool meshoutput,
+  bool fieldoutput,
+  bool surfmeshoutput,
+  bool surffieldoutput,
+  uint64_t itr,
+  uint64_t itf,
+  uint64_t itsf,
+  tk::real time,
+  int id,
+  const std::string& basefilename,
+  const std::vector< std::size_t >& inpoel,
+  const UnsMesh::Coords& coord,
+  const std::map< int, std::vector< std::size_t > >& bface,
+  const std::map< int, std::vector< std::size_t > >& bnode,
+  const std::vector< std::size_t >& triinpoel,
+  const std::vector< std::string >& elemfieldnames,
+  const std::vector< std::string >& nodefieldnames,
+  const std::vector< std::string >& nodesurfnames,
+  const std::vector< std::vector< tk::real > >& elemfields,
+  const std::vector< std::vector< tk::real > >& nodefields,
+  const std::vector< std::vector< tk::real > >& nodesurfs,
+  const std::set< int >& outsets )
+// *****************************************************************************
+//  Output mesh chunk and fields into file(s)
+//! \param[in] meshoutput True if the volume mesh is to be written
+//! \param[in] fieldoutput True if volume field data is to be written
+//! \param[in] surfmeshoutput True if the surface meshes are to be written
+//! \param[in] surffieldoutput True if surface field data is to be written
+//! \param[in] itr Iteration count since a new mesh
+//! \param[in] itf Volume field output iteration count
+//! \param[in] itsf Surface field output iteration count
+//! \param[in] time Physical time this at this field output dump
+//! \param[in] id The chare id, or if aggregating, the compute node id, used
+//!   as the rank in the filename
+//! \param[in] basefilename String to use as the base of the filename
+//! \param[in] inpoel Mesh connectivity with local ids
+//! \param[in] coord Node coordinates
+//! \param[in] bface Map of boundary-face lists mapped to side set ids
+//! \param[in] bnode Map of boundary-node lists mapped to side set ids
+//! \param[in] triinpoel Interconnectivity of points and boundary-face
+//! \param[in] elemfieldnames Names of element fields to be output to file
+//! \param[in] nodefieldnames Names of node fields to be output to file
+//! \param[in] nodesurfnames Names of node surface fields to be output to file
+//! \param[in] elemfields Field data in mesh elements to output to file
+//! \param[in] nodefields Field data in mesh nodes to output to file
+//! \param[in] nodesurfs Surface field data in mesh nodes to output to file
+//! \param[in] outsets Unique set of surface side set ids along which to save
+//!   solution field variables
+//! \details The volume and the surface files are written independently, so
+//!   the surface fields may be output more often than the volume fields, with
+//!   their own time steps, see also Discretization::write(). The number of
+//!   bytes of mesh and field data passed and the time spent are accumulated
+//!   into the I/O statistics, see iostat().
+// *****************************************************************************
+{
+  tk::Timer timer;
+
+  // Close files kept open of meshes older than the one written
+  for (auto e = begin(m_exo); e != end(m_exo); )
+    if (e->second.first < itr) e = m_exo.erase( e ); else ++e;
+
+  if (meshoutput) {
+    #ifdef HAS_ROOT
+    if (m_filetype == ctr::FieldFileType::ROOT) {
+
+      RootMeshWriter rmw( filename( basefilename, itr, id ), 0 );
+      rmw.writeMesh( UnsMesh( inpoel, coord ) );
+      rmw.writeNodeVarNames( nodefieldnames );
+
+    } else
+    #endif
+    if (m_filetype == ctr::FieldFileType::EXODUSII) {
+
+      // Write volume mesh and field names
+      auto ev = exodus( basefilename, itr, id, 0, ExoWriter::CREATE );
+      // Write chare mesh (do not write side sets in parallel)
+      if (m_nchare == 1) {
+
+        if (m_bndCentering == Centering::ELEM)
+          ev->writeMesh( inpoel, coord, bface, triinpoel );
+        else if (m_bndCentering == Centering::NODE)
+          ev->writeMesh( inpoel, coord, bnode );
+        else Throw( "Centering not handled for writing mesh" );
+
+      } else {
+        ev->writeMesh< 4 >( inpoel, coord );
+      }
+      ev->writeElemVarNames( elemfieldnames );
+      Assert( nodefieldnames.size() == nodefields.size(), "Size mismatch" );
+      ev->writeNodeVarNames( nodefieldnames );
+
+    }
+  }
+
+  if (surfmeshoutput && m_filetype == ctr::FieldFileType::EXODUSII) {
+
+    // Write surface meshes and surface variable field names
+    for (auto s : outsets) {
+      auto es = exodus( basefilename, itr, id, s, ExoWriter::CREATE );
+      auto b = bface.find(s);
+      if (b == end(bface)) {
+        // If a side set does not exist on a chare, write out a
+        // connectivity for a single triangle with its node coordinates of
+        // zero. This is so the paraview series reader can load side sets
+        // distributed across multiple files. See also
+        // https://www.paraview.org/Wiki/Restarted_Simulation_Readers.
+        es->writeMesh< 3 >( std::vector< std::size_t >{1,2,3},
+          UnsMesh::Coords{{ {{0,0,0}}, {{0,0,0}}, {{0,0,0}} }} );
+        es->writeNodeVarNames( nodesurfnames );
+        continue;
+      }
+      std::vector< std::size_t > nodes;
+      for (auto f : b->second) {
+        nodes.push_back( triinpoel[f*3+0] );
+        nodes.push_back( triinpoel[f*3+1] );
+        nodes.push_back( triinpoel[f*3+2] );
+      }
+      auto [inp,gid,lid] = tk::global2local( nodes );
+      tk::unique( nodes );
+      auto nnode = nodes.size();
+      UnsMesh::Coords scoord;
+      scoord[0].resize( nnode );
+      scoord[1].resize( nnode );
+      scoord[2].resize( nnode );
+      std::size_t j = 0;
+      for (auto i : nodes) {
+        scoord[0][j] = coord[0][i];
+        scoord[1][j] = coord[1][i];
+        scoord[2][j] = coord[2][i];
+        ++j;
+      }
+      es->writeMesh< 3 >( inp, scoord );
+      es->writeNodeVarNames( nodesurfnames );
+    }
+
+  }
+
+  if (fieldoutput) {
+    #ifdef HAS_ROOT
+    if (m_filetype == ctr::FieldFileType::ROOT) {
+
+      RootMeshWriter rw( filename( basefilename, itr, id ), 1 );
+      rw.writeTimeStamp( itf, time );
+      int varid = 0;
+      for (const auto& v : nodefields) rw.writeNodeScalar( itf, ++varid, v );
 
+    } else
+    #endif
+    if (m_filetype == ctr::FieldFileType::EXODUSII) {
+
+      // Write volume variable fields
+      auto ev = exodus( basefilename, itr, id, 0, ExoWriter::OPEN );
+      ev->writeTimeStamp( itf, time );
+      // Write volume element variable fields
+      int varid = 0;
+      for (const auto& v : elemfields) ev->writeElemScalar( itf, ++varid, v );
+      // Write volume node variable fields
+      varid = 0;
+      for (const auto& v : nodefields) ev->writeNodeScalar( itf, ++varid, v );
+      if (m_persistent) ev->update();
+
+    }
+  }
+
+  if (surffieldoutput && m_filetype == ctr::FieldFileType::EXODUSII) {
+
+    // Write surface node variable fields
+    std::size_t j = 0;
+    auto nvar = static_cast< int >( nodesurfnames.size() ) ;
+    for (auto s : outsets) {
+      auto es = exodus( basefilename, itr, id, s, ExoWriter::OPEN );
+      es->writeTimeStamp( itsf, time );
+      if (bface.find(s) == end(bface)) {
+        // If a side set does not exist on a chare, write out a
+        // a node field for a single triangle with zeros. This is so the
+        // paraview series reader can load side sets distributed across
+        // multiple files. See also
+        // https://www.paraview.org/Wiki/Restarted_Simulation_Readers.
+        for (int i=1; i<=nvar; ++i) es->writeNodeScalar( itsf, i, {0,0,0} );
+        if (m_persistent) es->update();
+        continue;
+      }
+      for (int i=1; i<=nvar; ++i)
+        es->writeNodeScalar( itsf, i, nodesurfs[j++] );
+      if (m_persistent) es->update();
+    }
+
+  }
+
+  // Accumulate I/O statistics, the files not kept open have been closed
+  tk::real bytes = 0.0;
+  if (meshoutput)
+    bytes += static_cast< tk::real >( 3 * coord[0].size() * sizeof(tk::real) +
+                                      inpoel.size() * sizeof(int) );
+  if (fieldoutput)
+    for (const auto* f : { &elemfields, &nodefields })
+      for (const auto& v : *f)
+        bytes += static_cast< tk::real >( v.size() * sizeof(tk::real) );
+  if (surffieldoutput)
+    for (const auto& v : nodesurfs)
+      bytes += static_cast< tk::real >( v.size() * sizeof(tk::real) );
+  m_iostat[ IOBYTES ] += bytes;
+  m_iostat[ IOTIME ] += timer.dsec();
+}
+
+void
+MeshWriter::writeSlices(
+  uint64_t its,
+  tk::real time,
+  int chareid,
+  const std::vector< std::string >& basefilenames,
+  const std::vector< std::vector< std::size_t > >& triinpoel,
+  const std::vector< UnsMesh::Coords >& coord,
+  const std::vector< std::string >& nodefieldnames,
+  const std::vector< std::vector< std::vector< tk::real > > >& nodefields,
+  CkCallback c )
+// *****************************************************************************
+//  Output slices, e.g., planar slices and iso-surfaces, into files
+//! \param[in] its Slice output iteration count
+//! \param[in] time Physical time this at this slice output
+//! \param[in] chareid The chare id the write-to-file request is coming from
+//! \param[in] basefilenames Strings to use as the base of the filenames, one
+//!   per slice
+//! \param[in] triinpoel Triangle connectivity of each slice with local ids
+//! \param[in] coord Node coordinates of each slice
+//! \param[in] nodefieldnames Names of node fields to be output to file
+//! \param[in] nodefields Field data in the slice nodes of each slice
+//! \param[in] c Function to continue with after the write
+//! \details Slices are small, so they are neither aggregated nor kept open:
+//!   every output creates a new file with a single time step for each slice
+//!   and chare, counted by its in place of the mesh iteration count, i.e.,
+//!   {RS}, of the filename. Thus a slice may change between outputs, e.g.,
+//!   an iso-surface. Slices are only written in ExodusII format.
+// *****************************************************************************
+{
+  Assert( triinpoel.size() == basefilenames.size() &&
+          coord.size() == basefilenames.size() &&
+          nodefields.size() == basefilenames.size(), "Size mismatch" );
+
+  if (!m_benchmark && m_filetype == ctr::FieldFileType::EXODUSII) {
+
+    tk::Timer timer;
+    tk::real bytes = 0.0;
+    auto nvar = static_cast< int >( nodefieldnames.size() );
+
+    for (std::size_t k=0; k<basefilenames.size(); ++k) {
+      // Slices are not aggregated, so {NP} is the number of chares
+      ExodusIIMeshWriter es( basefilenames[k] + ".e-s"
+                             + '.' + std::to_string( its )
+                             + '.' + std::to_string( m_nchare )
+                             + '.' + std::to_string( chareid ),
+                             ExoWriter::CREATE, m_compression, m_lossytol );
+      if (triinpoel[k].empty()) {
+        // If a slice does not intersect a chare, write out a single triangle
+        // with zero node coordinates and fields, so the paraview series
+        // reader can load slices distributed across multiple files, see also
+        // MeshWriter::output().
+        es.writeMesh< 3 >( std::vector< std::size_t >{1,2,3},
+          UnsMesh::Coords{{ {{0,0,0}}, {{0,0,0}}, {{0,0,0}} }} );
+        es.writeNodeVarNames( nodefieldnames );
+        es.writeTimeStamp( 1, time );
+        for (int i=1; i<=nvar; ++i) es.writeNodeScalar( 1, i, {0,0,0} );
+        continue;
       }
+      es.writeMesh< 3 >( triinpoel[k], coord[k] );
+      es.writeNodeVarNames( nodefieldnames );
+      es.writeTimeStamp( 1, time );
+      int varid = 0;
+      for (const auto& v : nodefields[k]) es.writeNodeScalar( 1, ++varid, v );
+      bytes += static_cast< tk::real >(
+                 3 * coord[k][0].size() * sizeof(tk::real) +
+                 triinpoel[k].size() * sizeof(int) +
+                 nodefields[k].size() * coord[k][0].size() * sizeof(tk::real) );
     }
 
+    m_iostat[ IOBYTES ] += bytes;
+    m_iostat[ IOTIME ] += timer.dsec();
+
   }
 
   c.send();
 }
 
+std::shared_ptr< tk::ExodusIIMeshWriter >
+MeshWriter::exodus( const std::string& basefilename,
+                    uint64_t itr,
+                    int id,
+                    int surfid,
+                    ExoWriter mode )
+// *****************************************************************************
+//  Create or open ExodusII file, or return the one kept open
+//! \param[in] basefilename String use as the base filename
+//! \param[in] itr Iteration count since a new mesh
+//! \param[in] id Chare id, or if aggregating, compute node id
+//! \param[in] surfid Surface ID if a surface file, 0 if a volume file
+//! \param[in] mode ExodusII writer constructor mode
+//! \return ExodusII writer, closing the file when the last copy is destroyed
+//! \details If not keeping files open, the file is created or opened on
+//!   every call and closed after use by the caller. Otherwise the file is
+//!   only created or opened once for a mesh and kept open until a file is
+//!   created for a new mesh. The time spent is accumulated into the I/O
+//!   statistics, see iostat().
+// *****************************************************************************
+{
+  tk::Timer timer;
+  auto f = filename( basefilename, itr, id, surfid );
+  std::shared_ptr< ExodusIIMeshWriter > w;
+
+  if (!m_persistent) {
+    w = std::make_shared< ExodusIIMeshWriter >
+          ( f, mode, m_compression, m_lossytol );
+  } else {
+    auto& e = m_exo[ { id, surfid } ];
+    if (mode == ExoWriter::CREATE || !e.second || e.first != itr) {
+      e.second.reset();   // close file before (re)creating it
+      e = { itr, std::make_shared< ExodusIIMeshWriter >
+                   ( f, mode, m_compression, m_lossytol ) };
+    }
+    w = e.second;
+  }
+
+  m_iostat[ IOMETA ] += timer.dsec();
+  return w;
+}
+
 std::string
 MeshWriter::filename( const std::string& basefilename,
                       uint64_t itr,
@@ -245,7 +715,8 @@ MeshWriter::filename( const std::string& basefilename,
 //! \param[in] basefilename String use as the base filename.
 //! \param[in] itr Iteration count since a new mesh. New mesh in this context
 //!   means that either the mesh is moved and/or its topology has changed.
-//! \param[in] chareid The chare id the write-to-file request is coming from
+//! \param[in] chareid The chare id the write-to-file request is coming from,
+//!   or if aggregating, the compute node id
 //! \param[in] surfid Surface ID if computing a surface filename
 //! \details We use a file naming convention for large field output data that
 //!   allows ParaView to glue multiple files into a single simulation output by
@@ -257,7 +728,9 @@ MeshWriter::filename( const std::string& basefilename,
 //!   compared to the previous (first) number afer ".e-s.",
 //!   (2) {NP}: total number of partitions (workers, chares), this is more than
 //!   the number of PEs with nonzero virtualization (overdecomposition), and
-//!   (3) {RANK}: worker (chare) id.
+//!   (3) {RANK}: worker (chare) id. If aggregating the output of chares on
+//!   compute nodes, {NP} is the number of compute nodes and {RANK} is the
+//!   compute node id.
 //!   Thus {RANK} does spatial partitioning, while {RS} partitions in time, but
 //!   a single {RS} id may contain multiple time steps, which equals to the
 //!   number of time steps at which field output is saved without refining the
@@ -269,8 +742,8 @@ MeshWriter::filename( const std::string& basefilename,
   return basefilename + (surfid ? "-surf." + std::to_string(surfid) : "")
          + ".e-s"
          + '.' + std::to_string( itr )        // iteration count with new mesh
-         + '.' + std::to_string( m_nchare )   // total number of workers
-         + '.' + std::to_string( chareid )    // new file per worker
+         + '.' + std::to_string( m_aggregate ? CkNumNodes() : m_nchare )
+         + '.' + std::to_string( chareid )    // new file per worker or node
          #ifdef HAS_ROOT
          + (m_filetype == ctr::FieldFileType::ROOT ? ".root" : "")
          #endif
@@ -9,7 +9,10 @@
   \details   Charm++ group declaration used to output data associated to
      unstructured meshes to file(s). Charm++ chares (work units) send mesh and
      field data associated to mesh entities to the MeshWriter class defined here
-     to write the data to file(s).
+     to write the data to file(s). By default, the data of every chare is
+     written to a separate file. Alternatively, the data of all chares on a
+     compute node can be aggregated, stitched together by global mesh node ids,
+     and written to a single file per compute node.
 */
 // *****************************************************************************
 #ifndef MeshWriter_h
@@ -19,16 +22,26 @@
 #include <string>
 #include <tuple>
 #include <map>
+#include <set>
+#include <array>
+#include <memory>
 
 #include "Types.hpp"
 #include "Options/FieldFile.hpp"
 #include "Centering.hpp"
 #include "UnsMesh.hpp"
+#include "ExodusIIMeshWriter.hpp"
 
 #include "NoWarning/meshwriter.decl.h"
 
 namespace tk {
 
+//! Indices of the I/O statistics of a mesh writer, see MeshWriter::iostat()
+enum IOStat { IOBYTES=0,        //!< Bytes of mesh and field data written
+              IOMETA,           //!< Time spent creating and opening files
+              IOTIME,           //!< Total time spent writing
+              NUMIOSTAT };
+
 //! Charm++ group used to output particle data to file in parallel
 class MeshWriter : public CBase_MeshWriter {
 
@@ -36,7 +49,11 @@ class MeshWriter : public CBase_MeshWriter {
     //! Constructor: set some defaults that stay constant at all times
     MeshWriter( ctr::FieldFileType filetype,
                 Centering bnd_centering,
-                bool benchmark );
+                bool benchmark,
+                bool aggregate,
+                bool persistent,
+                uint32_t compression,
+                tk::real lossytol );
 
     #if defined(__clang__)
       #pragma clang diagnostic push
@@ -51,16 +68,71 @@ class MeshWriter : public CBase_MeshWriter {
     //! Set the total number of chares
     void nchare( int n );
 
+    //! Receive the number of chares writing on each compute node
+    void nwrite( int n, int* cnt );
+
+    //! Close the files kept open of a chare
+    void close( int id );
+
+    //! Contribute the I/O statistics of this writer since the last call
+    void iostat( CkCallback c );
+
+    //! Mesh chunk and field data of a chare
+    struct Part {
+      int chareid;
+      std::vector< std::size_t > inpoel;
+      UnsMesh::Coords coord;
+      std::vector< std::size_t > gid;
+      std::map< int, std::vector< std::size_t > > bface;
+      std::map< int, std::vector< std::size_t > > bnode;
+      std::vector< std::size_t > triinpoel;
+      std::vector< std::vector< tk::real > > elemfields;
+      std::vector< std::vector< tk::real > > nodefields;
+      std::vector< std::vector< tk::real > > nodesurfs;
+      CkCallback c;
+    };
+
+    //! Data of an output dump, the same for all chares
+    struct Dump {
+      bool meshoutput;
+      bool fieldoutput;
+      bool surfmeshoutput;
+      bool surffieldoutput;
+      uint64_t itr;
+      uint64_t itf;
+      uint64_t itsf;
+      tk::real time;
+      std::string basefilename;
+      std::vector< std::string > elemfieldnames;
+      std::vector< std::string > nodefieldnames;
+      std::vector< std::string > nodesurfnames;
+      std::set< int > outsets;
+    };
+
+    //! \brief Write request handed over by pointer within a compute node, see
+    //!   writeLocal()
+    struct Request {
+      Dump dump;        //!< Data of the output dump
+      Part part;        //!< Mesh chunk and field data of the chare
+    };
+
+    //! Output unstructured mesh into file, taking over a write request
+    void writeLocal( uint64_t req );
+
     //! Output unstructured mesh into file
     void write( bool meshoutput,
                 bool fieldoutput,
+                bool surfmeshoutput,
+                bool surffieldoutput,
                 uint64_t itr,
                 uint64_t itf,
+                uint64_t itsf,
                 tk::real time,
                 int chareid,
                 const std::string& basefilename,
                 const std::vector< std::size_t >& inpoel,
                 const UnsMesh::Coords& coord,
+                const std::vector< std::size_t >& gid,
                 const std::map< int, std::vector< std::size_t > >& bface,
                 const std::map< int, std::vector< std::size_t > >& bnode,
                 const std::vector< std::size_t >& triinpoel,
@@ -73,6 +145,18 @@ class MeshWriter : public CBase_MeshWriter {
                 const std::set< int >& outsets,
                 CkCallback c );
 
+    //! Output slices, e.g., planar slices and iso-surfaces, into files
+    void writeSlices(
+      uint64_t its,
+      tk::real time,
+      int chareid,
+      const std::vector< std::string >& basefilenames,
+      const std::vector< std::vector< std::size_t > >& triinpoel,
+      const std::vector< UnsMesh::Coords >& coord,
+      const std::vector< std::string >& nodefieldnames,
+      const std::vector< std::vector< std::vector< tk::real > > >& nodefields,
+      CkCallback c );
+
     /** @name Charm++ pack/unpack serializer member functions */
     ///@{
     //! \brief Pack/Unpack serialize member function
@@ -84,6 +168,10 @@ class MeshWriter : public CBase_MeshWriter {
       p | m_bndCentering;
       p | m_benchmark;
       p | m_nchare;
+      p | m_aggregate;
+      p | m_persistent;
+      p | m_compression;
+      p | m_lossytol;
     }
     //! \brief Pack/Unpack serialize operator|
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
@@ -100,6 +188,70 @@ class MeshWriter : public CBase_MeshWriter {
     bool m_benchmark;
     //! Total number chares across the whole problem
     int m_nchare;
+    //! True if aggregating the output of all chares on a compute node
+    bool m_aggregate;
+    //! True if keeping ExodusII files open across field outputs of a mesh
+    bool m_persistent;
+    //! Deflate level of ExodusII files, 0: uncompressed
+    uint32_t m_compression;
+    //! Relative tolerance of rounding fields written, 0: exact
+    tk::real m_lossytol;
+    //! \brief ExodusII files kept open associated to chare (or compute node)
+    //!   and surface ids, with the iteration count of their mesh
+    //! \details Not migrated: files are opened again after restart.
+    std::map< std::pair< int, int >,
+              std::pair< uint64_t, std::shared_ptr< ExodusIIMeshWriter > > >
+      m_exo;
+    //! \brief I/O statistics accumulated since the last call to iostat(),
+    //!   indexed by IOStat
+    //! \details Not migrated: only used between field outputs.
+    std::array< tk::real, NUMIOSTAT > m_iostat;
+
+    //! \brief Data of the output dump being aggregated, same for all chares
+    //! \details This is scratch storage only, hence not migrated: field
+    //!   output is completed before checkpointing.
+    Dump m_dump;
+    //! \brief Number of chares writing on this compute node in the dump being
+    //!   aggregated, -1 if not yet known
+    int m_nexpect;
+    //! Mesh chunks and field data buffered of the dump being aggregated
+    std::vector< Part > m_part;
+
+    //! Create or open ExodusII file, or return the one kept open
+    std::shared_ptr< ExodusIIMeshWriter >
+    exodus( const std::string& basefilename,
+            uint64_t itr,
+            int id,
+            int surfid,
+            ExoWriter mode );
+
+    //! Output mesh chunk and fields into file(s)
+    void output( bool meshoutput,
+                 bool fieldoutput,
+                 bool surfmeshoutput,
+                 bool surffieldoutput,
+                 uint64_t itr,
+                 uint64_t itf,
+                 uint64_t itsf,
+                 tk::real time,
+                 int id,
+                 const std::string& basefilename,
+                 const std::vector< std::size_t >& inpoel,
+                 const UnsMesh::Coords& coord,
+                 const std::map< int, std::vector< std::size_t > >& bface,
+                 const std::map< int, std::vector< std::size_t > >& bnode,
+                 const std::vector< std::size_t >& triinpoel,
+                 const std::vector< std::string >& elemfieldnames,
+                 const std::vector< std::string >& nodefieldnames,
+                 const std::vector< std::string >& nodesurfnames,
+                 const std::vector< std::vector< tk::real > >& elemfields,
+                 const std::vector< std::vector< tk::real > >& nodefields,
+                 const std::vector< std::vector< tk::real > >& nodesurfs,
+                 const std::set< int >& outsets );
+
+    //! \brief Stitch the mesh chunks and fields of all chares on this compute
+    //!   node together and output them into file(s) if all have arrived
+    void aggregate();
 
     //! Compute filename
     std::string filename( const std::string& basefilename,
@@ -15,12 +15,14 @@
 #include <string>
 #include <vector>
 #include <cstddef>
+#include <limits>
 
 #include "Types.hpp"
 #include "Exception.hpp"
 #include "UnsMesh.hpp"
 #include "Reorder.hpp"
 #include "NetgenMeshReader.hpp"
+#include "TextParser.hpp"
 
 using tk::NetgenMeshReader;
 
@@ -30,18 +32,46 @@ NetgenMeshReader::readMesh( UnsMesh& mesh )
 //  Read Netgen mesh
 //! \param[in] mesh Unstructured mesh object
 // *****************************************************************************
+{
+  readMesh(
+    [&]( const UnsMesh::Coords& c ){
+      mesh.x().insert( end(mesh.x()), begin(c[0]), end(c[0]) );
+      mesh.y().insert( end(mesh.y()), begin(c[1]), end(c[1]) );
+      mesh.z().insert( end(mesh.z()), begin(c[2]), end(c[2]) ); },
+    [&]( std::size_t nnpe, const std::vector< std::size_t >& inpoel ){
+      auto& conn = nnpe == 4 ? mesh.tetinpoel() : mesh.triinpoel();
+      conn.insert( end(conn), begin(inpoel), end(inpoel) ); },
+    std::numeric_limits< std::size_t >::max() );
+
+  // Shift node IDs to start from zero
+  shiftToZero( mesh.tetinpoel() );
+  shiftToZero( mesh.triinpoel() );
+}
+
+void
+NetgenMeshReader::readMesh( const NodeChunkFn& nodes,
+                            const ElemChunkFn& elems,
+                            std::size_t chunk )
+// *****************************************************************************
+//  Read Netgen mesh in chunks
+//! \param[in] nodes Function to pass chunks of node coordinates to
+//! \param[in] elems Function to pass chunks of element connectivity to, with
+//!   node ids as in the file, i.e., one-based
+//! \param[in] chunk Maximum number of nodes or elements passed at a time
+// *****************************************************************************
 {
   // Read nodes
-  readNodes( mesh );
+  readNodes( nodes, chunk );
   // Read elements
-  readElements( mesh );
+  readElements( elems, chunk );
 }
 
 void
-NetgenMeshReader::readNodes( UnsMesh& mesh )
+NetgenMeshReader::readNodes( const NodeChunkFn& nodes, std::size_t chunk )
 // *****************************************************************************
 //  Read nodes
-//! \param[in] mesh Unstructured mesh object
+//! \param[in] nodes Function to pass chunks of node coordinates to
+//! \param[in] chunk Maximum number of nodes passed at a time
 // *****************************************************************************
 {
   int nnode;
@@ -49,26 +79,65 @@ NetgenMeshReader::readNodes( UnsMesh& mesh )
   ErrChk( nnode > 0,
           "Number of nodes must be greater than zero in file " + m_filename  );
 
-  // Read in node coordinates: x-coord y-coord z-coord
-  for (int i=0; i<nnode; ++i) {
-    tk::real x, y, z;
-    m_inFile >> x >> y >> z;
-    mesh.x().push_back( x );
-    mesh.y().push_back( y );
-    mesh.z().push_back( z );
-  }
-
   std::string s;
-  getline( m_inFile, s );  // finish reading the last line
+  getline( m_inFile, s );  // finish reading the line
+
+  // Read in node coordinates: x-coord y-coord z-coord
+  UnsMesh::Coords coord;
+  auto ok = tk::parseLines< UnsMesh::Coords >( m_inFile,
+    static_cast< std::size_t >( nnode ),
+    []( const char* p, UnsMesh::Coords& c ){
+      for (std::size_t d=0; d<3; ++d) {
+        tk::real r;
+        if (!(p = tk::parseReal( p, r ))) return false;
+        c[d].push_back( r );
+      }
+      return true; },
+    [&]( const UnsMesh::Coords& c ){
+      for (std::size_t d=0; d<3; ++d)
+        coord[d].insert( end(coord[d]), begin(c[d]), end(c[d]) );
+      if (coord[0].size() >= chunk) {
+        nodes( coord );
+        for (auto& x : coord) x.clear();
+      } } );
+  ErrChk( ok, "Failed to read nodes in file " + m_filename );
+  if (!coord[0].empty()) nodes( coord );
 }
 
 void
-NetgenMeshReader::readElements( UnsMesh& mesh )
+NetgenMeshReader::readElements( const ElemChunkFn& elems, std::size_t chunk )
 // *****************************************************************************
 //  Read element connectivity
-//! \param[in] mesh Unstructured mesh object
+//! \param[in] elems Function to pass chunks of element connectivity to
+//! \param[in] chunk Maximum number of elements passed at a time
 // *****************************************************************************
 {
+  // Read a block of elements: tag n[1-nnpe], tetrahedra ordering their nodes
+  // as n[4] n[1-3]
+  auto read = [&]( std::size_t nnpe, int nel, const std::string& name ) {
+    using Conn = std::vector< std::size_t >;
+    Conn inpoel;
+    auto ok = tk::parseLines< Conn >( m_inFile,
+      static_cast< std::size_t >( nel ),
+      [&]( const char* p, Conn& c ){
+        int tag;
+        std::array< std::size_t, 4 > n;
+        if (!(p = tk::parseInt( p, tag ))) return false;
+        if (nnpe == 4 && !(p = tk::parseInt( p, n[3] ))) return false;
+        for (std::size_t j=0; j<3; ++j)
+          if (!(p = tk::parseInt( p, n[j] ))) return false;
+        c.insert( end(c), begin(n), begin(n)+nnpe );
+        return true; },
+      [&]( const Conn& c ){
+        inpoel.insert( end(inpoel), begin(c), end(c) );
+        if (inpoel.size()/nnpe >= chunk) {
+          elems( nnpe, inpoel );
+          inpoel.clear();
+        } } );
+    ErrChk( ok, "Failed to read " + name + " in file " + m_filename );
+    if (!inpoel.empty()) elems( nnpe, inpoel );
+  };
+
   int nel;
 
   // Read in number of tetrahedra
@@ -79,20 +148,8 @@ NetgenMeshReader::readElements( UnsMesh& mesh )
     std::string s;
     getline( m_inFile, s );  // finish reading the last line
 
-    // Read in tetrahedra element tags and connectivity
-    for (int i=0; i<nel; ++i) {
-      int tag;
-      std::array< std::size_t, 4 > n;
-      // tag n[1-4]
-      m_inFile >> tag >> n[3] >> n[0] >> n[1] >> n[2];
-      mesh.tetinpoel().push_back( n[0] );
-      mesh.tetinpoel().push_back( n[1] );
-      mesh.tetinpoel().push_back( n[2] );
-      mesh.tetinpoel().push_back( n[3] );
-    }
-
-    // Shift node IDs to start from zero
-    shiftToZero( mesh.tetinpoel() );
+    // Read in tetrahedra element tags and connectivity: tag n[1-4]
+    read( 4, nel, "tetrahedra" );
   }
 
   // Read in number of triangles
@@ -103,18 +160,7 @@ NetgenMeshReader::readElements( UnsMesh& mesh )
     std::string s;
     getline( m_inFile, s );  // finish reading the last line
 
-    // Read in triangle element tags and connectivity
-    for (int i=0; i<nel; ++i) {
-      int tag;
-      std::array< std::size_t, 3 > n;
-      // tag n[1-3]
-      m_inFile >> tag >> n[0] >> n[1] >> n[2];
-      mesh.triinpoel().push_back( n[0] );
-      mesh.triinpoel().push_back( n[1] );
-      mesh.triinpoel().push_back( n[2] );
-    }
-
-    // Shift node IDs to start from zero
-    shiftToZero( mesh.triinpoel() );
+    // Read in triangle element tags and connectivity: tag n[1-3]
+    read( 3, nel, "triangles" );
   }
 }
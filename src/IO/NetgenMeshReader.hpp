@@ -15,6 +15,7 @@
 #include <iosfwd>
 
 #include "Reader.hpp"
+#include "MeshStream.hpp"
 
 namespace tk {
 
@@ -34,12 +35,17 @@ class NetgenMeshReader : public Reader {
     //! Read Netgen mesh
     void readMesh( UnsMesh& mesh );
 
+    //! Read Netgen mesh in chunks
+    void readMesh( const NodeChunkFn& nodes,
+                   const ElemChunkFn& elems,
+                   std::size_t chunk );
+
   private:
     //! Read nodes
-    void readNodes( UnsMesh& mesh );
+    void readNodes( const NodeChunkFn& nodes, std::size_t chunk );
 
     //! Read element connectivity
-    void readElements( UnsMesh& mesh );
+    void readElements( const ElemChunkFn& elems, std::size_t chunk );
 };
 
 } // tk::
@@ -43,16 +43,8 @@ NetgenMeshWriter::writeNodes( const UnsMesh& mesh )
 //! \param[in] mesh Unstructured mesh object
 // *****************************************************************************
 {
-  // Write out number of nodes
-  m_outFile << mesh.nnode() << std::endl;
-
-  // Write node coordinates: x-coord y-coord z-coord
-  m_outFile << std::setprecision(6) << std::fixed;
-  for ( std::size_t i=0; i<mesh.nnode(); ++i ) {
-    m_outFile << '\t' << mesh.x()[i]
-              << '\t' << mesh.y()[i]
-              << '\t' << mesh.z()[i] << std::endl;
-  }
+  writeCount( mesh.nnode() );
+  writeNodeChunk( mesh.x(), mesh.y(), mesh.z() );
 }
 
 void
@@ -69,26 +61,9 @@ NetgenMeshWriter::writeElements( const UnsMesh& mesh )
                                 end(mesh.tetinpoel()) ).first == 0,
           "tetrahedron node ids should start from zero" );
 
-  // Get number of tetrahedra in mesh
-  auto n = mesh.tetinpoel().size()/4;  
-
-  // Write out number of tetrahedra
-  m_outFile << n << std::endl;
-
-  // Create empty tag vector
-  std::vector< std::vector< int > > tg;
-  tg.resize( n );
-  for (auto& t : tg) t.push_back( 1 );
-
-  // Write out tetrehadra element tags and connectivity
-  for (std::size_t i=0; i<n; ++i) {
-    // tag n[1-4]
-    m_outFile << '\t' << tg[i][0]
-              << '\t' << mesh.tetinpoel()[i*4+3]+1
-              << '\t' << mesh.tetinpoel()[i*4+0]+1
-              << '\t' << mesh.tetinpoel()[i*4+1]+1
-              << '\t' << mesh.tetinpoel()[i*4+2]+1 << std::endl;
-  }
+  // Write out number of tetrahedra, tags, and connectivity
+  writeCount( mesh.tetinpoel().size()/4 );
+  writeElemChunk( 4, mesh.tetinpoel() );
 
   if (mesh.triinpoel().empty()) return;
 
@@ -97,23 +72,74 @@ NetgenMeshWriter::writeElements( const UnsMesh& mesh )
                                 end(mesh.triinpoel()) ).first == 0,
           "triangle node ids should start from zero" );
 
-  // Get number of triangles in mesh
-  n = mesh.triinpoel().size()/3;
+  // Write out number of triangles, tags, and connectivity
+  writeCount( mesh.triinpoel().size()/3 );
+  writeElemChunk( 3, mesh.triinpoel() );
+}
 
-  // Write out number of triangles
+void
+NetgenMeshWriter::writeCount( std::size_t n )
+// *****************************************************************************
+//  Write number of nodes or elements preceding their section
+//! \param[in] n Number of nodes, tetrahedra, or triangles to be written
+//! \details The mesh is written in the order of nodes, tetrahedra, and
+//!   triangles, each section preceded by its number of entries. Triangles are
+//!   only written if the mesh has tetrahedra.
+// *****************************************************************************
+{
   m_outFile << n << std::endl;
+}
 
-  // Create empty tag vector if there is no tag
-  tg.clear();
-  tg.resize( n );
-  for (auto& t : tg) t.push_back( 1 );
+void
+NetgenMeshWriter::writeNodeChunk( const std::vector< tk::real >& x,
+                                  const std::vector< tk::real >& y,
+                                  const std::vector< tk::real >& z )
+// *****************************************************************************
+//  Write a chunk of nodes
+//! \param[in] x X coordinates of nodes to write
+//! \param[in] y Y coordinates of nodes to write
+//! \param[in] z Z coordinates of nodes to write
+// *****************************************************************************
+{
+  // Write node coordinates: x-coord y-coord z-coord
+  m_outFile << std::setprecision(6) << std::fixed;
+  for ( std::size_t i=0; i<x.size(); ++i ) {
+    m_outFile << '\t' << x[i]
+              << '\t' << y[i]
+              << '\t' << z[i] << '\n';
+  }
+  ErrChk( !m_outFile.bad(), "Failed to write to file: " + m_filename );
+}
 
-  // Write out triangle element tags and connectivity
-  for (std::size_t i=0; i<n; ++i) {
-    // tag n[1-4]
-    m_outFile << '\t' << tg[i][0]
-              << '\t' << mesh.triinpoel()[i*3+0]+1
-              << '\t' << mesh.triinpoel()[i*3+1]+1
-              << '\t' << mesh.triinpoel()[i*3+2]+1 << std::endl;
+void
+NetgenMeshWriter::writeElemChunk( std::size_t nnpe,
+                                  const std::vector< std::size_t >& inpoel )
+// *****************************************************************************
+//  Write a chunk of tetrahedra or triangles
+//! \param[in] nnpe Number of nodes per element: 4: tetrahedra, 3: triangles
+//! \param[in] inpoel Element connectivity (zero-based node ids)
+// *****************************************************************************
+{
+  // Element tag to write
+  const int tag = 1;
+
+  if (nnpe == 4) {
+    // Write out tetrehadra element tags and connectivity: tag n[1-4]
+    for (std::size_t i=0; i<inpoel.size()/4; ++i) {
+      m_outFile << '\t' << tag
+                << '\t' << inpoel[i*4+3]+1
+                << '\t' << inpoel[i*4+0]+1
+                << '\t' << inpoel[i*4+1]+1
+                << '\t' << inpoel[i*4+2]+1 << '\n';
+    }
+  } else {
+    // Write out triangle element tags and connectivity: tag n[1-3]
+    for (std::size_t i=0; i<inpoel.size()/3; ++i) {
+      m_outFile << '\t' << tag
+                << '\t' << inpoel[i*3+0]+1
+                << '\t' << inpoel[i*3+1]+1
+                << '\t' << inpoel[i*3+2]+1 << '\n';
+    }
   }
+  ErrChk( !m_outFile.bad(), "Failed to write to file: " + m_filename );
 }
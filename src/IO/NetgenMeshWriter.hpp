@@ -13,7 +13,10 @@
 #define NetgenMeshWriter_h
 
 #include <iosfwd>
+#include <vector>
+#include <cstddef>
 
+#include "Types.hpp"
 #include "Writer.hpp"
 
 namespace tk {
@@ -34,6 +37,18 @@ class NetgenMeshWriter : public Writer {
     //! Write Netgen mesh
     void writeMesh( const UnsMesh& mesh );
 
+    //! Write number of nodes or elements preceding their section
+    void writeCount( std::size_t n );
+
+    //! Write a chunk of nodes
+    void writeNodeChunk( const std::vector< tk::real >& x,
+                         const std::vector< tk::real >& y,
+                         const std::vector< tk::real >& z );
+
+    //! Write a chunk of tetrahedra or triangles
+    void writeElemChunk( std::size_t nnpe,
+                         const std::vector< std::size_t >& inpoel );
+
   private:
     //! Write nodes
     void writeNodes( const UnsMesh& mesh );
@@ -27,7 +27,9 @@ Omega_h_MeshReader::readMeshPart(
   std::unordered_map< std::size_t, std::size_t >& lid,
   tk::UnsMesh::Coords& coord,
   int numpes,
-  [[maybe_unused]] int mype )
+  [[maybe_unused]] int mype,
+  [[maybe_unused]] bool readtri,
+  [[maybe_unused]] const std::string& partvar )
 // *****************************************************************************
 //  Read a part of the mesh (graph and coordinates) from Omega_h file
 //! \param[in,out] ginpoel Container to store element connectivity of this PE's
@@ -42,6 +44,9 @@ Omega_h_MeshReader::readMeshPart(
 //!   PE's mesh chunk
 //! \param[in] numpes Total number of PEs (default n = 1, for a single-CPU read)
 //! \param[in] mype This PE (default m = 0, for a single-CPU read)
+//! \param[in] readtri Unused, triangles are not read from Omega_h files
+//! \param[in] partvar Unused, Omega_h files are always read by partition: each
+//!   PE reads the part the mesh has been saved with, see below
 //! \note The last two integer arguments are unused. They are needed because
 //!   this function can be used via a polymorphic interface via a base class,
 //!   see tk::MeshReader, and other specialized mesh readers, e.g.,
@@ -128,6 +133,34 @@ Omega_h_MeshReader::readMeshPart(
 }
 
 
+std::size_t
+Omega_h_MeshReader::readTriangleChunk(
+  [[maybe_unused]] std::vector< std::size_t >& triinp,
+  [[maybe_unused]] int numpes,
+  [[maybe_unused]] int mype ) const
+// *****************************************************************************
+//  Read a chunk of the triangle elements from Omega_h file
+//! \param[in,out] triinp Container to store triangle element connectivity
+//! \param[in] numpes Total number of PEs the triangles are read by
+//! \param[in] mype This PE
+//! \return Id of the first triangle read
+//! \note Triangles are not read from Omega_h files.
+// *****************************************************************************
+{
+  return 0;
+}
+
+void
+Omega_h_MeshReader::ownTriangles(
+  [[maybe_unused]] const std::vector< std::size_t >& triid )
+// *****************************************************************************
+//  Store the triangle elements that are faces of this PE's mesh chunk
+//! \param[in] triid Triangle element ids
+//! \note Triangles are not read from Omega_h files.
+// *****************************************************************************
+{
+}
+
 std::vector< std::size_t >
 Omega_h_MeshReader::triinpoel(
   [[maybe_unused]] std::map< int, std::vector< std::size_t > >& bface,
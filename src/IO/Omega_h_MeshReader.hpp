@@ -45,7 +45,16 @@ class Omega_h_MeshReader {
                        std::vector< std::size_t >& triinp,
                        std::unordered_map< std::size_t, std::size_t >& lid,
                        tk::UnsMesh::Coords& coord,
-                       int numpes=1, int mype=0 );
+                       int numpes=1, int mype=0, bool readtri=true,
+                       const std::string& partvar = {} );
+
+    //! Read a chunk of the triangle elements from Omega h file
+    std::size_t readTriangleChunk( std::vector< std::size_t >& triinp,
+                                   int numpes,
+                                   int mype ) const;
+
+    //! Store the triangle elements that are faces of this PE's mesh chunk
+    void ownTriangles( const std::vector< std::size_t >& triid );
 
     //! Read face list of all side sets from Omega h file
     void
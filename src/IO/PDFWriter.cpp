@@ -14,6 +14,7 @@
 // *****************************************************************************
 
 #include <iomanip>
+#include <cstdint>
 
 #include "NoWarning/exodusII.hpp"
 
@@ -24,13 +25,16 @@ using tk::PDFWriter;
 
 PDFWriter::PDFWriter( const std::string& filename,
                       ctr::TxtFloatFormatType format,
-                      kw::precision::info::expect::type precision ) :
-  Writer( filename )
+                      kw::precision::info::expect::type precision,
+                      std::ios_base::openmode mode ) :
+  Writer( filename, mode )
 // *****************************************************************************
 //  Constructor
 //! \param[in] filename Output filename to which output the PDF
 //! \param[in] format Configure floating-point output format for ASCII output
 //! \param[in] precision Configure precision for floating-point ASCII output
+//! \param[in] mode Configure file open mode, binary output requires
+//!   std::ios_base::binary, appending to a file std::ios_base::app
 // *****************************************************************************
 {
   // Set floating-point format for output file stream
@@ -1125,6 +1129,116 @@ PDFWriter::writeExodusII( const TriPDF& pdf,
   ErrChk( ex_close(outFile) == 0, "Failed to close file: " + m_filename );
 }
 
+void
+PDFWriter::writeBin( const UniPDF& pdf,
+                     const tk::ctr::PDFInfo& info,
+                     bool header ) const
+// *****************************************************************************
+//  Append univariate PDF to binary file
+//! \param[in] pdf Univariate PDF
+//! \param[in] info PDF metadata
+//! \param[in] header True to write the file header before the PDF
+// *****************************************************************************
+{
+  writeBinPDF< UniPDF::dim >( pdf, info, {{ pdf.binsize() }}, header );
+}
+
+void
+PDFWriter::writeBin( const BiPDF& pdf,
+                     const tk::ctr::PDFInfo& info,
+                     bool header ) const
+// *****************************************************************************
+//  Append bivariate PDF to binary file
+//! \param[in] pdf Bivariate PDF
+//! \param[in] info PDF metadata
+//! \param[in] header True to write the file header before the PDF
+// *****************************************************************************
+{
+  writeBinPDF< BiPDF::dim >( pdf, info, pdf.binsize(), header );
+}
+
+void
+PDFWriter::writeBin( const TriPDF& pdf,
+                     const tk::ctr::PDFInfo& info,
+                     bool header ) const
+// *****************************************************************************
+//  Append trivariate PDF to binary file
+//! \param[in] pdf Trivariate PDF
+//! \param[in] info PDF metadata
+//! \param[in] header True to write the file header before the PDF
+// *****************************************************************************
+{
+  writeBinPDF< TriPDF::dim >( pdf, info, pdf.binsize(), header );
+}
+
+template< std::size_t dim, class PDF >
+void
+PDFWriter::writeBinPDF( const PDF& pdf,
+                        const tk::ctr::PDFInfo& info,
+                        const std::array< tk::real, dim >& binsize,
+                        bool header ) const
+// *****************************************************************************
+//  Append PDF of any dimension to binary file
+//! \param[in] pdf PDF to write
+//! \param[in] info PDF metadata
+//! \param[in] binsize Sample space bin sizes
+//! \param[in] header True to write the file header before the PDF
+//! \details The file header consists of text lines: "quinoa binary pdf 1",
+//!   the name of the PDF, the number of sample space dimensions, the names of
+//!   the sample space variables, and "end". Each PDF appended is a record,
+//!   in native byte order, of the iteration count (64-bit unsigned integer),
+//!   the time and the bin sizes (64-bit floating-point numbers), the number of
+//!   nonempty bins (64-bit unsigned integer), followed by, for each nonempty
+//!   bin, its ids (64-bit integers) and its probability density (64-bit
+//!   floating-point number). The center of the bin with ids i is i*binsize in
+//!   each dimension. Only the nonempty bins are written, the user-specified
+//!   sample space extents are not applied. As opposed to the other formats, no
+//!   sample space mesh is written, its nodes follow from the bin ids.
+// *****************************************************************************
+{
+  assertSampleSpaceDimensions< dim >( info.vars );
+
+  if (header) {
+    m_outFile << "quinoa binary pdf 1\n" << info.name << '\n' << dim << '\n';
+    for (const auto& v : info.vars) m_outFile << v << '\n';
+    m_outFile << "end\n";
+  }
+
+  const auto real = static_cast< std::streamsize >( sizeof(tk::real) );
+  const std::uint64_t it = info.it;
+  const tk::real time = info.time;
+  const std::uint64_t nbin = pdf.map().size();
+  m_outFile.write( reinterpret_cast< const char* >( &it ), sizeof(it) );
+  m_outFile.write( reinterpret_cast< const char* >( &time ), real );
+  m_outFile.write( reinterpret_cast< const char* >( binsize.data() ),
+                   static_cast< std::streamsize >( dim ) * real );
+  m_outFile.write( reinterpret_cast< const char* >( &nbin ), sizeof(nbin) );
+
+  // Collect bins in a single buffer to output them with a single write
+  tk::real vol = static_cast< tk::real >( pdf.nsample() );
+  for (auto b : binsize) vol *= b;
+  struct Bin {
+    std::array< std::int64_t, dim > id;
+    tk::real p;
+  };
+  std::vector< Bin > bins;
+  bins.reserve( pdf.map().size() );
+  for (const auto& [key,count] : pdf.map()) {
+    Bin b;
+    if constexpr( dim == 1 )
+      b.id[0] = key;
+    else
+      for (std::size_t j=0; j<dim; ++j) b.id[j] = key[j];
+    b.p = count / vol;
+    bins.push_back( b );
+  }
+  static_assert( sizeof(Bin) == (dim+1)*8, "Bin record must not be padded" );
+  m_outFile.write( reinterpret_cast< const char* >( bins.data() ),
+                   static_cast< std::streamsize >( bins.size()*sizeof(Bin) ) );
+
+  ErrChk( !m_outFile.bad(), "Failed to write to file: " + m_filename );
+}
+
 int
 PDFWriter::createExFile() const
 // *****************************************************************************
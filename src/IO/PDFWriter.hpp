@@ -36,7 +36,8 @@ class PDFWriter : public tk::Writer {
     explicit PDFWriter(
       const std::string& filename,
       tk::ctr::TxtFloatFormatType format = tk::ctr::TxtFloatFormatType::DEFAULT,
-      kw::precision::info::expect::type precision = std::cout.precision() );
+      kw::precision::info::expect::type precision = std::cout.precision(),
+      std::ios_base::openmode mode = std::ios_base::out );
 
     //! Write univariate PDF to text file
     void writeTxt( const UniPDF& pdf, const tk::ctr::PDFInfo& info ) const;
@@ -71,6 +72,18 @@ class PDFWriter : public tk::Writer {
     void writeExodusII( const TriPDF& pdf, const tk::ctr::PDFInfo& info,
                         ctr::PDFCenteringType centering ) const;
 
+    //! Append univariate PDF to binary file
+    void writeBin( const UniPDF& pdf, const tk::ctr::PDFInfo& info,
+                   bool header ) const;
+
+    //! Append bivariate PDF to binary file
+    void writeBin( const BiPDF& pdf, const tk::ctr::PDFInfo& info,
+                   bool header ) const;
+
+    //! Append trivariate PDF to binary file
+    void writeBin( const TriPDF& pdf, const tk::ctr::PDFInfo& info,
+                   bool header ) const;
+
   private:
     //! Assert the number of sample space dimensions given
     template< std::size_t size, class Container >
@@ -90,6 +103,12 @@ class PDFWriter : public tk::Writer {
                 std::to_string( size*2 ) +" real numbers: minx, maxx, ..." );
     }
 
+    //! Append PDF of any dimension to binary file
+    template< std::size_t dim, class PDF >
+    void writeBinPDF( const PDF& pdf, const tk::ctr::PDFInfo& info,
+                      const std::array< tk::real, dim >& binsize,
+                      bool header ) const;
+
     // Create Exodus II file
     int createExFile() const;
 
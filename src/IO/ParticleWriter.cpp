@@ -11,6 +11,9 @@
 */
 // *****************************************************************************
 
+#include <memory>
+#include <cstdint>
+
 #include "ParticleWriter.hpp"
 #include "Exception.hpp"
 
@@ -29,38 +32,75 @@ ParticleWriter::npar( std::size_t n, CkCallback c )
 }
 
 void
-ParticleWriter::writeCoords( uint64_t it,
-                             const std::vector< tk::real >& x,
-                             const std::vector< tk::real >& y,
-                             const std::vector< tk::real >& z,
-                             CkCallback c )
+ParticleWriter::writeParticles(
+  uint64_t it,
+  const std::vector< tk::real >& x,
+  const std::vector< tk::real >& y,
+  const std::vector< tk::real >& z,
+  const std::vector< std::string >& names,
+  const std::vector< std::vector< tk::real > >& fields,
+  const std::vector< uint64_t >& id,
+  CkCallback c )
 // *****************************************************************************
-//  Write particle coordinates to file
+//  Write particle coordinates, fields, and ids to file
 //! \param[in] it Output iteration count
 //! \param[in] x X coordinates of particles
 //! \param[in] y Y coordinates of particles
 //! \param[in] z Z coordinates of particles
+//! \param[in] names Names of particle fields, the same from all chares
+//! \param[in] fields Particle fields, one per name, each of the size of x
+//! \param[in] id Particle ids, empty or of the size of x
 //! \param[in] c Function to continue with after the write is complete
+//! \details Contributions of all chares on my node are buffered, then written
+//!   to file in a single collective write by all nodes, each node writing its
+//!   contiguous range of particles, see tk::H5PartWriter::writeParticles().
 // *****************************************************************************
 {
   Assert( x.size() == y.size() && y.size() == z.size(),
           "Particle coordinates array sizes mismatch" );
+  Assert( names.size() == fields.size(),
+          "Number of particle field names and fields mismatch" );
 
-  // buffer up coordinates
+  // buffer up coordinates, fields, and ids
   m_x.insert( end(m_x), begin(x), end(x) );
   m_y.insert( end(m_y), begin(y), end(y) );
   m_z.insert( end(m_z), begin(z), end(z) );
+  m_names = names;
+  m_fields.resize( fields.size() );
+  for (std::size_t i=0; i<fields.size(); ++i)
+    m_fields[i].insert( end(m_fields[i]), begin(fields[i]), end(fields[i]) );
+  m_id.insert( end(m_id), begin(id), end(id) );
 
-  // if received from all chares on my PE, write to file
+  // if received from all chares on my node, write to file
   if (m_x.size() == m_npar) {
-    m_writer.writeCoords( it, m_x, m_y, m_z );
+    m_writer.writeParticles( it, m_x, m_y, m_z, m_names, m_fields, m_id );
     m_npar = 0;
     m_x.clear();
     m_y.clear();
     m_z.clear();
+    m_fields.clear();
+    m_id.clear();
   }
 
   c.send();
 }
 
+void
+ParticleWriter::writeLocal( uint64_t req )
+// *****************************************************************************
+//  Write particle data to file, taking over a write request
+//! \param[in] req Address of a write request allocated with new by a chare
+//!   on this compute node, whose ownership is taken over
+//! \details Chares only write through the particle writer of their own
+//!   compute node, i.e., in their own address space, so they hand over the
+//!   address of their particle data instead of serializing it into a
+//!   message. The request is released after its data has been buffered.
+// *****************************************************************************
+{
+  std::unique_ptr< Request >
+    r( reinterpret_cast< Request* >( static_cast< std::uintptr_t >( req ) ) );
+
+  writeParticles( r->it, r->x, r->y, r->z, r->names, r->fields, r->id, r->c );
+}
+
 #include "NoWarning/particlewriter.def.h"
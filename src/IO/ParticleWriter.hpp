@@ -16,6 +16,8 @@
 #include <string>
 #include <vector>
 
+#include "NoWarning/pup_stl.hpp"
+
 #include "H5PartWriter.hpp"
 
 #include "NoWarning/particlewriter.decl.h"
@@ -34,17 +36,74 @@ class ParticleWriter : public CBase_ParticleWriter {
       m_npar( 0 ),
       m_x(),
       m_y(),
-      m_z() {}
+      m_z(),
+      m_names(),
+      m_fields(),
+      m_id() {}
+
+    #if defined(__clang__)
+      #pragma clang diagnostic push
+      #pragma clang diagnostic ignored "-Wundefined-func-template"
+    #endif
+    //! Migrate constructor
+    explicit ParticleWriter( CkMigrateMessage* m ) :
+      CBase_ParticleWriter( m ),
+      m_writer( std::string() ) {}
+    #if defined(__clang__)
+      #pragma clang diagnostic pop
+    #endif
 
     //! Chares contribute their number of particles they will output on my node
     void npar( std::size_t n, CkCallback c );
 
-    //! Write particle coordinates to file
-    void writeCoords( uint64_t it,
-                      const std::vector< tk::real >& x,
-                      const std::vector< tk::real >& y,
-                      const std::vector< tk::real >& z,
-                      CkCallback c );
+    //! \brief Particle data of a chare handed over by pointer within a compute
+    //!   node, see writeLocal()
+    struct Request {
+      uint64_t it;                      //!< Output iteration count
+      std::vector< tk::real > x;        //!< X coordinates of particles
+      std::vector< tk::real > y;        //!< Y coordinates of particles
+      std::vector< tk::real > z;        //!< Z coordinates of particles
+      std::vector< std::string > names; //!< Names of particle fields
+      //! Particle fields, one per name
+      std::vector< std::vector< tk::real > > fields;
+      std::vector< uint64_t > id;       //!< Particle ids
+      CkCallback c;                     //!< Function to continue with
+    };
+
+    //! Write particle data to file, taking over a write request
+    void writeLocal( uint64_t req );
+
+    //! Write particle coordinates, fields, and ids to file
+    void writeParticles( uint64_t it,
+                         const std::vector< tk::real >& x,
+                         const std::vector< tk::real >& y,
+                         const std::vector< tk::real >& z,
+                         const std::vector< std::string >& names,
+                         const std::vector< std::vector< tk::real > >& fields,
+                         const std::vector< uint64_t >& id,
+                         CkCallback c );
+
+    /** @name Charm++ pack/unpack serializer member functions */
+    ///@{
+    //! \brief Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \note This is a Charm++ nodegroup, pup() is thus only for
+    //!    checkpoint/restart.
+    void pup( PUP::er &p ) override {
+      p | m_writer;
+      p | m_npar;
+      p | m_x;
+      p | m_y;
+      p | m_z;
+      p | m_names;
+      p | m_fields;
+      p | m_id;
+    }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] w ParticleWriter object reference
+    friend void operator|( PUP::er& p, ParticleWriter& w ) { w.pup(p); }
+    //@}
 
   private:
     tk::H5PartWriter m_writer;     //!< Particle file format writer
@@ -52,6 +111,10 @@ class ParticleWriter : public CBase_ParticleWriter {
     std::vector< tk::real > m_x;   //!< Buffer collecting x coordinates
     std::vector< tk::real > m_y;   //!< Buffer collecting y coordinates
     std::vector< tk::real > m_z;   //!< Buffer collecting z coordinates
+    std::vector< std::string > m_names;  //!< Particle field names
+    //! Buffer collecting particle fields
+    std::vector< std::vector< tk::real > > m_fields;
+    std::vector< uint64_t > m_id;  //!< Buffer collecting particle ids
 };
 
 } // tk::
@@ -23,6 +23,7 @@
 #include "UnsMesh.hpp"
 #include "Reorder.hpp"
 #include "UGRIDMeshReader.hpp"
+#include "TextParser.hpp"
 
 using tk::UGRIDMeshReader;
 
@@ -82,14 +83,27 @@ UGRIDMeshReader::readNodes( UnsMesh& mesh )
 //! \param[in] mesh Unstructured mesh object
 // *****************************************************************************
 {
+  std::string s;
+  getline( m_inFile, s );  // finish reading the header line
+
   // Read in node coordinates: x-coord y-coord z-coord
-  for (std::size_t i=0; i<m_nnode; ++i) {
-    tk::real x, y, z;
-    m_inFile >> x >> y >> z;
-    mesh.x().push_back( x );
-    mesh.y().push_back( y );
-    mesh.z().push_back( z );
-  }
+  auto& x = mesh.x();
+  auto& y = mesh.y();
+  auto& z = mesh.z();
+  using Coords = std::array< std::vector< tk::real >, 3 >;
+  auto ok = tk::parseLines< Coords >( m_inFile, m_nnode,
+    []( const char* p, Coords& c ){
+      for (std::size_t d=0; d<3; ++d) {
+        tk::real r;
+        if (!(p = tk::parseReal( p, r ))) return false;
+        c[d].push_back( r );
+      }
+      return true; },
+    [&]( const Coords& c ){
+      x.insert( end(x), begin(c[0]), end(c[0]) );
+      y.insert( end(y), begin(c[1]), end(c[1]) );
+      z.insert( end(z), begin(c[2]), end(c[2]) ); } );
+  ErrChk( ok, "Failed to read nodes in file " + m_filename );
 }
 
 void
@@ -99,32 +113,44 @@ UGRIDMeshReader::readElements( UnsMesh& mesh )
 //! \param[in] mesh Unstructured mesh object
 // *****************************************************************************
 {
+  using Inpoel = std::vector< std::size_t >;
+
+  // Read in element connectivity of nnpe nodes per element
+  auto conn = [&]( std::size_t nel, std::size_t nnpe, Inpoel& inpoel ) {
+    auto ok = tk::parseLines< Inpoel >( m_inFile, nel,
+      [=]( const char* p, Inpoel& in ){
+        for (std::size_t j=0; j<nnpe; ++j) {
+          std::size_t n;
+          if (!(p = tk::parseInt( p, n ))) return false;
+          in.push_back( n );
+        }
+        return true; },
+      [&]( const Inpoel& in ){
+        inpoel.insert( end(inpoel), begin(in), end(in) ); } );
+    ErrChk( ok, "Failed to read elements in file " + m_filename );
+  };
+
   // Read in triangle element connectivity
-  for (std::size_t i=0; i<m_ntri; ++i) {
-    std::array< std::size_t, 3 > n;
-    m_inFile >> n[0] >> n[1] >> n[2];
-    mesh.triinpoel().push_back( n[0] );
-    mesh.triinpoel().push_back( n[1] );
-    mesh.triinpoel().push_back( n[2] );
-  }
+  conn( m_ntri, 3, mesh.triinpoel() );
 
   // Read side sets of triangle elements
+  std::vector< int > setid;
+  auto ok = tk::parseLines< std::vector< int > >( m_inFile, m_ntri,
+    []( const char* p, std::vector< int >& id ){
+      int i;
+      if (!tk::parseInt( p, i )) return false;
+      id.push_back( i );
+      return true; },
+    [&]( const std::vector< int >& id ){
+      setid.insert( end(setid), begin(id), end(id) ); } );
+  ErrChk( ok, "Failed to read side sets in file " + m_filename );
   for (std::size_t i=0; i<m_ntri; ++i) {
-    int setid;
-    m_inFile >> setid;
-    mesh.bface()[ setid ].push_back( m_ntet + i );
-    mesh.faceid()[ setid ].push_back( 0 );
+    mesh.bface()[ setid[i] ].push_back( m_ntet + i );
+    mesh.faceid()[ setid[i] ].push_back( 0 );
   }
 
   // Read in tetrahedra element connectivity
-  for (std::size_t i=0; i<m_ntet; ++i) {
-    std::array< std::size_t, 4 > n;
-    m_inFile >> n[0] >> n[1] >> n[2] >> n[3];
-    mesh.tetinpoel().push_back( n[0] );
-    mesh.tetinpoel().push_back( n[1] );
-    mesh.tetinpoel().push_back( n[2] );
-    mesh.tetinpoel().push_back( n[3] );
-  }
+  conn( m_ntet, 4, mesh.tetinpoel() );
 
   // Shift node IDs to start from zero
   shiftToZero( mesh.triinpoel() );
@@ -15,6 +15,10 @@
 */
 // *****************************************************************************
 
+#include <map>
+#include <iterator>
+#include <algorithm>
+
 #include "QuinoaConfig.hpp"
 #include "ALECG.hpp"
 #include "Vector.hpp"
@@ -27,12 +31,15 @@
 #include "CGPDE.hpp"
 #include "Discretization.hpp"
 #include "DiagReducer.hpp"
+#include "SetupReport.hpp"
 #include "NodeBC.hpp"
 #include "Refiner.hpp"
 #include "Reorder.hpp"
 #include "Around.hpp"
 #include "CGPDE.hpp"
 #include "Integrate/Mass.hpp"
+#include "DtLevels.hpp"
+#include "MsgPriority.hpp"
 
 #ifdef HAS_ROOT
   #include "RootMeshWriter.hpp"
@@ -44,8 +51,26 @@ extern ctr::InputDeck g_inputdeck;
 extern ctr::InputDeck g_inputdeck_defaults;
 extern std::vector< CGPDE > g_cgpde;
 
-//! Runge-Kutta coefficients
-static const std::array< tk::real, 3 > rkcoef{{ 1.0/3.0, 1.0/2.0, 1.0 }};
+//! \brief Coefficients of the multistage Runge-Kutta schemes by number of
+//!   stages
+//! \details Stage k computes u = un + rkcoefs[k] dt R(u), where u is the
+//!   solution of the previous stage, see ALECG::solve(). These are the
+//!   schemes of Jameson, the last one of which has the largest stability
+//!   interval along the imaginary axis per stage.
+static const std::map< std::size_t, std::vector< tk::real > > rkcoefs{
+  { 3, { 1.0/3.0, 1.0/2.0, 1.0 } },
+  { 4, { 1.0/4.0, 1.0/3.0, 1.0/2.0, 1.0 } },
+  { 5, { 1.0/4.0, 1.0/6.0, 3.0/8.0, 1.0/2.0, 1.0 } } };
+
+//! Runge-Kutta coefficients of the number of stages configured
+//! \return Stage coefficients of the Runge-Kutta scheme configured
+static const std::vector< tk::real >& rkcoef() {
+  const auto n = g_inputdeck.get< tag::discr, tag::rkstages >();
+  const auto c = rkcoefs.find( n );
+  ErrChk( c != end(rkcoefs), "ALECG does not support Runge-Kutta schemes "
+          "with " + std::to_string(n) + " stages" );
+  return c->second;
+}
 
 } // inciter::
 
@@ -55,6 +80,7 @@ ALECG::ALECG( const CProxy_Discretization& disc,
               const std::map< int, std::vector< std::size_t > >& bface,
               const std::map< int, std::vector< std::size_t > >& bnode,
               const std::vector< std::size_t >& triinpoel ) :
+  m_setupt0( CkWallTimer() ),
   m_disc( disc ),
   m_initial( 1 ),
   m_nsol( 0 ),
@@ -69,7 +95,9 @@ ALECG::ALECG( const CProxy_Discretization& disc,
   m_bndel( bndel() ),
   m_dfnorm(),
   m_dfnormc(),
+  m_dfnedge(),
   m_dfn(),
+  m_changedNodes(),
   m_esup( tk::genEsup( Disc()->Inpoel(), 4 ) ),
   m_psup( tk::genPsup( Disc()->Inpoel(), 4, m_esup ) ),
   m_u( m_disc[thisIndex].ckLocal()->Gid().size(),
@@ -83,19 +111,49 @@ ALECG::ALECG( const CProxy_Discretization& disc,
   m_gradc(),
   m_rhsc(),
   m_diag(),
+  m_diaglag(),
+  m_stats( Disc()->stats( m_u.nprop() ) ),
   m_bnorm(),
   m_bnormc(),
   m_symbcnodes(),
   m_farfieldbcnodes(),
+  m_symbcnorm(),
+  m_farfieldbcnorm(),
   m_symbctri(),
   m_stage( 0 ),
   m_boxnodes(),
-  m_boxnodes_set(),
+  m_boxstate(),
   m_edgenode(),
   m_edgeid(),
+  m_rhspart(),
+  m_pgrad( g_cgpde.size() ),
+  m_dflux( g_cgpde.size() ),
   m_dtp( m_u.nunk(), 0.0 ),
   m_tp( m_u.nunk(), g_inputdeck.get< tag::discr, tag::t0 >() ),
-  m_finished( 0 )
+  m_finished( 0 ),
+  m_kit( 0 ),
+  m_res(),
+  m_krylov(),
+  m_arnoldi(),
+  m_hcol(),
+  m_unorm( 0.0 ),
+  m_keps( 0.0 ),
+  m_own(),
+  m_mgcorr( 0 ),
+  m_mg(),
+  m_dtlag( 0.0 ),
+  m_dtlocal( 0.0 ),
+  m_dtpending( 0 ),
+  m_dtwait( 0 ),
+  m_stepctl( g_inputdeck.get< tag::discr, tag::rktol >() ),
+  m_dterr( -1.0 ),
+  m_u1(),
+  m_irs( 0 ),
+  m_nirs{{ 0, 0 }},
+  m_irsc(),
+  m_irsw(),
+  m_rhs0(),
+  m_rsm()
 // *****************************************************************************
 //  Constructor
 //! \param[in] disc Discretization proxy
@@ -107,37 +165,77 @@ ALECG::ALECG( const CProxy_Discretization& disc,
 {
   usesAtSync = true;    // enable migration at AtSync
 
-  // Perform optional operator-access-pattern mesh node reordering
-  if (g_inputdeck.get< tag::discr, tag::operator_reorder >()) {
+  auto d = Disc();
 
-    auto d = Disc();
+  const auto nodereorder =
+    g_inputdeck.get< tag::discr, tag::operator_reorder >();
+  const auto elemreorder = g_inputdeck.get< tag::discr, tag::elem_reorder >();
+
+  // Perform optional local mesh node reordering
+  if (nodereorder) {
 
-    // Create new local ids based on access pattern of PDE operators
     std::unordered_map< std::size_t, std::size_t > map;
-    std::size_t n = 0;
 
-    for (std::size_t p=0; p<m_u.nunk(); ++p) {  // for each point p
-      if (map.find(p) == end(map)) map[p] = n++;
-      for (auto q : tk::Around(m_psup,p)) {     // for each edge p-q
-        if (map.find(q) == end(map)) map[q] = n++;
+    if (g_inputdeck.get< tag::discr, tag::node_reorder >() ==
+        ctr::ReorderType::OPERATOR)
+    {
+      // Create new local ids based on access pattern of PDE operators
+      std::size_t n = 0;
+      for (std::size_t p=0; p<m_u.nunk(); ++p) {  // for each point p
+        if (map.find(p) == end(map)) map[p] = n++;
+        for (auto q : tk::Around(m_psup,p)) {     // for each edge p-q
+          if (map.find(q) == end(map)) map[q] = n++;
+        }
       }
+    } else {
+      // Create new local ids using a graph- or coordinate-based algorithm
+      map = d->nodeReorder();
     }
 
     Assert( map.size() == d->Gid().size(), "Map size mismatch" );
 
     // Remap data in bound Discretization object
     d->remap( map );
+    // Remap boundary triangle face connectivity
+    tk::remap( m_triinpoel, map );
+  }
+
+  // Perform optional element reordering consistent with node order
+  if (elemreorder) {
+    d->reorderElems();
+    // Regenerate elements along our mesh chunk boundary
+    m_bndel = bndel();
+  }
+
+  if (nodereorder || elemreorder) {
     // Recompute elements surrounding points
     m_esup = tk::genEsup( d->Inpoel(), 4 );
     // Recompute points surrounding points
     m_psup = tk::genPsup( d->Inpoel(), 4, m_esup );
-    // Remap boundary triangle face connectivity
-    tk::remap( m_triinpoel, map );
   }
 
   // Activate SDAG wait for initially computing the left-hand side and normals
   thisProxy[ thisIndex ].wait4lhs();
 
+  // Account memory of the worker
+  if (g_inputdeck.get< tag::cmd, tag::feedback >()) {
+    std::array< std::size_t, NUMMEM > b{};
+    b[MMESH] = tk::bytes( m_bnode, m_bface, m_triinpoel );
+    b[MDERIVED] = tk::bytes( m_esup, m_psup, m_bndel, m_dfnorm, m_dfn,
+                             m_edgenode, m_edgeid, m_irsw, m_bcdir, m_bnorm,
+                             m_symbcnodes, m_farfieldbcnodes, m_symbctri,
+                             m_boxnodes );
+    b[MFIELDS] = tk::bytes( m_u, m_un, m_lhs, m_rhs, m_grad, m_pgrad, m_prim,
+                             m_dflux, m_res, m_krylov, m_stats, m_rhs0,
+                             m_rsm );
+    b[MCOMMAP] = tk::bytes( m_lhsc, m_gradc, m_rhsc, m_dfnormc, m_dfnedge,
+                            m_bnormc, m_irsc );
+    d->memory( b );
+    contribute( setupreport( { { TDERIVED, CkWallTimer() - m_setupt0 } } ),
+      CkReduction::max_double,
+      CkCallback( CkReductionTarget(Transporter,setuptime), d->Tr() ) );
+  }
+
   // Signal the runtime system that the workers have been created
   contribute( sizeof(int), &m_initial, CkReduction::sum_int,
     CkCallback(CkReductionTarget(Transporter,comfinal), Disc()->Tr()) );
@@ -151,6 +249,7 @@ ALECG::norm()
 // *****************************************************************************
 {
   auto d = Disc();
+  m_setupt0 = CkWallTimer();
 
   // Query nodes at which symmetry BCs are specified
   auto bcnodes = d->bcnodes< tag::bcsym >( m_bface, m_triinpoel );
@@ -246,33 +345,198 @@ ALECG::edfnorm( const tk::UnsMesh::Edge& edge,
   return n;
 }
 
+void
+ALECG::edgeids()
+// *****************************************************************************
+// Generate flat list of unique edges and flat edge id data structure
+//! \details Edges p-q are enumerated in increasing order of p (and q > p),
+//!   visiting each once, which is cache friendly in the edge loop. Since the
+//!   points surrounding a point are sorted (see tk::genPsup), the id of an
+//!   edge p-q, with q < p, already assigned at point q, can be found by binary
+//!   search. The end-points of an edge are stored in increasing order of their
+//!   global ids, so the orientation of an edge is the same on all chares
+//!   sharing it.
+// *****************************************************************************
+{
+  const auto& gid = Disc()->Gid();
+  const auto& psup1 = m_psup.first;
+  const auto& psup2 = m_psup.second;
+  ErrChk( psup1.size() <= std::numeric_limits< tk::lid_t >::max(),
+          "Number of edges exceeds the range of local ids" );
+  m_edgenode.clear();
+  m_edgenode.reserve( psup1.size()-1 );
+  m_edgeid.resize( psup1.size() );
+  for (std::size_t p=0, e=0; p<gid.size(); ++p)
+    for (auto i=psup2[p]+1; i<=psup2[p+1]; ++i) {
+      auto q = psup1[i];
+      if (p < q) {
+        m_edgeid[i-1] = static_cast< tk::lid_t >( e++ );
+        auto lp = static_cast< tk::lid_t >( p );
+        auto lq = static_cast< tk::lid_t >( q );
+        if (gid[p] > gid[q]) {
+          m_edgenode.push_back( lq );
+          m_edgenode.push_back( lp );
+        } else {
+          m_edgenode.push_back( lp );
+          m_edgenode.push_back( lq );
+        }
+      } else {
+        m_edgeid[i-1] = static_cast< tk::lid_t >( edgeid( q, p ) );
+      }
+    }
+}
+
+std::size_t
+ALECG::edgeid( std::size_t p, std::size_t q ) const
+// *****************************************************************************
+// Find the id of an edge
+//! \param[in] p Local id of one end-point of the edge
+//! \param[in] q Local id of the other end-point of the edge
+//! \return Id of edge p-q in m_edgenode
+//! \details The id is found by binary search among the sorted points
+//!   surrounding point p.
+// *****************************************************************************
+{
+  tk::Around around( m_psup, p );
+  auto j = std::lower_bound( around.begin(), around.end(), q );
+  Assert( j != around.end() && *j == q, "Edge not found among points "
+          "surrounding points" );
+  return m_edgeid[ static_cast< std::size_t >(
+                     std::distance( begin(m_psup.first), j ) ) - 1 ];
+}
+
 void
 ALECG::dfnorm()
 // *****************************************************************************
 // Compute dual-face normals associated to edges
+//! \details Our own contributions to the dual-face normals are accumulated
+//!   in the first vector of each edge in m_dfn, indexed by edge id, and those
+//!   of chare-boundary edges are sent to neighbor chares in the order of their
+//!   sorted global edge ids, so that the contributions received can be added
+//!   by position, see normfinal().
 // *****************************************************************************
 {
   auto d = Disc();
   const auto& inpoel = d->Inpoel();
   const auto& gid = d->Gid();
+  const auto& lid = d->Lid();
 
-  // compute derived data structures
-  auto esued = tk::genEsued( inpoel, 4, tk::genEsup( inpoel, 4 ) );
+  // Enumerate edges, whose ids change if the mesh is refined
+  edgeids();
+  m_dfn.assign( m_edgenode.size()*3, 0.0 );     // 2 vectors per edge
+
+  if (m_dfnorm.empty()) {
+
+    const auto& coord = d->Coord();
+    const auto& x = coord[0];
+    const auto& y = coord[1];
+    const auto& z = coord[2];
+
+    // Compute dual-face normals for domain edges in a single element loop
+    for (std::size_t e=0; e<inpoel.size()/4; ++e) {
+      // access node IDs
+      const std::array< std::size_t, 4 >
+        N{ inpoel[e*4+0], inpoel[e*4+1], inpoel[e*4+2], inpoel[e*4+3] };
+      // compute element Jacobi determinant
+      const std::array< tk::real, 3 >
+        ba{{ x[N[1]]-x[N[0]], y[N[1]]-y[N[0]], z[N[1]]-z[N[0]] }},
+        ca{{ x[N[2]]-x[N[0]], y[N[2]]-y[N[0]], z[N[2]]-z[N[0]] }},
+        da{{ x[N[3]]-x[N[0]], y[N[3]]-y[N[0]], z[N[3]]-z[N[0]] }};
+      const auto J = tk::triple( ba, ca, da );        // J = 6V
+      Assert( J > 0, "Element Jacobian non-positive" );
+      // shape function derivatives, nnode*ndim [4][3]
+      std::array< std::array< tk::real, 3 >, 4 > grad;
+      grad[1] = tk::crossdiv( ca, da, J );
+      grad[2] = tk::crossdiv( da, ba, J );
+      grad[3] = tk::crossdiv( ba, ca, J );
+      for (std::size_t i=0; i<3; ++i)
+        grad[0][i] = -grad[1][i]-grad[2][i]-grad[3][i];
+      // sum normal contributions to the edges of the element
+      auto J48 = J/48.0;
+      for (const auto& [a,b] : tk::lpoed) {
+        auto k = edgeid( N[a], N[b] );
+        auto s = tk::orient( {N[a],N[b]}, {m_edgenode[k*2+0],
+                                           m_edgenode[k*2+1]} );
+        for (std::size_t j=0; j<3; ++j)
+          m_dfn[k*6+j] += J48 * s * (grad[a][j] - grad[b][j]);
+      }
+    }
+
+    // Keep own contributions if the mesh is refined during time stepping
+    if (g_inputdeck.get< tag::amr, tag::dtref >())
+      for (std::size_t k=0; k<m_edgenode.size()/2; ++k) {
+        auto& n = m_dfnorm[{ gid[m_edgenode[k*2+0]], gid[m_edgenode[k*2+1]] }];
+        for (std::size_t j=0; j<3; ++j) n[j] = m_dfn[k*6+j];
+      }
 
-  // Compute dual-face normals for domain edges
-  for (std::size_t p=0; p<gid.size(); ++p)    // for each point p
-    for (auto q : tk::Around(m_psup,p))       // for each edge p-q
-      if (gid[p] < gid[q])
-        m_dfnorm[{gid[p],gid[q]}] = edfnorm( {p,q}, esued );
+  } else {
 
-  // Send our dual-face normal contributions to neighbor chares
+    // After mesh refinement only recompute dual-face normals of edges that
+    // have at least one end-point whose surrounding elements have changed
+    std::vector< char > changed( gid.size(), 0 );
+    for (auto p : m_changedNodes) changed[p] = 1;
+
+    // Remove dual-face normals of edges removed or changed
+    for (auto it = m_dfnorm.begin(); it != m_dfnorm.end(); ) {
+      auto p = lid.find( it->first[0] );
+      auto q = lid.find( it->first[1] );
+      if (p == end(lid) || q == end(lid) || changed[p->second] ||
+          changed[q->second])
+        it = m_dfnorm.erase( it );
+      else
+        ++it;
+    }
+
+    // Collect elements surrounding changed edges, each element once per edge
+    std::unordered_map< tk::UnsMesh::Edge, std::vector< std::size_t >,
+      tk::UnsMesh::Hash<2>, tk::UnsMesh::Eq<2> > esued;
+    for (auto p : m_changedNodes)
+      for (auto e : tk::Around(m_esup,p))
+        for (const auto& [a,b] : tk::lpoed) {
+          auto A = inpoel[e*4+a];
+          auto B = inpoel[e*4+b];
+          auto q = A == p ? B : (B == p ? A : p);
+          if (q != p && (!changed[q] || p < q)) esued[{p,q}].push_back( e );
+        }
+
+    // Recompute dual-face normals for changed domain edges
+    for (auto p : m_changedNodes)               // for each changed point p
+      for (auto q : tk::Around(m_psup,p))       // for each edge p-q
+        if (gid[p] < gid[q])
+          m_dfnorm[{gid[p],gid[q]}] = edfnorm( {p,q}, esued );
+        else if (!changed[q])
+          m_dfnorm[{gid[q],gid[p]}] = edfnorm( {q,p}, esued );
+
+    tk::destroy( m_changedNodes );
+
+    // Flatten own contributions to dual-face normals using the new edge ids
+    for (std::size_t k=0; k<m_edgenode.size()/2; ++k) {
+      const auto& n = tk::cref_find( m_dfnorm,
+        tk::UnsMesh::Edge{ gid[m_edgenode[k*2+0]], gid[m_edgenode[k*2+1]] } );
+      for (std::size_t j=0; j<3; ++j) m_dfn[k*6+j] = n[j];
+    }
+  }
+
+  // Send our dual-face normal contributions to neighbor chares, in the order
+  // of sorted global edge ids, remembering the ids of the edges sent
+  m_dfnedge.clear();
   if (d->EdgeCommMap().empty())
     comdfnorm_complete();
   else {
     for (const auto& [c,edges] : d->EdgeCommMap()) {
-      decltype(m_dfnorm) exp;
-      for (const auto& e : edges) exp[e] = tk::cref_find(m_dfnorm,e);
-      thisProxy[c].comdfnorm( exp );
+      std::vector< tk::UnsMesh::Edge > g;
+      g.reserve( edges.size() );
+      for (const auto& [a,b] : edges)
+        g.push_back( {{ std::min(a,b), std::max(a,b) }} );
+      std::sort( begin(g), end(g) );
+      auto& k = m_dfnedge[c];
+      k.resize( g.size() );
+      std::vector< tk::real > exp( g.size()*3 );
+      for (std::size_t i=0; i<g.size(); ++i) {
+        k[i] = edgeid( tk::cref_find(lid,g[i][0]), tk::cref_find(lid,g[i][1]) );
+        for (std::size_t j=0; j<3; ++j) exp[i*3+j] = m_dfn[k[i]*6+j];
+      }
+      thisProxy[c].comdfnorm( thisIndex, exp );
     }
   }
 
@@ -280,22 +544,20 @@ ALECG::dfnorm()
 }
 
 void
-ALECG::comdfnorm( const std::unordered_map< tk::UnsMesh::Edge,
-                    std::array< tk::real, 3 >,
-                    tk::UnsMesh::Hash<2>, tk::UnsMesh::Eq<2> >& dfnorm )
+ALECG::comdfnorm( int fromch, const std::vector< tk::real >& dfnorm )
 // *****************************************************************************
 // Receive contributions to dual-face normals on chare-boundaries
+//! \param[in] fromch Sender chare id
 //! \param[in] dfnorm Incoming partial sums of dual-face normals associated to
-//!   chare-boundary edges
+//!   chare-boundary edges, 3 reals per edge, in the order of the sorted global
+//!   ids of the edges shared with the sender
 // *****************************************************************************
 {
   // Buffer up inccoming contributions to dual-face normals
-  for (const auto& [e,n] : dfnorm) {
-    auto& dfn = m_dfnormc[e];
-    dfn[0] += n[0];
-    dfn[1] += n[1];
-    dfn[2] += n[2];
-  }
+  Assert( m_dfnormc.find(fromch) == end(m_dfnormc),
+          "Dual-face normals already received from chare " +
+          std::to_string(fromch) );
+  m_dfnormc[ fromch ] = dfnorm;
 
   if (++m_ndfnorm == Disc()->EdgeCommMap().size()) {
     m_ndfnorm = 0;
@@ -363,20 +625,6 @@ ALECG::comnorm( const std::unordered_map< int,
   }
 }
 
-void
-ALECG::registerReducers()
-// *****************************************************************************
-//  Configure Charm++ reduction types initiated from this chare array
-//! \details Since this is a [initnode] routine, the runtime system executes the
-//!   routine exactly once on every logical node early on in the Charm++ init
-//!   sequence. Must be static as it is called without an object. See also:
-//!   Section "Initializations at Program Startup" at in the Charm++ manual
-//!   http://charm.cs.illinois.edu/manuals/html/charm++/manual.html.
-// *****************************************************************************
-{
-  NodeDiagnostics::registerReducers();
-}
-
 void
 ALECG::ResumeFromSync()
 // *****************************************************************************
@@ -403,6 +651,7 @@ ALECG::setup()
 
   // Compute volume of user-defined box IC
   d->boxvol( m_boxnodes );
+  m_boxstate = ICBoxState( m_boxnodes.size() );
 
   // Query time history field output labels from all PDEs integrated
   const auto& hist_points = g_inputdeck.get< tag::history, tag::point >();
@@ -430,9 +679,7 @@ ALECG::box( tk::real v )
 
   // Set user-defined IC box conditions
   for (const auto& eq : g_cgpde)
-    eq.box( d->Boxvol(), d->T(), m_boxnodes, d->Coord(), m_u, m_boxnodes_set );
-  //if (m_boxnodes_set.size() != m_boxnodes.size())
-  //  std::cout << thisIndex << ':' << m_boxnodes.size() - m_boxnodes_set.size() << '\n';
+    eq.box( d->Boxvol(), d->T(), m_boxnodes, d->Coord(), m_u, m_boxstate );
 
   // Compute left-hand side of PDEs
   lhs();
@@ -449,11 +696,63 @@ ALECG::start()
   Disc()->Timer().zero();
   // Zero grind-timer
   Disc()->grindZero();
+
+  // Group mesh nodes into time step size levels if configured
+  auto nlevel = g_inputdeck.get< tag::discr, tag::dtlevels >();
+  auto const_dt = g_inputdeck.get< tag::discr, tag::dt >();
+  auto def_const_dt = g_inputdeck_defaults.get< tag::discr, tag::dt >();
+  auto eps = std::numeric_limits< tk::real >::epsilon();
+  if (nlevel > 0 && std::abs(const_dt - def_const_dt) < eps &&
+      !g_inputdeck.get< tag::discr, tag::steady_state >())
+  {
+    auto d = Disc();
+    for (const auto& eq : g_cgpde) eq.dt( d->It(), d->Vol(), m_u, m_dtp );
+    auto mindt = *std::min_element( begin(m_dtp), end(m_dtp) );
+    contribute( sizeof(tk::real), &mindt, CkReduction::min_double,
+                CkCallback(CkReductionTarget(ALECG,dtlevels), thisProxy) );
+    return;
+  }
+
   // Continue to next time step
   next();
 }
 //! [start]
 
+void
+ALECG::dtlevels( tk::real mindt )
+// *****************************************************************************
+// Group mesh nodes into time step size levels and report them
+//! \param[in] mindt Global minimum of the nodal time step sizes
+//! \details The number of mesh nodes owned by this chare on each level is
+//!   summed across all chares in Transporter::dtlevels(), which reports the
+//!   distribution and the potential speedup of multi-rate time stepping. The
+//!   nodal time step sizes, computed in start(), are not changed by advancing
+//!   the solution, which only starts after this.
+// *****************************************************************************
+{
+  auto d = Disc();
+  auto nlevel = g_inputdeck.get< tag::discr, tag::dtlevels >();
+
+  auto level = tk::dtlevels( m_dtp, mindt, nlevel, m_psup );
+
+  // Flag slave mesh nodes, owned by the chare with the lowest ID, so that
+  // nodes on chare boundaries are only counted once
+  std::vector< char > slave( m_u.nunk(), 0 );
+  for (const auto& [c,n] : d->NodeCommMap())
+    if (thisIndex > c)
+      for (auto i : n) slave[ tk::cref_find( d->Lid(), i ) ] = 1;
+
+  std::vector< tk::real > count( nlevel, 0.0 );
+  for (std::size_t i=0; i<level.size(); ++i)
+    if (!slave[i]) count[ level[i] ] += 1.0;
+
+  contribute( count, CkReduction::sum_double,
+    CkCallback(CkReductionTarget(Transporter,dtlevels), d->Tr()) );
+
+  // Continue to next time step
+  next();
+}
+
 //! [Compute own and send lhs on chare-boundary]
 void
 ALECG::lhs()
@@ -463,20 +762,23 @@ ALECG::lhs()
 // *****************************************************************************
 {
   auto d = Disc();
+  d->phase( LHS );
 
   // Compute lumped mass lhs
   m_lhs = tk::lump( m_u.nprop(), d->Coord(), d->Inpoel() );
 
   if (d->NodeCommMap().empty())        // in serial we are done
     comlhs_complete();
-  else // send contributions of lhs to chare-boundary nodes to fellow chares
-    for (const auto& [c,n] : d->NodeCommMap()) {
-      std::vector< std::vector< tk::real > > l( n.size() );
-      std::size_t j = 0;
-      for (auto i : n) l[ j++ ] = m_lhs[ tk::cref_find(d->Lid(),i) ];
-      thisProxy[c].comlhs( std::vector<std::size_t>(begin(n),end(n)), l );
+  else {  // send contributions of lhs to chare-boundary nodes to fellow chares
+    std::vector< tk::real > l;
+    for (const auto& [c,n] : d->NodeCommLid()) {
+      d->packNodeComm( c, m_lhs, l );
+      d->Comm().sent( MLHS, c, thisIndex, l );
+      thisProxy[c].comlhs( thisIndex, l, msgopts( MLHS ) );
     }
+  }
 
+  d->phase( WAIT );
   ownlhs_complete();
 
   // (Re-)compute boundary point-, and dual-face normals
@@ -486,12 +788,12 @@ ALECG::lhs()
 
 //! [Receive lhs on chare-boundary]
 void
-ALECG::comlhs( const std::vector< std::size_t >& gid,
-               const std::vector< std::vector< tk::real > >& L )
+ALECG::comlhs( int c, const std::vector< tk::real >& L )
 // *****************************************************************************
 //  Receive contributions to left-hand side diagonal matrix on chare-boundaries
-//! \param[in] gid Global mesh node IDs at which we receive LHS contributions
-//! \param[in] L Partial contributions of LHS to chare-boundary nodes
+//! \param[in] c Sender chare id
+//! \param[in] L Partial contributions of LHS to chare-boundary nodes, all
+//!   components per node, in the order of Discretization::NodeCommLid()
 //! \details This function receives contributions to m_lhs, which stores the
 //!   diagonal (lumped) mass matrix at mesh nodes. While m_lhs stores
 //!   own contributions, m_lhsc collects the neighbor chare contributions during
@@ -499,15 +801,10 @@ ALECG::comlhs( const std::vector< std::size_t >& gid,
 //!   are combined in lhsmerge().
 // *****************************************************************************
 {
-  Assert( L.size() == gid.size(), "Size mismatch" );
-
-  using tk::operator+=;
-
   auto d = Disc();
+  d->Comm().received( MLHS, c, L );
 
-  for (std::size_t i=0; i<gid.size(); ++i) {
-    m_lhsc[ gid[i] ] += L[i];
-  }
+  m_lhsc[ c ] = L;
 
   // When we have heard from all chares we communicate with, this chare is done
   if (++m_nlhs == d->NodeCommMap().size()) {
@@ -526,16 +823,10 @@ ALECG::lhsmerge()
 {
   // Combine own and communicated contributions to left hand side
   auto d = Disc();
+  d->phase( LHS );
 
   // Combine own and communicated contributions to LHS and ICs
-  for (const auto& b : m_lhsc) {
-    auto lid = tk::cref_find( d->Lid(), b.first );
-    for (ncomp_t c=0; c<m_lhs.nprop(); ++c)
-      m_lhs(lid,c,0) += b.second[c];
-  }
-
-  // Clear receive buffer
-  tk::destroy(m_lhsc);
+  d->unpackNodeComm( m_lhsc, m_lhs );
 
   // Combine own and communicated contributions of normals and apply boundary
   // conditions on the initial conditions
@@ -543,8 +834,14 @@ ALECG::lhsmerge()
 
   // Continue after lhs is complete
   if (m_initial) {
+    // Report the time from starting computing normals till they are complete
+    if (g_inputdeck.get< tag::cmd, tag::feedback >())
+      contribute( setupreport( { { TNORM, CkWallTimer() - m_setupt0 } } ),
+        CkReduction::max_double,
+        CkCallback( CkReductionTarget(Transporter,setuptime), d->Tr() ) );
     // Output initial conditions to file
-    writeFields( CkCallback(CkIndex_ALECG::start(), thisProxy[thisIndex]) );
+    writeFields( true,
+                 CkCallback(CkIndex_ALECG::start(), thisProxy[thisIndex]) );
   } else {
     lhs_complete();
   }
@@ -605,12 +902,16 @@ ALECG::normfinal()
   // If farfield BC is set on a node, will not also set symmetry BC
   for (auto fn : m_farfieldbcnodes) m_symbcnodes.erase(fn);
 
+  // Flatten BC nodes and their normals for applying BCs after every solve
+  m_symbcnorm = tk::BndNodeNormals( m_bnorm, m_symbcnodes );
+  m_farfieldbcnorm = tk::BndNodeNormals( m_bnorm, m_farfieldbcnodes );
+
   // Apply symmetry BCs on initial conditions
   for (const auto& eq : g_cgpde)
-    eq.symbc( m_u, d->Coord(), m_bnorm, m_symbcnodes );
+    eq.symbc( m_u, d->Coord(), m_symbcnorm );
   // Apply farfield BCs on initial conditions
   for (const auto& eq : g_cgpde)
-    eq.farfieldbc( m_u, d->Coord(), m_bnorm, m_farfieldbcnodes );
+    eq.farfieldbc( m_u, d->Coord(), m_farfieldbcnorm );
 
   // Prepare boundary nodes contiguously accessible from a triangle-face loop
   m_symbctri.resize( m_triinpoel.size()/3, 0 );
@@ -618,75 +919,103 @@ ALECG::normfinal()
     if (m_symbcnodes.find(m_triinpoel[e*3+0]) != end(m_symbcnodes))
       m_symbctri[e] = 1;
 
-  // Count contributions to chare-boundary edges
-  std::unordered_map< tk::UnsMesh::Edge, std::size_t,
-    tk::UnsMesh::Hash<2>, tk::UnsMesh::Eq<2> > edge_node_count;
-  for (const auto& [c,edges] : d->EdgeCommMap())
-    for (const auto& e : edges)
-      ++edge_node_count[e];
-
-  // Combine and weigh communicated contributions to dual-face normals
-  for (auto& [e,n] : m_dfnormc) {
-    const auto& dfn = tk::cref_find( m_dfnorm, e );
-    n[0] += dfn[0];
-    n[1] += dfn[1];
-    n[2] += dfn[2];
-    auto count = static_cast< tk::real >( tk::cref_find( edge_node_count, e ) );
-    auto factor = 1.0/(count + 1.0);
-    for (auto & x : n) x *= factor;
+  // Combine and weigh communicated contributions to dual-face normals. The
+  // contributions received from a neighbor chare are in the order of the
+  // edges in m_dfnedge, summed to the second vector of m_dfn, which is then
+  // averaged with our own in the first vector of m_dfn.
+  std::vector< std::size_t > count( m_edgenode.size()/2, 0 );
+  for (const auto& [c,n] : m_dfnormc) {
+    const auto& k = tk::cref_find( m_dfnedge, c );
+    Assert( n.size() == k.size()*3, "Size mismatch in dual-face normals "
+            "received from chare " + std::to_string(c) );
+    for (std::size_t i=0; i<k.size(); ++i) {
+      for (std::size_t j=0; j<3; ++j) m_dfn[k[i]*6+3+j] += n[i*3+j];
+      ++count[ k[i] ];
+    }
   }
-
-  // Generate list of unique edges
-  tk::UnsMesh::EdgeSet uedge;
-  for (std::size_t p=0; p<m_u.nunk(); ++p)
-    for (auto q : tk::Around(m_psup,p))
-      uedge.insert( {p,q} );
-
-  // Flatten edge list
-  m_edgenode.resize( uedge.size() * 2 );
-  std::size_t f = 0;
-  const auto& gid = d->Gid();
-  for (auto&& [p,q] : uedge) {
-    if (gid[p] > gid[q]) {
-      m_edgenode[f+0] = std::move(q);
-      m_edgenode[f+1] = std::move(p);
+  for (std::size_t e=0; e<count.size(); ++e)
+    if (count[e]) {
+      auto factor = 1.0/(static_cast< tk::real >( count[e] ) + 1.0);
+      for (std::size_t j=0; j<3; ++j) {
+        auto& m = m_dfn[e*6+3+j];
+        m += m_dfn[e*6+j];
+        m *= factor;
+      }
     } else {
-      m_edgenode[f+0] = std::move(p);
-      m_edgenode[f+1] = std::move(q);
+      for (std::size_t j=0; j<3; ++j) m_dfn[e*6+3+j] = m_dfn[e*6+j];
     }
-    f += 2;
-  }
-  tk::destroy(uedge);
 
-  // Convert dual-face normals to streamable (and vectorizable) data structure
-  m_dfn.resize( m_edgenode.size() * 3 );      // 2 vectors per access
-  std::unordered_map< tk::UnsMesh::Edge, std::size_t,
-                      tk::UnsMesh::Hash<2>, tk::UnsMesh::Eq<2> > eid;
-  for (std::size_t e=0; e<m_edgenode.size()/2; ++e) {
-    auto p = m_edgenode[e*2+0];
-    auto q = m_edgenode[e*2+1];
-    eid[{p,q}] = e;
-    std::array< std::size_t, 2 > g{ gid[p], gid[q] };
-    auto n = tk::cref_find( m_dfnorm, g );
-    // figure out if this is an edge on the parallel boundary
-    auto nit = m_dfnormc.find( g );
-    auto m = ( nit != m_dfnormc.end() ) ? nit->second : n;
-    m_dfn[e*6+0] = n[0];
-    m_dfn[e*6+1] = n[1];
-    m_dfn[e*6+2] = n[2];
-    m_dfn[e*6+3] = m[0];
-    m_dfn[e*6+4] = m[1];
-    m_dfn[e*6+5] = m[2];
+  // Weigh edges in implicit residual smoothing by the inverse of the number
+  // of chares sharing them, so that each edge is summed once across chares
+  if (g_inputdeck.get< tag::discr, tag::irs_sweeps >()) {
+    m_irsw.resize( count.size() );
+    for (std::size_t e=0; e<count.size(); ++e)
+      m_irsw[e] = 1.0 / (static_cast< tk::real >( count[e] ) + 1.0);
   }
 
-  tk::destroy( m_dfnorm );
+  // Coarse multigrid levels are regenerated from the new edges at first use
+  m_mg.clear();
+
+  // Keep own contributions to dual-face normals if the mesh is refined during
+  // time stepping, so that only those that change need to be recomputed
+  if (!g_inputdeck.get< tag::amr, tag::dtref >()) tk::destroy( m_dfnorm );
   tk::destroy( m_dfnormc );
 
-  // Flatten edge id data structure
-  m_edgeid.resize( m_psup.first.size() );
-  for (std::size_t p=0,k=0; p<m_u.nunk(); ++p)
-    for (auto q : tk::Around(m_psup,p))
-      m_edgeid[k++] = tk::cref_find( eid, {p,q} );
+  // Partition mesh entities into the parts of the right hand side
+  rhspart();
+}
+
+void
+ALECG::rhspart()
+// *****************************************************************************
+//  Partition mesh entities into the parts of the right hand side
+//! \details The right hand side is computed in two parts, so that the
+//!   contributions to chare-boundary points can be sent to fellow chares
+//!   before the (often much larger) rest of the right hand side is computed.
+//!   The first part consists of the chare-boundary points, the edges and
+//!   boundary triangles with at least a single chare-boundary node, and the
+//!   nodes of the elements along the mesh chunk boundary, in which the
+//!   gradients are required by the edges of the first part. Every other point,
+//!   edge, and triangle is in the second part. In serial the first part is
+//!   empty.
+// *****************************************************************************
+{
+  auto d = Disc();
+  const auto& inpoel = d->Inpoel();
+  const auto npoin = m_u.nunk();
+
+  // Flag chare-boundary points
+  std::vector< int > bnd( npoin, 0 );
+  for (auto i : d->BidLid())
+    if (i != std::numeric_limits< std::size_t >::max()) bnd[i] = 1;
+
+  // Flag points in which gradients are required by the first part
+  std::vector< int > bndg( npoin, 0 );
+  for (auto e : m_bndel)
+    for (std::size_t a=0; a<4; ++a) bndg[ inpoel[e*4+a] ] = 1;
+
+  for (auto& part : m_rhspart) {
+    part.gpoin.clear();
+    part.poin.clear();
+    part.edge.clear();
+    part.tri.clear();
+  }
+
+  for (std::size_t p=0; p<npoin; ++p) {
+    m_rhspart[ bndg[p] ? 0 : 1 ].gpoin.push_back( p );
+    m_rhspart[ bnd[p] ? 0 : 1 ].poin.push_back( p );
+  }
+
+  for (std::size_t e=0; e<m_edgenode.size()/2; ++e) {
+    auto b = bnd[ m_edgenode[e*2+0] ] || bnd[ m_edgenode[e*2+1] ];
+    m_rhspart[ b ? 0 : 1 ].edge.push_back( e );
+  }
+
+  for (std::size_t e=0; e<m_triinpoel.size()/3; ++e) {
+    auto b = bnd[ m_triinpoel[e*3+0] ] || bnd[ m_triinpoel[e*3+1] ] ||
+             bnd[ m_triinpoel[e*3+2] ];
+    m_rhspart[ b ? 0 : 1 ].tri.push_back( e );
+  }
 }
 
 void
@@ -740,6 +1069,13 @@ ALECG::dt()
     }
     //! [Find the minimum dt across all PDEs integrated]
 
+    // Bound the time step size by the one selected by the local error
+    // estimate of the previous time step, folded into the same minimum
+    if (dtctl() && m_dterr >= 0.0) {
+      mindt = std::min( mindt, m_stepctl.dt( d->Dt(), m_dterr ) );
+      m_dterr = -1.0;
+    }
+
   }
 
   //! [Advance]
@@ -748,12 +1084,81 @@ ALECG::dt()
   thisProxy[ thisIndex ].wait4rhs();
   thisProxy[ thisIndex ].wait4stage();
 
+  // With lagged time step sizes, compute the minimum dt across all chares
+  // in the background, but start the step only after the minimum of the
+  // previous step has arrived
+  if (g_inputdeck.get< tag::discr, tag::laggeddt >() > 0.0 &&
+      std::abs(const_dt - def_const_dt) < eps &&
+      !g_inputdeck.get< tag::discr, tag::steady_state >())
+  {
+    m_dtlocal = mindt;
+    if (m_dtpending) m_dtwait = 1; else stepdt();
+    return;
+  }
+
+  // Send diagnostics of the previous step along with dt, which continues via
+  // Transporter::diagdt() to advance()
+  if (!m_diaglag.empty()) {
+    m_diag.contribute( *d, std::move(m_diaglag), mindt );
+    m_diaglag.clear();
+    return;
+  }
+
   // Contribute to minimum dt across all chares the advance to next step
   contribute( sizeof(tk::real), &mindt, CkReduction::min_double,
               CkCallback(CkReductionTarget(ALECG,advance), thisProxy) );
   //! [Advance]
 }
 
+void
+ALECG::stepdt()
+// *****************************************************************************
+// Start a time step with the lagged global time step size
+//! \details The step is taken with the global minimum of the previous step
+//!   times the safety factor while the minimum of this step is computed. If
+//!   there is no previous minimum, e.g., in the first step, or the step size
+//!   taken in the previous step was too large, the step waits for its own.
+// *****************************************************************************
+{
+  m_dtpending = 1;
+  contribute( sizeof(tk::real), &m_dtlocal, CkReduction::min_double,
+              CkCallback(CkReductionTarget(ALECG,laggeddt), thisProxy) );
+
+  if (m_dtlag > 0.0)
+    advance( g_inputdeck.get< tag::discr, tag::laggeddt >() * m_dtlag );
+  else
+    m_dtwait = 2;
+}
+
+void
+ALECG::laggeddt( tk::real newdt )
+// *****************************************************************************
+// Receive the global minimum of the time step size computed in the background
+// with lagged time step sizes
+//! \param[in] newdt The smallest dt across the whole problem
+//! \details Unless the step waits for it, the minimum arrives during the
+//!   step it has been computed for, so the step size taken is checked against
+//!   it: if the step size taken violates the CFL condition, the next step
+//!   waits for its own minimum.
+// *****************************************************************************
+{
+  m_dtpending = 0;
+
+  if (m_dtwait == 2) {
+    m_dtwait = 0;
+    m_dtlag = newdt;
+    advance( newdt );
+    return;
+  }
+
+  m_dtlag = Disc()->Dt() > newdt ? 0.0 : newdt;
+
+  if (m_dtwait == 1) {
+    m_dtwait = 0;
+    stepdt();
+  }
+}
+
 void
 ALECG::advance( tk::real newdt )
 // *****************************************************************************
@@ -777,32 +1182,93 @@ ALECG::grad()
 // *****************************************************************************
 {
   auto d = Disc();
+  d->phase( GRAD );
+
+  // Compute primitive variables once per stage for all equations, scratch
+  // storage is not migrated
+  m_prim.resize( g_cgpde.size() );
+  for (std::size_t i=0; i<g_cgpde.size(); ++i)
+    g_cgpde[i].prim( d->Coord(), m_u, m_prim[i] );
+
+  // Reuse the gradients of the first stage without communication
+  if (frozengrad()) {
+    comgrad_complete();
+    owngrad_complete();
+    return;
+  }
 
   // Compute own portion of gradients for all equations
-  for (const auto& eq : g_cgpde)
-    eq.grad(d->Coord(), d->Inpoel(), m_bndel, d->Gid(), d->Bid(), m_u, m_grad);
+  for (std::size_t i=0; i<g_cgpde.size(); ++i)
+    g_cgpde[i].grad( d->Coord(), d->Inpoel(), m_bndel, d->LidBid(),
+                     m_prim[i], m_grad );
 
   // Communicate gradients to other chares on chare-boundary
   if (d->NodeCommMap().empty())        // in serial we are done
     comgrad_complete();
-  else // send gradients contributions to chare-boundary nodes to fellow chares
-    for (const auto& [c,n] : d->NodeCommMap()) {
-      std::vector< std::vector< tk::real > > g( n.size() );
-      std::size_t j = 0;
-      for (auto i : n) g[ j++ ] = m_grad[ tk::cref_find(d->Bid(),i) ];
-      thisProxy[c].comgrad( std::vector<std::size_t>(begin(n),end(n)), g );
+  else {  // send gradient contributions to chare-boundary nodes to fellows
+    const auto reduced = g_inputdeck.get< tag::discr, tag::reducedhalo >();
+    std::vector< tk::real > g;
+    std::vector< float > gf;
+    for (const auto& [c,n] : d->NodeCommBid()) {
+      if (reduced)
+        d->Comm().rounded( MGRAD, d->packNodeComm( c, m_grad, gf, true ) );
+      else
+        d->packNodeComm( c, m_grad, g, true );
+      d->Comm().sent( MGRAD, c, thisIndex, g, gf );
+      thisProxy[c].comgrad( thisIndex, g, gf, msgopts( MGRAD ) );
     }
+  }
 
+  d->phase( WAIT );
   owngrad_complete();
 }
 
+bool
+ALECG::dtctl() const
+// *****************************************************************************
+// Query if the time step size is selected by the local error estimate
+//! \return True if the time step size is bounded by the one selected from
+//!   the local time error estimate of the previous time step
+//! \details Only used with explicit time stepping, with the time step size
+//!   computed from the CFL condition, and without local time stepping.
+// *****************************************************************************
+{
+  return m_stepctl.enabled() &&
+         !g_inputdeck.get< tag::discr, tag::steady_state >() &&
+         !g_inputdeck.get< tag::discr, tag::implicit >() &&
+         std::abs( g_inputdeck.get< tag::discr, tag::dt >() -
+                   g_inputdeck_defaults.get< tag::discr, tag::dt >() ) <
+           std::numeric_limits< tk::real >::epsilon();
+}
+
+bool
+ALECG::frozengrad() const
+// *****************************************************************************
+// Query if the gradients of the first stage are reused in this stage
+//! \return True if the gradients computed in the first Runge-Kutta stage of
+//!   this time step are reused as is in this (later) stage
+//! \details Gradients are only frozen marching to steady state with explicit
+//!   time stepping, so every chare freezes in the same stages and no gradient
+//!   messages are expected in those.
+// *****************************************************************************
+{
+  return g_inputdeck.get< tag::discr, tag::steady_state >() &&
+         g_inputdeck.get< tag::discr, tag::freeze_grad >() &&
+         !g_inputdeck.get< tag::discr, tag::implicit >() &&
+         m_stage > 0;
+}
+
 void
-ALECG::comgrad( const std::vector< std::size_t >& gid,
-                const std::vector< std::vector< tk::real > >& G )
+ALECG::comgrad( int c,
+                const std::vector< tk::real >& G,
+                const std::vector< float >& Gf )
 // *****************************************************************************
 //  Receive contributions to nodal gradients on chare-boundaries
-//! \param[in] gid Global mesh node IDs at which we receive grad contributions
-//! \param[in] G Partial contributions of gradients to chare-boundary nodes
+//! \param[in] c Sender chare id
+//! \param[in] G Partial contributions of gradients to chare-boundary nodes,
+//!   all components per node, in the order of Discretization::NodeCommBid()
+//! \param[in] Gf Same as G but in single precision, sent instead of G if
+//!   reduced precision node halo data is configured
 //! \details This function receives contributions to m_grad, which stores the
 //!   nodal gradients at mesh nodes. While m_grad stores own
 //!   contributions, m_gradc collects the neighbor chare contributions during
@@ -810,11 +1276,9 @@ ALECG::comgrad( const std::vector< std::size_t >& gid,
 //!   are combined in rhs().
 // *****************************************************************************
 {
-  Assert( G.size() == gid.size(), "Size mismatch" );
-
-  using tk::operator+=;
-
-  for (std::size_t i=0; i<gid.size(); ++i) m_gradc[ gid[i] ] += G[i];
+  Disc()->Comm().received( MGRAD, c, G, Gf );
+  if (Gf.empty()) m_gradc[ c ] = G;
+  else m_gradc[ c ].assign( begin(Gf), end(Gf) );
 
   if (++m_ngrad == Disc()->NodeCommMap().size()) {
     m_ngrad = 0;
@@ -826,60 +1290,98 @@ void
 ALECG::rhs()
 // *****************************************************************************
 // Compute right-hand side of transport equations
+//! \details The right hand side is computed in chare-boundary points first,
+//!   which is then sent to fellow chares, and the rest of the right hand side
+//!   is computed while the messages are in flight. See also rhspart().
 // *****************************************************************************
 {
+  tk::Timer t;
   auto d = Disc();
+  d->phase( RHS );
 
   // Combine own and communicated contributions to nodal gradients
-  for (const auto& [gid,g] : m_gradc) {
-    auto bid = tk::cref_find( d->Bid(), gid );
-    for (ncomp_t c=0; c<m_grad.nprop(); ++c) m_grad(bid,c,0) += g[c];
-  }
-
-  // clear gradients receive buffer
-  tk::destroy(m_gradc);
+  const auto frozen = frozengrad();
+  if (!frozen) d->unpackNodeComm( m_gradc, m_grad, true );
 
   const auto steady = g_inputdeck.get< tag::discr, tag::steady_state >();
+  const auto implicit = g_inputdeck.get< tag::discr, tag::implicit >();
+
+  // Scratch storage is not migrated
+  m_pgrad.resize( g_cgpde.size() );
+  m_dflux.resize( g_cgpde.size() );
+
+  // Runge-Kutta coefficients of the stage, implicit time stepping evaluates
+  // the right hand side at the new time (backward Euler)
+  const auto& rk = rkcoef();
+  auto prev_rkcoef = implicit ? 1.0 : m_stage == 0 ? 0.0 : rk[m_stage-1];
+  auto rkc = implicit ? 1.0 : rk[m_stage];
+
+  // Compute own portion of right-hand side for all equations in a part
+  auto partrhs = [&]( const RHSPart& part ) {
+    for (std::size_t i=0; i<g_cgpde.size(); ++i)
+      g_cgpde[i].rhs( d->T() + prev_rkcoef * d->Dt(), d->Coord(), d->Inpoel(),
+        m_triinpoel, d->Gid(), d->BidLid(), m_dfn, m_psup, m_esup,
+        m_symbctri, d->Vol(), m_edgenode, m_edgeid, m_grad, m_u, m_prim[i],
+        m_tp, part, frozen, m_pgrad[i], m_dflux[i], m_rhs );
+  };
 
-  // Compute own portion of right-hand side for all equations
-  auto prev_rkcoef = m_stage == 0 ? 0.0 : rkcoef[m_stage-1];
   if (steady)
     for (std::size_t p=0; p<m_tp.size(); ++p) m_tp[p] += prev_rkcoef * m_dtp[p];
-  for (const auto& eq : g_cgpde)
-    eq.rhs( d->T() + prev_rkcoef * d->Dt(), d->Coord(), d->Inpoel(),
-            m_triinpoel, d->Gid(), d->Bid(), d->Lid(), m_dfn, m_psup, m_esup,
-            m_symbctri, d->Vol(), m_edgenode, m_edgeid, m_grad, m_u, m_tp,
-            m_rhs );
-  if (steady)
-    for (std::size_t p=0; p<m_tp.size(); ++p) m_tp[p] -= prev_rkcoef * m_dtp[p];
 
-  // Query and match user-specified boundary conditions to side sets
-  if (steady) for (auto& deltat : m_dtp) deltat *= rkcoef[m_stage];
-  m_bcdir = match( m_u.nprop(), d->T(), rkcoef[m_stage] * d->Dt(),
-                   m_tp, m_dtp, d->Coord(), d->Lid(), m_bnode );
-  if (steady) for (auto& deltat : m_dtp) deltat /= rkcoef[m_stage];
+  // Compute own portion of right-hand side in chare-boundary points
+  m_rhs.fill( 0.0 );
+  partrhs( m_rhspart[0] );
 
   // Communicate rhs to other chares on chare-boundary
   if (d->NodeCommMap().empty())        // in serial we are done
     comrhs_complete();
-  else // send contributions of rhs to chare-boundary nodes to fellow chares
-    for (const auto& [c,n] : d->NodeCommMap()) {
-      std::vector< std::vector< tk::real > > r( n.size() );
-      std::size_t j = 0;
-      for (auto i : n) r[ j++ ] = m_rhs[ tk::cref_find(d->Lid(),i) ];
-      thisProxy[c].comrhs( std::vector<std::size_t>(begin(n),end(n)), r );
+  else {  // send contributions of rhs to chare-boundary nodes to fellow chares
+    const auto reduced = g_inputdeck.get< tag::discr, tag::reducedhalo >();
+    std::vector< tk::real > r;
+    std::vector< float > rf;
+    for (const auto& [c,n] : d->NodeCommLid()) {
+      if (reduced)
+        d->Comm().rounded( MRHS, d->packNodeComm( c, m_rhs, rf ) );
+      else
+        d->packNodeComm( c, m_rhs, r );
+      d->Comm().sent( MRHS, c, thisIndex, r, rf );
+      thisProxy[c].comrhs( thisIndex, r, rf, msgopts( MRHS ) );
     }
+  }
+
+  // Compute the rest of the right-hand side while messages are in flight
+  partrhs( m_rhspart[1] );
+
+  if (steady)
+    for (std::size_t p=0; p<m_tp.size(); ++p) m_tp[p] -= prev_rkcoef * m_dtp[p];
+
+  // Match user-specified boundary conditions to side sets if the mesh has
+  // changed, then evaluate them
+  if (m_bcdir.epoch() != d->MeshEpoch())
+    m_bcdir = DirBCPlan( m_u.nprop(), m_u.nunk(), d->Coord(), d->Lid(),
+                         m_bnode, d->MeshEpoch() );
+  if (steady) for (auto& deltat : m_dtp) deltat *= rkc;
+  m_bcdir.eval( d->T(), rkc * d->Dt(), m_tp, m_dtp, d->Coord() );
+  if (steady) for (auto& deltat : m_dtp) deltat /= rkc;
 
+  // Record cost of right-hand side for load balancing
+  d->addCost( t.dsec() );
+
+  d->phase( WAIT );
   ownrhs_complete();
 }
 
 void
-ALECG::comrhs( const std::vector< std::size_t >& gid,
-               const std::vector< std::vector< tk::real > >& R )
+ALECG::comrhs( int c,
+               const std::vector< tk::real >& R,
+               const std::vector< float >& Rf )
 // *****************************************************************************
 //  Receive contributions to right-hand side vector on chare-boundaries
-//! \param[in] gid Global mesh node IDs at which we receive RHS contributions
-//! \param[in] R Partial contributions of RHS to chare-boundary nodes
+//! \param[in] c Sender chare id
+//! \param[in] R Partial contributions of RHS to chare-boundary nodes, all
+//!   components per node, in the order of Discretization::NodeCommLid()
+//! \param[in] Rf Same as R but in single precision, sent instead of R if
+//!   reduced precision node halo data is configured
 //! \details This function receives contributions to m_rhs, which stores the
 //!   right hand side vector at mesh nodes. While m_rhs stores own
 //!   contributions, m_rhsc collects the neighbor chare contributions during
@@ -887,11 +1389,9 @@ ALECG::comrhs( const std::vector< std::size_t >& gid,
 //!   are combined in solve().
 // *****************************************************************************
 {
-  Assert( R.size() == gid.size(), "Size mismatch" );
-
-  using tk::operator+=;
-
-  for (std::size_t i=0; i<gid.size(); ++i) m_rhsc[ gid[i] ] += R[i];
+  Disc()->Comm().received( MRHS, c, R, Rf );
+  if (Rf.empty()) m_rhsc[ c ] = R;
+  else m_rhsc[ c ].assign( begin(Rf), end(Rf) );
 
   // When we have heard from all chares we communicate with, this chare is done
   if (++m_nrhs == Disc()->NodeCommMap().size()) {
@@ -906,63 +1406,236 @@ ALECG::solve()
 //  Solve low and high order diagonal systems
 // *****************************************************************************
 {
-  const auto ncomp = m_rhs.nprop();
-
   auto d = Disc();
+  d->phase( SOLVE );
 
   // Combine own and communicated contributions to rhs
-  for (const auto& b : m_rhsc) {
-    auto lid = tk::cref_find( d->Lid(), b.first );
-    for (ncomp_t c=0; c<ncomp; ++c) m_rhs(lid,c,0) += b.second[c];
+  d->unpackNodeComm( m_rhsc, m_rhs );
+
+  // Continue with the Krylov solver in implicit time stepping
+  if (g_inputdeck.get< tag::discr, tag::implicit >()) {
+    krylov();
+    return;
   }
 
-  // clear receive buffer
-  tk::destroy(m_rhsc);
+  const auto steady = g_inputdeck.get< tag::discr, tag::steady_state >();
+
+  // Correct the solution by agglomeration multigrid before the first stage,
+  // then restart the stage with the corrected solution
+  if (steady && g_inputdeck.get< tag::discr, tag::multigrid >() &&
+      m_stage == 0 && !m_mgcorr)
+  {
+    m_mgcorr = 1;
+    mgcycle();
+    thisProxy[ thisIndex ].wait4grad();
+    thisProxy[ thisIndex ].wait4rhs();
+    grad();
+    return;
+  }
 
+  // Smooth the residual before the update, continuing in rksolve()
+  if (steady && g_inputdeck.get< tag::discr, tag::irs_sweeps >()) {
+    m_rhs0 = m_rhs;
+    irs();
+    return;
+  }
+
+  rksolve();
+}
+
+void
+ALECG::rksolve()
+// *****************************************************************************
+//  Solve the diagonal system of an explicit Runge-Kutta stage
+// *****************************************************************************
+{
+  const auto ncomp = m_rhs.nprop();
   const auto steady = g_inputdeck.get< tag::discr, tag::steady_state >();
+  auto d = Disc();
 
   // Set Dirichlet BCs for lhs and rhs
-  for (const auto& [b,bc] : m_bcdir)
+  for (std::size_t i=0; i<m_bcdir.size(); ++i) {
+    auto b = m_bcdir.node(i);
+    auto deltat = steady ? m_dtp[b] : d->Dt();
     for (ncomp_t c=0; c<ncomp; ++c)
-      if (bc[c].first) {
+      if (m_bcdir.set(i,c)) {
         m_lhs(b,c,0) = 1.0;
-        auto deltat = steady ? m_dtp[b] : d->Dt();
-        m_rhs(b,c,0) = bc[c].second / deltat / rkcoef[m_stage];
+        m_rhs(b,c,0) = m_bcdir.value(i,c) / deltat / rkcoef()[m_stage];
       }
+  }
 
   // Update Un
   if (m_stage == 0) m_un = m_u;
 
-  // Solve the sytem
-  if (steady) {
+  // Solve the sytem, shared among OpenMP threads (if enabled)
+  const auto npoin = static_cast< std::ptrdiff_t >( m_u.nunk() );
+  const auto rkc = rkcoef()[m_stage];
+  #pragma omp parallel for schedule(static)
+  for (std::ptrdiff_t ip=0; ip<npoin; ++ip) {
+    auto i = static_cast< std::size_t >( ip );
+    auto deltat = steady ? m_dtp[i] : d->Dt();
+    for (ncomp_t c=0; c<ncomp; ++c)
+      m_u(i,c,0) = m_un(i,c,0) + rkc * deltat * m_rhs(i,c,0) / m_lhs(i,c,0);
+  }
 
-    for (std::size_t i=0; i<m_u.nunk(); ++i)
-      for (ncomp_t c=0; c<m_u.nprop(); ++c)
-        m_u(i,c,0) = m_un(i,c,0)
-          + rkcoef[m_stage] * m_dtp[i] * m_rhs(i,c,0) / m_lhs(i,c,0);
+  update();
+}
 
-  } else {
+void
+ALECG::irs()
+// *****************************************************************************
+//  Advance implicit residual smoothing by a Jacobi sweep
+//! \details Implicit residual smoothing replaces the residual R, kept in
+//!   m_rhs0, by the approximate solution Rs in m_rhs of Rs - eps*L(Rs) = R,
+//!   with L the graph Laplacian over the mesh edges, by the Jacobi sweeps
+//!     Rs(p) <- [ R(p) + eps * sum_q Rs(q) ] / [ 1 + eps * deg(p) ],
+//!   summing over the points q surrounding point p. Each chare sums over its
+//!   own edges, weighing chare-boundary edges by the inverse of the number of
+//!   chares sharing them, see normfinal(), and the sums in chare-boundary
+//!   points are completed by fellow chares, see comirs(). The sweep is
+//!   finished in the next call, and the stage continues in rksolve() after
+//!   the last sweep.
+// *****************************************************************************
+{
+  const auto nsweep = g_inputdeck.get< tag::discr, tag::irs_sweeps >();
+  const auto eps = g_inputdeck.get< tag::discr, tag::irs_eps >();
+  const auto ncomp = m_rhs.nprop();
+  const auto npoin = m_rhs.nunk();
+  auto d = Disc();
+  d->phase( SOLVE );
+
+  // Finish the latest sweep, the last component of the sums is the degree
+  if (m_irs > 0) {
+    d->unpackNodeComm( m_irsc[ m_irs%2 ], m_rsm );
+    for (std::size_t p=0; p<npoin; ++p) {
+      auto f = 1.0 / (1.0 + eps * m_rsm(p,ncomp,0));
+      for (ncomp_t c=0; c<ncomp; ++c)
+        m_rhs(p,c,0) = (m_rhs0(p,c,0) + eps * m_rsm(p,c,0)) * f;
+    }
+  }
 
-    m_u = m_un + rkcoef[m_stage] * d->Dt() * m_rhs / m_lhs;
+  if (m_irs == nsweep) {
+    m_irs = 0;
+    rksolve();
+    return;
+  }
+  ++m_irs;
 
+  // Sum the current iterate over the points surrounding points in own edges
+  if (m_rsm.nunk() != npoin || m_rsm.nprop() != ncomp+1)
+    m_rsm = tk::Fields( npoin, ncomp+1 );
+  m_rsm.fill( 0.0 );
+  for (std::size_t e=0; e<m_edgenode.size()/2; ++e) {
+    auto p = m_edgenode[e*2+0];
+    auto q = m_edgenode[e*2+1];
+    auto w = m_irsw[e];
+    for (ncomp_t c=0; c<ncomp; ++c) {
+      m_rsm(p,c,0) += w * m_rhs(q,c,0);
+      m_rsm(q,c,0) += w * m_rhs(p,c,0);
+    }
+    m_rsm(p,ncomp,0) += w;
+    m_rsm(q,ncomp,0) += w;
   }
 
+  // Send sums in chare-boundary points to fellow chares
+  thisProxy[ thisIndex ].wait4irs();
+  if (d->NodeCommMap().empty())
+    comirs_complete();
+  else {
+    const auto reduced = g_inputdeck.get< tag::discr, tag::reducedhalo >();
+    std::vector< tk::real > r;
+    std::vector< float > rf;
+    for (const auto& [c,n] : d->NodeCommLid()) {
+      if (reduced)
+        d->Comm().rounded( MRHS, d->packNodeComm( c, m_rsm, rf ) );
+      else
+        d->packNodeComm( c, m_rsm, r );
+      d->Comm().sent( MRHS, c, thisIndex, r, rf );
+      thisProxy[c].comirs( thisIndex, m_irs, r, rf, msgopts( MRHS ) );
+    }
+    // Fellow chares may have finished their part of this sweep before us
+    auto& n = m_nirs[ m_irs%2 ];
+    if (n == d->NodeCommMap().size()) {
+      n = 0;
+      comirs_complete();
+    }
+  }
+
+  d->phase( WAIT );
+  ownirs_complete();
+}
+
+void
+ALECG::comirs( int c,
+               std::size_t sweep,
+               const std::vector< tk::real >& R,
+               const std::vector< float >& Rf )
+// *****************************************************************************
+//  Receive sums of implicit residual smoothing on chare-boundaries
+//! \param[in] c Sender chare id
+//! \param[in] sweep Sweep the sums belong to, counted from 1
+//! \param[in] R Partial sums over points surrounding chare-boundary points,
+//!   in the order of Discretization::NodeCommLid()
+//! \param[in] Rf Same as R but in single precision, sent instead of R if
+//!   reduced precision node halo data is configured
+//! \details Since a sweep takes a single round of communication, a fellow
+//!   chare may send the sums of the next sweep before we have heard from all
+//!   chares in the current one, so sums are buffered by the parity of the
+//!   sweep. Sums of a sweep ahead of ours are only complete after we have
+//!   started that sweep, see irs().
+// *****************************************************************************
+{
+  Disc()->Comm().received( MRHS, c, R, Rf );
+  auto& buf = m_irsc[ sweep%2 ][ c ];
+  if (Rf.empty()) buf = R;
+  else buf.assign( begin(Rf), end(Rf) );
+
+  auto& n = m_nirs[ sweep%2 ];
+  if (++n == Disc()->NodeCommMap().size() && sweep == m_irs) {
+    n = 0;
+    comirs_complete();
+  }
+}
+
+void
+ALECG::update()
+// *****************************************************************************
+//  Apply boundary conditions on the new solution and continue
+// *****************************************************************************
+{
+  auto d = Disc();
+
+  const auto steady = g_inputdeck.get< tag::discr, tag::steady_state >();
+
   // Apply symmetry BCs on initial conditions
   for (const auto& eq : g_cgpde)
-    eq.symbc( m_u, d->Coord(), m_bnorm, m_symbcnodes );
+    eq.symbc( m_u, d->Coord(), m_symbcnorm );
   // Apply farfield BCs on new solution
   for (const auto& eq : g_cgpde)
-    eq.farfieldbc( m_u, d->Coord(), m_bnorm, m_farfieldbcnodes );
-
-  // Set user-defined IC box conditions
-  for (const auto& eq : g_cgpde)
-    eq.box( d->Boxvol(), d->T()+d->Dt(), m_boxnodes, d->Coord(), m_u,
-            m_boxnodes_set );
-  //if (m_boxnodes_set.size() != m_boxnodes.size())
-  //  std::cout << thisIndex << ':' << m_boxnodes.size() - m_boxnodes_set.size() << '\n';
+    eq.farfieldbc( m_u, d->Coord(), m_farfieldbcnorm );
+
+  // Set user-defined IC box conditions, until all box nodes have been set
+  if (!m_boxstate.done())
+    for (const auto& eq : g_cgpde)
+      eq.box( d->Boxvol(), d->T()+d->Dt(), m_boxnodes, d->Coord(), m_u,
+              m_boxstate );
+
+  // Keep the solution of the first stage to estimate the local time error,
+  // with the increment of Dirichlet BCs unscaled, as the BC values are set
+  // in full by every stage, see solve()
+  if (m_stage == 0 && dtctl()) {
+    const auto c0 = rkcoef()[0];
+    m_u1 = m_u;
+    for (std::size_t i=0; i<m_bcdir.size(); ++i) {
+      auto b = m_bcdir.node(i);
+      for (ncomp_t c=0; c<m_u.nprop(); ++c)
+        if (m_bcdir.set(i,c))
+          m_u1(b,c,0) = m_un(b,c,0) + c0 * (m_u(b,c,0) - m_un(b,c,0));
+    }
+  }
 
   //! [Continue after solve]
-  if (m_stage < 2) {
+  if (m_stage+1 < rkcoef().size()) {
 
     // Activate SDAG wait for next time step stage
     thisProxy[ thisIndex ].wait4grad();
@@ -973,9 +1646,21 @@ ALECG::solve()
 
   } else {
 
-    // Compute diagnostics, e.g., residuals
-    auto diag_computed =
-      m_diag.compute( *d, m_u, m_un, m_bnorm, m_symbcnodes, m_farfieldbcnodes );
+    // Compute diagnostics, e.g., residuals, or keep them to be sent along
+    // with the next time step size
+    d->phase( DIAG );
+    auto diag_computed = false;
+    if (NodeDiagnostics::lagged())
+      m_diaglag =
+        m_diag.accumulate( *d, m_u, m_un, m_symbcnorm, m_farfieldbcnorm );
+    else
+      diag_computed =
+        m_diag.compute( *d, m_u, m_un, m_symbcnorm, m_farfieldbcnorm );
+    // Estimate the local time error of the step (if configured)
+    if (dtctl())
+      m_dterr = m_stepctl.error( m_u, m_un, m_u1, rkcoef()[0], m_u.nunk() );
+    // Add new solution to time averages (if configured)
+    m_stats.add( m_u, d->statsweight() );
     // Increase number of iterations and physical time
     d->next();
     // Advance physical time for local time stepping
@@ -987,6 +1672,388 @@ ALECG::solve()
   //! [Continue after solve]
 }
 
+void
+ALECG::mgsetup()
+// *****************************************************************************
+//  Generate the coarse levels of agglomeration multigrid
+//! \details Nodes along chare boundaries, the mesh boundary, and in IC boxes
+//!   are frozen: they are not agglomerated and receive no correction. This
+//!   keeps the correction independent of fellow chares, so coarse levels
+//!   require no communication, and leaves boundary conditions to the mesh.
+// *****************************************************************************
+{
+  auto d = Disc();
+  const auto& lid = d->Lid();
+
+  std::vector< char > frozen( m_u.nunk(), 0 );
+  for (auto i : d->BidLid())
+    if (i != std::numeric_limits< std::size_t >::max()) frozen[i] = 1;
+  for (auto p : m_triinpoel) frozen[p] = 1;
+  for (const auto& [s,nodes] : m_bnode)
+    for (auto g : nodes) {
+      auto i = lid.find( g );
+      if (i != end(lid)) frozen[ i->second ] = 1;
+    }
+  for (auto p : m_boxnodes) frozen[p] = 1;
+
+  m_mg.clear();
+  m_mg.push_back( tk::coarsen( d->Coord(), d->Vol(), m_edgenode, m_dfn,
+                               frozen ) );
+
+  // coarsen further until configured or no longer possible
+  auto nlevel = g_inputdeck.get< tag::discr, tag::mg_levels >();
+  while (m_mg.size() < nlevel) {
+    const auto& f = m_mg.back();
+    auto c = tk::coarsen( f.coord, f.vol, f.edgenode, f.dfn, f.frozen );
+    if (c.vol.size() == f.vol.size()) break;
+    m_mg.push_back( std::move(c) );
+  }
+}
+
+void
+ALECG::mgrhs( const tk::AggLevel& c,
+              const tk::Fields& U,
+              const tk::Fields& P,
+              tk::Fields& R ) const
+// *****************************************************************************
+//  Compute the right hand side of a coarse multigrid level
+//! \param[in] c Coarse level
+//! \param[in] U Solution at the coarse nodes
+//! \param[in] P Forcing term of the coarse level
+//! \param[out] R Right hand side of the coarse level: forcing plus the coarse
+//!   edge fluxes of all equations
+// *****************************************************************************
+{
+  R = P;
+  for (const auto& eq : g_cgpde)
+    eq.coarserhs( c.coord, c.edgenode, c.dfn, U, R );
+}
+
+void
+ALECG::mgcycle()
+// *****************************************************************************
+//  Correct the solution by a multigrid cycle on the coarse levels
+//! \details This is a full approximation storage (FAS) sawtooth cycle, using
+//!   the right hand side at the solution in m_rhs. Going down the levels, the
+//!   solution is restricted as a volume-weighted average and the right hand
+//!   side as a sum over the fine nodes of each coarse node. The forcing term
+//!   of a coarse level is the difference of the restricted fine right hand
+//!   side and the coarse right hand side at the restricted solution, so that
+//!   the coarse level reproduces the fine right hand side. Each coarse level
+//!   is smoothed by a three-stage Runge-Kutta step with local time steps,
+//!   after which its right hand side is restricted to the next level. Going up
+//!   the levels, the change of the solution at each level is injected to the
+//!   nodes of the level above it. Frozen coarse nodes are not updated, see
+//!   also mgsetup().
+// *****************************************************************************
+{
+  if (m_mg.empty()) mgsetup();
+
+  auto d = Disc();
+  const auto ncomp = m_u.nprop();
+  const auto nlevel = m_mg.size();
+
+  // restricted (initial) and smoothed solutions of the coarse levels
+  std::vector< tk::Fields > u0, u;
+  // right hand side: restricted at the finer level, then of the coarse level
+  tk::Fields r( m_rhs );
+  // local time steps of the finer level
+  auto dtf = m_dtp;
+
+  for (std::size_t l=0; l<nlevel; ++l) {
+    const auto& c = m_mg[l];
+    const auto& uf = l == 0 ? m_u : u.back();
+    const auto& vf = l == 0 ? d->Vol() : m_mg[l-1].vol;
+    const auto n = c.vol.size();
+
+    // restrict solution and right hand side
+    tk::Fields uc( n, ncomp ), rc( n, ncomp );
+    uc.fill( 0.0 );
+    rc.fill( 0.0 );
+    for (std::size_t p=0; p<uf.nunk(); ++p) {
+      auto i = c.map[p];
+      for (ncomp_t k=0; k<ncomp; ++k) {
+        uc(i,k,0) += vf[p] * uf(p,k,0);
+        rc(i,k,0) += r(p,k,0);
+      }
+    }
+    for (std::size_t i=0; i<n; ++i)
+      for (ncomp_t k=0; k<ncomp; ++k) uc(i,k,0) /= c.vol[i];
+
+    // local time steps of the coarse level: the smallest of the finer nodes,
+    // unless an equation computes its own
+    std::vector< tk::real > dtc( n, std::numeric_limits< tk::real >::max() );
+    for (std::size_t p=0; p<uf.nunk(); ++p)
+      dtc[ c.map[p] ] = std::min( dtc[ c.map[p] ], dtf[p] );
+    for (const auto& eq : g_cgpde) eq.dt( d->It(), c.vol, uc, dtc );
+    dtf = std::move( dtc );
+
+    // forcing term, so the coarse right hand side at the restricted solution
+    // is the restricted right hand side
+    tk::Fields P( n, ncomp );
+    P.fill( 0.0 );
+    mgrhs( c, uc, P, r );
+    P = rc - r;
+    r = rc;
+
+    // smooth
+    u0.push_back( uc );
+    const auto& rk = rkcoef();
+    for (std::size_t s=0; s<rk.size(); ++s) {
+      if (s > 0) mgrhs( c, uc, P, r );
+      for (std::size_t i=0; i<n; ++i)
+        if (!c.frozen[i])
+          for (ncomp_t k=0; k<ncomp; ++k)
+            uc(i,k,0) = u0.back()(i,k,0)
+                      + rk[s] * dtf[i] * r(i,k,0) / c.vol[i];
+    }
+    u.push_back( std::move(uc) );
+
+    // right hand side of the coarse level after smoothing
+    mgrhs( c, u.back(), P, r );
+  }
+
+  // prolong corrections by injection from the coarsest level up to the mesh
+  for (std::size_t l=nlevel; l-->0; ) {
+    const auto& c = m_mg[l];
+    auto& uf = l == 0 ? m_u : u[l-1];
+    for (std::size_t p=0; p<uf.nunk(); ++p) {
+      auto i = c.map[p];
+      if (c.frozen[i]) continue;
+      for (ncomp_t k=0; k<ncomp; ++k)
+        uf(p,k,0) += u[l](i,k,0) - u0[l](i,k,0);
+    }
+  }
+}
+
+tk::real
+ALECG::dinv( std::size_t i, ncomp_t c ) const
+// *****************************************************************************
+//  Inverse of the diagonal preconditioner of implicit time stepping at a mesh
+//  node for a scalar component
+//! \param[in] i Local mesh node id
+//! \param[in] c Scalar component index
+//! \return Time step size divided by the lumped mass matrix entry
+// *****************************************************************************
+{
+  const auto steady = g_inputdeck.get< tag::discr, tag::steady_state >();
+  auto deltat = steady ? m_dtp[i] : Disc()->Dt();
+  return deltat / m_lhs(i,c,0);
+}
+
+tk::real
+ALECG::owndot( const tk::Fields& a, const tk::Fields& b, bool precond ) const
+// *****************************************************************************
+//  Contribution of this chare to the dot product of two nodal fields
+//! \param[in] a First nodal field
+//! \param[in] b Second nodal field
+//! \param[in] precond True to apply the inverse of the diagonal preconditioner
+//!   on both fields
+//! \return Sum of the products over the mesh nodes owned by this chare
+//! \details Summing the contributions of all chares, e.g., via a reduction,
+//!   yields the dot product across the whole problem, counting chare-boundary
+//!   nodes only once.
+// *****************************************************************************
+{
+  Assert( a.nunk() == m_own.size() && b.nunk() == m_own.size(),
+          "Size mismatch" );
+  tk::real s = 0.0;
+  for (std::size_t i=0; i<a.nunk(); ++i)
+    for (ncomp_t c=0; c<a.nprop(); ++c) {
+      auto p = a(i,c,0) * b(i,c,0) * m_own[i];
+      if (precond) p *= dinv(i,c) * dinv(i,c);
+      s += p;
+    }
+  return s;
+}
+
+void
+ALECG::krylov()
+// *****************************************************************************
+//  Continue the Krylov solve after evaluating the right hand side
+//! \details Implicit time stepping does a single Newton iteration of the
+//!   backward-Euler discretization, M/dt du - J du = R(u), where M is the
+//!   lumped mass matrix, dt is the (local or global) time step size, R(u)
+//!   is the right hand side at the current solution, and J is its Jacobian.
+//!   The linear system is solved by GMRES, right-preconditioned with the
+//!   diagonal D=M/dt, i.e., (I - J D^{-1}) z = R(u) with du = D^{-1} z, and
+//!   the Jacobian is never formed: its product with a vector v is
+//!   approximated by [R(u + eps D^{-1} v) - R(u)] / eps. Each GMRES iteration
+//!   thus costs one right hand side evaluation (including its communication)
+//!   and two reductions with the dot products of the Arnoldi process.
+//!   At Dirichlet BC nodes the system is replaced by the identity prescribing
+//!   the BC increment. This function is called after every right hand side
+//!   evaluation: if m_kit = 0, m_rhs is R(u) and the Krylov solve starts,
+//!   otherwise m_rhs is evaluated at the solution perturbed along the latest
+//!   Krylov vector, yielding the next one.
+// *****************************************************************************
+{
+  auto d = Disc();
+  const auto ncomp = m_rhs.nprop();
+
+  if (m_kit == 0) {
+
+    const auto maxit = g_inputdeck.get< tag::discr, tag::krylov_maxit >();
+
+    // Mesh nodes owned by this chare: the chare with the lowest id among the
+    // ones sharing a node (the mesh may have changed since the last step)
+    m_own.assign( m_u.nunk(), 1.0 );
+    for (const auto& [c,n] : d->NodeCommMap())
+      if (thisIndex > c)
+        for (auto g : n) m_own[ tk::cref_find( d->Lid(), g ) ] = 0.0;
+
+    // Store current solution and right hand side at current solution
+    m_un = m_u;
+    m_res = m_rhs;
+
+    // Right hand side of the linear system, prescribe BC increments
+    m_krylov.resize( maxit + 1 );
+    auto& b = m_krylov[0];
+    b = m_rhs;
+    for (std::size_t j=0; j<m_bcdir.size(); ++j) {
+      auto i = m_bcdir.node(j);
+      for (ncomp_t c=0; c<ncomp; ++c)
+        if (m_bcdir.set(j,c)) b(i,c,0) = m_bcdir.value(j,c) / dinv(i,c);
+    }
+
+    // Contribute to the norms of the right hand side and the solution
+    std::vector< tk::real > r{ owndot(b,b), owndot(b,b,true), owndot(m_u,m_u) };
+    contribute( r, CkReduction::sum_double,
+                CkCallback(CkReductionTarget(ALECG,krylovnorm), thisProxy) );
+
+  } else {
+
+    // Apply operator to the latest Krylov vector via finite differences
+    const auto& v = m_krylov[ m_kit-1 ];
+    auto& w = m_krylov[ m_kit ];
+    w = v;
+    for (std::size_t i=0; i<w.nunk(); ++i)
+      for (ncomp_t c=0; c<ncomp; ++c)
+        w(i,c,0) -= (m_rhs(i,c,0) - m_res(i,c,0)) / m_keps;
+    for (std::size_t j=0; j<m_bcdir.size(); ++j) {
+      auto i = m_bcdir.node(j);
+      for (ncomp_t c=0; c<ncomp; ++c)
+        if (m_bcdir.set(j,c)) w(i,c,0) = v(i,c,0);
+    }
+
+    // Contribute to the dot products with all previous Krylov vectors
+    std::vector< tk::real > h( m_kit );
+    for (std::size_t k=0; k<m_kit; ++k) h[k] = owndot( w, m_krylov[k] );
+    contribute( h, CkReduction::sum_double,
+                CkCallback(CkReductionTarget(ALECG,krylovdot), thisProxy) );
+
+  }
+}
+
+void
+ALECG::krylovdot( [[maybe_unused]] int n, tk::real* h )
+// *****************************************************************************
+//  Orthogonalize the latest Krylov vector in implicit time stepping
+//! \param[in] n Number of dot products
+//! \param[in] h Dot products of the latest Krylov vector with all previous
+//!   ones across the whole problem
+// *****************************************************************************
+{
+  Assert( static_cast< std::size_t >( n ) == m_kit, "Size mismatch" );
+
+  m_hcol.assign( h, h+m_kit );
+
+  auto& w = m_krylov[ m_kit ];
+  for (std::size_t k=0; k<m_kit; ++k) {
+    const auto& v = m_krylov[k];
+    for (std::size_t i=0; i<w.nunk(); ++i)
+      for (ncomp_t c=0; c<w.nprop(); ++c)
+        w(i,c,0) -= m_hcol[k] * v(i,c,0);
+  }
+
+  // Contribute to the norm of the orthogonalized Krylov vector
+  std::vector< tk::real > r{ owndot(w,w), owndot(w,w,true) };
+  contribute( r, CkReduction::sum_double,
+              CkCallback(CkReductionTarget(ALECG,krylovnorm), thisProxy) );
+}
+
+void
+ALECG::krylovnorm( [[maybe_unused]] int n, tk::real* r )
+// *****************************************************************************
+//  Continue implicit time stepping after the norm of a Krylov vector
+//! \param[in] n Number of norms
+//! \param[in] r Squared norms of the latest Krylov vector across the whole
+//!   problem: r[0] L2 norm, r[1] L2 norm after applying the inverse of the
+//!   preconditioner, and if this is the first Krylov vector, r[2] L2 norm of
+//!   the current solution.
+//! \details If GMRES has converged, or the maximum number of iterations has
+//!   been reached, the time step is finished, otherwise the right hand side is
+//!   evaluated at the solution perturbed along the new Krylov vector.
+// *****************************************************************************
+{
+  Assert( n == (m_kit == 0 ? 3 : 2), "Size mismatch" );
+
+  const auto maxit = g_inputdeck.get< tag::discr, tag::krylov_maxit >();
+  const auto tol = g_inputdeck.get< tag::discr, tag::krylov_tol >();
+  const auto eps = std::numeric_limits< tk::real >::epsilon();
+
+  auto hnext = std::sqrt( r[0] );
+  if (m_kit == 0) {
+    m_unorm = std::sqrt( r[2] );
+    m_arnoldi.start( hnext );
+    // nothing to solve if the right hand side is zero
+    if (hnext < eps) { krylovsol(); return; }
+  } else {
+    auto res = m_arnoldi.add( m_hcol, hnext );
+    // finish if converged, reached the maximum size of the Krylov subspace,
+    // or the new Krylov vector vanished (the solution is in the subspace)
+    if (res <= tol * m_arnoldi.beta() || m_kit == maxit ||
+        hnext <= eps * m_arnoldi.beta())
+    {
+      krylovsol();
+      return;
+    }
+  }
+
+  // Normalize the new Krylov vector
+  auto& v = m_krylov[ m_kit ];
+  for (std::size_t i=0; i<v.nunk(); ++i)
+    for (ncomp_t c=0; c<v.nprop(); ++c)
+      v(i,c,0) /= hnext;
+
+  // Perturb the solution along the new Krylov vector
+  m_keps = std::sqrt( eps * (1.0 + m_unorm) ) * hnext / std::sqrt( r[1] );
+  for (std::size_t i=0; i<m_u.nunk(); ++i)
+    for (ncomp_t c=0; c<m_u.nprop(); ++c)
+      m_u(i,c,0) = m_un(i,c,0) + m_keps * dinv(i,c) * v(i,c,0);
+
+  ++m_kit;
+
+  // Activate SDAG waits and evaluate the right hand side
+  thisProxy[ thisIndex ].wait4grad();
+  thisProxy[ thisIndex ].wait4rhs();
+  grad();
+}
+
+void
+ALECG::krylovsol()
+// *****************************************************************************
+//  Finish implicit time step with the Krylov solution
+// *****************************************************************************
+{
+  // Form the solution increment from the Krylov basis
+  auto y = m_arnoldi.solve();
+  m_u = m_un;
+  for (std::size_t k=0; k<y.size(); ++k) {
+    const auto& v = m_krylov[k];
+    for (std::size_t i=0; i<m_u.nunk(); ++i)
+      for (ncomp_t c=0; c<m_u.nprop(); ++c)
+        m_u(i,c,0) += y[k] * dinv(i,c) * v(i,c,0);
+  }
+
+  m_kit = 0;
+
+  // Implicit time stepping has a single stage
+  m_stage = rkcoef().size() - 1;
+
+  update();
+}
+
 void
 ALECG::refine( const std::vector< tk::real >& l2res )
 // *****************************************************************************
@@ -997,6 +2064,7 @@ ALECG::refine( const std::vector< tk::real >& l2res )
 {
   //! [Refine]
   auto d = Disc();
+  d->phase( AMR );
 
   const auto nstep = g_inputdeck.get< tag::discr, tag::nstep >();
   const auto term = g_inputdeck.get< tag::discr, tag::term >();
@@ -1049,7 +2117,8 @@ ALECG::resizePostAMR(
   const tk::UnsMesh::Chunk& chunk,
   const tk::UnsMesh::Coords& coord,
   const std::unordered_map< std::size_t, tk::UnsMesh::Edge >& addedNodes,
-  const std::unordered_map< std::size_t, std::size_t >& /*addedTets*/,
+  const tk::CellFamilies& /*families*/,
+  const std::vector< std::size_t >& changedNodes,
   const tk::NodeCommMap& nodeCommMap,
   const std::map< int, std::vector< std::size_t > >& bface,
   const std::map< int, std::vector< std::size_t > >& bnode,
@@ -1060,46 +2129,75 @@ ALECG::resizePostAMR(
 //! \param[in] chunk New mesh chunk (connectivity and global<->local id maps)
 //! \param[in] coord New mesh node coordinates
 //! \param[in] addedNodes Newly added mesh nodes and their parents (local ids)
-//! \param[in] addedTets Newly added mesh cells and their parents (local ids)
+//! \param[in] families Cell families relating old and new mesh cells
+//! \param[in] changedNodes Nodes of cells added by refinement/derefinement
 //! \param[in] nodeCommMap New node communication map
 //! \param[in] bface Boundary-faces mapped to side set ids
 //! \param[in] bnode Boundary-node lists mapped to side set ids
 //! \param[in] triinpoel Boundary-face connectivity
 // *****************************************************************************
 {
+  tk::Timer t;
   auto d = Disc();
 
   // Set flag that indicates that we are during time stepping
   m_initial = 0;
 
-  // Zero field output iteration count between two mesh refinement steps
+  // Zero field output iteration counts between two mesh refinement steps
   d->Itf() = 0;
+  d->Itsf() = 0;
 
   // Increase number of iterations with mesh refinement
   ++d->Itr();
 
+  // Save global ids of the old mesh
+  const auto oldgid = d->Gid();
+
   // Resize mesh data structures
   d->resizePostAMR( chunk, coord, nodeCommMap );
 
-  // Resize auxiliary solution vectors
+  // Generate old->new local id map for nodes kept
+  const auto& lid = d->Lid();
+  std::vector< std::size_t > map( oldgid.size() );
+  for (std::size_t p=0; p<oldgid.size(); ++p) {
+    auto it = lid.find( oldgid[p] );
+    map[p] = it != end(lid) ? it->second
+                            : std::numeric_limits< std::size_t >::max();
+  }
+
+  // Update derived data structures, regenerating points surrounding points
+  // only for nodes whose surrounding elements have changed
+  m_esup = tk::genEsup( d->Inpoel(), 4 );
+  m_psup = tk::updatePsup( d->Inpoel(), 4, m_esup, m_psup, map, changedNodes );
+  m_bndel = bndel();
+
+  // Store nodes whose dual-face normals must be recomputed
+  m_changedNodes = changedNodes;
+
+  // Move the solution of the nodes kept to their new local ids and resize
+  // auxiliary solution vectors
   auto npoin = coord[0].size();
   auto nprop = m_u.nprop();
-  m_u.resize( npoin, nprop );
+  m_u.remap( map, npoin );
   m_un.resize( npoin, nprop );
   m_lhs.resize( npoin, nprop );
   m_rhs.resize( npoin, nprop );
   m_grad.resize( d->Bid().size(), nprop*3 );
 
+  // Start time averages over on the new mesh
+  m_stats.reset( npoin );
+
   // Update solution on new mesh
-  for (const auto& n : addedNodes)
-    for (std::size_t c=0; c<nprop; ++c)
-      m_u(n.first,c,0) = (m_u(n.second[0],c,0) + m_u(n.second[1],c,0))/2.0;
+  tk::transfer( addedNodes, m_u );
 
   // Update physical-boundary node-, face-, and element lists
   m_bnode = bnode;
   m_bface = bface;
   m_triinpoel = tk::remap( triinpoel, d->Lid() );
 
+  // Record cost of solution transfer for load balancing
+  d->addCost( t.dsec() );
+
   contribute( CkCallback(CkReductionTarget(Transporter,resized), d->Tr()) );
 }
 //! [Resize]
@@ -1124,13 +2222,15 @@ ALECG::stage()
 
   // if not all Runge-Kutta stages complete, continue to next time stage,
   // otherwise output field data to file(s)
-  if (m_stage < 3) grad(); else out();
+  if (m_stage < rkcoef().size()) grad(); else out();
 }
 
 void
-ALECG::writeFields( CkCallback c ) const
+ALECG::writeFields( bool volume, CkCallback c ) const
 // *****************************************************************************
 // Output mesh-based fields to file
+//! \param[in] volume True to output the volume fields, false to only output
+//!   the surface fields, see Discretization::surfdue()
 //! \param[in] c Function to continue with after the write
 // *****************************************************************************
 {
@@ -1153,28 +2253,88 @@ ALECG::writeFields( CkCallback c ) const
     }
 
     // Collect node block and surface field solution
-    auto u = m_u;
     std::vector< std::vector< tk::real > > nodefields;
     std::vector< std::vector< tk::real > > nodesurfs;
     for (const auto& eq : g_cgpde) {
-      auto o = eq.fieldOutput( d->T(), d->meshvol(), d->Coord()[0].size(),
-                               d->Coord(), d->V(), u );
-      nodefields.insert( end(nodefields), begin(o), end(o) );
-      auto s = eq.surfOutput( tk::bfacenodes(m_bface,m_triinpoel), u );
+      if (volume) {
+        auto o = eq.fieldOutput( d->T(), d->meshvol(), d->Coord()[0].size(),
+                                 d->Coord(), d->V(), m_u );
+        nodefields.insert( end(nodefields),
+                           std::make_move_iterator( begin(o) ),
+                           std::make_move_iterator( end(o) ) );
+      }
+      auto s = eq.surfOutput( tk::bfacenodes(m_bface,m_triinpoel), m_u );
       nodesurfs.insert( end(nodesurfs), begin(s), end(s) );
     }
 
+    // Send surface fields only for output to file
+    if (!volume) {
+      d->write( false, {}, d->Coord(), m_bface, {}, m_triinpoel, {}, {},
+                nodesurfnames, {}, {}, nodesurfs, c );
+      return;
+    }
+
     // nodefieldnames.push_back( "initiated" );
     // std::vector< tk::real > initiated( m_u.nunk(), 0.0 );
-    // for (auto i : m_boxnodes_set) initiated[i] = 1.0;
+    // for (std::size_t b=0; b<m_boxnodes.size(); ++b)
+    //   if (m_boxstate.isset(b)) initiated[m_boxnodes[b]] = 1.0;
     // nodefields.push_back( initiated );
 
+    // Add time averages and second moments of the solution
+    if (!m_stats.empty()) {
+      std::vector< std::string > var;
+      for (const auto& eq : g_cgpde) {
+        auto n = eq.names();
+        var.insert( end(var), begin(n), end(n) );
+      }
+      auto n = m_stats.names( var );
+      nodefieldnames.insert( end(nodefieldnames), begin(n), end(n) );
+      auto f = m_stats.fields();
+      nodefields.insert( end(nodefields), begin(f), end(f) );
+    }
+
     Assert( nodefieldnames.size() == nodefields.size(), "Size mismatch" );
 
     // Send mesh and fields data (solution dump) for output to file
-    d->write( d->Inpoel(), d->Coord(), m_bface, tk::remap(m_bnode,d->Lid()),
-              m_triinpoel, {}, nodefieldnames, nodesurfnames, {}, nodefields,
-              nodesurfs, c );
+    d->write( true, d->Inpoel(), d->Coord(), m_bface,
+              tk::remap(m_bnode,d->Lid()), m_triinpoel, {}, nodefieldnames,
+              nodesurfnames, {}, nodefields, nodesurfs, c );
+
+  }
+}
+
+void
+ALECG::writeSlices( CkCallback c ) const
+// *****************************************************************************
+// Output slices and iso-surfaces of mesh-based fields to files
+//! \param[in] c Function to continue with after the write
+// *****************************************************************************
+{
+  if (g_inputdeck.get< tag::cmd, tag::benchmark >()) {
+
+    c.send();
+
+  } else {
+
+    auto d = Disc();
+
+    // Query and collect node field names and solution from PDEs integrated
+    std::vector< std::string > nodefieldnames;
+    std::vector< std::vector< tk::real > > nodefields;
+    for (const auto& eq : g_cgpde) {
+      auto n = eq.fieldNames();
+      nodefieldnames.insert( end(nodefieldnames), begin(n), end(n) );
+      auto o = eq.fieldOutput( d->T(), d->meshvol(), d->Coord()[0].size(),
+                               d->Coord(), d->V(), m_u );
+      nodefields.insert( end(nodefields),
+                         std::make_move_iterator( begin(o) ),
+                         std::make_move_iterator( end(o) ) );
+    }
+
+    Assert( nodefieldnames.size() == nodefields.size(), "Size mismatch" );
+
+    // Extract slices and send them for output to file
+    d->slices( m_u, nodefieldnames, nodefields, c );
 
   }
 }
@@ -1186,6 +2346,7 @@ ALECG::out()
 // *****************************************************************************
 {
   auto d = Disc();
+  d->phase( OUTPUT );
 
   // Output time history if we hit its output frequency
   const auto histfreq = g_inputdeck.get< tag::interval, tag::history >();
@@ -1198,21 +2359,40 @@ ALECG::out()
     d->history( std::move(hist) );
   }
 
+  // Output slices and iso-surfaces if we hit their output frequency
+  if (d->slicedue())
+    writeSlices( CkCallback(CkIndex_ALECG::outfields(), thisProxy[thisIndex]) );
+  else
+    outfields();
+}
+
+void
+ALECG::outfields()
+// *****************************************************************************
+// Output volume and surface field data
+// *****************************************************************************
+{
+  auto d = Disc();
+
   const auto fieldfreq = g_inputdeck.get< tag::interval, tag::field >();
 
   // output field data if field iteration count is reached or in the last time
-  // step
-  if ( !((d->It()) % fieldfreq) || m_finished )
-    writeFields( CkCallback(CkIndex_ALECG::step(), thisProxy[thisIndex]) );
+  // step, and surface field data only if their own iteration count is reached
+  const auto volume = !((d->It()) % fieldfreq) || m_finished;
+  if (volume || d->surfdue())
+    writeFields( volume,
+                 CkCallback(CkIndex_ALECG::step(), thisProxy[thisIndex]) );
   else
     step();
 }
 
 void
-ALECG::evalLB( int nrestart )
+ALECG::evalLB( int nrestart, int lb )
 // *****************************************************************************
 // Evaluate whether to do load balancing
 //! \param[in] nrestart Number of times restarted
+//! \param[in] lb If nonzero, do load balancing regardless of the frequency,
+//!   set if the load imbalance after mesh refinement exceeds its threshold
 // *****************************************************************************
 {
   auto d = Disc();
@@ -1224,11 +2404,21 @@ ALECG::evalLB( int nrestart )
   const auto lbfreq = g_inputdeck.get< tag::cmd, tag::lbfreq >();
   const auto nonblocking = g_inputdeck.get< tag::cmd, tag::nonblocking >();
 
-  // Load balancing if user frequency is reached or after the second time-step
-  if ( (d->It()) % lbfreq == 0 || d->It() == 2 ) {
+  // Restarted on a different number of PEs than checkpointed: the chares
+  // are where the restart has put them, so rebalance before the next step
+  const auto newpes = d->newpes();
 
-    AtSync();
-    if (nonblocking) next();
+  // Load balancing if user frequency is reached, after the second time-step,
+  // or if requested after mesh refinement
+  if ( (d->It()) % lbfreq == 0 || d->It() == 2 || lb || newpes ) {
+
+    if (newpes || g_inputdeck.get< tag::discr, tag::costlb >()) {
+      // Balance load by solver-measured costs, continue in next()
+      d->commgraph( 1 );
+    } else {
+      AtSync();
+      if (nonblocking) next();
+    }
 
   } else {
 
@@ -1246,17 +2436,30 @@ ALECG::evalRestart()
   auto d = Disc();
 
   const auto rsfreq = g_inputdeck.get< tag::cmd, tag::rsfreq >();
+  const auto memfreq = g_inputdeck.get< tag::cmd, tag::memfreq >();
   const auto benchmark = g_inputdeck.get< tag::cmd, tag::benchmark >();
 
   if ( !benchmark && (d->It()) % rsfreq == 0 ) {
 
     int finished = 0;
+    d->checkpointing();
     d->contribute( sizeof(int), &finished, CkReduction::nop,
       CkCallback(CkReductionTarget(Transporter,checkpoint), d->Tr()) );
 
+  } else if ( !benchmark && memfreq > 0 && d->It() % memfreq == 0 ) {
+
+    d->contribute(
+      CkCallback(CkReductionTarget(Transporter,memcheckpoint), d->Tr()) );
+
+  } else if (d->refined() &&
+             g_inputdeck.get< tag::amr, tag::lbimbalance >() > 0.0) {
+
+    // Evaluate load imbalance after mesh refinement, continue in evalLB()
+    d->imbalance();
+
   } else {
 
-    evalLB( /* nrestart = */ -1 );
+    evalLB( /* nrestart = */ -1, /* lb = */ 0 );
 
   }
 }
@@ -1268,11 +2471,14 @@ ALECG::step()
 // *****************************************************************************
 {
   auto d = Disc();
+  d->phase( OTHER );
 
   // Output one-liner status report to screen
   d->status();
   // Reset Runge-Kutta stage counter
   m_stage = 0;
+  // Reset multigrid correction flag
+  m_mgcorr = 0;
 
   if (not m_finished) {
 
@@ -1280,7 +2486,15 @@ ALECG::step()
 
   } else {
 
-    d->contribute( CkCallback(CkReductionTarget(Transporter,finish), d->Tr()) );
+    d->checkpointing();
+    // Send diagnostics of the last step (if lagged), which then finishes
+    if (!m_diaglag.empty()) {
+      m_diag.finish( *d, std::move(m_diaglag) );
+      m_diaglag.clear();
+    } else {
+      d->contribute(
+        CkCallback(CkReductionTarget(Transporter,finish), d->Tr()) );
+    }
 
   }
 }
@@ -24,15 +24,24 @@
 #ifndef ALECG_h
 #define ALECG_h
 
+#include <array>
 #include <vector>
 #include <map>
 
 #include "QuinoaConfig.hpp"
 #include "Types.hpp"
 #include "Fields.hpp"
+#include "Arnoldi.hpp"
+#include "StepControl.hpp"
+#include "Agglomerate.hpp"
 #include "DerivedData.hpp"
+#include "BndNodeNormals.hpp"
+#include "Integrate/Transfer.hpp"
 #include "FluxCorrector.hpp"
+#include "NodeBC.hpp"
+#include "ICBoxState.hpp"
 #include "NodeDiagnostics.hpp"
+#include "CGPDE.hpp"
 #include "Inciter/InputDeck/InputDeck.hpp"
 
 #include "NoWarning/alecg.decl.h"
@@ -85,9 +94,6 @@ class ALECG : public CBase_ALECG {
       #pragma clang diagnostic pop
     #endif
 
-    //! Configure Charm++ custom reduction types initiated from this chare array
-    static void registerReducers();
-
     //! Return from migration
     void ResumeFromSync() override;
 
@@ -106,36 +112,50 @@ class ALECG : public CBase_ALECG {
     // Start time stepping
     void start();
 
+    //! Group mesh nodes into time step size levels and report them
+    void dtlevels( tk::real mindt );
+
     //! Advance equations to next time step
     void advance( tk::real newdt );
 
+    //! Receive the global minimum of the time step size computed in the
+    //! background with lagged time step sizes
+    void laggeddt( tk::real newdt );
+
+    //! Orthogonalize the latest Krylov vector in implicit time stepping
+    void krylovdot( int n, tk::real* h );
+
+    //! Continue implicit time stepping after the norm of a Krylov vector
+    void krylovnorm( int n, tk::real* r );
+
     //! Compute left-hand side of transport equations
     void lhs();
 
     //! Receive contributions to duual-face normals on chare boundaries
-    void comdfnorm(
-      const std::unordered_map< tk::UnsMesh::Edge,
-              std::array< tk::real, 3 >,
-              tk::UnsMesh::Hash<2>, tk::UnsMesh::Eq<2> >& dfnorm );
+    void comdfnorm( int fromch, const std::vector< tk::real >& dfnorm );
 
     //! Receive boundary point normals on chare-boundaries
     void comnorm( const std::unordered_map< int,
       std::unordered_map< std::size_t, std::array< tk::real, 4 > > >& innorm );
 
     //! Receive contributions to left-hand side matrix on chare-boundaries
-    void comlhs( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& L );
+    void comlhs( int c, const std::vector< tk::real >& L );
 
     //! Receive contributions to gradients on chare-boundaries
-    void comgrad( const std::vector< std::size_t >& gid,
-                  const std::vector< std::vector< tk::real > >& G );
+    void comgrad( int c,
+                  const std::vector< tk::real >& G,
+                  const std::vector< float >& Gf );
 
     //! Receive contributions to right-hand side vector on chare-boundaries
-    void comrhs( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& R );
+    void comrhs( int c,
+                 const std::vector< tk::real >& R,
+                 const std::vector< float >& Rf );
 
-    //! Update solution at the end of time step
-    void update( const tk::Fields& a );
+    //! Receive sums of implicit residual smoothing on chare-boundaries
+    void comirs( int c,
+                 std::size_t sweep,
+                 const std::vector< tk::real >& R,
+                 const std::vector< float >& Rf );
 
     //! Optionally refine/derefine mesh
     void refine( const std::vector< tk::real >& l2res );
@@ -146,7 +166,8 @@ class ALECG : public CBase_ALECG {
       const tk::UnsMesh::Chunk& chunk,
       const tk::UnsMesh::Coords& coord,
       const std::unordered_map< std::size_t, tk::UnsMesh::Edge >& addedNodes,
-      const std::unordered_map< std::size_t, std::size_t >& addedTets,
+      const tk::CellFamilies& families,
+      const std::vector< std::size_t >& changedNodes,
       const tk::NodeCommMap& nodeCommMap,
       const std::map< int, std::vector< std::size_t > >& /* bface */,
       const std::map< int, std::vector< std::size_t > >& bnode,
@@ -159,11 +180,14 @@ class ALECG : public CBase_ALECG {
     //! Resizing data sutrctures after mesh refinement has been completed
     void resized();
 
+    //! Output volume and surface field data after slices
+    void outfields();
+
     //! Evaluate whether to continue with next time step
     void step();
 
     // Evaluate whether to do load balancing
-    void evalLB( int nrestart );
+    void evalLB( int nrestart, int lb );
 
     //! Continue to next time step
     void next();
@@ -187,7 +211,9 @@ class ALECG : public CBase_ALECG {
       p | m_bndel;
       p | m_dfnorm;
       p | m_dfnormc;
+      p | m_dfnedge;
       p | m_dfn;
+      p | m_changedNodes;
       p | m_esup;
       p | m_psup;
       p | m_u;
@@ -200,19 +226,36 @@ class ALECG : public CBase_ALECG {
       p | m_gradc;
       p | m_rhsc;
       p | m_diag;
+      p | m_diaglag;
+      p | m_stats;
       p | m_bnorm;
       p | m_bnormc;
       p | m_symbcnodes;
       p | m_farfieldbcnodes;
+      p | m_symbcnorm;
+      p | m_farfieldbcnorm;
       p | m_symbctri;
       p | m_stage;
       p | m_boxnodes;
-      p | m_boxnodes_set;
+      p | m_boxstate;
       p | m_edgenode;
       p | m_edgeid;
+      p | m_rhspart;
       p | m_dtp;
       p | m_tp;
       p | m_finished;
+      p | m_kit;
+      p | m_mgcorr;
+      p | m_dtlag;
+      p | m_dtlocal;
+      p | m_dtpending;
+      p | m_dtwait;
+      p | m_stepctl;
+      p | m_dterr;
+      p | m_irs;
+      p | m_nirs;
+      p | m_irsc;
+      p | m_irsw;
     }
     //! \brief Pack/Unpack serialize operator|
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
@@ -223,6 +266,10 @@ class ALECG : public CBase_ALECG {
   private:
     using ncomp_t = kw::ncomp::info::expect::type;
 
+    //! \brief Wall-clock time stamp at the start of the setup phase timed,
+    //!   declared first to also time the derived data generated in the
+    //!   initializer list, not migrated since only used during setup
+    tk::real m_setupt0;
     //! Discretization proxy
     CProxy_Discretization m_disc;
     //! 1 if starting time stepping, 0 if during time stepping
@@ -250,11 +297,18 @@ class ALECG : public CBase_ALECG {
     //! Dual-face normals along edges
     std::unordered_map< tk::UnsMesh::Edge, std::array< tk::real, 3 >,
                         tk::UnsMesh::Hash<2>, tk::UnsMesh::Eq<2> > m_dfnorm;
-    //! Receive buffer for dual-face normals along chare-boundary edges
-    std::unordered_map< tk::UnsMesh::Edge, std::array< tk::real, 3 >,
-                     tk::UnsMesh::Hash<2>, tk::UnsMesh::Eq<2> > m_dfnormc;
+    //! \brief Receive buffer for dual-face normals along chare-boundary edges
+    //!   per neighbor chare, 3 reals per edge in the order of m_dfnedge
+    std::unordered_map< int, std::vector< tk::real > > m_dfnormc;
+    //! \brief Edge ids of chare-boundary edges per neighbor chare, in the
+    //!   order of their sorted global ids in which dual-face normals are
+    //!   exchanged
+    std::unordered_map< int, std::vector< std::size_t > > m_dfnedge;
     //! Streamable dual-face normals
     std::vector< tk::real > m_dfn;
+    //! \brief Nodes whose surrounding elements changed during the last mesh
+    //!   refinement step (local ids)
+    std::vector< std::size_t > m_changedNodes;
     //! El;ements surrounding points
     std::pair< std::vector< std::size_t >, std::vector< std::size_t > > m_esup;
     //! Points surrounding points
@@ -264,31 +318,33 @@ class ALECG : public CBase_ALECG {
     //! Unknown/solution vector at mesh nodes at previous time
     tk::Fields m_un;
     //! Lumped lhs mass matrix
-    tk::Fields m_lhs;
+    tk::ReducedFields m_lhs;
     //! Right-hand side vector (for the high order system)
     tk::Fields m_rhs;
     //! Nodal gradients
     tk::Fields m_grad;
-    //! Boundary conditions evaluated and assigned to local mesh node IDs
-    //! \details Vector of pairs of bool and boundary condition value associated
-    //!   to local mesh node IDs at which the user has set Dirichlet boundary
-    //!   conditions for all PDEs integrated. The bool indicates whether the BC
-    //!   is set at the node for that component the if true, the real value is
-    //!   the increment (from t to dt) in the BC specified for a component.
-    std::unordered_map< std::size_t,
-      std::vector< std::pair< bool, tk::real > > > m_bcdir;
+    //! \brief Dirichlet boundary conditions matched to local mesh node IDs,
+    //!   rebuilt if the mesh epoch changes, evaluated at every stage
+    DirBCPlan m_bcdir;
     //! Receive buffer for communication of the left hand side
-    //! \details Key: chare id, value: lhs for all scalar components per node
-    std::unordered_map< std::size_t, std::vector< tk::real > > m_lhsc;
+    //! \details Key: chare id, value: lhs for all scalar components per node,
+    //!   in the order of Discretization::NodeCommLid()
+    std::unordered_map< int, std::vector< tk::real > > m_lhsc;
     //! Receive buffer for communication of the nodal gradients
     //! \details Key: chare id, value: gradients for all scalar components per
-    //!   node
-    std::unordered_map< std::size_t, std::vector< tk::real > > m_gradc;
+    //!   node, in the order of Discretization::NodeCommBid()
+    std::unordered_map< int, std::vector< tk::real > > m_gradc;
     //! Receive buffer for communication of the right hand side
-    //! \details Key: chare id, value: rhs for all scalar components per node
-    std::unordered_map< std::size_t, std::vector< tk::real > > m_rhsc;
+    //! \details Key: chare id, value: rhs for all scalar components per node,
+    //!   in the order of Discretization::NodeCommLid()
+    std::unordered_map< int, std::vector< tk::real > > m_rhsc;
     //! Diagnostics object
     NodeDiagnostics m_diag;
+    //! \brief Partial diagnostics of the previous time step to be sent along
+    //!   with the time step size, empty if none, see NodeDiagnostics::lagged()
+    std::vector< std::vector< tk::real > > m_diaglag;
+    //! Time averages and second moments of the solution, empty if none
+    FieldStats m_stats;
     //! Face normals in boundary points associated to side sets
     //! \details Key: local node id, value: unit normal and inverse distance
     //!   square between face centroids and points, outer key: side set id
@@ -304,24 +360,108 @@ class ALECG : public CBase_ALECG {
     std::unordered_set< std::size_t > m_symbcnodes;
     //! Unique set of nodes at which farfield BCs are set
     std::unordered_set< std::size_t > m_farfieldbcnodes;
+    //! Nodes and their normals at which symmetry BCs are set, flattened
+    tk::BndNodeNormals m_symbcnorm;
+    //! Nodes and their normals at which farfield BCs are set, flattened
+    tk::BndNodeNormals m_farfieldbcnorm;
     //! Vector with 1 at symmetry BC boundary triangles
     std::vector< int > m_symbctri;
     //! Runge-Kutta stage counter
     std::size_t m_stage;
     //! Mesh node ids at which user-defined box ICs are defined
     std::vector< std::size_t > m_boxnodes;
-    //! Box nodes that have been set
-    std::unordered_set< std::size_t > m_boxnodes_set;
+    //! Box nodes that have been set and their index by distance
+    ICBoxState m_boxstate;
     //! Local node IDs of edges
-    std::vector< std::size_t > m_edgenode;
+    std::vector< tk::lid_t > m_edgenode;
     //! Edge ids in the order of access
-    std::vector< std::size_t > m_edgeid;
+    std::vector< tk::lid_t > m_edgeid;
+    //! \brief Parts of the mesh in which the right hand side is computed:
+    //!   0: entities contributing to chare-boundary points, 1: the rest
+    std::array< RHSPart, 2 > m_rhspart;
+    //! \brief Nodal gradients in all points, one for each PDE, kept between
+    //!   the parts of the right hand side
+    //! \details This is scratch storage only, hence not migrated; it is resized
+    //!   by the PDE as needed.
+    std::vector< tk::ReducedFields > m_pgrad;
+    //! \brief Primitive variables in all points, one for each PDE, computed
+    //!   once per stage and used by both the gradients and the edge fluxes
+    //! \details This is scratch storage only, hence not migrated; it is resized
+    //!   by the PDE as needed.
+    std::vector< tk::Fields > m_prim;
+    //! \brief Edge flux buffers, one for each PDE, reused across stages and
+    //!   kept between the parts of the right hand side
+    //! \details This is scratch storage only, hence not migrated; it is resized
+    //!   by the PDE as needed.
+    std::vector< std::vector< tk::real > > m_dflux;
     //! Time step size for each mesh node
     std::vector< tk::real > m_dtp;
     //! Physical time for each mesh node
     std::vector< tk::real > m_tp;
     //! True in the last time step
     int m_finished;
+    //! \brief Krylov iteration counter in implicit time stepping, 0: the right
+    //!   hand side is evaluated at the current solution
+    std::size_t m_kit;
+    //! Right hand side at the current solution in implicit time stepping
+    //! \details This and the Krylov solver data below are only used within a
+    //!   time step, hence not migrated.
+    tk::Fields m_res;
+    //! Krylov subspace basis vectors in implicit time stepping
+    std::vector< tk::Fields > m_krylov;
+    //! Least-squares problem of GMRES in implicit time stepping
+    tk::Arnoldi m_arnoldi;
+    //! Dot products of the latest Krylov vector with the previous ones
+    std::vector< tk::real > m_hcol;
+    //! L2 norm of the current solution in implicit time stepping
+    tk::real m_unorm;
+    //! Finite difference step size of the Jacobian-vector product
+    tk::real m_keps;
+    //! \brief 1.0 at mesh nodes owned by this chare, 0.0 at nodes owned by
+    //!   fellow chares, used to compute dot products across all chares
+    std::vector< tk::real > m_own;
+    //! 1 if the multigrid correction has been applied in this time step
+    int m_mgcorr;
+    //! Coarse levels of agglomeration multigrid
+    //! \details This is scratch storage only, hence not migrated; it is
+    //!   (re-)generated at first use after the edges have been (re-)computed.
+    std::vector< tk::AggLevel > m_mg;
+    //! \brief Global minimum of the time step size of the latest time step
+    //!   computed with lagged time step sizes, 0.0 if the next step must wait
+    //!   for its own global minimum
+    tk::real m_dtlag;
+    //! Chare-local minimum of the time step size of this time step
+    tk::real m_dtlocal;
+    //! 1 if a global minimum of the time step size is being computed
+    int m_dtpending;
+    //! \brief Continuation after the global minimum of the time step size
+    //!   arrives: 0: none, 1: start the step, 2: advance with the minimum
+    int m_dtwait;
+    //! Time step size selection by the estimate of the local time error
+    tk::StepControl m_stepctl;
+    //! \brief Scaled local time error estimate of the latest time step, see
+    //!   tk::StepControl, negative if not yet estimated
+    tk::real m_dterr;
+    //! Solution after the first Runge-Kutta stage of the time step
+    //! \details This is scratch storage only, hence not migrated; it is
+    //!   assigned in the first stage of every time step if needed.
+    tk::Fields m_u1;
+    //! Sweep of implicit residual smoothing in progress, 0 if none
+    std::size_t m_irs;
+    //! \brief Counters for receiving sums of implicit residual smoothing,
+    //!   by the parity of the sweep
+    std::array< std::size_t, 2 > m_nirs;
+    //! \brief Receive buffers for sums of implicit residual smoothing, by the
+    //!   parity of the sweep
+    std::array< std::unordered_map< int, std::vector< tk::real > >, 2 > m_irsc;
+    //! Weights of edges in implicit residual smoothing
+    std::vector< tk::real > m_irsw;
+    //! Residual before implicit residual smoothing
+    //! \details This is scratch storage only, hence not migrated.
+    tk::Fields m_rhs0;
+    //! Sums of a sweep of implicit residual smoothing and degree of points
+    //! \details This is scratch storage only, hence not migrated.
+    tk::Fields m_rsm;
 
     //! Access bound Discretization class pointer
     Discretization* Disc() const {
@@ -339,6 +479,12 @@ class ALECG : public CBase_ALECG {
     //! Find elements along our mesh chunk boundary
     std::vector< std::size_t > bndel() const;
 
+    //! Generate flat list of unique edges and flat edge id data structure
+    void edgeids();
+
+    //! Find the id of an edge
+    std::size_t edgeid( std::size_t p, std::size_t q ) const;
+
     //! Compute chare-boundary edges
     void bndEdges();
 
@@ -357,11 +503,17 @@ class ALECG : public CBase_ALECG {
     //!   boundary conditions on the initial conditions
     void normfinal();
 
+    //! Partition mesh entities into the parts of the right hand side
+    void rhspart();
+
     //! Output mesh and particle fields to files
     void out();
 
     //! Output mesh-based fields to file
-    void writeFields( CkCallback c ) const;
+    void writeFields( bool volume, CkCallback c ) const;
+
+    //! Output slices and iso-surfaces of mesh-based fields to files
+    void writeSlices( CkCallback c ) const;
 
     //! Combine own and communicated contributions to left hand side
     void lhsmerge();
@@ -369,15 +521,60 @@ class ALECG : public CBase_ALECG {
     //! Compute gradients
     void grad();
 
+    //! Query if the gradients of the first stage are reused in this stage
+    bool frozengrad() const;
+
+    //! Query if the time step size is selected by the local error estimate
+    bool dtctl() const;
+
     //! Compute righ-hand side vector of transport equations
     void rhs();
 
     //! Solve low and high order diagonal systems
     void solve();
 
+    //! Solve the diagonal system of an explicit Runge-Kutta stage
+    void rksolve();
+
+    //! Advance implicit residual smoothing by a Jacobi sweep
+    void irs();
+
+    //! Apply boundary conditions on the new solution and continue
+    void update();
+
+    //! Continue the Krylov solve after evaluating the right hand side
+    void krylov();
+
+    //! Finish implicit time step with the Krylov solution
+    void krylovsol();
+
+    //! \brief Inverse of the diagonal preconditioner of implicit time stepping
+    //!   at a mesh node for a scalar component
+    tk::real dinv( std::size_t i, ncomp_t c ) const;
+
+    //! Contribution of this chare to the dot product of two nodal fields
+    tk::real owndot( const tk::Fields& a,
+                     const tk::Fields& b,
+                     bool precond = false ) const;
+
+    //! Generate the coarse levels of agglomeration multigrid
+    void mgsetup();
+
+    //! Correct the solution by a multigrid cycle on the coarse levels
+    void mgcycle();
+
+    //! Compute the right hand side of a coarse multigrid level
+    void mgrhs( const tk::AggLevel& c,
+                const tk::Fields& U,
+                const tk::Fields& P,
+                tk::Fields& R ) const;
+
     //! Compute time step size
     void dt();
 
+    //! Start a time step with the lagged global time step size
+    void stepdt();
+
     //! Evaluate whether to continue with next time step stage
     void stage();
 
@@ -96,8 +96,6 @@ const
 //! \return Error indicator: a real number between [0...1] inclusive
 // *****************************************************************************
 {
-  const tk::real small = std::numeric_limits< tk::real >::epsilon();
-
   const auto& x = coord[0];
   const auto& y = coord[1];
   const auto& z = coord[2];
@@ -111,6 +109,23 @@ const
   auto ga = nodegrad( a, coord, inpoel, esup, u, c );
   auto gb = nodegrad( b, coord, inpoel, esup, u, c );
 
+  return hessian( ga, gb, h );
+}
+
+tk::real
+Error::hessian( const std::array< tk::real, 3 >& ga,
+                const std::array< tk::real, 3 >& gb,
+                const std::array< tk::real, 3 >& h )
+// *****************************************************************************
+//  Hessian-based error indicator from edge-end gradients and edge vector
+//! \param[in] ga Gradient of scalar at first edge-end point
+//! \param[in] gb Gradient of scalar at second edge-end point
+//! \param[in] h Edge vector
+//! \return Error indicator: a real number between [0...1] inclusive
+// *****************************************************************************
+{
+  const tk::real small = std::numeric_limits< tk::real >::epsilon();
+
   // Compute dot products of gradients and edge vectors
   auto dua = tk::dot( ga, h );
   auto dub = tk::dot( gb, h );
@@ -121,3 +136,70 @@ const
 
   return std::abs(dub-dua) / norm;
 }
+
+std::vector< tk::real >
+Error::scalars( const tk::Fields& u,
+                const std::vector< std::size_t >& inpoed,
+                const std::vector< std::size_t >& comps,
+                const std::array< std::vector< tk::real >, 3 >& coord,
+                const std::vector< std::size_t >& inpoel,
+                const std::pair< std::vector< std::size_t >,
+                                 std::vector< std::size_t > >& esup,
+                inciter::ctr::AMRErrorType err ) const
+// *****************************************************************************
+//  Compute error estimates for scalar quantities in all edges
+//! \param[in] u Solution vector
+//! \param[in] inpoed Edge connectivity, see tk::genInpoed()
+//! \param[in] comps Scalar components to compute error of
+//! \param[in] coord Mesh node coordinates
+//! \param[in] inpoel Mesh element connectivity
+//! \param[in] esup Linked lists storing elements surrounding points, see
+//!    tk::genEsup()
+//! \param[in] err AMR Error indicator type
+//! \return Largest error indicator among the scalar components for each edge
+//!   of inpoed, real numbers between [0...1] inclusive
+//! \details This computes the same indicators as scalar() called for each
+//!   edge and component, but visits each edge once and, for the Hessian-based
+//!   indicator, computes the gradients of all components at all mesh nodes
+//!   only once, instead of at both end-points of every edge.
+// *****************************************************************************
+{
+  const auto nedge = inpoed.size()/2;
+  const auto ncomp = comps.size();
+  std::vector< tk::real > error( nedge, 0.0 );
+
+  if (err == inciter::ctr::AMRErrorType::JUMP) {
+
+    for (std::size_t e=0; e<nedge; ++e) {
+      edge_t edge( inpoed[e*2], inpoed[e*2+1] );
+      for (auto c : comps) {
+        auto r = error_jump( u, edge, c );
+        if (r > error[e]) error[e] = r;
+      }
+    }
+
+  } else if (err == inciter::ctr::AMRErrorType::HESSIAN) {
+
+    const auto& x = coord[0];
+    const auto& y = coord[1];
+    const auto& z = coord[2];
+
+    // Compute gradients of all components at all mesh nodes
+    auto grad = tk::nodegrads( tk::shapegrads( coord, inpoel ), inpoel, esup,
+                               u, comps );
+
+    for (std::size_t e=0; e<nedge; ++e) {
+      edge_t edge( inpoed[e*2], inpoed[e*2+1] );
+      auto a = edge.first();
+      auto b = edge.second();
+      std::array< tk::real, 3 > h {{ x[a]-x[b], y[a]-y[b], z[a]-z[b] }};
+      for (std::size_t i=0; i<ncomp; ++i) {
+        auto r = hessian( grad[a*ncomp+i], grad[b*ncomp+i], h );
+        if (r > error[e]) error[e] = r;
+      }
+    }
+
+  } else Throw( "No such AMR error indicator type" );
+
+  return error;
+}
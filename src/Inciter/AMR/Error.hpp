@@ -36,6 +36,17 @@ class Error {
                                       std::vector< std::size_t > >& esup,
                      inciter::ctr::AMRErrorType err ) const;
 
+    //! Compute error estimates for scalar quantities in all edges
+    std::vector< tk::real >
+    scalars( const tk::Fields& u,
+             const std::vector< std::size_t >& inpoed,
+             const std::vector< std::size_t >& comps,
+             const std::array< std::vector< tk::real >, 3 >& coord,
+             const std::vector< std::size_t >& inpoel,
+             const std::pair< std::vector< std::size_t >,
+                              std::vector< std::size_t > >& esup,
+             inciter::ctr::AMRErrorType err ) const;
+
   private:
     //! Estimate error for scalar quantity on edge based on jump in solution
     tk::real
@@ -52,6 +63,12 @@ class Error {
                    const std::vector< std::size_t >& inpoel,
                    const std::pair< std::vector< std::size_t >,
                                     std::vector< std::size_t > >& esup ) const;
+
+    //! Hessian-based error indicator from edge-end gradients and edge vector
+    static tk::real
+    hessian( const std::array< tk::real, 3 >& ga,
+             const std::array< tk::real, 3 >& gb,
+             const std::array< tk::real, 3 >& h );
 };
 
 } // AMR::
@@ -10,7 +10,6 @@ namespace AMR {
 
     class edge_store_t {
         public:
-            // TODO: convert this to an unordered map with a custom hash (can lift from Quinoa)
             edges_t edges;
 
             // Node connectivity does this any way, but in a slightly less efficient way
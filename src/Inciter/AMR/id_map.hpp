@@ -0,0 +1,546 @@
+#ifndef AMR_id_map_h
+#define AMR_id_map_h
+
+#include <deque>
+#include <vector>
+#include <utility>
+#include <iterator>
+#include <type_traits>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+
+#include "edge.hpp"
+
+namespace AMR {
+
+    //! Slot index of the end() iterators of the containers below
+    const size_t end_slot = std::numeric_limits< size_t >::max();
+
+    /**
+     * @brief Forward iterator over the used slots of a slot container
+     *
+     * @details Iterates the slots in index order, skipping those not in use.
+     * The iterator stores the index, not a pointer to the slot, and any
+     * index past the last slot compares equal to end(), which is not bound
+     * to the current number of slots. So the iterator stays valid if the
+     * container grows or shrinks while iterating, and slots added while
+     * iterating are also visited, the same as with std::map for keys larger
+     * than the current one.
+     */
+    template< class Store, class Value >
+    class slot_iterator_t {
+        private:
+            Store* store;
+            size_t i;
+
+            //! Advance to the first used slot starting from the current one
+            void skip()
+            {
+                auto n = store->num_slots();
+                while (i < n && !store->used(i)) ++i;
+            }
+
+            //! Query if iterator is past the last slot
+            bool at_end() const { return i >= store->num_slots(); }
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = std::remove_const_t< Value >;
+            using difference_type = std::ptrdiff_t;
+            using pointer = Value*;
+            using reference = Value&;
+
+            slot_iterator_t( Store* s, size_t idx ) : store(s), i(idx)
+            {
+                skip();
+            }
+
+            //! Conversion from iterator to const_iterator
+            template< class S, class V >
+            // cppcheck-suppress noExplicitConstructor
+            slot_iterator_t( const slot_iterator_t< S, V >& it ) :
+                store(it.get_store()), i(it.index()) {}
+
+            Store* get_store() const { return store; }
+            size_t index() const { return i; }
+
+            reference operator*() const { return store->slot(i); }
+            pointer operator->() const { return &store->slot(i); }
+
+            slot_iterator_t& operator++()
+            {
+                ++i;
+                skip();
+                return *this;
+            }
+
+            slot_iterator_t operator++(int)
+            {
+                auto it = *this;
+                ++(*this);
+                return it;
+            }
+
+            bool operator==( const slot_iterator_t& rhs ) const
+            {
+                return at_end() ? rhs.at_end() : i == rhs.i;
+            }
+            bool operator!=( const slot_iterator_t& rhs ) const
+            {
+                return !(*this == rhs);
+            }
+    };
+
+    /**
+     * @brief Map from (tet) ids to values stored densely, indexed by id
+     *
+     * @details Drop-in replacement of std::map< size_t, T > for keys handed
+     * out by id_generator_t, i.e., from a contiguous range starting at zero.
+     * The value with id i is stored in slot i, so lookup is an index
+     * operation and iteration visits the ids in ascending order, just like
+     * std::map does. Slots live in a std::deque, so references to values
+     * stay valid when other ids are inserted. Erased slots are released
+     * only if they are at the end of the range, so ids are never moved; the
+     * value of an erased slot inside the range is kept until overwritten.
+     */
+    template< class T >
+    class id_map_t {
+        public:
+            using key_type = size_t;
+            using mapped_type = T;
+            using value_type = std::pair< size_t, T >;
+            using iterator = slot_iterator_t< id_map_t, value_type >;
+            using const_iterator =
+              slot_iterator_t< const id_map_t, const value_type >;
+
+        private:
+            std::deque< value_type > slots;
+            std::vector< char > flags;
+            size_t nused = 0;
+
+        public:
+            //! Non-const-ref access to state
+            std::deque< value_type >& get_data() { return slots; }
+            std::vector< char >& get_flags() { return flags; }
+            size_t& get_size() { return nused; }
+
+            size_t num_slots() const { return flags.size(); }
+            bool used(size_t i) const { return flags[i]; }
+
+            //! Number of bytes occupied, not counting heap storage of values
+            size_t bytes() const
+            {
+                return sizeof(*this) + slots.size() * sizeof(value_type) +
+                       flags.capacity();
+            }
+            value_type& slot(size_t i) { return slots[i]; }
+            const value_type& slot(size_t i) const { return slots[i]; }
+
+            iterator begin() { return iterator(this, 0); }
+            iterator end() { return iterator(this, end_slot); }
+            const_iterator begin() const { return const_iterator(this, 0); }
+            const_iterator end() const
+            {
+                return const_iterator(this, end_slot);
+            }
+
+            size_t size() const { return nused; }
+            bool empty() const { return nused == 0; }
+
+            void clear()
+            {
+                slots.clear();
+                flags.clear();
+                nused = 0;
+            }
+
+            size_t count(size_t id) const
+            {
+                return id < num_slots() && flags[id] ? 1 : 0;
+            }
+
+            iterator find(size_t id)
+            {
+                return count(id) ? iterator(this, id) : end();
+            }
+            const_iterator find(size_t id) const
+            {
+                return count(id) ? const_iterator(this, id) : end();
+            }
+
+            /**
+             * @brief Insert value if its id does not exist yet
+             *
+             * @param v Id and value to insert
+             *
+             * @return Iterator to the value with the id and a bool that is
+             * true if the value was inserted
+             */
+            std::pair< iterator, bool > insert(const value_type& v)
+            {
+                auto id = v.first;
+                if (count(id)) return { iterator(this, id), false };
+                if (id >= num_slots()) {
+                    slots.resize(id+1);
+                    flags.resize(id+1, 0);
+                }
+                slots[id] = v;
+                flags[id] = 1;
+                ++nused;
+                return { iterator(this, id), true };
+            }
+
+            T& operator[](size_t id)
+            {
+                if (!count(id)) insert( value_type(id, T()) );
+                return slots[id].second;
+            }
+
+            T& at(size_t id)
+            {
+                // cppcheck-suppress assertWithSideEffect
+                assert( count(id) );
+                return slots[id].second;
+            }
+            const T& at(size_t id) const
+            {
+                // cppcheck-suppress assertWithSideEffect
+                assert( count(id) );
+                return slots[id].second;
+            }
+
+            /**
+             * @brief Erase value with id, if it exists
+             *
+             * @param id Id of the value to erase
+             *
+             * @return The number of values erased (0 or 1)
+             */
+            size_t erase(size_t id)
+            {
+                if (!count(id)) return 0;
+                flags[id] = 0;
+                --nused;
+                while (!flags.empty() && !flags.back()) {
+                    flags.pop_back();
+                    slots.pop_back();
+                }
+                return 1;
+            }
+    };
+
+    /**
+     * @brief Set of (tet) ids stored as a flag per id
+     *
+     * @details Drop-in replacement of std::set< size_t > for ids handed out
+     * by id_generator_t. Iteration visits the ids in ascending order.
+     */
+    class id_set_t {
+        public:
+            using key_type = size_t;
+            using value_type = size_t;
+
+        private:
+            std::vector< char > flags;
+            size_t nused = 0;
+
+        public:
+            //! Iterator dereferencing to the id
+            class const_iterator {
+                private:
+                    const id_set_t* set;
+                    size_t i;
+                    void skip()
+                    {
+                        auto n = set->flags.size();
+                        while (i < n && !set->flags[i]) ++i;
+                    }
+                    bool at_end() const { return i >= set->flags.size(); }
+                public:
+                    using iterator_category = std::forward_iterator_tag;
+                    using value_type = size_t;
+                    using difference_type = std::ptrdiff_t;
+                    using pointer = const size_t*;
+                    using reference = size_t;
+
+                    const_iterator( const id_set_t* s, size_t idx ) :
+                        set(s), i(idx) { skip(); }
+                    size_t operator*() const { return i; }
+                    const_iterator& operator++() { ++i; skip(); return *this; }
+                    const_iterator operator++(int)
+                    {
+                        auto it = *this;
+                        ++(*this);
+                        return it;
+                    }
+                    bool operator==( const const_iterator& rhs ) const
+                    {
+                        return at_end() ? rhs.at_end() : i == rhs.i;
+                    }
+                    bool operator!=( const const_iterator& rhs ) const
+                    {
+                        return !(*this == rhs);
+                    }
+            };
+            using iterator = const_iterator;
+
+            //! Non-const-ref access to state
+            std::vector< char >& get_flags() { return flags; }
+            size_t& get_size() { return nused; }
+
+            //! Number of bytes occupied
+            size_t bytes() const { return sizeof(*this) + flags.capacity(); }
+
+            const_iterator begin() const { return const_iterator(this, 0); }
+            const_iterator end() const
+            {
+                return const_iterator(this, end_slot);
+            }
+
+            size_t size() const { return nused; }
+            bool empty() const { return nused == 0; }
+
+            void clear()
+            {
+                flags.clear();
+                nused = 0;
+            }
+
+            size_t count(size_t id) const
+            {
+                return id < flags.size() && flags[id] ? 1 : 0;
+            }
+
+            const_iterator find(size_t id) const
+            {
+                return count(id) ? const_iterator(this, id) : end();
+            }
+
+            std::pair< const_iterator, bool > insert(size_t id)
+            {
+                if (count(id)) return { const_iterator(this, id), false };
+                if (id >= flags.size()) flags.resize(id+1, 0);
+                flags[id] = 1;
+                ++nused;
+                return { const_iterator(this, id), true };
+            }
+
+            size_t erase(size_t id)
+            {
+                if (!count(id)) return 0;
+                flags[id] = 0;
+                --nused;
+                while (!flags.empty() && !flags.back()) flags.pop_back();
+                return 1;
+            }
+    };
+
+    /**
+     * @brief Hash table from edges to values using open addressing
+     *
+     * @details Drop-in replacement of std::map< edge_t, T > for the edge
+     * store: all entries live in a single array of slots probed linearly,
+     * instead of a node allocated per edge. The capacity is a power of two
+     * and the table is rehashed when more than half of the slots are used
+     * or deleted. Iteration order is unspecified and, unlike std::map,
+     * references to values are invalidated by insertions that rehash.
+     */
+    template< class T >
+    class edge_table_t {
+        public:
+            using key_type = edge_t;
+            using mapped_type = T;
+            using value_type = std::pair< edge_t, T >;
+            using iterator = slot_iterator_t< edge_table_t, value_type >;
+            using const_iterator =
+              slot_iterator_t< const edge_table_t, const value_type >;
+
+            //! Slot states
+            enum : char { EMPTY = 0, FULL, DELETED };
+
+        private:
+            std::vector< value_type > slots;
+            std::vector< char > state;
+            size_t nused = 0;
+            size_t ndeleted = 0;
+
+            //! Hash an edge (64-bit mix of the two node ids)
+            static size_t hash(const edge_t& e)
+            {
+                std::uint64_t h = e.first() * 0x9E3779B97F4A7C15ULL;
+                h ^= e.second() + 0x7F4A7C159E3779B9ULL + (h << 6) + (h >> 2);
+                h ^= h >> 33;
+                h *= 0xFF51AFD7ED558CCDULL;
+                h ^= h >> 33;
+                return static_cast< size_t >( h );
+            }
+
+            //! Find slot of key or capacity if not found
+            size_t locate(const edge_t& key) const
+            {
+                auto cap = slots.size();
+                if (cap == 0) return cap;
+                auto mask = cap - 1;
+                for (auto i = hash(key) & mask; ; i = (i+1) & mask) {
+                    if (state[i] == EMPTY) return cap;
+                    if (state[i] == FULL && slots[i].first == key) return i;
+                }
+            }
+
+            //! Rebuild table with capacity cap, dropping deleted slots
+            void rehash(size_t cap)
+            {
+                std::vector< value_type > s( cap );
+                std::vector< char > f( cap, EMPTY );
+                auto mask = cap - 1;
+                for (size_t j=0; j<slots.size(); ++j) {
+                    if (state[j] != FULL) continue;
+                    auto i = hash(slots[j].first) & mask;
+                    while (f[i] == FULL) i = (i+1) & mask;
+                    s[i] = std::move(slots[j]);
+                    f[i] = FULL;
+                }
+                slots = std::move(s);
+                state = std::move(f);
+                ndeleted = 0;
+            }
+
+        public:
+            //! Non-const-ref access to state
+            std::vector< value_type >& get_data() { return slots; }
+            std::vector< char >& get_flags() { return state; }
+            size_t& get_size() { return nused; }
+            size_t& get_ndeleted() { return ndeleted; }
+
+            size_t num_slots() const { return state.size(); }
+            bool used(size_t i) const { return state[i] == FULL; }
+
+            //! Number of bytes occupied, not counting heap storage of values
+            size_t bytes() const
+            {
+                return sizeof(*this) + slots.capacity() * sizeof(value_type) +
+                       state.capacity();
+            }
+            value_type& slot(size_t i) { return slots[i]; }
+            const value_type& slot(size_t i) const { return slots[i]; }
+
+            iterator begin() { return iterator(this, 0); }
+            iterator end() { return iterator(this, end_slot); }
+            const_iterator begin() const { return const_iterator(this, 0); }
+            const_iterator end() const
+            {
+                return const_iterator(this, end_slot);
+            }
+
+            size_t size() const { return nused; }
+            bool empty() const { return nused == 0; }
+
+            void clear()
+            {
+                slots.clear();
+                state.clear();
+                nused = ndeleted = 0;
+            }
+
+            size_t count(const edge_t& key) const
+            {
+                return locate(key) < slots.size() ? 1 : 0;
+            }
+
+            iterator find(const edge_t& key)
+            {
+                return iterator(this, locate(key));
+            }
+            const_iterator find(const edge_t& key) const
+            {
+                return const_iterator(this, locate(key));
+            }
+
+            /**
+             * @brief Insert value if its key does not exist yet
+             *
+             * @param v Key and value to insert
+             *
+             * @return Iterator to the value with the key and a bool that is
+             * true if the value was inserted
+             */
+            std::pair< iterator, bool > insert(const value_type& v)
+            {
+                auto f = locate(v.first);
+                if (f < slots.size()) return { iterator(this, f), false };
+                auto cap = slots.size();
+                if (2*(nused + ndeleted + 1) > cap)
+                    rehash( 2*(nused+1) > cap/2 ? (cap ? 2*cap : 16) : cap );
+                auto mask = slots.size() - 1;
+                auto i = hash(v.first) & mask;
+                while (state[i] == FULL) i = (i+1) & mask;
+                if (state[i] == DELETED) --ndeleted;
+                slots[i] = v;
+                state[i] = FULL;
+                ++nused;
+                return { iterator(this, i), true };
+            }
+
+            T& operator[](const edge_t& key)
+            {
+                auto f = locate(key);
+                if (f < slots.size()) return slots[f].second;
+                return insert( value_type(key, T()) ).first->second;
+            }
+
+            /**
+             * @brief Erase value with key, if it exists
+             *
+             * @param key Key of the value to erase
+             *
+             * @return The number of values erased (0 or 1)
+             */
+            size_t erase(const edge_t& key)
+            {
+                auto f = locate(key);
+                if (f == slots.size()) return 0;
+                slots[f].second = T();
+                state[f] = DELETED;
+                --nused;
+                ++ndeleted;
+                return 1;
+            }
+    };
+
+    /** @name Free begin/end functions, found by ADL as with std containers */
+    ///@{
+    template< class T >
+    typename id_map_t< T >::iterator begin( id_map_t< T >& m )
+    { return m.begin(); }
+    template< class T >
+    typename id_map_t< T >::iterator end( id_map_t< T >& m )
+    { return m.end(); }
+    template< class T >
+    typename id_map_t< T >::const_iterator begin( const id_map_t< T >& m )
+    { return m.begin(); }
+    template< class T >
+    typename id_map_t< T >::const_iterator end( const id_map_t< T >& m )
+    { return m.end(); }
+
+    inline id_set_t::const_iterator begin( const id_set_t& s )
+    { return s.begin(); }
+    inline id_set_t::const_iterator end( const id_set_t& s )
+    { return s.end(); }
+
+    template< class T >
+    typename edge_table_t< T >::iterator begin( edge_table_t< T >& t )
+    { return t.begin(); }
+    template< class T >
+    typename edge_table_t< T >::iterator end( edge_table_t< T >& t )
+    { return t.end(); }
+    template< class T >
+    typename edge_table_t< T >::const_iterator
+    begin( const edge_table_t< T >& t ) { return t.begin(); }
+    template< class T >
+    typename edge_table_t< T >::const_iterator
+    end( const edge_table_t< T >& t ) { return t.end(); }
+    ///@}
+}
+
+#endif // guard
@@ -86,28 +86,33 @@ namespace AMR {
              */
             void add(size_t id, case_t r)
             {
-                // Check if that active element already exists
-                if (exists(id))
+                // Tets may be marked concurrently, see
+                // mesh_adapter_t::mark_refinement()
+                #pragma omp critical (AMR_marked_refinements)
                 {
-                    if (marked_refinements[id] != r)
+                    // Check if that active element already exists
+                    if (exists(id))
                     {
-                        trace_out << "Updating marked value to " << r <<
-                            " was " << marked_refinements[id] << std::endl;
-
-                        marked_refinements[id] = r;
-
-                        // TODO :Find a better way to handle/update this global
-                        state_changed = true;
+                        if (marked_refinements[id] != r)
+                        {
+                            trace_out << "Updating marked value to " << r <<
+                                " was " << marked_refinements[id] << std::endl;
+
+                            marked_refinements[id] = r;
+
+                            // TODO :Find a better way to handle/update this global
+                            state_changed = true;
+                        }
+                        else {
+                            trace_out << "Not setting marked refinement val as same val"<< std::endl;
+                        }
                     }
                     else {
-                        trace_out << "Not setting marked refinement val as same val"<< std::endl;
+                        trace_out << "Adding new marked value " << id << " = " << r << std::endl;
+                        marked_refinements.insert( std::pair<size_t, case_t>(id, r));
+                        state_changed = true;
                     }
                 }
-                else {
-                    trace_out << "Adding new marked value " << id << " = " << r << std::endl;
-                    marked_refinements.insert( std::pair<size_t, case_t>(id, r));
-                    state_changed = true;
-                }
             }
 
             /**
@@ -1,21 +1,21 @@
 #ifndef AMR_master_element_store_h
 #define AMR_master_element_store_h
 
-#include <map>
 #include <algorithm>
 #include <cassert>
 
 #include "Refinement_State.hpp"
+#include "id_map.hpp"
 #include "AMR/Loggers.hpp"                   // for trace_out
 
 namespace AMR {
 
     class master_element_store_t {
         private:
-            std::map<size_t, Refinement_State> master_elements;
+            id_map_t<Refinement_State> master_elements;
         public:
             //! Non-const-ref access to state
-            std::map<size_t, Refinement_State>& data() {
+            id_map_t<Refinement_State>& data() {
               return master_elements;
             }
 
@@ -279,6 +279,11 @@ namespace AMR {
 #endif
         const size_t max_num_rounds = AMR_MAX_ROUNDS;
 
+#ifdef _OPENMP
+        // Group tets that can be marked concurrently
+        const auto colors = color_tets();
+#endif
+
         // Mark refinements
         size_t iter;
         //Iterate until convergence
@@ -287,130 +292,215 @@ namespace AMR {
 
             tet_store.marked_refinements.get_state_changed() = false;
 
+#ifdef _OPENMP
+            // Sweep over tets color by color, tets of the same color in
+            // parallel
+            for (const auto& color : colors)
+            {
+                const auto ntet = static_cast< std::ptrdiff_t >( color.size() );
+                #pragma omp parallel for schedule(static)
+                for (std::ptrdiff_t i=0; i<ntet; ++i)
+                {
+                    mark_tet_refinement( color[ static_cast<size_t>(i) ] );
+                }
+            }
+#else
             // Loop over Tets.
             for (const auto& kv : tet_store.tets)
             {
-                size_t tet_id = kv.first;
+                mark_tet_refinement( kv.first );
+            }
+#endif
 
-                trace_out << "Process tet " << tet_id << std::endl;
+            // If nothing changed during that round, break
+            if (!tet_store.marked_refinements.get_state_changed())
+            {
+                trace_out << "Terminating loop at iter " << iter << std::endl;
+                break;
+            }
+            trace_out << "End iter " << iter << std::endl;
+        }
+        trace_out << "Loop took " << iter << " rounds." << std::endl;
 
-                // Only apply checks to tets on the active list
-                if (tet_store.is_active(tet_id)) {
-                    int num_locked_edges = 0;
-                    int num_intermediate_edges = 0;
+        //std::cout << "Print Tets" << std::endl;
+        //print_tets();
+    }
 
-                    // Loop over nodes and count the number which need refining
-                    int num_to_refine = 0;
+    /**
+     * @brief Decide the refinement case of a single tet, one step of the
+     * iterative marking algorithm in mark_refinement()
+     *
+     * @param tet_id The id of the tet to mark
+     */
+    void mesh_adapter_t::mark_tet_refinement(size_t tet_id)
+    {
+        trace_out << "Process tet " << tet_id << std::endl;
 
-                    // This is useful for later inspection
-                    edge_list_t edge_list = tet_store.generate_edge_keys(tet_id);
+        // Only apply checks to tets on the active list
+        if (tet_store.is_active(tet_id)) {
+            int num_locked_edges = 0;
+            int num_intermediate_edges = 0;
 
-                    //Iterate over edges
-                    for(auto & key : edge_list)
-                    {
+            // Loop over nodes and count the number which need refining
+            int num_to_refine = 0;
 
-                        trace_out << "Edge " << key << std::endl;
+            // This is useful for later inspection
+            edge_list_t edge_list = tet_store.generate_edge_keys(tet_id);
 
-                        //Count locked edges and edges in need of
-                        // refinement
-                        // Count Locked Edges
-                        if(tet_store.edge_store.get(key).lock_case == AMR::Edge_Lock_Case::locked)
-                        {
-                            trace_out << "Found locked edge " << key << std::endl;
-                            trace_out << "Locked :" << tet_store.edge_store.get(key).lock_case << std::endl;
-                            num_locked_edges++;
-                        }
-                        else if(tet_store.edge_store.get(key).lock_case == AMR::Edge_Lock_Case::intermediate)
-                        {
-                            trace_out << "Found intermediate edge " << key << std::endl;
-                            num_intermediate_edges++;
-                        }
-                        else
-                        {
-                            // Count edges which need refining
-                            //  We check in here as we won't refine a
-                            //  locked edge and will thus ignore it
-                            if (tet_store.edge_store.get(key).needs_refining)
-                            {
-                                num_to_refine++;
-                                trace_out << "key needs ref " << key << std::endl;
-                            }
-                        }
-                    }
+            //Iterate over edges
+            for(auto & key : edge_list)
+            {
 
-                    // TODO: Should this be a reference?
-                    AMR::Refinement_Case refinement_case = tet_store.get_refinement_case(tet_id);
-                    int normal = tet_store.is_normal(tet_id);
+                trace_out << "Edge " << key << std::endl;
 
-                    trace_out << "Checking " << tet_id <<
-                        " ref case " << refinement_case <<
-                        " num ref " << num_to_refine <<
-                        " normal " << normal <<
-                        std::endl;
+                //Count locked edges and edges in need of
+                // refinement
+                // Count Locked Edges
+                if(tet_store.edge_store.get(key).lock_case == AMR::Edge_Lock_Case::locked)
+                {
+                    trace_out << "Found locked edge " << key << std::endl;
+                    trace_out << "Locked :" << tet_store.edge_store.get(key).lock_case << std::endl;
+                    num_locked_edges++;
+                }
+                else if(tet_store.edge_store.get(key).lock_case == AMR::Edge_Lock_Case::intermediate)
+                {
+                    trace_out << "Found intermediate edge " << key << std::endl;
+                    num_intermediate_edges++;
+                }
+                else
+                {
+                    // Count edges which need refining
+                    //  We check in here as we won't refine a
+                    //  locked edge and will thus ignore it
+                    if (tet_store.edge_store.get(key).needs_refining)
+                    {
+                        num_to_refine++;
+                        trace_out << "key needs ref " << key << std::endl;
+                    }
+                }
+            }
 
+            // TODO: Should this be a reference?
+            AMR::Refinement_Case refinement_case = tet_store.get_refinement_case(tet_id);
+            int normal = tet_store.is_normal(tet_id);
+
+            trace_out << "Checking " << tet_id <<
+                " ref case " << refinement_case <<
+                " num ref " << num_to_refine <<
+                " normal " << normal <<
+                std::endl;
 
 
-                    //If we have any tets to refine
-                    if (num_to_refine > 0)
-                    {
-                        //Determine compatibility case
 
-                        int compatibility = detect_compatibility(num_locked_edges,
-                                num_intermediate_edges, refinement_case, normal);
+            //If we have any tets to refine
+            if (num_to_refine > 0)
+            {
+                //Determine compatibility case
 
-                        trace_out << "Compat " << compatibility << std::endl;
+                int compatibility = detect_compatibility(num_locked_edges,
+                        num_intermediate_edges, refinement_case, normal);
 
-                        // Now check num_to_refine against situations
-                        if (compatibility == 1)
-                        {
-                            refinement_class_one(num_to_refine, tet_id);
-                        }
-                        else if (compatibility == 2)
-                        {
-                            refinement_class_two(edge_list, tet_id);
-                        }
-                        else if (compatibility == 3)
-                        {
-                            refinement_class_three(tet_id);
-                        }
+                trace_out << "Compat " << compatibility << std::endl;
 
-                        /*
-                        // Write temp mesh out
-                        std::string temp_file =  "temp." +
-                        std::to_string(iter) + "." +
-                        std::to_string(tet_id) + ".exo";
-
-                        std::cout << "Writing " << temp_file << std::endl;
-                        Adaptive_UnsMesh outmesh(
-                        get_active_inpoel(), x(), y(), z()
-                        );
-                        tk::ExodusIIMeshWriter( temp_file, tk::ExoWriter::CREATE ).
-                        writeMesh(outmesh);
-                        */
-
-                    } // if num_to_refine
-                    else {
-                            // If we got here, we don't want to refine this guy
-                            tet_store.marked_refinements.add(tet_id, AMR::Refinement_Case::none);
-                    }
-                } // if active
-                else {
-                    trace_out << "Inactive" << std::endl;
+                // Now check num_to_refine against situations
+                if (compatibility == 1)
+                {
+                    refinement_class_one(num_to_refine, tet_id);
+                }
+                else if (compatibility == 2)
+                {
+                    refinement_class_two(edge_list, tet_id);
+                }
+                else if (compatibility == 3)
+                {
+                    refinement_class_three(tet_id);
                 }
-            } // For
 
-            // If nothing changed during that round, break
-            if (!tet_store.marked_refinements.get_state_changed())
+                /*
+                // Write temp mesh out
+                std::string temp_file =  "temp." +
+                std::to_string(iter) + "." +
+                std::to_string(tet_id) + ".exo";
+
+                std::cout << "Writing " << temp_file << std::endl;
+                Adaptive_UnsMesh outmesh(
+                get_active_inpoel(), x(), y(), z()
+                );
+                tk::ExodusIIMeshWriter( temp_file, tk::ExoWriter::CREATE ).
+                writeMesh(outmesh);
+                */
+
+            } // if num_to_refine
+            else {
+                    // If we got here, we don't want to refine this guy
+                    tet_store.marked_refinements.add(tet_id, AMR::Refinement_Case::none);
+            }
+        } // if active
+        else {
+            trace_out << "Inactive" << std::endl;
+        }
+    }
+
+    /**
+     * @brief Group active tets into colors, so that the tets of a color can
+     * be marked concurrently
+     *
+     * @details Marking a tet reads and writes the edges of the tet and, for
+     * tets with intermediate edges (1:2 and 1:4 children, see
+     * refinement_class_three), the edges and the state of all children of
+     * its parent. Two tets get different colors if these footprints share
+     * an edge. Colors are assigned greedily in ascending tet id order, so
+     * the coloring, and thus the marking, only depends on the mesh and not
+     * on the number of threads.
+     *
+     * @return Ids of the active tets of each color in ascending order
+     */
+    std::vector< std::vector< size_t > > mesh_adapter_t::color_tets()
+    {
+        std::vector< std::vector< size_t > > colors;
+        edge_table_t< std::vector< size_t > > edge_colors;
+        std::vector< char > used;
+
+        for (const auto& kv : tet_store.tets)
+        {
+            size_t tet_id = kv.first;
+            if (!tet_store.is_active(tet_id)) continue;
+
+            // Collect the edges touched when marking this tet
+            std::vector< edge_t > footprint;
+            auto add_edges = [&]( size_t id ){
+                auto edge_list = tet_store.generate_edge_keys(id);
+                footprint.insert( end(footprint), begin(edge_list),
+                                  end(edge_list) );
+            };
+            auto refinement_case = tet_store.get_refinement_case(tet_id);
+            if (refinement_case == AMR::Refinement_Case::one_to_two ||
+                refinement_case == AMR::Refinement_Case::one_to_four)
             {
-                trace_out << "Terminating loop at iter " << iter << std::endl;
-                break;
+                size_t parent_id = tet_store.get_parent_id(tet_id);
+                for (auto c : tet_store.data(parent_id).children) add_edges(c);
             }
-            trace_out << "End iter " << iter << std::endl;
+            else {
+                add_edges(tet_id);
+            }
+
+            // Find smallest color not used on the footprint
+            used.assign(colors.size()+1, 0);
+            for (const auto& e : footprint)
+            {
+                auto f = edge_colors.find(e);
+                if (f != end(edge_colors))
+                    for (auto c : f->second) used[c] = 1;
+            }
+            size_t color = 0;
+            while (used[color]) ++color;
+
+            if (color == colors.size()) colors.emplace_back();
+            colors[color].push_back(tet_id);
+            for (const auto& e : footprint) edge_colors[e].push_back(color);
         }
-        trace_out << "Loop took " << iter << " rounds." << std::endl;
 
-        //std::cout << "Print Tets" << std::endl;
-        //print_tets();
+        return colors;
     }
 
     /**
@@ -1118,14 +1208,11 @@ namespace AMR {
         {
             tet_store.marked_derefinements.get_state_changed() = false;
 
-            // Loop over tets
-            for (const auto& kv : tet_store.tets)
+            // Loop over parents whose children are all leaves: only these
+            // can be derefined
+            for (const auto tet_id : tet_store.leaf_families)
             {
-                size_t tet_id = kv.first;
-
-                // Skip tets which have no children
                 child_id_list_t children = tet_store.data(tet_id).children;
-                if (children.size() <= 0) { continue; }
 
                 // This is useful for later inspection
                 //edge_list_t edge_list = tet_store.generate_edge_keys(tet_id);
@@ -1326,47 +1413,49 @@ namespace AMR {
     {
         trace_out << "Perform deref" << std::endl;
 
-        // Do derefinements
-        for (const auto& kv : tet_store.tets)
+        // Collect the leaf families marked for derefinement, as derefining
+        // them modifies the list of leaf families
+        std::vector< size_t > marked;
+        for (const auto tet_id : tet_store.leaf_families)
         {
-            size_t tet_id = kv.first;
-            //size_t parent_id = 0;
-
-            // TODO: Do I really want to loop all tets?
-
-            // TODO: is this doing a double lookup?
             if (tet_store.has_derefinement_decision(tet_id))
             {
-                trace_out << "Do derefine of " << tet_id << std::endl;
-                //size_t parent_id = tet_store.get_parent_id(tet_id);
-                //trace_out << "Parent = " << parent_id << std::endl;
-                switch(tet_store.marked_derefinements.get(tet_id))
-                {
-                    case AMR::Derefinement_Case::two_to_one:
-                        refiner.derefine_two_to_one(tet_store,node_connectivity,tet_id);
-                        break;
-                    case AMR::Derefinement_Case::four_to_one:
-                        refiner.derefine_four_to_one(tet_store,node_connectivity,tet_id);
-                        break;
-                    case AMR::Derefinement_Case::four_to_two:
-                        refiner.derefine_four_to_two(tet_store,node_connectivity,tet_id);
-                        break;
-                    case AMR::Derefinement_Case::eight_to_one:
-                        refiner.derefine_eight_to_one(tet_store,node_connectivity,tet_id);
-                        break;
-                    case AMR::Derefinement_Case::eight_to_two:
-                        refiner.derefine_eight_to_two(tet_store,node_connectivity,tet_id);
-                        break;
-                    case AMR::Derefinement_Case::eight_to_four:
-                        refiner.derefine_eight_to_four(tet_store,node_connectivity,tet_id);
-                        break;
-                    case AMR::Derefinement_Case::skip:
-                        // What do we do with skip?
-                        break;
-                }
-                // Mark tet as not needing refinement
-                tet_store.marked_derefinements.erase(tet_id);
+                marked.push_back(tet_id);
+            }
+        }
+
+        // Do derefinements
+        for (const auto tet_id : marked)
+        {
+            trace_out << "Do derefine of " << tet_id << std::endl;
+            //size_t parent_id = tet_store.get_parent_id(tet_id);
+            //trace_out << "Parent = " << parent_id << std::endl;
+            switch(tet_store.marked_derefinements.get(tet_id))
+            {
+                case AMR::Derefinement_Case::two_to_one:
+                    refiner.derefine_two_to_one(tet_store,node_connectivity,tet_id);
+                    break;
+                case AMR::Derefinement_Case::four_to_one:
+                    refiner.derefine_four_to_one(tet_store,node_connectivity,tet_id);
+                    break;
+                case AMR::Derefinement_Case::four_to_two:
+                    refiner.derefine_four_to_two(tet_store,node_connectivity,tet_id);
+                    break;
+                case AMR::Derefinement_Case::eight_to_one:
+                    refiner.derefine_eight_to_one(tet_store,node_connectivity,tet_id);
+                    break;
+                case AMR::Derefinement_Case::eight_to_two:
+                    refiner.derefine_eight_to_two(tet_store,node_connectivity,tet_id);
+                    break;
+                case AMR::Derefinement_Case::eight_to_four:
+                    refiner.derefine_eight_to_four(tet_store,node_connectivity,tet_id);
+                    break;
+                case AMR::Derefinement_Case::skip:
+                    // What do we do with skip?
+                    break;
             }
+            // Mark tet as not needing refinement
+            tet_store.marked_derefinements.erase(tet_id);
         }
 
         node_connectivity.print();
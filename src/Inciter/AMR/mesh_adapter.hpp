@@ -70,6 +70,8 @@ namespace AMR {
             void lock_intermediates();
 
             void mark_refinement();
+            void mark_tet_refinement(size_t tet_id);
+            std::vector< std::vector< size_t > > color_tets();
             void perform_refinement();
 
             void refinement_class_one(int num_to_refine, size_t tet_id);
@@ -744,6 +744,7 @@ namespace AMR {
                     */
                 }
                 parent.children.clear();
+                tet_store.remove_leaf_family(parent_id);
             }
 
             /**
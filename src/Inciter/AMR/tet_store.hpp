@@ -1,6 +1,7 @@
 #ifndef AMR_tet_store_h
 #define AMR_tet_store_h
 
+#include <set>
 #include <unordered_set>
 #include <vector>
 
@@ -20,9 +21,14 @@ namespace AMR {
                 // This is a horrendous code abuse, and I'm sorry. I'm fairly
                 // certain we'll be re-writing how this detection is done and just
                 // wanted a quick-fix so I could move on :(
-            std::set<size_t> center_tets; // Store for 1:4 centers
+            id_set_t center_tets; // Store for 1:4 centers
 
-            std::set<size_t> delete_list; // For marking deletions in deref
+            id_set_t delete_list; // For marking deletions in deref
+
+            // Parents whose children are all leaves, i.e., have no children
+            // themselves. Only these can be derefined, so derefinement only
+            // visits these instead of all tets.
+            id_set_t leaf_families;
 
             AMR::active_element_store_t active_elements;
             AMR::master_element_store_t master_elements;
@@ -237,6 +243,7 @@ namespace AMR {
 
                 // Deal with updating parent
                 master_elements.add_child(parent_id, id);
+                add_leaf_family(parent_id);
 
                 trace_out << "Added child " << id << std::endl;
             }
@@ -753,6 +760,40 @@ namespace AMR {
                 return master_elements.get_parent(id);
             }
 
+            /**
+             * @brief Function to register a parent whose children have just
+             * been added as a leaf family. Its own parent, if any, is no
+             * longer one, as it now has a grandchild.
+             *
+             * @param parent_id Id of the parent
+             */
+            void add_leaf_family(size_t parent_id)
+            {
+                leaf_families.insert(parent_id);
+                if (data(parent_id).refinement_level > 0) {
+                    leaf_families.erase(get_parent_id(parent_id));
+                }
+            }
+
+            /**
+             * @brief Function to unregister a parent whose children have just
+             * been removed as a leaf family. Its own parent, if any, becomes
+             * one if none of its other children have children.
+             *
+             * @param parent_id Id of the parent
+             */
+            void remove_leaf_family(size_t parent_id)
+            {
+                leaf_families.erase(parent_id);
+                if (data(parent_id).refinement_level == 0) return;
+                size_t grandparent_id = get_parent_id(parent_id);
+                for (auto c : data(grandparent_id).children)
+                {
+                    if (!data(c).children.empty()) return;
+                }
+                leaf_families.insert(grandparent_id);
+            }
+
             // Deref
             void process_delete_list()
             {
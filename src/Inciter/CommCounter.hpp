@@ -0,0 +1,161 @@
+// *****************************************************************************
+/*!
+  \file      src/Inciter/CommCounter.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Counters of messages and bytes communicated between chares
+  \details   Counters of messages and bytes communicated between chares. A
+    chare counts each message it sends to or receives from a fellow chare,
+    by kind, with the number of bytes its arguments pack to, and the bytes
+    sent to each neighbor chare, so that the number of neighbors and the
+    largest volume exchanged between a pair of chares can be reported, e.g.,
+    to validate partitioner changes or spot pathological chare neighborhoods.
+*/
+// *****************************************************************************
+#ifndef CommCounter_h
+#define CommCounter_h
+
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+
+#include "Types.hpp"
+#include "PUPUtil.hpp"
+
+namespace inciter {
+
+//! Kinds of messages counted
+enum Msg : std::size_t { MLHS=0,        //!< Left-hand side
+                         MGRAD,         //!< Gradients
+                         MRHS,          //!< Right-hand side
+                         MFCT,          //!< Flux-corrected transport
+                         MGHOST,        //!< Setting up DG ghost elements
+                         MSOL,          //!< DG solution on ghosts
+                         MRECO,         //!< DG reconstruction on ghosts
+                         MLIM,          //!< DG limited solution on ghosts
+                         MREFINER,      //!< Mesh refinement protocol
+                         MSORTER,       //!< Mesh reordering protocol
+                         NUMMSG };      //!< Number of kinds
+
+//! Names of kinds of messages counted
+const std::array< const char*, NUMMSG > MsgName{{ "lhs", "grad", "rhs", "fct",
+  "ghost", "sol", "reco", "lim", "refiner", "sorter" }};
+
+//! \brief Communication statistics per kind of message
+//! \details In the communication report vector (of vectors of kinds) entry s
+//!   is summed and entry NUMCOMMSTAT+s is maxed across chares, followed by an
+//!   entry whose first element is the iteration count.
+enum CommStat { NSENT=0,        //!< Number of messages sent
+                BSENT,          //!< Bytes sent
+                NRECV,          //!< Number of messages received
+                BRECV,          //!< Bytes received
+                NNEIGH,         //!< Number of neighbor chares sent to
+                BPAIR,          //!< Largest number of bytes sent to a neighbor
+                ROUND,          //!< Largest rounding error of data sent
+                NUMCOMMSTAT };  //!< Number of statistics
+
+//! Counters of messages and bytes communicated between chares
+class CommCounter {
+
+  public:
+    //! Count a message sent
+    //! \param[in] m Kind of message
+    //! \param[in] c Chare the message is sent to
+    //! \param[in] args Arguments of the message
+    template< typename... Args >
+    void sent( Msg m, int c, const Args&... args ) {
+      auto b = bytes( args... );
+      ++m_count[m][NSENT];
+      m_count[m][BSENT] += b;
+      m_nbytes[m][c] += b;
+    }
+
+    //! Count a message received
+    //! \param[in] m Kind of message
+    //! \param[in] args Arguments of the message
+    template< typename... Args >
+    void received( Msg m, const Args&... args ) {
+      ++m_count[m][NRECV];
+      m_count[m][BRECV] += bytes( args... );
+    }
+
+    //! Record the rounding error of data sent in reduced precision
+    //! \param[in] m Kind of message
+    //! \param[in] e Largest absolute difference between the data sent and the
+    //!   data it was rounded from
+    void rounded( Msg m, tk::real e ) {
+      m_round[m] = std::max( m_round[m], e );
+    }
+
+    //! Add the counts of another counter, e.g., of a chare bound to this one
+    //! \param[in] c Counter whose counts to add
+    void merge( const CommCounter& c ) {
+      for (std::size_t m=0; m<NUMMSG; ++m) {
+        for (std::size_t s=0; s<NNEIGH; ++s) m_count[m][s] += c.m_count[m][s];
+        for (const auto& [ch,b] : c.m_nbytes[m]) m_nbytes[m][ch] += b;
+        m_round[m] = std::max( m_round[m], c.m_round[m] );
+      }
+    }
+
+    //! Query statistics and zero the counters
+    //! \return Communication report vector of vectors of kinds of messages,
+    //!   see CommStat, with the iteration count not yet set
+    std::vector< std::vector< tk::real > > report() {
+      std::vector< std::vector< tk::real > >
+        r( 2*NUMCOMMSTAT+1, std::vector< tk::real >( NUMMSG, 0.0 ) );
+      for (std::size_t m=0; m<NUMMSG; ++m) {
+        for (std::size_t s=0; s<NNEIGH; ++s)
+          r[s][m] = static_cast< tk::real >( m_count[m][s] );
+        r[NNEIGH][m] = static_cast< tk::real >( m_nbytes[m].size() );
+        for (const auto& nb : m_nbytes[m])
+          r[BPAIR][m] = std::max( r[BPAIR][m],
+                                  static_cast< tk::real >( nb.second ) );
+        r[ROUND][m] = m_round[m];
+        for (std::size_t s=0; s<NUMCOMMSTAT; ++s) r[NUMCOMMSTAT+s][m] = r[s][m];
+        m_count[m].fill( 0 );
+        m_nbytes[m].clear();
+        m_round[m] = 0.0;
+      }
+      return r;
+    }
+
+    /** @name Charm++ pack/unpack serializer member functions */
+    ///@{
+    //! \brief Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    void pup( PUP::er &p ) {
+      p | m_count;
+      p | m_nbytes;
+      p | m_round;
+    }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] c CommCounter object reference
+    friend void operator|( PUP::er& p, CommCounter& c ) { c.pup(p); }
+    //@}
+
+  private:
+    //! Messages and bytes sent and received per kind of message
+    std::array< std::array< std::size_t, NNEIGH >, NUMMSG > m_count{};
+    //! Bytes sent to each neighbor chare per kind of message
+    std::array< std::unordered_map< int, std::size_t >, NUMMSG > m_nbytes;
+    //! Largest rounding error of reduced-precision data sent per kind
+    std::array< tk::real, NUMMSG > m_round{};
+
+    //! Number of bytes the arguments of a message pack to
+    //! \param[in] args Arguments of the message
+    //! \return Number of bytes the arguments pack to
+    template< typename... Args >
+    static std::size_t bytes( const Args&... args ) {
+      PUP::sizer s;
+      ( (s | const_cast< Args& >( args )), ... );
+      return s.size();
+    }
+};
+
+} // inciter::
+
+#endif // CommCounter_h
@@ -13,23 +13,30 @@
 */
 // *****************************************************************************
 
+#include <cmath>
 #include <algorithm>
 #include <numeric>
+#include <map>
+#include <iterator>
 #include <sstream>
 
 #include "DG.hpp"
 #include "Discretization.hpp"
 #include "DGPDE.hpp"
 #include "DiagReducer.hpp"
+#include "SetupReport.hpp"
 #include "DerivedData.hpp"
 #include "ElemDiagnostics.hpp"
 #include "Inciter/InputDeck/InputDeck.hpp"
 #include "Refiner.hpp"
 #include "Limiter.hpp"
 #include "PrefIndicator.hpp"
+#include "Reconstruction.hpp"
 #include "Reorder.hpp"
 #include "Vector.hpp"
 #include "Around.hpp"
+#include "MsgPriority.hpp"
+#include "Integrate/Mass.hpp"
 
 namespace inciter {
 
@@ -37,9 +44,31 @@ extern ctr::InputDeck g_inputdeck;
 extern ctr::InputDeck g_inputdeck_defaults;
 extern std::vector< DGPDE > g_dgpde;
 
-//! Runge-Kutta coefficients
-static const std::array< std::array< tk::real, 3 >, 2 >
-  rkcoef{{ {{ 0.0, 3.0/4.0, 1.0/3.0 }}, {{ 1.0, 1.0/4.0, 2.0/3.0 }} }};
+//! \brief Coefficients of the strong stability preserving Runge-Kutta schemes
+//!   by number of stages
+//! \details Stage k computes u = a[k] un + b[k] (u + c[k] dt R(u)), where u
+//!   is the solution of the previous stage and {a,b,c} are the three rows
+//!   of coefficients, see DG::solve(). 3 stages: the third order scheme of
+//!   Shu and Osher, SSP coefficient 1, 4 stages: the third order scheme of
+//!   Spiteri and Ruuth, SSP coefficient 2.
+static const std::map< std::size_t, std::array< std::vector< tk::real >, 3 > >
+  rkcoefs{
+    { 3, {{ { 0.0, 3.0/4.0, 1.0/3.0 },
+            { 1.0, 1.0/4.0, 2.0/3.0 },
+            { 1.0, 1.0, 1.0 } }} },
+    { 4, {{ { 0.0, 0.0, 2.0/3.0, 0.0 },
+            { 1.0, 1.0, 1.0/3.0, 1.0 },
+            { 1.0/2.0, 1.0/2.0, 1.0/2.0, 1.0/2.0 } }} } };
+
+//! Runge-Kutta coefficients of the number of stages configured
+//! \return Stage coefficients of the Runge-Kutta scheme configured
+static const std::array< std::vector< tk::real >, 3 >& rkcoef() {
+  const auto n = g_inputdeck.get< tag::discr, tag::rkstages >();
+  const auto c = rkcoefs.find( n );
+  ErrChk( c != end(rkcoefs), "DG does not support Runge-Kutta schemes with "
+          + std::to_string(n) + " stages" );
+  return c->second;
+}
 
 } // inciter::
 
@@ -49,6 +78,7 @@ DG::DG( const CProxy_Discretization& disc,
         const std::map< int, std::vector< std::size_t > >& bface,
         const std::map< int, std::vector< std::size_t > >& /* bnode */,
         const std::vector< std::size_t >& triinpoel ) :
+  m_setupt0( CkWallTimer() ),
   m_disc( disc ),
   m_ncomfac( 0 ),
   m_nadj( 0 ),
@@ -72,10 +102,10 @@ DG::DG( const CProxy_Discretization& disc,
     m_p.nprop()/g_inputdeck.get< tag::discr, tag::rdof >()),
   m_geoFace( tk::genGeoFaceTri( m_fd.Nipfac(), m_fd.Inpofa(), Disc()->Coord()) ),
   m_geoElem( tk::genGeoElemTet( Disc()->Inpoel(), Disc()->Coord() ) ),
-  m_lhs( m_u.nunk(),
+  m_lhsls(),
+  m_rhs( m_u.nunk(),
          g_inputdeck.get< tag::discr, tag::ndof >()*
          g_inputdeck.get< tag::component >().nprop() ),
-  m_rhs( m_u.nunk(), m_lhs.nprop() ),
   m_nfac( m_fd.Inpofa().size()/3 ),
   m_nunk( m_u.nunk() ),
   m_ncoord( Disc()->Coord()[0].size() ),
@@ -86,15 +116,38 @@ DG::DG( const CProxy_Discretization& disc,
   m_ghost(),
   m_exptGhost(),
   m_recvGhost(),
+  m_ghostch(),
+  m_sendoff(),
+  m_sendel(),
+  m_recvoff(),
+  m_recvbid(),
   m_diag(),
   m_stage( 0 ),
+  m_dte(),
+  m_finished( 0 ),
   m_ndof(),
+  m_ndofbkt(),
   m_bid(),
   m_uc(),
   m_pc(),
   m_ndofc(),
+  m_limc(),
   m_initial( 1 ),
-  m_expChBndFace()
+  m_expChBndFace(),
+  m_dtlag( 0.0 ),
+  m_dtlocal( 0.0 ),
+  m_dtpending( 0 ),
+  m_dtwait( 0 ),
+  m_stepctl( g_inputdeck.get< tag::discr, tag::rktol >() ),
+  m_dterr( -1.0 ),
+  m_u1(),
+  m_kit( 0 ),
+  m_res(),
+  m_krylov(),
+  m_arnoldi(),
+  m_hcol(),
+  m_unorm( 0.0 ),
+  m_keps( 0.0 )
 // *****************************************************************************
 //  Constructor
 //! \param[in] disc Discretization proxy
@@ -111,6 +164,16 @@ DG::DG( const CProxy_Discretization& disc,
   Assert( !tk::leakyPartition(m_fd.Esuel(), Disc()->Inpoel(), Disc()->Coord()),
           "Input mesh to DG leaky" );
 
+  // Report the time of generating the derived data, then time setting up the
+  // face adjacency and ghosts across chare boundaries
+  if (g_inputdeck.get< tag::cmd, tag::feedback >()) {
+    auto now = CkWallTimer();
+    contribute( setupreport( { { TDERIVED, now - m_setupt0 } } ),
+      CkReduction::max_double,
+      CkCallback( CkReductionTarget(Transporter,setuptime), Disc()->Tr() ) );
+    m_setupt0 = now;
+  }
+
   // Ensure mesh physical boundary for the entire problem not leaky,
   // effectively checking if the user has specified boundary conditions on all
   // physical boundary faces
@@ -236,6 +299,7 @@ DG::resizeComm()
   else
     // for all chares we share nodes with
     for (const auto& c : d->NodeCommMap()) {
+      d->Comm().sent( MGHOST, c.first, thisIndex, potbndface );
       thisProxy[ c.first ].comfac( thisIndex, potbndface );
     }
 
@@ -334,6 +398,8 @@ DG::comfac( int fromch, const tk::UnsMesh::FaceSet& infaces )
 //! \param[in] infaces Unique set of faces we potentially share with fromch
 // *****************************************************************************
 {
+  Disc()->Comm().received( MGHOST, fromch, infaces );
+
   // Buffer up incoming data
   m_infaces[ fromch ] = infaces;
 
@@ -434,8 +500,10 @@ DG::bndFaces()
   // with. This is so that we can test for completing by querying the size of
   // the already complete node commincation map in reqGhost. Requests in
   // sendGhost will only be fullfilled based on m_ghostData.
-  for (const auto& c : d->NodeCommMap())  // for all chares we share nodes with
+  for (const auto& c : d->NodeCommMap()) { // for all chares we share nodes with
+    d->Comm().sent( MGHOST, c.first );
     thisProxy[ c.first ].reqGhost();
+  }
 }
 
 bool
@@ -586,6 +654,8 @@ DG::reqGhost()
 // Receive requests for ghost data
 // *****************************************************************************
 {
+  Disc()->Comm().received( MGHOST );
+
   // If every chare we communicate with has requested ghost data from us, we may
   // fulfill the requests, but only if we have already setup our ghost data.
   if (++m_ghostReq == Disc()->NodeCommMap().size()) {
@@ -600,8 +670,10 @@ DG::sendGhost()
 // Send all of our ghost data to fellow chares
 // *****************************************************************************
 {
-  for (const auto& c : m_ghostData)
+  for (const auto& c : m_ghostData) {
+    Disc()->Comm().sent( MGHOST, c.first, thisIndex, c.second );
     thisProxy[ c.first ].comGhost( thisIndex, c.second );
+  }
 
   if ( g_inputdeck.get< tag::cmd, tag::feedback >() ) Disc()->Tr().chghost();
 }
@@ -631,6 +703,7 @@ DG::comGhost( int fromch, const GhostData& ghost )
 // *****************************************************************************
 {
   auto d = Disc();
+  d->Comm().received( MGHOST, fromch, ghost );
   const auto& lid = d->Lid();
   auto& inpofa = m_fd.Inpofa();
   auto& inpoel = d->Inpoel();
@@ -998,6 +1071,7 @@ DG::nodeNeighSetup()
         }
       }
 
+      Disc()->Comm().sent( MGHOST, cid, thisIndex, bndEsup, nodeBndCells );
       thisProxy[cid].comEsup(thisIndex, bndEsup, nodeBndCells);
     }
   }
@@ -1020,6 +1094,7 @@ DG::comEsup( int fromch,
 //!   remote element IDs in the esup
 // *****************************************************************************
 {
+  Disc()->Comm().received( MGHOST, fromch, bndEsup, nodeBndCells );
   auto& chghost = m_ghost[fromch];
 
   // Extend remote-local element id map and element geometry array
@@ -1086,11 +1161,10 @@ DG::adj()
     for([[maybe_unused]] const auto& i : n.second)
       Assert( i < m_fd.Esuel().size()/4, "Sender contains ghost tet id. ");
 
-  // Resize solution vectors, lhs and rhs by the number of ghost tets
+  // Resize solution vectors and rhs by the number of ghost tets
   m_u.resize( m_nunk );
   m_un.resize( m_nunk );
   m_p.resize( m_nunk );
-  m_lhs.resize( m_nunk );
   m_rhs.resize( m_nunk );
 
   // Create a mapping between local ghost tet ids and zero-based boundary ids
@@ -1105,8 +1179,9 @@ DG::adj()
 
   // Size communication buffer that receives number of degrees of freedom
   for (auto& n : m_ndofc) n.resize( m_bid.size() );
-  for (auto& u : m_uc) u.resize( m_bid.size() );
-  for (auto& p : m_pc) p.resize( m_bid.size() );
+  for (auto& u : m_uc) u.resize( m_bid.size() * m_u.nprop() );
+  for (auto& p : m_pc) p.resize( m_bid.size() * m_p.nprop() );
+  m_limc.assign( m_bid.size(), 0 );
 
   // Initialize number of degrees of freedom in mesh elements
   const auto pref = g_inputdeck.get< tag::pref, tag::pref >();
@@ -1120,11 +1195,22 @@ DG::adj()
     const auto ndof = g_inputdeck.get< tag::discr, tag::ndof >();
     m_ndof.resize( m_nunk, ndof );
   }
+  m_ndofbkt = tk::bucketNdof( m_ndof, m_fd.Esuel().size()/4 );
 
   // Ensure that we also have all the geometry and connectivity data
   // (including those of ghosts)
   Assert( m_geoElem.nunk() == m_u.nunk(), "GeoElem unknowns size mismatch" );
 
+  // Gather connectivity and geometry of internal faces, now including the
+  // chare-boundary faces, for face loops
+  m_fd.genIntfac( m_geoFace );
+
+  // Compute the inverse of the least-squares reconstruction matrix, which
+  // only depends on the geometry (including that of ghosts), if P0P1
+  if (g_inputdeck.get< tag::discr, tag::rdof >() == 4 &&
+      g_inputdeck.get< tag::discr, tag::ndof >() == 1)
+    tk::invLeastSq_P0P1( m_fd, m_geoElem, m_geoFace, m_lhsls );
+
   // Basic error checking on ghost tet ID map
   Assert( m_ghost.find( thisIndex ) == m_ghost.cend(),
           "Ghost id map should not contain data for own chare ID" );
@@ -1135,25 +1221,33 @@ DG::adj()
       Assert( m_exptGhost.insert( g.second ).second,
               "Failed to store local tetid as exptected ghost id" );
 
+  // Flatten ghost communication maps used for ghost data exchanges
+  ghostLayer();
+
+  // Account memory of the worker at the end of setup
+  if (m_initial && g_inputdeck.get< tag::cmd, tag::feedback >()) {
+    std::array< std::size_t, NUMMEM > b{};
+    b[MMESH] = tk::bytes( m_fd.Bface(), m_fd.Triinpoel() );
+    b[MDERIVED] = tk::bytes( m_fd.Esuel(), m_fd.Inpofa(), m_fd.Belem(),
+                             m_fd.Esuf(), m_fd.Intfac(), m_ndof, m_esup,
+                             m_bid );
+    b[MFIELDS] = tk::bytes( m_u, m_un, m_p, m_Unode, m_Pnode, m_geoFace,
+                             m_geoElem, m_lhsls, m_rhs, m_uc, m_pc,
+                             m_ndofc, m_limc );
+    b[MCOMMAP] = tk::bytes( m_ipface, m_bndFace, m_ghostch, m_sendoff,
+                            m_sendel, m_recvoff, m_recvbid, m_exptGhost,
+                            m_recvGhost, m_expChBndFace, m_infaces, m_esupc );
+    Disc()->memory( b );
+    contribute( setupreport( { { TGHOST, CkWallTimer() - m_setupt0 } } ),
+      CkReduction::max_double,
+      CkCallback( CkReductionTarget(Transporter,setuptime), Disc()->Tr() ) );
+  }
+
   // Signal the runtime system that all workers have received their adjacency
   contribute( sizeof(int), &m_initial, CkReduction::sum_int,
     CkCallback(CkReductionTarget(Transporter,comfinal), Disc()->Tr()) );
 }
 
-void
-DG::registerReducers()
-// *****************************************************************************
-//  Configure Charm++ reduction types
-//! \details Since this is a [initnode] routine, the runtime system executes the
-//!   routine exactly once on every logical node early on in the Charm++ init
-//!   sequence. Must be static as it is called without an object. See also:
-//!   Section "Initializations at Program Startup" at in the Charm++ manual
-//!   http://charm.cs.illinois.edu/manuals/html/charm++/manual.html.
-// *****************************************************************************
-{
-  ElemDiagnostics::registerReducers();
-}
-
 void
 DG::ResumeFromSync()
 // *****************************************************************************
@@ -1170,21 +1264,18 @@ DG::ResumeFromSync()
 void
 DG::setup()
 // *****************************************************************************
-// Set initial conditions, generate lhs, output mesh
+// Set initial conditions, output mesh
 // *****************************************************************************
 {
   auto d = Disc();
 
   // Basic error checking on sizes of element geometry data and connectivity
-  Assert( m_geoElem.nunk() == m_lhs.nunk(), "Size mismatch in DG::setup()" );
-
-  // Compute left-hand side of discrete PDEs
-  lhs();
+  Assert( m_geoElem.nunk() == m_u.nunk(), "Size mismatch in DG::setup()" );
 
   // Set initial conditions for all PDEs
   for (const auto& eq : g_dgpde) 
   {
-    eq.initialize( m_lhs, d->Inpoel(), d->Coord(), m_u, d->T(),
+    eq.initialize( m_geoElem, d->Inpoel(), d->Coord(), m_u, d->T(),
                    m_fd.Esuel().size()/4 );
     eq.updatePrimitives( m_u, m_p, m_fd.Esuel().size()/4 );
   }
@@ -1229,11 +1320,9 @@ DG::next()
 // Advance equations to next time step
 // *****************************************************************************
 {
-  const auto pref = g_inputdeck.get< tag::pref, tag::pref >();
-
   auto d = Disc();
 
-  if (pref && m_stage == 0 && d->T() > 0)
+  if (padapt() && d->T() > 0)
     eval_ndof( m_nunk, Disc()->Coord(), Disc()->Inpoel(), m_fd, m_u,
                g_inputdeck.get< tag::pref, tag::indicator >(),
                g_inputdeck.get< tag::discr, tag::ndof >(),
@@ -1241,25 +1330,28 @@ DG::next()
                g_inputdeck.get< tag::pref, tag::tolref >(),
                m_ndof );
 
-  // communicate solution ghost data (if any)
-  if (m_sendGhost.empty())
+  // communicate solution ghost data (if any), neighbors on the same PE are
+  // only notified after their receive buffers have been filled directly
+  if (m_ghostch.empty())
     comsol_complete();
   else
-    for(const auto& [cid, ghostdata] : m_sendGhost) {
-      std::vector< std::size_t > tetid( ghostdata.size() );
-      std::vector< std::vector< tk::real > > u( ghostdata.size() ),
-                                             prim( ghostdata.size() );
-      std::vector< std::size_t > ndof;
-      std::size_t j = 0;
-      for(const auto& i : ghostdata) {
-        Assert( i < m_fd.Esuel().size()/4, "Sending solution ghost data" );
-        tetid[j] = i;
-        u[j] = m_u[i];
-        prim[j] = m_p[i];
-        if (pref && m_stage == 0) ndof.push_back( m_ndof[i] );
-        ++j;
+    for (std::size_t n=0; n<m_ghostch.size(); ++n) {
+      auto cid = m_ghostch[n];
+      auto nb = thisProxy[ cid ].ckLocal();
+      if (nb) {
+        d->Comm().rounded( MSOL, localGhost( n, *nb ) );
+        d->Comm().sent( MSOL, cid, thisIndex, m_stage );
+        thisProxy[ cid ].comlocsol( thisIndex, m_stage, msgopts( MSOL ) );
+        continue;
       }
-      thisProxy[ cid ].comsol( thisIndex, m_stage, tetid, u, prim, ndof );
+      std::vector< std::size_t > tetid, ndof;
+      std::vector< tk::real > u, prim;
+      std::vector< float > high;
+      d->Comm().rounded( MSOL, packGhost( n, {}, tetid, u, prim, high, ndof ) );
+      d->Comm().sent( MSOL, cid, thisIndex, m_stage, tetid, u, prim, high,
+                      ndof );
+      thisProxy[ cid ].comsol( thisIndex, m_stage, tetid, u, prim, high,
+                               ndof, msgopts( MSOL ) );
     }
 
   ownsol_complete();
@@ -1269,49 +1361,52 @@ void
 DG::comsol( int fromch,
             std::size_t fromstage,
             const std::vector< std::size_t >& tetid,
-            const std::vector< std::vector< tk::real > >& u,
-            const std::vector< std::vector< tk::real > >& prim,
+            const std::vector< tk::real >& u,
+            const std::vector< tk::real >& prim,
+            const std::vector< float >& high,
             const std::vector< std::size_t >& ndof )
 // *****************************************************************************
 //  Receive chare-boundary solution ghost data from neighboring chares
 //! \param[in] fromch Sender chare id
 //! \param[in] fromstage Sender chare time step stage
-//! \param[in] tetid Ghost tet ids we receive solution data for
-//! \param[in] u Solution ghost data
-//! \param[in] prim Primitive variables in ghost cells
+//! \param[in] tetid Positions of the ghost tets we receive solution data for,
+//!   empty if all are received, see packGhost()
+//! \param[in] u Solution ghost data, flattened, see packGhost()
+//! \param[in] prim Primitive variables in ghost cells, flattened
+//! \param[in] high High-order modes in single precision, see packGhost()
 //! \param[in] ndof Number of degrees of freedom for chare-boundary elements
 //! \details This function receives contributions to the unlimited solution
 //!   from fellow chares.
 // *****************************************************************************
 {
-  Assert( u.size() == tetid.size(), "Size mismatch in DG::comsol()" );
-  Assert( prim.size() == tetid.size(), "Size mismatch in DG::comsol()" );
-
-  const auto pref = g_inputdeck.get< tag::pref, tag::pref >();
+  Disc()->Comm().received( MSOL, fromch, fromstage, tetid, u, prim, high,
+                           ndof );
 
-  if (pref && fromstage == 0)
-    Assert( ndof.size() == tetid.size(), "Size mismatch in DG::comsol()" );
-
-  // Find local-to-ghost tet id map for sender chare
-  const auto& n = tk::cref_find( m_ghost, fromch );
-
-  for (std::size_t i=0; i<tetid.size(); ++i) {
-    auto j = tk::cref_find( n, tetid[i] );
-    Assert( j >= m_fd.Esuel().size()/4, "Receiving solution non-ghost data" );
-    auto b = tk::cref_find( m_bid, j );
-    Assert( b < m_uc[0].size(), "Indexing out of bounds" );
-    m_uc[0][b] = u[i];
-    m_pc[0][b] = prim[i];
-    if (pref && fromstage == 0) {
-      Assert( b < m_ndofc[0].size(), "Indexing out of bounds" );
-      m_ndofc[0][b] = ndof[i];
-    }
-  }
+  unpackGhost( fromch, 0, tetid, u, prim, high, ndof, !ndof.empty() );
 
   // if we have received all solution ghost contributions from neighboring
   // chares (chares we communicate along chare-boundary faces with), and
   // contributed our solution to these neighbors, proceed to reconstructions
-  if (++m_nsol == m_sendGhost.size()) {
+  if (++m_nsol == m_ghostch.size()) {
+    m_nsol = 0;
+    comsol_complete();
+  }
+}
+
+void
+DG::comlocsol( int fromch, std::size_t fromstage )
+// *****************************************************************************
+//  Receive notice that a neighbor chare on the same PE has copied its
+//  chare-boundary solution ghost data to our receive buffers
+//! \param[in] fromch Sender chare id
+//! \param[in] fromstage Sender chare time step stage
+//! \details The solution ghost data has been copied by the sender, see
+//!   localGhost(), so this only counts the contribution, see comsol().
+// *****************************************************************************
+{
+  Disc()->Comm().received( MSOL, fromch, fromstage );
+
+  if (++m_nsol == m_ghostch.size()) {
     m_nsol = 0;
     comsol_complete();
   }
@@ -1358,8 +1453,12 @@ DG::writeFields( CkCallback c )
 
       // cut off ghost elements from element output
       for (auto& f : eo) f.resize( nielem );
-      elemfields.insert( end(elemfields), begin(eo), end(eo) );
-      nodefields.insert( end(nodefields), begin(no), end(no) );
+      elemfields.insert( end(elemfields),
+                         std::make_move_iterator( begin(eo) ),
+                         std::make_move_iterator( end(eo) ) );
+      nodefields.insert( end(nodefields),
+                         std::make_move_iterator( begin(no) ),
+                         std::make_move_iterator( end(no) ) );
     }
 
     // chop off ghosts from mesh for dump
@@ -1372,8 +1471,9 @@ DG::writeFields( CkCallback c )
     elemfields.push_back( ndof );
 
     // Output chare mesh and fields metadata to file
-    d->write( inpoel, coord, m_fd.Bface(), {}, m_fd.Triinpoel(), elemfieldnames,
-              nodalfieldnames, {}, elemfields, nodefields, {}, c );
+    d->write( true, inpoel, coord, m_fd.Bface(), {}, m_fd.Triinpoel(),
+              elemfieldnames, nodalfieldnames, {}, elemfields, nodefields, {},
+              c );
   }
 }
 
@@ -1381,9 +1481,13 @@ void
 DG::lhs()
 // *****************************************************************************
 // Compute left-hand side of discrete transport equations
+//! \details The DG mass matrix is diagonal and only depends on the element
+//!   volumes, so it is not stored but applied in solve() via the volumes in
+//!   m_geoElem and tk::dubinerInvMass. This only continues time stepping
+//!   after mesh refinement.
 // *****************************************************************************
 {
-  for (const auto& eq : g_dgpde) eq.lhs( m_geoElem, m_lhs );
+  Disc()->phase( LHS );
 
   if (!m_initial) stage();
 }
@@ -1394,26 +1498,14 @@ DG::reco()
 // Compute reconstructions
 // *****************************************************************************
 {
-  const auto pref = g_inputdeck.get< tag::pref, tag::pref >();
+  Disc()->phase( GRAD );
   const auto rdof = g_inputdeck.get< tag::discr, tag::rdof >();
 
   // Combine own and communicated contributions of unreconstructed solution and
   // degrees of freedom in cells (if p-adaptive)
-  for (const auto& b : m_bid) {
-    Assert( m_uc[0][b.second].size() == m_u.nprop(), "ncomp size mismatch" );
-    Assert( m_pc[0][b.second].size() == m_p.nprop(), "ncomp size mismatch" );
-    for (std::size_t c=0; c<m_u.nprop(); ++c) {
-      m_u(b.first,c,0) = m_uc[0][b.second][c];
-    }
-    for (std::size_t c=0; c<m_p.nprop(); ++c) {
-      m_p(b.first,c,0) = m_pc[0][b.second][c];
-    }
-    if (pref && m_stage == 0) {
-      m_ndof[ b.first ] = m_ndofc[0][ b.second ];
-    }
-  }
+  combineGhost( 0, padapt() );
 
-  if (pref && m_stage==0) propagate_ndof();
+  if (padapt()) propagate_ndof();
 
   if (rdof > 1) {
     auto d = Disc();
@@ -1422,144 +1514,507 @@ DG::reco()
     // if P0P1
     if (rdof == 4 && g_inputdeck.get< tag::discr, tag::ndof >() == 1)
       for (const auto& eq : g_dgpde)
-        eq.reconstruct( d->T(), m_geoFace, m_geoElem, m_fd, m_esup, d->Inpoel(),
-                        d->Coord(), m_u, m_p );
+        eq.reconstruct( d->T(), m_geoFace, m_geoElem, m_fd, m_lhsls, m_esup,
+                        d->Inpoel(), d->Coord(), m_u, m_p );
   }
 
-  // Send reconstructed solution to neighboring chares
-  if (m_sendGhost.empty())
+  // Send reconstructed solution to neighboring chares, unless the ghost data
+  // is the same as what was received after the solution update
+  if (m_ghostch.empty() || !recoGhost())
     comreco_complete();
   else
-    for(const auto& [cid, ghostdata] : m_sendGhost) {
-      std::vector< std::size_t > tetid( ghostdata.size() );
-      std::vector< std::vector< tk::real > > u( ghostdata.size() ),
-                                             prim( ghostdata.size() );
-      std::vector< std::size_t > ndof;
-      std::size_t j = 0;
-      for(const auto& i : ghostdata) {
-        Assert( i < m_fd.Esuel().size()/4, "Sending reconstructed ghost "
-          "data" );
-        tetid[j] = i;
-        u[j] = m_u[i];
-        prim[j] = m_p[i];
-        if (pref && m_stage == 0) ndof.push_back( m_ndof[i] );
-        ++j;
-      }
-      thisProxy[ cid ].comreco( thisIndex, tetid, u, prim, ndof );
+    for (std::size_t n=0; n<m_ghostch.size(); ++n) {
+      auto cid = m_ghostch[n];
+      std::vector< std::size_t > tetid, ndof;
+      std::vector< tk::real > u, prim;
+      std::vector< float > high;
+      Disc()->Comm().rounded( MRECO,
+        packGhost( n, {}, tetid, u, prim, high, ndof ) );
+      Disc()->Comm().sent( MRECO, cid, thisIndex, tetid, u, prim, high,
+                           ndof );
+      thisProxy[ cid ].comreco( thisIndex, tetid, u, prim, high, ndof,
+                                msgopts( MRECO ) );
     }
 
+  Disc()->phase( WAIT );
   ownreco_complete();
 }
 
 void
 DG::comreco( int fromch,
              const std::vector< std::size_t >& tetid,
-             const std::vector< std::vector< tk::real > >& u,
-             const std::vector< std::vector< tk::real > >& prim,
+             const std::vector< tk::real >& u,
+             const std::vector< tk::real >& prim,
+             const std::vector< float >& high,
              const std::vector< std::size_t >& ndof )
 // *****************************************************************************
 //  Receive chare-boundary reconstructed ghost data from neighboring chares
 //! \param[in] fromch Sender chare id
-//! \param[in] tetid Ghost tet ids we receive solution data for
-//! \param[in] u Reconstructed high-order solution
-//! \param[in] prim Limited high-order primitive quantities
+//! \param[in] tetid Positions of the ghost tets we receive data for, empty
+//!   if all are received, see packGhost()
+//! \param[in] u Reconstructed high-order solution, flattened
+//! \param[in] prim Limited high-order primitive quantities, flattened
+//! \param[in] high High-order modes in single precision, see packGhost()
 //! \param[in] ndof Number of degrees of freedom for chare-boundary elements
 //! \details This function receives contributions to the reconstructed solution
 //!   from fellow chares.
 // *****************************************************************************
 {
-  Assert( u.size() == tetid.size(), "Size mismatch in DG::comreco()" );
-  Assert( prim.size() == tetid.size(), "Size mismatch in DG::comreco()" );
-
-  const auto pref = g_inputdeck.get< tag::pref, tag::pref >();
+  Disc()->Comm().received( MRECO, fromch, tetid, u, prim, high, ndof );
 
-  if (pref && m_stage == 0)
-    Assert( ndof.size() == tetid.size(), "Size mismatch in DG::comreco()" );
-
-  // Find local-to-ghost tet id map for sender chare
-  const auto& n = tk::cref_find( m_ghost, fromch );
-
-  for (std::size_t i=0; i<tetid.size(); ++i) {
-    auto j = tk::cref_find( n, tetid[i] );
-    Assert( j >= m_fd.Esuel().size()/4, "Receiving solution non-ghost data" );
-    auto b = tk::cref_find( m_bid, j );
-    Assert( b < m_uc[1].size(), "Indexing out of bounds" );
-    Assert( b < m_pc[1].size(), "Indexing out of bounds" );
-    m_uc[1][b] = u[i];
-    m_pc[1][b] = prim[i];
-    if (pref && m_stage == 0) {
-      Assert( b < m_ndofc[1].size(), "Indexing out of bounds" );
-      m_ndofc[1][b] = ndof[i];
-    }
-  }
+  unpackGhost( fromch, 1, tetid, u, prim, high, ndof, padapt() );
 
   // if we have received all solution ghost contributions from neighboring
   // chares (chares we communicate along chare-boundary faces with), and
   // contributed our solution to these neighbors, proceed to limiting
-  if (++m_nreco == m_sendGhost.size()) {
+  if (++m_nreco == m_ghostch.size()) {
     m_nreco = 0;
     comreco_complete();
   }
 }
 
+void
+DG::ghostLayer()
+// *****************************************************************************
+//  Flatten ghost communication maps into send and receive lists
+//! \details For each chare we exchange ghost data with, in increasing order of
+//!   chare ids, the local ids of our elements that are ghosts on that chare
+//!   are stored contiguously in m_sendel, and the receive buffer ids of the
+//!   ghosts owned by that chare are stored contiguously in m_recvbid. Both
+//!   lists are in increasing order of the local element ids on the owner
+//!   chare, so the sender and the receiver agree on the position of each
+//!   ghost tet and ghost data can be packed and unpacked by position. The
+//!   maps the lists are generated from are only needed during setup and are
+//!   freed.
+// *****************************************************************************
+{
+  Assert( m_sendGhost.size() == m_ghost.size(),
+          "Chares sending and receiving ghost data must match" );
+
+  m_ghostch.clear();
+  m_sendel.clear();
+  m_recvbid.clear();
+  m_sendoff.assign( 1, 0 );
+  m_recvoff.assign( 1, 0 );
+
+  for (const auto& [c,s] : m_sendGhost) m_ghostch.push_back( c );
+  std::sort( begin(m_ghostch), end(m_ghostch) );
+
+  for (auto c : m_ghostch) {
+    const auto& s = tk::cref_find( m_sendGhost, c );
+    auto b = m_sendel.size();
+    m_sendel.insert( end(m_sendel), begin(s), end(s) );
+    std::sort( begin(m_sendel) + static_cast< std::ptrdiff_t >( b ),
+               end(m_sendel) );
+    m_sendoff.push_back( m_sendel.size() );
+
+    const auto& g = tk::cref_find( m_ghost, c );
+    std::vector< std::pair< std::size_t, std::size_t > > r( begin(g), end(g) );
+    std::sort( begin(r), end(r) );
+    for (const auto& [remote,local] : r)
+      m_recvbid.push_back( tk::cref_find( m_bid, local ) );
+    m_recvoff.push_back( m_recvbid.size() );
+  }
+
+  tk::destroy( m_sendGhost );
+  tk::destroy( m_ghost );
+}
+
 void
 DG::lim()
 // *****************************************************************************
 // Compute limiter function
 // *****************************************************************************
 {
-  const auto pref = g_inputdeck.get< tag::pref, tag::pref >();
+  Disc()->phase( GRAD );
   const auto rdof = g_inputdeck.get< tag::discr, tag::rdof >();
 
   // Combine own and communicated contributions of unlimited solution, and
   // if a p-adaptive algorithm is used, degrees of freedom in cells
-  for (const auto& [boundary, localtet] : m_bid) {
-    Assert( m_uc[1][localtet].size() == m_u.nprop(), "ncomp size mismatch" );
-    Assert( m_pc[1][localtet].size() == m_p.nprop(), "ncomp size mismatch" );
-    for (std::size_t c=0; c<m_u.nprop(); ++c) {
-      m_u(boundary,c,0) = m_uc[1][localtet][c];
-    }
-    for (std::size_t c=0; c<m_p.nprop(); ++c) {
-      m_p(boundary,c,0) = m_pc[1][localtet][c];
-    }
-    if (pref && m_stage == 0) {
-      m_ndof[ boundary ] = m_ndofc[1][ localtet ];
-    }
-  }
+  if (recoGhost()) combineGhost( 1, padapt() );
+
+  // Ids of elements limited (troubled cells)
+  std::vector< std::size_t > troubled;
 
   if (rdof > 1) {
     auto d = Disc();
 
+    troubled = troubledCells( m_fd.Esuel().size()/4, m_ndof, m_u, m_p );
+
     for (const auto& eq : g_dgpde)
       eq.limit( d->T(), m_geoFace, m_geoElem, m_fd, m_esup, d->Inpoel(),
-                d->Coord(), m_ndof, m_u, m_p );
+                d->Coord(), m_ndof, troubled, m_u, m_p );
   }
 
-
-  // Send limited solution to neighboring chares
-  if (m_sendGhost.empty())
+  // Send limited solution to neighboring chares, unless the ghost data is
+  // the same as what was received before limiting. Only the troubled cells
+  // are sent, since the rest of the ghost data has not changed by limiting.
+  if (m_ghostch.empty() || !limGhost())
     comlim_complete();
-  else
-    for(const auto& [cid, ghostdata] : m_sendGhost) {
-      std::vector< std::size_t > tetid( ghostdata.size() );
-      std::vector< std::vector< tk::real > > u( ghostdata.size() ),
-                                             prim( ghostdata.size() );
-      std::vector< std::size_t > ndof;
-      std::size_t j = 0;
-      for(const auto& i : ghostdata) {
-        Assert( i < m_fd.Esuel().size()/4, "Sending limiter ghost data" );
-        tetid[j] = i;
-        u[j] = m_u[i];
-        prim[j] = m_p[i];
-        if (pref && m_stage == 0) ndof.push_back( m_ndof[i] );
-        ++j;
-      }
-      thisProxy[ cid ].comlim( thisIndex, tetid, u, prim, ndof );
+  else {
+    std::vector< char > limited( m_fd.Esuel().size()/4, 0 );
+    for (auto e : troubled) limited[e] = 1;
+    for (std::size_t n=0; n<m_ghostch.size(); ++n) {
+      auto cid = m_ghostch[n];
+      std::vector< std::size_t > tetid, ndof;
+      std::vector< tk::real > u, prim;
+      std::vector< float > high;
+      Disc()->Comm().rounded( MLIM,
+        packGhost( n, limited, tetid, u, prim, high, ndof ) );
+      Disc()->Comm().sent( MLIM, cid, thisIndex, tetid, u, prim, high,
+                           ndof );
+      thisProxy[ cid ].comlim( thisIndex, tetid, u, prim, high, ndof,
+                               msgopts( MLIM ) );
     }
+  }
+
+  // Compute the part of the right hand side that does not depend on ghost
+  // data while the limited ghost data and the time step size are communicated
+  Disc()->phase( RHS );
+  rhs( RhsPart::OWN );
 
+  Disc()->phase( WAIT );
   ownlim_complete();
 }
 
+bool
+DG::recoGhost() const
+// *****************************************************************************
+//  Query if reconstructed ghost data needs to be exchanged
+//! \return True if reconstruction may change the data of elements that are
+//!   ghosts on other chares
+//! \details Without p-adaptation, which changes the number of degrees of
+//!   freedom in reco(), and without reconstruction, which is only done for
+//!   rDG(P0P1), the data exchanged after reco() is the same as the data
+//!   exchanged after the solution update, so the second exchange round of the
+//!   stage can be skipped. This is decided on the input deck, the stage, and
+//!   the time step count only, so all chares agree.
+// *****************************************************************************
+{
+  const auto ndof = g_inputdeck.get< tag::discr, tag::ndof >();
+  const auto rdof = g_inputdeck.get< tag::discr, tag::rdof >();
+
+  return padapt() || rdof > ndof;
+}
+
+bool
+DG::padapt() const
+// *****************************************************************************
+//  Query if the number of degrees of freedom is adapted in this stage
+//! \return True if p-adaptive and this is the first stage of a time step at
+//!   which p-refinement is configured to be done, see tag::pref, tag::dtfreq
+//! \details Only in these stages are the p-refinement indicator evaluated,
+//!   the number of degrees of freedom exchanged with neighbor chares, and
+//!   the coefficients of deactivated modes zeroed. In between, the number of
+//!   degrees of freedom of all elements stays the same.
+// *****************************************************************************
+{
+  const auto pref = g_inputdeck.get< tag::pref, tag::pref >();
+  const auto dtfreq = g_inputdeck.get< tag::pref, tag::dtfreq >();
+
+  return pref && m_stage == 0 && Disc()->It() % dtfreq == 0;
+}
+
+bool
+DG::limGhost() const
+// *****************************************************************************
+//  Query if limited ghost data needs to be exchanged
+//! \return True if limiting may change the data of elements that are ghosts
+//!   on other chares
+//! \details Without high-order dofs or without a limiter, lim() does not
+//!   change the solution, so the data exchanged after lim() is the same as
+//!   that exchanged before it, and the third exchange round of the stage can
+//!   be skipped. This is decided on the input deck only, so all chares agree.
+// *****************************************************************************
+{
+  const auto rdof = g_inputdeck.get< tag::discr, tag::rdof >();
+  const auto limiter = g_inputdeck.get< tag::discr, tag::limiter >();
+
+  return rdof > 1 && limiter != ctr::LimiterType::NOLIMITER;
+}
+
+bool
+DG::dtctl() const
+// *****************************************************************************
+//  Query if the time step size is selected by the local error estimate
+//! \return True if the time step size is bounded by the one selected from
+//!   the local time error estimate of the previous time step
+//! \details Only used with explicit time stepping, with the time step size
+//!   computed from the CFL condition, and without local time stepping. The
+//!   first stage of the SSP Runge-Kutta schemes is a scaled forward Euler
+//!   step, see rkcoefs, which is the embedded scheme of the error estimate.
+// *****************************************************************************
+{
+  return m_stepctl.enabled() &&
+         !g_inputdeck.get< tag::discr, tag::steady_state >() &&
+         !g_inputdeck.get< tag::discr, tag::implicit >() &&
+         std::abs( g_inputdeck.get< tag::discr, tag::dt >() -
+                   g_inputdeck_defaults.get< tag::discr, tag::dt >() ) <
+           std::numeric_limits< tk::real >::epsilon();
+}
+
+bool
+DG::reducedGhost() const
+// *****************************************************************************
+//  Query if high-order ghost data is exchanged in single precision
+//! \return True if the high-order modes of ghost data are sent as floats
+//! \details Only the high-order modes are truncated: cell averages are always
+//!   sent in double precision, so the conservative update of the ghosts'
+//!   neighbors and the bounds computed by the limiters from the averages are
+//!   unaffected. This is decided on the input deck only, so all chares agree.
+// *****************************************************************************
+{
+  const auto rdof = g_inputdeck.get< tag::discr, tag::rdof >();
+
+  return rdof > 1 && g_inputdeck.get< tag::discr, tag::reducedghost >();
+}
+
+tk::real
+DG::packGhost( std::size_t n,
+               const std::vector< char >& flag,
+               std::vector< std::size_t >& tetid,
+               std::vector< tk::real >& u,
+               std::vector< tk::real >& prim,
+               std::vector< float >& high,
+               std::vector< std::size_t >& ndof ) const
+// *****************************************************************************
+//  Pack ghost data to be sent to a neighbor chare
+//! \param[in] n Position of the neighbor chare in m_ghostch
+//! \param[in] flag If not empty, only the elements flagged nonzero are sent
+//! \param[in,out] tetid Positions of the ghost tets sent in the send list of
+//!   the neighbor, only packed if not all are sent
+//! \param[in,out] u Solution of ghost tets, m_u.nprop() values per tet
+//! \param[in,out] prim Primitive variables of ghost tets, m_p.nprop() values
+//!   per tet
+//! \param[in,out] high High-order modes of the solution and primitive
+//!   variables of ghost tets in single precision, only packed if reduced
+//!   precision ghost data is configured, in which case u and prim only
+//!   contain the cell averages
+//! \param[in,out] ndof Number of degrees of freedom of ghost tets, only
+//!   packed if the number of degrees of freedom is adapted, see padapt()
+//! \return Largest absolute rounding error of the modes packed in single
+//!   precision, zero if ghost data is sent in full precision
+//! \details The solution and primitive variables of all ghost tets are sent
+//!   in a single flat array each, instead of one vector per tet. Ghost tets
+//!   are identified by their position in the send list, which is the same as
+//!   that in the receive list of the neighbor, see ghostLayer().
+// *****************************************************************************
+{
+  const auto withndof = padapt();
+  const auto rdof = g_inputdeck.get< tag::discr, tag::rdof >();
+  const auto reduced = reducedGhost();
+  const auto nu = m_u.nprop();
+  const auto np = m_p.nprop();
+  const auto b = m_sendoff[n];
+  const auto e = m_sendoff[n+1];
+
+  tetid.clear();
+  u.clear();
+  prim.clear();
+  high.clear();
+  ndof.clear();
+  u.reserve( (e-b) * (reduced ? nu/rdof : nu) );
+  prim.reserve( (e-b) * (reduced ? np/rdof : np) );
+  if (reduced) high.reserve( (e-b) * (nu+np) / rdof * (rdof-1) );
+
+  // Pack a degree of freedom in double precision if it is a cell average or
+  // ghost data is sent in full precision, in single precision otherwise
+  tk::real err = 0.0;
+  auto pack = [&]( tk::real v, std::size_t c, std::vector< tk::real >& d ){
+    if (!reduced || c % rdof == 0)
+      d.push_back( v );
+    else {
+      high.push_back( static_cast< float >( v ) );
+      err = std::max( err, std::abs( v - static_cast< tk::real >(
+                                           high.back() ) ) );
+    }
+  };
+
+  for (auto j=b; j<e; ++j) {
+    auto i = m_sendel[j];
+    Assert( i < m_fd.Esuel().size()/4, "Sending non-owned ghost data" );
+    if (!flag.empty()) {
+      if (!flag[i]) continue;
+      tetid.push_back( j-b );
+    }
+    for (std::size_t c=0; c<nu; ++c) pack( m_u(i,c,0), c, u );
+    for (std::size_t c=0; c<np; ++c) pack( m_p(i,c,0), c, prim );
+    if (withndof) ndof.push_back( m_ndof[i] );
+  }
+
+  return err;
+}
+
+void
+DG::unpackGhost( int fromch,
+                 std::size_t k,
+                 const std::vector< std::size_t >& tetid,
+                 const std::vector< tk::real >& u,
+                 const std::vector< tk::real >& prim,
+                 const std::vector< float >& high,
+                 const std::vector< std::size_t >& ndof,
+                 bool withndof )
+// *****************************************************************************
+//  Unpack ghost data received from a neighbor chare into receive buffers
+//! \param[in] fromch Sender chare id
+//! \param[in] k Receive buffer index: 0: solution, 1: reconstruction,
+//!   2: limiting
+//! \param[in] tetid Positions of the ghost tets received in the receive list
+//!   of the sender, empty if all are received, see packGhost()
+//! \param[in] u Solution of ghost tets, flattened
+//! \param[in] prim Primitive variables of ghost tets, flattened
+//! \param[in] high High-order modes of ghost tets in single precision, see
+//!   packGhost()
+//! \param[in] ndof Number of degrees of freedom of ghost tets
+//! \param[in] withndof True if ndof was sent
+// *****************************************************************************
+{
+  const auto rdof = g_inputdeck.get< tag::discr, tag::rdof >();
+  const auto reduced = reducedGhost();
+  const auto nu = m_u.nprop();
+  const auto np = m_p.nprop();
+  const auto nt = u.size() / (reduced ? nu/rdof : nu);
+
+  // Find receive list of sender chare
+  auto it = std::lower_bound( begin(m_ghostch), end(m_ghostch), fromch );
+  Assert( it != end(m_ghostch) && *it == fromch,
+          "Ghost data received from unknown chare" );
+  const auto q = static_cast< std::size_t >( it - begin(m_ghostch) );
+  const auto r = m_recvbid.data() + m_recvoff[q];
+  [[maybe_unused]] const auto nr = m_recvoff[q+1] - m_recvoff[q];
+
+  Assert( tetid.empty() ? nt == 0 || nt == nr : nt == tetid.size(),
+          "Size mismatch in ghost data" );
+  Assert( prim.size() == nt*(reduced ? np/rdof : np),
+          "Size mismatch in ghost data" );
+  Assert( high.size() == (reduced ? nt*(nu+np)/rdof*(rdof-1) : 0),
+          "Size mismatch in ghost data" );
+  if (withndof)
+    Assert( ndof.size() == nt, "Size mismatch in ghost data" );
+
+  // Cursors into the double and single precision data if reduced
+  auto uv = u.cbegin();
+  auto pv = prim.cbegin();
+  auto hv = high.cbegin();
+
+  for (std::size_t i=0; i<nt; ++i) {
+    auto j = tetid.empty() ? i : tetid[i];
+    Assert( j < nr, "Ghost tet position out of bounds" );
+    auto b = r[j];
+    Assert( (b+1)*nu <= m_uc[k].size(), "Indexing out of bounds" );
+    Assert( (b+1)*np <= m_pc[k].size(), "Indexing out of bounds" );
+    if (reduced) {
+      for (std::size_t c=0; c<nu; ++c)
+        m_uc[k][b*nu+c] = c % rdof == 0 ? *uv++ : *hv++;
+      for (std::size_t c=0; c<np; ++c)
+        m_pc[k][b*np+c] = c % rdof == 0 ? *pv++ : *hv++;
+    } else {
+      std::copy( u.data() + i*nu, u.data() + (i+1)*nu,
+                 m_uc[k].data() + b*nu );
+      std::copy( prim.data() + i*np, prim.data() + (i+1)*np,
+                 m_pc[k].data() + b*np );
+    }
+    if (withndof) {
+      Assert( b < m_ndofc[k].size(), "Indexing out of bounds" );
+      m_ndofc[k][b] = ndof[i];
+    }
+    if (k == 2) m_limc[b] = 1;
+  }
+}
+
+tk::real
+DG::localGhost( std::size_t n, DG& nb ) const
+// *****************************************************************************
+//  Copy solution ghost data directly to the receive buffers of a neighbor
+//  chare on the same PE
+//! \param[in] n Position of the neighbor chare in m_ghostch
+//! \param[in,out] nb Neighbor chare, see CProxyElement_DG::ckLocal()
+//! \return Largest absolute rounding error of the modes rounded to single
+//!   precision, zero if ghost data is sent in full precision
+//! \details This yields the same receive buffers as packGhost() with all
+//!   ghost tets, followed by unpackGhost() on the neighbor, including the
+//!   rounding of high-order modes if reduced precision ghost data is
+//!   configured, so the solution does not depend on where neighbors are
+//!   placed, but without serializing and copying a message. Since the
+//!   neighbor is on the same PE it does not execute while its buffers are
+//!   filled, and filling them now is equivalent to the message arriving
+//!   right after it is sent.
+// *****************************************************************************
+{
+  const auto withndof = padapt();
+  const auto rdof = g_inputdeck.get< tag::discr, tag::rdof >();
+  const auto reduced = reducedGhost();
+  const auto nu = m_u.nprop();
+  const auto np = m_p.nprop();
+  const auto b = m_sendoff[n];
+  const auto e = m_sendoff[n+1];
+
+  // Find receive list of this chare on the neighbor
+  auto it = std::lower_bound( begin(nb.m_ghostch), end(nb.m_ghostch),
+                              thisIndex );
+  Assert( it != end(nb.m_ghostch) && *it == thisIndex,
+          "Ghost data copied to unknown chare" );
+  const auto q = static_cast< std::size_t >( it - begin(nb.m_ghostch) );
+  const auto r = nb.m_recvbid.data() + nb.m_recvoff[q];
+  Assert( nb.m_recvoff[q+1] - nb.m_recvoff[q] == e-b,
+          "Size mismatch in ghost data" );
+
+  // Round a degree of freedom like packGhost()
+  tk::real err = 0.0;
+  auto rounded = [&]( tk::real v, std::size_t c ){
+    if (!reduced || c % rdof == 0) return v;
+    auto h = static_cast< tk::real >( static_cast< float >( v ) );
+    err = std::max( err, std::abs( v - h ) );
+    return h;
+  };
+
+  for (auto j=b; j<e; ++j) {
+    auto i = m_sendel[j];
+    auto g = r[j-b];
+    Assert( (g+1)*nu <= nb.m_uc[0].size(), "Indexing out of bounds" );
+    Assert( (g+1)*np <= nb.m_pc[0].size(), "Indexing out of bounds" );
+    for (std::size_t c=0; c<nu; ++c)
+      nb.m_uc[0][g*nu+c] = rounded( m_u(i,c,0), c );
+    for (std::size_t c=0; c<np; ++c)
+      nb.m_pc[0][g*np+c] = rounded( m_p(i,c,0), c );
+    if (withndof) {
+      Assert( g < nb.m_ndofc[0].size(), "Indexing out of bounds" );
+      nb.m_ndofc[0][g] = m_ndof[i];
+    }
+  }
+
+  return err;
+}
+
+void
+DG::combineGhost( std::size_t k, bool withndof )
+// *****************************************************************************
+//  Copy ghost data from receive buffers to the solution of ghost tets
+//! \param[in] k Receive buffer index: 0: solution, 1: reconstruction,
+//!   2: limiting
+//! \param[in] withndof True to also copy the number of degrees of freedom
+//! \details After limiting, only the ghosts limited by their owner chares
+//!   are received, so only those are copied.
+// *****************************************************************************
+{
+  const auto nu = m_u.nprop();
+  const auto np = m_p.nprop();
+  Assert( m_uc[k].size() == m_bid.size()*nu, "ncomp size mismatch" );
+  Assert( m_pc[k].size() == m_bid.size()*np, "ncomp size mismatch" );
+
+  for (const auto& [boundary, localtet] : m_bid) {
+    if (k == 2) {
+      if (!m_limc[localtet]) continue;
+      m_limc[localtet] = 0;
+    }
+    for (std::size_t c=0; c<nu; ++c)
+      m_u(boundary,c,0) = m_uc[k][localtet*nu+c];
+    for (std::size_t c=0; c<np; ++c)
+      m_p(boundary,c,0) = m_pc[k][localtet*np+c];
+    if (withndof) m_ndof[ boundary ] = m_ndofc[k][ localtet ];
+  }
+}
+
 void
 DG::propagate_ndof()
 // *****************************************************************************
@@ -1589,54 +2044,39 @@ DG::propagate_ndof()
 
   // Update number of degrees of freedom for each cell
   m_ndof = ndof;
+
+  // Rebucket elements by their number of degrees of freedom
+  m_ndofbkt = tk::bucketNdof( m_ndof, m_fd.Esuel().size()/4 );
 }
 
 void
 DG::comlim( int fromch,
             const std::vector< std::size_t >& tetid,
-            const std::vector< std::vector< tk::real > >& u,
-            const std::vector< std::vector< tk::real > >& prim,
+            const std::vector< tk::real >& u,
+            const std::vector< tk::real >& prim,
+            const std::vector< float >& high,
             const std::vector< std::size_t >& ndof )
 // *****************************************************************************
 //  Receive chare-boundary limiter ghost data from neighboring chares
 //! \param[in] fromch Sender chare id
-//! \param[in] tetid Ghost tet ids we receive solution data for
-//! \param[in] u Limited high-order solution
-//! \param[in] prim Limited high-order primitive quantities
+//! \param[in] tetid Positions of the ghost tets we receive data for, see
+//!   packGhost()
+//! \param[in] u Limited high-order solution, flattened
+//! \param[in] prim Limited high-order primitive quantities, flattened
+//! \param[in] high High-order modes in single precision, see packGhost()
 //! \param[in] ndof Number of degrees of freedom for chare-boundary elements
 //! \details This function receives contributions to the limited solution from
 //!   fellow chares.
 // *****************************************************************************
 {
-  Assert( u.size() == tetid.size(), "Size mismatch in DG::comlim()" );
-  Assert( prim.size() == tetid.size(), "Size mismatch in DG::comlim()" );
-
-  const auto pref = g_inputdeck.get< tag::pref, tag::pref >();
+  Disc()->Comm().received( MLIM, fromch, tetid, u, prim, high, ndof );
 
-  if (pref && m_stage == 0)
-    Assert( ndof.size() == tetid.size(), "Size mismatch in DG::comlim()" );
-
-  // Find local-to-ghost tet id map for sender chare
-  const auto& n = tk::cref_find( m_ghost, fromch );
-
-  for (std::size_t i=0; i<tetid.size(); ++i) {
-    auto j = tk::cref_find( n, tetid[i] );
-    Assert( j >= m_fd.Esuel().size()/4, "Receiving solution non-ghost data" );
-    auto b = tk::cref_find( m_bid, j );
-    Assert( b < m_uc[2].size(), "Indexing out of bounds" );
-    Assert( b < m_pc[2].size(), "Indexing out of bounds" );
-    m_uc[2][b] = u[i];
-    m_pc[2][b] = prim[i];
-    if (pref && m_stage == 0) {
-      Assert( b < m_ndofc[2].size(), "Indexing out of bounds" );
-      m_ndofc[2][b] = ndof[i];
-    }
-  }
+  unpackGhost( fromch, 2, tetid, u, prim, high, ndof, padapt() );
 
   // if we have received all solution ghost contributions from neighboring
   // chares (chares we communicate along chare-boundary faces with), and
   // contributed our solution to these neighbors, proceed to limiting
-  if (++m_nlim == m_sendGhost.size()) {
+  if (++m_nlim == m_ghostch.size()) {
     m_nlim = 0;
     comlim_complete();
   }
@@ -1648,24 +2088,16 @@ DG::dt()
 // Compute time step size
 // *****************************************************************************
 {
-  const auto pref = g_inputdeck.get< tag::pref, tag::pref >();
-
   auto d = Disc();
 
   // Combine own and communicated contributions of limited solution and degrees
   // of freedom in cells (if p-adaptive)
-  for (const auto& b : m_bid) {
-    Assert( m_uc[2][b.second].size() == m_u.nprop(), "ncomp size mismatch" );
-    Assert( m_pc[2][b.second].size() == m_p.nprop(), "ncomp size mismatch" );
-    for (std::size_t c=0; c<m_u.nprop(); ++c) {
-      m_u(b.first,c,0) = m_uc[2][b.second][c];
-    }
-    for (std::size_t c=0; c<m_p.nprop(); ++c) {
-      m_p(b.first,c,0) = m_pc[2][b.second][c];
-    }
-    if (pref && m_stage == 0) {
-      m_ndof[ b.first ] = m_ndofc[2][ b.second ];
-    }
+  if (limGhost()) combineGhost( 2, padapt() );
+
+  // The Krylov iterations of implicit time stepping keep the time step size
+  if (m_kit > 0) {
+    solve( d->Dt() );
+    return;
   }
 
   auto mindt = std::numeric_limits< tk::real >::max();
@@ -1680,18 +2112,32 @@ DG::dt()
     if (std::abs(const_dt - def_const_dt) > eps) {
 
       mindt = const_dt;
+      m_dte.assign( m_nunk, mindt );
 
     } else {      // compute dt based on CFL
 
-      // find the minimum dt across all PDEs integrated
+      // find the minimum dt across all PDEs integrated, and the dt of each
+      // element across all PDEs integrated
+      m_dte.assign( m_nunk, mindt );
       for (const auto& eq : g_dgpde) {
         auto eqdt =
           eq.dt( d->Coord(), d->Inpoel(), m_fd, m_geoFace, m_geoElem, m_ndof,
-            m_u, m_p, m_fd.Esuel().size()/4 );
+            m_u, m_p, m_fd.Esuel().size()/4, m_dte );
         if (eqdt < mindt) mindt = eqdt;
       }
 
-      mindt *= g_inputdeck.get< tag::discr, tag::cfl >();
+      const auto cfl = g_inputdeck.get< tag::discr, tag::cfl >();
+      mindt *= cfl;
+      for (auto& deltat : m_dte) deltat *= cfl;
+      // ghost elements are updated by their owner chares
+      for (auto e=m_fd.Esuel().size()/4; e<m_nunk; ++e) m_dte[e] = mindt;
+
+      // Bound the time step size by the one selected by the local error
+      // estimate of the previous time step, folded into the same minimum
+      if (dtctl() && m_dterr >= 0.0) {
+        mindt = std::min( mindt, m_stepctl.dt( d->Dt(), m_dterr ) );
+        m_dterr = -1.0;
+      }
     }
   }
   else
@@ -1699,9 +2145,111 @@ DG::dt()
     mindt = d->Dt();
   }
 
-  // Contribute to minimum dt across all chares then advance to next step
-  contribute( sizeof(tk::real), &mindt, CkReduction::min_double,
-              CkCallback(CkReductionTarget(DG,solve), thisProxy) );
+  // Lagged time step sizes are only used with dt computed from CFL
+  const auto lagged = g_inputdeck.get< tag::discr, tag::laggeddt >() > 0.0 &&
+    std::abs( g_inputdeck.get< tag::discr, tag::dt >() -
+              g_inputdeck_defaults.get< tag::discr, tag::dt >() ) <
+      std::numeric_limits< tk::real >::epsilon();
+
+  // With local time stepping the elements advance with their own dt, so the
+  // minimum dt across all chares is not needed, only the chare-local one
+  // (used to advance the pseudo time of the chare)
+  if (g_inputdeck.get< tag::discr, tag::steady_state >())
+    thisProxy[ thisIndex ].solve( mindt );
+  else if (lagged && m_stage > 0)
+    // With lagged time step sizes the later stages need no global minimum
+    thisProxy[ thisIndex ].solve( mindt );
+  else if (lagged) {
+    // Compute the minimum dt across all chares in the background, but start
+    // the step only after the minimum of the previous step has arrived
+    m_dtlocal = mindt;
+    if (m_dtpending) m_dtwait = 1; else stepdt();
+  } else // Contribute to minimum dt across all chares then advance to next step
+    contribute( sizeof(tk::real), &mindt, CkReduction::min_double,
+                CkCallback(CkReductionTarget(DG,solve), thisProxy) );
+}
+
+void
+DG::stepdt()
+// *****************************************************************************
+// Start a time step with the lagged global time step size
+//! \details The step is taken with the global minimum of the previous step
+//!   times the safety factor while the minimum of this step is computed. If
+//!   there is no previous minimum, e.g., in the first step, or the step size
+//!   taken in the previous step was too large, the step waits for its own.
+// *****************************************************************************
+{
+  m_dtpending = 1;
+  contribute( sizeof(tk::real), &m_dtlocal, CkReduction::min_double,
+              CkCallback(CkReductionTarget(DG,laggeddt), thisProxy) );
+
+  if (m_dtlag > 0.0)
+    solve( g_inputdeck.get< tag::discr, tag::laggeddt >() * m_dtlag );
+  else
+    m_dtwait = 2;
+}
+
+void
+DG::laggeddt( tk::real newdt )
+// *****************************************************************************
+// Receive the global minimum of the time step size computed in the background
+// with lagged time step sizes
+//! \param[in] newdt The smallest dt across the whole problem
+//! \details Unless the step waits for it, the minimum arrives during the
+//!   step it has been computed for, so the step size taken is checked against
+//!   it: if the step size taken violates the CFL condition, the next step
+//!   waits for its own minimum.
+// *****************************************************************************
+{
+  m_dtpending = 0;
+
+  if (m_dtwait == 2) {
+    m_dtwait = 0;
+    m_dtlag = newdt;
+    solve( newdt );
+    return;
+  }
+
+  m_dtlag = Disc()->Dt() > newdt ? 0.0 : newdt;
+
+  if (m_dtwait == 1) {
+    m_dtwait = 0;
+    stepdt();
+  }
+}
+
+void
+DG::rhs( RhsPart part )
+// *****************************************************************************
+// Compute a part of the right hand side
+//! \param[in] part Part of the right hand side to compute, see RhsPart
+//! \details When elements are coarsened, high order terms should be zero.
+//!   Since the right hand side of deactivated modes is zero, they stay zero
+//!   until the number of degrees of freedom is adapted again. They are zeroed
+//!   here in the elements whose solution is first used by the part computed:
+//!   the owned elements for OWN and the ghost elements for CHBND.
+// *****************************************************************************
+{
+  auto d = Disc();
+  const auto rdof = g_inputdeck.get< tag::discr, tag::rdof >();
+  const auto neq = m_u.nprop()/rdof;
+  const auto nelem = m_fd.Esuel().size()/4;
+
+  if (padapt()) {
+    const auto ebeg = part == RhsPart::CHBND ? nelem : 0;
+    const auto eend = part == RhsPart::OWN ? nelem : m_nunk;
+    for (auto e=ebeg; e<eend; ++e)
+      for (std::size_t c=0; c<neq; ++c)
+        for (std::size_t k=m_ndof[e]; k<rdof; ++k)
+          m_u(e, c*rdof+k, 0) = 0.0;
+  }
+
+  tk::Timer t;
+  for (const auto& eq : g_dgpde)
+    eq.rhs( d->T(), m_geoFace, m_geoElem, m_fd, d->Inpoel(), d->Coord(), m_u,
+            m_p, m_ndof, m_ndofbkt, part, m_rhs );
+  // Record cost of right-hand side for load balancing
+  d->addCost( t.dsec() );
 }
 
 void
@@ -1709,6 +2257,10 @@ DG::solve( tk::real newdt )
 // *****************************************************************************
 // Compute right-hand side of discrete transport equations
 //! \param[in] newdt Size of this new time step
+//! \details Only the integrals on the chare-boundary faces are computed here,
+//!   since they need the limited ghost data. The rest of the right hand side
+//!   has already been computed in lim(), overlapped with the communication of
+//!   the ghost data.
 // *****************************************************************************
 {
   // Enable SDAG wait for building the solution vector during the next stage
@@ -1717,6 +2269,7 @@ DG::solve( tk::real newdt )
   thisProxy[ thisIndex ].wait4lim();
 
   auto d = Disc();
+  d->phase( RHS );
   const auto rdof = g_inputdeck.get< tag::discr, tag::rdof >();
   const auto ndof = g_inputdeck.get< tag::discr, tag::ndof >();
   const auto neq = m_u.nprop()/rdof;
@@ -1724,56 +2277,315 @@ DG::solve( tk::real newdt )
   // Set new time step size
   if (m_stage == 0) d->setdt( newdt );
 
-  const auto pref = g_inputdeck.get< tag::pref, tag::pref >();
-  if (pref && m_stage == 0)
-  {
-    // When the element are coarsened, high order terms should be zero
-    for(std::size_t e = 0; e < m_nunk; e++)
-    {
-      const auto ncomp= m_u.nprop()/rdof;
-      if(m_ndof[e] == 1)
-      {
-        for (std::size_t c=0; c<ncomp; ++c)
-        {
-          auto mark = c*rdof;
-          m_u(e, mark+1, 0) = 0.0;
-          m_u(e, mark+2, 0) = 0.0;
-          m_u(e, mark+3, 0) = 0.0;
-        }
-      } else if(m_ndof[e] == 4)
-      {
-        for (std::size_t c=0; c<ncomp; ++c)
-        {
-          auto mark = c*ndof;
-          m_u(e, mark+4, 0) = 0.0;
-          m_u(e, mark+5, 0) = 0.0;
-          m_u(e, mark+6, 0) = 0.0;
-          m_u(e, mark+7, 0) = 0.0;
-          m_u(e, mark+8, 0) = 0.0;
-          m_u(e, mark+9, 0) = 0.0;
-        }
-      }
-    }
+  // Complete the right hand side with the chare-boundary face integrals
+  rhs( RhsPart::CHBND );
+
+  d->phase( SOLVE );
+
+  // Continue with the Krylov solver in implicit time stepping
+  if (g_inputdeck.get< tag::discr, tag::implicit >()) {
+    krylov();
+    return;
   }
 
   // Update Un
   if (m_stage == 0) m_un = m_u;
 
-  for (const auto& eq : g_dgpde)
-    eq.rhs( d->T(), m_geoFace, m_geoElem, m_fd, d->Inpoel(), d->Coord(), m_u,
-            m_p, m_ndof, m_rhs );
-
-  // Explicit time-stepping using RK3 to discretize time-derivative
-  for(std::size_t e=0; e<m_nunk; ++e)
+  // Explicit time-stepping using SSP RK to discretize time-derivative, with
+  // element-local (pseudo) time step sizes if marching to steady state
+  const auto steady = g_inputdeck.get< tag::discr, tag::steady_state >();
+  const auto& rk = rkcoef();
+  const auto a = rk[0][m_stage];
+  const auto b = rk[1][m_stage];
+  const auto cdt = rk[2][m_stage];
+  const auto gdt = d->Dt();
+  // Solve the sytem, shared among OpenMP threads (if enabled)
+  const auto nunk = static_cast< std::ptrdiff_t >( m_nunk );
+  #pragma omp parallel for schedule(static)
+  for (std::ptrdiff_t ie=0; ie<nunk; ++ie) {
+    auto e = static_cast< std::size_t >( ie );
+    auto deltat = steady ? m_dte[e] : gdt;
+    // apply the inverse of the diagonal mass matrix, see tk::dubinerInvMass
+    auto dtv = cdt * deltat / m_geoElem(e,0,0);
     for(std::size_t c=0; c<neq; ++c)
       for (std::size_t k=0; k<ndof; ++k)
       {
         auto rmark = c*rdof+k;
         auto mark = c*ndof+k;
-        m_u(e, rmark, 0) =  rkcoef[0][m_stage] * m_un(e, rmark, 0)
-          + rkcoef[1][m_stage] * ( m_u(e, rmark, 0)
-            + d->Dt() * m_rhs(e, mark, 0)/m_lhs(e, mark, 0) );
+        m_u(e, rmark, 0) =  a * m_un(e, rmark, 0)
+          + b * ( m_u(e, rmark, 0)
+            + dtv * tk::dubinerInvMass[k] * m_rhs(e, mark, 0) );
+      }
+  }
+
+  update();
+}
+
+tk::real
+DG::dinv( std::size_t e, std::size_t mark ) const
+// *****************************************************************************
+//  Inverse of the block-diagonal preconditioner of implicit time stepping
+//! \param[in] e Element id
+//! \param[in] mark Position of the degree of freedom in m_rhs, c*ndof+k
+//! \return Inverse of the diagonal entry of the element block
+//! \details The element block is the mass matrix, diagonal in the Dubiner
+//!   basis, times the inverse of the (local or global) time step size plus
+//!   an estimate of the spectral radius of the element's flux Jacobian. The
+//!   latter is the inverse of the element's time step size at unit CFL, see
+//!   dt(), the diagonal of the Jacobian of an upwind flux summed over the
+//!   faces of the element.
+// *****************************************************************************
+{
+  const auto ndof = g_inputdeck.get< tag::discr, tag::ndof >();
+  const auto cfl = g_inputdeck.get< tag::discr, tag::cfl >();
+  const auto steady = g_inputdeck.get< tag::discr, tag::steady_state >();
+  auto deltat = steady ? m_dte[e] : Disc()->Dt();
+  auto rho = cfl > 0.0 ? cfl / m_dte[e] : 0.0;
+  return tk::dubinerInvMass[ mark % ndof ] /
+         ( m_geoElem(e,0,0) * (1.0/deltat + rho) );
+}
+
+tk::real
+DG::owndot( const tk::Fields& a, const tk::Fields& b, bool precond ) const
+// *****************************************************************************
+//  Contribution of this chare to the dot product of two element fields
+//! \param[in] a First element field, indexed like m_rhs
+//! \param[in] b Second element field, indexed like m_rhs
+//! \param[in] precond True to apply the inverse of the block-diagonal
+//!   preconditioner on both fields
+//! \return Sum of the products over the elements owned by this chare
+// *****************************************************************************
+{
+  const auto nelem = m_fd.Esuel().size()/4;
+  Assert( a.nunk() == nelem && b.nunk() == nelem, "Size mismatch" );
+  tk::real s = 0.0;
+  for (std::size_t e=0; e<nelem; ++e)
+    for (std::size_t c=0; c<a.nprop(); ++c) {
+      auto p = a(e,c,0) * b(e,c,0);
+      if (precond) p *= dinv(e,c) * dinv(e,c);
+      s += p;
+    }
+  return s;
+}
+
+void
+DG::krylov()
+// *****************************************************************************
+//  Continue the Krylov solve after evaluating the right hand side
+//! \details Implicit time stepping does a single Newton iteration of the
+//!   backward-Euler discretization, M/dt du - J du = R(u), the same way as
+//!   ALECG does, see ALECG::krylov(): the linear system is solved by GMRES,
+//!   right-preconditioned with the block-diagonal D, see dinv(), and the
+//!   product of the Jacobian with a vector v is approximated by
+//!   [R(u + eps D^{-1} v) - R(u)] / eps. The right hand side at the perturbed
+//!   solution is evaluated by the same sequence of ghost exchanges,
+//!   reconstruction and limiting as in explicit time stepping, so each GMRES
+//!   iteration costs one right hand side evaluation and two reductions. The
+//!   unknowns are the degrees of freedom evolved (ndof per component) in the
+//!   elements owned. This function is called after every right hand side
+//!   evaluation: if m_kit = 0, m_rhs is R(u) and the Krylov solve starts,
+//!   otherwise m_rhs is evaluated at the solution perturbed along the latest
+//!   Krylov vector, yielding the next one.
+// *****************************************************************************
+{
+  const auto nelem = m_fd.Esuel().size()/4;
+  const auto nprop = m_rhs.nprop();
+
+  if (m_kit == 0) {
+
+    ErrChk( !padapt(), "Implicit time stepping is not supported with "
+            "p-adaptive DG" );
+
+    const auto maxit = g_inputdeck.get< tag::discr, tag::krylov_maxit >();
+
+    // Store current solution and right hand side at current solution
+    m_un = m_u;
+    m_res = m_rhs;
+
+    // Right hand side of the linear system
+    m_krylov.resize( maxit + 1 );
+    auto& b = m_krylov[0];
+    b = tk::Fields( nelem, nprop );
+    for (std::size_t e=0; e<nelem; ++e)
+      for (std::size_t c=0; c<nprop; ++c)
+        b(e,c,0) = m_rhs(e,c,0);
+
+    // Contribute to the norms of the right hand side and the solution
+    std::vector< tk::real > r{ owndot(b,b), owndot(b,b,true), unorm() };
+    contribute( r, CkReduction::sum_double,
+                CkCallback(CkReductionTarget(DG,krylovnorm), thisProxy) );
+
+  } else {
+
+    // Apply operator to the latest Krylov vector via finite differences
+    const auto& v = m_krylov[ m_kit-1 ];
+    auto& w = m_krylov[ m_kit ];
+    w = v;
+    for (std::size_t e=0; e<nelem; ++e)
+      for (std::size_t c=0; c<nprop; ++c)
+        w(e,c,0) -= (m_rhs(e,c,0) - m_res(e,c,0)) / m_keps;
+
+    // Contribute to the dot products with all previous Krylov vectors
+    std::vector< tk::real > h( m_kit );
+    for (std::size_t k=0; k<m_kit; ++k) h[k] = owndot( w, m_krylov[k] );
+    contribute( h, CkReduction::sum_double,
+                CkCallback(CkReductionTarget(DG,krylovdot), thisProxy) );
+
+  }
+}
+
+tk::real
+DG::unorm() const
+// *****************************************************************************
+//  Contribution of this chare to the squared norm of the solution evolved
+//! \return Sum of the squares of the degrees of freedom evolved in the
+//!   elements owned
+// *****************************************************************************
+{
+  const auto rdof = g_inputdeck.get< tag::discr, tag::rdof >();
+  const auto ndof = g_inputdeck.get< tag::discr, tag::ndof >();
+  const auto nelem = m_fd.Esuel().size()/4;
+  const auto neq = m_u.nprop()/rdof;
+  tk::real s = 0.0;
+  for (std::size_t e=0; e<nelem; ++e)
+    for (std::size_t c=0; c<neq; ++c)
+      for (std::size_t k=0; k<ndof; ++k)
+        s += m_u(e,c*rdof+k,0) * m_u(e,c*rdof+k,0);
+  return s;
+}
+
+void
+DG::krylovdot( [[maybe_unused]] int n, tk::real* h )
+// *****************************************************************************
+//  Orthogonalize the latest Krylov vector in implicit time stepping
+//! \param[in] n Number of dot products
+//! \param[in] h Dot products of the latest Krylov vector with all previous
+//!   ones across the whole problem
+// *****************************************************************************
+{
+  Assert( static_cast< std::size_t >( n ) == m_kit, "Size mismatch" );
+
+  m_hcol.assign( h, h+m_kit );
+
+  auto& w = m_krylov[ m_kit ];
+  for (std::size_t k=0; k<m_kit; ++k) {
+    const auto& v = m_krylov[k];
+    for (std::size_t e=0; e<w.nunk(); ++e)
+      for (std::size_t c=0; c<w.nprop(); ++c)
+        w(e,c,0) -= m_hcol[k] * v(e,c,0);
+  }
+
+  // Contribute to the norm of the orthogonalized Krylov vector
+  std::vector< tk::real > r{ owndot(w,w), owndot(w,w,true) };
+  contribute( r, CkReduction::sum_double,
+              CkCallback(CkReductionTarget(DG,krylovnorm), thisProxy) );
+}
+
+void
+DG::krylovnorm( [[maybe_unused]] int n, tk::real* r )
+// *****************************************************************************
+//  Continue implicit time stepping after the norm of a Krylov vector
+//! \param[in] n Number of norms
+//! \param[in] r Squared norms of the latest Krylov vector across the whole
+//!   problem: r[0] L2 norm, r[1] L2 norm after applying the inverse of the
+//!   preconditioner, and if this is the first Krylov vector, r[2] L2 norm of
+//!   the current solution.
+//! \details If GMRES has converged, or the maximum number of iterations has
+//!   been reached, the time step is finished, otherwise the right hand side is
+//!   evaluated at the solution perturbed along the new Krylov vector.
+// *****************************************************************************
+{
+  Assert( n == (m_kit == 0 ? 3 : 2), "Size mismatch" );
+
+  const auto maxit = g_inputdeck.get< tag::discr, tag::krylov_maxit >();
+  const auto tol = g_inputdeck.get< tag::discr, tag::krylov_tol >();
+  const auto eps = std::numeric_limits< tk::real >::epsilon();
+
+  auto hnext = std::sqrt( r[0] );
+  if (m_kit == 0) {
+    m_unorm = std::sqrt( r[2] );
+    m_arnoldi.start( hnext );
+    // nothing to solve if the right hand side is zero
+    if (hnext < eps) { krylovsol(); return; }
+  } else {
+    auto res = m_arnoldi.add( m_hcol, hnext );
+    // finish if converged, reached the maximum size of the Krylov subspace,
+    // or the new Krylov vector vanished (the solution is in the subspace)
+    if (res <= tol * m_arnoldi.beta() || m_kit == maxit ||
+        hnext <= eps * m_arnoldi.beta())
+    {
+      krylovsol();
+      return;
+    }
+  }
+
+  // Normalize the new Krylov vector
+  auto& v = m_krylov[ m_kit ];
+  for (std::size_t e=0; e<v.nunk(); ++e)
+    for (std::size_t c=0; c<v.nprop(); ++c)
+      v(e,c,0) /= hnext;
+
+  // Perturb the solution along the new Krylov vector
+  m_keps = std::sqrt( eps * (1.0 + m_unorm) ) * hnext / std::sqrt( r[1] );
+  m_u = m_un;
+  addKrylov( m_keps, v );
+  for (const auto& eq : g_dgpde)
+    eq.updatePrimitives( m_u, m_p, m_fd.Esuel().size()/4 );
+
+  ++m_kit;
+
+  // Evaluate the right hand side, starting with the ghost exchanges, with
+  // the SDAG waits activated in solve()
+  next();
+}
+
+void
+DG::addKrylov( tk::real y, const tk::Fields& v )
+// *****************************************************************************
+//  Add a preconditioned Krylov vector to the solution evolved
+//! \param[in] y Coefficient of the Krylov vector
+//! \param[in] v Krylov vector, indexed like m_rhs
+// *****************************************************************************
+{
+  const auto rdof = g_inputdeck.get< tag::discr, tag::rdof >();
+  const auto ndof = g_inputdeck.get< tag::discr, tag::ndof >();
+  const auto neq = m_u.nprop()/rdof;
+  for (std::size_t e=0; e<v.nunk(); ++e)
+    for (std::size_t c=0; c<neq; ++c)
+      for (std::size_t k=0; k<ndof; ++k) {
+        auto mark = c*ndof+k;
+        m_u(e,c*rdof+k,0) += y * dinv(e,mark) * v(e,mark,0);
       }
+}
+
+void
+DG::krylovsol()
+// *****************************************************************************
+//  Finish implicit time step with the Krylov solution
+// *****************************************************************************
+{
+  // Form the solution increment from the Krylov basis
+  auto y = m_arnoldi.solve();
+  m_u = m_un;
+  for (std::size_t k=0; k<y.size(); ++k) addKrylov( y[k], m_krylov[k] );
+
+  m_kit = 0;
+
+  // Implicit time stepping has a single stage
+  m_stage = rkcoef()[0].size() - 1;
+
+  update();
+}
+
+void
+DG::update()
+// *****************************************************************************
+// Update the primitive quantities of the new solution and continue
+// *****************************************************************************
+{
+  auto d = Disc();
+  const auto rdof = g_inputdeck.get< tag::discr, tag::rdof >();
+  const auto& rk = rkcoef();
 
   // Update primitives based on the evolved solution
   for (const auto& eq : g_dgpde)
@@ -1782,35 +2594,62 @@ DG::solve( tk::real newdt )
     eq.cleanTraceMaterial( m_geoElem, m_u, m_p, m_fd.Esuel().size()/4 );
   }
 
-  if (m_stage < 2) {
+  // Keep the solution of the first stage to estimate the local time error
+  if (m_stage == 0 && dtctl()) {
+    Assert( std::abs(rk[0][0]) < 1.0e-14 && std::abs(rk[1][0]-1.0) < 1.0e-14,
+            "First Runge-Kutta stage must be a forward Euler step" );
+    m_u1 = m_u;
+  }
+
+  if (m_stage+1 < rk[0].size()) {
 
     // continue with next time step stage
     stage();
 
   } else {
 
+    // Estimate the local time error in the cell averages of the owned
+    // elements (if configured)
+    if (dtctl())
+      m_dterr = m_stepctl.error( m_u, m_un, m_u1, rk[2][0],
+                                 m_fd.Esuel().size()/4, rdof );
+
     // Compute diagnostics, e.g., residuals
+    d->phase( DIAG );
     auto diag_computed = m_diag.compute( *d, m_u.nunk()-m_fd.Esuel().size()/4,
-                                         m_geoElem, m_ndof, m_u );
+                                         m_geoElem, m_ndof, m_u, m_un );
 
     // Increase number of iterations and physical time
     d->next();
 
     // Continue to mesh refinement (if configured)
-    if (!diag_computed) refine( std::vector< tk::real >( m_u.nprop(), 0.0 ) );
+    if (!diag_computed) refine( std::vector< tk::real >( m_u.nprop(), 1.0 ) );
 
   }
 }
 
 void
-DG::refine( [[maybe_unused]] const std::vector< tk::real >& l2res )
+DG::refine( const std::vector< tk::real >& l2res )
 // *****************************************************************************
 // Optionally refine/derefine mesh
 //! \param[in] l2res L2-norms of the residual for each scalar component
 //!   computed across the whole problem
+//! \details With local time stepping the (pseudo) time is chare-local, so
+//!   marching to steady state only terminates on the max number of time
+//!   steps or the residual, which are the same across all chares.
 // *****************************************************************************
 {
   auto d = Disc();
+  d->phase( AMR );
+
+  const auto nstep = g_inputdeck.get< tag::discr, tag::nstep >();
+  const auto steady = g_inputdeck.get< tag::discr, tag::steady_state >();
+  const auto residual = g_inputdeck.get< tag::discr, tag::residual >();
+  const auto rc = g_inputdeck.get< tag::discr, tag::rescomp >() - 1;
+
+  // this is the last time step if max number of time steps reached or the
+  // residual has reached its convergence criterion
+  if (steady && (d->It() >= nstep || l2res[rc] < residual)) m_finished = 1;
 
   auto dtref = g_inputdeck.get< tag::amr, tag::dtref >();
   auto dtfreq = g_inputdeck.get< tag::amr, tag::dtfreq >();
@@ -1836,7 +2675,8 @@ DG::resizePostAMR(
   const tk::UnsMesh::Chunk& chunk,
   const tk::UnsMesh::Coords& coord,
   const std::unordered_map< std::size_t, tk::UnsMesh::Edge >& /*addedNodes*/,
-  const std::unordered_map< std::size_t, std::size_t >& addedTets,
+  const tk::CellFamilies& families,
+  const std::vector< std::size_t >& /*changedNodes*/,
   const tk::NodeCommMap& nodeCommMap,
   const std::map< int, std::vector< std::size_t > >& bface,
   const std::map< int, std::vector< std::size_t > >& /* bnode */,
@@ -1845,37 +2685,36 @@ DG::resizePostAMR(
 //  Receive new mesh from refiner
 //! \param[in] chunk New mesh chunk (connectivity and global<->local id maps)
 //! \param[in] coord New mesh node coordinates
-//! \param[in] addedTets Newly added mesh cells and their parents (local ids)
+//! \param[in] families Cell families relating old and new mesh cells
+//! \param[in] changedNodes Nodes of cells added by refinement/derefinement
 //! \param[in] nodeCommMap New node communication map
 //! \param[in] bface Boundary-faces mapped to side set ids
 //! \param[in] triinpoel Boundary-face connectivity
 // *****************************************************************************
 {
+  tk::Timer t;
   auto d = Disc();
 
   // Set flag that indicates that we are during time stepping
   m_initial = 0;
 
-  // Zero field output iteration count between two mesh refinement steps
+  // Zero field output iteration counts between two mesh refinement steps
   d->Itf() = 0;
+  d->Itsf() = 0;
 
   // Increase number of iterations with mesh refinement
   ++d->Itr();
 
-  // Save old number of elements
-  [[maybe_unused]] auto old_nelem = d->Inpoel().size()/4;
+  // Save old mesh for transferring the solution
+  const auto oldinpoel = d->Inpoel();
+  const auto oldcoord = d->Coord();
 
   // Resize mesh data structures
   d->resizePostAMR( chunk, coord, nodeCommMap );
 
   // Update state
   auto nelem = d->Inpoel().size()/4;
-  auto nprop = m_p.nprop();
-  m_p.resize( nelem, nprop );
-  nprop = m_u.nprop();
-  m_u.resize( nelem, nprop );
-  m_un.resize( nelem, nprop );
-  m_lhs.resize( nelem, nprop );
+  auto nprop = m_u.nprop();
   m_rhs.resize( nelem, nprop );
 
   m_fd = FaceData( d->Inpoel(), bface, tk::remap(triinpoel,d->Lid()) );
@@ -1893,18 +2732,38 @@ DG::resizePostAMR(
   m_ghost.clear();
   m_esup.clear();
 
-  // Update solution on new mesh, P0 (cell center value) only for now
+  // Transfer solution to new mesh: cells kept are copied, while the solution
+  // in children of refined and parents of derefined cells is obtained by
+  // conservative L2 projection of all degrees of freedom solved for
+  const auto pref = g_inputdeck.get< tag::pref, tag::pref >();
+  const auto ndof = pref ? g_inputdeck.get< tag::pref, tag::ndofmax >()
+                         : g_inputdeck.get< tag::discr, tag::ndof >();
+  const auto rdof = g_inputdeck.get< tag::discr, tag::rdof >();
+  tk::Fields u( nelem, nprop ), p( nelem, m_p.nprop() );
+  tk::transfer( ndof, rdof, families, oldinpoel, oldcoord, m_ndof,
+                d->Inpoel(), coord, m_u, u );
+  tk::transfer( ndof, rdof, families, oldinpoel, oldcoord, m_ndof,
+                d->Inpoel(), coord, m_p, p );
+  m_u = std::move( u );
+  m_p = std::move( p );
   m_un = m_u;
-  auto pn = m_p;
-  for (const auto& e : addedTets) {
-    Assert( e.first < nelem, "Indexing out of new solution vector" );
-    Assert( e.second < old_nelem, "Indexing out of old solution vector" );
-    for (std::size_t c=0; c<nprop; ++c)
-      m_u(e.first,c,0) = m_un(e.second,c,0);
-    for (std::size_t c=0; c<m_p.nprop(); ++c)
-      m_p(e.first,c,0) = pn(e.second,c,0);
+
+  // Transfer number of degrees of freedom: cells of a family inherit the
+  // largest among its old cells
+  std::vector< std::size_t > ndofel( nelem, ndof );
+  for (std::size_t e=0; e<nelem; ++e)
+    if (families.isKept(e)) ndofel[e] = m_ndof[ families.kept[e] ];
+  for (std::size_t f=0; f<families.size(); ++f) {
+    std::size_t n = 0;
+    for (auto i=families.srcidx[f]; i<families.srcidx[f+1]; ++i)
+      n = std::max( n, m_ndof[ families.src[i] ] );
+    for (auto i=families.tgtidx[f]; i<families.tgtidx[f+1]; ++i)
+      ndofel[ families.tgt[i] ] = n;
   }
-  m_un = m_u;
+  m_ndof = std::move( ndofel );
+
+  // Record cost of solution transfer for load balancing
+  d->addCost( t.dsec() );
 
   // Enable SDAG wait for setting up chare boundary faces
   thisProxy[ thisIndex ].wait4fac();
@@ -1920,6 +2779,7 @@ DG::out()
 // *****************************************************************************
 {
   auto d = Disc();
+  d->phase( OUTPUT );
 
   const auto term = g_inputdeck.get< tag::discr, tag::term >();
   const auto nstep = g_inputdeck.get< tag::discr, tag::nstep >();
@@ -1928,7 +2788,7 @@ DG::out()
 
   // output field data if field iteration count is reached or in the last time
   // step, otherwise continue to next time step
-  if ( !((d->It()) % fieldfreq) ||
+  if ( !((d->It()) % fieldfreq) || m_finished ||
        (std::fabs(d->T()-term) < eps || d->It() >= nstep) )
     writeFields( CkCallback(CkIndex_DG::step(), thisProxy[thisIndex]) );
   else
@@ -1946,29 +2806,42 @@ DG::stage()
 
   // if not all Runge-Kutta stages complete, continue to next time stage,
   // otherwise output field data to file(s)
-  if (m_stage < 3) next(); else out();
+  if (m_stage < rkcoef()[0].size()) next(); else out();
 }
 
 void
-DG::evalLB( int nrestart )
+DG::evalLB( int nrestart, int lb )
 // *****************************************************************************
 // Evaluate whether to do load balancing
 //! \param[in] nrestart Number of times restarted
+//! \param[in] lb If nonzero, do load balancing regardless of the frequency,
+//!   set if the load imbalance after mesh refinement exceeds its threshold
 // *****************************************************************************
 {
   auto d = Disc();
 
-  // Detect if just returned from a checkpoint and if so, zero timers
-  d->restarted( nrestart );
+  // Detect if just returned from a checkpoint and if so, zero timers and
+  // finished flag
+  if (d->restarted( nrestart )) m_finished = 0;
 
   const auto lbfreq = g_inputdeck.get< tag::cmd, tag::lbfreq >();
   const auto nonblocking = g_inputdeck.get< tag::cmd, tag::nonblocking >();
 
-  // Load balancing if user frequency is reached or after the second time-step
-  if ( (d->It()) % lbfreq == 0 || d->It() == 2 ) {
+  // Restarted on a different number of PEs than checkpointed: the chares
+  // are where the restart has put them, so rebalance before the next step
+  const auto newpes = d->newpes();
 
-    AtSync();
-    if (nonblocking) next();
+  // Load balancing if user frequency is reached, after the second time-step,
+  // or if requested after mesh refinement
+  if ( (d->It()) % lbfreq == 0 || d->It() == 2 || lb || newpes ) {
+
+    if (newpes || g_inputdeck.get< tag::discr, tag::costlb >()) {
+      // Balance load by solver-measured costs, continue in next()
+      d->commgraph( 1 );
+    } else {
+      AtSync();
+      if (nonblocking) next();
+    }
 
   } else {
 
@@ -1986,17 +2859,30 @@ DG::evalRestart()
   auto d = Disc();
 
   const auto rsfreq = g_inputdeck.get< tag::cmd, tag::rsfreq >();
+  const auto memfreq = g_inputdeck.get< tag::cmd, tag::memfreq >();
   const auto benchmark = g_inputdeck.get< tag::cmd, tag::benchmark >();
 
   if ( !benchmark && (d->It()) % rsfreq == 0 ) {
 
     int finished = 0;
+    d->checkpointing();
     d->contribute( sizeof(int), &finished, CkReduction::nop,
       CkCallback(CkReductionTarget(Transporter,checkpoint), d->Tr()) );
 
+  } else if ( !benchmark && memfreq > 0 && d->It() % memfreq == 0 ) {
+
+    d->contribute(
+      CkCallback(CkReductionTarget(Transporter,memcheckpoint), d->Tr()) );
+
+  } else if (d->refined() &&
+             g_inputdeck.get< tag::amr, tag::lbimbalance >() > 0.0) {
+
+    // Evaluate load imbalance after mesh refinement, continue in evalLB()
+    d->imbalance();
+
   } else {
 
-    evalLB( /* nrestart = */ -1 );
+    evalLB( /* nrestart = */ -1, /* lb = */ 0 );
 
   }
 }
@@ -2008,6 +2894,7 @@ DG::step()
 // *****************************************************************************
 {
   auto d = Disc();
+  d->phase( OTHER );
 
   // Output one-liner status report to screen
   d->status();
@@ -2016,15 +2903,19 @@ DG::step()
 
   const auto term = g_inputdeck.get< tag::discr, tag::term >();
   const auto nstep = g_inputdeck.get< tag::discr, tag::nstep >();
+  const auto steady = g_inputdeck.get< tag::discr, tag::steady_state >();
   const auto eps = std::numeric_limits< tk::real >::epsilon();
 
-  // If neither max iterations nor max time reached, continue, otherwise finish
-  if (std::fabs(d->T()-term) > eps && d->It() < nstep) {
+  // If neither max iterations nor max time reached (or when marching to
+  // steady state, not converged), continue, otherwise finish
+  if (steady ? !m_finished :
+               std::fabs(d->T()-term) > eps && d->It() < nstep) {
 
     evalRestart();
  
   } else {
 
+    d->checkpointing();
     d->contribute( CkCallback(CkReductionTarget(Transporter,finish), d->Tr()) );
 
   }
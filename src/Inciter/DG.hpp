@@ -32,6 +32,10 @@
 #include "DerivedData.hpp"
 #include "FaceData.hpp"
 #include "ElemDiagnostics.hpp"
+#include "Integrate/Basis.hpp"
+#include "Integrate/Transfer.hpp"
+#include "StepControl.hpp"
+#include "Arnoldi.hpp"
 
 #include "NoWarning/dg.decl.h"
 
@@ -109,9 +113,6 @@ class DG : public CBase_DG {
       const std::unordered_map< std::size_t, std::vector< tk::real > >&
         nodeBndCells );
 
-    //! Configure Charm++ reduction types for concatenating BC nodelists
-    static void registerReducers();
-
     //! Setup: query boundary conditions, output mesh, etc.
     void setup();
 
@@ -119,7 +120,7 @@ class DG : public CBase_DG {
     void box( tk::real v );
 
     // Evaluate whether to do load balancing
-    void evalLB( int nrestart );
+    void evalLB( int nrestart, int lb );
 
     //! Start time stepping
     void start();
@@ -130,25 +131,32 @@ class DG : public CBase_DG {
     //! Receive chare-boundary limiter function data from neighboring chares
     void comlim( int fromch,
                  const std::vector< std::size_t >& tetid,
-                 const std::vector< std::vector< tk::real > >& u,
-                 const std::vector< std::vector< tk::real > >& prim,
+                 const std::vector< tk::real >& u,
+                 const std::vector< tk::real >& prim,
+                 const std::vector< float >& high,
                  const std::vector< std::size_t >& ndof );
 
     //! Receive chare-boundary reconstructed data from neighboring chares
     void comreco( int fromch,
                   const std::vector< std::size_t >& tetid,
-                  const std::vector< std::vector< tk::real > >& u,
-                  const std::vector< std::vector< tk::real > >& prim,
+                  const std::vector< tk::real >& u,
+                  const std::vector< tk::real >& prim,
+                  const std::vector< float >& high,
                   const std::vector< std::size_t >& ndof );
 
     //! Receive chare-boundary ghost data from neighboring chares
     void comsol( int fromch,
                  std::size_t fromstage,
                  const std::vector< std::size_t >& tetid,
-                 const std::vector< std::vector< tk::real > >& u,
-                 const std::vector< std::vector< tk::real > >& prim,
+                 const std::vector< tk::real >& u,
+                 const std::vector< tk::real >& prim,
+                 const std::vector< float >& high,
                  const std::vector< std::size_t >& ndof );
 
+    //! \brief Receive notice that a neighbor chare on the same PE has copied
+    //!   its chare-boundary solution ghost data to our receive buffers
+    void comlocsol( int fromch, std::size_t fromstage );
+
     //! Optionally refine/derefine mesh
     void refine( const std::vector< tk::real >& l2res );
 
@@ -158,7 +166,8 @@ class DG : public CBase_DG {
       const tk::UnsMesh::Chunk& chunk,
       const tk::UnsMesh::Coords& coord,
       const std::unordered_map< std::size_t, tk::UnsMesh::Edge >& /* addedNodes */,
-      const std::unordered_map< std::size_t, std::size_t >& addedTets,
+      const tk::CellFamilies& families,
+      const std::vector< std::size_t >& /* changedNodes */,
       const tk::NodeCommMap& nodeCommMap,
       const std::map< int, std::vector< std::size_t > >& bface,
       const std::map< int, std::vector< std::size_t > >& /* bnode */,
@@ -171,16 +180,22 @@ class DG : public CBase_DG {
     //! Compute left hand side
     void lhs();
 
-    //! Const-ref access to current solution
-    //! \param[in,out] u Reference to update with current solution
-    void solution( tk::Fields& u ) const { u = m_u; }
-
     //! Unused in DG
     void resized() {}
 
     //! Compute right hand side and solve system
     void solve( tk::real newdt );
 
+    //! Orthogonalize the latest Krylov vector in implicit time stepping
+    void krylovdot( int n, tk::real* h );
+
+    //! Continue implicit time stepping after the norm of a Krylov vector
+    void krylovnorm( int n, tk::real* r );
+
+    //! Receive the global minimum of the time step size computed in the
+    //! background with lagged time step sizes
+    void laggeddt( tk::real newdt );
+
     //! Evaluate whether to continue with next time step
     void step();
 
@@ -205,7 +220,7 @@ class DG : public CBase_DG {
       p | m_Pnode;
       p | m_geoFace;
       p | m_geoElem;
-      p | m_lhs;
+      p | m_lhsls;
       p | m_rhs;
       p | m_nfac;
       p | m_nunk;
@@ -218,18 +233,34 @@ class DG : public CBase_DG {
       p | m_ghost;
       p | m_exptGhost;
       p | m_recvGhost;
+      p | m_ghostch;
+      p | m_sendoff;
+      p | m_sendel;
+      p | m_recvoff;
+      p | m_recvbid;
       p | m_diag;
       p | m_stage;
+      p | m_dte;
+      p | m_finished;
       p | m_ndof;
+      p | m_ndofbkt;
       p | m_bid;
       p | m_uc;
       p | m_pc;
       p | m_ndofc;
+      p | m_limc;
       p | m_initial;
       p | m_expChBndFace;
       p | m_infaces;
       p | m_esup;
       p | m_esupc;
+      p | m_dtlag;
+      p | m_dtlocal;
+      p | m_dtpending;
+      p | m_dtwait;
+      p | m_stepctl;
+      p | m_dterr;
+      p | m_kit;
     }
     //! \brief Pack/Unpack serialize operator|
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
@@ -248,6 +279,10 @@ class DG : public CBase_DG {
                           tk::UnsMesh::Hash<3>,
                           tk::UnsMesh::Eq<3> >;
 
+    //! \brief Wall-clock time stamp at the start of the setup phase timed,
+    //!   declared first to also time the derived data generated in the
+    //!   initializer list, not migrated since only used during setup
+    tk::real m_setupt0;
     //! Discretization proxy
     CProxy_Discretization m_disc;
     //! Counter for face adjacency communication map
@@ -281,8 +316,10 @@ class DG : public CBase_DG {
     tk::Fields m_geoFace;
     //! Element geometry
     tk::Fields m_geoElem;
-    //! Left-hand side mass-matrix which is a diagonal matrix
-    tk::Fields m_lhs;
+    //! \brief Inverse of the least-squares reconstruction matrix of each
+    //!   element, only geometry dependent and thus computed after the mesh
+    //!   (refinement) has changed
+    std::vector< std::array< std::array< tk::real, 3 >, 3 > > m_lhsls;
     //! Vector of right-hand side
     tk::Fields m_rhs;
     //! Counter for number of faces on this chare (including chare boundaries)
@@ -314,21 +351,44 @@ class DG : public CBase_DG {
     std::set< std::size_t > m_exptGhost;
     //! Received ghost tet ids (used only in DEBUG)
     std::set< std::size_t > m_recvGhost;
+    //! Chare ids we exchange ghost data with in increasing order
+    std::vector< int > m_ghostch;
+    //! Offsets of the send lists of chares in m_ghostch in m_sendel
+    std::vector< std::size_t > m_sendoff;
+    //! \brief Local ids of elements that are ghosts on the chares in
+    //!   m_ghostch, for each chare in increasing order
+    std::vector< std::size_t > m_sendel;
+    //! Offsets of the receive lists of chares in m_ghostch in m_recvbid
+    std::vector< std::size_t > m_recvoff;
+    //! \brief Receive buffer ids of ghosts owned by the chares in m_ghostch,
+    //!   for each chare in increasing order of the owner's local element ids
+    std::vector< std::size_t > m_recvbid;
     //! Diagnostics object
     ElemDiagnostics m_diag;
     //! Runge-Kutta stage counter
     std::size_t m_stage;
+    //! Element time step sizes for local (pseudo) time stepping
+    std::vector< tk::real > m_dte;
+    //! True in the last time step when marching to steady state
+    int m_finished;
     //! Vector of local number of degrees of freedom for each element
     std::vector< std::size_t > m_ndof;
+    //! Owned element ids bucketed by their local number of degrees of freedom
+    tk::NdofBuckets m_ndofbkt;
     //! Map local ghost tet ids (value) and zero-based boundary ids (key)
     std::unordered_map< std::size_t, std::size_t > m_bid;
     //! Solution receive buffers for ghosts only
-    std::array< std::vector< std::vector< tk::real > >, 3 > m_uc;
+    //! \details Flat, m_u.nprop() values per ghost, indexed by m_bid
+    std::array< std::vector< tk::real >, 3 > m_uc;
     //! Primitive-variable receive buffers for ghosts only
-    std::array< std::vector< std::vector< tk::real > >, 3 > m_pc;
+    //! \details Flat, m_p.nprop() values per ghost, indexed by m_bid
+    std::array< std::vector< tk::real >, 3 > m_pc;
     //! \brief Number of degrees of freedom (for p-adaptive) receive buffers
     //!   for ghosts only
     std::array< std::vector< std::size_t >, 3 > m_ndofc;
+    //! \brief Flags of ghosts, indexed by m_bid, whose limited solution has
+    //!   been received, see comlim()
+    std::vector< char > m_limc;
     //! 1 if starting time stepping, 0 if during time stepping
     int m_initial;
     //! Unique set of chare-boundary faces this chare is expected to receive
@@ -339,6 +399,40 @@ class DG : public CBase_DG {
     std::map< std::size_t, std::vector< std::size_t > > m_esup;
     //! Communication buffer for esup data-structure
     std::map< std::size_t, std::vector< std::size_t > > m_esupc;
+    //! \brief Global minimum of the time step size of the latest time step
+    //!   computed with lagged time step sizes, 0.0 if the next step must wait
+    //!   for its own global minimum
+    tk::real m_dtlag;
+    //! Chare-local minimum of the time step size of this time step
+    tk::real m_dtlocal;
+    //! 1 if a global minimum of the time step size is being computed
+    int m_dtpending;
+    //! \brief Continuation after the global minimum of the time step size
+    //!   arrives: 0: none, 1: start the step, 2: advance with the minimum
+    int m_dtwait;
+    //! Time step size selection by the estimate of the local time error
+    tk::StepControl m_stepctl;
+    //! \brief Scaled local time error estimate of the latest time step, see
+    //!   tk::StepControl, negative if not yet estimated
+    tk::real m_dterr;
+    //! Solution after the first Runge-Kutta stage of the time step
+    //! \details This is scratch storage only, hence not migrated; it is
+    //!   assigned in the first stage of every time step if needed.
+    tk::Fields m_u1;
+    //! Krylov iteration count in implicit time stepping, 0: not iterating
+    std::size_t m_kit;
+    //! Right hand side at the current solution in implicit time stepping
+    tk::Fields m_res;
+    //! Krylov basis vectors of GMRES in implicit time stepping
+    std::vector< tk::Fields > m_krylov;
+    //! Least-squares problem of GMRES in implicit time stepping
+    tk::Arnoldi m_arnoldi;
+    //! Dot products of the latest Krylov vector with the previous ones
+    std::vector< tk::real > m_hcol;
+    //! Norm of the current solution in implicit time stepping
+    tk::real m_unorm;
+    //! Finite difference step size of the latest Jacobian-vector product
+    tk::real m_keps;
 
     //! Access bound Discretization class pointer
     Discretization* Disc() const {
@@ -407,6 +501,12 @@ class DG : public CBase_DG {
     //! Compute time step size
     void dt();
 
+    //! Compute a part of the right hand side
+    void rhs( RhsPart part );
+
+    //! Start a time step with the lagged global time step size
+    void stepdt();
+
     //! Evaluate whether to continue with next time step stage
     void stage();
 
@@ -415,6 +515,72 @@ class DG : public CBase_DG {
 
     //! p-refine all elements that are adjacent to p-refined elements
     void propagate_ndof();
+
+    //! Query if the number of degrees of freedom is adapted in this stage
+    bool padapt() const;
+
+    //! Query if reconstructed ghost data needs to be exchanged
+    bool recoGhost() const;
+
+    //! Query if limited ghost data needs to be exchanged
+    bool limGhost() const;
+
+    //! Query if high-order ghost data is exchanged in single precision
+    bool reducedGhost() const;
+
+    //! Query if the time step size is selected by the local error estimate
+    bool dtctl() const;
+
+    //! Update the primitive quantities of the new solution and continue
+    void update();
+
+    //! Inverse of the block-diagonal preconditioner of implicit time stepping
+    tk::real dinv( std::size_t e, std::size_t mark ) const;
+
+    //! Contribution of this chare to the dot product of two element fields
+    tk::real owndot( const tk::Fields& a, const tk::Fields& b,
+                     bool precond = false ) const;
+
+    //! Contribution of this chare to the squared norm of the solution evolved
+    tk::real unorm() const;
+
+    //! Continue the Krylov solve after evaluating the right hand side
+    void krylov();
+
+    //! Add a preconditioned Krylov vector to the solution evolved
+    void addKrylov( tk::real y, const tk::Fields& v );
+
+    //! Finish implicit time step with the Krylov solution
+    void krylovsol();
+
+    //! Flatten ghost communication maps into send and receive lists
+    void ghostLayer();
+
+    //! Pack ghost data to be sent to a neighbor chare
+    tk::real packGhost( std::size_t n,
+                        const std::vector< char >& flag,
+                        std::vector< std::size_t >& tetid,
+                        std::vector< tk::real >& u,
+                        std::vector< tk::real >& prim,
+                        std::vector< float >& high,
+                        std::vector< std::size_t >& ndof ) const;
+
+    //! Unpack ghost data received from a neighbor chare into receive buffers
+    void unpackGhost( int fromch,
+                      std::size_t k,
+                      const std::vector< std::size_t >& tetid,
+                      const std::vector< tk::real >& u,
+                      const std::vector< tk::real >& prim,
+                      const std::vector< float >& high,
+                      const std::vector< std::size_t >& ndof,
+                      bool withndof );
+
+    //! Copy ghost data from receive buffers to the solution of ghost tets
+    void combineGhost( std::size_t k, bool withndof );
+
+    //! \brief Copy solution ghost data directly to the receive buffers of a
+    //!   neighbor chare on the same PE
+    tk::real localGhost( std::size_t n, DG& nb ) const;
 };
 
 } // inciter::
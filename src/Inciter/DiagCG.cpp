@@ -29,9 +29,11 @@
 #include "Discretization.hpp"
 #include "DistFCT.hpp"
 #include "DiagReducer.hpp"
+#include "SetupReport.hpp"
 #include "NodeBC.hpp"
 #include "Refiner.hpp"
 #include "Reorder.hpp"
+#include "MsgPriority.hpp"
 #include "Integrate/Mass.hpp"
 
 namespace inciter {
@@ -48,6 +50,7 @@ DiagCG::DiagCG( const CProxy_Discretization& disc,
                 const std::map< int, std::vector< std::size_t > >& bface,
                 const std::map< int, std::vector< std::size_t > >& bnode,
                 const std::vector< std::size_t >& triinpoel ) :
+  m_setupt0( CkWallTimer() ),
   m_disc( disc ),
   m_initial( 1 ),
   m_nsol( 0 ),
@@ -70,15 +73,22 @@ DiagCG::DiagCG( const CProxy_Discretization& disc,
   m_vol(),
   m_bnorm(),
   m_bnormc(),
-  m_symbcnodemap(),
   m_symbcnodes(),
   m_farfieldbcnodes(),
+  m_symbcnorm(),
+  m_farfieldbcnorm(),
   m_diag(),
+  m_diaglag(),
+  m_stats( Disc()->stats( m_u.nprop() ) ),
   m_boxnodes(),
-  m_boxnodes_set(),
+  m_boxstate(),
   m_dtp( m_u.nunk(), 0.0 ),
   m_tp( m_u.nunk(), g_inputdeck.get< tag::discr, tag::t0 >() ),
-  m_finished( 0 )
+  m_finished( 0 ),
+  m_dtlag( 0.0 ),
+  m_dtlocal( 0.0 ),
+  m_dtpending( 0 ),
+  m_dtwait( 0 )
 // *****************************************************************************
 //  Constructor
 //! \param[in] disc Discretization proxy
@@ -91,32 +101,46 @@ DiagCG::DiagCG( const CProxy_Discretization& disc,
 
   auto d = Disc();
 
-  // Perform optional operator-access-pattern mesh node reordering
+  // Perform optional local mesh node reordering
   if (g_inputdeck.get< tag::discr, tag::operator_reorder >()) {
 
-    const auto& inpoel = d->Inpoel();
-
-    // Create new local ids based on access pattern of PDE operators
     std::unordered_map< std::size_t, std::size_t > map;
-    std::size_t n = 0;
 
-    for (std::size_t e=0; e<inpoel.size()/4; ++e)
-      for (std::size_t i=0; i<4; ++i) {
-        std::size_t o = inpoel[e*4+i];
-        if (map.find(o) == end(map)) map[o] = n++;
-      }
+    if (g_inputdeck.get< tag::discr, tag::node_reorder >() ==
+        ctr::ReorderType::OPERATOR)
+    {
+      const auto& inpoel = d->Inpoel();
+
+      // Create new local ids based on access pattern of PDE operators
+      std::size_t n = 0;
+      for (std::size_t e=0; e<inpoel.size()/4; ++e)
+        for (std::size_t i=0; i<4; ++i) {
+          std::size_t o = inpoel[e*4+i];
+          if (map.find(o) == end(map)) map[o] = n++;
+        }
+    } else {
+      // Create new local ids using a graph- or coordinate-based algorithm
+      map = d->nodeReorder();
+    }
 
     Assert( map.size() == d->Gid().size(), "Map size mismatch" );
 
     // Remap data in bound Discretization object
     d->remap( map );
-    // Remap local ids in DistFCT
-    d->FCT()->remap( *d );
     // Remap boundary triangle face connectivity
     tk::remap( m_triinpoel, map );
 
   }
 
+  // Perform optional element reordering consistent with node order
+  if (g_inputdeck.get< tag::discr, tag::elem_reorder >())
+    d->reorderElems();
+
+  // Remap local ids in DistFCT
+  if (g_inputdeck.get< tag::discr, tag::operator_reorder >() ||
+      g_inputdeck.get< tag::discr, tag::elem_reorder >())
+    d->FCT()->remap( *d );
+
   // Activate SDAG wait
   thisProxy[ thisIndex ].wait4norm();
   thisProxy[ thisIndex ].wait4lhs();
@@ -240,8 +264,7 @@ DiagCG::normfinal()
   m_bnorm = std::move(bnorm);
 
   // Prepare unique set of symmetry BC nodes
-  m_symbcnodemap = d->bcnodes<tag::bcsym>( m_bface, m_triinpoel );
-  for (const auto& [s,nodes] : m_symbcnodemap)
+  for (const auto& [s,nodes] : d->bcnodes<tag::bcsym>(m_bface,m_triinpoel))
     m_symbcnodes.insert( begin(nodes), end(nodes) );
 
   // Prepare unique set of farfield BC nodes
@@ -249,9 +272,24 @@ DiagCG::normfinal()
     m_farfieldbcnodes.insert( begin(nodes), end(nodes) );
 
   // If farfield BC is set on a node, will not also set symmetry BC
-  for (auto fn : m_farfieldbcnodes) {
-    m_symbcnodes.erase(fn);
-    for (auto& [s,nodes] : m_symbcnodemap) nodes.erase(fn);
+  for (auto fn : m_farfieldbcnodes) m_symbcnodes.erase(fn);
+
+  // Flatten BC nodes and their normals for applying BCs after every solve
+  m_symbcnorm = tk::BndNodeNormals( m_bnorm, m_symbcnodes );
+  m_farfieldbcnorm = tk::BndNodeNormals( m_bnorm, m_farfieldbcnodes );
+
+  // Account memory of the worker
+  if (g_inputdeck.get< tag::cmd, tag::feedback >()) {
+    std::array< std::size_t, NUMMEM > b{};
+    b[MMESH] = tk::bytes( m_bnode, m_bface, m_triinpoel );
+    b[MDERIVED] = tk::bytes( m_bcdir, m_bnorm, m_symbcnodes, m_farfieldbcnodes,
+                             m_symbcnorm, m_farfieldbcnorm, m_boxnodes );
+    b[MFIELDS] = tk::bytes( m_u, m_ul, m_du, m_ue, m_lhs, m_rhs, m_stats );
+    b[MCOMMAP] = tk::bytes( m_lhsc, m_rhsc, m_difc, m_bnormc );
+    d->memory( b );
+    contribute( setupreport( { { TDERIVED, CkWallTimer() - m_setupt0 } } ),
+      CkReduction::max_double,
+      CkCallback( CkReductionTarget(Transporter,setuptime), d->Tr() ) );
   }
 
   // Signal the runtime system that the workers have been created
@@ -259,20 +297,6 @@ DiagCG::normfinal()
     CkCallback(CkReductionTarget(Transporter,comfinal), d->Tr()) );
 }
 
-void
-DiagCG::registerReducers()
-// *****************************************************************************
-//  Configure Charm++ reduction types initiated from this chare array
-//! \details Since this is a [initnode] routine, the runtime system executes the
-//!   routine exactly once on every logical node early on in the Charm++ init
-//!   sequence. Must be static as it is called without an object. See also:
-//!   Section "Initializations at Program Startup" at in the Charm++ manual
-//!   http://charm.cs.illinois.edu/manuals/html/charm++/manual.html.
-// *****************************************************************************
-{
-  NodeDiagnostics::registerReducers();
-}
-
 void
 DiagCG::ResumeFromSync()
 // *****************************************************************************
@@ -300,13 +324,14 @@ DiagCG::setup()
 
   // Apply symmetry BCs on initial conditions
   for (const auto& eq : g_cgpde)
-    eq.symbc( m_u, coord, m_bnorm, m_symbcnodes );
+    eq.symbc( m_u, coord, m_symbcnorm );
   // Apply farfield BCs on initial conditions
   for (const auto& eq : g_cgpde)
-    eq.farfieldbc( m_u, coord, m_bnorm, m_farfieldbcnodes );
+    eq.farfieldbc( m_u, coord, m_farfieldbcnorm );
 
   // Compute volume of user-defined box IC
   d->boxvol( m_boxnodes );
+  m_boxstate = ICBoxState( m_boxnodes.size() );
 
   // Query time history field output labels from all PDEs integrated
   const auto& hist_points = g_inputdeck.get< tag::history, tag::point >();
@@ -334,10 +359,10 @@ DiagCG::box( tk::real v )
 
   // Set user-defined IC box conditions
   for (const auto& eq : g_cgpde)
-    eq.box( d->Boxvol(), d->T(), m_boxnodes, d->Coord(), m_u, m_boxnodes_set );
+    eq.box( d->Boxvol(), d->T(), m_boxnodes, d->Coord(), m_u, m_boxstate );
 
   // Output initial conditions to file (regardless of whether it was requested)
-  writeFields( CkCallback(CkIndex_DiagCG::init(), thisProxy[thisIndex]) );
+  writeFields( true, CkCallback(CkIndex_DiagCG::init(), thisProxy[thisIndex]) );
 }
 
 void
@@ -365,30 +390,33 @@ DiagCG::lhs()
 // *****************************************************************************
 {
   auto d = Disc();
+  d->phase( LHS );
 
   // Compute lumped mass lhs required for both high and low order solutions
   m_lhs = tk::lump( m_u.nprop(), d->Coord(), d->Inpoel() );
 
   if (d->NodeCommMap().empty())
     comlhs_complete();
-  else // send contributions of lhs to chare-boundary nodes to fellow chares
-    for (const auto& [c,n] : d->NodeCommMap()) {
-      std::vector< std::vector< tk::real > > l( n.size() );
-      std::size_t j = 0;
-      for (auto i : n) l[ j++ ] = m_lhs[ tk::cref_find(d->Lid(),i) ];
-      thisProxy[c].comlhs( std::vector<std::size_t>(begin(n),end(n)), l );
+  else {  // send contributions of lhs to chare-boundary nodes to fellow chares
+    std::vector< tk::real > l;
+    for (const auto& [c,n] : d->NodeCommLid()) {
+      d->packNodeComm( c, m_lhs, l );
+      d->Comm().sent( MLHS, c, thisIndex, l );
+      thisProxy[c].comlhs( thisIndex, l, msgopts( MLHS ) );
     }
+  }
 
+  d->phase( WAIT );
   ownlhs_complete();
 }
 
 void
-DiagCG::comlhs( const std::vector< std::size_t >& gid,
-                const std::vector< std::vector< tk::real > >& L )
+DiagCG::comlhs( int c, const std::vector< tk::real >& L )
 // *****************************************************************************
 //  Receive contributions to left-hand side diagonal matrix on chare-boundaries
-//! \param[in] gid Global mesh node IDs at which we receive LHS contributions
-//! \param[in] L Partial contributions of LHS to chare-boundary nodes
+//! \param[in] c Sender chare id
+//! \param[in] L Partial contributions of LHS to chare-boundary nodes, all
+//!   components per node, in the order of Discretization::NodeCommLid()
 //! \details This function receives contributions to m_lhs, which stores the
 //!   diagonal (lumped) mass matrix at mesh nodes. While m_lhs stores
 //!   own contributions, m_lhsc collects the neighbor chare contributions during
@@ -396,12 +424,8 @@ DiagCG::comlhs( const std::vector< std::size_t >& gid,
 //!   are combined in lhsmerge().
 // *****************************************************************************
 {
-  Assert( L.size() == gid.size(), "Size mismatch" );
-
-  using tk::operator+=;
-
-  for (std::size_t i=0; i<gid.size(); ++i)
-    m_lhsc[ gid[i] ] += L[i];
+  Disc()->Comm().received( MLHS, c, L );
+  m_lhsc[ c ] = L;
 
   if (++m_nlhs == Disc()->NodeCommMap().size()) {
     m_nlhs = 0;
@@ -416,14 +440,8 @@ DiagCG::lhsmerge()
 // *****************************************************************************
 {
   // Combine own and communicated contributions to left hand side
-  for (const auto& b : m_lhsc) {
-    auto lid = tk::cref_find( Disc()->Lid(), b.first );
-    for (ncomp_t c=0; c<m_lhs.nprop(); ++c)
-      m_lhs(lid,c,0) += b.second[c];
-  }
-
-  // Clear receive buffer
-  tk::destroy(m_lhsc);
+  Disc()->phase( LHS );
+  Disc()->unpackNodeComm( m_lhsc, m_lhs );
 
   // Continue after lhs is complete
   if (m_initial) {
@@ -474,11 +492,79 @@ DiagCG::dt()
   // Activate SDAG-waits for FCT
   d->FCT()->next();
 
+  // With lagged time step sizes, compute the minimum dt across all chares
+  // in the background, but start the step only after the minimum of the
+  // previous step has arrived
+  if (g_inputdeck.get< tag::discr, tag::laggeddt >() > 0.0 &&
+      std::abs(const_dt - def_const_dt) < eps)
+  {
+    m_dtlocal = mindt;
+    if (m_dtpending) m_dtwait = 1; else stepdt();
+    return;
+  }
+
+  // Send diagnostics of the previous step along with dt, which continues via
+  // Transporter::diagdt() to advance()
+  if (!m_diaglag.empty()) {
+    m_diag.contribute( *d, std::move(m_diaglag), mindt );
+    m_diaglag.clear();
+    return;
+  }
+
   // Contribute to minimum dt across all chares the advance to next step
   contribute( sizeof(tk::real), &mindt, CkReduction::min_double,
               CkCallback(CkReductionTarget(DiagCG,advance), thisProxy) );
 }
 
+void
+DiagCG::stepdt()
+// *****************************************************************************
+// Start a time step with the lagged global time step size
+//! \details The step is taken with the global minimum of the previous step
+//!   times the safety factor while the minimum of this step is computed. If
+//!   there is no previous minimum, e.g., in the first step, or the step size
+//!   taken in the previous step was too large, the step waits for its own.
+// *****************************************************************************
+{
+  m_dtpending = 1;
+  contribute( sizeof(tk::real), &m_dtlocal, CkReduction::min_double,
+              CkCallback(CkReductionTarget(DiagCG,laggeddt), thisProxy) );
+
+  if (m_dtlag > 0.0)
+    advance( g_inputdeck.get< tag::discr, tag::laggeddt >() * m_dtlag );
+  else
+    m_dtwait = 2;
+}
+
+void
+DiagCG::laggeddt( tk::real newdt )
+// *****************************************************************************
+// Receive the global minimum of the time step size computed in the background
+// with lagged time step sizes
+//! \param[in] newdt The smallest dt across the whole problem
+//! \details Unless the step waits for it, the minimum arrives during the
+//!   step it has been computed for, so the step size taken is checked against
+//!   it: if the step size taken violates the CFL condition, the next step
+//!   waits for its own minimum.
+// *****************************************************************************
+{
+  m_dtpending = 0;
+
+  if (m_dtwait == 2) {
+    m_dtwait = 0;
+    m_dtlag = newdt;
+    advance( newdt );
+    return;
+  }
+
+  m_dtlag = Disc()->Dt() > newdt ? 0.0 : newdt;
+
+  if (m_dtwait == 1) {
+    m_dtwait = 0;
+    stepdt();
+  }
+}
+
 void
 DiagCG::advance( tk::real newdt )
 // *****************************************************************************
@@ -501,7 +587,9 @@ DiagCG::rhs()
 // Compute right-hand side of transport equations
 // *****************************************************************************
 {
+  tk::Timer t;
   auto d = Disc();
+  d->phase( RHS );
   const auto& lid = d->Lid();
   const auto& inpoel = d->Inpoel();
 
@@ -520,39 +608,44 @@ DiagCG::rhs()
   // Compute mass diffusion
   auto dif = d->FCT()->diff( *d, m_u );
 
-  // Query and match user-specified boundary conditions to side sets
-  m_bcdir = match( m_u.nprop(), d->T(), d->Dt(), m_tp, m_dtp, d->Coord(),
-                   lid, m_bnode );
+  // Match user-specified boundary conditions to side sets if the mesh has
+  // changed, then evaluate them
+  if (m_bcdir.epoch() != d->MeshEpoch())
+    m_bcdir = DirBCPlan( m_u.nprop(), m_u.nunk(), d->Coord(), lid, m_bnode,
+                         d->MeshEpoch() );
+  m_bcdir.eval( d->T(), d->Dt(), m_tp, m_dtp, d->Coord() );
+
+  // Record cost of right-hand side for load balancing
+  d->addCost( t.dsec() );
 
   // Send rhs data on chare-boundary nodes to fellow chares
   if (d->NodeCommMap().empty())
     comrhs_complete();
-  else  // send contributions of rhs to chare-boundary nodes to fellow chares
-    for (const auto& [c,n] : d->NodeCommMap()) {
-      std::vector< std::vector< tk::real > > r( n.size() );
-      std::vector< std::vector< tk::real > > D( n.size() );
-      std::size_t j = 0;
-      for (auto i : n) {
-        auto k = tk::cref_find( lid, i );
-        r[j] = m_rhs[k];
-        D[j] = dif[k];
-        ++j;
-      }
-      thisProxy[c].comrhs( std::vector<std::size_t>(begin(n),end(n)), r, D );
+  else {  // send contributions of rhs to chare-boundary nodes to fellow chares
+    std::vector< tk::real > r, D;
+    for (const auto& [c,n] : d->NodeCommLid()) {
+      d->packNodeComm( c, m_rhs, r );
+      d->packNodeComm( c, dif, D );
+      d->Comm().sent( MRHS, c, thisIndex, r, D );
+      thisProxy[c].comrhs( thisIndex, r, D, msgopts( MRHS ) );
     }
+  }
 
+  d->phase( WAIT );
   ownrhs_complete( dif );
 }
 
 void
-DiagCG::comrhs( const std::vector< std::size_t >& gid,
-                const std::vector< std::vector< tk::real > >& R,
-                const std::vector< std::vector< tk::real > >& D )
+DiagCG::comrhs( int c,
+                const std::vector< tk::real >& R,
+                const std::vector< tk::real >& D )
 // *****************************************************************************
 //  Receive contributions to right-hand side vector on chare-boundaries
-//! \param[in] gid Global mesh node IDs at which we receive RHS contributions
-//! \param[in] R Partial contributions of RHS to chare-boundary nodes
-//! \param[in] D Partial contributions to chare-boundary nodes
+//! \param[in] c Sender chare id
+//! \param[in] R Partial contributions of RHS to chare-boundary nodes, all
+//!   components per node, in the order of Discretization::NodeCommLid()
+//! \param[in] D Partial contributions to chare-boundary nodes, in the same
+//!   layout as R
 //! \details This function receives contributions to m_rhs, which stores the
 //!   right hand side vector at mesh nodes. While m_rhs stores own
 //!   contributions, m_rhsc collects the neighbor chare contributions during
@@ -561,15 +654,11 @@ DiagCG::comrhs( const std::vector< std::size_t >& gid,
 //!   mass diffusion term of the right hand side vector at mesh nodes.
 // *****************************************************************************
 {
-  Assert( R.size() == gid.size(), "Size mismatch" );
-  Assert( D.size() == gid.size(), "Size mismatch" );
-
-  using tk::operator+=;
+  Assert( R.size() == D.size(), "Size mismatch" );
+  Disc()->Comm().received( MRHS, c, R, D );
 
-  for (std::size_t i=0; i<gid.size(); ++i) {
-    m_rhsc[ gid[i] ] += R[i];
-    m_difc[ gid[i] ] += D[i];
-  }
+  m_rhsc[ c ] = R;
+  m_difc[ c ] = D;
 
   if (++m_nrhs == Disc()->NodeCommMap().size()) {
     m_nrhs = 0;
@@ -587,22 +676,13 @@ DiagCG::solve( tk::Fields& dif )
   const auto ncomp = m_rhs.nprop();
 
   auto d = Disc();
+  d->phase( SOLVE );
 
   // Combine own and communicated contributions to rhs
-  for (const auto& b : m_rhsc) {
-    auto lid = tk::cref_find( d->Lid(), b.first );
-    for (ncomp_t c=0; c<ncomp; ++c) m_rhs(lid,c,0) += b.second[c];
-  }
+  d->unpackNodeComm( m_rhsc, m_rhs );
 
   // Combine own and communicated contributions to mass diffusion
-  for (const auto& b : m_difc) {
-    auto lid = tk::cref_find( d->Lid(), b.first );
-    for (ncomp_t c=0; c<ncomp; ++c) dif(lid,c,0) += b.second[c];
-  }
-
-  // Clear receive buffers
-  tk::destroy(m_rhsc);
-  tk::destroy(m_difc);
+  d->unpackNodeComm( m_difc, dif );
 
   // Set Dirichlet BCs for lhs and both low and high order rhs vectors. Note
   // that the low order rhs (more precisely the mass-diffusion term) is set to
@@ -611,18 +691,19 @@ DiagCG::solve( tk::Fields& dif )
   // hand side and mass diffusion so the low order system is L = R + D, where L
   // is the lumped mass matrix, R is the high order RHS, and D is
   // mass diffusion, and R already will have the Dirichlet BC set.
-  for (const auto& [b,bc] : m_bcdir) {
+  for (std::size_t i=0; i<m_bcdir.size(); ++i) {
+    auto b = m_bcdir.node(i);
     for (ncomp_t c=0; c<ncomp; ++c) {
-      if (bc[c].first) {
+      if (m_bcdir.set(i,c)) {
         m_lhs( b, c, 0 ) = 1.0;
-        m_rhs( b, c, 0 ) = bc[c].second;
+        m_rhs( b, c, 0 ) = m_bcdir.value(i,c);
         dif( b, c, 0 ) = 0.0;
       }
     }
   }
 
   // Solve low and high order diagonal systems and update low order solution
-  auto dul = (m_rhs + dif) / m_lhs;
+  tk::Fields dul = (m_rhs + dif) / m_lhs;
 
   m_ul = m_u + dul;
   m_du = m_rhs / m_lhs;
@@ -630,23 +711,25 @@ DiagCG::solve( tk::Fields& dif )
   const auto& coord = d->Coord();
   for (const auto& eq : g_cgpde) {
     // Apply symmetry BCs
-    eq.symbc( dul, coord, m_bnorm, m_symbcnodes );
-    eq.symbc( m_ul, coord, m_bnorm, m_symbcnodes );
-    eq.symbc( m_du, coord, m_bnorm, m_symbcnodes );
+    eq.symbc( dul, coord, m_symbcnorm );
+    eq.symbc( m_ul, coord, m_symbcnorm );
+    eq.symbc( m_du, coord, m_symbcnorm );
     // Apply farfield BCs
-    eq.farfieldbc( m_ul, coord, m_bnorm, m_farfieldbcnodes );
-    eq.farfieldbc( m_du, coord, m_bnorm, m_farfieldbcnodes );
+    eq.farfieldbc( m_ul, coord, m_farfieldbcnorm );
+    eq.farfieldbc( m_du, coord, m_farfieldbcnorm );
   }
 
   // Continue with FCT
-  d->FCT()->aec( *d, m_du, m_u, m_bcdir, m_symbcnodemap, m_bnorm );
-  d->FCT()->alw( m_u, m_ul, std::move(dul), thisProxy );
+  d->FCT()->aec( *d, m_du, m_u, m_ul, std::move(dul), m_bcdir,
+                 m_symbcnorm, thisProxy );
 }
 
 void
-DiagCG::writeFields( CkCallback c ) const
+DiagCG::writeFields( bool volume, CkCallback c ) const
 // *****************************************************************************
 // Output mesh-based fields to file
+//! \param[in] volume True to output the volume fields, false to only output
+//!   the surface fields, see Discretization::surfdue()
 //! \param[in] c Function to continue with after the write
 // *****************************************************************************
 {
@@ -669,17 +752,40 @@ DiagCG::writeFields( CkCallback c ) const
     }
 
     // Collect node field solution
-    auto u = m_u;
     std::vector< std::vector< tk::real > > nodefields;
     std::vector< std::vector< tk::real > > nodesurfs;
     for (const auto& eq : g_cgpde) {
-      auto o = eq.fieldOutput( d->T(), d->meshvol(), d->Coord()[0].size(),
-                               d->Coord(), d->V(), u );
-      nodefields.insert( end(nodefields), begin(o), end(o) );
-      auto s = eq.surfOutput( tk::bfacenodes(m_bface,m_triinpoel), u );
+      if (volume) {
+        auto o = eq.fieldOutput( d->T(), d->meshvol(), d->Coord()[0].size(),
+                                 d->Coord(), d->V(), m_u );
+        nodefields.insert( end(nodefields),
+                           std::make_move_iterator( begin(o) ),
+                           std::make_move_iterator( end(o) ) );
+      }
+      auto s = eq.surfOutput( tk::bfacenodes(m_bface,m_triinpoel), m_u );
       nodesurfs.insert( end(nodesurfs), begin(s), end(s) );
     }
 
+    // Send surface fields only for output to file
+    if (!volume) {
+      d->write( false, {}, d->Coord(), m_bface, {}, m_triinpoel, {}, {},
+                nodesurfnames, {}, {}, nodesurfs, c );
+      return;
+    }
+
+    // Add time averages and second moments of the solution
+    if (!m_stats.empty()) {
+      std::vector< std::string > var;
+      for (const auto& eq : g_cgpde) {
+        auto n = eq.names();
+        var.insert( end(var), begin(n), end(n) );
+      }
+      auto n = m_stats.names( var );
+      nodefieldnames.insert( end(nodefieldnames), begin(n), end(n) );
+      auto f = m_stats.fields();
+      nodefields.insert( end(nodefields), begin(f), end(f) );
+    }
+
     Assert( nodefieldnames.size() == nodefields.size(), "Size mismatch" );
 
     std::vector< std::string > elemfieldnames;
@@ -728,9 +834,10 @@ DiagCG::writeFields( CkCallback c ) const
       begin(fct_elemfields), end(fct_elemfields) );
 
     // Send mesh and fields data (solution dump) for output to file
-    d->write( d->Inpoel(), d->Coord(), m_bface, tk::remap( m_bnode,d->Lid() ),
-              m_triinpoel, elemfieldnames, nodefieldnames, nodesurfnames,
-              elemfields, nodefields, nodesurfs, c );
+    d->write( true, d->Inpoel(), d->Coord(), m_bface,
+              tk::remap( m_bnode,d->Lid() ), m_triinpoel, elemfieldnames,
+              nodefieldnames, nodesurfnames, elemfields, nodefields, nodesurfs,
+              c );
 
   }
 }
@@ -756,9 +863,17 @@ DiagCG::update( const tk::Fields& a, [[maybe_unused]] tk::Fields&& dul )
   else
     m_u = m_u + m_du;
 
-  // Compute diagnostics, e.g., residuals
-  auto diag_computed =
-    m_diag.compute( *d, m_u, un, m_bnorm, m_symbcnodes, m_farfieldbcnodes );
+  // Compute diagnostics, e.g., residuals, or keep them to be sent along with
+  // the next time step size
+  d->phase( DIAG );
+  auto diag_computed = false;
+  if (NodeDiagnostics::lagged())
+    m_diaglag = m_diag.accumulate( *d, m_u, un, m_symbcnorm, m_farfieldbcnorm );
+  else
+    diag_computed =
+      m_diag.compute( *d, m_u, un, m_symbcnorm, m_farfieldbcnorm );
+  // Add new solution to time averages (if configured)
+  m_stats.add( m_u, d->statsweight() );
   // Increase number of iterations and physical time
   d->next();
   // Continue to mesh refinement (if configured)
@@ -774,6 +889,7 @@ DiagCG::refine( [[maybe_unused]] const std::vector< tk::real >& l2res )
 // *****************************************************************************
 {
   auto d = Disc();
+  d->phase( AMR );
 
   auto dtref = g_inputdeck.get< tag::amr, tag::dtref >();
   auto dtfreq = g_inputdeck.get< tag::amr, tag::dtfreq >();
@@ -803,7 +919,8 @@ DiagCG::resizePostAMR(
   const tk::UnsMesh::Chunk& chunk,
   const tk::UnsMesh::Coords& coord,
   const std::unordered_map< std::size_t, tk::UnsMesh::Edge >& addedNodes,
-  const std::unordered_map< std::size_t, std::size_t >& /*addedTets*/,
+  const tk::CellFamilies& /*families*/,
+  const std::vector< std::size_t >& /*changedNodes*/,
   const tk::NodeCommMap& nodeCommMap,
   const std::map< int, std::vector< std::size_t > >& /*bface*/,
   const std::map< int, std::vector< std::size_t > >& bnode,
@@ -814,18 +931,21 @@ DiagCG::resizePostAMR(
 //! \param[in] chunk New mesh chunk (connectivity and global<->local id maps)
 //! \param[in] coord New mesh node coordinates
 //! \param[in] addedNodes Newly added mesh nodes and their parents (local ids)
-//! \param[in] addedTets Newly added mesh cells and their parents (local ids)
+//! \param[in] families Cell families relating old and new mesh cells
+//! \param[in] changedNodes Nodes of cells added by refinement/derefinement
 //! \param[in] nodeCommMap New node communication map
 //! \param[in] bnode Boundary-node lists mapped to side set ids
 // *****************************************************************************
 {
+  tk::Timer t;
   auto d = Disc();
 
   // Set flag that indicates that we are during time stepping
   m_initial = 0;
 
-  // Zero field output iteration count between two mesh refinement steps
+  // Zero field output iteration counts between two mesh refinement steps
   d->Itf() = 0;
+  d->Itsf() = 0;
 
   // Increase number of iterations with mesh refinement
   ++d->Itr();
@@ -844,10 +964,11 @@ DiagCG::resizePostAMR(
   m_lhs.resize( npoin, nprop );
   m_rhs.resize( npoin, nprop );
 
+  // Start time averages over on the new mesh
+  m_stats.reset( npoin );
+
   // Update solution on new mesh
-  for (const auto& n : addedNodes)
-    for (std::size_t c=0; c<nprop; ++c)
-      m_u(n.first,c,0) = (m_u(n.second[0],c,0) + m_u(n.second[1],c,0))/2.0;
+  tk::transfer( addedNodes, m_u );
 
   // Update physical-boundary node lists
   m_bnode = bnode;
@@ -855,6 +976,9 @@ DiagCG::resizePostAMR(
   // Resize FCT data structures
   d->FCT()->resize( npoin, nodeCommMap, d->Bid(), d->Lid(), d->Inpoel() );
 
+  // Record cost of solution transfer for load balancing
+  d->addCost( t.dsec() );
+
   contribute( CkCallback(CkReductionTarget(Transporter,resized), d->Tr()) );
 }
 
@@ -867,6 +991,42 @@ DiagCG::resized()
   resize_complete();
 }
 
+void
+DiagCG::writeSlices( CkCallback c ) const
+// *****************************************************************************
+// Output slices and iso-surfaces of mesh-based fields to files
+//! \param[in] c Function to continue with after the write
+// *****************************************************************************
+{
+  if (g_inputdeck.get< tag::cmd, tag::benchmark >()) {
+
+    c.send();
+
+  } else {
+
+    auto d = Disc();
+
+    // Query and collect node field names and solution from PDEs integrated
+    std::vector< std::string > nodefieldnames;
+    std::vector< std::vector< tk::real > > nodefields;
+    for (const auto& eq : g_cgpde) {
+      auto n = eq.fieldNames();
+      nodefieldnames.insert( end(nodefieldnames), begin(n), end(n) );
+      auto o = eq.fieldOutput( d->T(), d->meshvol(), d->Coord()[0].size(),
+                               d->Coord(), d->V(), m_u );
+      nodefields.insert( end(nodefields),
+                         std::make_move_iterator( begin(o) ),
+                         std::make_move_iterator( end(o) ) );
+    }
+
+    Assert( nodefieldnames.size() == nodefields.size(), "Size mismatch" );
+
+    // Extract slices and send them for output to file
+    d->slices( m_u, nodefieldnames, nodefields, c );
+
+  }
+}
+
 void
 DiagCG::out()
 // *****************************************************************************
@@ -874,6 +1034,7 @@ DiagCG::out()
 // *****************************************************************************
 {
   auto d = Disc();
+  d->phase( OUTPUT );
 
   // Output time history if we hit its output frequency
   const auto histfreq = g_inputdeck.get< tag::interval, tag::history >();
@@ -886,25 +1047,46 @@ DiagCG::out()
     d->history( std::move(hist) );
   }
 
+  // Output slices and iso-surfaces if we hit their output frequency
+  if (d->slicedue())
+    writeSlices( CkCallback(CkIndex_DiagCG::outfields(),
+                            thisProxy[thisIndex]) );
+  else
+    outfields();
+}
+
+void
+DiagCG::outfields()
+// *****************************************************************************
+// Output volume and surface field data
+// *****************************************************************************
+{
+  auto d = Disc();
+
   const auto term = g_inputdeck.get< tag::discr, tag::term >();
   const auto nstep = g_inputdeck.get< tag::discr, tag::nstep >();
   const auto eps = std::numeric_limits< tk::real >::epsilon();
   const auto fieldfreq = g_inputdeck.get< tag::interval, tag::field >();
 
   // output field data if field iteration count is reached or in the last time
-  // step, otherwise continue to next time step
-  if ( !((d->It()) % fieldfreq) ||
-       (std::fabs(d->T()-term) < eps || d->It() >= nstep) )
-    writeFields( CkCallback(CkIndex_DiagCG::step(), thisProxy[thisIndex]) );
+  // step, and surface field data only if their own iteration count is
+  // reached, otherwise continue to next time step
+  const auto volume = !((d->It()) % fieldfreq) ||
+                      (std::fabs(d->T()-term) < eps || d->It() >= nstep);
+  if (volume || d->surfdue())
+    writeFields( volume,
+                 CkCallback(CkIndex_DiagCG::step(), thisProxy[thisIndex]) );
   else
     step();
 }
 
 void
-DiagCG::evalLB( int nrestart )
+DiagCG::evalLB( int nrestart, int lb )
 // *****************************************************************************
 // Evaluate whether to do load balancing
 //! \param[in] nrestart Number of times restarted
+//! \param[in] lb If nonzero, do load balancing regardless of the frequency,
+//!   set if the load imbalance after mesh refinement exceeds its threshold
 // *****************************************************************************
 {
   auto d = Disc();
@@ -915,11 +1097,21 @@ DiagCG::evalLB( int nrestart )
   const auto lbfreq = g_inputdeck.get< tag::cmd, tag::lbfreq >();
   const auto nonblocking = g_inputdeck.get< tag::cmd, tag::nonblocking >();
 
-  // Load balancing if user frequency is reached or after the second time-step
-  if ( (d->It()) % lbfreq == 0 || d->It() == 2 ) {
+  // Restarted on a different number of PEs than checkpointed: the chares
+  // are where the restart has put them, so rebalance before the next step
+  const auto newpes = d->newpes();
+
+  // Load balancing if user frequency is reached, after the second time-step,
+  // or if requested after mesh refinement
+  if ( (d->It()) % lbfreq == 0 || d->It() == 2 || lb || newpes ) {
 
-    AtSync();
-    if (nonblocking) next();
+    if (newpes || g_inputdeck.get< tag::discr, tag::costlb >()) {
+      // Balance load by solver-measured costs, continue in next()
+      d->commgraph( 1 );
+    } else {
+      AtSync();
+      if (nonblocking) next();
+    }
 
   } else {
 
@@ -937,17 +1129,30 @@ DiagCG::evalRestart()
   auto d = Disc();
 
   const auto rsfreq = g_inputdeck.get< tag::cmd, tag::rsfreq >();
+  const auto memfreq = g_inputdeck.get< tag::cmd, tag::memfreq >();
   const auto benchmark = g_inputdeck.get< tag::cmd, tag::benchmark >();
 
   if ( !benchmark && d->It() % rsfreq == 0 ) {
 
     int finished = 0;
+    d->checkpointing();
     d->contribute( sizeof(int), &finished, CkReduction::nop,
       CkCallback(CkReductionTarget(Transporter,checkpoint), d->Tr()) );
 
+  } else if ( !benchmark && memfreq > 0 && d->It() % memfreq == 0 ) {
+
+    d->contribute(
+      CkCallback(CkReductionTarget(Transporter,memcheckpoint), d->Tr()) );
+
+  } else if (d->refined() &&
+             g_inputdeck.get< tag::amr, tag::lbimbalance >() > 0.0) {
+
+    // Evaluate load imbalance after mesh refinement, continue in evalLB()
+    d->imbalance();
+
   } else {
 
-    evalLB( /* nrestart = */ -1 );
+    evalLB( /* nrestart = */ -1, /* lb = */ 0 );
 
   }
 }
@@ -959,6 +1164,10 @@ DiagCG::step()
 // *****************************************************************************
 {
   auto d = Disc();
+  d->phase( OTHER );
+
+  // Collect communication counts of flux-corrected transport for the report
+  d->Comm().merge( d->FCT()->comm() );
 
   // Output one-liner status report to screen
   d->status();
@@ -974,7 +1183,15 @@ DiagCG::step()
 
   } else {
 
-    d->contribute( CkCallback(CkReductionTarget(Transporter,finish), d->Tr()) );
+    d->checkpointing();
+    // Send diagnostics of the last step (if lagged), which then finishes
+    if (!m_diaglag.empty()) {
+      m_diag.finish( *d, std::move(m_diaglag) );
+      m_diaglag.clear();
+    } else {
+      d->contribute(
+        CkCallback(CkReductionTarget(Transporter,finish), d->Tr()) );
+    }
 
   }
 }
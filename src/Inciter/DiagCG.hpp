@@ -36,7 +36,11 @@
 #include "Types.hpp"
 #include "Fields.hpp"
 #include "DerivedData.hpp"
+#include "BndNodeNormals.hpp"
+#include "Integrate/Transfer.hpp"
 #include "FluxCorrector.hpp"
+#include "NodeBC.hpp"
+#include "ICBoxState.hpp"
 #include "NodeDiagnostics.hpp"
 #include "CommMap.hpp"
 #include "Inciter/InputDeck/InputDeck.hpp"
@@ -91,9 +95,6 @@ class DiagCG : public CBase_DiagCG {
       #pragma clang diagnostic pop
     #endif
 
-    //! Configure Charm++ custom reduction types initiated from this chare array
-    static void registerReducers();
-
     //! Return from migration
     void ResumeFromSync() override;
 
@@ -115,6 +116,10 @@ class DiagCG : public CBase_DiagCG {
     //! Advance equations to next time step
     void advance( tk::real newdt );
 
+    //! Receive the global minimum of the time step size computed in the
+    //! background with lagged time step sizes
+    void laggeddt( tk::real newdt );
+
     //! Compute left-hand side of transport equations
     void lhs();
 
@@ -123,13 +128,12 @@ class DiagCG : public CBase_DiagCG {
       std::unordered_map< std::size_t, std::array< tk::real, 4 > > >& innorm );
 
     //! Receive contributions to left-hand side matrix on chare-boundaries
-    void comlhs( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& L );
+    void comlhs( int c, const std::vector< tk::real >& L );
 
     //! Receive contributions to right-hand side vector on chare-boundaries
-    void comrhs( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& R,
-                 const std::vector< std::vector< tk::real > >& D );
+    void comrhs( int c,
+                 const std::vector< tk::real >& R,
+                 const std::vector< tk::real >& D );
 
     //! Update solution at the end of time step
     void update( const tk::Fields& a, tk::Fields&& dul );
@@ -143,7 +147,8 @@ class DiagCG : public CBase_DiagCG {
       const tk::UnsMesh::Chunk& chunk,
       const tk::UnsMesh::Coords& coord,
       const std::unordered_map< std::size_t, tk::UnsMesh::Edge >& addedNodes,
-      const std::unordered_map< std::size_t, std::size_t >& addedTets,
+      const tk::CellFamilies& families,
+      const std::vector< std::size_t >& /* changedNodes */,
       const tk::NodeCommMap& nodeCommMap,
       const std::map< int, std::vector< std::size_t > >& /* bface */,
       const std::map< int, std::vector< std::size_t > >& bnode,
@@ -156,11 +161,14 @@ class DiagCG : public CBase_DiagCG {
     //! Resizing data sutrctures after mesh refinement has been completed
     void resized();
 
+    //! Output volume and surface field data after slices
+    void outfields();
+
     //! Evaluate whether to continue with next time step
     void step();
 
     // Evaluate whether to do load balancing
-    void evalLB( int nrestart );
+    void evalLB( int nrestart, int lb );
 
     //! Continue to next time step
     void next();
@@ -192,14 +200,21 @@ class DiagCG : public CBase_DiagCG {
       p | m_vol;
       p | m_bnorm;
       p | m_bnormc;
-      p | m_symbcnodemap;
       p | m_symbcnodes;
       p | m_farfieldbcnodes;
+      p | m_symbcnorm;
+      p | m_farfieldbcnorm;
       p | m_diag;
+      p | m_diaglag;
+      p | m_stats;
       p | m_boxnodes;
-      p | m_boxnodes_set;
+      p | m_boxstate;
       p | m_dtp;
       p | m_tp;
+      p | m_dtlag;
+      p | m_dtlocal;
+      p | m_dtpending;
+      p | m_dtwait;
     }
     //! \brief Pack/Unpack serialize operator|
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
@@ -210,6 +225,9 @@ class DiagCG : public CBase_DiagCG {
   private:
     using ncomp_t = kw::ncomp::info::expect::type;
 
+    //! \brief Wall-clock time stamp at construction, declared first to also
+    //!   time the derived data generated in the initializer list
+    tk::real m_setupt0;
     //! Discretization proxy
     CProxy_Discretization m_disc;
     //! 1 if starting time stepping, 0 if during time stepping
@@ -240,23 +258,21 @@ class DiagCG : public CBase_DiagCG {
     tk::Fields m_lhs;
     //! Right-hand side vector (for the high order system)
     tk::Fields m_rhs;
-    //! Boundary conditions evaluated and assigned to local mesh node IDs
-    //! \details Vector of pairs of bool and boundary condition value associated
-    //!   to local mesh node IDs at which the user has set Dirichlet boundary
-    //!   conditions for all PDEs integrated. The bool indicates whether the BC
-    //!   is set at the node for that component the if true, the real value is
-    //!   the increment (from t to dt) in the BC specified for a component.
-    std::unordered_map< std::size_t,
-      std::vector< std::pair< bool, tk::real > > > m_bcdir;
+    //! \brief Dirichlet boundary conditions matched to local mesh node IDs,
+    //!   rebuilt if the mesh epoch changes, evaluated at every time step
+    DirBCPlan m_bcdir;
     //! Receive buffer for communication of the left hand side
-    //! \details Key: chare id, value: lhs for all scalar components per node
-    std::unordered_map< std::size_t, std::vector< tk::real > > m_lhsc;
+    //! \details Key: chare id, value: lhs for all scalar components per node,
+    //!   in the order of Discretization::NodeCommLid()
+    std::unordered_map< int, std::vector< tk::real > > m_lhsc;
     //! Receive buffer for communication of the right hand side
-    //! \details Key: chare id, value: rhs for all scalar components per node
-    std::unordered_map< std::size_t, std::vector< tk::real > > m_rhsc;
+    //! \details Key: chare id, value: rhs for all scalar components per node,
+    //!   in the order of Discretization::NodeCommLid()
+    std::unordered_map< int, std::vector< tk::real > > m_rhsc;
     //! Receive buffer for communication of mass diffusion on the hand side
-    //! \details Key: chare id, value: dif for all scalar components per node
-    std::unordered_map< std::size_t, std::vector< tk::real > > m_difc;
+    //! \details Key: chare id, value: dif for all scalar components per node,
+    //!   in the order of Discretization::NodeCommLid()
+    std::unordered_map< int, std::vector< tk::real > > m_difc;
     //! Total mesh volume
     tk::real m_vol;
     //! Face normals in boundary points associated to side sets
@@ -270,24 +286,42 @@ class DiagCG : public CBase_DiagCG {
     //!   inverse distance squared (4th component), outer key, side set id
     std::unordered_map< int,
       std::unordered_map< std::size_t, std::array< tk::real, 4 > > > m_bnormc;
-    //! Unique set of nodes at which symmetry BCs are set for side sets
-    std::unordered_map< int, std::unordered_set< std::size_t > > m_symbcnodemap;
     //! Unique set of nodes at which symmetry BCs are set
     std::unordered_set< std::size_t > m_symbcnodes;
     //! Unique set of nodes at which farfield BCs are set
     std::unordered_set< std::size_t > m_farfieldbcnodes;
+    //! Nodes and their normals at which symmetry BCs are set, flattened
+    tk::BndNodeNormals m_symbcnorm;
+    //! Nodes and their normals at which farfield BCs are set, flattened
+    tk::BndNodeNormals m_farfieldbcnorm;
     //! Diagnostics object
     NodeDiagnostics m_diag;
+    //! \brief Partial diagnostics of the previous time step to be sent along
+    //!   with the time step size, empty if none, see NodeDiagnostics::lagged()
+    std::vector< std::vector< tk::real > > m_diaglag;
+    //! Time averages and second moments of the solution, empty if none
+    FieldStats m_stats;
     //! Mesh node ids at which user-defined box ICs are defined
     std::vector< std::size_t > m_boxnodes;
-    //! Box nodes that have been set
-    std::unordered_set< std::size_t > m_boxnodes_set;
+    //! Box nodes that have been set and their index by distance
+    ICBoxState m_boxstate;
     //! Time step size for each mesh node
     std::vector< tk::real > m_dtp;
     //! Physical time for each mesh node
     std::vector< tk::real > m_tp;
     //! True in the last time step
     int m_finished;
+    //! \brief Global minimum of the time step size of the latest time step
+    //!   computed with lagged time step sizes, 0.0 if the next step must wait
+    //!   for its own global minimum
+    tk::real m_dtlag;
+    //! Chare-local minimum of the time step size of this time step
+    tk::real m_dtlocal;
+    //! 1 if a global minimum of the time step size is being computed
+    int m_dtpending;
+    //! \brief Continuation after the global minimum of the time step size
+    //!   arrives: 0: none, 1: start the step, 2: advance with the minimum
+    int m_dtwait;
 
     //! Access bound Discretization class pointer
     Discretization* Disc() const {
@@ -306,7 +340,10 @@ class DiagCG : public CBase_DiagCG {
     void out();
 
     //! Output mesh-based fields to file
-    void writeFields( CkCallback c ) const;
+    void writeFields( bool volume, CkCallback c ) const;
+
+    //! Output slices and iso-surfaces of mesh-based fields to files
+    void writeSlices( CkCallback c ) const;
 
     //! The own and communication portion of the left-hand side is complete
     void lhsdone();
@@ -326,6 +363,9 @@ class DiagCG : public CBase_DiagCG {
     //! Compute time step size
     void dt();
 
+    //! Start a time step with the lagged global time step size
+    void stepdt();
+
     //! Evaluate whether to save checkpoint/restart
     void evalRestart();
 };
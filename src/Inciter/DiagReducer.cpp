@@ -11,15 +11,21 @@
 // *****************************************************************************
 
 #include <stddef.h>
+#include <algorithm>
 #include <type_traits>
 #include <memory>
 
 #include "DiagReducer.hpp"
 #include "Diagnostics.hpp"
+#include "PhaseTimer.hpp"
+#include "CommCounter.hpp"
+#include "MemoryReport.hpp"
 #include "Exception.hpp"
 
 namespace inciter {
 
+CkReduction::reducerType MemMerger;
+
 std::pair< int, std::unique_ptr<char[]> >
 serialize( const std::vector< std::vector< tk::real > >& d )
 // *****************************************************************************
@@ -45,57 +51,157 @@ serialize( const std::vector< std::vector< tk::real > >& d )
 }
 
 CkReductionMsg*
-mergeDiag( int nmsg, CkReductionMsg **msgs )
+diagMsg( const std::vector< std::vector< tk::real > >& d )
+// *****************************************************************************
+// Build Charm++ reduction message of diagnostics reduced by built-in reducers
+//! \param[in] d Diagnostics vector of vectors (of eq components)
+//! \return Charm++ reduction message to contribute, without callback
+//! \details Each entry of the diagnostics vector is a contiguous array of
+//!   reals in a Charm++ tuple reduction, reduced by Charm++'s built-in reducer
+//!   implementing its aggregation policy. Compared to a custom reducer, no
+//!   merge step of the reduction tree deserializes and reserializes the
+//!   diagnostics: the arrays are reduced in place. The entries ITER, TIME,
+//!   and DT are the same on all workers, so taking their maximum copies them.
 // *****************************************************************************
-// Charm++ custom reducer for merging diagnostics during reduction across PEs
+{
+  static_assert( std::is_same_v< tk::real, double >,
+                 "Diagnostics reduced by built-in reducers of doubles" );
+  Assert( d.size() == NUMDIAG || d.size() == NEXTDT+1,
+          "Diagnostics vector size mismatch" );
+
+  std::vector< CkReduction::tupleElement > e;
+  e.reserve( d.size() );
+  for (std::size_t i=0; i<d.size(); ++i) {
+    auto r = CkReduction::sum_double;           // L2SOL, L2ERR, L2RES
+    if (i >= LINFERR && i <= DT) r = CkReduction::max_double;
+    else if (i == NEXTDT) r = CkReduction::min_double;
+    e.emplace_back( d[i].size() * sizeof(tk::real),
+                    const_cast< tk::real* >( d[i].data() ), r );
+  }
+
+  return CkReductionMsg::buildFromTuple( e.data(), static_cast<int>(d.size()) );
+}
+
+std::vector< std::vector< tk::real > >
+diagVec( CkReductionMsg* msg )
+// *****************************************************************************
+// Extract diagnostics from Charm++ reduction message built by diagMsg()
+//! \param[in] msg Charm++ reduction message containing the diagnostics
+//!   aggregated across all PEs, not deleted here
+//! \return Diagnostics vector of vectors (of eq components)
+// *****************************************************************************
+{
+  CkReduction::tupleElement* e = nullptr;
+  int n = 0;
+  msg->toTuple( &e, &n );
+
+  std::vector< std::vector< tk::real > > d( static_cast< std::size_t >( n ) );
+  for (std::size_t i=0; i<d.size(); ++i) {
+    const auto v = reinterpret_cast< const tk::real* >( e[i].data );
+    d[i].assign( v, v + e[i].dataSize/sizeof(tk::real) );
+  }
+  delete[] e;
+
+  return d;
+}
+
+CkReductionMsg*
+mergePerf( int nmsg, CkReductionMsg **msgs )
+// *****************************************************************************
+// Charm++ custom reducer for merging time step phase timers during reduction
+// across PEs
 //! \param[in] nmsg Number of messages in msgs
 //! \param[in] msgs Charm++ reduction message containing the serialized
-//!   diagnostics
-//! \return Aggregated diagnostics built for further aggregation if needed
+//!   times spent in the phases of time steps
+//! \return Aggregated phase times built for further aggregation if needed
 // *****************************************************************************
 {
-  // Will store deserialized diagnostics vector of vectors
   std::vector< std::vector< tk::real > > v;
-
-  // Create PUP deserializer based on message passed in
   PUP::fromMem creator( msgs[0]->getData() );
+  creator | v;
+
+  for (int m=1; m<nmsg; ++m) {
+    std::vector< std::vector< tk::real > > w;
+    PUP::fromMem curCreator( msgs[m]->getData() );
+    curCreator | w;
+    Assert( v.size() == NUMPERF && w.size() == NUMPERF,
+            "Size mismatch during phase timer aggregation" );
+    for (std::size_t i=0; i<NUMPHASE; ++i) {
+      v[PMIN][i] = std::min( v[PMIN][i], w[PMIN][i] );
+      v[PMAX][i] = std::max( v[PMAX][i], w[PMAX][i] );
+      v[PSUM][i] += w[PSUM][i];
+    }
+    Assert( v[PPE].size() == w[PPE].size(),
+            "Size mismatch during busy time per PE aggregation" );
+    for (std::size_t p=0; p<v[PPE].size(); ++p) v[PPE][p] += w[PPE][p];
+    slowest( v[PSLOW], w[PSLOW] );
+  }
+
+  auto stream = serialize( v );
+  return CkReductionMsg::buildNew( stream.first, stream.second.get() );
+}
 
-  // Deserialize vector from raw stream
+CkReductionMsg*
+mergeComm( int nmsg, CkReductionMsg **msgs )
+// *****************************************************************************
+// Charm++ custom reducer for merging communication counters during reduction
+// across PEs
+//! \param[in] nmsg Number of messages in msgs
+//! \param[in] msgs Charm++ reduction message containing the serialized
+//!   communication statistics
+//! \return Aggregated communication statistics built for further aggregation
+//!   if needed
+// *****************************************************************************
+{
+  std::vector< std::vector< tk::real > > v;
+  PUP::fromMem creator( msgs[0]->getData() );
   creator | v;
 
   for (int m=1; m<nmsg; ++m) {
-    // Unpack vector
     std::vector< std::vector< tk::real > > w;
     PUP::fromMem curCreator( msgs[m]->getData() );
     curCreator | w;
-    // Aaggregate diagnostics vector
-    Assert( v.size() == w.size(),
-            "Size mismatch during diagnostics aggregation" );
-    Assert( v.size() == inciter::NUMDIAG,
-            "Size mismatch during diagnostics aggregation" );
-    for (std::size_t i=0; i<v.size(); ++i)
-      Assert( v[i].size() == w[i].size(),
-              "Size mismatch during diagnostics aggregation" );
-    // Apply diagnostics aggregation policy
-    // Sum for L2 normal of the numerical solution for all scalar components
-    for (std::size_t i=0; i<v[L2SOL].size(); ++i) v[L2SOL][i] += w[L2SOL][i];
-    // Sum for the L2 norm of the numerical - analytical solution for all comps
-    for (std::size_t i=0; i<v[L2ERR].size(); ++i) v[L2ERR][i] += w[L2ERR][i];
-    // Sum for the L2 norm of the residual of all components
-    for (std::size_t i=0; i<v[L2RES].size(); ++i) v[L2RES][i] += w[L2RES][i];
-    // Max for the Linf norm of the numerical - analytical solution for all comp
-    for (std::size_t i=0; i<v[LINFERR].size(); ++i)
-      if (w[LINFERR][i] > v[LINFERR][i]) v[LINFERR][i] = w[LINFERR][i];
-    // Copy ITER, TIME, DT
-    for (std::size_t j=v.size()-3; j<v.size(); ++j)
-      for (std::size_t i=0; i<v[j].size(); ++i)
-        v[j][i] = w[j][i];
+    Assert( v.size() == 2*NUMCOMMSTAT+1 && w.size() == v.size(),
+            "Size mismatch during communication counter aggregation" );
+    for (std::size_t s=0; s<NUMCOMMSTAT; ++s)
+      for (std::size_t i=0; i<NUMMSG; ++i) {
+        v[s][i] += w[s][i];
+        auto& mx = v[NUMCOMMSTAT+s][i];
+        mx = std::max( mx, w[NUMCOMMSTAT+s][i] );
+      }
   }
 
-  // Serialize concatenated diagnostics vector to raw stream
   auto stream = serialize( v );
+  return CkReductionMsg::buildNew( stream.first, stream.second.get() );
+}
 
-  // Forward serialized diagnostics
+CkReductionMsg*
+mergeMem( int nmsg, CkReductionMsg **msgs )
+// *****************************************************************************
+// Charm++ custom reducer for merging memory reports during reduction across PEs
+//! \param[in] nmsg Number of messages in msgs
+//! \param[in] msgs Charm++ reduction message containing the serialized
+//!   memory reports
+//! \return Aggregated memory report built for further aggregation if needed
+// *****************************************************************************
+{
+  std::vector< std::vector< tk::real > > v;
+  PUP::fromMem creator( msgs[0]->getData() );
+  creator | v;
+
+  for (int m=1; m<nmsg; ++m) {
+    std::vector< std::vector< tk::real > > w;
+    PUP::fromMem curCreator( msgs[m]->getData() );
+    curCreator | w;
+    Assert( v.size() == NUMMEMROW && w.size() == NUMMEMROW,
+            "Size mismatch during memory report aggregation" );
+    for (std::size_t i=0; i<NUMMEM; ++i) {
+      v[MSUM][i] += w[MSUM][i];
+      v[MMAX][i] = std::max( v[MMAX][i], w[MMAX][i] );
+    }
+  }
+
+  auto stream = serialize( v );
   return CkReductionMsg::buildNew( stream.first, stream.second.get() );
 }
 
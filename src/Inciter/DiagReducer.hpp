@@ -26,9 +26,33 @@ namespace inciter {
 std::pair< int, std::unique_ptr<char[]> >
 serialize( const std::vector< std::vector< tk::real > >& d );
 
-//! Charm++ custom reducer for merging std::vectors during reduction across PEs
+//! \brief Build Charm++ reduction message of diagnostics reduced by built-in
+//!   reducers
 CkReductionMsg*
-mergeDiag( int nmsg, CkReductionMsg **msgs );
+diagMsg( const std::vector< std::vector< tk::real > >& d );
+
+//! Extract diagnostics from Charm++ reduction message built by diagMsg()
+std::vector< std::vector< tk::real > >
+diagVec( CkReductionMsg* msg );
+
+//! \brief Charm++ custom reducer for merging time step phase timers during
+//!   reduction across PEs
+CkReductionMsg*
+mergePerf( int nmsg, CkReductionMsg **msgs );
+
+//! \brief Charm++ custom reducer for merging communication counters during
+//!   reduction across PEs
+CkReductionMsg*
+mergeComm( int nmsg, CkReductionMsg **msgs );
+
+//! \brief Charm++ custom reducer for merging memory reports during reduction
+//!   across PEs
+CkReductionMsg*
+mergeMem( int nmsg, CkReductionMsg **msgs );
+
+//! \brief Charm++ reducer type for memory reports, registered by
+//!   Discretization::registerReducers(), used by all contributors
+extern CkReduction::reducerType MemMerger;
 
 } // inciter::
 
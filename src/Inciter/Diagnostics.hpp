@@ -28,6 +28,12 @@ enum Diag { L2SOL=0,    //!< L2 norm of numerical solution
             TIME,       //!< Physical time
             DT };       //!< Time step size
 
+//! \brief Index of the optional entry of the diagnostics vector (of vectors)
+//!   holding the time step size of the next time step
+//! \details Only sent with lagged diagnostics, see the lagged_diag keyword,
+//!   and aggregated by taking the minimum.
+const std::size_t NEXTDT = NUMDIAG;
+
 } // inciter::
 
 #endif // Diagnostics_h
@@ -10,6 +10,15 @@
 */
 // *****************************************************************************
 
+#include <limits>
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <cstdio>
+#include <cfenv>
+#include <cmath>
+#include <cstdint>
+
 #include "Tags.hpp"
 #include "Reorder.hpp"
 #include "Vector.hpp"
@@ -21,13 +30,35 @@
 #include "Inciter/Options/Scheme.hpp"
 #include "Print.hpp"
 #include "Around.hpp"
+#include "Slice.hpp"
+#include "HashMapReducer.hpp"
+#include "DiagReducer.hpp"
+#include "SetupReport.hpp"
+#include "Compress.hpp"
+#include "ChareStateCollector.hpp"
+#include "MsgPriority.hpp"
+
+extern tk::CProxy_ChareStateCollector stateProxy;
 
 namespace inciter {
 
 static CkReduction::reducerType PDFMerger;
+static CkReduction::reducerType GraphMerger;
+static CkReduction::reducerType PerfMerger;
+static CkReduction::reducerType CommMerger;
 extern ctr::InputDeck g_inputdeck;
 extern ctr::InputDeck g_inputdeck_defaults;
 
+//! \brief Query if surface field output is decoupled from volume field output
+//! \return True if the surface fields are output at their own interval
+//! \details Only node-centered schemes output surface fields, so for others
+//!   the surface files are always written with the volume fields.
+static bool surfDecoupled() {
+  const auto sch = g_inputdeck.get< tag::discr, tag::scheme >();
+  return g_inputdeck.get< tag::interval, tag::surface >() > 0 &&
+         (sch == ctr::SchemeType::DiagCG || sch == ctr::SchemeType::ALECG);
+}
+
 } // inciter::
 
 using inciter::Discretization;
@@ -44,9 +75,12 @@ Discretization::Discretization(
   m_it( 0 ),
   m_itr( 0 ),
   m_itf( 0 ),
+  m_itsf( 0 ),
+  m_itsl( 0 ),
   m_initial( 1.0 ),
   m_t( g_inputdeck.get< tag::discr, tag::t0 >() ),
   m_lastDumpTime( -std::numeric_limits< tk::real >::max() ),  
+  m_lastSurfTime( -std::numeric_limits< tk::real >::max() ),
   m_dt( g_inputdeck.get< tag::discr, tag::dt >() ),
   m_nvol( 0 ),
   m_fct( fctproxy ),
@@ -55,6 +89,10 @@ Discretization::Discretization(
   m_el( tk::global2local( ginpoel ) ),     // fills m_inpoel, m_gid, m_lid
   m_coord( setCoord( coordmap ) ),
   m_nodeCommMap(),
+  m_nodeCommLid(),
+  m_nodeCommBid(),
+  m_bidlid(),
+  m_lidbid(),
   m_edgeCommMap(),
   m_meshvol( 0.0 ),
   m_v( m_gid.size(), 0.0 ),
@@ -65,7 +103,22 @@ Discretization::Discretization(
   m_refined( 0 ),
   m_prevstatus( std::chrono::high_resolution_clock::now() ),
   m_nrestart( 0 ),
-  m_histdata()
+  m_histdata(),
+  m_cost( 0.0 ),
+  m_nwrite( 0 ),
+  m_writecb(),
+  m_writenode( -1 ),
+  m_phase(),
+  m_tracing( g_inputdeck.get< tag::cmd, tag::tracebuf >() > 0 ),
+  m_tracet0( CkWallTimer() ),
+  m_setupt0( 0.0 ),
+  m_firstcb(),
+  m_comm(),
+  m_meshepoch( 0 ),
+  m_ckptepoch( std::numeric_limits< uint64_t >::max() ),
+  m_ckptprev( std::numeric_limits< uint64_t >::max() ),
+  m_checkpointing( false ),
+  m_newpes( false )
 // *****************************************************************************
 //  Constructor
 //! \param[in] fctproxy Distributed FCT proxy
@@ -84,6 +137,15 @@ Discretization::Discretization(
   Assert( tk::conforming( m_inpoel, m_coord ),
           "Input mesh to Discretization not conforming" );
 
+  // Perform optional element reordering consistent with node order. With AMR
+  // off this is done for all schemes, because element-based data of DG is
+  // required to be generated in the element order stored here. With AMR on,
+  // DG schemes associate new elements to parent element ids of Refiner, so
+  // only CG schemes, which reorder after optional node reordering, do it.
+  if (g_inputdeck.get< tag::discr, tag::elem_reorder >() &&
+      !g_inputdeck.get< tag::amr, tag::amr >())
+    reorderElems();
+
   // Store communication maps
   for (const auto& [ c, maps ] : msum) {
     m_nodeCommMap[c] = maps.get< tag::node >();
@@ -101,6 +163,9 @@ Discretization::Discretization(
   tk::unique( c );
   m_bid = tk::assignLid( c );
 
+  // Build schedule of nodal exchanges on chare-boundaries
+  commSchedule();
+
   // Lambda to decide if a node is not counted by this chare. If a node is
   // found in the node communication map and is associated to a lower chare id
   // than thisIndex, it is counted by another chare (and not thisIndex), hence
@@ -119,18 +184,7 @@ Discretization::Discretization(
 
   // Find host elements of user-specified points where time histories are
   // saved, and save the shape functions evaluated at the point locations
-  const auto& pt = g_inputdeck.get< tag::history, tag::point >();
-  const auto& id = g_inputdeck.get< tag::history, tag::id >();
-  for (std::size_t p=0; p<pt.size(); ++p) {
-    std::array< tk::real, 4 > N;
-    const auto& l = pt[p];
-    for (std::size_t e=0; e<m_inpoel.size()/4; ++e) {
-      if (tk::intet( m_coord, m_inpoel, l, e, N )) {
-        m_histdata.push_back( HistData{{ id[p], e, {l[0],l[1],l[2]}, N }} );
-        break;
-      }
-    }
-  }
+  histpoints();
 
   // Insert DistFCT chare array element if FCT is needed. Note that even if FCT
   // is configured false in the input deck, at this point, we still need the FCT
@@ -158,6 +212,8 @@ Discretization::resizePostAMR( const tk::UnsMesh::Chunk& chunk,
 //! \param[in] nodeCommMap New node communication map
 // *****************************************************************************
 {
+  ++m_meshepoch;        // mesh data changes
+
   m_el = chunk;         // updates m_inpoel, m_gid, m_lid
   m_coord = coord;      // update mesh node coordinates
   m_nodeCommMap = nodeCommMap;        // update node communication map
@@ -169,6 +225,9 @@ Discretization::resizePostAMR( const tk::UnsMesh::Chunk& chunk,
       if (m_bid.find( g ) == end(m_bid))
         m_bid[ g ] = bid++;
 
+  // Rebuild schedule of nodal exchanges on chare-boundaries
+  commSchedule();
+
   // Clear receive buffer that will be used for collecting nodal volumes
   m_volc.clear();
 
@@ -178,6 +237,9 @@ Discretization::resizePostAMR( const tk::UnsMesh::Chunk& chunk,
   // Update mesh volume
   std::fill( begin(m_vol), end(m_vol), 0.0 );
   m_vol.resize( m_gid.size(), 0.0 );
+
+  // Re-locate history points in the new mesh
+  histpoints();
 }
 
 void
@@ -203,6 +265,11 @@ Discretization::registerReducers()
 // *****************************************************************************
 {
   PDFMerger = CkReduction::addReducer( tk::mergeUniPDFs );
+  GraphMerger = CkReduction::addReducer(
+                  tk::mergeHashMap< int, std::vector< tk::real > > );
+  PerfMerger = CkReduction::addReducer( mergePerf );
+  CommMerger = CkReduction::addReducer( mergeComm );
+  MemMerger = CkReduction::addReducer( mergeMem );
 }
 
 tk::UnsMesh::Coords
@@ -237,6 +304,8 @@ Discretization::remap(
 //! \param[in] map Mapping of old->new local ids
 // *****************************************************************************
 {
+  ++m_meshepoch;        // mesh data changes
+
   // Remap connectivity containing local IDs
   for (auto& l : m_inpoel) l = tk::cref_find(map,l);
 
@@ -275,6 +344,174 @@ Discretization::remap(
     newcoord[2][n] = m_coord[2][o];
   }
   m_coord = std::move( newcoord );
+
+  // Rebuild schedule of nodal exchanges on chare-boundaries with new local ids
+  commSchedule();
+}
+
+void
+Discretization::histpoints()
+// *****************************************************************************
+//  Find host elements of history points and evaluate shapefunctions in them
+//! \details Each element is tested against all points not yet found at once,
+//!   using the shapefunctions evaluated at many points, and the search stops
+//!   as soon as all points have been found. Points outside of the bounding box
+//!   of our mesh chunk are not searched for. A point is hosted by the first
+//!   element containing it. Since the elements do not overlap, a point not on
+//!   an element face is found by a single chare, which then is the only one
+//!   that outputs its time history. The history output itself, see, e.g.,
+//!   CGPDE::histOutput(), is then a gather of the nodal values of the host
+//!   element weighed by the shapefunctions stored here. This must be called
+//!   whenever the mesh changes, i.e., with each new mesh epoch, except when
+//!   only the elements are reordered, see reorderElems().
+// *****************************************************************************
+{
+  m_histdata.clear();
+
+  const auto& pt = g_inputdeck.get< tag::history, tag::point >();
+  const auto& id = g_inputdeck.get< tag::history, tag::id >();
+  if (pt.empty() || m_inpoel.empty()) return;
+
+  // Bounding box of our mesh chunk
+  std::array< tk::real, 3 > bmin, bmax;
+  for (std::size_t j=0; j<3; ++j) {
+    auto [mn,mx] = std::minmax_element( begin(m_coord[j]), end(m_coord[j]) );
+    bmin[j] = *mn;
+    bmax[j] = *mx;
+  }
+
+  // Collect coordinates and indices of points in our bounding box
+  std::array< std::vector< tk::real >, 3 > l;
+  std::vector< std::size_t > q;
+  for (std::size_t p=0; p<pt.size(); ++p) {
+    bool in = true;
+    for (std::size_t j=0; j<3; ++j)
+      if (pt[p][j] < bmin[j] || pt[p][j] > bmax[j]) in = false;
+    if (in) {
+      for (std::size_t j=0; j<3; ++j) l[j].push_back( pt[p][j] );
+      q.push_back( p );
+    }
+  }
+  if (q.empty()) return;
+
+  const auto nelem = m_inpoel.size()/4;
+  const auto invjac = tk::genInvJacTet( m_coord, m_inpoel );
+  std::vector< std::size_t > host( pt.size(), nelem );
+  std::vector< std::array< tk::real, 4 > > Nh( pt.size() );
+  std::array< std::vector< tk::real >, 4 > N;
+  for (std::size_t e=0; e<nelem && !q.empty(); ++e) {
+    tk::shapeTet( invjac, e, l, N );
+    // Remove points found from the search, from the back, so that swapping
+    // with the last point only moves points already tested against e
+    for (std::size_t k=q.size(); k-->0; ) {
+      std::array< tk::real, 4 > n{{ N[0][k], N[1][k], N[2][k], N[3][k] }};
+      if (tk::intet( n )) {
+        host[ q[k] ] = e;
+        Nh[ q[k] ] = n;
+        for (std::size_t j=0; j<3; ++j) {
+          l[j][k] = l[j].back();
+          l[j].pop_back();
+        }
+        q[k] = q.back();
+        q.pop_back();
+      }
+    }
+  }
+
+  for (std::size_t p=0; p<pt.size(); ++p)
+    if (host[p] < nelem)
+      m_histdata.push_back( HistData{{ id[p], host[p],
+        {pt[p][0],pt[p][1],pt[p][2]}, Nh[p] }} );
+}
+
+void
+Discretization::commSchedule()
+// *****************************************************************************
+//  Build the persistent schedule of nodal exchanges on chare-boundaries
+//! \details For each fellow chare we share nodes with, store the local and
+//!   chare-boundary ids of the shared nodes in the order of their global ids.
+//!   Since the fellow chare orders the same nodes the same way, a flat buffer
+//!   of nodal values packed by packNodeComm() on one side can be added by
+//!   unpackNodeComm() on the other, without sending global ids along. Also
+//!   store the dense maps between local and chare-boundary node ids.
+// *****************************************************************************
+{
+  m_nodeCommLid.clear();
+  m_nodeCommBid.clear();
+
+  const auto none = std::numeric_limits< std::size_t >::max();
+  m_bidlid.assign( m_bid.size(), none );
+  m_lidbid.assign( m_gid.size(), none );
+  for (const auto& [g,b] : m_bid) {
+    auto i = m_lid.find( g );
+    if (i == end(m_lid)) continue;
+    m_bidlid[b] = i->second;
+    m_lidbid[ i->second ] = b;
+  }
+
+  for (const auto& [c,n] : m_nodeCommMap) {
+    std::vector< std::size_t > gid( begin(n), end(n) );
+    std::sort( begin(gid), end(gid) );
+    auto& l = m_nodeCommLid[c];
+    auto& b = m_nodeCommBid[c];
+    l.resize( gid.size() );
+    b.resize( gid.size() );
+    for (std::size_t i=0; i<gid.size(); ++i) {
+      l[i] = tk::cref_find( m_lid, gid[i] );
+      b[i] = tk::cref_find( m_bid, gid[i] );
+    }
+  }
+}
+
+std::unordered_map< std::size_t, std::size_t >
+Discretization::nodeReorder() const
+// *****************************************************************************
+//  Generate new local node ids using the configured reordering algorithm
+//! \return Mapping of old->new local ids
+//! \details The operator-access reordering depends on the access pattern of
+//!   the PDE operators of the scheme, hence that is done by the schemes.
+// *****************************************************************************
+{
+  const auto alg = g_inputdeck.get< tag::discr, tag::node_reorder >();
+  Assert( alg != ctr::ReorderType::OPERATOR,
+          "Operator-access reordering must be done by the scheme" );
+
+  std::vector< std::size_t > map;
+  if (alg == ctr::ReorderType::MORTON)
+    map = tk::renumberMorton( m_coord );
+  else if (alg == ctr::ReorderType::HILBERT)
+    map = tk::renumberHilbert( m_coord );
+  else {
+    const auto psup =
+      tk::genPsup( m_inpoel, 4, tk::genEsup( m_inpoel, 4 ) );
+    if (alg == ctr::ReorderType::RCM)
+      map = tk::renumberRCM( psup );
+    else
+      map = tk::renumber( psup );
+  }
+
+  std::unordered_map< std::size_t, std::size_t > newlid;
+  for (std::size_t p=0; p<map.size(); ++p) newlid[p] = map[p];
+  return newlid;
+}
+
+void
+Discretization::reorderElems()
+// *****************************************************************************
+//  Reorder mesh elements consistent with the order of mesh nodes
+//! \details Besides the element connectivity, this also updates the host
+//!   element ids of history points. Element-based data of the schemes must be
+//!   (re-)generated after calling this function.
+// *****************************************************************************
+{
+  ++m_meshepoch;        // mesh data changes
+
+  auto map = tk::reorderElements( m_inpoel, 4 );
+
+  for (auto& h : m_histdata) {
+    auto& e = h.get< tag::elem >();
+    e = map[ e ];
+  }
 }
 
 void
@@ -293,6 +530,10 @@ Discretization::vol()
 // Sum mesh volumes to nodes, start communicating them on chare-boundaries
 // *****************************************************************************
 {
+  ++m_meshepoch;        // mesh data changes
+
+  m_setupt0 = CkWallTimer();
+
   const auto& x = m_coord[0];
   const auto& y = m_coord[1];
   const auto& z = m_coord[2];
@@ -364,6 +605,8 @@ Discretization::comvol( const std::vector< std::size_t >& gid,
 //!   and m_volc is overlapped. The contributions are applied in totalvol().
 // *****************************************************************************
 {
+  ++m_meshepoch;        // mesh data changes
+
   Assert( nodevol.size() == gid.size(), "Size mismatch" );
 
   for (std::size_t i=0; i<gid.size(); ++i)
@@ -381,6 +624,8 @@ Discretization::totalvol()
 // Sum mesh volumes and contribute own mesh volume to total volume
 // *****************************************************************************
 {
+  ++m_meshepoch;        // mesh data changes
+
   // Applied received contributions to nodal volumes
   for (const auto& [gid, vol] : m_volc)
     m_vol[ tk::cref_find(m_lid,gid) ] += vol;
@@ -393,6 +638,11 @@ Discretization::totalvol()
   for (auto v : m_v) tvol[0] += v;
   contribute( tvol, CkReduction::sum_double,
     CkCallback(CkReductionTarget(Transporter,totalvol), m_transporter) );
+
+  if (m_initial > 0.0 && g_inputdeck.get< tag::cmd, tag::feedback >())
+    contribute( setupreport( { { TVOL, CkWallTimer() - m_setupt0 } } ),
+      CkReduction::max_double,
+      CkCallback( CkReductionTarget(Transporter,setuptime), m_transporter ) );
 }
 
 void
@@ -423,6 +673,10 @@ Discretization::stat( tk::real mesh_volume )
   Assert( psup.second.size()-1 == m_gid.size(),
           "Number of mesh points and number of global IDs unequal" );
 
+  // Mask floating-point exceptions while binning samples into PDFs
+  fenv_t fe;
+  feholdexcept( &fe );
+
   // Compute edge length statistics
   // Note that while the min and max edge lengths are independent of the number
   // of CPUs (by the time they are aggregated across all chares), the sum of
@@ -467,6 +721,9 @@ Discretization::stat( tk::real mesh_volume )
   min[2] = max[2] = sum[5] = m_inpoel.size() / 4;
   ntetPDF.add( min[2] );
 
+  feclearexcept( FE_UNDERFLOW );
+  feupdateenv( &fe );
+
   // Contribute to mesh statistics across all Discretization chares
   contribute( min, CkReduction::min_double,
     CkCallback(CkReductionTarget(Transporter,minstat), m_transporter) );
@@ -484,6 +741,84 @@ Discretization::stat( tk::real mesh_volume )
   contribute( stream.first, stream.second.get(), PDFMerger, cb );
 }
 
+void
+Discretization::imbalance()
+// *****************************************************************************
+// Contribute number of mesh cells to evaluating the load imbalance
+//! \details Each chare contributes its number of cells to its own entry of a
+//!   vector of the number of cells per chare summed across all chares, so
+//!   both the maximum and the mean may be computed from a single reduction by
+//!   Transporter::imbalance().
+// *****************************************************************************
+{
+  std::vector< tk::real > nelem( static_cast< std::size_t >( m_nchare ), 0.0 );
+  nelem[ static_cast< std::size_t >( thisIndex ) ] =
+    static_cast< tk::real >( m_inpoel.size()/4 );
+
+  contribute( nelem, CkReduction::sum_double,
+    CkCallback( CkIndex_Transporter::imbalance(nullptr), m_transporter ) );
+}
+
+void
+Discretization::commgraph( int lb )
+// *****************************************************************************
+// Contribute to the communication graph of chares
+//! \param[in] lb If nonzero, we are load balancing during time stepping,
+//!   contribute to Transporter::lbgraph(), if zero, we are during setup,
+//!   contribute to Transporter::commgraph()
+//! \details Each chare contributes its load, the size of its data, and its
+//!   PE, followed by the chare id and the number of shared nodes of each of
+//!   its neighbor chares, aggregated across all chares in a hash map
+//!   associating chare ids to these vectors. During setup the load is the
+//!   number of cells, during time stepping it is the cost measured by the
+//!   solver since the last load balancing (or the number of cells if none has
+//!   been measured), which is then reset.
+// *****************************************************************************
+{
+  // Estimate the size of our data migrated
+  PUP::sizer sizer;
+  pup( sizer );
+
+  auto nelem = static_cast< tk::real >( m_inpoel.size()/4 );
+  auto load = lb && m_cost > 0.0 ? m_cost : nelem;
+  m_cost = 0.0;
+
+  std::vector< tk::real > g{ load, static_cast< tk::real >( sizer.size() ),
+                             static_cast< tk::real >( CkMyPe() ) };
+  for (const auto& [ c, nodes ] : m_nodeCommMap) {
+    g.push_back( static_cast< tk::real >( c ) );
+    g.push_back( static_cast< tk::real >( nodes.size() ) );
+  }
+
+  std::unordered_map< int, std::vector< tk::real > > graph{
+    { thisIndex, std::move(g) } };
+
+  auto stream = tk::serialize( graph );
+  if (lb)
+    contribute( stream.first, stream.second.get(), GraphMerger,
+      CkCallback( CkIndex_Transporter::lbgraph(nullptr), m_transporter ) );
+  else
+    contribute( stream.first, stream.second.get(), GraphMerger,
+      CkCallback( CkIndex_Transporter::commgraph(nullptr), m_transporter ) );
+}
+
+void
+Discretization::remap( const std::vector< int >& pe )
+// *****************************************************************************
+// Migrate to the PE computed from the communication graph of chares
+//! \param[in] pe PE of each chare, see Transporter::commgraph()
+//! \details Array elements bound to this one, i.e., the worker chares of the
+//!   discretization scheme, migrate together with it. Completion of all
+//!   migrations is detected by quiescence, see Transporter::remapped().
+// *****************************************************************************
+{
+  Assert( pe.size() == static_cast< std::size_t >( m_nchare ),
+          "Size mismatch" );
+
+  auto p = pe[ static_cast< std::size_t >( thisIndex ) ];
+  if (p != CkMyPe()) migrateMe( p );
+}
+
 void
 Discretization::boxvol( const std::vector< std::size_t >& nodes )
 // *****************************************************************************
@@ -500,8 +835,145 @@ Discretization::boxvol( const std::vector< std::size_t >& nodes )
     CkCallback(CkReductionTarget(Transporter,boxvol), m_transporter) );
 }
 
+bool
+Discretization::surfdue() const
+// *****************************************************************************
+//  Query if surface field output is decoupled and due in this time step
+//! \return True if the surface fields are output at their own interval,
+//!   independently of the volume fields, and that interval is hit
+// *****************************************************************************
+{
+  return surfDecoupled() &&
+         !(m_it % g_inputdeck.get< tag::interval, tag::surface >());
+}
+
+inciter::FieldStats
+Discretization::stats( std::size_t ncomp ) const
+// *****************************************************************************
+//  Create zero time averages and second moments of nodal solution fields
+//! \param[in] ncomp Number of scalar components of the nodal solution
+//! \return Time averages and second moments configured by the user of all
+//!   solution components in our mesh nodes, or empty statistics if the user
+//!   has not configured any
+// *****************************************************************************
+{
+  const auto& discr = g_inputdeck.get< tag::discr >();
+  if (!(discr.get< tag::tavg >() <
+        std::numeric_limits< kw::time_average::info::expect::type >::max()))
+    return {};
+
+  // Convert one-based user component ids of covariances to indices
+  const auto& cov = discr.get< tag::covariance >();
+  ErrChk( cov.size() % 2 == 0, "Covariances must be given in pairs" );
+  std::vector< std::size_t > c;
+  for (auto i : cov) {
+    ErrChk( i >= 1 && i <= ncomp, "Covariance component " + std::to_string(i) +
+            " out of bounds [1..." + std::to_string(ncomp) + "]" );
+    c.push_back( i-1 );
+  }
+
+  return FieldStats( m_gid.size(), ncomp, c );
+}
+
+tk::real
+Discretization::statsweight() const
+// *****************************************************************************
+//  Weight of the solution of this time step in the time averages
+//! \return The part of the time step size since the time configured to start
+//!   averaging from, zero if the new time is not after that time
+//! \details This is to be called after the solution of the time step has been
+//!   computed and before the physical time is advanced by next().
+// *****************************************************************************
+{
+  const auto t = m_t + m_dt;
+  const auto t0 = g_inputdeck.get< tag::discr, tag::tavg >();
+  return t > t0 ? std::min( m_dt, t - t0 ) : 0.0;
+}
+
+bool
+Discretization::slicedue() const
+// *****************************************************************************
+//  Query if slice output is configured and due in this time step
+//! \return True if planar slices or iso-surfaces are configured and their
+//!   output interval is hit
+// *****************************************************************************
+{
+  const auto& discr = g_inputdeck.get< tag::discr >();
+  return (!discr.get< tag::slice >().empty() ||
+          !discr.get< tag::isosurface >().empty()) &&
+         !(m_it % g_inputdeck.get< tag::interval, tag::slice >());
+}
+
+void
+Discretization::slices(
+  const tk::Fields& u,
+  const std::vector< std::string >& nodefieldnames,
+  const std::vector< std::vector< tk::real > >& nodefields,
+  CkCallback c )
+// *****************************************************************************
+//  Output planar slices and iso-surfaces of node fields to files
+//! \param[in] u Nodal solution whose components iso-surfaces are extracted of
+//! \param[in] nodefieldnames Names of the node fields to output
+//! \param[in] nodefields Node fields to interpolate onto the slices
+//! \param[in] c Function to continue with after the write
+//! \details The slices of our mesh chunk are extracted here, in-situ, and
+//!   only the triangulated slices and the fields interpolated onto them are
+//!   sent to the meshwriter, see tk::slice() and MeshWriter::writeSlices().
+// *****************************************************************************
+{
+  const auto& discr = g_inputdeck.get< tag::discr >();
+  const auto& plane = discr.get< tag::slice >();
+  const auto& iso = discr.get< tag::isosurface >();
+  ErrChk( plane.size() % 6 == 0, "Slices must be given by 6 reals per plane" );
+  ErrChk( iso.size() % 2 == 0, "Iso-surfaces must be given in pairs" );
+
+  const auto& of = g_inputdeck.get< tag::cmd, tag::io, tag::output >();
+  std::vector< std::string > basefilenames;
+  std::vector< std::vector< std::size_t > > triinpoel;
+  std::vector< tk::UnsMesh::Coords > coord;
+  std::vector< std::vector< std::vector< tk::real > > > fields;
+
+  // Extract zero level set of d and interpolate node fields onto it
+  auto extract = [&]( std::string&& basefilename,
+                      const std::vector< tk::real >& d )
+  {
+    auto s = tk::slice( m_inpoel, m_coord, d );
+    basefilenames.push_back( std::move(basefilename) );
+    fields.emplace_back();
+    for (const auto& f : nodefields)
+      fields.back().push_back( tk::interpolate( s, f ) );
+    triinpoel.push_back( std::move(s.triinpoel) );
+    coord.push_back( std::move(s.coord) );
+  };
+
+  for (std::size_t k=0; k<plane.size()/6; ++k) {
+    const auto p = plane.data() + k*6;
+    ErrChk( tk::length( p[3], p[4], p[5] ) > 0.0,
+            "Normal of slice " + std::to_string(k+1) + " is zero" );
+    extract( of + "-slice." + std::to_string(k+1),
+             tk::planedist( m_coord, {{p[0],p[1],p[2]}}, {{p[3],p[4],p[5]}} ) );
+  }
+
+  for (std::size_t k=0; k<iso.size()/2; ++k) {
+    const auto c1 = iso[k*2+0];
+    const auto comp = c1 >= 1.0 ? static_cast< std::size_t >( c1 ) : 0;
+    ErrChk( comp >= 1 && comp <= u.nprop() &&
+            !(std::abs( c1 - static_cast< tk::real >( comp ) ) > 0.0),
+            "Component of iso-surface " + std::to_string(k+1) +
+            " must be an integer in [1..." + std::to_string(u.nprop()) + "]" );
+    std::vector< tk::real > d( u.nunk() );
+    for (std::size_t i=0; i<d.size(); ++i) d[i] = u(i,comp-1,0) - iso[k*2+1];
+    extract( of + "-iso." + std::to_string(k+1), d );
+  }
+
+  m_meshwriter[ CkNodeFirst( CkMyNode() ) ].
+    writeSlices( ++m_itsl, m_t, thisIndex, basefilenames, triinpoel, coord,
+                 nodefieldnames, fields, c, msgopts( NUMMSG ) );
+}
+
 void
 Discretization::write(
+  bool volume,
   const std::vector< std::size_t >& inpoel,
   const tk::UnsMesh::Coords& coord,
   const std::map< int, std::vector< std::size_t > >& bface,
@@ -516,6 +988,8 @@ Discretization::write(
   CkCallback c )
 // *****************************************************************************
 //  Output mesh and fields data (solution dump) to file(s)
+//! \param[in] volume True to output the volume mesh and fields, false to only
+//!   output the surface fields, if they are decoupled, see surfdue()
 //! \param[in] inpoel Mesh connectivity for the mesh chunk to be written
 //! \param[in] coord Node coordinates of the mesh chunk to be written
 //! \param[in] bface Map of boundary-face lists mapped to corresponding side set
@@ -543,29 +1017,210 @@ Discretization::write(
 //!   output is serialized through the first PE of each compute node. In SMP
 //!   mode, channeling multiple files via a single PE on each node is required
 //!   by NetCDF and HDF5, as well as ExodusII, since none of these libraries are
-//!   thread-safe.
+//!   thread-safe. If aggregating the output of chares, the output of all
+//!   chares on a compute node is written into a single file: the meshwriter
+//!   is told how many chares write on each compute node, since chares may
+//!   have migrated. The output is copied once into a write request, whose
+//!   address is handed over to the meshwriter, which is in the same address
+//!   space, see tk::MeshWriter::writeLocal(). If writing asynchronously, time
+//!   stepping continues right away, unless the previous write has not yet
+//!   finished (double buffering), see written(). If the surface field output
+//!   is decoupled from the volume field output, the surface files get their
+//!   own time steps, counted by m_itsf, and the surface mesh is written with
+//!   their first output after a new mesh.
 // *****************************************************************************
 {
   // If the previous iteration refined (or moved) the mesh or this is called
   // before the first time step, we also output the mesh.
-  bool meshoutput = m_itf == 0 ? true : false;
+  bool meshoutput = volume && m_itf == 0;
 
   auto eps = std::numeric_limits< tk::real >::epsilon();
   bool fieldoutput = false;
 
   // Output field data only if there is no dump at this physical time yet
-  if (std::abs(m_lastDumpTime - m_t) > eps ) {
+  if (volume && std::abs(m_lastDumpTime - m_t) > eps ) {
     m_lastDumpTime = m_t;
     ++m_itf;
     fieldoutput = true;
   }
 
-  m_meshwriter[ CkNodeFirst( CkMyNode() ) ].
-    write( meshoutput, fieldoutput, m_itr, m_itf, m_t, thisIndex,
-           g_inputdeck.get< tag::cmd, tag::io, tag::output >(),
-           inpoel, coord, bface, bnode, triinpoel, elemfieldnames,
-           nodefieldnames, nodesurfnames, elemfields, nodefields, nodesurfs,
-           g_inputdeck.outsets(), c );
+  // Output surface fields with the volume fields unless decoupled
+  bool surfmeshoutput = meshoutput;
+  bool surffieldoutput = fieldoutput;
+  auto itsf = m_itf;
+  if (surfDecoupled()) {
+    const auto surf = surfdue();
+    surfmeshoutput = surf && m_itsf == 0;
+    surffieldoutput = false;
+    if (surf && std::abs(m_lastSurfTime - m_t) > eps) {
+      m_lastSurfTime = m_t;
+      ++m_itsf;
+      surffieldoutput = true;
+    }
+    itsf = m_itsf;
+  }
+
+  if (g_inputdeck.get< tag::discr, tag::aggregate >()) {
+    std::vector< int > cnt( static_cast< std::size_t >( CkNumNodes() ), 0 );
+    cnt[ static_cast< std::size_t >( CkMyNode() ) ] = 1;
+    contribute( cnt, CkReduction::sum_int,
+      CkCallback( tk::CkIndex_MeshWriter::redn_wrapper_nwrite(nullptr),
+                  m_meshwriter ) );
+  }
+
+  // Close the files kept open by the meshwriter on another compute node if
+  // this chare has migrated since its last field output
+  if (g_inputdeck.get< tag::discr, tag::persistent >() &&
+      !g_inputdeck.get< tag::discr, tag::aggregate >())
+  {
+    if (m_writenode != -1 && m_writenode != CkMyNode())
+      m_meshwriter[ CkNodeFirst( m_writenode ) ].close( thisIndex );
+    m_writenode = CkMyNode();
+  }
+
+  const auto async = g_inputdeck.get< tag::discr, tag::asyncwrite >();
+
+  // Time the first (synchronous) field output, which also writes the mesh
+  if (meshoutput && !async && g_inputdeck.get< tag::cmd, tag::feedback >()) {
+    m_setupt0 = CkWallTimer();
+    m_firstcb = c;
+    c = CkCallback( CkIndex_Discretization::firstwritten(),
+                    thisProxy[thisIndex] );
+  }
+
+  // Hand the output over to the meshwriter on this compute node by address
+  auto r = new tk::MeshWriter::Request{
+    { meshoutput, fieldoutput, surfmeshoutput, surffieldoutput, m_itr, m_itf,
+      itsf, m_t, g_inputdeck.get< tag::cmd, tag::io, tag::output >(),
+      elemfieldnames, nodefieldnames, nodesurfnames, g_inputdeck.outsets() },
+    { thisIndex, inpoel, coord, m_gid, bface, bnode, triinpoel, elemfields,
+      nodefields, nodesurfs,
+      async ? CkCallback( CkIndex_Discretization::written(),
+                          thisProxy[thisIndex] ) : c } };
+  m_meshwriter[ CkNodeFirst( CkMyNode() ) ].writeLocal(
+    static_cast< uint64_t >( reinterpret_cast< std::uintptr_t >( r ) ),
+    msgopts( NUMMSG ) );
+
+  // Continue while writing unless the previous write is still unfinished
+  if (async) {
+    if (++m_nwrite == 1) c.send(); else m_writecb = c;
+  }
+}
+
+void
+Discretization::written()
+// *****************************************************************************
+//  Receive notice that a field output written asynchronously has finished
+// *****************************************************************************
+{
+  Assert( m_nwrite > 0, "No field output written asynchronously" );
+
+  // Continue if waiting for the previous write to finish
+  if (--m_nwrite == 1) m_writecb.send();
+}
+
+void
+Discretization::firstwritten()
+// *****************************************************************************
+//  Receive notice that the first field output has finished
+//! \details The time of the first field output, including that of the mesh,
+//!   is reported with the setup phases, then we continue as after any write.
+// *****************************************************************************
+{
+  contribute( setupreport( { { TOUTPUT, CkWallTimer() - m_setupt0 } } ),
+    CkReduction::max_double,
+    CkCallback( CkReductionTarget(Transporter,setuptime), m_transporter ) );
+  m_firstcb.send();
+}
+
+void
+Discretization::iobench( std::size_t nfield )
+// *****************************************************************************
+//  Output synthetic fields to file(s) in I/O benchmark mode
+//! \param[in] nfield Number of scalar fields to output both in mesh nodes and
+//!   in mesh elements
+//! \details Instead of the solution, smooth functions of the coordinates are
+//!   written, so that compression, if configured, sees data similar to a
+//!   solution. The mesh is only written with the first field output, as in
+//!   time stepping without mesh refinement. Contrary to write(), the output
+//!   is never asynchronous, so that Transporter times the write itself.
+// *****************************************************************************
+{
+  const auto& x = m_coord[0];
+  const auto& y = m_coord[1];
+  const auto& z = m_coord[2];
+  auto npoin = x.size();
+  auto nelem = m_inpoel.size() / 4;
+
+  std::vector< std::string > nodefieldnames, elemfieldnames;
+  std::vector< std::vector< tk::real > >
+    nodefields( nfield, std::vector< tk::real >( npoin ) ),
+    elemfields( nfield, std::vector< tk::real >( nelem ) );
+  for (std::size_t v=0; v<nfield; ++v) {
+    nodefieldnames.push_back( "node" + std::to_string(v+1) );
+    elemfieldnames.push_back( "elem" + std::to_string(v+1) );
+    auto k = static_cast< tk::real >( v+1 ) + static_cast< tk::real >( m_itf );
+    for (std::size_t p=0; p<npoin; ++p)
+      nodefields[v][p] = std::sin( k*x[p] ) * std::cos( k*y[p] ) + z[p];
+    for (std::size_t e=0; e<nelem; ++e)
+      elemfields[v][e] = nodefields[v][ m_inpoel[e*4] ];
+  }
+
+  bool meshoutput = m_itf == 0;
+  ++m_itf;
+
+  if (g_inputdeck.get< tag::discr, tag::aggregate >()) {
+    std::vector< int > cnt( static_cast< std::size_t >( CkNumNodes() ), 0 );
+    cnt[ static_cast< std::size_t >( CkMyNode() ) ] = 1;
+    contribute( cnt, CkReduction::sum_int,
+      CkCallback( tk::CkIndex_MeshWriter::redn_wrapper_nwrite(nullptr),
+                  m_meshwriter ) );
+  }
+
+  // Side sets are not written
+  std::map< int, std::vector< std::size_t > > bface, bnode;
+  std::vector< std::size_t > triinpoel;
+  std::vector< std::string > nodesurfnames;
+  std::vector< std::vector< tk::real > > nodesurfs;
+  std::set< int > outsets;
+
+  auto r = new tk::MeshWriter::Request{
+    { meshoutput, /* fieldoutput = */ true, meshoutput,
+      /* surffieldoutput = */ true, m_itr, m_itf, m_itf,
+      static_cast< tk::real >( m_itf ),
+      g_inputdeck.get< tag::cmd, tag::io, tag::output >(), elemfieldnames,
+      nodefieldnames, nodesurfnames, outsets },
+    { thisIndex, m_inpoel, m_coord, m_gid, bface, bnode, triinpoel,
+      std::move( elemfields ), std::move( nodefields ), nodesurfs,
+      CkCallback( CkIndex_Discretization::iowritten(),
+                  thisProxy[thisIndex] ) } };
+  m_meshwriter[ CkNodeFirst( CkMyNode() ) ].writeLocal(
+    static_cast< uint64_t >( reinterpret_cast< std::uintptr_t >( r ) ),
+    msgopts( NUMMSG ) );
+}
+
+void
+Discretization::iowritten()
+// *****************************************************************************
+//  Receive notice that a field output of the I/O benchmark has finished
+// *****************************************************************************
+{
+  contribute(
+    CkCallback( CkReductionTarget(Transporter,iowritten), m_transporter ) );
+}
+
+void
+Discretization::iocheckpoint()
+// *****************************************************************************
+//  Save checkpoint/restart files at the end of the I/O benchmark
+//! \details This takes the same path as the checkpoint at the end of time
+//!   stepping, so incremental checkpoints, if configured, are also measured.
+// *****************************************************************************
+{
+  int finished = 1;
+  checkpointing();
+  contribute( sizeof(int), &finished, CkReduction::nop,
+    CkCallback( CkReductionTarget(Transporter,checkpoint), m_transporter ) );
 }
 
 void
@@ -611,6 +1266,69 @@ Discretization::grindZero()
   }
 }
 
+std::string
+Discretization::ckptMeshFile( uint64_t epoch ) const
+// *****************************************************************************
+//  Construct file name of mesh data of incremental checkpoints
+//! \param[in] epoch Mesh epoch
+//! \return File name of mesh data of a mesh epoch in the restart directory
+// *****************************************************************************
+{
+  return g_inputdeck.get< tag::cmd, tag::io, tag::restart >() + "/mesh." +
+         std::to_string( epoch ) + '.' + std::to_string( thisIndex );
+}
+
+void
+Discretization::ckptMesh( PUP::er& p )
+// *****************************************************************************
+//  Pack/Unpack mesh data of incremental checkpoints via a file per mesh epoch
+//! \param[in,out] p Charm++'s PUP::er serializer object reference
+//! \details When packing, the mesh data is written to a file, optionally
+//!   compressed, only if it has not yet been written for the current mesh
+//!   epoch. The file of the epoch before the previous one is then removed,
+//!   keeping the file referred to by the previous checkpoint until the new
+//!   checkpoint is complete. When unpacking, i.e., restarting, the mesh data
+//!   is read back from the file of the mesh epoch of the checkpoint.
+// *****************************************************************************
+{
+  if (p.isPacking() && m_ckptepoch != m_meshepoch) {
+
+    PUP::sizer s;
+    pupMesh( s );
+    std::vector< char > buf( s.size() );
+    PUP::toMem t( buf.data() );
+    pupMesh( t );
+    auto compressed =
+      static_cast< char >( g_inputdeck.get< tag::cmd, tag::ckptcompress >() );
+    if (compressed) buf = tk::compress( buf.data(), buf.size() );
+
+    const auto filename = ckptMeshFile( m_meshepoch );
+    std::ofstream f( filename, std::ios::binary );
+    f.write( &compressed, 1 );
+    f.write( buf.data(), static_cast< std::streamsize >( buf.size() ) );
+    ErrChk( f.good(), "Failed to write checkpoint mesh file " + filename );
+
+    if (m_ckptprev != std::numeric_limits< uint64_t >::max())
+      std::remove( ckptMeshFile( m_ckptprev ).c_str() );
+    m_ckptprev = m_ckptepoch;
+    m_ckptepoch = m_meshepoch;
+
+  } else if (p.isUnpacking()) {
+
+    const auto filename = ckptMeshFile( m_meshepoch );
+    std::ifstream f( filename, std::ios::binary );
+    ErrChk( f.good(), "Failed to open checkpoint mesh file " + filename );
+    char compressed = 0;
+    f.read( &compressed, 1 );
+    std::vector< char > buf( (std::istreambuf_iterator< char >( f )),
+                             std::istreambuf_iterator< char >() );
+    if (compressed) buf = tk::decompress( buf );
+    PUP::fromMem m( buf.data() );
+    pupMesh( m );
+
+  }
+}
+
 bool
 Discretization::restarted( int nrestart )
 // *****************************************************************************
@@ -693,6 +1411,44 @@ Discretization::history( std::vector< std::vector< tk::real > >&& data )
   }
 }
 
+void
+Discretization::memory( std::array< std::size_t, NUMMEM > b )
+// *****************************************************************************
+// Contribute memory report of a worker at the end of setup
+//! \param[in] b Bytes per category accounted by the scheme worker bound to us,
+//!   to which the bytes of the mesh and communication maps held here are added
+// *****************************************************************************
+{
+  b[MMESH] += tk::bytes( m_inpoel, m_gid, m_lid, m_coord, m_v, m_vol, m_volc,
+                         m_bid, m_bidlid, m_lidbid );
+  b[MCOMMAP] += tk::bytes( m_nodeCommMap, m_nodeCommLid, m_nodeCommBid,
+                           m_edgeCommMap );
+  auto stream = serialize( memreport( MSETUP, b ) );
+  contribute( stream.first, stream.second.get(), MemMerger,
+    CkCallback(CkIndex_Transporter::memory(nullptr), m_transporter) );
+}
+
+void
+Discretization::trace()
+// *****************************************************************************
+// Record the phase of the time step left as a trace event
+//! \details The kinds of trace events are registered once per process, by the
+//!   first chare switching phases, so that recording an event only queries
+//!   the clock and stores a few numbers in the trace buffer of our PE.
+// *****************************************************************************
+{
+  static const auto ev = []{
+    std::array< std::uint32_t, NUMPHASE > e;
+    for (std::size_t p=0; p<NUMPHASE; ++p)
+      e[p] = tk::traceEvent( PhaseName[p] );
+    return e; }();
+
+  auto now = CkWallTimer();
+  stateProxy.ckLocalBranch()->trace( ev[ m_phase.current() ], thisIndex, m_it,
+                                     m_tracet0, now );
+  m_tracet0 = now;
+}
+
 void
 Discretization::status()
 // *****************************************************************************
@@ -709,6 +1465,29 @@ Discretization::status()
   auto grind_time = duration_cast< ms >(clock::now() - m_prevstatus).count();
   m_prevstatus = clock::now();
 
+  // Contribute times spent in the phases of time steps and communication
+  // counts since the last report
+  const auto perffreq = g_inputdeck.get< tag::cmd, tag::perffreq >();
+  if (perffreq && !(m_it % perffreq)) {
+    std::vector< std::vector< tk::real > > perf( NUMPERF, m_phase.times() );
+    perf[PITER] = { static_cast< tk::real >( m_it ) };
+    const auto b = busy( perf[PSUM] );
+    perf[PPE].assign( static_cast< std::size_t >( CkNumPes() ), 0.0 );
+    perf[PPE][ static_cast< std::size_t >( CkMyPe() ) ] = b;
+    perf[PSLOW] = { b, perf[PSUM][WAIT], static_cast< tk::real >( thisIndex ),
+      static_cast< tk::real >( CkMyPe() ),
+      static_cast< tk::real >( m_inpoel.size()/4 ),
+      static_cast< tk::real >( m_gid.size() ) };
+    auto stream = serialize( perf );
+    contribute( stream.first, stream.second.get(), PerfMerger,
+      CkCallback(CkIndex_Transporter::perf(nullptr), m_transporter) );
+    auto comm = m_comm.report();
+    comm.back() = { static_cast< tk::real >( m_it ) };
+    stream = serialize( comm );
+    contribute( stream.first, stream.second.get(), CommMerger,
+      CkCallback(CkIndex_Transporter::comm(nullptr), m_transporter) );
+  }
+
   if (thisIndex==0 && !(m_it%tty)) {
 
     const auto eps = std::numeric_limits< tk::real >::epsilon();
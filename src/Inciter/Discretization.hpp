@@ -13,6 +13,12 @@
 #ifndef Discretization_h
 #define Discretization_h
 
+#include <map>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+
 #include <brigand/algorithms/for_each.hpp>
 
 #include "Types.hpp"
@@ -24,6 +30,10 @@
 #include "UnsMesh.hpp"
 #include "CommMap.hpp"
 #include "History.hpp"
+#include "FieldStats.hpp"
+#include "PhaseTimer.hpp"
+#include "CommCounter.hpp"
+#include "MemoryReport.hpp"
 #include "Inciter/InputDeck/InputDeck.hpp"
 
 #include "NoWarning/discretization.decl.h"
@@ -110,6 +120,30 @@ class Discretization : public CBase_Discretization {
     //! Compute mesh cell statistics
     void stat( tk::real mesh_volume );
 
+    //! Contribute number of mesh cells to evaluating the load imbalance
+    void imbalance();
+
+    //! Contribute to the communication graph of chares
+    void commgraph( int lb );
+
+    //! Migrate to the PE computed from the communication graph of chares
+    void remap( const std::vector< int >& pe );
+
+    //! Receive notice that a field output written asynchronously has finished
+    void written();
+
+    //! Receive notice that the first field output has finished
+    void firstwritten();
+
+    //! Output synthetic fields to file(s) in I/O benchmark mode
+    void iobench( std::size_t nfield );
+
+    //! Receive notice that a field output of the I/O benchmark has finished
+    void iowritten();
+
+    //! Save checkpoint/restart files at the end of the I/O benchmark
+    void iocheckpoint();
+
     //! Compute total box IC volume
     void boxvol( const std::vector< std::size_t >& boxnodes );
 
@@ -163,10 +197,16 @@ class Discretization : public CBase_Discretization {
     //! Iteration count accessor
     uint64_t It() const { return m_it; }
 
+    //! Mesh epoch accessor
+    //! \return Version of the data that only changes with the mesh
+    uint64_t MeshEpoch() const { return m_meshepoch; }
+
     //! Non-const-ref refinement iteration count accessor
     uint64_t& Itr() { return m_itr; }
     //! Non-const-ref field-output iteration count accessor
     uint64_t& Itf() { return m_itf; }
+    //! Non-const-ref surface field-output iteration count accessor
+    uint64_t& Itsf() { return m_itsf; }
 
     //! Non-const-ref number of restarts accessor
     int& Nrestart() { return m_nrestart; }
@@ -176,6 +216,24 @@ class Discretization : public CBase_Discretization {
     //! Timer accessor as non-const-ref
     tk::Timer& Timer() { return m_timer; }
 
+    //! Add to the cost of this chare measured by the solver
+    //! \param[in] c Cost to add, e.g., time spent computing in seconds
+    void addCost( tk::real c ) { m_cost += c; }
+
+    //! Switch the timer of the phases of the time step to a new phase
+    //! \param[in] p Phase of the time step entered
+    //! \details If tracing, the phase left is also recorded as a trace event.
+    void phase( Phase p ) {
+      if (m_tracing) trace();
+      m_phase( p );
+    }
+
+    //! Communication counters accessor as non-const-ref
+    CommCounter& Comm() { return m_comm; }
+
+    //! Contribute memory report of a worker at the end of setup
+    void memory( std::array< std::size_t, NUMMEM > b );
+
     //! Accessor to flag indicating if the mesh was refined as a value
     int refined() const { return m_refined; }
     //! Accessor to flag indicating if the mesh was refined as non-const-ref
@@ -210,6 +268,21 @@ class Discretization : public CBase_Discretization {
     //! Node communication map accessor as non-const-ref
     tk::NodeCommMap& NodeCommMap() { return m_nodeCommMap; }
 
+    //! Node communication schedule (local node ids) accessor as const-ref
+    const std::map< int, std::vector< std::size_t > >& NodeCommLid() const
+    { return m_nodeCommLid; }
+    //! \brief Node communication schedule (chare-boundary node ids) accessor
+    //!   as const-ref
+    const std::map< int, std::vector< std::size_t > >& NodeCommBid() const
+    { return m_nodeCommBid; }
+
+    //! \brief Local node ids of chare-boundary nodes (indexed by
+    //!   chare-boundary id) accessor as const-ref
+    const std::vector< std::size_t >& BidLid() const { return m_bidlid; }
+    //! \brief Chare-boundary ids of local nodes (indexed by local node id)
+    //!   accessor as const-ref
+    const std::vector< std::size_t >& LidBid() const { return m_lidbid; }
+
     //! Edge communication map accessor as const-ref
     const tk::EdgeCommMap& EdgeCommMap() const { return m_edgeCommMap; }
     //! Edge communication map accessor as non-const-ref
@@ -235,8 +308,27 @@ class Discretization : public CBase_Discretization {
     //! Output time history for a time step
     void history( std::vector< std::vector< tk::real > >&& data );
 
+    //! Query if surface field output is decoupled and due in this time step
+    bool surfdue() const;
+
+    //! Create zero time averages and second moments of nodal solution fields
+    FieldStats stats( std::size_t ncomp ) const;
+
+    //! Weight of the solution of this time step in the time averages
+    tk::real statsweight() const;
+
+    //! Query if slice output is configured and due in this time step
+    bool slicedue() const;
+
+    //! Output planar slices and iso-surfaces of node fields to files
+    void slices( const tk::Fields& u,
+                 const std::vector< std::string >& nodefieldnames,
+                 const std::vector< std::vector< tk::real > >& nodefields,
+                 CkCallback c );
+
     //! Output mesh and fields data (solution dump) to file(s)
-    void write( const std::vector< std::size_t >& inpoel,
+    void write( bool volume,
+                const std::vector< std::size_t >& inpoel,
                 const tk::UnsMesh::Coords& coord,
                 const std::map< int, std::vector< std::size_t > >& bface,
                 const std::map< int, std::vector< std::size_t > >& bnode,
@@ -255,9 +347,85 @@ class Discretization : public CBase_Discretization {
     //! Detect if just returned from a checkpoint and if so, zero timers
     bool restarted( int nrestart );
 
+    //! Signal that the next pack is a checkpoint, not a migration
+    void checkpointing() { m_checkpointing = true; }
+
+    //! \brief Query if restarted on a different number of PEs than the
+    //!   checkpoint was saved on, and if so, clear the condition
+    //! \return True if restarted on a different number of PEs
+    bool newpes() { auto n = m_newpes; m_newpes = false; return n; }
+
     //! Remap mesh data due to new local ids
     void remap( const std::unordered_map< std::size_t, std::size_t >& map );
 
+    //! Generate new local node ids using the configured reordering algorithm
+    std::unordered_map< std::size_t, std::size_t > nodeReorder() const;
+
+    //! Reorder mesh elements consistent with the order of mesh nodes
+    void reorderElems();
+
+    //! \brief Pack values of a nodal field in nodes shared with a fellow chare
+    //!   into a flat buffer in the order of the node communication schedule
+    //! \tparam Field Nodal field type, e.g., tk::Fields or tk::ReducedFields
+    //! \tparam T Value type of the buffer, e.g., float to send in single
+    //!   precision
+    //! \param[in] c Fellow chare id to pack values for
+    //! \param[in] f Nodal field to pack, indexed by local node ids, or by
+    //!   chare-boundary node ids if bnd is true
+    //! \param[in,out] buf Flat buffer, resized to store all components of f
+    //!   (as consecutive values) for each shared node
+    //! \param[in] bnd True if f is indexed by chare-boundary node ids
+    //! \return Largest absolute rounding error of the values packed, zero if
+    //!   the buffer is of the value type of the field
+    template< class Field, typename T >
+    tk::real packNodeComm( int c,
+                           const Field& f,
+                           std::vector< T >& buf,
+                           bool bnd = false ) const
+    {
+      using V = typename Field::value_type;
+      const auto& id = tk::cref_find( bnd ? m_nodeCommBid : m_nodeCommLid, c );
+      const auto ncomp = f.nprop();
+      buf.resize( id.size() * ncomp );
+      tk::real e = 0.0;
+      for (std::size_t i=0; i<id.size(); ++i)
+        for (std::size_t k=0; k<ncomp; ++k) {
+          const auto v = f( id[i], k, 0 );
+          auto& b = buf[ i*ncomp+k ];
+          b = static_cast< T >( v );
+          if constexpr( !std::is_same_v< T, V > )
+            e = std::max( e, std::abs( static_cast< tk::real >( v ) -
+                                       static_cast< tk::real >( b ) ) );
+        }
+      return e;
+    }
+
+    //! Add flat buffers received from fellow chares to a nodal field
+    //! \tparam Field Nodal field type, e.g., tk::Fields or tk::ReducedFields
+    //! \param[in] buf Flat buffers packed by packNodeComm() on fellow chares,
+    //!   associated to the sender chare ids
+    //! \param[in,out] f Nodal field to add to, indexed by local node ids, or by
+    //!   chare-boundary node ids if bnd is true
+    //! \param[in] bnd True if f is indexed by chare-boundary node ids
+    //! \details Contributions are added in the order of fellow chare ids, so
+    //!   the result does not depend on the order in which messages arrived.
+    template< class Field >
+    void unpackNodeComm(
+      const std::unordered_map< int, std::vector< tk::real > >& buf,
+      Field& f,
+      bool bnd = false ) const
+    {
+      using V = typename Field::value_type;
+      const auto ncomp = f.nprop();
+      for (const auto& [c,id] : bnd ? m_nodeCommBid : m_nodeCommLid) {
+        const auto& b = tk::cref_find( buf, c );
+        Assert( b.size() == id.size() * ncomp, "Size mismatch" );
+        for (std::size_t i=0; i<id.size(); ++i)
+          for (std::size_t k=0; k<ncomp; ++k)
+            f( id[i], k, 0 ) += static_cast< V >( b[ i*ncomp+k ] );
+      }
+    }
+
     //! \brief Function object for querying the node ids at which a particular
     //!   BCType BC is configured by the user, called for each PDE type
     template< typename BCType >
@@ -321,40 +489,71 @@ class Discretization : public CBase_Discretization {
       p | m_it;
       p | m_itr;
       p | m_itf;
+      p | m_itsf;
+      p | m_itsl;
       p | m_initial;
       p | m_t;
       p | m_lastDumpTime;
+      p | m_lastSurfTime;
       p | m_dt;
       p | m_nvol;
       p | m_fct;
       p | m_transporter;
       p | m_meshwriter;
       p | m_refiner;
-      p | m_el;
-      if (p.isUnpacking()) {
-        m_inpoel = std::get< 0 >( m_el );
-        m_gid = std::get< 1 >( m_el );
-        m_lid = std::get< 2 >( m_el );
-      }
-      p | m_coord;
-      p | m_nodeCommMap;
-      p | m_edgeCommMap;
       p | m_meshvol;
-      p | m_v;
-      p | m_vol;
-      p | m_volc;
       p | m_boxvol;
-      p | m_bid;
+      // On incremental checkpoints, mesh data that only changes with the mesh
+      // is written once per mesh epoch to a separate file, see ckptMesh()
+      bool incremental = m_checkpointing &&
+        g_inputdeck.get< tag::cmd, tag::ckptincr >();
+      p | incremental;
+      p | m_meshepoch;
+      if (incremental) ckptMesh( p ); else pupMesh( p );
+      p | m_ckptepoch;
+      p | m_ckptprev;
+      if (!p.isSizing()) m_checkpointing = false;
       p | m_timer;
       p | m_refined;
       p( reinterpret_cast<char*>(&m_prevstatus), sizeof(Clock::time_point) );
       p | m_nrestart;
+      // Detect restarting on a number of PEs different from that saved on
+      int npes = CkNumPes();
+      p | npes;
+      if (p.isUnpacking()) m_newpes = npes != CkNumPes();
       p | m_histdata;
+      p | m_cost;
+      p | m_nwrite;
+      p | m_writecb;
+      p | m_writenode;
+      p | m_phase;
+      p | m_tracing;
+      if (p.isUnpacking()) m_tracet0 = CkWallTimer();
+      p | m_comm;
     }
     //! \brief Pack/Unpack serialize operator|
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
     //! \param[in,out] i Discretization object reference
     friend void operator|( PUP::er& p, Discretization& i ) { i.pup(p); }
+    //! \brief Pack/Unpack serialize mesh data that only changes with the mesh
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    void pupMesh( PUP::er& p ) {
+      // pack the (large) mesh connectivity and coordinates as contiguous arrays
+      PUP::pup_contiguous( p, std::get< 0 >( m_el ) );
+      PUP::pup_contiguous( p, std::get< 1 >( m_el ) );
+      p | std::get< 2 >( m_el );
+      PUP::pup_contiguous( p, m_coord );
+      p | m_nodeCommMap;
+      p | m_nodeCommLid;
+      p | m_nodeCommBid;
+      p | m_bidlid;
+      p | m_lidbid;
+      p | m_edgeCommMap;
+      p | m_v;
+      p | m_vol;
+      p | m_volc;
+      p | m_bid;
+    }
     //@}
 
   private:
@@ -374,12 +573,19 @@ class Discretization : public CBase_Discretization {
     //! \details Counts the number of field outputs to file during two
     //!   time steps with mesh efinement
     uint64_t m_itf;
+    //! \brief Surface field output iteration count without mesh refinement,
+    //!   if surface field output is decoupled from volume field output
+    uint64_t m_itsf;
+    //! Slice and iso-surface output iteration count
+    uint64_t m_itsl;
     //! Flag that is nonzero during setup and zero during time stepping
     tk::real m_initial;
     //! Physical time
     tk::real m_t;
     //! Physical time at last field output
     tk::real m_lastDumpTime;
+    //! Physical time at last decoupled surface field output
+    tk::real m_lastSurfTime;
     //! Physical time step size
     tk::real m_dt;
     //! \brief Number of chares from which we received nodal volume
@@ -411,6 +617,30 @@ class Discretization : public CBase_Discretization {
     //! \brief Global mesh node IDs bordering the mesh chunk held by fellow
     //!   Discretization chares associated to their chare IDs
     tk::NodeCommMap m_nodeCommMap;
+    //! \brief Local ids of mesh nodes shared with fellow chares, associated to
+    //!   fellow chare ids, in the order of their global ids
+    //! \details This is the persistent schedule of nodal exchanges on
+    //!   chare-boundaries: both chares sharing a set of nodes order them the
+    //!   same way, so contributions can be sent as a flat buffer without global
+    //!   ids and added on the receiving side without hash lookups. Rebuilt
+    //!   whenever the mesh or the local node ids change, see commSchedule().
+    std::map< int, std::vector< std::size_t > > m_nodeCommLid;
+    //! \brief Chare-boundary ids of mesh nodes shared with fellow chares, in
+    //!   the same order as m_nodeCommLid
+    std::map< int, std::vector< std::size_t > > m_nodeCommBid;
+    //! \brief Local node ids of chare-boundary nodes indexed by their
+    //!   chare-boundary id
+    //! \details Dense inverse of m_lid restricted to m_bid, so that hot loops
+    //!   over chare-boundary nodes need no hash lookups. Chare-boundary ids of
+    //!   nodes no longer in the mesh (e.g., after derefinement) are associated
+    //!   to std::numeric_limits< std::size_t >::max(). Rebuilt with
+    //!   m_nodeCommLid.
+    std::vector< std::size_t > m_bidlid;
+    //! \brief Chare-boundary ids of mesh nodes indexed by their local id
+    //! \details Dense version of m_bid indexed by local instead of global node
+    //!   ids. Nodes not on the chare boundary are associated to
+    //!   std::numeric_limits< std::size_t >::max(). Rebuilt with m_nodeCommLid.
+    std::vector< std::size_t > m_lidbid;
     //! \brief Edges with global node IDs bordering the mesh chunk held by
     //!   fellow Discretization chares associated to their chare IDs
     tk::EdgeCommMap m_edgeCommMap;
@@ -448,9 +678,56 @@ class Discretization : public CBase_Discretization {
     int m_nrestart;
     //! Data at history point locations
     std::vector< HistData > m_histdata;
+    //! Cost of this chare measured by the solver since last load balancing
+    tk::real m_cost;
+    //! Number of field outputs written asynchronously not yet finished
+    int m_nwrite;
+    //! \brief Function to continue with after the previous field output
+    //!   written asynchronously has finished
+    CkCallback m_writecb;
+    //! Compute node of the meshwriter of the last field output, -1 if none
+    int m_writenode;
+    //! Wall-clock timers of the phases of the time step
+    PhaseTimer m_phase;
+    //! True if recording the phases of the time step as trace events
+    bool m_tracing;
+    //! Wall-clock time the current phase was entered, if tracing
+    tk::real m_tracet0;
+    //! Wall-clock time the setup phase timed was entered, see SetupReport.hpp
+    tk::real m_setupt0;
+    //! Function to continue with after the first field output
+    CkCallback m_firstcb;
+    //! Counters of messages and bytes communicated with fellow chares
+    CommCounter m_comm;
+    //! \brief Mesh epoch, incremented whenever data that only changes with
+    //!   the mesh changes, e.g., due to refinement or reordering
+    uint64_t m_meshepoch;
+    //! Mesh epoch whose mesh data was written by the last checkpoint
+    uint64_t m_ckptepoch;
+    //! Mesh epoch whose mesh data was written by the checkpoint before
+    uint64_t m_ckptprev;
+    //! True if the next pack is a checkpoint, false if it is a migration
+    bool m_checkpointing;
+    //! True if restarted on a different number of PEs than checkpointed
+    bool m_newpes;
+
+    //! Record the phase of the time step left as a trace event
+    void trace();
+
+    //! Construct file name of mesh data of incremental checkpoints
+    std::string ckptMeshFile( uint64_t epoch ) const;
+
+    //! Pack/Unpack mesh data of incremental checkpoints via a file per epoch
+    void ckptMesh( PUP::er& p );
 
     //! Set mesh coordinates based on coordinates map
     tk::UnsMesh::Coords setCoord( const tk::UnsMesh::CoordMap& coordmap );
+
+    //! Build the persistent schedule of nodal exchanges on chare-boundaries
+    void commSchedule();
+
+    //! Find host elements of history points and evaluate shapefunctions
+    void histpoints();
 };
 
 } // inciter::
@@ -16,11 +16,13 @@
 #include <cmath>
 #include <array>
 #include <set>
+#include <limits>
 #include <algorithm>
 
 #include "QuinoaConfig.hpp"
 #include "ContainerUtil.hpp"
 #include "DistFCT.hpp"
+#include "MsgPriority.hpp"
 
 namespace inciter {
 
@@ -38,12 +40,13 @@ DistFCT::DistFCT( int nchare,
                   const std::unordered_map< std::size_t, std::size_t >& lid,
                   const std::vector< std::size_t >& inpoel ) :
   m_naec( 0 ),
-  m_nalw( 0 ),
   m_nlim( 0 ),
   m_nchare( static_cast< std::size_t >( nchare ) ),
   m_nodeCommMap( nodeCommMap ),
   m_bid( bid ),
-  m_lid( lid ),
+  m_bidlid(),
+  m_commgid(),
+  m_commlid(),
   m_inpoel( inpoel ),
   m_fluxcorrector( m_inpoel.size() ),
   m_p( nu, np*2 ),
@@ -54,7 +57,8 @@ DistFCT::DistFCT( int nchare,
   m_ac(),
   m_ul(),
   m_dul(),
-  m_du()
+  m_du(),
+  m_comm()
 // *****************************************************************************
 //  Constructor
 //! \param[in] nchare Total number of worker chares
@@ -71,6 +75,7 @@ DistFCT::DistFCT( int nchare,
 //! \param[in] inpoel Mesh connectivity of our chunk of the mesh
 // *****************************************************************************
 {
+  commLid( lid );       // Store local ids of chare-boundary nodes
   resizeComm();         // Size communication buffers
 }
 
@@ -100,10 +105,37 @@ DistFCT::remap( const Discretization& d )
 //! \param[in] d Discretization proxy to read mesh data from
 // *****************************************************************************
 {
-  m_lid = d.Lid();
+  commLid( d.Lid() );
   m_inpoel = d.Inpoel();
 }
 
+void
+DistFCT::commLid( const std::unordered_map< std::size_t, std::size_t >& lid )
+// *****************************************************************************
+//  Store local ids of chare-boundary nodes used in communication
+//! \param[in] lid Local mesh node ids associated to the global ones of owned
+//!   elements
+//! \details Instead of keeping a copy of the global->local id map, only the
+//!   local ids of chare-boundary nodes are stored, so that the nodes can be
+//!   accessed without hash lookups during time stepping.
+// *****************************************************************************
+{
+  m_bidlid.assign( m_bid.size(), std::numeric_limits< std::size_t >::max() );
+  for (const auto& [g,b] : m_bid) {
+    auto i = lid.find( g );
+    if (i != end(lid)) m_bidlid[b] = i->second;
+  }
+
+  m_commgid.clear();
+  m_commlid.clear();
+  for (const auto& [c,n] : m_nodeCommMap) {
+    auto& gid = m_commgid[c];
+    auto& l = m_commlid[c];
+    gid.assign( begin(n), end(n) );
+    for (auto g : gid) l.push_back( tk::cref_find( lid, g ) );
+  }
+}
+
 void
 DistFCT::resize( std::size_t nu,
                  const tk::NodeCommMap& nodeCommMap,
@@ -125,7 +157,7 @@ DistFCT::resize( std::size_t nu,
 {
   m_nodeCommMap = nodeCommMap;
   m_bid = bid;
-  m_lid = lid;
+  commLid( lid );
   m_inpoel = inpoel;
 
   auto np = m_a.nprop();
@@ -144,8 +176,17 @@ DistFCT::diff( const Discretization& d, const tk::Fields& Un )
 //! \param[in] d Discretization proxy to read mesh data from
 //! \param[in] Un Solution at the previous time step
 //! \return Mass diffusion contribution to the RHS of the low order system
+//! \details If configured, the mass diffusion is assembled over the mesh
+//!   edges, whose weights are computed at the first call after mesh
+//!   refinement or migration, see FluxCorrector::diffEdges().
 // *****************************************************************************
 {
+  if (g_inputdeck.get< tag::discr, tag::fctedge >()) {
+    if (!m_fluxcorrector.hasDiffEdges())
+      m_fluxcorrector.diffEdges( d.Coord(), m_inpoel );
+    return m_fluxcorrector.diff( Un );
+  }
+
   return m_fluxcorrector.diff( d.Coord(), m_inpoel, Un );
 }
 
@@ -181,99 +222,39 @@ DistFCT::aec(
   const Discretization& d,
   const tk::Fields& dUh,
   const tk::Fields& Un,
-  const std::unordered_map< std::size_t,
-    std::vector< std::pair< bool, tk::real > > >& bcdir,
-  const std::unordered_map< int,
-    std::unordered_set< std::size_t > >& symbcnodemap,
-  const std::unordered_map< int,
-    std::unordered_map< std::size_t, std::array< tk::real, 4 > > >& bnorm )
+  const tk::Fields& Ul,
+  tk::Fields&& dUl,
+  const DirBCPlan& bcdir,
+  const tk::BndNodeNormals& symbcnorm,
+  const CProxy_DiagCG& host )
 // *****************************************************************************
-//  Compute and sum antidiffusive element contributions (AEC) to mesh nodes
+//  Compute and sum antidiffusive element contributions (AEC) and the maximum
+//  and minimum unknowns of all elements surrounding nodes
 //! \param[in] d Discretization proxy to read mesh data from
 //! \param[in] dUh Increment of the high order solution
 //! \param[in] Un Solution at the previous time step
-//! \param[in] bcdir Vector of pairs of bool and boundary condition value
-//!   associated to mesh node IDs at which to set Dirichlet boundary conditions.
-//!   Note that this BC data structure must include boundary conditions set
-//!   across all PEs, not just the ones need to be set on this PE.
-//! \param[in] nodes Unique set of node ids at which to set symmetry BCs
-//! \param[in] bnorm Face normals in boundary points: key global node id,
-//!   value: unit normal, outer key: side set id
-//! \details This function computes and starts communicating m_p, which stores
-//!    the sum of all positive (negative) antidiffusive element contributions to
-//!    nodes (Lohner: P^{+,-}_i), see also FluxCorrector::aec().
-// *****************************************************************************
-{
-  // Store a copy of the high order solution increment for later
-  m_du = dUh;
-
-  // Compute and sum antidiffusive element contributions to mesh nodes. Note
-  // that the sums are complete on nodes that are not shared with other chares
-  // and only partial sums on chare-boundary nodes.
-  m_fluxcorrector.aec( d.Coord(), m_inpoel, d.Vol(), bcdir, symbcnodemap, bnorm,
-                       Un, m_p );
-
-  if (d.NodeCommMap().empty())
-    comaec_complete();
-  else // send contributions to chare-boundary nodes to fellow chares
-    for (const auto& [c,n] : d.NodeCommMap()) {
-      std::vector< std::vector< tk::real > > p( n.size() );
-      std::size_t j = 0;
-      for (auto i : n) p[ j++ ] = m_p[ tk::cref_find(m_lid,i) ];
-      thisProxy[ c ].comaec( std::vector<std::size_t>(begin(n),end(n)), p );
-    }
-
-  ownaec_complete( bcdir );
-}
-
-void
-DistFCT::comaec( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& P )
-// *****************************************************************************
-//  Receive sums of antidiffusive element contributions on chare-boundaries
-//! \param[in] gid Global mesh node IDs at which we receive AEC contributions
-//! \param[in] P Partial sums of positive (negative) antidiffusive element
-//!   contributions to chare-boundary nodes
-//! \details This function receives contributions to m_p, which stores the
-//!   sum of all positive (negative) antidiffusive element contributions to
-//!   nodes (Lohner: P^{+,-}_i), see also FluxCorrector::aec(). While m_p stores
-//!   own contributions, m_pc collects the neighbor chare contributions during
-//!   communication. This way work on m_p and m_pc is overlapped. The two are
-//!   combined in lim().
-// *****************************************************************************
-{
-  Assert( P.size() == gid.size(), "Size mismatch" );
-
-  using tk::operator+=;
-
-  for (std::size_t i=0; i<gid.size(); ++i) {
-    auto bid = tk::cref_find( m_bid, gid[i] );
-    Assert( bid < m_pc.size(), "Indexing out of bounds" );
-    m_pc[ bid ] += P[i];
-  }
-
-  if (++m_naec == m_nodeCommMap.size()) {
-    m_naec = 0;
-    comaec_complete();
-  }
-}
-
-void
-DistFCT::alw( const tk::Fields& Un,
-              const tk::Fields& Ul,
-              tk::Fields&& dUl,
-              const CProxy_DiagCG& host )
-// *****************************************************************************
-//  Compute the maximum and minimum unknowns of elements surrounding nodes
-//! \param[in] Un Solution at the previous time step
 //! \param[in] Ul Low order solution
 //! \param[in] dUl Low order solution increment
+//! \param[in] bcdir Dirichlet boundary conditions matched to local mesh node
+//!   IDs
+//! \param[in] symbcnorm Flat arrays of the nodes at which symmetry BCs are set
+//!   and their unit normals
 //! \param[in] host DiagCG Charm++ proxy we interoperate with
-//! \details This function computes and starts communicating m_q, which stores
-//!    the maximum and mimimum unknowns of all elements surrounding each node
-//!    (Lohner: u^{max,min}_i), see also FluxCorrector::alw().
+//! \details This function computes and starts communicating m_p, which stores
+//!    the sum of all positive (negative) antidiffusive element contributions to
+//!    nodes (Lohner: P^{+,-}_i), and m_q, which stores the maximum and
+//!    mimimum unknowns of all elements surrounding each node (Lohner:
+//!    u^{max,min}_i), both computed in a single sweep over the mesh elements
+//!    by FluxCorrector::aec(). Since both are only required to be complete on
+//!    chare-boundary nodes by lim(), and neither depends on the other, they
+//!    are sent together in a single message to each fellow chare, saving a
+//!    communication round per time step.
 // *****************************************************************************
 {
+  // Store a copy of the high order solution increment for verifying the AEC,
+  // only done in DEBUG mode
+  if constexpr (!tk::ndebug) m_du = dUh;
+
   // Store a copy of the low order solution vector and its increment for later
   m_ul = Ul;
   m_dul = std::move(dUl);
@@ -281,47 +262,63 @@ DistFCT::alw( const tk::Fields& Un,
   // Store discretization scheme proxy
   m_host = host;
 
-  // Compute the maximum and minimum unknowns of all elements surrounding nodes
-  // Note that the maximum and minimum unknowns are complete on nodes that are
-  // not shared with other chares and only partially complete on chare-boundary
-  // nodes.
-  m_fluxcorrector.alw( m_inpoel, Un, Ul, m_q );
+  // Compute and sum antidiffusive element contributions to mesh nodes and
+  // compute the maximum and minimum unknowns of all elements surrounding
+  // nodes. Note that both are complete on nodes that are not shared with other
+  // chares and only partially complete on chare-boundary nodes.
+  m_fluxcorrector.aec( d.Coord(), m_inpoel, d.Vol(), bcdir, symbcnorm, Un, Ul,
+                       m_p, m_q );
 
   if (m_nodeCommMap.empty())
-    comalw_complete();
-  else // send contributions at chare-boundary nodes to fellow chares
+    comaec_complete();
+  else // send contributions to chare-boundary nodes to fellow chares
     for (const auto& [c,n] : m_nodeCommMap) {
-      std::vector< std::vector< tk::real > > q( n.size() );
+      std::vector< std::vector< tk::real > > p( n.size() ), q( n.size() );
       std::size_t j = 0;
-      for (auto i : n) q[ j++ ] = m_q[ tk::cref_find(m_lid,i) ];
-      thisProxy[ c ].comalw( std::vector<std::size_t>(begin(n),end(n)), q );
+      for (auto l : tk::cref_find( m_commlid, c )) {
+        p[ j ] = m_p[ l ];
+        q[ j++ ] = m_q[ l ];
+      }
+      const auto& gid = tk::cref_find( m_commgid, c );
+      m_comm.sent( MFCT, c, gid, p, q );
+      thisProxy[ c ].comaec( gid, p, q, msgopts( MFCT ) );
     }
 
-  ownalw_complete();
+  ownaec_complete( bcdir );
 }
 
 void
-DistFCT::comalw( const std::vector< std::size_t >& gid,
+DistFCT::comaec( const std::vector< std::size_t >& gid,
+                 const std::vector< std::vector< tk::real > >& P,
                  const std::vector< std::vector< tk::real > >& Q )
 // *****************************************************************************
-// Receive contributions to the maxima and minima of unknowns of all elements
-// surrounding mesh nodes on chare-boundaries
+//  Receive sums of antidiffusive element contributions and contributions to
+//  the maxima and minima of unknowns of all elements surrounding mesh nodes on
+//  chare-boundaries
 //! \param[in] gid Global mesh node IDs at which we receive contributions
+//! \param[in] P Partial sums of positive (negative) antidiffusive element
+//!   contributions to chare-boundary nodes
 //! \param[in] Q Partial contributions to maximum and minimum unknowns of all
 //!   elements surrounding nodes to chare-boundary nodes
-//! \details This function receives contributions to m_q, which stores the
-//!   maximum and mimimum unknowns of all elements surrounding each node
-//!   (Lohner: u^{max,min}_i), see also FluxCorrector::alw(). While m_q stores
-//!   own contributions, m_qc collects the neighbor chare contributions during
-//!   communication. This way work on m_q and m_qc is overlapped. The two are
-//!   combined in lim().
+//! \details This function receives contributions to m_p, which stores the
+//!   sum of all positive (negative) antidiffusive element contributions to
+//!   nodes (Lohner: P^{+,-}_i), see also FluxCorrector::aec(), and to m_q,
+//!   which stores the maximum and mimimum unknowns of all elements surrounding
+//!   each node (Lohner: u^{max,min}_i), see also FluxCorrector::aec(). While
+//!   m_p and m_q store own contributions, m_pc and m_qc collect the neighbor
+//!   chare contributions during communication. This way work on m_p, m_q and
+//!   m_pc, m_qc is overlapped. They are combined in lim().
 // *****************************************************************************
 {
-  Assert( Q.size() == gid.size(), "Size mismatch" );
+  Assert( P.size() == gid.size() && Q.size() == gid.size(), "Size mismatch" );
+  m_comm.received( MFCT, gid, P, Q );
+
+  using tk::operator+=;
 
   for (std::size_t i=0; i<gid.size(); ++i) {
     auto bid = tk::cref_find( m_bid, gid[i] );
-    Assert( bid < m_qc.size(), "Indexing out of bounds" );
+    Assert( bid < m_pc.size() && bid < m_qc.size(), "Indexing out of bounds" );
+    m_pc[ bid ] += P[i];
     auto& o = m_qc[ bid ];
     const auto& q = Q[i];
     for (ncomp_t c=0; c<m_q.nprop()/2; ++c) {
@@ -330,33 +327,34 @@ DistFCT::comalw( const std::vector< std::size_t >& gid,
     }
   }
 
-  if (++m_nalw == m_nodeCommMap.size()) {
-    m_nalw = 0;
-    comalw_complete();
+  if (++m_naec == m_nodeCommMap.size()) {
+    m_naec = 0;
+    comaec_complete();
   }
 }
 
 void
-DistFCT::lim( const std::unordered_map< std::size_t,
-                std::vector< std::pair< bool, tk::real > > >& bcdir )
+DistFCT::lim( const DirBCPlan& bcdir )
 // *****************************************************************************
 //  Compute the limited antidiffusive element contributions
-//! \param[in] bcdir Vector of pairs of bool and boundary condition value
-//!   associated to mesh node IDs at which to set Dirichlet boundary conditions.
-//!   Note that this BC data structure must include boundary conditions set
-//!   across all PEs, not just the ones need to be set on this PE.
+//! \param[in] bcdir Dirichlet boundary conditions matched to local mesh node
+//!   IDs
 //! \details This function computes and starts communicating m_a, which stores
 //!   the limited antidiffusive element contributions assembled to nodes
 //!   (Lohner: AEC^c), see also FluxCorrector::limit().
 // *****************************************************************************
 {
-  m_fluxcorrector.verify( m_nchare, m_inpoel, m_du, m_dul );
+  // Verify the AEC against the difference of the high and low order
+  // increments in DEBUG mode only, it is an extra pass over the whole mesh
+  if constexpr (!tk::ndebug)
+    m_fluxcorrector.verify( m_nchare, m_inpoel, m_du, m_dul );
 
   // Combine own and communicated contributions to P and Q
-  for (const auto& b : m_bid) {
-    auto lid = tk::cref_find( m_lid, b.first );
-    const auto& bpc = m_pc[ b.second ];
-    const auto& bqc = m_qc[ b.second ];
+  for (std::size_t b=0; b<m_bidlid.size(); ++b) {
+    auto lid = m_bidlid[b];
+    if (lid == std::numeric_limits< std::size_t >::max()) continue;
+    const auto& bpc = m_pc[ b ];
+    const auto& bqc = m_qc[ b ];
     for (ncomp_t c=0; c<m_p.nprop()/2; ++c) {
       m_p(lid,c*2+0,0) += bpc[c*2+0];
       m_p(lid,c*2+1,0) += bpc[c*2+1];
@@ -373,8 +371,10 @@ DistFCT::lim( const std::unordered_map< std::size_t,
     for (const auto& [c,n] : m_nodeCommMap) {
       std::vector< std::vector< tk::real > > a( n.size() );
       std::size_t j = 0;
-      for (auto i : n) a[ j++ ] = m_a[ tk::cref_find(m_lid,i) ];
-      thisProxy[ c ].comlim( std::vector<std::size_t>(begin(n),end(n)), a );
+      for (auto l : tk::cref_find( m_commlid, c )) a[ j++ ] = m_a[ l ];
+      const auto& gid = tk::cref_find( m_commgid, c );
+      m_comm.sent( MFCT, c, gid, a );
+      thisProxy[ c ].comlim( gid, a, msgopts( MFCT ) );
     }
 
   ownlim_complete();
@@ -398,6 +398,7 @@ DistFCT::comlim( const std::vector< std::size_t >& gid,
 // *****************************************************************************
 {
   Assert( A.size() == gid.size(), "Size mismatch" );
+  m_comm.received( MFCT, gid, A );
 
   using tk::operator+=;
 
@@ -420,9 +421,10 @@ DistFCT::apply()
 // *****************************************************************************
 {
   // Combine own and communicated contributions to A
-  for (const auto& b : m_bid) {
-    auto lid = tk::cref_find( m_lid, b.first );
-    const auto& bac = m_ac[ b.second ];
+  for (std::size_t b=0; b<m_bidlid.size(); ++b) {
+    auto lid = m_bidlid[b];
+    if (lid == std::numeric_limits< std::size_t >::max()) continue;
+    const auto& bac = m_ac[ b ];
     for (ncomp_t c=0; c<m_a.nprop(); ++c) m_a(lid,c,0) += bac[c];
   }
 
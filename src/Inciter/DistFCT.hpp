@@ -32,14 +32,15 @@
 #include <cstring>
 #include <cmath>
 #include <unordered_map>
-#include <unordered_set>
 #include <set>
+#include <map>
 
 #include "QuinoaConfig.hpp"
 #include "Types.hpp"
 #include "Fields.hpp"
 #include "DerivedData.hpp"
 #include "FluxCorrector.hpp"
+#include "CommCounter.hpp"
 #include "Discretization.hpp"
 #include "DiagCG.hpp"
 #include "Inciter/InputDeck/InputDeck.hpp"
@@ -103,13 +104,11 @@ class DistFCT : public CBase_DistFCT {
     //! Prepare for next time step stage
     void next();
 
-    //! Receive sums of antidiffusive element contributions on chare-boundaries
+    //! \brief Receive sums of antidiffusive element contributions and the
+    //!   maxima and minima of unknowns of elements surrounding mesh nodes on
+    //!   chare-boundaries
     void comaec( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& P );
-
-    //! \brief Receive contributions to the maxima and minima of unknowns of all
-    //!   elements surrounding mesh nodes on chare-boundaries
-    void comalw( const std::vector< std::size_t >& gid,
+                 const std::vector< std::vector< tk::real > >& P,
                  const std::vector< std::vector< tk::real > >& Q );
 
     //! \brief Receive contributions of limited antidiffusive element
@@ -117,24 +116,17 @@ class DistFCT : public CBase_DistFCT {
     void comlim( const std::vector< std::size_t >& gid,
                  const std::vector< std::vector< tk::real > >& A );
 
-    //! Compute and sum antidiffusive element contributions (AEC) to mesh nodes
+    //! \brief Compute and sum antidiffusive element contributions (AEC) and
+    //!   the maximum and minimum unknowns of all elements surrounding nodes
     void aec(
       const Discretization& d,
       const tk::Fields& dUh,
       const tk::Fields& Un,
-      const std::unordered_map< std::size_t,
-              std::vector< std::pair< bool, tk::real > > >& bcdir,
-      const std::unordered_map< int,
-              std::unordered_set< std::size_t > >& symbcnodemap,
-      const std::unordered_map< int,
-        std::unordered_map< std::size_t, std::array< tk::real, 4 > > >& bnorm );
-
-    //! \brief Compute the maximum and minimum unknowns of all elements
-    //!   surrounding nodes
-    void alw( const tk::Fields& Un,
-              const tk::Fields& Ul,
-              tk::Fields&& dUl,
-              const CProxy_DiagCG& host );
+      const tk::Fields& Ul,
+      tk::Fields&& dUl,
+      const DirBCPlan& bcdir,
+      const tk::BndNodeNormals& symbcnorm,
+      const CProxy_DiagCG& host );
 
     //! Remap local ids after a mesh node reorder
     void remap( const Discretization& d );
@@ -153,18 +145,23 @@ class DistFCT : public CBase_DistFCT {
             std::vector< std::vector< tk::real > > >
     fields() const;
 
+    //! Query and zero communication counters
+    //! \return Counters of messages and bytes since the previous call
+    CommCounter comm() { return std::exchange( m_comm, CommCounter() ); }
+
     /** @name Pack/unpack (Charm++ serialization) routines */
     ///@{
     //! \brief Pack/Unpack serialize member function
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
     void pup( PUP::er &p ) override {
       p | m_naec;
-      p | m_nalw;
       p | m_nlim;
       p | m_nchare;
       p | m_nodeCommMap;
       p | m_bid;
-      p | m_lid;
+      p | m_bidlid;
+      p | m_commgid;
+      p | m_commlid;
       p | m_inpoel;
       p | m_fluxcorrector;
       p | m_p;
@@ -177,6 +174,7 @@ class DistFCT : public CBase_DistFCT {
       p | m_dul;
       p | m_du;
       p | m_host;
+      p | m_comm;
     }
     //! \brief Pack/Unpack serialize operator|
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
@@ -188,11 +186,9 @@ class DistFCT : public CBase_DistFCT {
     using ncomp_t = kw::ncomp::info::expect::type;
 
     //! \brief Number of chares from which we received antidiffusive element
-    //!   contributions on chare boundaries
+    //!   contributions and maximum and minimum unknowns of elements surrounding
+    //!   nodes on chare boundaries
     std::size_t m_naec;
-    //! \brief Number of chares from which we received maximum and minimum
-    //!   unknowns of elements surrounding nodes on chare boundaries
-    std::size_t m_nalw;
     //! \brief Number of chares from which we received limited antidiffusion
     //!   element contributiones on chare boundaries
     std::size_t m_nlim;
@@ -207,9 +203,16 @@ class DistFCT : public CBase_DistFCT {
     //!   contribute to
     //! \note This is a copy. Original in (bound) Discretization
     std::unordered_map< std::size_t, std::size_t > m_bid;
-    //! Local mesh node ids associated to the global ones of owned elements
-    //! \note This is a copy. Original in (bound) Discretization
-    std::unordered_map< std::size_t, std::size_t > m_lid;
+    //! \brief Local mesh node ids of chare-boundary nodes indexed by their
+    //!   chare-boundary id, std::numeric_limits< std::size_t >::max() for nodes
+    //!   no longer in the mesh
+    std::vector< std::size_t > m_bidlid;
+    //! \brief Global mesh node ids of the nodes shared with fellow chares
+    //!   associated to their chare IDs, in the order sent
+    std::map< int, std::vector< std::size_t > > m_commgid;
+    //! \brief Local mesh node ids of the nodes shared with fellow chares
+    //!   associated to their chare IDs, in the order of m_commgid
+    std::map< int, std::vector< std::size_t > > m_commlid;
     //! Mesh connectivity of our chunk of the mesh
     //! \note This is a copy. Original in (bound) Discretization
     std::vector< std::size_t > m_inpoel;
@@ -219,18 +222,23 @@ class DistFCT : public CBase_DistFCT {
     tk::Fields m_p, m_q, m_a;
     //! Receive buffers for FCT
     std::vector< std::vector< tk::real > > m_pc, m_qc, m_ac;
-    //! Pointer to low order solution vector and increment
+    //! \brief Pointer to low order solution vector and increment, and the
+    //!   high order solution increment, the latter only stored in DEBUG mode
     //! \note These are copies. Original in (bound) Discretization
     tk::Fields m_ul, m_dul, m_du;
     //! Host proxy (DiagCG) we interoperate with
     CProxy_DiagCG m_host;
+    //! Counters of messages and bytes communicated with fellow chares
+    CommCounter m_comm;
 
     //! Size FCT communication buffers
     void resizeComm();
 
+    //! Store local ids of chare-boundary nodes used in communication
+    void commLid( const std::unordered_map< std::size_t, std::size_t >& lid );
+
     //! Compute the limited antidiffusive element contributions
-    void lim( const std::unordered_map< std::size_t,
-                std::vector< std::pair< bool, tk::real > > >& bcdir );
+    void lim( const DirBCPlan& bcdir );
 
     //! Apply limited antidiffusive element contributions
     void apply();
@@ -29,33 +29,17 @@ namespace inciter {
 extern ctr::InputDeck g_inputdeck;
 extern std::vector< DGPDE > g_dgpde;
 
-static CkReduction::reducerType DiagMerger;
-
 } // inciter::
 
 using inciter::ElemDiagnostics;
 
-void
-ElemDiagnostics::registerReducers()
-// *****************************************************************************
-//  Configure Charm++ reduction types
-//! \details This routine is supposed to be called from a Charm++ initnode
-//!   routine. Since the runtime system executes initnode routines exactly once
-//!   on every logical node early on in the Charm++ init sequence, they must be
-//!   static as they are called without an object. See also: Section
-//!   "Initializations at Program Startup" at in the Charm++ manual
-//!   http://charm.cs.illinois.edu/manuals/html/charm++/manual.html.
-// *****************************************************************************
-{
-  DiagMerger = CkReduction::addReducer( mergeDiag );
-}
-
 bool
 ElemDiagnostics::compute( Discretization& d,
                           const std::size_t nchGhost,
                           const tk::Fields& geoElem,
                           const std::vector< std::size_t >& ndofel,
-                          const tk::Fields& u ) const
+                          const tk::Fields& u,
+                          const tk::Fields& un ) const
 // *****************************************************************************
 //  Compute diagnostics, e.g., residuals, norms of errors, etc.
 //! \param[in] d Discretization base class to read from
@@ -63,6 +47,7 @@ ElemDiagnostics::compute( Discretization& d,
 //! \param[in] geoElem Element geometry
 //! \param[in] ndofel Vector of local number of degrees of freedom
 //! \param[in] u Current solution vector
+//! \param[in] un Solution vector at the previous time step
 //! \return True if diagnostics have been computed
 //! \details Diagnostics are defined as some norm, e.g., L2 norm, of a quantity,
 //!    computed in mesh elements, A, as ||A||_2 = sqrt[ sum_i(A_i)^2 V_i ],
@@ -71,7 +56,7 @@ ElemDiagnostics::compute( Discretization& d,
 //!    the whole mesh. The final aggregated solution will end up in
 //!    Transporter::diagnostics(). Aggregation of the partially computed
 //!    diagnostics is done via potentially different policies for each field.
-//! \see inciter::mergeDiag(), src/Inciter/Diagnostics.h
+//! \see inciter::diagMsg(), src/Inciter/Diagnostics.h
 // *****************************************************************************
 {
   // Optionally collect diagnostics and send for aggregation across all workers
@@ -90,7 +75,7 @@ ElemDiagnostics::compute( Discretization& d,
       diag( NUMDIAG, std::vector< tk::real >( u.nprop()/rdof, 0.0 ) );
 
     // Compute diagnostics for DG
-    compute_diag(d, rdof, nchGhost, geoElem, ndofel, u, diag);
+    compute_diag(d, rdof, nchGhost, geoElem, ndofel, u, un, diag);
 
     // Append diagnostics vector with metadata on the current time step
     // ITER: Current iteration count (only the first entry is used)
@@ -101,9 +86,10 @@ ElemDiagnostics::compute( Discretization& d,
     diag[DT][0] = d.Dt();
 
     // Contribute to diagnostics
-    auto stream = serialize( diag );
-    d.contribute( stream.first, stream.second.get(), DiagMerger,
+    auto msg = diagMsg( diag );
+    msg->setCallback(
       CkCallback(CkIndex_Transporter::diagnostics(nullptr), d.Tr()) );
+    d.contribute( msg );
 
     return true;        // diagnostics have been computed
 
@@ -119,6 +105,7 @@ ElemDiagnostics::compute_diag( const Discretization& d,
                                const tk::Fields& geoElem,
                                const std::vector< std::size_t >& ndofel,
                                const tk::Fields& u,
+                               const tk::Fields& un,
                                std::vector< std::vector< tk::real > >& diag )
 const
 // *****************************************************************************
@@ -129,7 +116,10 @@ const
 //! \param[in] geoElem Element geometry
 //! \param[in] ndofel Vector of local number of degrees of freedom
 //! \param[in] u Current solution vector
+//! \param[in] un Solution vector at the previous time step
 //! \param[in,out] diag Diagnostics vector
+//! \details The residual is computed from the change of the cell averages
+//!   during the time step.
 // *****************************************************************************
 {
   const auto& inpoel = d.Inpoel();
@@ -212,5 +202,13 @@ const
         if (err > diag[LINFERR][c]) diag[LINFERR][c] = err;
       }
     }
+
+    // Compute sum for L2 norm of the residual
+    for (std::size_t c=0; c<u.nprop()/rdof; ++c)
+    {
+      auto mark = c*rdof;
+      auto du = u(e, mark, 0) - un(e, mark, 0);
+      diag[L2RES][c] += geoElem(e, 0, 0) * du * du;
+    }
   }
 }
@@ -23,15 +23,13 @@ namespace inciter {
 class ElemDiagnostics {
 
   public:
-    //! Configure Charm++ custom reduction types initiated from this class
-    static void registerReducers();
-
     //! Compute diagnostics, e.g., residuals, norms of errors, etc.
     bool compute( Discretization& d,
                   const std::size_t nchGhost,
                   const tk::Fields& geoElem,
                   const std::vector< std::size_t >& ndofel,
-                  const tk::Fields& u ) const;
+                  const tk::Fields& u,
+                  const tk::Fields& un ) const;
 
     /** @name Charm++ pack/unpack serializer member functions */
     ///@{
@@ -51,6 +49,7 @@ class ElemDiagnostics {
                        const tk::Fields& geoElem,
                        const std::vector< std::size_t >& pIndex,
                        const tk::Fields& u,
+                       const tk::Fields& un,
                        std::vector< std::vector< tk::real > >& diag ) const;
 };
 
@@ -10,6 +10,9 @@
 */
 // *****************************************************************************
 
+#include <limits>
+#include <algorithm>
+
 #include "Reorder.hpp"
 #include "DerivedData.hpp"
 #include "FaceData.hpp"
@@ -20,7 +23,7 @@ FaceData::FaceData(
   const std::vector< std::size_t >& inpoel,
   const std::map< int, std::vector< std::size_t > >& bface,
   const std::vector< std::size_t >& triinpoel )
-  : m_bface( bface ), m_triinpoel( triinpoel )
+  : m_bface( bface ), m_triinpoel( triinpoel ), m_nownfac( 0 )
 // *****************************************************************************
 //  Constructor: compute (element-face) data for internal and domain-boundary
 //  faces
@@ -39,3 +42,60 @@ FaceData::FaceData(
   Assert( m_belem.size() == nbfac,
          "Number of boundary-elements and number of boundary-faces unequal" );
 }
+
+void
+FaceData::genIntfac( const tk::Fields& geoFace )
+// *****************************************************************************
+//  Generate internal face data stored face by face
+//! \param[in] geoFace Face geometry, see tk::genGeoFaceTri()
+//! \details This gathers the elements surrounding, the nodes, and the geometry
+//!   of each internal face, including chare-boundary faces, into a single
+//!   record, so that face loops, e.g., tk::surfInt(), stream through a single
+//!   contiguous array. The faces whose both elements are owned are stored
+//!   first, followed by the chare-boundary faces, i.e., those with a ghost
+//!   element, so that the part of the right hand side not depending on ghost
+//!   data can be integrated separately, see RhsPart. Within both groups the
+//!   faces keep their order. Since the elements surrounding chare-boundary
+//!   faces are only known after the ghost elements have been set up, this must
+//!   be called (again) after the face data has been completed with ghosts.
+// *****************************************************************************
+{
+  auto nbfac = Nbfac();
+  auto nfac = m_esuf.size()/2;
+  Assert( geoFace.nunk() >= nfac, "Face geometry size mismatch" );
+  Assert( m_inpofa.size() >= nfac*3, "Face connectivity size mismatch" );
+  Assert( m_inpofa.empty() ||
+          *std::max_element( begin(m_inpofa), end(m_inpofa) ) <
+            std::numeric_limits< uint32_t >::max(),
+          "Node ids do not fit into 32 bits" );
+
+  // Gather the connectivity and geometry of internal face f
+  auto intface = [&]( std::size_t f ) -> IntFace {
+    return {
+      {{ static_cast< uint32_t >( m_esuf[2*f] ),
+         static_cast< uint32_t >( m_esuf[2*f+1] ) }},
+      {{ static_cast< uint32_t >( m_inpofa[3*f] ),
+         static_cast< uint32_t >( m_inpofa[3*f+1] ),
+         static_cast< uint32_t >( m_inpofa[3*f+2] ) }},
+      geoFace(f,0,0),
+      {{ geoFace(f,1,0), geoFace(f,2,0), geoFace(f,3,0) }},
+      {{ geoFace(f,4,0), geoFace(f,5,0), geoFace(f,6,0) }} };
+  };
+
+  // Elements with ids not less than the number of owned elements are ghosts
+  const auto nelem = static_cast< int >( m_esuel.size()/4 );
+
+  m_intfac.clear();
+  m_intfac.reserve( nfac > nbfac ? nfac - nbfac : 0 );
+  std::vector< std::size_t > chbnd;
+  for (auto f=nbfac; f<nfac; ++f) {
+    Assert( m_esuf[2*f] > -1 && m_esuf[2*f+1] > -1, "Interior element "
+            "detected as -1" );
+    if (m_esuf[2*f] >= nelem || m_esuf[2*f+1] >= nelem)
+      chbnd.push_back( f );
+    else
+      m_intfac.push_back( intface(f) );
+  }
+  m_nownfac = m_intfac.size();
+  for (auto f : chbnd) m_intfac.push_back( intface(f) );
+}
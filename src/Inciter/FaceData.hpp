@@ -11,14 +11,17 @@
 #ifndef FaceData_h
 #define FaceData_h
 
+#include <array>
 #include <vector>
 #include <tuple>
+#include <cstdint>
 #include <map>
 #include <unordered_map>
 
 #include "Types.hpp"
 #include "PUPUtil.hpp"
 #include "ContainerUtil.hpp"
+#include "Fields.hpp"
 
 namespace inciter {
 
@@ -37,12 +40,48 @@ using GhostData =
                         // inpoel of said tet
                         std::array< std::size_t, 4 > > >;
 
+//! \brief Connectivity and geometry of an internal face stored together for
+//!   face loops, see FaceData::genIntfac()
+//! \details Local ids are stored in 32 bits, which is enough for a mesh
+//!   chunk, to halve the index bandwidth of face loops.
+struct IntFace {
+  //! Local ids of the left and right elements of the face
+  std::array< uint32_t, 2 > esuf;
+  //! Local ids of the face nodes
+  std::array< uint32_t, 3 > inpofa;
+  //! Face area
+  tk::real area;
+  //! Face unit normal pointing outward of the left element
+  std::array< tk::real, 3 > normal;
+  //! Face centroid coordinates
+  std::array< tk::real, 3 > centroid;
+
+  //! \brief Pack/Unpack serialize operator|
+  //! \param[in,out] p Charm++'s PUP::er serializer object reference
+  //! \param[in,out] f IntFace object reference
+  friend void operator|( PUP::er& p, IntFace& f ) {
+    p | f.esuf;
+    p | f.inpofa;
+    p | f.area;
+    p | f.normal;
+    p | f.centroid;
+  }
+};
+
+//! \brief Parts of the DG right hand side computed together
+//! \details OWN is the part that does not depend on ghost data, i.e., the
+//!   volume and domain-boundary integrals, and the integrals on internal faces
+//!   whose both elements are owned. This can be computed while ghost data is
+//!   communicated. CHBND is the rest: the integrals on chare-boundary faces.
+//!   ALL is both.
+enum class RhsPart : uint8_t { ALL, OWN, CHBND };
+
 //! FaceData class holding face-connectivity data useful for DG discretization
 class FaceData {
 
   public:
     //! Empty constructor for Charm++
-    explicit FaceData() {}
+    explicit FaceData() : m_nownfac( 0 ) {}
 
     //! \brief Constructor: compute (element-face) data for internal and
     //!   domain-boundary faces
@@ -66,8 +105,22 @@ class FaceData {
     const std::vector< std::size_t >& Belem() const { return m_belem; }
     const std::vector< int >& Esuf() const { return m_esuf; }
     std::vector< int >& Esuf() { return m_esuf; }
+    const std::vector< IntFace >& Intfac() const { return m_intfac; }
+    std::size_t Nownfac() const { return m_nownfac; }
     //@}
 
+    //! Range of internal faces contributing to a part of the right hand side
+    //! \param[in] part Part of the right hand side
+    //! \return Index range [first,second) of the faces in Intfac()
+    std::pair< std::size_t, std::size_t > intfacRange( RhsPart part ) const {
+      if (part == RhsPart::OWN) return { 0, m_nownfac };
+      if (part == RhsPart::CHBND) return { m_nownfac, m_intfac.size() };
+      return { 0, m_intfac.size() };
+    }
+
+    //! Generate internal face data stored face by face
+    void genIntfac( const tk::Fields& geoFace );
+
     /** @name Charm++ pack/unpack (serialization) routines
       * */
     ///@{
@@ -81,6 +134,8 @@ class FaceData {
       p | m_inpofa;
       p | m_belem;
       p | m_esuf;
+      p | m_intfac;
+      p | m_nownfac;
     }
     //! \brief Pack/Unpack serialize operator|
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
@@ -103,6 +158,12 @@ class FaceData {
     std::vector< std::size_t > m_belem;
     //! Element surrounding faces
     std::vector< int > m_esuf;
+    //! \brief Internal (including chare-boundary) faces with their elements,
+    //!   nodes, and geometry
+    std::vector< IntFace > m_intfac;
+    //! \brief Number of internal faces whose both elements are owned, stored
+    //!   first in m_intfac, followed by the chare-boundary faces
+    std::size_t m_nownfac;
 };
 
 } // inciter::
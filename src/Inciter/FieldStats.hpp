@@ -0,0 +1,186 @@
+// *****************************************************************************
+/*!
+  \file      src/Inciter/FieldStats.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Running time averages and second moments of nodal fields
+  \details   Running time averages and second moments, i.e., variances and
+    covariances, of the scalar components of the numerical solution in mesh
+    nodes, accumulated in-situ after every time step.
+*/
+// *****************************************************************************
+#ifndef FieldStats_h
+#define FieldStats_h
+
+#include <vector>
+#include <string>
+
+#include "Types.hpp"
+#include "Fields.hpp"
+#include "Exception.hpp"
+#include "PUPUtil.hpp"
+
+namespace inciter {
+
+//! Running time averages and second moments of nodal fields
+//! \details Samples are weighted by the time step size. The means and the
+//!   sums of squared and cross deviations are updated one sample at a time
+//!   using the weighted version of Welford's algorithm, which, contrary to
+//!   accumulating the sums of the squares, does not lose precision if the
+//!   fluctuations are small compared to the mean. Only the means and the
+//!   sums of deviations are stored, so their output, see fields(), requires
+//!   no instantaneous fields to be kept.
+class FieldStats {
+
+  public:
+    //! Empty constructor: no statistics
+    explicit FieldStats() = default;
+
+    //! Constructor: zero statistics
+    //! \param[in] nunk Number of mesh nodes
+    //! \param[in] ncomp Number of scalar solution components
+    //! \param[in] cov Component index pairs (0-based) whose covariances to
+    //!   compute, two per covariance
+    explicit FieldStats( std::size_t nunk,
+                         std::size_t ncomp,
+                         const std::vector< std::size_t >& cov ) :
+      m_nunk( nunk ),
+      m_ncomp( ncomp ),
+      m_cov( cov ),
+      m_w( 0.0 ),
+      m_mean( nunk*ncomp, 0.0 ),
+      m_m2( nunk*ncomp, 0.0 ),
+      m_c2( nunk*(cov.size()/2), 0.0 )
+    {
+      Assert( cov.size() % 2 == 0, "Covariances must be given in pairs" );
+      for ([[maybe_unused]] auto c : cov)
+        Assert( c < ncomp, "Covariance component index out of bounds" );
+    }
+
+    //! Zero statistics, e.g., after the number of mesh nodes has changed
+    //! \param[in] nunk Number of mesh nodes
+    void reset( std::size_t nunk )
+    { *this = FieldStats( nunk, m_ncomp, m_cov ); }
+
+    //! Add a sample
+    //! \param[in] u Solution vector whose components to add
+    //! \param[in] w Weight of the sample, e.g., time step size
+    //! \details Samples with zero weight and samples added to empty
+    //!   statistics are ignored.
+    void add( const tk::Fields& u, tk::real w ) {
+      if (empty() || !(w > 0.0)) return;
+      Assert( u.nunk() == m_nunk && u.nprop() == m_ncomp, "Size mismatch" );
+      m_w += w;
+      const auto f = w / m_w;
+      const auto ncov = m_cov.size() / 2;
+      std::vector< tk::real > d( m_ncomp );
+      for (std::size_t i=0; i<m_nunk; ++i) {
+        auto mean = m_mean.data() + i*m_ncomp;
+        auto m2 = m_m2.data() + i*m_ncomp;
+        for (std::size_t c=0; c<m_ncomp; ++c) {
+          const auto x = u(i,c,0);
+          d[c] = x - mean[c];
+          mean[c] += f * d[c];
+          m2[c] += w * d[c] * (x - mean[c]);
+        }
+        auto c2 = m_c2.data() + i*ncov;
+        for (std::size_t k=0; k<ncov; ++k) {
+          const auto a = m_cov[k*2+0];
+          const auto b = m_cov[k*2+1];
+          c2[k] += w * d[a] * (u(i,b,0) - mean[b]);
+        }
+      }
+    }
+
+    //! Query if no statistics are accumulated
+    //! \return True if constructed empty, i.e., no statistics configured
+    bool empty() const { return m_ncomp == 0; }
+
+    //! Total weight of the samples added, e.g., time averaged over
+    //! \return Sum of the weights of all samples added
+    tk::real weight() const { return m_w; }
+
+    //! Names of the fields output
+    //! \param[in] var Names of the solution components
+    //! \return Names of the means, the variances, and the covariances, in the
+    //!   order of fields()
+    std::vector< std::string >
+    names( const std::vector< std::string >& var ) const {
+      Assert( var.size() == m_ncomp, "Size mismatch" );
+      std::vector< std::string > n;
+      for (const auto& v : var) n.push_back( v + "_mean" );
+      for (const auto& v : var) n.push_back( v + "_variance" );
+      for (std::size_t k=0; k<m_cov.size()/2; ++k)
+        n.push_back( var[m_cov[k*2+0]] + '_' + var[m_cov[k*2+1]] +
+                     "_covariance" );
+      return n;
+    }
+
+    //! Fields output
+    //! \return Means, variances, and covariances in mesh nodes, zero if no
+    //!   samples have been added yet
+    std::vector< std::vector< tk::real > > fields() const {
+      const auto ncov = m_cov.size() / 2;
+      const auto r = m_w > 0.0 ? 1.0/m_w : 0.0;
+      std::vector< std::vector< tk::real > >
+        f( 2*m_ncomp + ncov, std::vector< tk::real >( m_nunk ) );
+      for (std::size_t i=0; i<m_nunk; ++i) {
+        for (std::size_t c=0; c<m_ncomp; ++c) {
+          f[c][i] = m_mean[i*m_ncomp+c];
+          f[m_ncomp+c][i] = m_m2[i*m_ncomp+c] * r;
+        }
+        for (std::size_t k=0; k<ncov; ++k)
+          f[2*m_ncomp+k][i] = m_c2[i*ncov+k] * r;
+      }
+      return f;
+    }
+
+    //! Number of bytes occupied, see tk::bytes()
+    //! \return Number of bytes occupied, including heap storage
+    std::size_t bytes() const {
+      return sizeof(*this) + m_cov.capacity()*sizeof(std::size_t) +
+        (m_mean.capacity() + m_m2.capacity() + m_c2.capacity()) *
+        sizeof(tk::real);
+    }
+
+    /** @name Charm++ pack/unpack serializer member functions */
+    ///@{
+    //! \brief Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    void pup( PUP::er &p ) {
+      p | m_nunk;
+      p | m_ncomp;
+      p | m_cov;
+      p | m_w;
+      p | m_mean;
+      p | m_m2;
+      p | m_c2;
+    }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] s FieldStats object reference
+    friend void operator|( PUP::er& p, FieldStats& s ) { s.pup(p); }
+    //@}
+
+  private:
+    //! Number of mesh nodes
+    std::size_t m_nunk = 0;
+    //! Number of scalar solution components
+    std::size_t m_ncomp = 0;
+    //! Component index pairs whose covariances to compute
+    std::vector< std::size_t > m_cov;
+    //! Sum of the weights of the samples added
+    tk::real m_w = 0.0;
+    //! Means, node-major
+    std::vector< tk::real > m_mean;
+    //! Weighted sums of squared deviations from the means, node-major
+    std::vector< tk::real > m_m2;
+    //! Weighted sums of cross deviations from the means, node-major
+    std::vector< tk::real > m_c2;
+};
+
+} // inciter::
+
+#endif // FieldStats_h
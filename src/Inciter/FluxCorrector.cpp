@@ -20,8 +20,7 @@
 
 #include "Macro.hpp"
 #include "Vector.hpp"
-#include "Around.hpp"
-#include "DerivedData.hpp"
+#include "UnsMesh.hpp"
 #include "FluxCorrector.hpp"
 #include "Inciter/InputDeck/InputDeck.hpp"
 
@@ -32,28 +31,26 @@ FluxCorrector::aec(
   const std::array< std::vector< tk::real >, 3 >& coord,
   const std::vector< std::size_t >& inpoel,
   const std::vector< tk::real >& vol,
-  const std::unordered_map< std::size_t,
-    std::vector< std::pair< bool, tk::real > > >& bcdir,
-  const std::unordered_map< int,
-    std::unordered_set< std::size_t > >& symbcnodemap,
-  const std::unordered_map< int,
-    std::unordered_map< std::size_t, std::array< tk::real, 4 > > >& bnorm,
+  const DirBCPlan& bcdir,
+  const tk::BndNodeNormals& symbcnorm,
   const tk::Fields& Un,
-  tk::Fields& P )
+  const tk::Fields& Ul,
+  tk::Fields& P,
+  tk::Fields& Q )
 // *****************************************************************************
-//  Compute antidiffusive element contributions (AEC)
+//  Compute antidiffusive element contributions (AEC) and the maximum and
+//  minimum unknowns of elements surrounding nodes
 //! \param[in] coord Mesh node coordinates
 //! \param[in] inpoel Mesh element connectivity
 //! \param[in] vol Volume associated to mesh nodes
-//! \param[in] bcdir Vector of pairs of bool and boundary condition value
-//!   associated to local mesh node IDs at which to set Dirichlet boundary
-//!   conditions.
-//! \param[in] symbcnodemap Unique set of node ids at which to set symmetry BCs
-//!   associated to side set ids
-//! \param[in] bnorm Face normals in boundary points: key global node id,
-//!   value: unit normal, outer key: side set id
+//! \param[in] bcdir Dirichlet boundary conditions matched to local mesh node
+//!   IDs
+//! \param[in] symbcnorm Flat arrays of the nodes at which symmetry BCs are set
+//!   and their unit normals
 //! \param[in] Un Solution at the previous time step
+//! \param[in] Ul Low order solution
 //! \param[in,out] P The sums of positive (negative) AECs to nodes
+//! \param[in,out] Q Maximum and mimimum unknowns of elements surrounding nodes
 //! \details The antidiffusive element contributions (AEC) are defined as the
 //!   difference between the high and low order solution, where the high order
 //!   solution is obtained from consistent mass Taylor-Galerkin discretization
@@ -71,6 +68,12 @@ FluxCorrector::aec(
 //!      volume associated to a mesh node by summing the quarter of the element
 //!      volumes surrounding the node. Note that this is the correct node volume
 //!      taking into account that some nodes are on chare boundaries.
+//!
+//!   The AECs, their boundary conditions, their positive and negative sums to
+//!   nodes, and the maximum and minimum unknowns of the elements surrounding
+//!   nodes are computed in a single loop over the elements. To avoid
+//!   searches in the boundary data inside this loop, the entries of symbcnorm
+//!   are first indexed by mesh node.
 //! \note Since we use the lumped-mass for the high-order solution, dUh
 //!   does not contribute to AEC, as computed above.
 //! \see Löhner, R., Morgan, K., Peraire, J. and Vahdati, M. (1987), Finite
@@ -81,17 +84,33 @@ FluxCorrector::aec(
 {
   auto ncomp = g_inputdeck.get< tag::component >().nprop();
   auto ctau = g_inputdeck.get< tag::discr, tag::ctau >();
+  auto clip = g_inputdeck.get< tag::discr, tag::fctclip >();
 
   Assert( vol.size() == coord[0].size(), "Nodal volume vector size mismatch" );
   Assert( m_aec.nunk() == inpoel.size() && m_aec.nprop() == ncomp,
           "AEC and mesh connectivity size mismatch" );
   Assert( Un.nunk() == P.nunk() && Un.nprop() == P.nprop()/2, "Size mismatch" );
+  Assert( Q.nunk() == Un.nunk() && Q.nprop() == Un.nprop()*2, "Max and min "
+          "unknowns of elements surrounding nodes array size mismatch" );
 
   const auto& x = coord[0];
   const auto& y = coord[1];
   const auto& z = coord[2];
 
-  m_aec.fill( 0.0 );
+  // Index entries of the symmetry BC normals by mesh node: the entries of node
+  // p are sym[ symstart[p] ... symstart[p+1]-1 ], in increasing side set order
+  const auto& bn = symbcnorm.node();
+  const auto& nx = symbcnorm.nx();
+  const auto& ny = symbcnorm.ny();
+  const auto& nz = symbcnorm.nz();
+  std::vector< std::size_t > symstart( x.size()+1, 0 ), sym( bn.size() );
+  for (auto p : bn) ++symstart[p+1];
+  for (std::size_t p=0; p<x.size(); ++p) symstart[p+1] += symstart[p];
+  auto pos = symstart;
+  for (std::size_t i=0; i<bn.size(); ++i) sym[ pos[bn[i]]++ ] = i;
+
+  // solution at element nodes at time n
+  std::vector< std::array< tk::real, 4 > > un( ncomp );
 
   for (std::size_t e=0; e<inpoel.size()/4; ++e) {
     const std::array< std::size_t, 4 > N{{ inpoel[e*4+0], inpoel[e*4+1],
@@ -105,84 +124,83 @@ FluxCorrector::aec(
     const auto J = tk::triple( ba, ca, da );
     Assert( J > 0, "Element Jacobian non-positive" );
 
-    // lumped - consistent mass
-    std::array< std::array< tk::real, 4 >, 4 > m;       // nnode*nnode [4][4]
-    m[0][0] = m[1][1] = m[2][2] = m[3][3] = 3.0*J/120.0;// diagonal
-    m[0][1] = m[0][2] = m[0][3] =                       // off-diagonal
-    m[1][0] = m[1][2] = m[1][3] =
-    m[2][0] = m[2][1] = m[2][3] =
-    m[3][0] = m[3][1] = m[3][2] = -J/120.0;
-
     // access solution at element nodes at time n
-    std::vector< std::array< tk::real, 4 > > un( ncomp );
     for (ncomp_t c=0; c<ncomp; ++c) un[c] = Un.extract( c, 0, N );
 
-    // Compute antidiffusive element contributions (AEC). The high order system
-    // is M_c * dUh = r, where M_c is the consistent mass matrix and r is the
-    // high order right hand side. The low order system is constructed from the
-    // high order one by lumping the consistent mass matrix and adding mass
-    // diffusion: M_L * dUl = r + c_tau * (M_c - M_L) Un, where M_L is the
-    // lumped mass matrix, c_tau is the mass diffusion coefficient (c_tau = 1.0
-    // guarantees a monotonic solution). See also the details in the function
-    // header for the notation. Based on the above, the AEC, in general, is
-    // computed as AEC = M_L^{-1} (M_Le - M_ce) (ctau * Un + dUh), which can be
-    // obtained by subtracting the low order system from the high order system.
-    // Note that the solution update is U^{n+1} = Un + dUl + lim(dUh - dUl),
-    // where the last term is the limited AEC. (Think of 'lim' as the limit
-    // coefficient between 0 and 1.)
-    for (std::size_t j=0; j<4; ++j)
-      for (ncomp_t c=0; c<ncomp; ++c)
-        for (std::size_t k=0; k<4; ++k)
-          m_aec(e*4+j,c,0) += m[j][k] * ctau*un[c][k] / vol[N[j]];
-  }
+    // compute maximum and minimum nodal values of the element (Lohner:
+    // u^*_el) and scatter them to its nodes to obtain the maximum and mimimum
+    // unknowns of all elements surrounding each node (Lohner: u^{max,min}_i)
+    for (ncomp_t c=0; c<ncomp; ++c) {
+      auto smax = -std::numeric_limits< tk::real >::max();
+      auto smin = std::numeric_limits< tk::real >::max();
+      for (std::size_t j=0; j<4; ++j) {
+        // compute maximum and minimum nodal values of Ul and Un (Lohner: u^*_i)
+        auto ul = Ul(N[j],c,0);
+        auto jmax = clip ? ul : std::max( ul, un[c][j] );
+        auto jmin = clip ? ul : std::min( ul, un[c][j] );
+        if (jmax > smax) smax = jmax;
+        if (jmin < smin) smin = jmin;
+      }
+      for (std::size_t j=0; j<4; ++j) {
+        if (smax > Q(N[j],c*2+0,0)) Q(N[j],c*2+0,0) = smax;
+        if (smin < Q(N[j],c*2+1,0)) Q(N[j],c*2+1,0) = smin;
+      }
+    }
 
-  for (std::size_t e=0; e<inpoel.size()/4; ++e) {
-    const std::array< std::size_t, 4 >
-      N{{ inpoel[e*4+0], inpoel[e*4+1], inpoel[e*4+2], inpoel[e*4+3] }};
     for (std::size_t j=0; j<4; ++j) {
+      // Compute antidiffusive element contributions (AEC). The high order
+      // system is M_c * dUh = r, where M_c is the consistent mass matrix and r
+      // is the high order right hand side. The low order system is constructed
+      // from the high order one by lumping the consistent mass matrix and
+      // adding mass diffusion: M_L * dUl = r + c_tau * (M_c - M_L) Un, where
+      // M_L is the lumped mass matrix, c_tau is the mass diffusion coefficient
+      // (c_tau = 1.0 guarantees a monotonic solution). See also the details in
+      // the function header for the notation. Based on the above, the AEC, in
+      // general, is computed as AEC = M_L^{-1} (M_Le - M_ce) (ctau * Un + dUh),
+      // which can be obtained by subtracting the low order system from the
+      // high order system. Note that the solution update is U^{n+1} = Un + dUl
+      // + lim(dUh - dUl), where the last term is the limited AEC. (Think of
+      // 'lim' as the limit coefficient between 0 and 1.) The lumped -
+      // consistent mass matrix is J/120 on the diagonal and -J/120 off the
+      // diagonal, so its row j applied to u is J/120 * (4 u_j - sum_k u_k).
+      const auto f = ctau * J / 120.0 / vol[N[j]];
+      for (ncomp_t c=0; c<ncomp; ++c) {
+        const auto& u = un[c];
+        m_aec(e*4+j,c,0) = f * (4.0*u[j] - u[0] - u[1] - u[2] - u[3]);
+      }
+
       // Dirichlet BCs: At nodes where Dirichlet boundary conditions (BC) are
       // set, we set the AEC to zero. This is because if the (same) BCs are
       // correctly set for both the low and the high order solution, there
       // should be no difference between the low and high order increments,
       // thus AEC = dUh - dUl = 0.
       auto b = bcdir.find(N[j]);
-      if (b != end(bcdir)) {
+      if (b != bcdir.size()) {
         for (ncomp_t c=0; c<ncomp; ++c) {
-          if (b->second[c].first) {
+          if (bcdir.set(b,c)) {
             m_aec(e*4+j,c,0) = 0.0;
           }
         }
       }
-      // Symmetry BCs
-      for (const auto& [s,nodes] : symbcnodemap) {
-        auto i = nodes.find(N[j]);
-        if (i != end(nodes)) {
-          auto l = bnorm.find(s);
-          if (l != end(bnorm)) {
-            auto k = l->second.find(N[j]);
-            for (const auto& vel : m_vel) {
-              std::array< tk::real, 3 >
-                v{ m_aec(e*4+j,vel[0],0),
-                   m_aec(e*4+j,vel[1],0),
-                   m_aec(e*4+j,vel[2],0) },
-                n{ k->second[0], k->second[1], k->second[2] };
-              auto vn = tk::dot( v, n );
-              m_aec(e*4+j,vel[0],0) -= vn * n[0];
-              m_aec(e*4+j,vel[1],0) -= vn * n[1];
-              m_aec(e*4+j,vel[2],0) -= vn * n[2];
-            }
-          }
+
+      // Symmetry BCs: remove the normal component of the velocity AECs
+      for (auto i=symstart[N[j]]; i<symstart[N[j]+1]; ++i) {
+        const auto l = sym[i];
+        const std::array< tk::real, 3 > n{ nx[l], ny[l], nz[l] };
+        for (const auto& vel : m_vel) {
+          std::array< tk::real, 3 >
+            v{ m_aec(e*4+j,vel[0],0),
+               m_aec(e*4+j,vel[1],0),
+               m_aec(e*4+j,vel[2],0) };
+          auto vn = tk::dot( v, n );
+          m_aec(e*4+j,vel[0],0) -= vn * n[0];
+          m_aec(e*4+j,vel[1],0) -= vn * n[1];
+          m_aec(e*4+j,vel[2],0) -= vn * n[2];
         }
       }
-    }
-  }
 
-  // sum all positive (negative) antidiffusive element contributions to nodes
-  // (Lohner: P^{+,-}_i)
-  for (std::size_t e=0; e<inpoel.size()/4; ++e) {
-    const std::array< std::size_t, 4 > N{{ inpoel[e*4+0], inpoel[e*4+1],
-                                           inpoel[e*4+2], inpoel[e*4+3] }};
-    for (std::size_t j=0; j<4; ++j) {
+      // sum all positive (negative) antidiffusive element contributions to
+      // nodes (Lohner: P^{+,-}_i)
       for (ncomp_t c=0; c<ncomp; ++c) {
         P(N[j],c*2+0,0) += std::max( 0.0, m_aec(e*4+j,c,0) );
         P(N[j],c*2+1,0) += std::min( 0.0, m_aec(e*4+j,c,0) );
@@ -234,7 +252,7 @@ FluxCorrector::verify( std::size_t nchare,
     }
 
     // Compute maximum difference between the assembled AEC and dUh-dUl
-    auto d = tk::maxdiff( U, dUh-dUl );
+    auto d = tk::maxdiff( U, tk::Fields( dUh-dUl ) );
 
     // Tolerance: 10 x the linear solver tolerance for the high order solution.
     if (d.second > 1.0e-7) {
@@ -317,59 +335,88 @@ FluxCorrector::diff( const std::array< std::vector< tk::real >, 3 >& coord,
 }
 
 void
-FluxCorrector::alw( const std::vector< std::size_t >& inpoel,
-                    const tk::Fields& Un,
-                    const tk::Fields& Ul,
-                    tk::Fields& Q ) const
+FluxCorrector::diffEdges( const std::array< std::vector< tk::real >, 3 >& coord,
+                          const std::vector< std::size_t >& inpoel )
 // *****************************************************************************
-//  Compute the maximum and minimum unknowns of elements surrounding nodes
+//  Compute edge weights of the mass diffusion of the low order system
+//! \param[in] coord Mesh node coordinates
 //! \param[in] inpoel Mesh element connectivity
-//! \param[in] Un Solution at the previous time step
-//! \param[in] Ul Low order solution
-//! \param[in,out] Q Maximum and mimimum unknowns of elements surrounding nodes
+//! \details The lumped minus the consistent mass matrix of a tetrahedron has
+//!   3J/120 in its diagonal and -J/120 off the diagonal, so its rows sum to
+//!   zero, and its contribution to node a is J/120 * sum_b (u_a - u_b) over
+//!   the other three nodes b of the element. The mass diffusion is thus a sum
+//!   over the edges of the mesh, each edge weighted by the sum of J/120 over
+//!   the elements sharing the edge, computed here once per mesh.
 // *****************************************************************************
 {
-  Assert( Q.nunk() == Un.nunk() && Q.nprop() == Un.nprop()*2, "Max and min "
-          "unknowns of elements surrounding nodes array size mismatch" );
+  const auto& x = coord[0];
+  const auto& y = coord[1];
+  const auto& z = coord[2];
 
-  auto ncomp = g_inputdeck.get< tag::component >().nprop();
-  auto clip = g_inputdeck.get< tag::discr, tag::fctclip >();
+  std::unordered_map< tk::UnsMesh::Edge, std::size_t,
+                      tk::UnsMesh::Hash<2>, tk::UnsMesh::Eq<2> > id;
+  id.reserve( inpoel.size()*2 );
+  m_dedge.clear();
+  m_dweight.clear();
 
-  // compute maximum and minimum nodal values of all elements (Lohner: u^*_el)
-  tk::Fields S( inpoel.size()/4, ncomp*2 );
   for (std::size_t e=0; e<inpoel.size()/4; ++e) {
-    const std::array< std::size_t, 4 > N{{ inpoel[e*4+0], inpoel[e*4+1],
-                                           inpoel[e*4+2], inpoel[e*4+3] }};
-    for (ncomp_t c=0; c<ncomp; ++c) {
-      S(e,c*2+0,0) = -std::numeric_limits< tk::real >::max();
-      S(e,c*2+1,0) = std::numeric_limits< tk::real >::max();
-      for (std::size_t j=0; j<4; ++j) {
-        // compute maximum and minimum nodal values of Ul and Un (Lohner: u^*_i)
-        auto jmax = clip ? Ul(N[j],c,0) : std::max(Ul(N[j],c,0), Un(N[j],c,0));
-        auto jmin = clip ? Ul(N[j],c,0) : std::min(Ul(N[j],c,0), Un(N[j],c,0));
-        if (jmax > S(e,c*2+0,0)) S(e,c*2+0,0) = jmax;
-        if (jmin < S(e,c*2+1,0)) S(e,c*2+1,0) = jmin;
+    const std::array< std::size_t, 4 >
+       N{{ inpoel[e*4+0], inpoel[e*4+1], inpoel[e*4+2], inpoel[e*4+3] }};
+    const std::array< tk::real, 3 >
+      ba{{ x[N[1]]-x[N[0]], y[N[1]]-y[N[0]], z[N[1]]-z[N[0]] }},
+      ca{{ x[N[2]]-x[N[0]], y[N[2]]-y[N[0]], z[N[2]]-z[N[0]] }},
+      da{{ x[N[3]]-x[N[0]], y[N[3]]-y[N[0]], z[N[3]]-z[N[0]] }};
+    const auto J = tk::triple( ba, ca, da );   // J = 6V
+    Assert( J > 0, "Element Jacobian non-positive" );
+
+    for (std::size_t a=0; a<4; ++a)
+      for (std::size_t b=a+1; b<4; ++b) {
+        auto i = id.emplace( tk::UnsMesh::Edge{{N[a],N[b]}}, m_dweight.size() );
+        if (i.second) {
+          m_dedge.push_back( N[a] );
+          m_dedge.push_back( N[b] );
+          m_dweight.push_back( 0.0 );
+        }
+        m_dweight[ i.first->second ] += J/120.0;
       }
-    }
   }
+}
 
-  // compute maximum and mimimum unknowns of all elements surrounding each node
-  // (Lohner: u^{max,min}_i)
-  const auto esup = tk::genEsup( inpoel, 4 );
-  for (std::size_t p=0; p<Un.nunk(); ++p) {
-    for (auto e : tk::Around(esup,p)) {
-      for (ncomp_t c=0; c<ncomp; ++c) {
-        if (S(e,c*2+0,0) > Q(p,c*2+0,0)) Q(p,c*2+0,0) = S(e,c*2+0,0);
-        if (S(e,c*2+1,0) < Q(p,c*2+1,0)) Q(p,c*2+1,0) = S(e,c*2+1,0);
-      }
+tk::Fields
+FluxCorrector::diff( const tk::Fields& Un ) const
+// *****************************************************************************
+//  Compute mass diffusion contribution to the RHS of the low order system over
+//  mesh edges
+//! \param[in] Un Solution at the previous time step
+//! \return Mass diffusion contribution to the RHS of the low order system
+//! \details Equals, up to round-off, the element-based assembly of the mass
+//!   diffusion, see diffEdges().
+// *****************************************************************************
+{
+  Assert( hasDiffEdges(), "Edge weights of mass diffusion not computed" );
+
+  auto ctau = g_inputdeck.get< tag::discr, tag::ctau >();
+
+  tk::Fields D( Un.nunk(), Un.nprop() );
+  D.fill( 0.0 );
+
+  for (std::size_t k=0; k<m_dweight.size(); ++k) {
+    auto p = m_dedge[k*2+0];
+    auto q = m_dedge[k*2+1];
+    auto w = ctau * m_dweight[k];
+    for (ncomp_t c=0; c<Un.nprop(); ++c) {
+      auto f = w * (Un(q,c,0) - Un(p,c,0));
+      D(p,c,0) += f;
+      D(q,c,0) -= f;
     }
   }
+
+  return D;
 }
 
 void
 FluxCorrector::lim( const std::vector< std::size_t >& inpoel,
-                    const std::unordered_map< std::size_t,
-                            std::vector< std::pair< bool, tk::real > > >& bcdir,
+                    const DirBCPlan& bcdir,
                     const tk::Fields& P,
                     const tk::Fields& Ul,
                     tk::Fields& Q,
@@ -377,8 +424,8 @@ FluxCorrector::lim( const std::vector< std::size_t >& inpoel,
 // *****************************************************************************
 // Compute limited antiffusive element contributions and apply to mesh nodes
 //! \param[in] inpoel Mesh element connectivity
-//! \param[in] bcdir Vector of pairs of bool and boundary condition value
-//!   associated to mesh node IDs at which to set Dirichlet boundary conditions.
+//! \param[in] bcdir Dirichlet boundary conditions matched to local mesh node
+//!   IDs
 //! \param[in] P The sums of all positive (negative) AECs to nodes
 //! \param[in] Ul Low order solution
 //! \param[in,out] Q The maximum and mimimum unknowns of elements surrounding
@@ -394,21 +441,18 @@ FluxCorrector::lim( const std::vector< std::size_t >& inpoel,
 
   auto ncomp = g_inputdeck.get< tag::component >().nprop();
 
-  // compute the maximum and minimum increments and decrements nodal solution
-  // values are allowed to achieve (Lohner: Q^{+,-}_i)
-  for (std::size_t p=0; p<Ul.nunk(); ++p)
-    for (ncomp_t c=0; c<ncomp; ++c) {
-      Q(p,c*2+0,0) -= Ul(p,c,0);
-      Q(p,c*2+1,0) -= Ul(p,c,0);
-    }
-
   auto eps = g_inputdeck.get< tag::discr, tag::fcteps >();
 
-  // compute the ratios of positive and negative element contributions that
-  // ensure monotonicity (Lohner: R^{+,-})
   for (std::size_t p=0; p<P.nunk(); ++p) {
     for (ncomp_t c=0; c<ncomp; ++c) {
 
+      // compute the maximum and minimum increments and decrements nodal
+      // solution values are allowed to achieve (Lohner: Q^{+,-}_i)
+      Q(p,c*2+0,0) -= Ul(p,c,0);
+      Q(p,c*2+1,0) -= Ul(p,c,0);
+
+      // compute the ratios of positive and negative element contributions that
+      // ensure monotonicity (Lohner: R^{+,-})
       if (P(p,c*2+0,0) < eps)
         Q(p,c*2+0,0) = 1.0;
       else
@@ -422,11 +466,18 @@ FluxCorrector::lim( const std::vector< std::size_t >& inpoel,
     }
   }
 
-  // calculate limit coefficient for all elements (Lohner: C_el)
-  tk::Fields C( inpoel.size()/4, ncomp );
+  // access pointer to limited antidiffusive contributions at mesh nodes
+  std::vector< const tk::real* > a( ncomp );
+  for (ncomp_t c=0; c<ncomp; ++c) a[c] = A.cptr( c, 0 );
+
+  // limit coefficients of an element for all scalar components
+  std::vector< tk::real > C( ncomp );
+
   for (std::size_t e=0; e<inpoel.size()/4; ++e) {
     const std::array< std::size_t, 4 > N{{ inpoel[e*4+0], inpoel[e*4+1],
                                            inpoel[e*4+2], inpoel[e*4+3] }};
+
+    // calculate limit coefficient of the element (Lohner: C_el)
     for (ncomp_t c=0; c<ncomp; ++c) {
       std::array< tk::real, 4 > R;
       for (std::size_t j=0; j<4; ++j) {
@@ -439,43 +490,32 @@ FluxCorrector::lim( const std::vector< std::size_t >& inpoel,
           R[j] = Q(N[j],c*2+1,0);
 
       }
-      C(e,c,0) = *std::min_element( begin(R), end(R) );
+      C[c] = *std::min_element( begin(R), end(R) );
       // if all vertices happened to be on a Dirichlet boundary, ignore limiting
-      if (C(e,c,0) > 1.0) C(e,c,0) = 1.0;
-      Assert( C(e,c,0) > -eps && C(e,c,0) < 1.0+eps,
-              "0 <= AEC <= 1.0 failed: C = " + std::to_string(C(e,c,0)) );
+      if (C[c] > 1.0) C[c] = 1.0;
+      Assert( C[c] > -eps && C[c] < 1.0+eps,
+              "0 <= AEC <= 1.0 failed: C = " + std::to_string(C[c]) );
     }
-  }
 
-  // System limiting
-  for (std::size_t e=0; e<inpoel.size()/4; ++e) {
+    // System limiting
     for (const auto& sys : m_sys) {
       tk::real cs = 1.0;
-      for (auto i : sys) if (C(e,i,0) < cs) cs = C(e,i,0);
-      for (auto i : sys) C(e,i,0) = cs;
+      for (auto i : sys) if (C[i] < cs) cs = C[i];
+      for (auto i : sys) C[i] = cs;
     }
-  }
-
-  // save the limited antidiffusive element contributions (Lohner: AEC^c)
-  for (std::size_t e=0; e<inpoel.size()/4; ++e) {
-    const std::array< std::size_t, 4 > N{{ inpoel[e*4+0], inpoel[e*4+1],
-                                           inpoel[e*4+2], inpoel[e*4+3] }};
-
-    // access pointer to solution at element nodes
-    std::vector< const tk::real* > a( ncomp );
-    for (ncomp_t c=0; c<ncomp; ++c) a[c] = A.cptr( c, 0 );
 
-    // Scatter-add limited antidiffusive element contributions to nodes. At
-    // nodes where Dirichlet boundary conditions are set, the AECs are set to
-    // zero so the limit coefficient has no effect. This yields no increment for
-    // those nodes. See the detailed discussion when computing the AECs.
+    // Scatter-add limited antidiffusive element contributions to nodes
+    // (Lohner: AEC^c). At nodes where Dirichlet boundary conditions are set,
+    // the AECs are set to zero so the limit coefficient has no effect. This
+    // yields no increment for those nodes. See the detailed discussion when
+    // computing the AECs.
     for (std::size_t j=0; j<4; ++j) {
       auto b = bcdir.find( N[j] );    // Dirichlet BC
       for (ncomp_t c=0; c<ncomp; ++c) {
-        if (b != end(bcdir) && b->second[c].first) {
+        if (b != bcdir.size() && bcdir.set(b,c)) {
           A.var(a[c],N[j]) += m_aec(e*4+j,c,0);
         } else {
-          A.var(a[c],N[j]) += C(e,c,0) * m_aec(e*4+j,c,0);
+          A.var(a[c],N[j]) += C[c] * m_aec(e*4+j,c,0);
         }
       }
     }
@@ -22,6 +22,8 @@
 
 #include "Keywords.hpp"
 #include "Fields.hpp"
+#include "NodeBC.hpp"
+#include "BndNodeNormals.hpp"
 #include "Inciter/InputDeck/InputDeck.hpp"
 
 namespace inciter {
@@ -105,21 +107,22 @@ class FluxCorrector {
     //! Resize state (e.g., after mesh refinement)
     void resize( std::size_t is ) {
       m_aec.resize( is, g_inputdeck.get< tag::component >().nprop() );
+      m_dedge.clear();
+      m_dweight.clear();
     }
 
-    //! Compute antidiffusive element contributions (AEC)
+    //! \brief Compute antidiffusive element contributions (AEC) and the
+    //!   maximum and minimum unknowns of all elements surrounding nodes
     void aec(
       const std::array< std::vector< tk::real >, 3 >& coord,
       const std::vector< std::size_t >& inpoel,
       const std::vector< tk::real >& vol,
-      const std::unordered_map< std::size_t,
-              std::vector< std::pair< bool, tk::real > > >& bc,
-      const std::unordered_map< int,
-        std::unordered_set< std::size_t > >& symbcnodemap,
-      const std::unordered_map< int,
-        std::unordered_map< std::size_t, std::array< tk::real, 4 > > >& bnorm,
+      const DirBCPlan& bc,
+      const tk::BndNodeNormals& symbcnorm,
       const tk::Fields& Un,
-      tk::Fields& P );
+      const tk::Fields& Ul,
+      tk::Fields& P,
+      tk::Fields& Q );
 
     //! Verify the assembled antidiffusive element contributions
     bool verify( std::size_t nchare,
@@ -132,17 +135,20 @@ class FluxCorrector {
                      const std::vector< std::size_t >& inpoel,
                      const tk::Fields& Un ) const;
 
-    //! \brief Compute the maximum and minimum unknowns of all elements
-    //!   surrounding nodes
-    void alw( const std::vector< std::size_t >& inpoel,
-              const tk::Fields& Un,
-              const tk::Fields& Ul,
-              tk::Fields& Q ) const;
+    //! Compute edge weights of the mass diffusion of the low order system
+    void diffEdges( const std::array< std::vector< tk::real >, 3 >& coord,
+                    const std::vector< std::size_t >& inpoel );
+
+    //! Query if the edge weights of the mass diffusion have been computed
+    //! eturn True if diffEdges() has been called since the last resize
+    bool hasDiffEdges() const { return !m_dweight.empty(); }
+
+    //! Compute mass diffusion contribution to the rhs over mesh edges
+    tk::Fields diff( const tk::Fields& Un ) const;
 
     //! Compute limited antiffusive element contributions and apply to mesh nodes
     void lim( const std::vector< std::size_t >& inpoel,
-              const std::unordered_map< std::size_t,
-                      std::vector< std::pair< bool, tk::real > > >& bcdir,
+              const DirBCPlan& bcdir,
               const tk::Fields& P,
               const tk::Fields& Ul,
               tk::Fields& Q,
@@ -175,6 +181,12 @@ class FluxCorrector {
    std::vector< std::vector< ncomp_t > > m_sys;
    //! Component indices to treat as a velocity vector for multiple systems
    std::vector< std::array< ncomp_t, 3 > > m_vel;
+   //! \brief Local node IDs of the end-points of the mesh edges for the
+   //!   edge-based mass diffusion, 2 per edge
+   //! \details Not migrated, recomputed by diffEdges() when needed.
+   std::vector< std::size_t > m_dedge;
+   //! Weights of the mesh edges for the edge-based mass diffusion
+   std::vector< tk::real > m_dweight;
 };
 
 } // inciter::
@@ -0,0 +1,196 @@
+// *****************************************************************************
+/*!
+  \file      src/Inciter/ICBoxState.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     State of applying user-defined box initial conditions
+  \details   State of applying user-defined box initial conditions (IC) at the
+    mesh nodes inside the box: which nodes have been set, and an index of the
+    nodes sorted by their distance from the centers of the spheres used for
+    initiating the box IC from points.
+*/
+// *****************************************************************************
+#ifndef ICBoxState_h
+#define ICBoxState_h
+
+#include <array>
+#include <cmath>
+#include <vector>
+#include <numeric>
+#include <utility>
+#include <algorithm>
+
+#include "Types.hpp"
+#include "Exception.hpp"
+#include "PUPUtil.hpp"
+
+namespace inciter {
+
+//! State of applying user-defined box ICs at the nodes inside the box
+//! \details The box nodes are referred to by their index b in the vector of
+//!   box node ids given to CGPDE::box(). Once all box nodes have been set,
+//!   done() returns true and box ICs need not be applied anymore.
+//!
+//!   For box ICs initiated from points, the nodes inside a spherical shell
+//!   around each point are set as the shell expands. To find them without
+//!   computing the distance of every box node at every time step, index()
+//!   stores, per PDE system and sphere, the box nodes in increasing order of
+//!   their distance from the center, as a compressed row storage. The nodes
+//!   inside a shell are then a contiguous range of it, see shell().
+class ICBoxState {
+
+  public:
+    //! Empty constructor: no box nodes
+    explicit ICBoxState() = default;
+
+    //! Constructor: no box node set yet
+    //! \param[in] n Number of nodes inside the box
+    explicit ICBoxState( std::size_t n ) : m_set( n, 0 ), m_nset( 0 ) {}
+
+    //! Query if all box nodes have been set
+    //! \return True if all box nodes have been set, and for no box nodes
+    bool done() const { return m_nset == m_set.size(); }
+
+    //! Query if a box node has been set
+    //! \param[in] b Box node index
+    //! \return True if box node b has been set
+    bool isset( std::size_t b ) const { return m_set[b]; }
+
+    //! Mark a box node as set
+    //! \param[in] b Box node index
+    void set( std::size_t b ) {
+      if (!m_set[b]) { m_set[b] = 1; ++m_nset; }
+    }
+
+    //! Mark all box nodes as set
+    void setall() {
+      std::fill( begin(m_set), end(m_set), 1 );
+      m_nset = m_set.size();
+    }
+
+    //! Query if the spheres of a PDE system have been indexed
+    //! \param[in] system Equation system index
+    //! \return True if index() has been called for system
+    bool indexed( std::size_t system ) const
+    { return system < m_start.size() && !m_start[system].empty(); }
+
+    //! Sort the box nodes by their distance from the centers of spheres
+    //! \param[in] system Equation system index
+    //! \param[in] boxnodes Mesh node ids inside the box
+    //! \param[in] coord Mesh node coordinates
+    //! \param[in] p Coordinates of the centers of the spheres, 3 per sphere
+    void index( std::size_t system,
+                const std::vector< std::size_t >& boxnodes,
+                const std::array< std::vector< tk::real >, 3 >& coord,
+                const std::vector< tk::real >& p )
+    {
+      Assert( boxnodes.size() == m_set.size(), "Size mismatch" );
+      if (system >= m_start.size()) {
+        m_start.resize( system+1 );
+        m_bid.resize( system+1 );
+        m_dist.resize( system+1 );
+      }
+      const auto& x = coord[0];
+      const auto& y = coord[1];
+      const auto& z = coord[2];
+      auto n = boxnodes.size();
+      auto& start = m_start[system];
+      auto& bid = m_bid[system];
+      auto& dist = m_dist[system];
+      start.assign( 1, 0 );
+      bid.clear();
+      dist.clear();
+      std::vector< std::size_t > o( n );
+      std::vector< tk::real > d( n );
+      for (std::size_t s=0; s<p.size()/3; ++s) {
+        for (std::size_t b=0; b<n; ++b) {
+          auto i = boxnodes[b];
+          d[b] = std::sqrt( (x[i]-p[s*3+0])*(x[i]-p[s*3+0]) +
+                            (y[i]-p[s*3+1])*(y[i]-p[s*3+1]) +
+                            (z[i]-p[s*3+2])*(z[i]-p[s*3+2]) );
+        }
+        std::iota( begin(o), end(o), 0 );
+        std::sort( begin(o), end(o),
+                   [&]( std::size_t a, std::size_t b ){ return d[a] < d[b]; } );
+        for (auto b : o) {
+          bid.push_back( b );
+          dist.push_back( d[b] );
+        }
+        start.push_back( bid.size() );
+      }
+    }
+
+    //! Find the box nodes inside a spherical shell
+    //! \param[in] system Equation system index
+    //! \param[in] s Sphere index
+    //! \param[in] r0 Inner radius of the shell
+    //! \param[in] r1 Outer radius of the shell
+    //! \return Index of the first and one past the last entry of bid() of
+    //!   the box nodes whose distance d from the center of sphere s satisfies
+    //!   r0 < d < r1
+    std::pair< std::size_t, std::size_t >
+    shell( std::size_t system, std::size_t s, tk::real r0, tk::real r1 ) const
+    {
+      Assert( indexed( system ), "Spheres not indexed" );
+      const auto& start = m_start[system];
+      const auto& dist = m_dist[system];
+      Assert( s+1 < start.size(), "Sphere index out of bounds" );
+      auto b = begin(dist) + static_cast< std::ptrdiff_t >( start[s] );
+      auto e = begin(dist) + static_cast< std::ptrdiff_t >( start[s+1] );
+      auto l = std::upper_bound( b, e, r0 );
+      auto u = std::lower_bound( l, e, r1 );
+      return { static_cast< std::size_t >( l - begin(dist) ),
+               static_cast< std::size_t >( u - begin(dist) ) };
+    }
+
+    //! Box node indices sorted by distance from sphere centers
+    //! \param[in] system Equation system index
+    //! \return Box node indices of all spheres of system, see shell()
+    const std::vector< std::size_t >& bid( std::size_t system ) const
+    { return m_bid[system]; }
+
+    //! Number of bytes occupied, see tk::bytes()
+    //! \return Number of bytes occupied, including heap storage
+    std::size_t bytes() const {
+      auto b = sizeof(*this) + m_set.capacity();
+      for (std::size_t e=0; e<m_start.size(); ++e)
+        b += (m_start[e].capacity() + m_bid[e].capacity())*sizeof(std::size_t)
+           + m_dist[e].capacity()*sizeof(tk::real);
+      return b;
+    }
+
+    /** @name Charm++ pack/unpack serializer member functions */
+    ///@{
+    //! \brief Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    void pup( PUP::er &p ) {
+      p | m_set;
+      p | m_nset;
+      p | m_start;
+      p | m_bid;
+      p | m_dist;
+    }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] s ICBoxState object reference
+    friend void operator|( PUP::er& p, ICBoxState& s ) { s.pup(p); }
+    //@}
+
+  private:
+    //! 1 if the box node has been set
+    std::vector< char > m_set;
+    //! Number of box nodes set
+    std::size_t m_nset = 0;
+    //! Index of the first entry of each sphere in m_bid, per PDE system
+    std::vector< std::vector< std::size_t > > m_start;
+    //! Box node indices sorted by distance for each sphere, per PDE system
+    std::vector< std::vector< std::size_t > > m_bid;
+    //! Distances of the box nodes in m_bid from the sphere centers
+    std::vector< std::vector< tk::real > > m_dist;
+};
+
+} // inciter::
+
+#endif // ICBoxState_h
@@ -0,0 +1,79 @@
+// *****************************************************************************
+/*!
+  \file      src/Inciter/MemoryReport.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Memory report of the setup phases
+  \details   Memory report of the setup phases. At the end of each phase of
+    the setup, i.e., after the mesh has been distributed, (initially) refined,
+    reordered, and after the workers have been set up, the objects that hold the
+    mesh count the bytes their major containers occupy, by category, using
+    tk::bytes(), together with the resident set size of their process and its
+    high-water mark. The report is reduced across the contributors and echoed
+    to screen with the setup progress, which helps finding out which of the
+    data structures dominate the memory footprint when running out of memory.
+*/
+// *****************************************************************************
+#ifndef MemoryReport_h
+#define MemoryReport_h
+
+#include <array>
+#include <vector>
+
+#include "Types.hpp"
+#include "Memory.hpp"
+
+namespace inciter {
+
+//! Categories of memory accounted
+enum Mem : std::size_t { MPART=0,       //!< Partitioner
+                         MSORTER,       //!< Mesh reordering
+                         MAMR,          //!< Mesh refinement stores
+                         MMESH,         //!< Mesh connectivity and coordinates
+                         MDERIVED,      //!< Derived data, e.g., psup, esuel
+                         MFIELDS,       //!< Solution and other fields
+                         MCOMMAP,       //!< Communication maps
+                         MRSS,          //!< Resident set size of process
+                         MHWM,          //!< High-water mark of resident set
+                         NUMMEM };      //!< Number of categories
+
+//! Names of categories of memory accounted
+const std::array< const char*, NUMMEM > MemName{{ "partitioner", "sorter",
+  "amr", "mesh", "derived", "fields", "commap", "rss", "rss-hwm" }};
+
+//! Setup phases at whose end memory is accounted
+enum MemPhase : std::size_t { MDISTRIBUTED=0,   //!< Mesh distributed
+                              MREFINED,         //!< Initial mesh refinement
+                              MREORDERED,       //!< Mesh nodes reordered
+                              MSETUP,           //!< Workers set up
+                              NUMMEMPHASE };    //!< Number of phases
+
+//! Names of setup phases at whose end memory is accounted
+const std::array< const char*, NUMMEMPHASE > MemPhaseName{{ "distributed",
+  "refined", "reordered", "setup" }};
+
+//! \brief Entries in the memory report vector (of vectors of categories)
+//! \details Only the first element of the MPHASE entry is used.
+enum MemRow { MSUM=0,           //!< Sum across contributors
+              MMAX,             //!< Maximum across contributors
+              MPHASE,           //!< Setup phase
+              NUMMEMROW };      //!< Number of entries
+
+//! Assemble memory report of a contributor
+//! \param[in] p Setup phase at whose end memory is accounted
+//! \param[in] b Bytes per category of memory accounted, those of MRSS and MHWM
+//!   are queried here
+//! \return Memory report vector, see MemRow
+inline std::vector< std::vector< tk::real > >
+memreport( MemPhase p, std::array< std::size_t, NUMMEM > b ) {
+  b[MRSS] = tk::rss();
+  b[MHWM] = tk::rsshwm();
+  std::vector< tk::real > r( begin(b), end(b) );
+  return { r, r, { static_cast< tk::real >( p ) } };
+}
+
+} // inciter::
+
+#endif // MemoryReport_h
@@ -0,0 +1,69 @@
+// *****************************************************************************
+/*!
+  \file      src/Inciter/MsgPriority.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Charm++ message priorities per kind of message
+  \details   Charm++ message priorities per kind of message. With message
+    priorities configured, halo exchanges, which neighbor chares wait for to
+    finish the current stage, are delivered before messages of default
+    priority, while mesh refinement bookkeeping and output, which no chare
+    waits for within a time step, yield to both. A PE busy with output then
+    no longer delays the halo data its neighbors are blocked on. The effect
+    shows up in the times chares wait for communication in the phase timer
+    report, see Transporter::perf().
+*/
+// *****************************************************************************
+#ifndef MsgPriority_h
+#define MsgPriority_h
+
+#include <array>
+#include <mutex>
+
+#include "NoWarning/charm++.hpp"
+
+#include "CommCounter.hpp"
+#include "Inciter/InputDeck/InputDeck.hpp"
+
+namespace inciter {
+
+extern ctr::InputDeck g_inputdeck;
+
+//! Charm++ integer priority of a kind of message, smaller is more urgent
+//! \param[in] m Kind of message
+//! \return Priority of the kind of message, 0 is the default priority
+inline int msgprio( Msg m ) {
+  switch (m) {
+    case MLHS: case MGRAD: case MRHS: case MFCT:
+    case MSOL: case MRECO: case MLIM: return -1;
+    case MREFINER: return 1;
+    default: return 0;
+  }
+}
+
+//! Charm++ entry options to send a kind of message with
+//! \param[in] m Kind of message, NUMMSG for output
+//! \return Entry options with the priority of the kind of message, nullptr,
+//!   i.e., default priority, if message priorities are not configured
+//! \details The entry options are shared by all chares of a process and
+//!   never modified after they are configured, so they are safe to pass to
+//!   concurrent sends by the PEs of an SMP process.
+inline const CkEntryOptions* msgopts( Msg m ) {
+  if (!g_inputdeck.get< tag::discr, tag::msgprio >()) return nullptr;
+
+  static std::array< CkEntryOptions, NUMMSG+1 > opts;
+  static std::once_flag once;
+  std::call_once( once, [](){
+    for (std::size_t k=0; k<NUMMSG; ++k)
+      opts[k].setPriority( msgprio( static_cast< Msg >( k ) ) );
+    opts[NUMMSG].setPriority( 1 );
+  } );
+
+  return &opts[ m ];
+}
+
+} // inciter::
+
+#endif // MsgPriority_h
@@ -15,6 +15,7 @@
 #include <map>
 #include <unordered_map>
 #include <algorithm>
+#include <cmath>
 
 #include "NodeBC.hpp"
 #include "CGPDE.hpp"
@@ -25,48 +26,40 @@ namespace inciter {
 
 extern std::vector< CGPDE > g_cgpde;
 
-std::unordered_map< std::size_t, std::vector< std::pair< bool, tk::real > > >
-match( [[maybe_unused]] tk::ctr::ncomp_t ncomp,
-       tk::real t,
-       tk::real dt,
-       const std::vector< tk::real >& tp,
-       const std::vector< tk::real >& dtp,
-       const tk::UnsMesh::Coords& coord,
-       const std::unordered_map< std::size_t, std::size_t >& lid,
-       const std::map< int, std::vector< std::size_t > >& bnode )
+DirBCPlan::DirBCPlan(
+  tk::ctr::ncomp_t ncomp,
+  std::size_t npoin,
+  const tk::UnsMesh::Coords& coord,
+  const std::unordered_map< std::size_t, std::size_t >& lid,
+  const std::map< int, std::vector< std::size_t > >& bnode,
+  uint64_t epoch ) :
+  m_ncomp( ncomp ),
+  m_epoch( epoch ),
+  m_node(),
+  m_mask(),
+  m_val(),
+  m_index( npoin, NONE ),
+  m_eqnode( g_cgpde.size() )
 // *****************************************************************************
-//  Match user-specified boundary conditions at nodes for side sets
+//  Constructor: match user-specified boundary conditions at nodes for side sets
 //! \param[in] ncomp Number of scalar components in PDE system
-//! \param[in] t Physical time at which to query boundary conditions
-//! \param[in] dt Time step size (for querying BC increments in time)
-//! \param[in] tp Physical time for each mesh node
-//! \param[in] dtp Time step size for each mesh node
+//! \param[in] npoin Number of mesh nodes of the mesh chunk
 //! \param[in] coord Mesh node coordinates
-//! \param[in] lid Local node IDs associated to local node IDs
+//! \param[in] lid Local node IDs associated to global node IDs
 //! \param[in] bnode Map storing global mesh node IDs mapped to side set ids
-//! \return Vector of pairs of bool and boundary condition value associated to
-//!   local mesh node IDs at which the user has set Dirichlet boundary
-//!   conditions for all systems of PDEs integrated. The bool indicates whether
-//!   the BC is set at the node for that component: if true, the real value is
-//!   the increment (from t to dt) in the BC specified for a component.
+//! \param[in] epoch Mesh epoch, i.e., version of the mesh data, matched in
 //! \details Boundary conditions (BC), mathematically speaking, are applied on
 //!   finite surfaces. These finite surfaces are given by element sets (i.e., a
-//!   list of elements). This function queries Dirichlet boundary condition
-//!   values from all PDEs in the system of systems of PDEs integrated at the
-//!   node lists associated to side set IDs, given by bnode  Each
-//!   PDE system returns a BC data structure. Note that the BC mesh nodes that
-//!   this function results in, stored in dirbc, only contains those nodes that
-//!   are supplied via bnode  i.e., in parallel only a part of the mesh is
-//!   worked on.
+//!   list of elements). This function queries Dirichlet boundary conditions
+//!   from all PDEs in the system of systems of PDEs integrated at the node
+//!   lists associated to side set IDs, given by bnode, and records the nodes
+//!   and components at which they are set. Note that the BC mesh nodes this
+//!   results in only contain those nodes that are supplied via bnode, i.e., in
+//!   parallel only a part of the mesh is worked on.
 // *****************************************************************************
 {
   using inciter::g_cgpde;
 
-  // Vector of pairs of bool and boundary condition value associated to mesh
-  // node IDs at which the user has set Dirichlet BCs for all PDEs integrated.
-  std::unordered_map< std::size_t,
-    std::vector< std::pair< bool, tk::real > > > dirbc;
-
   // Details for the algorithm below: PDE::dirbc() returns a new map that
   // associates a vector of pairs associated to local node IDs. (The pair is a
   // pair of bool and real value, the former is the fact that the BC is to be
@@ -109,6 +102,14 @@ match( [[maybe_unused]] tk::ctr::ncomp_t ncomp,
   // common node. Since bnode is an ordered map, the side set with a larger
   // id wins if a node belongs to multiple side sets.
 
+  // Since the BCs are only queried here to find out where they are set, the
+  // time and time step sizes passed to PDE::dirbc() are arbitrary. For each
+  // node and PDE system, the position of the first component of the system in
+  // the node's NodeBC vector is recorded, at which eval() stores its BCs.
+  std::vector< tk::real > zero( npoin, 0.0 );
+  std::map< std::size_t, std::vector< char > > mask;
+  std::vector< std::map< std::size_t, std::size_t > > eqnode( g_cgpde.size() );
+
   // Lambda to convert global to local node ids of a list of nodes
   auto local = [ &lid ]( const std::vector< std::size_t >& gnodes ){
     std::vector< std::size_t > lnodes( gnodes.size() );
@@ -123,54 +124,80 @@ match( [[maybe_unused]] tk::ctr::ncomp_t ncomp,
     auto l = local(s.second);   // generate local node ids on side set
     for (std::size_t eq=0; eq<g_cgpde.size(); ++eq) {
       // query Dirichlet BCs at nodes of this side set
-      auto eqbc = g_cgpde[eq].dirbc( t, dt, tp, dtp, {s.first,l}, coord );
-      for (const auto& n : eqbc) {
-        auto id = n.first;                      // BC node ID
-        const auto& bcs = n.second;             // BCs
-        auto& nodebc = dirbc[ id ];     // BCs to be set for node
-        if (nodebc.size() > c) {        // node already has BCs from this PDE
-          Assert( nodebc.size() == c+bcs.size(), "Size mismatch" );
-          for (std::size_t i=0; i<bcs.size(); i++) {
-            if (bcs[i].first) nodebc[c+i] = bcs[i];
-          }
-        } else {        // node does not yet have BCs from this PDE
-          // This branch needs to be completed for system of systems of PDEs.
-          // See note above.
-          nodebc.insert( end(nodebc), begin(bcs), end(bcs) );
-        }
+      auto eqbc = g_cgpde[eq].dirbc( 0.0, 0.0, zero, zero, {s.first,l}, coord );
+      for (const auto& [id,bcs] : eqbc) {
+        auto& nodebc = mask[ id ];      // BCs to be set for node
+        if (nodebc.size() < c+bcs.size()) nodebc.resize( c+bcs.size(), 0 );
+        for (std::size_t i=0; i<bcs.size(); i++)
+          if (bcs[i].first) nodebc[c+i] = 1;
+        eqnode[eq][id] = c;
       }
       if (!eqbc.empty()) c += eqbc.cbegin()->second.size();
     }
   }
 
-  // Verify the size of each NodeBC vectors. They must have the same lengths and
-  // equal to the total number of scalar components for all systems of PDEs
-  // integrated.
-  Assert( std::all_of( begin(dirbc), end(dirbc),
-            [ ncomp ]( const auto& n ){ return n.second.size() == ncomp; } ),
+  // Verify the size of each NodeBC vectors. They must not be larger than the
+  // total number of scalar components for all systems of PDEs integrated.
+  Assert( std::all_of( begin(mask), end(mask),
+            [ ncomp ]( const auto& n ){ return n.second.size() <= ncomp; } ),
           "Size of NodeBC vector incorrect" );
- 
-  return dirbc;
+
+  // Compile BC nodes, in increasing order of local node ids, and their masks
+  m_node.reserve( mask.size() );
+  m_mask.resize( mask.size() * m_ncomp, 0 );
+  m_val.resize( m_mask.size(), 0.0 );
+  for (const auto& [p,m] : mask) {
+    m_index[p] = m_node.size();
+    std::copy( begin(m), end(m), begin(m_mask) +
+      static_cast< std::ptrdiff_t >( m_node.size() * m_ncomp ) );
+    m_node.push_back( p );
+  }
+
+  // Compile the nodes at which each PDE system sets BCs
+  for (std::size_t eq=0; eq<g_cgpde.size(); ++eq) {
+    m_eqnode[eq].reserve( eqnode[eq].size() );
+    for (const auto& [p,c] : eqnode[eq])
+      m_eqnode[eq].emplace_back( p, m_index[p]*m_ncomp + c );
+  }
+}
+
+void
+DirBCPlan::eval( tk::real t,
+                 tk::real dt,
+                 const std::vector< tk::real >& tp,
+                 const std::vector< tk::real >& dtp,
+                 const tk::UnsMesh::Coords& coord )
+// *****************************************************************************
+//  Evaluate the increments of the boundary conditions at all BC nodes
+//! \param[in] t Physical time at which to evaluate boundary conditions
+//! \param[in] dt Time step size (for evaluating BC increments in time)
+//! \param[in] tp Physical time for each mesh node
+//! \param[in] dtp Time step size for each mesh node
+//! \param[in] coord Mesh node coordinates
+//! \details The increments (from t to t+dt) of the BCs are evaluated by each
+//!   PDE system at the nodes at which it sets BCs. If a component is not
+//!   masked, see set(), its value is not used.
+// *****************************************************************************
+{
+  for (std::size_t eq=0; eq<g_cgpde.size(); ++eq)
+    if (!m_eqnode[eq].empty())
+      g_cgpde[eq].dirbcinc( t, dt, tp, dtp, m_eqnode[eq], coord, m_val );
 }
 
 bool
 correctBC( const tk::Fields& a,
            const tk::Fields& dul,
-           const std::unordered_map< std::size_t,
-                   std::vector< std::pair< bool, tk::real > > >& dirbc )
+           const DirBCPlan& bc )
 // *****************************************************************************
 //  Verify that the change in the solution at those nodes where Dirichlet
 //  boundary conditions are set is exactly the amount the BCs prescribe
 //! \param[in] a Limited antidiffusive element contributions (from FCT)
 //! \param[in] dul Low order solution increment
-//! \param[in] dirbc Vector of boundary conditions (true/false + BC value) for
-//!   all scalar components integrated associated of all systems to local node
-//!   ID
+//! \param[in] bc Dirichlet boundary conditions (set or not + BC increment)
+//!   for all scalar components integrated of all systems at local node IDs
 //! \return True if solution is correct at Dirichlet boundary condition nodes
-//! \details We loop through the map that associates a vector of of boundary
-//!   conditions (true/false, indicating whether the BC is set + BC value if
-//!   true) for all scalar components integrated associated of all systems to
-//!   global node IDs. Then for all scalar components of all systems of systems
+//! \details We loop through the nodes at which boundary conditions are set.
+//!   Then for all scalar components of all systems of systems
 //!   of PDEs integrated if a BC is to be set for a given component, we compute
 //!   the low order solution increment + the anti-diffusive element
 //!   contributions (in FCT), which is the current solution increment (to be
@@ -180,11 +207,11 @@ correctBC( const tk::Fields& a,
 //!   error.
 // *****************************************************************************
 {
-  for (const auto& [i,bc] : dirbc) {
-    Assert( bc.size() == dul.nprop(), "Size mismatch" );
-    for (std::size_t c=0; c<bc.size(); ++c) {
-      if ( bc[c].first &&
-           std::abs( dul(i,c,0) + a(i,c,0) - bc[c].second ) >
+  for (std::size_t b=0; b<bc.size(); ++b) {
+    auto i = bc.node(b);
+    for (std::size_t c=0; c<dul.nprop(); ++c) {
+      if ( bc.set(b,c) &&
+           std::abs( dul(i,c,0) + a(i,c,0) - bc.value(b,c) ) >
              std::numeric_limits< tk::real >::epsilon() )
       {
          return false;
@@ -15,24 +15,135 @@
 
 #include <vector>
 #include <map>
+#include <limits>
+#include <utility>
 #include <unordered_map>
 
 #include "SystemComponents.hpp"
 #include "UnsMesh.hpp"
 #include "Fields.hpp"
+#include "Memory.hpp"
+#include "PUPUtil.hpp"
 
 namespace inciter {
 
-//! Match user-specified boundary conditions at nodes for side sets
-std::unordered_map< std::size_t, std::vector< std::pair< bool, tk::real > > >
-match( tk::ctr::ncomp_t ncomp,
-       tk::real t,
-       tk::real dt,
-       const std::vector< tk::real >& tp,
-       const std::vector< tk::real >& dtp,
-       const tk::UnsMesh::Coords& coord,
-       const std::unordered_map< std::size_t, std::size_t >& lid,
-       const std::map< int, std::vector< std::size_t > >& sidenodes );
+//! \brief Dirichlet boundary conditions matched to the nodes of a mesh chunk,
+//!   compiled into flat arrays once per mesh epoch
+//! \details The nodes at which the user has set Dirichlet boundary conditions
+//!   (BC) on side sets, and for which of their scalar components, only change
+//!   with the mesh. Thus they are matched to local node ids only when the mesh
+//!   changes, see the constructor, storing the BC nodes in increasing order of
+//!   their local ids, together with a mask of the components set, as flat
+//!   arrays. The BC values, i.e., the increments of the BCs from t to t+dt,
+//!   are evaluated by eval() at every stage by each PDE system at the nodes at
+//!   which it sets BCs, directly into a flat array, so that applying the BCs
+//!   is a loop over flat arrays without hashing or allocation.
+class DirBCPlan {
+
+  public:
+    //! Empty constructor: no BCs
+    explicit DirBCPlan() = default;
+
+    //! Constructor: match user-specified BCs at nodes for side sets
+    explicit DirBCPlan( tk::ctr::ncomp_t ncomp,
+                        std::size_t npoin,
+                        const tk::UnsMesh::Coords& coord,
+                        const std::unordered_map< std::size_t, std::size_t >&
+                          lid,
+                        const std::map< int, std::vector< std::size_t > >&
+                          bnode,
+                        uint64_t epoch );
+
+    //! Evaluate the increments of the BCs at all BC nodes
+    void eval( tk::real t,
+               tk::real dt,
+               const std::vector< tk::real >& tp,
+               const std::vector< tk::real >& dtp,
+               const tk::UnsMesh::Coords& coord );
+
+    //! Mesh epoch the BCs were matched in
+    //! \return Mesh epoch passed to the constructor
+    uint64_t epoch() const { return m_epoch; }
+
+    //! Number of nodes at which BCs are set
+    //! \return Number of BC nodes
+    std::size_t size() const { return m_node.size(); }
+
+    //! Local node id of a BC node
+    //! \param[in] i BC node index, i < size()
+    //! \return Local node id of BC node i
+    std::size_t node( std::size_t i ) const { return m_node[i]; }
+
+    //! Query if the BC is set for a component of a BC node
+    //! \param[in] i BC node index, i < size()
+    //! \param[in] c Scalar component index
+    //! \return True if the BC is set for component c at BC node i
+    bool set( std::size_t i, std::size_t c ) const
+    { return m_mask[ i*m_ncomp + c ]; }
+
+    //! Increment of the BC of a component of a BC node
+    //! \param[in] i BC node index, i < size()
+    //! \param[in] c Scalar component index
+    //! \return Increment of the BC from t to t+dt, see eval()
+    tk::real value( std::size_t i, std::size_t c ) const
+    { return m_val[ i*m_ncomp + c ]; }
+
+    //! Find the BC node index of a local node id
+    //! \param[in] p Local node id
+    //! \return BC node index of local node p, size() if no BC is set at p
+    std::size_t find( std::size_t p ) const {
+      auto i = p < m_index.size() ? m_index[p] : NONE;
+      return i == NONE ? m_node.size() : i;
+    }
+
+    //! Number of bytes occupied, see tk::bytes()
+    //! \return Number of bytes the plan occupies, including its heap storage
+    std::size_t bytes() const {
+      return sizeof(*this) + tk::bytes( m_node, m_mask, m_val, m_index,
+                                        m_eqnode );
+    }
+
+    /** @name Charm++ pack/unpack serializer member functions */
+    ///@{
+    //! \brief Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    void pup( PUP::er &p ) {
+      p | m_ncomp;
+      p | m_epoch;
+      p | m_node;
+      p | m_mask;
+      p | m_val;
+      p | m_index;
+      p | m_eqnode;
+    }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] d DirBCPlan object reference
+    friend void operator|( PUP::er& p, DirBCPlan& d ) { d.pup(p); }
+    //@}
+
+  private:
+    //! Value in m_index for nodes at which no BC is set
+    static constexpr std::size_t NONE = std::numeric_limits<std::size_t>::max();
+
+    //! Number of scalar components of all PDE systems
+    std::size_t m_ncomp = 0;
+    //! Mesh epoch the BCs were matched in, none if the max
+    uint64_t m_epoch = std::numeric_limits< uint64_t >::max();
+    //! Local node ids of the BC nodes in increasing order
+    std::vector< std::size_t > m_node;
+    //! 1 if the BC is set for a component, m_ncomp per BC node
+    std::vector< char > m_mask;
+    //! BC increments, m_ncomp per BC node
+    std::vector< tk::real > m_val;
+    //! BC node index of each local node id, NONE if no BC is set at the node
+    std::vector< std::size_t > m_index;
+    //! \brief Nodes at which a PDE system sets BCs, for each PDE system
+    //! \details Pairs of local node id and the index in m_val of the first
+    //!   component of the PDE system at the node
+    std::vector< std::vector< std::pair< std::size_t, std::size_t > > >
+      m_eqnode;
+};
 
 //! \brief Verify that the change in the solution at those nodes where
 //!   Dirichlet boundary conditions are set is exactly the amount the BCs
@@ -40,8 +151,7 @@ match( tk::ctr::ncomp_t ncomp,
 bool
 correctBC( const tk::Fields& a,
            const tk::Fields& dul,
-           const std::unordered_map< std::size_t,
-                   std::vector< std::pair< bool, tk::real > > >& bc );
+           const DirBCPlan& bc );
 
 } // inciter::
 
@@ -12,6 +12,9 @@
 */
 // *****************************************************************************
 
+#include <cmath>
+#include <limits>
+
 #include "CGPDE.hpp"
 #include "NodeDiagnostics.hpp"
 #include "DiagReducer.hpp"
@@ -22,27 +25,32 @@
 namespace inciter {
 
 extern ctr::InputDeck g_inputdeck;
+extern ctr::InputDeck g_inputdeck_defaults;
 extern std::vector< CGPDE > g_cgpde;
 
-static CkReduction::reducerType DiagMerger;
-
 } // inciter::
 
 using inciter::NodeDiagnostics;
 
-void
-NodeDiagnostics::registerReducers()
+bool
+NodeDiagnostics::lagged()
 // *****************************************************************************
-//  Configure Charm++ reduction types
-//! \details This routine is supposed to be called from a Charm++ initnode
-//!   routine. Since the runtime system executes initnode routines exactly once
-//!   on every logical node early on in the Charm++ init sequence, they must be
-//!   static as they are called without an object. See also: Section
-//!   "Initializations at Program Startup" at in the Charm++ manual
-//!   http://charm.cs.illinois.edu/manuals/html/charm++/manual.html.
+//  Query if diagnostics are sent along with the next time step size
+//! \return True if lagged diagnostics are configured and can be used
+//! \details Lagged diagnostics are not used with steady state, which needs
+//!   the residual to decide whether to continue, and with lagged time step
+//!   sizes, whose reduction is off the critical path already.
 // *****************************************************************************
 {
-  DiagMerger = CkReduction::addReducer( mergeDiag );
+  const auto& discr = g_inputdeck.get< tag::discr >();
+  if (!discr.get< tag::laggeddiag >() || discr.get< tag::steady_state >())
+    return false;
+
+  const auto eps = std::numeric_limits< tk::real >::epsilon();
+  const auto const_dt = discr.get< tag::dt >();
+  const auto def_const_dt = g_inputdeck_defaults.get< tag::discr, tag::dt >();
+  return !(discr.get< tag::laggeddt >() > 0.0 &&
+           std::abs(const_dt - def_const_dt) < eps);
 }
 
 bool
@@ -50,29 +58,95 @@ NodeDiagnostics::compute(
   Discretization& d,
   const tk::Fields& u,
   const tk::Fields& un,
-  const std::unordered_map< int,
-          std::unordered_map< std::size_t, std::array< tk::real, 4 > > >& bnorm,
-  const std::unordered_set< std::size_t >& symbcnodes,
-  const std::unordered_set< std::size_t >& farfieldbcnodes ) const
+  const tk::BndNodeNormals& symbc,
+  const tk::BndNodeNormals& farfieldbc ) const
 // *****************************************************************************
 //  Compute diagnostics, e.g., residuals, norms of errors, etc.
 //! \param[in] d Discretization proxy to read from
 //! \param[in] u Current solution vector
 //! \param[in] un Previous solution vector
-//! \param[in] bnorm Face normals in boundary points, key local node id,
-//!   first 3 reals of value: unit normal, outer key: side set id
-//! \param[in] symbcnodes Unique set of node ids at which to set symmetry BCs
-//! \param[in] farfieldbcnodes Unique set of node ids at which to set farfield
-//!   BCs
+//! \param[in] symbc Nodes and their normals at which to set symmetry BCs
+//! \param[in] farfieldbc Nodes and their normals at which to set farfield BCs
 //! \return True if diagnostics have been computed
+//! \details We send multiple sets of quantities to the host for aggregation
+//!   across the whole mesh. The final aggregated solution will end up in
+//!   Transporter::diagnostics(). Aggregation of the partially computed
+//!   diagnostics is done via potentially different policies for each field.
+//! \see inciter::diagMsg(), src/Inciter/Diagnostics.hpp
+// *****************************************************************************
+{
+  auto diag = accumulate( d, u, un, symbc, farfieldbc );
+  if (diag.empty()) return false;       // diagnostics have not been computed
+
+  // Contribute to diagnostics
+  auto msg = diagMsg( diag );
+  msg->setCallback(
+    CkCallback(CkIndex_Transporter::diagnostics(nullptr), d.Tr()) );
+  d.contribute( msg );
+
+  return true;        // diagnostics have been computed
+}
+
+void
+NodeDiagnostics::contribute( Discretization& d,
+                             std::vector< std::vector< tk::real > >&& diag,
+                             tk::real dt ) const
+// *****************************************************************************
+//  Contribute lagged diagnostics along with the next time step size
+//! \param[in] d Discretization proxy
+//! \param[in] diag Partial diagnostics of the previous time step computed by
+//!   accumulate()
+//! \param[in] dt Time step size of the next time step of this worker
+//! \details The aggregated diagnostics and the minimum time step size end up
+//!   in Transporter::diagdt(), which continues with the next time step.
+// *****************************************************************************
+{
+  Assert( diag.size() == NUMDIAG, "Diagnostics vector size mismatch" );
+  diag.push_back( { dt } );
+  auto msg = diagMsg( diag );
+  msg->setCallback( CkCallback(CkIndex_Transporter::diagdt(nullptr), d.Tr()) );
+  d.contribute( msg );
+}
+
+void
+NodeDiagnostics::finish( Discretization& d,
+                         std::vector< std::vector< tk::real > >&& diag ) const
+// *****************************************************************************
+//  Contribute lagged diagnostics of the last time step and finish
+//! \param[in] d Discretization proxy
+//! \param[in] diag Partial diagnostics of the last time step computed by
+//!   accumulate()
+//! \details The aggregated diagnostics end up in Transporter::diagfinish(),
+//!   which finishes time stepping.
+// *****************************************************************************
+{
+  Assert( diag.size() == NUMDIAG, "Diagnostics vector size mismatch" );
+  auto msg = diagMsg( diag );
+  msg->setCallback(
+    CkCallback(CkIndex_Transporter::diagfinish(nullptr), d.Tr()) );
+  d.contribute( msg );
+}
+
+std::vector< std::vector< tk::real > >
+NodeDiagnostics::accumulate(
+  Discretization& d,
+  const tk::Fields& u,
+  const tk::Fields& un,
+  const tk::BndNodeNormals& symbc,
+  const tk::BndNodeNormals& farfieldbc ) const
+// *****************************************************************************
+//  Compute the partial diagnostics of this worker, e.g., residuals, norms of
+//  errors, etc.
+//! \param[in] d Discretization proxy to read from
+//! \param[in] u Current solution vector
+//! \param[in] un Previous solution vector
+//! \param[in] symbc Nodes and their normals at which to set symmetry BCs
+//! \param[in] farfieldbc Nodes and their normals at which to set farfield BCs
+//! \return Partial diagnostics vector (of vectors) to be aggregated across
+//!   all workers, empty if no diagnostics are computed in this time step
 //! \details Diagnostics are defined as some norm, e.g., L2 norm, of a quantity,
 //!   computed in mesh nodes, A, as ||A||_2 = sqrt[ sum_i(A_i)^2 V_i ],
 //!   where the sum is taken over all mesh nodes and V_i is the nodal volume.
-//!   We send multiple sets of quantities to the host for aggregation across
-//!   the whole mesh. The final aggregated solution will end up in
-//!   Transporter::diagnostics(). Aggregation of the partially computed
-//!   diagnostics is done via potentially different policies for each field.
-//! \see inciter::mergeDiag(), src/Inciter/Diagnostics.hpp
 // *****************************************************************************
 {
   // Optionally collect diagnostics and send for aggregation across all workers
@@ -82,15 +156,15 @@ NodeDiagnostics::compute(
 
   if ( !((d.It()+1) % diagfreq) ) {     // if remainder, don't dump
 
-    // Slave mesh node local IDs. Local IDs of those mesh nodes to which we
+    // Flag slave mesh nodes. Local IDs of those mesh nodes to which we
     // contribute to but do not own. Ownership here is defined by having a lower
     // chare ID than any other chare that also contributes to the node.
-    std::unordered_set< std::size_t > slave;
+    std::vector< char > slave( u.nunk(), 0 );
 
     for (const auto& c : d.NodeCommMap())// for all neighbor chares
       if (d.thisIndex > c.first)        // if our chare ID is larger than theirs
-        for (auto i : c.second)         // store local ID in set
-          slave.insert( tk::cref_find( d.Lid(), i ) );
+        for (auto i : c.second)         // flag local ID
+          slave[ tk::cref_find( d.Lid(), i ) ] = 1;
 
     // Diagnostics vector (of vectors) during aggregation. See
     // Inciter/Diagnostics.h.
@@ -106,7 +180,7 @@ NodeDiagnostics::compute(
     // Evaluate analytic solution (if exist, if not, IC)
     auto an = u;
     for (std::size_t i=0; i<an.nunk(); ++i) {
-      if (slave.find(i) == end(slave)) {    // ignore non-owned nodes
+      if (!slave[i]) {                      // ignore non-owned nodes
         // Query analytic solution for all components of all PDEs integrated
         std::vector< tk::real > a;
         for (const auto& eq : g_cgpde) {
@@ -119,26 +193,26 @@ NodeDiagnostics::compute(
     }
     // Apply symmetry BCs on analytic solution (if exist, if not, IC)
     for (const auto& eq : g_cgpde)
-      eq.symbc( an, coord, bnorm, symbcnodes );
+      eq.symbc( an, coord, symbc );
     // Apply farfield BCs on analytic solution (if exist, if not, IC)
     for (const auto& eq : g_cgpde)
-      eq.farfieldbc( an, coord, bnorm, farfieldbcnodes );
+      eq.farfieldbc( an, coord, farfieldbc );
 
-    // Put in norms sweeping our mesh chunk
+    // Put in norms sweeping our mesh chunk, all norms in a single pass
     for (std::size_t i=0; i<u.nunk(); ++i) {
-      if (slave.find(i) == end(slave)) {    // ignore non-owned nodes
-        // Compute sum for L2 norm of the numerical solution
-        for (std::size_t c=0; c<u.nprop(); ++c)
-          diag[L2SOL][c] += u(i,c,0) * u(i,c,0) * v[i];
-        // Compute sum for L2 norm of the numerical-analytic solution
-        for (std::size_t c=0; c<u.nprop(); ++c)
-          diag[L2ERR][c] += (u(i,c,0)-an(i,c,0)) * (u(i,c,0)-an(i,c,0)) * v[i];
-        // Compute sum for L2 norm of the residual
-        for (std::size_t c=0; c<u.nprop(); ++c)
-          diag[L2RES][c] += (u(i,c,0)-un(i,c,0)) * (u(i,c,0)-un(i,c,0)) * v[i];
-        // Compute max for Linf norm of the numerical-analytic solution
+      if (!slave[i]) {                      // ignore non-owned nodes
         for (std::size_t c=0; c<u.nprop(); ++c) {
-          auto err = std::abs( u(i,c,0) - an(i,c,0) );
+          const auto s = u(i,c,0);
+          const auto e = s - an(i,c,0);
+          const auto r = s - un(i,c,0);
+          // Compute sum for L2 norm of the numerical solution
+          diag[L2SOL][c] += s * s * v[i];
+          // Compute sum for L2 norm of the numerical-analytic solution
+          diag[L2ERR][c] += e * e * v[i];
+          // Compute sum for L2 norm of the residual
+          diag[L2RES][c] += r * r * v[i];
+          // Compute max for Linf norm of the numerical-analytic solution
+          auto err = std::abs( e );
           if (err > diag[LINFERR][c]) diag[LINFERR][c] = err;
         }
       }
@@ -152,13 +226,8 @@ NodeDiagnostics::compute(
     diag[TIME][0] = d.T() + d.Dt();
     diag[DT][0] = d.Dt();
 
-    // Contribute to diagnostics
-    auto stream = serialize( diag );
-    d.contribute( stream.first, stream.second.get(), DiagMerger,
-      CkCallback(CkIndex_Transporter::diagnostics(nullptr), d.Tr()) );
-
-    return true;        // diagnostics have been computed
+    return diag;
   }
 
-  return false;         // diagnostics have not been computed
+  return {};
 }
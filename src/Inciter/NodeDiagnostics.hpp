@@ -18,6 +18,7 @@
 #include "Discretization.hpp"
 #include "PUPUtil.hpp"
 #include "Diagnostics.hpp"
+#include "BndNodeNormals.hpp"
 
 namespace inciter {
 
@@ -25,17 +26,31 @@ namespace inciter {
 class NodeDiagnostics {
 
   public:
-    //! Configure Charm++ custom reduction types initiated from this class
-    static void registerReducers();
+    //! Query if diagnostics are sent along with the next time step size
+    static bool lagged();
 
     //! Compute diagnostics, e.g., residuals, norms of errors, etc.
     bool compute(
       Discretization& d,
       const tk::Fields& u, const tk::Fields& un,
-      const std::unordered_map< int,
-        std::unordered_map< std::size_t, std::array< tk::real, 4 > > >& bnorm,
-      const std::unordered_set< std::size_t >& symbcnodes,
-      const std::unordered_set< std::size_t >& farfieldbcnodes ) const;
+      const tk::BndNodeNormals& symbc,
+      const tk::BndNodeNormals& farfieldbc ) const;
+
+    //! Compute the partial diagnostics of this worker without contributing
+    std::vector< std::vector< tk::real > > accumulate(
+      Discretization& d,
+      const tk::Fields& u, const tk::Fields& un,
+      const tk::BndNodeNormals& symbc,
+      const tk::BndNodeNormals& farfieldbc ) const;
+
+    //! Contribute lagged diagnostics along with the next time step size
+    void contribute( Discretization& d,
+                     std::vector< std::vector< tk::real > >&& diag,
+                     tk::real dt ) const;
+
+    //! Contribute lagged diagnostics of the last time step and finish
+    void finish( Discretization& d,
+                 std::vector< std::vector< tk::real > >&& diag ) const;
 
     /** @name Charm++ pack/unpack serializer member functions */
     ///@{
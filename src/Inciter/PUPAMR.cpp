@@ -65,6 +65,17 @@ void PUP::pup( PUP::er &p, AMR::edge_t& e )
   p | e.get_data();
 }
 
+void PUP::pup( PUP::er &p, AMR::id_set_t& s )
+// *****************************************************************************
+//  Pack/Unpack id_set_t
+//! \param[in] p Charm++'s pack/unpack object
+//! \param[in,out] s id_set_t object reference
+// *****************************************************************************
+{
+  p | s.get_flags();
+  p | s.get_size();
+}
+
 void PUP::pup( PUP::er &p, AMR::active_element_store_t& a )
 // *****************************************************************************
 //  Pack/Unpack active_element_store_t
@@ -105,6 +116,7 @@ void PUP::pup( PUP::er &p, AMR::tet_store_t& t )
 {
   p | t.center_tets;
   p | t.delete_list;
+  p | t.leaf_families;
   p | t.active_elements.data();
   p | t.master_elements.data();
   p | t.active_tetinpoel;
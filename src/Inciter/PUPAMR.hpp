@@ -25,6 +25,7 @@
 #include "AMR/refinement.hpp"
 #include "AMR/master_element_store.hpp"
 #include "AMR/id_generator.hpp"
+#include "AMR/id_map.hpp"
 
 //! Extensions to Charm++'s Pack/Unpack routines
 namespace PUP {
@@ -87,6 +88,53 @@ inline void operator|( PUP::er& p, AMR::marked_refinements_store_t<case_t>& m )
 { pup(p,m); }
 //@}
 
+/** @name Charm++ pack/unpack serializer member functions for id_map_t */
+///@{
+//! Pack/Unpack id_map_t
+//! \param[in] p Charm++'s pack/unpack object
+//! \param[in,out] m id_map_t object reference
+template< class T >
+void pup( PUP::er &p, AMR::id_map_t< T >& m ) {
+  p | m.get_data();
+  p | m.get_flags();
+  p | m.get_size();
+}
+//! Pack/Unpack serialize operator|
+//! \param[in,out] p Charm++'s PUP::er serializer object reference
+//! \param[in,out] m id_map_t object reference
+template< class T >
+inline void operator|( PUP::er& p, AMR::id_map_t< T >& m ) { pup(p,m); }
+//@}
+
+/** @name Charm++ pack/unpack serializer member functions for id_set_t */
+///@{
+//! Pack/Unpack id_set_t
+void pup( PUP::er &p, AMR::id_set_t& s );
+//! Pack/Unpack serialize operator|
+//! \param[in,out] p Charm++'s PUP::er serializer object reference
+//! \param[in,out] s id_set_t object reference
+inline void operator|( PUP::er& p, AMR::id_set_t& s ) { pup(p,s); }
+//@}
+
+/** @name Charm++ pack/unpack serializer member functions for edge_table_t */
+///@{
+//! Pack/Unpack edge_table_t
+//! \param[in] p Charm++'s pack/unpack object
+//! \param[in,out] t edge_table_t object reference
+template< class T >
+void pup( PUP::er &p, AMR::edge_table_t< T >& t ) {
+  p | t.get_data();
+  p | t.get_flags();
+  p | t.get_size();
+  p | t.get_ndeleted();
+}
+//! Pack/Unpack serialize operator|
+//! \param[in,out] p Charm++'s PUP::er serializer object reference
+//! \param[in,out] t edge_table_t object reference
+template< class T >
+inline void operator|( PUP::er& p, AMR::edge_table_t< T >& t ) { pup(p,t); }
+//@}
+
 /** @name Charm++ pack/unpack serializer member functions for active_element_store_t */
 ///@{
 //! Pack/Unpack active_element_store_t
@@ -13,17 +13,28 @@
 // *****************************************************************************
 
 #include <numeric>
+#include <algorithm>
+#include <limits>
+#include <set>
+#include <unordered_set>
+#include <fstream>
 
 #include "Partitioner.hpp"
 #include "DerivedData.hpp"
 #include "Reorder.hpp"
+#include "SFCPartition.hpp"
 #include "MeshReader.hpp"
+#include "PrimitiveTable.hpp"
+#include "ExodusIIMeshReader.hpp"
 #include "CGPDE.hpp"
 #include "DGPDE.hpp"
 #include "Inciter/Options/Scheme.hpp"
 #include "UnsMesh.hpp"
 #include "ContainerUtil.hpp"
 #include "Callback.hpp"
+#include "DiagReducer.hpp"
+#include "MemoryReport.hpp"
+#include "SetupReport.hpp"
 
 namespace inciter {
 
@@ -46,7 +57,9 @@ Partitioner::Partitioner(
   const Scheme& scheme,
   const std::map< int, std::vector< std::size_t > >& bface,
   const std::map< int, std::vector< std::size_t > >& faces,
-  const std::map< int, std::vector< std::size_t > >& bnode ) :
+  const std::map< int, std::vector< std::size_t > >& bnode,
+  const std::string& meshcache,
+  bool cached ) :
   m_cbp( cbp ),
   m_cbr( cbr ),
   m_cbs( cbs ),
@@ -68,7 +81,25 @@ Partitioner::Partitioner(
   m_chtriinpoel(),
   m_chbnode(),
   m_bface( bface ),
-  m_bnode( bnode )
+  m_bnode( bnode ),
+  m_sfckey(),
+  m_sfcsorted(),
+  m_sfccum(),
+  m_sfc(),
+  m_export(),
+  m_exportch(),
+  m_exportoff( 0 ),
+  m_meshcache( meshcache ),
+  m_cached( cached ),
+  m_reader(),
+  m_faceid( faces ),
+  m_ntri( 0 ),
+  m_nowntri( 0 ),
+  m_trinodech(),
+  m_tridir(),
+  m_tricand(),
+  m_setupt0( CkWallTimer() ),
+  m_tsetup()
 // *****************************************************************************
 //  Constructor
 //! \param[in] cbp Charm++ callbacks for Partitioner
@@ -82,19 +113,188 @@ Partitioner::Partitioner(
 //! \param[in] bface File-internal elem ids of side sets (whole mesh)
 //! \param[in] faces Elem-relative face ids of side sets (whole mesh)
 //! \param[in] bnode Node lists of side sets (whole mesh)
+//! \param[in] meshcache File name prefix of the partitioned mesh cache, empty
+//!   if not used
+//! \param[in] cached True if the mesh is to be loaded from the partitioned
+//!   mesh cache instead of reading and partitioning it
 // *****************************************************************************
 {
-  // Create mesh reader
-  tk::MeshReader mr( g_inputdeck.get< tag::cmd, tag::io, tag::input >() );
+  // If the mesh is loaded from cache after the number of chares is known, see
+  // partition(), only signal that there is nothing to read
+  if (m_cached) {
+    std::size_t nelem = 0;
+    contribute( sizeof(std::size_t), &nelem, CkReduction::sum_ulong,
+                m_cbp.get< tag::load >() );
+    return;
+  }
+
+  // Create mesh reader, kept until the triangle elements are distributed
+  m_reader = std::make_unique< tk::MeshReader >
+               ( g_inputdeck.get< tag::cmd, tag::io, tag::input >() );
 
-  // Read this compute node's chunk of the mesh (graph and coords) from file
+  // Read this compute node's chunk of the mesh (graph and coords) from file,
+  // without the triangle elements. If the partition is stored in the file,
+  // the chunk consists of the elements assigned to this compute node.
   std::vector< std::size_t > triinpoel;
-  mr.readMeshPart( m_ginpoel, m_inpoel, triinpoel, m_lid, m_coord,
-                   CkNumNodes(), CkMyNode() );
+  m_reader->readMeshPart( m_ginpoel, m_inpoel, triinpoel, m_lid, m_coord,
+                          CkNumNodes(), CkMyNode(), false,
+                          g_inputdeck.get< tag::discr, tag::partfield >() );
+
+  // Read this compute node's chunk of the triangle elements from file and
+  // route them to the compute nodes whose mesh chunk they are faces of
+  auto first =
+    m_reader->readTriangleChunk( triinpoel, CkNumNodes(), CkMyNode() );
+  m_tsetup[ TREAD ] = CkWallTimer() - m_setupt0;
+  routeTriangles( first, triinpoel );
+}
+
+void
+Partitioner::routeTriangles( std::size_t first,
+                             const std::vector< std::size_t >& triinp )
+// *****************************************************************************
+//  Send triangle elements and the nodes of our mesh chunk to be matched
+//! \param[in] first Triangle element id of the first triangle read by this
+//!   compute node
+//! \param[in] triinp Triangle element connectivity of the chunk of triangle
+//!   elements read by this compute node, with global node ids
+//! \details Instead of every compute node reading all triangle elements and
+//!   searching them for the faces of its mesh chunk, the triangle elements
+//!   are read in chunks and matched to the compute nodes in a distributed
+//!   fashion: a triangle element and the global node ids of all mesh chunks
+//!   are sent to the compute node given by the node id hashed, the lowest
+//!   node id for triangles. There, each triangle is forwarded to the compute
+//!   nodes whose mesh chunk contains its lowest node, see bndtri(), which
+//!   then keep the triangles that are faces of their mesh chunk, see
+//!   owntri(). This way the memory and the work of each compute node are
+//!   proportional to its share of the mesh and triangle elements. Each
+//!   compute node sends exactly one message to each compute node (and also to
+//!   itself) in both steps, so counting messages detects if a step is done.
+// *****************************************************************************
+{
+  auto N = static_cast< std::size_t >( CkNumNodes() );
+
+  std::vector< std::vector< std::size_t > > gid( N ), triid( N ), tri( N );
+  for (const auto& n : m_lid) gid[ n.first % N ].push_back( n.first );
+  for (std::size_t t=0; t<triinp.size()/3; ++t) {
+    auto n = std::min( { triinp[t*3+0], triinp[t*3+1], triinp[t*3+2] } );
+    auto d = n % N;
+    triid[d].push_back( first + t );
+    tri[d].push_back( triinp[t*3+0] );
+    tri[d].push_back( triinp[t*3+1] );
+    tri[d].push_back( triinp[t*3+2] );
+  }
+
+  for (std::size_t d=0; d<N; ++d)
+    thisProxy[ static_cast< int >( d ) ].
+      bndtri( CkMyNode(), gid[d], triid[d], tri[d] );
+}
+
+void
+Partitioner::bndtri( int fromnode,
+                     const std::vector< std::size_t >& gid,
+                     const std::vector< std::size_t >& triid,
+                     const std::vector< std::size_t >& triinp )
+// *****************************************************************************
+//  Receive triangle elements and the nodes of a mesh chunk to be matched
+//! \param[in] fromnode Compute node sending the data
+//! \param[in] gid Global node ids of the mesh chunk of fromnode hashed to
+//!   this compute node
+//! \param[in] triid Triangle element ids of the triangles read by fromnode
+//!   hashed to this compute node
+//! \param[in] triinp Triangle element connectivity of triid with global node
+//!   ids
+//! \details Once received from all compute nodes, each triangle is forwarded
+//!   to all compute nodes whose mesh chunk contains the lowest node of the
+//!   triangle: those are the only compute nodes the triangle can be a face
+//!   of the mesh chunk of. See also routeTriangles().
+// *****************************************************************************
+{
+  for (auto g : gid) m_trinodech[ g ].push_back( fromnode );
+  auto& id = m_tridir.first;
+  auto& inp = m_tridir.second;
+  id.insert( end(id), begin(triid), end(triid) );
+  inp.insert( end(inp), begin(triinp), end(triinp) );
+
+  if (++m_ntri < static_cast< std::size_t >( CkNumNodes() )) return;
+
+  auto N = static_cast< std::size_t >( CkNumNodes() );
+  std::vector< std::vector< std::size_t > > candid( N ), cand( N );
+  for (std::size_t t=0; t<id.size(); ++t) {
+    auto n = std::min( { inp[t*3+0], inp[t*3+1], inp[t*3+2] } );
+    auto c = m_trinodech.find( n );
+    if (c == end(m_trinodech)) continue;
+    for (auto d : c->second) {
+      auto k = static_cast< std::size_t >( d );
+      candid[k].push_back( id[t] );
+      cand[k].push_back( inp[t*3+0] );
+      cand[k].push_back( inp[t*3+1] );
+      cand[k].push_back( inp[t*3+2] );
+    }
+  }
+  tk::destroy( m_trinodech );
+  tk::destroy( id );
+  tk::destroy( inp );
+
+  for (std::size_t d=0; d<N; ++d)
+    thisProxy[ static_cast< int >( d ) ].owntri( candid[d], cand[d] );
+}
+
+void
+Partitioner::owntri( const std::vector< std::size_t >& triid,
+                     const std::vector< std::size_t >& triinp )
+// *****************************************************************************
+//  Receive triangle elements that may be faces of our mesh chunk
+//! \param[in] triid Triangle element ids of the triangles whose lowest node
+//!   is in our mesh chunk
+//! \param[in] triinp Triangle element connectivity of triid with global node
+//!   ids
+//! \details Once received from all compute nodes, the triangles that are
+//!   faces of our mesh chunk are passed to the mesh reader, in the order of
+//!   their triangle element ids, and the triangle connectivity of the side
+//!   sets is computed. See also routeTriangles().
+// *****************************************************************************
+{
+  auto& id = m_tricand.first;
+  auto& inp = m_tricand.second;
+  id.insert( end(id), begin(triid), end(triid) );
+  inp.insert( end(inp), begin(triinp), end(triinp) );
+
+  if (++m_nowntri < static_cast< std::size_t >( CkNumNodes() )) return;
+
+  // Generate table of unique faces of our mesh chunk
+  tk::FaceTable faces;
+  faces.reserve( m_ginpoel.size() );
+  for (std::size_t e=0; e<m_ginpoel.size()/4; ++e)
+    for (std::size_t f=0; f<4; ++f) {
+      const auto& tri = tk::expofa[f];
+      faces.insert( {{ m_ginpoel[ e*4+tri[0] ],
+                       m_ginpoel[ e*4+tri[1] ],
+                       m_ginpoel[ e*4+tri[2] ] }} );
+    }
+  faces.finalize();
+
+  // Keep triangles that are faces of our mesh chunk in file order
+  std::vector< std::size_t > order( id.size() );
+  std::iota( begin(order), end(order), 0 );
+  std::sort( begin(order), end(order),
+             [&]( std::size_t a, std::size_t b ){ return id[a] < id[b]; } );
+  std::vector< std::size_t > ownid, triinpoel;
+  for (auto t : order)
+    if (faces.contains( {{ inp[t*3+0], inp[t*3+1], inp[t*3+2] }} )) {
+      ownid.push_back( id[t] );
+      triinpoel.push_back( inp[t*3+0] );
+      triinpoel.push_back( inp[t*3+1] );
+      triinpoel.push_back( inp[t*3+2] );
+    }
+  tk::destroy( id );
+  tk::destroy( inp );
+  m_reader->ownTriangles( ownid );
 
   // Compute triangle connectivity for side sets, reduce boundary face for side
   // sets to this compute node only and to compute-node-local face ids
-  m_triinpoel = mr.triinpoel( m_bface, faces, m_ginpoel, triinpoel );
+  m_triinpoel = m_reader->triinpoel( m_bface, m_faceid, m_ginpoel, triinpoel );
+  m_reader.reset();
+  tk::destroy( m_faceid );
 
   // Reduce boundary node lists (global ids) for side sets to this compute node
   // only
@@ -140,32 +340,214 @@ Partitioner::partition( int nchare )
 //! \param[in] nchare Number of parts the mesh will be partitioned into
 //! \details This function calls the mesh partitioner to partition the mesh. The
 //!   number of partitions equals the number nchare argument which must be no
-//!   lower than the number of compute nodes.
+//!   lower than the number of compute nodes. If the mesh is partitioned
+//!   hierarchically, the mesh partitioner only partitions the mesh across
+//!   compute nodes and the mesh of each compute node is split into its chares
+//!   after distribution, see split(). If the partition across compute nodes
+//!   has been read from the mesh file, partitioning and distribution are
+//!   skipped and the mesh read is only split into the chares.
 // *****************************************************************************
 {
   Assert( nchare >= CkNumNodes(), "Number of chares must not be lower than the "
                                   "number of compute nodes" );
 
-  // Generate element IDs for Zoltan
-  std::vector< long > gelemid( m_ginpoel.size()/4 );
-  std::iota( begin(gelemid), end(gelemid), 0 );
+  // Load the mesh of the chares we own from cache, skipping partitioning and
+  // distribution
+  if (m_cached) {
+    m_nchare = nchare;
+    m_tsetup.fill( -1.0 );      // only reading is timed
+    m_setupt0 = CkWallTimer();
+    readCache();
+    m_tsetup[ TREAD ] = CkWallTimer() - m_setupt0;
+    if (g_inputdeck.get< tag::cmd, tag::feedback >()) {
+      m_host.pepartitioned();
+      m_host.pedistributed();
+    }
+    contribute( m_cbp.get< tag::distributed >() );
+    return;
+  }
+
+  m_setupt0 = CkWallTimer();
+
+  // The mesh read is the mesh of this compute node: assign all of it to our
+  // first chare to be split into our chares, see split()
+  if (!g_inputdeck.get< tag::discr, tag::partfield >().empty()) {
+    m_nchare = nchare;
+    ErrChk( !m_ginpoel.empty(), "The partition read from the mesh file "
+            "assigns no mesh cells to compute node " +
+            std::to_string( CkMyNode() ) );
+    auto first = static_cast< std::size_t >
+                   ( CkMyNode() * distribution( m_nchare )[0] );
+    std::vector< std::size_t > che( m_ginpoel.size()/4, first );
+    for (const auto& [ chid, mesh ] :
+           categorize( che, m_ginpoel, m_bface, m_triinpoel, m_bnode ))
+      own( chid, mesh, coordmap( std::get<0>( mesh ) ) );
+    if (g_inputdeck.get< tag::cmd, tag::feedback >()) m_host.pepartitioned();
+    distributed();
+    return;
+  }
 
   m_nchare = nchare;
   const auto alg = g_inputdeck.get< tag::selected, tag::partitioner >();
-  const auto che = tk::zoltan::geomPartMesh( alg,
-                                             centroids( m_inpoel, m_coord ),
-                                             gelemid,
-                                             nchare );
 
+  // The built-in space-filling curve partitioner needs the bounding box of
+  // the whole mesh first
+  if (alg == tk::ctr::PartitioningAlgorithmType::SFC) {
+    std::vector< tk::real > box( 6 );
+    for (std::size_t d=0; d<3; ++d) {
+      auto mm = std::minmax_element( begin(m_coord[d]), end(m_coord[d]) );
+      auto empty = m_coord[d].empty();
+      box[d] = empty ? -std::numeric_limits< tk::real >::max() : -*mm.first;
+      box[d+3] = empty ? -std::numeric_limits< tk::real >::max() : *mm.second;
+    }
+    contribute( box, CkReduction::max_double,
+                CkCallback(CkReductionTarget(Partitioner,sfcbox), thisProxy) );
+    return;
+  }
+
+  // Generate element IDs for Zoltan, unique across compute nodes without
+  // communication by interleaving them, as required by the connectivity-based
+  // partitioners, which identify the elements adjacent to nodes by their ids
+  std::vector< long > gelemid( m_ginpoel.size()/4 );
+  for (std::size_t e=0; e<gelemid.size(); ++e)
+    gelemid[e] = static_cast< long >( e ) * CkNumNodes() + CkMyNode();
+
+  auto coord = [this]( std::size_t g ){ return nodecoord( g ); };
+  if (tk::ctr::PartitioningAlgorithm().geometric( alg ))
+    partitioned( tk::zoltan::geomPartMesh( alg,
+                                           centroids( m_inpoel, m_coord ),
+                                           gelemid,
+                                           nparts(),
+                                           weights( m_ginpoel, m_bface,
+                                                    m_triinpoel, coord ) ) );
+  else
+    partitioned( tk::zoltan::graphPartMesh( alg,
+                                            centroids( m_inpoel, m_coord ),
+                                            gelemid,
+                                            m_ginpoel,
+                                            nparts(),
+                                            weights( m_ginpoel, m_bface,
+                                                     m_triinpoel, coord ) ) );
+}
+
+bool
+Partitioner::hierarchical() const
+// *****************************************************************************
+//  Query if the mesh is partitioned hierarchically
+//! \return True if the mesh is first partitioned across compute nodes, then
+//!   split into chares within compute nodes, see split()
+//! \details This is also the case if the partition across compute nodes is
+//!   read from the mesh file.
+// *****************************************************************************
+{
+  return (g_inputdeck.get< tag::discr, tag::hierarchical >() &&
+          CkNumNodes() > 1) ||
+         !g_inputdeck.get< tag::discr, tag::partfield >().empty();
+}
+
+int
+Partitioner::nparts() const
+// *****************************************************************************
+//  Return the number of parts the mesh partitioner partitions the mesh into
+//! \return Number of compute nodes if partitioning hierarchically, number of
+//!   chares otherwise
+// *****************************************************************************
+{
+  return hierarchical() ? CkNumNodes() : m_nchare;
+}
+
+void
+Partitioner::partitioned( std::vector< std::size_t >&& che )
+// *****************************************************************************
+//  Categorize and distribute the mesh after mesh partitioning
+//! \param[in] che Part of each mesh element of our mesh chunk
+//! \details If partitioning hierarchically, the parts are compute nodes, and
+//!   all elements of a compute node are first assigned to its first chare,
+//!   then split into its chares after distribution, see split().
+// *****************************************************************************
+{
   if ( g_inputdeck.get< tag::cmd, tag::feedback >() ) m_host.pepartitioned();
 
-  Assert( che.size() == gelemid.size(), "Size of ownership array (chare ID "
-          "of elements) after mesh partitioning does not equal the number of "
-          "mesh graph elements" );
+  // Partitioning time excludes that of computing the centroids
+  auto now = CkWallTimer();
+  m_tsetup[ TPARTITION ] = now - m_setupt0 - m_tsetup[ TCENTROID ];
+  m_setupt0 = now;
+
+  Assert( che.size() == m_ginpoel.size()/4, "Size of ownership array (chare "
+          "ID of elements) after mesh partitioning does not equal the number "
+          "of mesh graph elements" );
+
+  if (hierarchical()) {
+    auto chunksize = static_cast< std::size_t >( distribution( m_nchare )[0] );
+    for (auto& c : che) c *= chunksize;
+  }
 
   // Categorize mesh elements (given by their gobal node IDs) by target chare
   // and distribute to their compute nodes based on mesh partitioning.
-  distribute( categorize( che ) );
+  distribute( categorize( che, m_ginpoel, m_bface, m_triinpoel, m_bnode ) );
+}
+
+void
+Partitioner::sfcbox( [[maybe_unused]] int n, tk::real* box )
+// *****************************************************************************
+//  Start partitioning the mesh along the Hilbert space-filling curve
+//! \param[in] n Size of box, 6
+//! \param[in] box Bounding box of the whole mesh: negative minimum x, y, z,
+//!   followed by maximum x, y, z
+//! \details The Hilbert keys of the cell centroids are computed on a grid over
+//!   the bounding box of the whole mesh so that they are consistent across
+//!   compute nodes. The curve is then cut into nchare pieces of equal weight,
+//!   see weights(), by tk::SFCSplitter via a histogram sort, requiring a
+//!   sum-reduction of the weights below its probe keys per iteration.
+// *****************************************************************************
+{
+  Assert( n == 6, "Size mismatch" );
+
+  std::array< tk::real, 6 > b{{ -box[0], -box[1], -box[2],
+                                 box[3], box[4], box[5] }};
+  m_sfckey = tk::hilbertKeys( centroids( m_inpoel, m_coord ), b );
+  std::tie( m_sfcsorted, m_sfccum ) =
+    tk::sfcCumulate( m_sfckey,
+      weights( m_ginpoel, m_bface, m_triinpoel,
+               [this]( std::size_t g ){ return nodecoord( g ); } ) );
+  m_sfc = tk::SFCSplitter( static_cast< std::size_t >( nparts() ) );
+
+  sfcprobe();
+}
+
+void
+Partitioner::sfcprobe()
+// *****************************************************************************
+//  Contribute the weights of cells below the space-filling curve probe keys
+// *****************************************************************************
+{
+  auto below = tk::sfcWeightBelow( m_sfcsorted, m_sfccum, m_sfc.probes() );
+  contribute( below, CkReduction::sum_double,
+              CkCallback(CkReductionTarget(Partitioner,sfcbelow), thisProxy) );
+}
+
+void
+Partitioner::sfcbelow( int n, tk::real* below )
+// *****************************************************************************
+//  Narrow the space-filling curve splitters, finish partitioning if found
+//! \param[in] n Number of probe keys
+//! \param[in] below Weight of all cells of the whole mesh below the probe keys
+//! \details Since all compute nodes receive the same weights, they update the
+//!   splitters the same way and finish in the same iteration.
+// *****************************************************************************
+{
+  m_sfc.update( std::vector< tk::real >( below, below+n ) );
+  if (!m_sfc.done()) {
+    sfcprobe();
+    return;
+  }
+
+  auto che = tk::sfcPart( m_sfckey, m_sfc.splitters() );
+  tk::destroy( m_sfckey );
+  tk::destroy( m_sfcsorted );
+  tk::destroy( m_sfccum );
+
+  partitioned( std::move(che) );
 }
 
 void
@@ -247,12 +629,25 @@ void
 Partitioner::recvMesh()
 // *****************************************************************************
 //  Acknowledge received mesh chunk and its nodes after mesh refinement
+//! \details If streaming the mesh, each acknowledgment frees a slot for the
+//!   next chunk, see stream().
 // *****************************************************************************
 {
-  if (--m_ndist == 0) {
-    if (g_inputdeck.get< tag::cmd, tag::feedback >()) m_host.pedistributed();
-    contribute( m_cbp.get< tag::distributed >() );
-  }
+  --m_ndist;
+  sendChunk();
+
+  if (m_ndist == 0) distributed();
+}
+
+void
+Partitioner::distributed()
+// *****************************************************************************
+//  Signal that the mesh has been distributed from this compute node
+// *****************************************************************************
+{
+  m_tsetup[ TDISTRIBUTE ] = CkWallTimer() - m_setupt0;
+  if (g_inputdeck.get< tag::cmd, tag::feedback >()) m_host.pedistributed();
+  contribute( m_cbp.get< tag::distributed >() );
 }
 
 void
@@ -261,6 +656,11 @@ Partitioner::refine()
 // Optionally start refining the mesh
 // *****************************************************************************
 {
+  if (!m_cached) {
+    if (hierarchical()) split();
+    if (!m_meshcache.empty()) writeCache();
+  }
+
   auto dist = distribution( m_nchare );
 
   int error = 0;
@@ -290,6 +690,26 @@ Partitioner::refine()
 
   }
 
+  // Account memory of the partitioner and of the mesh of our chares before
+  // the latter is handed to the refiners
+  if (g_inputdeck.get< tag::cmd, tag::feedback >()) {
+    std::array< std::size_t, NUMMEM > b{};
+    b[MPART] = tk::bytes( m_ginpoel, m_coord, m_inpoel, m_lid, m_nface,
+                          m_nodech, m_linnodes, m_bnodechares, m_bface,
+                          m_triinpoel, m_bnode );
+    b[MMESH] = tk::bytes( m_chinpoel, m_chcoordmap, m_chbface, m_chtriinpoel,
+                          m_chbnode );
+    auto stream = serialize( memreport( MDISTRIBUTED, b ) );
+    contribute( stream.first, stream.second.get(), MemMerger,
+      CkCallback( CkIndex_Transporter::memory(nullptr), m_host ) );
+    contribute( setupreport( { { TREAD, m_tsetup[TREAD] },
+                               { TCENTROID, m_tsetup[TCENTROID] },
+                               { TPARTITION, m_tsetup[TPARTITION] },
+                               { TDISTRIBUTE, m_tsetup[TDISTRIBUTE] } } ),
+      CkReduction::max_double,
+      CkCallback( CkReductionTarget(Transporter,setuptime), m_host ) );
+  }
+
   tk::destroy( m_ginpoel );
   tk::destroy( m_coord );
   tk::destroy( m_inpoel );
@@ -323,6 +743,7 @@ Partitioner::centroids( const std::vector< std::size_t >& inpoel,
 {
   Assert( tk::uniquecopy(inpoel).size() == coord[0].size(), "Size mismatch" );
 
+  const auto t0 = CkWallTimer();
   const auto& x = coord[0];
   const auto& y = coord[1];
   const auto& z = coord[2];
@@ -348,35 +769,178 @@ Partitioner::centroids( const std::vector< std::size_t >& inpoel,
     cz[e] = (z[A] + z[B] + z[C] + z[D]) / 4.0;
   }
 
+  m_tsetup[ TCENTROID ] += CkWallTimer() - t0;
   return cent;
 }
 
+std::vector< tk::real >
+Partitioner::weights(
+  const std::vector< std::size_t >& ginpoel,
+  const std::map< int, std::vector< std::size_t > >& bface,
+  const std::vector< std::size_t >& triinpoel,
+  const CoordFn& coord ) const
+// *****************************************************************************
+//  Estimate the computational cost of elements as partitioning weights
+//! \param[in] ginpoel Mesh connectivity with global node ids
+//! \param[in] bface Boundary face ids associated to side set ids
+//! \param[in] triinpoel Boundary face connectivity with global node ids
+//! \param[in] coord Function returning the coordinates of a node given by its
+//!   global id, only called if the weights account for initial refinement
+//! \return Element weights for all cells of the mesh given, empty if the
+//!   cells are to be weighted equally
+//! \details The cost of a cell is estimated as unity plus the cost configured
+//!   by the user per boundary face of the cell, as boundary conditions (and,
+//!   for DG, the boundary-face integrals) make cells with faces on side sets
+//!   more expensive than those in the interior. If configured, this is
+//!   multiplied by the number of cells the cell is predicted to be refined
+//!   into by initial mesh refinement, see t0refFactors().
+// *****************************************************************************
+{
+  const auto bw = g_inputdeck.get< tag::discr, tag::bfaceweight >();
+  auto r = t0refFactors( ginpoel, coord );
+  if (bw < std::numeric_limits< tk::real >::epsilon()) return r;
+
+  using Face = tk::UnsMesh::Face;
+
+  std::unordered_set< Face, tk::UnsMesh::Hash<3>, tk::UnsMesh::Eq<3> > bf;
+  for (const auto& [ setid, faceids ] : bface)
+    for (auto f : faceids)
+      bf.insert( {{ triinpoel[f*3+0], triinpoel[f*3+1],
+                    triinpoel[f*3+2] }} );
+
+  std::vector< tk::real > w( ginpoel.size()/4, 1.0 );
+  if (!bf.empty())
+    for (std::size_t e=0; e<w.size(); ++e) {
+      tk::UnsMesh::Tet t{{ ginpoel[e*4+0], ginpoel[e*4+1],
+                           ginpoel[e*4+2], ginpoel[e*4+3] }};
+      std::array<Face,4> face{{ {{t[0],t[2],t[1]}}, {{t[0],t[1],t[3]}},
+                                {{t[0],t[3],t[2]}}, {{t[1],t[2],t[3]}} }};
+      for (const auto& f : face) if (bf.find(f) != end(bf)) w[e] += bw;
+    }
+
+  for (std::size_t e=0; e<r.size(); ++e) w[e] *= r[e];
+
+  return w;
+}
+
+std::vector< tk::real >
+Partitioner::t0refFactors( const std::vector< std::size_t >& ginpoel,
+                           const CoordFn& coord ) const
+// *****************************************************************************
+//  Predict the number of elements each element is refined into at t<0
+//! \param[in] ginpoel Mesh connectivity with global node ids
+//! \param[in] coord Function returning the coordinates of a node given by its
+//!   global id
+//! \return Predicted number of elements each element of ginpoel is refined
+//!   into by the initial mesh refinement steps configured, empty if initial
+//!   refinement is not configured to weight the partition
+//! \details The initial refinement steps are evaluated on the coarse mesh,
+//!   each multiplying the predicted number of children of a cell by 8 for
+//!   uniform refinement, and, for edge-list and coordinate-based refinement,
+//!   by the number of children given by the refinement pattern of the edges
+//!   of the cell tagged: 2 for a single edge, 4 for edges of a single face,
+//!   8 otherwise. This ignores the refinement of additional edges to keep
+//!   the mesh conforming, and assumes that the children of a cell tagged by
+//!   coordinates are tagged again by subsequent steps, as they lie in the
+//!   same region. Uniform refinement followed by derefinement and
+//!   refinement based on the initial conditions are taken to leave the
+//!   number of cells unchanged.
+// *****************************************************************************
+{
+  if (!g_inputdeck.get< tag::amr, tag::t0ref >() ||
+      !g_inputdeck.get< tag::amr, tag::t0refweight >()) return {};
+
+  using inciter::ctr::AMRInitialType;
+  const auto& init = g_inputdeck.get< tag::amr, tag::init >();
+  const auto hw = Refiner::halfworld();
+  const auto coordref =
+    std::find( begin(init), end(init), AMRInitialType::COORDINATES ) !=
+      end(init) &&
+    std::any_of( begin(hw), end(hw), []( const auto& h ){ return h.first; } );
+
+  // Edges given by the user, with ordered end-points
+  std::set< std::pair< std::size_t, std::size_t > > useredges;
+  const auto& edgelist = g_inputdeck.get< tag::amr, tag::edge >();
+  for (std::size_t i=0; i<edgelist.size()/2; ++i)
+    useredges.insert( std::minmax( edgelist[i*2+0], edgelist[i*2+1] ) );
+
+  // Number of children given the edges of a cell tagged
+  auto children = []( const std::array< bool, 6 >& t ){
+    std::set< std::size_t > n;
+    std::size_t ne = 0;
+    for (std::size_t i=0; i<6; ++i)
+      if (t[i]) {
+        ++ne;
+        n.insert( tk::lpoed[i][0] );
+        n.insert( tk::lpoed[i][1] );
+      }
+    if (ne == 0) return 1.0;
+    if (ne == 1) return 2.0;
+    return n.size() == 3 ? 4.0 : 8.0;
+  };
+
+  std::vector< tk::real > r( ginpoel.size()/4, 1.0 );
+  for (std::size_t e=0; e<r.size(); ++e) {
+    std::array< std::array< tk::real, 3 >, 4 > x;
+    if (coordref)
+      for (std::size_t i=0; i<4; ++i) x[i] = coord( ginpoel[e*4+i] );
+    for (auto s : init) {
+      if (s == AMRInitialType::UNIFORM) {
+        r[e] *= 8.0;
+      } else if (s == AMRInitialType::EDGELIST) {
+        std::array< bool, 6 > t;
+        for (std::size_t i=0; i<6; ++i)
+          t[i] = useredges.count( std::minmax( ginpoel[e*4+tk::lpoed[i][0]],
+                                               ginpoel[e*4+tk::lpoed[i][1]] ) );
+        r[e] *= children( t );
+      } else if (s == AMRInitialType::COORDINATES && coordref) {
+        std::array< bool, 6 > t;
+        for (std::size_t i=0; i<6; ++i)
+          t[i] = Refiner::halfworldTag( hw, x[ tk::lpoed[i][0] ],
+                                            x[ tk::lpoed[i][1] ] );
+        r[e] *= children( t );
+      }
+    }
+  }
+
+  return r;
+}
+
 std::unordered_map< int, Partitioner::MeshData >
-Partitioner::categorize( const std::vector< std::size_t >& target ) const
+Partitioner::categorize(
+  const std::vector< std::size_t >& target,
+  const std::vector< std::size_t >& ginpoel,
+  const std::map< int, std::vector< std::size_t > >& bface,
+  const std::vector< std::size_t >& triinpoel,
+  const std::map< int, std::vector< std::size_t > >& bnode ) const
 // *****************************************************************************
 // Categorize mesh data by target
 //! \param[in] target Target chares of mesh elements, size: number of
 //!   elements in the chunk of the mesh graph on this compute node.
+//! \param[in] ginpoel Mesh connectivity with global node ids
+//! \param[in] bface Boundary face ids associated to side set ids
+//! \param[in] triinpoel Boundary face connectivity with global node ids
+//! \param[in] bnode Boundary node lists (global ids) of side sets
 //! \return Vector of global mesh node ids connecting elements owned by each
 //!   target chare.
 // *****************************************************************************
 {
-  Assert( target.size() == m_ginpoel.size()/4, "Size mismatch");
+  Assert( target.size() == ginpoel.size()/4, "Size mismatch");
 
   using Face = tk::UnsMesh::Face;
 
   // Build hash map associating side set id to boundary faces
   std::unordered_map< Face, int,
                       tk::UnsMesh::Hash<3>, tk::UnsMesh::Eq<3> > faceside;
-  for (const auto& [ setid, faceids ] : m_bface)
+  for (const auto& [ setid, faceids ] : bface)
     for (auto f : faceids)
-      faceside[ {{ m_triinpoel[f*3+0],
-                   m_triinpoel[f*3+1],
-                   m_triinpoel[f*3+2] }} ] = setid;
+      faceside[ {{ triinpoel[f*3+0],
+                   triinpoel[f*3+1],
+                   triinpoel[f*3+2] }} ] = setid;
 
   // Build hash map associating side set ids to boundary nodes
   std::unordered_map< std::size_t, std::unordered_set< int > > nodeside;
-  for (const auto& [ setid, nodes ] : m_bnode)
+  for (const auto& [ setid, nodes ] : bnode)
     for (auto n : nodes)
       nodeside[ n ].insert( setid );
 
@@ -385,8 +949,8 @@ Partitioner::categorize( const std::vector< std::size_t >& target ) const
   std::unordered_map< int, MeshData > chmesh;
   for (std::size_t e=0; e<target.size(); ++e) {
     // Construct a tetrahedron with global node ids
-    tk::UnsMesh::Tet t{{ m_ginpoel[e*4+0], m_ginpoel[e*4+1],
-                         m_ginpoel[e*4+2], m_ginpoel[e*4+3] }};
+    tk::UnsMesh::Tet t{{ ginpoel[e*4+0], ginpoel[e*4+1],
+                         ginpoel[e*4+2], ginpoel[e*4+3] }};
     // Categorize tetrahedron (domain element) connectivity
     auto& mesh = chmesh[ static_cast<int>(target[e]) ];
     auto& inpoel = std::get< 0 >( mesh );
@@ -403,12 +967,12 @@ Partitioner::categorize( const std::vector< std::size_t >& target ) const
       }
     }
     // Categorize boundary node lists
-    auto& bnode = std::get< 2 >( mesh );
+    auto& bnodes = std::get< 2 >( mesh );
     for (const auto& n : t) {
       auto it = nodeside.find( n );
       if (it != end(nodeside))
         for (auto s : it->second)
-          bnode[ s ].push_back( n );
+          bnodes[ s ].push_back( n );
     }
   }
 
@@ -481,41 +1045,20 @@ Partitioner::distribute( std::unordered_map< int, MeshData >&& mesh )
     auto chid = CkMyNode() * dist[0] + c; // compute owned chare ID
     const auto it = mesh.find( chid );    // attempt to find its mesh data
     if (it != end(mesh)) {                // if found
-      // Store own tetrahedron connectivity
-      const auto& inpoel = std::get<0>( it->second );
-      auto& inp = m_chinpoel[ chid ];     // will store own mesh connectivity
-      inp.insert( end(inp), begin(inpoel), end(inpoel) );
-      // Store own node coordinates
-      auto& chcm = m_chcoordmap[ chid ];  // will store own node coordinates
-      auto cm = coordmap( inpoel );       // extract node coordinates 
-      chcm.insert( begin(cm), end(cm) );  // concatenate node coords
-      // Store own boundary face connectivity
-      const auto& bconn = std::get<1>( it->second );
-      auto& bface = m_chbface[ chid ];    // will store own boundary faces
-      auto& t = m_chtriinpoel[ chid ];    // wil store own boundary face conn
-      auto& f = m_nface[ chid ];          // use counter for chare
-      for (const auto& [ setid, faceids ] : bconn) {
-        auto& b = bface[ setid ];
-        for (std::size_t i=0; i<faceids.size()/3; ++i) {
-          b.push_back( f++ );
-          t.push_back( faceids[i*3+0] );
-          t.push_back( faceids[i*3+1] );
-          t.push_back( faceids[i*3+2] );
-        }
-      }
-      // Store own boundary node lists
-      const auto& bnode = std::get<2>( it->second );
-      auto& nodes = m_chbnode[ chid ];    // will store own boundary nodes
-      for (const auto& [ setid, nodeids ] : bnode) {
-        auto& b = nodes[ setid ];
-        b.insert( end(b), begin(nodeids), end(nodeids) );
-      }
+      // Store own mesh data with node coordinates extracted
+      own( chid, it->second, coordmap( std::get<0>( it->second ) ) );
       // Remove chare ID and mesh data
       mesh.erase( it );
     }
     Assert( mesh.find(chid) == end(mesh), "Not all owned mesh data stored" );
   }
 
+  // Optionally stream mesh we do not own in chunks of bounded size
+  if (g_inputdeck.get< tag::discr, tag::distchunk >() > 0) {
+    stream( std::move(mesh) );
+    return;
+  }
+
   // Construct export map associating mesh connectivities with global node
   // indices and node coordinates for mesh chunks associated to chare IDs
   // owned by chares we do not own.
@@ -541,8 +1084,7 @@ Partitioner::distribute( std::unordered_map< int, MeshData >&& mesh )
 
   // Export chare IDs and mesh we do not own to fellow compute nodes
   if (exp.empty()) {
-    if ( g_inputdeck.get< tag::cmd, tag::feedback >() ) m_host.pedistributed();
-    contribute( m_cbp.get< tag::distributed >() );
+    distributed();
   } else {
      m_ndist += exp.size();
      for (const auto& [ targetchare, chunk ] : exp)
@@ -550,6 +1092,282 @@ Partitioner::distribute( std::unordered_map< int, MeshData >&& mesh )
   }
 }
 
+void
+Partitioner::stream( std::unordered_map< int, MeshData >&& mesh )
+// *****************************************************************************
+// Start streaming mesh to target compute nodes in bounded chunks
+//! \param[in] mesh Mesh data categorized by target chares we do not own
+//! \details Instead of a single message per target compute node containing
+//!   the mesh of all of its chares, the mesh is sent in chunks of at most
+//!   dist_chunk cells, with at most a few chunks in flight at a time: a new
+//!   chunk is only sent after a previous one has been acknowledged, see
+//!   recvMesh(). Thus the transient memory required on both the send and
+//!   receive sides is bounded by the size of the chunks in flight on top of
+//!   the mesh chunk read. The coordinates of a chunk are only extracted when
+//!   it is sent. To avoid all compute nodes sending to the same compute node
+//!   at the same time, compute nodes start streaming to their next compute
+//!   node.
+// *****************************************************************************
+{
+  // Number of chunks in flight per compute node
+  const std::size_t window = 2;
+
+  m_export = std::move( mesh );
+  m_exportoff = 0;
+  m_exportch.clear();
+  for (const auto& c : m_export) m_exportch.push_back( c.first );
+
+  // Stagger streaming: order chare ids by the distance of their compute node
+  // to ours, farthest first, because the stream is consumed from the back
+  auto n = CkNumNodes();
+  auto dist = [&]( int c ){ return (node(c) - CkMyNode() + n) % n; };
+  std::sort( begin(m_exportch), end(m_exportch),
+    [&]( int a, int b ){ return std::make_pair( dist(a), a ) >
+                                std::make_pair( dist(b), b ); } );
+
+  // Nothing to export: done
+  if (m_exportch.empty()) {
+    distributed();
+    return;
+  }
+
+  for (std::size_t i=0; i<window; ++i) sendChunk();
+}
+
+bool
+Partitioner::sendChunk()
+// *****************************************************************************
+// Send the next chunk of mesh streamed to target compute nodes
+//! \return True if a chunk was sent, false if there was nothing left to send
+//! \details The boundary face connectivity and node lists of a chare are sent
+//!   with its first chunk, since they are only concatenated on the receive
+//!   side, see addMesh().
+// *****************************************************************************
+{
+  if (m_exportch.empty()) return false;
+
+  auto chid = m_exportch.back();
+  auto& [ inpoel, bface, bnode ] = tk::ref_find( m_export, chid );
+
+  auto nelem = inpoel.size()/4;
+  auto chunk = g_inputdeck.get< tag::discr, tag::distchunk >();
+  auto e = std::min( m_exportoff + chunk, nelem );
+  std::vector< std::size_t > piece;
+  piece.reserve( (e - m_exportoff)*4 );
+  for (auto i=m_exportoff*4; i<e*4; ++i) piece.push_back( inpoel[i] );
+
+  std::unordered_map< int,
+    std::tuple< std::vector< std::size_t >,
+                tk::UnsMesh::CoordMap,
+                std::unordered_map< int, std::vector< std::size_t > >,
+                std::unordered_map< int, std::vector< std::size_t > > > > exp;
+  auto& [ t, cm, bf, bn ] = exp[ chid ];
+  cm = coordmap( piece );
+  t = std::move( piece );
+  if (m_exportoff == 0) {
+    bf = std::move( bface );
+    bn = std::move( bnode );
+  }
+
+  ++m_ndist;
+  thisProxy[ node(chid) ].addMesh( CkMyNode(), exp );
+
+  if (e == nelem) {
+    m_export.erase( chid );
+    m_exportch.pop_back();
+    m_exportoff = 0;
+  } else {
+    m_exportoff = e;
+  }
+
+  return true;
+}
+
+void
+Partitioner::own( int chid,
+                  const MeshData& mesh,
+                  const tk::UnsMesh::CoordMap& cm )
+// *****************************************************************************
+// Store mesh data of a chare we own
+//! \param[in] chid Chare id
+//! \param[in] mesh Mesh data categorized for the chare
+//! \param[in] cm Coordinates of the nodes of the chare's mesh
+// *****************************************************************************
+{
+  // Store own tetrahedron connectivity
+  const auto& inpoel = std::get<0>( mesh );
+  auto& inp = m_chinpoel[ chid ];     // will store own mesh connectivity
+  inp.insert( end(inp), begin(inpoel), end(inpoel) );
+  // Store own node coordinates
+  auto& chcm = m_chcoordmap[ chid ];  // will store own node coordinates
+  chcm.insert( begin(cm), end(cm) );  // concatenate node coords
+  // Store own boundary face connectivity
+  const auto& bconn = std::get<1>( mesh );
+  auto& bface = m_chbface[ chid ];    // will store own boundary faces
+  auto& t = m_chtriinpoel[ chid ];    // wil store own boundary face conn
+  auto& f = m_nface[ chid ];          // use counter for chare
+  for (const auto& [ setid, faceids ] : bconn) {
+    auto& b = bface[ setid ];
+    for (std::size_t i=0; i<faceids.size()/3; ++i) {
+      b.push_back( f++ );
+      t.push_back( faceids[i*3+0] );
+      t.push_back( faceids[i*3+1] );
+      t.push_back( faceids[i*3+2] );
+    }
+  }
+  // Store own boundary node lists
+  const auto& bnode = std::get<2>( mesh );
+  auto& nodes = m_chbnode[ chid ];    // will store own boundary nodes
+  for (const auto& [ setid, nodeids ] : bnode) {
+    auto& b = nodes[ setid ];
+    b.insert( end(b), begin(nodeids), end(nodeids) );
+  }
+}
+
+void
+Partitioner::split()
+// *****************************************************************************
+// Split the mesh of this compute node into its chares
+//! \details When partitioning hierarchically, all mesh elements of a compute
+//!   node have been assigned to its first chare by the mesh partitioner, see
+//!   partitioned(). Here they are split into all chares of the compute node
+//!   along the Hilbert space-filling curve, locally, i.e., without
+//!   communication, into parts of equal weight, see weights().
+// *****************************************************************************
+{
+  auto dist = distribution( m_nchare );
+  auto first = CkMyNode() * dist[0];
+
+  auto it = m_chinpoel.find( first );
+  if (dist[1] < 2 || it == end(m_chinpoel)) return;
+
+  // Take over the mesh data of the compute node, stored for its first chare
+  auto ginpoel = std::move( it->second );
+  auto cm = std::move( m_chcoordmap[first] );
+  auto bface = std::move( m_chbface[first] );
+  auto triinpoel = std::move( m_chtriinpoel[first] );
+  auto bnode = std::move( m_chbnode[first] );
+  m_chinpoel.erase( first );
+  m_chcoordmap.erase( first );
+  m_chbface.erase( first );
+  m_chtriinpoel.erase( first );
+  m_chbnode.erase( first );
+  m_nface.erase( first );
+
+  // Compute element centroids and their Hilbert keys
+  auto nelem = ginpoel.size()/4;
+  std::array< std::vector< tk::real >, 3 > cent;
+  for (auto& c : cent) c.resize( nelem, 0.0 );
+  for (std::size_t e=0; e<nelem; ++e)
+    for (std::size_t i=0; i<4; ++i) {
+      const auto& x = tk::cref_find( cm, ginpoel[e*4+i] );
+      for (std::size_t d=0; d<3; ++d) cent[d][e] += x[d] / 4.0;
+    }
+  std::array< tk::real, 6 > box;
+  for (std::size_t d=0; d<3; ++d) {
+    auto mm = std::minmax_element( begin(cent[d]), end(cent[d]) );
+    box[d] = *mm.first;
+    box[d+3] = *mm.second;
+  }
+  auto key = tk::hilbertKeys( cent, box );
+
+  // Cut the curve into equal-weight parts: same as partitioning along the
+  // curve across compute nodes, see sfcbox(), but with a single caller
+  auto [ sorted, cum ] =
+    tk::sfcCumulate( key,
+      weights( ginpoel, bface, triinpoel,
+               [&]( std::size_t g ){ return tk::cref_find( cm, g ); } ) );
+  tk::SFCSplitter sfc( static_cast< std::size_t >( dist[1] ) );
+  while (!sfc.done())
+    sfc.update( tk::sfcWeightBelow( sorted, cum, sfc.probes() ) );
+  auto che = tk::sfcPart( key, sfc.splitters() );
+  for (auto& c : che) c += static_cast< std::size_t >( first );
+
+  // Categorize mesh data by chares and store them as own
+  for (const auto& [ chid, mesh ] :
+         categorize( che, ginpoel, bface, triinpoel, bnode ))
+  {
+    tk::UnsMesh::CoordMap chcm;
+    for (auto g : tk::uniquecopy( std::get<0>( mesh ) ))
+      chcm[g] = tk::cref_find( cm, g );
+    own( chid, mesh, chcm );
+  }
+}
+
+std::string
+Partitioner::cachefile( int chid ) const
+// *****************************************************************************
+//  Return the file name of the partitioned mesh cache of a chare
+//! \param[in] chid Chare id
+//! \return File name of the mesh of the chare in the partitioned mesh cache
+// *****************************************************************************
+{
+  return m_meshcache + '.' + std::to_string( chid );
+}
+
+void
+Partitioner::writeCache()
+// *****************************************************************************
+//  Write the mesh of the chares we own to the partitioned mesh cache
+//! \details The mesh data of each chare, as passed to its mesh refiner, is
+//!   serialized with Charm++'s PUP framework into a binary file of its own.
+//!   The host writes the meta file once all compute nodes are done, so a cache
+//!   with a meta file is complete.
+// *****************************************************************************
+{
+  for (const auto& c : m_chinpoel) {
+    auto chid = c.first;
+    auto serialize = [&]( PUP::er& p ) {
+      p | m_nchare;
+      p | m_chinpoel.at( chid );
+      p | m_chcoordmap.at( chid );
+      p | m_chbface.at( chid );
+      p | m_chtriinpoel.at( chid );
+      p | m_chbnode.at( chid );
+    };
+    PUP::sizer sizer;
+    serialize( sizer );
+    std::vector< char > buf( sizer.size() );
+    PUP::toMem packer( buf.data() );
+    serialize( packer );
+    auto filename = cachefile( chid );
+    std::ofstream f( filename, std::ios::binary );
+    f.write( buf.data(), static_cast< std::streamsize >( buf.size() ) );
+    ErrChk( f.good(), "Failed to write file: " + filename );
+  }
+}
+
+void
+Partitioner::readCache()
+// *****************************************************************************
+//  Load the mesh of the chares we own from the partitioned mesh cache
+//! \details Each file is read in a single binary read and deserialized
+//!   directly into the mesh data passed to the mesh refiners, see refine().
+// *****************************************************************************
+{
+  auto dist = distribution( m_nchare );
+  for (int c=0; c<dist[1]; ++c) {
+    auto chid = CkMyNode() * dist[0] + c;
+    auto filename = cachefile( chid );
+    std::ifstream f( filename, std::ios::binary | std::ios::ate );
+    ErrChk( f.good(), "Failed to open file: " + filename );
+    std::vector< char > buf( static_cast< std::size_t >( f.tellg() ) );
+    f.seekg( 0 );
+    f.read( buf.data(), static_cast< std::streamsize >( buf.size() ) );
+    ErrChk( f.good(), "Failed to read file: " + filename );
+    int nchare = 0;
+    PUP::fromMem unpacker( buf.data() );
+    unpacker | nchare;
+    unpacker | m_chinpoel[ chid ];
+    unpacker | m_chcoordmap[ chid ];
+    unpacker | m_chbface[ chid ];
+    unpacker | m_chtriinpoel[ chid ];
+    unpacker | m_chbnode[ chid ];
+    ErrChk( nchare == m_nchare, "Number of chares in partitioned mesh cache "
+            "file " + filename + " differs from the number of chares" );
+  }
+}
+
 std::array< int, 2 >
 Partitioner::distribution( int npart ) const
 // *****************************************************************************
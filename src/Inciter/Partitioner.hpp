@@ -15,10 +15,14 @@
 #define Partitioner_h
 
 #include <array>
+#include <string>
+#include <memory>
+#include <functional>
 #include <stddef.h>
 
 #include "ContainerUtil.hpp"
 #include "ZoltanInterOp.hpp"
+#include "SFCPartition.hpp"
 #include "Inciter/InputDeck/InputDeck.hpp"
 #include "Options/PartitioningAlgorithm.hpp"
 #include "DerivedData.hpp"
@@ -27,6 +31,8 @@
 #include "Sorter.hpp"
 #include "Refiner.hpp"
 #include "Callback.hpp"
+#include "MeshReader.hpp"
+#include "SetupReport.hpp"
 
 #include "NoWarning/partitioner.decl.h"
 
@@ -65,7 +71,9 @@ class Partitioner : public CBase_Partitioner {
                  const Scheme& scheme,
                  const std::map< int, std::vector< std::size_t > >& bface,
                  const std::map< int, std::vector< std::size_t > >& faces,
-                 const std::map< int, std::vector< std::size_t > >& bnode );
+                 const std::map< int, std::vector< std::size_t > >& bnode,
+                 const std::string& meshcache,
+                 bool cached );
 
     #if defined(__clang__)
       #pragma clang diagnostic push
@@ -80,6 +88,22 @@ class Partitioner : public CBase_Partitioner {
     //! Partition the computational mesh into a number of chares
     void partition( int nchare );
 
+    //! Start partitioning the mesh along the Hilbert space-filling curve
+    void sfcbox( int n, tk::real* box );
+
+    //! Narrow the space-filling curve splitters, finish partitioning if found
+    void sfcbelow( int n, tk::real* below );
+
+    //! Receive triangle elements and the nodes of a mesh chunk to be matched
+    void bndtri( int fromnode,
+                 const std::vector< std::size_t >& gid,
+                 const std::vector< std::size_t >& triid,
+                 const std::vector< std::size_t >& triinp );
+
+    //! Receive triangle elements that may be faces of our mesh chunk
+    void owntri( const std::vector< std::size_t >& triid,
+                 const std::vector< std::size_t >& triinp );
+
     //! Receive mesh associated to chares we own after refinement
     void addMesh( int fromnode,
                   const std::unordered_map< int,
@@ -129,6 +153,15 @@ class Partitioner : public CBase_Partitioner {
       p | m_bface;
       p | m_triinpoel;
       p | m_bnode;
+      p | m_sfckey;
+      p | m_sfcsorted;
+      p | m_sfccum;
+      p | m_sfc;
+      p | m_export;
+      p | m_exportch;
+      p | m_exportoff;
+      p | m_meshcache;
+      p | m_cached;
     }
     //! \brief Pack/Unpack serialize operator|
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
@@ -200,15 +233,112 @@ class Partitioner : public CBase_Partitioner {
     std::vector< std::size_t > m_triinpoel;
     //! List of boundary nodes associated to side-set IDs
     std::map< int, std::vector< std::size_t > > m_bnode;
+    //! Hilbert keys of the cells of our mesh chunk
+    std::vector< std::uint64_t > m_sfckey;
+    //! Hilbert keys of the cells of our mesh chunk in ascending order
+    std::vector< std::uint64_t > m_sfcsorted;
+    //! Cumulative weights of the cells in the order of m_sfcsorted
+    std::vector< tk::real > m_sfccum;
+    //! Space-filling curve splitters, same on all compute nodes
+    tk::SFCSplitter m_sfc;
+    //! Mesh data of chares we do not own yet to be streamed to their nodes
+    std::unordered_map< int, MeshData > m_export;
+    //! Chare ids of m_export in reverse order of streaming
+    std::vector< int > m_exportch;
+    //! Number of cells of the last chare of m_exportch already streamed
+    std::size_t m_exportoff;
+    //! File name prefix of the partitioned mesh cache, empty if not used
+    std::string m_meshcache;
+    //! True if the chares' mesh is loaded from the partitioned mesh cache
+    bool m_cached;
+    //! \brief Mesh reader, kept only until the triangle elements are
+    //!   distributed across compute nodes
+    //! \details This and the data below used to distribute the triangle
+    //!   elements are not migrated: they are only used while reading the
+    //!   mesh, before checkpointing is possible.
+    std::unique_ptr< tk::MeshReader > m_reader;
+    //! Elem-relative face ids of side sets (whole mesh)
+    std::map< int, std::vector< std::size_t > > m_faceid;
+    //! Counter of compute nodes whose triangles and nodes have been received
+    std::size_t m_ntri;
+    //! Counter of compute nodes whose triangles matched have been received
+    std::size_t m_nowntri;
+    //! \brief Compute nodes (value) whose mesh chunk contains global mesh node
+    //!   ids (key) hashed to this compute node
+    std::unordered_map< std::size_t, std::vector< int > > m_trinodech;
+    //! Triangle element ids and connectivity hashed to this compute node
+    std::pair< std::vector< std::size_t >, std::vector< std::size_t > >
+      m_tridir;
+    //! \brief Triangle element ids and connectivity of the triangles that may
+    //!   be faces of our mesh chunk
+    std::pair< std::vector< std::size_t >, std::vector< std::size_t > >
+      m_tricand;
+    //! Wall-clock time stamp at the start of the current setup phase
+    tk::real m_setupt0;
+    //! \brief Wall-clock times of the setup phases performed by the
+    //!   partitioner, see SetupReport.hpp, not migrated either
+    std::array< tk::real, TREFINE > m_tsetup;
 
     //! Compute element centroid coordinates
     std::array< std::vector< tk::real >, 3 >
     centroids( const std::vector< std::size_t >& inpoel,
                const tk::UnsMesh::Coords& coord );
 
+    //! Contribute the weights of cells below the space-filling curve probes
+    void sfcprobe();
+
+    //! Send triangle elements and the nodes of our mesh chunk to be matched
+    void routeTriangles( std::size_t first,
+                         const std::vector< std::size_t >& triinp );
+
+    //! Coordinates of a mesh node given by its global id
+    using CoordFn = std::function< std::array< tk::real, 3 >( std::size_t ) >;
+
+    //! Estimate the computational cost of elements as partitioning weights
+    std::vector< tk::real >
+    weights( const std::vector< std::size_t >& ginpoel,
+             const std::map< int, std::vector< std::size_t > >& bface,
+             const std::vector< std::size_t >& triinpoel,
+             const CoordFn& coord ) const;
+
+    //! Predict the number of elements each element is refined into at t<0
+    std::vector< tk::real >
+    t0refFactors( const std::vector< std::size_t >& ginpoel,
+                  const CoordFn& coord ) const;
+
+    //! Coordinates of a node of the mesh chunk read by this compute node
+    //! \param[in] g Global node id
+    //! \return Node coordinates
+    std::array< tk::real, 3 > nodecoord( std::size_t g ) const {
+      auto i = tk::cref_find( m_lid, g );
+      return {{ m_coord[0][i], m_coord[1][i], m_coord[2][i] }};
+    }
+
+    //! Query if the mesh is partitioned hierarchically
+    bool hierarchical() const;
+
+    //! Return the number of parts the mesh partitioner partitions the mesh into
+    int nparts() const;
+
+    //! Categorize and distribute the mesh after mesh partitioning
+    void partitioned( std::vector< std::size_t >&& che );
+
     //!  Categorize mesh elements (given by their gobal node IDs) by target
     std::unordered_map< int, MeshData >
-    categorize( const std::vector< std::size_t >& che ) const;
+    categorize( const std::vector< std::size_t >& che,
+                const std::vector< std::size_t >& ginpoel,
+                const std::map< int, std::vector< std::size_t > >& bface,
+                const std::vector< std::size_t >& triinpoel,
+                const std::map< int, std::vector< std::size_t > >& bnode )
+    const;
+
+    //! Store mesh data of a chare we own
+    void own( int chid,
+              const MeshData& mesh,
+              const tk::UnsMesh::CoordMap& cm );
+
+    //! Split the mesh of this compute node into its chares
+    void split();
 
     //! Extract coordinates associated to global nodes of a mesh chunk
     tk::UnsMesh::CoordMap coordmap( const std::vector< std::size_t >& inpoel );
@@ -216,6 +346,24 @@ class Partitioner : public CBase_Partitioner {
     //! Distribute mesh to target compute nodes after mesh partitioning
     void distribute( std::unordered_map< int, MeshData >&& mesh );
 
+    //! Start streaming mesh to target compute nodes in bounded chunks
+    void stream( std::unordered_map< int, MeshData >&& mesh );
+
+    //! Send the next chunk of mesh streamed to target compute nodes
+    bool sendChunk();
+
+    //! Signal that the mesh has been distributed from this compute node
+    void distributed();
+
+    //! Return the file name of the partitioned mesh cache of a chare
+    std::string cachefile( int chid ) const;
+
+    //! Write the mesh of the chares we own to the partitioned mesh cache
+    void writeCache();
+
+    //! Load the mesh of the chares we own from the partitioned mesh cache
+    void readCache();
+
     //! Compute chare (partition) distribution across compute nodes
     std::array< int, 2 > distribution( int npart ) const;
 
@@ -0,0 +1,155 @@
+// *****************************************************************************
+/*!
+  \file      src/Inciter/PhaseTimer.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Wall-clock timers of the phases of a time step
+  \details   Wall-clock timers of the phases of a time step. A worker chare
+    switches its timer to the phase it enters at the start of each SDAG stage,
+    e.g., computing the right-hand side, and to the WAIT phase after sending
+    its partial results to other chares, so the time between two switches is
+    accumulated in the phase left. Since the timers measure wall-clock time,
+    WAIT includes the time the PE spends executing other chares, while the
+    chare waits for messages.
+*/
+// *****************************************************************************
+#ifndef PhaseTimer_h
+#define PhaseTimer_h
+
+#include <array>
+#include <vector>
+#include <chrono>
+#include <numeric>
+#include <algorithm>
+
+#include "Types.hpp"
+#include "PUPUtil.hpp"
+
+namespace inciter {
+
+//! Phases of a time step
+enum Phase : std::size_t { OTHER=0,     //!< Everything not timed separately
+                           LHS,         //!< Left-hand side
+                           GRAD,        //!< Gradients, reconstruction, limiting
+                           RHS,         //!< Right-hand side
+                           WAIT,        //!< Waiting for communication
+                           SOLVE,       //!< Solution update
+                           DIAG,        //!< Diagnostics
+                           OUTPUT,      //!< Field and other output
+                           AMR,         //!< Mesh refinement
+                           NUMPHASE };  //!< Number of phases
+
+//! Names of phases of a time step
+const std::array< const char*, NUMPHASE > PhaseName{{ "other", "lhs", "grad",
+  "rhs", "wait", "solve", "diag", "output", "amr" }};
+
+//! Entries in performance report vector (of vectors of phases)
+enum Perf { PMIN=0,     //!< Minimum across chares
+            PMAX,       //!< Maximum across chares
+            PSUM,       //!< Sum across chares
+            PITER,      //!< Iteration count (only the first entry is used)
+            PPE,        //!< Busy time summed per PE (one entry per PE)
+            PSLOW,      //!< Slowest chares (NUMSLOW entries per chare)
+            NUMPERF };  //!< Number of entries
+
+//! Entries describing a chare in the list of slowest chares of the report
+enum Slow { SBUSY=0,    //!< Busy time, i.e., not waiting
+            SWAIT,      //!< Time waiting for communication
+            SCHARE,     //!< Chare id (thisIndex)
+            SPE,        //!< PE the chare resides on
+            SNELEM,     //!< Number of mesh elements of the chare
+            SNPOIN,     //!< Number of mesh nodes of the chare
+            NUMSLOW };  //!< Number of entries
+
+//! Number of slowest chares kept in the performance report
+const std::size_t NSLOWEST = 5;
+
+//! Compute the busy time of a chare from its phase times
+//! \param[in] t Wall-clock times of the phases, see PhaseTimer::times()
+//! \return Sum of the times of all phases but WAIT
+inline tk::real busy( const std::vector< tk::real >& t ) {
+  return std::accumulate( begin(t), end(t), 0.0 ) - t[ WAIT ];
+}
+
+//! Merge two lists of slowest chares, keeping the NSLOWEST slowest
+//! \param[in,out] a List of chares, NUMSLOW entries each, in decreasing order
+//!   of their busy times, merged into
+//! \param[in] b List of chares to merge, in decreasing order of busy times
+inline void slowest( std::vector< tk::real >& a,
+                     const std::vector< tk::real >& b )
+{
+  std::vector< tk::real > m;
+  auto i = a.cbegin(), j = b.cbegin();
+  while ((i != a.cend() || j != b.cend()) && m.size() < NSLOWEST*NUMSLOW) {
+    auto& k =
+      j == b.cend() || (i != a.cend() && i[SBUSY] >= j[SBUSY]) ? i : j;
+    m.insert( end(m), k, k+NUMSLOW );
+    k += NUMSLOW;
+  }
+  a = std::move( m );
+}
+
+//! Accumulating wall-clock timers of the phases of a time step
+class PhaseTimer {
+
+  private:
+    using clock = std::chrono::high_resolution_clock;
+
+  public:
+    //! Constructor: start timing the OTHER phase
+    explicit PhaseTimer() : m_phase( OTHER ), m_start( clock::now() ), m_acc()
+    { m_acc.fill( 0.0 ); }
+
+    //! Switch to a new phase
+    //! \param[in] p Phase to switch to
+    //! \details The time since the previous switch is accumulated in the
+    //!   phase left.
+    void operator()( Phase p ) {
+      using sec = std::chrono::duration< tk::real >;
+      auto now = clock::now();
+      m_acc[ m_phase ] += sec( now - m_start ).count();
+      m_start = now;
+      m_phase = p;
+    }
+
+    //! Query current phase
+    //! \return Phase entered by the last switch
+    Phase current() const { return static_cast< Phase >( m_phase ); }
+
+    //! Query accumulated times and zero them, the current phase continues
+    //! \return Wall-clock times in seconds accumulated in the phases since
+    //!   the previous call
+    std::vector< tk::real > times() {
+      (*this)( current() );
+      std::vector< tk::real > t( begin(m_acc), end(m_acc) );
+      m_acc.fill( 0.0 );
+      return t;
+    }
+
+    /** @name Charm++ pack/unpack serializer member functions */
+    ///@{
+    //! \brief Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \note The time spent migrating is not accumulated in any phase
+    void pup( PUP::er &p ) {
+      p | m_phase;
+      p | m_acc;
+      if (p.isUnpacking()) m_start = clock::now();
+    }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] t PhaseTimer object reference
+    friend void operator|( PUP::er& p, PhaseTimer& t ) { t.pup(p); }
+    //@}
+
+  private:
+    std::size_t m_phase;                        //!< Current phase
+    clock::time_point m_start;                  //!< Start of current phase
+    std::array< tk::real, NUMPHASE > m_acc;     //!< Accumulated times
+};
+
+} // inciter::
+
+#endif // PhaseTimer_h
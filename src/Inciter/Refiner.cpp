@@ -26,6 +26,11 @@
 #include "Around.hpp"
 #include "Sorter.hpp"
 #include "Discretization.hpp"
+#include "MultiMat/MultiMatIndexing.hpp"
+#include "DiagReducer.hpp"
+#include "MemoryReport.hpp"
+#include "SetupReport.hpp"
+#include "MsgPriority.hpp"
 
 namespace inciter {
 
@@ -71,21 +76,23 @@ Refiner::Refiner( const CProxy_Transporter& transporter,
   m_nref( 0 ),
   m_nbnd( 0 ),
   m_extra( 0 ),
+  m_qd( 0 ),
   m_ch(),
   m_edgech(),
   m_chedge(),
   m_localEdgeData(),
   m_remoteEdgeData(),
   m_nodeCommMap(),
-  m_oldTets(),
   m_addedNodes(),
-  m_addedTets(),
-  m_oldntets( 0 ),
+  m_families(),
+  m_changedNodes(),
   m_coarseBndFaces(),
   m_coarseBndNodes(),
   m_rid( ginpoel.size() ),
   m_lref( ginpoel.size() ),
-  m_parent()
+  m_parent(),
+  m_comm(),
+  m_setupt0( CkWallTimer() )
 // *****************************************************************************
 //  Constructor
 //! \param[in] transporter Transporter (host) proxy
@@ -169,6 +176,10 @@ Refiner::sendProxy()
 
   // Pass Refiner Charm++ chare proxy to fellow (bound) Discretization object
   m_scheme.disc()[thisIndex].ckLocal()->setRefiner( thisProxy );
+
+  // Hand communication counts of initial mesh refinement to the report
+  m_scheme.disc()[thisIndex].ckLocal()->Comm().merge( m_comm );
+  m_comm = CommCounter();
 }
 
 void
@@ -267,6 +278,7 @@ Refiner::start()
 // *****************************************************************************
 {
   m_extra = 0;
+  m_qd = qdcorr() ? 1 : 0;
   m_ch.clear();
   m_remoteEdgeData.clear();
   m_remoteEdges.clear();
@@ -325,8 +337,11 @@ Refiner::bndEdges()
   if (m_nbnd == 0)
     contribute( m_cbr.get< tag::queried >() );
   else
-    for (const auto& [ targetchare, bndedges ] : chbedges)
-      thisProxy[ targetchare ].query( thisIndex, bndedges );
+    for (const auto& [ targetchare, bndedges ] : chbedges) {
+      m_comm.sent( MREFINER, targetchare, thisIndex, bndedges );
+      thisProxy[ targetchare ].query( thisIndex, bndedges,
+                                      msgopts( MREFINER ) );
+    }
 }
 
 void
@@ -338,11 +353,13 @@ Refiner::query( int fromch, const EdgeSet& edges )
 //! \param[in] edges Chare-boundary edge list from another chare
 // *****************************************************************************
 {
+  m_comm.received( MREFINER, fromch, edges );
   // Store incoming edges in edge->chare and its inverse, chare->edge, maps
   for (const auto& e : edges) m_edgech[ e ].push_back( fromch );
   m_chedge[ fromch ].insert( begin(edges), end(edges) );
   // Report back to chare message received from
-  thisProxy[ fromch ].recvquery();
+  m_comm.sent( MREFINER, fromch );
+  thisProxy[ fromch ].recvquery( msgopts( MREFINER ) );
 }
 
 void
@@ -351,6 +368,7 @@ Refiner::recvquery()
 // Receive receipt of boundary edge lists to query
 // *****************************************************************************
 {
+  m_comm.received( MREFINER );
   if (--m_nbnd == 0) contribute( m_cbr.get< tag::queried >() );
 }
 
@@ -383,8 +401,11 @@ Refiner::response()
   if (m_nbnd == 0)
     contribute( m_cbr.get< tag::responded >() );
   else
-    for (const auto& [ targetchare, bndedges ] : exp)
-      thisProxy[ targetchare ].bnd( thisIndex, bndedges );
+    for (const auto& [ targetchare, bndedges ] : exp) {
+      m_comm.sent( MREFINER, targetchare, thisIndex, bndedges );
+      thisProxy[ targetchare ].bnd( thisIndex, bndedges,
+                                    msgopts( MREFINER ) );
+    }
 }
 
 void
@@ -395,11 +416,14 @@ Refiner::bnd( int fromch, const std::vector< int >& chares )
 //! \param[in] chares Chare ids we share edges with
 // *****************************************************************************
 {
+  m_comm.received( MREFINER, fromch, chares );
+
   // Store chare ids we share edges with
   m_ch.insert( begin(chares), end(chares) );
 
   // Report back to chare message received from
-  thisProxy[ fromch ].recvbnd();
+  m_comm.sent( MREFINER, fromch );
+  thisProxy[ fromch ].recvbnd( msgopts( MREFINER ) );
 }
 
 void
@@ -408,6 +432,7 @@ Refiner::recvbnd()
 // Receive receipt of shared boundary edges
 // *****************************************************************************
 {
+  m_comm.received( MREFINER );
   if (--m_nbnd == 0) contribute( m_cbr.get< tag::responded >() );
 }
 
@@ -460,8 +485,23 @@ Refiner::refine()
       errorRefine();
   }
 
-  // Communicate extra edges
-  comExtra();
+  if (m_qd) {
+
+    // Correct our edges based on data neighbors sent before we tagged ours,
+    // then send our edges to neighbors
+    m_qd = 2;
+    std::vector< int > from;
+    for (const auto& [ neighborchare, edgedata ] : m_remoteEdgeData)
+      from.push_back( neighborchare );
+    if (!from.empty()) correctNeighbors( from );
+    exportEdges();
+
+  } else {
+
+    // Communicate extra edges
+    comExtra();
+
+  }
 }
 
 void
@@ -471,12 +511,19 @@ Refiner::comExtra()
 // *****************************************************************************
 {
   // Export extra added nodes on our mesh chunk boundary to other chares
-  if (m_ch.empty()) {
-    correctref();
-  } else {
-    for (auto c : m_ch) {  // for all chares we share at least an edge with
-      thisProxy[c].addRefBndEdges(thisIndex, m_localEdgeData, m_intermediates);
-    }
+  if (m_ch.empty()) correctref(); else exportEdges();
+}
+
+void
+Refiner::exportEdges()
+// *****************************************************************************
+// Send our edges and intermediates to all chares we share edges with
+// *****************************************************************************
+{
+  for (auto c : m_ch) {  // for all chares we share at least an edge with
+    m_comm.sent( MREFINER, c, thisIndex, m_localEdgeData, m_intermediates );
+    thisProxy[c].addRefBndEdges(thisIndex, m_localEdgeData, m_intermediates,
+                                msgopts( MREFINER ));
   }
 }
 
@@ -492,9 +539,16 @@ Refiner::addRefBndEdges(
 //! \param[in] intermediates Intermediate nodes
 // *****************************************************************************
 {
-  // Save/augment buffers of edge data for each sender chare
+  m_comm.received( MREFINER, fromch, ed, intermediates );
+
+  // Save/augment buffers of edge data for each sender chare, with
+  // neighbor-only correction, only keep the latest data of the sender
   auto& red = m_remoteEdgeData[ fromch ];
   auto& re = m_remoteEdges[ fromch ];
+  if (m_qd) {
+    red.clear();
+    re.clear();
+  }
   using edge_data_t = std::tuple< Edge, int, AMR::Edge_Lock_Case >;
   for (const auto& [ edge, data ] : ed) {
     red.push_back( edge_data_t{ edge, data.first, data.second } );
@@ -509,8 +563,15 @@ Refiner::addRefBndEdges(
     }
   }
 
-  // Heard from every worker we share at least a single edge with
-  if (++m_nref == m_ch.size()) {
+  if (m_qd) {
+
+    // Once our own edges are tagged, correct them based on the sender's and
+    // if that modified them, re-send them to neighbors. Convergence is
+    // detected by quiescence, see quiescent().
+    if (m_qd == 2 && correctNeighbors( { fromch } )) exportEdges();
+
+  } else if (++m_nref == m_ch.size()) {
+    // Heard from every worker we share at least a single edge with
     m_nref = 0;
     // Add intermediates to refiner lib
     auto localedges_orig = m_localEdgeData;
@@ -538,61 +599,12 @@ Refiner::correctref()
 //!    a conforming mesh across chare boundaries during a mesh refinement step.
 // *****************************************************************************
 {
-  auto unlocked = AMR::Edge_Lock_Case::unlocked;
-
   // Storage for edge data that need correction to yield a conforming mesh
   AMR::EdgeData extra;
 
   // loop through all edges shared with other chares
-  for (const auto& [ neighborchare, edgedata ] : m_remoteEdgeData) {
-    for (const auto& [edge,remote_needs_refining,remote_lock_case] : edgedata) {
-      // find local data of remote edge
-      auto it = m_localEdgeData.find( edge );
-      if (it != end(m_localEdgeData)) {
-        auto& local = it->second;
-        auto& local_needs_refining = local.first;
-        auto& local_lock_case = local.second;
-
-        auto local_needs_refining_orig = local_needs_refining;
-        auto local_lock_case_orig = local_lock_case;
-
-        Assert( !(local_lock_case > unlocked && local_needs_refining),
-                "Invalid local edge: locked & needs refining" );
-        Assert( !(remote_lock_case > unlocked && remote_needs_refining),
-                "Invalid remote edge: locked & needs refining" );
-
-        // compute lock from local and remote locks as most restrictive
-        local_lock_case = std::max( local_lock_case, remote_lock_case );
-
-        if (local_lock_case > unlocked)
-          local_needs_refining = 0;
-
-        if (local_lock_case == unlocked && remote_needs_refining)
-          local_needs_refining = 1;
-
-        // if the remote sent us data that makes us change our local state,
-        // e.g., local{0,0} + remote(1,0} -> local{1,0}, i.e., I changed my
-        // state I need to tell the world about it
-        if ( (local_lock_case != local_lock_case_orig ||
-              local_needs_refining != local_needs_refining_orig) ||
-        // or if the remote data is inconsistent with what I think, e.g.,
-        // local{1,0} + remote(0,0} -> local{1,0}, i.e., the remote does not
-        // yet agree, I need to tell the world about it
-             (local_lock_case != remote_lock_case ||
-              local_needs_refining != remote_needs_refining) )
-        {
-          auto l1 = tk::cref_find( m_lid, edge[0] );
-          auto l2 = tk::cref_find( m_lid, edge[1] );
-          Assert( l1 != l2, "Edge end-points local ids are the same" );
-          auto r1 = m_rid[ l1 ];
-          auto r2 = m_rid[ l2 ];
-          Assert( r1 != r2, "Edge end-points refiner ids are the same" );
-           extra[ {{ std::min(r1,r2), std::max(r1,r2) }} ] =
-             { local_needs_refining, local_lock_case };
-        }
-      }
-    }
-  }
+  for (const auto& [ neighborchare, edgedata ] : m_remoteEdgeData)
+    correctEdges( edgedata, extra );
 
   m_remoteEdgeData.clear();
   m_extra = extra.size();
@@ -614,6 +626,124 @@ Refiner::correctref()
   contribute( m, CkReduction::sum_ulong, m_cbr.get< tag::matched >() );
 }
 
+void
+Refiner::correctEdges(
+  const std::vector< std::tuple< Edge, int, AMR::Edge_Lock_Case > >& edgedata,
+  AMR::EdgeData& extra )
+// *****************************************************************************
+//  Correct our chare-boundary edges based on edge data from a fellow chare
+//! \param[in] edgedata Refinement data of edges from a fellow chare
+//! \param[in,out] extra Edge data that need correction to yield a conforming
+//!   mesh across chare boundaries, augmented by the edges we share with the
+//!   fellow chare whose state changed or does not agree with the fellow chare
+// *****************************************************************************
+{
+  auto unlocked = AMR::Edge_Lock_Case::unlocked;
+
+  for (const auto& [edge,remote_needs_refining,remote_lock_case] : edgedata) {
+    // find local data of remote edge
+    auto it = m_localEdgeData.find( edge );
+    if (it != end(m_localEdgeData)) {
+      auto& local = it->second;
+      auto& local_needs_refining = local.first;
+      auto& local_lock_case = local.second;
+
+      auto local_needs_refining_orig = local_needs_refining;
+      auto local_lock_case_orig = local_lock_case;
+
+      Assert( !(local_lock_case > unlocked && local_needs_refining),
+              "Invalid local edge: locked & needs refining" );
+      Assert( !(remote_lock_case > unlocked && remote_needs_refining),
+              "Invalid remote edge: locked & needs refining" );
+
+      // compute lock from local and remote locks as most restrictive
+      local_lock_case = std::max( local_lock_case, remote_lock_case );
+
+      if (local_lock_case > unlocked)
+        local_needs_refining = 0;
+
+      if (local_lock_case == unlocked && remote_needs_refining)
+        local_needs_refining = 1;
+
+      // if the remote sent us data that makes us change our local state,
+      // e.g., local{0,0} + remote(1,0} -> local{1,0}, i.e., I changed my
+      // state I need to tell the world about it
+      if ( (local_lock_case != local_lock_case_orig ||
+            local_needs_refining != local_needs_refining_orig) ||
+      // or if the remote data is inconsistent with what I think, e.g.,
+      // local{1,0} + remote(0,0} -> local{1,0}, i.e., the remote does not
+      // yet agree, I need to tell the world about it
+           (local_lock_case != remote_lock_case ||
+            local_needs_refining != remote_needs_refining) )
+      {
+        auto l1 = tk::cref_find( m_lid, edge[0] );
+        auto l2 = tk::cref_find( m_lid, edge[1] );
+        Assert( l1 != l2, "Edge end-points local ids are the same" );
+        auto r1 = m_rid[ l1 ];
+        auto r2 = m_rid[ l2 ];
+        Assert( r1 != r2, "Edge end-points refiner ids are the same" );
+        extra[ {{ std::min(r1,r2), std::max(r1,r2) }} ] =
+          { local_needs_refining, local_lock_case };
+      }
+    }
+  }
+}
+
+bool
+Refiner::correctNeighbors( const std::vector< int >& from )
+// *****************************************************************************
+//  Correct our edges based on the latest edge data from fellow chares
+//! \param[in] from Chare ids whose latest edge data to correct with
+//! \return True if our edge data or intermediates changed, i.e., they need to
+//!   be sent to fellow chares
+//! \details This is a single local step of neighbor-only correction of
+//!   chare-boundary edges: the intermediates received are locked, the edges
+//!   needing correction are applied, and the compatibility algorithm is run.
+// *****************************************************************************
+{
+  auto localedges_orig = m_localEdgeData;
+  auto intermediates_orig = m_intermediates;
+
+  AMR::EdgeData extra;
+  for (auto c : from) correctEdges( tk::cref_find(m_remoteEdgeData,c), extra );
+
+  m_refiner.lock_intermediates();
+  m_refiner.mark_error_refinement_corr( extra );
+  updateEdgeData();
+
+  return localedges_orig != m_localEdgeData ||
+         intermediates_orig != m_intermediates;
+}
+
+void
+Refiner::quiescent()
+// *****************************************************************************
+//  Finish neighbor-only correction of chare-boundary edges
+//! \details This is called after quiescence has been detected during
+//!   neighbor-only correction, i.e., when no chare modifies its edges any
+//!   longer. A single global check follows in correctref(), which, if any edge
+//!   still needs correction, continues with the correction iterating on
+//!   global reductions.
+// *****************************************************************************
+{
+  m_qd = 0;
+  correctref();
+}
+
+bool
+Refiner::qdcorr() const
+// *****************************************************************************
+//  Query if chare-boundary edges are corrected among neighbors only
+//! \return True if edges are corrected using neighbor-only communication
+//!   with convergence detected by quiescence
+//! \details Quiescence detection is not used if it is enabled by the user to
+//!   catch logic errors, since that would be triggered as well.
+// *****************************************************************************
+{
+  return g_inputdeck.get< tag::amr, tag::qdcorr >() &&
+         !g_inputdeck.get< tag::cmd, tag::quiescence >();
+}
+
 void
 Refiner::updateEdgeData()
 // *****************************************************************************
@@ -668,23 +798,20 @@ Refiner::refinementFields() const
   auto esup = tk::genEsup( m_inpoel, 4 );
 
   // Update solution on current mesh
-  auto u = solution( npoin, esup );
+  tk::Fields init;
+  const auto& u = solution( npoin, esup, init );
   Assert( u.nunk() == npoin, "Solution uninitialized or wrong size" );
 
   // Compute error in edges on current mesh
-  auto edgeError = errorsInEdges( npoin, esup, u );
+  auto inpoed = tk::genInpoed( m_inpoel, 4, esup );
+  auto edgeError = errorsInEdges( inpoed, esup, u );
 
   // Transfer error from edges to cells for field output
+  auto inedel = tk::genInedel( m_inpoel, 4, inpoed );
   std::vector< tk::real > error( m_inpoel.size()/4, 0.0 );
   for (std::size_t e=0; e<m_inpoel.size()/4; ++e) {
-    auto A = m_inpoel[e*4+0];
-    auto B = m_inpoel[e*4+1];
-    auto C = m_inpoel[e*4+2];
-    auto D = m_inpoel[e*4+3];
-    std::array<Edge,6> edges{{ {{A,B}}, {{B,C}}, {{A,C}},
-                               {{A,D}}, {{B,D}}, {{C,D}} }};
     // sum error from edges to elements
-    for (const auto& ed : edges) error[e] += tk::cref_find( edgeError, ed );
+    for (std::size_t i=0; i<6; ++i) error[e] += edgeError[ inedel[e*6+i] ];
     error[e] /= 6.0;    // assign edge-average error to element
   }
 
@@ -756,16 +883,12 @@ Refiner::writeMesh( const std::string& basefilename,
                            begin(solfieldnames), end(solfieldnames) );
 
     auto ndof = g_inputdeck.get< tag::discr, tag::ndof >();
-    tk::Fields lhs( m_inpoel.size()/4, ndof*nprop );
-
-    // Generate left hand side for DG initialize
-    auto geoElem = tk::genGeoElemTet( m_inpoel, m_coord );
-    for (const auto& eq : g_dgpde) eq.lhs( geoElem, lhs );
+    tk::Fields u( m_inpoel.size()/4, ndof*nprop );
 
     // Evaluate initial conditions on current mesh at t0
-    auto u = lhs;
+    auto geoElem = tk::genGeoElemTet( m_inpoel, m_coord );
     for (const auto& eq : g_dgpde)
-      eq.initialize( lhs, m_inpoel, m_coord, u, t0, m_inpoel.size()/4 );
+      eq.initialize( geoElem, m_inpoel, m_coord, u, t0, m_inpoel.size()/4 );
 
     // Extract all scalar components from solution for output to file
     for (std::size_t i=0; i<nprop; ++i)
@@ -774,8 +897,9 @@ Refiner::writeMesh( const std::string& basefilename,
 
   // Output mesh
   m_meshwriter[ CkNodeFirst( CkMyNode() ) ].
-    write( /*meshoutput = */ true, /*fieldoutput = */ true, itr, 1, t,
-           thisIndex, basefilename, m_inpoel, m_coord, m_bface,
+    write( /*meshoutput = */ true, /*fieldoutput = */ true,
+           /*surfmeshoutput = */ false, /*surffieldoutput = */ false, itr, 1,
+           1, t, thisIndex, basefilename, m_inpoel, m_coord, m_bface,
            tk::remap(m_bnode,m_lid), tk::remap(m_triinpoel,m_lid),
            elemfieldnames, nodefieldnames, {}, elemfields, nodefields, {},
            {}, c );
@@ -793,12 +917,6 @@ Refiner::perform()
 //!   (Discretization).
 // *****************************************************************************
 {
-  // Save old tets and their ids before performing refinement
-  m_oldntets = m_oldTets.size();
-  m_oldTets.clear();
-  for (const auto& [ id, tet ] : m_refiner.tet_store.tets)
-    m_oldTets.insert( tet );
-
   //auto& tet_store = m_refiner.tet_store;
   //std::cout << "before ref: " << tet_store.marked_refinements.size() << ", " << tet_store.marked_derefinements.size() << ", " << tet_store.size() << ", " << tet_store.get_active_inpoel().size() << '\n';
   m_refiner.perform_refinement();
@@ -851,10 +969,16 @@ Refiner::next()
       }
     }
 
+    // Hand communication counts of this mesh refinement step to the report
+    auto disc = m_scheme.disc()[thisIndex].ckLocal();
+    Assert( disc != nullptr, "About to dereference nullptr" );
+    disc->Comm().merge( m_comm );
+    m_comm = CommCounter();
+
     // Send new mesh, solution, and communication data back to PDE worker
     m_scheme.ckLocal< Scheme::resizePostAMR >( thisIndex,  m_ginpoel, m_el,
-      m_coord, m_addedNodes, m_addedTets, m_nodeCommMap, m_bface, m_bnode,
-      m_triinpoel );
+      m_coord, m_addedNodes, m_families, m_changedNodes, m_nodeCommMap,
+      m_bface, m_bnode, m_triinpoel );
   }
 }
 
@@ -878,6 +1002,33 @@ Refiner::endt0ref()
                                         m_coord[0].size() }};
   contribute( meshsize, CkReduction::sum_ulong, m_cbr.get< tag::refined >() );
 
+  // Account memory of the refiner library stores, the mesh, and the refiner's
+  // own data before the latter is freed
+  if (g_inputdeck.get< tag::cmd, tag::feedback >()) {
+    auto& t = m_refiner.tet_store;
+    std::array< std::size_t, NUMMEM > b{};
+    b[MAMR] = tk::bytes( t.tets, t.edge_store.edges, t.active_tetinpoel,
+                         t.active_nodes, t.active_id_mapping,
+                         t.intermediate_list, t.center_tets, t.delete_list,
+                         t.leaf_families, t.active_elements.data(),
+                         t.master_elements.data(),
+                         m_refiner.node_connectivity.data(),
+                         m_refiner.node_connectivity.inv_data() ) +
+              tk::bytes( m_localEdgeData, m_remoteEdges, m_intermediates,
+                         m_addedNodes, m_rid, m_oldrid, m_lref, m_parent );
+    b[MMESH] = tk::bytes( m_ginpoel, m_inpoel, m_gid, m_lid, m_coordmap,
+                          m_coord, m_bface, m_bnode, m_triinpoel,
+                          m_coarseBndFaces, m_coarseBndNodes );
+    b[MCOMMAP] = tk::bytes( m_ch, m_edgech, m_chedge, m_nodeCommMap );
+    auto stream = serialize( memreport( MREFINED, b ) );
+    contribute( stream.first, stream.second.get(), MemMerger,
+      CkCallback( CkIndex_Transporter::memory(nullptr), m_host ) );
+    if (g_inputdeck.get< tag::amr, tag::t0ref >())
+      contribute( setupreport( { { TREFINE, CkWallTimer() - m_setupt0 } } ),
+        CkReduction::max_double,
+        CkCallback( CkReductionTarget(Transporter,setuptime), m_host ) );
+  }
+
   // Free up memory if no dtref
   if (!g_inputdeck.get< tag::amr, tag::dtref >()) {
     tk::destroy( m_ginpoel );
@@ -896,9 +1047,9 @@ Refiner::endt0ref()
     tk::destroy( m_remoteEdges );
     tk::destroy( m_intermediates );
     tk::destroy( m_nodeCommMap );
-    tk::destroy( m_oldTets );
     tk::destroy( m_addedNodes );
-    tk::destroy( m_addedTets );
+    m_families = tk::CellFamilies();
+    tk::destroy( m_changedNodes );
     tk::destroy( m_coarseBndFaces );
     tk::destroy( m_coarseBndNodes );
     tk::destroy( m_rid );
@@ -942,18 +1093,19 @@ Refiner::uniformDeRefine()
   m_extra = 0;
 }
 
-Refiner::EdgeError
+std::vector< tk::real >
 Refiner::errorsInEdges(
-  std::size_t npoin,
+  const std::vector< std::size_t >& inpoed,
   const std::pair< std::vector<std::size_t>, std::vector<std::size_t> >& esup,
   const tk::Fields& u ) const
 // *****************************************************************************
 //  Compute errors in edges
-//! \param[in] npoin Number nodes in current mesh (partition)
+//! \param[in] inpoed Edge connectivity of current mesh (partition), see
+//!   tk::genInpoed()
 //! \param[in] esup Elements surrounding points linked vectors
 //! \param[in] u Solution evaluated at mesh nodes for all scalar components
-//! \return A map associating errors (real values between 0.0 and 1.0 incusive)
-//!   to edges (2 local node IDs)
+//! \return Errors (real values between 0.0 and 1.0 incusive) in edges, the
+//!   maximum among the refinement variables, one per edge of inpoed
 // *****************************************************************************
 {
   // Get the indices (in the system of systems) of refinement variables and the
@@ -961,59 +1113,151 @@ Refiner::errorsInEdges(
   const auto& refidx = g_inputdeck.get< tag::amr, tag::id >();
   auto errtype = g_inputdeck.get< tag::amr, tag::error >();
 
-  // Compute points surrounding points
-  auto psup = tk::genPsup( m_inpoel, 4, esup );
-
   // Compute errors in ICs and define refinement criteria for edges
   AMR::Error error;
-  EdgeError edgeError;
-
-  for (std::size_t p=0; p<npoin; ++p) { // for all mesh nodes on this chare
-    for (auto q : tk::Around(psup,p)) { // for all nodes surrounding p
-      tk::real cmax = 0.0;
-      AMR::edge_t e(p,q);
-      for (auto i : refidx) {          // for all refinement variables
-        auto c = error.scalar( u, e, i, m_coord, m_inpoel, esup, errtype );
-        if (c > cmax) cmax = c;        // find max error at edge
+  return error.scalars( u, inpoed, refidx, m_coord, m_inpoel, esup, errtype );
+}
+
+void
+Refiner::bufferEdges( const std::vector< std::size_t >& inpoed,
+                      const tk::Fields& u,
+                      std::vector< char >& ref ) const
+// *****************************************************************************
+//  Extend edges tagged for refinement into buffer zones
+//! \param[in] inpoed Edge connectivity of current mesh (partition), see
+//!   tk::genInpoed()
+//! \param[in] u Solution evaluated at mesh nodes for all scalar components
+//! \param[in,out] ref Refinement flags, one per edge of inpoed, 1 if edge is
+//!   tagged for refinement, extended by the edges of the buffer zones
+//! \details The region tagged for refinement is grown by the user-configured
+//!   number of edge layers. In each layer, an edge not yet tagged, adjacent to
+//!   an end-point of the previous layer, is tagged if it points downstream,
+//!   i.e., its direction away from that end-point makes a non-obtuse angle
+//!   with the velocity at that end-point. If the solution does not carry a
+//!   velocity or the velocity is zero, the buffer grows in all directions.
+//!   This keeps features propagating with the flow inside refined cells for a
+//!   number of time steps, so mesh refinement may be done less frequently.
+//!   Edges tagged differently on either side of a chare boundary are made
+//!   consistent by the chare-boundary correction that follows.
+// *****************************************************************************
+{
+  auto nbuf = g_inputdeck.get< tag::amr, tag::buffer >();
+  if (nbuf == 0) return;
+
+  Assert( ref.size() == inpoed.size()/2, "Size mismatch" );
+
+  const auto& x = m_coord[0];
+  const auto& y = m_coord[1];
+  const auto& z = m_coord[2];
+  auto v = velocity( u );
+  auto vel = !v[0].empty();
+
+  // Return true if edge from node p to q points downstream from p
+  auto downstream = [&]( std::size_t p, std::size_t q ) {
+    if (!vel) return true;
+    return (x[q]-x[p])*v[0][p] + (y[q]-y[p])*v[1][p] + (z[q]-z[p])*v[2][p]
+           >= 0.0;
+  };
+
+  // Flag end-points of edges tagged by the error indicator as the front
+  std::vector< char > front( x.size(), 0 ), next( x.size(), 0 );
+  for (std::size_t e=0; e<ref.size(); ++e)
+    if (ref[e]) front[ inpoed[e*2] ] = front[ inpoed[e*2+1] ] = 1;
+
+  // Grow buffer zone layer by layer from the front
+  for (std::size_t l=0; l<nbuf; ++l) {
+    std::fill( begin(next), end(next), 0 );
+    for (std::size_t e=0; e<ref.size(); ++e) {
+      if (ref[e]) continue;
+      auto p = inpoed[e*2];
+      auto q = inpoed[e*2+1];
+      if ((front[p] && downstream(p,q)) || (front[q] && downstream(q,p))) {
+        ref[e] = 1;
+        next[p] = next[q] = 1;
       }
-      edgeError[ {{p,q}} ] = cmax;       // associate error to edge
     }
+    std::swap( front, next );
   }
+}
+
+std::array< std::vector< tk::real >, 3 >
+Refiner::velocity( const tk::Fields& u ) const
+// *****************************************************************************
+//  Extract velocity from the solution of the first system of equations
+//! \param[in] u Solution evaluated at mesh nodes for all scalar components
+//! \return Velocity components at mesh nodes, empty if the first system of
+//!   equations configured does not carry a velocity
+// *****************************************************************************
+{
+  std::array< std::vector< tk::real >, 3 > v;
+
+  const auto& pde = g_inputdeck.get< tag::selected, tag::pde >();
+  if (pde.empty()) return v;
 
-  return edgeError;
+  const auto& ncomp = g_inputdeck.get< tag::component >();
+  auto npoin = u.nunk();
+
+  if (pde[0] == ctr::PDEType::COMPFLOW) {
+
+    auto offset = ncomp.offset< tag::compflow >( 0 );
+    for (std::size_t j=0; j<3; ++j) {
+      v[j].resize( npoin );
+      for (std::size_t i=0; i<npoin; ++i)
+        v[j][i] = u(i,j+1,offset) / u(i,0,offset);
+    }
+
+  } else if (pde[0] == ctr::PDEType::MULTIMAT) {
+
+    auto offset = ncomp.offset< tag::multimat >( 0 );
+    auto nmat = g_inputdeck.get< tag::param, tag::multimat, tag::nmat >()[0];
+    std::vector< tk::real > rho( npoin, 0.0 );
+    for (std::size_t k=0; k<nmat; ++k)
+      for (std::size_t i=0; i<npoin; ++i)
+        rho[i] += u(i,densityIdx(nmat,k),offset);
+    for (std::size_t j=0; j<3; ++j) {
+      v[j].resize( npoin );
+      for (std::size_t i=0; i<npoin; ++i)
+        v[j][i] = u(i,momentumIdx(nmat,j),offset) / rho[i];
+    }
+
+  }
+
+  return v;
 }
 
-tk::Fields
+const tk::Fields&
 Refiner::solution( std::size_t npoin,
                    const std::pair< std::vector< std::size_t >,
-                                    std::vector< std::size_t > >& esup ) const
+                                    std::vector< std::size_t > >& esup,
+                   tk::Fields& init ) const
 // *****************************************************************************
 //  Update (or evaluate) solution on current mesh
 //! \param[in] npoin Number nodes in current mesh (partition)
 //! \param[in] esup Elements surrounding points linked vectors
+//! \param[in,out] init Storage for the initial conditions, only filled for
+//!   initial (before t=0) AMR
 //! \return Solution updated/evaluated for all scalar components
+//! \details During time stepping the solution is not copied: the reference
+//!   returned is to the solution of the worker on this PE, which must not
+//!   change until the caller is done with it.
 // *****************************************************************************
 {
-  // Get solution whose error to evaluate
-  tk::Fields u;
-
   if (m_initial) {      // initial (before t=0) AMR
 
     // Evaluate initial conditions at mesh nodes
-    u = nodeinit( npoin, esup );
+    init = nodeinit( npoin, esup );
+    return init;
 
-  } else {              // AMR during time stepping (t>0)
+  }
 
-    // Query current solution
-    u = m_scheme.ckLocal< Scheme::solution >( thisIndex );
- 
-    const auto scheme = g_inputdeck.get< tag::discr, tag::scheme >();
-    const auto centering = ctr::Scheme().centering( scheme );
-    if (centering == tk::Centering::ELEM) {
+  // AMR during time stepping (t>0): read current solution in place
+  const auto& u = m_scheme.ckLocal< Scheme::solution >( thisIndex );
 
-      // ...
+  const auto scheme = g_inputdeck.get< tag::discr, tag::scheme >();
+  const auto centering = ctr::Scheme().centering( scheme );
+  if (centering == tk::Centering::ELEM) {
 
-    }
+    // ...
 
   }
 
@@ -1032,7 +1276,8 @@ Refiner::errorRefine()
   auto esup = tk::genEsup( m_inpoel, 4 );
 
   // Update solution on current mesh
-  auto u = solution( npoin, esup );
+  tk::Fields init;
+  const auto& u = solution( npoin, esup, init );
   Assert( u.nunk() == npoin, "Solution uninitialized or wrong size" );
 
   using AMR::edge_t;
@@ -1043,14 +1288,22 @@ Refiner::errorRefine()
   // derefinement tolerance.
   auto tolref = g_inputdeck.get< tag::amr, tag::tolref >();
   auto tolderef = g_inputdeck.get< tag::amr, tag::tolderef >();
+  auto inpoed = tk::genInpoed( m_inpoel, 4, esup );
+  auto edgeError = errorsInEdges( inpoed, esup, u );
+  std::vector< char > ref( edgeError.size() );
+  for (std::size_t e=0; e<ref.size(); ++e) ref[e] = edgeError[e] > tolref;
+
+  // Optionally extend the refined region into buffer zones during time
+  // stepping
+  if (!m_initial) bufferEdges( inpoed, u, ref );
+
   std::vector< std::pair< edge_t, edge_tag > > tagged_edges;
-  for (const auto& e : errorsInEdges(npoin,esup,u)) {
-    if (e.second > tolref) {
-      tagged_edges.push_back( { edge_t( m_rid[e.first[0]], m_rid[e.first[1]] ),
-                                edge_tag::REFINE } );
-    } else if (e.second < tolderef) {
-      tagged_edges.push_back( { edge_t( m_rid[e.first[0]], m_rid[e.first[1]] ),
-                                edge_tag::DEREFINE } );
+  for (std::size_t e=0; e<inpoed.size()/2; ++e) {
+    edge_t ed( m_rid[inpoed[e*2]], m_rid[inpoed[e*2+1]] );
+    if (ref[e]) {
+      tagged_edges.push_back( { ed, edge_tag::REFINE } );
+    } else if (edgeError[e] < tolderef) {
+      tagged_edges.push_back( { ed, edge_tag::DEREFINE } );
     }
   }
 
@@ -1118,35 +1371,15 @@ Refiner::coordRefine()
 // *****************************************************************************
 {
   // Get user-defined half-world coordinates
-  auto xminus = g_inputdeck.get< tag::amr, tag::xminus >();
-  auto xplus = g_inputdeck.get< tag::amr, tag::xplus >();
-  auto yminus = g_inputdeck.get< tag::amr, tag::yminus >();
-  auto yplus = g_inputdeck.get< tag::amr, tag::yplus >();
-  auto zminus = g_inputdeck.get< tag::amr, tag::zminus >();
-  auto zplus = g_inputdeck.get< tag::amr, tag::zplus >();
-
-  // The default is the largest representable double
-  auto eps =
-    std::numeric_limits< kw::amr_xminus::info::expect::type >::epsilon();
-  auto xminus_default = g_inputdeck_defaults.get< tag::amr, tag::xminus >();
-  auto xplus_default = g_inputdeck_defaults.get< tag::amr, tag::xplus >();
-  auto yminus_default = g_inputdeck_defaults.get< tag::amr, tag::yminus >();
-  auto yplus_default = g_inputdeck_defaults.get< tag::amr, tag::yplus >();
-  auto zminus_default = g_inputdeck_defaults.get< tag::amr, tag::zminus >();
-  auto zplus_default = g_inputdeck_defaults.get< tag::amr, tag::zplus >();
-
-  // Decide if user has configured the half-world
-  bool xm = std::abs(xminus - xminus_default) > eps ? true : false;
-  bool xp = std::abs(xplus - xplus_default) > eps ? true : false;
-  bool ym = std::abs(yminus - yminus_default) > eps ? true : false;
-  bool yp = std::abs(yplus - yplus_default) > eps ? true : false;
-  bool zm = std::abs(zminus - zminus_default) > eps ? true : false;
-  bool zp = std::abs(zplus - zplus_default) > eps ? true : false;
+  const auto hw = halfworld();
 
   using AMR::edge_t;
   using AMR::edge_tag;
 
-  if (xm || xp || ym || yp || zm || zp) {       // if any half-world configured
+  auto configured = std::any_of( begin(hw), end(hw),
+                                 []( const auto& h ){ return h.first; } );
+
+  if (configured) {       // if any half-world configured
     // Find number of nodes in old mesh
     auto npoin = tk::npoin_in_graph( m_inpoel );
     // Generate edges surrounding points in old mesh
@@ -1162,18 +1395,9 @@ Refiner::coordRefine()
       for (auto q : tk::Around(psup,p)) {  // for all nodes surrounding p
         Edge e{{p,q}};
 
-        bool t = true;
-        if (xm) { if (x[p]>xminus && x[q]>xminus) t = false; }
-        if (xp) { if (x[p]<xplus && x[q]<xplus) t = false; }
-        if (ym) { if (y[p]>yminus && y[q]>yminus) t = false; }
-        if (yp) { if (y[p]<yplus && y[q]<yplus) t = false; }
-        if (zm) { if (z[p]>zminus && z[q]>zminus) t = false; }
-        if (zp) { if (z[p]<zplus && z[q]<zplus) t = false; }
-
-        if (t) {
+        if (halfworldTag( hw, {{ x[p], y[p], z[p] }}, {{ x[q], y[q], z[q] }} ))
           tagged_edges.push_back( { edge_t( m_rid[e[0]], m_rid[e[1]] ),
                                     edge_tag::REFINE } );
-        }
       }
 
     // Do error-based refinement
@@ -1187,6 +1411,52 @@ Refiner::coordRefine()
   }
 }
 
+Refiner::HalfWorld
+Refiner::halfworld()
+// *****************************************************************************
+// Query half-world coordinates configured for coordinate-based refinement
+//! \return Half-world coordinates x-, x+, y-, y+, z-, z+, each with whether
+//!   it has been configured by the user, i.e., differs from its default
+// *****************************************************************************
+{
+  // The default is the largest representable double
+  auto eps =
+    std::numeric_limits< kw::amr_xminus::info::expect::type >::epsilon();
+  auto set = [&]( tk::real v, tk::real d ){
+    return std::make_pair( std::abs(v - d) > eps, v ); };
+
+  const auto& a = g_inputdeck.get< tag::amr >();
+  const auto& d = g_inputdeck_defaults.get< tag::amr >();
+  return {{ set( a.get< tag::xminus >(), d.get< tag::xminus >() ),
+            set( a.get< tag::xplus >(), d.get< tag::xplus >() ),
+            set( a.get< tag::yminus >(), d.get< tag::yminus >() ),
+            set( a.get< tag::yplus >(), d.get< tag::yplus >() ),
+            set( a.get< tag::zminus >(), d.get< tag::zminus >() ),
+            set( a.get< tag::zplus >(), d.get< tag::zplus >() ) }};
+}
+
+bool
+Refiner::halfworldTag( const HalfWorld& hw,
+                       const std::array< tk::real, 3 >& p,
+                       const std::array< tk::real, 3 >& q )
+// *****************************************************************************
+// Query if an edge is tagged by coordinate-based refinement
+//! \param[in] hw Half-world coordinates configured, see halfworld()
+//! \param[in] p Coordinates of one end-point of the edge
+//! \param[in] q Coordinates of the other end-point of the edge
+//! \return True if the edge is to be refined: for all half-worlds configured,
+//!   at least one of its end-points is in the half-world
+// *****************************************************************************
+{
+  for (std::size_t d=0; d<3; ++d) {
+    const auto& m = hw[d*2+0];
+    const auto& l = hw[d*2+1];
+    if (m.first && p[d] > m.second && q[d] > m.second) return false;
+    if (l.first && p[d] < l.second && q[d] < l.second) return false;
+  }
+  return true;
+}
+
 tk::Fields
 Refiner::nodeinit( std::size_t npoin,
                    const std::pair< std::vector< std::size_t >,
@@ -1218,12 +1488,9 @@ Refiner::nodeinit( std::size_t npoin,
     auto esuel = tk::genEsuelTet( m_inpoel, esup ); // elems surrounding elements
     // Initialize cell-based unknowns
     tk::Fields ue( m_inpoel.size()/4, nprop );
-    auto lhs = ue;
     auto geoElem = tk::genGeoElemTet( m_inpoel, m_coord );
     for (const auto& eq : g_dgpde)
-      eq.lhs( geoElem, lhs );
-    for (const auto& eq : g_dgpde)
-      eq.initialize( lhs, m_inpoel, m_coord, ue, t0, esuel.size()/4 );
+      eq.initialize( geoElem, m_inpoel, m_coord, ue, t0, esuel.size()/4 );
 
     // Transfer initial conditions from cells to nodes
     for (std::size_t p=0; p<npoin; ++p) {    // for all mesh nodes on this chare
@@ -1260,24 +1527,56 @@ Refiner::updateMesh()
   Assert( tk::conforming( m_inpoel, m_coord ),
           "Mesh not conforming after refinement" );
 
-  // Generate unique node lists of old and refined mesh using local ids
+  // Flag nodes of old and refined mesh using refiner lib node ids
   auto rinpoel = m_inpoel;
   tk::remap( rinpoel, m_rid );
-  std::unordered_set< std::size_t > old( begin(rinpoel), end(rinpoel) );
-  std::unordered_set< std::size_t > ref( begin(refinpoel), end(refinpoel) );
+  std::size_t nr = 0;
+  for (auto r : rinpoel) nr = std::max( nr, r+1 );
+  for (auto r : refinpoel) nr = std::max( nr, r+1 );
+  std::vector< char > old( nr, 0 ), ref( nr, 0 );
+  for (auto r : rinpoel) old[r] = 1;
+  for (auto r : refinpoel) ref[r] = 1;
+
+  // Find nodes added by refinement and removed by derefinement, in ascending
+  // refiner lib node id order
+  std::vector< std::size_t > added, removed;
+  for (std::size_t r=0; r<nr; ++r)
+    if (ref[r] && !old[r])
+      added.push_back( r );
+    else if (old[r] && !ref[r])
+      removed.push_back( r );
 
   // Augment refiner id -> local node id map with newly added nodes
   std::size_t l = m_lref.size();
-  for (auto r : ref) if (old.find(r) == end(old)) m_lref[r] = l++;
+  for (auto r : added) m_lref[r] = l++;
 
   // Get nodal communication map from Discretization worker
   if (!m_initial)
     m_nodeCommMap = m_scheme.disc()[thisIndex].ckLocal()->NodeCommMap();
 
+  // Find cell families relating the cells of the old and new meshes, used to
+  // transfer cell data to the new mesh during time stepping
+  if (!m_initial) m_families = families( rinpoel );
+
   // Update mesh and solution after refinement
-  newVolMesh( old, ref );
+  newVolMesh( added, removed );
   newBndMesh( ref );
 
+  // Find nodes of cells that were not in the old mesh, i.e., children of
+  // refined and parents of derefined cells, whose surrounding cells changed
+  TetSet oldtets;
+  for (std::size_t e=0; e<rinpoel.size()/4; ++e)
+    oldtets.insert( {{ rinpoel[e*4+0], rinpoel[e*4+1],
+                       rinpoel[e*4+2], rinpoel[e*4+3] }} );
+  tk::destroy( m_changedNodes );
+  for (std::size_t e=0; e<refinpoel.size()/4; ++e) {
+    Tet t{{ refinpoel[e*4+0], refinpoel[e*4+1],
+            refinpoel[e*4+2], refinpoel[e*4+3] }};
+    if (oldtets.find(t) == end(oldtets))
+      for (auto r : t) m_changedNodes.push_back( tk::cref_find(m_lref,r) );
+  }
+  tk::unique( m_changedNodes );
+
   // Update mesh connectivity from refiner lib, remapping refiner to local ids
   m_inpoel = m_refiner.tet_store.get_active_inpoel();
   tk::remap( m_inpoel, m_lref );
@@ -1302,120 +1601,227 @@ Refiner::updateMesh()
           "Mesh not conforming after updating mesh after mesh refinement" );
 }
 
+tk::CellFamilies
+Refiner::families( const std::vector< std::size_t >& rinpoel )
+// *****************************************************************************
+//  Find cell families relating the old and new meshes after mesh refinement
+//! \param[in] rinpoel Old mesh connectivity with refiner lib node ids
+//! \return Cell families relating the cells of the old and new meshes, whose
+//!   node ids are old local ids
+//! \details The family of a new cell not in the old mesh is the new cell
+//!   itself if it is the parent of old cells, i.e., if it has been derefined,
+//!   or otherwise its parent, which is either an old cell, i.e., it has been
+//!   refined, or the parent of old cells, i.e., its refinement pattern has
+//!   changed. The parents of old cells are looked up in the child->parent map
+//!   of the old mesh, so this must be called before that is regenerated by
+//!   boundary().
+// *****************************************************************************
+{
+  auto& tet_store = m_refiner.tet_store;
+
+  // Generate old cell ids and refiner lib -> old local node ids
+  std::unordered_map< Tet, std::size_t, Hash<4>, Eq<4> > oldcell;
+  std::unordered_map< std::size_t, std::size_t > oldlid;
+  for (std::size_t e=0; e<rinpoel.size()/4; ++e) {
+    Tet t{{ rinpoel[e*4+0], rinpoel[e*4+1], rinpoel[e*4+2], rinpoel[e*4+3] }};
+    oldcell[ t ] = e;
+    for (std::size_t i=0; i<4; ++i) oldlid[ t[i] ] = m_inpoel[e*4+i];
+  }
+
+  // Group old cells by their parents
+  std::unordered_map< Tet, std::vector< std::size_t >, Hash<4>, Eq<4> >
+    oldchildren;
+  for (const auto& [ t, e ] : oldcell) {
+    auto p = m_parent.find( t );
+    if (p != end(m_parent)) oldchildren[ p->second ].push_back( e );
+  }
+
+  // Find the families of new cells not in the old mesh, visiting the active
+  // cells in the same order as get_active_inpoel()
+  tk::CellFamilies f;
+  std::unordered_map< Tet, std::vector< std::size_t >, Hash<4>, Eq<4> > fam;
+  std::size_t e = 0;
+  for (const auto& [ id, t ] : tet_store.tets) {
+    if (!tet_store.is_active( id )) continue;
+    auto o = oldcell.find( t );
+    if (o != end(oldcell)) {
+      f.kept.push_back( o->second );
+    } else {
+      f.kept.push_back( std::numeric_limits< std::size_t >::max() );
+      if (oldchildren.find( t ) != end(oldchildren)) {
+        fam[ t ].push_back( e );
+      } else {
+        Assert( tet_store.data( id ).refinement_level > 0,
+                "New cell without parent not in old mesh" );
+        fam[ tet_store.get( tet_store.get_parent_id( id ) ) ].push_back( e );
+      }
+    }
+    ++e;
+  }
+
+  for (auto& [ t, tgt ] : fam) {
+    std::vector< std::size_t > src;
+    auto o = oldcell.find( t );
+    if (o != end(oldcell))
+      src.push_back( o->second );
+    else
+      src = tk::cref_find( oldchildren, t );
+    std::sort( begin(src), end(src) );
+    std::sort( begin(tgt), end(tgt) );
+    Tet n{{ tk::cref_find( oldlid, t[0] ), tk::cref_find( oldlid, t[1] ),
+            tk::cref_find( oldlid, t[2] ), tk::cref_find( oldlid, t[3] ) }};
+    f.add( n, src, tgt );
+  }
+
+  return f;
+}
+
 void
-Refiner::newVolMesh( const std::unordered_set< std::size_t >& old,
-                     const std::unordered_set< std::size_t >& ref )
+Refiner::newVolMesh( const std::vector< std::size_t >& added,
+                     const std::vector< std::size_t >& removed )
 // *****************************************************************************
 //  Compute new volume mesh after mesh refinement
-//! \param[in] old Unique nodes of the old (unrefined) mesh using local ids
-//! \param[in] ref Unique nodes of the refined mesh using local ids
+//! \param[in] added Nodes added by refinement, refiner lib ids in ascending
+//!   order
+//! \param[in] removed Nodes removed by derefinement, refiner lib ids
+//! \details Newly added nodes are appended to the nodes kept, in the order of
+//!   their refiner lib ids, so they are numbered contiguously and the order of
+//!   the nodes kept, and thus the locality of the data associated to them, is
+//!   preserved. If no node is removed, the id maps and coordinates of the nodes
+//!   kept are left alone and only those of the newly added nodes are appended.
+//!   Otherwise the id maps and coordinates are compacted.
 // *****************************************************************************
 {
   const auto& x = m_coord[0];
   const auto& y = m_coord[1];
   const auto& z = m_coord[2];
 
+  auto npoin = m_gid.size();
+
   // Generate coordinates and ids to newly added nodes after refinement
-  std::unordered_map< std::size_t, std::size_t > gid_add;
+  std::vector< std::pair< std::size_t, std::size_t > > gid_add;
+  std::vector< std::array< tk::real, 3 > > coord_add;
   tk::destroy( m_addedNodes );
-  for (auto r : ref) {               // for all unique nodes of the refined mesh
-    if (old.find(r) == end(old)) {   // if node is newly added
-      // get (local) parent ids of newly added node
-      auto p = m_refiner.node_connectivity.get( r );
-      Assert( old.find(p[0]) != end(old) && old.find(p[1]) != end(old),
-              "Parent(s) not in old mesh" );
-      Assert( r >= old.size(), "Attempting to overwrite node with added one" );
-      // local parent ids
-      decltype(p) lp{{tk::cref_find(m_lref,p[0]), tk::cref_find(m_lref,p[1])}};
-      // global parent ids
-      decltype(p) gp{{m_gid[lp[0]], m_gid[lp[1]]}};
-      // generate new global ID for newly added node
-      auto g = Hash<2>()( gp );
-
-      // if node added by AMR lib has not yet been added to Refiner's new mesh
-      if (m_coordmap.find(g) == end(m_coordmap)) {
-        Assert( g >= old.size(), "Hashed id overwriting old id" );
-        Assert( m_lid.find(g) == end(m_lid),
-                "Overwriting entry global->local node ID map" );
-        Assert( m_coordmap.find(g) == end(m_coordmap),
-                "Overwriting entry already in coordmap" );
-        auto l = tk::cref_find( m_lref, r );
-        // store newly added node id and their parent ids (local ids)
-        m_addedNodes[r] = lp;   // key = r for later update to local
-        // assign new node to refiner->global map
-        gid_add[r] = g; // key = r for later search
-        // assign new node to global->local map
-        m_lid[g] = l;
-        // generate and store coordinates for newly added node
-        m_coordmap.insert( {g, {{ (x[lp[0]] + x[lp[1]])/2.0,
-                                  (y[lp[0]] + y[lp[1]])/2.0,
-                                  (z[lp[0]] + z[lp[1]])/2.0 }} } );
-      }
+  for (auto r : added) {             // for all newly added nodes
+    // get (local) parent ids of newly added node
+    auto p = m_refiner.node_connectivity.get( r );
+    Assert( m_lref.find(p[0]) != end(m_lref) &&
+            m_lref.find(p[1]) != end(m_lref), "Parent(s) not in old mesh" );
+    Assert( r >= npoin, "Attempting to overwrite node with added one" );
+    // local parent ids
+    decltype(p) lp{{tk::cref_find(m_lref,p[0]), tk::cref_find(m_lref,p[1])}};
+    Assert( lp[0] < npoin && lp[1] < npoin, "Parent(s) not in old mesh" );
+    // global parent ids
+    decltype(p) gp{{m_gid[lp[0]], m_gid[lp[1]]}};
+    // generate new global ID for newly added node
+    auto g = Hash<2>()( gp );
+
+    // if node added by AMR lib has not yet been added to Refiner's new mesh
+    if (m_coordmap.find(g) == end(m_coordmap)) {
+      Assert( g >= npoin, "Hashed id overwriting old id" );
+      Assert( m_lid.find(g) == end(m_lid),
+              "Overwriting entry global->local node ID map" );
+      auto l = tk::cref_find( m_lref, r );
+      // store newly added node id and their parent ids (local ids)
+      m_addedNodes[r] = lp;   // key = r for later update to local
+      // assign new node to refiner->global map
+      gid_add.emplace_back( r, g );
+      // assign new node to global->local map
+      m_lid[g] = l;
+      // generate and store coordinates for newly added node
+      coord_add.push_back( {{ (x[lp[0]] + x[lp[1]])/2.0,
+                              (y[lp[0]] + y[lp[1]])/2.0,
+                              (z[lp[0]] + z[lp[1]])/2.0 }} );
+      m_coordmap.insert( { g, coord_add.back() } );
     }
   }
-  tk::destroy( m_coord );
 
-  // Remove coordinates and ids of removed nodes due to derefinement
-  std::unordered_map< std::size_t, std::size_t > gid_rem;
-  for (auto o : old) {               // for all unique nodes of the old mesh
-    if (ref.find(o) == end(ref)) {   // if node is no longer in new mesh
+  // Save previous states of refiner-local node id maps before update
+  m_oldrid = m_rid;
+  //m_oldlref = m_lref;
+
+  auto& rx = m_coord[0];
+  auto& ry = m_coord[1];
+  auto& rz = m_coord[2];
+
+  if (removed.empty() && gid_add.size() == added.size()) {
+
+    // Fast path (refinement only): the local ids of the nodes kept do not
+    // change and the newly added nodes already got their local ids, see
+    // updateMesh(), so only append the ids and coordinates of added nodes
+    decltype(m_addedNodes) addedNodes( m_addedNodes.size() );
+    for (std::size_t i=0; i<gid_add.size(); ++i) {
+      auto [r,g] = gid_add[i];
+      Assert( tk::cref_find(m_lref,r) == m_gid.size(), "Local id mismatch" );
+      m_gid.push_back( g );
+      m_rid.push_back( r );
+      rx.push_back( coord_add[i][0] );
+      ry.push_back( coord_add[i][1] );
+      rz.push_back( coord_add[i][2] );
+      auto it = m_addedNodes.find( r );
+      Assert( it != end(m_addedNodes), "Cannot find added node" );
+      addedNodes[ m_gid.size()-1 ] = std::move(it->second);
+    }
+    m_addedNodes = std::move( addedNodes );
+
+  } else {
+
+    tk::destroy( m_coord );
+
+    // Remove coordinates and ids of removed nodes due to derefinement
+    std::vector< char > rem( npoin, 0 );
+    for (auto o : removed) {         // for all nodes no longer in new mesh
       auto l = tk::cref_find( m_lref, o );
       auto g = m_gid[l];
-      gid_rem[l] = g;
+      rem[l] = 1;
       m_lid.erase( g );
       m_coordmap.erase( g );
     }
-  }
-
-  // Save previous states of refiner-local node id maps before update
-  m_oldrid = m_rid;
-  //m_oldlref = m_lref;
 
-  // Generate new node id maps for nodes kept
-  tk::destroy( m_lref );
-  std::vector< std::size_t > rid( ref.size() );
-  std::vector< std::size_t > gid( ref.size() );
-  std::size_t l = 0;    // will generate new local node id
-  for (std::size_t i=0; i<m_gid.size(); ++i) {
-    if (gid_rem.find(i) == end(gid_rem)) {
-      gid[l] = m_gid[i];
-      rid[l] = m_rid[i];
-      m_lref[ m_rid[i] ] = l;
+    // Generate new node id maps for nodes kept
+    auto nref = npoin - removed.size() + gid_add.size();
+    tk::destroy( m_lref );
+    std::vector< std::size_t > rid( nref );
+    std::vector< std::size_t > gid( nref );
+    std::size_t l = 0;    // will generate new local node id
+    for (std::size_t i=0; i<npoin; ++i) {
+      if (!rem[i]) {
+        gid[l] = m_gid[i];
+        rid[l] = m_rid[i];
+        m_lref[ m_rid[i] ] = l;
+        ++l;
+      }
+    }
+    // Add newly added nodes due to refinement to node id maps
+    decltype(m_addedNodes) addedNodes( m_addedNodes.size() );
+    for (const auto& [r,g] : gid_add) {
+      gid[l] = g;
+      rid[l] = r;
+      m_lref[r] = l;
+      auto it = m_addedNodes.find( r );
+      Assert( it != end(m_addedNodes), "Cannot find added node" );
+      addedNodes[l] = std::move(it->second);
       ++l;
     }
-  }
-  // Add newly added nodes due to refinement to node id maps
-  decltype(m_addedNodes) addedNodes( m_addedNodes.size() );
-  for (const auto& n : gid_add) {
-    auto r = n.first;
-    auto g = n.second;
-    gid[l] = g;
-    rid[l] = r;
-    m_lref[r] = l;
-    auto it = m_addedNodes.find( r );
-    Assert( it != end(m_addedNodes), "Cannot find added node" );
-    addedNodes[l] = std::move(it->second);
-    ++l;
-  }
-  Assert( m_lref.size() == ref.size(), "Size mismatch" );
-  m_rid = std::move( rid );
-  m_addedNodes = std::move( addedNodes );
+    Assert( m_lref.size() == nref, "Size mismatch" );
+    m_rid = std::move( rid );
+    m_addedNodes = std::move( addedNodes );
+
+    // Update node coordinates, ids, and id maps
+    rx.resize( nref );
+    ry.resize( nref );
+    rz.resize( nref );
+    for (std::size_t i=0; i<gid.size(); ++i) {
+      tk::ref_find( m_lid, gid[i] ) = i;
+      const auto& c = tk::cref_find( m_coordmap, gid[i] );
+      rx[i] = c[0];
+      ry[i] = c[1];
+      rz[i] = c[2];
+    }
+    m_gid = std::move( gid );
 
-  // Update node coordinates, ids, and id maps
-  auto& rx = m_coord[0];
-  auto& ry = m_coord[1];
-  auto& rz = m_coord[2];
-  rx.resize( ref.size() );
-  ry.resize( ref.size() );
-  rz.resize( ref.size() );
-  for (std::size_t i=0; i<gid.size(); ++i) {
-    tk::ref_find( m_lid, gid[i] ) = i;
-    const auto& c = tk::cref_find( m_coordmap, gid[i] );
-    rx[i] = c[0];
-    ry[i] = c[1];
-    rz[i] = c[2];
   }
-  m_gid = std::move( gid );
+
   Assert( m_gid.size() == m_lid.size(), "Size mismatch" );
 }
 
@@ -1513,11 +1919,8 @@ Refiner::boundary()
     }
   }
 
-  // Generate child->parent tet and id maps after refinement/derefinement step
+  // Generate child->parent tet map after refinement/derefinement step
   tk::destroy( m_parent );
-  m_addedTets.clear();
-  std::size_t p = 0;
-  std::size_t c = 0;
   const auto& tet_store = m_refiner.tet_store;
   for (const auto& t : tet_store.tets) {
     // query number of children of tet
@@ -1538,14 +1941,9 @@ Refiner::boundary()
       // assign parent tet to child tet
       //m_parent[ {{cA,cB,cC,cD}} ] = {{pA,pB,pC,pD}};
       m_parent[ ct->second ] = t.second; //{{pA,pB,pC,pD}};
-      if (m_oldTets.find(ct->second) == end(m_oldTets)) {
-        m_addedTets[ c++ ] = p - m_oldntets;
-      }
     }
-    ++p;
   }
 
-  //std::cout << thisIndex << " added: " << m_addedTets.size() << '\n';
   //std::cout << thisIndex << " parent: " << m_parent.size() << '\n';
   //std::cout << thisIndex << " pcret: " << pcReFaceTets.size() << '\n';
   //std::cout << thisIndex << " pcdet: " << pcDeFaceTets.size() << '\n';
@@ -1564,10 +1962,11 @@ Refiner::boundary()
 }
 
 void
-Refiner::newBndMesh( const std::unordered_set< std::size_t >& ref )
+Refiner::newBndMesh( const std::vector< char >& ref )
 // *****************************************************************************
 // Update boundary data structures after mesh refinement
-//! \param[in] ref Unique nodes of the refined mesh using local ids
+//! \param[in] ref Flags, one per refiner lib node id, 1 for nodes of the
+//!   refined mesh
 // *****************************************************************************
 {
   // Generate boundary face data structures used to regenerate boundary face
@@ -1581,11 +1980,12 @@ Refiner::newBndMesh( const std::unordered_set< std::size_t >& ref )
 
 void
 Refiner::updateBndFaces(
-  [[maybe_unused]] const std::unordered_set< std::size_t >& ref,
+  [[maybe_unused]] const std::vector< char >& ref,
   const BndFaceData& bnd )
 // *****************************************************************************
 // Regenerate boundary faces after mesh refinement step
-//! \param[in] ref Unique nodes of the refined mesh using local ids
+//! \param[in] ref Flags, one per refiner lib node id, 1 for nodes of the
+//!   refined mesh
 //! \param[in] bnd Boundary face data bundle
 // *****************************************************************************
 {
@@ -1638,7 +2038,7 @@ Refiner::updateBndFaces(
           Assert( ct != end(tets), "Child tet not found" );
           // ensure all nodes of child tet are in refined mesh
           Assert( std::all_of( begin(ct->second), end(ct->second),
-                    [&]( std::size_t n ){ return ref.find(n) != end(ref); } ),
+                    [&]( std::size_t n ){ return n < ref.size() && ref[n]; } ),
                   "Boundary child tet node id not found in refined mesh" );
           // get nodes of child tet
           auto A = tk::cref_find( m_lref, ct->second[0] );
@@ -1752,11 +2152,12 @@ Refiner::bndIntegral()
 
 void
 Refiner::updateBndNodes(
-  [[maybe_unused]] const std::unordered_set< std::size_t >& ref,
+  [[maybe_unused]] const std::vector< char >& ref,
   const BndFaceData& bnd )
 // *****************************************************************************
 // Update boundary nodes after mesh refinement
-//! \param[in] ref Unique nodes of the refined mesh using local ids
+//! \param[in] ref Flags, one per refiner lib node id, 1 for nodes of the
+//!   refined mesh
 //! \param[in] bnd Boundary face data bundle
 // *****************************************************************************
 {
@@ -1823,7 +2224,7 @@ Refiner::updateBndNodes(
         Assert( ct != end(tets), "Child tet not found" );
         // ensure all nodes of child tet are in refined mesh
         Assert( std::all_of( begin(ct->second), end(ct->second),
-                  [&]( std::size_t n ){ return ref.find(n) != end(ref); } ),
+                  [&]( std::size_t n ){ return n < ref.size() && ref[n]; } ),
                 "Boundary child tet node id not found in refined mesh" );
         // search each child tet of refined boundary tet and add their boundary
         // nodes to the side set(s) of their parent (in coarse mesh) nodes
@@ -18,6 +18,7 @@
 #ifndef Refiner_h
 #define Refiner_h
 
+#include <array>
 #include <vector>
 #include <unordered_map>
 
@@ -29,11 +30,13 @@
 #include "Callback.hpp"
 #include "UnsMesh.hpp"
 #include "Base/Fields.hpp"
+#include "Integrate/Transfer.hpp"
 #include "Scheme.hpp"
 #include "DiagCG.hpp"
 #include "ALECG.hpp"
 #include "DG.hpp"
 #include "CommMap.hpp"
+#include "CommCounter.hpp"
 
 #include "NoWarning/transporter.decl.h"
 #include "NoWarning/refiner.decl.h"
@@ -60,9 +63,6 @@ class Refiner : public CBase_Refiner {
       std::unordered_map< int, FaceSet >
     >;
 
-    //! Used to associate error to edges
-    using EdgeError = std::unordered_map< Edge, tk::real, Hash<2>, Eq<2> >;
-
 
   public:
     //! Constructor
@@ -130,6 +130,9 @@ class Refiner : public CBase_Refiner {
     //! Communicate refined edges after a refinement/derefinement step
     void comExtra();
 
+    //! Finish neighbor-only correction of chare-boundary edges
+    void quiescent();
+
     //! Perform mesh refinement and decide how to continue
     void perform();
 
@@ -173,6 +176,7 @@ class Refiner : public CBase_Refiner {
       p | m_nref;
       p | m_nbnd;
       p | m_extra;
+      p | m_qd;
       p | m_ch;
       p | m_edgech;
       p | m_chedge;
@@ -181,10 +185,9 @@ class Refiner : public CBase_Refiner {
       p | m_remoteEdges;
       p | m_intermediates;
       p | m_nodeCommMap;
-      p | m_oldTets;
       p | m_addedNodes;
-      p | m_addedTets;
-      p | m_oldntets;
+      p | m_families;
+      p | m_changedNodes;
       p | m_coarseBndFaces;
       p | m_coarseBndNodes;
       p | m_rid;
@@ -192,6 +195,7 @@ class Refiner : public CBase_Refiner {
       p | m_lref;
       //p | m_oldlref;
       p | m_parent;
+      p | m_comm;
     }
     //! \brief Pack/Unpack serialize operator|
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
@@ -199,6 +203,18 @@ class Refiner : public CBase_Refiner {
     friend void operator|( PUP::er& p, Refiner& r ) { r.pup(p); }
     //@}
 
+    //! \brief Half-world coordinates configured for coordinate-based
+    //!   refinement: x-, x+, y-, y+, z-, z+, each with whether it is set
+    using HalfWorld = std::array< std::pair< bool, tk::real >, 6 >;
+
+    //! Query half-world coordinates configured for coordinate-based refinement
+    static HalfWorld halfworld();
+
+    //! Query if an edge is tagged by coordinate-based refinement
+    static bool halfworldTag( const HalfWorld& hw,
+                              const std::array< tk::real, 3 >& p,
+                              const std::array< tk::real, 3 >& q );
+
   private:
     //! Host proxy
     CProxy_Transporter m_host;
@@ -252,6 +268,9 @@ class Refiner : public CBase_Refiner {
     std::size_t m_nbnd;
     //! Number of chare-boundary newly added nodes that need correction
     std::size_t m_extra;
+    //! \brief State of neighbor-only correction of chare-boundary edges: 0:
+    //!   not used, 1: waiting for our own edges tagged, 2: correcting
+    int m_qd;
     //! Chares we share at least a single edge with
     std::unordered_set< int > m_ch;
     //! Edge->chare map used to build shared boundary edges
@@ -270,14 +289,13 @@ class Refiner : public CBase_Refiner {
     //! \brief Global mesh node IDs bordering the mesh chunk held by fellow
     //!    worker chares associated to their chare IDs for the coarse mesh
     tk::NodeCommMap m_nodeCommMap;
-    //! Tetrahedra before refinement/derefinement step
-    TetSet m_oldTets;
     //! Newly added mesh nodes (local id) and their parents (local ids)
     std::unordered_map< std::size_t, Edge > m_addedNodes;
-    //! Newly added mesh cells (local id) and their parent (local id)
-    std::unordered_map< std::size_t, std::size_t > m_addedTets;
-    //! Number of tetrahedra in the mesh before refinement/derefinement step
-    std::size_t m_oldntets;
+    //! Cell families relating the cells before and after the last step
+    tk::CellFamilies m_families;
+    //! \brief Nodes (local ids) of mesh cells added by the last refinement
+    //!   or derefinement step, i.e., nodes whose surrounding cells changed
+    std::vector< std::size_t > m_changedNodes;
     //! A unique set of faces associated to side sets of the coarsest mesh
     std::unordered_map< int, FaceSet > m_coarseBndFaces;
     //! A unique set of nodes associated to side sets of the coarsest mesh
@@ -292,6 +310,11 @@ class Refiner : public CBase_Refiner {
     //std::unordered_map< std::size_t, std::size_t > m_oldlref;
     //! Child -> parent tet map
     std::unordered_map< Tet, Tet, Hash<4>, Eq<4> > m_parent;
+    //! Counters of messages and bytes communicated with fellow chares
+    CommCounter m_comm;
+    //! \brief Wall-clock time stamp at construction, used to time initial
+    //!   mesh refinement, not migrated since only used during setup
+    tk::real m_setupt0;
 
     //! (Re-)generate boundary data structures for coarse mesh
     void coarseBnd();
@@ -318,17 +341,27 @@ class Refiner : public CBase_Refiner {
     void errorRefine();
 
     //! Compute errors in edges
-    EdgeError
-    errorsInEdges( std::size_t npoin,
+    std::vector< tk::real >
+    errorsInEdges( const std::vector< std::size_t >& inpoed,
                    const std::pair< std::vector< std::size_t >,
                                     std::vector< std::size_t > >& esup,
                    const tk::Fields& u ) const;
 
+    //! Extend edges tagged for refinement into buffer zones
+    void bufferEdges( const std::vector< std::size_t >& inpoed,
+                      const tk::Fields& u,
+                      std::vector< char >& ref ) const;
+
+    //! Extract velocity from the solution of the first system of equations
+    std::array< std::vector< tk::real >, 3 >
+    velocity( const tk::Fields& u ) const;
+
     //! Update (or evaluate) solution on current mesh
-    tk::Fields
+    const tk::Fields&
     solution( std::size_t npoin,
               const std::pair< std::vector< std::size_t >,
-                               std::vector< std::size_t > >& esup ) const;
+                               std::vector< std::size_t > >& esup,
+              tk::Fields& init ) const;
 
     //! Do mesh refinement based on user explicitly tagging edges
     void edgelistRefine();
@@ -336,6 +369,21 @@ class Refiner : public CBase_Refiner {
     //! Do mesh refinement based on tagging edges based on end-point coordinates
     void coordRefine();
 
+    //! Send our edges and intermediates to all chares we share edges with
+    void exportEdges();
+
+    //! Correct our chare-boundary edges based on edge data from a fellow chare
+    void correctEdges(
+      const std::vector< std::tuple< Edge, int, AMR::Edge_Lock_Case > >&
+        edgedata,
+      AMR::EdgeData& extra );
+
+    //! Correct our edges based on the latest edge data from fellow chares
+    bool correctNeighbors( const std::vector< int >& from );
+
+    //! Query if chare-boundary edges are corrected among neighbors only
+    bool qdcorr() const;
+
     //! Query AMR lib and update our local store of edge data
     void updateEdgeData();
 
@@ -345,23 +393,26 @@ class Refiner : public CBase_Refiner {
     //! Update old mesh after refinement
     void updateMesh();
 
+    //! Find cell families relating the old and new meshes after refinement
+    tk::CellFamilies families( const std::vector< std::size_t >& rinpoel );
+
     //! Update volume mesh after mesh refinement
-    void newVolMesh( const std::unordered_set< std::size_t >& old,
-                     const std::unordered_set< std::size_t >& ref );
+    void newVolMesh( const std::vector< std::size_t >& added,
+                     const std::vector< std::size_t >& removed );
 
     //! Update boundary data structures after mesh refinement
-    void newBndMesh( const std::unordered_set< std::size_t >& ref );
+    void newBndMesh( const std::vector< char >& ref );
 
     //! \brief Generate boundary data structures used to update
     //!   refined/derefined boundary faces and nodes of side sets
     BndFaceData boundary();
 
     //! Regenerate boundary faces after mesh refinement/derefinement step
-    void updateBndFaces( const std::unordered_set< std::size_t >& ref,
+    void updateBndFaces( const std::vector< char >& ref,
                          const BndFaceData& bnd );
 
     //! Regenerate boundary nodes after mesh refinement/derefinement step
-    void updateBndNodes( const std::unordered_set< std::size_t >& ref,
+    void updateBndNodes( const std::vector< char >& ref,
                          const BndFaceData& bnd );
 
     //! Evaluate initial conditions (IC) at mesh nodes
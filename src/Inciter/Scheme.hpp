@@ -147,6 +147,7 @@ class Scheme {
     struct diag {};
     struct evalLB {};
     struct doneInserting {};
+    struct next {};
     //! Issue broadcast to Scheme entry method
     //! \tparam Fn Function tag identifying the entry method to call
     //! \tparam Args Types of arguments to pass to entry method
@@ -179,6 +180,8 @@ class Scheme {
             p.evalLB( std::forward< Args >( args )... );
           else if constexpr( std::is_same_v< Fn, doneInserting > )
             p.doneInserting( std::forward< Args >( args )... );
+          else if constexpr( std::is_same_v< Fn, next > )
+            p.next( std::forward< Args >( args )... );
         }, proxy );
     }
 
@@ -193,11 +196,12 @@ class Scheme {
     //! \details This function calls a member function via Charm++'s ckLocal()
     //!    behind the element proxy configured, indexed by the array index x.
     //!    Since the call is behind ckLocal(), the member function does not have
-    //!    to be a Charm++ entry method.
+    //!    to be a Charm++ entry method. References returned by the member
+    //!    function, e.g., to the solution, are passed through without a copy.
     template< typename Fn, typename... Args >
-    auto ckLocal( const CkArrayIndex1D& x, Args&&... args ) const {
+    decltype(auto) ckLocal( const CkArrayIndex1D& x, Args&&... args ) const {
       auto e = element( x );
-      return std::visit( [&]( auto& p ){
+      return std::visit( [&]( auto& p ) -> decltype(auto) {
           if constexpr( std::is_same_v< Fn, resizePostAMR > )
             return p.ckLocal()->resizePostAMR( std::forward<Args>(args)... );
           else if constexpr( std::is_same_v< Fn, solution > )
@@ -0,0 +1,73 @@
+// *****************************************************************************
+/*!
+  \file      src/Inciter/SetupReport.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Wall-clock time report of the setup phases
+  \details   Wall-clock time report of the setup phases. The objects that
+    perform the setup, i.e., the partitioner, the refiners, the sorters, and
+    the workers, measure the wall-clock time they spend in the phases they
+    perform, e.g., reading the mesh, partitioning, or computing boundary
+    normals, and contribute them to a single max-reduction per object, from
+    which the minimum and maximum times across the contributors are echoed to
+    screen. This helps finding out which of the phases dominate the startup
+    time on large meshes.
+*/
+// *****************************************************************************
+#ifndef SetupReport_h
+#define SetupReport_h
+
+#include <array>
+#include <limits>
+#include <vector>
+#include <utility>
+#include <initializer_list>
+
+#include "Types.hpp"
+
+namespace inciter {
+
+//! Setup phases timed
+enum SetupPhase : std::size_t { TREAD=0,        //!< Mesh read
+                                TCENTROID,      //!< Cell centroids
+                                TPARTITION,     //!< Mesh partitioning
+                                TDISTRIBUTE,    //!< Mesh distribution
+                                TREFINE,        //!< Initial mesh refinement
+                                TREORDER,       //!< Mesh node reordering
+                                TVOL,           //!< Nodal volumes
+                                TDERIVED,       //!< Derived data of workers
+                                TNORM,          //!< Boundary normals
+                                TGHOST,         //!< Face adjacency, ghosts
+                                TOUTPUT,        //!< First field output
+                                NUMSETUP };     //!< Number of phases
+
+//! Names of setup phases timed
+const std::array< const char*, NUMSETUP > SetupName{{ "mesh read",
+  "centroids", "partitioning", "distribution", "refinement", "reordering",
+  "nodal volumes", "derived data", "boundary normals", "ghosts",
+  "first output" }};
+
+//! Assemble setup time report of a contributor
+//! \param[in] t Setup phases timed by the contributor and their wall-clock
+//!   times in seconds, negative if not timed
+//! \return Setup time report vector to be max-reduced, holding the time and
+//!   its negative for each phase, so that the reduction yields both the
+//!   maximum and the minimum across contributors. Phases not timed by the
+//!   contributor are set to the lowest value so they do not affect the result.
+inline std::vector< tk::real >
+setupreport( std::initializer_list< std::pair< SetupPhase, tk::real > > t ) {
+  std::vector< tk::real >
+    r( NUMSETUP*2, std::numeric_limits< tk::real >::lowest() );
+  for (const auto& [p,s] : t) {
+    if (s < 0.0) continue;
+    r[p*2+0] = s;
+    r[p*2+1] = -s;
+  }
+  return r;
+}
+
+} // inciter::
+
+#endif // SetupReport_h
@@ -17,6 +17,9 @@
 #include "Reorder.hpp"
 #include "DerivedData.hpp"
 #include "Inciter/InputDeck/InputDeck.hpp"
+#include "DiagReducer.hpp"
+#include "MemoryReport.hpp"
+#include "SetupReport.hpp"
 
 namespace inciter {
 
@@ -50,7 +53,10 @@ Sorter::Sorter( const CProxy_Transporter& transporter,
   m_bnode( bnode ),
   m_nchare( nchare ),
   m_nodeset( begin(ginpoel), end(ginpoel) ),
-  m_noffset( 0 ),
+  m_nuniq( 0 ),
+  m_scanning( false ),
+  m_scanround( 0 ),
+  m_scanrecv(),
   m_nodech(),
   m_chnode(),
   m_edgech(),
@@ -62,7 +68,9 @@ Sorter::Sorter( const CProxy_Transporter& transporter,
   m_newcoordmap(),
   m_reqnodes(),
   m_lower( 0 ),
-  m_upper( 0 )
+  m_upper( 0 ),
+  m_comm(),
+  m_setupt0( CkWallTimer() )
 // *****************************************************************************
 //  Constructor: prepare owned mesh node IDs for reordering
 //! \param[in] transporter Transporter (host) Charm++ proxy
@@ -86,6 +94,24 @@ Sorter::Sorter( const CProxy_Transporter& transporter,
           "Boundary face data structures inconsistent" );
 }
 
+bool
+Sorter::qdcomm()
+// *****************************************************************************
+//  Query if completion of the boundary queries and responses is detected by
+//  quiescence instead of receipts
+//! \return True if Transporter detects completion of query() and bnd() by
+//!   quiescence, in which case no receipts are sent back to the senders
+//! \details Each boundary query and response would otherwise be answered by a
+//!   receipt message, doubling the number of small messages of the setup. Since
+//!   the rounds are started by broadcasts from Transporter, all of their
+//!   messages are in flight or processed when quiescence detection starts.
+//!   Quiescence detection is not used if it is enabled by the user to catch
+//!   logic errors, since that would be triggered as well.
+// *****************************************************************************
+{
+  return !g_inputdeck.get< tag::cmd, tag::quiescence >();
+}
+
 void
 Sorter::setup( std::size_t npoin )
 // *****************************************************************************
@@ -155,14 +181,16 @@ Sorter::setup( std::size_t npoin )
   // for the data in the bin. These bins form a distributed table.  Note that
   // we only send data to those chares that have data to work on. The receiving
   // sides do not know in advance if they receive messages or not.  Completion
-  // is detected by having the receiver respond back and counting the responses
-  // on the sender side, i.e., this chare.
+  // is detected by quiescence, see qdcomm(), or by having the receiver respond
+  // back and counting the responses on the sender side, i.e., this chare.
   m_nbnd = chbnd.size();
-  if (m_nbnd == 0)
-    contribute( m_cbs.get< tag::queried >() );
-  else
-    for (const auto& [ targetchare, bnd ] : chbnd)
+  if (m_nbnd == 0) {
+    if (!qdcomm()) contribute( m_cbs.get< tag::queried >() );
+  } else
+    for (const auto& [ targetchare, bnd ] : chbnd) {
+      m_comm.sent( MSORTER, targetchare, thisIndex, bnd );
       thisProxy[ targetchare ].query( thisIndex, bnd );
+    }
 }
 
 void
@@ -174,6 +202,8 @@ Sorter::query( int fromch, const tk::AllCommMaps& bnd )
 //! \param[in] bnd Chare-boundary data from another chare
 // *****************************************************************************
 {
+  m_comm.received( MSORTER, fromch, bnd );
+
   // Store incoming nodes in node->chare and its inverse, chare->node, maps
   const auto& nodes = bnd.get< tag::node >();
   for (auto n : nodes) m_nodech[ n ].push_back( fromch );
@@ -185,7 +215,10 @@ Sorter::query( int fromch, const tk::AllCommMaps& bnd )
   m_chedge[ fromch ].insert( begin(edges), end(edges) );
 
   // Report back to chare message received from
-  thisProxy[ fromch ].recvquery();
+  if (!qdcomm()) {
+    m_comm.sent( MSORTER, fromch );
+    thisProxy[ fromch ].recvquery();
+  }
 }
 
 void
@@ -194,6 +227,7 @@ Sorter::recvquery()
 // Receive receipt of boundary node lists to query
 // *****************************************************************************
 {
+  m_comm.received( MSORTER );
   if (--m_nbnd == 0) contribute( m_cbs.get< tag::queried >() );
 }
 
@@ -228,14 +262,17 @@ Sorter::response()
   // This data form a distributed table and we only work on a chunk of it. Note
   // that we only send data back to those chares that have queried us. The
   // receiving sides do not know in advance if the receive messages or not.
-  // Completion is detected by having the receiver respond back and counting
-  // the responses on the sender side, i.e., this chare.
+  // Completion is detected by quiescence, see qdcomm(), or by having the
+  // receiver respond back and counting the responses on the sender side, i.e.,
+  // this chare.
   m_nbnd = exp.size();
-  if (m_nbnd == 0)
-    contribute( m_cbs.get< tag::responded >() );
-  else
-    for (const auto& [ targetchare, maps ] : exp)
+  if (m_nbnd == 0) {
+    if (!qdcomm()) contribute( m_cbs.get< tag::responded >() );
+  } else
+    for (const auto& [ targetchare, maps ] : exp) {
+      m_comm.sent( MSORTER, targetchare, thisIndex, maps );
       thisProxy[ targetchare ].bnd( thisIndex, maps );
+    }
 }
 
 void
@@ -246,6 +283,8 @@ Sorter::bnd( int fromch, const tk::CommMaps& msum )
 //! \param[in] msum Communication map(s) assembled by chare fromch
 // *****************************************************************************
 {
+  m_comm.received( MSORTER, fromch, msum );
+
   for (const auto& [ neighborchare, maps ] : msum) {
     auto& m = m_msum[ neighborchare ];
     const auto& nodemap = maps.get< tag::node >();
@@ -255,7 +294,10 @@ Sorter::bnd( int fromch, const tk::CommMaps& msum )
   }
 
   // Report back to chare message received from
-  thisProxy[ fromch ].recvbnd();
+  if (!qdcomm()) {
+    m_comm.sent( MSORTER, fromch );
+    thisProxy[ fromch ].recvbnd();
+  }
 }
 
 void
@@ -264,6 +306,7 @@ Sorter::recvbnd()
 // Receive receipt of boundary node communication map
 // *****************************************************************************
 {
+  m_comm.received( MSORTER );
   if (--m_nbnd == 0) contribute( m_cbs.get< tag::responded >() );
 }
 
@@ -306,25 +349,16 @@ Sorter::mask()
   // to chares only with lower IDs than thisIndex. That is because this chare
   // will need to receive new (reorderd) node IDs only from chares with lower
   // IDs than thisIndex during node reordering. Since it only stores data for
-  // lower chare IDs, it is asymmetric. Note that because of this algorithm the
-  // type of m_msum is an ordered map, because of the std::none_of() algorithm
-  // needs to look at ALL chares this chare potentially communicates nodes with
-  // that have lower chare IDs that thisIndex. Since the map is ordered, it can
-  // walk through from the beginning of m_msum until the outer loop variable c,
-  // which is the chare ID the outer loop works on in a given cycle.
-  for (auto c=m_msum.cbegin(); c!=m_msum.cend(); ++c)
-    if (thisIndex > c->first) {
-      auto& n = m_reordcomm[ c->first ];
-      for (auto j : c->second.get< tag::node >())
-        if (std::none_of( m_msum.cbegin(), c,
-             [j]( const auto& s ) {
-               const auto& nodemap = s.second.template get< tag::node >();
-               return nodemap.find(j) != end(nodemap); } ))
-        {
-          n.insert(j);
-        }
-      if (n.empty()) m_reordcomm.erase( c->first );
-    }
+  // lower chare IDs, it is asymmetric. A node shared with multiple lower chares
+  // is received from the lowest one, which assigns its new ID. Since m_msum is
+  // an ordered map, walking it from the beginning associates each node to the
+  // first, i.e., lowest, chare it is found at.
+  std::unordered_set< std::size_t > lower;
+  for (const auto& [ neighborchare, maps ] : m_msum) {
+    if (neighborchare >= thisIndex) break;
+    for (auto j : maps.get< tag::node >())
+      if (lower.insert(j).second) m_reordcomm[ neighborchare ].insert(j);
+  }
 
   // Count up total number of nodes this chare will need to receive
   auto nrecv = tk::sumvalsize( m_reordcomm );
@@ -332,37 +366,76 @@ Sorter::mask()
   if ( g_inputdeck.get< tag::cmd, tag::feedback >() ) m_host.chmask();
 
   // Compute number of mesh node IDs we will assign IDs to
-  auto nuniq = m_nodeset.size() - nrecv;
+  m_nuniq = m_nodeset.size() - nrecv;
+
+  // Start computing offsets for node reordering: send our partial sum for the
+  // first round of the prefix sum to the next chare
+  m_start = m_nuniq;
+  m_scanning = true;
+  if (thisIndex+1 < m_nchare) {
+    m_comm.sent( MSORTER, thisIndex+1, 0UL, m_start );
+    thisProxy[ thisIndex+1 ].prefix( 0, m_start );
+  }
+  scan();
+}
 
-  // Start computing offsets for node reordering
-  thisProxy.offset( thisIndex, nuniq );
+void
+Sorter::prefix( std::size_t round, std::size_t s )
+// *****************************************************************************
+//  Receive partial sum of the number of uniquely assigned global mesh node IDs
+//  from a chare with a lower index
+//! \param[in] round Prefix sum round the partial sum was sent in
+//! \param[in] s Sum of the number of mesh node IDs assigned by the (at most)
+//!   2^round chares below and including chare thisIndex-2^round
+//! \details Partial sums may arrive before this chare has started the prefix
+//!   sum or entered the round, so they are stored until used by scan().
+// *****************************************************************************
+{
+  m_comm.received( MSORTER, round, s );
+  m_scanrecv[ round ] = s;
+  if (m_scanning) scan();
 }
 
 void
-Sorter::offset( int c, std::size_t u )
+Sorter::scan()
 // *****************************************************************************
-//  Receive number of uniquely assigned global mesh node IDs from chares with
-//  lower IDs than thisIndex
-//! \param[in] c Chare ID
-//! \param[in] u Number of mesh node IDs chare c will assign IDs to
+//  Advance the parallel prefix sum computing the node reordering offset
 //! \details This function computes the offset each chare will need to start
-//!   assigning its new node IDs from. The offset for a chare is the
-//!   offset for the previous chare plus the number of node IDs the previous
-//!   chare (uniquely) assigns new IDs for minus the number of node IDs the
-//!   previous chare receives from others (lower chares). This is computed here
-//!   in a parallel/distributed fashion by each chare sending its number of node
-//!   IDs (that it uniquely assigns) to all chares. Note that each chare would
-//!   only need to send this information to chares with higher IDs, but instead
-//!   this function is called in a broadcast fashion, because that is more
-//!   efficient than individual calls to only chares with higher IDs. Therefore
-//!   when computing the offsets, we only count the lower chares. When this is
-//!   done, we have the precise asymmetric communication map as well as the
-//!   start offset on all chares and so we can start the distributed global mesh
-//!   node ID reordering.
+//!   assigning its new node IDs from. The offset for a chare is the sum of the
+//!   number of node IDs all lower chares (uniquely) assign new IDs to. This is
+//!   computed here as a parallel prefix sum (scan) across the chares in
+//!   log2(nchare) rounds: in round r each chare adds the partial sum received
+//!   from the chare 2^r lower than itself (if any) to its own and sends the
+//!   result to the chare 2^(r+1) higher than itself (if any). This only sends
+//!   O(nchare log nchare) messages, instead of broadcasting each chare's count
+//!   to all chares, i.e., O(nchare^2) messages. When this is done, we have the
+//!   precise asymmetric communication map as well as the start offset on all
+//!   chares and so we can start the distributed global mesh node ID
+//!   reordering.
 // *****************************************************************************
 {
-  if (c < thisIndex) m_start += u;
-  if (++m_noffset == m_nchare) reorder();
+  auto N = static_cast< std::size_t >( m_nchare );
+  auto me = static_cast< std::size_t >( thisIndex );
+
+  for (std::size_t d = 1UL << m_scanround; d < N; d <<= 1) {
+    if (me >= d) {
+      auto it = m_scanrecv.find( m_scanround );
+      if (it == end(m_scanrecv)) return;  // wait for partial sum of this round
+      m_start += it->second;
+      m_scanrecv.erase( it );
+    }
+    ++m_scanround;
+    if (2*d < N && me+2*d < N) {
+      const auto c = static_cast< int >( me+2*d );
+      m_comm.sent( MSORTER, c, m_scanround, m_start );
+      thisProxy[ c ].prefix( m_scanround, m_start );
+    }
+  }
+
+  // Convert inclusive partial sum to the offset of this chare
+  m_scanning = false;
+  m_start -= m_nuniq;
+  reorder();
 }
 
 void
@@ -378,8 +451,10 @@ Sorter::reorder()
   thisProxy[ thisIndex ].wait4prep();
 
   // Send out request for new global node IDs for nodes we do not reorder
-  for (const auto& [ targetchare, nodes ] : m_reordcomm)
+  for (const auto& [ targetchare, nodes ] : m_reordcomm) {
+    m_comm.sent( MSORTER, targetchare, thisIndex, nodes );
     thisProxy[ targetchare ].request( thisIndex, nodes );
+  }
 
   // Lambda to decide if node is assigned a new ID by this chare. If node is not
   // found in the asymmetric communication map, it is owned, i.e., this chare
@@ -418,6 +493,7 @@ Sorter::request( int c, const std::unordered_set< std::size_t >& nd )
 //! \param[in] nd Set of old node IDs whose new IDs are requested
 // *****************************************************************************
 {
+  m_comm.received( MSORTER, c, nd );
   // Queue up requesting chare and node IDs
   m_reqnodes.push_back( { c, nd } );
   // Trigger SDAG wait signaling that node IDs have been requested from us
@@ -439,6 +515,7 @@ Sorter::prepare()
       n.emplace( p,
         std::make_tuple( newid, tk::cref_find(m_newcoordmap,newid) ) );
     }
+    m_comm.sent( MSORTER, requestorchare, n );
     thisProxy[ requestorchare ].neworder( n );
   }
 
@@ -460,6 +537,8 @@ Sorter::neworder( const std::unordered_map< std::size_t,
 //! \param[in] nodes Map associating new to old node IDs
 // *****************************************************************************
 {
+  m_comm.received( MSORTER, nodes );
+
   // Store new node IDs associated to old ones, and node coordinates associated
   // to new node IDs.
   for (const auto& [ oldid, newnodes ] : nodes) {
@@ -553,6 +632,25 @@ Sorter::createDiscWorkers()
   m_scheme.disc()[ thisIndex ].insert( m_scheme.fct(), m_host, m_meshwriter,
     m_ginpoel, m_coordmap, m_msum, m_nchare );
 
+  // Account memory of the sorter and the reordered mesh
+  if (g_inputdeck.get< tag::cmd, tag::feedback >()) {
+    std::array< std::size_t, NUMMEM > b{};
+    b[MSORTER] = tk::bytes( m_nodeset, m_scanrecv, m_nodech, m_chnode,
+                            m_edgech, m_chedge, m_reordcomm, m_newnodes,
+                            m_newcoordmap, m_reqnodes );
+    b[MMESH] = tk::bytes( m_ginpoel, m_coordmap, m_bface, m_triinpoel,
+                          m_bnode );
+    for (const auto& [c,maps] : m_msum)
+      b[MCOMMAP] += tk::bytes( c, maps.get< tag::node >(),
+                               maps.get< tag::edge >() );
+    auto stream = serialize( memreport( MREORDERED, b ) );
+    contribute( stream.first, stream.second.get(), MemMerger,
+      CkCallback( CkIndex_Transporter::memory(nullptr), m_host ) );
+    contribute( setupreport( { { TREORDER, CkWallTimer() - m_setupt0 } } ),
+      CkReduction::max_double,
+      CkCallback( CkReductionTarget(Transporter,setuptime), m_host ) );
+  }
+
   contribute( m_cbs.get< tag::discinserted >() );
 }
 
@@ -566,6 +664,10 @@ Sorter::createWorkers()
   Assert( m_scheme.disc()[thisIndex].ckLocal() != nullptr,
           "About to pass nullptr" );
 
+  // Hand communication counts of mesh node reordering to the report
+  m_scheme.disc()[thisIndex].ckLocal()->Comm().merge( m_comm );
+  m_comm = CommCounter();
+
   // Create worker array element using Charm++ dynamic chare array element
   // insertion: 1st arg: chare id, other args: Discretization's child ctor args.
   // See also Charm++ manual, Sec. "Dynamic Insertion".
@@ -26,6 +26,7 @@
 #include "UnsMesh.hpp"
 #include "Scheme.hpp"
 #include "CommMap.hpp"
+#include "CommCounter.hpp"
 
 #include "NoWarning/transporter.decl.h"
 #include "NoWarning/sorter.decl.h"
@@ -86,6 +87,10 @@ class Sorter : public CBase_Sorter {
     //! Configure Charm++ reduction types
     static void registerReducers();
 
+    //! \brief Query if completion of the boundary queries and responses is
+    //!   detected by quiescence instead of receipts
+    static bool qdcomm();
+
     //! Setup chare mesh boundary node communication map
     void setup( std::size_t npoin );
     //! \brief Incoming query for a list mesh nodes for which this chare
@@ -103,9 +108,9 @@ class Sorter : public CBase_Sorter {
     //! Start reordering (if user enabled it)
     void start();
 
-    //! \brief Receive number of uniquely assigned global mesh node IDs from
-    //!   chares with lower indices
-    void offset( int c, std::size_t u );
+    //! \brief Receive partial sum of the number of uniquely assigned global
+    //!   mesh node IDs from a chare with a lower index
+    void prefix( std::size_t round, std::size_t s );
 
     //! Request new global node IDs for old node IDs
     void request( int c, const std::unordered_set< std::size_t >& nd );
@@ -144,7 +149,10 @@ class Sorter : public CBase_Sorter {
       p | m_bnode;
       p | m_nchare;
       p | m_nodeset;
-      p | m_noffset;
+      p | m_nuniq;
+      p | m_scanning;
+      p | m_scanround;
+      p | m_scanrecv;
       p | m_nodech;
       p | m_chnode;
       p | m_edgech;
@@ -157,6 +165,7 @@ class Sorter : public CBase_Sorter {
       p | m_reqnodes;
       p | m_lower;
       p | m_upper;
+      p | m_comm;
     }
     //! \brief Pack/Unpack serialize operator|
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
@@ -191,9 +200,14 @@ class Sorter : public CBase_Sorter {
     int m_nchare;
     //! Unique global node IDs chares on our PE will contribute to
     std::set< std::size_t > m_nodeset;
-    //! \brief Counter for the number of chares from which this chare has
-    //!   received node reordering offsets from
-    int m_noffset;
+    //! Number of mesh node IDs this chare assigns new IDs to
+    std::size_t m_nuniq;
+    //! True if this chare has started the parallel prefix sum of m_nuniq
+    bool m_scanning;
+    //! Current round of the parallel prefix sum of m_nuniq
+    std::size_t m_scanround;
+    //! Partial sums received from lower chares associated to prefix sum rounds
+    std::unordered_map< std::size_t, std::size_t > m_scanrecv;
     //! Node->chare map used to build boundary node communication maps
     std::unordered_map< std::size_t, std::vector< int > > m_nodech;
     //! Chare->node map used to build boundary node communication maps
@@ -225,10 +239,18 @@ class Sorter : public CBase_Sorter {
     std::size_t m_lower;
     //! Upper bound of node IDs this chare contributes to in a linear system
     std::size_t m_upper;
+    //! Counters of messages and bytes communicated with fellow chares
+    CommCounter m_comm;
+    //! \brief Wall-clock time stamp at construction, used to time mesh node
+    //!   reordering, not migrated since only used during setup
+    tk::real m_setupt0;
 
     //! Start preparing for mesh node reordering in parallel
     void mask();
 
+    //! Advance the parallel prefix sum computing the node reordering offset
+    void scan();
+
     //! Reorder global mesh node IDs
     void reorder();
 
@@ -21,6 +21,14 @@
 #include <unordered_set>
 #include <limits>
 #include <cmath>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <numeric>
+
+#include <sys/stat.h>
+#include <dirent.h>
 
 #include <brigand/algorithms/for_each.hpp>
 
@@ -38,8 +46,15 @@
 #include "NodeDiagnostics.hpp"
 #include "ElemDiagnostics.hpp"
 #include "DiagWriter.hpp"
+#include "DiagReducer.hpp"
+#include "MeshWriter.hpp"
+#include "PhaseTimer.hpp"
+#include "CommCounter.hpp"
+#include "MemoryReport.hpp"
+#include "SetupReport.hpp"
 #include "Callback.hpp"
 #include "CartesianProduct.hpp"
+#include "DtLevels.hpp"
 
 #include "NoWarning/inciter.decl.h"
 #include "NoWarning/partitioner.decl.h"
@@ -57,6 +72,32 @@ extern std::vector< DGPDE > g_dgpde;
 
 using inciter::Transporter;
 
+namespace inciter {
+
+//! Sum the sizes of the files in a directory and its subdirectories
+//! \param[in] dir Directory name
+//! \return Number of bytes in the files, 0 if the directory does not exist
+static std::size_t dirsize( const std::string& dir ) {
+  std::size_t bytes = 0;
+  auto d = opendir( dir.c_str() );
+  if (!d) return bytes;
+  while (auto e = readdir( d )) {
+    std::string name( e->d_name );
+    if (name == "." || name == "..") continue;
+    struct stat st;
+    auto path = dir + '/' + name;
+    if (stat( path.c_str(), &st ) != 0) continue;
+    if (S_ISDIR( st.st_mode ))
+      bytes += dirsize( path );
+    else
+      bytes += static_cast< std::size_t >( st.st_size );
+  }
+  closedir( d );
+  return bytes;
+}
+
+} // inciter::
+
 Transporter::Transporter() :
   m_nchare( 0 ),
   m_ncit( 0 ),
@@ -69,12 +110,18 @@ Transporter::Transporter() :
   m_sorter(),
   m_nelem( 0 ),
   m_npoin( 0 ),
+  m_meshcache(),
+  m_cached( false ),
+  m_cachenelem( 0 ),
   m_finished( 0 ),
+  m_inmemory( false ),
   m_meshvol( 0.0 ),
   m_minstat( {{ 0.0, 0.0, 0.0 }} ),
   m_maxstat( {{ 0.0, 0.0, 0.0 }} ),
   m_avgstat( {{ 0.0, 0.0, 0.0 }} ),
   m_timer(),
+  m_iodump( 0 ),
+  m_iowall( 0.0 ),
   m_progMesh( g_inputdeck.get< tag::cmd, tag::feedback >(),
               ProgMeshPrefix, ProgMeshLegend ),
   m_progWork( g_inputdeck.get< tag::cmd, tag::feedback >(),
@@ -180,6 +227,8 @@ Transporter::info( const InciterPrint& print )
                   g_inputdeck.get< tag::discr, tag::fcteps >() );
       print.item( "Clipping FCT",
                   g_inputdeck.get< tag::discr, tag::fctclip >() );
+      print.item( "Edge-based FCT mass diffusion",
+                  g_inputdeck.get< tag::discr, tag::fctedge >() );
     }
   } else if (scheme == ctr::SchemeType::DG ||
              scheme == ctr::SchemeType::P0P1 || scheme == ctr::SchemeType::DGP1 ||
@@ -189,10 +238,43 @@ Transporter::info( const InciterPrint& print )
   }
   print.item( "PE-locality mesh reordering",
               g_inputdeck.get< tag::discr, tag::pelocal_reorder >() );
-  print.item( "Operator-access mesh reordering",
+  print.item( "Local mesh node reordering",
               g_inputdeck.get< tag::discr, tag::operator_reorder >() );
+  if (g_inputdeck.get< tag::discr, tag::operator_reorder >())
+    print.Item< ctr::Reorder, tag::discr, tag::node_reorder >();
+  print.item( "Local mesh element reordering",
+              g_inputdeck.get< tag::discr, tag::elem_reorder >() );
+  if (scheme == ctr::SchemeType::ALECG)
+    print.item( "Fused edge flux and scatter",
+                g_inputdeck.get< tag::discr, tag::fused_edgeflux >() );
   auto steady = g_inputdeck.get< tag::discr, tag::steady_state >();
   print.item( "Local time stepping", steady );
+  auto implicit = g_inputdeck.get< tag::discr, tag::implicit >();
+  if (scheme != ctr::SchemeType::DiagCG) {
+    print.item( "Implicit (Newton-Krylov) time stepping", implicit );
+    if (implicit) {
+      print.item( "Maximum number of Krylov iterations",
+                  g_inputdeck.get< tag::discr, tag::krylov_maxit >() );
+      print.item( "Krylov relative convergence tolerance",
+                  g_inputdeck.get< tag::discr, tag::krylov_tol >() );
+    }
+  }
+  if (scheme == ctr::SchemeType::ALECG) {
+    if (steady && !implicit) {
+      auto mg = g_inputdeck.get< tag::discr, tag::multigrid >();
+      print.item( "Agglomeration multigrid", mg );
+      if (mg)
+        print.item( "Number of coarse multigrid levels",
+                    g_inputdeck.get< tag::discr, tag::mg_levels >() );
+      print.item( "Frozen gradients in later Runge-Kutta stages",
+                  g_inputdeck.get< tag::discr, tag::freeze_grad >() );
+      auto irs = g_inputdeck.get< tag::discr, tag::irs_sweeps >();
+      print.item( "Implicit residual smoothing sweeps", irs );
+      if (irs)
+        print.item( "Implicit residual smoothing coefficient",
+                    g_inputdeck.get< tag::discr, tag::irs_eps >() );
+    }
+  }
   if (steady) {
     print.item( "L2-norm residual convergence criterion",
                 g_inputdeck.get< tag::discr, tag::residual >() );
@@ -223,6 +305,8 @@ Transporter::info( const InciterPrint& print )
                 g_inputdeck.get< tag::pref, tag::ndofmax >() );
     print.item( "Tolerance",
                 g_inputdeck.get< tag::pref, tag::tolref >() );
+    print.item( "Frequency",
+                g_inputdeck.get< tag::pref, tag::dtfreq >() );
   }
 
   // Print out adaptive mesh refinement configuration
@@ -277,11 +361,19 @@ Transporter::info( const InciterPrint& print )
       print.item( "Mesh refinement frequency, t>0", dtfreq );
       print.item( "Uniform-only mesh refinement, t>0",
                   g_inputdeck.get< tag::amr, tag::dtref_uniform >() );
+      auto buffer = g_inputdeck.get< tag::amr, tag::buffer >();
+      if (buffer > 0)
+        print.item( "Refinement buffer edge layers, t>0", buffer );
     }
     print.item( "Refinement tolerance",
                 g_inputdeck.get< tag::amr, tag::tolref >() );
     print.item( "De-refinement tolerance",
                 g_inputdeck.get< tag::amr, tag::tolderef >() );
+    print.item( "Neighbor-only refinement correction",
+                g_inputdeck.get< tag::amr, tag::qdcorr >() );
+    auto lbimbalance = g_inputdeck.get< tag::amr, tag::lbimbalance >();
+    if (dtref && lbimbalance > 0.0)
+      print.item( "Load imbalance threshold, t>0", lbimbalance );
   }
 
   // Print I/O filenames
@@ -305,6 +397,17 @@ Transporter::info( const InciterPrint& print )
               g_inputdeck.get< tag::interval, tag::diag >() );
   print.item( "Checkpoint/restart",
               g_inputdeck.get< tag::cmd, tag::rsfreq >() );
+  if (g_inputdeck.get< tag::cmd, tag::memfreq >() > 0)
+    print.item( "In-memory checkpoint",
+                g_inputdeck.get< tag::cmd, tag::memfreq >() );
+
+  const auto iobench = g_inputdeck.get< tag::cmd, tag::iobench >();
+  if (iobench) {
+    print.section( "I/O benchmark" );
+    print.item( "Field outputs", iobench );
+    print.item( "Node and element fields per output",
+                g_inputdeck.get< tag::cmd, tag::iofields >() );
+  }
 
   const auto outsets = g_inputdeck.outsets();
   if (!outsets.empty()) {
@@ -381,6 +484,58 @@ Transporter::matchBCs( std::map< int, std::vector< std::size_t > >& bnd )
    return !bnd.empty();
  }
 
+std::string
+Transporter::meshCache(
+  const std::map< int, std::vector< std::size_t > >& bface,
+  const std::map< int, std::vector< std::size_t > >& bnode ) const
+// *****************************************************************************
+// Compute the file name prefix of the partitioned mesh cache
+//! \param[in] bface Boundary-faces mapped to side set ids used in the input
+//! \param[in] bnode Boundary-nodes mapped to side set ids used in the input
+//! \return File name prefix of the cache, composed of the user-configured
+//!   prefix and a key identifying the mesh and its partitioning, empty if the
+//!   cache is not used
+//! \details The key is the FNV-1a hash of everything the partitioned and
+//!   distributed mesh depends on: the mesh file (name, size, and modification
+//!   time), the side sets used by boundary conditions, the partitioning
+//!   configuration and virtualization, and the number of compute nodes and
+//!   PEs.
+// *****************************************************************************
+{
+  const auto& prefix = g_inputdeck.get< tag::discr, tag::meshcache >();
+  if (prefix.empty()) return {};
+
+  const auto& input = g_inputdeck.get< tag::cmd, tag::io, tag::input >();
+  struct stat st;
+  ErrChk( stat( input.c_str(), &st ) == 0, "Failed to stat file: " + input );
+
+  const auto& d = g_inputdeck.get< tag::discr >();
+  const auto alg = g_inputdeck.get< tag::selected, tag::partitioner >();
+  std::stringstream ss;
+  ss << std::setprecision( std::numeric_limits< tk::real >::max_digits10 )
+     << input << ' ' << st.st_size << ' ' << st.st_mtime << ' '
+     << CkNumNodes() << ' ' << CkNumPes() << ' '
+     << static_cast< int >( alg ) << ' '
+     << static_cast< int >( d.get< tag::scheme >() ) << ' '
+     << d.get< tag::bfaceweight >() << ' ' << d.get< tag::hierarchical >()
+     << ' ' << g_inputdeck.get< tag::cmd, tag::virtualization >() << ' '
+     << d.get< tag::autovirt >() << ' ' << d.get< tag::elemcost >() << ' '
+     << d.get< tag::msglatency >() << ' ' << d.get< tag::msgoverhead >()
+     << ' ' << d.get< tag::partfield >();
+  for (const auto& [ setid, faces ] : bface) ss << " f" << setid;
+  for (const auto& [ setid, nodes ] : bnode) ss << " n" << setid;
+
+  std::uint64_t h = 14695981039346656037UL;
+  for (auto c : ss.str()) {
+    h ^= static_cast< unsigned char >( c );
+    h *= 1099511628211UL;
+  }
+
+  std::stringstream key;
+  key << prefix << '.' << std::hex << std::setw(16) << std::setfill('0') << h;
+  return key.str();
+}
+
 void
 Transporter::createPartitioner()
 // *****************************************************************************
@@ -450,6 +605,15 @@ Transporter::createPartitioner()
     , CkCallback( CkReductionTarget(Transporter,workinserted), thisProxy )
   }};
 
+  // Find out if the partitioned mesh has been cached by a previous run: the
+  // meta file, written last, holds the number of mesh elements
+  m_meshcache = meshCache( bface, bnode );
+  if (!m_meshcache.empty()) {
+    std::ifstream meta( m_meshcache + ".meta" );
+    m_cached = static_cast< bool >( meta >> m_cachenelem );
+    if (m_cached) print.diag( "Loading partitioned mesh from cache" );
+  }
+
   // Start timer measuring preparation of the mesh for partitioning
   m_timer[ TimerTag::MESH_READ ];
 
@@ -466,12 +630,18 @@ Transporter::createPartitioner()
   m_meshwriter = tk::CProxy_MeshWriter::ckNew(
                     g_inputdeck.get< tag::selected, tag::filetype >(),
                     centering,
-                    g_inputdeck.get< tag::cmd, tag::benchmark >() );
+                    g_inputdeck.get< tag::cmd, tag::benchmark >() &&
+                      !g_inputdeck.get< tag::cmd, tag::iobench >(),
+                    g_inputdeck.get< tag::discr, tag::aggregate >(),
+                    g_inputdeck.get< tag::discr, tag::persistent >(),
+                    g_inputdeck.get< tag::discr, tag::compression >(),
+                    g_inputdeck.get< tag::discr, tag::lossytol >() );
 
   // Create mesh partitioner Charm++ chare nodegroup
   m_partitioner =
     CProxy_Partitioner::ckNew( cbp, cbr, cbs, thisProxy, m_refiner, m_sorter,
-                               m_meshwriter, m_scheme, bface, faces, bnode );
+                               m_meshwriter, m_scheme, bface, faces, bnode,
+                               m_meshcache, m_cached );
 }
 
 void
@@ -481,13 +651,30 @@ Transporter::load( std::size_t nelem )
 //! \param[in] nelem Total number of mesh elements (summed across all PEs)
 // *****************************************************************************
 {
-  // Compute load distribution given total work (nelem) and user-specified
-  // virtualization
+  // If the mesh is loaded from cache, the partitioners have not read it
+  if (m_cached) nelem = m_cachenelem; else m_cachenelem = nelem;
+
+  // Compute load distribution given total work (nelem) and user-specified or
+  // auto-tuned virtualization
+  const auto autovirt = g_inputdeck.get< tag::discr, tag::autovirt >();
+  auto virt = g_inputdeck.get< tag::cmd, tag::virtualization >();
+  if (autovirt) {
+    // Number of times per time step chares wait for their neighbors: ALECG
+    // exchanges gradients and right hand sides in each of its 3 stages,
+    // DiagCG exchanges right hand sides and 2 FCT quantities, DG exchanges
+    // the solution, its reconstruction, and limiting in each of its 3 stages
+    const auto scheme = g_inputdeck.get< tag::discr, tag::scheme >();
+    std::size_t nphase = scheme == ctr::SchemeType::ALECG ? 6 :
+                         scheme == ctr::SchemeType::DiagCG ? 3 : 9;
+    virt = tk::autoVirtualization( nelem, CkNumPes(),
+             g_inputdeck.get< tag::discr, tag::elemcost >(),
+             g_inputdeck.get< tag::discr, tag::msglatency >(),
+             g_inputdeck.get< tag::discr, tag::msgoverhead >(), nphase );
+  }
   uint64_t chunksize, remainder;
   m_nchare = static_cast<int>(
                tk::linearLoadDistributor(
-                 g_inputdeck.get< tag::cmd, tag::virtualization >(),
-                 nelem, CkNumPes(), chunksize, remainder ) );
+                 virt, nelem, CkNumPes(), chunksize, remainder ) );
 
   auto print = printer();
 
@@ -502,8 +689,10 @@ Transporter::load( std::size_t nelem )
 
   // Print out info on load distribution
   print.section( "Initial load distribution" );
-  print.item( "Virtualization [0.0...1.0]",
-              g_inputdeck.get< tag::cmd, tag::virtualization >() );
+  print.item( "Virtualization [0.0...1.0]", virt );
+  print.item( "Auto-tuned virtualization", autovirt );
+  print.item( "Message priorities",
+              g_inputdeck.get< tag::discr, tag::msgprio >() );
   print.item( "Number of tetrahedra", nelem );
   print.item( "Number of points", m_npoin );
   print.item( "Number of work units", m_nchare );
@@ -559,6 +748,14 @@ Transporter::refinserted( int error )
 
   } else {
 
+     // Write the meta file of the partitioned mesh cache once all chares' mesh
+     // has been cached, see Partitioner::writeCache()
+     if (!m_meshcache.empty() && !m_cached) {
+       std::ofstream meta( m_meshcache + ".meta" );
+       meta << m_cachenelem << '\n';
+       ErrChk( meta.good(), "Failed to write file: " + m_meshcache + ".meta" );
+     }
+
      m_refiner.doneInserting();
 
   }
@@ -577,9 +774,26 @@ void
 Transporter::respondedRef()
 // *****************************************************************************
 // Reduction target: all mesh refiner chares have setup their boundary edges
+//! \details With neighbor-only correction of chare-boundary edges, see
+//!   Refiner::quiescent(), convergence of the correction is detected by
+//!   quiescence, i.e., when no Refiner chare modifies its edges any longer.
 // *****************************************************************************
 {
   m_refiner.refine();
+
+  if (g_inputdeck.get< tag::amr, tag::qdcorr >() &&
+      !g_inputdeck.get< tag::cmd, tag::quiescence >())
+    CkStartQD( CkCallback( CkIndex_Transporter::quiescentRef(), thisProxy ) );
+}
+
+void
+Transporter::quiescentRef()
+// *****************************************************************************
+// Quiescence target: all mesh refiner chares have corrected their edges with
+// their neighbors
+// *****************************************************************************
+{
+  m_refiner.quiescent();
 }
 
 void
@@ -703,21 +917,29 @@ Transporter::refined( std::size_t nelem, std::size_t npoin )
   m_nelem = nelem;
 
   m_sorter.setup( npoin );
+
+  if (Sorter::qdcomm())
+    CkStartQD( CkCallback( CkIndex_Transporter::queried(), thisProxy ) );
 }
 
 void
 Transporter::queried()
 // *****************************************************************************
 // Reduction target: all Sorter chares have queried their boundary nodes
+//! \details Also called when quiescence is detected, see Sorter::qdcomm().
 // *****************************************************************************
 {
   m_sorter.response();
+
+  if (Sorter::qdcomm())
+    CkStartQD( CkCallback( CkIndex_Transporter::responded(), thisProxy ) );
 }
 
 void
 Transporter::responded()
 // *****************************************************************************
 // Reduction target: all Sorter chares have responded with their boundary nodes
+//! \details Also called when quiescence is detected, see Sorter::qdcomm().
 // *****************************************************************************
 {
   m_sorter.start();
@@ -834,8 +1056,10 @@ Transporter::diagHeader()
       d.push_back( errname + '(' + var[i] + "-IC)" );
   }
 
-  // Augment diagnostics variables by L2-norm of the residual
-  if (scheme == ctr::SchemeType::DiagCG || scheme == ctr::SchemeType::ALECG) {
+  // Augment diagnostics variables by L2-norm of the residual, for DG only if
+  // marching to steady state
+  if (scheme == ctr::SchemeType::DiagCG || scheme == ctr::SchemeType::ALECG ||
+      g_inputdeck.get< tag::discr, tag::steady_state >()) {
     for (std::size_t i=0; i<nv; ++i) d.push_back( "L2(d" + var[i] + ')' );
   }
 
@@ -853,18 +1077,145 @@ Transporter::comfinal( int initial )
 // [Discretization-specific communication maps]
 {
   if (initial > 0) {
-    auto print = printer();
-    m_progWork.end( print );
-    m_scheme.bcast< Scheme::setup >();
-    // Turn on automatic load balancing
-    tk::CProxy_LBSwitch::ckNew();
-    print.diag( "Load balancing on (if enabled in Charm++)" );
+    m_progWork.end( printer() );
+    // Optionally remap chares to PEs based on their communication graph
+    if (g_inputdeck.get< tag::discr, tag::graphmap >() && CkNumPes() > 1)
+      m_scheme.disc().commgraph( 0 );
+    else
+      setup();
   } else {
     m_scheme.bcast< Scheme::lhs >();
   }
 }
 // [Discretization-specific communication maps]
 
+void
+Transporter::chgraph( CkReductionMsg* msg,
+                      std::vector< tk::real >& load,
+                      std::vector< tk::real >& bytes,
+                      std::vector< int >& pe,
+                      tk::ChareGraph& adj ) const
+// *****************************************************************************
+// Extract the communication graph of chares from a reduction message
+//! \param[in] msg Serialized hash map associating chare ids to their load,
+//!   data size, and PE, followed by pairs of neighbor chare ids and number of
+//!   shared nodes, see Discretization::commgraph(), deleted here
+//! \param[in,out] load Load of each chare
+//! \param[in,out] bytes Data size of each chare
+//! \param[in,out] pe PE of each chare
+//! \param[in,out] adj Communication graph of chares
+// *****************************************************************************
+{
+  std::unordered_map< int, std::vector< tk::real > > graph;
+  PUP::fromMem creator( msg->getData() );
+  creator | graph;
+  delete msg;
+
+  auto n = static_cast< std::size_t >( m_nchare );
+  Assert( graph.size() == n, "Communication graph incomplete" );
+
+  load.resize( n );
+  bytes.resize( n );
+  pe.resize( n );
+  adj.assign( n, {} );
+  for (const auto& [ c, g ] : graph) {
+    auto i = static_cast< std::size_t >( c );
+    load[i] = g[0];
+    bytes[i] = g[1];
+    pe[i] = static_cast< int >( g[2] );
+    for (std::size_t j=3; j+1<g.size(); j+=2)
+      adj[i].emplace_back( static_cast< std::size_t >( g[j] ), g[j+1] );
+  }
+}
+
+void
+Transporter::commgraph( CkReductionMsg* msg )
+// *****************************************************************************
+// Reduction target collecting the communication graph of chares
+//! \param[in] msg Serialized communication graph of chares, see chgraph()
+//! \details The PEs of all chares are computed from the load and the
+//!   communication graph of the chares and all chares are instructed to
+//!   migrate to their PEs. Setup continues after all chares have migrated,
+//!   which is detected by quiescence.
+// *****************************************************************************
+{
+  std::vector< tk::real > load, bytes;
+  std::vector< int > oldpe;
+  tk::ChareGraph adj;
+  chgraph( msg, load, bytes, oldpe, adj );
+
+  auto pe = tk::graphMap( load, adj, CkNumPes() );
+
+  printer().diag( "Remapping chares to PEs based on communication graph" );
+
+  m_scheme.disc().remap( pe );
+  CkStartQD( CkCallback( CkIndex_Transporter::remapped(), thisProxy ) );
+}
+
+void
+Transporter::lbgraph( CkReductionMsg* msg )
+// *****************************************************************************
+// Reduction target collecting the measured costs and the communication graph
+// of chares for load balancing during time stepping
+//! \param[in] msg Serialized communication graph of chares, see chgraph()
+//! \details The current placement of chares is improved given their costs
+//!   measured by the solver, their data sizes, and their communication graph,
+//!   see tk::rebalance(). The chares moved are instructed to migrate and time
+//!   stepping continues after all of them have migrated, which is detected by
+//!   quiescence.
+// *****************************************************************************
+{
+  std::vector< tk::real > load, bytes;
+  std::vector< int > oldpe;
+  tk::ChareGraph adj;
+  chgraph( msg, load, bytes, oldpe, adj );
+
+  auto pe = tk::rebalance( load, bytes, adj, oldpe, CkNumPes(),
+                           g_inputdeck.get< tag::discr, tag::migcost >() );
+
+  std::size_t nmove = 0;
+  for (std::size_t c=0; c<pe.size(); ++c) if (pe[c] != oldpe[c]) ++nmove;
+  printer().diag( "Load balancing: migrating " + std::to_string( nmove ) +
+                  " chares" );
+
+  if (nmove > 0) {
+    m_scheme.disc().remap( pe );
+    CkStartQD( CkCallback( CkIndex_Transporter::rebalanced(), thisProxy ) );
+  } else {
+    rebalanced();
+  }
+}
+
+void
+Transporter::rebalanced()
+// *****************************************************************************
+// Quiescence target: all chares have migrated to their rebalanced PEs
+// *****************************************************************************
+{
+  m_scheme.bcast< Scheme::next >();
+}
+
+void
+Transporter::remapped()
+// *****************************************************************************
+// Quiescence target: all chares have migrated to their remapped PEs
+// *****************************************************************************
+{
+  setup();
+}
+
+void
+Transporter::setup()
+// *****************************************************************************
+// Start setting up the workers for time stepping once setup is complete
+// *****************************************************************************
+{
+  m_scheme.bcast< Scheme::setup >();
+  // Turn on automatic load balancing
+  tk::CProxy_LBSwitch::ckNew();
+  printer().diag( "Load balancing on (if enabled in Charm++)" );
+}
+
 void
 Transporter::totalvol( tk::real v, tk::real initial )
 // *****************************************************************************
@@ -1009,7 +1360,106 @@ Transporter::boxvol( tk::real v )
 // *****************************************************************************
 {
   if (v > 0.0) printer().diag( "Box IC volume: " + std::to_string(v) );
-  m_scheme.bcast< Scheme::box >( v );
+
+  // In I/O benchmark mode, output synthetic fields instead of time stepping
+  if (g_inputdeck.get< tag::cmd, tag::iobench >()) {
+    printer().diag( "Starting I/O benchmark" );
+    iodump();
+  } else {
+    m_scheme.bcast< Scheme::box >( v );
+  }
+}
+
+void
+Transporter::iodump()
+// *****************************************************************************
+// Start a field output of the I/O benchmark
+// *****************************************************************************
+{
+  m_timer[ TimerTag::IOBENCH ].zero();
+  m_scheme.disc().iobench( g_inputdeck.get< tag::cmd, tag::iofields >() );
+}
+
+void
+Transporter::iowritten()
+// *****************************************************************************
+// Reduction target: all worker chares have finished a field output of the I/O
+// benchmark
+// *****************************************************************************
+{
+  m_iowall = m_timer[ TimerTag::IOBENCH ].dsec();
+  m_meshwriter.iostat(
+    CkCallback( CkReductionTarget(Transporter,iostat), thisProxy ) );
+}
+
+void
+Transporter::iostat( [[maybe_unused]] int n, tk::real* d )
+// *****************************************************************************
+// Reduction target collecting the I/O statistics of all mesh writers after a
+// field output of the I/O benchmark
+//! \param[in] n Size of the statistics array
+//! \param[in] d Statistics of the mesh writer of each compute node, indexed
+//!   by tk::IOStat, see tk::MeshWriter::iostat()
+//! \details The aggregate throughput is the bytes written by all writers per
+//!   wall-clock time of the field output. The time spent creating and opening
+//!   files and the skew of the time spent writing are given across the
+//!   writers that received data. Once all field outputs are done, the
+//!   checkpoint is measured.
+// *****************************************************************************
+{
+  Assert( n == tk::NUMIOSTAT * CkNumNodes(), "Size mismatch" );
+
+  std::size_t nw = 0;
+  tk::real bytes = 0.0, metasum = 0.0, metamax = 0.0, tsum = 0.0, tmax = 0.0;
+  auto tmin = std::numeric_limits< tk::real >::max();
+  for (int w=0; w<CkNumNodes(); ++w) {
+    const auto s = d + tk::NUMIOSTAT*w;
+    if (s[tk::IOTIME] <= 0.0) continue;    // no writer on this compute node
+    ++nw;
+    bytes += s[tk::IOBYTES];
+    metasum += s[tk::IOMETA];
+    metamax = std::max( metamax, s[tk::IOMETA] );
+    tsum += s[tk::IOTIME];
+    tmin = std::min( tmin, s[tk::IOTIME] );
+    tmax = std::max( tmax, s[tk::IOTIME] );
+  }
+
+  std::stringstream ss;
+  ss << std::setprecision(3) << "I/O at field output " << ++m_iodump << ": "
+     << bytes/1.0e9 << " GB in " << m_iowall << " s, "
+     << (m_iowall > 0.0 ? bytes/m_iowall/1.0e9 : 0.0) << " GB/s";
+  if (nw) {
+    const auto w = static_cast< tk::real >( nw );
+    ss << ", " << nw << " writers, open avg/max " << metasum/w << '/'
+       << metamax << " s, write min/avg/max " << tmin << '/' << tsum/w << '/'
+       << tmax << " s, skew max/avg " << tmax*w/tsum;
+  }
+  printer().diag( ss.str() );
+
+  if (m_iodump < g_inputdeck.get< tag::cmd, tag::iobench >())
+    iodump();
+  else
+    m_scheme.disc().iocheckpoint();
+}
+
+void
+Transporter::dtlevels( int n, tk::real* d )
+// *****************************************************************************
+// Reduction target collecting the number of mesh nodes on each time step size
+// level of multi-rate time stepping
+//! \param[in] n Number of levels
+//! \param[in] d Number of mesh nodes on each level summed across all chares
+// *****************************************************************************
+{
+  std::vector< tk::real > count( d, d+n );
+  auto nnode = std::accumulate( begin(count), end(count), 0.0 );
+  if (nnode < 1.0) return;
+
+  std::stringstream ss;
+  ss << std::setprecision(3) << "Time step size levels (% of nodes):";
+  for (int l=0; l<n; ++l) ss << ' ' << l << ": " << 100.0*d[l]/nnode;
+  ss << ", estimated multi-rate speedup " << tk::dtspeedup( count );
+  printer().diag( ss.str() );
 }
 
 void
@@ -1041,21 +1491,76 @@ void
 Transporter::diagnostics( CkReductionMsg* msg )
 // *****************************************************************************
 // Reduction target optionally collecting diagnostics, e.g., residuals
-//! \param[in] msg Serialized diagnostics vector aggregated across all PEs
+//! \param[in] msg Diagnostics vector aggregated across all PEs
 //! \note Only used for nodal schemes
 // *****************************************************************************
 {
-  std::vector< std::vector< tk::real > > d;
+  auto d = diagVec( msg );
+  delete msg;
 
-  // Deserialize diagnostics vector
-  PUP::fromMem creator( msg->getData() );
-  creator | d;
+  Assert( d.size() == NUMDIAG, "Diagnostics vector size mismatch" );
+
+  // Evaluate whether to continue with next step
+  m_scheme.bcast< Scheme::refine >( diagwrite( d ) );
+}
+
+void
+Transporter::diagdt( CkReductionMsg* msg )
+// *****************************************************************************
+// Reduction target collecting lagged diagnostics and the time step size of
+// the next time step
+//! \param[in] msg Diagnostics vector aggregated across all PEs,
+//!   with the minimum time step size of the next time step appended
+//! \details Lagged diagnostics (see the lagged_diag keyword) are computed at
+//!   the end of a time step but sent along with the time step size computed at
+//!   the start of the next one, so that this reduction replaces both the
+//!   diagnostics and the time step size reductions.
+//! \note Only used for nodal schemes
+// *****************************************************************************
+{
+  auto d = diagVec( msg );
   delete msg;
 
+  Assert( d.size() == NEXTDT+1, "Diagnostics vector size mismatch" );
+  Assert( d[NEXTDT].size() == 1, "Time step size vector size mismatch" );
+  auto dt = d[NEXTDT][0];
+  d.pop_back();
+
+  diagwrite( d );
+
+  // Continue with next time step
+  m_scheme.bcast< Scheme::advance >( dt );
+}
+
+void
+Transporter::diagfinish( CkReductionMsg* msg )
+// *****************************************************************************
+// Reduction target collecting lagged diagnostics of the last time step
+//! \param[in] msg Diagnostics vector aggregated across all PEs
+//! \note Only used for nodal schemes
+// *****************************************************************************
+{
+  auto d = diagVec( msg );
+  delete msg;
+
+  Assert( d.size() == NUMDIAG, "Diagnostics vector size mismatch" );
+
+  diagwrite( d );
+
+  finish();
+}
+
+std::vector< tk::real >
+Transporter::diagwrite( const std::vector< std::vector< tk::real > >& d )
+// *****************************************************************************
+// Finish computing diagnostics aggregated and append diagnostics file
+//! \param[in] d Diagnostics vector aggregated across all PEs
+//! \return L2-norms of the residual for each scalar component
+// *****************************************************************************
+{
   auto ncomp = g_inputdeck.get< tag::component >().nprop();
 
   Assert( ncomp > 0, "Number of scalar components must be positive");
-  Assert( d.size() == NUMDIAG, "Diagnostics vector size mismatch" );
 
   for (std::size_t i=0; i<d.size(); ++i)
      Assert( d[i].size() == ncomp,
@@ -1088,7 +1593,8 @@ Transporter::diagnostics( CkReductionMsg* msg )
   // Finish computing the L2 norm of the residual and append
   const auto scheme = g_inputdeck.get< tag::discr, tag::scheme >();
   std::vector< tk::real > l2res( d[L2RES].size(), 0.0 );
-  if (scheme == ctr::SchemeType::DiagCG || scheme == ctr::SchemeType::ALECG)
+  if (scheme == ctr::SchemeType::DiagCG || scheme == ctr::SchemeType::ALECG ||
+      g_inputdeck.get< tag::discr, tag::steady_state >())
     for (std::size_t i=0; i<d[L2RES].size(); ++i) {
       l2res[i] = std::sqrt( d[L2RES][i] / m_meshvol );
       diag.push_back( l2res[i] );
@@ -1101,8 +1607,242 @@ Transporter::diagnostics( CkReductionMsg* msg )
                      std::ios_base::app );
   dw.diag( static_cast<uint64_t>(d[ITER][0]), d[TIME][0], d[DT][0], diag );
 
-  // Evaluate whether to continue with next step
-  m_scheme.bcast< Scheme::refine >( l2res );
+  return l2res;
+}
+
+void
+Transporter::perf( CkReductionMsg* msg )
+// *****************************************************************************
+// Reduction target collecting the times spent in the phases of time steps from
+// all worker chares
+//! \param[in] msg Serialized minimum, maximum, and sum of the phase times
+//!   across all workers, see Discretization::status()
+//! \details The minimum, average, and maximum are echoed to screen and
+//!   appended to the performance log, which starts with a header line naming
+//!   the columns if it does not yet exist. The load imbalance follows from the
+//!   busy time, i.e., the time not spent waiting for communication: its
+//!   max/avg ratio across chares and across PEs, and the fraction of the time
+//!   since the last report the busiest PE was busy, which bounds the length
+//!   of the critical path. The slowest chares are listed with their PE and
+//!   mesh size, to help tuning load balancing and weighted partitioning.
+// *****************************************************************************
+{
+  std::vector< std::vector< tk::real > > d;
+  PUP::fromMem creator( msg->getData() );
+  creator | d;
+  delete msg;
+
+  Assert( d.size() == NUMPERF, "Phase timer vector size mismatch" );
+
+  const auto& name = g_inputdeck.get< tag::cmd, tag::io, tag::perf >();
+  bool header = !std::ifstream( name ).good();
+  std::ofstream log( name, std::ios_base::app );
+  ErrChk( log.good(), "Failed to open performance log file: " + name );
+
+  if (header) {
+    log << "#it";
+    for (std::size_t p=0; p<NUMPHASE; ++p)
+      log << ' ' << PhaseName[p] << "_min " << PhaseName[p] << "_avg "
+          << PhaseName[p] << "_max";
+    log << " busy_avg busy_max imb_chare imb_pe critpath\n";
+  }
+
+  const auto it = static_cast< uint64_t >( d[PITER][0] );
+  const auto n = static_cast< tk::real >( m_nchare );
+  std::stringstream ss;
+  ss << "Phase times at it " << it << " (min/avg/max s):";
+  log << it << std::scientific << std::setprecision(6);
+  ss << std::scientific << std::setprecision(2);
+  for (std::size_t p=0; p<NUMPHASE; ++p) {
+    const auto avg = d[PSUM][p] / n;
+    log << ' ' << d[PMIN][p] << ' ' << avg << ' ' << d[PMAX][p];
+    if (d[PMAX][p] > 0.0)
+      ss << ' ' << PhaseName[p] << ' ' << d[PMIN][p] << '/' << avg << '/'
+         << d[PMAX][p];
+  }
+
+  // Busy time and its imbalance across chares and PEs
+  const auto total = std::accumulate( begin(d[PSUM]), end(d[PSUM]), 0.0 ) / n;
+  const auto busyavg = busy( d[PSUM] ) / n;
+  const auto busymax = d[PSLOW].empty() ? 0.0 : d[PSLOW][SBUSY];
+  const auto pemax = d[PPE].empty() ? 0.0 :
+                     *std::max_element( begin(d[PPE]), end(d[PPE]) );
+  const auto peavg = d[PPE].empty() ? 0.0 :
+    std::accumulate( begin(d[PPE]), end(d[PPE]), 0.0 ) /
+    static_cast< tk::real >( d[PPE].size() );
+  const auto imbchare = busyavg > 0.0 ? busymax / busyavg : 1.0;
+  const auto imbpe = peavg > 0.0 ? pemax / peavg : 1.0;
+  const auto critpath = total > 0.0 ? std::min( pemax / total, 1.0 ) : 0.0;
+  log << ' ' << busyavg << ' ' << busymax << ' ' << imbchare << ' ' << imbpe
+      << ' ' << critpath << '\n';
+
+  printer().diag( ss.str() );
+
+  std::stringstream si;
+  si << std::setprecision(3) << "Load imbalance at it " << it
+     << ": busy max/avg " << imbchare << " across chares, " << imbpe
+     << " across PEs, critical path " << 100.0*critpath << "% of step time";
+  printer().diag( si.str() );
+
+  if (!d[PSLOW].empty()) {
+    std::stringstream sl;
+    sl << std::setprecision(3) << "Slowest chares (busy/wait s, PE, nelem, "
+       << "npoin):";
+    for (std::size_t i=0; i+NUMSLOW<=d[PSLOW].size(); i+=NUMSLOW) {
+      const auto s = d[PSLOW].data() + i;
+      sl << ' ' << static_cast< std::size_t >( s[SCHARE] ) << ": " << s[SBUSY]
+         << '/' << s[SWAIT] << ", " << static_cast< int >( s[SPE] ) << ", "
+         << static_cast< std::size_t >( s[SNELEM] ) << ", "
+         << static_cast< std::size_t >( s[SNPOIN] ) << ';';
+    }
+    printer().diag( sl.str() );
+  }
+}
+
+void
+Transporter::comm( CkReductionMsg* msg )
+// *****************************************************************************
+// Reduction target collecting the counts of messages and bytes communicated by
+// all worker chares
+//! \param[in] msg Serialized sums and maxima of the communication statistics
+//!   across all workers, see Discretization::status()
+//! \details The statistics of each kind of message sent since the last report
+//!   are echoed to screen and appended to the communication log, next to the
+//!   performance log, which starts with a header line naming the columns if it
+//!   does not yet exist.
+// *****************************************************************************
+{
+  std::vector< std::vector< tk::real > > d;
+  PUP::fromMem creator( msg->getData() );
+  creator | d;
+  delete msg;
+
+  Assert( d.size() == 2*NUMCOMMSTAT+1, "Communication vector size mismatch" );
+
+  const auto name = g_inputdeck.get< tag::cmd, tag::io, tag::perf >() + ".comm";
+  bool header = !std::ifstream( name ).good();
+  std::ofstream log( name, std::ios_base::app );
+  ErrChk( log.good(), "Failed to open communication log file: " + name );
+
+  if (header)
+    log << "#it kind nsent bsent nsent_max bsent_max nrecv brecv "
+           "nneigh_avg nneigh_max bpair_max round_max\n";
+
+  const auto it = static_cast< uint64_t >( d.back()[0] );
+  const auto n = static_cast< tk::real >( m_nchare );
+  // maximum across chares of a statistic of a kind of message
+  auto mx = [&]( CommStat s, std::size_t m ){ return d[NUMCOMMSTAT+s][m]; };
+  auto print = printer();
+  for (std::size_t m=0; m<NUMMSG; ++m) {
+    if (d[NSENT][m] + d[NRECV][m] < 1.0) continue;
+    log << it << ' ' << MsgName[m] << std::scientific << std::setprecision(6)
+        << ' ' << d[NSENT][m] << ' ' << d[BSENT][m] << ' ' << mx(NSENT,m)
+        << ' ' << mx(BSENT,m) << ' ' << d[NRECV][m] << ' ' << d[BRECV][m]
+        << ' ' << d[NNEIGH][m]/n << ' ' << mx(NNEIGH,m) << ' ' << mx(BPAIR,m)
+        << ' ' << mx(ROUND,m) << '\n';
+    std::stringstream ss;
+    ss << "Comm at it " << it << ", " << MsgName[m] << ": "
+       << std::scientific << std::setprecision(2)
+       << d[NSENT][m] << " msgs, " << d[BSENT][m] << " B (max "
+       << mx(BSENT,m) << " B/chare), neighbors avg/max "
+       << std::fixed << std::setprecision(1) << d[NNEIGH][m]/n << '/'
+       << mx(NNEIGH,m) << ", max pair " << std::scientific
+       << std::setprecision(2) << mx(BPAIR,m) << " B";
+    if (mx(ROUND,m) > 0.0) ss << ", max rounding error " << mx(ROUND,m);
+    print.diag( ss.str() );
+  }
+}
+
+void
+Transporter::memory( CkReductionMsg* msg )
+// *****************************************************************************
+// Reduction target collecting the memory report at the end of a setup phase
+//! \param[in] msg Serialized sums and maxima of the bytes accounted per
+//!   category across all contributors, see inciter::memreport()
+//! \details The sums and maxima across contributors (chares, or compute nodes
+//!   for the partitioner) of the categories of memory accounted are echoed to
+//!   screen, followed by the largest resident set size and its high-water mark
+//!   across processes.
+// *****************************************************************************
+{
+  std::vector< std::vector< tk::real > > d;
+  PUP::fromMem creator( msg->getData() );
+  creator | d;
+  delete msg;
+
+  Assert( d.size() == NUMMEMROW, "Memory report vector size mismatch" );
+
+  const tk::real mib = 1024.0 * 1024.0;
+  const auto p = static_cast< std::size_t >( d[MPHASE][0] );
+  std::stringstream ss;
+  ss << "Memory at " << MemPhaseName[p] << " (sum/max MiB):"
+     << std::fixed << std::setprecision(1);
+  for (std::size_t m=0; m<MRSS; ++m)
+    if (d[MSUM][m] > 0.0)
+      ss << ' ' << MemName[m] << ' ' << d[MSUM][m]/mib << '/'
+         << d[MMAX][m]/mib;
+  ss << ", max " << MemName[MRSS] << ' ' << d[MMAX][MRSS]/mib << ", max "
+     << MemName[MHWM] << ' ' << d[MMAX][MHWM]/mib;
+  printer().diag( ss.str() );
+}
+
+void
+Transporter::setuptime( [[maybe_unused]] int n, tk::real* d )
+// *****************************************************************************
+// Reduction target collecting the wall-clock times of the setup phases timed
+// by a setup object
+//! \param[in] n Size of the setup time report, 2*NUMSETUP
+//! \param[in] d Maxima of the times and of their negatives of all setup phases
+//!   across all contributors, see inciter::setupreport()
+//! \details The minima and maxima across contributors (chares, or compute
+//!   nodes for the partitioner) of the phases timed by the contributors are
+//!   echoed to screen; the rest of the phases are timed by other objects.
+// *****************************************************************************
+{
+  Assert( static_cast< std::size_t >( n ) == NUMSETUP*2,
+          "Setup time report size mismatch" );
+
+  for (std::size_t p=0; p<NUMSETUP; ++p)
+    if (d[p*2+0] >= 0.0) {
+      std::stringstream ss;
+      ss << "Setup " << SetupName[p] << " time (min/max): "
+         << std::setprecision(3) << -d[p*2+1] << '/' << d[p*2+0] << " s";
+      printer().diag( ss.str() );
+    }
+}
+
+void
+Transporter::imbalance( CkReductionMsg* msg )
+// *****************************************************************************
+// Reduction target collecting the number of mesh cells per chare to evaluate
+// the load imbalance after mesh refinement
+//! \param[in] msg Number of mesh cells of each chare, see
+//!   Discretization::imbalance()
+//! \details If the ratio of the maximum to the mean number of cells per chare
+//!   exceeds the user-configured threshold, all workers are instructed to
+//!   migrate (via Charm++'s load balancing) right away, instead of waiting for
+//!   the next load balancing step configured by the load balancing frequency.
+// *****************************************************************************
+{
+  auto nelem = static_cast< const tk::real* >( msg->getData() );
+  auto n = static_cast< std::size_t >( msg->getSize() ) / sizeof(tk::real);
+  Assert( n == static_cast< std::size_t >( m_nchare ), "Size mismatch" );
+
+  tk::real max = 0.0, sum = 0.0;
+  for (std::size_t c=0; c<n; ++c) {
+    max = std::max( max, nelem[c] );
+    sum += nelem[c];
+  }
+  delete msg;
+
+  auto ratio = sum > 0.0 ? max * static_cast< tk::real >( n ) / sum : 1.0;
+  int lb = ratio > g_inputdeck.get< tag::amr, tag::lbimbalance >();
+
+  if (lb)
+    printer().diag( "Load imbalance after refinement: max/avg(ntets) = " +
+                    std::to_string( ratio ) + ", rebalancing" );
+
+  m_scheme.bcast< Scheme::evalLB >( -1, lb );
 }
 
 void
@@ -1117,9 +1857,21 @@ Transporter::resume()
     // If just restarted from a checkpoint, Main( CkMigrateMessage* msg ) has
     // increased nrestart in g_inputdeck, but only on PE 0, so broadcast.
     auto nrestart = g_inputdeck.get< tag::cmd, tag::io, tag::nrestart >();
-    m_scheme.bcast< Scheme::evalLB >( nrestart );
-  } else
+    m_scheme.bcast< Scheme::evalLB >( nrestart, 0 );
+  } else {
+    if (m_iodump) {
+      const auto& restart =
+        g_inputdeck.get< tag::cmd, tag::io, tag::restart >();
+      const auto t = m_timer[ TimerTag::IOBENCH ].dsec();
+      const auto bytes = static_cast< tk::real >( dirsize( restart ) );
+      std::stringstream ss;
+      ss << std::setprecision(3) << "I/O at checkpoint: " << bytes/1.0e9
+         << " GB in " << t << " s, " << (t > 0.0 ? bytes/t/1.0e9 : 0.0)
+         << " GB/s";
+      printer().diag( ss.str() );
+    }
     mainProxy.finalize();
+  }
 }
 
 void
@@ -1131,9 +1883,49 @@ Transporter::checkpoint( int finished )
 {
   m_finished = finished;
 
-  const auto benchmark = g_inputdeck.get< tag::cmd, tag::benchmark >();
+  // Time the checkpoint in I/O benchmark mode
+  if (m_iodump) m_timer[ TimerTag::IOBENCH ].zero();
+
+  // Complete field output written asynchronously before checkpointing
+  if (g_inputdeck.get< tag::discr, tag::asyncwrite >())
+    CkStartQD( CkCallback( CkIndex_Transporter::flushed(), thisProxy ) );
+  else
+    flushed();
+}
+
+void
+Transporter::memcheckpoint()
+// *****************************************************************************
+// Save double in-memory checkpoint
+//! \details The state of each chare is stored in the memory of its own node
+//!   and of a buddy node. As with checkpoint/restart files, execution
+//!   continues in resume(), both after the checkpoint is done and when the
+//!   run, after a node failure, has restarted from the in-memory checkpoint.
+// *****************************************************************************
+{
+  m_inmemory = true;
+
+  // Complete field output written asynchronously before checkpointing
+  if (g_inputdeck.get< tag::discr, tag::asyncwrite >())
+    CkStartQD( CkCallback( CkIndex_Transporter::flushed(), thisProxy ) );
+  else
+    flushed();
+}
+
+void
+Transporter::flushed()
+// *****************************************************************************
+// Save checkpoint/restart files after all field output has been written
+// *****************************************************************************
+{
+  const auto benchmark = g_inputdeck.get< tag::cmd, tag::benchmark >() &&
+                         !g_inputdeck.get< tag::cmd, tag::iobench >();
 
-  if (!benchmark) {
+  if (m_inmemory) {
+    m_inmemory = false;
+    CkCallback res( CkIndex_Transporter::resume(), thisProxy );
+    CkStartMemCheckpoint( res );
+  } else if (!benchmark) {
     const auto& restart = g_inputdeck.get< tag::cmd, tag::io, tag::restart >();
     CkCallback res( CkIndex_Transporter::resume(), thisProxy );
     CkStartCheckpoint( restart.c_str(), res );
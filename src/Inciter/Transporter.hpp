@@ -24,6 +24,7 @@
 #include "Progress.hpp"
 #include "Scheme.hpp"
 #include "ContainerUtil.hpp"
+#include "GraphMap.hpp"
 
 namespace inciter {
 
@@ -104,6 +105,10 @@ class Transporter : public CBase_Transporter {
     //!   been inserted
     void workinserted();
 
+    //! \brief Quiescence target: all mesh refiner chares have corrected their
+    //!   edges with their neighbors
+    void quiescentRef();
+
     //! \brief Reduction target: all mesh refiner chares have received a round
     //!   of edges, and ran their compatibility algorithm
     void compatibility( int modified );
@@ -160,6 +165,19 @@ class Transporter : public CBase_Transporter {
     //! Reduction target indicating that the communication maps have been setup
     void comfinal( int initial );
 
+    //! Reduction target collecting the communication graph of chares
+    void commgraph( CkReductionMsg* msg );
+
+    //! Quiescence target: all chares have migrated to their remapped PEs
+    void remapped();
+
+    //! \brief Reduction target collecting the measured costs and the
+    //!   communication graph of chares for load balancing
+    void lbgraph( CkReductionMsg* msg );
+
+    //! Quiescence target: all chares have migrated to their rebalanced PEs
+    void rebalanced();
+
     //! Reduction target summing total mesh volume
     void totalvol( tk::real v, tk::real initial );
 
@@ -188,12 +206,58 @@ class Transporter : public CBase_Transporter {
     //!   residuals, from all  worker chares
     void diagnostics( CkReductionMsg* msg );
 
+    //! \brief Reduction target collecting lagged diagnostics along with the
+    //!   time step size of the next time step from all worker chares
+    void diagdt( CkReductionMsg* msg );
+
+    //! \brief Reduction target collecting lagged diagnostics of the last time
+    //!   step from all worker chares
+    void diagfinish( CkReductionMsg* msg );
+
+    //! \brief Reduction target collecting the times spent in the phases of
+    //!   time steps from all worker chares
+    void perf( CkReductionMsg* msg );
+
+    //! \brief Reduction target collecting the counts of messages and bytes
+    //!   communicated by all worker chares
+    void comm( CkReductionMsg* msg );
+
+    //! \brief Reduction target collecting the memory report at the end of a
+    //!   setup phase
+    void memory( CkReductionMsg* msg );
+
+    //! \brief Reduction target collecting the wall-clock times of the setup
+    //!   phases timed by a setup object
+    void setuptime( int n, tk::real* d );
+
+    //! \brief Reduction target collecting the number of mesh cells per chare
+    //!   to evaluate the load imbalance after mesh refinement
+    void imbalance( CkReductionMsg* msg );
+
+    //! \brief Reduction target: all worker chares have finished a field
+    //!   output of the I/O benchmark
+    void iowritten();
+
+    //! \brief Reduction target collecting the I/O statistics of all mesh
+    //!   writers after a field output of the I/O benchmark
+    void iostat( int n, tk::real* d );
+
+    //! \brief Reduction target collecting the number of mesh nodes on each
+    //!   time step size level of multi-rate time stepping
+    void dtlevels( int n, tk::real* d );
+
     //! Resume execution from checkpoint/restart files
     void resume();
 
     //! Save checkpoint/restart files
     void checkpoint( int finished );
 
+    //! Save double in-memory checkpoint
+    void memcheckpoint();
+
+    //! Save checkpoint/restart files after all field output has been written
+    void flushed();
+
     //! Normal finish of time stepping
     void finish();
 
@@ -215,12 +279,18 @@ class Transporter : public CBase_Transporter {
       p | m_sorter;
       p | m_nelem;
       p | m_npoin;
+      p | m_meshcache;
+      p | m_cached;
+      p | m_cachenelem;
       if (p.isUnpacking()) m_finished = 0;      // returning from checkpoint
+      if (p.isUnpacking()) m_inmemory = false;
       p | m_meshvol;
       p | m_minstat;
       p | m_maxstat;
       p | m_avgstat;
       p | m_timer;
+      p | m_iodump;
+      p | m_iowall;
     }
     //! \brief Pack/Unpack serialize operator|
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
@@ -240,7 +310,13 @@ class Transporter : public CBase_Transporter {
     CProxy_Sorter m_sorter;              //!< Mesh sorter array proxy
     std::size_t m_nelem;                 //!< Number of mesh elements
     std::size_t m_npoin;                 //!< Total number mesh points
+    //! File name prefix of the partitioned mesh cache, empty if not used
+    std::string m_meshcache;
+    bool m_cached;                       //!< True if mesh loaded from cache
+    std::size_t m_cachenelem;            //!< Number of mesh elements cached
     int m_finished;                      //!< True if finished with timestepping
+    //! True if the checkpoint in progress is an in-memory checkpoint
+    bool m_inmemory;
     //! Total mesh volume
     tk::real m_meshvol;
     //! Minimum mesh statistics
@@ -250,9 +326,13 @@ class Transporter : public CBase_Transporter {
     //! Average mesh statistics
     std::array< tk::real, 3 > m_avgstat;
     //! Timer tags
-    enum class TimerTag { MESH_READ=0 };
+    enum class TimerTag { MESH_READ=0, IOBENCH };
     //! Timers
     std::map< TimerTag, tk::Timer > m_timer;
+    //! Number of field outputs written by the I/O benchmark
+    std::size_t m_iodump;
+    //! Wall-clock time of the last field output of the I/O benchmark
+    tk::real m_iowall;
     //! Progress object for preparing mesh
     tk::Progress< 7 > m_progMesh;
     //! Progress object for preparing workers
@@ -261,9 +341,26 @@ class Transporter : public CBase_Transporter {
     //! Create mesh partitioner and boundary condition object group
     void createPartitioner();
 
+    //! Start setting up the workers for time stepping once setup is complete
+    void setup();
+
+    //! Start a field output of the I/O benchmark
+    void iodump();
+
+    //! Extract the communication graph of chares from a reduction message
+    void chgraph( CkReductionMsg* msg,
+                  std::vector< tk::real >& load,
+                  std::vector< tk::real >& bytes,
+                  std::vector< int >& pe,
+                  tk::ChareGraph& adj ) const;
+
     //! Configure and write diagnostics file header
     void diagHeader();
 
+    //! Finish computing diagnostics aggregated and append diagnostics file
+    std::vector< tk::real >
+    diagwrite( const std::vector< std::vector< tk::real > >& d );
+
     //! Echo configuration to screen
     void info( const InciterPrint& print );
 
@@ -316,6 +413,11 @@ class Transporter : public CBase_Transporter {
 
     //! Verify boundary condition (BC) side sets used exist in mesh file
     bool matchBCs( std::map< int, std::vector< std::size_t > >& bnd );
+
+    //! Compute the file name prefix of the partitioned mesh cache
+    std::string meshCache(
+      const std::map< int, std::vector< std::size_t > >& bface,
+      const std::map< int, std::vector< std::size_t > >& bnode ) const;
 };
 
 } // inciter::
@@ -0,0 +1,208 @@
+// *****************************************************************************
+/*!
+  \file      src/LoadBalance/GraphMap.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Communication-graph-aware placement of chares to PEs
+  \details   Communication-graph-aware placement of chares to PEs.
+*/
+// *****************************************************************************
+
+#include <set>
+#include <map>
+#include <tuple>
+#include <numeric>
+
+#include "GraphMap.hpp"
+#include "Exception.hpp"
+
+namespace tk {
+
+std::vector< int >
+graphMap( const std::vector< tk::real >& load,
+          const ChareGraph& adj,
+          int npe )
+// *****************************************************************************
+//  Compute the PE of each chare given their load and communication graph
+//! \param[in] load Computational load of each chare, e.g., number of cells
+//! \param[in] adj Communication graph of chares, assumed symmetric
+//! \param[in] npe Number of PEs
+//! \return PE of each chare
+//! \details The PEs are filled in order by greedy graph growing. The next
+//!   chare assigned to a PE is the unassigned chare with the largest
+//!   communication weight to the chares already on the PE, among those with
+//!   equal weights (e.g., the first chare of a PE, which has none) the one
+//!   with the largest communication weight to all chares already assigned to
+//!   any PE, and among those the one with the smallest id. A PE takes chares
+//!   until its load would exceed its share of the load remaining by more than
+//!   it falls short without the chare, but always at least one if there are
+//!   chares left for all remaining PEs, and the last PE takes all chares
+//!   left.
+// *****************************************************************************
+{
+  Assert( load.size() == adj.size(), "Size mismatch" );
+  Assert( npe > 0, "Number of PEs must be positive" );
+
+  auto n = load.size();
+  std::vector< int > pe( n, -1 );
+  if (n == 0) return pe;
+
+  // Communication weight of each chare to the chares on the PE being filled
+  // and to all chares already assigned
+  std::vector< tk::real > gain( n, 0.0 ), conn( n, 0.0 );
+
+  // Unassigned chares ordered by gain, then conn, then id, the next chare to
+  // be assigned first
+  using Key = std::tuple< tk::real, tk::real, std::size_t >;
+  auto cmp = []( const Key& a, const Key& b ) {
+    return std::make_tuple( -std::get<0>(a), -std::get<1>(a), std::get<2>(a) ) <
+           std::make_tuple( -std::get<0>(b), -std::get<1>(b), std::get<2>(b) );
+  };
+  std::set< Key, decltype(cmp) > queue( cmp );
+  for (std::size_t c=0; c<n; ++c) queue.emplace( 0.0, 0.0, c );
+
+  auto remaining = std::accumulate( begin(load), end(load), 0.0 );
+
+  for (int p=0; p<npe && !queue.empty(); ++p) {
+
+    auto target = remaining / static_cast< tk::real >( npe - p );
+    auto leftpe = static_cast< std::size_t >( npe - p - 1 );
+    tk::real l = 0.0;
+    std::size_t nc = 0;
+    std::vector< std::size_t > touched;   // chares whose gain changed
+
+    while (!queue.empty()) {
+      auto c = std::get<2>( *queue.begin() );
+      // Leave enough chares for the remaining PEs; otherwise stop before
+      // overshooting the target more than falling short of it
+      if (nc > 0 && (queue.size() <= leftpe ||
+                      (leftpe > 0 && l + load[c]/2.0 > target))) break;
+      queue.erase( queue.begin() );
+      pe[c] = p;
+      l += load[c];
+      ++nc;
+      // Update the keys of the unassigned neighbors
+      for (const auto& [ d, w ] : adj[c]) {
+        if (pe[d] != -1) continue;
+        queue.erase( Key{ gain[d], conn[d], d } );
+        touched.push_back( d );
+        gain[d] += w;
+        conn[d] += w;
+        queue.emplace( gain[d], conn[d], d );
+      }
+    }
+
+    // Reset the gains for the next PE
+    for (auto d : touched) {
+      if (pe[d] != -1) { gain[d] = 0.0; continue; }
+      queue.erase( Key{ gain[d], conn[d], d } );
+      gain[d] = 0.0;
+      queue.emplace( gain[d], conn[d], d );
+    }
+
+    remaining -= l;
+  }
+
+  Assert( queue.empty(), "Not all chares have been assigned to PEs" );
+
+  return pe;
+}
+
+std::vector< int >
+rebalance( const std::vector< tk::real >& load,
+           const std::vector< tk::real >& bytes,
+           const ChareGraph& adj,
+           const std::vector< int >& pe,
+           int npe,
+           tk::real migcost )
+// *****************************************************************************
+//  Improve the PEs of chares given their load, size, and communication graph,
+//  trading off the makespan and the data migrated
+//! \param[in] load Measured computational cost of each chare
+//! \param[in] bytes Size of the data of each chare migrated if moved
+//! \param[in] adj Communication graph of chares, assumed symmetric
+//! \param[in] pe Current PE of each chare
+//! \param[in] npe Number of PEs
+//! \param[in] migcost Cost of migrating a byte in units of load
+//! \return New PE of each chare
+//! \details Greedy refinement minimizing the makespan, i.e., the largest
+//!   load of a PE, plus the cost of migrating the chares moved. Each step
+//!   moves a chare off the most loaded PE, either to a PE holding some of its
+//!   neighbors or to the least loaded PE. The move chosen reduces the larger
+//!   of the loads of the two PEs involved the most after deducting the cost
+//!   of migrating the chare (which is zero if it has already moved and
+//!   negative if it moves back), preferring, among equally good moves, the PE
+//!   the chare communicates most with. Refinement stops if no move off the
+//!   most loaded PE is worth it. Since each move strictly decreases the sum
+//!   of squared PE loads, refinement terminates.
+// *****************************************************************************
+{
+  Assert( load.size() == adj.size() && bytes.size() == adj.size() &&
+          pe.size() == adj.size(), "Size mismatch" );
+  Assert( npe > 0, "Number of PEs must be positive" );
+
+  auto n = load.size();
+  auto newpe = pe;
+
+  // Loads of PEs ordered and chares on PEs
+  auto np = static_cast< std::size_t >( npe );
+  std::vector< tk::real > L( np, 0.0 );
+  std::vector< std::set< std::size_t > > chares( np );
+  for (std::size_t c=0; c<n; ++c) {
+    Assert( pe[c] >= 0 && pe[c] < npe, "PE out of range" );
+    auto p = static_cast< std::size_t >( pe[c] );
+    L[p] += load[c];
+    chares[p].insert( c );
+  }
+  std::set< std::pair< tk::real, std::size_t > > order;
+  for (std::size_t p=0; p<np; ++p) order.emplace( L[p], p );
+
+  while (order.size() > 1) {
+
+    auto p = order.rbegin()->second;    // most loaded PE
+    auto q = order.begin()->second;     // least loaded PE
+
+    // Find the best move off of PE p
+    tk::real best = 0.0, bestcomm = 0.0;
+    std::size_t bc = n, bt = np;
+    for (auto c : chares[p]) {
+      // Candidate PEs: those of the neighbors and the least loaded PE
+      std::map< std::size_t, tk::real > comm{{ q, 0.0 }};
+      for (const auto& [ d, w ] : adj[c])
+        comm[ static_cast< std::size_t >( newpe[d] ) ] += w;
+      auto mig = migcost * bytes[c];
+      for (const auto& [ t, w ] : comm) {
+        if (t == p) continue;
+        auto gain = L[p] - std::max( L[p] - load[c], L[t] + load[c] );
+        if (!(gain > 0.0)) continue;
+        auto cost = static_cast< int >( t ) == pe[c] ? -mig :
+                    newpe[c] == pe[c] ? mig : 0.0;
+        auto score = gain - cost;
+        if (score > best || (bc < n && !(score < best) && w > bestcomm)) {
+          best = score;
+          bestcomm = w;
+          bc = c;
+          bt = t;
+        }
+      }
+    }
+    if (bc == n) break;
+
+    // Move chare bc from PE p to PE bt
+    order.erase( { L[p], p } );
+    order.erase( { L[bt], bt } );
+    L[p] -= load[bc];
+    L[bt] += load[bc];
+    order.emplace( L[p], p );
+    order.emplace( L[bt], bt );
+    chares[p].erase( bc );
+    chares[bt].insert( bc );
+    newpe[bc] = static_cast< int >( bt );
+  }
+
+  return newpe;
+}
+
+} // tk::
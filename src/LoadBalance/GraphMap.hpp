@@ -0,0 +1,62 @@
+// *****************************************************************************
+/*!
+  \file      src/LoadBalance/GraphMap.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Communication-graph-aware placement of chares to PEs
+  \details   Communication-graph-aware placement of chares to PEs. As opposed
+    to tk::LinearMap and tk::UnsMeshMap, which place chare array elements
+    before any of them exist, this placement is computed from the
+    communication graph of the chares, i.e., the number of mesh nodes each
+    chare shares with each of its neighbors, which is only known after the
+    chares have setup their communication maps. The PEs are filled one after
+    the other by greedy graph growing: each PE takes the unassigned chares
+    most strongly connected to the chares already on the PE until its share
+    of the load is reached, starting from the chare most strongly connected
+    to the chares already placed. Since the Charm++ runtime system numbers the
+    PEs of a compute node consecutively, this places heavily communicating
+    chares onto the same PE and compute node.
+
+    For load balancing during time stepping, when the chares already reside
+    on PEs, tk::rebalance() incrementally improves their placement, given
+    their measured costs, by only moving those chares off the most loaded PEs
+    whose move is worth more than migrating the chares' data.
+*/
+// *****************************************************************************
+#ifndef GraphMap_h
+#define GraphMap_h
+
+#include <vector>
+#include <utility>
+#include <cstddef>
+
+#include "Types.hpp"
+
+namespace tk {
+
+//! \brief Communication graph of chares: neighbor chare ids and
+//!   communication weights (e.g., number of shared nodes) of each chare
+using ChareGraph =
+  std::vector< std::vector< std::pair< std::size_t, tk::real > > >;
+
+//! Compute the PE of each chare given their load and communication graph
+std::vector< int >
+graphMap( const std::vector< tk::real >& load,
+          const ChareGraph& adj,
+          int npe );
+
+//! \brief Improve the PEs of chares given their load, size, and
+//!   communication graph, trading off the makespan and the data migrated
+std::vector< int >
+rebalance( const std::vector< tk::real >& load,
+           const std::vector< tk::real >& bytes,
+           const ChareGraph& adj,
+           const std::vector< int >& pe,
+           int npe,
+           tk::real migcost );
+
+} // tk::
+
+#endif // GraphMap_h
@@ -0,0 +1,241 @@
+// *****************************************************************************
+/*!
+  \file      src/LoadBalance/SFCPartition.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Space-filling curve partitioning via distributed histogram sort
+  \details   Space-filling curve partitioning via distributed histogram sort.
+*/
+// *****************************************************************************
+
+#include <limits>
+#include <numeric>
+#include <algorithm>
+
+#include "SFCPartition.hpp"
+#include "Exception.hpp"
+
+namespace tk {
+
+//! Largest key, assumed to be larger than all keys partitioned
+static const std::uint64_t MaxKey = std::numeric_limits< std::uint64_t >::max();
+
+//! Generate probe keys inside an interval of keys
+//! \param[in] lo Lower end of key interval
+//! \param[in] hi Upper end of key interval
+//! \param[in] nbin Number of subintervals to split the interval into
+//! \return Keys splitting [lo,hi] into nbin subintervals of (roughly) equal
+//!   length, not including lo and hi
+static std::vector< std::uint64_t >
+probeKeys( std::uint64_t lo, std::uint64_t hi, std::size_t nbin )
+{
+  std::vector< std::uint64_t > k;
+  auto len = hi - lo;
+  if (len < nbin) {
+    for (auto i=lo+1; i<hi; ++i) k.push_back( i );
+  } else {
+    auto step = len / nbin;
+    for (std::size_t i=1; i<nbin; ++i) k.push_back( lo + i*step );
+  }
+  return k;
+}
+
+SFCSplitter::SFCSplitter( std::size_t npart, tk::real tol, std::size_t nbin ) :
+  m_npart( npart ),
+  m_tol( tol ),
+  m_nbin( nbin ),
+  m_total( -1.0 ),
+  m_lo(),
+  m_hi(),
+  m_wlo(),
+  m_whi(),
+  m_active(),
+  m_probe( 1, MaxKey )
+// *****************************************************************************
+//  Constructor
+//! \param[in] npart Number of parts to cut the space-filling curve into
+//! \param[in] tol Relative tolerance on the weight of parts: a splitter is
+//!   accepted if it is off by at most this fraction of the mean part weight
+//! \param[in] nbin Number of subintervals an interval of keys is split into
+//!   per iteration
+//! \details The first probe is the largest key, asking for the total weight.
+// *****************************************************************************
+{
+  Assert( npart > 0, "Number of parts must be positive" );
+  Assert( nbin > 1, "Number of subintervals must be larger than one" );
+}
+
+bool
+SFCSplitter::found( std::size_t s ) const
+// *****************************************************************************
+//  Query if a splitter has been found
+//! \param[in] s Splitter id
+//! \return True if the interval of the splitter has been narrowed to a single
+//!   key or one of its ends is within tolerance of the weight targeted
+// *****************************************************************************
+{
+  auto n = static_cast< tk::real >( m_npart );
+  auto target = m_total * static_cast< tk::real >( s+1 ) / n;
+  auto tol = m_tol * m_total / n;
+  return m_hi[s] - m_lo[s] <= 1 ||
+         target - m_wlo[s] <= tol ||
+         m_whi[s] - target <= tol;
+}
+
+void
+SFCSplitter::probe()
+// *****************************************************************************
+//  Generate the probe keys for the splitters not yet found
+//! \details Probes shared by multiple splitters, e.g., with the same
+//!   interval, are only requested once.
+// *****************************************************************************
+{
+  m_active.clear();
+  m_probe.clear();
+  for (std::size_t s=0; s<m_lo.size(); ++s)
+    if (!found(s)) {
+      m_active.push_back( s );
+      auto k = probeKeys( m_lo[s], m_hi[s], m_nbin );
+      m_probe.insert( end(m_probe), begin(k), end(k) );
+    }
+  std::sort( begin(m_probe), end(m_probe) );
+  m_probe.erase( std::unique( begin(m_probe), end(m_probe) ), end(m_probe) );
+}
+
+void
+SFCSplitter::update( const std::vector< tk::real >& below )
+// *****************************************************************************
+//  Narrow the splitter intervals given the global weights below probes
+//! \param[in] below Global weight of all keys below each probe key, i.e., the
+//!   sum of sfcWeightBelow() over all callers, for the probes returned by
+//!   probes()
+// *****************************************************************************
+{
+  Assert( below.size() == m_probe.size(), "Size mismatch" );
+
+  if (m_total < 0.0) {
+
+    m_total = below[0];
+    auto nsplit = m_npart - 1;
+    m_lo.resize( nsplit, 0 );
+    m_hi.resize( nsplit, MaxKey );
+    m_wlo.resize( nsplit, 0.0 );
+    m_whi.resize( nsplit, m_total );
+
+  } else {
+
+    auto n = static_cast< tk::real >( m_npart );
+    for (auto s : m_active) {
+      auto target = m_total * static_cast< tk::real >( s+1 ) / n;
+      for (auto k : probeKeys( m_lo[s], m_hi[s], m_nbin )) {
+        auto i = std::lower_bound( begin(m_probe), end(m_probe), k );
+        auto b = below[ static_cast< std::size_t >( i - begin(m_probe) ) ];
+        if (b < target) {
+          m_lo[s] = k;
+          m_wlo[s] = b;
+        } else {
+          m_hi[s] = k;
+          m_whi[s] = b;
+          break;
+        }
+      }
+    }
+
+  }
+
+  probe();
+}
+
+std::vector< std::uint64_t >
+SFCSplitter::splitters() const
+// *****************************************************************************
+//  Return the splitter keys
+//! \return The npart-1 splitter keys in ascending order: keys below the first
+//!   splitter belong to part 0, keys not below splitter s but below splitter
+//!   s+1 belong to part s+1, see sfcPart()
+// *****************************************************************************
+{
+  Assert( done(), "Splitters queried before found" );
+
+  auto n = static_cast< tk::real >( m_npart );
+  std::vector< std::uint64_t > split( m_lo.size() );
+  for (std::size_t s=0; s<m_lo.size(); ++s) {
+    auto target = m_total * static_cast< tk::real >( s+1 ) / n;
+    split[s] = target - m_wlo[s] <= m_whi[s] - target ? m_lo[s] : m_hi[s];
+  }
+  std::sort( begin(split), end(split) );
+  return split;
+}
+
+std::pair< std::vector< std::uint64_t >, std::vector< tk::real > >
+sfcCumulate( const std::vector< std::uint64_t >& key,
+             const std::vector< tk::real >& weight )
+// *****************************************************************************
+//  Sort keys and accumulate their weights for computing weights below keys
+//! \param[in] key Space-filling curve keys
+//! \param[in] weight Weight of each key, empty for unit weights
+//! \return Keys in ascending order and the cumulative weights of the sorted
+//!   keys: the weight of the first i sorted keys is the ith, i=0...size,
+//!   cumulative weight
+// *****************************************************************************
+{
+  Assert( weight.empty() || weight.size() == key.size(), "Size mismatch" );
+
+  std::vector< std::size_t > order( key.size() );
+  std::iota( begin(order), end(order), 0 );
+  std::sort( begin(order), end(order),
+    [&]( std::size_t a, std::size_t b ){ return key[a] < key[b]; } );
+
+  std::vector< std::uint64_t > sorted( key.size() );
+  std::vector< tk::real > cum( key.size()+1, 0.0 );
+  for (std::size_t i=0; i<order.size(); ++i) {
+    sorted[i] = key[ order[i] ];
+    cum[i+1] = cum[i] + (weight.empty() ? 1.0 : weight[ order[i] ]);
+  }
+
+  return { sorted, cum };
+}
+
+std::vector< tk::real >
+sfcWeightBelow( const std::vector< std::uint64_t >& sorted,
+                const std::vector< tk::real >& cumweight,
+                const std::vector< std::uint64_t >& probe )
+// *****************************************************************************
+//  Compute the weight of keys below probe keys
+//! \param[in] sorted Keys in ascending order, see sfcCumulate()
+//! \param[in] cumweight Cumulative weights of sorted keys, see sfcCumulate()
+//! \param[in] probe Probe keys, see SFCSplitter::probes()
+//! \return Weight of all keys below each probe key
+// *****************************************************************************
+{
+  Assert( cumweight.size() == sorted.size()+1, "Size mismatch" );
+
+  std::vector< tk::real > below( probe.size() );
+  for (std::size_t p=0; p<probe.size(); ++p) {
+    auto i = std::lower_bound( begin(sorted), end(sorted), probe[p] );
+    below[p] = cumweight[ static_cast< std::size_t >( i - begin(sorted) ) ];
+  }
+  return below;
+}
+
+std::vector< std::size_t >
+sfcPart( const std::vector< std::uint64_t >& key,
+         const std::vector< std::uint64_t >& splitter )
+// *****************************************************************************
+//  Assign parts to keys given the splitter keys
+//! \param[in] key Space-filling curve keys
+//! \param[in] splitter Splitter keys, see SFCSplitter::splitters()
+//! \return Part of each key
+// *****************************************************************************
+{
+  std::vector< std::size_t > part( key.size() );
+  for (std::size_t i=0; i<key.size(); ++i)
+    part[i] = static_cast< std::size_t >(
+      std::upper_bound( begin(splitter), end(splitter), key[i] ) -
+      begin(splitter) );
+  return part;
+}
+
+} // tk::
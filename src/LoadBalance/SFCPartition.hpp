@@ -0,0 +1,124 @@
+// *****************************************************************************
+/*!
+  \file      src/LoadBalance/SFCPartition.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Space-filling curve partitioning via distributed histogram sort
+  \details   Space-filling curve partitioning via distributed histogram sort.
+    Mesh cells, given by their (e.g., Hilbert) space-filling curve keys and
+    weights, are distributed across many processing elements. The curve is cut
+    into a number of parts of equal total weight by finding a splitter key
+    for each cut. The splitters are found iteratively, by narrowing an
+    interval of keys around each splitter: each iteration asks for the global
+    weight of all keys below a set of probe keys inside the intervals, which
+    is the sum of the weights computed locally by the callers on their own
+    keys, see sfcWeightBelow(), and thus is obtained by a single sum-reduction
+    across all callers. Since the splitter state depends only on the globally
+    reduced weights, all callers hold the same splitters after each iteration
+    without further communication.
+*/
+// *****************************************************************************
+#ifndef SFCPartition_h
+#define SFCPartition_h
+
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+
+#include "Types.hpp"
+#include "PUPUtil.hpp"
+
+namespace tk {
+
+//! Find the splitter keys of a space-filling curve partitioning
+class SFCSplitter {
+
+  public:
+    //! Constructor
+    explicit SFCSplitter( std::size_t npart = 1,
+                          tk::real tol = 0.01,
+                          std::size_t nbin = 16 );
+
+    //! Return the keys whose global weight below is requested next
+    //! \return Probe keys, see sfcWeightBelow()
+    const std::vector< std::uint64_t >& probes() const { return m_probe; }
+
+    //! Narrow the splitter intervals given the global weights below probes
+    void update( const std::vector< tk::real >& below );
+
+    //! Query if all splitters have been found
+    //! \return True if no more probes are needed
+    bool done() const { return m_probe.empty(); }
+
+    //! Return the splitter keys
+    std::vector< std::uint64_t > splitters() const;
+
+    /** @name Pack/Unpack: Serialize SFCSplitter object for Charm++ */
+    ///@{
+    //! \brief Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    void pup( PUP::er& p ) {
+      p | m_npart;
+      p | m_tol;
+      p | m_nbin;
+      p | m_total;
+      p | m_lo;
+      p | m_hi;
+      p | m_wlo;
+      p | m_whi;
+      p | m_active;
+      p | m_probe;
+    }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] s SFCSplitter object reference
+    friend void operator|( PUP::er& p, SFCSplitter& s ) { s.pup(p); }
+    //@}
+
+  private:
+    //! Number of parts
+    std::size_t m_npart;
+    //! Relative tolerance on the weight of parts
+    tk::real m_tol;
+    //! Number of subintervals an interval is split into per iteration
+    std::size_t m_nbin;
+    //! Total weight of all keys, negative until known
+    tk::real m_total;
+    //! Lower and upper ends of the key interval of each splitter
+    std::vector< std::uint64_t > m_lo, m_hi;
+    //! Weight of all keys below the lower and upper ends of the intervals
+    std::vector< tk::real > m_wlo, m_whi;
+    //! Ids of splitters not yet found
+    std::vector< std::size_t > m_active;
+    //! Keys whose global weight below is requested next
+    std::vector< std::uint64_t > m_probe;
+
+    //! Generate the probe keys for the splitters not yet found
+    void probe();
+
+    //! Query if a splitter has been found
+    bool found( std::size_t s ) const;
+};
+
+//! Sort keys and accumulate their weights for computing weights below keys
+std::pair< std::vector< std::uint64_t >, std::vector< tk::real > >
+sfcCumulate( const std::vector< std::uint64_t >& key,
+             const std::vector< tk::real >& weight );
+
+//! Compute the weight of keys below probe keys
+std::vector< tk::real >
+sfcWeightBelow( const std::vector< std::uint64_t >& sorted,
+                const std::vector< tk::real >& cumweight,
+                const std::vector< std::uint64_t >& probe );
+
+//! Assign parts to keys given the splitter keys
+std::vector< std::size_t >
+sfcPart( const std::vector< std::uint64_t >& key,
+         const std::vector< std::uint64_t >& splitter );
+
+} // tk::
+
+#endif // SFCPartition_h
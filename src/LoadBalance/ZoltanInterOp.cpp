@@ -13,10 +13,12 @@
 
 #include <stddef.h>
 #include <string>
+#include <algorithm>
 
 #include "NoWarning/Zoltan2_PartitioningProblem.hpp"
 
 #include "ZoltanInterOp.hpp"
+#include "Exception.hpp"
 
 namespace tk {
 namespace zoltan {
@@ -41,14 +43,17 @@ class GeometricMeshElemAdapter : public Zoltan2::MeshAdapter< ZoltanTypes > {
     //! \param[in] nelem Number of elements in mesh graph on this rank
     //! \param[in] centroid Mesh element coordinates (centroids)
     //! \param[in] elemid Mesh element global IDs
+    //! \param[in] elemwgt Mesh element weights, empty if unweighted
     GeometricMeshElemAdapter(
       std::size_t nelem,
       const std::array< std::vector< tk::real >, 3 >& centroid,
-      const std::vector< long >& elemid )
+      const std::vector< long >& elemid,
+      const std::vector< tk::real >& elemwgt )
     : m_nelem( nelem ),
       m_topology( EntityTopologyType::TETRAHEDRON ),
       m_centroid( centroid ),
-      m_elemid( elemid )
+      m_elemid( elemid ),
+      m_elemwgt( elemwgt )
     {}
 
     //! Returns the number of mesh entities on this rank
@@ -95,6 +100,26 @@ class GeometricMeshElemAdapter : public Zoltan2::MeshAdapter< ZoltanTypes > {
       stride = 1;
     }
 
+    //! Return the number of weights per mesh element
+    //! \return Number of weights per mesh element: 1 if weighted, 0 if not
+    // cppcheck-suppress unusedFunction
+    int getNumWeightsPerOf( MeshEntityType ) const override
+    { return m_elemwgt.empty() ? 0 : 1; }
+
+    //! Provide a pointer to the mesh element weights
+    //! \param[in,out] weights Pointer to the list of element weights
+    //! \param[in,out] stride Describes the layout of the weights in the
+    //!   weights list, see getCoordinatesViewOf()
+    // cppcheck-suppress unusedFunction
+    void getWeightsViewOf( MeshEntityType,
+                           const scalar_t*& weights,
+                           int& stride,
+                           int ) const override
+    {
+      weights = m_elemwgt.data();
+      stride = 1;
+    }
+
   private:
     //! Number of elements on this rank
     const std::size_t m_nelem;
@@ -104,25 +129,177 @@ class GeometricMeshElemAdapter : public Zoltan2::MeshAdapter< ZoltanTypes > {
     const std::array< std::vector< tk::real >, 3 >& m_centroid;
     //! Global mesh element ids
     const std::vector< long >& m_elemid;
+    //! Mesh element weights
+    const std::vector< tk::real >& m_elemwgt;
+};
+
+//! ConnectedMeshElemAdapter : GeometricMeshElemAdapter
+//! \details ConnectedMeshElemAdapter adds the mesh connectivity, as
+//!   adjacencies between mesh elements (regions) and mesh nodes (vertices) in
+//!   both directions, to GeometricMeshElemAdapter, required by the graph and
+//!   hypergraph partitioners of Zoltan2. The nodes of the mesh graph on this
+//!   rank are described with their global ids, so nodes shared by multiple
+//!   ranks are identified by Zoltan2 as the same hyperedge, or, for graph
+//!   partitioners, induce the edges of the element graph across ranks.
+template< typename ZoltanTypes >
+class ConnectedMeshElemAdapter : public GeometricMeshElemAdapter< ZoltanTypes >
+{
+
+  private:
+    using MeshEntityType = Zoltan2::MeshEntityType;
+    using base_t = GeometricMeshElemAdapter< ZoltanTypes >;
+
+  public:
+    using gno_t = typename base_t::gno_t;
+    using offset_t = typename Zoltan2::InputTraits< ZoltanTypes >::offset_t;
+
+    //! Constructor
+    //! \param[in] centroid Mesh element coordinates (centroids)
+    //! \param[in] elemid Mesh element global IDs
+    //! \param[in] ginpoel Mesh element connectivity with global node ids
+    //! \param[in] elemwgt Mesh element weights, empty if unweighted
+    ConnectedMeshElemAdapter(
+      const std::array< std::vector< tk::real >, 3 >& centroid,
+      const std::vector< long >& elemid,
+      const std::vector< std::size_t >& ginpoel,
+      const std::vector< tk::real >& elemwgt )
+    : base_t( elemid.size(), centroid, elemid, elemwgt ),
+      m_elemid( elemid ),
+      m_nodeid(),
+      m_elnode( begin(ginpoel), end(ginpoel) ),
+      m_eloffset( elemid.size()+1 ),
+      m_neloffset(),
+      m_nelem()
+    {
+      Assert( ginpoel.size() == elemid.size()*4, "Size mismatch" );
+      for (std::size_t e=0; e<=elemid.size(); ++e) m_eloffset[e] = e*4;
+      // Unique nodes of the mesh graph on this rank, sorted
+      m_nodeid = m_elnode;
+      std::sort( begin(m_nodeid), end(m_nodeid) );
+      m_nodeid.erase( std::unique( begin(m_nodeid), end(m_nodeid) ),
+                      end(m_nodeid) );
+      // Elements surrounding nodes, in compressed row storage
+      m_neloffset.assign( m_nodeid.size()+1, 0 );
+      std::vector< std::size_t > lid( ginpoel.size() );
+      for (std::size_t i=0; i<ginpoel.size(); ++i) {
+        lid[i] = static_cast< std::size_t >(
+          std::lower_bound( begin(m_nodeid), end(m_nodeid), m_elnode[i] ) -
+          begin(m_nodeid) );
+        ++m_neloffset[ lid[i]+1 ];
+      }
+      for (std::size_t n=0; n<m_nodeid.size(); ++n)
+        m_neloffset[n+1] += m_neloffset[n];
+      m_nelem.resize( ginpoel.size() );
+      auto pos = m_neloffset;
+      for (std::size_t i=0; i<ginpoel.size(); ++i)
+        m_nelem[ static_cast< std::size_t >( pos[ lid[i] ]++ ) ] =
+          m_elemid[ i/4 ];
+    }
+
+    //! Returns the number of mesh entities on this rank
+    //! \param[in] etype Mesh entity type, elements or nodes
+    //! \return Number of mesh elements or nodes on this rank
+    // cppcheck-suppress unusedFunction
+    std::size_t getLocalNumOf( MeshEntityType etype ) const override {
+      return etype == MeshEntityType::MESH_VERTEX ? m_nodeid.size() :
+                                                    m_elemid.size();
+    }
+
+    //! Provide a pointer to this rank's identifiers
+    //! \param[in] etype Mesh entity type, elements or nodes
+    //! \param[in,out] Ids Pointer to the list of global element or node Ids
+    //!   on this rank
+    // cppcheck-suppress unusedFunction
+    void getIDsViewOf( MeshEntityType etype, const gno_t*& Ids ) const override
+    {
+      Ids = etype == MeshEntityType::MESH_VERTEX ? m_nodeid.data() :
+                                                   m_elemid.data();
+    }
+
+    //! Query if adjacencies are available between entity types
+    //! \param[in] source Mesh entity type whose adjacencies are queried
+    //! \param[in] target Mesh entity type of the adjacencies
+    //! \return True for element-node and node-element adjacencies
+    // cppcheck-suppress unusedFunction
+    bool availAdjs( MeshEntityType source, MeshEntityType target )
+    const override {
+      return (source == MeshEntityType::MESH_REGION &&
+              target == MeshEntityType::MESH_VERTEX) ||
+             (source == MeshEntityType::MESH_VERTEX &&
+              target == MeshEntityType::MESH_REGION);
+    }
+
+    //! Returns the number of adjacencies on this rank
+    //! \param[in] source Mesh entity type whose adjacencies are queried
+    //! \param[in] target Mesh entity type of the adjacencies
+    //! \return Number of element-node or node-element adjacencies
+    // cppcheck-suppress unusedFunction
+    std::size_t getLocalNumAdjs( MeshEntityType source, MeshEntityType target )
+    const override
+    { return availAdjs( source, target ) ? m_elnode.size() : 0; }
+
+    //! Provide pointers to the adjacencies in compressed row storage
+    //! \param[in] source Mesh entity type whose adjacencies are queried
+    //! \param[in] target Mesh entity type of the adjacencies
+    //! \param[in,out] offsets Pointer to the adjacency offsets of the source
+    //!   entities, one more than the number of source entities
+    //! \param[in,out] adjacencyIds Pointer to the global ids of the adjacent
+    //!   target entities
+    // cppcheck-suppress unusedFunction
+    void getAdjsView( MeshEntityType source,
+                      MeshEntityType,
+                      const offset_t*& offsets,
+                      const gno_t*& adjacencyIds ) const override
+    {
+      if (source == MeshEntityType::MESH_VERTEX) {
+        offsets = m_neloffset.data();
+        adjacencyIds = m_nelem.data();
+      } else {
+        offsets = m_eloffset.data();
+        adjacencyIds = m_elnode.data();
+      }
+    }
+
+  private:
+    //! Global mesh element ids
+    const std::vector< long >& m_elemid;
+    //! Global mesh node ids of the nodes on this rank, sorted
+    std::vector< gno_t > m_nodeid;
+    //! Global mesh node ids of the elements
+    std::vector< gno_t > m_elnode;
+    //! Offsets of the elements into m_elnode
+    std::vector< offset_t > m_eloffset;
+    //! Offsets of the nodes into m_nelem
+    std::vector< offset_t > m_neloffset;
+    //! Global mesh element ids of elements surrounding nodes
+    std::vector< gno_t > m_nelem;
 };
 
 std::vector< std::size_t >
 geomPartMesh( tk::ctr::PartitioningAlgorithmType algorithm,
               const std::array< std::vector< tk::real >, 3 >& centroid,
               const std::vector< long >& elemid,
-              int npart )
+              int npart,
+              const std::vector< tk::real >& elemwgt )
 // *****************************************************************************
 //  Partition mesh using Zoltan2 with a geometric partitioner, such as RCB, RIB
 //! \param[in] algorithm Partitioning algorithm type
 //! \param[in] centroid Mesh element coordinates
 //! \param[in] elemid Global mesh element ids
 //! \param[in] npart Number of desired graph partitions
+//! \param[in] elemwgt Mesh element weights, e.g., estimated computational
+//!   cost, empty (default) for equal weights
 //! \return Array of chare ownership IDs mapping graph points to concurrent
 //!   async chares
 //! \details This function uses Zoltan to partition the mesh graph in parallel.
 //!   It assumes that the mesh graph is distributed among all the MPI ranks.
+//!   If element weights are given, the partitions are balanced in the sum of
+//!   the weights of their elements, otherwise in the number of elements.
 // *****************************************************************************
 {
+  Assert( elemwgt.empty() || elemwgt.size() == elemid.size(),
+          "Number of element weights must equal the number of elements" );
+
   // Set Zoltan parameters
   Teuchos::ParameterList params( "Zoltan parameters" );
   params.set( "algorithm", tk::ctr::PartitioningAlgorithm().param(algorithm) );
@@ -144,7 +321,7 @@ geomPartMesh( tk::ctr::PartitioningAlgorithmType algorithm,
 
   // Create mesh adapter for Zoltan for mesh element partitioning
   using InciterZoltanAdapter = GeometricMeshElemAdapter< ZoltanTypes >;
-  InciterZoltanAdapter adapter( elemid.size(), centroid, elemid );
+  InciterZoltanAdapter adapter( elemid.size(), centroid, elemid, elemwgt );
 
   // Create Zoltan2 partitioning problem using our mesh input adapter
   Zoltan2::PartitioningProblem< InciterZoltanAdapter >
@@ -164,5 +341,70 @@ geomPartMesh( tk::ctr::PartitioningAlgorithmType algorithm,
   return chare;
 }
 
+std::vector< std::size_t >
+graphPartMesh( tk::ctr::PartitioningAlgorithmType algorithm,
+               const std::array< std::vector< tk::real >, 3 >& centroid,
+               const std::vector< long >& elemid,
+               const std::vector< std::size_t >& ginpoel,
+               int npart,
+               const std::vector< tk::real >& elemwgt )
+// *****************************************************************************
+//  Partition mesh using Zoltan2 with a connectivity-based partitioner, such as
+//  PHG or ParMETIS
+//! \param[in] algorithm Partitioning algorithm type
+//! \param[in] centroid Mesh element coordinates
+//! \param[in] elemid Global mesh element ids, unique across all ranks
+//! \param[in] ginpoel Mesh element connectivity with global node ids
+//! \param[in] npart Number of desired graph partitions
+//! \param[in] elemwgt Mesh element weights, e.g., estimated computational
+//!   cost, empty (default) for equal weights
+//! \return Array of chare ownership IDs mapping graph points to concurrent
+//!   async chares
+//! \details As opposed to geomPartMesh(), the partitions minimize the number
+//!   of mesh nodes shared among partitions, which are the nodes communicated
+//!   by the node-centered schemes and bound the faces communicated by DG. The
+//!   hypergraph partitioner takes the mesh nodes as hyperedges, connecting
+//!   all elements surrounding them. Graph partitioners take the element graph
+//!   induced by the shared nodes, which Zoltan2 assembles in parallel across
+//!   the ranks from the adjacencies. Communication costs are not weighted by
+//!   the number of scalar components, as scaling all of them by the same
+//!   factor leaves the partitions unchanged.
+// *****************************************************************************
+{
+  Assert( elemwgt.empty() || elemwgt.size() == elemid.size(),
+          "Number of element weights must equal the number of elements" );
+  Assert( ginpoel.size() == elemid.size()*4, "Size mismatch" );
+
+  // Set Zoltan parameters; elements, i.e., regions, are partitioned, their
+  // adjacencies are through nodes, i.e., vertices (the defaults of Zoltan2's
+  // MeshAdapter)
+  Teuchos::ParameterList params( "Zoltan parameters" );
+  params.set( "algorithm", tk::ctr::PartitioningAlgorithm().param(algorithm) );
+  params.set( "num_global_parts", std::to_string(npart) );
+  params.set( "objects_to_partition", "mesh_elements" );
+
+  // Define types for Zoltan2, see geomPartMesh()
+  using ZoltanTypes = Zoltan2::BasicUserTypes< tk::real, long, long >;
+
+  // Create mesh adapter for Zoltan for mesh element partitioning
+  using InciterZoltanAdapter = ConnectedMeshElemAdapter< ZoltanTypes >;
+  InciterZoltanAdapter adapter( centroid, elemid, ginpoel, elemwgt );
+
+  // Create Zoltan2 partitioning problem using our mesh input adapter
+  Zoltan2::PartitioningProblem< InciterZoltanAdapter >
+    partitioner( &adapter, &params );
+
+  // Perform partitioning using Zoltan
+  partitioner.solve();
+
+  // Copy over array of chare IDs corresponding to the ownership of elements
+  auto partlist = partitioner.getSolution().getPartListView();
+  std::vector< std::size_t > chare( elemid.size() );
+  for (std::size_t p=0; p<elemid.size(); ++p )
+    chare[p] = static_cast< std::size_t >( partlist[p] );
+
+  return chare;
+}
+
 } // zoltan::
 } // tk::
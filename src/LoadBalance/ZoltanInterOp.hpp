@@ -33,7 +33,18 @@ std::vector< std::size_t >
 geomPartMesh( tk::ctr::PartitioningAlgorithmType algorithm,
               const std::array< std::vector< tk::real >, 3 >& elemcoord,
               const std::vector< long >& elemid,
-              int npart );
+              int npart,
+              const std::vector< tk::real >& elemwgt = {} );
+
+//! \brief Partition mesh using Zoltan2 with a connectivity-based partitioner,
+//!   such as PHG or ParMETIS
+std::vector< std::size_t >
+graphPartMesh( tk::ctr::PartitioningAlgorithmType algorithm,
+               const std::array< std::vector< tk::real >, 3 >& centroid,
+               const std::vector< long >& elemid,
+               const std::vector< std::size_t >& ginpoel,
+               int npart,
+               const std::vector< tk::real >& elemwgt = {} );
 
 } // zoltan::
 } // tk::
@@ -0,0 +1,38 @@
+### AMRBench executable ########################################################
+
+add_executable(${AMRBENCH_EXECUTABLE}
+               AMRBenchDriver.cpp
+               AMRBench.cpp)
+
+config_executable(${AMRBENCH_EXECUTABLE})
+
+target_include_directories(${AMRBENCH_EXECUTABLE} PUBLIC
+                           ${QUINOA_SOURCE_DIR}/Inciter
+                           ${PROJECT_BINARY_DIR}/../Base)
+
+target_link_libraries(${AMRBENCH_EXECUTABLE}
+                      MeshRefinement
+                      NativeMeshIO
+                      ExodusIIMeshIO
+                      HyperMeshIO
+                      MeshDetect
+                      Mesh
+                      AMRBenchControl
+                      Base
+                      Config
+                      Init
+                      ${PUGIXML_LIBRARIES}
+                      ${SEACASExodus_LIBRARIES}
+                      ${NETCDF_LIBRARIES}       # only for static link
+                      ${HDF5_HL_LIBRARIES}      # only for static link
+                      ${HDF5_C_LIBRARIES}
+                      ${AEC_LIBRARIES}          # only for static link
+                      ${BACKWARD_LIBRARIES}
+                      ${OMEGA_H_LIBRARIES}
+                      ${LIBCXX_LIBRARIES}       # only for static link with libc++
+                      ${LIBCXXABI_LIBRARIES})   # only for static link with libc++
+
+# Add custom dependencies for AMRBench's main Charm++ module
+addCharmModule( "amrbench" "${AMRBENCH_EXECUTABLE}" )
+
+add_dependencies( "amrbenchCharmModule" "charestatecollectorCharmModule" )
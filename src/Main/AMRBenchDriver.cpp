@@ -0,0 +1,226 @@
+// *****************************************************************************
+/*!
+  \file      src/Main/AMRBenchDriver.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Mesh refinement benchmark driver
+  \details   Mesh refinement benchmark driver.
+*/
+// *****************************************************************************
+
+#include <array>
+#include <cmath>
+#include <algorithm>
+
+#include "Types.hpp"
+#include "Tags.hpp"
+#include "AMRBenchDriver.hpp"
+#include "MeshFactory.hpp"
+#include "TaggedTupleDeepPrint.hpp"
+#include "Writer.hpp"
+#include "Timer.hpp"
+#include "Fields.hpp"
+#include "DerivedData.hpp"
+#include "AMR/mesh_adapter.hpp"
+#include "AMR/Error.hpp"
+
+#include "NoWarning/amrbench.decl.h"
+
+using amrbench::AMRBenchDriver;
+
+extern CProxy_Main mainProxy;
+
+AMRBenchDriver::AMRBenchDriver( const ctr::CmdLine& cmdline, int ) :
+  m_print( cmdline.logname( cmdline.get< tag::io, tag::screen >(),
+                            cmdline.get< tag::io, tag::nrestart >() ),
+           cmdline.get< tag::verbose >() ? std::cout : std::clog,
+           std::ios_base::app ),
+  m_ncycle( cmdline.get< tag::ncycle >() ),
+  m_uniform( cmdline.get< tag::uniform >() ),
+  m_input()
+// *****************************************************************************
+//  Constructor
+//! \param[in] cmdline Command line object storing data parsed from the command
+//!   line arguments
+// *****************************************************************************
+{
+  // Save input file name
+  m_input = cmdline.get< tag::io, tag::input >();
+
+  // Output command line object to file
+  auto logfilename = tk::amrbench_executable() + "_input.log";
+  tk::Writer log( logfilename );
+  tk::print( log.stream(), "cmdline", cmdline );
+}
+
+void
+AMRBenchDriver::execute() const
+// *****************************************************************************
+//  Execute: Refine and derefine mesh and time the phases of mesh refinement
+//! \details Each cycle consists of a refinement step followed by a
+//!   derefinement step, both done by the mesh refiner lib, AMR::mesh_adapter_t,
+//!   the same way Inciter's Refiner does within a mesh partition. With uniform
+//!   refinement all cells are refined, then derefined, in each cycle. With
+//!   error-based refinement the edges are tagged using the jump error
+//!   indicator of a smooth step whose front sweeps across the mesh in the x
+//!   direction during the cycles, so that cells are refined along the front
+//!   and edges away from it are tagged for derefinement, as in
+//!   Refiner::errorRefine(). The wall-clock time of each step is
+//!   accumulated separately for the phases of tagging and marking edges,
+//!   refinement, derefinement, updating the mesh (coordinates of added nodes
+//!   and renumbering of nodes), and regenerating the derived data the solvers
+//!   need on the new mesh. Since amrbench runs on a single mesh partition,
+//!   there is no communication among partitions to time.
+// *****************************************************************************
+{
+  m_print.endsubsection();
+
+  std::vector< std::pair< std::string, tk::real > > times( 1 );
+  auto mesh = tk::readUnsMesh( m_print, m_input, times[0] );
+
+  // Refinement and derefinement tolerances, same as Inciter's defaults
+  const tk::real tolref = 0.2;
+  const tk::real tolderef = 0.05;
+
+  // Phases of a mesh refinement step timed
+  enum Phase { MARK=0, REFINE, DEREFINE, UPDATE, DERIVED, NPHASE };
+  const std::array< std::string, NPHASE > name{{ "Mark", "Refine", "Derefine",
+    "Mesh update", "Derived data" }};
+  std::array< tk::real, NPHASE > dt;
+  dt.fill( 0.0 );
+
+  // Time a phase of a mesh refinement step
+  auto time = [&]( Phase p, const auto& f ) {
+    tk::Timer t;
+    f();
+    dt[p] += t.dsec();
+  };
+
+  // Node coordinates indexed by refiner lib node ids
+  tk::UnsMesh::Coords rcoord{{ mesh.x(), mesh.y(), mesh.z() }};
+
+  // Extents of the front sweeping across the mesh
+  auto [ xmin, xmax ] = std::minmax_element( begin(rcoord[0]), end(rcoord[0]) );
+  auto x0 = *xmin;
+  auto length = *xmax - *xmin;
+
+  AMR::mesh_adapter_t refiner( mesh.tetinpoel() );
+
+  // Current mesh: connectivity, coordinates, local->refiner lib node ids, and
+  // derived data
+  std::vector< std::size_t > inpoel, rid, inpoed;
+  tk::UnsMesh::Coords coord;
+  std::pair< std::vector< std::size_t >, std::vector< std::size_t > > esup;
+
+  // Update mesh after a refinement step: generate coordinates for nodes added
+  // (at edge midpoints) and renumber the nodes of the active cells
+  auto update = [&]() {
+    inpoel = refiner.tet_store.get_active_inpoel();
+    std::size_t nr = 0;
+    for (auto r : inpoel) nr = std::max( nr, r+1 );
+    // parents always have lower ids than the nodes added between them
+    for (auto r=rcoord[0].size(); r<nr; ++r) {
+      auto p = refiner.node_connectivity.get( r );
+      for (auto& x : rcoord) x.push_back( (x[p[0]] + x[p[1]])/2.0 );
+    }
+    std::vector< std::size_t > lid( nr, 0 );
+    for (auto r : inpoel) lid[r] = 1;
+    rid.clear();
+    for (std::size_t r=0; r<nr; ++r)
+      if (lid[r]) {
+        lid[r] = rid.size();
+        rid.push_back( r );
+      }
+    for (auto& r : inpoel) r = lid[r];
+    for (std::size_t j=0; j<3; ++j) {
+      coord[j].resize( rid.size() );
+      for (std::size_t i=0; i<rid.size(); ++i) coord[j][i] = rcoord[j][rid[i]];
+    }
+  };
+
+  // Regenerate derived data on the new mesh
+  auto derived = [&]() {
+    esup = tk::genEsup( inpoel, 4 );
+    auto psup = tk::genPsup( inpoel, 4, esup );
+    auto esuel = tk::genEsuelTet( inpoel, esup );
+    inpoed = tk::genInpoed( inpoel, 4, esup );
+  };
+
+  // Tag edges for refinement or derefinement based on the errors of a smooth
+  // step whose front is at xf
+  auto tag = [&]( tk::real xf, AMR::edge_tag t ) {
+    tk::Fields u( coord[0].size(), 1 );
+    auto width = length / 40.0;
+    for (std::size_t i=0; i<coord[0].size(); ++i)
+      u(i,0,0) = 2.0 + std::tanh( (coord[0][i] - xf) / width );
+    AMR::Error error;
+    auto err = error.scalars( u, inpoed, {0}, coord, inpoel, esup,
+                              inciter::ctr::AMRErrorType::JUMP );
+    std::vector< std::pair< AMR::edge_t, AMR::edge_tag > > edges;
+    for (std::size_t e=0; e<inpoed.size()/2; ++e)
+      if (t == AMR::edge_tag::REFINE ? err[e] > tolref : err[e] < tolderef)
+        edges.push_back(
+          { AMR::edge_t( rid[inpoed[e*2]], rid[inpoed[e*2+1]] ), t } );
+    refiner.mark_error_refinement( edges );
+  };
+
+  update();
+  derived();
+
+  auto ncell0 = inpoel.size()/4;
+  auto maxncell = ncell0;
+  std::size_t ncell = 0;        // number of cells generated across all steps
+
+  for (std::size_t c=0; c<m_ncycle; ++c) {
+    auto xf = x0 + length * static_cast< tk::real >( c+1 )
+                          / static_cast< tk::real >( m_ncycle+1 );
+
+    // Refinement step
+    time( MARK, [&]{
+      if (m_uniform)
+        refiner.mark_uniform_refinement();
+      else
+        tag( xf, AMR::edge_tag::REFINE );
+    } );
+    time( REFINE, [&]{ refiner.perform_refinement(); } );
+    time( UPDATE, update );
+    time( DERIVED, derived );
+    maxncell = std::max( maxncell, inpoel.size()/4 );
+    ncell += inpoel.size()/4;
+
+    // Derefinement step
+    time( MARK, [&]{
+      if (m_uniform)
+        refiner.mark_uniform_derefinement();
+      else
+        tag( xf, AMR::edge_tag::DEREFINE );
+    } );
+    time( DEREFINE, [&]{ refiner.perform_derefinement(); } );
+    time( UPDATE, update );
+    time( DERIVED, derived );
+    ncell += inpoel.size()/4;
+  }
+
+  tk::real total = 0.0;
+  for (auto t : dt) total += t;
+
+  m_print.section( "Mesh refinement benchmark" );
+  m_print.item( "Refinement", m_uniform ? "uniform" : "error-based" );
+  m_print.item( "Number of cycles", m_ncycle );
+  m_print.item( "Initial number of cells", ncell0 );
+  m_print.item( "Maximum number of cells", maxncell );
+  m_print.item( "Final number of cells", inpoel.size()/4 );
+  for (std::size_t p=0; p<NPHASE; ++p) {
+    m_print.item( name[p] + " (s)", dt[p] );
+    times.emplace_back( "AMR " + name[p], dt[p] );
+  }
+  m_print.item( "Total (s)", total );
+  if (total > 0.0)
+    m_print.item( "Throughput (cells/s)", static_cast<tk::real>(ncell)/total );
+
+  mainProxy.timestamp( times );
+
+  mainProxy.finalize();
+}
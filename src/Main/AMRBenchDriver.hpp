@@ -0,0 +1,42 @@
+// *****************************************************************************
+/*!
+  \file      src/Main/AMRBenchDriver.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Mesh refinement benchmark driver
+  \details   Mesh refinement benchmark driver.
+*/
+// *****************************************************************************
+#ifndef AMRBenchDriver_h
+#define AMRBenchDriver_h
+
+#include <iosfwd>
+
+#include "Print.hpp"
+#include "AMRBench/CmdLine/CmdLine.hpp"
+
+//! Mesh refinement benchmark declarations and definitions
+namespace amrbench {
+
+//! Mesh refinement benchmark driver used polymorphically with tk::Driver
+class AMRBenchDriver {
+
+  public:
+    //! Constructor
+    explicit AMRBenchDriver( const ctr::CmdLine& cmdline, int );
+
+    //! Execute
+    void execute() const;
+
+  private:
+    const tk::Print m_print;            //!< Pretty printer
+    const std::size_t m_ncycle;         //!< Number of refinement cycles
+    const bool m_uniform;               //!< True: uniform, false: error-based
+    std::string m_input;                //!< Input file name
+};
+
+} // amrbench::
+
+#endif // AMRBenchDriver_h
@@ -16,6 +16,7 @@
 #include <unordered_map>
 #include <vector>
 #include <iostream>
+#include <fstream>
 
 #include "Types.hpp"
 #include "Init.hpp"
@@ -32,6 +33,7 @@
 #include "Inciter/CmdLine/CmdLine.hpp"
 #include "Inciter/InputDeck/InputDeck.hpp"
 #include "ChareStateCollector.hpp"
+#include "PerfCounter.hpp"
 #include "LBSwitch.hpp"
 
 #include "NoWarning/inciter.decl.h"
@@ -203,8 +205,15 @@ class Main : public CBase_Main {
       tk::MainCtor( mainProxy, thisProxy, m_timer, m_cmdline,
                     CkCallback( CkIndex_Main::quiescence(), thisProxy ) );
       // If quiescence detection is on or user requested it, create chare state
-      // collector Charm++ chare group
-      if ( m_cmdline.get< tag::chare >() || m_cmdline.get< tag::quiescence >() )
+      // collector Charm++ chare group, also recording trace events and
+      // sampling performance counters if enabled
+      const auto tracebuf = m_cmdline.get< tag::tracebuf >();
+      const auto perfctr = m_cmdline.get< tag::perfctr >();
+      if (tracebuf || perfctr)
+        stateProxy =
+          tk::CProxy_ChareStateCollector::ckNew( tracebuf, perfctr );
+      else if ( m_cmdline.get< tag::chare >() ||
+                m_cmdline.get< tag::quiescence >() )
         stateProxy = tk::CProxy_ChareStateCollector::ckNew();
       // Fire up an asynchronous execute object, which when created at some
       // future point in time will call back to this->execute(). This is
@@ -249,12 +258,62 @@ class Main : public CBase_Main {
       } catch (...) { tk::processExceptionCharm(); }
     }
 
-    //! Towards normal exit but collect chare state first (if any)
+    //! Towards normal exit but write trace events first (if any)
     void finalize() {
-      tk::finalize( m_cmdline, m_timer, stateProxy, m_timestamp,
-        inciter::g_inputdeck_defaults.get< tag::cmd, tag::io, tag::screen >(),
-        inciter::g_inputdeck.get< tag::cmd, tag::io, tag::nrestart >(),
-        CkCallback( CkIndex_Main::dumpstate(nullptr), thisProxy ) );
+      try {
+        if (m_cmdline.get< tag::tracebuf >())
+          stateProxy.dumptrace(
+            m_cmdline.get< tag::io, tag::perf >() + ".trace",
+            CkCallback( CkIndex_Main::traced(), thisProxy ) );
+        else
+          traced();
+      } catch (...) { tk::processExceptionCharm(); }
+    }
+
+    //! Towards normal exit but collect performance counters first (if any)
+    void traced() {
+      try {
+        if (m_cmdline.get< tag::perfctr >())
+          stateProxy.counters(
+            CkCallback( CkIndex_Main::counted(nullptr), thisProxy ) );
+        else
+          finish();
+      } catch (...) { tk::processExceptionCharm(); }
+    }
+
+    //! Report performance counters collected from all PEs
+    //! \param[in] msg Serialized rows of all PEs per region, see tk::perfRows()
+    //! \details The summary is printed to screen, while the rows of all PEs
+    //!   are written to a file named after the performance log.
+    void counted( CkReductionMsg* msg ) {
+      try {
+        std::unordered_map< std::string, std::vector< tk::real > > rows;
+        PUP::fromMem creator( msg->getData() );
+        creator | rows;
+        delete msg;
+
+        tk::Print print( m_cmdline.logname(
+          inciter::g_inputdeck_defaults.get< tag::cmd, tag::io, tag::screen >(),
+          inciter::g_inputdeck.get< tag::cmd, tag::io, tag::nrestart >() ),
+          m_cmdline.get< tag::verbose >() ? std::cout : std::clog,
+          std::ios_base::app );
+        print.section( "Performance counters (sum across PEs)" );
+        for (const auto& s : tk::perfSummary( rows ))
+          print.item( s.first, s.second );
+
+        const auto name = m_cmdline.get< tag::io, tag::perf >() + ".ctr";
+        std::ofstream f( name );
+        ErrChk( f.good(), "Failed to open performance counter file: " + name );
+        f << "# region pe calls time cycles instructions l1dmiss llcmiss\n";
+        for (const auto& [ region, r ] : rows)
+          for (std::size_t i=0; i+tk::PRSTRIDE<=r.size(); i+=tk::PRSTRIDE) {
+            f << region;
+            for (std::size_t j=0; j<tk::PRSTRIDE; ++j) f << ' ' << r[i+j];
+            f << '\n';
+          }
+
+        finish();
+      } catch (...) { tk::processExceptionCharm(); }
     }
 
     //! Entry method triggered when quiescence is detected
@@ -296,6 +355,14 @@ class Main : public CBase_Main {
     std::vector< tk::Timer > m_timer;           //!< Timers
     //! Time stamps in h:m:s with labels
     std::vector< std::pair< std::string, tk::Timer::Watch > > m_timestamp;
+
+    //! Towards normal exit but collect chare state first (if any)
+    void finish() {
+      tk::finalize( m_cmdline, m_timer, stateProxy, m_timestamp,
+        inciter::g_inputdeck_defaults.get< tag::cmd, tag::io, tag::screen >(),
+        inciter::g_inputdeck.get< tag::cmd, tag::io, tag::nrestart >(),
+        CkCallback( CkIndex_Main::dumpstate(nullptr), thisProxy ) );
+    }
 };
 
 //! \brief Charm++ chare execute
@@ -67,6 +67,15 @@ InciterDriver::InciterDriver( const ctr::CmdLine& cmdline, int nrestart )
   print.item( "Checkpoint/restart frequency, -" + *kw::rsfreq::alias(),
                std::to_string(cmdline.get< tag::rsfreq >()) );
 
+  if (cmdline.get< tag::memfreq >() > 0) {
+    #if !defined(CMK_MEM_CHECKPOINT) || !CMK_MEM_CHECKPOINT
+    Throw( "In-memory checkpoints require Charm++ built with the syncft "
+           "option" );
+    #endif
+    print.item( "In-memory checkpoint frequency, -" + *kw::memfreq::alias(),
+                 std::to_string(cmdline.get< tag::memfreq >()) );
+  }
+
   // Parse input deck into g_inputdeck
   print.item( "Control file", cmdline.get< tag::io, tag::control >() );
   g_inputdeck = g_inputdeck_defaults;   // overwrite with defaults if restarted
@@ -21,6 +21,7 @@
 #include "Tags.hpp"
 #include "Keywords.hpp"
 #include "Init.hpp"
+#include "ISA.hpp"
 
 namespace tk {
 
@@ -85,6 +86,10 @@ void echoHeader( const Print& print, HeaderType header )
     print.headerWalker();
   else if ( header == HeaderType::FILECONV )
     print.headerFileConv();
+  else if ( header == HeaderType::AMRBENCH )
+    print.headerAMRBench();
+  else if ( header == HeaderType::MICROBENCH )
+    print.headerMicroBench();
   else
     Throw( "Header not available" );
 }
@@ -154,6 +159,7 @@ void echoRunEnv( const Print& print, int argc, char** argv,
               verbose ? "verbose" : "quiet" );
   print.item( "Screen output log file, -" + *kw::screen::alias(), screen_log );
   print.item( "Input log file", input_log );
+  print.item( "Kernel instruction set", tk::isa() );
   print.item( "Number of processing elements",
               std::to_string( CkNumPes() ) + " (" +
               std::to_string( CkNumNodes() ) + 'x' +
@@ -34,7 +34,9 @@ enum class HeaderType : uint8_t { INCITER=0,
                                   UNITTEST,
                                   MESHCONV,
                                   FILECONV,
-                                  WALKER };
+                                  WALKER,
+                                  AMRBENCH,
+                                  MICROBENCH };
 
 //! Wrapper for the standard C library's gettimeofday() from
 std::string curtime();
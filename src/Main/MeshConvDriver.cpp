@@ -29,6 +29,7 @@ MeshConvDriver::MeshConvDriver( const ctr::CmdLine& cmdline, int ) :
            cmdline.get< tag::verbose >() ? std::cout : std::clog,
            std::ios_base::app ),
   m_reorder( cmdline.get< tag::reorder >() ),
+  m_stream( cmdline.get< tag::stream >() ),
   m_input(),
   m_output()
 // *****************************************************************************
@@ -63,10 +64,26 @@ MeshConvDriver::execute() const
 
     // Convert single mesh
 
-    times.push_back( {} );
-    auto mesh = tk::readUnsMesh( m_print, m_input, times[0] );
-    auto wtimes = tk::writeUnsMesh( m_print, m_output, mesh, m_reorder );
-    times.insert( end(times), begin(wtimes), end(wtimes) );
+    bool stream = m_stream && !m_reorder &&
+                  tk::streamable( m_input, m_output );
+    if (m_stream && !stream)
+      m_print.diag( "Streaming not supported for the mesh formats or with "
+                    "reordering, converting in memory" );
+
+    if (stream) {
+
+      // Number of nodes or elements held in memory at a time
+      const std::size_t chunk = 1UL << 20;
+      times = tk::streamUnsMesh( m_print, m_input, m_output, chunk );
+
+    } else {
+
+      times.push_back( {} );
+      auto mesh = tk::readUnsMesh( m_print, m_input, times[0] );
+      auto wtimes = tk::writeUnsMesh( m_print, m_output, mesh, m_reorder );
+      times.insert( end(times), begin(wtimes), end(wtimes) );
+
+    }
 
   } else {
 
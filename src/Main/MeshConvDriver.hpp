@@ -33,6 +33,7 @@ class MeshConvDriver {
   private:
     const tk::Print m_print;            //!< Pretty printer
     const bool m_reorder;               //!< Whether to also reorder mesh nodes
+    const bool m_stream;                //!< Whether to convert mesh in chunks
     std::string m_input;                //!< Input file name
     std::string m_output;               //!< Output file name
 };
@@ -0,0 +1,29 @@
+### MicroBench executable ######################################################
+
+add_executable(${MICROBENCH_EXECUTABLE}
+               MicroBenchDriver.cpp
+               MicroBench.cpp)
+
+config_executable(${MICROBENCH_EXECUTABLE})
+
+target_include_directories(${MICROBENCH_EXECUTABLE} PUBLIC
+                           ${QUINOA_SOURCE_DIR}/Inciter
+                           ${QUINOA_SOURCE_DIR}/PDE
+                           ${PROJECT_BINARY_DIR}/../Base)
+
+target_link_libraries(${MICROBENCH_EXECUTABLE}
+                      Integrate
+                      InciterControl
+                      Mesh
+                      MicroBenchControl
+                      Base
+                      Config
+                      Init
+                      ${BACKWARD_LIBRARIES}
+                      ${LIBCXX_LIBRARIES}       # only for static link with libc++
+                      ${LIBCXXABI_LIBRARIES})   # only for static link with libc++
+
+# Add custom dependencies for MicroBench's main Charm++ module
+addCharmModule( "microbench" "${MICROBENCH_EXECUTABLE}" )
+
+add_dependencies( "microbenchCharmModule" "charestatecollectorCharmModule" )
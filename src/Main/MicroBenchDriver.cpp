@@ -0,0 +1,311 @@
+// *****************************************************************************
+/*!
+  \file      src/Main/MicroBenchDriver.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Microbenchmark suite driver
+  \details   Microbenchmark suite driver.
+*/
+// *****************************************************************************
+
+#include <array>
+#include <cmath>
+#include <sstream>
+#include <iomanip>
+
+#include "Types.hpp"
+#include "Tags.hpp"
+#include "MicroBenchDriver.hpp"
+#include "TaggedTupleDeepPrint.hpp"
+#include "Writer.hpp"
+#include "Benchmark.hpp"
+#include "Data.hpp"
+#include "DerivedData.hpp"
+#include "Init.hpp"
+#include "Integrate/Basis.hpp"
+#include "Integrate/Quadrature.hpp"
+#include "Riemann/HLLC.hpp"
+#include "Riemann/LaxFriedrichs.hpp"
+#include "EoS/EoS.hpp"
+#include "Inciter/InputDeck/InputDeck.hpp"
+
+#include "NoWarning/microbench.decl.h"
+
+using microbench::MicroBenchDriver;
+
+extern CProxy_Main mainProxy;
+
+namespace inciter {
+
+extern ctr::InputDeck g_inputdeck;
+
+} // inciter::
+
+namespace microbench {
+
+//! Generate a tetrahedron mesh of the unit cube
+//! \param[in] n Number of cubes along each axis, each cube split into six
+//!   tetrahedra sharing the main diagonal of the cube
+//! \param[in,out] inpoel Element connectivity
+//! \param[in,out] coord Node coordinates
+//! \details The nodes of tetrahedra with negative volume are swapped so that
+//!   all tetrahedra are positively oriented as the solvers expect.
+static void
+boxMesh( std::size_t n,
+         std::vector< std::size_t >& inpoel,
+         std::array< std::vector< tk::real >, 3 >& coord )
+{
+  const auto m = n+1;
+  const auto h = 1.0 / static_cast< tk::real >( n );
+  for (auto& x : coord) x.resize( m*m*m );
+  for (std::size_t k=0; k<m; ++k)
+    for (std::size_t j=0; j<m; ++j)
+      for (std::size_t i=0; i<m; ++i) {
+        auto p = (k*m + j)*m + i;
+        coord[0][p] = static_cast< tk::real >( i ) * h;
+        coord[1][p] = static_cast< tk::real >( j ) * h;
+        coord[2][p] = static_cast< tk::real >( k ) * h;
+      }
+
+  // corners of a cube along the six paths from corner 0 to corner 6
+  const std::array< std::array< std::size_t, 4 >, 6 >
+    tet{{ {{0,1,2,6}}, {{0,2,3,6}}, {{0,3,7,6}},
+          {{0,7,4,6}}, {{0,4,5,6}}, {{0,5,1,6}} }};
+  const auto& x = coord[0];
+  const auto& y = coord[1];
+  const auto& z = coord[2];
+
+  inpoel.clear();
+  inpoel.reserve( n*n*n*24 );
+  for (std::size_t k=0; k<n; ++k)
+    for (std::size_t j=0; j<n; ++j)
+      for (std::size_t i=0; i<n; ++i) {
+        auto p = (k*m + j)*m + i;
+        const std::array< std::size_t, 8 >
+          c{{ p, p+1, p+m+1, p+m, p+m*m, p+m*m+1, p+m*m+m+1, p+m*m+m }};
+        for (const auto& t : tet) {
+          std::array< std::size_t, 4 >
+            e{{ c[t[0]], c[t[1]], c[t[2]], c[t[3]] }};
+          auto ax = x[e[1]]-x[e[0]], ay = y[e[1]]-y[e[0]], az = z[e[1]]-z[e[0]];
+          auto bx = x[e[2]]-x[e[0]], by = y[e[2]]-y[e[0]], bz = z[e[2]]-z[e[0]];
+          auto cx = x[e[3]]-x[e[0]], cy = y[e[3]]-y[e[0]], cz = z[e[3]]-z[e[0]];
+          auto vol = ax*(by*cz - bz*cy) - ay*(bx*cz - bz*cx)
+                   + az*(bx*cy - by*cx);
+          if (vol < 0.0) std::swap( e[2], e[3] );
+          inpoel.insert( end(inpoel), begin(e), end(e) );
+        }
+      }
+}
+
+//! Run the benchmarks of sweeps over a field with a given data layout
+//! \param[in] bench Benchmark harness to run the benchmarks with
+//! \param[in] layout Name of the data layout, appended to benchmark names
+//! \param[in] nunk Number of unknowns of the field
+//! \param[in] nprop Number of properties (components) of the field
+//! \details The unknown sweep visits all components of an unknown before the
+//!   next unknown, as do the pointwise kernels, e.g., Riemann solvers, while
+//!   the component sweep visits all unknowns of a component before the next
+//!   component, as do the vectorized kernels, e.g., the batched EoS.
+template< uint8_t Layout >
+static void
+dataSweeps( tk::Benchmark& bench,
+            const std::string& layout,
+            std::size_t nunk,
+            std::size_t nprop )
+{
+  tk::Data< Layout > u( nunk, nprop );
+  for (std::size_t i=0; i<nunk; ++i)
+    for (std::size_t c=0; c<nprop; ++c)
+      u( i, c, 0 ) = 1.0 + static_cast< tk::real >( (i+c) % 7 );
+  std::vector< tk::real > s( nunk );
+  const auto bytes = (nprop+1) * nunk * sizeof(tk::real);
+
+  bench.run( "data:unknown_sweep:" + layout, nunk, bytes, [&]{
+    for (std::size_t i=0; i<nunk; ++i) {
+      tk::real r = 0.0;
+      for (std::size_t c=0; c<nprop; ++c) r += u( i, c, 0 );
+      s[i] = r;
+    }
+    tk::doNotOptimize( s );
+  } );
+
+  bench.run( "data:component_sweep:" + layout, nunk, bytes, [&]{
+    std::fill( begin(s), end(s), 0.0 );
+    for (std::size_t c=0; c<nprop; ++c)
+      for (std::size_t i=0; i<nunk; ++i) s[i] += u( i, c, 0 );
+    tk::doNotOptimize( s );
+  } );
+}
+
+} // microbench::
+
+MicroBenchDriver::MicroBenchDriver( const ctr::CmdLine& cmdline, int ) :
+  m_print( cmdline.logname( cmdline.get< tag::io, tag::screen >(),
+                            cmdline.get< tag::io, tag::nrestart >() ),
+           cmdline.get< tag::verbose >() ? std::cout : std::clog,
+           std::ios_base::app ),
+  m_json( cmdline.get< tag::io, tag::json >() ),
+  m_filter( cmdline.get< tag::filter >() ),
+  m_mintime( static_cast< tk::real >( cmdline.get< tag::mintime >() )/1000.0 ),
+  m_boxsize( cmdline.get< tag::boxsize >() )
+// *****************************************************************************
+//  Constructor
+//! \param[in] cmdline Command line object storing data parsed from the command
+//!   line arguments
+// *****************************************************************************
+{
+  // Configure the material constants of a single ideal gas, air, queried by
+  // the Riemann solvers via the equation of state
+  auto& compflow = inciter::g_inputdeck.get< tag::param, tag::compflow >();
+  compflow.get< tag::gamma >() = {{ 1.4 }};
+  compflow.get< tag::pstiff >() = {{ 0.0 }};
+  compflow.get< tag::cv >() = {{ 717.5 }};
+
+  // Output command line object to file
+  auto logfilename = tk::microbench_executable() + "_input.log";
+  tk::Writer log( logfilename );
+  tk::print( log.stream(), "cmdline", cmdline );
+}
+
+void
+MicroBenchDriver::execute() const
+// *****************************************************************************
+//  Execute: Run the microbenchmarks and report their results
+//! \details The building blocks of the PDE solvers are benchmarked in
+//!   isolation on data sized by the box mesh generated, so that changes in
+//!   the performance of a kernel, e.g., a Riemann solver, are not washed out
+//!   by the rest of a time step. Each kernel is timed by tk::Benchmark, and
+//!   the results are both printed and written to a JSON file in the format of
+//!   Google Benchmark. Since microbench runs on a single PE, there is no
+//!   communication to time.
+// *****************************************************************************
+{
+  m_print.endsubsection();
+
+  tk::Benchmark bench( m_mintime, m_filter );
+
+  std::vector< std::size_t > inpoel;
+  std::array< std::vector< tk::real >, 3 > coord;
+  microbench::boxMesh( m_boxsize, inpoel, coord );
+  const auto nelem = inpoel.size()/4;
+  const auto npoin = coord[0].size();
+  const auto ib = inpoel.size() * sizeof(std::size_t);
+
+  // Compressible flow states of air with smooth variations, one per element
+  const std::size_t ncomp = 5;
+  const inciter::EoSParam air{ 1.4, 0.0, 717.5 };
+  auto state = [&]( std::size_t i, tk::real shift ){
+    auto x = static_cast< tk::real >( i ) * 1.0e-3 + shift;
+    auto rho = 1.0 + 0.1*std::sin(x);
+    std::array< tk::real, 3 > v{{ 0.5*std::cos(x), 0.2*std::sin(2.0*x), 0.1 }};
+    auto p = 1.0e5 * (1.0 + 0.05*std::cos(x));
+    auto rE = p/(air.gamma-1.0) + 0.5*rho*(v[0]*v[0] + v[1]*v[1] + v[2]*v[2]);
+    return std::vector< tk::real >{ rho, rho*v[0], rho*v[1], rho*v[2], rE };
+  };
+
+  // Riemann solvers on a batch of problems, one per element
+  tk::RiemannBatch rb( ncomp );
+  for (std::size_t i=0; i<nelem; ++i) {
+    auto x = static_cast< tk::real >( i );
+    std::array< tk::real, 3 > fn{{ std::cos(x), std::sin(x), 0.0 }};
+    rb.push_back( fn, {{ state( i, 0.0 ), state( i, 0.5 ) }}, {} );
+  }
+  std::vector< std::vector< tk::real > > flx;
+  const auto rbytes = nelem * (3 + 3*ncomp) * sizeof(tk::real);
+  bench.run( "riemann:hllc", nelem, rbytes, [&]{
+    inciter::HLLC::fluxes( rb, flx );
+    tk::doNotOptimize( flx );
+  } );
+  bench.run( "riemann:laxfriedrichs", nelem, rbytes, [&]{
+    inciter::LaxFriedrichs::fluxes( rb, flx );
+    tk::doNotOptimize( flx );
+  } );
+
+  // Equation of state on batches of states
+  std::vector< tk::real > p( nelem ), a( nelem );
+  const auto& ru = rb.u[0];
+  bench.run( "eos:pressure", nelem, 6 * nelem * sizeof(tk::real), [&]{
+    inciter::eos_pressure( air, nelem, ru[0], ru[1], ru[2], ru[3], ru[4], p );
+    tk::doNotOptimize( p );
+  } );
+  bench.run( "eos:soundspeed", nelem, 3 * nelem * sizeof(tk::real), [&]{
+    inciter::eos_soundspeed( air, nelem, ru[0], p, a );
+    tk::doNotOptimize( a );
+  } );
+
+  // Quadrature and basis functions of DG(P2)
+  const std::size_t ndof = 10;
+  const auto ng = tk::NGvol( ndof );
+  std::array< std::vector< tk::real >, 3 > coordgp;
+  std::vector< tk::real > wgp;
+  for (auto& c : coordgp) c.resize( ng );
+  wgp.resize( ng );
+  bench.run( "quadrature:GaussQuadratureTet", 1, 4 * ng * sizeof(tk::real),
+    [&]{
+      tk::GaussQuadratureTet( ng, coordgp, wgp );
+      tk::doNotOptimize( wgp );
+    } );
+  bench.run( "basis:eval_basis", ng, ng * ndof * sizeof(tk::real), [&]{
+    for (std::size_t g=0; g<ng; ++g) {
+      auto B = tk::eval_basis( ndof, coordgp[0][g], coordgp[1][g],
+                               coordgp[2][g] );
+      tk::doNotOptimize( B );
+    }
+  } );
+  const std::array< std::array< tk::real, 3 >, 3 >
+    jacInv{{ {{ 2.0, 0.1, 0.0 }}, {{ 0.0, 2.0, 0.1 }}, {{ 0.1, 0.0, 2.0 }} }};
+  std::array< std::vector< tk::real >, 3 > dBdx;
+  for (auto& d : dBdx) d.resize( ndof, 0.0 );
+  bench.run( "basis:eval_dBdx_p2", ng, ng * 3 * ndof * sizeof(tk::real), [&]{
+    for (std::size_t g=0; g<ng; ++g) {
+      tk::eval_dBdx_p2( g, coordgp, jacInv, dBdx );
+      tk::doNotOptimize( dBdx );
+    }
+  } );
+
+  // Derived mesh data
+  auto esup = tk::genEsup( inpoel, 4 );
+  bench.run( "mesh:genEsup", nelem, ib, [&]{
+    auto e = tk::genEsup( inpoel, 4 );
+    tk::doNotOptimize( e );
+  } );
+  bench.run( "mesh:genPsup", nelem, ib, [&]{
+    auto e = tk::genPsup( inpoel, 4, esup );
+    tk::doNotOptimize( e );
+  } );
+  bench.run( "mesh:genEsuelTet", nelem, ib, [&]{
+    auto e = tk::genEsuelTet( inpoel, esup );
+    tk::doNotOptimize( e );
+  } );
+
+  // Sweeps over nodal fields of the compressible flow unknowns
+  microbench::dataSweeps< tk::UnkEqComp >( bench, "UnkEqComp", npoin, ncomp );
+  microbench::dataSweeps< tk::EqCompUnk >( bench, "EqCompUnk", npoin, ncomp );
+  microbench::dataSweeps< tk::BlkEqCompUnk >
+    ( bench, "BlkEqCompUnk", npoin, ncomp );
+
+  m_print.section( "Microbenchmarks" );
+  m_print.item( "Mesh: elements, nodes", std::to_string( nelem ) + ", " +
+                                         std::to_string( npoin ) );
+  m_print.item( "Minimum time per benchmark (s)", m_mintime );
+  if (!m_filter.empty()) m_print.item( "Filter", m_filter );
+  for (const auto& r : bench.results()) {
+    std::stringstream ss;
+    ss << std::setprecision(4) << r.nsop() << " ns/op, " << r.gbs()
+       << " GB/s";
+    m_print.item( r.name, ss.str() );
+  }
+
+  tk::Writer json( m_json );
+  bench.json( json.stream(),
+              { { "executable", tk::microbench_executable() },
+                { "version", tk::quinoa_version() },
+                { "git_commit", tk::git_commit() },
+                { "date", tk::curtime() },
+                { "boxsize", std::to_string( m_boxsize ) } } );
+  m_print.item( "Results written to", m_json );
+
+  mainProxy.finalize();
+}
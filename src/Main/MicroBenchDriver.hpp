@@ -0,0 +1,43 @@
+// *****************************************************************************
+/*!
+  \file      src/Main/MicroBenchDriver.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Microbenchmark suite driver
+  \details   Microbenchmark suite driver.
+*/
+// *****************************************************************************
+#ifndef MicroBenchDriver_h
+#define MicroBenchDriver_h
+
+#include <iosfwd>
+
+#include "Print.hpp"
+#include "MicroBench/CmdLine/CmdLine.hpp"
+
+//! Microbenchmark suite declarations and definitions
+namespace microbench {
+
+//! Microbenchmark suite driver used polymorphically with tk::Driver
+class MicroBenchDriver {
+
+  public:
+    //! Constructor
+    explicit MicroBenchDriver( const ctr::CmdLine& cmdline, int );
+
+    //! Execute
+    void execute() const;
+
+  private:
+    const tk::Print m_print;            //!< Pretty printer
+    const std::string m_json;           //!< JSON output file name
+    const std::string m_filter;         //!< Only benchmarks matching are run
+    const tk::real m_mintime;           //!< Minimum time per benchmark (s)
+    const std::size_t m_boxsize;        //!< Number of cubes along each axis
+};
+
+} // microbench::
+
+#endif // MicroBenchDriver_h
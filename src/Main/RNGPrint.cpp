@@ -22,6 +22,7 @@
 #include "RNGPrint.hpp"
 #include "Options/RNG.hpp"
 #include "Options/RNGSSESeqLen.hpp"
+#include "Options/GaussianTransform.hpp"
 
 #ifdef HAS_MKL
   #include "Options/MKLGaussianMethod.hpp"
@@ -62,6 +63,12 @@ RNGPrint::echoMKLParams( const ctr::RNGMKLParam& p ) const
               % m_item_indent
               % gmvm.group()
               % gmvm.name( p.get< tag::gaussianmv_method >() );
+
+  ctr::GaussianTransform gt;
+  m_stream << m_item_name_value_fmt
+              % m_item_indent
+              % gt.group()
+              % gt.name( p.get< tag::gaussian_transform >() );
 }
 #endif
 
@@ -88,6 +95,12 @@ RNGPrint::echoRNGSSEParams( const ctr::RNGSSEParam& p,
                 % seq.group()
                 % seq.name( p.get< tag::seqlen >() );
   }
+
+  ctr::GaussianTransform gt;
+  m_stream << m_item_name_value_fmt
+              % m_item_indent
+              % gt.group()
+              % gt.name( p.get< tag::gaussian_transform >() );
 }
 
 void
@@ -101,6 +114,12 @@ RNGPrint::echoRandom123Params( const ctr::RNGRandom123Param& p ) const
               % m_item_indent
               % "seed"
               % p.get< tag::seed >();
+
+  ctr::GaussianTransform gt;
+  m_stream << m_item_name_value_fmt
+              % m_item_indent
+              % gt.group()
+              % gt.name( p.get< tag::gaussian_transform >() );
 }
 
 #ifdef HAS_MKL
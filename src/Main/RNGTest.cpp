@@ -159,7 +159,8 @@ void operator|( PUP::er& p, std::map< tk::ctr::RawRNGType, tk::RNG >& rng ) {
       #ifdef HAS_RNGSSE2
       g_inputdeck.get< tag::param, tag::rngsse >(),
       #endif
-      g_inputdeck.get< tag::param, tag::rng123 >() );
+      g_inputdeck.get< tag::param, tag::rng123 >(),
+      static_cast< std::size_t >( CkNumPes() ) );    // a stream per PE
     rng = stack.selected( g_inputdeck.get< tag::selected, tag::rng >() );
   }
 }
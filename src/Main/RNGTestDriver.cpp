@@ -15,6 +15,7 @@
 #include "Factory.hpp"
 #include "Battery.hpp"
 #include "TestU01Suite.hpp"
+#include "Benchmark.hpp"
 #include "RNGTestPrint.hpp"
 #include "RNGTestDriver.hpp"
 #include "RNGTest/InputDeck/InputDeck.hpp"
@@ -80,6 +81,7 @@ RNGTestDriver::execute() const
                     ( bf, BatteryType::CRUSH, BatteryType::CRUSH, 0 );
   tk::recordCharmModel< Battery, TestU01Suite >
                     ( bf, BatteryType::BIGCRUSH, BatteryType::BIGCRUSH, 0 );
+  tk::recordCharmModel< Battery, Benchmark >( bf, BatteryType::BENCHMARK, 0 );
   m_print.list< ctr::Battery >( "Registered batteries", bf );
   m_print.endpart();
 
@@ -202,6 +202,30 @@ class RNGTestPrint : public tk::RNGPrint {
       }
     }
 
+    //! Print throughput benchmark header (with legend)
+    //! \param[in] t String to use as title
+    void benchhead( const std::string& t ) const {
+      section( t );
+      raw( m_item_indent + "Legend: Distribution, batch size, threads : "
+                           "random numbers per second per core "
+                           "(parallel efficiency)\n\n" );
+    }
+
+    //! Print throughputs measured for an RNG
+    //! \param[in] status Vector of vector of string with the following assumed
+    //!   structure:
+    //!   - status[0]: vector of names of the measurements
+    //!   - status[1]: vector of throughputs measured, same length as status[0]
+    //!   - status[2]: vector of length 1: RNG name used for the measurements
+    void throughput( const std::vector< std::vector< std::string > >& status )
+    const {
+      section( status[2][0] );
+      for (std::size_t t=0; t<status[0].size(); ++t)
+        m_stream << m_item_widename_value_fmt % m_item_indent
+                                              % status[0][t]
+                                              % status[1][t];
+    }
+
     //! Print RNGs and their measured run times
     //! \param[in] name Section name
     //! \param[in] costnote A note on how to interpret the costs
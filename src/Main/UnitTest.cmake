@@ -15,22 +15,33 @@ endif()
 add_executable(${UNITTEST_EXECUTABLE}
                UnitTestDriver.cpp
                UnitTest.cpp
+               ../../tests/unit/Base/TestArnoldi.cpp
+               ../../tests/unit/Base/TestBenchmark.cpp
+               ../../tests/unit/Base/TestCompress.cpp
                ../../tests/unit/Base/TestContainerUtil.cpp
                ../../tests/unit/Base/TestData.cpp
                ../../tests/unit/Base/TestException.cpp
                ../../tests/unit/Base/TestExceptionMPI.cpp
+               ../../tests/unit/Base/TestExternalSort.cpp
                ../../tests/unit/Base/TestFactory.cpp
                ../../tests/unit/Base/TestFlip_map.cpp
+               ../../tests/unit/Base/TestGridTable.cpp
                ../../tests/unit/Base/TestHas.cpp
+               ../../tests/unit/Base/TestMemory.cpp
+               ../../tests/unit/Base/TestPerfCounter.cpp
                ../../tests/unit/Base/TestPrint.cpp
                ../../tests/unit/Base/TestProcessControl.cpp
                ../../tests/unit/Base/TestPUPUtil.cpp
                ../../tests/unit/Base/TestReader.cpp
                ../../tests/unit/Base/TestPrintUtil.cpp
+               ../../tests/unit/Base/TestStepControl.cpp
+               ../../tests/unit/Base/TestTable.cpp
+               ../../tests/unit/Base/TestTextParser.cpp
                ../../tests/unit/Base/TestTaggedTuple.cpp
                ../../tests/unit/Base/TestTaggedTuplePrint.cpp
                ../../tests/unit/Base/TestTaggedTupleDeepPrint.cpp
                ../../tests/unit/Base/TestTimer.cpp
+               ../../tests/unit/Base/TestTraceBuffer.cpp
                ../../tests/unit/Base/TestVector.cpp
                ../../tests/unit/Base/TestWriter.cpp
                ../../tests/unit/${TestMKLUniformMethod}
@@ -44,21 +55,33 @@ add_executable(${UNITTEST_EXECUTABLE}
                ../../tests/unit/Control/TestToggle.cpp
                ../../tests/unit/${TestScheme}
                ../../tests/unit/${TestError}
+               ../../tests/unit/${TestIdMap}
+               ../../tests/unit/${TestMeshAdapter}
                ../../tests/unit/IO/TestExodusIIMeshReader.cpp
                ../../tests/unit/IO/TestMesh.cpp
                ../../tests/unit/IO/TestMeshReader.cpp
+               ../../tests/unit/LoadBalance/TestGraphMap.cpp
                ../../tests/unit/LoadBalance/TestLinearMap.cpp
                ../../tests/unit/LoadBalance/TestLoadDistributor.cpp
+               ../../tests/unit/LoadBalance/TestSFCPartition.cpp
                ../../tests/unit/LoadBalance/TestUnsMeshMap.cpp
+               ../../tests/unit/Mesh/TestAgglomerate.cpp
                ../../tests/unit/Mesh/TestAround.cpp
+               ../../tests/unit/Mesh/TestBndNodeNormals.cpp
+               ../../tests/unit/Mesh/TestBVH.cpp
                ../../tests/unit/Mesh/TestDerivedData.cpp
                ../../tests/unit/Mesh/TestDerivedData_MPISingle.cpp
+               ../../tests/unit/Mesh/TestDtLevels.cpp
                ../../tests/unit/Mesh/TestGradients.cpp
+               ../../tests/unit/Mesh/TestPrimitiveTable.cpp
                ../../tests/unit/Mesh/TestReorder.cpp
+               ../../tests/unit/Mesh/TestSlice.cpp
                ../../tests/unit/${TestMKLRNG}
                ../../tests/unit/${TestRNGSSE}
                ../../tests/unit/RNG/TestRNG.cpp
-               ../../tests/unit/RNG/TestRandom123.cpp)
+               ../../tests/unit/RNG/TestRNGBlock.cpp
+               ../../tests/unit/RNG/TestRandom123.cpp
+               ../../tests/unit/RNG/TestZiggurat.cpp)
 
 target_include_directories(${UNITTEST_EXECUTABLE} PUBLIC
                            ${QUINOA_SOURCE_DIR}
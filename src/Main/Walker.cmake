@@ -22,6 +22,7 @@ target_link_libraries(${WALKER_EXECUTABLE}
                       Walker
                       Statistics
                       IO
+                      Mesh
                       WalkerControl
                       Base
                       Config
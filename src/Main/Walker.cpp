@@ -110,6 +110,21 @@ CProxy_Distributor g_DistributorProxy;
   #pragma clang diagnostic pop
 #endif
 
+//! Instantiate the random number generators selected in the input deck
+//! \return Map of the selected random number generators
+static std::map< tk::ctr::RawRNGType, tk::RNG > selectedRNGs() {
+  tk::RNGStack stack(
+    #ifdef HAS_MKL
+    g_inputdeck.get< tag::param, tag::rngmkl >(),
+    #endif
+    #ifdef HAS_RNGSSE2
+    g_inputdeck.get< tag::param, tag::rngsse >(),
+    #endif
+    g_inputdeck.get< tag::param, tag::rng123 >(),
+    g_inputdeck.nstream( CkNumPes() ) );
+  return stack.selected( g_inputdeck.get< tag::selected, tag::rng >() );
+}
+
 //! Pack/Unpack selected RNGs. This Pack/Unpack method (re-)creates the full RNG
 //! stack since it needs to (re-)bind function pointers on different processing
 //! elements. Therefore we circumvent Charm's usual pack/unpack for this type,
@@ -126,17 +141,7 @@ CProxy_Distributor g_DistributorProxy;
 inline
 void operator|( PUP::er& p, std::map< tk::ctr::RawRNGType, tk::RNG >& rng ) {
   try {
-    if (!p.isSizing()) {
-      tk::RNGStack stack(
-        #ifdef HAS_MKL
-        g_inputdeck.get< tag::param, tag::rngmkl >(),
-        #endif
-        #ifdef HAS_RNGSSE2
-        g_inputdeck.get< tag::param, tag::rngsse >(),
-        #endif
-        g_inputdeck.get< tag::param, tag::rng123 >() );
-      rng = stack.selected( g_inputdeck.get< tag::selected, tag::rng >() );
-    }
+    if (!p.isSizing()) rng = selectedRNGs();
   } catch (...) { tk::processExceptionCharm(); }
 }
 
@@ -204,7 +209,9 @@ class Main : public CBase_Main {
                           walker::g_inputdeck_defaults.get< tag::cmd, tag::io,
                             tag::nrestart >() ) ),
       m_timer(1),       // start new timer measuring the total runtime
-      m_timestamp()
+      m_timestamp(),
+      m_run( 0 ),
+      m_ensemble()
     {
       delete msg;
       g_trace = m_cmdline.get< tag::trace >();
@@ -214,6 +221,9 @@ class Main : public CBase_Main {
       // collector Charm++ chare group
       if ( m_cmdline.get< tag::chare >() || m_cmdline.get< tag::quiescence >() )
         stateProxy = tk::CProxy_ChareStateCollector::ckNew();
+      // If running an ensemble, create nodegroup replacing the global-scope
+      // data between its runs
+      if (m_driver.nrun() > 1) m_ensemble = CProxy_ensemble::ckNew();
       // Fire up an asynchronous execute object, which when created at some
       // future point in time will call back to this->execute(). This is
       // necessary so that this->execute() can access already migrated
@@ -221,6 +231,36 @@ class Main : public CBase_Main {
       CProxy_execute::ckNew();
     } catch (...) { tk::processExceptionCharm(); }
 
+    //! Migrate constructor: returning from a checkpoint
+    explicit Main( CkMigrateMessage* msg ) : CBase_Main( msg ),
+      m_signal( tk::setSignalHandlers() ),
+      m_cmdline(),
+      m_cmdParser( reinterpret_cast<CkArgMsg*>(msg)->argc,
+                   reinterpret_cast<CkArgMsg*>(msg)->argv,
+                   tk::Print(),
+                   m_cmdline ),
+      m_driver( tk::Main< walker::WalkerDriver >
+                        ( reinterpret_cast<CkArgMsg*>(msg)->argc,
+                          reinterpret_cast<CkArgMsg*>(msg)->argv,
+                          m_cmdline,
+                          tk::HeaderType::WALKER,
+                          tk::walker_executable(),
+                          walker::g_inputdeck_defaults.get< tag::cmd,
+                            tag::io, tag::screen >(),
+                          walker::g_inputdeck.get< tag::cmd,
+                            tag::io, tag::nrestart >()+1 ) ),
+      m_timer(1),
+      m_timestamp(),
+      m_run( 0 ),
+      m_ensemble()
+    {
+      // increase number of restarts (available for Distributor on PE 0)
+      ++walker::g_inputdeck.get< tag::cmd, tag::io, tag::nrestart >();
+      g_trace = m_cmdline.get< tag::trace >();
+      tk::MainCtor( mainProxy, thisProxy, m_timer, m_cmdline,
+                    CkCallback( CkIndex_Main::quiescence(), thisProxy ) );
+    }
+
     //! Execute driver created and initialized by constructor
     void execute() {
       try {
@@ -230,13 +270,33 @@ class Main : public CBase_Main {
     }
 
     //! Towards normal exit but collect chare state first (if any)
+    //! \details If running an ensemble and not all of its runs have finished,
+    //!   the input deck of the next run is parsed and distributed to all
+    //!   compute nodes instead, and the run is started by next().
     void finalize() {
+      if (m_run+1 < m_driver.nrun()) {
+        try {
+          ++m_run;
+          m_ensemble.setup( m_driver.deck( m_run ),
+                            CkCallback( CkIndex_Main::next(), thisProxy ) );
+        } catch (...) { tk::processExceptionCharm(); }
+        return;
+      }
       tk::finalize( m_cmdline, m_timer, stateProxy, m_timestamp,
         walker::g_inputdeck_defaults.get< tag::cmd, tag::io, tag::screen >(),
         walker::g_inputdeck.get< tag::cmd, tag::io, tag::nrestart >(),
         CkCallback( CkIndex_Main::dumpstate(nullptr), thisProxy ) );
     }
 
+    //! Start next run of the ensemble once its input deck has been distributed
+    void next() {
+      try {
+        m_timestamp.emplace_back( "Ensemble run " + std::to_string(m_run-1),
+                                  m_timer[1].hms() );
+        walker::WalkerDriver::run();
+      } catch (...) { tk::processExceptionCharm(); }
+    }
+
     //! Entry method triggered when quiescence is detected
     void quiescence() {
       try {
@@ -260,6 +320,23 @@ class Main : public CBase_Main {
       } catch (...) { tk::processExceptionCharm(); }
     }
 
+    /** @name Charm++ pack/unpack serializer member functions */
+    ///@{
+    //! \brief Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \note This is a Charm++ mainchare, pup() is thus only for
+    //!    checkpoint/restart.
+    void pup( PUP::er &p ) override {
+      p | m_timer;
+      p | m_run;
+      p | m_ensemble;
+    }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] m Mainchare object reference
+    friend void operator|( PUP::er& p, Main& m ) { m.pup(p); }
+    //@}
+
   private:
     int m_signal;                               //!< Used to set signal handlers
     walker::ctr::CmdLine m_cmdline;             //!< Command line
@@ -269,6 +346,10 @@ class Main : public CBase_Main {
 
     //! Time stamps in h:m:s with labels
     std::vector< std::pair< std::string, tk::Timer::Watch > > m_timestamp;
+    //! Index of the run of the ensemble being integrated
+    std::size_t m_run;
+    //! Charm++ nodegroup proxy replacing global-scope data between runs
+    CProxy_ensemble m_ensemble;
 };
 
 //! \brief Charm++ chare execute
@@ -276,7 +357,36 @@ class Main : public CBase_Main {
 //!    has finished migrating all global-scoped read-only objects which happens
 //!    after the main chare constructor has finished.
 class execute : public CBase_execute {
- public: execute() { mainProxy.execute(); }
+  public:
+    //! Constructor
+    execute() { mainProxy.execute(); }
+    //! Migrate constructor
+    explicit execute( CkMigrateMessage* m ) : CBase_execute( m ) {}
+};
+
+//! \brief Charm++ nodegroup ensemble
+//! \details Between the runs of an ensemble this object replaces the
+//!   global-scope data, initialized by the runtime system only once at
+//!   startup, with that of the next run. It is a nodegroup, as global-scope
+//!   data is shared by the PEs of a compute node in SMP mode.
+class ensemble : public CBase_ensemble {
+  public:
+    //! Constructor
+    ensemble() = default;
+    //! Migrate constructor
+    explicit ensemble( CkMigrateMessage* m ) : CBase_ensemble( m ) {}
+
+    //! Replace global-scope data with that of the next run
+    //! \param[in] deck Input deck of the next run
+    //! \param[in] cb Callback to signal when all compute nodes are done
+    void setup( walker::ctr::InputDeck deck, CkCallback cb ) {
+      try {
+        walker::g_inputdeck = std::move( deck );
+        walker::g_rng = walker::selectedRNGs();
+        walker::g_diffeqs = walker::DiffEqStack().selected();
+        contribute( cb );
+      } catch (...) { tk::processExceptionCharm(); }
+    }
 };
 
 #include "NoWarning/walker.def.h"
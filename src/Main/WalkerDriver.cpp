@@ -10,13 +10,17 @@
 */
 // *****************************************************************************
 
+#include <sstream>
+
 #include "Tags.hpp"
+#include "Exception.hpp"
 #include "WalkerPrint.hpp"
 #include "WalkerDriver.hpp"
 #include "Walker/InputDeck/Parser.hpp"
 #include "Walker/CmdLine/CmdLine.hpp"
 #include "Walker/InputDeck/InputDeck.hpp"
 #include "TaggedTupleDeepPrint.hpp"
+#include "Reader.hpp"
 #include "Writer.hpp"
 
 #include "NoWarning/distributor.decl.h"
@@ -30,12 +34,41 @@ extern CProxy_Distributor g_DistributorProxy;
 
 using walker::WalkerDriver;
 
-WalkerDriver::WalkerDriver( const ctr::CmdLine& cmdline, int nrestart )
+namespace {
+
+std::string
+runname( const std::string& filename, std::size_t r )
+// *****************************************************************************
+//  Construct the name of an output file of a run of an ensemble
+//! \param[in] filename Output file name
+//! \param[in] r Index of the run
+//! \return File name appended by '_' and the index of the run in front of its
+//!   extension, if any
+// *****************************************************************************
+{
+  auto s = filename.find_last_of( '/' );
+  auto e = filename.find_last_of( '.' );
+  if (e == std::string::npos || (s != std::string::npos && e < s) || e == 0)
+    e = filename.size();
+  return filename.substr( 0, e ) + '_' + std::to_string( r ) +
+         filename.substr( e );
+}
+
+} // ::
+
+WalkerDriver::WalkerDriver( const ctr::CmdLine& cmdline, int nrestart ) :
+  m_cmdline( cmdline ),
+  m_nrestart( nrestart ),
+  m_param(),
+  m_value()
 // *****************************************************************************
 //  Constructor
 //! \param[in] cmdline Command line object storing data parsed from the command
 //!   line arguments
 //! \param[in] nrestart Number of times restarted
+//! \details If an ensemble is requested on the command line, its parameter
+//!   table is read here and the input deck of its first run is parsed, the
+//!   rest of the runs are parsed by deck() once the previous run has finished.
 // *****************************************************************************
 {
   // All global-scope data to be migrated to all PEs initialized here (if any)
@@ -47,24 +80,128 @@ WalkerDriver::WalkerDriver( const ctr::CmdLine& cmdline, int nrestart )
                      cmdline.get< tag::verbose >() ? std::cout : std::clog,
                      std::ios_base::app );
 
+  #if !defined(CMK_MEM_CHECKPOINT) || !CMK_MEM_CHECKPOINT
+  ErrChk( cmdline.get< tag::memfreq >() == 0, "In-memory checkpoints require "
+          "Charm++ built with the syncft option" );
+  #endif
+
+  // Read parameter table of ensemble: names in first line, values of a run
+  // in each further non-empty line
+  const auto& table = cmdline.get< tag::io, tag::ensemble >();
+  if (!table.empty()) {
+    print.item( "Ensemble parameter table", table );
+    auto lines = tk::Reader( table ).lines();
+    std::size_t l = 0;
+    for (const auto& line : lines) {
+      ++l;
+      std::istringstream ss( line );
+      std::vector< std::string > v;
+      std::string w;
+      while (ss >> w) v.push_back( std::move(w) );
+      if (v.empty()) continue;
+      if (m_param.empty()) { m_param = std::move(v); continue; }
+      ErrChk( v.size() == m_param.size(), "Number of values in line " +
+              std::to_string(l) + " of ensemble parameter table '" + table +
+              "' differs from the number of parameters" );
+      m_value.push_back( std::move(v) );
+    }
+    ErrChk( !m_value.empty(),
+            "Ensemble parameter table '" + table + "' contains no runs" );
+    print.item( "Number of runs in ensemble", m_value.size() );
+  }
+
   // Parse input deck into g_inputdeck
-  print.item( "Control file", cmdline.get< tag::io, tag::control >() );
-  InputDeckParser inputdeckParser( print, cmdline, g_inputdeck );
+  if (nrun()) {
+    g_inputdeck = deck( 0 );
+  } else {
+    print.item( "Control file", cmdline.get< tag::io, tag::control >() );
+    InputDeckParser inputdeckParser( print, cmdline, g_inputdeck );
+    print.item( "Parsed control file", "success" );
+    print.endpart();
+
+    // Output command line object to file
+    auto logfilename = tk::walker_executable() + "_input.log";
+    tk::Writer log( logfilename );
+    tk::print( log.stream(), "inputdeck", g_inputdeck );
+  }
+
+  // Instantiate Distributor chare on PE 0 which drives the time-integration of
+  // differential equations via several integrator chares. Since this is called
+  // inside the main chare constructor, the Charm++ runtime system distributes
+  // its proxy along with all other global-scope data.
+  run();
+}
+
+walker::ctr::InputDeck
+WalkerDriver::deck( std::size_t r ) const
+// *****************************************************************************
+//  Parse the input deck of a run of the ensemble
+//! \param[in] r Index of the run
+//! \return Input deck parsed from the control file instantiated for run r
+//! \details The control file given on the command line is a template: it is
+//!   copied to a file whose name is appended by '.' and r, replacing each
+//!   '${name}' with the value of parameter 'name' of run r, which is then
+//!   parsed. The names of the output files of the run are appended by r, so
+//!   that the runs do not overwrite each other's statistics.
+// *****************************************************************************
+{
+  Assert( r < nrun(), "Ensemble run index out of bounds" );
+
+  const auto& def =
+    g_inputdeck_defaults.get< tag::cmd, tag::io, tag::screen >();
+  WalkerPrint print( m_cmdline.logname( def, m_nrestart ),
+                     m_cmdline.get< tag::verbose >() ? std::cout : std::clog,
+                     std::ios_base::app );
+
+  // Instantiate control file template with the parameters of run r
+  const auto& control = m_cmdline.get< tag::io, tag::control >();
+  std::string text;
+  for (const auto& line : tk::Reader( control ).lines()) text += line + '\n';
+  for (std::size_t i=0; i<m_param.size(); ++i) {
+    const auto key = "${" + m_param[i] + '}';
+    for (auto p = text.find( key ); p != std::string::npos;
+         p = text.find( key, p + m_value[r][i].size() ))
+      text.replace( p, key.size(), m_value[r][i] );
+  }
+  const auto u = text.find( "${" );
+  ErrChk( u == std::string::npos, "Control file '" + control +
+          "' refers to a parameter not in the ensemble parameter table: " +
+          text.substr( u, text.find( '}', u ) - u + 1 ) );
+  auto cmd = m_cmdline;
+  auto& io = cmd.get< tag::io >();
+  io.get< tag::control >() = control + '.' + std::to_string( r );
+  tk::Writer( io.get< tag::control >() ).stream() << text;
+
+  // Separate output files of the runs
+  io.get< tag::stat >() = runname( io.get< tag::stat >(), r );
+  io.get< tag::pdf >() = runname( io.get< tag::pdf >(), r );
+  io.get< tag::particles >() = runname( io.get< tag::particles >(), r );
+
+  // Parse input deck of run r
+  print.section( "Ensemble run " + std::to_string( r ) );
+  print.item( "Control file", io.get< tag::control >() );
+  ctr::InputDeck d;
+  InputDeckParser inputdeckParser( print, cmd, d );
   print.item( "Parsed control file", "success" );
   print.endpart();
 
-  // Output command line object to file
-  auto logfilename = tk::walker_executable() + "_input.log";
-  tk::Writer log( logfilename );
-  tk::print( log.stream(), "inputdeck", g_inputdeck );
+  // Output input deck of run r to file
+  tk::Writer log( runname( tk::walker_executable() + "_input.log", r ) );
+  tk::print( log.stream(), "inputdeck", d );
 
-  // Instantiate Distributor chare on PE 0 which drives the time-integration of
-  // differential equations via several integrator chares. We only support a
-  // single type of Distributor class at this point, so no factory
-  // instantiation, simply fire up a Charm++ chare Distributor, which fires up
-  // integrators. Store proxy handle in global-scope to make it available to
-  // individual integrators so they can call back to Distributor. Since this
-  // is called inside the main chare constructor, the Charm++ runtime system
-  // distributes the handle along with all other global-scope data.
+  return d;
+}
+
+void
+WalkerDriver::run()
+// *****************************************************************************
+//  Start integrating the differential equations of the input deck
+//! \details We only support a single type of Distributor class at this point,
+//!   so no factory instantiation, simply fire up a Charm++ chare Distributor,
+//!   which fires up integrators. The proxy handle is stored in global-scope to
+//!   make it available to individual integrators so they can call back to
+//!   Distributor.
+// *****************************************************************************
+{
   g_DistributorProxy = CProxy_Distributor::ckNew( 0 );
 }
@@ -12,7 +12,11 @@
 #ifndef WalkerDriver_h
 #define WalkerDriver_h
 
+#include <string>
+#include <vector>
+
 #include "Walker/CmdLine/CmdLine.hpp"
+#include "Walker/InputDeck/InputDeck.hpp"
 
 //! Everything that contributes to the walker executable
 namespace walker {
@@ -26,6 +30,26 @@ class WalkerDriver {
 
     //! Execute driver
     void execute() const {}
+
+    //! Number of runs of the ensemble, zero if not running an ensemble
+    //! \return Number of runs in the parameter table
+    std::size_t nrun() const { return m_value.size(); }
+
+    //! Parse the input deck of a run of the ensemble
+    ctr::InputDeck deck( std::size_t r ) const;
+
+    //! Start integrating the differential equations of the input deck
+    static void run();
+
+  private:
+    //! Command line
+    ctr::CmdLine m_cmdline;
+    //! Number of times restarted
+    int m_nrestart;
+    //! Names of the parameters of the ensemble
+    std::vector< std::string > m_param;
+    //! Values of the parameters for each run of the ensemble
+    std::vector< std::vector< std::string > > m_value;
 };
 
 } // walker::
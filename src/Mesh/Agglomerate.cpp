@@ -0,0 +1,182 @@
+// *****************************************************************************
+/*!
+  \file      src/Mesh/Agglomerate.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Agglomeration of edge-based median-dual meshes into coarse levels
+  \details   Agglomeration of edge-based median-dual meshes into coarse levels,
+    used by agglomeration multigrid.
+*/
+// *****************************************************************************
+
+#include <algorithm>
+#include <limits>
+
+#include "Agglomerate.hpp"
+#include "Exception.hpp"
+
+namespace tk {
+
+std::vector< std::size_t >
+agglomerate( std::size_t npoin,
+             const std::vector< tk::lid_t >& edgenode,
+             const std::vector< char >& frozen,
+             std::size_t& ncoarse )
+// *****************************************************************************
+//  Group nodes of a mesh into agglomerates of neighboring nodes
+//! \param[in] npoin Number of nodes
+//! \param[in] edgenode Node ids of edges, two per edge
+//! \param[in] frozen Flags, one per node, 1 at nodes not to be agglomerated
+//! \param[out] ncoarse Number of agglomerates
+//! \return Agglomerate id of each node, in [0,ncoarse)
+//! \details Agglomerates are formed greedily: an unassigned node together with
+//!   its unassigned neighbors becomes a new agglomerate. A node left alone
+//!   this way is attached to the smallest neighboring agglomerate. Frozen nodes
+//!   are neither attached to others nor do they attract others: each one is a
+//!   (singleton) agglomerate on its own. Agglomerate ids are assigned in the
+//!   order of the smallest node id they contain, so the result only depends
+//!   on the node and edge numbering.
+// *****************************************************************************
+{
+  Assert( frozen.size() == npoin, "Size mismatch" );
+
+  const auto npos = std::numeric_limits< std::size_t >::max();
+
+  // generate points surrounding points from the edges
+  std::vector< std::size_t > psup2( npoin+1, 0 );
+  for (auto p : edgenode) {
+    Assert( p < npoin, "Indexing out of bounds" );
+    ++psup2[p+1];
+  }
+  for (std::size_t p=0; p<npoin; ++p) psup2[p+1] += psup2[p];
+  std::vector< std::size_t > psup1( psup2.back() );
+  auto pos = psup2;
+  for (std::size_t e=0; e<edgenode.size()/2; ++e) {
+    auto p = edgenode[e*2+0];
+    auto q = edgenode[e*2+1];
+    psup1[ pos[p]++ ] = q;
+    psup1[ pos[q]++ ] = p;
+  }
+
+  // greedily group free nodes with their free unassigned neighbors
+  std::vector< std::size_t > agg( npoin, npos ), size;
+  for (std::size_t p=0; p<npoin; ++p) {
+    if (frozen[p] || agg[p] != npos) continue;
+    agg[p] = size.size();
+    size.push_back( 1 );
+    for (auto i=psup2[p]; i<psup2[p+1]; ++i) {
+      auto q = psup1[i];
+      if (!frozen[q] && agg[q] == npos) {
+        agg[q] = agg[p];
+        ++size.back();
+      }
+    }
+  }
+
+  // attach free nodes left alone to their smallest free neighbor agglomerate
+  for (std::size_t p=0; p<npoin; ++p) {
+    if (frozen[p] || size[agg[p]] != 1) continue;
+    auto a = npos;
+    for (auto i=psup2[p]; i<psup2[p+1]; ++i) {
+      auto q = psup1[i];
+      if (!frozen[q] && agg[q] != agg[p] &&
+          (a == npos || size[agg[q]] < size[a]))
+        a = agg[q];
+    }
+    if (a != npos) {
+      --size[agg[p]];
+      agg[p] = a;
+      ++size[a];
+    }
+  }
+
+  // renumber agglomerates in the order of their smallest node id, frozen
+  // nodes become singletons
+  std::vector< std::size_t > id( size.size(), npos );
+  ncoarse = 0;
+  for (std::size_t p=0; p<npoin; ++p)
+    if (frozen[p])
+      agg[p] = ncoarse++;
+    else {
+      auto& i = id[ agg[p] ];
+      if (i == npos) i = ncoarse++;
+      agg[p] = i;
+    }
+
+  return agg;
+}
+
+AggLevel
+coarsen( const std::array< std::vector< real >, 3 >& coord,
+         const std::vector< real >& vol,
+         const std::vector< tk::lid_t >& edgenode,
+         const std::vector< real >& dfn,
+         const std::vector< char >& frozen )
+// *****************************************************************************
+//  Generate the next coarse level of an edge-based median-dual mesh
+//! \param[in] coord Node coordinates
+//! \param[in] vol Dual-cell volumes of nodes
+//! \param[in] edgenode Node ids of edges, two per edge
+//! \param[in] dfn Dual-face normals of edges, oriented from the first to the
+//!   second node of the edge, two normals (6 reals) per edge
+//! \param[in] frozen Flags, one per node, 1 at nodes not to be agglomerated
+//! \return Coarse level, see AggLevel
+//! \details Nodes are agglomerated by agglomerate(). Fine edges whose both
+//!   end-points are in the same agglomerate are interior to a coarse dual cell
+//!   and are dropped. The rest contribute their normals, flipped as needed to
+//!   point from the lower to the higher coarse node id, to the coarse edge.
+//!   Coarse volumes are sums and coarse coordinates are volume-weighted
+//!   centroids of the fine ones.
+// *****************************************************************************
+{
+  const auto npoin = vol.size();
+  Assert( coord[0].size() == npoin, "Size mismatch" );
+  Assert( dfn.size() == edgenode.size()*3, "Size mismatch" );
+
+  AggLevel c;
+  std::size_t ncoarse = 0;
+  c.map = agglomerate( npoin, edgenode, frozen, ncoarse );
+
+  // coarse frozen flags, volumes, and centroids
+  c.frozen.resize( ncoarse, 0 );
+  c.vol.resize( ncoarse, 0.0 );
+  for (auto& x : c.coord) x.resize( ncoarse, 0.0 );
+  for (std::size_t p=0; p<npoin; ++p) {
+    auto i = c.map[p];
+    if (frozen[p]) c.frozen[i] = 1;
+    c.vol[i] += vol[p];
+    for (std::size_t j=0; j<3; ++j) c.coord[j][i] += vol[p] * coord[j][p];
+  }
+  for (std::size_t i=0; i<ncoarse; ++i)
+    for (std::size_t j=0; j<3; ++j) c.coord[j][i] /= c.vol[i];
+
+  // collect fine edges connecting different agglomerates: coarse end-points
+  // (lower first) and fine edge id
+  std::vector< std::array< std::size_t, 3 > > edges;
+  edges.reserve( edgenode.size()/2 );
+  for (std::size_t e=0; e<edgenode.size()/2; ++e) {
+    auto I = c.map[ edgenode[e*2+0] ];
+    auto J = c.map[ edgenode[e*2+1] ];
+    if (I != J) edges.push_back( {{ std::min(I,J), std::max(I,J), e }} );
+  }
+  std::sort( begin(edges), end(edges) );
+
+  // sum oriented normals of fine edges into coarse edges
+  for (std::size_t k=0; k<edges.size(); ++k) {
+    const auto& [I,J,e] = edges[k];
+    if (k == 0 || edges[k-1][0] != I || edges[k-1][1] != J) {
+      c.edgenode.push_back( static_cast< lid_t >( I ) );
+      c.edgenode.push_back( static_cast< lid_t >( J ) );
+      c.dfn.resize( c.dfn.size()+6, 0.0 );
+    }
+    auto s = c.map[ edgenode[e*2+0] ] == I ? 1.0 : -1.0;
+    auto n = c.dfn.data() + c.dfn.size() - 6;
+    for (std::size_t j=0; j<6; ++j) n[j] += s * dfn[e*6+j];
+  }
+
+  return c;
+}
+
+} // tk::
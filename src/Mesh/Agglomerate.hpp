@@ -0,0 +1,59 @@
+// *****************************************************************************
+/*!
+  \file      src/Mesh/Agglomerate.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Agglomeration of edge-based median-dual meshes into coarse levels
+  \details   Agglomeration of edge-based median-dual meshes into coarse levels,
+    used by agglomeration multigrid.
+*/
+// *****************************************************************************
+#ifndef Agglomerate_h
+#define Agglomerate_h
+
+#include <array>
+#include <vector>
+#include <cstddef>
+
+#include "Types.hpp"
+
+namespace tk {
+
+//! \brief Coarse level of an agglomerated edge-based median-dual mesh
+//! \details A coarse node (control volume) is the union of the dual cells of
+//!   a group of neighboring fine nodes. Coarse edges connect coarse nodes that
+//!   contain the end-points of at least one fine edge and their dual-face
+//!   normals are the sums of the (consistently oriented) normals of those fine
+//!   edges, so that the coarse dual cells stay closed. Coarse edge data is
+//!   laid out the same way as that of the fine mesh: the coarse (local) node
+//!   ids of edge e are edgenode[e*2+0] < edgenode[e*2+1], and its normals,
+//!   oriented from the first to the second node, are dfn[e*6+0..5].
+struct AggLevel {
+  std::vector< std::size_t > map;       //!< Fine -> coarse node ids
+  std::vector< char > frozen;           //!< 1 at frozen (singleton) nodes
+  std::array< std::vector< real >, 3 > coord;  //!< Coarse node centroids
+  std::vector< real > vol;              //!< Coarse dual-cell volumes
+  std::vector< lid_t > edgenode;        //!< Coarse node ids of edges
+  std::vector< real > dfn;              //!< Coarse dual-face normals
+};
+
+//! Group nodes of a mesh into agglomerates of neighboring nodes
+std::vector< std::size_t >
+agglomerate( std::size_t npoin,
+             const std::vector< tk::lid_t >& edgenode,
+             const std::vector< char >& frozen,
+             std::size_t& ncoarse );
+
+//! Generate the next coarse level of an edge-based median-dual mesh
+AggLevel
+coarsen( const std::array< std::vector< real >, 3 >& coord,
+         const std::vector< real >& vol,
+         const std::vector< tk::lid_t >& edgenode,
+         const std::vector< real >& dfn,
+         const std::vector< char >& frozen );
+
+} // tk::
+
+#endif // Agglomerate_h
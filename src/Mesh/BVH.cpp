@@ -0,0 +1,127 @@
+// *****************************************************************************
+/*!
+  \file      src/Mesh/BVH.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Bounding volume hierarchy of tetrahedra
+  \details   Bounding volume hierarchy of tetrahedra.
+*/
+// *****************************************************************************
+
+#include <limits>
+#include <numeric>
+#include <algorithm>
+
+#include "BVH.hpp"
+#include "Exception.hpp"
+
+using tk::BVH;
+
+BVH::BVH( const std::array< std::vector< tk::real >, 3 >& coord,
+          const std::vector< std::size_t >& inpoel )
+// *****************************************************************************
+//  Constructor: build hierarchy of tetrahedra
+//! \param[in] coord Mesh node coordinates
+//! \param[in] inpoel Mesh element connectivity
+//! \details The elements are split recursively at the median of their
+//!   centroids along the longest extent of the centroids, until at most
+//!   s_leafsize elements remain in a node, yielding a balanced tree.
+//! \note It is okay to call this function with an empty connectivity; it will
+//!    simply yield an empty hierarchy.
+// *****************************************************************************
+{
+  Assert( inpoel.size() % 4 == 0, "Size of inpoel must be divisible by 4" );
+
+  const auto& x = coord[0];
+  const auto& y = coord[1];
+  const auto& z = coord[2];
+
+  const auto nelem = inpoel.size()/4;
+  if (nelem == 0) return;
+
+  // compute element bounding boxes and centroids
+  std::vector< Box > elbox( nelem );
+  std::vector< std::array< tk::real, 3 > > centroid( nelem );
+  for (std::size_t e=0; e<nelem; ++e) {
+    auto& b = elbox[e];
+    b = {{ x[inpoel[e*4]], y[inpoel[e*4]], z[inpoel[e*4]],
+           x[inpoel[e*4]], y[inpoel[e*4]], z[inpoel[e*4]] }};
+    for (std::size_t a=1; a<4; ++a) {
+      const auto p = inpoel[e*4+a];
+      b[0] = std::min( b[0], x[p] );  b[3] = std::max( b[3], x[p] );
+      b[1] = std::min( b[1], y[p] );  b[4] = std::max( b[4], y[p] );
+      b[2] = std::min( b[2], z[p] );  b[5] = std::max( b[5], z[p] );
+    }
+    for (std::size_t j=0; j<3; ++j) centroid[e][j] = (b[j] + b[j+3]) / 2.0;
+  }
+
+  m_elem.resize( nelem );
+  std::iota( begin(m_elem), end(m_elem), 0 );
+  m_node.reserve( 2*nelem );
+  m_node.push_back( Node() );
+  build( 0, 0, nelem, centroid, elbox );
+
+  // store element boxes in leaf order for contiguous access on query
+  m_box.resize( nelem );
+  for (std::size_t i=0; i<nelem; ++i) m_box[i] = elbox[ m_elem[i] ];
+}
+
+void
+BVH::build( std::size_t node,
+            std::size_t begin,
+            std::size_t end,
+            const std::vector< std::array< tk::real, 3 > >& centroid,
+            const std::vector< Box >& elbox )
+// *****************************************************************************
+//  Build subtree of elements in leaf order range
+//! \param[in] node Node of tree to build subtree at
+//! \param[in] begin Index of first element of node in leaf order
+//! \param[in] end Index of one past the last element of node in leaf order
+//! \param[in] centroid Element centroids
+//! \param[in] elbox Element bounding boxes
+// *****************************************************************************
+{
+  constexpr auto big = std::numeric_limits< tk::real >::max();
+
+  // bounding box of elements and extents of their centroids
+  Box b{{ big, big, big, -big, -big, -big }};
+  Box c = b;
+  for (std::size_t i=begin; i<end; ++i) {
+    const auto e = m_elem[i];
+    for (std::size_t j=0; j<3; ++j) {
+      b[j] = std::min( b[j], elbox[e][j] );
+      b[j+3] = std::max( b[j+3], elbox[e][j+3] );
+      c[j] = std::min( c[j], centroid[e][j] );
+      c[j+3] = std::max( c[j+3], centroid[e][j] );
+    }
+  }
+  m_node[node].box = b;
+
+  if (end - begin <= s_leafsize) {
+    m_node[node].first = begin;
+    m_node[node].count = end - begin;
+    return;
+  }
+
+  // split at median of centroids along their longest extent
+  std::size_t axis = 0;
+  for (std::size_t j=1; j<3; ++j)
+    if (c[j+3] - c[j] > c[axis+3] - c[axis]) axis = j;
+  const auto mid = begin + (end - begin)/2;
+  std::nth_element( m_elem.begin() + static_cast< std::ptrdiff_t >( begin ),
+                    m_elem.begin() + static_cast< std::ptrdiff_t >( mid ),
+                    m_elem.begin() + static_cast< std::ptrdiff_t >( end ),
+                    [&]( std::size_t p, std::size_t q ){
+                      return centroid[p][axis] < centroid[q][axis]; } );
+
+  // children are stored next to each other
+  const auto left = m_node.size();
+  m_node[node].first = left;
+  m_node[node].count = 0;
+  m_node.push_back( Node() );
+  m_node.push_back( Node() );
+  build( left, begin, mid, centroid, elbox );
+  build( left+1, mid, end, centroid, elbox );
+}
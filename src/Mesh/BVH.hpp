@@ -0,0 +1,115 @@
+// *****************************************************************************
+/*!
+  \file      src/Mesh/BVH.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Bounding volume hierarchy of tetrahedra
+  \details   Bounding volume hierarchy of tetrahedra. The hierarchy is a binary
+    tree of axis-aligned bounding boxes, whose leaves hold a few tetrahedra,
+    and in which the box of a node bounds the boxes of its children. Finding
+    the tetrahedra whose bounding boxes contain a point then takes a number of
+    box tests logarithmic in the number of tetrahedra, instead of testing all
+    tetrahedra, e.g., when searching for the element that contains a particle.
+*/
+// *****************************************************************************
+#ifndef BVH_h
+#define BVH_h
+
+#include <array>
+#include <vector>
+#include <cstddef>
+
+#include "Types.hpp"
+
+namespace tk {
+
+//! Bounding volume hierarchy of tetrahedra
+class BVH {
+
+  public:
+    //! Axis-aligned bounding box: xmin, ymin, zmin, xmax, ymax, zmax
+    using Box = std::array< tk::real, 6 >;
+
+    //! Default constructor: empty hierarchy
+    explicit BVH() = default;
+
+    //! Constructor: build hierarchy of tetrahedra
+    explicit BVH( const std::array< std::vector< tk::real >, 3 >& coord,
+                  const std::vector< std::size_t >& inpoel );
+
+    //! Query if hierarchy is empty
+    //! \return True if the hierarchy holds no elements
+    bool empty() const { return m_node.empty(); }
+
+    //! Bounding box of all tetrahedra
+    //! \return Bounding box of all tetrahedra
+    const Box& box() const { return m_node.front().box; }
+
+    //! Query if a box contains a point
+    //! \param[in] b Box
+    //! \param[in] x X coordinate of point
+    //! \param[in] y Y coordinate of point
+    //! \param[in] z Z coordinate of point
+    //! \return True if the point is in the box (including its boundary)
+    static bool contains( const Box& b, tk::real x, tk::real y, tk::real z ) {
+      return b[0] <= x && x <= b[3] &&
+             b[1] <= y && y <= b[4] &&
+             b[2] <= z && z <= b[5];
+    }
+
+    //! Visit tetrahedra whose bounding boxes contain a point
+    //! \param[in] x X coordinate of point
+    //! \param[in] y Y coordinate of point
+    //! \param[in] z Z coordinate of point
+    //! \param[in] f Function called as f(e) for element ids e whose bounding
+    //!   boxes contain the point, returning true to stop the search
+    //! \return True if f returned true for one of the elements visited
+    template< class F >
+    bool find( tk::real x, tk::real y, tk::real z, F&& f ) const {
+      if (m_node.empty()) return false;
+      // depth of tree is bounded by the median splits
+      std::array< std::size_t, 64 > stack;
+      std::size_t top = 0;
+      stack[ top++ ] = 0;
+      while (top) {
+        const auto& n = m_node[ stack[--top] ];
+        if (!contains( n.box, x, y, z )) continue;
+        if (n.count) {
+          for (std::size_t i=n.first; i<n.first+n.count; ++i)
+            if (contains( m_box[i], x, y, z ) && f( m_elem[i] )) return true;
+        } else {
+          stack[ top++ ] = n.first;
+          stack[ top++ ] = n.first + 1;
+        }
+      }
+      return false;
+    }
+
+  private:
+    //! Node of the tree
+    struct Node {
+      Box box;              //!< Box bounding all elements below node
+      std::size_t first;    //!< Leaf: first element, internal: first child
+      std::size_t count;    //!< Leaf: number of elements, internal: zero
+    };
+
+    //! Maximum number of elements in a leaf
+    static const std::size_t s_leafsize = 4;
+
+    std::vector< Node > m_node;            //!< Nodes of tree, root first
+    std::vector< std::size_t > m_elem;     //!< Element ids in leaf order
+    std::vector< Box > m_box;              //!< Element boxes in leaf order
+
+    //! Build subtree of elements in leaf order range
+    void build( std::size_t node,
+                std::size_t begin,
+                std::size_t end,
+                const std::vector< std::array< tk::real, 3 > >& centroid,
+                const std::vector< Box >& elbox );
+};
+
+} // tk::
+
+#endif // BVH_h
@@ -0,0 +1,154 @@
+// *****************************************************************************
+/*!
+  \file      src/Mesh/BndNodeNormals.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Flat arrays of boundary nodes and their normals per side set
+  \details   Flat arrays of boundary nodes and their normals per side set,
+    used to apply boundary conditions that depend on the boundary normal,
+    e.g., symmetry or farfield, without hash map lookups.
+*/
+// *****************************************************************************
+#ifndef BndNodeNormals_h
+#define BndNodeNormals_h
+
+#include <array>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <unordered_set>
+#include <unordered_map>
+
+#include "Types.hpp"
+#include "Exception.hpp"
+#include "PUPUtil.hpp"
+
+namespace tk {
+
+//! \brief Boundary nodes and their unit normals of the side sets at which a
+//!   type of boundary condition is set, as flat arrays
+//! \details The nodes are grouped by side set, in increasing order of side set
+//!   ids, and in increasing order of local node ids within a side set. Side
+//!   set k owns the entries [range(k).first, range(k).second) of node(),
+//!   nx(), ny(), and nz(), so applying a BC on a side set is a loop over
+//!   contiguous arrays, with the normals stored as a structure of arrays.
+class BndNodeNormals {
+
+  public:
+    //! \brief Boundary point normals as computed by cg::bnorm(), but with
+    //!   local node ids
+    //! \details Key: local node id, value: unit normal and inverse distance
+    //!   square between face centroids and points, outer key: side set id
+    using Normals = std::unordered_map< int,
+      std::unordered_map< std::size_t, std::array< real, 4 > > >;
+
+    //! Empty constructor: no boundary nodes
+    explicit BndNodeNormals() = default;
+
+    //! \brief Constructor: flatten boundary point normals at a set of nodes
+    //! \param[in] bnorm Boundary point normals with local node ids
+    //! \param[in] nodes Unique set of local node ids at which the BC is set.
+    //!   Nodes of bnorm not in this set are left out.
+    explicit BndNodeNormals( const Normals& bnorm,
+                             const std::unordered_set< std::size_t >& nodes )
+    {
+      for (const auto& [s,norms] : bnorm) m_side.push_back( s );
+      std::sort( begin(m_side), end(m_side) );
+      m_start.reserve( m_side.size() + 1 );
+      std::vector< std::size_t > n;
+      for (auto s : m_side) {
+        const auto& norms = bnorm.at( s );
+        n.clear();
+        for (const auto& [p,v] : norms)
+          if (nodes.find(p) != end(nodes)) n.push_back( p );
+        std::sort( begin(n), end(n) );
+        for (auto p : n) {
+          const auto& v = norms.at( p );
+          m_node.push_back( p );
+          m_nx.push_back( v[0] );
+          m_ny.push_back( v[1] );
+          m_nz.push_back( v[2] );
+        }
+        m_start.push_back( m_node.size() );
+      }
+    }
+
+    //! Number of side sets
+    //! \return Number of side sets
+    std::size_t nside() const { return m_side.size(); }
+
+    //! Find the index of a side set
+    //! \param[in] s Side set id
+    //! \return Index of side set s, nside() if there are no nodes of s
+    std::size_t find( int s ) const {
+      auto i = std::lower_bound( begin(m_side), end(m_side), s );
+      return i != end(m_side) && *i == s ?
+        static_cast< std::size_t >( i - begin(m_side) ) : m_side.size();
+    }
+
+    //! Range of entries of a side set
+    //! \param[in] k Side set index, k < nside()
+    //! \return Index of the first and one past the last entry of side set k
+    std::pair< std::size_t, std::size_t > range( std::size_t k ) const {
+      Assert( k < m_side.size(), "Side set index out of bounds" );
+      return { m_start[k], m_start[k+1] };
+    }
+
+    //! Total number of entries, i.e., boundary nodes of all side sets
+    //! \return Number of entries
+    std::size_t size() const { return m_node.size(); }
+
+    /** @name Accessors to the entries of all side sets */
+    ///@{
+    const std::vector< std::size_t >& node() const { return m_node; }
+    const std::vector< real >& nx() const { return m_nx; }
+    const std::vector< real >& ny() const { return m_ny; }
+    const std::vector< real >& nz() const { return m_nz; }
+    ///@}
+
+    //! Number of bytes occupied, see tk::bytes()
+    //! \return Number of bytes occupied, including heap storage
+    std::size_t bytes() const {
+      return sizeof(*this) + m_side.capacity()*sizeof(int) +
+        (m_start.capacity() + m_node.capacity())*sizeof(std::size_t) +
+        (m_nx.capacity() + m_ny.capacity() + m_nz.capacity())*sizeof(real);
+    }
+
+    /** @name Charm++ pack/unpack serializer member functions */
+    ///@{
+    //! \brief Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    void pup( PUP::er &p ) {
+      p | m_side;
+      p | m_start;
+      p | m_node;
+      p | m_nx;
+      p | m_ny;
+      p | m_nz;
+    }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] b BndNodeNormals object reference
+    friend void operator|( PUP::er& p, BndNodeNormals& b ) { b.pup(p); }
+    //@}
+
+  private:
+    //! Side set ids in increasing order
+    std::vector< int > m_side;
+    //! Index of the first entry of each side set, and the total at the end
+    std::vector< std::size_t > m_start = { 0 };
+    //! Local node ids
+    std::vector< std::size_t > m_node;
+    //! Unit normal x components
+    std::vector< real > m_nx;
+    //! Unit normal y components
+    std::vector< real > m_ny;
+    //! Unit normal z components
+    std::vector< real > m_nz;
+};
+
+} // tk::
+
+#endif // BndNodeNormals_h
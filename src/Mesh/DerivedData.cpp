@@ -19,6 +19,7 @@
 #include <type_traits>
 #include <cstddef>
 #include <array>
+#include <limits>
 #include <unordered_set>
 #include <unordered_map>
 #include <iostream>
@@ -202,36 +203,186 @@ genPsup( const std::vector< std::size_t >& inpoel,
 
   auto& esup1 = esup.first;
   auto& esup2 = esup.second;
+  auto np = static_cast< std::ptrdiff_t >( npoin );
 
-  // allocate both of the linked lists storing points surrounding points, we
-  // only know the size of psup2, put in a single zero in psup1
-  std::vector< std::size_t > psup2( npoin+1 ), psup1( 1, 0 );
+  // allocate and fill with zeros one of the linked lists storing points
+  // surrounding points: psup2
+  std::vector< std::size_t > psup2( npoin+1, 0 );
 
-  // allocate and fill with zeros a temporary array, only used locally
-  std::vector< std::size_t > lpoin( npoin, 0 );
+  // point pass 1: count number of (unique) points surrounding each point,
+  // using a temporary array (one per thread) to mark points already counted
+  #pragma omp parallel
+  {
+    std::vector< std::size_t > lpoin( npoin, 0 );
+    #pragma omp for schedule(static)
+    for (std::ptrdiff_t ip=0; ip<np; ++ip) {
+      auto p = static_cast< std::size_t >( ip );
+      for (std::size_t i=esup2[p]+1; i<=esup2[p+1]; ++i )
+        for (std::size_t n=0; n<nnpe; ++n) {
+          auto q = inpoel[ esup1[i] * nnpe + n ];
+          if (q != p && lpoin[q] != p+1) {
+            ++psup2[p+1];
+            lpoin[q] = p+1;
+          }
+        }
+    }
+  }
 
-  // fill both psup1 and psup2
-  psup2[0] = 0;
-  std::size_t j = 0;
-  for (std::size_t p=0; p<npoin; ++p) {
-    for (std::size_t i=esup2[p]+1; i<=esup2[p+1]; ++i ) {
-      for (std::size_t n=0; n<nnpe; ++n) {
-        auto q = inpoel[ esup1[i] * nnpe + n ];
-        if (q != p && lpoin[q] != p+1) {
-          ++j;
-          psup1.push_back( q );
-          lpoin[q] = p+1;
+  // storage pass: compute indices into psup1 from the counts
+  for (std::size_t p=0; p<npoin; ++p) psup2[p+1] += psup2[p];
+
+  // now we know the size of psup1, so allocate it, and put in a single zero
+  std::vector< std::size_t > psup1( psup2.back()+1, 0 );
+
+  // point pass 2: store (and sort) point ids surrounding each point in psup1
+  #pragma omp parallel
+  {
+    std::vector< std::size_t > lpoin( npoin, 0 );
+    #pragma omp for schedule(static)
+    for (std::ptrdiff_t ip=0; ip<np; ++ip) {
+      auto p = static_cast< std::size_t >( ip );
+      auto j = psup2[p];
+      for (std::size_t i=esup2[p]+1; i<=esup2[p+1]; ++i )
+        for (std::size_t n=0; n<nnpe; ++n) {
+          auto q = inpoel[ esup1[i] * nnpe + n ];
+          if (q != p && lpoin[q] != p+1) {
+            psup1[ ++j ] = q;
+            lpoin[q] = p+1;
+          }
         }
+      std::sort(
+        std::next( begin(psup1), static_cast<std::ptrdiff_t>(psup2[p]+1) ),
+        std::next( begin(psup1), static_cast<std::ptrdiff_t>(psup2[p+1]+1) ) );
+    }
+  }
+
+  // Return (move out) linked lists
+  return std::make_pair( std::move(psup1), std::move(psup2) );
+}
+
+std::pair< std::vector< std::size_t >, std::vector< std::size_t > >
+updatePsup( const std::vector< std::size_t >& inpoel,
+            std::size_t nnpe,
+            const std::pair< std::vector< std::size_t >,
+                             std::vector< std::size_t > >& esup,
+            const std::pair< std::vector< std::size_t >,
+                             std::vector< std::size_t > >& psup,
+            const std::vector< std::size_t >& map,
+            const std::vector< std::size_t >& changed )
+// *****************************************************************************
+//  Update derived data structure, points surrounding points, after changing
+//  part of the mesh
+//! \param[in] inpoel Inteconnectivity of points and elements of the new mesh
+//! \param[in] nnpe Number of nodes per element
+//! \param[in] esup Elements surrounding points of the new mesh, see
+//!   tk::genEsup
+//! \param[in] psup Points surrounding points of the old mesh, see tk::genPsup
+//! \param[in] map Mapping of old->new point ids, the new id of points removed
+//!   from the mesh must be std::numeric_limits< std::size_t >::max()
+//! \param[in] changed Point ids of the new mesh whose surrounding elements
+//!   may have changed, i.e., the points of all elements of the new mesh that
+//!   are not in the old mesh, e.g., the children of refined and the parents of
+//!   derefined elements
+//! \return Linked lists storing points surrounding points of the new mesh,
+//!   same as would be returned by tk::genPsup() for the new mesh
+//! \details Points surrounding points are regenerated from the elements
+//!   surrounding points only for the changed and newly added points, for all
+//!   other points the old lists are remapped. This is cheaper than
+//!   regenerating the whole data structure if only a small fraction of the
+//!   mesh changed, e.g., after a step of adaptive mesh refinement.
+// *****************************************************************************
+{
+  Assert( !inpoel.empty(), "Attempt to call updatePsup() on empty container" );
+  Assert( nnpe > 0, "Attempt to call updatePsup() with zero nodes per element" );
+  Assert( inpoel.size()%nnpe == 0, "Size of inpoel must be divisible by nnpe" );
+  Assert( psup.second.size() == map.size()+1, "Size of old-new point id map "
+          "must equal the number of points of the old mesh" );
+
+  auto& esup1 = esup.first;
+  auto& esup2 = esup.second;
+  auto& opsup1 = psup.first;
+  auto& opsup2 = psup.second;
+
+  // find out number of points of the new mesh
+  auto npoin = esup2.size()-1;
+  auto np = static_cast< std::ptrdiff_t >( npoin );
+  const auto none = std::numeric_limits< std::size_t >::max();
+
+  // find old id of points of new mesh, flag changed and new points to redo
+  std::vector< std::size_t > oldid( npoin, none );
+  for (std::size_t o=0; o<map.size(); ++o)
+    if (map[o] != none) {
+      Assert( map[o] < npoin, "Old-new point id map indexing out of bounds" );
+      oldid[ map[o] ] = o;
+    }
+  std::vector< char > redo( npoin, 0 );
+  for (auto p : changed) redo[p] = 1;
+  for (std::size_t p=0; p<npoin; ++p) if (oldid[p] == none) redo[p] = 1;
+
+  // allocate and fill with zeros one of the linked lists storing points
+  // surrounding points: psup2
+  std::vector< std::size_t > psup2( npoin+1, 0 );
+
+  // point pass 1: count number of (unique) points surrounding each point,
+  // using a temporary array (one per thread) to mark points already counted
+  #pragma omp parallel
+  {
+    std::vector< std::size_t > lpoin( npoin, 0 );
+    #pragma omp for schedule(static)
+    for (std::ptrdiff_t ip=0; ip<np; ++ip) {
+      auto p = static_cast< std::size_t >( ip );
+      if (redo[p]) {
+        for (std::size_t i=esup2[p]+1; i<=esup2[p+1]; ++i )
+          for (std::size_t n=0; n<nnpe; ++n) {
+            auto q = inpoel[ esup1[i] * nnpe + n ];
+            if (q != p && lpoin[q] != p+1) {
+              ++psup2[p+1];
+              lpoin[q] = p+1;
+            }
+          }
+      } else {
+        psup2[p+1] = opsup2[ oldid[p]+1 ] - opsup2[ oldid[p] ];
       }
     }
-    psup2[p+1] = j;
   }
 
-  // sort point ids for each point in psup1
-  for (std::size_t p=0; p<npoin; ++p)
-    std::sort(
-      std::next( begin(psup1), static_cast<std::ptrdiff_t>(psup2[p]+1) ),
-      std::next( begin(psup1), static_cast<std::ptrdiff_t>(psup2[p+1]+1) ) );
+  // storage pass: compute indices into psup1 from the counts
+  for (std::size_t p=0; p<npoin; ++p) psup2[p+1] += psup2[p];
+
+  // now we know the size of psup1, so allocate it, and put in a single zero
+  std::vector< std::size_t > psup1( psup2.back()+1, 0 );
+
+  // point pass 2: store (and sort) point ids surrounding each point in psup1,
+  // regenerating the changed points and remapping the others
+  #pragma omp parallel
+  {
+    std::vector< std::size_t > lpoin( npoin, 0 );
+    #pragma omp for schedule(static)
+    for (std::ptrdiff_t ip=0; ip<np; ++ip) {
+      auto p = static_cast< std::size_t >( ip );
+      auto j = psup2[p];
+      if (redo[p]) {
+        for (std::size_t i=esup2[p]+1; i<=esup2[p+1]; ++i )
+          for (std::size_t n=0; n<nnpe; ++n) {
+            auto q = inpoel[ esup1[i] * nnpe + n ];
+            if (q != p && lpoin[q] != p+1) {
+              psup1[ ++j ] = q;
+              lpoin[q] = p+1;
+            }
+          }
+      } else {
+        auto o = oldid[p];
+        for (auto i=opsup2[o]+1; i<=opsup2[o+1]; ++i) {
+          Assert( map[ opsup1[i] ] != none, "Point surrounding unchanged point "
+                  "removed, the list of changed points is incomplete" );
+          psup1[ ++j ] = map[ opsup1[i] ];
+        }
+      }
+      std::sort(
+        std::next( begin(psup1), static_cast<std::ptrdiff_t>(psup2[p]+1) ),
+        std::next( begin(psup1), static_cast<std::ptrdiff_t>(psup2[p+1]+1) ) );
+    }
+  }
 
   // Return (move out) linked lists
   return std::make_pair( std::move(psup1), std::move(psup2) );
@@ -826,6 +977,71 @@ genEsued( const std::vector< std::size_t >& inpoel,
   return esued;
 }
 
+std::vector< std::vector< std::size_t > >
+genHalo( const std::vector< std::size_t >& inpoel,
+         std::size_t nnpe,
+         const std::pair< std::vector< std::size_t >,
+                          std::vector< std::size_t > >& esup,
+         const std::vector< std::size_t >& elems,
+         std::size_t nlayer )
+// *****************************************************************************
+//  Generate layers of elements surrounding a set of elements
+//! \param[in] inpoel Inteconnectivity of points and elements
+//! \param[in] nnpe Number of nodes per element
+//! \param[in] esup Elements surrounding points as linked lists, see tk::genEsup
+//! \param[in] elems Element ids of the set whose surrounding layers to
+//!   generate, e.g., the elements owned by a chare
+//! \param[in] nlayer Number of layers to generate
+//! \return Element ids of each layer in increasing order: layer 0 are the
+//!   elements not in elems sharing a node with elems, layer l > 0 are the
+//!   elements not in elems or the previous layers sharing a node with layer
+//!   l-1. Fewer than nlayer layers are returned if the mesh is exhausted.
+//! \details The layers are the halo, i.e., the ghost elements, a set of
+//!   elements needs to be advanced without communication for nlayer stages of
+//!   a scheme whose stencil is the elements surrounding the nodes of an
+//!   element, e.g., the vertex-based limiter or (with nodes as unknowns) the
+//!   node-based schemes. With face-based stencils, e.g., DG without
+//!   limiting, the layers are a superset of what is required.
+// *****************************************************************************
+{
+  Assert( nnpe > 0, "Attempt to call genHalo() with zero nodes per element" );
+  Assert( inpoel.size()%nnpe == 0, "Size of inpoel must be divisible by nnpe" );
+
+  auto& esup1 = esup.first;
+  auto& esup2 = esup.second;
+  const auto nelem = inpoel.size()/nnpe;
+
+  // mark the elements of the set and layers as they are generated
+  std::vector< char > marked( nelem, 0 );
+  for (auto e : elems) {
+    Assert( e < nelem, "Element id out of mesh" );
+    marked[e] = 1;
+  }
+
+  std::vector< std::vector< std::size_t > > layers;
+  std::vector< std::size_t > front( elems );
+  for (std::size_t l=0; l<nlayer && !front.empty(); ++l) {
+    std::vector< std::size_t > layer;
+    for (auto e : front)
+      for (std::size_t n=0; n<nnpe; ++n) {
+        auto p = inpoel[e*nnpe+n];
+        for (auto i=esup2[p]+1; i<=esup2[p+1]; ++i) {
+          auto s = esup1[i];
+          if (!marked[s]) {
+            marked[s] = 1;
+            layer.push_back( s );
+          }
+        }
+      }
+    if (layer.empty()) break;
+    std::sort( begin(layer), end(layer) );
+    front = layer;
+    layers.push_back( std::move(layer) );
+  }
+
+  return layers;
+}
+
 std::size_t
 genNbfacTet( std::size_t tnbfac,
              const std::vector< std::size_t >& inpoel,
@@ -993,59 +1209,65 @@ genEsuelTet( const std::vector< std::size_t >& inpoel,
   auto npoin = *minmax.second + 1;
 
   std::vector< int > esuelTet(nfpe*nelem, -1);
-  std::vector< std::size_t > lhelp(nnpf,0),
-                             lpoin(npoin,0);
+  auto ne = static_cast< std::ptrdiff_t >( nelem );
 
-  for (std::size_t e=0; e<nelem; ++e)
+  // Each element only stores its own neighbors, so that elements can be
+  // processed independently, using temporary arrays (one per thread)
+  #pragma omp parallel
   {
-    auto mark = nnpe*e;
-    for (std::size_t fe=0; fe<nfpe; ++fe)
+    std::array< std::size_t, 3 > lhelp{{ 0, 0, 0 }};
+    std::vector< std::size_t > lpoin(npoin,0);
+
+    #pragma omp for schedule(static)
+    for (std::ptrdiff_t ie=0; ie<ne; ++ie)
     {
-      // array which stores points on this face
-      lhelp[0] = inpoel[mark+lpofa[fe][0]];
-      lhelp[1] = inpoel[mark+lpofa[fe][1]];
-      lhelp[2] = inpoel[mark+lpofa[fe][2]];
+      auto e = static_cast< std::size_t >( ie );
+      auto mark = nnpe*e;
+      for (std::size_t fe=0; fe<nfpe; ++fe)
+      {
+        // array which stores points on this face
+        lhelp[0] = inpoel[mark+lpofa[fe][0]];
+        lhelp[1] = inpoel[mark+lpofa[fe][1]];
+        lhelp[2] = inpoel[mark+lpofa[fe][2]];
 
-      // mark in this array
-      lpoin[lhelp[0]] = 1;
-      lpoin[lhelp[1]] = 1;
-      lpoin[lhelp[2]] = 1;
+        // mark in this array
+        lpoin[lhelp[0]] = 1;
+        lpoin[lhelp[1]] = 1;
+        lpoin[lhelp[2]] = 1;
 
-      // select a point on this face
-      auto ipoin = lhelp[0];
+        // select a point on this face
+        auto ipoin = lhelp[0];
 
-      // loop over elements around this point
-      for (std::size_t j=esup2[ipoin]+1; j<=esup2[ipoin+1]; ++j )
-      {
-        auto jelem = esup1[j];
-        // if this jelem is not e itself then proceed
-        if (jelem != e)
+        // loop over elements around this point
+        for (std::size_t j=esup2[ipoin]+1; j<=esup2[ipoin+1]; ++j )
         {
-          for (std::size_t fj=0; fj<nfpe; ++fj)
+          auto jelem = esup1[j];
+          // if this jelem is not e itself then proceed
+          if (jelem != e)
           {
-            std::size_t icoun(0);
-            for (std::size_t jnofa=0; jnofa<nnpf; ++jnofa)
+            for (std::size_t fj=0; fj<nfpe; ++fj)
             {
-              auto markj = jelem*nnpe;
-              auto jpoin = inpoel[markj+lpofa[fj][jnofa]];
-              if (lpoin[jpoin] == 1) { ++icoun; }
-            }
-            //store esuel if
-            if (icoun == nnpf)
-            {
-              auto markf = nfpe*e;
-              esuelTet[markf+fe] = static_cast<int>(jelem);
-
-              markf = nfpe*jelem;
-              esuelTet[markf+fj] = static_cast<int>(e);
+              std::size_t icoun(0);
+              for (std::size_t jnofa=0; jnofa<nnpf; ++jnofa)
+              {
+                auto markj = jelem*nnpe;
+                auto jpoin = inpoel[markj+lpofa[fj][jnofa]];
+                if (lpoin[jpoin] == 1) { ++icoun; }
+              }
+              //store esuel if
+              if (icoun == nnpf)
+              {
+                auto markf = nfpe*e;
+                esuelTet[markf+fe] = static_cast<int>(jelem);
+              }
             }
           }
         }
+        // reset this array
+        lpoin[lhelp[0]] = 0;
+        lpoin[lhelp[1]] = 0;
+        lpoin[lhelp[2]] = 0;
       }
-      // reset this array
-      lpoin[lhelp[0]] = 0;
-      lpoin[lhelp[1]] = 0;
-      lpoin[lhelp[2]] = 0;
     }
   }
 
@@ -1291,6 +1513,99 @@ genBelemTet( std::size_t nbfac,
   return belem;
 }
         
+static void
+faceGeometry( const std::vector< std::size_t >& inpofa,
+              const UnsMesh::Coords& coord,
+              std::size_t f,
+              Fields& geoFace )
+// *****************************************************************************
+//  Compute the geometry of a triangular face in place
+//! \param[in] inpofa Face-node connectivity
+//! \param[in] coord Co-ordinates of nodes in this mesh-chunk
+//! \param[in] f Face id whose geometry to compute
+//! \param[in,out] geoFace Face geometry, see genGeoFaceTri(), whose row f is
+//!   overwritten
+// *****************************************************************************
+{
+  const auto& x = coord[0];
+  const auto& y = coord[1];
+  const auto& z = coord[2];
+
+  const auto A = inpofa[3*f+0];
+  const auto B = inpofa[3*f+1];
+  const auto C = inpofa[3*f+2];
+
+  geoFace(f,0,0) = area( x[A], x[B], x[C], y[A], y[B], y[C],
+                         z[A], z[B], z[C] );
+  normal( x[A], x[B], x[C], y[A], y[B], y[C], z[A], z[B], z[C],
+          geoFace(f,1,0), geoFace(f,2,0), geoFace(f,3,0) );
+  geoFace(f,4,0) = (x[A]+x[B]+x[C])/3.0;
+  geoFace(f,5,0) = (y[A]+y[B]+y[C])/3.0;
+  geoFace(f,6,0) = (z[A]+z[B]+z[C])/3.0;
+}
+
+static real
+tetGeometry( const std::vector< std::size_t >& inpoel,
+             const UnsMesh::Coords& coord,
+             std::size_t e,
+             Fields& geoElem )
+// *****************************************************************************
+//  Compute the geometry of a tetrahedron in place
+//! \param[in] inpoel Element-node connectivity
+//! \param[in] coord Co-ordinates of nodes in this mesh-chunk
+//! \param[in] e Element id whose geometry to compute
+//! \param[in,out] geoElem Element geometry, see genGeoElemTet(), whose row e
+//!   is overwritten
+//! \return Volume of the element
+// *****************************************************************************
+{
+  const auto& x = coord[0];
+  const auto& y = coord[1];
+  const auto& z = coord[2];
+
+  const auto A = inpoel[4*e+0];
+  const auto B = inpoel[4*e+1];
+  const auto C = inpoel[4*e+2];
+  const auto D = inpoel[4*e+3];
+  std::array< real, 3 > ba{{ x[B]-x[A], y[B]-y[A], z[B]-z[A] }},
+                        ca{{ x[C]-x[A], y[C]-y[A], z[C]-z[A] }},
+                        da{{ x[D]-x[A], y[D]-y[A], z[D]-z[A] }};
+
+  const auto vole = triple( ba, ca, da ) / 6.0;
+
+  Assert( vole > 0, "Element Jacobian non-positive" );
+
+  geoElem(e,0,0) = vole;
+  geoElem(e,1,0) = (x[A]+x[B]+x[C]+x[D])/4.0;
+  geoElem(e,2,0) = (y[A]+y[B]+y[C]+y[D])/4.0;
+  geoElem(e,3,0) = (z[A]+z[B]+z[C]+z[D])/4.0;
+
+  return vole;
+}
+
+static std::vector< std::size_t >
+around( const std::pair< std::vector< std::size_t >,
+                         std::vector< std::size_t > >& esup,
+        const std::vector< std::size_t >& nodes )
+// *****************************************************************************
+//  Collect the unique ids of entities surrounding a set of nodes
+//! \param[in] esup Entities (elements or faces) surrounding points, see
+//!   tk::genEsup()
+//! \param[in] nodes Node ids
+//! \return Sorted unique ids of entities having any of the nodes
+// *****************************************************************************
+{
+  std::vector< std::size_t > ids;
+  for (auto p : nodes) {
+    Assert( p+1 < esup.second.size(), "Node id out of esup bounds" );
+    for (auto i=esup.second[p]+1; i<=esup.second[p+1]; ++i)
+      ids.push_back( esup.first[i] );
+  }
+  std::sort( begin(ids), end(ids) );
+  ids.erase( std::unique( begin(ids), end(ids) ), end(ids) );
+  return ids;
+}
+
 Fields
 genGeoFaceTri( std::size_t nipfac,
                const std::vector< std::size_t >& inpofa,
@@ -1313,51 +1628,44 @@ genGeoFaceTri( std::size_t nipfac,
 //!   centroid x-coordinate: geoFace(f,4,0),
 //!            y-coordinate: geoFace(f,5,0),
 //!            z-coordinate: geoFace(f,6,0).
+//! \details The geometry of each face is computed directly into its row of
+//!   the result, without temporaries.
 // *****************************************************************************
 {
   Fields geoFace( nipfac, 7 );
 
-  // set triangle geometry
-  std::size_t nnpf(3);
+  Assert( inpofa.size()%3 == 0, "Size of inpofa must be divisible by 3" );
+  Assert( inpofa.size() >= 3*nipfac, "Size of inpofa too small" );
 
-  Assert( inpofa.size()%nnpf == 0,
-          "Size of inpofa must be divisible by nnpf" );
-
-  for(std::size_t f=0; f<nipfac; ++f)
-  {
-    std::size_t ip1, ip2, ip3;
-    real xp1, yp1, zp1,
-             xp2, yp2, zp2,
-             xp3, yp3, zp3;
-
-    // get area
-    ip1 = inpofa[nnpf*f];
-    ip2 = inpofa[nnpf*f + 1];
-    ip3 = inpofa[nnpf*f + 2];
-
-    xp1 = coord[0][ip1];
-    yp1 = coord[1][ip1];
-    zp1 = coord[2][ip1];
-
-    xp2 = coord[0][ip2];
-    yp2 = coord[1][ip2];
-    zp2 = coord[2][ip2];
-
-    xp3 = coord[0][ip3];
-    yp3 = coord[1][ip3];
-    zp3 = coord[2][ip3];
-
-    auto geoif = geoFaceTri( {{xp1, xp2, xp3}},
-                             {{yp1, yp2, yp3}},
-                             {{zp1, zp2, zp3}} );
-
-    for (std::size_t i=0; i<7; ++i)
-      geoFace(f,i,0) = geoif(0,i,0);
-  }
+  for (std::size_t f=0; f<nipfac; ++f)
+    faceGeometry( inpofa, coord, f, geoFace );
 
   return geoFace;
 }
 
+void
+updGeoFaceTri( const std::vector< std::size_t >& inpofa,
+               const UnsMesh::Coords& coord,
+               const std::pair< std::vector< std::size_t >,
+                                std::vector< std::size_t > >& fsup,
+               const std::vector< std::size_t >& moved,
+               Fields& geoFace )
+// *****************************************************************************
+//  Update the face geometry of the faces adjacent to moved nodes
+//! \param[in] inpofa Face-node connectivity
+//! \param[in] coord Co-ordinates of nodes in this mesh-chunk, already moved
+//! \param[in] fsup Faces surrounding points, e.g., tk::genEsup(inpofa,3)
+//! \param[in] moved Ids of nodes whose coordinates have changed
+//! \param[in,out] geoFace Face geometry, see genGeoFaceTri(), to update
+//! \details Only the faces that have at least one moved node are recomputed,
+//!   each once, so the cost is proportional to the number of moved nodes.
+//!   Faces beyond the number of faces in geoFace are skipped.
+// *****************************************************************************
+{
+  for (auto f : around( fsup, moved ))
+    if (f < geoFace.nunk()) faceGeometry( inpofa, coord, f, geoFace );
+}
+
 std::array< real, 3 >
 normal( const std::array< real, 3 >& x,
         const std::array< real, 3 >& y,
@@ -1448,44 +1756,46 @@ genGeoElemTet( const std::vector< std::size_t >& inpoel,
 //!            z-coordinate: geoElem(f,3,0).
 // *****************************************************************************
 {
-  // set tetrahedron geometry
-  std::size_t nnpe(4);
+  Assert( inpoel.size()%4 == 0, "Size of inpoel must be divisible by 4" );
 
-  Assert( inpoel.size()%nnpe == 0,
-          "Size of inpoel must be divisible by nnpe" );
-
-  auto nelem = inpoel.size()/nnpe;
+  auto nelem = inpoel.size()/4;
 
   Fields geoElem( nelem, 4 );
 
-  const auto& x = coord[0];
-  const auto& y = coord[1];
-  const auto& z = coord[2];
-
-  for(std::size_t e=0; e<nelem; ++e)
-  {
-    // get volume
-    const auto A = inpoel[nnpe*e+0];
-    const auto B = inpoel[nnpe*e+1];
-    const auto C = inpoel[nnpe*e+2];
-    const auto D = inpoel[nnpe*e+3];
-    std::array< real, 3 > ba{{ x[B]-x[A], y[B]-y[A], z[B]-z[A] }},
-                              ca{{ x[C]-x[A], y[C]-y[A], z[C]-z[A] }},
-                              da{{ x[D]-x[A], y[D]-y[A], z[D]-z[A] }};
-
-    const auto vole = triple( ba, ca, da ) / 6.0;
+  for (std::size_t e=0; e<nelem; ++e) tetGeometry( inpoel, coord, e, geoElem );
 
-    Assert( vole > 0, "Element Jacobian non-positive" );
+  return geoElem;
+}
 
-    geoElem(e,0,0) = vole;
+real
+updGeoElemTet( const std::vector< std::size_t >& inpoel,
+               const UnsMesh::Coords& coord,
+               const std::pair< std::vector< std::size_t >,
+                                std::vector< std::size_t > >& esup,
+               const std::vector< std::size_t >& moved,
+               Fields& geoElem )
+// *****************************************************************************
+//  Update the element geometry of the elements surrounding moved nodes
+//! \param[in] inpoel Element-node connectivity
+//! \param[in] coord Co-ordinates of nodes in this mesh-chunk, already moved
+//! \param[in] esup Elements surrounding points, see tk::genEsup()
+//! \param[in] moved Ids of nodes whose coordinates have changed
+//! \param[in,out] geoElem Element geometry, see genGeoElemTet(), to update
+//! \return Change in the sum of the volumes of the elements of the mesh chunk
+//! \details Only the elements that have at least one moved node are
+//!   recomputed, each once. The returned volume change allows keeping the
+//!   mesh volume up to date without summing the volumes of all elements.
+// *****************************************************************************
+{
+  Assert( geoElem.nunk() == inpoel.size()/4, "Size mismatch" );
 
-    // get centroid
-    geoElem(e,1,0) = (x[A]+x[B]+x[C]+x[D])/4.0;
-    geoElem(e,2,0) = (y[A]+y[B]+y[C]+y[D])/4.0;
-    geoElem(e,3,0) = (z[A]+z[B]+z[C]+z[D])/4.0;
+  real dv = 0.0;
+  for (auto e : around( esup, moved )) {
+    auto v = geoElem(e,0,0);
+    dv += tetGeometry( inpoel, coord, e, geoElem ) - v;
   }
 
-  return geoElem;
+  return dv;
 }
 
 bool
@@ -1757,5 +2067,151 @@ intet( const std::array< std::vector< real >, 3 >& coord,
   }
 }
 
+std::vector< real >
+genInvJacTet( const std::array< std::vector< real >, 3 >& coord,
+              const std::vector< std::size_t >& inpoel )
+// *****************************************************************************
+//  Generate inverse Jacobians of tetrahedra for evaluating shapefunctions
+//! \param[in] coord Mesh node coordinates
+//! \param[in] inpoel Mesh element connectivity
+//! \return InvJacTetSize reals per tetrahedron: the inverse of the Jacobian of
+//!   the map from the reference tetrahedron, row-major, followed by the
+//!   coordinates of the first node of the tetrahedron
+//! \details With these, the shapefunctions of a tetrahedron evaluated at a
+//!   point, see tk::shapeTet, cost 9 multiply-adds instead of the about 400
+//!   floating point operations of evaluating them by Cramer's rule, see
+//!   tk::intet, which pays off when evaluating them for more than a few points
+//!   per tetrahedron, e.g., when searching for particles or probes repeatedly.
+//!   The shapefunction of node i+1 is the ith reference coordinate, obtained
+//!   by multiplying the ith row of the inverse Jacobian with the position of
+//!   the point relative to the first node. The rows are the cross products of
+//!   the edges from the first node, divided by the determinant of the
+//!   Jacobian, whose columns are the edges. The shapefunctions of degenerate
+//!   tetrahedra are not finite, which tk::intet() rejects.
+// *****************************************************************************
+{
+  Assert( inpoel.size() % 4 == 0, "Size of inpoel must be divisible by 4" );
+
+  const auto& x = coord[0];
+  const auto& y = coord[1];
+  const auto& z = coord[2];
+
+  const auto nelem = inpoel.size()/4;
+  std::vector< real > invjac( nelem * InvJacTetSize );
+
+  for (std::size_t e=0; e<nelem; ++e) {
+    const auto A = inpoel[e*4+0];
+    const auto B = inpoel[e*4+1];
+    const auto C = inpoel[e*4+2];
+    const auto D = inpoel[e*4+3];
+    // edges from the first node
+    const std::array< real, 3 > b{{ x[B]-x[A], y[B]-y[A], z[B]-z[A] }},
+                                c{{ x[C]-x[A], y[C]-y[A], z[C]-z[A] }},
+                                d{{ x[D]-x[A], y[D]-y[A], z[D]-z[A] }};
+    const auto cd = tk::cross( c, d );
+    const auto db = tk::cross( d, b );
+    const auto bc = tk::cross( b, c );
+    const auto r = 1.0 / tk::dot( b, cd );
+    auto j = invjac.data() + e*InvJacTetSize;
+    for (std::size_t i=0; i<3; ++i) {
+      j[i]   = cd[i] * r;
+      j[3+i] = db[i] * r;
+      j[6+i] = bc[i] * r;
+    }
+    j[9] = x[A];
+    j[10] = y[A];
+    j[11] = z[A];
+  }
+
+  return invjac;
+}
+
+void
+shapeTet( const std::vector< real >& invjac,
+          std::size_t e,
+          const std::array< std::vector< real >, 3 >& p,
+          std::array< std::vector< real >, 4 >& N )
+// *****************************************************************************
+//  Evaluate shapefunctions of a tetrahedron at many points
+//! \param[in] invjac Inverse Jacobians of tetrahedra, see tk::genInvJacTet
+//! \param[in] e Tetrahedron index
+//! \param[in] p Point coordinates, one vector per coordinate direction
+//! \param[out] N Shapefunctions evaluated at the points, one vector per node
+//!   of the tetrahedron, resized to the number of points
+//! \details The loop over the points runs with the tetrahedron's data in
+//!   registers and unit-stride access to the points, so it vectorizes.
+// *****************************************************************************
+{
+  Assert( e < invjac.size()/InvJacTetSize, "Tetrahedron index out of range" );
+  Assert( p[1].size() == p[0].size() && p[2].size() == p[0].size(),
+          "Size mismatch" );
+
+  const auto n = p[0].size();
+  for (auto& v : N) v.resize( n );
+
+  const auto j = invjac.data() + e*InvJacTetSize;
+  const auto j0 = j[0], j1 = j[1], j2 = j[2], j3 = j[3], j4 = j[4],
+             j5 = j[5], j6 = j[6], j7 = j[7], j8 = j[8],
+             xa = j[9], ya = j[10], za = j[11];
+  const auto x = p[0].data();
+  const auto y = p[1].data();
+  const auto z = p[2].data();
+  auto N0 = N[0].data();
+  auto N1 = N[1].data();
+  auto N2 = N[2].data();
+  auto N3 = N[3].data();
+
+  for (std::size_t i=0; i<n; ++i) {
+    const auto dx = x[i] - xa;
+    const auto dy = y[i] - ya;
+    const auto dz = z[i] - za;
+    N1[i] = j0*dx + j1*dy + j2*dz;
+    N2[i] = j3*dx + j4*dy + j5*dz;
+    N3[i] = j6*dx + j7*dy + j8*dz;
+    N0[i] = 1.0 - N1[i] - N2[i] - N3[i];
+  }
+}
+
+void
+shapeTet( const std::vector< real >& invjac,
+          const std::vector< std::size_t >& e,
+          const std::array< std::vector< real >, 3 >& p,
+          std::array< std::vector< real >, 4 >& N )
+// *****************************************************************************
+//  Evaluate shapefunctions of many tetrahedra at a point each
+//! \param[in] invjac Inverse Jacobians of tetrahedra, see tk::genInvJacTet
+//! \param[in] e Tetrahedron index for each point
+//! \param[in] p Point coordinates, one vector per coordinate direction
+//! \param[out] N Shapefunctions of tetrahedron e[i] evaluated at point i, one
+//!   vector per node of the tetrahedra, resized to the number of points
+// *****************************************************************************
+{
+  Assert( p[0].size() == e.size() && p[1].size() == e.size() &&
+          p[2].size() == e.size(), "Size mismatch" );
+
+  const auto n = e.size();
+  for (auto& v : N) v.resize( n );
+
+  const auto x = p[0].data();
+  const auto y = p[1].data();
+  const auto z = p[2].data();
+  auto N0 = N[0].data();
+  auto N1 = N[1].data();
+  auto N2 = N[2].data();
+  auto N3 = N[3].data();
+
+  for (std::size_t i=0; i<n; ++i) {
+    Assert( e[i] < invjac.size()/InvJacTetSize,
+            "Tetrahedron index out of range" );
+    const auto j = invjac.data() + e[i]*InvJacTetSize;
+    const auto dx = x[i] - j[9];
+    const auto dy = y[i] - j[10];
+    const auto dz = z[i] - j[11];
+    N1[i] = j[0]*dx + j[1]*dy + j[2]*dz;
+    N2[i] = j[3]*dx + j[4]*dy + j[5]*dz;
+    N3[i] = j[6]*dx + j[7]*dy + j[8]*dz;
+    N0[i] = 1.0 - N1[i] - N2[i] - N3[i];
+  }
+}
 
 } // tk::
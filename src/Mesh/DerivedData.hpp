@@ -16,6 +16,7 @@
 #include <vector>
 #include <map>
 #include <utility>
+#include <algorithm>
 #include <cstddef>
 #include "Types.hpp"
 #include "Fields.hpp"
@@ -138,6 +139,18 @@ genPsup( const std::vector< std::size_t >& inpoel,
          const std::pair< std::vector< std::size_t >,
                           std::vector< std::size_t > >& esup );
 
+//! \brief Update derived data structure, points surrounding points, after
+//!   changing part of the mesh
+std::pair< std::vector< std::size_t >, std::vector< std::size_t > >
+updatePsup( const std::vector< std::size_t >& inpoel,
+            std::size_t nnpe,
+            const std::pair< std::vector< std::size_t >,
+                             std::vector< std::size_t > >& esup,
+            const std::pair< std::vector< std::size_t >,
+                             std::vector< std::size_t > >& psup,
+            const std::vector< std::size_t >& map,
+            const std::vector< std::size_t >& changed );
+
 //! Generate derived data structure, edges surrounding points
 std::pair< std::vector< std::size_t >, std::vector< std::size_t > >
 genEdsup( const std::vector< std::size_t >& inpoel,
@@ -188,6 +201,15 @@ genEsued( const std::vector< std::size_t >& inpoel,
           const std::pair< std::vector< std::size_t >,
                            std::vector< std::size_t > >& esup );
 
+//! Generate layers of elements surrounding a set of elements
+std::vector< std::vector< std::size_t > >
+genHalo( const std::vector< std::size_t >& inpoel,
+         std::size_t nnpe,
+         const std::pair< std::vector< std::size_t >,
+                          std::vector< std::size_t > >& esup,
+         const std::vector< std::size_t >& elems,
+         std::size_t nlayer );
+
 //! Generate total number of boundary faces in this chunk
 std::size_t
 genNbfacTet( std::size_t tnbfac,
@@ -233,6 +255,15 @@ genGeoFaceTri( std::size_t nipfac,
                const std::vector< std::size_t >& inpofa,
                const UnsMesh::Coords& coord );
 
+//! Update face geometry of the faces adjacent to moved nodes
+void
+updGeoFaceTri( const std::vector< std::size_t >& inpofa,
+               const UnsMesh::Coords& coord,
+               const std::pair< std::vector< std::size_t >,
+                                std::vector< std::size_t > >& fsup,
+               const std::vector< std::size_t >& moved,
+               Fields& geoFace );
+
 //! Compute geometry of the face given by three vertices
 Fields
 geoFaceTri( const std::array< real, 3 >& x,
@@ -244,6 +275,15 @@ Fields
 genGeoElemTet( const std::vector< std::size_t >& inpoel,
                const UnsMesh::Coords& coord );
 
+//! Update element geometry of the elements surrounding moved nodes
+real
+updGeoElemTet( const std::vector< std::size_t >& inpoel,
+               const UnsMesh::Coords& coord,
+               const std::pair< std::vector< std::size_t >,
+                                std::vector< std::size_t > >& esup,
+               const std::vector< std::size_t >& moved,
+               Fields& geoElem );
+
 //! Perform leak-test on mesh (partition)
 bool
 leakyPartition( const std::vector< int >& esueltet,
@@ -264,6 +304,60 @@ intet( const std::array< std::vector< real >, 3 >& coord,
        std::size_t e,
        std::array< real, 4 >& N );
 
+//! Number of reals stored per tetrahedron by genInvJacTet()
+const std::size_t InvJacTetSize = 12;
+
+//! Generate inverse Jacobians of tetrahedra for evaluating shapefunctions
+std::vector< real >
+genInvJacTet( const std::array< std::vector< real >, 3 >& coord,
+              const std::vector< std::size_t >& inpoel );
+
+//! Evaluate shapefunctions of a tetrahedron at a point
+//! \param[in] invjac Inverse Jacobians of tetrahedra, see tk::genInvJacTet
+//! \param[in] e Tetrahedron index
+//! \param[in] x X coordinate of point
+//! \param[in] y Y coordinate of point
+//! \param[in] z Z coordinate of point
+//! \param[out] N Shapefunctions of the tetrahedron evaluated at the point
+inline void
+shapeTet( const std::vector< real >& invjac,
+          std::size_t e,
+          real x, real y, real z,
+          std::array< real, 4 >& N )
+{
+  const auto j = invjac.data() + e*InvJacTetSize;
+  const auto dx = x - j[9];
+  const auto dy = y - j[10];
+  const auto dz = z - j[11];
+  N[1] = j[0]*dx + j[1]*dy + j[2]*dz;
+  N[2] = j[3]*dx + j[4]*dy + j[5]*dz;
+  N[3] = j[6]*dx + j[7]*dy + j[8]*dz;
+  N[0] = 1.0 - N[1] - N[2] - N[3];
+}
+
+//! Evaluate shapefunctions of a tetrahedron at many points
+void
+shapeTet( const std::vector< real >& invjac,
+          std::size_t e,
+          const std::array< std::vector< real >, 3 >& p,
+          std::array< std::vector< real >, 4 >& N );
+
+//! Evaluate shapefunctions of many tetrahedra at a point each
+void
+shapeTet( const std::vector< real >& invjac,
+          const std::vector< std::size_t >& e,
+          const std::array< std::vector< real >, 3 >& p,
+          std::array< std::vector< real >, 4 >& N );
+
+//! Determine if a point is in a tetrahedron given its shapefunctions
+//! \param[in] N Shapefunctions of the tetrahedron evaluated at the point
+//! \return True if the point is in the tetrahedron
+inline bool
+intet( const std::array< real, 4 >& N ) {
+  return std::min(N[0],1.0-N[0]) > 0 && std::min(N[1],1.0-N[1]) > 0 &&
+         std::min(N[2],1.0-N[2]) > 0 && std::min(N[3],1.0-N[3]) > 0;
+}
+
 } // tk::
 
 #endif // DerivedData_h
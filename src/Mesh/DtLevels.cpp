@@ -0,0 +1,102 @@
+// *****************************************************************************
+/*!
+  \file      src/Mesh/DtLevels.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Functions grouping mesh nodes into time step size levels
+  \details   Functions grouping mesh nodes into levels of time step sizes that
+    are powers of two multiples of the smallest one, as used by multi-rate
+    time stepping.
+*/
+// *****************************************************************************
+
+#include <cmath>
+#include <algorithm>
+
+#include "Exception.hpp"
+#include "DtLevels.hpp"
+
+namespace tk {
+
+std::vector< std::size_t >
+dtlevels( const std::vector< tk::real >& dtp,
+          tk::real dtmin,
+          std::size_t nlevel,
+          const std::pair< std::vector< std::size_t >,
+                           std::vector< std::size_t > >& psup )
+// *****************************************************************************
+//  Group mesh nodes into time step size levels
+//! \param[in] dtp Largest stable time step size of each mesh node
+//! \param[in] dtmin Smallest time step size, level 0, e.g., the minimum of dtp
+//!   across all mesh nodes of all chares
+//! \param[in] nlevel Number of levels, the largest level is nlevel-1
+//! \param[in] psup Points surrounding points, see tk::genPsup()
+//! \return Level l of each mesh node, whose time step size is dtmin * 2^l
+//! \details A node is first assigned the largest level whose time step size
+//!   does not exceed its own, then the levels are lowered so that the levels
+//!   of neighboring nodes differ by at most one. The latter is done by a
+//!   breadth-first sweep of the nodes in increasing order of their levels,
+//!   which yields the largest levels satisfying both conditions.
+// *****************************************************************************
+{
+  Assert( nlevel > 0, "Number of levels must be positive" );
+  Assert( dtmin > 0.0, "Smallest time step size must be positive" );
+  Assert( psup.second.size() == dtp.size()+1, "Size mismatch" );
+
+  const auto& p1 = psup.first;
+  const auto& p2 = psup.second;
+  const auto npoin = dtp.size();
+
+  // Assign the largest level not exceeding the node's time step size
+  std::vector< std::size_t > level( npoin );
+  std::vector< std::vector< std::size_t > > bucket( nlevel );
+  for (std::size_t i=0; i<npoin; ++i) {
+    auto r = dtp[i] / dtmin;
+    std::size_t l = 0;
+    while (l+1 < nlevel && r >= 2.0) { r /= 2.0; ++l; }
+    level[i] = l;
+    bucket[l].push_back( i );
+  }
+
+  // Lower levels so that neighbors differ by at most one, the nodes whose
+  // level has been lowered are processed again with their new level
+  for (std::size_t l=0; l+1<nlevel; ++l)
+    for (std::size_t b=0; b<bucket[l].size(); ++b) {
+      auto i = bucket[l][b];
+      if (level[i] != l) continue;
+      for (auto j=p2[i]+1; j<=p2[i+1]; ++j) {
+        auto q = p1[j];
+        if (level[q] > l+1) {
+          level[q] = l+1;
+          bucket[l+1].push_back( q );
+        }
+      }
+    }
+
+  return level;
+}
+
+tk::real
+dtspeedup( const std::vector< tk::real >& count )
+// *****************************************************************************
+//  Estimate the speedup of multi-rate time stepping
+//! \param[in] count Number of mesh nodes in each time step size level
+//! \return Ratio of the number of node updates advancing all nodes with the
+//!   time step size of level 0 and advancing the nodes of each level l with
+//!   their own time step size, 2^l times larger
+//! \details This is an upper bound of the speedup, as it ignores the extra
+//!   work at the interfaces of the levels.
+// *****************************************************************************
+{
+  tk::real n = 0.0, w = 0.0, f = 1.0;
+  for (auto c : count) {
+    n += c;
+    w += c * f;
+    f /= 2.0;
+  }
+  return w > 0.0 ? n / w : 1.0;
+}
+
+} // tk::
@@ -0,0 +1,38 @@
+// *****************************************************************************
+/*!
+  \file      src/Mesh/DtLevels.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Functions grouping mesh nodes into time step size levels
+  \details   Functions grouping mesh nodes into levels of time step sizes that
+    are powers of two multiples of the smallest one, as used by multi-rate
+    time stepping.
+*/
+// *****************************************************************************
+#ifndef DtLevels_h
+#define DtLevels_h
+
+#include <vector>
+#include <utility>
+
+#include "Types.hpp"
+
+namespace tk {
+
+//! Group mesh nodes into time step size levels
+std::vector< std::size_t >
+dtlevels( const std::vector< tk::real >& dtp,
+          tk::real dtmin,
+          std::size_t nlevel,
+          const std::pair< std::vector< std::size_t >,
+                           std::vector< std::size_t > >& psup );
+
+//! Estimate the speedup of multi-rate time stepping
+tk::real
+dtspeedup( const std::vector< tk::real >& count );
+
+} // tk::
+
+#endif // DtLevels_h
@@ -160,4 +160,165 @@ edgegrad( const std::array< std::vector< tk::real >, 3 >& coord,
    return g;
 }
 
+ShapeGrads
+shapegrads( const std::array< std::vector< tk::real >, 3 >& coord,
+            const std::vector< std::size_t >& inpoel )
+// *****************************************************************************
+//  Compute shape function derivatives and Jacobians of all mesh elements
+//! \param[in] coord Mesh node coordinates
+//! \param[in] inpoel Mesh element connectivity
+//! \return Shape function derivatives and Jacobians of all elements
+//! \details The result only changes if the mesh changes, e.g., after mesh
+//!   refinement, and is to be passed to nodegrads() or edgegrad() as many
+//!   times as gradients are required on the same mesh.
+// *****************************************************************************
+{
+  Assert( inpoel.size() % 4 == 0, "Size of inpoel must be divisible by 4" );
+
+  const auto& x = coord[0];
+  const auto& y = coord[1];
+  const auto& z = coord[2];
+
+  const auto nelem = inpoel.size()/4;
+  ShapeGrads sg;
+  sg.dN.resize( nelem*12 );
+  sg.J.resize( nelem );
+
+  // Elements are independent, shared among OpenMP threads (if enabled)
+  #pragma omp parallel for schedule(static)
+  for (std::ptrdiff_t ie=0; ie<static_cast< std::ptrdiff_t >( nelem ); ++ie) {
+    const auto e = static_cast< std::size_t >( ie );
+    const std::array< std::size_t, 4 > N{{ inpoel[e*4+0], inpoel[e*4+1],
+                                           inpoel[e*4+2], inpoel[e*4+3] }};
+    const std::array< tk::real, 3 >
+      ba{{ x[N[1]]-x[N[0]], y[N[1]]-y[N[0]], z[N[1]]-z[N[0]] }},
+      ca{{ x[N[2]]-x[N[0]], y[N[2]]-y[N[0]], z[N[2]]-z[N[0]] }},
+      da{{ x[N[3]]-x[N[0]], y[N[3]]-y[N[0]], z[N[3]]-z[N[0]] }};
+    const auto J = tk::triple( ba, ca, da );        // J = 6V
+    Assert( J > 0, "Element Jacobian non-positive" );
+    sg.J[e] = J;
+
+    // shape function derivatives, nnode*ndim [4][3]
+    auto g = sg.dN.data() + e*12;
+    const auto g1 = tk::crossdiv( ca, da, J );
+    const auto g2 = tk::crossdiv( da, ba, J );
+    const auto g3 = tk::crossdiv( ba, ca, J );
+    for (std::size_t j=0; j<3; ++j) {
+      g[3+j] = g1[j];
+      g[6+j] = g2[j];
+      g[9+j] = g3[j];
+      g[j] = -g1[j]-g2[j]-g3[j];
+    }
+  }
+
+  return sg;
+}
+
+std::vector< std::array< tk::real, 3 > >
+nodegrads( const ShapeGrads& sg,
+           const std::vector< std::size_t >& inpoel,
+           const std::pair< std::vector< std::size_t >,
+                            std::vector< std::size_t > >& esup,
+           const tk::Fields& U,
+           const std::vector< ncomp_t >& comps )
+// *****************************************************************************
+//  Compute gradients of scalar components at all mesh nodes
+//! \param[in] sg Shape function derivatives and Jacobians, see shapegrads()
+//! \param[in] inpoel Mesh element connectivity
+//! \param[in] esup Linked lists storing elements surrounding points, see
+//!    tk::genEsup()
+//! \param[in] U Field vector whose component gradients to compute
+//! \param[in] comps Scalar components to compute gradients of
+//! \return Gradients of the components at all mesh nodes, gradient of
+//!   comps[i] at node p at index p*comps.size()+i
+//! \details Computes the same gradients as nodegrad() called for each node
+//!   and component, bit by bit, but without recomputing the element geometry
+//!   for every node and component: the element contributions are gathered to
+//!   each node from the elements surrounding it, so the loop over the nodes
+//!   is free of write conflicts and is shared among OpenMP threads (if
+//!   enabled).
+// *****************************************************************************
+{
+  Assert( sg.J.size() == inpoel.size()/4, "Size mismatch" );
+  Assert( esup.second.size() == U.nunk()+1, "Size mismatch" );
+  for ([[maybe_unused]] auto c : comps)
+    Assert( c < U.nprop(), "Indexing out of field data" );
+
+  const auto npoin = U.nunk();
+  const auto ncomp = comps.size();
+
+  std::vector< std::array< tk::real, 3 > > grad( npoin*ncomp );
+
+  #pragma omp parallel for schedule(static)
+  for (std::ptrdiff_t ip=0; ip<static_cast< std::ptrdiff_t >( npoin ); ++ip) {
+    const auto p = static_cast< std::size_t >( ip );
+    auto g = grad.data() + p*ncomp;
+    for (std::size_t c=0; c<ncomp; ++c) g[c] = {{ 0.0, 0.0, 0.0 }};
+    tk::real vol = 0.0;
+
+    // gather gradients over elements weighed by cell volume / 4
+    for (auto e : tk::Around(esup,p)) {
+      const std::array< std::size_t, 4 > N{{ inpoel[e*4+0], inpoel[e*4+1],
+                                             inpoel[e*4+2], inpoel[e*4+3] }};
+      const auto dN = sg.dN.data() + e*12;
+      const auto J = sg.J[e];
+      vol += 5.0*J/120.0;
+      for (std::size_t c=0; c<ncomp; ++c) {
+        auto u = U.extract( comps[c], 0, N );
+        for (std::size_t j=0; j<3; ++j)
+          for (std::size_t i=0; i<4; ++i)
+            g[c][j] += dN[i*3+j] * u[i] * 5.0*J/120.0;
+      }
+    }
+
+    // divide components of nodal gradients by nodal volume
+    for (std::size_t c=0; c<ncomp; ++c)
+      for (std::size_t j=0; j<3; ++j)
+        g[c][j] /= vol;
+  }
+
+  return grad;
+}
+
+std::array< tk::real, 3 >
+edgegrad( const ShapeGrads& sg,
+          const std::vector< std::size_t >& inpoel,
+          const std::vector< std::size_t >& esued,
+          const tk::Fields& U,
+          ncomp_t c )
+// *****************************************************************************
+//  Compute gradient at a mesh edge using precomputed shape function derivatives
+//! \param[in] sg Shape function derivatives and Jacobians, see shapegrads()
+//! \param[in] inpoel Mesh element connectivity
+//! \param[in] esued List of elements surrounding edge, see tk::genEsued()
+//! \param[in] U Field vector whose component gradient to compute
+//! \param[in] c Scalar component to compute gradient of
+//! \return Gradient of U(c) at mesh edge
+// *****************************************************************************
+{
+  Assert( c < U.nprop(), "Indexing out of field data" );
+
+  // storage for gradient and volume at the mesh edge
+  std::array< tk::real, 3 > g{{ 0.0, 0.0, 0.0 }};
+  tk::real vol = 0.0;
+
+  // sum gradients over elements weighed by cell volume / 6
+  for (auto e : esued) {
+    const std::array< std::size_t, 4 > N{{ inpoel[e*4+0], inpoel[e*4+1],
+                                           inpoel[e*4+2], inpoel[e*4+3] }};
+    const auto dN = sg.dN.data() + e*12;
+    const auto J = sg.J[e];
+    auto u = U.extract( c, 0, N );
+    vol += J/36.0;
+    for (std::size_t j=0; j<3; ++j)
+      for (std::size_t i=0; i<4; ++i)
+        g[j] += dN[i*3+j] * u[i] * J/36.0;
+  }
+
+  // divide components of gradient by edge volume
+  for (std::size_t j=0; j<3; ++j) g[j] /= vol;
+
+  return g;
+}
+
 } // tk::
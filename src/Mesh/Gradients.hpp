@@ -26,6 +26,16 @@ namespace tk {
 
 using ncomp_t = kw::ncomp::info::expect::type;
 
+//! Shape function derivatives and Jacobians of all tetrahedra of a mesh
+//! \details Only depend on the mesh, so can be reused for computing the
+//!   gradients of any number of fields on the same mesh, see shapegrads().
+struct ShapeGrads {
+  //! Shape function derivatives, 4 nodes * 3 dimensions of each element
+  std::vector< tk::real > dN;
+  //! Jacobian determinant, six times the volume, of each element
+  std::vector< tk::real > J;
+};
+
 //! Compute gradient at a mesh node
 std::array< tk::real, 3 >
 nodegrad( std::size_t node,
@@ -44,6 +54,28 @@ edgegrad( const std::array< std::vector< tk::real >, 3 >& coord,
           const tk::Fields& U,
           ncomp_t c );
 
+//! Compute shape function derivatives and Jacobians of all mesh elements
+ShapeGrads
+shapegrads( const std::array< std::vector< tk::real >, 3 >& coord,
+            const std::vector< std::size_t >& inpoel );
+
+//! Compute gradients of scalar components at all mesh nodes
+std::vector< std::array< tk::real, 3 > >
+nodegrads( const ShapeGrads& sg,
+           const std::vector< std::size_t >& inpoel,
+           const std::pair< std::vector< std::size_t >,
+                            std::vector< std::size_t > >& esup,
+           const tk::Fields& U,
+           const std::vector< ncomp_t >& comps );
+
+//! Compute gradient at a mesh edge using precomputed shape function derivatives
+std::array< tk::real, 3 >
+edgegrad( const ShapeGrads& sg,
+          const std::vector< std::size_t >& inpoel,
+          const std::vector< std::size_t >& esued,
+          const tk::Fields& U,
+          ncomp_t c );
+
 } // tk::
 
 #endif // Gradients_h
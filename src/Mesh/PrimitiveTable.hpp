@@ -0,0 +1,103 @@
+// *****************************************************************************
+/*!
+  \file      src/Mesh/PrimitiveTable.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Flat table of unique element primitives, e.g., edges or faces
+  \details   Flat table of unique element primitives, e.g., edges or faces,
+    given by node IDs, built by sorting rather than hashing.
+*/
+// *****************************************************************************
+#ifndef PrimitiveTable_h
+#define PrimitiveTable_h
+
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+
+#include "Exception.hpp"
+
+namespace tk {
+
+//! \brief Flat table of unique element primitives, e.g., edges or faces, given
+//!   by node IDs
+//! \details This is an alternative to UnsMesh::EdgeSet and UnsMesh::FaceSet
+//!   for when many primitives are inserted first and only queried afterwards.
+//!   Primitives are appended to a contiguous vector with their node IDs sorted,
+//!   then the table is sorted and made unique once, after which a query is a
+//!   binary search. Compared to the hash sets this avoids hashing every
+//!   primitive, one heap allocation per primitive, and the storage overhead of
+//!   the hash buckets. Only the node IDs of the primitives are stored, as in
+//!   the hash sets, the order of nodes (orientation) is not.
+//! \tparam N Number of nodes describing element primitive. E.g., Edge:2,
+//!    Face:3, Tet:4.
+template< std::size_t N >
+class PrimitiveTable {
+
+  public:
+    //! Element primitive: node IDs
+    using Primitive = std::array< std::size_t, N >;
+
+    //! Const iterator to the primitives
+    using const_iterator = typename std::vector< Primitive >::const_iterator;
+
+    //! Reserve storage for a number of primitives (including duplicates)
+    //! \param[in] n Number of primitives to reserve memory for
+    void reserve( std::size_t n ) { m_prim.reserve( n ); }
+
+    //! Add a primitive to the table
+    //! \param[in] p Node IDs of element primitive to add (in any order)
+    //! \note Duplicates are only removed by finalize().
+    void insert( Primitive p ) {
+      std::sort( p.begin(), p.end() );
+      m_prim.push_back( p );
+      m_final = false;
+    }
+
+    //! Sort and remove duplicate primitives, required before queries
+    void finalize() {
+      std::sort( m_prim.begin(), m_prim.end() );
+      m_prim.erase( std::unique( m_prim.begin(), m_prim.end() ),
+                    m_prim.end() );
+      m_prim.shrink_to_fit();
+      m_final = true;
+    }
+
+    //! Query if a primitive is in the table
+    //! \param[in] p Node IDs of element primitive to find (in any order)
+    //! \return True if the primitive is in the table
+    bool contains( Primitive p ) const {
+      Assert( m_final, "PrimitiveTable must be finalized before queries" );
+      std::sort( p.begin(), p.end() );
+      return std::binary_search( m_prim.cbegin(), m_prim.cend(), p );
+    }
+
+    //! Number of primitives in the table
+    //! \return Number of (unique after finalize()) primitives
+    std::size_t size() const noexcept { return m_prim.size(); }
+
+    //! Const iterator to the first primitive
+    //! \return Iterator to the first primitive (sorted after finalize())
+    const_iterator begin() const noexcept { return m_prim.cbegin(); }
+
+    //! Const iterator to the primitive after the last one
+    //! \return Iterator to the primitive after the last one
+    const_iterator end() const noexcept { return m_prim.cend(); }
+
+  private:
+    std::vector< Primitive > m_prim;    //!< Primitives with sorted node IDs
+    bool m_final = true;                //!< True if sorted and unique
+};
+
+//! Flat table of unique edges
+using EdgeTable = PrimitiveTable< 2 >;
+
+//! Flat table of unique faces
+using FaceTable = PrimitiveTable< 3 >;
+
+} // tk::
+
+#endif // PrimitiveTable_h
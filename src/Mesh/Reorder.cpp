@@ -16,6 +16,8 @@
 #include <map>
 #include <tuple>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
 
 #include "Reorder.hpp"
 #include "Exception.hpp"
@@ -257,6 +259,280 @@ renumber( const std::pair< std::vector< std::size_t >,
   return map;
 }
 
+std::vector< std::size_t >
+renumberRCM( const std::pair< std::vector< std::size_t >,
+                              std::vector< std::size_t > >& psup )
+// *****************************************************************************
+//  Reorder mesh points with the reverse Cuthill-McKee algorithm
+//! \param[in] psup Points surrounding points
+//! \return Mapping created by renumbering (reordering): old->new
+//! \details Each connected component of the graph is traversed breadth-first
+//!   starting from an unnumbered point of minimum degree, visiting the
+//!   neighbors of each point in increasing order of their degree. The order of
+//!   the traversal is then reversed, which reduces the bandwidth (and profile)
+//!   of the matrices assembled over the edges of the graph.
+// *****************************************************************************
+{
+  const auto& psup1 = psup.first;
+  const auto& psup2 = psup.second;
+
+  // Find out number of nodes in graph
+  auto npoin = psup2.size()-1;
+
+  // Lambda to query the degree of a point
+  auto degree = [&]( std::size_t p ){ return psup2[p+1] - psup2[p]; };
+
+  // Points sorted by increasing degree, used to find the next start point
+  std::vector< std::size_t > bydeg( npoin );
+  for (std::size_t p=0; p<npoin; ++p) bydeg[p] = p;
+  std::stable_sort( begin(bydeg), end(bydeg),
+    [&]( std::size_t a, std::size_t b ){ return degree(a) < degree(b); } );
+
+  // Construct Cuthill-McKee order (new->old) by breadth-first traversal
+  std::vector< std::size_t > order;
+  order.reserve( npoin );
+  std::vector< char > done( npoin, 0 );
+  std::vector< std::size_t > nbr;
+  for (auto s : bydeg) {
+    if (done[s]) continue;
+    done[s] = 1;
+    auto head = order.size();
+    order.push_back( s );
+    while (head < order.size()) {
+      auto p = order[ head++ ];
+      nbr.clear();
+      for (auto j=psup2[p]+1; j<=psup2[p+1]; ++j) {
+        auto q = psup1[j];
+        if (!done[q]) { done[q] = 1; nbr.push_back( q ); }
+      }
+      std::stable_sort( begin(nbr), end(nbr),
+        [&]( std::size_t a, std::size_t b ){ return degree(a) < degree(b); } );
+      order.insert( end(order), begin(nbr), end(nbr) );
+    }
+  }
+
+  Assert( order.size() == npoin, "Not all points have been renumbered" );
+
+  // Reverse the order and construct old->new id map
+  std::vector< std::size_t > map( npoin );
+  for (std::size_t i=0; i<npoin; ++i) map[ order[i] ] = npoin-1-i;
+
+  return map;
+}
+
+//! Number of bits per coordinate direction in space-filling curve keys
+static const int SFCBits = 21;
+
+static std::array< real, 6 >
+boundingBox( const std::array< std::vector< real >, 3 >& coord )
+// *****************************************************************************
+// Compute the bounding box of points
+//! \param[in] coord Point coordinates
+//! \return Bounding box: minimum x, y, z, followed by maximum x, y, z
+// *****************************************************************************
+{
+  auto npoin = coord[0].size();
+  std::array< real, 6 > box;
+  for (std::size_t d=0; d<3; ++d) {
+    auto mm = std::minmax_element( begin(coord[d]), end(coord[d]) );
+    box[d] = npoin ? *mm.first : 0.0;
+    box[d+3] = npoin ? *mm.second : 0.0;
+  }
+  return box;
+}
+
+static std::vector< std::array< std::uint32_t, 3 > >
+quantize( const std::array< std::vector< real >, 3 >& coord,
+          const std::array< real, 6 >& box )
+// *****************************************************************************
+// Quantize point coordinates to integers on a uniform grid spanning a
+// bounding box
+//! \param[in] coord Point coordinates
+//! \param[in] box Bounding box containing all points: minimum x, y, z,
+//!   followed by maximum x, y, z
+//! \return Integer coordinates in [0,2^SFCBits) in all three directions
+// *****************************************************************************
+{
+  auto npoin = coord[0].size();
+
+  // Use the same scaling in all directions to keep the aspect ratio
+  auto len = std::max( { box[3]-box[0], box[4]-box[1], box[5]-box[2] } );
+  const auto cells = static_cast< real >( (1U << SFCBits) - 1 );
+  auto scale = len > 0.0 ? cells/len : 0.0;
+
+  std::vector< std::array< std::uint32_t, 3 > > q( npoin );
+  for (std::size_t p=0; p<npoin; ++p)
+    for (std::size_t d=0; d<3; ++d)
+      q[p][d] =
+        static_cast< std::uint32_t >( (coord[d][p] - box[d]) * scale + 0.5 );
+  return q;
+}
+
+static std::uint64_t
+interleave( const std::array< std::uint32_t, 3 >& x )
+// *****************************************************************************
+// Interleave the bits of three integer coordinates into a single key
+//! \param[in] x Integer coordinates, each using SFCBits bits
+//! \return Key with the bits of x interleaved, the first coordinate's bit
+//!   most significant
+// *****************************************************************************
+{
+  std::uint64_t key = 0;
+  for (int b=SFCBits-1; b>=0; --b)
+    for (std::size_t d=0; d<3; ++d)
+      key = (key << 1) | ((x[d] >> b) & 1U);
+  return key;
+}
+
+static void
+hilbertTranspose( std::array< std::uint32_t, 3 >& x )
+// *****************************************************************************
+// Transform integer coordinates to the transposed Hilbert index
+//! \param[in,out] x Integer coordinates on input, transposed Hilbert index on
+//!   output, whose interleaved bits give the Hilbert key
+//! \see J. Skilling, Programming the Hilbert curve, AIP Conf. Proc. 707, 381
+//!   (2004)
+// *****************************************************************************
+{
+  const std::uint32_t m = 1U << (SFCBits-1);
+  // Inverse undo excess work
+  for (auto q=m; q>1; q>>=1) {
+    auto p = q - 1;
+    for (std::size_t d=0; d<3; ++d)
+      if (x[d] & q)
+        x[0] ^= p;
+      else {
+        auto t = (x[0] ^ x[d]) & p;
+        x[0] ^= t;
+        x[d] ^= t;
+      }
+  }
+  // Gray encode
+  x[1] ^= x[0];
+  x[2] ^= x[1];
+  std::uint32_t t = 0;
+  for (auto q=m; q>1; q>>=1) if (x[2] & q) t ^= q - 1;
+  for (auto& c : x) c ^= t;
+}
+
+static std::vector< std::size_t >
+sortByKey( const std::vector< std::uint64_t >& key )
+// *****************************************************************************
+// Construct old->new map ordering points by their space-filling curve key
+//! \param[in] key Space-filling curve key of each point
+//! \return Mapping created by renumbering (reordering): old->new
+// *****************************************************************************
+{
+  std::vector< std::size_t > order( key.size() );
+  for (std::size_t p=0; p<order.size(); ++p) order[p] = p;
+  std::stable_sort( begin(order), end(order),
+    [&]( std::size_t a, std::size_t b ){ return key[a] < key[b]; } );
+  std::vector< std::size_t > map( key.size() );
+  for (std::size_t i=0; i<order.size(); ++i) map[ order[i] ] = i;
+  return map;
+}
+
+std::vector< std::size_t >
+renumberMorton( const std::array< std::vector< real >, 3 >& coord )
+// *****************************************************************************
+//  Reorder mesh points along the Morton (Z-order) space-filling curve
+//! \param[in] coord Point coordinates
+//! \return Mapping created by renumbering (reordering): old->new
+//! \details Points are sorted by the key obtained by interleaving the bits of
+//!   their coordinates quantized on a uniform grid over their bounding box.
+//!   Points closer than the grid spacing keep their original relative order.
+// *****************************************************************************
+{
+  auto q = quantize( coord, boundingBox(coord) );
+  std::vector< std::uint64_t > key( q.size() );
+  for (std::size_t p=0; p<q.size(); ++p) key[p] = interleave( q[p] );
+  return sortByKey( key );
+}
+
+std::vector< std::uint64_t >
+hilbertKeys( const std::array< std::vector< real >, 3 >& coord,
+             const std::array< real, 6 >& box )
+// *****************************************************************************
+//  Compute Hilbert space-filling curve keys of points within a bounding box
+//! \param[in] coord Point coordinates
+//! \param[in] box Bounding box containing all points: minimum x, y, z,
+//!   followed by maximum x, y, z
+//! \return Hilbert key of each point, obtained on a uniform grid over box
+//! \details Passing the same (e.g., global) bounding box on all callers
+//!   yields keys consistent across distributed parts of a point set.
+// *****************************************************************************
+{
+  auto q = quantize( coord, box );
+  std::vector< std::uint64_t > key( q.size() );
+  for (std::size_t p=0; p<q.size(); ++p) {
+    hilbertTranspose( q[p] );
+    key[p] = interleave( q[p] );
+  }
+  return key;
+}
+
+std::vector< std::size_t >
+renumberHilbert( const std::array< std::vector< real >, 3 >& coord )
+// *****************************************************************************
+//  Reorder mesh points along the Hilbert space-filling curve
+//! \param[in] coord Point coordinates
+//! \return Mapping created by renumbering (reordering): old->new
+//! \details Same as renumberMorton() but using the Hilbert curve, which,
+//!   unlike the Morton curve, has no jumps between consecutive grid cells, and
+//!   thus generally yields better locality.
+// *****************************************************************************
+{
+  return sortByKey( hilbertKeys( coord, boundingBox(coord) ) );
+}
+
+std::vector< std::size_t >
+reorderElements( std::vector< std::size_t >& inpoel, std::size_t nnpe )
+// *****************************************************************************
+//  Reorder elements consistent with the order of their nodes
+//! \param[in,out] inpoel Inteconnectivity of points and elements
+//! \param[in] nnpe Number of nodes per element
+//! \return Mapping created by reordering elements: old->new element ids
+//! \details Elements are sorted by their lowest and then by their highest node
+//!   id, so that element loops gathering and scattering nodal data traverse
+//!   node data in the order it is laid out in memory. The order of nodes
+//!   within elements (orientation) is not changed.
+// *****************************************************************************
+{
+  Assert( nnpe > 0, "Attempt to call reorderElements() with zero nodes per "
+          "element" );
+  Assert( inpoel.size() % nnpe == 0, "Size of inpoel must be divisible by "
+          "the number of nodes per element" );
+
+  auto nelem = inpoel.size() / nnpe;
+
+  // Find lowest and highest node id of all elements
+  std::vector< std::pair< std::size_t, std::size_t > > key( nelem );
+  for (std::size_t e=0; e<nelem; ++e) {
+    auto mm = std::minmax_element( begin(inpoel) + e*nnpe,
+                                   begin(inpoel) + (e+1)*nnpe );
+    key[e] = { *mm.first, *mm.second };
+  }
+
+  // Sort element ids by key, keeping elements with equal keys in order
+  std::vector< std::size_t > order( nelem );
+  for (std::size_t e=0; e<nelem; ++e) order[e] = e;
+  std::stable_sort( begin(order), end(order),
+    [&]( std::size_t a, std::size_t b ){ return key[a] < key[b]; } );
+
+  // Apply new element order and construct old->new element id map
+  std::vector< std::size_t > newinpoel( inpoel.size() );
+  std::vector< std::size_t > map( nelem );
+  for (std::size_t i=0; i<nelem; ++i) {
+    auto e = order[i];
+    map[e] = i;
+    std::copy( begin(inpoel) + e*nnpe, begin(inpoel) + (e+1)*nnpe,
+               begin(newinpoel) + i*nnpe );
+  }
+  inpoel = std::move( newinpoel );
+
+  return map;
+}
+
 std::unordered_map< std::size_t, std::size_t >
 assignLid( const std::vector< std::size_t >& gid )
 // *****************************************************************************
@@ -18,6 +18,7 @@
 #include <unordered_map>
 #include <map>
 #include <cstddef>
+#include <cstdint>
 #include <array>
 
 #include "Types.hpp"
@@ -61,6 +62,28 @@ std::vector< std::size_t >
 renumber( const std::pair< std::vector< std::size_t >,
                            std::vector< std::size_t > >& psup );
 
+//! Reorder mesh points with the reverse Cuthill-McKee algorithm
+std::vector< std::size_t >
+renumberRCM( const std::pair< std::vector< std::size_t >,
+                              std::vector< std::size_t > >& psup );
+
+//! Reorder mesh points along the Morton (Z-order) space-filling curve
+std::vector< std::size_t >
+renumberMorton( const std::array< std::vector< real >, 3 >& coord );
+
+//! Reorder mesh points along the Hilbert space-filling curve
+std::vector< std::size_t >
+renumberHilbert( const std::array< std::vector< real >, 3 >& coord );
+
+//! Compute Hilbert space-filling curve keys of points within a bounding box
+std::vector< std::uint64_t >
+hilbertKeys( const std::array< std::vector< real >, 3 >& coord,
+             const std::array< real, 6 >& box );
+
+//! Reorder elements consistent with the order of their nodes
+std::vector< std::size_t >
+reorderElements( std::vector< std::size_t >& inpoel, std::size_t nnpe );
+
 //! Assign local ids to global ids
 std::unordered_map< std::size_t, std::size_t >
 assignLid( const std::vector< std::size_t >& gid );
@@ -0,0 +1,155 @@
+// *****************************************************************************
+/*!
+  \file      src/Mesh/Slice.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Functions extracting slices and iso-surfaces of tetrahedron meshes
+  \details   Functions extracting the triangulated zero level set of a
+    piecewise linear nodal field on tetrahedron meshes, e.g., planar slices
+    and iso-surfaces, and interpolating nodal fields onto them.
+*/
+// *****************************************************************************
+
+#include <cmath>
+#include <unordered_map>
+
+#include "Exception.hpp"
+#include "Vector.hpp"
+#include "Slice.hpp"
+
+namespace tk {
+
+Slice
+slice( const std::vector< std::size_t >& inpoel,
+       const UnsMesh::Coords& coord,
+       const std::vector< tk::real >& d )
+// *****************************************************************************
+//  Extract the triangulated zero level set of a nodal field
+//! \param[in] inpoel Mesh element connectivity
+//! \param[in] coord Mesh node coordinates
+//! \param[in] d Nodal field whose zero level set to extract, e.g., signed
+//!   distance from a plane, see planedist(), or a field minus its iso-value
+//! \return Triangulated zero level set
+//! \details The level set of the linear interpolant of d intersects a
+//!   tetrahedron if d changes sign across its nodes, nodes with d = 0 counted
+//!   as positive. The intersection is a triangle if a single node is on one
+//!   side and a quadrilateral, split into two triangles, if two are. Slice
+//!   nodes on edges shared by tetrahedra are only stored once. The triangles
+//!   are oriented so that their normals point towards increasing d.
+//! \note If d = 0 in a mesh node, the slice nodes on the edges of that node
+//!   coincide with it and some triangles may be degenerate.
+// *****************************************************************************
+{
+  Assert( inpoel.size() % 4 == 0, "Size of inpoel must be divisible by 4" );
+  Assert( d.size() == coord[0].size(), "Size mismatch" );
+
+  const auto& x = coord[0];
+  const auto& y = coord[1];
+  const auto& z = coord[2];
+
+  Slice s;
+  std::unordered_map< UnsMesh::Edge, std::size_t,
+                      UnsMesh::Hash<2>, UnsMesh::Eq<2> > id;
+
+  // Return slice node id on edge (a,b), a on the positive side
+  auto node = [&]( std::size_t a, std::size_t b ){
+    auto e = id.emplace( UnsMesh::Edge{{ a, b }}, id.size() );
+    if (e.second) {
+      auto w = d[b] / (d[b] - d[a]);
+      s.edge.push_back( a );
+      s.edge.push_back( b );
+      s.weight.push_back( w );
+      s.coord[0].push_back( w*x[a] + (1.0-w)*x[b] );
+      s.coord[1].push_back( w*y[a] + (1.0-w)*y[b] );
+      s.coord[2].push_back( w*z[a] + (1.0-w)*z[b] );
+    }
+    return e.first->second;
+  };
+
+  // Add triangle, oriented towards positive node p
+  auto tri = [&]( std::size_t A, std::size_t B, std::size_t C, std::size_t p ){
+    const auto& c = s.coord;
+    auto n = cross( { c[0][B]-c[0][A], c[1][B]-c[1][A], c[2][B]-c[2][A] },
+                    { c[0][C]-c[0][A], c[1][C]-c[1][A], c[2][C]-c[2][A] } );
+    if (dot( n, { x[p]-c[0][A], y[p]-c[1][A], z[p]-c[2][A] } ) < 0.0)
+      std::swap( B, C );
+    s.triinpoel.push_back( A );
+    s.triinpoel.push_back( B );
+    s.triinpoel.push_back( C );
+  };
+
+  for (std::size_t e=0; e<inpoel.size()/4; ++e) {
+    std::array< std::size_t, 4 > pos, neg;
+    std::size_t np = 0, nn = 0;
+    for (std::size_t k=0; k<4; ++k) {
+      auto i = inpoel[e*4+k];
+      if (d[i] >= 0.0) pos[np++] = i; else neg[nn++] = i;
+    }
+    if (np == 1) {
+      auto p = pos[0];
+      tri( node(p,neg[0]), node(p,neg[1]), node(p,neg[2]), p );
+    } else if (np == 3) {
+      auto n = neg[0];
+      tri( node(pos[0],n), node(pos[1],n), node(pos[2],n), pos[0] );
+    } else if (np == 2) {
+      // Quadrilateral (p0,n0), (p0,n1), (p1,n1), (p1,n0)
+      auto A = node( pos[0], neg[0] );
+      auto B = node( pos[0], neg[1] );
+      auto C = node( pos[1], neg[1] );
+      auto D = node( pos[1], neg[0] );
+      tri( A, B, C, pos[0] );
+      tri( A, C, D, pos[0] );
+    }
+  }
+
+  return s;
+}
+
+std::vector< tk::real >
+planedist( const UnsMesh::Coords& coord,
+           const std::array< tk::real, 3 >& p,
+           const std::array< tk::real, 3 >& n )
+// *****************************************************************************
+//  Compute the signed distance of mesh nodes from a plane
+//! \param[in] coord Mesh node coordinates
+//! \param[in] p Coordinates of a point of the plane
+//! \param[in] n Normal vector of the plane, need not be of unit length
+//! \return Signed distance of the mesh nodes from the plane, positive on the
+//!   side n points to
+// *****************************************************************************
+{
+  auto l = length( n );
+  Assert( l > 0.0, "Plane normal must be nonzero" );
+
+  const auto& x = coord[0];
+  const auto& y = coord[1];
+  const auto& z = coord[2];
+
+  std::vector< tk::real > d( x.size() );
+  for (std::size_t i=0; i<x.size(); ++i)
+    d[i] = ( n[0]*(x[i]-p[0]) + n[1]*(y[i]-p[1]) + n[2]*(z[i]-p[2]) ) / l;
+
+  return d;
+}
+
+std::vector< tk::real >
+interpolate( const Slice& s, const std::vector< tk::real >& f )
+// *****************************************************************************
+//  Interpolate a nodal field onto the nodes of a slice
+//! \param[in] s Slice to interpolate onto, see slice()
+//! \param[in] f Nodal field on the mesh the slice is extracted from
+//! \return Field f interpolated onto the slice nodes
+// *****************************************************************************
+{
+  std::vector< tk::real > v( s.weight.size() );
+  for (std::size_t i=0; i<v.size(); ++i) {
+    const auto w = s.weight[i];
+    v[i] = w*f[ s.edge[i*2+0] ] + (1.0-w)*f[ s.edge[i*2+1] ];
+  }
+
+  return v;
+}
+
+} // tk::
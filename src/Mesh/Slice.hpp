@@ -0,0 +1,60 @@
+// *****************************************************************************
+/*!
+  \file      src/Mesh/Slice.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Functions extracting slices and iso-surfaces of tetrahedron meshes
+  \details   Functions extracting the triangulated zero level set of a
+    piecewise linear nodal field on tetrahedron meshes, e.g., planar slices
+    and iso-surfaces, and interpolating nodal fields onto them.
+*/
+// *****************************************************************************
+#ifndef Slice_h
+#define Slice_h
+
+#include <array>
+#include <vector>
+
+#include "Types.hpp"
+#include "UnsMesh.hpp"
+
+namespace tk {
+
+//! Triangulated zero level set of a nodal field on a tetrahedron mesh
+//! \details Each slice node is the intersection of the level set with a
+//!   mesh edge, given by the two end points of the edge and the weight of the
+//!   first one. Nodal fields are interpolated onto the slice nodes linearly
+//!   along the edges, see interpolate().
+struct Slice {
+  //! Triangle connectivity with slice node ids
+  std::vector< std::size_t > triinpoel;
+  //! Coordinates of the slice nodes
+  UnsMesh::Coords coord;
+  //! Mesh node ids of the end points of the edges of the slice nodes, two
+  //! per slice node
+  std::vector< std::size_t > edge;
+  //! Interpolation weights of the first end points of the edges
+  std::vector< tk::real > weight;
+};
+
+//! Extract the triangulated zero level set of a nodal field
+Slice
+slice( const std::vector< std::size_t >& inpoel,
+       const UnsMesh::Coords& coord,
+       const std::vector< tk::real >& d );
+
+//! Compute the signed distance of mesh nodes from a plane
+std::vector< tk::real >
+planedist( const UnsMesh::Coords& coord,
+           const std::array< tk::real, 3 >& p,
+           const std::array< tk::real, 3 >& n );
+
+//! Interpolate a nodal field onto the nodes of a slice
+std::vector< tk::real >
+interpolate( const Slice& s, const std::vector< tk::real >& f );
+
+} // tk::
+
+#endif // Slice_h
@@ -20,6 +20,7 @@
 #include <map>
 #include <unordered_set>
 #include <unordered_map>
+#include <cstdint>
 
 #include "NoWarning/sip_hash.hpp"
 
@@ -79,12 +80,33 @@ class UnsMesh {
       //! \return Unique hash value for the same array of node IDs
       //! \note The order of the nodes does not matter: the IDs are sorted
       //!   before the hash is computed.
+      //! \note If MESH_FAST_HASH is defined, the (sorted) node IDs are combined
+      //!   by a cheap, non-cryptographic mixing function (the finalizer of
+      //!   SplitMix64) instead of SipHash. Mesh primitive keys are not
+      //!   adversarial, so the cryptographic strength of SipHash is not needed.
       std::size_t operator()( const std::array< std::size_t, N >& p ) const {
+        #if defined MESH_FAST_HASH
+        auto s = p;
+        std::sort( std::begin(s), std::end(s) );
+        std::uint64_t h = N;
+        for (auto i : s) h = mix( h ^ i );
+        return static_cast< std::size_t >( h );
+        #else
         using highwayhash::SipHash;
         Shaper< N > shaper;
         for (std::size_t i=0; i<N; ++i) shaper.sizets[i] = p[i];
         std::sort( std::begin(shaper.sizets), std::end(shaper.sizets) );
         return SipHash( hh_key, shaper.bytes, N*sizeof(std::size_t) );
+        #endif
+      }
+      //! Mix bits of a 64-bit integer (finalizer of SplitMix64)
+      //! \param[in] x Integer whose bits to mix
+      //! \return Integer with bits mixed
+      static std::uint64_t mix( std::uint64_t x ) noexcept {
+        x += 0x9e3779b97f4a7c15ULL;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+        return x ^ (x >> 31);
       }
     };
 
@@ -33,6 +33,8 @@
 #include "FunctionPrototypes.hpp"
 #include "Mesh/CommMap.hpp"
 #include "History.hpp"
+#include "Mesh/BndNodeNormals.hpp"
+#include "ICBoxState.hpp"
 
 namespace inciter {
 
@@ -58,6 +60,34 @@ bnorm( const std::map< int, std::vector< std::size_t > >& bface,
 
 } // cg::
 
+//! \brief Part of the mesh of a chare in which the ALECG right hand side is
+//!   computed
+//! \details ALECG computes its right hand side in two parts: first in the
+//!   entities required to complete the right hand side in chare-boundary
+//!   points, so that it can be sent to fellow chares, then in the rest, while
+//!   the messages are in flight. The two parts of each list are disjoint and
+//!   together cover all entities, so each mesh entity contributes exactly
+//!   once, and the entities of the first part include all at which
+//!   chare-boundary points receive contributions.
+struct RHSPart {
+  std::vector< std::size_t > gpoin;   //!< Points in which to compute gradients
+  std::vector< std::size_t > poin;    //!< Points in which to sum contributions
+  std::vector< std::size_t > edge;    //!< Edge ids in which to compute fluxes
+  std::vector< std::size_t > tri;     //!< Boundary triangles to integrate on
+  //! Pack/Unpack serialize member function
+  //! \param[in,out] p Charm++'s PUP::er serializer object reference
+  void pup( PUP::er& p ) {
+    p | gpoin;
+    p | poin;
+    p | edge;
+    p | tri;
+  }
+  //! \brief Pack/Unpack serialize operator|
+  //! \param[in,out] p Charm++'s PUP::er serializer object reference
+  //! \param[in,out] r RHSPart object reference
+  friend void operator|( PUP::er& p, RHSPart& r ) { r.pup(p); }
+};
+
 //! \brief Partial differential equation base for continuous Galerkin PDEs
 //! \details This class uses runtime polymorphism without client-side
 //!   inheritance: inheritance is confined to the internals of the this class,
@@ -117,18 +147,23 @@ class CGPDE {
     void box( real v, real t, const std::vector< std::size_t >& boxnodes,
               const std::array< std::vector< real >, 3 >& coord,
               tk::Fields& unk,
-              std::unordered_set< std::size_t >& boxnodes_set ) const
-    { self->box( v, t, boxnodes, coord, unk, boxnodes_set ); }
+              ICBoxState& boxstate ) const
+    { self->box( v, t, boxnodes, coord, unk, boxstate ); }
+
+    //! Public interface to computing the primitive variables for ALECG
+    void prim( const std::array< std::vector< real >, 3 >& coord,
+               const tk::Fields& U,
+               tk::Fields& W ) const
+    { self->prim( coord, U, W ); }
 
     //! Public interface to computing the nodal gradients for ALECG
     void grad( const std::array< std::vector< real >, 3 >& coord,
                const std::vector< std::size_t >& inpoel,
                const std::vector< std::size_t >& bndel,
-               const std::vector< std::size_t >& gid,
-               const std::unordered_map< std::size_t, std::size_t >& bid,
-               const tk::Fields& U,
+               const std::vector< std::size_t >& lidbid,
+               const tk::Fields& W,
                tk::Fields& G ) const
-    { self->grad( coord, inpoel, bndel, gid, bid, U, G ); }
+    { self->grad( coord, inpoel, bndel, lidbid, W, G ); }
 
     //! Public interface to computing the right-hand side vector for DiagCG
     void rhs( real t,
@@ -147,8 +182,7 @@ class CGPDE {
       const std::vector< std::size_t >& inpoel,
       const std::vector< std::size_t >& triinpoel,
       const std::vector< std::size_t >& gid,
-      const std::unordered_map< std::size_t, std::size_t >& bid,
-      const std::unordered_map< std::size_t, std::size_t >& lid,
+      const std::vector< std::size_t >& bidlid,
       const std::vector< real >& dfn,
       const std::pair< std::vector< std::size_t >,
                        std::vector< std::size_t > >& psup,
@@ -156,14 +190,29 @@ class CGPDE {
                        std::vector< std::size_t > >& esup,
       const std::vector< int >& symbctri,
       const std::vector< real >& vol,
-      const std::vector< std::size_t >& edgenode,
-      const std::vector< std::size_t >& edgeid,
+      const std::vector< tk::lid_t >& edgenode,
+      const std::vector< tk::lid_t >& edgeid,
       const tk::Fields& G,
       const tk::Fields& U,
+      const tk::Fields& W,
       const std::vector< real >& tp,
+      const RHSPart& part,
+      bool frozen,
+      tk::ReducedFields& Grad,
+      std::vector< real >& dflux,
       tk::Fields& R ) const
-    { self->rhs( t, coord, inpoel, triinpoel, gid, bid, lid, dfn, psup, esup,
-                 symbctri, vol, edgenode, edgeid, G, U, tp, R ); }
+    { self->rhs( t, coord, inpoel, triinpoel, gid, bidlid, dfn, psup, esup,
+                 symbctri, vol, edgenode, edgeid, G, U, W, tp, part, frozen,
+                 Grad, dflux, R ); }
+
+    //! \brief Public interface to computing the first-order domain-edge
+    //!   right-hand side on a coarse (agglomerated) multigrid level for ALECG
+    void coarserhs( const std::array< std::vector< real >, 3 >& coord,
+                    const std::vector< tk::lid_t >& edgenode,
+                    const std::vector< real >& dfn,
+                    const tk::Fields& U,
+                    tk::Fields& R ) const
+    { self->coarserhs( coord, edgenode, dfn, U, R ); }
 
     //! Public interface for computing the minimum time step size
     real dt( const std::array< std::vector< real >, 3 >& coord,
@@ -189,25 +238,31 @@ class CGPDE {
            const std::array< std::vector< real >, 3 >& coord ) const
     { return self->dirbc( t, deltat, tp, dtp, sides, coord ); }
 
+    //! \brief Public interface for evaluating the increments of Dirichlet
+    //!   boundary conditions at given nodes for all components in a PDE system
+    void
+    dirbcinc( real t,
+              real deltat,
+              const std::vector< real >& tp,
+              const std::vector< real >& dtp,
+              const std::vector< std::pair< std::size_t, std::size_t > >& nodes,
+              const std::array< std::vector< real >, 3 >& coord,
+              std::vector< real >& inc ) const
+    { self->dirbcinc( t, deltat, tp, dtp, nodes, coord, inc ); }
+
     //! Public interface to set symmetry boundary conditions at nodes
     void
     symbc( tk::Fields& U,
            const std::array< std::vector< real >, 3 >& coord,
-           const std::unordered_map< int,
-                   std::unordered_map< std::size_t,
-                     std::array< real, 4 > > >& bnorm,
-           const std::unordered_set< std::size_t >& nodes ) const
-    { self->symbc( U, coord, bnorm, nodes ); }
+           const tk::BndNodeNormals& bn ) const
+    { self->symbc( U, coord, bn ); }
 
     //! Public interface to set farfield boundary conditions at nodes
     void
     farfieldbc( tk::Fields& U,
                 const std::array< std::vector< real >, 3 >& coord,
-                const std::unordered_map< int,
-                        std::unordered_map< std::size_t,
-                          std::array< real, 4 > > >& bnorm,
-                const std::unordered_set< std::size_t >& nodes ) const
-    { self->farfieldbc( U, coord, bnorm, nodes ); }
+                const tk::BndNodeNormals& bn ) const
+    { self->farfieldbc( U, coord, bn ); }
 
     //! Public interface to returning field output labels
     std::vector< std::string > fieldNames() const { return self->fieldNames(); }
@@ -228,13 +283,13 @@ class CGPDE {
       std::size_t nunk,
       const std::array< std::vector< real >, 3 >& coord,
       const std::vector< real >& v,
-      tk::Fields& U ) const
+      const tk::Fields& U ) const
     { return self->fieldOutput( t, V, nunk, coord, v, U ); }
 
     //! Public interface to returning surface field output
     std::vector< std::vector< real > >
     surfOutput( const std::map< int, std::vector< std::size_t > >& bnd,
-                tk::Fields& U ) const
+                const tk::Fields& U ) const
     { return self->surfOutput( bnd, U ); }
 
     //! Public interface to returning time history output
@@ -275,12 +330,14 @@ class CGPDE {
         real, real, const std::vector< std::size_t >&,
         const std::array< std::vector< real >, 3 >&,
         tk::Fields& unk,
-        std::unordered_set< std::size_t >& boxnodes_set ) const = 0;
+        ICBoxState& boxstate ) const = 0;
+      virtual void prim( const std::array< std::vector< real >, 3 >&,
+                         const tk::Fields&,
+                         tk::Fields& ) const = 0;
       virtual void grad( const std::array< std::vector< real >, 3 >&,
                          const std::vector< std::size_t >&,
                          const std::vector< std::size_t >&,
                          const std::vector< std::size_t >&,
-                         const std::unordered_map< std::size_t, std::size_t >&,
                          const tk::Fields&,
                          tk::Fields& ) const = 0;
       virtual void rhs( real,
@@ -296,8 +353,7 @@ class CGPDE {
         const std::vector< std::size_t >&,
         const std::vector< std::size_t >&,
         const std::vector< std::size_t >&,
-        const std::unordered_map< std::size_t, std::size_t >&,
-        const std::unordered_map< std::size_t, std::size_t >&,
+        const std::vector< std::size_t >&,
         const std::vector< real >&,
         const std::pair< std::vector< std::size_t >,
                          std::vector< std::size_t > >&,
@@ -309,8 +365,18 @@ class CGPDE {
         const std::vector< std::size_t >&,
         const tk::Fields&,
         const tk::Fields&,
+        const tk::Fields&,
         const std::vector< real >&,
+        const RHSPart&,
+        bool,
+        tk::ReducedFields&,
+        std::vector< real >&,
         tk::Fields& ) const = 0;
+      virtual void coarserhs( const std::array< std::vector< real >, 3 >&,
+                              const std::vector< std::size_t >&,
+                              const std::vector< real >&,
+                              const tk::Fields&,
+                              tk::Fields& ) const = 0;
       virtual real dt( const std::array< std::vector< real >, 3 >&,
                        const std::vector< std::size_t >&,
                        const tk::Fields& ) const = 0;
@@ -325,20 +391,22 @@ class CGPDE {
              const std::vector< real >&,
              const std::pair< const int, std::vector< std::size_t > >&,
              const std::array< std::vector< real >, 3 >& ) const = 0;
+      virtual void dirbcinc(
+        real,
+        real,
+        const std::vector< real >&,
+        const std::vector< real >&,
+        const std::vector< std::pair< std::size_t, std::size_t > >&,
+        const std::array< std::vector< real >, 3 >&,
+        std::vector< real >& ) const = 0;
       virtual void symbc(
         tk::Fields& U,
         const std::array< std::vector< real >, 3 >&,
-        const std::unordered_map< int,
-                std::unordered_map< std::size_t,
-                  std::array< real, 4 > > >&,
-        const std::unordered_set< std::size_t >& ) const = 0;
+        const tk::BndNodeNormals& ) const = 0;
       virtual void farfieldbc(
         tk::Fields&,
         const std::array< std::vector< real >, 3 >&,
-        const std::unordered_map< int,
-                std::unordered_map< std::size_t,
-                  std::array< real, 4 > > >&,
-        const std::unordered_set< std::size_t >& ) const = 0;
+        const tk::BndNodeNormals& ) const = 0;
       virtual std::vector< std::string > fieldNames() const = 0;
       virtual std::vector< std::string > surfNames() const = 0;
       virtual std::vector< std::string > histNames() const = 0;
@@ -349,10 +417,10 @@ class CGPDE {
         std::size_t,
         const std::array< std::vector< real >, 3 >&,
         const std::vector< real >&,
-        tk::Fields& ) const = 0;
+        const tk::Fields& ) const = 0;
       virtual std::vector< std::vector< real > > surfOutput(
         const std::map< int, std::vector< std::size_t > >&,
-        tk::Fields& ) const = 0;
+        const tk::Fields& ) const = 0;
       virtual std::vector< std::vector< real > > histOutput(
         const std::vector< HistData >&,
         const std::vector< std::size_t >&,
@@ -375,16 +443,19 @@ class CGPDE {
       void box( real v, real t, const std::vector< std::size_t >& boxnodes,
                 const std::array< std::vector< real >, 3 >& coord,
                 tk::Fields& unk,
-                std::unordered_set< std::size_t >& boxnodes_set ) const override
-      { data.box( v, t, boxnodes, coord, unk, boxnodes_set ); }
+                ICBoxState& boxstate ) const override
+      { data.box( v, t, boxnodes, coord, unk, boxstate ); }
+      void prim( const std::array< std::vector< real >, 3 >& coord,
+                 const tk::Fields& U,
+                 tk::Fields& W ) const override
+      { data.prim( coord, U, W ); }
       void grad( const std::array< std::vector< real >, 3 >& coord,
                  const std::vector< std::size_t >& inpoel,
                  const std::vector< std::size_t >& bndel,
-                 const std::vector< std::size_t >& gid,
-                 const std::unordered_map< std::size_t, std::size_t >& bid,
-                 const tk::Fields& U,
+                 const std::vector< std::size_t >& lidbid,
+                 const tk::Fields& W,
                  tk::Fields& G ) const override
-      { data.grad( coord, inpoel, bndel, gid, bid, U, G ); }
+      { data.grad( coord, inpoel, bndel, lidbid, W, G ); }
       void rhs( real t,
                 real deltat,
                 const std::array< std::vector< real >, 3 >& coord,
@@ -399,8 +470,7 @@ class CGPDE {
         const std::vector< std::size_t >& inpoel,
         const std::vector< std::size_t >& triinpoel,
         const std::vector< std::size_t >& gid,
-        const std::unordered_map< std::size_t, std::size_t >& bid,
-        const std::unordered_map< std::size_t, std::size_t >& lid,
+        const std::vector< std::size_t >& bidlid,
         const std::vector< real >& dfn,
         const std::pair< std::vector< std::size_t >,
                          std::vector< std::size_t > >& psup,
@@ -408,14 +478,26 @@ class CGPDE {
                          std::vector< std::size_t > >& esup,
         const std::vector< int >& symbctri,
         const std::vector< real >& vol,
-        const std::vector< std::size_t >& edgenode,
-        const std::vector< std::size_t >& edgeid,
+        const std::vector< tk::lid_t >& edgenode,
+        const std::vector< tk::lid_t >& edgeid,
         const tk::Fields& G,
         const tk::Fields& U,
+        const tk::Fields& W,
         const std::vector< real >& tp,
+        const RHSPart& part,
+        bool frozen,
+        tk::ReducedFields& Grad,
+        std::vector< real >& dflux,
         tk::Fields& R ) const override
-      { data.rhs( t, coord, inpoel, triinpoel, gid, bid, lid, dfn, psup, esup,
-                  symbctri, vol, edgenode, edgeid, G, U, tp, R ); }
+      { data.rhs( t, coord, inpoel, triinpoel, gid, bidlid, dfn, psup, esup,
+                  symbctri, vol, edgenode, edgeid, G, U, W, tp, part, frozen,
+                  Grad, dflux, R ); }
+      void coarserhs( const std::array< std::vector< real >, 3 >& coord,
+                      const std::vector< tk::lid_t >& edgenode,
+                      const std::vector< real >& dfn,
+                      const tk::Fields& U,
+                      tk::Fields& R ) const override
+      { data.coarserhs( coord, edgenode, dfn, U, R ); }
       real dt( const std::array< std::vector< real >, 3 >& coord,
                    const std::vector< std::size_t >& inpoel,
                    const tk::Fields& U ) const override
@@ -433,22 +515,25 @@ class CGPDE {
              const std::pair< const int, std::vector< std::size_t > >& sides,
              const std::array< std::vector< real >, 3 >& coord ) const
         override { return data.dirbc( t, deltat, tp, dtp, sides, coord ); }
+      void dirbcinc(
+        real t,
+        real deltat,
+        const std::vector< real >& tp,
+        const std::vector< real >& dtp,
+        const std::vector< std::pair< std::size_t, std::size_t > >& nodes,
+        const std::array< std::vector< real >, 3 >& coord,
+        std::vector< real >& inc ) const override
+      { data.dirbcinc( t, deltat, tp, dtp, nodes, coord, inc ); }
       void symbc(
         tk::Fields& U,
         const std::array< std::vector< real >, 3 >& coord,
-        const std::unordered_map< int,
-                std::unordered_map< std::size_t,
-                  std::array< real, 4 > > >& bnorm,
-        const std::unordered_set< std::size_t >& nodes ) const override
-      { data.symbc( U, coord, bnorm, nodes ); }
+        const tk::BndNodeNormals& bn ) const override
+      { data.symbc( U, coord, bn ); }
       void farfieldbc(
         tk::Fields& U,
         const std::array< std::vector< real >, 3 >& coord,
-        const std::unordered_map< int,
-                std::unordered_map< std::size_t,
-                  std::array< real, 4 > > >& bnorm,
-        const std::unordered_set< std::size_t >& nodes ) const override
-      { data.farfieldbc( U, coord, bnorm, nodes ); }
+        const tk::BndNodeNormals& bn ) const override
+      { data.farfieldbc( U, coord, bn ); }
       std::vector< std::string > fieldNames() const override
       { return data.fieldNames(); }
       std::vector< std::string > surfNames() const override
@@ -463,11 +548,11 @@ class CGPDE {
         std::size_t nunk,
         const std::array< std::vector< real >, 3 >& coord,
         const std::vector< real >& v,
-        tk::Fields& U ) const override
+        const tk::Fields& U ) const override
       { return data.fieldOutput( t, V, nunk, coord, v, U ); }
       std::vector< std::vector< real > > surfOutput(
         const std::map< int, std::vector< std::size_t > >& bnd,
-        tk::Fields& U ) const override
+        const tk::Fields& U ) const override
       { return data.surfOutput( bnd, U ); }
       std::vector< std::vector< real > > histOutput(
         const std::vector< HistData >& h,
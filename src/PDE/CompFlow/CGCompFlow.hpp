@@ -14,6 +14,7 @@
 #define CGCompFlow_h
 
 #include <cmath>
+#include <limits>
 #include <algorithm>
 #include <unordered_set>
 #include <unordered_map>
@@ -27,8 +28,12 @@
 #include "Problem/FieldOutput.hpp"
 #include "Riemann/Rusanov.hpp"
 #include "NodeBC.hpp"
+#include "ICBoxState.hpp"
 #include "EoS/EoS.hpp"
 #include "History.hpp"
+#include "CGPDE.hpp"
+#include "PerfCounter.hpp"
+#include "ISA.hpp"
 
 namespace inciter {
 
@@ -61,7 +66,7 @@ class CompFlow {
     //! \brief Constructor
     //! \param[in] c Equation system index (among multiple systems configured)
     explicit CompFlow( ncomp_t c ) :
-      m_physics(),
+      m_physics( c ),
       m_problem(),
       m_system( c ),
       m_offset( g_inputdeck.get< tag::component >().offset< eq >(c) ),
@@ -73,7 +78,9 @@ class CompFlow {
             g_inputdeck.get< param, eq, tag::farfield_pressure >()[c] : 1.0 ),
       m_fu( g_inputdeck.get< param, eq, tag::farfield_velocity >().size() > c ?
             g_inputdeck.get< param, eq, tag::farfield_velocity >()[c] :
-            std::vector< real >( 3, 0.0 ) )
+            std::vector< real >( 3, 0.0 ) ),
+      m_gamma( g_inputdeck.get< param, eq, tag::gamma >()[c][0] ),
+      m_pstiff( g_inputdeck.get< param, eq, tag::pstiff >()[c][0] )
     {
       Assert( g_inputdeck.get< tag::component >().get< eq >().at(c) == m_ncomp,
        "Number of CompFlow PDE components must be " + std::to_string(m_ncomp) );
@@ -118,7 +125,8 @@ class CompFlow {
     //! \param[in] boxnodes Mesh node ids within user-defined box
     //! \param[in] coord Mesh node coordinates
     //! \param[in,out] unk Array of unknowns
-    //! \param[in,out] boxnodes_set Box nodes that have been set
+    //! \param[in,out] boxstate Box nodes that have been set, and index of
+    //!   box nodes by distance from the points the box IC is initiated from
     //! \details This function sets the fluid density and total specific energy
     //!   within a box initial condition, configured by the user. If the user
     //!   is specified a box where mass is specified, we also assume here that
@@ -135,9 +143,9 @@ class CompFlow {
               const std::vector< std::size_t >& boxnodes,
               const std::array< std::vector< real >, 3 >& coord,
               tk::Fields& unk,
-              std::unordered_set< std::size_t >& boxnodes_set ) const
+              ICBoxState& boxstate ) const
     {
-      if (boxnodes_set.size() == boxnodes.size()) return;
+      if (boxstate.done()) return;
 
       const auto& ic = g_inputdeck.get< tag::param, eq, tag::ic >();
       const auto& icbox = ic.get< tag::box >();
@@ -212,17 +220,13 @@ class CompFlow {
             unk(i,4,m_offset) = re;
           }
         }
-        boxnodes_set.insert( begin(boxnodes), end(boxnodes) );
+        boxstate.setall();
 
       // Initiate type 'linear' assigns the prescribed values to all
       // nodes within a box using linearly expanding sphere within which nodes
       // get assigned their prescribed values.
       } else if (inittype[m_system] == ctr::InitiateType::LINEAR) {
 
-        const auto& x = coord[0];
-        const auto& y = coord[1];
-        const auto& z = coord[2];
-
         // apply box conditions within growing sphere
         tk::real box_extent =
           std::max( icbox.get< tag::xmax >() - icbox.get< tag::xmin >(),
@@ -233,30 +237,34 @@ class CompFlow {
         const auto& iv = initiate.get< tag::velocity >()[ m_system ];
         Assert( p.size() == r.size()*3, "Size mismatch" );
         Assert( p.size() == iv.size()*3, "Size mismatch" );
+        // sort box nodes by distance from the sphere centers once
+        if (!boxstate.indexed( m_system ))
+          boxstate.index( m_system, boxnodes, coord, p );
+        const auto& bid = boxstate.bid( m_system );
         for (std::size_t s=0; s<p.size()/3; ++s) {  // for each sphere
           auto r0t = iv[s]*0.5*t;
           auto r1t = r[s] + iv[s]*t;
           if (r1t > box_extent) // done if initiation front reached box extent
-            boxnodes_set.insert( begin(boxnodes), end(boxnodes) );
-          else
-            for (auto i : boxnodes) {
-              auto d = std::sqrt( (x[i]-p[s*3+0])*(x[i]-p[s*3+0]) +
-                                  (y[i]-p[s*3+1])*(y[i]-p[s*3+1]) +
-                                  (z[i]-p[s*3+2])*(z[i]-p[s*3+2]) );
-              if (d > r0t && d < r1t) {
-                // superimpose on existing velocity field
-                const auto u = unk(i,1,m_offset)/unk(i,0,m_offset),
-                           v = unk(i,2,m_offset)/unk(i,0,m_offset),
-                           w = unk(i,3,m_offset)/unk(i,0,m_offset);
-                const auto ke = 0.5*(u*u + v*v + w*w);
-                unk(i,0,m_offset) = rho;
-                unk(i,1,m_offset) = rho * u;
-                unk(i,2,m_offset) = rho * v;
-                unk(i,3,m_offset) = rho * w;
-                unk(i,4,m_offset) = rho * (spi + ke);
-                boxnodes_set.insert( i );       // mark node as set
-              }
+            boxstate.setall();
+          else {
+            // box nodes within the shell between r0t and r1t are contiguous
+            const auto [sb,se] = boxstate.shell( m_system, s, r0t, r1t );
+            for (auto j=sb; j<se; ++j) {
+              auto b = bid[j];
+              auto i = boxnodes[b];
+              // superimpose on existing velocity field
+              const auto u = unk(i,1,m_offset)/unk(i,0,m_offset),
+                         v = unk(i,2,m_offset)/unk(i,0,m_offset),
+                         w = unk(i,3,m_offset)/unk(i,0,m_offset);
+              const auto ke = 0.5*(u*u + v*v + w*w);
+              unk(i,0,m_offset) = rho;
+              unk(i,1,m_offset) = rho * u;
+              unk(i,2,m_offset) = rho * v;
+              unk(i,3,m_offset) = rho * w;
+              unk(i,4,m_offset) = rho * (spi + ke);
+              boxstate.set( b );                // mark node as set
             }
+          }
         }
 
       } else Throw( "IC box initiate type not implemented" );
@@ -303,7 +311,9 @@ class CompFlow {
       const auto& y = coord[1];
       const auto& z = coord[2];
 
-      // 1st stage: update element values from node values (gather-add)
+      // Both stages in a single pass over the elements: the element values
+      // after the 1st stage only depend on the nodes of the same element, so
+      // the element geometry is computed once per element for both stages.
       for (std::size_t e=0; e<inpoel.size()/4; ++e) {
         // access node IDs
         const std::array< std::size_t, 4 >
@@ -324,6 +334,7 @@ class CompFlow {
         for (std::size_t i=0; i<3; ++i)
           grad[0][i] = -grad[1][i]-grad[2][i]-grad[3][i];
 
+        // 1st stage: update element values from node values (gather-add)
         // access solution at element nodes
         std::array< std::array< real, 4 >, m_ncomp > u;
         for (ncomp_t c=0; c<m_ncomp; ++c) u[c] = U.extract( c, m_offset, N );
@@ -336,31 +347,30 @@ class CompFlow {
             u[1][a] = u[2][a] = u[3][a] = 0.0;
           }
 
-        // access solution at elements
-        std::array< const real*, m_ncomp > ue;
-        for (ncomp_t c=0; c<m_ncomp; ++c) ue[c] = Ue.cptr( c, m_offset );
+        // access solution at element
+        auto uv = Ue.uview( e, m_offset );
 
         // pressure
-        std::array< real, 4 > p;
+        std::array< real, 4 > pn;
         for (std::size_t a=0; a<4; ++a)
-          p[a] = eos_pressure< eq >
-                   ( m_system, u[0][a], u[1][a]/u[0][a], u[2][a]/u[0][a],
-                     u[3][a]/u[0][a], u[4][a] );
+          pn[a] = eos_pressure< eq >
+                    ( m_system, u[0][a], u[1][a]/u[0][a], u[2][a]/u[0][a],
+                      u[3][a]/u[0][a], u[4][a] );
 
         // sum flux contributions to element
-        real d = deltat/2.0;
+        real dh = deltat/2.0;
         for (std::size_t j=0; j<3; ++j)
           for (std::size_t a=0; a<4; ++a) {
             // mass: advection
-            Ue.var(ue[0],e) -= d * grad[a][j] * u[j+1][a];
+            uv[0] -= dh * grad[a][j] * u[j+1][a];
             // momentum: advection
             for (std::size_t i=0; i<3; ++i)
-              Ue.var(ue[i+1],e) -= d * grad[a][j] * u[j+1][a]*u[i+1][a]/u[0][a];
+              uv[i+1] -= dh * grad[a][j] * u[j+1][a]*u[i+1][a]/u[0][a];
             // momentum: pressure
-            Ue.var(ue[j+1],e) -= d * grad[a][j] * p[a];
+            uv[j+1] -= dh * grad[a][j] * pn[a];
             // energy: advection and pressure
-            Ue.var(ue[4],e) -= d * grad[a][j] *
-                              (u[4][a] + p[a]) * u[j+1][a]/u[0][a];
+            uv[4] -= dh * grad[a][j] *
+                              (u[4][a] + pn[a]) * u[j+1][a]/u[0][a];
           }
 
         // add (optional) source to all equations
@@ -369,37 +379,15 @@ class CompFlow {
           Problem::src( m_system, x[N[a]], y[N[a]], z[N[a]], t,
                         s[0], s[1], s[2], s[3], s[4] );
           for (std::size_t c=0; c<m_ncomp; ++c)
-            Ue.var(ue[c],e) += d/4.0 * s[c];
+            uv[c] += dh/4.0 * s[c];
         }
-      }
-
-      // 2nd stage: form rhs from element values (scatter-add)
-      for (std::size_t e=0; e<inpoel.size()/4; ++e) {
-        // access node IDs
-        const std::array< std::size_t, 4 >
-          N{{ inpoel[e*4+0], inpoel[e*4+1], inpoel[e*4+2], inpoel[e*4+3] }};
-        // compute element Jacobi determinant
-        const std::array< real, 3 >
-          ba{{ x[N[1]]-x[N[0]], y[N[1]]-y[N[0]], z[N[1]]-z[N[0]] }},
-          ca{{ x[N[2]]-x[N[0]], y[N[2]]-y[N[0]], z[N[2]]-z[N[0]] }},
-          da{{ x[N[3]]-x[N[0]], y[N[3]]-y[N[0]], z[N[3]]-z[N[0]] }};
-        const auto J = tk::triple( ba, ca, da );        // J = 6V
-        Assert( J > 0, "Element Jacobian non-positive" );
-
-        // shape function derivatives, nnode*ndim [4][3]
-        std::array< std::array< real, 3 >, 4 > grad;
-        grad[1] = tk::crossdiv( ca, da, J );
-        grad[2] = tk::crossdiv( da, ba, J );
-        grad[3] = tk::crossdiv( ba, ca, J );
-        for (std::size_t i=0; i<3; ++i)
-          grad[0][i] = -grad[1][i]-grad[2][i]-grad[3][i];
 
+        // 2nd stage: form rhs from element values (scatter-add)
         // access solution at elements
         std::array< real, m_ncomp > ue;
         for (ncomp_t c=0; c<m_ncomp; ++c) ue[c] = Ue( e, c, m_offset );
-        // access pointer to right hand side at component and offset
-        std::array< const real*, m_ncomp > r;
-        for (ncomp_t c=0; c<m_ncomp; ++c) r[c] = R.cptr( c, m_offset );
+        // access right hand side at offset
+        auto r = R.sview( m_offset );
 
         // pressure
         auto p = eos_pressure< eq >
@@ -411,14 +399,14 @@ class CompFlow {
         for (std::size_t j=0; j<3; ++j)
           for (std::size_t a=0; a<4; ++a) {
             // mass: advection
-            R.var(r[0],N[a]) += d * grad[a][j] * ue[j+1];
+            r(N[a],0) += d * grad[a][j] * ue[j+1];
             // momentum: advection
             for (std::size_t i=0; i<3; ++i)
-              R.var(r[i+1],N[a]) += d * grad[a][j] * ue[j+1]*ue[i+1]/ue[0];
+              r(N[a],i+1) += d * grad[a][j] * ue[j+1]*ue[i+1]/ue[0];
             // momentum: pressure
-            R.var(r[j+1],N[a]) += d * grad[a][j] * p;
+            r(N[a],j+1) += d * grad[a][j] * p;
             // energy: advection and pressure
-            R.var(r[4],N[a]) += d * grad[a][j] * (ue[4] + p) * ue[j+1]/ue[0];
+            r(N[a],4) += d * grad[a][j] * (ue[4] + p) * ue[j+1]/ue[0];
           }
 
         // add (optional) source to all equations
@@ -430,7 +418,7 @@ class CompFlow {
                       s[0], s[1], s[2], s[3], s[4] );
         for (std::size_t c=0; c<m_ncomp; ++c)
           for (std::size_t a=0; a<4; ++a)
-            R.var(r[c],N[a]) += d/4.0 * s[c];
+            r(N[a],c) += d/4.0 * s[c];
       }
 //         // add viscous stress contribution to momentum and energy rhs
 //         m_physics.viscousRhs( deltat, J, N, grad, u, r, R );
@@ -438,25 +426,69 @@ class CompFlow {
 //         m_physics.conductRhs( deltat, J, N, grad, u, r, R );
     }
 
+    //! Compute primitive variables for ALECG
+    //! \param[in] coord Mesh node coordinates
+    //! \param[in] U Solution vector at recent time step
+    //! \param[in,out] W Primitive variables (density, velocity, specific
+    //!   internal energy) in mesh points, with stagnation BCs applied,
+    //!   (re)allocated here if its size is not yet right
+    //! \details The primitive variables are computed once per stage, so that
+    //!   the gradient and the edge flux computations reuse them instead of
+    //!   dividing by the density (and testing for stagnation points) at every
+    //!   element and edge-end point.
+    void prim( const std::array< std::vector< real >, 3 >& coord,
+               const tk::Fields& U,
+               tk::Fields& W ) const
+    {
+      Assert( U.nunk() == coord[0].size(), "Number of unknowns in solution "
+              "vector at recent time step incorrect" );
+
+      if (W.nunk() != U.nunk() || W.nprop() != m_ncomp)
+        W = tk::Fields( U.nunk(), m_ncomp );
+
+      // access node cooordinates
+      const auto& x = coord[0];
+      const auto& y = coord[1];
+      const auto& z = coord[2];
+
+      // race-free, since each point only writes its own primitive variables
+      const auto npoin = static_cast< std::ptrdiff_t >( U.nunk() );
+      #pragma omp parallel for schedule(static)
+      for (std::ptrdiff_t ip=0; ip<npoin; ++ip) {
+        auto p = static_cast< std::size_t >( ip );
+        real r = U(p,0,m_offset);
+        real u = U(p,1,m_offset) / r;
+        real v = U(p,2,m_offset) / r;
+        real w = U(p,3,m_offset) / r;
+        W(p,0,0) = r;
+        W(p,4,0) = U(p,4,m_offset) / r - 0.5*(u*u + v*v + w*w);
+        // apply stagnation BCs to primitive variables
+        if ( !skipPoint(x[p],y[p],z[p]) && stagPoint(x[p],y[p],z[p]) )
+          u = v = w = 0.0;
+        W(p,1,0) = u;
+        W(p,2,0) = v;
+        W(p,3,0) = w;
+      }
+    }
+
     //! Compute nodal gradients of primitive variables for ALECG along boundary
     //! \param[in] coord Mesh node coordinates
     //! \param[in] inpoel Mesh element connectivity
     //! \param[in] bndel List of elements contributing to chare-boundary nodes
-    //! \param[in] gid Local->global node id map
-    //! \param[in] bid Local chare-boundary node ids (value) associated to
-    //!    global node ids (key)
-    //! \param[in] U Solution vector at recent time step
+    //! \param[in] lidbid Chare-boundary node ids associated to local node ids,
+    //!   std::numeric_limits< std::size_t >::max() for nodes not on the
+    //!   chare boundary
+    //! \param[in] W Primitive variables at recent time step, see prim()
     //! \param[in,out] G Nodal gradients of primitive variables
     void grad( const std::array< std::vector< real >, 3 >& coord,
                const std::vector< std::size_t >& inpoel,
                const std::vector< std::size_t >& bndel,
-               const std::vector< std::size_t >& gid,
-               const std::unordered_map< std::size_t, std::size_t >& bid,
-               const tk::Fields& U,
+               const std::vector< std::size_t >& lidbid,
+               const tk::Fields& W,
                tk::Fields& G ) const
     {
-      Assert( U.nunk() == coord[0].size(), "Number of unknowns in solution "
-              "vector at recent time step incorrect" );
+      Assert( W.nunk() == coord[0].size(), "Number of unknowns in primitive "
+              "variables incorrect" );
 
       // compute gradients of primitive variables in points
       G.fill( 0.0 );
@@ -494,26 +526,12 @@ class CompFlow {
           g[0][i] = -g[1][i] - g[2][i] - g[3][i];
         // scatter-add gradient contributions to boundary nodes
         for (std::size_t a=0; a<4; ++a) {
-          auto i = bid.find( gid[N[a]] );
-          if (i != end(bid)) {
-            real u[5];
-            for (std::size_t b=0; b<4; ++b) {
-              u[0] = U(N[b],0,m_offset);
-              u[1] = U(N[b],1,m_offset)/u[0];
-              u[2] = U(N[b],2,m_offset)/u[0];
-              u[3] = U(N[b],3,m_offset)/u[0];
-              u[4] = U(N[b],4,m_offset)/u[0]
-                     - 0.5*(u[1]*u[1] + u[2]*u[2] + u[3]*u[3]);
-              if ( !skipPoint(x[N[b]],y[N[b]],z[N[b]]) &&
-                   stagPoint(x[N[b]],y[N[b]],z[N[b]]) )
-              {
-                u[1] = u[2] = u[3] = 0.0;
-              }
+          auto i = lidbid[ N[a] ];
+          if (i != std::numeric_limits< std::size_t >::max())
+            for (std::size_t b=0; b<4; ++b)
               for (std::size_t c=0; c<5; ++c)
                 for (std::size_t j=0; j<3; ++j)
-                  G(i->second,c*3+j,0) += J24 * g[b][j] * u[c];
-            }
-          }
+                  G(i,c*3+j,0) += J24 * g[b][j] * W(N[b],c,0);
         }
       }
     }
@@ -523,10 +541,8 @@ class CompFlow {
     //! \param[in] coord Mesh node coordinates
     //! \param[in] inpoel Mesh element connectivity
     //! \param[in] triinpoel Boundary triangle face connecitivity with local ids
-    //! \param[in] bid Local chare-boundary node ids (value) associated to
-    //!    global node ids (key)
     //! \param[in] gid Local->glocal node ids
-    //! \param[in] lid Global->local node ids
+    //! \param[in] bidlid Local node ids associated to chare-boundary node ids
     //! \param[in] dfn Dual-face normals
     //! \param[in] psup Points surrounding points
     //! \param[in] symbctri Vector with 1 at symmetry BC boundary triangles
@@ -535,15 +551,22 @@ class CompFlow {
     //! \param[in] edgeid Edge ids in the order of access
     //! \param[in] G Nodal gradients
     //! \param[in] U Solution vector at recent time step
+    //! \param[in] W Primitive variables at recent time step, see prim()
     //! \param[in] tp Physical time for each mesh node
+    //! \param[in] part Part of the mesh in which to compute the right hand side
+    //! \param[in] frozen True if Grad holds gradients computed in a previous
+    //!   stage to be reused as is
+    //! \param[in,out] Grad Nodal gradient buffer, owned by the caller
+    //! \param[in,out] dflux Edge flux buffer, owned by the caller
     //! \param[in,out] R Right-hand side vector computed
+    //! \details Contributions are added to R, zeroed by the caller before the
+    //!   first part. Grad and dflux must be kept between the parts.
     void rhs( real t,
               const std::array< std::vector< real >, 3 >& coord,
               const std::vector< std::size_t >& inpoel,
               const std::vector< std::size_t >& triinpoel,
               const std::vector< std::size_t >& gid,
-              const std::unordered_map< std::size_t, std::size_t >& bid,
-              const std::unordered_map< std::size_t, std::size_t >& lid,
+              const std::vector< std::size_t >& bidlid,
               const std::vector< real >& dfn,
               const std::pair< std::vector< std::size_t >,
                                std::vector< std::size_t > >& psup,
@@ -551,35 +574,86 @@ class CompFlow {
                                std::vector< std::size_t > >& esup,
               const std::vector< int >& symbctri,
               const std::vector< real >& vol,
-              const std::vector< std::size_t >& edgenode,
-              const std::vector< std::size_t >& edgeid,
+              const std::vector< tk::lid_t >& edgenode,
+              const std::vector< tk::lid_t >& edgeid,
               const tk::Fields& G,
               const tk::Fields& U,
+              const tk::Fields& W,
               const std::vector< tk::real >& tp,
+              const RHSPart& part,
+              bool frozen,
+              tk::ReducedFields& Grad,
+              std::vector< real >& dflux,
               tk::Fields& R ) const
     {
       Assert( G.nprop() == m_ncomp*3,
               "Number of components in gradient vector incorrect" );
       Assert( U.nunk() == coord[0].size(), "Number of unknowns in solution "
               "vector at recent time step incorrect" );
+      Assert( W.nunk() == U.nunk() && W.nprop() == m_ncomp,
+              "Size of primitive variables incorrect" );
       Assert( R.nunk() == coord[0].size(),
               "Number of unknowns and/or number of components in right-hand "
               "side vector incorrect" );
+      Assert( !frozen || Grad.nunk() == U.nunk(),
+              "Frozen gradients have not been computed" );
 
       // compute/assemble gradients in points
-      auto Grad = nodegrad( coord, inpoel, lid, bid, vol, esup, U, G );
-
-      // zero right hand side for all components
-      for (ncomp_t c=0; c<m_ncomp; ++c) R.fill( c, m_offset, 0.0 );
+      if (!frozen)
+        nodegrad( coord, inpoel, bidlid, vol, esup, W, G, part.gpoin, Grad );
 
       // compute domain-edge integral
-      domainint( coord, gid, edgenode, edgeid, psup, dfn, U, Grad, R );
+      domainint( coord, gid, edgenode, edgeid, psup, dfn, W, Grad, part,
+                 dflux, R );
 
       // compute boundary integrals
-      bndint( coord, triinpoel, symbctri, U, R );
+      bndint( coord, triinpoel, symbctri, U, part.tri, R );
 
       // compute optional source integral
-      src( coord, inpoel, t, tp, R );
+      src( coord, inpoel, esup, t, tp, part.poin, R );
+    }
+
+    //! \brief Compute the first-order domain-edge right hand side on a coarse
+    //!   (agglomerated) multigrid level for ALECG
+    //! \param[in] coord Coarse node coordinates
+    //! \param[in] edgenode Coarse node ids of edges
+    //! \param[in] dfn Coarse dual-face normals
+    //! \param[in] U Solution vector at coarse nodes
+    //! \param[in,out] R Right-hand side vector to which the edge fluxes are
+    //!   added
+    //! \details Coarse levels are only used to compute corrections, so the
+    //!   same Riemann flux as on the mesh is used but without reconstruction
+    //!   (zero gradients), boundary, and source integrals.
+    void coarserhs( const std::array< std::vector< real >, 3 >& coord,
+                    const std::vector< tk::lid_t >& edgenode,
+                    const std::vector< real >& dfn,
+                    const tk::Fields& U,
+                    tk::Fields& R ) const
+    {
+      Assert( U.nunk() == coord[0].size(), "Number of unknowns in solution "
+              "vector incorrect" );
+      Assert( R.nunk() == coord[0].size(),
+              "Number of unknowns in right-hand side vector incorrect" );
+
+      // primitive variables in coarse nodes
+      tk::Fields W;
+      prim( coord, U, W );
+
+      // zero gradients yield first order fluxes
+      tk::ReducedFields G( U.nunk(), m_ncomp*3 );
+      G.fill( 0.0 );
+
+      auto r = R.sview( m_offset );
+      for (std::size_t e=0; e<edgenode.size()/2; ++e) {
+        real f[m_ncomp];
+        edgeflux( coord, edgenode, dfn, W, G, e, f );
+        auto p = edgenode[e*2+0];
+        auto q = edgenode[e*2+1];
+        for (std::size_t c=0; c<m_ncomp; ++c) {
+          r(p,c) -= 2.0*f[c];
+          r(q,c) += 2.0*f[c];
+        }
+      }
     }
 
     //! Compute the minimum time step size
@@ -621,9 +695,9 @@ class CompFlow {
           auto& rv = u[2][j];    // rho * v
           auto& rw = u[3][j];    // rho * w
           auto& re = u[4][j];    // rho * e
-          auto p = eos_pressure< eq >( m_system, r, ru/r, rv/r, rw/r, re );
+          auto p = eos_pressure( m_gamma, m_pstiff, r, ru/r, rv/r, rw/r, re );
           if (p < 0) p = 0.0;
-          auto c = eos_soundspeed< eq >( m_system, r, p );
+          auto c = eos_soundspeed( m_gamma, m_pstiff, r, p );
           auto v = std::sqrt((ru*ru + rv*rv + rw*rw)/r/r) + c; // char. velocity
           if (v > maxvel) maxvel = v;
         }
@@ -650,20 +724,29 @@ class CompFlow {
              const tk::Fields& U,
              std::vector< tk::real >& dtp ) const
     {
-      for (std::size_t i=0; i<U.nunk(); ++i) {
+      const auto npoin = U.nunk();
+      const auto r = U.cview( 0, m_offset );
+      const auto ru = U.cview( 1, m_offset );
+      const auto rv = U.cview( 2, m_offset );
+      const auto rw = U.cview( 3, m_offset );
+      const auto re = U.cview( 4, m_offset );
+      const EoSParam mat{ m_gamma, m_pstiff, 0.0 };
+      const auto cfl = g_inputdeck.get< tag::discr, tag::cfl >();
+
+      // compute pressure and speed of sound at all nodes
+      std::vector< real > p( npoin ), c( npoin );
+      eos_pressure( mat, npoin, r, ru, rv, rw, re, p );
+      for (auto& q : p) if (q < 0) q = 0.0;
+      eos_soundspeed( mat, npoin, r, p, c );
+
+      for (std::size_t i=0; i<npoin; ++i) {
         // compute cubic root of element volume as the characteristic length
         const auto L = std::cbrt( vol[i] );
-        // access solution at node p at recent time step
-        const auto u = U[i];
-        // compute pressure
-        auto p = eos_pressure< eq >
-                   ( m_system, u[0], u[1]/u[0], u[2]/u[0], u[3]/u[0], u[4] );
-        if (p < 0) p = 0.0;
-        auto c = eos_soundspeed< eq >( m_system, u[0], p );
         // characteristic velocity
-        auto v = std::sqrt((u[1]*u[1] + u[2]*u[2] + u[3]*u[3])/u[0]/u[0]) + c;
+        auto v = std::sqrt((ru[i]*ru[i] + rv[i]*rv[i] + rw[i]*rw[i])/r[i]/r[i])
+                 + c[i];
         // compute dt for node
-        dtp[i] = L / v * g_inputdeck.get< tag::discr, tag::cfl >();
+        dtp[i] = L / v * cfl;
       }
     }
 
@@ -735,125 +818,166 @@ class CompFlow {
       return bc;
     }
 
+    //! \brief Evaluate the increments of Dirichlet boundary conditions at
+    //!   given nodes for all components in this PDE system
+    //! \param[in] t Physical time
+    //! \param[in] deltat Time step size
+    //! \param[in] tp Physical time for each mesh node
+    //! \param[in] dtp Time step size for each mesh node
+    //! \param[in] nodes Pairs of local node id at which Dirichlet boundary
+    //!   conditions are set, see dirbc(), and index in inc of the first
+    //!   component of this system at the node
+    //! \param[in] coord Mesh node coordinates
+    //! \param[in,out] inc Increments between t+deltat and t of the boundary
+    //!   conditions, written at the indices given by nodes
+    void
+    dirbcinc( real t,
+              real deltat,
+              const std::vector< tk::real >& tp,
+              const std::vector< tk::real >& dtp,
+              const std::vector< std::pair< std::size_t, std::size_t > >& nodes,
+              const std::array< std::vector< real >, 3 >& coord,
+              std::vector< real >& inc ) const
+    {
+      const auto steady = g_inputdeck.get< tag::discr, tag::steady_state >();
+      const auto& x = coord[0];
+      const auto& y = coord[1];
+      const auto& z = coord[2];
+      for (const auto& [n,i] : nodes) {
+        Assert( i+5 <= inc.size(), "Indexing out of BC increments" );
+        if (steady) { t = tp[n]; deltat = dtp[n]; }
+        auto s = solinc( m_system, m_ncomp, x[n], y[n], z[n],
+                         t, deltat, Problem::solution );
+        for (std::size_t c=0; c<5; ++c) inc[i+c] = s[c];
+      }
+    }
+
     //! Set symmetry boundary conditions at nodes
     //! \param[in] U Solution vector at recent time step
     //! \param[in] coord Mesh node coordinates
-    //! \param[in] bnorm Face normals in boundary points, key local node id,
-    //!   first 3 reals of value: unit normal, outer key: side set id
-    //! \param[in] nodes Unique set of node ids at which to set symmetry BCs
+    //! \param[in] bn Nodes at which to set symmetry BCs and their unit
+    //!   normals, for all side sets with symmetry BCs
+    //! \details The user-defined side sets of this system are looked up once
+    //!   each, then the velocity component normal to the boundary is removed
+    //!   at their nodes in a loop over the contiguous normals of bn.
     void
     symbc( tk::Fields& U,
            const std::array< std::vector< real >, 3 >& coord,
-           const std::unordered_map< int,
-             std::unordered_map< std::size_t, std::array< real, 4 > > >& bnorm,
-           const std::unordered_set< std::size_t >& nodes ) const
+           const tk::BndNodeNormals& bn ) const
     {
       const auto& x = coord[0];
       const auto& y = coord[1];
       const auto& z = coord[2];
+      const auto& node = bn.node();
+      const auto& nx = bn.nx();
+      const auto& ny = bn.ny();
+      const auto& nz = bn.nz();
       const auto& sbc = g_inputdeck.get< param, eq, tag::bc, tag::bcsym >();
       if (sbc.size() > m_system)               // use symbcs for this system
-        for (auto p : nodes)                   // for all symbc nodes
-          if (!skipPoint(x[p],y[p],z[p]))
-            for (const auto& s : sbc[m_system]) {// for all user-def symbc sets
-              auto j = bnorm.find(std::stoi(s));// find nodes & normals for side
-              if (j != end(bnorm)) {
-                auto i = j->second.find(p);      // find normal for node
-                if (i != end(j->second)) {
-                  std::array< real, 3 >
-                    n{ i->second[0], i->second[1], i->second[2] },
-                    v{ U(p,1,m_offset), U(p,2,m_offset), U(p,3,m_offset) };
-                  auto v_dot_n = tk::dot( v, n );
-                  U(p,1,m_offset) -= v_dot_n * n[0];
-                  U(p,2,m_offset) -= v_dot_n * n[1];
-                  U(p,3,m_offset) -= v_dot_n * n[2];
-                }
-              }
-            }
+        for (const auto& s : sbc[m_system]) {  // for all user-def symbc sets
+          auto k = bn.find( std::stoi(s) );    // find nodes & normals for side
+          if (k == bn.nside()) continue;
+          const auto [b,e] = bn.range( k );
+          for (auto i=b; i<e; ++i) {           // for all symbc nodes of side
+            auto p = node[i];
+            if (skipPoint(x[p],y[p],z[p])) continue;
+            auto& ru = U(p,1,m_offset);
+            auto& rv = U(p,2,m_offset);
+            auto& rw = U(p,3,m_offset);
+            auto v_dot_n = ru*nx[i] + rv*ny[i] + rw*nz[i];
+            ru -= v_dot_n * nx[i];
+            rv -= v_dot_n * ny[i];
+            rw -= v_dot_n * nz[i];
+          }
+        }
     }
 
     //! Set farfield boundary conditions at nodes
     //! \param[in] U Solution vector at recent time step
     //! \param[in] coord Mesh node coordinates
-    //! \param[in] bnorm Face normals in boundary points, key local node id,
-    //!   first 3 reals of value: unit normal, outer key: side set id
-    //! \param[in] nodes Unique set of node ids at which to set farfield BCs
+    //! \param[in] bn Nodes at which to set farfield BCs and their unit
+    //!   normals, for all side sets with farfield BCs
+    //! \details The state at a node is set depending on the normal Mach
+    //!   number, computed with the contiguous normals of bn, i.e., whether the
+    //!   flow is super- or subsonic inflow or outflow at the node.
     void
-    farfieldbc(
-      tk::Fields& U,
-      const std::array< std::vector< real >, 3 >& coord,
-      const std::unordered_map< int,
-        std::unordered_map< std::size_t, std::array< real, 4 > > >& bnorm,
-      const std::unordered_set< std::size_t >& nodes ) const
+    farfieldbc( tk::Fields& U,
+                const std::array< std::vector< real >, 3 >& coord,
+                const tk::BndNodeNormals& bn ) const
     {
       const auto& x = coord[0];
       const auto& y = coord[1];
       const auto& z = coord[2];
+      const auto& node = bn.node();
+      const auto& nx = bn.nx();
+      const auto& ny = bn.ny();
+      const auto& nz = bn.nz();
       const auto& fbc = g_inputdeck.get<param, eq, tag::bc, tag::bcfarfield>();
       if (fbc.size() > m_system)               // use farbcs for this system
-        for (auto p : nodes)                   // for all farfieldbc nodes
-          if (!skipPoint(x[p],y[p],z[p]))
-            for (const auto& s : fbc[m_system]) {// for all user-def farbc sets
-              auto j = bnorm.find(std::stoi(s));// find nodes & normals for side
-              if (j != end(bnorm)) {
-                auto i = j->second.find(p);      // find normal for node
-                if (i != end(j->second)) {
-                  auto& r  = U(p,0,m_offset);
-                  auto& ru = U(p,1,m_offset);
-                  auto& rv = U(p,2,m_offset);
-                  auto& rw = U(p,3,m_offset);
-                  auto& re = U(p,4,m_offset);
-                  auto vn =
-                    (ru*i->second[0] + rv*i->second[1] + rw*i->second[2]) / r;
-                  auto a = eos_soundspeed< eq >( m_system, r,
-                    eos_pressure< eq >( m_system, r, ru/r, rv/r, rw/r, re ) );
-                  auto M = vn / a;
-                  if (M <= -1.0) {                      // supersonic inflow
-                    r  = m_fr;
-                    ru = m_fr * m_fu[0];
-                    rv = m_fr * m_fu[1];
-                    rw = m_fr * m_fu[2];
-                    re = eos_totalenergy< eq >
-                           ( m_system, m_fr, m_fu[0], m_fu[1], m_fu[2], m_fp );
-                  } else if (M > -1.0 && M < 0.0) {     // subsonic inflow
-                    r  = m_fr;
-                    ru = m_fr * m_fu[0];
-                    rv = m_fr * m_fu[1];
-                    rw = m_fr * m_fu[2];
-                    re =
-                    eos_totalenergy< eq >( m_system, m_fr, m_fu[0], m_fu[1],
-                      m_fu[2], eos_pressure< eq >( m_system, r, ru/r, rv/r,
-                                                   rw/r, re ) );
-                  } else if (M >= 0.0 && M < 1.0) {     // subsonic outflow
-                    re = eos_totalenergy< eq >( m_system, r, ru/r, rv/r, rw/r,
-                                                m_fp );
-                  }
-                }
-              }
+        for (const auto& s : fbc[m_system]) {  // for all user-def farbc sets
+          auto k = bn.find( std::stoi(s) );    // find nodes & normals for side
+          if (k == bn.nside()) continue;
+          const auto [b,e] = bn.range( k );
+          for (auto i=b; i<e; ++i) {           // for all farfieldbc nodes
+            auto p = node[i];
+            if (skipPoint(x[p],y[p],z[p])) continue;
+            auto& r  = U(p,0,m_offset);
+            auto& ru = U(p,1,m_offset);
+            auto& rv = U(p,2,m_offset);
+            auto& rw = U(p,3,m_offset);
+            auto& re = U(p,4,m_offset);
+            auto vn = (ru*nx[i] + rv*ny[i] + rw*nz[i]) / r;
+            auto a = eos_soundspeed< eq >( m_system, r,
+              eos_pressure< eq >( m_system, r, ru/r, rv/r, rw/r, re ) );
+            auto M = vn / a;
+            if (M <= -1.0) {                      // supersonic inflow
+              r  = m_fr;
+              ru = m_fr * m_fu[0];
+              rv = m_fr * m_fu[1];
+              rw = m_fr * m_fu[2];
+              re = eos_totalenergy< eq >
+                     ( m_system, m_fr, m_fu[0], m_fu[1], m_fu[2], m_fp );
+            } else if (M > -1.0 && M < 0.0) {     // subsonic inflow
+              r  = m_fr;
+              ru = m_fr * m_fu[0];
+              rv = m_fr * m_fu[1];
+              rw = m_fr * m_fu[2];
+              re =
+              eos_totalenergy< eq >( m_system, m_fr, m_fu[0], m_fu[1],
+                m_fu[2], eos_pressure< eq >( m_system, r, ru/r, rv/r,
+                                             rw/r, re ) );
+            } else if (M >= 0.0 && M < 1.0) {     // subsonic outflow
+              re = eos_totalenergy< eq >( m_system, r, ru/r, rv/r, rw/r,
+                                          m_fp );
             }
+          }
+        }
     }
 
     //! Return field names to be output to file
     //! \return Vector of strings labelling fields output in file
-    std::vector< std::string > fieldNames() const
-    { return m_problem.fieldNames( m_ncomp ); }
+    std::vector< std::string > fieldNames() const {
+      auto n = m_problem.fieldNames( m_ncomp );
+      CompFlowSelectFields( n );
+      return CompFlowSystemNames( m_system, std::move(n) );
+    }
 
     //! Return surface field names to be output to file
     //! \return Vector of strings labelling surface fields output in file
     std::vector< std::string > surfNames() const
-    { return CompFlowSurfNames(); }
+    { return CompFlowSystemNames( m_system, CompFlowSurfNames() ); }
 
     //! Return time history field names to be output to file
     //! \return Vector of strings labelling time history fields output in file
     std::vector< std::string > histNames() const
-    { return CompFlowHistNames(); }
+    { return CompFlowSystemNames( m_system, CompFlowHistNames() ); }
 
     //! Return field output going to file
     //! \param[in] t Physical time
     //! \param[in] V Total mesh volume
     //! \param[in] coord Mesh node coordinates
     //! \param[in] v Nodal mesh volumes
-    //! \param[in,out] U Solution vector at recent time step
+    //! \param[in] U Solution vector at recent time step
     //! \return Vector of vectors to be output to file
     std::vector< std::vector< tk::real > >
     fieldOutput( tk::real t,
@@ -861,16 +985,19 @@ class CompFlow {
                  std::size_t nunk,
                  const std::array< std::vector< tk::real >, 3 >& coord,
                  const std::vector< tk::real >& v,
-                 tk::Fields& U ) const
+                 const tk::Fields& U ) const
     {
-      return m_problem.fieldOutput( m_system, m_ncomp, m_offset, nunk, t,
-                                    V, v, coord, U );
+      auto n = m_problem.fieldNames( m_ncomp );
+      auto f = m_problem.fieldOutput( m_system, m_ncomp, m_offset, nunk, t,
+                                      V, v, coord, U );
+      CompFlowSelectFields( n, f );
+      return f;
     }
 
     //! Return surface field output going to file
     std::vector< std::vector< real > >
     surfOutput( const std::map< int, std::vector< std::size_t > >& bnd,
-                tk::Fields& U ) const
+                const tk::Fields& U ) const
     { return CompFlowSurfOutput( m_system, bnd, U ); }
 
     //! Return time history field output evaluated at time history points
@@ -897,6 +1024,10 @@ class CompFlow {
     const real m_fr;                    //!< Farfield density
     const real m_fp;                    //!< Farfield pressure
     const std::vector< real > m_fu;     //!< Farfield velocity
+    //! \brief Material constants of the EoS, queried once so that the edge and
+    //!   boundary kernels do not access the input deck
+    const real m_gamma;                 //!< Ratio of specific heats
+    const real m_pstiff;                //!< Stiffness parameter
 
     //! Decide if point is a stagnation point
     //! \param[in] x X mesh point coordinates to query
@@ -933,40 +1064,49 @@ class CompFlow {
     }
 
     //! \brief Compute/assemble nodal gradients of primitive variables for
-    //!   ALECG in all points
+    //!   ALECG in a list of points
     //! \param[in] coord Mesh node coordinates
     //! \param[in] inpoel Mesh element connectivity
-    //! \param[in] lid Global->local node ids
-    //! \param[in] bid Local chare-boundary node ids (value) associated to
-    //!    global node ids (key)
+    //! \param[in] bidlid Local node ids associated to chare-boundary node ids,
+    //!   std::numeric_limits< std::size_t >::max() for nodes no longer in the
+    //!   mesh
     //! \param[in] vol Nodal volumes
-    //! \param[in] U Solution vector at recent time step
+    //! \param[in] W Primitive variables at recent time step, see prim()
     //! \param[in] G Nodal gradients of primitive variables in chare-boundary nodes
-    //! \return Gradients of primitive variables in all mesh points
-    tk::Fields
+    //! \param[in] gpoin Points in which to compute gradients
+    //! \param[in,out] Grad Gradients of primitive variables in mesh points,
+    //!   (re)allocated here if its size is not yet right
+    void
     nodegrad( const std::array< std::vector< real >, 3 >& coord,
               const std::vector< std::size_t >& inpoel,
-              const std::unordered_map< std::size_t, std::size_t >& lid,
-              const std::unordered_map< std::size_t, std::size_t >& bid,
+              const std::vector< std::size_t >& bidlid,
               const std::vector< real >& vol,
               const std::pair< std::vector< std::size_t >,
                                std::vector< std::size_t > >& esup,
-              const tk::Fields& U,
-              const tk::Fields& G ) const
+              const tk::Fields& W,
+              const tk::Fields& G,
+              const std::vector< std::size_t >& gpoin,
+              tk::ReducedFields& Grad ) const
     {
       // allocate storage for nodal gradients of primitive variables
-      tk::Fields Grad( U.nunk(), m_ncomp*3 );
-      Grad.fill( 0.0 );
+      if (Grad.nunk() != W.nunk() || Grad.nprop() != m_ncomp*3)
+        Grad = tk::ReducedFields( W.nunk(), m_ncomp*3 );
+      using greal = tk::ReducedFields::value_type;
 
       // access node cooordinates
       const auto& x = coord[0];
       const auto& y = coord[1];
       const auto& z = coord[2];
 
-      // compute gradients of primitive variables in points
-      auto npoin = U.nunk();
-      #pragma omp simd
-      for (std::size_t p=0; p<npoin; ++p)
+      // compute gradients of primitive variables in points, accumulating in
+      // real, independent of the (potentially reduced) storage precision;
+      // race-free, since each point only writes its own gradients
+      const auto np = static_cast< std::ptrdiff_t >( gpoin.size() );
+      #pragma omp parallel for schedule(static)
+      for (std::ptrdiff_t ip=0; ip<np; ++ip) {
+        auto p = gpoin[ static_cast< std::size_t >( ip ) ];
+        real grad[m_ncomp*3];
+        for (auto& r : grad) r = 0.0;
         for (auto e : tk::Around(esup,p)) {
           // access node IDs
           std::size_t N[4] =
@@ -994,38 +1134,23 @@ class CompFlow {
           for (std::size_t i=0; i<3; ++i)
             g[0][i] = -g[1][i] - g[2][i] - g[3][i];
           // scatter-add gradient contributions to boundary nodes
-          real u[m_ncomp];
-          for (std::size_t b=0; b<4; ++b) {
-            u[0] = U(N[b],0,m_offset);
-            u[1] = U(N[b],1,m_offset)/u[0];
-            u[2] = U(N[b],2,m_offset)/u[0];
-            u[3] = U(N[b],3,m_offset)/u[0];
-            u[4] = U(N[b],4,m_offset)/u[0]
-                   - 0.5*(u[1]*u[1] + u[2]*u[2] + u[3]*u[3]);
-            if ( !skipPoint(x[N[b]],y[N[b]],z[N[b]]) &&
-                 stagPoint(x[N[b]],y[N[b]],z[N[b]]) )
-            {
-              u[1] = u[2] = u[3] = 0.0;
-            }
+          for (std::size_t b=0; b<4; ++b)
             for (std::size_t c=0; c<m_ncomp; ++c)
               for (std::size_t i=0; i<3; ++i)
-                Grad(p,c*3+i,0) += J24 * g[b][i] * u[c];
-          }
+                grad[c*3+i] += J24 * g[b][i] * W(N[b],c,0);
         }
+        // divide weak result in gradients by nodal volume
+        for (std::size_t c=0; c<m_ncomp*3; ++c)
+          Grad(p,c,0) = static_cast< greal >( grad[c] / vol[p] );
+      }
 
       // put in nodal gradients of chare-boundary points
-      for (const auto& [g,b] : bid) {
-        auto i = tk::cref_find( lid, g );
+      for (std::size_t b=0; b<bidlid.size(); ++b) {
+        auto i = bidlid[b];
+        if (i == std::numeric_limits< std::size_t >::max()) continue;
         for (ncomp_t c=0; c<Grad.nprop(); ++c)
-          Grad(i,c,0) = G(b,c,0);
+          Grad(i,c,0) = static_cast< greal >( G(b,c,0) / vol[i] );
       }
-
-      // divide weak result in gradients by nodal volume
-      for (std::size_t p=0; p<npoin; ++p)
-        for (std::size_t c=0; c<m_ncomp*3; ++c)
-          Grad(p,c,0) /= vol[p];
-
-      return Grad;
     }
 
     //! Compute domain-edge integral for ALECG
@@ -1035,90 +1160,144 @@ class CompFlow {
     //! \param[in] edgeid Local node id pair -> edge id map
     //! \param[in] psup Points surrounding points
     //! \param[in] dfn Dual-face normals
-    //! \param[in] U Solution vector at recent time step
+    //! \param[in] W Primitive variables at recent time step, see prim()
     //! \param[in] G Nodal gradients
+    //! \param[in] part Part of the mesh in which to compute the integral
+    //! \param[in,out] dflux Edge flux buffer, resized here as needed
     //! \param[in,out] R Right-hand side vector computed
+    //! \details By default, both loops are race-free without edge coloring
+    //!   or atomics, so they are shared among OpenMP threads (if enabled): the
+    //!   flux loop writes each edge's own slot, while the scatter loop is
+    //!   owner-computes, i.e., each point gathers the fluxes of the edges
+    //!   surrounding it and only writes its own right hand side. The edge flux
+    //!   buffer is owned by the caller so it is not reallocated every stage,
+    //!   and so that fluxes computed in a previous part can be gathered.
+    //!   If fused_edgeflux is configured, the flux of each edge is instead
+    //!   added to both edge-end points right after it is computed, in a single
+    //!   (serial) pass over the edge list, without the edge flux buffer.
+    TK_MULTIVERSION
     void domainint( const std::array< std::vector< real >, 3 >& coord,
                     const std::vector< std::size_t >& gid,
-                    const std::vector< std::size_t >& edgenode,
-                    const std::vector< std::size_t >& edgeid,
+                    const std::vector< tk::lid_t >& edgenode,
+                    const std::vector< tk::lid_t >& edgeid,
                     const std::pair< std::vector< std::size_t >,
                                      std::vector< std::size_t > >& psup,
                     const std::vector< real >& dfn,
-                    const tk::Fields& U,
-                    const tk::Fields& G,
+                    const tk::Fields& W,
+                    const tk::ReducedFields& G,
+                    const RHSPart& part,
+                    std::vector< real >& dflux,
                     tk::Fields& R ) const
     {
-      // domain-edge integral: compute fluxes in edges
-      std::vector< real > dflux( edgenode.size()/2 * m_ncomp );
-
-      // access node coordinates
-      const auto& x = coord[0];
-      const auto& y = coord[1];
-      const auto& z = coord[2];
-
-      #pragma omp simd
-      for (std::size_t e=0; e<edgenode.size()/2; ++e) {
-        auto p = edgenode[e*2+0];
-        auto q = edgenode[e*2+1];
-
-        // compute primitive variables at edge-end points
-        real rL  = U(p,0,m_offset);
-        real ruL = U(p,1,m_offset) / rL;
-        real rvL = U(p,2,m_offset) / rL;
-        real rwL = U(p,3,m_offset) / rL;
-        real reL = U(p,4,m_offset) / rL - 0.5*(ruL*ruL + rvL*rvL + rwL*rwL);
-        real rR  = U(q,0,m_offset);
-        real ruR = U(q,1,m_offset) / rR;
-        real rvR = U(q,2,m_offset) / rR;
-        real rwR = U(q,3,m_offset) / rR;
-        real reR = U(q,4,m_offset) / rR - 0.5*(ruR*ruR + rvR*rvR + rwR*rwR);
-
-        // apply stagnation BCs to primitive variables
-        if ( !skipPoint(x[p],y[p],z[p]) && stagPoint(x[p],y[p],z[p]) )
-          ruL = rvL = rwL = 0.0;
-        if ( !skipPoint(x[q],y[q],z[q]) && stagPoint(x[q],y[q],z[q]) )
-          ruR = rvR = rwR = 0.0;
-
-        // compute MUSCL reconstruction in edge-end points
-        muscl( p, q, coord, G, rL, ruL, rvL, rwL, reL,
-               rR, ruR, rvR, rwR, reR );
-
-        // convert back to conserved variables
-        reL = (reL + 0.5*(ruL*ruL + rvL*rvL + rwL*rwL)) * rL;
-        ruL *= rL;
-        rvL *= rL;
-        rwL *= rL;
-        reR = (reR + 0.5*(ruR*ruR + rvR*rvR + rwR*rwR)) * rR;
-        ruR *= rR;
-        rvR *= rR;
-        rwR *= rR;
-
-        // compute Riemann flux using edge-end point states
-        real f[5];
-        Rusanov::flux( dfn[e*6+0], dfn[e*6+1], dfn[e*6+2],
-                       dfn[e*6+3], dfn[e*6+4], dfn[e*6+5],
-                       rL, ruL, rvL, rwL, reL,
-                       rR, ruR, rvR, rwR, reR,
-                       f[0], f[1], f[2], f[3], f[4] );
-        // store flux in edges
-        for (std::size_t c=0; c<m_ncomp; ++c) dflux[e*m_ncomp+c] = f[c];
+      static const auto region = tk::perfRegion( "CGCompFlow::domainint" );
+      tk::PerfRegion pr( region );
+
+      // access right hand side at offset
+      auto r = R.sview( m_offset );
+
+      // domain-edge integral: compute fluxes in edges and sum them to both
+      // edge-end points in a single pass
+      if (g_inputdeck.get< tag::discr, tag::fused_edgeflux >()) {
+        for (auto e : part.edge) {
+          real f[m_ncomp];
+          edgeflux( coord, edgenode, dfn, W, G, e, f );
+          auto p = edgenode[e*2+0];
+          auto q = edgenode[e*2+1];
+          auto s = gid[p] > gid[q] ? -1.0 : 1.0;
+          for (std::size_t c=0; c<m_ncomp; ++c) {
+            r(p,c) -= 2.0*s*f[c];
+            r(q,c) += 2.0*s*f[c];
+          }
+        }
+        return;
       }
 
-      // access pointer to right hand side at component and offset
-      std::array< const real*, m_ncomp > r;
-      for (ncomp_t c=0; c<m_ncomp; ++c) r[c] = R.cptr( c, m_offset );
+      // domain-edge integral: compute fluxes in edges
+      dflux.resize( edgenode.size()/2 * m_ncomp );
+      const auto& edge = part.edge;
+      const auto ne = static_cast< std::ptrdiff_t >( edge.size() );
+      #pragma omp parallel for schedule(static)
+      for (std::ptrdiff_t ie=0; ie<ne; ++ie) {
+        auto e = edge[ static_cast< std::size_t >( ie ) ];
+        edgeflux( coord, edgenode, dfn, W, G, e, dflux.data() + e*m_ncomp );
+      }
 
       // domain-edge integral: sum flux contributions to points
-      for (std::size_t p=0,k=0; p<U.nunk(); ++p)
-        for (auto q : tk::Around(psup,p)) {
+      const auto& psup1 = psup.first;
+      const auto& psup2 = psup.second;
+      const auto& poin = part.poin;
+      const auto np = static_cast< std::ptrdiff_t >( poin.size() );
+      #pragma omp parallel for schedule(static)
+      for (std::ptrdiff_t ip=0; ip<np; ++ip) {
+        auto p = poin[ static_cast< std::size_t >( ip ) ];
+        for (std::size_t i=psup2[p]+1; i<=psup2[p+1]; ++i) {
+          auto q = psup1[i];
           auto s = gid[p] > gid[q] ? -1.0 : 1.0;
-          auto e = edgeid[k++];
+          auto e = edgeid[i-1];
           for (std::size_t c=0; c<m_ncomp; ++c)
-            R.var(r[c],p) -= 2.0*s*dflux[e*m_ncomp+c];
+            r(p,c) -= 2.0*s*dflux[e*m_ncomp+c];
         }
+      }
+    }
 
-      tk::destroy(dflux);
+    //! Compute Riemann flux in an edge for ALECG
+    //! \param[in] coord Mesh node coordinates
+    //! \param[in] edgenode Local node ids of edges
+    //! \param[in] dfn Dual-face normals
+    //! \param[in] W Primitive variables at recent time step, see prim()
+    //! \param[in] G Nodal gradients
+    //! \param[in] e Edge id
+    //! \param[out] f Riemann flux in edge, m_ncomp components
+    void edgeflux( const std::array< std::vector< real >, 3 >& coord,
+                   const std::vector< tk::lid_t >& edgenode,
+                   const std::vector< real >& dfn,
+                   const tk::Fields& W,
+                   const tk::ReducedFields& G,
+                   std::size_t e,
+                   real* f ) const
+    {
+      auto p = edgenode[e*2+0];
+      auto q = edgenode[e*2+1];
+
+      // access primitive variables at edge-end points
+      real rL  = W(p,0,0);
+      real ruL = W(p,1,0);
+      real rvL = W(p,2,0);
+      real rwL = W(p,3,0);
+      real reL = W(p,4,0);
+      real rR  = W(q,0,0);
+      real ruR = W(q,1,0);
+      real rvR = W(q,2,0);
+      real rwR = W(q,3,0);
+      real reR = W(q,4,0);
+
+      // compute MUSCL reconstruction in edge-end points
+      muscl( p, q, coord, G, rL, ruL, rvL, rwL, reL,
+             rR, ruR, rvR, rwR, reR );
+
+      // convert back to conserved variables
+      reL = (reL + 0.5*(ruL*ruL + rvL*rvL + rwL*rwL)) * rL;
+      ruL *= rL;
+      rvL *= rL;
+      rwL *= rL;
+      reR = (reR + 0.5*(ruR*ruR + rvR*rvR + rwR*rwR)) * rR;
+      ruR *= rR;
+      rvR *= rR;
+      rwR *= rR;
+
+      // compute Riemann flux using edge-end point states
+      Rusanov::flux( m_gamma, m_pstiff,
+                     dfn[e*6+0], dfn[e*6+1], dfn[e*6+2],
+                     dfn[e*6+3], dfn[e*6+4], dfn[e*6+5],
+                     rL, ruL, rvL, rwL, reL,
+                     rR, ruR, rvR, rwR, reR,
+                     f[0], f[1], f[2], f[3], f[4] );
+
+      // add viscous and heat conduction fluxes (if any) from unreconstructed
+      // edge-end point states
+      m_physics.viscousFlux( p, q, coord,
+                             {{ dfn[e*6+0], dfn[e*6+1], dfn[e*6+2] }},
+                             W, G, f );
     }
 
     //! \brief Compute MUSCL reconstruction in edge-end points using a MUSCL
@@ -1140,7 +1319,7 @@ class CompFlow {
     void muscl( std::size_t p,
                 std::size_t q,
                 const tk::UnsMesh::Coords& coord,
-                const tk::Fields& G,
+                const tk::ReducedFields& G,
                 real& rL, real& uL, real& vL, real& wL, real& eL,
                 real& rR, real& uR, real& vR, real& wR, real& eR ) const
     {
@@ -1207,11 +1386,13 @@ class CompFlow {
     //! \param[in] triinpoel Boundary triangle face connecitivity with local ids
     //! \param[in] symbctri Vector with 1 at symmetry BC boundary triangles
     //! \param[in] U Solution vector at recent time step
+    //! \param[in] tri Boundary triangles to integrate on
     //! \param[in,out] R Right-hand side vector computed
     void bndint( const std::array< std::vector< real >, 3 >& coord,
                  const std::vector< std::size_t >& triinpoel,
                  const std::vector< int >& symbctri,
                  const tk::Fields& U,
+                 const std::vector< std::size_t >& tri,
                  tk::Fields& R ) const
     {
 
@@ -1221,10 +1402,10 @@ class CompFlow {
       const auto& z = coord[2];
 
       // boundary integrals: compute fluxes in edges
-      std::vector< real > bflux( triinpoel.size() * m_ncomp * 2 );
+      std::vector< real > bflux( tri.size() * m_ncomp * 6 );
 
-      #pragma omp simd
-      for (std::size_t e=0; e<triinpoel.size()/3; ++e) {
+      for (std::size_t t=0; t<tri.size(); ++t) {
+        auto e = tri[t];
         // access node IDs
         std::size_t N[3] =
           { triinpoel[e*3+0], triinpoel[e*3+1], triinpoel[e*3+2] };
@@ -1270,21 +1451,24 @@ class CompFlow {
         real f[m_ncomp][3];
         real p, vn;
         int sym = symbctri[e];
-        p = eos_pressure< eq >( m_system, rA, ruA/rA, rvA/rA, rwA/rA, reA );
+        p = eos_pressure( m_gamma, m_pstiff,
+                          rA, ruA/rA, rvA/rA, rwA/rA, reA );
         vn = sym ? 0.0 : (nx*ruA + ny*rvA + nz*rwA) / rA;
         f[0][0] = rA*vn;
         f[1][0] = ruA*vn + p*nx;
         f[2][0] = rvA*vn + p*ny;
         f[3][0] = rwA*vn + p*nz;
         f[4][0] = (reA + p)*vn;
-        p = eos_pressure< eq >( m_system, rB, ruB/rB, rvB/rB, rwB/rB, reB );
+        p = eos_pressure( m_gamma, m_pstiff,
+                          rB, ruB/rB, rvB/rB, rwB/rB, reB );
         vn = sym ? 0.0 : (nx*ruB + ny*rvB + nz*rwB) / rB;
         f[0][1] = rB*vn;
         f[1][1] = ruB*vn + p*nx;
         f[2][1] = rvB*vn + p*ny;
         f[3][1] = rwB*vn + p*nz;
         f[4][1] = (reB + p)*vn;
-        p = eos_pressure< eq >( m_system, rC, ruC/rC, rvC/rC, rwC/rC, reC );
+        p = eos_pressure( m_gamma, m_pstiff,
+                          rC, ruC/rC, rvC/rC, rwC/rC, reC );
         vn = sym ? 0.0 : (nx*ruC + ny*rvC + nz*rwC) / rC;
         f[0][2] = rC*vn;
         f[1][2] = ruC*vn + p*nx;
@@ -1298,7 +1482,7 @@ class CompFlow {
         auto A24 = A6/4.0;
         // store flux in boundary elements
         for (std::size_t c=0; c<m_ncomp; ++c) {
-          auto eb = (e*m_ncomp+c)*6;
+          auto eb = (t*m_ncomp+c)*6;
           auto Bab = A24 * (f[c][0] + f[c][1]);
           bflux[eb+0] = Bab + A6 * f[c][0];
           bflux[eb+1] = Bab;
@@ -1311,18 +1495,19 @@ class CompFlow {
         }
       }
 
-      // access pointer to right hand side at component and offset
-      std::array< const real*, m_ncomp > r;
-      for (ncomp_t c=0; c<m_ncomp; ++c) r[c] = R.cptr( c, m_offset );
+      // access right hand side at offset
+      auto r = R.sview( m_offset );
 
       // boundary integrals: sum flux contributions to points
-      for (std::size_t e=0; e<triinpoel.size()/3; ++e)
+      for (std::size_t t=0; t<tri.size(); ++t) {
+        auto e = tri[t];
         for (std::size_t c=0; c<m_ncomp; ++c) {
-          auto eb = (e*m_ncomp+c)*6;
-          R.var(r[c],triinpoel[e*3+0]) -= bflux[eb+0] + bflux[eb+5];
-          R.var(r[c],triinpoel[e*3+1]) -= bflux[eb+1] + bflux[eb+2];
-          R.var(r[c],triinpoel[e*3+2]) -= bflux[eb+3] + bflux[eb+4];
+          auto eb = (t*m_ncomp+c)*6;
+          r(triinpoel[e*3+0],c) -= bflux[eb+0] + bflux[eb+5];
+          r(triinpoel[e*3+1],c) -= bflux[eb+1] + bflux[eb+2];
+          r(triinpoel[e*3+2],c) -= bflux[eb+3] + bflux[eb+4];
         }
+      }
 
       tk::destroy(bflux);
     }
@@ -1330,13 +1515,21 @@ class CompFlow {
     //! Compute optional source integral
     //! \param[in] coord Mesh node coordinates
     //! \param[in] inpoel Mesh element connectivity
+    //! \param[in] esup Elements surrounding points
     //! \param[in] t Physical time
     //! \param[in] tp Physical time for each mesh node
+    //! \param[in] poin Points in which to sum source contributions
     //! \param[in,out] R Right-hand side vector computed
+    //! \details The source is evaluated in nodes, so the integral is
+    //!   assembled owner-computes, with each point gathering the contributions
+    //!   of the elements surrounding it.
     void src( const std::array< std::vector< real >, 3 >& coord,
               const std::vector< std::size_t >& inpoel,
+              const std::pair< std::vector< std::size_t >,
+                               std::vector< std::size_t > >& esup,
               real t,
               const std::vector< tk::real >& tp,
+              const std::vector< std::size_t >& poin,
               tk::Fields& R ) const
     {
       // access node coordinates
@@ -1344,27 +1537,27 @@ class CompFlow {
       const auto& y = coord[1];
       const auto& z = coord[2];
 
-      // access pointer to right hand side at component and offset
-      std::array< const real*, m_ncomp > r;
-      for (ncomp_t c=0; c<m_ncomp; ++c) r[c] = R.cptr( c, m_offset );
+      // access right hand side at offset
+      auto r = R.sview( m_offset );
 
       // source integral
-      for (std::size_t e=0; e<inpoel.size()/4; ++e) {
-        std::size_t N[4] =
-          { inpoel[e*4+0], inpoel[e*4+1], inpoel[e*4+2], inpoel[e*4+3] };
-        // compute element Jacobi determinant, J = 6V
-        auto J24 = tk::triple(
-          x[N[1]]-x[N[0]], y[N[1]]-y[N[0]], z[N[1]]-z[N[0]],
-          x[N[2]]-x[N[0]], y[N[2]]-y[N[0]], z[N[2]]-z[N[0]],
-          x[N[3]]-x[N[0]], y[N[3]]-y[N[0]], z[N[3]]-z[N[0]] ) / 24.0;
-        // sum source contributions to nodes
-        for (std::size_t a=0; a<4; ++a) {
-          real s[m_ncomp];
-          if (g_inputdeck.get< tag::discr, tag::steady_state >()) t = tp[N[a]];
-          Problem::src( m_system, x[N[a]], y[N[a]], z[N[a]], t,
-                        s[0], s[1], s[2], s[3], s[4] );
+      for (auto p : poin) {
+        // evaluate source in point
+        real s[m_ncomp];
+        if (g_inputdeck.get< tag::discr, tag::steady_state >()) t = tp[p];
+        Problem::src( m_system, x[p], y[p], z[p], t,
+                      s[0], s[1], s[2], s[3], s[4] );
+        // sum source contributions of elements surrounding point
+        for (auto e : tk::Around(esup,p)) {
+          std::size_t N[4] =
+            { inpoel[e*4+0], inpoel[e*4+1], inpoel[e*4+2], inpoel[e*4+3] };
+          // compute element Jacobi determinant, J = 6V
+          auto J24 = tk::triple(
+            x[N[1]]-x[N[0]], y[N[1]]-y[N[0]], z[N[1]]-z[N[0]],
+            x[N[2]]-x[N[0]], y[N[2]]-y[N[0]], z[N[2]]-z[N[0]],
+            x[N[3]]-x[N[0]], y[N[3]]-y[N[0]], z[N[3]]-z[N[0]] ) / 24.0;
           for (std::size_t c=0; c<m_ncomp; ++c)
-            R.var(r[c],N[a]) += J24 * s[c];
+            r(p,c) += J24 * s[c];
         }
       }
     }
@@ -31,7 +31,6 @@
 #include "Integrate/Basis.hpp"
 #include "Integrate/Quadrature.hpp"
 #include "Integrate/Initialize.hpp"
-#include "Integrate/Mass.hpp"
 #include "Integrate/Surface.hpp"
 #include "Integrate/Boundary.hpp"
 #include "Integrate/Volume.hpp"
@@ -40,6 +39,7 @@
 #include "EoS/EoS.hpp"
 #include "Reconstruction.hpp"
 #include "Limiter.hpp"
+#include "Problem/FieldOutput.hpp"
 
 namespace inciter {
 
@@ -68,6 +68,7 @@ class CompFlow {
       m_system( c ),
       m_ncomp( g_inputdeck.get< tag::component, eq >().at(c) ),
       m_offset( g_inputdeck.get< tag::component >().offset< eq >(c) ),
+      m_mat( eos_params< eq >( c ).at(0) ),
       m_riemann(tk::cref_find(compflowRiemannSolvers(),
         g_inputdeck.get< tag::param, tag::compflow, tag::flux >().at(m_system)))
     {
@@ -92,31 +93,23 @@ class CompFlow {
     }
 
     //! Initalize the compressible flow equations, prepare for time integration
-    //! \param[in] L Block diagonal mass matrix
+    //! \param[in] geoElem Element geometry array
     //! \param[in] inpoel Element-node connectivity
     //! \param[in] coord Array of nodal coordinates
     //! \param[in,out] unk Array of unknowns
     //! \param[in] t Physical time
     //! \param[in] nielem Number of internal elements
-    void initialize( const tk::Fields& L,
+    void initialize( const tk::Fields& geoElem,
                      const std::vector< std::size_t >& inpoel,
                      const tk::UnsMesh::Coords& coord,
                      tk::Fields& unk,
                      tk::real t,
                      const std::size_t nielem ) const
     {
-      tk::initialize( m_system, m_ncomp, m_offset, L, inpoel, coord,
+      tk::initialize( m_system, m_ncomp, m_offset, geoElem, inpoel, coord,
                       Problem::solution, unk, t, nielem );
     }
 
-    //! Compute the left hand side block-diagonal mass matrix
-    //! \param[in] geoElem Element geometry array
-    //! \param[in,out] l Block diagonal mass matrix
-    void lhs( const tk::Fields& geoElem, tk::Fields& l ) const {
-      const auto ndof = g_inputdeck.get< tag::discr, tag::ndof >();
-      tk::mass( m_ncomp, m_offset, ndof, geoElem, l );
-    }
-
     //! Update the primitives for this PDE system
     //! \details This function computes and stores the dofs for primitive
     //!   quantities, which is currently unused for compflow. But if a limiter
@@ -139,6 +132,8 @@ class CompFlow {
     //! \param[in] geoFace Face geometry array
     //! \param[in] geoElem Element geometry array
     //! \param[in] fd Face connectivity and boundary conditions object
+    //! \param[in] lhsinv Inverse of the least-squares reconstruction matrix of
+    //!   each element, see tk::invLeastSq_P0P1()
     //! \param[in] inpoel Element-node connectivity
     //! \param[in] coord Array of nodal coordinates
     //! \param[in,out] U Solution vector at recent time step
@@ -147,6 +142,8 @@ class CompFlow {
                       const tk::Fields& geoFace,
                       const tk::Fields& geoElem,
                       const inciter::FaceData& fd,
+                      const std::vector< std::array<
+                        std::array< tk::real, 3 >, 3 > >& lhsinv,
                       const std::map< std::size_t, std::vector< std::size_t > >&,
                       const std::vector< std::size_t >& inpoel,
                       const tk::UnsMesh::Coords& coord,
@@ -161,19 +158,16 @@ class CompFlow {
       Assert( fd.Inpofa().size()/3 == fd.Esuf().size()/2,
               "Mismatch in inpofa size" );
 
-      // allocate and initialize matrix and vector for reconstruction
-      std::vector< std::array< std::array< tk::real, 3 >, 3 > >
-        lhs_ls( nelem, {{ {{0.0, 0.0, 0.0}},
-                          {{0.0, 0.0, 0.0}},
-                          {{0.0, 0.0, 0.0}} }} );
+      Assert( lhsinv.size() == nelem, "Size mismatch in least-squares lhs" );
+
+      // allocate and initialize vector for reconstruction
       std::vector< std::vector< std::array< tk::real, 3 > > >
         rhs_ls( nelem, std::vector< std::array< tk::real, 3 > >
           ( m_ncomp,
             {{ 0.0, 0.0, 0.0 }} ) );
 
-      // reconstruct x,y,z-derivatives of unknowns
-      // 0. get lhs matrix, which is only geometry dependent
-      tk::lhsLeastSq_P0P1(fd, geoElem, geoFace, lhs_ls);
+      // reconstruct x,y,z-derivatives of unknowns, the inverse of the lhs
+      // matrix, which is only geometry dependent, is given in lhsinv
 
       // 1. internal face contributions
       tk::intLeastSq_P0P1( m_ncomp, m_offset, rdof, fd, geoElem, U, rhs_ls );
@@ -184,7 +178,7 @@ class CompFlow {
           b.first, fd, geoFace, geoElem, t, b.second, P, U, rhs_ls );
 
       // 3. solve 3x3 least-squares system
-      tk::solveLeastSq_P0P1( m_ncomp, m_offset, rdof, lhs_ls, rhs_ls, U );
+      tk::solveLeastSq_P0P1( m_ncomp, m_offset, rdof, lhsinv, rhs_ls, U );
 
       // 4. transform reconstructed derivatives to Dubiner dofs
       tk::transform_P0P1( m_ncomp, m_offset, rdof, nelem, inpoel, coord, U );
@@ -198,6 +192,7 @@ class CompFlow {
     //! \param[in] inpoel Element-node connectivity
     //! \param[in] coord Array of nodal coordinates
     //! \param[in] ndofel Vector of local number of degrees of freedome
+    //! \param[in] troubled Ids of elements to limit
     //! \param[in,out] U Solution vector at recent time step
     void limit( [[maybe_unused]] tk::real t,
                 [[maybe_unused]] const tk::Fields& geoFace,
@@ -207,15 +202,16 @@ class CompFlow {
                 const std::vector< std::size_t >& inpoel,
                 const tk::UnsMesh::Coords& coord,
                 const std::vector< std::size_t >& ndofel,
+                const std::vector< std::size_t >& troubled,
                 tk::Fields& U,
                 tk::Fields& ) const
     {
       const auto limiter = g_inputdeck.get< tag::discr, tag::limiter >();
 
       if (limiter == ctr::LimiterType::WENOP1)
-        WENO_P1( fd.Esuel(), m_offset, U );
+        WENO_P1( fd.Esuel(), troubled, m_offset, U );
       else if (limiter == ctr::LimiterType::SUPERBEEP1)
-        Superbee_P1( fd.Esuel(), inpoel, ndofel, m_offset, coord, U );
+        Superbee_P1( fd.Esuel(), inpoel, ndofel, troubled, m_offset, coord, U );
     }
 
     //! Compute right hand side
@@ -228,6 +224,8 @@ class CompFlow {
     //! \param[in] U Solution vector at recent time step
     //! \param[in] P Primitive vector at recent time step
     //! \param[in] ndofel Vector of local number of degrees of freedom
+    //! \param[in] elems Element ids bucketed by their local number of dofs
+    //! \param[in] part Part of the right hand side to compute, see RhsPart
     //! \param[in,out] R Right-hand side vector computed
     void rhs( tk::real t,
               const tk::Fields& geoFace,
@@ -238,6 +236,8 @@ class CompFlow {
               const tk::Fields& U,
               const tk::Fields& P,
               const std::vector< std::size_t >& ndofel,
+              const tk::NdofBuckets& elems,
+              inciter::RhsPart part,
               tk::Fields& R ) const
     {
       const auto ndof = g_inputdeck.get< tag::discr, tag::ndof >();
@@ -256,8 +256,12 @@ class CompFlow {
       Assert( fd.Inpofa().size()/3 == fd.Esuf().size()/2,
               "Mismatch in inpofa size" );
 
+      // The terms not depending on ghost data are computed with the faces
+      // whose both elements are owned, the rhs is also zeroed at that point
+      const auto own = part != inciter::RhsPart::CHBND;
+
       // set rhs to zero
-      R.fill(0.0);
+      if (own) R.fill(0.0);
 
       // empty vector for non-conservative terms. This vector is unused for
       // single-material hydrodynamics since, there are no non-conservative
@@ -270,22 +274,30 @@ class CompFlow {
                 const std::array< std::vector< tk::real >, 2 >& u,
                 const std::vector< std::array< tk::real, 3 > >& v )
               { return m_riemann.flux( fn, u, v ); };
+      // configure batched Riemann flux function
+      auto rieflxbatchfn =
+        [this]( const tk::RiemannBatch& b,
+                std::vector< std::vector< tk::real > >& flx )
+              { m_riemann.fluxes( b, flx ); };
       // configure a no-op lambda for prescribed velocity
       auto velfn = [this]( ncomp_t, ncomp_t, tk::real, tk::real, tk::real ){
         return std::vector< std::array< tk::real, 3 > >( m_ncomp ); };
 
       // compute internal surface flux integrals
       tk::surfInt( m_system, 1, m_offset, ndof, rdof, inpoel, coord,
-                   fd, geoFace, rieflxfn, velfn, U, P, ndofel, R, riemannDeriv );
+                   fd, part, rieflxbatchfn, velfn, U, P, ndofel, R,
+                   riemannDeriv );
+
+      if (!own) return;
 
       // compute ptional source term
-      tk::srcInt( m_system, m_offset, t, ndof, fd.Esuel().size()/4,
-                  inpoel, coord, geoElem, Problem::src, ndofel, R );
+      tk::srcInt( m_system, m_offset, t, ndof, elems, inpoel, coord, geoElem,
+                  Problem::src, R );
 
       if(ndof > 1)
         // compute volume integrals
-        tk::volInt( m_system, m_ncomp, m_offset, ndof, fd.Esuel().size()/4,
-                    inpoel, coord, geoElem, flux, velfn, U, ndofel, R );
+        tk::volInt( m_system, m_ncomp, m_offset, ndof, elems, inpoel, coord,
+                    geoElem, flux, velfn, U, R );
 
       // compute boundary surface flux integrals
       for (const auto& b : m_bc)
@@ -302,6 +314,8 @@ class CompFlow {
     //! \param[in] geoElem Element geometry array
     //! \param[in] ndofel Vector of local number of degrees of freedom
     //! \param[in] U Solution vector at recent time step
+    //! \param[in,out] dte Time step size of each element, lowered to the time
+    //!   step size allowed by this PDE system for internal elements
     //! \return Minimum time step size
     tk::real dt( const std::array< std::vector< tk::real >, 3 >& coord,
                  const std::vector< std::size_t >& inpoel,
@@ -311,7 +325,8 @@ class CompFlow {
                  const std::vector< std::size_t >& ndofel,
                  const tk::Fields& U,
                  const tk::Fields&,
-                 const std::size_t /*nielem*/ ) const
+                 const std::size_t /*nielem*/,
+                 std::vector< tk::real >& dte ) const
     {
       const auto rdof = g_inputdeck.get< tag::discr, tag::rdof >();
 
@@ -424,9 +439,9 @@ class CompFlow {
           v = ugp[0][2]/rho;
           w = ugp[0][3]/rho;
           rhoE = ugp[0][4];
-          p = eos_pressure< tag::compflow >( m_system, rho, u, v, w, rhoE );
+          p = eos_pressure( m_mat, rho, u, v, w, rhoE );
 
-          a = eos_soundspeed< tag::compflow >( m_system, rho, p );
+          a = eos_soundspeed( m_mat, rho, p );
 
           vn = u*geoFace(f,1,0) + v*geoFace(f,2,0) + w*geoFace(f,3,0);
 
@@ -483,8 +498,8 @@ class CompFlow {
             v = ugp[1][2]/rho;
             w = ugp[1][3]/rho;
             rhoE = ugp[1][4];
-            p = eos_pressure< tag::compflow >( m_system, rho, u, v, w, rhoE );
-            a = eos_soundspeed< tag::compflow >( m_system, rho, p );
+            p = eos_pressure( m_mat, rho, u, v, w, rhoE );
+            a = eos_soundspeed( m_mat, rho, p );
 
             vn = u*geoFace(f,1,0) + v*geoFace(f,2,0) + w*geoFace(f,3,0);
 
@@ -514,7 +529,9 @@ class CompFlow {
 
         // Scale smallest dt with CFL coefficient and the CFL is scaled by (2*p+1)
         // where p is the order of the DG polynomial by linear stability theory.
-        mindt = std::min( mindt, geoElem(e,0,0)/ (delt[e] * (2.0*dgp + 1.0)) );
+        auto edt = geoElem(e,0,0) / (delt[e] * (2.0*dgp + 1.0));
+        dte[e] = std::min( dte[e], edt );
+        mindt = std::min( mindt, edt );
       }
 
       return mindt;
@@ -545,8 +562,11 @@ class CompFlow {
 
     //! Return field names to be output to file
     //! \return Vector of strings labelling fields output in file
-    std::vector< std::string > fieldNames() const
-    { return m_problem.fieldNames( m_ncomp ); }
+    std::vector< std::string > fieldNames() const {
+      auto n = m_problem.fieldNames( m_ncomp );
+      CompFlowSelectFields( n );
+      return CompFlowSystemNames( m_system, std::move(n) );
+    }
 
     //! Return field names to be output to file
     //! \return Vector of strings labelling fields output in file
@@ -558,7 +578,7 @@ class CompFlow {
     //! \param[in] V Total mesh volume
     //! \param[in] nunk Number of unknowns to extract
     //! \param[in] geoElem Element geometry array
-    //! \param[in,out] U Solution vector at recent time step
+    //! \param[in] U Solution vector at recent time step
     //! \return Vector of vectors to be output to file
     std::vector< std::vector< tk::real > >
     fieldOutput( tk::real t,
@@ -566,14 +586,17 @@ class CompFlow {
                  std::size_t,
                  std::size_t nunk,
                  const tk::Fields& geoElem,
-                 tk::Fields& U,
+                 const tk::Fields& U,
                  const tk::Fields& ) const
     {
       std::array< std::vector< tk::real >, 3 > coord{
         geoElem.extract(1,0), geoElem.extract(2,0), geoElem.extract(3,0) };
 
-      return m_problem.fieldOutput( m_system, m_ncomp, m_offset, nunk, t, V,
-                                    geoElem.extract(0,0), coord, U );
+      auto n = m_problem.fieldNames( m_ncomp );
+      auto f = m_problem.fieldOutput( m_system, m_ncomp, m_offset, nunk, t, V,
+                                      geoElem.extract(0,0), coord, U );
+      CompFlowSelectFields( n, f );
+      return f;
     }
 
     //! Nodal field output setup will go here
@@ -594,7 +617,7 @@ class CompFlow {
     //! Return surface field output going to file
     std::vector< std::vector< tk::real > >
     surfOutput( const std::map< int, std::vector< std::size_t > >&,
-                tk::Fields& ) const
+                const tk::Fields& ) const
     {
       std::vector< std::vector< tk::real > > s; // punt for now
       return s;
@@ -630,6 +653,8 @@ class CompFlow {
     const ncomp_t m_ncomp;
     //! Offset PDE system operates from
     const ncomp_t m_offset;
+    //! Material constants of the equation of state
+    const EoSParam m_mat;
     //! Riemann solver
     RiemannSolver m_riemann;
     //! BC configuration
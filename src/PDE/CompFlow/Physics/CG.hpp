@@ -23,6 +23,11 @@
       which returns the enum value of the option from the underlying option
       class, collecting all possible options for Physics policies.
 
+    - Must define a constructor taking the equation system index.
+
+    - Must define the function _viscousFlux()_, adding the viscous and heat
+      conduction fluxes to the flux in an edge, used by ALECG.
+
     - Must define the function _viscousRhs()_, adding the viscous terms
       to the right hand side.
 
@@ -21,6 +21,7 @@
 #include <limits>
 
 #include "Types.hpp"
+#include "Fields.hpp"
 #include "Inciter/Options/Physics.hpp"
 #include "Inciter/InputDeck/InputDeck.hpp"
 
@@ -35,6 +36,19 @@ namespace cg {
 class CompFlowPhysicsEuler {
 
   public:
+    //! Constructor
+    explicit CompFlowPhysicsEuler( std::size_t ) {}
+
+    //! Add viscous and heat conduction fluxes in an edge to its flux (no-op)
+    void
+    viscousFlux( std::size_t,
+                 std::size_t,
+                 const std::array< std::vector< tk::real >, 3 >&,
+                 const std::array< tk::real, 3 >&,
+                 const tk::Fields&,
+                 const tk::ReducedFields&,
+                 tk::real* ) const {}
+
     //! Add viscous stress contribution to momentum and energy rhs (no-op)
     void
     viscousRhs( tk::real,
@@ -23,6 +23,7 @@
 
 #include "Types.hpp"
 #include "Fields.hpp"
+#include "Vector.hpp"
 #include "Inciter/Options/Physics.hpp"
 #include "Inciter/InputDeck/InputDeck.hpp"
 
@@ -38,6 +39,72 @@ namespace cg {
 class CompFlowPhysicsNavierStokes {
 
   public:
+    //! Constructor
+    //! \param[in] c Equation system index
+    explicit CompFlowPhysicsNavierStokes( std::size_t c ) :
+      m_mu( g_inputdeck.get< tag::param, tag::compflow, tag::mu >()[c][0] ),
+      m_cv( g_inputdeck.get< tag::param, tag::compflow, tag::cv >()[c][0] ),
+      m_k( g_inputdeck.get< tag::param, tag::compflow, tag::k >()[c][0] ),
+      m_kcv( m_k / m_cv )
+    {}
+
+    //! Add viscous and heat conduction fluxes in an edge to its flux
+    //! \param[in] p Left node id of edge-end
+    //! \param[in] q Right node id of edge-end
+    //! \param[in] coord Mesh node coordinates
+    //! \param[in] n Dual-face normal of the edge, oriented from p to q
+    //! \param[in] W Primitive variables (density, velocity, specific internal
+    //!   energy) at recent time step
+    //! \param[in] G Nodal gradients of the primitive variables
+    //! \param[in,out] f Flux in edge, 5 components, from which the viscous
+    //!   and heat conduction fluxes are subtracted
+    //! \details The gradients of velocity and temperature in the edge are the
+    //!   averages of the nodal gradients whose component along the edge is
+    //!   replaced by the difference of the edge-end values, which couples the
+    //!   edge-end points directly and avoids odd-even decoupling. This only
+    //!   needs data already loaded for the inviscid edge flux, so it is
+    //!   computed in the same pass over the edges.
+    void
+    viscousFlux( std::size_t p,
+                 std::size_t q,
+                 const std::array< std::vector< tk::real >, 3 >& coord,
+                 const std::array< tk::real, 3 >& n,
+                 const tk::Fields& W,
+                 const tk::ReducedFields& G,
+                 tk::real* f ) const
+    {
+      const auto& x = coord[0];
+      const auto& y = coord[1];
+      const auto& z = coord[2];
+
+      // edge vector
+      std::array< tk::real, 3 > d{ x[q]-x[p], y[q]-y[p], z[q]-z[p] };
+      auto l2 = tk::dot( d, d );
+
+      // edge gradients of velocity (0-2) and specific internal energy (3)
+      std::array< std::array< tk::real, 3 >, 4 > g;
+      for (std::size_t c=0; c<4; ++c) {
+        for (std::size_t j=0; j<3; ++j)
+          g[c][j] = 0.5*(G(p,(c+1)*3+j,0) + G(q,(c+1)*3+j,0));
+        auto corr = (W(q,c+1,0) - W(p,c+1,0) - tk::dot(g[c],d)) / l2;
+        for (std::size_t j=0; j<3; ++j) g[c][j] += corr*d[j];
+      }
+      auto div = g[0][0] + g[1][1] + g[2][2];
+
+      // viscous stress times normal, and its work, at the edge midpoint
+      tk::real work = 0.0;
+      for (std::size_t i=0; i<3; ++i) {
+        tk::real t = -2.0/3.0*m_mu*div*n[i];
+        for (std::size_t j=0; j<3; ++j)
+          t += m_mu*(g[i][j] + g[j][i])*n[j];
+        f[i+1] -= t;
+        work += 0.5*(W(p,i+1,0) + W(q,i+1,0))*t;
+      }
+
+      // heat conduction, T = e/cv
+      f[4] -= work + m_kcv*tk::dot( g[3], n );
+    }
+
     //! Add viscous stress contribution to momentum and energy rhs
     void
     viscousRhs( tk::real dt,
@@ -72,6 +139,16 @@ class CompFlowPhysicsNavierStokes {
     //! Return phsyics type
     static ctr::PhysicsType type() noexcept
     { return ctr::PhysicsType::NAVIERSTOKES; }
+
+  private:
+    //! Dynamic viscosity
+    const tk::real m_mu;
+    //! Specific heat at constant volume
+    const tk::real m_cv;
+    //! Thermal conductivity
+    const tk::real m_k;
+    //! Thermal conductivity divided by the specific heat at constant volume
+    const tk::real m_kcv;
 };
 
 } // cg::
@@ -11,6 +11,9 @@
 */
 // *****************************************************************************
 
+#include <array>
+#include <algorithm>
+
 #include "FieldOutput.hpp"
 #include "EoS/EoS.hpp"
 #include "ContainerUtil.hpp"
@@ -18,29 +21,94 @@
 
 namespace inciter {
 
+namespace {
+
+//! Names of all fields output by CompFlowFieldOutput()
+const std::array< std::string, 6 > compflow_fields{{
+  "density_numerical", "x-velocity_numerical", "y-velocity_numerical",
+  "z-velocity_numerical", "specific_total_energy_numerical",
+  "pressure_numerical" }};
+
+} // ::
+
 std::vector< std::string > CompFlowFieldNames()
 // *****************************************************************************
 // Return field names to be output to file
 //! \return Vector of strings labelling fields output in file
+//! \details Only the fields selected in the input deck are returned, see
+//!   InputDeck::outvar().
 // *****************************************************************************
 {
   std::vector< std::string > n;
 
-  n.push_back( "density_numerical" );
-  n.push_back( "x-velocity_numerical" );
-  n.push_back( "y-velocity_numerical" );
-  n.push_back( "z-velocity_numerical" );
-  n.push_back( "specific_total_energy_numerical" );
-  n.push_back( "pressure_numerical" );
+  for (const auto& f : compflow_fields)
+    if (g_inputdeck.outvar( f )) n.push_back( f );
+
+  return n;
+}
 
+std::vector< std::string >
+CompFlowSystemNames( ncomp_t system, std::vector< std::string > n )
+// *****************************************************************************
+//  Distinguish output names of a system among multiple compflow systems
+//! \param[in] system Equation system index, i.e., which compressible
+//!   flow equation system we operate on among the systems of PDEs
+//! \param[in] n Output names of the system
+//! \return Output names prefixed by the dependent variable of the system and
+//!   '_' if multiple compflow systems are integrated, e.g., the members of an
+//!   ensemble sharing the mesh, unchanged if a single one
+// *****************************************************************************
+{
+  if (g_inputdeck.get< tag::component, tag::compflow >().size() > 1) {
+    const auto v =
+      g_inputdeck.get< tag::param, tag::compflow, tag::depvar >().at(system);
+    for (auto& s : n) s = v + ('_' + s);
+  }
   return n;
 }
 
-std::vector< std::vector< tk::real > > 
+void
+CompFlowSelectFields( std::vector< std::string >& n,
+                      std::vector< std::vector< tk::real > >& f )
+// *****************************************************************************
+//  Remove fields not selected for output
+//! \param[in,out] n Field names, without the system prefix
+//! \param[in,out] f Fields, one per name
+//! \details This removes the fields, e.g., analytic solutions, appended by
+//!   the problems to those of CompFlowFieldOutput(), which has already only
+//!   computed the fields selected in the input deck.
+// *****************************************************************************
+{
+  Assert( n.size() == f.size(), "Size mismatch" );
+  std::size_t j = 0;
+  for (std::size_t i=0; i<n.size(); ++i)
+    if (g_inputdeck.outvar( n[i] )) {
+      if (j != i) {
+        n[j] = std::move( n[i] );
+        f[j] = std::move( f[i] );
+      }
+      ++j;
+    }
+  n.resize( j );
+  f.resize( j );
+}
+
+void
+CompFlowSelectFields( std::vector< std::string >& n )
+// *****************************************************************************
+//  Remove field names not selected for output
+//! \param[in,out] n Field names, without the system prefix
+// *****************************************************************************
+{
+  n.erase( std::remove_if( begin(n), end(n), []( const std::string& s ){
+             return !g_inputdeck.outvar( s ); } ), end(n) );
+}
+
+std::vector< std::vector< tk::real > >
 CompFlowFieldOutput( ncomp_t system,
                      ncomp_t offset,
                      std::size_t nunk,
-                     tk::Fields& U )
+                     const tk::Fields& U )
 // *****************************************************************************
 //  Return field output going to file
 //! \param[in] system Equation system index, i.e., which compressible
@@ -49,49 +117,44 @@ CompFlowFieldOutput( ncomp_t system,
 //!   PDEs among other systems
 //! \param[in] nunk Number of unknowns to extract
 //! \param[in] U Solution vector at recent time step
-//! \return Vector of vectors to be output to file
+//! \return Vector of vectors to be output to file, only those selected in
+//!   the input deck, in the order of CompFlowFieldNames()
+//! \details All fields selected are computed in a single pass over the
+//!   unknowns, reading the conserved variables once, and written directly
+//!   into the output vectors.
 // *****************************************************************************
 {
   // number of degree of freedom
   const std::size_t rdof = g_inputdeck.get< tag::discr, tag::rdof >();
 
-  std::vector< std::vector< tk::real > > out;
-  const auto r  = U.extract( 0*rdof, offset );
-  const auto ru = U.extract( 1*rdof, offset );
-  const auto rv = U.extract( 2*rdof, offset );
-  const auto rw = U.extract( 3*rdof, offset );
-  const auto re = U.extract( 4*rdof, offset );
-
-  out.push_back( r );
-
-  Assert( r.size() >= nunk, "Size mismatch" );
-
-  std::vector< tk::real > u = ru;
-  Assert( u.size() >= nunk, "Size mismatch" );
-  for (std::size_t i=0; i<nunk; ++i) u[i] /= r[i];
-  out.push_back( u );
-
-  std::vector< tk::real > v = rv;
-  Assert( v.size() >= nunk, "Size mismatch" );
-  for (std::size_t i=0; i<nunk; ++i) v[i] /= r[i];
-  out.push_back( v );
+  Assert( U.nunk() >= nunk, "Size mismatch" );
 
-  std::vector< tk::real > w = rw;
-  Assert( w.size() >= nunk, "Size mismatch" );
-  for (std::size_t i=0; i<nunk; ++i) w[i] /= r[i];
-  out.push_back( w );
-
-  std::vector< tk::real > E = re;
-  Assert( E.size() >= nunk, "Size mismatch" );
-  for (std::size_t i=0; i<nunk; ++i) E[i] /= r[i];
-  out.push_back( E );
+  // allocate fields selected, null pointers to those not output
+  std::vector< std::vector< tk::real > > out;
+  out.reserve( compflow_fields.size() );
+  std::array< bool, 6 > sel;
+  for (std::size_t k=0; k<compflow_fields.size(); ++k) {
+    sel[k] = g_inputdeck.outvar( compflow_fields[k] );
+    if (sel[k]) out.emplace_back( nunk );
+  }
+  std::array< tk::real*, 6 > f;
+  for (std::size_t k=0, j=0; k<compflow_fields.size(); ++k)
+    f[k] = sel[k] ? out[ j++ ].data() : nullptr;
 
-  std::vector< tk::real > P( nunk, 0.0 );
   for (std::size_t i=0; i<nunk; ++i) {
-    P[i] = eos_pressure< tag::compflow >
-             ( system, r[i], u[i], v[i], w[i], r[i]*E[i] );
+    const auto r = U( i, 0*rdof, offset );
+    const auto u = U( i, 1*rdof, offset ) / r;
+    const auto v = U( i, 2*rdof, offset ) / r;
+    const auto w = U( i, 3*rdof, offset ) / r;
+    const auto E = U( i, 4*rdof, offset ) / r;
+    if (f[0]) f[0][i] = r;
+    if (f[1]) f[1][i] = u;
+    if (f[2]) f[2][i] = v;
+    if (f[3]) f[3][i] = w;
+    if (f[4]) f[4][i] = E;
+    if (f[5])
+      f[5][i] = eos_pressure< tag::compflow >( system, r, u, v, w, r*E );
   }
-  out.push_back( P );
 
   return out;
 }
@@ -118,7 +181,7 @@ std::vector< std::string > CompFlowSurfNames()
 std::vector< std::vector< tk::real > >
 CompFlowSurfOutput( ncomp_t system,
                     const std::map< int, std::vector< std::size_t > >& bnd,
-                    tk::Fields& U )
+                    const tk::Fields& U )
 // *****************************************************************************
 //  Return surface field output going to file
 //! \param[in] system Equation system index, i.e., which compressible
@@ -199,9 +262,11 @@ CompFlowHistOutput( ncomp_t system,
     auto e = p.get< tag::elem >();        // host element id
     const auto& n = p.get< tag::fn >();   // shapefunctions evaluated at point
     out[j].resize( 6, 0.0 );
+    Assert( U.nprop() == 5, "Size mismatch" );
     for (std::size_t i=0; i<4; ++i) {
-      const auto u = U.extract( inpoel[e*4+i] );
-      Assert( u.size() == 5, "Size mismatch" );
+      const auto N = inpoel[e*4+i];
+      const std::array< tk::real, 5 >
+        u{{ U(N,0,0), U(N,1,0), U(N,2,0), U(N,3,0), U(N,4,0) }};
       out[j][0] += n[i] * u[0];
       out[j][1] += n[i] * u[1]/u[0];
       out[j][2] += n[i] * u[2]/u[0];
@@ -30,18 +30,31 @@ std::vector< std::string > CompFlowSurfNames();
 //! Return time history field names to be output to file
 std::vector< std::string > CompFlowHistNames();
 
+//! Distinguish output names of a system among multiple compflow systems
+std::vector< std::string >
+CompFlowSystemNames( ncomp_t system, std::vector< std::string > n );
+
+//! Remove fields not selected for output
+void
+CompFlowSelectFields( std::vector< std::string >& n,
+                      std::vector< std::vector< tk::real > >& f );
+
+//! Remove field names not selected for output
+void
+CompFlowSelectFields( std::vector< std::string >& n );
+
 //! Return field output going to file
 std::vector< std::vector< tk::real > > 
 CompFlowFieldOutput( ncomp_t system,
                      ncomp_t offset,
                      std::size_t nunk,
-                     tk::Fields& U );
+                     const tk::Fields& U );
 
 //! Return surface field output going to file
 std::vector< std::vector< tk::real > >
 CompFlowSurfOutput( ncomp_t system,
                     const std::map< int, std::vector< std::size_t > >& bnd,
-                    tk::Fields& U );
+                    const tk::Fields& U );
 
 //! Return time history field output evaluated at time history points
 std::vector< std::vector< tk::real > >
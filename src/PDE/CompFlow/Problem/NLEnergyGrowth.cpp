@@ -138,7 +138,7 @@ CompFlowProblemNLEnergyGrowth::fieldOutput(
   tk::real V,
   const std::vector< tk::real >& vol,
   const std::array< std::vector< tk::real >, 3 >& coord,
-  tk::Fields& U ) const
+  const tk::Fields& U ) const
 // *****************************************************************************
 //  Return field output going to file
 //! \param[in] system Equation system index, i.e., which compressible
@@ -85,7 +85,7 @@ CompFlowProblemSheddingFlow::fieldOutput(
   tk::real,
   const std::vector< tk::real >&,
   const std::array< std::vector< tk::real >, 3 >&,
-  tk::Fields& U ) const
+  const tk::Fields& U ) const
 // *****************************************************************************
 //  Return field output going to file
 //! \param[in] system Equation system index, i.e., which compressible
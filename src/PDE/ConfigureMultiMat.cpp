@@ -116,6 +116,12 @@ infoMultiMat( std::map< ctr::PDEType, tk::ctr::ncomp_t >& cnt )
   nfo.emplace_back( "material stiffness", parameters(
     g_inputdeck.get< tag::param, eq, tag::pstiff >()[c] ) );
 
+  // Tabulated equations of state are optional: the inner vector may be empty
+  const auto& eostable = g_inputdeck.get< tag::param, eq, tag::eostable >();
+  if (eostable.size() > c && !eostable[c].empty())
+    nfo.emplace_back( "tabulated equation of state", parameters(
+      eostable[c] ) );
+
   return nfo;
 }
 
@@ -32,6 +32,8 @@
 #include "UnsMesh.hpp"
 #include "Inciter/InputDeck/InputDeck.hpp"
 #include "FunctionPrototypes.hpp"
+#include "PerfCounter.hpp"
+#include "Integrate/Basis.hpp"
 
 namespace inciter {
 
@@ -125,17 +127,13 @@ class DGPDE {
     { return self->nprim(); }
 
     //! Public interface to setting the initial conditions for the diff eq
-    void initialize( const tk::Fields& L,
+    void initialize( const tk::Fields& geoElem,
                      const std::vector< std::size_t >& inpoel,
                      const tk::UnsMesh::Coords& coord,
                      tk::Fields& unk,
                      tk::real t,
                      const std::size_t nielem ) const
-    { self->initialize( L, inpoel, coord, unk, t, nielem ); }
-
-    //! Public interface to computing the left-hand side matrix for the diff eq
-    void lhs( const tk::Fields& geoElem, tk::Fields& l ) const
-    { self->lhs( geoElem, l ); }
+    { self->initialize( geoElem, inpoel, coord, unk, t, nielem ); }
 
     //! Public interface to updating the primitives for the diff eq
     void updatePrimitives( const tk::Fields& unk,
@@ -155,6 +153,8 @@ class DGPDE {
                       const tk::Fields& geoFace,
                       const tk::Fields& geoElem,
                       const inciter::FaceData& fd,
+                      const std::vector< std::array<
+                        std::array< tk::real, 3 >, 3 > >& lhsinv,
                       const std::map< std::size_t, std::vector< std::size_t > >&
                         esup,
                       const std::vector< std::size_t >& inpoel,
@@ -162,7 +162,10 @@ class DGPDE {
                       tk::Fields& U,
                       tk::Fields& P ) const
     {
-      self->reconstruct( t, geoFace, geoElem, fd, esup, inpoel, coord, U, P );
+      static const auto region = tk::perfRegion( "DGPDE::reconstruct" );
+      tk::PerfRegion pr( region );
+      self->reconstruct( t, geoFace, geoElem, fd, lhsinv, esup, inpoel, coord,
+                         U, P );
     }
 
     //! Public interface to limiting the second-order solution
@@ -174,10 +177,14 @@ class DGPDE {
                 const std::vector< std::size_t >& inpoel,
                 const tk::UnsMesh::Coords& coord,
                 const std::vector< std::size_t >& ndofel,
+                const std::vector< std::size_t >& troubled,
                 tk::Fields& U,
                 tk::Fields& P ) const
     {
-      self->limit( t, geoFace, geoElem, fd, esup, inpoel, coord, ndofel, U, P );
+      static const auto region = tk::perfRegion( "DGPDE::limit" );
+      tk::PerfRegion pr( region );
+      self->limit( t, geoFace, geoElem, fd, esup, inpoel, coord, ndofel,
+                   troubled, U, P );
     }
 
     //! Public interface to computing the P1 right-hand side vector
@@ -190,9 +197,12 @@ class DGPDE {
               const tk::Fields& U,
               const tk::Fields& P,
               const std::vector< std::size_t >& ndofel,
+              const tk::NdofBuckets& elems,
+              inciter::RhsPart part,
               tk::Fields& R ) const
     {
-      self->rhs( t, geoFace, geoElem, fd, inpoel, coord, U, P, ndofel, R );
+      self->rhs( t, geoFace, geoElem, fd, inpoel, coord, U, P, ndofel, elems,
+                 part, R );
     }
 
     //! Public interface for computing the minimum time step size
@@ -204,8 +214,10 @@ class DGPDE {
                  const std::vector< std::size_t >& ndofel,
                  const tk::Fields& U,
                  const tk::Fields& P,
-                 const std::size_t nielem ) const
-    { return self->dt( coord, inpoel, fd, geoFace, geoElem, ndofel, U, P, nielem ); }
+                 const std::size_t nielem,
+                 std::vector< tk::real >& dte ) const
+    { return self->dt( coord, inpoel, fd, geoFace, geoElem, ndofel, U, P,
+                       nielem, dte ); }
 
     //! Public interface to returning field output labels
     std::vector< std::string > fieldNames() const { return self->fieldNames(); }
@@ -224,7 +236,7 @@ class DGPDE {
       std::size_t rdof,
       std::size_t nunk,
       const tk::Fields& geoElem,
-      tk::Fields& U,
+      const tk::Fields& U,
       const tk::Fields& P ) const
     { return self->fieldOutput( t, V, rdof, nunk, geoElem, U, P ); }
 
@@ -245,7 +257,7 @@ class DGPDE {
     //! Public interface to returning surface field output
     std::vector< std::vector< tk::real > >
     surfOutput( const std::map< int, std::vector< std::size_t > >& bnd,
-                tk::Fields& U ) const
+                const tk::Fields& U ) const
     { return self->surfOutput( bnd, U ); }
 
     //! Public interface to returning analytic solution
@@ -278,7 +290,6 @@ class DGPDE {
                                tk::Fields&,
                                tk::real,
                                const std::size_t nielem ) const = 0;
-      virtual void lhs( const tk::Fields&, tk::Fields& ) const = 0;
       virtual void updatePrimitives( const tk::Fields&,
                                      tk::Fields&,
                                      std::size_t ) const = 0;
@@ -290,6 +301,8 @@ class DGPDE {
                                 const tk::Fields&,
                                 const tk::Fields&,
                                 const inciter::FaceData&,
+                                const std::vector< std::array<
+                                  std::array< tk::real, 3 >, 3 > >&,
                                 const std::map< std::size_t,
                                   std::vector< std::size_t > >&,
                                 const std::vector< std::size_t >&,
@@ -305,6 +318,7 @@ class DGPDE {
                           const std::vector< std::size_t >&,
                           const tk::UnsMesh::Coords&,
                           const std::vector< std::size_t >&,
+                          const std::vector< std::size_t >&,
                           tk::Fields&,
                           tk::Fields& ) const = 0;
       virtual void rhs( tk::real,
@@ -316,6 +330,8 @@ class DGPDE {
                         const tk::Fields&,
                         const tk::Fields&,
                         const std::vector< std::size_t >&,
+                        const tk::NdofBuckets&,
+                        inciter::RhsPart,
                         tk::Fields& ) const = 0;
       virtual tk::real dt( const std::array< std::vector< tk::real >, 3 >&,
                            const std::vector< std::size_t >&,
@@ -325,7 +341,8 @@ class DGPDE {
                            const std::vector< std::size_t >&,
                            const tk::Fields&,
                            const tk::Fields&,
-                           const std::size_t ) const = 0;
+                           const std::size_t,
+                           std::vector< tk::real >& ) const = 0;
       virtual std::vector< std::string > fieldNames() const = 0;
       virtual std::vector< std::string > nodalFieldNames() const = 0;
       virtual std::vector< std::string > names() const = 0;
@@ -335,7 +352,7 @@ class DGPDE {
         std::size_t,
         std::size_t,
         const tk::Fields&,
-        tk::Fields&,
+        const tk::Fields&,
         const tk::Fields& ) const = 0;
       virtual std::vector< std::vector< tk::real > > nodalFieldOutput(
         tk::real,
@@ -349,7 +366,7 @@ class DGPDE {
         const tk::Fields& ) const = 0;
       virtual std::vector< std::vector< tk::real > > surfOutput(
         const std::map< int, std::vector< std::size_t > >&,
-        tk::Fields& ) const = 0;
+        const tk::Fields& ) const = 0;
       virtual std::vector< tk::real > analyticSolution(
         tk::real xi, tk::real yi, tk::real zi, tk::real t ) const = 0;
     };
@@ -362,15 +379,13 @@ class DGPDE {
       Concept* copy() const override { return new Model( *this ); }
       std::size_t nprim() const override
       { return data.nprim(); }
-      void initialize( const tk::Fields& L,
+      void initialize( const tk::Fields& geoElem,
                        const std::vector< std::size_t >& inpoel,
                        const tk::UnsMesh::Coords& coord,
                        tk::Fields& unk,
                        tk::real t,
-                       const std::size_t nielem )
-      const override { data.initialize( L, inpoel, coord, unk, t, nielem ); }
-      void lhs( const tk::Fields& geoElem, tk::Fields& l ) const override
-      { data.lhs( geoElem, l ); }
+                       const std::size_t nielem ) const override
+      { data.initialize( geoElem, inpoel, coord, unk, t, nielem ); }
       void updatePrimitives( const tk::Fields& unk,
                              tk::Fields& prim,
                              std::size_t nielem )
@@ -384,6 +399,8 @@ class DGPDE {
                         const tk::Fields& geoFace,
                         const tk::Fields& geoElem,
                         const inciter::FaceData& fd,
+                        const std::vector< std::array<
+                          std::array< tk::real, 3 >, 3 > >& lhsinv,
                         const std::map< std::size_t,
                           std::vector< std::size_t > >& esup,
                         const std::vector< std::size_t >& inpoel,
@@ -391,7 +408,8 @@ class DGPDE {
                         tk::Fields& U,
                         tk::Fields& P ) const override
       {
-        data.reconstruct( t, geoFace, geoElem, fd, esup, inpoel, coord, U, P );
+        data.reconstruct( t, geoFace, geoElem, fd, lhsinv, esup, inpoel, coord,
+                          U, P );
       }
       void limit( tk::real t,
                   const tk::Fields& geoFace,
@@ -402,10 +420,12 @@ class DGPDE {
                   const std::vector< std::size_t >& inpoel,
                   const tk::UnsMesh::Coords& coord,
                   const std::vector< std::size_t >& ndofel,
+                  const std::vector< std::size_t >& troubled,
                   tk::Fields& U,
                   tk::Fields& P ) const override
       {
-        data.limit( t, geoFace, geoElem, fd, esup, inpoel, coord, ndofel, U, P );
+        data.limit( t, geoFace, geoElem, fd, esup, inpoel, coord, ndofel,
+                    troubled, U, P );
       }
       void rhs( tk::real t,
                 const tk::Fields& geoFace,
@@ -416,9 +436,12 @@ class DGPDE {
                 const tk::Fields& U,
                 const tk::Fields& P,
                 const std::vector< std::size_t >& ndofel,
+                const tk::NdofBuckets& elems,
+                inciter::RhsPart part,
                 tk::Fields& R ) const override
       {
-        data.rhs( t, geoFace, geoElem, fd, inpoel, coord, U, P, ndofel, R );
+        data.rhs( t, geoFace, geoElem, fd, inpoel, coord, U, P, ndofel, elems,
+                  part, R );
       }
       tk::real dt( const std::array< std::vector< tk::real >, 3 >& coord,
                    const std::vector< std::size_t >& inpoel,
@@ -428,8 +451,10 @@ class DGPDE {
                    const std::vector< std::size_t >& ndofel,
                    const tk::Fields& U,
                    const tk::Fields& P,
-                   const std::size_t nielem ) const override
-      { return data.dt( coord, inpoel, fd, geoFace, geoElem, ndofel, U, P, nielem ); }
+                   const std::size_t nielem,
+                   std::vector< tk::real >& dte ) const override
+      { return data.dt( coord, inpoel, fd, geoFace, geoElem, ndofel, U, P,
+                        nielem, dte ); }
       std::vector< std::string > fieldNames() const override
       { return data.fieldNames(); }
       std::vector< std::string > nodalFieldNames() const override
@@ -442,7 +467,7 @@ class DGPDE {
         std::size_t rdof,
         std::size_t nunk,
         const tk::Fields& geoElem,
-        tk::Fields& U,
+        const tk::Fields& U,
         const tk::Fields& P ) const override
       { return data.fieldOutput( t, V, rdof, nunk, geoElem, U, P ); }
       std::vector< std::vector< tk::real > > nodalFieldOutput(
@@ -459,7 +484,7 @@ class DGPDE {
         Pnode, U, P ); }
       std::vector< std::vector< tk::real > > surfOutput(
         const std::map< int, std::vector< std::size_t > >& bnd,
-        tk::Fields& U ) const override
+        const tk::Fields& U ) const override
       { return data.surfOutput( bnd, U ); }
       std::vector< tk::real >
       analyticSolution( tk::real xi, tk::real yi, tk::real zi, tk::real t )
@@ -7,14 +7,20 @@
              All rights reserved. See the LICENSE file for details.
   \brief     Equation of state class
   \details   This file defines functions for equations of state for the
-    compressible flow equations.
+    compressible flow equations. Materials configured with a tabulated
+    equation of state, see inciter::EoSTable, evaluate it instead of the
+    stiffened-gas equation of state.
 */
 // *****************************************************************************
 #ifndef EoS_h
 #define EoS_h
 
+#include <vector>
+#include <type_traits>
+
 #include "Data.hpp"
 #include "Inciter/InputDeck/InputDeck.hpp"
+#include "EoS/EoSTable.hpp"
 
 namespace inciter {
 
@@ -22,6 +28,79 @@ extern ctr::InputDeck g_inputdeck;
 
 using ncomp_t = kw::ncomp::info::expect::type;
 
+//! \brief Material constants of the stiffened-gas equation of state, or the
+//!   tabulated equation of state used instead
+struct EoSParam {
+  tk::real gamma;       //!< Ratio of specific heats
+  tk::real pstiff;      //!< Stiffness parameter
+  tk::real cv;          //!< Specific heat at constant volume
+  //! Tabulated equation of state, nullptr for the stiffened-gas EoS
+  const EoSTable* table = nullptr;
+};
+
+//! Query the tabulated equation of state of a material
+//! \tparam Eq Equation type to operate on, e.g., tag::compflow, tag::multimat
+//! \param[in] system Equation system index
+//! \param[in] imat Material-id who's EoS is required
+//! \return Tabulated equation of state, nullptr if the material uses the
+//!   stiffened-gas equation of state
+//! \details The tables of all systems are queried once, at the first call,
+//!   so overloads of the EoS functions that query the input deck only pay
+//!   for indexing a vector to find out which EoS to evaluate. Tabulated EoS
+//!   are only configurable for multi-material flow.
+template< class Eq >
+const EoSTable* eos_tabulated( ncomp_t system, std::size_t imat )
+{
+  if constexpr( std::is_same_v< Eq, tag::multimat > ) {
+    static const auto tables = []{
+      std::vector< std::vector< const EoSTable* > > t;
+      for (const auto& s : g_inputdeck.get< tag::param, Eq, tag::eostable >()) {
+        t.emplace_back();
+        for (const auto& f : s) t.back().push_back( eos_table( f ).get() );
+      }
+      return t;
+    }();
+    if (system < tables.size() && imat < tables[system].size())
+      return tables[system][imat];
+  }
+  return nullptr;
+}
+
+//! Query the material constants of all materials of an equation system
+//! \tparam Eq Equation type to operate on, e.g., tag::compflow, tag::multimat
+//! \param[in] system Equation system index
+//! \return Table of material constants, one entry per material
+//! \details PDE classes resolve this table once at construction and pass its
+//!   entries to the overloads of the EoS functions taking EoSParam, so hot
+//!   loops do not look up the material constants in the input deck for every
+//!   evaluation of the EoS.
+template< class Eq >
+std::vector< EoSParam > eos_params( ncomp_t system )
+{
+  const auto& g = g_inputdeck.get< tag::param, Eq, tag::gamma >()[ system ];
+  const auto& p_c = g_inputdeck.get< tag::param, Eq, tag::pstiff >()[ system ];
+  const auto& cv = g_inputdeck.get< tag::param, Eq, tag::cv >()[ system ];
+  Assert( p_c.size() == g.size() && cv.size() == g.size(),
+          "Number of material constants inconsistent" );
+
+  std::vector< EoSParam > mat( g.size() );
+  for (std::size_t k=0; k<mat.size(); ++k)
+    mat[k] = { g[k], p_c[k], cv[k], eos_tabulated< Eq >( system, k ) };
+  return mat;
+}
+
+//! \brief Calculate density from the material pressure and temperature using
+//!   the stiffened-gas equation of state with given material constants
+//! \param[in] mat Material constants
+//! \param[in] pr Material pressure
+//! \param[in] temp Material temperature
+//! \return Material density calculated using the stiffened-gas EoS
+inline tk::real eos_density( const EoSParam& mat, tk::real pr, tk::real temp )
+{
+  if (mat.table) return mat.table->density( pr, temp );
+  return (pr + mat.pstiff) / ((mat.gamma-1.0) * mat.cv * temp);
+}
+
 //! \brief Calculate density from the material pressure and temperature using
 //!   the stiffened-gas equation of state
 //! \tparam Eq Equation type to operate on, e.g., tag::compflow, tag::multimat
@@ -38,16 +117,113 @@ tk::real eos_density( ncomp_t system,
                       tk::real temp,
                       std::size_t imat=0 )
 {
-  // query input deck to get gamma, p_c
-  auto g =
-    g_inputdeck.get< tag::param, Eq, tag::gamma >()[ system ][imat];
-  auto p_c =
-    g_inputdeck.get< tag::param, Eq, tag::pstiff >()[ system ][imat];
-  auto cv =
-    g_inputdeck.get< tag::param, Eq, tag::cv >()[ system ][imat];
+  // query input deck to get gamma, p_c, cv
+  EoSParam mat{
+    g_inputdeck.get< tag::param, Eq, tag::gamma >()[ system ][imat],
+    g_inputdeck.get< tag::param, Eq, tag::pstiff >()[ system ][imat],
+    g_inputdeck.get< tag::param, Eq, tag::cv >()[ system ][imat],
+    eos_tabulated< Eq >( system, imat ) };
 
-  tk::real rho = (pr + p_c) / ((g-1.0) * cv * temp);
-  return rho;
+  return eos_density( mat, pr, temp );
+}
+
+//! \brief Calculate pressure from the material density, momentum and total
+//!   energy using the stiffened-gas equation of state with given material
+//!   constants
+//! \param[in] g Ratio of specific heats
+//! \param[in] p_c Stiffness parameter
+//! \param[in] arho Material partial density (alpha_k * rho_k)
+//! \param[in] u X-velocity
+//! \param[in] v Y-velocity
+//! \param[in] w Z-velocity
+//! \param[in] arhoE Material total energy (alpha_k * rho_k * E_k)
+//! \param[in] alpha Material volume fraction
+//! \return Material partial pressure (alpha_k * p_k) calculated using the
+//!   stiffened-gas EoS
+//! \details Hot loops that evaluate the EoS of the same material many times
+//!   can query the material constants once and call this overload, so the
+//!   input deck is not accessed in every call.
+#pragma omp declare simd
+inline tk::real eos_pressure( tk::real g,
+                              tk::real p_c,
+                              tk::real arho,
+                              tk::real u,
+                              tk::real v,
+                              tk::real w,
+                              tk::real arhoE,
+                              tk::real alpha=1.0 )
+{
+  return (arhoE - 0.5 * arho * (u*u + v*v + w*w) - alpha*p_c) * (g-1.0)
+         - alpha*p_c;
+}
+
+//! \brief Calculate pressure from the material density, momentum and total
+//!   energy using the stiffened-gas equation of state with given material
+//!   constants
+//! \param[in] mat Material constants
+//! \param[in] arho Material partial density (alpha_k * rho_k)
+//! \param[in] u X-velocity
+//! \param[in] v Y-velocity
+//! \param[in] w Z-velocity
+//! \param[in] arhoE Material total energy (alpha_k * rho_k * E_k)
+//! \param[in] alpha Material volume fraction
+//! \return Material partial pressure (alpha_k * p_k) calculated using the
+//!   stiffened-gas EoS
+inline tk::real eos_pressure( const EoSParam& mat,
+                              tk::real arho,
+                              tk::real u,
+                              tk::real v,
+                              tk::real w,
+                              tk::real arhoE,
+                              tk::real alpha=1.0 )
+{
+  if (mat.table)
+    return alpha * mat.table->pressure( arho/alpha,
+             (arhoE - 0.5 * arho * (u*u + v*v + w*w)) / arho );
+  return eos_pressure( mat.gamma, mat.pstiff, arho, u, v, w, arhoE, alpha );
+}
+
+//! \brief Calculate pressure from the density, momentum and total energy of a
+//!   batch of single-material states using the stiffened-gas equation of state
+//! \tparam In Container type of the states, indexed by state, e.g.,
+//!   std::vector< tk::real > or the views returned by tk::Data::cview()
+//! \tparam Out Container type of the pressures, indexed by state
+//! \param[in] mat Material constants
+//! \param[in] n Number of states
+//! \param[in] rho Densities
+//! \param[in] ru X-momenta
+//! \param[in] rv Y-momenta
+//! \param[in] rw Z-momenta
+//! \param[in] rE Total energies
+//! \param[in,out] p Pressures computed, must hold at least n entries
+//! \details The material constants are loaded once for the whole batch and
+//!   the loop over the states carries no dependencies, so it can be
+//!   vectorized. This also holds for a tabulated EoS, as locating the states
+//!   in the table does not branch.
+template< class In, class Out >
+void eos_pressure( const EoSParam& mat,
+                   std::size_t n,
+                   const In& rho,
+                   const In& ru,
+                   const In& rv,
+                   const In& rw,
+                   const In& rE,
+                   Out& p )
+{
+  if (mat.table) {
+    const auto& t = *mat.table;
+    #pragma omp simd
+    for (std::size_t i=0; i<n; ++i)
+      p[i] = t.pressure( rho[i], (rE[i] - 0.5 * (ru[i]*ru[i] + rv[i]*rv[i] +
+                                  rw[i]*rw[i]) / rho[i]) / rho[i] );
+    return;
+  }
+  const auto g = mat.gamma;
+  const auto p_c = mat.pstiff;
+  #pragma omp simd
+  for (std::size_t i=0; i<n; ++i)
+    p[i] = eos_pressure( g, p_c, rho[i], ru[i]/rho[i], rv[i]/rho[i],
+                         rw[i]/rho[i], rE[i] );
 }
 
 //! \brief Calculate pressure from the material density, momentum and total
@@ -78,13 +254,82 @@ tk::real eos_pressure( ncomp_t system,
                        tk::real alpha=1.0,
                        std::size_t imat=0 )
 {
+  if (auto t = eos_tabulated< Eq >( system, imat ))
+    return eos_pressure( EoSParam{ 0.0, 0.0, 0.0, t }, arho, u, v, w, arhoE,
+                         alpha );
+
   // query input deck to get gamma, p_c
   auto g = g_inputdeck.get< tag::param, Eq, tag::gamma >()[ system ][imat];
   auto p_c = g_inputdeck.get< tag::param, Eq, tag::pstiff >()[ system ][imat];
 
-  tk::real partpressure = (arhoE - 0.5 * arho * (u*u + v*v + w*w) - alpha*p_c)
-                          * (g-1.0) - alpha*p_c;
-  return partpressure;
+  return eos_pressure( g, p_c, arho, u, v, w, arhoE, alpha );
+}
+
+//! \brief Calculate speed of sound from the material density and material
+//!   pressure with given material constants
+//! \param[in] g Ratio of specific heats
+//! \param[in] p_c Stiffness parameter
+//! \param[in] arho Material partial density (alpha_k * rho_k)
+//! \param[in] apr Material partial pressure (alpha_k * p_k)
+//! \param[in] alpha Material volume fraction
+//! \return Material speed of sound using the stiffened-gas EoS
+//! \details See the overload of eos_pressure() with material constants.
+inline tk::real eos_soundspeed( tk::real g,
+                                tk::real p_c,
+                                tk::real arho,
+                                tk::real apr,
+                                tk::real alpha=1.0 )
+{
+  auto p_eff = std::max( 1.0e-15, apr+(alpha*p_c) );
+  return std::sqrt( g * p_eff / arho );
+}
+
+//! \brief Calculate speed of sound from the material density and material
+//!   pressure with given material constants
+//! \param[in] mat Material constants
+//! \param[in] arho Material partial density (alpha_k * rho_k)
+//! \param[in] apr Material partial pressure (alpha_k * p_k)
+//! \param[in] alpha Material volume fraction
+//! \return Material speed of sound using the stiffened-gas EoS
+inline tk::real eos_soundspeed( const EoSParam& mat,
+                                tk::real arho,
+                                tk::real apr,
+                                tk::real alpha=1.0 )
+{
+  if (mat.table) return mat.table->soundspeed( arho/alpha, apr/alpha );
+  return eos_soundspeed( mat.gamma, mat.pstiff, arho, apr, alpha );
+}
+
+//! \brief Calculate speed of sound from the density and pressure of a batch
+//!   of single-material states using the stiffened-gas equation of state
+//! \tparam In Container type of the states, indexed by state, e.g.,
+//!   std::vector< tk::real > or the views returned by tk::Data::cview()
+//! \tparam P Container type of the pressures, indexed by state
+//! \tparam Out Container type of the speeds of sound, indexed by state
+//! \param[in] mat Material constants
+//! \param[in] n Number of states
+//! \param[in] rho Densities
+//! \param[in] p Pressures
+//! \param[in,out] a Speeds of sound computed, must hold at least n entries
+//! \details See the batched eos_pressure().
+template< class In, class P, class Out >
+void eos_soundspeed( const EoSParam& mat,
+                     std::size_t n,
+                     const In& rho,
+                     const P& p,
+                     Out& a )
+{
+  if (mat.table) {
+    const auto& t = *mat.table;
+    #pragma omp simd
+    for (std::size_t i=0; i<n; ++i) a[i] = t.soundspeed( rho[i], p[i] );
+    return;
+  }
+  const auto g = mat.gamma;
+  const auto p_c = mat.pstiff;
+  #pragma omp simd
+  for (std::size_t i=0; i<n; ++i)
+    a[i] = eos_soundspeed( g, p_c, rho[i], p[i] );
 }
 
 //! Calculate speed of sound from the material density and material pressure
@@ -104,16 +349,38 @@ tk::real eos_soundspeed( ncomp_t system,
                          tk::real arho, tk::real apr,
                          tk::real alpha=1.0, std::size_t imat=0 )
 {
+  if (auto t = eos_tabulated< Eq >( system, imat ))
+    return t->soundspeed( arho/alpha, apr/alpha );
+
   // query input deck to get gamma, p_c
   auto g =
     g_inputdeck.get< tag::param, Eq, tag::gamma >()[ system ][imat];
   auto p_c =
     g_inputdeck.get< tag::param, Eq, tag::pstiff >()[ system ][imat];
 
-  auto p_eff = std::max( 1.0e-15, apr+(alpha*p_c) );
+  return eos_soundspeed( g, p_c, arho, apr, alpha );
+}
 
-  tk::real a = std::sqrt( g * p_eff / arho );
-  return a;
+//! \brief Calculate material specific total energy from the material density,
+//!   momentum and material pressure with given material constants
+//! \param[in] mat Material constants
+//! \param[in] rho Material density
+//! \param[in] u X-velocity
+//! \param[in] v Y-velocity
+//! \param[in] w Z-velocity
+//! \param[in] pr Material pressure
+//! \return Material specific total energy using the stiffened-gas EoS
+inline tk::real eos_totalenergy( const EoSParam& mat,
+                                 tk::real rho,
+                                 tk::real u,
+                                 tk::real v,
+                                 tk::real w,
+                                 tk::real pr )
+{
+  if (mat.table)
+    return rho * mat.table->energy( rho, pr ) + 0.5 * rho * (u*u + v*v + w*w);
+  return (pr + mat.pstiff) / (mat.gamma-1.0) + 0.5 * rho * (u*u + v*v + w*w)
+         + mat.pstiff;
 }
 
 //! \brief Calculate material specific total energy from the material density,
@@ -139,13 +406,37 @@ tk::real eos_totalenergy( ncomp_t system,
                           std::size_t imat=0 )
 {
   // query input deck to get gamma, p_c
-  auto g =
-    g_inputdeck.get< tag::param, Eq, tag::gamma >()[ system ][imat];
-  auto p_c =
-    g_inputdeck.get< tag::param, Eq, tag::pstiff >()[ system ][imat];
+  EoSParam mat{
+    g_inputdeck.get< tag::param, Eq, tag::gamma >()[ system ][imat],
+    g_inputdeck.get< tag::param, Eq, tag::pstiff >()[ system ][imat],
+    0.0, eos_tabulated< Eq >( system, imat ) };
+
+  return eos_totalenergy( mat, rho, u, v, w, pr );
+}
 
-  tk::real rhoE = (pr + p_c) / (g-1.0) + 0.5 * rho * (u*u + v*v + w*w) + p_c;
-  return rhoE;
+//! \brief Calculate material temperature from the material density, and
+//!   material specific total energy with given material constants
+//! \param[in] mat Material constants
+//! \param[in] arho Material partial density (alpha_k * rho_k)
+//! \param[in] u X-velocity
+//! \param[in] v Y-velocity
+//! \param[in] w Z-velocity
+//! \param[in] arhoE Material total energy (alpha_k * rho_k * E_k)
+//! \param[in] alpha Material volume fraction
+//! \return Material temperature using the stiffened-gas EoS
+inline tk::real eos_temperature( const EoSParam& mat,
+                                 tk::real arho,
+                                 tk::real u,
+                                 tk::real v,
+                                 tk::real w,
+                                 tk::real arhoE,
+                                 tk::real alpha=1.0 )
+{
+  if (mat.table)
+    return mat.table->temperature( arho/alpha,
+             (arhoE - 0.5 * arho * (u*u + v*v + w*w)) / arho );
+  return (arhoE - 0.5 * arho * (u*u + v*v + w*w) - alpha*mat.pstiff)
+         / (arho*mat.cv);
 }
 
 //! \brief Calculate material temperature from the material density, and
@@ -174,14 +465,13 @@ tk::real eos_temperature( ncomp_t system,
                           tk::real alpha=1.0,
                           std::size_t imat=0 )
 {
-  // query input deck to get gamma, p_c, cv
-  auto p_c =
-    g_inputdeck.get< tag::param, Eq, tag::pstiff >()[ system ][imat];
-  auto cv =
-    g_inputdeck.get< tag::param, Eq, tag::cv >()[ system ][imat];
+  // query input deck to get p_c, cv
+  EoSParam mat{ 0.0,
+    g_inputdeck.get< tag::param, Eq, tag::pstiff >()[ system ][imat],
+    g_inputdeck.get< tag::param, Eq, tag::cv >()[ system ][imat],
+    eos_tabulated< Eq >( system, imat ) };
 
-  tk::real t = (arhoE - 0.5 * arho * (u*u + v*v + w*w) - alpha*p_c) / (arho*cv);
-  return t;
+  return eos_temperature( mat, arho, u, v, w, arhoE, alpha );
 }
 
 } //inciter::
@@ -0,0 +1,136 @@
+// *****************************************************************************
+/*!
+  \file      src/PDE/EoS/EoSTable.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Tabulated equation of state
+  \details   This file defines a tabulated equation of state, see
+    EoSTable.hpp.
+*/
+// *****************************************************************************
+
+#include <map>
+#include <mutex>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <algorithm>
+
+#include "EoSTable.hpp"
+#include "Reader.hpp"
+#include "Exception.hpp"
+
+using inciter::EoSTable;
+
+EoSTable::EoSTable( const std::string& filename )
+// *****************************************************************************
+//  Constructor: read table from file
+//! \param[in] filename Name of the file to read the table from, see
+//!   kw::mat_eostable for its format
+//! \details After reading the table of (rho,e) -> (p,c,T), the table of
+//!   (rho,p) -> (e,c) is computed on a uniform grid of the same size, whose
+//!   pressures span the range of the pressures tabulated. Along each line of
+//!   constant density, e(p) is the inverse of the piecewise linear p(e), and
+//!   pressures outside of the range of the line take the energy at its ends.
+// *****************************************************************************
+{
+  // Read numbers, skipping comments
+  std::stringstream ss;
+  for (const auto& l : tk::Reader( filename ).lines())
+    if (l.find_first_not_of( " \t" ) != std::string::npos &&
+        l[ l.find_first_not_of( " \t" ) ] != '#')
+      ss << l << '\n';
+
+  std::size_t nr = 0, ne = 0;
+  std::array< tk::real, 2 > rr{{ 0.0, 0.0 }}, er{{ 0.0, 0.0 }};
+  ss >> nr >> ne >> rr[0] >> rr[1] >> er[0] >> er[1];
+  ErrChk( !ss.fail(), "Failed to read size of equation of state table '" +
+          filename + "'" );
+  ErrChk( nr > 1 && ne > 1, "Equation of state table '" + filename +
+          "' needs at least two grid points in density and energy" );
+
+  std::vector< tk::real > v( nr*ne*3 );
+  for (auto& x : v) ss >> x;
+  ErrChk( !ss.fail(), "Failed to read " + std::to_string( nr*ne ) +
+          " rows of p c T from equation of state table '" + filename + "'" );
+  m_re = tk::GridTable( 3, rr, nr, er, ne, v );
+
+  // Range of pressures tabulated, pressure must increase with energy
+  tk::real pmin = std::numeric_limits< tk::real >::max();
+  tk::real pmax = std::numeric_limits< tk::real >::lowest();
+  for (std::size_t i=0; i<nr; ++i) {
+    for (std::size_t j=0; j+1<ne; ++j)
+      ErrChk( v[(i*ne+j+1)*3] > v[(i*ne+j)*3], "Pressure in equation of "
+              "state table '" + filename + "' must increase with energy" );
+    pmin = std::min( pmin, v[i*ne*3] );
+    pmax = std::max( pmax, v[(i*ne+ne-1)*3] );
+  }
+
+  // Invert p(rho,e) along lines of constant density
+  const auto de = (er[1] - er[0]) / static_cast< tk::real >( ne-1 );
+  const auto dp = (pmax - pmin) / static_cast< tk::real >( ne-1 );
+  const auto dr = (rr[1] - rr[0]) / static_cast< tk::real >( nr-1 );
+  std::vector< tk::real > w( nr*ne*2 );
+  for (std::size_t i=0; i<nr; ++i) {
+    const auto rho = rr[0] + static_cast< tk::real >( i ) * dr;
+    std::size_t j = 0;
+    for (std::size_t m=0; m<ne; ++m) {
+      const auto p = pmin + static_cast< tk::real >( m ) * dp;
+      while (j+2 < ne && v[(i*ne+j+1)*3] <= p) ++j;
+      const auto p1 = v[(i*ne+j)*3], p2 = v[(i*ne+j+1)*3];
+      const auto s = std::min( std::max( (p-p1)/(p2-p1), 0.0 ), 1.0 );
+      const auto e = er[0] + (static_cast< tk::real >( j ) + s) * de;
+      w[(i*ne+m)*2] = e;
+      w[(i*ne+m)*2+1] = m_re.sample( rho, e, 1 );
+    }
+  }
+  m_rp = tk::GridTable( 2, rr, nr, {{ pmin, pmax }}, ne, std::move(w) );
+}
+
+tk::real
+EoSTable::density( tk::real p, tk::real T ) const
+// *****************************************************************************
+//  Density from pressure and temperature
+//! \param[in] p Material pressure
+//! \param[in] T Material temperature
+//! \return Material density whose temperature at pressure p is T
+//! \details The density is found by bisection in the range of densities
+//!   tabulated, assuming the temperature at constant pressure is monotonic in
+//!   the density. This is only intended for setting initial conditions.
+// *****************************************************************************
+{
+  auto f = [&]( tk::real rho ){ return temperature( rho, energy(rho,p) ) - T; };
+
+  auto a = m_re.xrange()[0], b = m_re.xrange()[1];
+  auto fa = f( a );
+  for (std::size_t i=0; i<100 && b-a > 1.0e-14*std::abs(b); ++i) {
+    const auto c = 0.5 * (a + b);
+    const auto fc = f( c );
+    if ((fa < 0.0) == (fc < 0.0)) { a = c; fa = fc; } else b = c;
+  }
+  return 0.5 * (a + b);
+}
+
+std::shared_ptr< const EoSTable >
+inciter::eos_table( const std::string& filename )
+// *****************************************************************************
+//  Query tabulated equation of state shared by all users in a process
+//! \param[in] filename Name of the file to read the table from
+//! \return Tabulated equation of state read from file
+//! \details A table is only read once per process, the first time it is
+//!   queried, and is shared by all PDE objects, and thus chares, of all PEs
+//!   of the process, as the tables are not modified after construction.
+//!   Tables are kept until the process exits, so users may store raw
+//!   pointers to them.
+// *****************************************************************************
+{
+  static std::mutex mutex;
+  static std::map< std::string, std::shared_ptr< const EoSTable > > tables;
+
+  std::lock_guard< std::mutex > lock( mutex );
+  auto& t = tables[ filename ];
+  if (!t) t = std::make_shared< const EoSTable >( filename );
+  return t;
+}
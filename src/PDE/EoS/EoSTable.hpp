@@ -0,0 +1,84 @@
+// *****************************************************************************
+/*!
+  \file      src/PDE/EoS/EoSTable.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Tabulated equation of state
+  \details   This file declares a tabulated equation of state, whose pressure,
+    speed of sound, and temperature are interpolated in tables of density and
+    specific internal energy, as an alternative to the analytic stiffened-gas
+    equation of state for the compressible flow equations.
+*/
+// *****************************************************************************
+#ifndef EoSTable_h
+#define EoSTable_h
+
+#include <memory>
+#include <string>
+
+#include "GridTable.hpp"
+
+namespace inciter {
+
+//! Tabulated equation of state of a material
+//! \details The pressure, speed of sound, and temperature are tabulated on a
+//!   uniform grid of density and specific internal energy, (rho,e) -> (p,c,T),
+//!   read from file. The evaluations of the EoS that start from the
+//!   pressure, i.e., the speed of sound and the total energy given the
+//!   density and the pressure, use a second table, (rho,p) -> (e,c), computed
+//!   from the first one at construction by inverting p(rho,e) along each line
+//!   of constant density, so none of the evaluations needed by the solvers
+//!   requires an iterative solve. All evaluations interpolate bilinearly
+//!   without branches and clip to the ranges tabulated.
+class EoSTable {
+
+  public:
+    //! Constructor: read table from file
+    explicit EoSTable( const std::string& filename );
+
+    //! Pressure from density and specific internal energy
+    //! \param[in] rho Material density
+    //! \param[in] e Material specific internal energy
+    //! \return Material pressure
+    tk::real pressure( tk::real rho, tk::real e ) const
+    { return m_re.sample( rho, e, 0 ); }
+
+    //! Temperature from density and specific internal energy
+    //! \param[in] rho Material density
+    //! \param[in] e Material specific internal energy
+    //! \return Material temperature
+    tk::real temperature( tk::real rho, tk::real e ) const
+    { return m_re.sample( rho, e, 2 ); }
+
+    //! Specific internal energy from density and pressure
+    //! \param[in] rho Material density
+    //! \param[in] p Material pressure
+    //! \return Material specific internal energy
+    tk::real energy( tk::real rho, tk::real p ) const
+    { return m_rp.sample( rho, p, 0 ); }
+
+    //! Speed of sound from density and pressure
+    //! \param[in] rho Material density
+    //! \param[in] p Material pressure
+    //! \return Material speed of sound
+    tk::real soundspeed( tk::real rho, tk::real p ) const
+    { return m_rp.sample( rho, p, 1 ); }
+
+    //! Density from pressure and temperature
+    tk::real density( tk::real p, tk::real T ) const;
+
+  private:
+    //! Pressure, speed of sound, and temperature as functions of (rho,e)
+    tk::GridTable m_re;
+    //! Specific internal energy and speed of sound as functions of (rho,p)
+    tk::GridTable m_rp;
+};
+
+//! Query tabulated equation of state shared by all users in a process
+std::shared_ptr< const EoSTable > eos_table( const std::string& filename );
+
+} //inciter::
+
+#endif // EoSTable_h
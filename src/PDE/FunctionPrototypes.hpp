@@ -15,6 +15,7 @@
 #ifndef FunctionPrototypes_h
 #define FunctionPrototypes_h
 
+#include <array>
 #include <vector>
 #include <functional>
 
@@ -43,6 +44,60 @@ using RiemannFluxFn = std::function<
                        const std::array< std::vector< real >, 2 >&,
                        const std::vector< std::array< real, 3 > >& ) >;
 
+//! \brief Left and right states of a batch of Riemann problems
+//! \details The data is stored as a structure of arrays, one entry per face
+//!   quadrature point i: fn[j][i] is component j of the face normal, u[0][c][i]
+//!   and u[1][c][i] are the left and right values of state component c, and
+//!   v[i] is the prescribed velocity (if any), one per scalar component.
+struct RiemannBatch {
+  std::array< std::vector< real >, 3 > fn;      //!< Face normals
+  std::array< std::vector< std::vector< real > >, 2 > u;  //!< States
+  std::vector< std::vector< std::array< real, 3 > > > v;  //!< Velocities
+
+  //! Constructor
+  //! \param[in] nu Number of state components, on each side
+  explicit RiemannBatch( std::size_t nu = 0 ) {
+    u[0].resize( nu );
+    u[1].resize( nu );
+  }
+
+  //! Number of Riemann problems in the batch
+  //! \return Number of face quadrature points in the batch
+  std::size_t size() const { return fn[0].size(); }
+
+  //! Append a Riemann problem to the batch
+  //! \param[in] n Face normal
+  //! \param[in] s Left and right state vectors
+  //! \param[in] vel Prescribed velocity
+  void push_back( const std::array< real, 3 >& n,
+                  const std::array< std::vector< real >, 2 >& s,
+                  std::vector< std::array< real, 3 > >&& vel )
+  {
+    for (std::size_t j=0; j<3; ++j) fn[j].push_back( n[j] );
+    for (std::size_t k=0; k<2; ++k) {
+      Assert( s[k].size() == u[k].size(), "Size mismatch" );
+      for (std::size_t c=0; c<s[k].size(); ++c) u[k][c].push_back( s[k][c] );
+    }
+    v.push_back( std::move(vel) );
+  }
+
+  //! Remove all Riemann problems from the batch, keeping the allocations
+  void clear() {
+    for (auto& n : fn) n.clear();
+    for (auto& s : u) for (auto& c : s) c.clear();
+    v.clear();
+  }
+};
+
+//! Function prototype for batched Riemann flux functions
+//! \details Functions of this type compute the numerical fluxes of all
+//!   Riemann problems in a batch: the flux component c of problem i is
+//!   returned in flx[c][i]. Same as RiemannFluxFn, but called once per batch
+//!   with data laid out so that the solvers can loop over the problems.
+//! \see e.g., inciter::LaxFriedrichs::fluxes, tk::batchFlux
+using RiemannBatchFluxFn = std::function<
+  void( const RiemannBatch&, std::vector< std::vector< real > >& ) >;
+
 //! Function prototype for flux vector functions
 //! \details Functions of this type are used to compute physical flux functions
 //!   in the PDEs being solved. These are different than the RiemannFluxFn
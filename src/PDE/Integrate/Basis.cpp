@@ -361,3 +361,28 @@ tk::eval_state ( ncomp_t ncomp,
 
   return state;
 }
+
+tk::NdofBuckets
+tk::bucketNdof( const std::vector< std::size_t >& ndofel, std::size_t nelem )
+// *****************************************************************************
+//  Bucket elements by their local number of degrees of freedom
+//! \param[in] ndofel Vector of local number of degrees of freedom
+//! \param[in] nelem Number of elements to bucket, the first nelem of ndofel
+//! \return Element ids bucketed by their number of degrees of freedom, in
+//!   increasing order within each bucket, see NdofBuckets
+// *****************************************************************************
+{
+  Assert( ndofel.size() >= nelem, "Size mismatch" );
+
+  NdofBuckets b;
+  for (std::size_t e=0; e<nelem; ++e) {
+    if (ndofel[e] == NdofBucket[0]) b[0].push_back( e );
+    else if (ndofel[e] == NdofBucket[1]) b[1].push_back( e );
+    else {
+      Assert( ndofel[e] == NdofBucket[2], "Unknown number of dofs" );
+      b[2].push_back( e );
+    }
+  }
+
+  return b;
+}
@@ -31,6 +31,20 @@ namespace tk {
 using ncomp_t = kw::ncomp::info::expect::type;
 using bcconf_t = kw::sideset::info::expect::type;
 
+//! \brief Element ids bucketed by their local number of degrees of freedom
+//! \details Buckets 0, 1, and 2 hold the elements with DG(P0), DG(P1), and
+//!   DG(P2), i.e., 1, 4, and 10 degrees of freedom, respectively, see
+//!   NdofBucket, so element integrals can run tight loops with a fixed number
+//!   of degrees of freedom and quadrature points over each bucket.
+using NdofBuckets = std::array< std::vector< std::size_t >, 3 >;
+
+//! Number of degrees of freedom of the elements in each of NdofBuckets
+static constexpr std::array< std::size_t, 3 > NdofBucket{{ 1, 4, 10 }};
+
+//! Bucket elements by their local number of degrees of freedom
+NdofBuckets
+bucketNdof( const std::vector< std::size_t >& ndofel, std::size_t nelem );
+
 //! Compute the coordinates of quadrature points for face integral
 std::array< tk::real, 3 >
 eval_gp ( const std::size_t igp,
@@ -72,6 +86,102 @@ eval_state ( ncomp_t ncomp,
              const Fields& U,
              const std::vector< tk::real >& B );
 
+//! \brief Derivatives of the first NDOF basis functions in physical space
+//! \details Index as dBdx[j][k]: derivative of basis function k with respect
+//!   to physical coordinate j.
+template< std::size_t NDOF >
+using BasisDerivs = std::array< std::array< tk::real, NDOF >, 3 >;
+
+//! \brief Compute the derivatives of basis functions for a compile-time
+//!   number of degrees of freedom
+//! \tparam NDOF Number of degrees of freedom, 4: DG(P1), 10: DG(P2)
+//! \param[in] igp Index of quadrature points (unused for DG(P1), whose basis
+//!   function derivatives are constant in an element)
+//! \param[in] coordgp Gauss point coordinates for tetrahedron element
+//! \param[in] jacInv Array of the inverse of Jacobian
+//! \return Array of the derivatives of basis functions
+//! \details Same as eval_dBdx_p1() and eval_dBdx_p2() combined, but with the
+//!   number of basis functions known at compile time, so the result lives on
+//!   the stack and the transformation loop below is unrolled.
+template< std::size_t NDOF >
+BasisDerivs< NDOF >
+eval_dBdx( [[maybe_unused]] std::size_t igp,
+           [[maybe_unused]] const std::array< std::vector< tk::real >, 3 >&
+             coordgp,
+           const std::array< std::array< tk::real, 3 >, 3 >& jacInv )
+{
+  static_assert( NDOF == 4 || NDOF == 10, "DG(P1) or DG(P2) only" );
+
+  // derivatives of the basis functions in reference space, dB/dxi
+  std::array< std::array< tk::real, 3 >, NDOF > dBdxi{{
+    {{ 0.0, 0.0, 0.0 }},
+    {{ 2.0, 1.0, 1.0 }},
+    {{ 0.0, 3.0, 1.0 }},
+    {{ 0.0, 0.0, 4.0 }} }};
+
+  if constexpr( NDOF > 4 ) {
+    const auto xi = coordgp[0][igp];
+    const auto eta = coordgp[1][igp];
+    const auto zeta = coordgp[2][igp];
+    dBdxi[4] = {{ 12.0*xi + 6.0*eta + 6.0*zeta - 6.0,
+                  6.0*xi + 2.0*eta + 2.0*zeta - 2.0,
+                  6.0*xi + 2.0*eta + 2.0*zeta - 2.0 }};
+    dBdxi[5] = {{ 10.0*eta + 2.0*zeta - 2.0,
+                  10.0*xi + 10.0*eta + 6.0*zeta - 6.0,
+                  2.0*xi + 6.0*eta + 2.0*zeta - 2.0 }};
+    dBdxi[6] = {{ 12.0*zeta - 2.0,
+                  6.0*zeta - 1.0,
+                  12.0*xi + 6.0*eta + 12.0*zeta - 7.0 }};
+    dBdxi[7] = {{ 0.0,
+                  20.0*eta + 8.0*zeta - 8.0,
+                  8.0*eta + 2.0*zeta - 2.0 }};
+    dBdxi[8] = {{ 0.0,
+                  18.0*zeta - 3.0,
+                  18.0*eta + 12.0*zeta - 7.0 }};
+    dBdxi[9] = {{ 0.0, 0.0, 30.0*zeta - 10.0 }};
+  }
+
+  // transform to physical space: dB/dx = dB/dxi . dxi/dx
+  BasisDerivs< NDOF > dBdx;
+  for (std::size_t j=0; j<3; ++j)
+    for (std::size_t k=0; k<NDOF; ++k)
+      dBdx[j][k] =  dBdxi[k][0] * jacInv[0][j]
+                  + dBdxi[k][1] * jacInv[1][j]
+                  + dBdxi[k][2] * jacInv[2][j];
+
+  return dBdx;
+}
+
+//! \brief Compute the state variables for the tetrahedron element for a
+//!   compile-time number of degrees of freedom
+//! \tparam NDOF Number of degrees of freedom of the element
+//! \param[in] offset Offset this PDE system operates from
+//! \param[in] ndof Maximum number of degrees of freedom
+//! \param[in] e Index for the tetrahedron element
+//! \param[in] U Solution vector at recent time step
+//! \param[in] B Vector of basis functions, at least NDOF long
+//! \param[in,out] state Vector of state variables, sized to the number of
+//!   scalar components on input, overwritten with the state of element e
+//! \details Same as eval_state() but reusing the caller's state vector and
+//!   with the basis sum unrolled on NDOF.
+template< std::size_t NDOF >
+void
+eval_state( ncomp_t offset,
+            std::size_t ndof,
+            std::size_t e,
+            const Fields& U,
+            const std::vector< tk::real >& B,
+            std::vector< tk::real >& state )
+{
+  Assert( B.size() >= NDOF, "Size mismatch" );
+  for (ncomp_t c=0; c<state.size(); ++c) {
+    const auto mark = c*ndof;
+    tk::real s = 0.0;
+    for (std::size_t k=0; k<NDOF; ++k) s += U( e, mark+k, offset ) * B[k];
+    state[c] = s;
+  }
+}
+
 } // tk::
 
 #endif // Basis_h
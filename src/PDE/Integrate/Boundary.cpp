@@ -96,16 +96,10 @@ tk::bndSurfInt( ncomp_t system,
 
         auto ng = tk::NGfa(ndofel[el]);
 
-        // arrays for quadrature points
-        std::array< std::vector< real >, 2 > coordgp;
-        std::vector< real > wgp;
-
-        coordgp[0].resize( ng );
-        coordgp[1].resize( ng );
-        wgp.resize( ng );
-
         // get quadrature point weights and coordinates for triangle
-        GaussQuadratureTri( ng, coordgp, wgp );
+        const auto& quad = triQuadrature( ng );
+        const auto& coordgp = quad.coordgp;
+        const auto& wgp = quad.wgp;
 
         // Extract the left element coordinates
         std::array< std::array< tk::real, 3>, 4 > coordel_l {{
@@ -215,26 +209,29 @@ tk::update_rhs_bc ( ncomp_t ncomp,
   // following line commented until rdofel is made available.
   //Assert( B_l.size() == ndof_l, "Size mismatch" );
 
+  // access right-hand side of element at offset
+  auto r = R.uview( el, offset );
+
   for (ncomp_t c=0; c<ncomp; ++c)
   {
     auto mark = c*ndof;
-    R(el, mark, offset) -= wt * fl[c];
+    r[mark] -= wt * fl[c];
 
     if(ndof_l > 1)          //DG(P1)
     {
-      R(el, mark+1, offset) -= wt * fl[c] * B_l[1];
-      R(el, mark+2, offset) -= wt * fl[c] * B_l[2];
-      R(el, mark+3, offset) -= wt * fl[c] * B_l[3];
+      r[mark+1] -= wt * fl[c] * B_l[1];
+      r[mark+2] -= wt * fl[c] * B_l[2];
+      r[mark+3] -= wt * fl[c] * B_l[3];
     }
 
     if(ndof_l > 4)          //DG(P2)
     {
-      R(el, mark+4, offset) -= wt * fl[c] * B_l[4];
-      R(el, mark+5, offset) -= wt * fl[c] * B_l[5];
-      R(el, mark+6, offset) -= wt * fl[c] * B_l[6];
-      R(el, mark+7, offset) -= wt * fl[c] * B_l[7];
-      R(el, mark+8, offset) -= wt * fl[c] * B_l[8];
-      R(el, mark+9, offset) -= wt * fl[c] * B_l[9];
+      r[mark+4] -= wt * fl[c] * B_l[4];
+      r[mark+5] -= wt * fl[c] * B_l[5];
+      r[mark+6] -= wt * fl[c] * B_l[6];
+      r[mark+7] -= wt * fl[c] * B_l[7];
+      r[mark+8] -= wt * fl[c] * B_l[8];
+      r[mark+9] -= wt * fl[c] * B_l[9];
     }
   }
 
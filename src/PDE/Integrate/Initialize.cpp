@@ -14,10 +14,13 @@
 
 #include <array>
 #include <vector>
+#include <cstddef>
 #include <iostream>
+#include <algorithm>
 #include "Data.hpp"
 #include "Initialize.hpp"
 #include "Quadrature.hpp"
+#include "Mass.hpp"
 #include "Inciter/InputDeck/InputDeck.hpp"
 
 namespace inciter {
@@ -30,7 +33,7 @@ void
 tk::initialize( ncomp_t system,
                 ncomp_t ncomp,
                 ncomp_t offset,
-                const Fields& L,
+                const Fields& geoElem,
                 const std::vector< std::size_t >& inpoel,
                 const UnsMesh::Coords& coord,
                 const SolutionFn& solution,
@@ -44,7 +47,7 @@ tk::initialize( ncomp_t system,
 //! \param[in] system Equation system index
 //! \param[in] ncomp Number of scalar components in this PDE system
 //! \param[in] offset Offset this PDE system operates from
-//! \param[in] L Block diagonal mass matrix
+//! \param[in] geoElem Element geometry array
 //! \param[in] inpoel Element-node connectivity
 //! \param[in] coord Array of node coordinates
 //! \param[in] solution Function to call to evaluate known solution or initial
@@ -60,56 +63,58 @@ tk::initialize( ncomp_t system,
   // Number of quadrature points for volume integration
   auto ng = tk::NGinit(ndof);
 
-  // arrays for quadrature points
-  std::array< std::vector< real >, 3 > coordgp;
-  std::vector< real > wgp;
-
-  coordgp[0].resize( ng );
-  coordgp[1].resize( ng );
-  coordgp[2].resize( ng );
-  wgp.resize( ng );
-
-  // get quadrature point weights and coordinates for triangle
-  GaussQuadratureTet( ng, coordgp, wgp );
+  // quadrature points, weights, and basis functions
+  const auto& quad = tetQuadrature( ng );
+  const auto& coordgp = quad.coordgp;
+  const auto& wgp = quad.wgp;
 
   const auto& cx = coord[0];
   const auto& cy = coord[1];
   const auto& cz = coord[2];
 
-  for (std::size_t e=0; e<nielem; ++e) {    // for all tets
-    // The volume of tetrahedron
-    auto vole = L(e, 0, offset);
+  // Elements are independent, shared among OpenMP threads (if enabled)
+  #pragma omp parallel
+  {
+    // right hand side vector, reused across the elements of a thread
+    std::vector< real > R( ncomp*ndof );
 
-    // Extract the element coordinates
-    std::array< std::array< real, 3>, 4 > coordel {{
-      {{ cx[ inpoel[4*e  ] ], cy[ inpoel[4*e  ] ], cz[ inpoel[4*e  ] ] }},
-      {{ cx[ inpoel[4*e+1] ], cy[ inpoel[4*e+1] ], cz[ inpoel[4*e+1] ] }},
-      {{ cx[ inpoel[4*e+2] ], cy[ inpoel[4*e+2] ], cz[ inpoel[4*e+2] ] }},
-      {{ cx[ inpoel[4*e+3] ], cy[ inpoel[4*e+3] ], cz[ inpoel[4*e+3] ] }} }};
+    #pragma omp for schedule(static)
+    for (std::ptrdiff_t ie=0; ie<static_cast< std::ptrdiff_t >( nielem ); ++ie)
+    {
+      const auto e = static_cast< std::size_t >( ie );
 
-    // right hand side vector
-    std::vector< real > R( ncomp*ndof, 0.0 );
+      // The volume of tetrahedron
+      auto vole = geoElem(e, 0, 0);
 
-    // Gaussian quadrature
-    for (std::size_t igp=0; igp<ng; ++igp)
-    {
-      // Compute the coordinates of quadrature point at physical domain
-      auto gp = eval_gp( igp, coordel, coordgp );
+      // Extract the element coordinates
+      std::array< std::array< real, 3>, 4 > coordel {{
+        {{ cx[ inpoel[4*e  ] ], cy[ inpoel[4*e  ] ], cz[ inpoel[4*e  ] ] }},
+        {{ cx[ inpoel[4*e+1] ], cy[ inpoel[4*e+1] ], cz[ inpoel[4*e+1] ] }},
+        {{ cx[ inpoel[4*e+2] ], cy[ inpoel[4*e+2] ], cz[ inpoel[4*e+2] ] }},
+        {{ cx[ inpoel[4*e+3] ], cy[ inpoel[4*e+3] ], cz[ inpoel[4*e+3] ] }} }};
 
-      // Compute the basis function
-      auto B =
-        eval_basis( ndof, coordgp[0][igp], coordgp[1][igp], coordgp[2][igp] );
+      std::fill( begin(R), end(R), 0.0 );
 
-      int inbox = 0;
-      const auto s = solution( system, ncomp, gp[0], gp[1], gp[2], t, inbox );
+      // Gaussian quadrature
+      for (std::size_t igp=0; igp<ng; ++igp)
+      {
+        // Compute the coordinates of quadrature point at physical domain
+        auto gp = eval_gp( igp, coordel, coordgp );
 
-      auto wt = wgp[igp] * vole;
+        // Access the basis function
+        const auto& B = quad.B( ndof, igp );
 
-      update_rhs( ncomp, ndof, wt, B, s, R );
-    }
+        int inbox = 0;
+        const auto s = solution( system, ncomp, gp[0], gp[1], gp[2], t, inbox );
+
+        auto wt = wgp[igp] * vole;
+
+        update_rhs( ncomp, ndof, wt, B, s, R );
+      }
 
-    // Compute the initial conditions
-    eval_init(ncomp, offset, ndof, rdof, e, R, L, unk);
+      // Compute the initial conditions
+      eval_init(ncomp, offset, ndof, rdof, e, R, geoElem, unk);
+    }
   }
 }
 
@@ -165,7 +170,7 @@ tk::eval_init( ncomp_t ncomp,
                const std::size_t rdof,
                const std::size_t e,
                const std::vector< tk::real >& R,
-               const Fields& L,
+               const Fields& geoElem,
                Fields& unk )
 // *****************************************************************************
 //  Compute the initial conditions
@@ -175,40 +180,22 @@ tk::eval_init( ncomp_t ncomp,
 //! \param[in] rdof Total number of reconstructed degrees of freedom
 //! \param[in] e Element index
 //! \param[in] R Right-hand side vector
-//! \param[in] L Block diagonal mass matrix
+//! \param[in] geoElem Element geometry array
 //! \param[in,out] unk Array of unknowns
 // *****************************************************************************
 {
+  // inverse of the element volume, see tk::dubinerInvMass
+  const auto vinv = 1.0 / geoElem(e,0,0);
+
   for (ncomp_t c=0; c<ncomp; ++c)
   {
-    // DG(P0)
     auto mark = c*ndof;
     auto rmark = c*rdof;
-    unk(e, rmark, offset) = R[mark] / L(e, mark,   offset);
 
     // if P0P1, initialize higher dofs to 0
-    if (rdof > ndof)
-    {
-      unk(e, rmark+1, offset) = 0.0;
-      unk(e, rmark+2, offset) = 0.0;
-      unk(e, rmark+3, offset) = 0.0;
-    }
+    for (std::size_t k=ndof; k<rdof; ++k) unk(e, rmark+k, offset) = 0.0;
 
-    if(ndof > 1)          // DG(P1)
-    {
-      unk(e, rmark+1, offset) = R[mark+1] / L(e, mark+1, offset);
-      unk(e, rmark+2, offset) = R[mark+2] / L(e, mark+2, offset);
-      unk(e, rmark+3, offset) = R[mark+3] / L(e, mark+3, offset);
- 
-      if(ndof > 4)        // DG(P2)
-      {
-        unk(e, rmark+4, offset) = R[mark+4] / L(e, mark+4, offset);
-        unk(e, rmark+5, offset) = R[mark+5] / L(e, mark+5, offset);
-        unk(e, rmark+6, offset) = R[mark+6] / L(e, mark+6, offset);
-        unk(e, rmark+7, offset) = R[mark+7] / L(e, mark+7, offset);
-        unk(e, rmark+8, offset) = R[mark+8] / L(e, mark+8, offset);
-        unk(e, rmark+9, offset) = R[mark+9] / L(e, mark+9, offset);
-      }
-    }
+    for (std::size_t k=0; k<ndof; ++k)
+      unk(e, rmark+k, offset) = R[mark+k] * dubinerInvMass[k] * vinv;
   }
 }
@@ -28,7 +28,7 @@ void
 initialize( ncomp_t system,
             ncomp_t ncomp,
             ncomp_t offset,
-            const Fields& L,
+            const Fields& geoElem,
             const std::vector< std::size_t >& inpoel,
             const UnsMesh::Coords& coord,
             const SolutionFn& solution,
@@ -54,7 +54,7 @@ eval_init( ncomp_t ncomp,
            const std::size_t rdof,
            const std::size_t e,
            const std::vector< tk::real >& R,
-           const Fields& L,
+           const Fields& geoElem,
            Fields& unk );
 
 } // tk::
@@ -14,6 +14,8 @@
 #ifndef Mass_h
 #define Mass_h
 
+#include <array>
+
 #include "Types.hpp"
 #include "Fields.hpp"
 
@@ -21,10 +23,21 @@ namespace tk {
 
 using ncomp_t = kw::ncomp::info::expect::type;
 
-//! Compute the block-diagnoal mass matrix for DG
-void
-mass( ncomp_t ncomp, ncomp_t offset, ncomp_t ndof, const Fields& geoElem,
-      Fields& l );
+//! \brief Const array defining the diagonal mass matrix of the orthogonal
+//!   Dubiner basis functions of DG(P0), DG(P1), and DG(P2) on a tetrahedron
+//! \details The mass matrix entry of basis function k of a tetrahedron with
+//!   volume V is dubinerMass[k] * V.
+const std::array< tk::real, 10 > dubinerMass{{ 1.0, 1.0/10.0, 3.0/10.0,
+  3.0/5.0, 1.0/35.0, 1.0/21.0, 1.0/14.0, 1.0/7.0, 3.0/14.0, 3.0/7.0 }};
+
+//! \brief Const array defining the inverse of the diagonal mass matrix of
+//!   the orthogonal Dubiner basis functions on a tetrahedron
+//! \details The inverse mass matrix entry of basis function k of a
+//!   tetrahedron with volume V is dubinerInvMass[k] / V, so the DG mass
+//!   matrix need not be stored, only the element volumes, see
+//!   tk::genGeoElemTet().
+const std::array< tk::real, 10 > dubinerInvMass{{ 1.0, 10.0, 10.0/3.0,
+  5.0/3.0, 35.0, 21.0, 14.0, 7.0, 14.0/3.0, 7.0/3.0 }};
 
 //! Compute lumped mass matrix for CG
 tk::Fields
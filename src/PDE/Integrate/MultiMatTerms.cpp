@@ -22,6 +22,46 @@
 
 namespace tk {
 
+MatInCell
+matInCell( std::size_t nmat,
+           ncomp_t offset,
+           const std::size_t rdof,
+           const std::size_t nelem,
+           const Fields& U,
+           real al_eps )
+// *****************************************************************************
+//  Find the materials present in each element
+//! \param[in] nmat Number of materials in this PDE system
+//! \param[in] offset Offset this PDE system operates from
+//! \param[in] rdof Maximum number of reconstructed degrees of freedom
+//! \param[in] nelem Number of elements
+//! \param[in] U Solution vector at recent time step
+//! \param[in] al_eps Volume fraction below which a material is considered
+//!   absent from an element
+//! \return Materials present in each element, see MatInCell
+//! \details A material is present in an element if its cell-averaged volume
+//!   fraction is larger than al_eps. Since the volume fractions sum to one,
+//!   every element contains at least one material, if al_eps < 1/nmat.
+// *****************************************************************************
+{
+  using inciter::volfracDofIdx;
+
+  MatInCell mic;
+  auto& [ mat, idx ] = mic;
+  idx.resize( nelem+1, 0 );
+  mat.reserve( nelem );
+
+  for (std::size_t e=0; e<nelem; ++e) {
+    for (std::size_t k=0; k<nmat; ++k)
+      if (U(e, volfracDofIdx(nmat, k, rdof, 0), offset) > al_eps)
+        mat.push_back( k );
+    idx[e+1] = mat.size();
+    Assert( idx[e+1] > idx[e], "No material present in element" );
+  }
+
+  return mic;
+}
+
 void
 nonConservativeInt( [[maybe_unused]] ncomp_t system,
                     std::size_t nmat,
@@ -37,6 +77,7 @@ nonConservativeInt( [[maybe_unused]] ncomp_t system,
                     const std::vector< std::vector< tk::real > >&
                       riemannDeriv,
                     const std::vector< std::size_t >& ndofel,
+                    const MatInCell& mic,
                     Fields& R )
 // *****************************************************************************
 //  Compute volume integrals for multi-material DG
@@ -60,15 +101,20 @@ nonConservativeInt( [[maybe_unused]] ncomp_t system,
 //! \param[in] riemannDeriv Derivatives of partial-pressures and velocities
 //!   computed from the Riemann solver for use in the non-conservative terms
 //! \param[in] ndofel Vector of local number of degrees of freedome
+//! \param[in] mic Materials present in each element, see matInCell(). The
+//!   material terms are only computed for these, the bulk quantities sum all
+//!   materials.
 //! \param[in,out] R Right-hand side vector added to
 // *****************************************************************************
 {
   using inciter::volfracIdx;
   using inciter::densityIdx;
-  using inciter::momentumIdx;
   using inciter::energyIdx;
   using inciter::velocityIdx;
 
+  const auto& [ mat, idx ] = mic;
+  Assert( idx.size() == nelem+1, "Size mismatch" );
+
   const auto& cx = coord[0];
   const auto& cy = coord[1];
   const auto& cz = coord[2];
@@ -81,16 +127,10 @@ nonConservativeInt( [[maybe_unused]] ncomp_t system,
   {
     auto ng = tk::NGvol(ndofel[e]);
 
-    // arrays for quadrature points
-    std::array< std::vector< real >, 3 > coordgp;
-    std::vector< real > wgp;
-
-    coordgp[0].resize( ng );
-    coordgp[1].resize( ng );
-    coordgp[2].resize( ng );
-    wgp.resize( ng );
-
-    GaussQuadratureTet( ng, coordgp, wgp );
+    // quadrature points, weights, and basis functions
+    const auto& quad = tetQuadrature( ng );
+    const auto& coordgp = quad.coordgp;
+    const auto& wgp = quad.wgp;
 
     // Extract the element coordinates
     std::array< std::array< real, 3>, 4 > coordel {{
@@ -127,9 +167,8 @@ nonConservativeInt( [[maybe_unused]] ncomp_t system,
         dof_el = ndofel[e];
       }
 
-      // Compute the basis function
-      auto B =
-        eval_basis( dof_el, coordgp[0][igp], coordgp[1][igp], coordgp[2][igp] );
+      // Access the basis function
+      const auto& B = quad.B( dof_el, igp );
 
       auto wt = wgp[igp] * geoElem(e, 0, 0);
 
@@ -145,29 +184,25 @@ nonConservativeInt( [[maybe_unused]] ncomp_t system,
                                       pgp[velocityIdx(nmat, 1)],
                                       pgp[velocityIdx(nmat, 2)] }};
 
-      std::vector< tk::real > ymat(nmat, 0.0);
       std::array< tk::real, 3 > dap{{0.0, 0.0, 0.0}};
       for (std::size_t k=0; k<nmat; ++k)
       {
-        ymat[k] = ugp[densityIdx(nmat, k)]/rhob;
-
         for (std::size_t idir=0; idir<3; ++idir)
           dap[idir] += riemannDeriv[3*k+idir][e];
       }
 
-      // compute non-conservative terms
+      // compute non-conservative terms, zero for the density and momentum
+      // equations and for the materials absent from the element
       std::vector< tk::real > ncf(ncomp, 0.0);
 
-      for (std::size_t idir=0; idir<3; ++idir)
-        ncf[momentumIdx(nmat, idir)] = 0.0;
-
-      for (std::size_t k=0; k<nmat; ++k)
+      for (auto i=idx[e]; i<idx[e+1]; ++i)
       {
-        ncf[densityIdx(nmat, k)] = 0.0;
+        auto k = mat[i];
+        auto ymat = ugp[densityIdx(nmat, k)]/rhob;
         ncf[volfracIdx(nmat, k)] = ugp[volfracIdx(nmat, k)]
                                    * riemannDeriv[3*nmat][e];
         for (std::size_t idir=0; idir<3; ++idir)
-          ncf[energyIdx(nmat, k)] -= vel[idir] * ( ymat[k]*dap[idir]
+          ncf[energyIdx(nmat, k)] -= vel[idir] * ( ymat*dap[idir]
                                                 - riemannDeriv[3*k+idir][e] );
       }
 
@@ -210,10 +245,13 @@ update_rhs_ncn(
   //        "Size mismatch for non-conservative term" );
   Assert( ncf.size() == ncomp, "Size mismatch for non-conservative term" );
 
+  // access right-hand side of element at offset
+  auto r = R.uview( e, offset );
+
   for (ncomp_t c=0; c<ncomp; ++c)
   {
     auto mark = c*ndof;
-    R(e, mark, offset) += wt * ncf[c];
+    r[mark] += wt * ncf[c];
   }
 }
 
@@ -228,6 +266,7 @@ pressureRelaxationInt( ncomp_t system,
                        const Fields& U,
                        const Fields& P,
                        const std::vector< std::size_t >& ndofel,
+                       const MatInCell& mic,
                        const tk::real ct,
                        Fields& R )
 // *****************************************************************************
@@ -249,6 +288,8 @@ pressureRelaxationInt( ncomp_t system,
 //! \param[in] U Solution vector at recent time step
 //! \param[in] P Vector of primitive quantities at recent time step
 //! \param[in] ndofel Vector of local number of degrees of freedome
+//! \param[in] mic Materials present in each element, see matInCell(). Only
+//!   these are relaxed towards (and determine) the relaxed pressure.
 //! \param[in] ct Pressure relaxation time-scale for this system
 //! \param[in,out] R Right-hand side vector added to
 // *****************************************************************************
@@ -260,6 +301,9 @@ pressureRelaxationInt( ncomp_t system,
   using inciter::pressureIdx;
   using inciter::velocityIdx;
 
+  const auto& [ mat, idx ] = mic;
+  Assert( idx.size() == nelem+1, "Size mismatch" );
+
   auto ncomp = U.nprop()/rdof;
   auto nprim = P.nprop()/rdof;
 
@@ -269,16 +313,9 @@ pressureRelaxationInt( ncomp_t system,
     auto dx = std::cbrt(geoElem(e, 0, 0));
     auto ng = NGvol(ndofel[e]);
 
-    // arrays for quadrature points
-    std::array< std::vector< real >, 3 > coordgp;
-    std::vector< real > wgp;
-
-    coordgp[0].resize( ng );
-    coordgp[1].resize( ng );
-    coordgp[2].resize( ng );
-    wgp.resize( ng );
-
-    GaussQuadratureTet( ng, coordgp, wgp );
+    // quadrature weights and basis functions
+    const auto& quad = tetQuadrature( ng );
+    const auto& wgp = quad.wgp;
 
     // Compute the derivatives of basis function for DG(P1)
     std::array< std::vector<real>, 3 > dBdx;
@@ -299,32 +336,31 @@ pressureRelaxationInt( ncomp_t system,
         dof_el = ndofel[e];
       }
 
-      // Compute the basis function
-      auto B =
-        eval_basis( dof_el, coordgp[0][igp], coordgp[1][igp], coordgp[2][igp] );
+      // Access the basis function
+      const auto& B = quad.B( dof_el, igp );
 
       auto wt = wgp[igp] * geoElem(e, 0, 0);
 
       auto ugp = eval_state( ncomp, offset, rdof, dof_el, e, U, B );
       auto pgp = eval_state( nprim, offset, rdof, dof_el, e, P, B );
 
-      // get bulk properties
-      real rhob(0.0);
+      // get bulk pressure
+      real pb(0.0);
       for (std::size_t k=0; k<nmat; ++k)
-        rhob += ugp[densityIdx(nmat, k)];
+        pb += pgp[pressureIdx(nmat, k)];
 
-      // get pressures and bulk modulii
-      real pb(0.0), nume(0.0), deno(0.0), trelax(0.0);
+      // get pressures and bulk modulii of materials present
+      real nume(0.0), deno(0.0), trelax(0.0);
       std::vector< real > apmat(nmat, 0.0), kmat(nmat, 0.0);
-      for (std::size_t k=0; k<nmat; ++k)
+      for (auto i=idx[e]; i<idx[e+1]; ++i)
       {
+        auto k = mat[i];
         real arhomat = ugp[densityIdx(nmat, k)];
         real alphamat = ugp[volfracIdx(nmat, k)];
         apmat[k] = pgp[pressureIdx(nmat, k)];
         real amat = inciter::eos_soundspeed< tag::multimat >( system, arhomat,
           apmat[k], alphamat, k );
         kmat[k] = arhomat * amat * amat;
-        pb += apmat[k];
 
         // relaxation parameters
         trelax = std::max(trelax, ct*dx/amat);
@@ -335,8 +371,9 @@ pressureRelaxationInt( ncomp_t system,
 
       // compute pressure relaxation terms
       std::vector< real > s_prelax(ncomp, 0.0);
-      for (std::size_t k=0; k<nmat; ++k)
+      for (auto i=idx[e]; i<idx[e+1]; ++i)
       {
+        auto k = mat[i];
         auto s_alpha = (apmat[k]-p_relax*ugp[volfracIdx(nmat, k)])
           * (ugp[volfracIdx(nmat, k)]/kmat[k]) / trelax;
         s_prelax[volfracIdx(nmat, k)] = s_alpha;
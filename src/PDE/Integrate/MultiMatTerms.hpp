@@ -16,6 +16,8 @@
 #ifndef MultiMatTerms_h
 #define MultiMatTerms_h
 
+#include <utility>
+
 #include "Basis.hpp"
 #include "Types.hpp"
 #include "Fields.hpp"
@@ -25,6 +27,20 @@ namespace tk {
 
 using ncomp_t = kw::ncomp::info::expect::type;
 
+//! \brief Materials present in each element, stored in linked lists: the
+//!   materials of element e are first[ second[e] ... second[e+1]-1 ]
+using MatInCell =
+  std::pair< std::vector< std::size_t >, std::vector< std::size_t > >;
+
+//! Find the materials present in each element
+MatInCell
+matInCell( std::size_t nmat,
+           ncomp_t offset,
+           const std::size_t rdof,
+           const std::size_t nelem,
+           const Fields& U,
+           real al_eps );
+
 //! Compute volume integrals of non-conservative terms for multi-material DG
 void
 nonConservativeInt( ncomp_t system,
@@ -40,6 +56,7 @@ nonConservativeInt( ncomp_t system,
                     const Fields& P,
                     const std::vector< std::vector< tk::real > >& riemannDeriv,
                     const std::vector< std::size_t >& ndofel,
+                    const MatInCell& mic,
                     Fields& R );
 
 //! Update the rhs by adding the non-conservative term integrals
@@ -66,6 +83,7 @@ pressureRelaxationInt( ncomp_t system,
                        const Fields& U,
                        const Fields& P,
                        const std::vector< std::size_t >& ndofel,
+                       const MatInCell& mic,
                        const tk::real ct,
                        Fields& R );
 
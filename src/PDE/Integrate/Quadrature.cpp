@@ -12,6 +12,7 @@
 // *****************************************************************************
 
 #include "Quadrature.hpp"
+#include "Basis.hpp"
 
 void
 tk::GaussQuadratureTet( const std::size_t NG,
@@ -337,3 +338,66 @@ tk::GaussQuadratureTri( const std::size_t NG,
       break;
   }
 }
+
+const tk::TetQuadrature&
+tk::tetQuadrature( std::size_t NG )
+// *****************************************************************************
+//  Access the Gaussian quadrature rule with basis functions for a tetrahedron
+//! \param[in] NG Number of quadrature points, one of 1, 4, 5, 11, 14
+//! \return Quadrature points, weights, and the basis functions evaluated at
+//!   the points for all supported numbers of degrees of freedom
+//! \details The rules are generated once, at the first call, and then shared
+//!   by all integrators, so that the quadrature points and the basis functions,
+//!   which do not depend on the element, are neither allocated nor recomputed
+//!   for every element in every stage. The initialization of the
+//!   function-local static is thread-safe.
+// *****************************************************************************
+{
+  static const auto rule = []{
+    std::array< TetQuadrature, 15 > r;
+    for (auto ng : { 1UL, 4UL, 5UL, 11UL, 14UL }) {
+      auto& q = r[ng];
+      for (auto& x : q.coordgp) x.resize( ng );
+      q.wgp.resize( ng );
+      GaussQuadratureTet( ng, q.coordgp, q.wgp );
+      std::size_t i = 0;
+      for (auto ndof : { 1UL, 4UL, 10UL }) {
+        auto& b = q.basis[i++];
+        for (std::size_t igp=0; igp<ng; ++igp)
+          b.push_back( eval_basis( ndof, q.coordgp[0][igp], q.coordgp[1][igp],
+                                   q.coordgp[2][igp] ) );
+      }
+    }
+    return r;
+  }();
+
+  Assert( NG < rule.size() && !rule[NG].wgp.empty(),
+          "Unsupported number of quadrature points for tetrahedron" );
+  return rule[ NG ];
+}
+
+const tk::TriQuadrature&
+tk::triQuadrature( std::size_t NG )
+// *****************************************************************************
+//  Access the Gaussian quadrature rule for a triangle
+//! \param[in] NG Number of quadrature points, one of 1, 3, 4, 6
+//! \return Quadrature points and weights
+//! \details The rules are generated once, at the first call, see also
+//!   tetQuadrature().
+// *****************************************************************************
+{
+  static const auto rule = []{
+    std::array< TriQuadrature, 7 > r;
+    for (auto ng : { 1UL, 3UL, 4UL, 6UL }) {
+      auto& q = r[ng];
+      for (auto& x : q.coordgp) x.resize( ng );
+      q.wgp.resize( ng );
+      GaussQuadratureTri( ng, q.coordgp, q.wgp );
+    }
+    return r;
+  }();
+
+  Assert( NG < rule.size() && !rule[NG].wgp.empty(),
+          "Unsupported number of quadrature points for triangle" );
+  return rule[ NG ];
+}
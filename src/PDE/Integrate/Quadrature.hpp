@@ -70,6 +70,46 @@ void
 GaussQuadratureTri( std::size_t NG,
                     std::array< std::vector< real >, 2 >& coordgp,
                     std::vector< real >& wgp );
+
+//! \brief Gaussian quadrature rule on the reference tetrahedron together with
+//!   the Dubiner basis functions evaluated at its points
+//! \details Both only depend on the number of quadrature points and on the
+//!   number of degrees of freedom, not on the element, see tetQuadrature().
+struct TetQuadrature {
+  //! Reference coordinates of quadrature points
+  std::array< std::vector< real >, 3 > coordgp;
+  //! Weights of quadrature points
+  std::vector< real > wgp;
+  //! Basis functions at quadrature points for 1, 4, and 10 degrees of freedom
+  std::array< std::vector< std::vector< real > >, 3 > basis;
+
+  //! Access basis functions at a quadrature point
+  //! \param[in] ndof Number of degrees of freedom, one of 1, 4, 10
+  //! \param[in] igp Index of quadrature point
+  //! \return Vector of ndof basis functions at quadrature point igp
+  const std::vector< real >& B( std::size_t ndof, std::size_t igp ) const {
+    Assert( ndof == 1 || ndof == 4 || ndof == 10,
+            "ndof must be one of 1,4,10" );
+    return basis[ ndof == 1 ? 0 : ndof == 4 ? 1 : 2 ][ igp ];
+  }
+};
+
+//! Gaussian quadrature rule on the reference triangle, see triQuadrature()
+struct TriQuadrature {
+  //! Reference coordinates of quadrature points
+  std::array< std::vector< real >, 2 > coordgp;
+  //! Weights of quadrature points
+  std::vector< real > wgp;
+};
+
+//! Access the Gaussian quadrature rule with basis functions for a tetrahedron
+const TetQuadrature&
+tetQuadrature( std::size_t NG );
+
+//! Access the Gaussian quadrature rule for a triangle
+const TriQuadrature&
+triQuadrature( std::size_t NG );
+
 } // tk::
 
 #endif // Quadrature_h
@@ -24,12 +24,11 @@ tk::srcInt( ncomp_t system,
             ncomp_t offset,
             real t,
             const std::size_t ndof,
-            const std::size_t nelem,
+            const NdofBuckets& elems,
             const std::vector< std::size_t >& inpoel,
             const UnsMesh::Coords& coord,
             const Fields& geoElem,
             const CompFlowSrcFn& src,
-            const std::vector< std::size_t >& ndofel,
             Fields& R )
 // *****************************************************************************
 //  Compute source term integrals for DG
@@ -37,12 +36,12 @@ tk::srcInt( ncomp_t system,
 //! \param[in] offset Offset this PDE system operates from
 //! \param[in] t Physical time
 //! \param[in] ndof Maximum number of degrees of freedom
-//! \param[in] nelen Maximum number of elements
+//! \param[in] elems Element ids bucketed by their local number of degrees of
+//!   freedom
 //! \param[in] inpoel Element-node connectivity
 //! \param[in] coord Array of nodal coordinates
 //! \param[in] geoElem Element geometry array
 //! \param[in] src Source function to use
-//! \param[in] ndofel Vector of local number of degrees of freedome
 //! \param[in,out] R Right-hand side vector computed
 // *****************************************************************************
 {
@@ -50,44 +49,48 @@ tk::srcInt( ncomp_t system,
   const auto& cy = coord[1];
   const auto& cz = coord[2];
 
-  for (std::size_t e=0; e<nelem; ++e)
+  for (std::size_t b=0; b<elems.size(); ++b)
   {
-    auto ng = tk::NGvol(ndofel[e]);
-
-    // arrays for quadrature points
-    std::array< std::vector< real >, 3 > coordgp;
-    std::vector< real > wgp;
-
-    coordgp[0].resize( ng );
-    coordgp[1].resize( ng );
-    coordgp[2].resize( ng );
-    wgp.resize( ng );
-
-    GaussQuadratureTet( ng, coordgp, wgp );
+    const auto dof_el = NdofBucket[b];
+    const auto ng = tk::NGvol( dof_el );
+
+    // quadrature points, weights, and basis functions
+    const auto& quad = tetQuadrature( ng );
+    const auto& coordgp = quad.coordgp;
+    const auto& wgp = quad.wgp;
+
+    // Elements only add to their own right hand side, so they are shared
+    // among OpenMP threads (if enabled)
+    const auto& el = elems[b];
+    const auto nel = static_cast< std::ptrdiff_t >( el.size() );
+    #pragma omp parallel for schedule(static)
+    for (std::ptrdiff_t i=0; i<nel; ++i)
+    {
+      const auto e = el[ static_cast< std::size_t >( i ) ];
 
-    // Extract the element coordinates
-    std::array< std::array< real, 3>, 4 > coordel {{
-      {{ cx[ inpoel[4*e  ] ], cy[ inpoel[4*e  ] ], cz[ inpoel[4*e  ] ] }},
-      {{ cx[ inpoel[4*e+1] ], cy[ inpoel[4*e+1] ], cz[ inpoel[4*e+1] ] }},
-      {{ cx[ inpoel[4*e+2] ], cy[ inpoel[4*e+2] ], cz[ inpoel[4*e+2] ] }},
-      {{ cx[ inpoel[4*e+3] ], cy[ inpoel[4*e+3] ], cz[ inpoel[4*e+3] ] }} }};
+      // Extract the element coordinates
+      std::array< std::array< real, 3>, 4 > coordel {{
+        {{ cx[ inpoel[4*e  ] ], cy[ inpoel[4*e  ] ], cz[ inpoel[4*e  ] ] }},
+        {{ cx[ inpoel[4*e+1] ], cy[ inpoel[4*e+1] ], cz[ inpoel[4*e+1] ] }},
+        {{ cx[ inpoel[4*e+2] ], cy[ inpoel[4*e+2] ], cz[ inpoel[4*e+2] ] }},
+        {{ cx[ inpoel[4*e+3] ], cy[ inpoel[4*e+3] ], cz[ inpoel[4*e+3] ] }} }};
 
-    for (std::size_t igp=0; igp<ng; ++igp)
-    {
-      // Compute the coordinates of quadrature point at physical domain
-      auto gp = eval_gp( igp, coordel, coordgp );
+      for (std::size_t igp=0; igp<ng; ++igp)
+      {
+        // Compute the coordinates of quadrature point at physical domain
+        auto gp = eval_gp( igp, coordel, coordgp );
 
-      // Compute the basis function
-      auto B =
-        eval_basis( ndofel[e], coordgp[0][igp], coordgp[1][igp], coordgp[2][igp] );
+        // Access the basis function
+        const auto& B = quad.B( dof_el, igp );
 
-      // Compute the source term variable
-      std::array< real, 5 > s;
-      src( system, gp[0], gp[1], gp[2], t, s[0], s[1], s[2], s[3], s[4] );
+        // Compute the source term variable
+        std::array< real, 5 > s;
+        src( system, gp[0], gp[1], gp[2], t, s[0], s[1], s[2], s[3], s[4] );
 
-      auto wt = wgp[igp] * geoElem(e, 0, 0);
+        auto wt = wgp[igp] * geoElem(e, 0, 0);
 
-      update_rhs( offset, ndof, ndofel[e], wt, e, B, s, R );
+        update_rhs( offset, ndof, dof_el, wt, e, B, s, R );
+      }
     }
   }
 }
@@ -115,25 +118,28 @@ tk::update_rhs( ncomp_t offset,
 {
   Assert( B.size() == ndof_el, "Size mismatch for basis function" );
 
+  // access right-hand side of element at offset
+  auto r = R.uview( e, offset );
+
   for (ncomp_t c=0; c<5; ++c)
   {
     auto mark = c*ndof;
-    R(e, mark, offset)   += wt * s[c];
+    r[mark] += wt * s[c];
 
     if ( ndof_el > 1 )
     {
-      R(e, mark+1, offset) += wt * s[c] * B[1];
-      R(e, mark+2, offset) += wt * s[c] * B[2];
-      R(e, mark+3, offset) += wt * s[c] * B[3];
+      r[mark+1] += wt * s[c] * B[1];
+      r[mark+2] += wt * s[c] * B[2];
+      r[mark+3] += wt * s[c] * B[3];
 
       if( ndof_el > 4 )
       {
-        R(e, mark+4, offset) += wt * s[c] * B[4];
-        R(e, mark+5, offset) += wt * s[c] * B[5];
-        R(e, mark+6, offset) += wt * s[c] * B[6];
-        R(e, mark+7, offset) += wt * s[c] * B[7];
-        R(e, mark+8, offset) += wt * s[c] * B[8];
-        R(e, mark+9, offset) += wt * s[c] * B[9];
+        r[mark+4] += wt * s[c] * B[4];
+        r[mark+5] += wt * s[c] * B[5];
+        r[mark+6] += wt * s[c] * B[6];
+        r[mark+7] += wt * s[c] * B[7];
+        r[mark+8] += wt * s[c] * B[8];
+        r[mark+9] += wt * s[c] * B[9];
       }
     }
   }
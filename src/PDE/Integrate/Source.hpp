@@ -32,12 +32,11 @@ srcInt( ncomp_t system,
         ncomp_t offset,
         real t,
         const std::size_t ndof,
-        const std::size_t nelem,
+        const NdofBuckets& elems,
         const std::vector< std::size_t >& inpoel,
         const UnsMesh::Coords& coord,
         const Fields& geoElem,
         const CompFlowSrcFn& src,
-        const std::vector< std::size_t >& ndofel,
         Fields& R );
 
 //! Update the rhs by adding the source term integrals
@@ -18,8 +18,10 @@
 #include "Surface.hpp"
 #include "Vector.hpp"
 #include "Quadrature.hpp"
+#include "PerfCounter.hpp"
+#include "ISA.hpp"
 
-void
+TK_MULTIVERSION void
 tk::surfInt( ncomp_t system,
              std::size_t nmat,
              ncomp_t offset,
@@ -28,8 +30,8 @@ tk::surfInt( ncomp_t system,
              const std::vector< std::size_t >& inpoel,
              const UnsMesh::Coords& coord,
              const inciter::FaceData& fd,
-             const Fields& geoFace,
-             const RiemannFluxFn& flux,
+             inciter::RhsPart part,
+             const RiemannBatchFluxFn& flux,
              const VelFn& vel,
              const Fields& U,
              const Fields& P,
@@ -46,8 +48,9 @@ tk::surfInt( ncomp_t system,
 //! \param[in] inpoel Element-node connectivity
 //! \param[in] coord Array of nodal coordinates
 //! \param[in] fd Face connectivity and boundary conditions object
-//! \param[in] geoFace Face geometry array
-//! \param[in] flux Riemann flux function to use
+//! \param[in] part Part of the right hand side whose internal faces to
+//!   integrate over, see inciter::FaceData::intfacRange()
+//! \param[in] flux Batched Riemann flux function to use
 //! \param[in] vel Function to use to query prescribed velocity (if any)
 //! \param[in] U Solution vector at recent time step
 //! \param[in] P Vector of primitives at recent time step
@@ -59,8 +62,8 @@ tk::surfInt( ncomp_t system,
 //!   single-material compflow and linear transport.
 // *****************************************************************************
 {
-  const auto& esuf = fd.Esuf();
-  const auto& inpofa = fd.Inpofa();
+  static const auto region = perfRegion( "tk::surfInt" );
+  PerfRegion pr( region );
 
   const auto& cx = coord[0];
   const auto& cy = coord[1];
@@ -72,14 +75,48 @@ tk::surfInt( ncomp_t system,
   Assert( (nmat==1 ? riemannDeriv.empty() : true), "Non-empty Riemann "
           "derivative vector for single material compflow" );
 
+  // Riemann problems at face quadrature points are collected into batches and
+  // solved together, then the fluxes are added to the rhs of the left and
+  // right elements from data saved for each problem of the batch
+  constexpr std::size_t nbatch = 256;
+  RiemannBatch batch( ncomp+nprim );
+  std::vector< std::array< std::size_t, 2 > > batchel;
+  std::vector< real > batchwt;
+  std::vector< std::array< std::vector< real >, 2 > > batchB;
+  std::vector< std::vector< real > > flx;
+  std::vector< real > fl;
+
+  // Solve the Riemann problems of the batch and add the fluxes to the rhs
+  auto flush = [&]() {
+    if (batch.size() == 0) return;
+    flux( batch, flx );
+    fl.resize( flx.size() );
+    for (std::size_t i=0; i<batch.size(); ++i) {
+      for (std::size_t c=0; c<flx.size(); ++c) fl[c] = flx[c][i];
+      const auto [el,er] = batchel[i];
+      update_rhs_fa( ncomp, nmat, offset, ndof, ndofel[el], ndofel[er],
+                     batchwt[i],
+                     {{ batch.fn[0][i], batch.fn[1][i], batch.fn[2][i] }},
+                     el, er, fl, batchB[i][0], batchB[i][1], R, riemannDeriv );
+    }
+    batch.clear();
+    batchel.clear();
+    batchwt.clear();
+    batchB.clear();
+  };
+
+  Assert( fd.Intfac().size() == fd.Esuf().size()/2 - fd.Nbfac(),
+          "Internal face data out of date" );
+
   // compute internal surface flux integrals
-  for (auto f=fd.Nbfac(); f<esuf.size()/2; ++f)
+  const auto& intfac = fd.Intfac();
+  const auto [fbeg,fend] = fd.intfacRange( part );
+  for (auto i=fbeg; i<fend; ++i)
   {
-    Assert( esuf[2*f] > -1 && esuf[2*f+1] > -1, "Interior element detected "
-            "as -1" );
-
-    std::size_t el = static_cast< std::size_t >(esuf[2*f]);
-    std::size_t er = static_cast< std::size_t >(esuf[2*f+1]);
+    const auto& fa = intfac[i];
+    std::size_t el = fa.esuf[0];
+    std::size_t er = fa.esuf[1];
+    const auto& fpoin = fa.inpofa;
 
     auto ng_l = tk::NGfa(ndofel[el]);
     auto ng_r = tk::NGfa(ndofel[er]);
@@ -88,16 +125,10 @@ tk::surfInt( ncomp_t system,
     // different, choose the larger ng
     auto ng = std::max( ng_l, ng_r );
 
-    // arrays for quadrature points
-    std::array< std::vector< real >, 2 > coordgp;
-    std::vector< real > wgp;
-
-    coordgp[0].resize( ng );
-    coordgp[1].resize( ng );
-    wgp.resize( ng );
-
     // get quadrature point weights and coordinates for triangle
-    GaussQuadratureTri( ng, coordgp, wgp );
+    const auto& quad = triQuadrature( ng );
+    const auto& coordgp = quad.coordgp;
+    const auto& wgp = quad.wgp;
 
     // Extract the element coordinates
     std::array< std::array< tk::real, 3>, 4 > coordel_l {{ 
@@ -120,12 +151,11 @@ tk::surfInt( ncomp_t system,
 
     // Extract the face coordinates
     std::array< std::array< tk::real, 3>, 3 > coordfa {{
-      {{ cx[ inpofa[3*f  ] ], cy[ inpofa[3*f  ] ], cz[ inpofa[3*f  ] ] }},
-      {{ cx[ inpofa[3*f+1] ], cy[ inpofa[3*f+1] ], cz[ inpofa[3*f+1] ] }},
-      {{ cx[ inpofa[3*f+2] ], cy[ inpofa[3*f+2] ], cz[ inpofa[3*f+2] ] }} }};
+      {{ cx[ fpoin[0] ], cy[ fpoin[0] ], cz[ fpoin[0] ] }},
+      {{ cx[ fpoin[1] ], cy[ fpoin[1] ], cz[ fpoin[1] ] }},
+      {{ cx[ fpoin[2] ], cy[ fpoin[2] ], cz[ fpoin[2] ] }} }};
 
-    std::array< real, 3 >
-      fn{{ geoFace(f,1,0), geoFace(f,2,0), geoFace(f,3,0) }};
+    const auto& fn = fa.normal;
 
     // Gaussian quadrature
     for (std::size_t igp=0; igp<ng; ++igp)
@@ -170,7 +200,7 @@ tk::surfInt( ncomp_t system,
             Jacobian( coordel_r[0], coordel_r[1], gp, coordel_r[3] ) / detT_r,
             Jacobian( coordel_r[0], coordel_r[1], coordel_r[2], gp ) / detT_r );
 
-      auto wt = wgp[igp] * geoFace(f,0,0);
+      auto wt = wgp[igp] * fa.area;
 
       std::array< std::vector< real >, 2 > state;
       std::array< std::vector< real >, 2 > sprim;
@@ -189,18 +219,17 @@ tk::surfInt( ncomp_t system,
       Assert( state[1].size() == ncomp+nprim, "Incorrect size for "
               "appended boundary state vector" );
 
-      // evaluate prescribed velocity (if any)
-      auto v = vel( system, ncomp, gp[0], gp[1], gp[2] );
-
-      // compute flux
-      auto fl =
-         flux( fn, state, v );
-
-      // Add the surface integration term to the rhs
-      update_rhs_fa( ncomp, nmat, offset, ndof, ndofel[el], ndofel[er], wt, fn,
-                     el, er, fl, B_l, B_r, R, riemannDeriv );
+      // evaluate prescribed velocity (if any) and queue the Riemann problem
+      batch.push_back( fn, state, vel( system, ncomp, gp[0], gp[1], gp[2] ) );
+      batchel.push_back( {{ el, er }} );
+      batchwt.push_back( wt );
+      batchB.push_back( {{ std::move(B_l), std::move(B_r) }} );
     }
+
+    if (batch.size() >= nbatch) flush();
   }
+
+  flush();
 }
 
 void
@@ -245,44 +274,48 @@ tk::update_rhs_fa ( ncomp_t ncomp,
   //Assert( B_l.size() == ndof_l, "Size mismatch" );
   //Assert( B_r.size() == ndof_r, "Size mismatch" );
 
+  // access right-hand side of elements at offset
+  auto rl = R.uview( el, offset );
+  auto rr = R.uview( er, offset );
+
   for (ncomp_t c=0; c<ncomp; ++c)
   {
     auto mark = c*ndof;
-    R(el, mark, offset) -= wt * fl[c];
-    R(er, mark, offset) += wt * fl[c];
+    rl[mark] -= wt * fl[c];
+    rr[mark] += wt * fl[c];
 
     if(ndof_l > 1)          //DG(P1)
     {
-      R(el, mark+1, offset) -= wt * fl[c] * B_l[1];
-      R(el, mark+2, offset) -= wt * fl[c] * B_l[2];
-      R(el, mark+3, offset) -= wt * fl[c] * B_l[3];
+      rl[mark+1] -= wt * fl[c] * B_l[1];
+      rl[mark+2] -= wt * fl[c] * B_l[2];
+      rl[mark+3] -= wt * fl[c] * B_l[3];
     }
 
     if(ndof_r > 1)          //DG(P1)
     {
-      R(er, mark+1, offset) += wt * fl[c] * B_r[1];
-      R(er, mark+2, offset) += wt * fl[c] * B_r[2];
-      R(er, mark+3, offset) += wt * fl[c] * B_r[3];
+      rr[mark+1] += wt * fl[c] * B_r[1];
+      rr[mark+2] += wt * fl[c] * B_r[2];
+      rr[mark+3] += wt * fl[c] * B_r[3];
     }
 
     if(ndof_l > 4)          //DG(P2)
     {
-      R(el, mark+4, offset) -= wt * fl[c] * B_l[4];
-      R(el, mark+5, offset) -= wt * fl[c] * B_l[5];
-      R(el, mark+6, offset) -= wt * fl[c] * B_l[6];
-      R(el, mark+7, offset) -= wt * fl[c] * B_l[7];
-      R(el, mark+8, offset) -= wt * fl[c] * B_l[8];
-      R(el, mark+9, offset) -= wt * fl[c] * B_l[9];
+      rl[mark+4] -= wt * fl[c] * B_l[4];
+      rl[mark+5] -= wt * fl[c] * B_l[5];
+      rl[mark+6] -= wt * fl[c] * B_l[6];
+      rl[mark+7] -= wt * fl[c] * B_l[7];
+      rl[mark+8] -= wt * fl[c] * B_l[8];
+      rl[mark+9] -= wt * fl[c] * B_l[9];
     }
 
     if(ndof_r > 4)          //DG(P2)
     {
-      R(er, mark+4, offset) += wt * fl[c] * B_r[4];
-      R(er, mark+5, offset) += wt * fl[c] * B_r[5];
-      R(er, mark+6, offset) += wt * fl[c] * B_r[6];
-      R(er, mark+7, offset) += wt * fl[c] * B_r[7];
-      R(er, mark+8, offset) += wt * fl[c] * B_r[8];
-      R(er, mark+9, offset) += wt * fl[c] * B_r[9];
+      rr[mark+4] += wt * fl[c] * B_r[4];
+      rr[mark+5] += wt * fl[c] * B_r[5];
+      rr[mark+6] += wt * fl[c] * B_r[6];
+      rr[mark+7] += wt * fl[c] * B_r[7];
+      rr[mark+8] += wt * fl[c] * B_r[8];
+      rr[mark+9] += wt * fl[c] * B_r[9];
     }
   }
 
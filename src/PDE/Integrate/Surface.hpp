@@ -37,8 +37,8 @@ surfInt( ncomp_t system,
          const std::vector< std::size_t >& inpoel,
          const UnsMesh::Coords& coord,
          const inciter::FaceData& fd,
-         const Fields& geoFace,
-         const RiemannFluxFn& flux,
+         inciter::RhsPart part,
+         const RiemannBatchFluxFn& flux,
          const VelFn& vel,
          const Fields& U,
          const Fields& P,
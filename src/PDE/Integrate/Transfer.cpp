@@ -0,0 +1,265 @@
+// *****************************************************************************
+/*!
+  \file      src/PDE/Integrate/Transfer.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Functions for transferring solution data after mesh refinement
+  \details   This file contains functionality for transferring the numerical
+     solution from the mesh before to the mesh after a mesh refinement step,
+     for nodal data of continuous Galerkin methods via linear interpolation
+     to the nodes added and for cell data of discontinuous Galerkin methods via
+     conservative L2 projection between parent and child cells.
+*/
+// *****************************************************************************
+
+#include <map>
+#include <array>
+#include <vector>
+#include <algorithm>
+
+#include "Transfer.hpp"
+#include "Vector.hpp"
+#include "Basis.hpp"
+#include "Quadrature.hpp"
+#include "Mass.hpp"
+
+namespace {
+
+//! Coordinates of the four vertices of a tetrahedron
+using TetCoord = std::array< std::array< tk::real, 3 >, 4 >;
+
+//! Extract the vertex coordinates of a tetrahedron
+//! \param[in] inpoel Tetrahedron connectivity
+//! \param[in] e Tetrahedron id
+//! \param[in] coord Node coordinates
+//! \return Vertex coordinates of tetrahedron e
+TetCoord
+vertices( const std::vector< std::size_t >& inpoel,
+          std::size_t e,
+          const tk::UnsMesh::Coords& coord )
+{
+  const auto& x = coord[0];
+  const auto& y = coord[1];
+  const auto& z = coord[2];
+  const auto N = inpoel.data() + e*4;
+  return {{ {{ x[N[0]], y[N[0]], z[N[0]] }},
+            {{ x[N[1]], y[N[1]], z[N[1]] }},
+            {{ x[N[2]], y[N[2]], z[N[2]] }},
+            {{ x[N[3]], y[N[3]], z[N[3]] }} }};
+}
+
+//! Compute the reference coordinates of a point in a tetrahedron
+//! \param[in] v Vertex coordinates of tetrahedron
+//! \param[in] p Physical coordinates of point
+//! \return Reference (xi, eta, zeta) coordinates of point p in tetrahedron v,
+//!   the inverse of the transformation in tk::eval_gp()
+std::array< tk::real, 3 >
+reference( const TetCoord& v, const std::array< tk::real, 3 >& p )
+{
+  std::array< tk::real, 3 > ba{{ v[1][0]-v[0][0], v[1][1]-v[0][1],
+                                 v[1][2]-v[0][2] }},
+                            ca{{ v[2][0]-v[0][0], v[2][1]-v[0][1],
+                                 v[2][2]-v[0][2] }},
+                            da{{ v[3][0]-v[0][0], v[3][1]-v[0][1],
+                                 v[3][2]-v[0][2] }},
+                            pa{{ p[0]-v[0][0], p[1]-v[0][1], p[2]-v[0][2] }};
+  auto detJ = tk::triple( ba, ca, da );
+  return {{ tk::triple( pa, ca, da ) / detJ,
+            tk::triple( ba, pa, da ) / detJ,
+            tk::triple( ba, ca, pa ) / detJ }};
+}
+
+//! \brief Compute the matrix of the L2 projection of a polynomial on a
+//!   tetrahedron onto the basis of another one, one containing the other
+//! \param[in] ndof Number of degrees of freedom
+//! \param[in] a Vertex coordinates of tetrahedron the polynomial projected is
+//!   expanded in the basis of
+//! \param[in] b Vertex coordinates of tetrahedron projected to
+//! \param[in] overa True if the projection is over tetrahedron a, contained
+//!   in b, false if it is over tetrahedron b, contained in a
+//! \return Projection matrix, P[k*ndof+j], whose product with the expansion
+//!   coefficients on a yields the expansion coefficients on b
+//! \details With the Dubiner basis functions B on a and b, P_kj =
+//!   int B^b_k B^a_j dV / int B^b_k B^b_k dV, integrated over the smaller of a
+//!   and b. Since the polynomials on both tetrahedra are of the same degree,
+//!   the quadrature rule used for initial conditions, see tk::NGinit(),
+//!   integrates the product exactly.
+std::vector< tk::real >
+projection( std::size_t ndof,
+            const TetCoord& a,
+            const TetCoord& b,
+            bool overa )
+{
+  const auto& quad = tk::tetQuadrature( tk::NGinit(ndof) );
+  const auto& r = overa ? a : b;
+  auto volr = tk::Jacobian( r[0], r[1], r[2], r[3] ) / 6.0;
+  auto volb = tk::Jacobian( b[0], b[1], b[2], b[3] ) / 6.0;
+
+  std::vector< tk::real > P( ndof*ndof, 0.0 );
+  for (std::size_t igp=0; igp<quad.wgp.size(); ++igp) {
+    auto wt = quad.wgp[igp] * volr;
+    const auto& B = quad.B( ndof, igp );
+    auto gp = reference( overa ? b : a, tk::eval_gp( igp, r, quad.coordgp ) );
+    auto Bo = tk::eval_basis( ndof, gp[0], gp[1], gp[2] );
+    const auto& Ba = overa ? B : Bo;
+    const auto& Bb = overa ? Bo : B;
+    for (std::size_t k=0; k<ndof; ++k)
+      for (std::size_t j=0; j<ndof; ++j)
+        P[k*ndof+j] += wt * Bb[k] * Ba[j];
+  }
+
+  for (std::size_t k=0; k<ndof; ++k)
+    for (std::size_t j=0; j<ndof; ++j)
+      P[k*ndof+j] *= tk::dubinerInvMass[k] / volb;
+
+  return P;
+}
+
+} // ::
+
+void
+tk::transfer( const std::unordered_map< std::size_t, UnsMesh::Edge >&
+                addedNodes,
+              Fields& u )
+// *****************************************************************************
+//  Transfer node data to nodes added by mesh refinement
+//! \param[in] addedNodes Newly added mesh nodes and their parents (local ids)
+//! \param[in,out] u Node data, resized to the new mesh, whose values at the
+//!   added nodes are linearly interpolated from those at their parents
+//! \details The added nodes are first collected in ascending node id order,
+//!   so that all of them are then processed in a single pass that visits the
+//!   nodes in memory order instead of in the order of the hash map.
+// *****************************************************************************
+{
+  std::vector< std::array< std::size_t, 3 > > added;
+  added.reserve( addedNodes.size() );
+  for (const auto& [ n, p ] : addedNodes)
+    added.push_back( {{ n, p[0], p[1] }} );
+  std::sort( begin(added), end(added) );
+
+  const auto nprop = u.nprop();
+  for (const auto& [ n, p, q ] : added) {
+    Assert( n < u.nunk(), "Indexing out of node data" );
+    for (std::size_t c=0; c<nprop; ++c)
+      u(n,c,0) = (u(p,c,0) + u(q,c,0)) / 2.0;
+  }
+}
+
+void
+tk::transfer( std::size_t ndof,
+              std::size_t rdof,
+              const CellFamilies& families,
+              const std::vector< std::size_t >& oldinpoel,
+              const UnsMesh::Coords& oldcoord,
+              const std::vector< std::size_t >& oldndof,
+              const std::vector< std::size_t >& inpoel,
+              const UnsMesh::Coords& coord,
+              const Fields& oldu,
+              Fields& u )
+// *****************************************************************************
+//  Transfer DG cell data from the old to the new mesh after mesh refinement
+//! \param[in] ndof Number of degrees of freedom transferred
+//! \param[in] rdof Total number of (solved and reconstructed) degrees of
+//!   freedom stored per component
+//! \param[in] families Cell families relating the old and new meshes
+//! \param[in] oldinpoel Old mesh connectivity
+//! \param[in] oldcoord Old mesh node coordinates
+//! \param[in] oldndof Number of degrees of freedom of old cells, if empty,
+//!   ndof in all old cells
+//! \param[in] inpoel New mesh connectivity
+//! \param[in] coord New mesh node coordinates
+//! \param[in] oldu Cell data on the old mesh
+//! \param[in,out] u Cell data on the new mesh, sized to the new mesh
+//! \details Cells kept are copied. For each family the data on its sources is
+//!   first L2-projected onto the family (the parent), then from the family to
+//!   its targets. Both projections are conservative, as the cell average is
+//!   the coefficient of the first, constant, basis function, to which all
+//!   others are orthogonal. Since children and their parent hold polynomials
+//!   of the same degree, the projection from parent to children is exact, so
+//!   refinement does not lose accuracy compared to the higher-order solution
+//!   on the parent. Projecting from children to their parent yields the best
+//!   approximation of the children's (piecewise) solution on the parent.
+//!   The families are processed bucketed by their refinement pattern, i.e.,
+//!   the number of their sources and targets, e.g., 1:2, 1:4, 1:8, 8:1. Degrees
+//!   of freedom that are reconstructed (beyond ndof) are zeroed in the cells
+//!   not kept.
+// *****************************************************************************
+{
+  Assert( ndof <= rdof, "Number of dofs transferred larger than rdof" );
+  Assert( u.nprop() == oldu.nprop(), "Size mismatch" );
+  Assert( u.nprop() % rdof == 0, "Size mismatch" );
+  Assert( families.kept.size() == inpoel.size()/4, "Size mismatch" );
+  Assert( oldndof.empty() || oldndof.size() >= oldinpoel.size()/4,
+          "Size mismatch" );
+
+  const auto nprop = u.nprop();
+  const auto ncomp = nprop / rdof;
+
+  // Copy data of cells kept
+  for (std::size_t e=0; e<families.kept.size(); ++e)
+    if (families.isKept(e)) {
+      auto o = families.kept[e];
+      for (std::size_t i=0; i<nprop; ++i) u(e,i,0) = oldu(o,i,0);
+    }
+
+  if (families.size() == 0) return;
+
+  // Bucket families by refinement pattern
+  std::map< std::pair< std::size_t, std::size_t >,
+            std::vector< std::size_t > > pattern;
+  for (std::size_t f=0; f<families.size(); ++f)
+    pattern[ { families.srcidx[f+1] - families.srcidx[f],
+               families.tgtidx[f+1] - families.tgtidx[f] } ].push_back( f );
+
+  std::vector< tk::real > uf( ncomp*ndof );
+
+  for (const auto& [ p, fam ] : pattern) {
+    const auto [ nsrc, ntgt ] = p;
+    for (auto f : fam) {
+      auto F = vertices( families.inpoel, f, oldcoord );
+      const auto src = families.src.data() + families.srcidx[f];
+      const auto tgt = families.tgt.data() + families.tgtidx[f];
+
+      // Project data from sources to family. A single source is the family.
+      std::fill( begin(uf), end(uf), 0.0 );
+      for (std::size_t i=0; i<nsrc; ++i) {
+        auto s = src[i];
+        auto nd = oldndof.empty() ? ndof : std::min( ndof, oldndof[s] );
+        if (nsrc == 1) {
+          for (std::size_t c=0; c<ncomp; ++c)
+            for (std::size_t j=0; j<nd; ++j)
+              uf[c*ndof+j] = oldu(s,c*rdof+j,0);
+        } else {
+          auto P = projection( ndof, vertices(oldinpoel,s,oldcoord), F, true );
+          for (std::size_t c=0; c<ncomp; ++c)
+            for (std::size_t k=0; k<ndof; ++k)
+              for (std::size_t j=0; j<nd; ++j)
+                uf[c*ndof+k] += P[k*ndof+j] * oldu(s,c*rdof+j,0);
+        }
+      }
+
+      // Project data from family to targets. A single target is the family.
+      for (std::size_t i=0; i<ntgt; ++i) {
+        auto t = tgt[i];
+        Assert( !families.isKept(t), "Family target kept" );
+        for (std::size_t k=0; k<nprop; ++k) u(t,k,0) = 0.0;
+        if (ntgt == 1) {
+          for (std::size_t c=0; c<ncomp; ++c)
+            for (std::size_t k=0; k<ndof; ++k)
+              u(t,c*rdof+k,0) = uf[c*ndof+k];
+        } else {
+          auto P = projection( ndof, F, vertices(inpoel,t,coord), false );
+          for (std::size_t c=0; c<ncomp; ++c)
+            for (std::size_t k=0; k<ndof; ++k) {
+              tk::real v = 0.0;
+              for (std::size_t j=0; j<ndof; ++j)
+                v += P[k*ndof+j] * uf[c*ndof+j];
+              u(t,c*rdof+k,0) = v;
+            }
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,117 @@
+// *****************************************************************************
+/*!
+  \file      src/PDE/Integrate/Transfer.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Functions for transferring solution data after mesh refinement
+  \details   This file contains functionality for transferring the numerical
+     solution from the mesh before to the mesh after a mesh refinement step,
+     for nodal data of continuous Galerkin methods via linear interpolation
+     to the nodes added and for cell data of discontinuous Galerkin methods via
+     conservative L2 projection between parent and child cells.
+*/
+// *****************************************************************************
+#ifndef Transfer_h
+#define Transfer_h
+
+#include <limits>
+#include <unordered_map>
+
+#include "Types.hpp"
+#include "Fields.hpp"
+#include "UnsMesh.hpp"
+
+namespace tk {
+
+//! \brief Families of cells relating the cells of a mesh before and after a
+//!   mesh refinement step, used to transfer cell data between them
+//! \details A family is a tetrahedron of the refinement hierarchy, given by
+//!   its nodes, which is covered by one or more cells of the old mesh, its
+//!   sources, as well as by one or more cells of the new mesh, its targets.
+//!   For refinement (1:2, 1:4, 1:8) the family is the old cell refined, for
+//!   derefinement (2:1, 4:1, 8:1) it is the new cell, and if the refinement
+//!   pattern of a parent changes (e.g., 1:2 -> 1:8, or 1:8 -> 1:4) it is the
+//!   parent. Cells kept by the refinement step are not part of any family.
+struct CellFamilies {
+  //! New->old cell id map of cells kept, max() for cells not kept
+  std::vector< std::size_t > kept;
+  //! Family connectivity, four (old mesh) node ids per family
+  std::vector< std::size_t > inpoel;
+  //! \brief Sources (old cell ids) of all families, linked list
+  //! \details Sources of family f are src[ srcidx[f] ] ...
+  //!   src[ srcidx[f+1]-1 ], similar to tk::genEsup.
+  std::vector< std::size_t > src;
+  //! Start index of the sources of families into src
+  std::vector< std::size_t > srcidx{ 0 };
+  //! Targets (new cell ids) of all families, same layout as sources
+  std::vector< std::size_t > tgt;
+  //! Start index of the targets of families into tgt
+  std::vector< std::size_t > tgtidx{ 0 };
+
+  //! Add a family
+  //! \param[in] t Family nodes (old mesh local ids)
+  //! \param[in] s Sources (old cell ids)
+  //! \param[in] c Targets (new cell ids)
+  void add( const UnsMesh::Tet& t,
+            const std::vector< std::size_t >& s,
+            const std::vector< std::size_t >& c )
+  {
+    inpoel.insert( end(inpoel), begin(t), end(t) );
+    src.insert( end(src), begin(s), end(s) );
+    srcidx.push_back( src.size() );
+    tgt.insert( end(tgt), begin(c), end(c) );
+    tgtidx.push_back( tgt.size() );
+  }
+
+  //! Number of families
+  //! \return Number of families
+  std::size_t size() const { return inpoel.size()/4; }
+
+  //! Query if cell of the new mesh has been kept
+  //! \param[in] e New cell id
+  //! \return True if cell e is the same as cell kept[e] of the old mesh
+  bool isKept( std::size_t e ) const
+  { return kept[e] != std::numeric_limits< std::size_t >::max(); }
+
+  /** @name Pack/Unpack: Serialize CellFamilies object for Charm++ */
+  ///@{
+  //! \brief Pack/Unpack serialize member function
+  //! \param[in,out] p Charm++'s PUP::er serializer object reference
+  void pup( PUP::er& p ) {
+    p | kept;
+    p | inpoel;
+    p | src;
+    p | srcidx;
+    p | tgt;
+    p | tgtidx;
+  }
+  //! \brief Pack/Unpack serialize operator|
+  //! \param[in,out] p Charm++'s PUP::er serializer object reference
+  //! \param[in,out] f CellFamilies object reference
+  friend void operator|( PUP::er& p, CellFamilies& f ) { f.pup(p); }
+  //@}
+};
+
+//! Transfer node data to nodes added by mesh refinement
+void
+transfer( const std::unordered_map< std::size_t, UnsMesh::Edge >& addedNodes,
+          Fields& u );
+
+//! Transfer DG cell data from the old to the new mesh after mesh refinement
+void
+transfer( std::size_t ndof,
+          std::size_t rdof,
+          const CellFamilies& families,
+          const std::vector< std::size_t >& oldinpoel,
+          const UnsMesh::Coords& oldcoord,
+          const std::vector< std::size_t >& oldndof,
+          const std::vector< std::size_t >& inpoel,
+          const UnsMesh::Coords& coord,
+          const Fields& oldu,
+          Fields& u );
+
+} // tk::
+
+#endif // Transfer_h
@@ -20,6 +20,7 @@
 #include "Fields.hpp"
 #include "UnsMesh.hpp"
 #include "FunctionPrototypes.hpp"
+#include "Basis.hpp"
 
 namespace tk {
 
@@ -31,28 +32,15 @@ volInt( ncomp_t system,
         ncomp_t ncomp,
         ncomp_t offset,
         const std::size_t ndof,
-        const std::size_t nelem,
+        const NdofBuckets& elems,
         const std::vector< std::size_t >& inpoel,
         const UnsMesh::Coords& coord,
         const Fields& geoElem,
         const FluxFn& flux,
         const VelFn& vel,
         const Fields& U,
-        const std::vector< std::size_t >& ndofel,
         Fields& R );
 
-//! Update the rhs by adding the source term integrals
-void
-update_rhs( ncomp_t ncomp,
-            ncomp_t offset,
-            const std::size_t ndof,
-            const std::size_t ndof_el,
-            const tk::real wt,
-            const std::size_t e,
-            const std::array< std::vector<tk::real>, 3 >& dBdx,
-            const std::vector< std::array< tk::real, 3 > >& fl,
-            Fields& R );
-
 } // tk::
 
 #endif // Volume_h
@@ -26,13 +26,86 @@ namespace inciter {
 
 extern ctr::InputDeck g_inputdeck;
 
+static bool
+spectralDecay( const tk::Fields& U,
+               std::size_t e,
+               std::size_t rdof,
+               tk::real tol )
+// *****************************************************************************
+//  Evaluate the spectral-decay troubled-cell indicator in an element
+//! \param[in] U High-order solution vector
+//! \param[in] e Element id
+//! \param[in] rdof Number of reconstructed degrees of freedom
+//! \param[in] tol Tolerance of the indicator
+//! \return True if the ratio of the squared L2 norms of the P1 part and the
+//!   full solution is not smaller than tol for any scalar component
+//! \details Since the Dubiner basis is orthogonal, both norms are sums of the
+//!   squared dofs weighted by the diagonal of the mass matrix (the volume
+//!   cancels), so unlike spectral_decay() in PrefIndicator.cpp, no quadrature
+//!   is needed.
+// *****************************************************************************
+{
+  const auto ncomp = U.nprop()/rdof;
+
+  for (ncomp_t c=0; c<ncomp; ++c)
+  {
+    auto mark = c*rdof;
+    auto dU = U(e,mark+1,0) * U(e,mark+1,0) / 10.0
+            + U(e,mark+2,0) * U(e,mark+2,0) * 3.0/10.0
+            + U(e,mark+3,0) * U(e,mark+3,0) * 3.0/5.0;
+    if (dU >= tol * (U(e,mark,0) * U(e,mark,0) + dU)) return true;
+  }
+
+  return false;
+}
+
+std::vector< std::size_t >
+troubledCells( std::size_t nelem,
+               const std::vector< std::size_t >& ndofel,
+               const tk::Fields& U,
+               const tk::Fields& P )
+// *****************************************************************************
+//  Find troubled cells, i.e., elements whose P1 solution is to be limited
+//! \param[in] nelem Number of elements
+//! \param[in] ndofel Vector of local number of degrees of freedom
+//! \param[in] U High-order solution vector of all equation systems
+//! \param[in] P High-order vector of primitives of all equation systems
+//! \return Ids of troubled cells in increasing order
+//! \details An element with P1 dofs is troubled if the spectral-decay
+//!   indicator of any scalar component of U or P reaches the tolerance set by
+//!   limtol. With the default tolerance, zero, all elements with P1 dofs are
+//!   troubled.
+// *****************************************************************************
+{
+  const auto rdof = inciter::g_inputdeck.get< tag::discr, tag::rdof >();
+  const auto ndof = inciter::g_inputdeck.get< tag::discr, tag::ndof >();
+  const auto tol = inciter::g_inputdeck.get< tag::discr, tag::limtol >();
+
+  std::vector< std::size_t > troubled;
+  troubled.reserve( nelem );
+
+  for (std::size_t e=0; e<nelem; ++e)
+  {
+    // see Superbee_P1() for the number of dofs of elements with rDG(P0P1)
+    auto dof_el = rdof > ndof ? rdof : ndofel[e];
+
+    if (dof_el > 1 &&
+        (spectralDecay( U, e, rdof, tol ) || spectralDecay( P, e, rdof, tol )))
+      troubled.push_back( e );
+  }
+
+  return troubled;
+}
+
 void
 WENO_P1( const std::vector< int >& esuel,
+         const std::vector< std::size_t >& troubled,
          inciter::ncomp_t offset,
          tk::Fields& U )
 // *****************************************************************************
 //  Weighted Essentially Non-Oscillatory (WENO) limiter for DGP1
 //! \param[in] esuel Elements surrounding elements
+//! \param[in] troubled Ids of elements to limit, see troubledCells()
 //! \param[in] offset Index for equation systems
 //! \param[in,out] U High-order solution vector which gets limited
 //! \details This WENO function should be called for transport and compflow
@@ -51,14 +124,14 @@ WENO_P1( const std::vector< int >& esuel,
 
   for (inciter::ncomp_t c=0; c<ncomp; ++c)
   {
-    for (std::size_t e=0; e<nelem; ++e)
+    for (auto e : troubled)
     {
       WENOFunction(U, esuel, e, c, rdof, offset, cweight, limU);
     }
 
     auto mark = c*rdof;
 
-    for (std::size_t e=0; e<nelem; ++e)
+    for (auto e : troubled)
     {
       U(e, mark+1, offset) = limU[0][e];
       U(e, mark+2, offset) = limU[1][e];
@@ -69,6 +142,7 @@ WENO_P1( const std::vector< int >& esuel,
 
 void
 WENOMultiMat_P1( const std::vector< int >& esuel,
+                 const std::vector< std::size_t >& troubled,
                  inciter::ncomp_t offset,
                  tk::Fields& U,
                  tk::Fields& P,
@@ -76,6 +150,7 @@ WENOMultiMat_P1( const std::vector< int >& esuel,
 // *****************************************************************************
 //  Weighted Essentially Non-Oscillatory (WENO) limiter for multi-material DGP1
 //! \param[in] esuel Elements surrounding elements
+//! \param[in] troubled Ids of elements to limit, see troubledCells()
 //! \param[in] offset Index for equation systems
 //! \param[in,out] U High-order solution vector which gets limited
 //! \param[in,out] P High-order vector of primitives which gets limited
@@ -98,14 +173,14 @@ WENOMultiMat_P1( const std::vector< int >& esuel,
   // limit conserved quantities
   for (inciter::ncomp_t c=0; c<ncomp; ++c)
   {
-    for (std::size_t e=0; e<nelem; ++e)
+    for (auto e : troubled)
     {
       WENOFunction(U, esuel, e, c, rdof, offset, cweight, limU);
     }
 
     auto mark = c*rdof;
 
-    for (std::size_t e=0; e<nelem; ++e)
+    for (auto e : troubled)
     {
       U(e, mark+1, offset) = limU[0][e];
       U(e, mark+2, offset) = limU[1][e];
@@ -116,14 +191,14 @@ WENOMultiMat_P1( const std::vector< int >& esuel,
   // limit primitive quantities
   for (inciter::ncomp_t c=0; c<nprim; ++c)
   {
-    for (std::size_t e=0; e<nelem; ++e)
+    for (auto e : troubled)
     {
       WENOFunction(P, esuel, e, c, rdof, offset, cweight, limU);
     }
 
     auto mark = c*rdof;
 
-    for (std::size_t e=0; e<nelem; ++e)
+    for (auto e : troubled)
     {
       P(e, mark+1, offset) = limU[0][e];
       P(e, mark+2, offset) = limU[1][e];
@@ -132,7 +207,7 @@ WENOMultiMat_P1( const std::vector< int >& esuel,
   }
 
   std::vector< tk::real > phic(ncomp, 1.0), phip(nprim, 1.0);
-  for (std::size_t e=0; e<nelem; ++e)
+  for (auto e : troubled)
   {
     consistentMultiMatLimiting_P1(nmat, offset, rdof, e, U, P, phic, phip);
   }
@@ -142,6 +217,7 @@ void
 Superbee_P1( const std::vector< int >& esuel,
              const std::vector< std::size_t >& inpoel,
              const std::vector< std::size_t >& ndofel,
+             const std::vector< std::size_t >& troubled,
              inciter::ncomp_t offset,
              const tk::UnsMesh::Coords& coord,
              tk::Fields& U )
@@ -150,6 +226,7 @@ Superbee_P1( const std::vector< int >& esuel,
 //! \param[in] esuel Elements surrounding elements
 //! \param[in] inpoel Element connectivity
 //! \param[in] ndofel Vector of local number of degrees of freedom
+//! \param[in] troubled Ids of elements to limit, see troubledCells()
 //! \param[in] offset Index for equation systems
 //! \param[in] coord Array of nodal coordinates
 //! \param[in,out] U High-order solution vector which gets limited
@@ -162,7 +239,7 @@ Superbee_P1( const std::vector< int >& esuel,
 
   auto beta_lim = 2.0;
 
-  for (std::size_t e=0; e<esuel.size()/4; ++e)
+  for (auto e : troubled)
   {
     // If an rDG method is set up (P0P1), then, currently we compute the P1
     // basis functions and solutions by default. This implies that P0P1 is
@@ -201,6 +278,7 @@ SuperbeeMultiMat_P1(
   const std::vector< int >& esuel,
   const std::vector< std::size_t >& inpoel,
   const std::vector< std::size_t >& ndofel,
+  const std::vector< std::size_t >& troubled,
   inciter::ncomp_t offset,
   const tk::UnsMesh::Coords& coord,
   tk::Fields& U,
@@ -211,6 +289,7 @@ SuperbeeMultiMat_P1(
 //! \param[in] esuel Elements surrounding elements
 //! \param[in] inpoel Element connectivity
 //! \param[in] ndofel Vector of local number of degrees of freedom
+//! \param[in] troubled Ids of elements to limit, see troubledCells()
 //! \param[in] offset Index for equation systems
 //! \param[in] coord Array of nodal coordinates
 //! \param[in,out] U High-order solution vector which gets limited
@@ -226,7 +305,7 @@ SuperbeeMultiMat_P1(
 
   auto beta_lim = 2.0;
 
-  for (std::size_t e=0; e<esuel.size()/4; ++e)
+  for (auto e : troubled)
   {
     // If an rDG method is set up (P0P1), then, currently we compute the P1
     // basis functions and solutions by default. This implies that P0P1 is
@@ -278,7 +357,7 @@ VertexBasedMultiMat_P1(
   const std::map< std::size_t, std::vector< std::size_t > >& esup,
   const std::vector< std::size_t >& inpoel,
   const std::vector< std::size_t >& ndofel,
-  std::size_t nelem,
+  const std::vector< std::size_t >& troubled,
   std::size_t offset,
   const tk::UnsMesh::Coords& coord,
   tk::Fields& U,
@@ -289,7 +368,7 @@ VertexBasedMultiMat_P1(
 //! \param[in] esup Elements surrounding points
 //! \param[in] inpoel Element connectivity
 //! \param[in] ndofel Vector of local number of degrees of freedom
-//! \param[in] nelem Number of elements
+//! \param[in] troubled Ids of elements to limit, see troubledCells()
 //! \param[in] offset Index for equation systems
 //! \param[in] coord Array of nodal coordinates
 //! \param[in,out] U High-order solution vector which gets limited
@@ -299,6 +378,8 @@ VertexBasedMultiMat_P1(
 //!   For details see: Kuzmin, D. (2010). A vertex-based hierarchical slope
 //!   limiter for p-adaptive discontinuous Galerkin methods. Journal of
 //!   computational and applied mathematics, 233(12), 3077-3085.
+//! \note Limiting only modifies the high-order dofs, so the bounds of the
+//!   cell averages at the nodes are computed once before limiting.
 // *****************************************************************************
 {
   const auto rdof = inciter::g_inputdeck.get< tag::discr, tag::rdof >();
@@ -306,7 +387,13 @@ VertexBasedMultiMat_P1(
   std::size_t ncomp = U.nprop()/rdof;
   std::size_t nprim = P.nprop()/rdof;
 
-  for (std::size_t e=0; e<nelem; ++e)
+  // min/max bounds of conserved and primitive quantities at nodes
+  const auto ubounds =
+    vertexBounds( U, esup, inpoel, troubled, rdof, offset, ncomp );
+  const auto pbounds =
+    vertexBounds( P, esup, inpoel, troubled, rdof, offset, nprim );
+
+  for (auto e : troubled)
   {
     // If an rDG method is set up (P0P1), then, currently we compute the P1
     // basis functions and solutions by default. This implies that P0P1 is
@@ -326,11 +413,11 @@ VertexBasedMultiMat_P1(
     if (dof_el > 1)
     {
       // limit conserved quantities
-      auto phic = VertexBasedFunction(U, esup, inpoel, coord, e, rdof, dof_el,
-        offset, ncomp);
+      auto phic = VertexBasedFunction(U, ubounds, inpoel, coord, e, rdof,
+        dof_el, offset, ncomp);
       // limit primitive quantities
-      auto phip = VertexBasedFunction(P, esup, inpoel, coord, e, rdof, dof_el,
-        offset, nprim);
+      auto phip = VertexBasedFunction(P, pbounds, inpoel, coord, e, rdof,
+        dof_el, offset, nprim);
 
       consistentMultiMatLimiting_P1(nmat, offset, rdof, e, U, P, phic, phip);
 
@@ -623,9 +710,60 @@ SuperbeeFunction( const tk::Fields& U,
   return phi;
 }
 
+VertexBounds
+vertexBounds( const tk::Fields& U,
+  const std::map< std::size_t, std::vector< std::size_t > >& esup,
+  const std::vector< std::size_t >& inpoel,
+  const std::vector< std::size_t >& troubled,
+  std::size_t rdof,
+  std::size_t offset,
+  std::size_t ncomp )
+// *****************************************************************************
+//  Min/max of cell averages surrounding the nodes of elements to limit
+//! \param[in] U High-order solution vector
+//! \param[in] esup Elements surrounding points
+//! \param[in] inpoel Element connectivity
+//! \param[in] troubled Ids of elements to limit, see troubledCells()
+//! \param[in] rdof Maximum number of reconstructed degrees of freedom
+//! \param[in] offset Index for equation systems
+//! \param[in] ncomp Number of scalar components in this PDE system
+//! \return Min/max bounds of the cell averages of all elements surrounding
+//!   each node of the elements to limit
+//! \details The neighborhood of each node is traversed once, instead of once
+//!   for each element containing the node, which is about 20 times on
+//!   tetrahedron meshes.
+// *****************************************************************************
+{
+  VertexBounds b;
+
+  // assign a compact index to the nodes of the elements to limit
+  for (auto e : troubled)
+    for (std::size_t lp=0; lp<4; ++lp)
+      b.id.emplace( inpoel[4*e+lp], b.id.size() );
+
+  // find min/max in the neighborhood of each node
+  b.minmax.resize( 2*ncomp*b.id.size() );
+  for (const auto& [p,i] : b.id) {
+    const auto& pesup = tk::cref_find(esup, p);
+    auto uMin = b.minmax.data() + 2*ncomp*i;
+    auto uMax = uMin + ncomp;
+    for (std::size_t c=0; c<ncomp; ++c)
+      uMin[c] = uMax[c] = U(pesup.front(), c*rdof, offset);
+    for (auto er : pesup)
+      for (std::size_t c=0; c<ncomp; ++c)
+      {
+        auto mark = c*rdof;
+        uMin[c] = std::min(uMin[c], U(er, mark, offset));
+        uMax[c] = std::max(uMax[c], U(er, mark, offset));
+      }
+  }
+
+  return b;
+}
+
 std::vector< tk::real >
 VertexBasedFunction( const tk::Fields& U,
-  const std::map< std::size_t, std::vector< std::size_t > >& esup,
+  const VertexBounds& bounds,
   const std::vector< std::size_t >& inpoel,
   const tk::UnsMesh::Coords& coord,
   std::size_t e,
@@ -636,7 +774,8 @@ VertexBasedFunction( const tk::Fields& U,
 // *****************************************************************************
 //  Kuzmin's vertex-based limiter function calculation for P1 dofs
 //! \param[in] U High-order solution vector which is to be limited
-//! \param[in] esup Elements surrounding points
+//! \param[in] bounds Min/max of cell averages at the nodes, see
+//!   vertexBounds()
 //! \param[in] inpoel Element connectivity
 //! \param[in] coord Array of nodal coordinates
 //! \param[in] e Id of element whose solution is to be limited
@@ -650,7 +789,8 @@ VertexBasedFunction( const tk::Fields& U,
   // Kuzmin's vertex-based TVD limiter uses min-max bounds that the
   // high-order solution should satisfy, to ensure TVD properties. For a
   // high-order method like DG, this involves the following steps:
-  // 1. Find min-max bounds in the nodal-neighborhood of cell.
+  // 1. Find min-max bounds in the nodal-neighborhood of cell, see
+  //    vertexBounds().
   // 2. Calculate the limiter function (Superbee) for all the vertices of cell.
   //    From these, use the minimum value of the limiter function.
 
@@ -670,33 +810,17 @@ VertexBasedFunction( const tk::Fields& U,
   auto detT =
     tk::Jacobian( coordel[0], coordel[1], coordel[2], coordel[3] );
 
-  std::vector< tk::real > uMin(ncomp, 0.0), uMax(ncomp, 0.0), phi(ncomp, 1.0);
+  std::vector< tk::real > phi(ncomp, 1.0);
 
   // loop over all nodes of the element e
   for (std::size_t lp=0; lp<4; ++lp)
   {
-    // reset min/max
-    for (std::size_t c=0; c<ncomp; ++c)
-    {
-      auto mark = c*rdof;
-      uMin[c] = U(e, mark, offset);
-      uMax[c] = U(e, mark, offset);
-    }
-
     auto p = inpoel[4*e+lp];
-    const auto& pesup = tk::cref_find(esup, p);
 
-    // ----- Step-1: find min/max in the neighborhood of node p
-    // loop over all the elements surrounding this node p
-    for (auto er : pesup)
-    {
-      for (std::size_t c=0; c<ncomp; ++c)
-      {
-        auto mark = c*rdof;
-        uMin[c] = std::min(uMin[c], U(er, mark, offset));
-        uMax[c] = std::max(uMax[c], U(er, mark, offset));
-      }
-    }
+    // ----- Step-1: min/max in the neighborhood of node p
+    const auto uMin =
+      bounds.minmax.data() + 2*ncomp*tk::cref_find(bounds.id, p);
+    const auto uMax = uMin + ncomp;
 
     // ----- Step-2: compute the limiter function at this node
 
@@ -14,6 +14,8 @@
 #ifndef Limiter_h
 #define Limiter_h
 
+#include <unordered_map>
+
 #include "Types.hpp"
 #include "Fields.hpp"
 #include "UnsMesh.hpp"
@@ -23,15 +25,33 @@ namespace inciter {
 
 using ncomp_t = kw::ncomp::info::expect::type;
 
+//! Min/max bounds of cell averages at nodes, see vertexBounds()
+struct VertexBounds {
+  //! Compact index of the nodes whose bounds are stored, keyed by node id
+  std::unordered_map< std::size_t, std::size_t > id;
+  //! Bounds of all nodes, 2*ncomp per node: minimum then maximum of each
+  //! scalar component, addressed by the compact index of the node
+  std::vector< tk::real > minmax;
+};
+
+//! Find troubled cells, i.e., elements whose P1 solution is to be limited
+std::vector< std::size_t >
+troubledCells( std::size_t nelem,
+               const std::vector< std::size_t >& ndofel,
+               const tk::Fields& U,
+               const tk::Fields& P );
+
 //! Weighted Essentially Non-Oscillatory (WENO) limiter for DGP1
 void
 WENO_P1( const std::vector< int >& esuel,
+         const std::vector< std::size_t >& troubled,
          inciter::ncomp_t offset,
          tk::Fields& U );
 
 //! Weighted Essentially Non-Oscillatory (WENO) limiter for multi-material DGP1
 void
 WENOMultiMat_P1( const std::vector< int >& esuel,
+                 const std::vector< std::size_t >& troubled,
                  inciter::ncomp_t offset,
                  tk::Fields& U,
                  tk::Fields& P,
@@ -42,6 +62,7 @@ void
 Superbee_P1( const std::vector< int >& esuel,
              const std::vector< std::size_t >& inpoel,
              const std::vector< std::size_t >& ndofel,
+             const std::vector< std::size_t >& troubled,
              inciter::ncomp_t offset,
              const tk::UnsMesh::Coords& coord,
              tk::Fields& U );
@@ -52,6 +73,7 @@ SuperbeeMultiMat_P1(
   const std::vector< int >& esuel,
   const std::vector< std::size_t >& inpoel,
   const std::vector< std::size_t >& ndofel,
+  const std::vector< std::size_t >& troubled,
   inciter::ncomp_t offset,
   const tk::UnsMesh::Coords& coord,
   tk::Fields& U,
@@ -64,7 +86,7 @@ VertexBasedMultiMat_P1(
   const std::map< std::size_t, std::vector< std::size_t > >& esup,
   const std::vector< std::size_t >& inpoel,
   const std::vector< std::size_t >& ndofel,
-  std::size_t nelem,
+  const std::vector< std::size_t >& troubled,
   std::size_t offset,
   const tk::UnsMesh::Coords& coord,
   tk::Fields& U,
@@ -96,10 +118,20 @@ SuperbeeFunction( const tk::Fields& U,
                   inciter:: ncomp_t ncomp,
                   tk::real beta_lim );
 
+//! Min/max of cell averages surrounding the nodes of elements to limit
+VertexBounds
+vertexBounds( const tk::Fields& U,
+  const std::map< std::size_t, std::vector< std::size_t > >& esup,
+  const std::vector< std::size_t >& inpoel,
+  const std::vector< std::size_t >& troubled,
+  std::size_t rdof,
+  std::size_t offset,
+  std::size_t ncomp );
+
 //! Kuzmin's vertex-based limiter function calculation for P1 dofs
 std::vector< tk::real >
 VertexBasedFunction( const tk::Fields& U,
-  const std::map< std::size_t, std::vector< std::size_t > >& esup,
+  const VertexBounds& bounds,
   const std::vector< std::size_t >& inpoel,
   const tk::UnsMesh::Coords& coord,
   std::size_t e,
@@ -29,7 +29,6 @@
 #include "Integrate/Basis.hpp"
 #include "Integrate/Quadrature.hpp"
 #include "Integrate/Initialize.hpp"
-#include "Integrate/Mass.hpp"
 #include "Integrate/Surface.hpp"
 #include "Integrate/Boundary.hpp"
 #include "Integrate/Volume.hpp"
@@ -68,6 +67,7 @@ class MultiMat {
       m_system( c ),
       m_ncomp( g_inputdeck.get< tag::component, eq >().at(c) ),
       m_offset( g_inputdeck.get< tag::component >().offset< eq >(c) ),
+      m_mat( eos_params< eq >( c ) ),
       m_riemann( tk::cref_find( multimatRiemannSolvers(),
         g_inputdeck.get< tag::param, tag::multimat, tag::flux >().at(m_system) ) )
     {
@@ -93,31 +93,23 @@ class MultiMat {
     }
 
     //! Initalize the compressible flow equations, prepare for time integration
-    //! \param[in] L Block diagonal mass matrix
+    //! \param[in] geoElem Element geometry array
     //! \param[in] inpoel Element-node connectivity
     //! \param[in] coord Array of nodal coordinates
     //! \param[in,out] unk Array of unknowns
     //! \param[in] t Physical time
     //! \param[in] nielem Number of internal elements
-    void initialize( const tk::Fields& L,
+    void initialize( const tk::Fields& geoElem,
                      const std::vector< std::size_t >& inpoel,
                      const tk::UnsMesh::Coords& coord,
                      tk::Fields& unk,
                      tk::real t,
                      const std::size_t nielem ) const
     {
-      tk::initialize( m_system, m_ncomp, m_offset, L, inpoel, coord,
+      tk::initialize( m_system, m_ncomp, m_offset, geoElem, inpoel, coord,
                       Problem::solution, unk, t, nielem );
     }
 
-    //! Compute the left hand side block-diagonal mass matrix
-    //! \param[in] geoElem Element geometry array
-    //! \param[in,out] l Block diagonal mass matrix
-    void lhs( const tk::Fields& geoElem, tk::Fields& l ) const {
-      const auto ndof = g_inputdeck.get< tag::discr, tag::ndof >();
-      tk::mass( m_ncomp, m_offset, ndof, geoElem, l );
-    }
-
     //! Update the primitives for this PDE system
     //! \param[in] unk Array of unknowns
     //! \param[in,out] prim Array of primitives
@@ -171,8 +163,8 @@ class MultiMat {
           tk::real arhoemat = unk(e, energyDofIdx(nmat, k, rdof, 0), m_offset);
           tk::real alphamat = unk(e, volfracDofIdx(nmat, k, rdof, 0), m_offset);
           prim(e, pressureDofIdx(nmat, k, rdof, 0), m_offset) =
-            eos_pressure< tag::multimat >( m_system, arhomat, vel[0], vel[1],
-              vel[2], arhoemat, alphamat, k );
+            eos_pressure( m_mat[k], arhomat, vel[0], vel[1], vel[2], arhoemat,
+              alphamat );
         }
       }
     }
@@ -266,8 +258,7 @@ class MultiMat {
             // energy change
             auto rhomat = unk(e, densityDofIdx(nmat, k, rdof, 0), m_offset)
               / alk_new;
-            rhoEmat = eos_totalenergy< eq >(m_system, rhomat, u, v, w,
-              p_target, k);
+            rhoEmat = eos_totalenergy( m_mat[k], rhomat, u, v, w, p_target );
 
             // volume-fraction and total energy flux into majority material
             d_al += (alk - alk_new);
@@ -300,10 +291,10 @@ class MultiMat {
 
         // correct pressure of majority material
         prim(e, pressureDofIdx(nmat, kmax, rdof, 0), m_offset) =
-          eos_pressure< eq >(m_system,
+          eos_pressure( m_mat[kmax],
           unk(e, densityDofIdx(nmat, kmax, rdof, 0), m_offset), u, v, w,
           unk(e, energyDofIdx(nmat, kmax, rdof, 0), m_offset),
-          unk(e, volfracDofIdx(nmat, kmax, rdof, 0), m_offset), kmax);
+          unk(e, volfracDofIdx(nmat, kmax, rdof, 0), m_offset) );
 
         // check for unphysical state
         pmax = prim(e, pressureDofIdx(nmat, kmax, rdof, 0), m_offset)/almax;
@@ -343,6 +334,8 @@ class MultiMat {
     //! \param[in] geoFace Face geometry array
     //! \param[in] geoElem Element geometry array
     //! \param[in] fd Face connectivity and boundary conditions object
+    //! \param[in] lhsinv Inverse of the least-squares reconstruction matrix of
+    //!   each element, see tk::invLeastSq_P0P1()
 //    //! \param[in] esup Elements-surrounding-nodes connectivity
     //! \param[in] inpoel Element-node connectivity
     //! \param[in] coord Array of nodal coordinates
@@ -352,6 +345,8 @@ class MultiMat {
                       const tk::Fields& geoFace,
                       const tk::Fields& geoElem,
                       const inciter::FaceData& fd,
+                      const std::vector< std::array<
+                        std::array< tk::real, 3 >, 3 > >& lhsinv,
                       const std::map< std::size_t, std::vector< std::size_t > >&
                         /*esup*/,
                       const std::vector< std::size_t >& inpoel,
@@ -367,17 +362,15 @@ class MultiMat {
       Assert( fd.Inpofa().size()/3 == fd.Esuf().size()/2,
               "Mismatch in inpofa size" );
 
-      // allocate and initialize matrix and vector for reconstruction:
-      // lhs_ls is the left-hand side matrix for solving the least-squares
-      // system using the normal equation approach, for each mesh element.
-      // It is indexed as follows:
+      // lhsinv is the inverse of the left-hand side matrix for solving the
+      // least-squares system using the normal equation approach, for each
+      // mesh element. It is indexed as follows:
       // The first index is the element id;
       // the second index is the row id of the 3-by-3 matrix;
       // the third index is the column id of the 3-by-3 matrix.
-      std::vector< std::array< std::array< tk::real, 3 >, 3 > >
-        lhs_ls( nelem, {{ {{0.0, 0.0, 0.0}},
-                          {{0.0, 0.0, 0.0}},
-                          {{0.0, 0.0, 0.0}} }} );
+      Assert( lhsinv.size() == nelem, "Size mismatch in least-squares lhs" );
+
+      // allocate and initialize vector for reconstruction:
       // rhs_ls is the right-hand side vector for solving the least-squares
       // system using the normal equation approach, for each element.
       // It is indexed as follows:
@@ -396,9 +389,8 @@ class MultiMat {
             {{ 0.0, 0.0, 0.0 }} ) );
 
       // reconstruct x,y,z-derivatives of unknowns. For multimat, conserved and
-      // primitive quantities are reconstructed separately.
-      // 0. get lhs matrix, which is only geometry dependent
-      tk::lhsLeastSq_P0P1(fd, geoElem, geoFace, lhs_ls);
+      // primitive quantities are reconstructed separately. The inverse of the
+      // lhs matrix, which is only geometry dependent, is given in lhsinv.
 
       // 1. internal face contributions
       tk::intLeastSq_P0P1( m_ncomp, m_offset, rdof, fd, geoElem, U, rhsu_ls );
@@ -414,14 +406,16 @@ class MultiMat {
       }
 
       // 3. solve 3x3 least-squares system
-      tk::solveLeastSq_P0P1( m_ncomp, m_offset, rdof, lhs_ls, rhsu_ls, U );
-      tk::solveLeastSq_P0P1( nprim(), m_offset, rdof, lhs_ls, rhsp_ls, P );
+      tk::solveLeastSq_P0P1( m_ncomp, m_offset, rdof, lhsinv, rhsu_ls, U );
+      tk::solveLeastSq_P0P1( nprim(), m_offset, rdof, lhsinv, rhsp_ls, P );
 
       //// 1. Reconstruct second-order dofs in Taylor space using nodal-stencils
+      //std::vector< std::array< std::array< tk::real, 3 >, 3 > > lhsinv_ext;
+      //tk::invLeastSqExtStencil( nelem, esup, inpoel, geoElem, lhsinv_ext );
       //tk::recoLeastSqExtStencil( rdof, m_offset, nelem, esup, inpoel, geoElem,
-      //  U );
+      //  lhsinv_ext, U );
       //tk::recoLeastSqExtStencil( rdof, m_offset, nelem, esup, inpoel, geoElem,
-      //  P );
+      //  lhsinv_ext, P );
 
       // 4. transform reconstructed derivatives to Dubiner dofs
       tk::transform_P0P1( m_ncomp, m_offset, rdof, nelem, inpoel, coord, U );
@@ -437,6 +431,7 @@ class MultiMat {
     //! \param[in] inpoel Element-node connectivity
     //! \param[in] coord Array of nodal coordinates
     //! \param[in] ndofel Vector of local number of degrees of freedome
+    //! \param[in] troubled Ids of elements to limit
     //! \param[in,out] U Solution vector at recent time step
     //! \param[in,out] P Vector of primitives at recent time step
     void limit( [[maybe_unused]] tk::real t,
@@ -447,6 +442,7 @@ class MultiMat {
                 const std::vector< std::size_t >& inpoel,
                 const tk::UnsMesh::Coords& coord,
                 const std::vector< std::size_t >& ndofel,
+                const std::vector< std::size_t >& troubled,
                 tk::Fields& U,
                 tk::Fields& P ) const
     {
@@ -460,17 +456,17 @@ class MultiMat {
       // limit vectors of conserved and primitive quantities
       if (limiter == ctr::LimiterType::SUPERBEEP1)
       {
-        SuperbeeMultiMat_P1( fd.Esuel(), inpoel, ndofel, m_offset, coord, U, P,
-          nmat );
+        SuperbeeMultiMat_P1( fd.Esuel(), inpoel, ndofel, troubled, m_offset,
+          coord, U, P, nmat );
       }
       else if (limiter == ctr::LimiterType::VERTEXBASEDP1)
       {
-        VertexBasedMultiMat_P1( esup, inpoel, ndofel, fd.Esuel().size()/4,
-          m_offset, coord, U, P, nmat );
+        VertexBasedMultiMat_P1( esup, inpoel, ndofel, troubled, m_offset,
+          coord, U, P, nmat );
       }
       else if (limiter == ctr::LimiterType::WENOP1)
       {
-        WENOMultiMat_P1( fd.Esuel(), m_offset, U, P, nmat );
+        WENOMultiMat_P1( fd.Esuel(), troubled, m_offset, U, P, nmat );
       }
     }
 
@@ -484,7 +480,13 @@ class MultiMat {
     //! \param[in] U Solution vector at recent time step
     //! \param[in] P Primitive vector at recent time step
     //! \param[in] ndofel Vector of local number of degrees of freedome
+    //! \param[in] elems Element ids bucketed by their local number of dofs
+    //! \param[in] part Part of the right hand side to compute, see RhsPart
     //! \param[in,out] R Right-hand side vector computed
+    //! \details The non-conservative terms need the Riemann derivatives
+    //!   integrated over all faces of an element, thus nothing is computed for
+    //!   the part not depending on ghost data, and all of the right hand side
+    //!   is computed with the chare-boundary faces.
     void rhs( tk::real t,
               const tk::Fields& geoFace,
               const tk::Fields& geoElem,
@@ -494,6 +496,8 @@ class MultiMat {
               const tk::Fields& U,
               const tk::Fields& P,
               const std::vector< std::size_t >& ndofel,
+              const tk::NdofBuckets& elems,
+              inciter::RhsPart part,
               tk::Fields& R ) const
     {
       const auto ndof = g_inputdeck.get< tag::discr, tag::ndof >();
@@ -517,6 +521,8 @@ class MultiMat {
               "Mismatch in inpofa size" );
       Assert( ndof == 1, "DGP1/2 not set up for multi-material" );
 
+      if (part == inciter::RhsPart::OWN) return;
+
       // set rhs to zero
       R.fill(0.0);
 
@@ -530,6 +536,11 @@ class MultiMat {
                 const std::array< std::vector< tk::real >, 2 >& u,
                 const std::vector< std::array< tk::real, 3 > >& v )
               { return m_riemann.flux( fn, u, v ); };
+      // configure batched Riemann flux function
+      auto rieflxbatchfn =
+        [this]( const tk::RiemannBatch& b,
+                std::vector< std::vector< tk::real > >& flx )
+              { m_riemann.fluxes( b, flx ); };
 
       // configure a no-op lambda for prescribed velocity
       auto velfn = [this]( ncomp_t, ncomp_t, tk::real, tk::real, tk::real ){
@@ -537,13 +548,13 @@ class MultiMat {
 
       // compute internal surface flux integrals
       tk::surfInt( m_system, nmat, m_offset, ndof, rdof, inpoel, coord,
-                   fd, geoFace, rieflxfn, velfn, U, P, ndofel, R,
-                   riemannDeriv );
+                   fd, inciter::RhsPart::ALL, rieflxbatchfn, velfn, U, P,
+                   ndofel, R, riemannDeriv );
 
       if(ndof > 1)
         // compute volume integrals
-        tk::volInt( m_system, m_ncomp, m_offset, ndof, nelem, inpoel, coord,
-                    geoElem, flux, velfn, U, ndofel, R );
+        tk::volInt( m_system, m_ncomp, m_offset, ndof, elems, inpoel, coord,
+                    geoElem, flux, velfn, U, R );
 
       // compute boundary surface flux integrals
       for (const auto& b : m_bc)
@@ -563,10 +574,15 @@ class MultiMat {
           riemannDeriv[k][e] /= geoElem(e, 0, 0);
       }
 
+      // find the materials present in each element, absent materials (such
+      // as the trace amounts initial conditions fill the domain with) are
+      // skipped in the multi-material terms below
+      auto mic = tk::matInCell( nmat, m_offset, rdof, nelem, U, 1.0e-10 );
+
       // compute volume integrals of non-conservative terms
       tk::nonConservativeInt( m_system, nmat, m_offset, ndof, rdof, nelem,
                               inpoel, coord, geoElem, U, P, riemannDeriv,
-                              ndofel, R );
+                              ndofel, mic, R );
 
       // compute finite pressure relaxation terms
       if (g_inputdeck.get< tag::param, tag::multimat, tag::prelax >()[m_system])
@@ -574,7 +590,7 @@ class MultiMat {
         const auto ct = g_inputdeck.get< tag::param, tag::multimat,
                                          tag::prelax_timescale >()[m_system];
         tk::pressureRelaxationInt( m_system, nmat, m_offset, ndof, rdof, nelem,
-                                   geoElem, U, P, ndofel, ct, R );
+                                   geoElem, U, P, ndofel, mic, ct, R );
       }
     }
 
@@ -586,6 +602,8 @@ class MultiMat {
     //! \param[in] U Solution vector at recent time step
     //! \param[in] P Vector of primitive quantities at recent time step
     //! \param[in] nielem Number of internal elements
+    //! \param[in,out] dte Time step size of each element, lowered to the time
+    //!   step size allowed by this PDE system for internal elements
     //! \return Minimum time step size
     //! \details The allowable dt is calculated by looking at the maximum
     //!   wave-speed in elements surrounding each face, times the area of that
@@ -600,7 +618,8 @@ class MultiMat {
                  const std::vector< std::size_t >& /*ndofel*/,
                  const tk::Fields& U,
                  const tk::Fields& P,
-                 const std::size_t nielem ) const
+                 const std::size_t nielem,
+                 std::vector< tk::real >& dte ) const
     {
       const auto ndof = g_inputdeck.get< tag::discr, tag::ndof >();
       const auto rdof = g_inputdeck.get< tag::discr, tag::rdof >();
@@ -642,9 +661,9 @@ class MultiMat {
         for (std::size_t k=0; k<nmat; ++k)
         {
           if (ugp[volfracIdx(nmat, k)] > 1.0e-04) {
-            a = std::max( a, eos_soundspeed< tag::multimat >( 0,
+            a = std::max( a, eos_soundspeed( m_mat[k],
               ugp[densityIdx(nmat, k)], pgp[pressureIdx(nmat, k)],
-              ugp[volfracIdx(nmat, k)], k ) );
+              ugp[volfracIdx(nmat, k)] ) );
           }
         }
 
@@ -675,9 +694,9 @@ class MultiMat {
           for (std::size_t k=0; k<nmat; ++k)
           {
             if (ugp[volfracIdx(nmat, k)] > 1.0e-04) {
-              a = std::max( a, eos_soundspeed< tag::multimat >( 0,
+              a = std::max( a, eos_soundspeed( m_mat[k],
                 ugp[densityIdx(nmat, k)], pgp[pressureIdx(nmat, k)],
-                ugp[volfracIdx(nmat, k)], k ) );
+                ugp[volfracIdx(nmat, k)] ) );
             }
           }
 
@@ -693,12 +712,6 @@ class MultiMat {
 
       tk::real mindt = std::numeric_limits< tk::real >::max();
 
-      // compute allowable dt
-      for (std::size_t e=0; e<nielem; ++e)
-      {
-        mindt = std::min( mindt, geoElem(e,0,0)/delt[e] );
-      }
-
       tk::real dgp = 0.0;
       if (ndof == 4)
       {
@@ -709,9 +722,16 @@ class MultiMat {
         dgp = 2.0;
       }
 
-      // Scale smallest dt with CFL coefficient and the CFL is scaled by (2*p+1)
+      // compute allowable dt
+      // Scale dt with CFL coefficient and the CFL is scaled by (2*p+1)
       // where p is the order of the DG polynomial by linear stability theory.
-      mindt /= (2.0*dgp + 1.0);
+      for (std::size_t e=0; e<nielem; ++e)
+      {
+        auto edt = geoElem(e,0,0) / delt[e] / (2.0*dgp + 1.0);
+        dte[e] = std::min( dte[e], edt );
+        mindt = std::min( mindt, edt );
+      }
+
       return mindt;
     }
 
@@ -776,7 +796,7 @@ class MultiMat {
     //! Return field output going to file
     //! \param[in] rdof Total number of degrees of freedom
     //! \param[in] nunk Number of unknowns
-    //! \param[in,out] U Solution vector at recent time step
+    //! \param[in] U Solution vector at recent time step
     //! \param[in] P Vector of primitive quantities at recent time step
     //! \return Vector of vectors to be output to file
     std::vector< std::vector< tk::real > >
@@ -785,7 +805,7 @@ class MultiMat {
                  std::size_t rdof,
                  std::size_t nunk,
                  const tk::Fields&,
-                 tk::Fields& U,
+                 const tk::Fields& U,
                  const tk::Fields& P ) const
     {
       // number of materials
@@ -830,7 +850,7 @@ class MultiMat {
     //! Return surface field output going to file
     std::vector< std::vector< tk::real > >
     surfOutput( const std::map< int, std::vector< std::size_t > >&,
-                tk::Fields& ) const
+                const tk::Fields& ) const
     {
       std::vector< std::vector< tk::real > > s; // punt for now
       return s;
@@ -862,6 +882,8 @@ class MultiMat {
     const ncomp_t m_ncomp;
     //! Offset PDE system operates from
     const ncomp_t m_offset;
+    //! Material constants of the equations of state
+    const std::vector< EoSParam > m_mat;
     //! Riemann solver
     RiemannSolver m_riemann;
     //! BC configuration
@@ -10,18 +10,22 @@
     files for compressible multi-material equations.
 */
 // *****************************************************************************
+#include <algorithm>
+
 #include "FieldOutput.hpp"
 #include "MultiMat/MultiMatIndexing.hpp"
 #include "EoS/EoS.hpp"
 
 namespace inciter {
 
+namespace {
+
 std::vector< std::string >
-MultiMatFieldNames( std::size_t nmat )
+MultiMatAllFieldNames( std::size_t nmat )
 // *****************************************************************************
-// Return multi-material field names to be output to file
+// Return names of all multi-material fields that can be output
 //! \param[in] nmat Number of materials in system
-//! \return Vector of strings labelling fields output in file
+//! \return Vector of strings labelling all fields, see MultiMatFieldOutput()
 // *****************************************************************************
 {
   std::vector< std::string > n;
@@ -45,6 +49,23 @@ MultiMatFieldNames( std::size_t nmat )
   return n;
 }
 
+} // ::
+
+std::vector< std::string >
+MultiMatFieldNames( std::size_t nmat )
+// *****************************************************************************
+// Return multi-material field names to be output to file
+//! \param[in] nmat Number of materials in system
+//! \return Vector of strings labelling fields output in file, only those
+//!   selected in the input deck, see InputDeck::outvar()
+// *****************************************************************************
+{
+  auto n = MultiMatAllFieldNames( nmat );
+  n.erase( std::remove_if( begin(n), end(n), []( const std::string& s ){
+             return !g_inputdeck.outvar( s ); } ), end(n) );
+  return n;
+}
+
 std::vector< std::vector< tk::real > >
 MultiMatFieldOutput(
   ncomp_t,
@@ -52,7 +73,7 @@ MultiMatFieldOutput(
   ncomp_t offset,
   std::size_t nunk,
   std::size_t rdof,
-  tk::Fields& U,
+  const tk::Fields& U,
   const tk::Fields& P )
 // *****************************************************************************
 //  Return field output going to file
@@ -63,7 +84,12 @@ MultiMatFieldOutput(
 //! \param[in] rdof Number of reconstructed degrees of freedom
 //! \param[in] U Solution vector at recent time step
 //! \param[in] P Vector of primitive quantities at recent time step
-//! \return Vector of vectors to be output to file
+//! \return Vector of vectors to be output to file, only those selected in
+//!   the input deck, in the order of MultiMatFieldNames()
+//! \details All fields selected are computed in a single pass over the
+//!   unknowns, so the solution of each unknown is read once. Fields not
+//!   selected are neither allocated nor computed, e.g., the material sound
+//!   speeds, which require evaluating the equation of state.
 // *****************************************************************************
 {
   // field-output vector with:
@@ -76,81 +102,48 @@ MultiMatFieldOutput(
   // - nmat material sound-speeds
   // - 1 bulk total energy density
   // - 1 material indicator
-  // leading to a size of 4*nmat+7
+  // leading to a size of 4*nmat+7, of which only those selected are output
+  const auto names = MultiMatAllFieldNames( nmat );
+  Assert( names.size() == 4*nmat+7, "Size mismatch" );
+
+  // allocate fields selected, null pointers to those not output
+  std::vector< char > sel( names.size() );
+  for (std::size_t j=0; j<names.size(); ++j)
+    sel[j] = g_inputdeck.outvar( names[j] );
   std::vector< std::vector< tk::real > >
-    out( 4*nmat+7, std::vector< tk::real >( nunk ) );
-
-  //// mesh node coordinates
-  //const auto& x = coord[0];
-  //const auto& y = coord[1];
-  //const auto& z = coord[2];
-
-  // material volume-fractions
-  for (std::size_t k=0; k<nmat; ++k) {
-    for (std::size_t i=0; i<nunk; ++i)
-      out[k][i] = U(i, volfracDofIdx(nmat, k, rdof, 0), offset);
-  }
-
-  // material densities
-  for (std::size_t k=0; k<nmat; ++k) {
-    for (std::size_t i=0; i<nunk; ++i) {
-      out[nmat+k][i] = U(i, densityDofIdx(nmat, k, rdof, 0), offset) /
-        std::max(1e-16, U(i, volfracDofIdx(nmat, k, rdof, 0), offset));
-    }
-  }
-
-  // bulk density
-  for (std::size_t i=0; i<nunk; ++i) {
-    for (std::size_t k=0; k<nmat; ++k)
-      out[2*nmat][i] += U(i, densityDofIdx(nmat, k, rdof, 0), offset);
-  }
-
-  // velocity components
-  for (std::size_t i=0; i<nunk; ++i) {
-    out[2*nmat+1][i] = P(i, velocityDofIdx(nmat, 0, rdof, 0), offset);
-    out[2*nmat+2][i] = P(i, velocityDofIdx(nmat, 1, rdof, 0), offset);
-    out[2*nmat+3][i] = P(i, velocityDofIdx(nmat, 2, rdof, 0), offset);
-  }
-
-  // material pressures
-  for (std::size_t k=0; k<nmat; ++k) {
-    for (std::size_t i=0; i<nunk; ++i) {
-      out[2*nmat+4+k][i] =
-        P(i, pressureDofIdx(nmat, k, rdof, 0), offset) /
-        std::max(1e-16, U(i, volfracDofIdx(nmat, k, rdof, 0), offset));
-    }
-  }
-
-  // bulk pressure
-  for (std::size_t i=0; i<nunk; ++i) {
-    for (std::size_t k=0; k<nmat; ++k)
-      out[3*nmat+4][i] += P(i, pressureDofIdx(nmat, k, rdof, 0), offset);
-  }
-
-  // material sound speeds
-  for (std::size_t k=0; k<nmat; ++k) {
-    for (std::size_t i=0; i<nunk; ++i) {
-      out[3*nmat+5+k][i] =
-      eos_soundspeed< tag::multimat >( 0,
-        std::max(1e-16, U(i, densityDofIdx(nmat,k,rdof,0), offset)),
-        P(i, pressureDofIdx(nmat,k,rdof,0), offset),
-        U(i, volfracDofIdx(nmat,k,rdof,0), offset), k );
-    }
-  }
-
-  // bulk total energy density
-  for (std::size_t i=0; i<nunk; ++i) {
-    for (std::size_t k=0; k<nmat; ++k)
-      out[4*nmat+5][i] += U(i, energyDofIdx(nmat, k, rdof, 0), offset);
-  }
+    out( static_cast< std::size_t >( std::count( begin(sel), end(sel), 1 ) ),
+         std::vector< tk::real >( nunk ) );
+  std::vector< tk::real* > f( names.size(), nullptr );
+  for (std::size_t j=0, o=0; j<names.size(); ++j)
+    if (sel[j]) f[j] = out[ o++ ].data();
 
-  // material indicator
   for (std::size_t i=0; i<nunk; ++i) {
-    out[4*nmat+6][i] = 0.0;
+    tk::real rho = 0.0, p = 0.0, rhoE = 0.0, ind = 0.0;
     for (std::size_t k=0; k<nmat; ++k) {
-      out[4*nmat+6][i] += U(i, volfracDofIdx(nmat,k,rdof,0), offset)
-        * static_cast< tk::real >(k+1);
+      const auto al = U(i, volfracDofIdx(nmat, k, rdof, 0), offset);
+      const auto arho = U(i, densityDofIdx(nmat, k, rdof, 0), offset);
+      const auto ap = P(i, pressureDofIdx(nmat, k, rdof, 0), offset);
+      // material volume-fraction, density, pressure, and sound speed
+      if (f[k]) f[k][i] = al;
+      if (f[nmat+k]) f[nmat+k][i] = arho / std::max(1e-16, al);
+      if (f[2*nmat+4+k]) f[2*nmat+4+k][i] = ap / std::max(1e-16, al);
+      if (f[3*nmat+5+k])
+        f[3*nmat+5+k][i] = eos_soundspeed< tag::multimat >( 0,
+          std::max(1e-16, arho), ap, al, k );
+      // bulk density, pressure, total energy density, material indicator
+      rho += arho;
+      p += ap;
+      rhoE += U(i, energyDofIdx(nmat, k, rdof, 0), offset);
+      ind += al * static_cast< tk::real >(k+1);
     }
+    if (f[2*nmat]) f[2*nmat][i] = rho;
+    // velocity components
+    for (std::size_t d=0; d<3; ++d)
+      if (f[2*nmat+1+d])
+        f[2*nmat+1+d][i] = P(i, velocityDofIdx(nmat, d, rdof, 0), offset);
+    if (f[3*nmat+4]) f[3*nmat+4][i] = p;
+    if (f[4*nmat+5]) f[4*nmat+5][i] = rhoE;
+    if (f[4*nmat+6]) f[4*nmat+6][i] = ind;
   }
 
   return out;
@@ -31,7 +31,7 @@ MultiMatFieldOutput(
   ncomp_t offset,
   std::size_t nunk,
   std::size_t rdof,
-  tk::Fields& U,
+  const tk::Fields& U,
   const tk::Fields& P );
 
 } //inciter::
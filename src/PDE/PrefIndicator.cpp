@@ -18,6 +18,7 @@
 #include "Vector.hpp"
 #include "Integrate/Basis.hpp"
 #include "Integrate/Quadrature.hpp"
+#include "Integrate/Mass.hpp"
 
 namespace inciter {
 
@@ -25,7 +26,6 @@ static
 void spectral_decay( std::size_t nunk,
                      const std::vector< int >& esuel,
                      const tk::Fields& unk,
-                     std::size_t ndof,
                      std::size_t ndofmax,
                      tk::real tolref,
                      std::vector< std::size_t >& ndofel )
@@ -34,7 +34,6 @@ void spectral_decay( std::size_t nunk,
 //! \param[in] nunk Number of unknowns
 //! \param[in] esuel Elements surrounding elements
 //! \param[in] unk Array of unknowns
-//! \param[in] ndof Number of degrees of freedom in the solution
 //! \param[in] ndofmax Max number of degrees of freedom for p-refinement
 //! \param[in] tolref Tolerance for p-refinement
 //! \param[in,out] ndofel Vector of local number of degrees of freedome
@@ -48,8 +47,6 @@ void spectral_decay( std::size_t nunk,
 //!    in space and time"
 // *****************************************************************************
 {
-  const auto ncomp = unk.nprop() / ndof;
-
   // The array storing the adaptive indicator for each elements
   std::vector< tk::real > Ind(nunk, 0);
 
@@ -57,51 +54,18 @@ void spectral_decay( std::size_t nunk,
   {
     if(ndofel[e] > 1)
     {
-      auto ng = tk::NGvol(ndofel[e]);
-
-      // arrays for quadrature points
-      std::array< std::vector< tk::real >, 3 > coordgp;
-      std::vector< tk::real > wgp;
-
-      coordgp[0].resize( ng );
-      coordgp[1].resize( ng );
-      coordgp[2].resize( ng );
-      wgp.resize( ng );
-
-      tk::GaussQuadratureTet( ng, coordgp, wgp );
+      // Due to the orthogonality of the basis, the integrals of the square of
+      // the solution and of its highest-order part reduce to sums of the
+      // squares of the modal coefficients of the first scalar component
+      // weighted by the mass matrix per unit volume, so no quadrature is
+      // needed
+      const std::size_t nlow = ndofel[e] > 4 ? 4 : 1;
 
       tk::real dU(0), U(0);
-
-      // Gaussian quadrature
-      for (std::size_t igp=0; igp<ng; ++igp)
-      {
-        // Compute the basis function
-        auto B = tk::eval_basis( ndofel[e], coordgp[0][igp], coordgp[1][igp],
-                                 coordgp[2][igp] );
-
-        auto state = tk::eval_state( ncomp, 0, ndof, ndofel[e], e, unk, B );
-
-        U += wgp[igp] * state[0] * state[0];
-
-        if(ndofel[e] > 4)
-        {
-           auto dU_p2 = unk(e, 4, 0) * B[4]
-                      + unk(e, 5, 0) * B[5]
-                      + unk(e, 6, 0) * B[6]
-                      + unk(e, 7, 0) * B[7]
-                      + unk(e, 8, 0) * B[8]
-                      + unk(e, 9, 0) * B[9];
-
-           dU += wgp[igp] * dU_p2 * dU_p2;
-        }
-        else
-        {
-           auto dU_p1 = unk(e, 1, 0) * B[1]
-                      + unk(e, 2, 0) * B[2]
-                      + unk(e, 3, 0) * B[3];
-
-           dU += wgp[igp] * dU_p1 * dU_p1;
-        }
+      for (std::size_t k=0; k<ndofel[e]; ++k) {
+        auto u2 = tk::dubinerMass[k] * unk(e, k, 0) * unk(e, k, 0);
+        U += u2;
+        if (k >= nlow) dU += u2;
       }
 
       Ind[e] = log10( dU / U );
@@ -333,7 +297,7 @@ void eval_ndof( std::size_t nunk,
   const auto& esuel = fd.Esuel();
 
   if(indicator == inciter::ctr::PrefIndicatorType::SPECTRAL_DECAY)
-    spectral_decay( nunk, esuel, unk, ndof, ndofmax, tolref, ndofel );
+    spectral_decay( nunk, esuel, unk, ndofmax, tolref, ndofel );
   else if(indicator == inciter::ctr::PrefIndicatorType::NON_CONFORMITY)
     non_conformity( nunk, fd.Nbfac(), inpoel, coord, esuel, fd.Esuf(),
                     fd.Inpofa(), unk, ndof, ndofmax, ndofel );
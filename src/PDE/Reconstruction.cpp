@@ -102,6 +102,33 @@ tk::lhsLeastSq_P0P1( const inciter::FaceData& fd,
   }
 }
 
+void
+tk::invLeastSq_P0P1( const inciter::FaceData& fd,
+  const Fields& geoElem,
+  const Fields& geoFace,
+  std::vector< std::array< std::array< real, 3 >, 3 > >& lhsinv )
+// *****************************************************************************
+//  Compute the inverse of the lhs matrix for the least-squares reconstruction
+//! \param[in] fd Face connectivity and boundary conditions object
+//! \param[in] geoElem Element geometry array
+//! \param[in] geoFace Face geometry array
+//! \param[in,out] lhsinv Inverse of the LHS reconstruction matrix of each
+//!   element, resized to the number of elements in this mesh chunk
+//! \details Since the lhs matrix only depends on the geometry, its inverse
+//!   can be computed once after the mesh (or the mesh refinement) has changed
+//!   and passed to solveLeastSq_P0P1() in every stage.
+// *****************************************************************************
+{
+  const auto nelem = fd.Esuel().size()/4;
+
+  lhsinv.assign( nelem, {{ {{0.0, 0.0, 0.0}},
+                           {{0.0, 0.0, 0.0}},
+                           {{0.0, 0.0, 0.0}} }} );
+  lhsLeastSq_P0P1( fd, geoElem, geoFace, lhsinv );
+
+  for (auto& l : lhsinv) l = tk::inverse( l );
+}
+
 void
 tk::intLeastSq_P0P1( ncomp_t ncomp,
                      ncomp_t offset,
@@ -357,7 +384,7 @@ void
 tk::solveLeastSq_P0P1( ncomp_t ncomp,
   ncomp_t offset,
   const std::size_t rdof,
-  const std::vector< std::array< std::array< real, 3 >, 3 > >& lhs,
+  const std::vector< std::array< std::array< real, 3 >, 3 > >& lhsinv,
   const std::vector< std::vector< std::array< real, 3 > > >& rhs,
   Fields& W )
 // *****************************************************************************
@@ -365,30 +392,84 @@ tk::solveLeastSq_P0P1( ncomp_t ncomp,
 //! \param[in] ncomp Number of scalar components in this PDE system
 //! \param[in] offset Offset this PDE system operates from
 //! \param[in] rdof Maximum number of reconstructed degrees of freedom
-//! \param[in] lhs LHS reconstruction matrix
+//! \param[in] lhsinv Inverse of the LHS reconstruction matrix, see
+//!   invLeastSq_P0P1()
 //! \param[in] rhs RHS reconstruction vector
 //! \param[in,out] W Solution vector to be reconstructed at recent time step
-//! \details Solves the 3x3 linear system for each element, individually. For
-//!   systems that require reconstructions of primitive quantities, this should
-//!   be called twice, once with the argument 'W' as U (conserved), and again
-//!   with 'W' as P (primitive).
+//! \details Solves the 3x3 linear system for each element, individually, by
+//!   applying the pre-computed inverse of the lhs matrix to the rhs vector.
+//!   For systems that require reconstructions of primitive quantities, this
+//!   should be called twice, once with the argument 'W' as U (conserved), and
+//!   again with 'W' as P (primitive).
 // *****************************************************************************
 {
-  auto nelem = lhs.size();
+  auto nelem = lhsinv.size();
 
   for (std::size_t e=0; e<nelem; ++e)
   {
+    const auto& l = lhsinv[e];
     for (ncomp_t c=0; c<ncomp; ++c)
     {
       auto mark = c*rdof;
+      const auto& r = rhs[e][c];
 
-      // solve system using Cramer's rule
-      auto ux = tk::cramer( lhs[e], rhs[e][c] );
+      W(e,mark+1,offset) = l[0][0]*r[0] + l[0][1]*r[1] + l[0][2]*r[2];
+      W(e,mark+2,offset) = l[1][0]*r[0] + l[1][1]*r[1] + l[1][2]*r[2];
+      W(e,mark+3,offset) = l[2][0]*r[0] + l[2][1]*r[1] + l[2][2]*r[2];
+    }
+  }
+}
 
-      W(e,mark+1,offset) = ux[0];
-      W(e,mark+2,offset) = ux[1];
-      W(e,mark+3,offset) = ux[2];
+void
+tk::invLeastSqExtStencil( std::size_t nielem,
+  const std::map< std::size_t, std::vector< std::size_t > >& esup,
+  const std::vector< std::size_t >& inpoel,
+  const Fields& geoElem,
+  std::vector< std::array< std::array< real, 3 >, 3 > >& lhsinv )
+// *****************************************************************************
+//  \brief Compute the inverse of the lhs matrix for the least-squares
+//    reconstruction from an extended stencil involving the node-neighbors
+//! \param[in] nielem Number of internal elements in this mesh chunk
+//! \param[in] esup Elements surrounding points
+//! \param[in] inpoel Element-node connectivity
+//! \param[in] geoElem Element geometry array
+//! \param[in,out] lhsinv Inverse of the LHS reconstruction matrix of each
+//!   internal element, resized to nielem
+//! \details See invLeastSq_P0P1() and recoLeastSqExtStencil().
+// *****************************************************************************
+{
+  lhsinv.resize( nielem );
+
+  for (std::size_t e=0; e<nielem; ++e)
+  {
+    // lhs matrix
+    std::array< std::array< tk::real, 3 >, 3 >
+      lhs_ls( {{ {{0.0, 0.0, 0.0}},
+                 {{0.0, 0.0, 0.0}},
+                 {{0.0, 0.0, 0.0}} }} );
+
+    // loop over all nodes of the element e
+    for (std::size_t lp=0; lp<4; ++lp)
+    {
+      auto p = inpoel[4*e+lp];
+      const auto& pesup = cref_find(esup, p);
+
+      // loop over all the elements surrounding this node p
+      for (auto er : pesup)
+      {
+        // centroid distance
+        std::array< real, 3 > wdeltax{{ geoElem(er,1,0)-geoElem(e,1,0),
+                                        geoElem(er,2,0)-geoElem(e,2,0),
+                                        geoElem(er,3,0)-geoElem(e,3,0) }};
+
+        // contribute to lhs matrix
+        for (std::size_t idir=0; idir<3; ++idir)
+          for (std::size_t jdir=0; jdir<3; ++jdir)
+            lhs_ls[idir][jdir] += wdeltax[idir] * wdeltax[jdir];
+      }
     }
+
+    lhsinv[e] = tk::inverse( lhs_ls );
   }
 }
 
@@ -399,6 +480,7 @@ tk::recoLeastSqExtStencil( std::size_t rdof,
   const std::map< std::size_t, std::vector< std::size_t > >& esup,
   const std::vector< std::size_t >& inpoel,
   const Fields& geoElem,
+  const std::vector< std::array< std::array< real, 3 >, 3 > >& lhsinv,
   Fields& W )
 // *****************************************************************************
 //  \brief Reconstruct the second-order solution using least-squares approach
@@ -409,6 +491,8 @@ tk::recoLeastSqExtStencil( std::size_t rdof,
 //! \param[in] esup Elements surrounding points
 //! \param[in] inpoel Element-node connectivity
 //! \param[in] geoElem Element geometry array
+//! \param[in] lhsinv Inverse of the LHS reconstruction matrix, see
+//!   invLeastSqExtStencil()
 //! \param[in,out] W Solution vector to be reconstructed at recent time step
 //! \details A second-order (piecewise linear) solution polynomial is obtained
 //!   from the first-order (piecewise constant) FV solutions by using a
@@ -420,13 +504,10 @@ tk::recoLeastSqExtStencil( std::size_t rdof,
 {
   const auto ncomp = W.nprop()/rdof;
 
+  Assert( lhsinv.size() >= nielem, "Size mismatch" );
+
   for (std::size_t e=0; e<nielem; ++e)
   {
-    // lhs matrix
-    std::array< std::array< tk::real, 3 >, 3 >
-      lhs_ls( {{ {{0.0, 0.0, 0.0}},
-                 {{0.0, 0.0, 0.0}},
-                 {{0.0, 0.0, 0.0}} }} );
     // rhs matrix
     std::vector< std::array< tk::real, 3 > >
     rhs_ls( ncomp, {{ 0.0, 0.0, 0.0 }} );
@@ -445,11 +526,6 @@ tk::recoLeastSqExtStencil( std::size_t rdof,
                                         geoElem(er,2,0)-geoElem(e,2,0),
                                         geoElem(er,3,0)-geoElem(e,3,0) }};
 
-        // contribute to lhs matrix
-        for (std::size_t idir=0; idir<3; ++idir)
-          for (std::size_t jdir=0; jdir<3; ++jdir)
-            lhs_ls[idir][jdir] += wdeltax[idir] * wdeltax[jdir];
-
         // compute rhs matrix
         for (std::size_t c=0; c<ncomp; ++c)
         {
@@ -461,19 +537,19 @@ tk::recoLeastSqExtStencil( std::size_t rdof,
       }
     }
 
-    // solve least-square normal equation system using Cramer's rule
+    // solve least-square normal equation system using the inverse lhs
+    const auto& l = lhsinv[e];
     for (ncomp_t c=0; c<ncomp; ++c)
     {
       auto mark = c*rdof;
-
-      auto ux = tk::cramer( lhs_ls, rhs_ls[c] );
+      const auto& r = rhs_ls[c];
 
       // Update the P1 dofs with the reconstructioned gradients.
       // Since this reconstruction does not affect the cell-averaged solution,
       // W(e,mark+0,offset) is unchanged.
-      W(e,mark+1,offset) = ux[0];
-      W(e,mark+2,offset) = ux[1];
-      W(e,mark+3,offset) = ux[2];
+      W(e,mark+1,offset) = l[0][0]*r[0] + l[0][1]*r[1] + l[0][2]*r[2];
+      W(e,mark+2,offset) = l[1][0]*r[0] + l[1][1]*r[1] + l[1][2]*r[2];
+      W(e,mark+3,offset) = l[2][0]*r[0] + l[2][1]*r[1] + l[2][2]*r[2];
     }
   }
 }
@@ -35,6 +35,13 @@ lhsLeastSq_P0P1( const inciter::FaceData& fd,
   const Fields& geoFace,
   std::vector< std::array< std::array< real, 3 >, 3 > >& lhs_ls );
 
+//! Compute the inverse of the lhs matrix for the least-squares reconstruction
+void
+invLeastSq_P0P1( const inciter::FaceData& fd,
+  const Fields& geoElem,
+  const Fields& geoFace,
+  std::vector< std::array< std::array< real, 3 >, 3 > >& lhsinv );
+
 //! Compute internal surface contributions to the least-squares reconstruction
 void
 intLeastSq_P0P1( ncomp_t ncomp,
@@ -87,10 +94,19 @@ solveLeastSq_P0P1(
   ncomp_t ncomp,
   ncomp_t offset,
   const std::size_t rdof,
-  const std::vector< std::array< std::array< real, 3 >, 3 > >& lhs,
+  const std::vector< std::array< std::array< real, 3 >, 3 > >& lhsinv,
   const std::vector< std::vector< std::array< real, 3 > > >& rhs,
   Fields& W );
 
+//! \brief Compute the inverse of the lhs matrix for the least-squares
+//!   reconstruction from an extended stencil involving the node-neighbors
+void
+invLeastSqExtStencil( std::size_t nielem,
+  const std::map< std::size_t, std::vector< std::size_t > >& esup,
+  const std::vector< std::size_t >& inpoel,
+  const Fields& geoElem,
+  std::vector< std::array< std::array< real, 3 >, 3 > >& lhsinv );
+
 //! \brief Reconstruct the second-order solution using least-squares approach
 //!   from an extended stencil involving the node-neighbors
 void
@@ -100,6 +116,7 @@ recoLeastSqExtStencil( std::size_t rdof,
   const std::map< std::size_t, std::vector< std::size_t > >& esup,
   const std::vector< std::size_t >& inpoel,
   const Fields& geoElem,
+  const std::vector< std::array< std::array< real, 3 >, 3 > >& lhsinv,
   Fields& W );
 
 //! Compute nodal field outputs
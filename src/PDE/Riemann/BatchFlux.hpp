@@ -0,0 +1,57 @@
+// *****************************************************************************
+/*!
+  \file      src/PDE/Riemann/BatchFlux.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Batched Riemann flux evaluation using a single-problem solver
+  \details   This file implements the batched interface of Riemann solvers,
+    tk::RiemannBatchFluxFn, for solvers that only provide a flux function
+    solving a single Riemann problem, tk::RiemannFluxFn.
+*/
+// *****************************************************************************
+#ifndef BatchFlux_h
+#define BatchFlux_h
+
+#include <array>
+#include <vector>
+
+#include "Types.hpp"
+#include "FunctionPrototypes.hpp"
+
+namespace tk {
+
+//! Compute the numerical fluxes of a batch of Riemann problems one by one
+//! \param[in] flux Flux function solving a single Riemann problem, see
+//!   tk::RiemannFluxFn
+//! \param[in] b Batch of Riemann problems
+//! \param[in,out] flx Numerical fluxes, flx[c][i]: component c of problem i
+//! \details The states of each problem are gathered from the batch into
+//!   the vectors reused across the problems of the batch.
+template< class FluxFunction >
+void
+batchFlux( FluxFunction&& flux,
+           const RiemannBatch& b,
+           std::vector< std::vector< real > >& flx )
+{
+  const auto n = b.size();
+  std::array< std::vector< real >, 2 > u{{
+    std::vector< real >( b.u[0].size() ),
+    std::vector< real >( b.u[1].size() ) }};
+
+  for (std::size_t i=0; i<n; ++i) {
+    for (std::size_t k=0; k<2; ++k)
+      for (std::size_t c=0; c<u[k].size(); ++c) u[k][c] = b.u[k][c][i];
+    auto f = flux( {{ b.fn[0][i], b.fn[1][i], b.fn[2][i] }}, u, b.v[i] );
+    if (i == 0) {
+      flx.resize( f.size() );
+      for (auto& c : flx) c.resize( n );
+    }
+    for (std::size_t c=0; c<f.size(); ++c) flx[c][i] = f[c];
+  }
+}
+
+} // tk::
+
+#endif // BatchFlux_h
@@ -16,9 +16,11 @@
 #include <vector>
 
 #include "Types.hpp"
+#include "ISA.hpp"
 #include "Fields.hpp"
 #include "Tags.hpp"
 #include "FunctionPrototypes.hpp"
+#include "Riemann/BatchFlux.hpp"
 #include "Inciter/Options/Flux.hpp"
 #include "EoS/EoS.hpp"
 
@@ -124,6 +126,15 @@ struct HLLC {
     return flx;
   }
 
+  //! HLLC approximate Riemann solver flux function for a batch of problems
+  //! \param[in] b Batch of Riemann problems
+  //! \param[in,out] flx Riemann flux solutions, see flux()
+  //! \note The function signature must follow tk::RiemannBatchFluxFn
+  TK_MULTIVERSION static void
+  fluxes( const tk::RiemannBatch& b,
+          std::vector< std::vector< tk::real > >& flx )
+  { tk::batchFlux( flux, b, flx ); }
+
   //! Flux type accessor
   //! \return Flux type
   static ctr::FluxType type() noexcept { return ctr::FluxType::HLLC; }
@@ -15,6 +15,7 @@
 #include <vector>
 
 #include "Types.hpp"
+#include "ISA.hpp"
 #include "Fields.hpp"
 #include "FunctionPrototypes.hpp"
 #include "Inciter/Options/Flux.hpp"
@@ -84,6 +85,72 @@ struct LaxFriedrichs {
     return flx;
   }
 
+  //! Lax-Friedrichs approximate Riemann solver flux function for a batch of
+  //!   problems
+  //! \param[in] b Batch of Riemann problems
+  //! \param[in,out] flx Riemann solutions according Lax and Friedrichs
+  //! \details Same as flux() but looping over the problems of the batch with
+  //!   the material constants queried once, so the loop can be vectorized.
+  //! \note The function signature must follow tk::RiemannBatchFluxFn
+  TK_MULTIVERSION static void
+  fluxes( const tk::RiemannBatch& b,
+          std::vector< std::vector< tk::real > >& flx )
+  {
+    const auto n = b.size();
+    flx.resize( 5 );
+    for (auto& f : flx) f.resize( n );
+
+    const auto g =
+      g_inputdeck.get< tag::param, tag::compflow, tag::gamma >()[0][0];
+    const auto p_c =
+      g_inputdeck.get< tag::param, tag::compflow, tag::pstiff >()[0][0];
+
+    const auto& ul = b.u[0];
+    const auto& ur = b.u[1];
+    const auto& nx = b.fn[0];
+    const auto& ny = b.fn[1];
+    const auto& nz = b.fn[2];
+
+    #pragma omp simd
+    for (std::size_t i=0; i<n; ++i) {
+      // Primitive variables
+      auto rhol = ul[0][i];
+      auto rhor = ur[0][i];
+
+      auto uvl = ul[1][i]/rhol;
+      auto vvl = ul[2][i]/rhol;
+      auto wvl = ul[3][i]/rhol;
+
+      auto uvr = ur[1][i]/rhor;
+      auto vvr = ur[2][i]/rhor;
+      auto wvr = ur[3][i]/rhor;
+
+      auto pl = eos_pressure( g, p_c, rhol, uvl, vvl, wvl, ul[4][i] );
+      auto pr = eos_pressure( g, p_c, rhor, uvr, vvr, wvr, ur[4][i] );
+
+      auto al = eos_soundspeed( g, p_c, rhol, pl );
+      auto ar = eos_soundspeed( g, p_c, rhor, pr );
+
+      // Face-normal velocities
+      auto vnl = uvl*nx[i] + vvl*ny[i] + wvl*nz[i];
+      auto vnr = uvr*nx[i] + vvr*ny[i] + wvr*nz[i];
+
+      auto lambda = std::max(al,ar) + std::max( std::abs(vnl), std::abs(vnr) );
+
+      // Numerical flux function
+      flx[0][i] = 0.5 * ( ul[0][i]*vnl + ur[0][i]*vnr
+                          - lambda*(ur[0][i] - ul[0][i]) );
+      flx[1][i] = 0.5 * ( ul[1][i]*vnl + pl*nx[i] + ur[1][i]*vnr + pr*nx[i]
+                          - lambda*(ur[1][i] - ul[1][i]) );
+      flx[2][i] = 0.5 * ( ul[2][i]*vnl + pl*ny[i] + ur[2][i]*vnr + pr*ny[i]
+                          - lambda*(ur[2][i] - ul[2][i]) );
+      flx[3][i] = 0.5 * ( ul[3][i]*vnl + pl*nz[i] + ur[3][i]*vnr + pr*nz[i]
+                          - lambda*(ur[3][i] - ul[3][i]) );
+      flx[4][i] = 0.5 * ( (ul[4][i] + pl)*vnl + (ur[4][i] + pr)*vnr
+                          - lambda*(ur[4][i] - ul[4][i]) );
+    }
+  }
+
   //! Flux type accessor
   //! \return Flux type
   static ctr::FluxType type() noexcept { return ctr::FluxType::LaxFriedrichs; }
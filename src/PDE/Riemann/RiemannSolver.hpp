@@ -77,6 +77,11 @@ class RiemannSolver {
           const std::vector< std::array< tk::real, 3 > >& v ) const
     { return self->flux( fn, u, v ); }
 
+    //! Public interface to computing the Riemann fluxes of a batch of problems
+    void fluxes( const tk::RiemannBatch& b,
+                 std::vector< std::vector< tk::real > >& flx ) const
+    { self->fluxes( b, flx ); }
+
     //! Copy assignment
     RiemannSolver& operator=( const RiemannSolver& x )
     { RiemannSolver tmp(x); *this = std::move(tmp); return *this; }
@@ -100,6 +105,8 @@ class RiemannSolver {
         flux( const std::array< tk::real, 3 >&,
               const std::array< std::vector< tk::real >, 2 >&,
               const std::vector< std::array< tk::real, 3 > >& ) const = 0;
+      virtual void fluxes( const tk::RiemannBatch&,
+                           std::vector< std::vector< tk::real > >& ) const = 0;
     };
 
     //! \brief Model models the Concept above by deriving from it and overriding
@@ -113,6 +120,9 @@ class RiemannSolver {
               const std::array< std::vector< tk::real >, 2 >& u,
               const std::vector< std::array< tk::real, 3 > >& v ) const override
       { return data.flux( fn, u, v ); }
+      void fluxes( const tk::RiemannBatch& b,
+                   std::vector< std::vector< tk::real > >& flx ) const override
+      { data.fluxes( b, flx ); }
       T data;
     };
 
@@ -30,6 +30,8 @@ struct Rusanov {
   using real = tk::real;
 
   //! Rusanov approximate Riemann solver flux function
+  //! \param[in] g Ratio of specific heats
+  //! \param[in] p_c Stiffness parameter of the stiffened-gas EoS
   //! \param[in] nx X component of the surface normal
   //! \param[in] ny Y component of the surface normal
   //! \param[in] nz Z component of the surface normal
@@ -57,7 +59,8 @@ struct Rusanov {
   //!   to Rusanov
   #pragma omp declare simd
   static void
-  flux( real nx, real ny, real nz,
+  flux( real g, real p_c,
+        real nx, real ny, real nz,
         real mx, real my, real mz,
         real rL, real ruL, real rvL, real rwL, real reL,
         real rR, real ruR, real rvR, real rwR, real reR,
@@ -71,11 +74,11 @@ struct Rusanov {
     auto vr = rvR/rR;
     auto wr = rwR/rR;
 
-    auto pl = eos_pressure< tag::compflow >( 0, rL, ul, vl, wl, reL );
-    auto pr = eos_pressure< tag::compflow >( 0, rR, ur, vr, wr, reR );
+    auto pl = eos_pressure( g, p_c, rL, ul, vl, wl, reL );
+    auto pr = eos_pressure( g, p_c, rR, ur, vr, wr, reR );
 
-    auto al = eos_soundspeed< tag::compflow >( 0, rL, pl );
-    auto ar = eos_soundspeed< tag::compflow >( 0, rR, pr );
+    auto al = eos_soundspeed( g, p_c, rL, pl );
+    auto ar = eos_soundspeed( g, p_c, rR, pr );
 
     // face-normal velocities
     real vnl = ul*nx + vl*ny + wl*nz;
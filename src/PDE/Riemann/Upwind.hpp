@@ -15,6 +15,7 @@
 #include <vector>
 
 #include "Types.hpp"
+#include "ISA.hpp"
 #include "Fields.hpp"
 #include "Vector.hpp"
 #include "FunctionPrototypes.hpp"
@@ -55,6 +56,35 @@ struct Upwind {
       return flx;
     }
   
+    //! Upwind Riemann solver flux function for a batch of problems
+    //! \param[in] b Batch of Riemann problems
+    //! \param[in,out] flx Riemann solutions using a central difference method
+    //! \note The function signature must follow tk::RiemannBatchFluxFn
+    TK_MULTIVERSION static void
+    fluxes( const tk::RiemannBatch& b,
+            std::vector< std::vector< tk::real > >& flx )
+    {
+      const auto n = b.size();
+      flx.resize( b.u[0].size() );
+      for (auto& f : flx) f.assign( n, 0.0 );
+
+      for (std::size_t i=0; i<n; ++i) {
+        const auto& v = b.v[i];
+        for (std::size_t c=0; c<v.size(); ++c)
+        {
+          // wave speed based on prescribed velocity
+          auto swave = v[c][0]*b.fn[0][i] + v[c][1]*b.fn[1][i]
+                     + v[c][2]*b.fn[2][i];
+
+          // upwinding
+          tk::real splus  = 0.5 * (swave + fabs(swave));
+          tk::real sminus = 0.5 * (swave - fabs(swave));
+
+          flx[c][i] = splus * b.u[0][c][i] + sminus * b.u[1][c][i];
+        }
+      }
+    }
+
     //! Flux type accessor
     //! \return Flux type
     static ctr::FluxType type() noexcept { return ctr::FluxType::UPWIND; }
@@ -94,7 +94,7 @@ class Transport {
     //! Set initial condition in user-defined box IC nodes (no-op for Transport)
     void box( real, real, const std::vector< std::size_t >&,
               const std::array< std::vector< real >, 3 >&, tk::Fields&,
-              std::unordered_set< std::size_t >& ) const {}
+              ICBoxState& ) const {}
 
     //! Return analytic solution (if defined by Problem) at xi, yi, zi, t
     //! \param[in] xi X-coordinate
@@ -110,25 +110,44 @@ class Transport {
       return std::vector< real >( begin(s), end(s) );
     }
 
+    //! Compute primitive variables for ALECG
+    //! \param[in] coord Mesh node coordinates
+    //! \param[in] U Solution vector at recent time step
+    //! \param[in,out] W Primitive variables in mesh points, (re)allocated here
+    //!   if its size is not yet right
+    //! \details The transported scalars are their own primitive variables, so
+    //!   this only copies the components of this system to W.
+    void prim( const std::array< std::vector< real >, 3 >& coord,
+               const tk::Fields& U,
+               tk::Fields& W ) const
+    {
+      Assert( U.nunk() == coord[0].size(), "Number of unknowns in solution "
+              "vector at recent time step incorrect" );
+      if (W.nunk() != U.nunk() || W.nprop() != m_ncomp)
+        W = tk::Fields( U.nunk(), m_ncomp );
+      for (std::size_t p=0; p<U.nunk(); ++p)
+        for (std::size_t c=0; c<m_ncomp; ++c)
+          W(p,c,0) = U(p,c,m_offset);
+    }
+
     //! Compute nodal gradients of primitive variables for ALECG
     //! \param[in] coord Mesh node coordinates
     //! \param[in] inpoel Mesh element connectivity
     //! \param[in] bndel List of elements contributing to chare-boundary nodes
-    //! \param[in] gid Local->global node id map
-    //! \param[in] bid Local chare-boundary node ids (value) associated to
-    //!    global node ids (key)
-    //! \param[in] U Solution vector at recent time step
+    //! \param[in] lidbid Chare-boundary node ids associated to local node ids,
+    //!   std::numeric_limits< std::size_t >::max() for nodes not on the
+    //!   chare boundary
+    //! \param[in] W Primitive variables at recent time step, see prim()
     //! \param[in,out] G Nodal gradients of primitive variables
     void grad( const std::array< std::vector< real >, 3 >& coord,
                const std::vector< std::size_t >& inpoel,
                const std::vector< std::size_t >& bndel,
-               const std::vector< std::size_t >& gid,
-               const std::unordered_map< std::size_t, std::size_t >& bid,
-               const tk::Fields& U,
+               const std::vector< std::size_t >& lidbid,
+               const tk::Fields& W,
                tk::Fields& G ) const
     {
-      Assert( U.nunk() == coord[0].size(), "Number of unknowns in solution "
-              "vector at recent time step incorrect" );
+      Assert( W.nunk() == coord[0].size(), "Number of unknowns in primitive "
+              "variables incorrect" );
 
       // compute gradients of primitive variables in points
       G.fill( 0.0 );
@@ -166,12 +185,12 @@ class Transport {
           g[0][i] = -g[1][i] - g[2][i] - g[3][i];
         // scatter-add gradient contributions to boundary nodes
         for (std::size_t a=0; a<4; ++a) {
-          auto i = bid.find( gid[N[a]] );
-          if (i != end(bid))
+          auto i = lidbid[ N[a] ];
+          if (i != std::numeric_limits< std::size_t >::max())
             for (std::size_t c=0; c<m_ncomp; ++c)
               for (std::size_t b=0; b<4; ++b)
                 for (std::size_t j=0; j<3; ++j)
-                  G(i->second,c*3+j,0) += J24 * g[b][j] * U(N[b],c,m_offset);
+                  G(i,c*3+j,0) += J24 * g[b][j] * W(N[b],c,0);
         }
       }
     }
@@ -180,25 +199,30 @@ class Transport {
     //! \param[in] coord Mesh node coordinates
     //! \param[in] inpoel Mesh element connectivity
     //! \param[in] triinpoel Boundary triangle face connecitivity
-    //! \param[in] bid Local chare-boundary node ids (value) associated to
-    //!    global node ids (key)
-    //! \param[in] lid Global->local node ids
+    //! \param[in] bidlid Local node ids associated to chare-boundary node ids
     //! \param[in] dfn Dual-face normals
     //! \param[in] psup Points surrounding points
     //! \param[in] symbcnode Vector with 1 at symmetry BC nodes
     //! \param[in] vol Nodal volumes
+    //! \param[in] edgenode Local node ids of edges
     //! \param[in] edgeid Local node id pair -> edge id map
     //! \param[in] G Nodal gradients in chare-boundary nodes
     //! \param[in] U Solution vector at recent time step
+    //! \param[in] W Primitive variables at recent time step, see prim()
+    //! \param[in] part Part of the mesh in which to compute the right hand side
+    //! \param[in] frozen True if Grad holds gradients computed in a previous
+    //!   stage to be reused as is
+    //! \param[in,out] Grad Nodal gradient buffer, owned by the caller
     //! \param[in,out] R Right-hand side vector computed
+    //! \details Contributions are added to R, zeroed by the caller before the
+    //!   first part. Grad must be kept between the parts.
     void rhs(
       real,
       const std::array< std::vector< real >, 3 >&  coord,
       const std::vector< std::size_t >& inpoel,
       const std::vector< std::size_t >& triinpoel,
       const std::vector< std::size_t >&,
-      const std::unordered_map< std::size_t, std::size_t >& bid,
-      const std::unordered_map< std::size_t, std::size_t >& lid,
+      const std::vector< std::size_t >& bidlid,
       const std::vector< real >& dfn,
       const std::pair< std::vector< std::size_t >,
                        std::vector< std::size_t > >& psup,
@@ -206,32 +230,84 @@ class Transport {
                        std::vector< std::size_t > >& esup,
       const std::vector< int >& symbcnode,
       const std::vector< real >& vol,
-      const std::vector< std::size_t >&,
-      const std::vector< std::size_t >& edgeid,
+      const std::vector< tk::lid_t >& edgenode,
+      const std::vector< tk::lid_t >& edgeid,
       const tk::Fields& G,
       const tk::Fields& U,
+      const tk::Fields& W,
       const std::vector< tk::real >&,
+      const RHSPart& part,
+      bool frozen,
+      tk::ReducedFields& Grad,
+      std::vector< real >&,
       tk::Fields& R ) const
     {
       Assert( G.nprop() == m_ncomp*3,
               "Number of components in gradient vector incorrect" );
       Assert( U.nunk() == coord[0].size(), "Number of unknowns in solution "
               "vector at recent time step incorrect" );
+      Assert( W.nunk() == U.nunk() && W.nprop() == m_ncomp,
+              "Size of primitive variables incorrect" );
       Assert( R.nunk() == coord[0].size(),
               "Number of unknowns and/or number of components in right-hand "
               "side vector incorrect" );
+      Assert( !frozen || Grad.nunk() == U.nunk(),
+              "Frozen gradients have not been computed" );
 
       // compute/assemble gradients in points
-      auto Grad = nodegrad( coord, inpoel, lid, bid, vol, esup, U, G );
-
-      // zero right hand side for all components
-      for (ncomp_t c=0; c<m_ncomp; ++c) R.fill( c, m_offset, 0.0 );
+      if (!frozen)
+        nodegrad( coord, inpoel, bidlid, vol, esup, W, G, part.gpoin, Grad );
 
       // compute domain-edge integral
-      domainint( coord, inpoel, edgeid, psup, dfn, U, Grad, R );
+      domainint( coord, inpoel, edgenode, edgeid, psup, dfn, W, Grad, part,
+                 R );
 
       // compute boundary integrals
-      bndint( coord, triinpoel, symbcnode, U, R );
+      bndint( coord, triinpoel, symbcnode, U, part.tri, R );
+    }
+
+    //! \brief Compute the first-order domain-edge right hand side on a coarse
+    //!   (agglomerated) multigrid level for ALECG
+    //! \param[in] coord Coarse node coordinates
+    //! \param[in] edgenode Coarse node ids of edges
+    //! \param[in] dfn Coarse dual-face normals
+    //! \param[in] U Solution vector at coarse nodes
+    //! \param[in,out] R Right-hand side vector to which the edge fluxes are
+    //!   added
+    //! \details Coarse levels are only used to compute corrections, so a
+    //!   first-order upwind flux through the (summed) dual faces is used,
+    //!   evaluating the prescribed velocity at the edge midpoint.
+    void coarserhs( const std::array< std::vector< real >, 3 >& coord,
+                    const std::vector< tk::lid_t >& edgenode,
+                    const std::vector< real >& dfn,
+                    const tk::Fields& U,
+                    tk::Fields& R ) const
+    {
+      Assert( U.nunk() == coord[0].size(), "Number of unknowns in solution "
+              "vector incorrect" );
+      Assert( R.nunk() == coord[0].size(),
+              "Number of unknowns in right-hand side vector incorrect" );
+
+      const auto& x = coord[0];
+      const auto& y = coord[1];
+      const auto& z = coord[2];
+
+      auto r = R.sview( m_offset );
+      for (std::size_t e=0; e<edgenode.size()/2; ++e) {
+        auto p = edgenode[e*2+0];
+        auto q = edgenode[e*2+1];
+        std::array< tk::real, 3 > n{ dfn[e*6+0], dfn[e*6+1], dfn[e*6+2] };
+        auto v = Problem::prescribedVelocity( m_system, m_ncomp,
+                   (x[p]+x[q])/2.0, (y[p]+y[q])/2.0, (z[p]+z[q])/2.0 );
+        for (std::size_t c=0; c<m_ncomp; ++c) {
+          auto uL = U(p,c,m_offset);
+          auto uR = U(q,c,m_offset);
+          auto vn = tk::dot( v[c], n );
+          auto f = vn*(uL + uR) - std::abs(vn)*(uR - uL);
+          r(p,c) -= f;
+          r(q,c) += f;
+        }
+      }
     }
 
     //! Compute right hand side for DiagCG (CG+FCT)
@@ -260,7 +336,13 @@ class Transport {
       const auto& y = coord[1];
       const auto& z = coord[2];
 
-      // 1st stage: update element values from node values (gather-add)
+      // solution at element nodes, reused across elements
+      std::vector< std::array< real, 4 > > u( m_ncomp );
+
+      // Both stages in a single pass over the elements: the element value
+      // after the 1st stage only depends on the nodes of the same element, so
+      // the element geometry and the solution at the element nodes are
+      // computed once per element and used by both stages.
       for (std::size_t e=0; e<inpoel.size()/4; ++e) {
         // access node IDs
         const std::array< std::size_t, 4 >
@@ -282,13 +364,11 @@ class Transport {
           grad[0][i] = -grad[1][i]-grad[2][i]-grad[3][i];
 
         // access solution at element nodes
-        std::vector< std::array< real, 4 > > u( m_ncomp );
         for (ncomp_t c=0; c<m_ncomp; ++c) u[c] = U.extract( c, m_offset, N );
-        // access solution at elements
-        std::vector< const real* > ue( m_ncomp );
-        for (ncomp_t c=0; c<m_ncomp; ++c) ue[c] = Ue.cptr( c, m_offset );
+        // access solution at element
+        auto uv = Ue.uview( e, m_offset );
 
-        // get prescribed velocity
+        // 1st stage: update element values from node values (gather-add)
         const std::array< std::vector<std::array<real,3>>, 4 > vel{{
           Problem::prescribedVelocity( m_system, m_ncomp,
                                        x[N[0]], y[N[0]], z[N[0]] ),
@@ -300,58 +380,24 @@ class Transport {
                                        x[N[3]], y[N[3]], z[N[3]] ) }};
 
         // sum flux (advection) contributions to element
-        auto d = deltat/2.0;
+        auto dh = deltat/2.0;
         for (std::size_t c=0; c<m_ncomp; ++c)
-          for (std::size_t j=0; j<3; ++j)
-            for (std::size_t a=0; a<4; ++a)
-              Ue.var(ue[c],e) -= d * grad[a][j] * vel[a][c][j]*u[c][a];
-      }
+          for (std::size_t a=0; a<4; ++a)
+            uv[c] -= dh * tk::dot( grad[a], vel[a][c] ) * u[c][a];
 
-
-      // 2nd stage: form rhs from element values (scatter-add)
-      for (std::size_t e=0; e<inpoel.size()/4; ++e) {
-        // access node IDs
-        const std::array< std::size_t, 4 >
-          N{{ inpoel[e*4+0], inpoel[e*4+1], inpoel[e*4+2], inpoel[e*4+3] }};
-        // compute element Jacobi determinant
-        const std::array< real, 3 >
-          ba{{ x[N[1]]-x[N[0]], y[N[1]]-y[N[0]], z[N[1]]-z[N[0]] }},
-          ca{{ x[N[2]]-x[N[0]], y[N[2]]-y[N[0]], z[N[2]]-z[N[0]] }},
-          da{{ x[N[3]]-x[N[0]], y[N[3]]-y[N[0]], z[N[3]]-z[N[0]] }};
-        const auto J = tk::triple( ba, ca, da );        // J = 6V
-        Assert( J > 0, "Element Jacobian non-positive" );
-
-        // shape function derivatives, nnode*ndim [4][3]
-        std::array< std::array< real, 3 >, 4 > grad;
-        grad[1] = tk::crossdiv( ca, da, J );
-        grad[2] = tk::crossdiv( da, ba, J );
-        grad[3] = tk::crossdiv( ba, ca, J );
-        for (std::size_t i=0; i<3; ++i)
-          grad[0][i] = -grad[1][i]-grad[2][i]-grad[3][i];
-
-        // access solution at elements
-        std::vector< real > ue( m_ncomp );
-        for (ncomp_t c=0; c<m_ncomp; ++c) ue[c] = Ue( e, c, m_offset );
-        // access pointer to right hand side at component and offset
-        std::vector< const real* > r( m_ncomp );
-        for (ncomp_t c=0; c<m_ncomp; ++c) r[c] = R.cptr( c, m_offset );
-        // access solution at nodes of element
-        std::vector< std::array< real, 4 > > u( m_ncomp );
-        for (ncomp_t c=0; c<m_ncomp; ++c) u[c] = U.extract( c, m_offset, N );
-
-        // get prescribed velocity
+        // 2nd stage: form rhs from element values (scatter-add)
+        auto r = R.sview( m_offset );
         auto xc = (x[N[0]] + x[N[1]] + x[N[2]] + x[N[3]]) / 4.0;
         auto yc = (y[N[0]] + y[N[1]] + y[N[2]] + y[N[3]]) / 4.0;
         auto zc = (z[N[0]] + z[N[1]] + z[N[2]] + z[N[3]]) / 4.0;
-        const auto vel =
+        const auto velc =
           Problem::prescribedVelocity( m_system, m_ncomp, xc, yc, zc );
 
         // scatter-add flux contributions to rhs at nodes
         real d = deltat * J/6.0;
         for (std::size_t c=0; c<m_ncomp; ++c)
-          for (std::size_t j=0; j<3; ++j)
-            for (std::size_t a=0; a<4; ++a)
-              R.var(r[c],N[a]) += d * grad[a][j] * vel[c][j]*ue[c];
+          for (std::size_t a=0; a<4; ++a)
+            r(N[a],c) += d * tk::dot( grad[a], velc[c] ) * uv[c];
 
         // add (optional) diffusion contribution to right hand side
         m_physics.diffusionRhs(m_system, m_ncomp, deltat, J, grad, N, u, r, R);
@@ -471,24 +517,50 @@ class Transport {
       return bc;
     }
 
+    //! \brief Evaluate the increments of Dirichlet boundary conditions at
+    //!   given nodes for all components in this PDE system
+    //! \param[in] t Physical time
+    //! \param[in] deltat Time step size
+    //! \param[in] tp Physical time for each mesh node
+    //! \param[in] dtp Time step size for each mesh node
+    //! \param[in] nodes Pairs of local node id at which Dirichlet boundary
+    //!   conditions are set, see dirbc(), and index in inc of the first
+    //!   component of this system at the node
+    //! \param[in] coord Mesh node coordinates
+    //! \param[in,out] inc Increments between t+dt and t of the boundary
+    //!   conditions, written at the indices given by nodes
+    void
+    dirbcinc( real t,
+              real deltat,
+              const std::vector< tk::real >& tp,
+              const std::vector< tk::real >& dtp,
+              const std::vector< std::pair< std::size_t, std::size_t > >& nodes,
+              const std::array< std::vector< real >, 3 >& coord,
+              std::vector< real >& inc ) const
+    {
+      const auto steady = g_inputdeck.get< tag::discr, tag::steady_state >();
+      const auto& x = coord[0];
+      const auto& y = coord[1];
+      const auto& z = coord[2];
+      for (const auto& [n,i] : nodes) {
+        Assert( i+m_ncomp <= inc.size(), "Indexing out of BC increments" );
+        if (steady) { t = tp[n]; deltat = dtp[n]; }
+        const auto s = solinc( m_system, m_ncomp, x[n], y[n], z[n],
+                               t, deltat, Problem::solution );
+        for (ncomp_t c=0; c<m_ncomp; ++c) inc[i+c] = s[c];
+      }
+    }
+
     //! Set symmetry boundary conditions at nodes
     void
-    symbc(
-      tk::Fields&,
-      const std::array< std::vector< real >, 3 >&,
-      const std::unordered_map< int,
-              std::unordered_map< std::size_t,
-                std::array< real, 4 > > >&,
-      const std::unordered_set< std::size_t >& ) const {}
+    symbc( tk::Fields&,
+           const std::array< std::vector< real >, 3 >&,
+           const tk::BndNodeNormals& ) const {}
 
     //! Set farfield boundary conditions at nodes
-    void farfieldbc(
-      tk::Fields&,
-      const std::array< std::vector< real >, 3 >&,
-      const std::unordered_map< int,
-              std::unordered_map< std::size_t,
-                std::array< real, 4 > > >&,
-      const std::unordered_set< std::size_t >& ) const {}
+    void farfieldbc( tk::Fields&,
+                     const std::array< std::vector< real >, 3 >&,
+                     const tk::BndNodeNormals& ) const {}
 
     //! Return field names to be output to file
     //! \return Vector of strings labelling fields output in file
@@ -523,7 +595,7 @@ class Transport {
     //! Return surface field output going to file
     std::vector< std::vector< real > >
     surfOutput( const std::map< int, std::vector< std::size_t > >&,
-                tk::Fields& ) const
+                const tk::Fields& ) const
     {
       std::vector< std::vector< real > > s; // punt for now
       return s;
@@ -551,39 +623,38 @@ class Transport {
     //! \param[in] V Total mesh volume
     //! \param[in] coord Mesh node coordinates
     //! \param[in] v Nodal volumes
-    //! \param[in,out] U Solution vector at recent time step
+    //! \param[in] U Solution vector at recent time step
     //! \return Vector of vectors to be output to file
     //! \details This functions should be written in conjunction with names(),
-    //!   which provides the vector of field names
-    //! \note U is overwritten
+    //!   which provides the vector of field names. The analytic solution is
+    //!   evaluated directly into the output vectors, so U is only read.
     std::vector< std::vector< tk::real > >
     fieldOutput( tk::real t,
                  tk::real V,
                  std::size_t,
                  const std::array< std::vector< tk::real >, 3 >& coord,
                  const std::vector< tk::real >& v,
-                 tk::Fields& U ) const
+                 const tk::Fields& U ) const
     {
-      std::vector< std::vector< real > > out;
+      Assert( U.nunk() == v.size(), "Size mismatch" );
+      const auto& x = coord[0];
+      const auto& y = coord[1];
+      const auto& z = coord[2];
+      std::vector< std::vector< real > > out( 3*m_ncomp );
       // will output numerical solution for all components
-      auto E = U;
       for (ncomp_t c=0; c<m_ncomp; ++c)
-        out.push_back( U.extract( c, m_offset ) );
-      // evaluate analytic solution at time t
-      std::vector< std::size_t > inbox;
-      initialize( coord, U, t, inbox );
-      // will output analytic solution for all components
-      for (ncomp_t c=0; c<m_ncomp; ++c)
-        out.push_back( U.extract( c, m_offset ) );
-      // will output error for all components
-      for (ncomp_t c=0; c<m_ncomp; ++c) {
-        auto u = U.extract( c, m_offset );
-        auto e = E.extract( c, m_offset );
-        Assert( u.size() == e.size(), "Size mismatch" );
-        Assert( u.size() == v.size(), "Size mismatch" );
-        for (std::size_t i=0; i<u.size(); ++i)
-          e[i] = std::pow( e[i] - u[i], 2.0 ) * v[i] / V;
-        out.push_back( e );
+        out[c] = U.extract( c, m_offset );
+      // will output analytic solution and error for all components
+      for (ncomp_t c=0; c<2*m_ncomp; ++c) out[m_ncomp+c].resize( U.nunk() );
+      for (std::size_t i=0; i<U.nunk(); ++i) {
+        int inbox = 0;
+        const auto s =
+          Problem::solution( m_system, m_ncomp, x[i], y[i], z[i], t, inbox );
+        for (ncomp_t c=0; c<m_ncomp; ++c) {
+          out[m_ncomp+c][i] = s[c];
+          out[2*m_ncomp+c][i] =
+            std::pow( U(i,c,m_offset) - s[c], 2.0 ) * v[i] / V;
+        }
       }
       return out;
     }
@@ -609,40 +680,45 @@ class Transport {
     const ncomp_t m_offset;             //!< Offset this PDE operates from
 
     //! \brief Compute/assemble nodal gradients of primitive variables for
-    //!   ALECG in all points
+    //!   ALECG in a list of points
     //! \param[in] coord Mesh node coordinates
     //! \param[in] inpoel Mesh element connectivity
-    //! \param[in] lid Global->local node ids
-    //! \param[in] bid Local chare-boundary node ids (value) associated to
-    //!    global node ids (key)
+    //! \param[in] bidlid Local node ids associated to chare-boundary node ids,
+    //!   std::numeric_limits< std::size_t >::max() for nodes no longer in the
+    //!   mesh
     //! \param[in] vol Nodal volumes
-    //! \param[in] U Solution vector at recent time step
+    //! \param[in] W Primitive variables at recent time step, see prim()
     //! \param[in] G Nodal gradients of primitive variables in chare-boundary nodes
-    //! \return Gradients of primitive variables in all mesh points
-    tk::Fields
+    //! \param[in] gpoin Points in which to compute gradients
+    //! \param[in,out] Grad Gradients of primitive variables in mesh points,
+    //!   (re)allocated here if its size is not yet right
+    void
     nodegrad( const std::array< std::vector< real >, 3 >& coord,
               const std::vector< std::size_t >& inpoel,
-              const std::unordered_map< std::size_t, std::size_t >& lid,
-              const std::unordered_map< std::size_t, std::size_t >& bid,
+              const std::vector< std::size_t >& bidlid,
               const std::vector< real >& vol,
               const std::pair< std::vector< std::size_t >,
                                std::vector< std::size_t > >& esup,
-              const tk::Fields& U,
-              const tk::Fields& G ) const
+              const tk::Fields& W,
+              const tk::Fields& G,
+              const std::vector< std::size_t >& gpoin,
+              tk::ReducedFields& Grad ) const
     {
       // allocate storage for nodal gradients of primitive variables
-      tk::Fields Grad( U.nunk(), m_ncomp*3 );
-      Grad.fill( 0.0 );
+      if (Grad.nunk() != W.nunk() || Grad.nprop() != m_ncomp*3)
+        Grad = tk::ReducedFields( W.nunk(), m_ncomp*3 );
+      using greal = tk::ReducedFields::value_type;
 
       // access node cooordinates
       const auto& x = coord[0];
       const auto& y = coord[1];
       const auto& z = coord[2];
 
-      // compute gradients of primitive variables in points
-      auto npoin = U.nunk();
-      #pragma omp simd
-      for (std::size_t p=0; p<npoin; ++p)
+      // compute gradients of primitive variables in points, accumulating in
+      // real, independent of the (potentially reduced) storage precision
+      std::vector< real > grad( m_ncomp*3 );
+      for (auto p : gpoin) {
+        std::fill( begin(grad), end(grad), 0.0 );
         for (auto e : tk::Around(esup,p)) {
           // access node IDs
           std::size_t N[4] =
@@ -673,22 +749,20 @@ class Transport {
           for (std::size_t c=0; c<m_ncomp; ++c)
             for (std::size_t b=0; b<4; ++b)
               for (std::size_t i=0; i<3; ++i)
-                Grad(p,c*3+i,0) += J24 * g[b][i] * U(N[b],c,m_offset);
+                grad[c*3+i] += J24 * g[b][i] * W(N[b],c,0);
         }
+        // divide weak result in gradients by nodal volume
+        for (std::size_t c=0; c<m_ncomp*3; ++c)
+          Grad(p,c,0) = static_cast< greal >( grad[c] / vol[p] );
+      }
 
       // put in nodal gradients of chare-boundary points
-      for (const auto& [g,b] : bid) {
-        auto i = tk::cref_find( lid, g );
+      for (std::size_t b=0; b<bidlid.size(); ++b) {
+        auto i = bidlid[b];
+        if (i == std::numeric_limits< std::size_t >::max()) continue;
         for (ncomp_t c=0; c<Grad.nprop(); ++c)
-          Grad(i,c,0) = G(b,c,0);
+          Grad(i,c,0) = static_cast< greal >( G(b,c,0) / vol[i] );
       }
-
-      // divide weak result in gradients by nodal volume
-      for (std::size_t p=0; p<npoin; ++p)
-        for (std::size_t c=0; c<m_ncomp*3; ++c)
-          Grad(p,c,0) /= vol[p];
-
-      return Grad;
     }
 
     //! \brief Compute MUSCL reconstruction in edge-end points using a MUSCL
@@ -703,7 +777,7 @@ class Transport {
     muscl( std::size_t p,
            std::size_t q,
            const tk::UnsMesh::Coords& coord,
-           const tk::Fields& G,
+           const tk::ReducedFields& G,
            std::vector< real >& uL,
            std::vector< real >& uR ) const
     {
@@ -750,22 +824,33 @@ class Transport {
 
     //! Compute domain-edge integral for ALECG
     //! \param[in] coord Mesh node coordinates
+    //! \param[in] inpoel Mesh element connectivity
+    //! \param[in] edgenode Local node ids of edges
     //! \param[in] edgeid Local node id pair -> edge id map
     //! \param[in] psup Points surrounding points
     //! \param[in] dfn Dual-face normals
-    //! \param[in] U Solution vector at recent time step
+    //! \param[in] W Primitive variables at recent time step, see prim()
     //! \param[in] G Nodal gradients
+    //! \param[in] part Part of the mesh in which to compute the integral
     //! \param[in,out] R Right-hand side vector computed
+    //! \details By default the contributions are gathered to each point from
+    //!   the edges surrounding it. If fused_edgeflux is configured, the
+    //!   contributions of each edge are added to both edge-end points in a
+    //!   single pass over the edge list instead.
     void domainint( const std::array< std::vector< real >, 3 >& coord,
                     const std::vector< std::size_t >& inpoel,
-                    const std::vector< std::size_t >& edgeid,
+                    const std::vector< tk::lid_t >& edgenode,
+                    const std::vector< tk::lid_t >& edgeid,
                     const std::pair< std::vector< std::size_t >,
                                      std::vector< std::size_t > >& psup,
                     const std::vector< real >& dfn,
-                    const tk::Fields& U,
-                    const tk::Fields& G,
+                    const tk::Fields& W,
+                    const tk::ReducedFields& G,
+                    const RHSPart& part,
                     tk::Fields& R ) const
     {
+      if (part.edge.empty() && part.poin.empty()) return;
+
       // access node cooordinates
       const auto& x = coord[0];
       const auto& y = coord[1];
@@ -774,60 +859,77 @@ class Transport {
       // compute derived data structures
       auto esued = tk::genEsued( inpoel, 4, tk::genEsup( inpoel, 4 ) );
 
-      // access pointer to right hand side at component and offset
-      std::vector< const real* > r( m_ncomp );
-      for (ncomp_t c=0; c<m_ncomp; ++c) r[c] = R.cptr( c, m_offset );
-
-      // domain-edge integral
-      for (std::size_t p=0,k=0; p<U.nunk(); ++p) {
-        for (auto q : tk::Around(psup,p)) {
-          // access dual-face normals for edge p-q
-          auto ed = edgeid[k++];
-          std::array< tk::real, 3 > n{ dfn[ed*6+0], dfn[ed*6+1], dfn[ed*6+2] };
-
-          std::vector< tk::real > uL( m_ncomp, 0.0 );
-          std::vector< tk::real > uR( m_ncomp, 0.0 );
-          for (std::size_t c=0; c<m_ncomp; ++c) {
-            uL[c] = U(p,c,m_offset);
-            uR[c] = U(q,c,m_offset);
-          }
-          // compute MUSCL reconstruction in edge-end points
-          muscl( p, q, coord, G, uL, uR );
-
-          // evaluate prescribed velocity
-          auto v =
-            Problem::prescribedVelocity( m_system, m_ncomp, x[p], y[p], z[p] );
-          // sum donain-edge contributions
-          for (auto e : tk::cref_find(esued,{p,q})) {
-            const std::array< std::size_t, 4 >
-              N{{ inpoel[e*4+0], inpoel[e*4+1], inpoel[e*4+2], inpoel[e*4+3] }};
-            // compute element Jacobi determinant
-            const std::array< tk::real, 3 >
-              ba{{ x[N[1]]-x[N[0]], y[N[1]]-y[N[0]], z[N[1]]-z[N[0]] }},
-              ca{{ x[N[2]]-x[N[0]], y[N[2]]-y[N[0]], z[N[2]]-z[N[0]] }},
-              da{{ x[N[3]]-x[N[0]], y[N[3]]-y[N[0]], z[N[3]]-z[N[0]] }};
-            const auto J = tk::triple( ba, ca, da );        // J = 6V
-            // shape function derivatives, nnode*ndim [5][3]
-            std::array< std::array< tk::real, 3 >, 4 > grad;
-            grad[1] = tk::crossdiv( ca, da, J );
-            grad[2] = tk::crossdiv( da, ba, J );
-            grad[3] = tk::crossdiv( ba, ca, J );
-            for (std::size_t i=0; i<3; ++i)
-              grad[0][i] = -grad[1][i]-grad[2][i]-grad[3][i];
-            auto J48 = J/48.0;
-            for (const auto& [a,b] : tk::lpoed) {
-              auto s = tk::orient( {N[a],N[b]}, {p,q} );
-              for (std::size_t j=0; j<3; ++j) {
-                for (std::size_t c=0; c<m_ncomp; ++c) {
-                  R.var(r[c],p) -= J48 * s * (grad[a][j] - grad[b][j])
-                                   * v[c][j]*(uL[c] + uR[c])
-                    - J48 * std::abs(s * (grad[a][j] - grad[b][j]))
-                          * std::abs(tk::dot(v[c],n)) * (uR[c] - uL[c]);
-                }
-              }
+      // access right hand side at offset
+      auto r = R.sview( m_offset );
+
+      // left and right states reused across all edges
+      std::vector< tk::real > uL( m_ncomp ), uR( m_ncomp );
+
+      // sum domain-edge contributions of edge ed to edge-end point p
+      auto edgeint = [&]( std::size_t p, std::size_t q, std::size_t ed ) {
+        // access dual-face normals for edge p-q
+        std::array< tk::real, 3 > n{ dfn[ed*6+0], dfn[ed*6+1], dfn[ed*6+2] };
+
+        // sum the geometry of the elements surrounding the edge: the central
+        // part, d, weighs the velocity, the upwind part, a, weighs |v.n|
+        std::array< tk::real, 3 > d{{ 0.0, 0.0, 0.0 }};
+        tk::real a = 0.0;
+        for (auto e : tk::cref_find(esued,{p,q})) {
+          const std::array< std::size_t, 4 >
+            N{{ inpoel[e*4+0], inpoel[e*4+1], inpoel[e*4+2], inpoel[e*4+3] }};
+          // compute element Jacobi determinant
+          const std::array< tk::real, 3 >
+            ba{{ x[N[1]]-x[N[0]], y[N[1]]-y[N[0]], z[N[1]]-z[N[0]] }},
+            ca{{ x[N[2]]-x[N[0]], y[N[2]]-y[N[0]], z[N[2]]-z[N[0]] }},
+            da{{ x[N[3]]-x[N[0]], y[N[3]]-y[N[0]], z[N[3]]-z[N[0]] }};
+          const auto J = tk::triple( ba, ca, da );        // J = 6V
+          // shape function derivatives, nnode*ndim [5][3]
+          std::array< std::array< tk::real, 3 >, 4 > grad;
+          grad[1] = tk::crossdiv( ca, da, J );
+          grad[2] = tk::crossdiv( da, ba, J );
+          grad[3] = tk::crossdiv( ba, ca, J );
+          for (std::size_t i=0; i<3; ++i)
+            grad[0][i] = -grad[1][i]-grad[2][i]-grad[3][i];
+          auto J48 = J/48.0;
+          for (const auto& [i,k] : tk::lpoed) {
+            auto s = tk::orient( {N[i],N[k]}, {p,q} );
+            for (std::size_t j=0; j<3; ++j) {
+              d[j] += J48 * s * (grad[i][j] - grad[k][j]);
+              a += J48 * std::abs(s * (grad[i][j] - grad[k][j]));
             }
           }
         }
+
+        for (std::size_t c=0; c<m_ncomp; ++c) {
+          uL[c] = W(p,c,0);
+          uR[c] = W(q,c,0);
+        }
+        // compute MUSCL reconstruction in edge-end points
+        muscl( p, q, coord, G, uL, uR );
+
+        // evaluate prescribed velocity, once for all components
+        auto v =
+          Problem::prescribedVelocity( m_system, m_ncomp, x[p], y[p], z[p] );
+        // sum domain-edge contributions
+        for (std::size_t c=0; c<m_ncomp; ++c)
+          r(p,c) -= tk::dot(d,v[c]) * (uL[c] + uR[c])
+                  - a * std::abs(tk::dot(v[c],n)) * (uR[c] - uL[c]);
+      };
+
+      // domain-edge integral
+      if (g_inputdeck.get< tag::discr, tag::fused_edgeflux >()) {
+        for (auto e : part.edge) {
+          auto p = edgenode[e*2+0];
+          auto q = edgenode[e*2+1];
+          edgeint( p, q, e );
+          edgeint( q, p, e );
+        }
+      } else {
+        const auto& psup1 = psup.first;
+        const auto& psup2 = psup.second;
+        for (auto p : part.poin)
+          for (std::size_t i=psup2[p]+1; i<=psup2[p+1]; ++i)
+            edgeint( p, psup1[i], edgeid[i-1] );
       }
     }
 
@@ -836,11 +938,13 @@ class Transport {
     //! \param[in] triinpoel Boundary triangle face connecitivity with local ids
     //! \param[in] symbctri Vector with 1 at symmetry BC boundary triangles
     //! \param[in] U Solution vector at recent time step
+    //! \param[in] tri Boundary triangles to integrate on
     //! \param[in,out] R Right-hand side vector computed
     void bndint( const std::array< std::vector< real >, 3 >& coord,
                  const std::vector< std::size_t >& triinpoel,
                  const std::vector< int >& symbctri,
                  const tk::Fields& U,
+                 const std::vector< std::size_t >& tri,
                  tk::Fields& R ) const
     {
       // access node coordinates
@@ -849,9 +953,10 @@ class Transport {
       const auto& z = coord[2];
 
       // boundary integrals: compute fluxes in edges
-      std::vector< real > bflux( triinpoel.size() * m_ncomp * 2 );
+      std::vector< real > bflux( tri.size() * m_ncomp * 6 );
 
-      for (std::size_t e=0; e<triinpoel.size()/3; ++e) {
+      for (std::size_t t=0; t<tri.size(); ++t) {
+        auto e = tri[t];
         // access node IDs
         std::array< std::size_t, 3 >
           N{ triinpoel[e*3+0], triinpoel[e*3+1], triinpoel[e*3+2] };
@@ -861,10 +966,7 @@ class Transport {
         std::array< tk::real, 3 > xp{ x[N[0]], x[N[1]], x[N[2]] },
                                   yp{ y[N[0]], y[N[1]], y[N[2]] },
                                   zp{ z[N[0]], z[N[1]], z[N[2]] };
-        // access solution at element nodes
-        std::vector< std::array< real, 3 > > u( m_ncomp );
-        for (ncomp_t c=0; c<m_ncomp; ++c) u[c] = U.extract( c, m_offset, N );
-        // evaluate prescribed velocity
+        // evaluate prescribed velocity, once for all components
         auto v =
           Problem::prescribedVelocity( m_system, m_ncomp, xp[0], yp[0], zp[0] );
         // compute face area
@@ -876,33 +978,35 @@ class Transport {
         auto n = tk::normal( xp, yp, zp );
         // store flux in boundary elements
         for (std::size_t c=0; c<m_ncomp; ++c) {
-          auto eb = (e*m_ncomp+c)*6;
+          // access solution at element nodes
+          const auto u = U.extract( c, m_offset, N );
+          auto eb = (t*m_ncomp+c)*6;
           auto vdotn = tk::dot( v[c], n );
-          auto Bab = A24 * vdotn * (u[c][0] + u[c][1]);
-          bflux[eb+0] = Bab + A6 * vdotn * u[c][0];
+          auto Bab = A24 * vdotn * (u[0] + u[1]);
+          bflux[eb+0] = Bab + A6 * vdotn * u[0];
           bflux[eb+1] = Bab;
-          Bab = A24 * vdotn * (u[c][1] + u[c][2]);
-          bflux[eb+2] = Bab + A6 * vdotn * u[c][1];
+          Bab = A24 * vdotn * (u[1] + u[2]);
+          bflux[eb+2] = Bab + A6 * vdotn * u[1];
           bflux[eb+3] = Bab;
-          Bab = A24 * vdotn * (u[c][2] + u[c][0]);
-          bflux[eb+4] = Bab + A6 * vdotn * u[c][2];
+          Bab = A24 * vdotn * (u[2] + u[0]);
+          bflux[eb+4] = Bab + A6 * vdotn * u[2];
           bflux[eb+5] = Bab;
         }
       }
 
-      // access pointer to right hand side at component and offset
-      std::vector< const real* > r( m_ncomp );
-      for (ncomp_t c=0; c<m_ncomp; ++c) r[c] = R.cptr( c, m_offset );
+      // access right hand side at offset
+      auto r = R.sview( m_offset );
 
       // boundary integrals: sum flux contributions to points
-      for (std::size_t e=0; e<triinpoel.size()/3; ++e) {
+      for (std::size_t t=0; t<tri.size(); ++t) {
+        auto e = tri[t];
         std::size_t N[3] =
           { triinpoel[e*3+0], triinpoel[e*3+1], triinpoel[e*3+2] };
         for (std::size_t c=0; c<m_ncomp; ++c) {
-          auto eb = (e*m_ncomp+c)*6;
-          R.var(r[c],N[0]) -= bflux[eb+0] + bflux[eb+5];
-          R.var(r[c],N[1]) -= bflux[eb+1] + bflux[eb+2];
-          R.var(r[c],N[2]) -= bflux[eb+3] + bflux[eb+4];
+          auto eb = (t*m_ncomp+c)*6;
+          r(N[0],c) -= bflux[eb+0] + bflux[eb+5];
+          r(N[1],c) -= bflux[eb+1] + bflux[eb+2];
+          r(N[2],c) -= bflux[eb+3] + bflux[eb+4];
         }
       }
 
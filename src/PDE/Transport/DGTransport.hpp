@@ -28,7 +28,6 @@
 #include "Integrate/Basis.hpp"
 #include "Integrate/Quadrature.hpp"
 #include "Integrate/Initialize.hpp"
-#include "Integrate/Mass.hpp"
 #include "Integrate/Surface.hpp"
 #include "Integrate/Boundary.hpp"
 #include "Integrate/Volume.hpp"
@@ -89,31 +88,23 @@ class Transport {
     }
 
     //! Initalize the transport equations for DG
-    //! \param[in] L Element mass matrix
+    //! \param[in] geoElem Element geometry array
     //! \param[in] inpoel Element-node connectivity
     //! \param[in] coord Array of nodal coordinates
     //! \param[in,out] unk Array of unknowns
     //! \param[in] t Physical time
     //! \param[in] nielem Number of internal elements
-    void initialize( const tk::Fields& L,
+    void initialize( const tk::Fields& geoElem,
                      const std::vector< std::size_t >& inpoel,
                      const tk::UnsMesh::Coords& coord,
                      tk::Fields& unk,
                      tk::real t,
                      const std::size_t nielem ) const
     {
-      tk::initialize( m_system, m_ncomp, m_offset, L, inpoel, coord,
+      tk::initialize( m_system, m_ncomp, m_offset, geoElem, inpoel, coord,
                       Problem::solution, unk, t, nielem );
     }
 
-    //! Compute the left hand side mass matrix
-    //! \param[in] geoElem Element geometry array
-    //! \param[in,out] l Block diagonal mass matrix
-    void lhs( const tk::Fields& geoElem, tk::Fields& l ) const {
-      const auto ndof = g_inputdeck.get< tag::discr, tag::ndof >();
-      tk::mass( m_ncomp, m_offset, ndof, geoElem, l );
-    }
-
     //! Update the primitives for this PDE system
     //! \details This function computes and stores the dofs for primitive
     //!   quantities, which are currently unused for transport.
@@ -134,6 +125,8 @@ class Transport {
     //! \param[in] geoFace Face geometry array
     //! \param[in] geoElem Element geometry array
     //! \param[in] fd Face connectivity and boundary conditions object
+    //! \param[in] lhsinv Inverse of the least-squares reconstruction matrix of
+    //!   each element, see tk::invLeastSq_P0P1()
     //! \param[in] inpoel Element-node connectivity
     //! \param[in] coord Array of nodal coordinates
     //! \param[in,out] U Solution vector at recent time step
@@ -142,6 +135,8 @@ class Transport {
                       const tk::Fields& geoFace,
                       const tk::Fields& geoElem,
                       const inciter::FaceData& fd,
+                      const std::vector< std::array<
+                        std::array< tk::real, 3 >, 3 > >& lhsinv,
                       const std::map< std::size_t, std::vector< std::size_t > >&,
                       const std::vector< std::size_t >& inpoel,
                       const tk::UnsMesh::Coords& coord,
@@ -156,19 +151,16 @@ class Transport {
       Assert( fd.Inpofa().size()/3 == fd.Esuf().size()/2,
               "Mismatch in inpofa size" );
 
-      // allocate and initialize matrix and vector for reconstruction
-      std::vector< std::array< std::array< tk::real, 3 >, 3 > >
-        lhs_ls( nelem, {{ {{0.0, 0.0, 0.0}},
-                          {{0.0, 0.0, 0.0}},
-                          {{0.0, 0.0, 0.0}} }} );
+      Assert( lhsinv.size() == nelem, "Size mismatch in least-squares lhs" );
+
+      // allocate and initialize vector for reconstruction
       std::vector< std::vector< std::array< tk::real, 3 > > >
         rhs_ls( nelem, std::vector< std::array< tk::real, 3 > >
           ( m_ncomp,
             {{ 0.0, 0.0, 0.0 }} ) );
 
-      // reconstruct x,y,z-derivatives of unknowns
-      // 0. get lhs matrix, which is only geometry dependent
-      tk::lhsLeastSq_P0P1(fd, geoElem, geoFace, lhs_ls);
+      // reconstruct x,y,z-derivatives of unknowns, the inverse of the lhs
+      // matrix, which is only geometry dependent, is given in lhsinv
 
       // 1. internal face contributions
       tk::intLeastSq_P0P1( m_ncomp, m_offset, rdof, fd, geoElem, U, rhs_ls );
@@ -179,7 +171,7 @@ class Transport {
           b.first, fd, geoFace, geoElem, t, b.second, P, U, rhs_ls );
 
       // 3. solve 3x3 least-squares system
-      tk::solveLeastSq_P0P1( m_ncomp, m_offset, rdof, lhs_ls, rhs_ls, U );
+      tk::solveLeastSq_P0P1( m_ncomp, m_offset, rdof, lhsinv, rhs_ls, U );
 
       // 4. transform reconstructed derivatives to Dubiner dofs
       tk::transform_P0P1( m_ncomp, m_offset, rdof, nelem, inpoel, coord, U );
@@ -193,6 +185,7 @@ class Transport {
     //! \param[in] inpoel Element-node connectivity
     //! \param[in] coord Array of nodal coordinates
     //! \param[in] ndofel Vector of local number of degrees of freedome
+    //! \param[in] troubled Ids of elements to limit
     //! \param[in,out] U Solution vector at recent time step
     void limit( [[maybe_unused]] tk::real t,
                 [[maybe_unused]] const tk::Fields& geoFace,
@@ -202,15 +195,16 @@ class Transport {
                 const std::vector< std::size_t >& inpoel,
                 const tk::UnsMesh::Coords& coord,
                 const std::vector< std::size_t >& ndofel,
+                const std::vector< std::size_t >& troubled,
                 tk::Fields& U,
                 tk::Fields& ) const
     {
       const auto limiter = g_inputdeck.get< tag::discr, tag::limiter >();
 
       if (limiter == ctr::LimiterType::WENOP1)
-        WENO_P1( fd.Esuel(), m_offset, U );
+        WENO_P1( fd.Esuel(), troubled, m_offset, U );
       else if (limiter == ctr::LimiterType::SUPERBEEP1)
-        Superbee_P1( fd.Esuel(), inpoel, ndofel, m_offset, coord, U );
+        Superbee_P1( fd.Esuel(), inpoel, ndofel, troubled, m_offset, coord, U );
     }
 
     //! Compute right hand side
@@ -223,6 +217,8 @@ class Transport {
     //! \param[in] U Solution vector at recent time step
     //! \param[in] P Primitive vector at recent time step
     //! \param[in] ndofel Vector of local number of degrees of freedom
+    //! \param[in] elems Element ids bucketed by their local number of dofs
+    //! \param[in] part Part of the right hand side to compute, see RhsPart
     //! \param[in,out] R Right-hand side vector computed
     void rhs( tk::real t,
               const tk::Fields& geoFace,
@@ -233,6 +229,8 @@ class Transport {
               const tk::Fields& U,
               const tk::Fields& P,
               const std::vector< std::size_t >& ndofel,
+              const tk::NdofBuckets& elems,
+              inciter::RhsPart part,
               tk::Fields& R ) const
     {
       const auto ndof = g_inputdeck.get< tag::discr, tag::ndof >();
@@ -251,8 +249,12 @@ class Transport {
       Assert( fd.Inpofa().size()/3 == fd.Esuf().size()/2,
               "Mismatch in inpofa size" );
 
+      // The terms not depending on ghost data are computed with the faces
+      // whose both elements are owned, the rhs is also zeroed at that point
+      const auto own = part != inciter::RhsPart::CHBND;
+
       // set rhs to zero
-      R.fill(0.0);
+      if (own) R.fill(0.0);
 
       // empty vector for non-conservative terms. This vector is unused for
       // linear transport since, there are no non-conservative terms in the
@@ -261,14 +263,15 @@ class Transport {
 
       // compute internal surface flux integrals
       tk::surfInt( m_system, 1, m_offset, ndof, rdof, inpoel, coord,
-                   fd, geoFace, Upwind::flux, Problem::prescribedVelocity, U, P,
+                   fd, part, Upwind::fluxes, Problem::prescribedVelocity, U, P,
                    ndofel, R, riemannDeriv );
 
+      if (!own) return;
+
       if(ndof > 1)
         // compute volume integrals
-        tk::volInt( m_system, m_ncomp, m_offset, ndof, fd.Esuel().size()/4,
-                    inpoel, coord, geoElem, flux, Problem::prescribedVelocity,
-                    U, ndofel, R );
+        tk::volInt( m_system, m_ncomp, m_offset, ndof, elems, inpoel, coord,
+                    geoElem, flux, Problem::prescribedVelocity, U, R );
 
       // compute boundary surface flux integrals
       for (const auto& b : m_bc)
@@ -282,6 +285,8 @@ class Transport {
 //     //! \param[in] coord Mesh node coordinates
 //     //! \param[in] inpoel Mesh element connectivity
     //! \return Minimum time step size
+    //! \details Since the time step size is not restricted by this PDE, the
+    //!   element time step sizes are left unchanged.
     tk::real dt( const std::array< std::vector< tk::real >, 3 >& /*coord*/,
                  const std::vector< std::size_t >& /*inpoel*/,
                  const inciter::FaceData& /*fd*/,
@@ -290,7 +295,8 @@ class Transport {
                  const std::vector< std::size_t >& /*ndofel*/,
                  const tk::Fields& /*U*/,
                  const tk::Fields&,
-                 const std::size_t /*nielem*/ ) const
+                 const std::size_t /*nielem*/,
+                 std::vector< tk::real >& /*dte*/ ) const
     {
       tk::real mindt = std::numeric_limits< tk::real >::max();
       return mindt;
@@ -327,7 +333,7 @@ class Transport {
     //! Return surface field output going to file
     std::vector< std::vector< tk::real > >
     surfOutput( const std::map< int, std::vector< std::size_t > >&,
-                tk::Fields& ) const
+                const tk::Fields& ) const
     {
       std::vector< std::vector< tk::real > > s; // punt for now
       return s;
@@ -336,47 +342,38 @@ class Transport {
     //! Return field output going to file
     //! \param[in] t Physical time
     //! \param[in] geoElem Element geometry array
-    //! \param[in,out] U Solution vector at recent time step
+    //! \param[in] U Solution vector at recent time step
     //! \return Vector of vectors to be output to file
     //! \details This functions should be written in conjunction with names(),
-    //!   which provides the vector of field names
-    //! \note U is overwritten
+    //!   which provides the vector of field names. The analytic solution is
+    //!   evaluated at the element centroids directly into the output vectors.
     std::vector< std::vector< tk::real > >
     fieldOutput( tk::real t,
                  tk::real,
                  std::size_t,
                  std::size_t,
                  const tk::Fields& geoElem,
-                 tk::Fields& U,
+                 const tk::Fields& U,
                  const tk::Fields& ) const
     {
       const auto rdof = g_inputdeck.get< tag::discr, tag::rdof >();
       Assert( geoElem.nunk() == U.nunk(), "Size mismatch" );
-      std::vector< std::vector< tk::real > > out;
+      std::vector< std::vector< tk::real > > out( 3*m_ncomp );
       // will output numerical solution for all components
       for (ncomp_t c=0; c<m_ncomp; ++c)
-        out.push_back( U.extract( c*rdof, m_offset ) );
-      // evaluate analytic solution at time t
-      auto E = U;
+        out[c] = U.extract( c*rdof, m_offset );
+      // will output analytic solution and error for all components
+      for (ncomp_t c=0; c<2*m_ncomp; ++c) out[m_ncomp+c].resize( U.nunk() );
       for (std::size_t e=0; e<U.nunk(); ++e)
       {
         int inbox = 0;
         auto s = Problem::solution( m_system, m_ncomp, geoElem(e,1,0),
                                     geoElem(e,2,0), geoElem(e,3,0), t, inbox );
-        for (ncomp_t c=0; c<m_ncomp; ++c)
-          E( e, c*rdof, m_offset ) = s[c];
-      }
-      // will output analytic solution for all components
-      for (ncomp_t c=0; c<m_ncomp; ++c)
-        out.push_back( E.extract( c*rdof, m_offset ) );
-      // will output error for all components
-      for (ncomp_t c=0; c<m_ncomp; ++c) {
-        auto mark = c*rdof;
-        auto u = U.extract( mark, m_offset );
-        auto e = E.extract( mark, m_offset );
-        for (std::size_t i=0; i<u.size(); ++i)
-          e[i] = std::pow( e[i] - u[i], 2.0 ) * geoElem(i,0,0);
-        out.push_back( e );
+        for (ncomp_t c=0; c<m_ncomp; ++c) {
+          out[m_ncomp+c][e] = s[c];
+          out[2*m_ncomp+c][e] =
+            std::pow( U(e,c*rdof,m_offset) - s[c], 2.0 ) * geoElem(e,0,0);
+        }
       }
       return out;
     }
@@ -12,6 +12,10 @@
 */
 // *****************************************************************************
 
+#include <iterator>
+#include <limits>
+#include <algorithm>
+
 #include "NoWarning/threefry.hpp"
 
 #include "Random123.hpp"
@@ -71,37 +75,165 @@ std::vector< std::size_t >
 Tracker::addpar( const std::array< std::vector< tk::real >, 3 >& coord,
                  const std::vector< std::size_t >& inpoel,
                  const std::vector< std::size_t >& miss,
-                 const std::vector< std::vector< tk::real > >& ps )
+                 const std::vector< tk::real >& ps )
 // *****************************************************************************
 //  Try to find particles and add those found to the list of ours
 //! \param[in] coord Mesh node coordinates
 //! \param[in] inpoel Mesh element connectivity
 //! \param[in] miss Indices of particles to find
-//! \param[in] ps Particle data associated to those particle indices to find
+//! \param[in] ps Particle data associated to those particle indices to find,
+//!   packed component-major as by pack()
 //! \return Particle indices found
 // *****************************************************************************
 {
-  Assert( ps.size() == miss.size(), "Size mismatch" );
+  const auto n = miss.size();
+  const auto nprop = m_particles.nprop();
+  Assert( ps.size() == n*nprop, "Size mismatch" );
 
   std::vector< std::size_t > found; // will store indices of particles found
 
-  // try to find particles received
-  for (std::size_t i=0; i<ps.size(); ++i)
-    for (std::size_t e=0; e<inpoel.size()/4; ++e) {
-      std::array< tk::real, 4 > N;
-      auto last = m_particles.nunk();
-      m_particles.push_back( ps[i] );
-      if (parinel( coord, inpoel, last, e, N )) {
-        found.push_back( miss[i] );
-        m_elp.resize( last+1 );
-        m_elp[ last ] = e;
-        e = inpoel.size()/4;
-      } else {
-        m_particles.rm( { last } );
+  const auto& t = tree( coord, inpoel );
+
+  // try to find particles received in the cells whose boxes contain them
+  std::vector< tk::real > p( nprop );
+  for (std::size_t i=0; i<n; ++i) {
+    for (std::size_t c=0; c<nprop; ++c) p[c] = ps[ c*n + i ];
+    std::array< tk::real, 4 > N;
+    auto last = m_particles.nunk();
+    m_particles.push_back( p );
+    if (t.find( p[0], p[1], p[2],
+                [&]( std::size_t e ){
+                  return parinel( coord, inpoel, last, e, N ); } ))
+      found.push_back( miss[i] );
+    else
+      m_particles.rm( { last } );
+  }
+
+  return found;
+}
+
+const std::vector< tk::real >&
+Tracker::invjac( const std::array< std::vector< tk::real >, 3 >& coord,
+                 const std::vector< std::size_t >& inpoel )
+// *****************************************************************************
+//  Access inverse Jacobians of mesh cells, generating them if needed
+//! \param[in] coord Mesh node coordinates
+//! \param[in] inpoel Mesh element connectivity
+//! \return Inverse Jacobians of mesh cells, see tk::genInvJacTet
+// *****************************************************************************
+{
+  if (m_invjac.empty()) m_invjac = tk::genInvJacTet( coord, inpoel );
+  return m_invjac;
+}
+
+const tk::BVH&
+Tracker::tree( const std::array< std::vector< tk::real >, 3 >& coord,
+               const std::vector< std::size_t >& inpoel )
+// *****************************************************************************
+//  Access bounding volume hierarchy of mesh chunk, building it if needed
+//! \param[in] coord Mesh node coordinates
+//! \param[in] inpoel Mesh element connectivity
+//! \return Bounding volume hierarchy of mesh chunk
+// *****************************************************************************
+{
+  if (m_tree.empty() && !inpoel.empty()) m_tree = BVH( coord, inpoel );
+  return m_tree;
+}
+
+std::vector< tk::real >
+Tracker::pack( const std::vector< std::size_t >& idx ) const
+// *****************************************************************************
+//  Pack particles into a single buffer for migration
+//! \param[in] idx Indices of particles to pack
+//! \return All properties of the particles, component-major, i.e., the first
+//!   property of all particles first, etc.
+// *****************************************************************************
+{
+  const auto n = idx.size();
+  const auto nprop = m_particles.nprop();
+  std::vector< tk::real > ps( n*nprop );
+  for (std::size_t c=0; c<nprop; ++c)
+    for (std::size_t i=0; i<n; ++i)
+      ps[ c*n + i ] = m_particles( idx[i], c, 0 );
+  return ps;
+}
+
+void
+Tracker::commap( const std::vector< std::size_t >& inpoel,
+                 const std::vector< std::size_t >& gid,
+                 const tk::NodeCommMap& nodeCommMap )
+// *****************************************************************************
+//  Find the chares across the faces at the boundary of our mesh chunk
+//! \param[in] inpoel Mesh element connectivity
+//! \param[in] gid Global node ids of local node ids
+//! \param[in] nodeCommMap Global node ids shared with fellow chares
+//! \details A particle that walked out of our mesh chunk through one of these
+//!   faces is migrated only to the chares sharing all three nodes of the face,
+//!   which usually is the single chare holding the element on the other side.
+//!   Faces at the boundary of the domain share their nodes with no chare.
+// *****************************************************************************
+{
+  Assert( m_esuel.size() == inpoel.size(),
+          "Elements surrounding elements size mismatch" );
+
+  m_bndch.clear();
+  for (std::size_t e=0; e<inpoel.size()/4; ++e)
+    for (std::size_t f=0; f<4; ++f) {
+      if (m_esuel[e*4+f] >= 0) continue;
+      for (const auto& [ c, nodes ] : nodeCommMap) {
+        bool shared = true;
+        for (auto a : tk::lpofa[f])
+          if (nodes.find( gid[ inpoel[e*4+a] ] ) == end(nodes)) shared = false;
+        if (shared) m_bndch[ e*4+f ].push_back( c );
       }
     }
+}
 
-  return found;
+bool
+Tracker::locate( const std::array< std::vector< tk::real >, 3 >& coord,
+                 const std::vector< std::size_t >& inpoel,
+                 std::size_t p,
+                 std::array< tk::real, 4 >& N,
+                 std::size_t& exit )
+// *****************************************************************************
+//  Find mesh cell of particle
+//! \param[in] coord Mesh node coordinates
+//! \param[in] inpoel Mesh element connectivity
+//! \param[in] p Particle index
+//! \param[in,out] N Shapefunctions evaluated at the particle position in the
+//!   cell found
+//! \param[out] exit Element*4+face of the chunk-boundary face the walk left
+//!   our mesh chunk through, if it did, otherwise an invalid face id
+//! \return True if particle is in one of our mesh cells
+//! \details The search walks from the cell the particle has last been found
+//!   in, each time crossing the face opposite the node whose shapefunction is
+//!   the most negative at the particle, i.e., the face beyond which the
+//!   particle is the farthest, which finds particles that moved a few cells
+//!   in a few steps. If the walk leaves the mesh chunk or does not arrive
+//!   within s_maxwalk steps, e.g., on non-convex chunks, the cells whose
+//!   bounding boxes contain the particle are searched.
+// *****************************************************************************
+{
+  Assert( m_esuel.size() == inpoel.size(),
+          "Elements surrounding elements size mismatch" );
+
+  exit = std::numeric_limits< std::size_t >::max();
+  auto e = m_elp[p];
+  for (std::size_t s=0; s<s_maxwalk; ++s) {
+    if (parinel( coord, inpoel, p, e, N )) return true;
+    // per tk::lpofa face f is opposite node f
+    auto f = std::distance( begin(N), std::min_element( begin(N), end(N) ) );
+    auto n = m_esuel[ e*4 + static_cast< std::size_t >( f ) ];
+    if (n < 0) {        // walked out of our mesh chunk
+      exit = e*4 + static_cast< std::size_t >( f );
+      break;
+    }
+    e = static_cast< std::size_t >( n );
+  }
+
+  return tree( coord, inpoel ).find(
+    m_particles(p,0,0), m_particles(p,1,0), m_particles(p,2,0),
+    [&]( std::size_t c ){ return parinel( coord, inpoel, p, c, N ); } );
 }
 
 bool
@@ -120,73 +252,10 @@ Tracker::parinel( const std::array< std::vector< tk::real >, 3 >& coord,
 //! \return True if particle is in mesh cell
 // *****************************************************************************
 {
-  // Tetrahedron node indices
-  const auto A = inpoel[e*4+0];
-  const auto B = inpoel[e*4+1];
-  const auto C = inpoel[e*4+2];
-  const auto D = inpoel[e*4+3];
-
-  // Tetrahedron node coordinates
-  const auto& x = coord[0];
-  const auto& y = coord[1];
-  const auto& z = coord[2];
+  tk::shapeTet( invjac( coord, inpoel ), e, m_particles(p,0,0),
+                m_particles(p,1,0), m_particles(p,2,0), N );
 
-  // Particle coordinates
-  const auto& xp = m_particles(p,0,0);
-  const auto& yp = m_particles(p,1,0);
-  const auto& zp = m_particles(p,2,0);
-
-  // Evaluate linear shapefunctions at particle locations using Cramer's Rule
-  //    | xp |   | x1 x2 x3 x4 |   | N1 |
-  //    | yp | = | y1 y2 y3 y4 | • | N2 |
-  //    | zp |   | z1 z2 z3 z4 |   | N3 |
-  //    | 1  |   | 1  1  1  1  |   | N4 |
-
-  tk::real DetX = (y[B]*z[C] - y[C]*z[B] - y[B]*z[D] + y[D]*z[B] +
-    y[C]*z[D] - y[D]*z[C])*x[A] + x[B]*y[C]*z[A] - x[B]*y[A]*z[C] +
-    x[C]*y[A]*z[B] - x[C]*y[B]*z[A] + x[B]*y[A]*z[D] - x[B]*y[D]*z[A] -
-    x[D]*y[A]*z[B] + x[D]*y[B]*z[A] - x[C]*y[A]*z[D] + x[C]*y[D]*z[A] +
-    x[D]*y[A]*z[C] - x[D]*y[C]*z[A] - x[B]*y[C]*z[D] + x[B]*y[D]*z[C] +
-    x[C]*y[B]*z[D] - x[C]*y[D]*z[B] - x[D]*y[B]*z[C] + x[D]*y[C]*z[B];
-
-  tk::real DetX1 = (y[D]*z[C] - y[C]*z[D] + y[C]*zp - yp*z[C] -
-    y[D]*zp + yp*z[D])*x[B] + x[C]*y[B]*z[D] - x[C]*y[D]*z[B] -
-    x[D]*y[B]*z[C] + x[D]*y[C]*z[B] - x[C]*y[B]*zp + x[C]*yp*z[B] +
-    xp*y[B]*z[C] - xp*y[C]*z[B] + x[D]*y[B]*zp - x[D]*yp*z[B] -
-    xp*y[B]*z[D] + xp*y[D]*z[B] + x[C]*y[D]*zp - x[C]*yp*z[D] -
-    x[D]*y[C]*zp + x[D]*yp*z[C] + xp*y[C]*z[D] - xp*y[D]*z[C];
-
-  tk::real DetX2 = (y[C]*z[D] - y[D]*z[C] - y[C]*zp + yp*z[C] +
-    y[D]*zp - yp*z[D])*x[A] + x[C]*y[D]*z[A] - x[C]*y[A]*z[D] +
-    x[D]*y[A]*z[C] - x[D]*y[C]*z[A] + x[C]*y[A]*zp - x[C]*yp*z[A] -
-    xp*y[A]*z[C] + xp*y[C]*z[A] - x[D]*y[A]*zp + x[D]*yp*z[A] +
-    xp*y[A]*z[D] - xp*y[D]*z[A] - x[C]*y[D]*zp + x[C]*yp*z[D] +
-    x[D]*y[C]*zp - x[D]*yp*z[C] - xp*y[C]*z[D] + xp*y[D]*z[C];
-
-  tk::real DetX3 = (y[D]*z[B] - y[B]*z[D] + y[B]*zp - yp*z[B] -
-    y[D]*zp + yp*z[D])*x[A] + x[B]*y[A]*z[D] - x[B]*y[D]*z[A] -
-    x[D]*y[A]*z[B] + x[D]*y[B]*z[A] - x[B]*y[A]*zp + x[B]*yp*z[A] +
-    xp*y[A]*z[B] - xp*y[B]*z[A] + x[D]*y[A]*zp - x[D]*yp*z[A] -
-    xp*y[A]*z[D] + xp*y[D]*z[A] + x[B]*y[D]*zp - x[B]*yp*z[D] -
-    x[D]*y[B]*zp + x[D]*yp*z[B] + xp*y[B]*z[D] - xp*y[D]*z[B];
-
-  tk::real DetX4 = (y[B]*z[C] - y[C]*z[B] - y[B]*zp + yp*z[B] +
-    y[C]*zp - yp*z[C])*x[A] + x[B]*y[C]*z[A] - x[B]*y[A]*z[C] +
-    x[C]*y[A]*z[B] - x[C]*y[B]*z[A] + x[B]*y[A]*zp - x[B]*yp*z[A] -
-    xp*y[A]*z[B] + xp*y[B]*z[A] - x[C]*y[A]*zp + x[C]*yp*z[A] +
-    xp*y[A]*z[C] - xp*y[C]*z[A] - x[B]*y[C]*zp + x[B]*yp*z[C] +
-    x[C]*y[B]*zp - x[C]*yp*z[B] - xp*y[B]*z[C] + xp*y[C]*z[B];
-
-  // Shape functions evaluated at particle location
-  N[0] = DetX1/DetX;
-  N[1] = DetX2/DetX;
-  N[2] = DetX3/DetX;
-  N[3] = DetX4/DetX;
-
-  // if min( N^i, 1-N^i ) > 0 for all i, particle is in cell
-  if ( std::min(N[0],1.0-N[0]) > 0 && std::min(N[1],1.0-N[1]) > 0 &&
-       std::min(N[2],1.0-N[2]) > 0 && std::min(N[3],1.0-N[3]) > 0 )
-  {
+  if (tk::intet( N )) {
     m_elp.resize( p+1 );
     m_elp[ p ] = e; // store element of particle
     return true;
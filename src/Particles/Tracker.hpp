@@ -8,7 +8,14 @@
   \brief     Tracker tracks Lagrangian particles in physical space
   \details   Tracker tracks Lagrangian particles in physical space. It works on
     a chunk of the Eulerian mesh, and tracks particles in elements and across
-    mesh chunks held by different Charm++ chares.
+    mesh chunks held by different Charm++ chares. A particle is searched for
+    first by walking from the element it has last been found in towards it
+    across element faces, then in the elements whose bounding boxes contain it,
+    found by a bounding volume hierarchy. Particles that left the mesh chunk
+    are handed directly to the chares whose chunks' bounding boxes contain
+    them, if the holder has passed the bounding boxes of all chunks, and to the
+    chares sharing mesh nodes with us otherwise. Only particles not found by
+    either are broadcast to all chares.
 */
 // *****************************************************************************
 #ifndef Tracker_h
@@ -17,6 +24,8 @@
 #include <vector>
 #include <array>
 #include <set>
+#include <map>
+#include <limits>
 #include <unordered_map>
 
 #include "NoWarning/pup.hpp"
@@ -24,6 +33,8 @@
 #include "Keywords.hpp"
 #include "Particles.hpp"
 #include "DerivedData.hpp"
+#include "BVH.hpp"
+#include "CommMap.hpp"
 #include "ParticleWriter.hpp"
 #include "ContainerUtil.hpp"
 #include "PUPUtil.hpp"
@@ -48,10 +59,44 @@ class Tracker {
       m_parmiss(),
       m_parelse(),
       m_nchpar( 0 ),
-      m_esupel( tk::genEsupel( inpoel, 4, tk::genEsup(inpoel,4) ) ),
+      m_nchreq( 0 ),
+      m_esuel( inpoel.empty() ? std::vector< int >() :
+               tk::genEsuelTet( inpoel, tk::genEsup(inpoel,4) ) ),
+      m_tree(),
+      m_invjac(),
+      m_chbox(),
       m_feedback( feedback )
     {}
 
+    //! Bounding box of our mesh chunk
+    //! \param[in] coord Mesh node coordinates
+    //! \param[in] inpoel Mesh element connectivity
+    //! \return Bounding box of our mesh chunk: xmin, ymin, zmin, xmax, ymax,
+    //!   zmax, empty (min > max) if we hold no elements
+    //! \details The holder gathers the boxes of all chares and passes them to
+    //!   chareboxes() of all chares, see there.
+    BVH::Box bbox( const std::array< std::vector< tk::real >, 3 >& coord,
+                   const std::vector< std::size_t >& inpoel )
+    {
+      const auto& t = tree( coord, inpoel );
+      if (!t.empty()) return t.box();
+      constexpr auto big = std::numeric_limits< tk::real >::max();
+      return {{ big, big, big, -big, -big, -big }};
+    }
+
+    //! Store bounding boxes of the mesh chunks of all holder chares
+    //! \param[in] box Bounding boxes of the mesh chunks of all holder chares,
+    //!   indexed by chare ID, each as returned by bbox()
+    //! \details Once stored, particles that left our mesh chunk are sent only
+    //!   to the chares whose boxes contain them instead of all chares whose
+    //!   mesh chunks we share nodes with.
+    void chareboxes( const std::vector< BVH::Box >& box ) { m_chbox = box; }
+
+    //! Find the chares across the faces at the boundary of our mesh chunk
+    void commap( const std::vector< std::size_t >& inpoel,
+                 const std::vector< std::size_t >& gid,
+                 const tk::NodeCommMap& nodeCommMap );
+
     //! Generate particles to each of our mesh cells
     void
     genpar( const std::array< std::vector< tk::real >, 3 >& coord,
@@ -139,56 +184,62 @@ class Tracker {
                 ChareArray* const array,
                 tk::real dt )
     {
-      // Lambda to attempt to find and advance particle i in element e. Returns
-      // true if the particle was found (and advanced), false if was not found.
+      // Search cells of our mesh chunk for all particles and advance those
+      // found. If a particle has not been found, it left our chunk of the
+      // mesh, mark as missing (will initiate communication to find it).
+      // Most particles are still in the cell they have last been found in, so
+      // first evaluate the shapefunctions of those cells for all particles at
+      // once.
+      std::array< std::vector< tk::real >, 3 > pos{{ m_particles.extract(0,0),
+        m_particles.extract(1,0), m_particles.extract(2,0) }};
+      std::array< std::vector< tk::real >, 4 > Nlast;
+      tk::shapeTet( invjac( coord, inpoel ), m_elp, pos, Nlast );
       std::array< tk::real, 4 > N;
-      auto adv = [ this, array, &N, &dt, &coord, &inpoel ]
-                ( std::size_t i, std::size_t e ) -> bool
-      {
-        if (this->parinel( coord, inpoel, i, e, N )) {
-          advanceParticle( array, i, e, dt, N );
-          return true;
-        }
-        return false;
-      };
-      // Search cells of our mesh chunk for all particles
+      std::unordered_map< std::size_t, std::size_t > exit;
       for (std::size_t i=0; i<m_particles.nunk(); ++i) {
-        // Get element ID where particle i has last been seen
-        bool found = adv( i, m_elp[i] );
-        // Next search in the elements surroundings the points of the element
-        // where the particle has last been found
-        if (!found) {
-          auto last = m_esupel.second[m_elp[i]+1];
-          for (auto j=m_esupel.second[m_elp[i]]+1; j<=last; ++j) {
-            found = adv( i, m_esupel.first[j] );
-            if (found) j = last+1;  // search for next particle
-          }
-        }
-        // Next search all cells in our chunk of the mesh
-        if (!found) {
-          for (std::size_t e=0; e<inpoel.size()/4; ++e) {
-            found = adv( i, e );
-            if (found) e = inpoel.size()/4;  // search for next particle
-          }
-          // If the particle still has not been found, it left our chunk of the
-          // mesh, mark as missing (will initiate communication to find it)
-          if (!found) m_parmiss.insert( i );
+        for (std::size_t a=0; a<4; ++a) N[a] = Nlast[a][i];
+        std::size_t f;
+        if (tk::intet( N ) || locate( coord, inpoel, i, N, f )) {
+          advanceParticle( array, i, m_elp[i], dt, N );
+        } else {
+          m_parmiss.insert( i );
+          exit[i] = f;
         }
       }
-      // If we have no missing particles, we are done, if we do, send out
-      // requests to find them to those ChareArray chares which we neighbor
-      // mesh cells with.
+      // If we have no missing particles, we are done, if we do, migrate them
+      // in a single batch per destination chare: to the chares across the
+      // chunk-boundary face a particle walked out through, if known, else to
+      // those whose mesh chunks' bounding boxes contain it, if known, else to
+      // those which we neighbor mesh cells with.
       if (m_parmiss.empty()) {
         signal2host_parcomcomplete( hostproxy, array );
-      } else {
-        std::vector< std::vector< tk::real > > pexp( m_parmiss.size() );
-        std::size_t j = 0;
-        for (auto i : m_parmiss) pexp[ j++ ] = m_particles[i];
-        m_nchpar = 0;
-        std::vector< std::size_t > miss( begin(m_parmiss), end(m_parmiss) );
-        for (const auto& n : msum)
-          arrayProxy[ n.first ].findpar( chid, miss, pexp );
+        return;
+      }
+      std::map< int, std::vector< std::size_t > > dest;
+      for (auto i : m_parmiss) {
+        auto b = m_bndch.find( exit[i] );
+        if (b != end(m_bndch)) {
+          for (auto c : b->second) dest[c].push_back( i );
+        } else if (!m_chbox.empty()) {
+          const auto x = m_particles(i,0,0);
+          const auto y = m_particles(i,1,0);
+          const auto z = m_particles(i,2,0);
+          for (std::size_t c=0; c<m_chbox.size(); ++c) {
+            const auto ch = static_cast< int >( c );
+            if (ch != chid && BVH::contains( m_chbox[c], x, y, z ))
+              dest[ ch ].push_back( i );
+          }
+        } else {
+          for (const auto& n : msum) dest[ n.first ].push_back( i );
+        }
       }
+      m_nchpar = 0;
+      m_nchreq = dest.size();
+      if (dest.empty())
+        collect( arrayProxy, chid );
+      else
+        for (const auto& [ ch, idx ] : dest)
+          arrayProxy[ ch ].findpar( chid, idx, pack( idx ) );
     }
 
     //! Find particles missing by the requestor and make those found ours
@@ -198,14 +249,15 @@ class Tracker {
     //! \param[in] inpoel Mesh element connectivity
     //! \param[in] fromch Chare ID the request originates from
     //! \param[in] miss Indices of particles to find
-    //! \param[in] ps Particle data associated to those particle indices to find
+    //! \param[in] ps Particle data associated to those particle indices to
+    //!   find, packed component-major as by pack()
     template< class ChareArrayProxy >
     void findpar( const ChareArrayProxy& arrayProxy,
                   const std::array< std::vector< tk::real >, 3 >& coord,
                   const std::vector< std::size_t >& inpoel,
                   int fromch,
                   const std::vector< std::size_t >& miss,
-                  const std::vector< std::vector< tk::real > >& ps )
+                  const std::vector< tk::real >& ps )
     {
       // Try to find particles missing by the requestor and own those found
       auto found = addpar( coord, inpoel, miss, ps );
@@ -217,9 +269,6 @@ class Tracker {
     //! \param[in] hostproxy Charm++ host proxy to which address reductions
     //! \param[in] arrayProxy Charm++ array proxy to whose all elements te
     //!   address our desparate broadcast (this is the proxy that holds us)
-    //! \param[in] msum Mesh chunks surrounding mesh chunks; we only use the
-    //!   keys of this container to address fellow Charm++ chare array elements
-    //!   via the arrayProxy
     //! \param[in] array Charm++ array object pointer of the holder class
     //! \param[in] chid Charm++ array index (thisIndex of the holder class)
     //! \param[in] found Indices of particles found
@@ -227,13 +276,12 @@ class Tracker {
     void
     foundpar( HostProxy& hostproxy,
               ChareArrayProxy& arrayProxy,
-              const std::unordered_map< int, std::vector< std::size_t > >& msum,
               ChareArray* const array,
               int chid,
               const std::vector< std::size_t >& found )
     {
       m_parelse.insert( begin(found), end(found) );
-      if (++m_nchpar == msum.size()) {    // if we have heard from all neighbors
+      if (++m_nchpar == m_nchreq) {   // if we have heard from all requested
         remove( m_parelse );  // delete particles found elsewhere
         // find particle that are still have not been found (by close neighbors)
         std::set< std::size_t > far;
@@ -241,20 +289,13 @@ class Tracker {
                              begin(m_parelse), end(m_parelse), 
                              std::inserter( far, begin(far) ) );
         m_parmiss = far;
-        // if there are still missing particles (not found by close neighbors we
-        // share mesh nodes with), we resort to requesting them to be searched by
-        // all holder chares
-        if (m_parmiss.empty()) {
+        // if there are still missing particles (not found by the chares
+        // requested), we resort to requesting them to be searched by all
+        // holder chares
+        if (m_parmiss.empty())
           signal2host_parcomcomplete( hostproxy, array );
-        } else {
-          std::vector< std::vector< tk::real > > pexp( m_parmiss.size() );
-          std::size_t j = 0;
-          for (auto i : m_parmiss) pexp[ j++ ] = m_particles[i];
-          m_nchpar = 0;
-          std::vector< std::size_t > miss( begin(m_parmiss), end(m_parmiss) );
-          m_parelse.clear();
-          arrayProxy.collectpar( chid, miss, pexp ); // broadcast to everyone
-        }
+        else
+          collect( arrayProxy, chid );
       }
     }
 
@@ -265,14 +306,15 @@ class Tracker {
     //! \param[in] inpoel Mesh element connectivity
     //! \param[in] fromch Chare ID the request originates from
     //! \param[in] miss Indices of particles to find
-    //! \param[in] ps Particle data associated to those particle indices to find
+    //! \param[in] ps Particle data associated to those particle indices to
+    //!   find, packed component-major as by pack()
     template< class ChareArrayProxy >
     void collectpar( const ChareArrayProxy& arrayProxy,
                      const std::array< std::vector< tk::real >, 3 >& coord,
                      const std::vector< std::size_t >& inpoel,
                      int fromch,
                      const std::vector< std::size_t >& miss,
-                     const std::vector< std::vector< tk::real > >& ps )
+                     const std::vector< tk::real >& ps )
     {
       // Try to find particles missing by the requestor and own those found
       auto found = addpar( coord, inpoel, miss, ps );
@@ -295,7 +337,9 @@ class Tracker {
       m_parelse.insert( begin(found), end(found) );
       if (++m_nchpar == nchare) {  // if we have heard from everyone
         remove( m_parelse );  // delete particles found elsewhere
-        Assert( m_parmiss == m_parelse, "Not all particles have been found" );
+        ErrChk( m_parmiss == m_parelse, std::to_string( m_parmiss.size() -
+                m_parelse.size() ) + " particle(s) lost: not found by any "
+                "chare" );
         signal2host_parcomcomplete( hostproxy, array );
       }
     }
@@ -310,6 +354,10 @@ class Tracker {
       p | m_parmiss;
       p | m_parelse;
       p | m_nchpar;
+      p | m_nchreq;
+      p | m_esuel;
+      p | m_chbox;
+      p | m_bndch;
     }
     //! \brief Pack/Unpack serialize operator|
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
@@ -328,9 +376,22 @@ class Tracker {
     std::set< std::size_t > m_parelse;
     //! Number of chares we received particles from
     std::size_t m_nchpar;
-    //! Elements surrounding points of elements of mesh chunk we operate on
-    std::pair< std::vector< std::size_t >, std::vector< std::size_t > >
-      m_esupel;
+    //! Number of chares we requested to find our missing particles
+    std::size_t m_nchreq;
+    //! Elements surrounding elements of mesh chunk we operate on
+    std::vector< int > m_esuel;
+    //! \brief Bounding volume hierarchy of mesh chunk we operate on
+    //! \details Built on first use, and not migrated, as it is cheaper to
+    //!   rebuild than to pack.
+    BVH m_tree;
+    //! \brief Inverse Jacobians of mesh cells of mesh chunk we operate on
+    //! \details Generated on first use, and not migrated, see m_tree.
+    std::vector< tk::real > m_invjac;
+    //! Bounding boxes of the mesh chunks of all holder chares
+    std::vector< BVH::Box > m_chbox;
+    //! \brief Chares sharing the nodes of the faces at the boundary of our
+    //!   mesh chunk, associated to element*4+face, see commap()
+    std::unordered_map< std::size_t, std::vector< int > > m_bndch;
     //! Bool that determines whether to send sub-task feedback to host
     bool m_feedback;
 
@@ -339,7 +400,30 @@ class Tracker {
     addpar( const std::array< std::vector< tk::real >, 3 >& coord,
             const std::vector< std::size_t >& inpoel,
             const std::vector< std::size_t >& miss,
-            const std::vector< std::vector< tk::real > >& ps );
+            const std::vector< tk::real >& ps );
+
+    //! \brief Maximum number of elements visited walking towards a particle
+    //!   before searching via the bounding volume hierarchy
+    static const std::size_t s_maxwalk = 32;
+
+    //! Access inverse Jacobians of mesh cells, generating them if needed
+    const std::vector< tk::real >&
+    invjac( const std::array< std::vector< tk::real >, 3 >& coord,
+            const std::vector< std::size_t >& inpoel );
+
+    //! Access bounding volume hierarchy of mesh chunk, building it if needed
+    const BVH& tree( const std::array< std::vector< tk::real >, 3 >& coord,
+                     const std::vector< std::size_t >& inpoel );
+
+    //! Find mesh cell of particle
+    bool locate( const std::array< std::vector< tk::real >, 3 >& coord,
+                 const std::vector< std::size_t >& inpoel,
+                 std::size_t p,
+                 std::array< tk::real, 4 >& N,
+                 std::size_t& exit );
+
+    //! Pack particles into a single buffer for migration
+    std::vector< tk::real > pack( const std::vector< std::size_t >& idx ) const;
 
     //! Search particle in a single mesh cell
     bool parinel( const std::array< std::vector< tk::real >, 3 >& coord,
@@ -354,6 +438,18 @@ class Tracker {
     //! Remove a set of particles
     void remove( const std::set< std::size_t >& idx );
 
+    //! Request missing particles to be searched by all holder chares
+    //! \param[in] arrayProxy Charm++ array proxy to whose all elements to
+    //!   address our broadcast (this is the proxy that holds us)
+    //! \param[in] chid Charm++ array index (thisIndex of the holder class)
+    template< class ChareArrayProxy >
+    void collect( const ChareArrayProxy& arrayProxy, int chid ) {
+      m_nchpar = 0;
+      std::vector< std::size_t > miss( begin(m_parmiss), end(m_parmiss) );
+      m_parelse.clear();
+      arrayProxy.collectpar( chid, miss, pack(miss) ); // broadcast to everyone
+    }
+
     #if defined(__clang__)
       #pragma clang diagnostic push
       #pragma clang diagnostic ignored "-Wdocumentation"
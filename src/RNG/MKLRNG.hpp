@@ -13,8 +13,11 @@
 #define MKLRNG_h
 
 #include <memory>
+#include <vector>
 #include <mkl_vsl.h>
 
+#include "NoWarning/pup.hpp"
+
 #include "Exception.hpp"
 #include "Keywords.hpp"
 
@@ -27,7 +30,7 @@ class MKLRNG {
 
   public:
     //! Constructor
-    //! \param[in] n Initialize RNG using this many independent streams
+    //! \param[in] n Allocate RNG for this many independent streams
     //! \param[in] brng Index of the basic generator to initialize the stream
     //! \param[in] seed RNG seed
     //! \param[in] uniform_method MKL ID of the method to use for uniform RNGs
@@ -57,24 +60,10 @@ class MKLRNG {
     {
       Assert( n > 0, "Need at least one thread" );
       Assert( brng > 0, "Basic RNG MKL parameter must be positive" );
-      // Allocate array of stream-pointers for threads
+      // Allocate array of stream-pointers for threads, the streams are
+      // created on first use, see stream()
       m_stream = std::make_unique< VSLStreamStatePtr[] >(
                    static_cast<std::size_t>(n) );
-      // Initialize thread-streams for block-splitting. These MKL VSL functions
-      // dynamically allocate memory, so these calls being in a constructor are
-      // a potential memory leak hazard in the presence of exceptions. However,
-      // thankfully, the MKL functions below only emit warnings if they
-      // encounter errors and always continue. As a result, the constructor
-      // finishes, the MKLRNG object gets created, so the destructor will also
-      // get called when leaving scope.
-      if (n == 1)
-        errchk( vslNewStream( &m_stream[0], brng, seed ) );
-      else
-        for (int i=0; i<n; ++i) {
-          auto I = static_cast< std::size_t >( i );
-          errchk( vslNewStream( &m_stream[I], brng, seed ) );
-          errchk( vslLeapfrogStream( m_stream[I], i, n ) );
-        }
     }
 
     //! Destructor
@@ -86,7 +75,7 @@ class MKLRNG {
     //! \param[in,out] r Pointer to memory to write the random numbers to
     void uniform( int tid, ncomp_t num, double* r ) const {
       vdRngUniform( m_uniform_method,
-                    m_stream[ static_cast<std::size_t>(tid) ],
+                    stream( tid ),
                     static_cast< long long >( num ),
                     r,
                     0.0, 1.0 );
@@ -98,7 +87,7 @@ class MKLRNG {
     //! \param[in,out] r Pointer to memory to write the random numbers to
     void gaussian( int tid, ncomp_t num, double* r ) const {
       vdRngGaussian( m_gaussian_method,
-                     m_stream[ static_cast<std::size_t>(tid) ],
+                     stream( tid ),
                      static_cast< long long >( num ),
                      r,
                      0.0, 1.0 );
@@ -119,7 +108,7 @@ class MKLRNG {
       Assert( d > 0,
               "Dimension of multi-variate Gaussian RNGs must be positive" );
       vdRngGaussianMV( m_gaussianmv_method,
-                       m_stream[ static_cast<std::size_t>(tid) ],
+                       stream( tid ),
                        static_cast< long long >( num ),
                        r,
                        static_cast< int >( d ),
@@ -140,7 +129,7 @@ class MKLRNG {
                double* r ) const
     {
       vdRngBeta( m_beta_method,
-                 m_stream[ static_cast<std::size_t>(tid) ],
+                 stream( tid ),
                  static_cast< long long >( num ),
                  r,
                  p, q, a, b );
@@ -155,7 +144,7 @@ class MKLRNG {
     void gamma( int tid, ncomp_t num, double a, double b, double* r ) const
     {
       vdRngGamma( m_beta_method,
-                  m_stream[ static_cast<std::size_t>(tid) ],
+                  stream( tid ),
                   static_cast< long long >( num ),
                   r,
                   a, 0.0, b );  // displacement = 0.0
@@ -173,14 +162,6 @@ class MKLRNG {
       m_nthreads = x.m_nthreads;
       m_stream = std::make_unique< VSLStreamStatePtr[] >(
                    static_cast<std::size_t>(x.m_nthreads) );
-      if (m_nthreads == 1)
-        errchk( vslNewStream( &m_stream[0], x.m_brng, x.m_seed ) );
-      else
-        for (int i=0; i<x.m_nthreads; ++i) {
-          auto I = static_cast< std::size_t >( i );
-          errchk( vslNewStream( &m_stream[I], x.m_brng, x.m_seed ) );
-          errchk( vslLeapfrogStream( m_stream[I], i, x.m_nthreads ) );
-        }
       return *this;
     }
 
@@ -234,7 +215,47 @@ class MKLRNG {
     std::size_t nthreads() const noexcept
     { return static_cast< std::size_t >( m_nthreads); }
 
+    //! Pack/Unpack the state of a stream
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in] tid Thread (or more precisely stream) ID
+    //! \details The stream state is saved to and loaded from memory by MKL
+    //!   VSL. Loading replaces the stream by a new one, continuing where the
+    //!   stream saved left off. A stream not yet used is created for packing.
+    void pupstate( PUP::er& p, int tid ) const {
+      if (!p.isUnpacking()) stream( tid );
+      auto& s = m_stream[ static_cast<std::size_t>(tid) ];
+      int size = p.isUnpacking() ? 0 : vslGetStreamSize( s );
+      p | size;
+      std::vector< char > b( static_cast< std::size_t >( size ) );
+      if (!p.isUnpacking()) errchk( vslSaveStreamM( s, b.data() ) );
+      PUParray( p, b.data(), b.size() );
+      if (p.isUnpacking()) {
+        if (s) errchk( vslDeleteStream( &s ) );
+        errchk( vslLoadStreamM( &s, b.data() ) );
+      }
+    }
+
   private:
+    //! Access a thread stream, creating it on first use
+    //! \param[in] tid Thread (or more precisely stream) ID
+    //! \return MKL VSL stream
+    //! \details A generator is set up with the streams of all threads of all
+    //!   PEs, only a few of which are used by a PE, and creating a stream for
+    //!   block-splitting (leapfrog) allocates memory and skips ahead. Streams
+    //!   are thus only created by their first user, which, as each stream is
+    //!   only used by a single thread, needs no locking and happens in
+    //!   parallel across threads. The MKL VSL functions only emit warnings on
+    //!   errors and always continue, so a stream failed to create leaks no
+    //!   memory.
+    VSLStreamStatePtr stream( int tid ) const {
+      auto& s = m_stream[ static_cast<std::size_t>(tid) ];
+      if (!s) {
+        errchk( vslNewStream( &s, m_brng, m_seed ) );
+        if (m_nthreads > 1) errchk( vslLeapfrogStream( s, tid, m_nthreads ) );
+      }
+      return s;
+    }
+
     //! Delete all thread streams
     void deleteStreams() {
       for (int i=0; i<m_nthreads; ++i) {
@@ -251,7 +272,7 @@ class MKLRNG {
     //! \details This calls ErrChk(), i.e., it is not compiled away in Release
     //!   mode as an error here can result due to user input incompatible with
     //!   the MKL library.
-    void errchk( int err ) {
+    void errchk( int err ) const {
       ErrChk( err == VSL_STATUS_OK, "MKL VSL Error Code: " +
               std::to_string(err) + ", see mkl_vsl_defines.h for more info" );
     }
@@ -20,6 +20,8 @@
 #include <functional>
 #include <memory>
 
+#include "NoWarning/pup.hpp"
+
 #include "Keywords.hpp"
 
 namespace tk {
@@ -81,6 +83,10 @@ class RNG {
     //! Public interface to number of threads accessor
     std::size_t nthreads() const noexcept { return self->nthreads(); }
 
+    //! Public interface to pack/unpack the state of a stream
+    void pupstate( PUP::er& p, int stream ) const
+    { self->pupstate( p, stream ); }
+
     //! Copy assignment
     RNG& operator=( const RNG& x )
     { RNG tmp(x); *this = std::move(tmp); return *this; }
@@ -107,6 +113,7 @@ class RNG {
         const = 0;
       virtual void gamma( int, ncomp_t, double, double, double* ) const = 0;
       virtual std::size_t nthreads() const noexcept = 0;
+      virtual void pupstate( PUP::er&, int ) const = 0;
     };
 
     //! \brief Model models the Concept above by deriving from it and overriding
@@ -129,6 +136,8 @@ class RNG {
       void gamma( int stream, ncomp_t num, double a, double b, double* r ) const
         override { data.gamma( stream, num, a, b, r ); }
       std::size_t nthreads() const noexcept override { return data.nthreads(); }
+      void pupstate( PUP::er& p, int stream ) const override
+      { data.pupstate( p, stream ); }
       T data;
     };
 
@@ -0,0 +1,175 @@
+// *****************************************************************************
+/*!
+  \file      src/RNG/RNGBlock.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Blocks of random numbers generated in bulk
+  \details   Blocks of random numbers generated in bulk. Instead of calling
+    the random number generator for the handful of random numbers required by
+    a single particle, tk::RNGBlock generates a large block of random numbers
+    at a time, from which random numbers are then handed out, one particle at a
+    time, until the block is exhausted. This amortizes the virtual call through
+    tk::RNG and enables the vectorized bulk generators of the underlying
+    libraries. The blocks are persistent and kept separately for each stream,
+    i.e., thread, and distribution. A block is only regenerated when it is
+    exhausted or when explicitly requested by refill(), so the numbers handed
+    out only depend on the sequence of requests of a stream, and are thus
+    reproducible across runs, independent of timing.
+*/
+// *****************************************************************************
+#ifndef RNGBlock_h
+#define RNGBlock_h
+
+#include <vector>
+#include <algorithm>
+#include <initializer_list>
+
+#include "NoWarning/pup.hpp"
+
+#include "Types.hpp"
+#include "Exception.hpp"
+#include "AlignedAllocator.hpp"
+#include "RNG.hpp"
+
+namespace tk {
+
+//! \brief Blocks of uniform and Gaussian random numbers generated in bulk,
+//!   one block per stream and distribution
+class RNGBlock {
+
+  public:
+    //! Constructor
+    //! \param[in] rng Random number generator to generate blocks from
+    //! \param[in] size Number of random numbers generated at a time
+    explicit RNGBlock( const tk::RNG& rng, std::size_t size = 1UL << 14 ) :
+      m_rng( rng ),
+      m_size( size ),
+      m_block( rng.nthreads() ),
+      m_ublock( rng.nthreads() )
+    {
+      Assert( m_size > 0, "Block size must be positive" );
+    }
+
+    //! \brief Hand out the next Gaussian random numbers with zero mean and
+    //!   unit variance
+    //! \param[in] stream Thread (or more precisely stream) ID
+    //! \param[in] num Number of random numbers required
+    //! \return Pointer to num random numbers, valid until the next call with
+    //!   the same stream
+    //! \details A new block of at least num random numbers is generated if
+    //!   the rest of the current block of the stream is not large enough.
+    const tk::real* gaussian( int stream, std::size_t num ) {
+      return next( m_block, stream, num,
+        [&]( std::size_t n, tk::real* r ){ m_rng.gaussian( stream, n, r ); } );
+    }
+
+    //! Hand out the next uniform random numbers in (0,1)
+    //! \param[in] stream Thread (or more precisely stream) ID
+    //! \param[in] num Number of random numbers required
+    //! \return Pointer to num random numbers, valid until the next call with
+    //!   the same stream
+    const tk::real* uniform( int stream, std::size_t num ) {
+      return next( m_ublock, stream, num,
+        [&]( std::size_t n, tk::real* r ){ m_rng.uniform( stream, n, r ); } );
+    }
+
+    //! \brief Discard the random numbers not yet handed out from all blocks of
+    //!   a stream
+    //! \param[in] stream Thread (or more precisely stream) ID
+    //! \details The next request of the stream then generates a new block.
+    //!   This is the hook to synchronize the blocks with the state of the
+    //!   generator, e.g., before the state of the stream is reseeded or
+    //!   packed via tk::RNG::pupstate() without packing this object.
+    void refill( int stream ) {
+      for (auto* blocks : { &m_block, &m_ublock }) {
+        auto& b = (*blocks)[ index( stream ) ];
+        b.r.clear();
+        b.pos = 0;
+      }
+    }
+
+    /** @name Pack/Unpack: Serialize RNGBlock object for Charm++ */
+    ///@{
+    //! \brief Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \details Only the random numbers not yet handed out are packed, so that
+    //!   after unpacking the numbers handed out continue where they left off.
+    //!   The generator is not packed, its state is packed separately, see
+    //!   tk::RNG::pupstate().
+    void pup( PUP::er& p ) {
+      for (auto* blocks : { &m_block, &m_ublock }) {
+        auto nb = blocks->size();
+        p | nb;
+        if (p.isUnpacking()) blocks->resize( nb );
+        for (auto& b : *blocks) {
+          auto n = b.r.size() - b.pos;
+          p | n;
+          if (p.isUnpacking()) {
+            b.r.resize( n );
+            b.pos = 0;
+          }
+          if (n) PUParray( p, b.r.data() + b.pos, n );
+        }
+      }
+    }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] b RNGBlock object reference
+    friend void operator|( PUP::er& p, RNGBlock& b ) { b.pup(p); }
+    ///@}
+
+  private:
+    //! \brief Random numbers generated and the position of the next one to
+    //!   hand out
+    //! \details Aligned to a cache line, since the position is updated by the
+    //!   thread of the stream at every request.
+    struct alignas( tk::DataAlign ) Block {
+      std::vector< tk::real > r;
+      std::size_t pos = 0;
+    };
+
+    const tk::RNG& m_rng;               //!< Random number generator
+    std::size_t m_size;                 //!< Number of numbers per block
+    std::vector< Block > m_block;       //!< Gaussian blocks, one per stream
+    std::vector< Block > m_ublock;      //!< Uniform blocks, one per stream
+
+    //! Compute block index of stream
+    //! \param[in] stream Thread (or more precisely stream) ID
+    //! \return Index of the blocks of the stream
+    std::size_t index( int stream ) const {
+      Assert( stream >= 0 &&
+              static_cast< std::size_t >( stream ) < m_block.size(),
+              "Stream out of range" );
+      return static_cast< std::size_t >( stream );
+    }
+
+    //! Hand out the next random numbers from a block of a stream
+    //! \param[in,out] blocks Blocks of the distribution, one per stream
+    //! \param[in] stream Thread (or more precisely stream) ID
+    //! \param[in] num Number of random numbers required
+    //! \param[in] generate Function called as generate(n,r) to generate n
+    //!   random numbers into r if the rest of the block is not large enough
+    //! \return Pointer to num random numbers
+    template< class Generate >
+    const tk::real* next( std::vector< Block >& blocks,
+                          int stream,
+                          std::size_t num,
+                          Generate&& generate )
+    {
+      auto& b = blocks[ index( stream ) ];
+      if (b.pos + num > b.r.size()) {
+        b.r.resize( std::max( m_size, num ) );
+        generate( b.r.size(), b.r.data() );
+        b.pos = 0;
+      }
+      const auto r = b.r.data() + b.pos;
+      b.pos += num;
+      return r;
+    }
+};
+
+} // tk::
+
+#endif // RNGBlock_h
@@ -16,10 +16,12 @@
 #include <random>
 #include <memory>
 
+#include "NoWarning/pup.hpp"
 #include "NoWarning/beta_distribution.hpp"
 #include <boost/random/gamma_distribution.hpp>
 
 #include "Exception.hpp"
+#include "AlignedAllocator.hpp"
 #include "Macro.hpp"
 #include "Options/RNGSSESeqLen.hpp"
 
@@ -31,24 +33,27 @@ class RNGSSE {
 
   private:
     using InitFn = void (*)( State*, SeqNumType );
+    //! State of a stream and whether it has been initialized
+    struct LazyState : State { bool ready; };
+    //! State of a stream, padded to a cache line to avoid false sharing
+    using Stream = tk::CacheLinePadded< LazyState >;
     using ncomp_t = kw::ncomp::info::expect::type;    
 
     //! Adaptor to use a std distribution with the RNGSSE generator
     //! \see C++ concepts: UniformRandomNumberGenerator
     struct Adaptor {
       using result_type = unsigned int;
-      Adaptor( const std::unique_ptr< State[] >& s, int t ) : str(s), tid(t) {}
+      explicit Adaptor( State* s ) : str(s) {}
       static constexpr result_type min() { return 0u; }
       static constexpr result_type max() { return 4294967295u; }
       result_type operator()()
-      { return Generate( &str[ static_cast<std::size_t>(tid) ] ); }
-      const std::unique_ptr< State[] >& str;
-      int tid;
+      { return Generate( str ); }
+      State* str;
     };
 
   public:
     //! Constructor
-    //! \param[in] n Initialize RNG using this many independent streams
+    //! \param[in] n Allocate RNG for this many independent streams
     //! \param[in] fnShort RNG initializer function for short streams
     //! \param[in] seqlen Sequence length enum: short, medium or long
     //! \param[in] fnLong RNG initializer function for long streams
@@ -65,10 +70,8 @@ class RNGSSE {
     {
       Assert( m_init != nullptr, "nullptr passed to RNGSSE constructor" );
       Assert( n > 0, "Need at least one thread" );
-      // Allocate array of stream-pointers for threads
-      m_stream = std::make_unique< State[] >( n );
-      // Initialize thread-streams
-      for (SeqNumType i=0; i<n; ++i) m_init( &m_stream[i], i );
+      // Allocate array of streams for threads, initialized on first use
+      m_stream = std::make_unique< Stream[] >( n );
     }
 
     //! Uniform RNG: Generate uniform random numbers
@@ -76,10 +79,9 @@ class RNGSSE {
     //! \param[in] num Number of RNGs to generate
     //! \param[in,out] r Pointer to memory to write the random numbers to
     void uniform( int tid, ncomp_t num, double* r ) const {
+      auto s = state( tid );
       for (ncomp_t i=0; i<num; ++i)
-        r[i] = static_cast<double>(
-                 Generate( &m_stream[ static_cast<std::size_t>(tid) ] ) )
-               / 4294967296.0;
+        r[i] = static_cast<double>( Generate( s ) ) / 4294967296.0;
     }
 
     //! Gaussian RNG: Generate Gaussian random numbers
@@ -100,7 +102,7 @@ class RNGSSE {
     //!   cache, as Box-Muller, implemented using the polar algorithm generates
     //!   2 Gaussian numbers for each pair of uniform ones, caching every 2nd.
     void gaussian( int tid, ncomp_t num, double* r ) const {
-      Adaptor generator( m_stream, tid );
+      Adaptor generator( state( tid ) );
       std::normal_distribution<> gauss_dist( 0.0, 1.0 );
       for (ncomp_t i=0; i<num; ++i) r[i] = gauss_dist( generator );
     }
@@ -142,7 +144,7 @@ class RNGSSE {
     //!   only known here) must be stored in the adaptor functor's state.
     void beta( int tid, ncomp_t num, double p, double q, double a, double b,
                double* r ) const {
-      Adaptor generator( m_stream, tid );
+      Adaptor generator( state( tid ) );
       boost::random::beta_distribution<> beta_dist( p, q );
       for (ncomp_t i=0; i<num; ++i) r[i] = beta_dist( generator ) * b + a;
     }
@@ -162,7 +164,7 @@ class RNGSSE {
     //!   with no arguments, thus the RNG state and the thread ID (this latter
     //!   only known here) must be stored in the adaptor functor's state.
     void gamma( int tid, ncomp_t num, double a, double b, double* r ) const {
-      Adaptor generator( m_stream, tid );
+      Adaptor generator( state( tid ) );
       boost::random::gamma_distribution<> gamma_dist( a, b );
       for (ncomp_t i=0; i<num; ++i) r[i] = gamma_dist( generator );
     }
@@ -171,8 +173,7 @@ class RNGSSE {
     RNGSSE& operator=( const RNGSSE& x ) {
       m_nthreads = x.m_nthreads;
       m_init = x.m_init;
-      m_stream = std::make_unique< State[] >( x.m_nthreads );
-      for (SeqNumType i=0; i<x.m_nthreads; ++i) m_init( &m_stream[i], i );
+      m_stream = std::make_unique< Stream[] >( x.m_nthreads );
       return *this;
     }
 
@@ -183,7 +184,7 @@ class RNGSSE {
     RNGSSE& operator=( RNGSSE&& x ) {
       m_nthreads = x.m_nthreads;
       m_init = x.m_init;
-      m_stream = std::make_unique< State[] >( x.m_nthreads );
+      m_stream = std::make_unique< Stream[] >( x.m_nthreads );
       for (SeqNumType i=0; i<x.m_nthreads; ++i) {
         m_stream[i] = x.m_stream[i];
         std::memset( &x.m_stream[i], 0, sizeof(x.m_stream[i]) );
@@ -204,10 +205,41 @@ class RNGSSE {
     //! Accessor to the number of threads we operate on
     SeqNumType nthreads() const noexcept { return m_nthreads; }
 
+    //! Pack/Unpack the state of a stream
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in] tid Thread (or more precisely stream) ID
+    //! \details The RNGSSE generator states are plain structs, packed as
+    //!   raw bytes. A stream not yet used is initialized before packing.
+    void pupstate( PUP::er& p, int tid ) const {
+      auto& s = m_stream[ static_cast<std::size_t>(tid) ];
+      if (!p.isUnpacking()) state( tid );
+      p( reinterpret_cast< char* >( static_cast< State* >( &s ) ),
+         sizeof(State) );
+      if (p.isUnpacking()) s.ready = true;
+    }
+
   private:
+    //! Access the state of a stream, initializing it on first use
+    //! \param[in] tid Thread (or more precisely stream) ID
+    //! \return Pointer to the state of the stream
+    //! \details Seeding a stream, especially of the long sequences, takes
+    //!   much longer than generating a number, and a generator is set up with
+    //!   the streams of all threads of all PEs, only a few of which are used
+    //!   by a PE. Streams are thus only initialized by their first user. As
+    //!   each stream is only used by a single thread, this needs no locking,
+    //!   and the threads initialize their streams in parallel.
+    State* state( int tid ) const {
+      auto& s = m_stream[ static_cast<std::size_t>(tid) ];
+      if (!s.ready) {
+        m_init( &s, static_cast< SeqNumType >( tid ) );
+        s.ready = true;
+      }
+      return &s;
+    }
+
     SeqNumType m_nthreads;                 //!< Number of threads
     InitFn m_init;                         //!< Sequence length initializer
-    std::unique_ptr< State[] > m_stream;   //!< Random number stream for threads
+    std::unique_ptr< Stream[] > m_stream;  //!< Random number stream for threads
 };
 
 } // tk::
@@ -29,6 +29,7 @@
 #include "RNGSSE.hpp"
 #include "Options/RNGSSESeqLen.hpp"
 #include "Random123.hpp"
+#include "Ziggurat.hpp"
 #include "QuinoaConfig.hpp"
 
 #ifdef HAS_RNGSSE2
@@ -56,6 +57,32 @@
 
 using tk::RNGStack;
 
+namespace {
+
+//! \brief Register a random number generator into factory with the Gaussian
+//!   transform selected
+//! \param[in,out] f Random number generator factory to register into
+//! \param[in] rng RNG key to register
+//! \param[in] transform Gaussian transform to use
+//! \param[in] args Random number generator constructor arguments
+//! \details If the ziggurat method is selected, the generator is wrapped in
+//!   tk::Ziggurat, which generates Gaussian numbers from its uniform ones.
+template< class Model, typename... ModelConstrArgs >
+void regModel( tk::RNGFactory& f,
+               tk::ctr::RNGType rng,
+               tk::ctr::GaussianTransformType transform,
+               ModelConstrArgs&&... args )
+{
+  if (transform == tk::ctr::GaussianTransformType::ZIGGURAT)
+    tk::recordModel< tk::RNG, tk::Ziggurat< Model > >
+                   ( f, rng, std::forward< ModelConstrArgs >( args )... );
+  else
+    tk::recordModel< tk::RNG, Model >
+                   ( f, rng, std::forward< ModelConstrArgs >( args )... );
+}
+
+} // ::
+
 RNGStack::RNGStack(
                     #ifdef HAS_MKL
                     const tk::ctr::RNGMKLParameters& mklparam,
@@ -63,7 +90,8 @@ RNGStack::RNGStack(
                     #ifdef HAS_RNGSSE2
                     const tk::ctr::RNGSSEParameters& rngsseparam,
                     #endif
-                    const tk::ctr::RNGRandom123Parameters& r123param )
+                    const tk::ctr::RNGRandom123Parameters& r123param,
+                    std::size_t nstream )
  : m_factory()
 // *****************************************************************************
 //  Constructor: register generators into factory for each supported library
@@ -71,15 +99,18 @@ RNGStack::RNGStack(
 //! \param[in] rngsseparam RNGSSE RNG parameters to use to configure RNGSSE RNGs
 //! \param[in] r123param Random123 RNG parameters to use to configure
 //!   Random123 RNGs
+//! \param[in] nstream Total number of independent streams, i.e., across all
+//!   PEs, of each generator
 // *****************************************************************************
 {
+  const auto n = static_cast< int >( nstream );
   #ifdef HAS_MKL
-  regMKL( CkNumPes(), mklparam );
+  regMKL( n, mklparam );
   #endif
   #ifdef HAS_RNGSSE2
-  regRNGSSE( CkNumPes(), rngsseparam );
+  regRNGSSE( n, rngsseparam );
   #endif
-  regRandom123( CkNumPes(), r123param );
+  regRandom123( n, r123param );
 }
 
 std::map< tk::ctr::RawRNGType, tk::RNG >
@@ -122,6 +153,7 @@ RNGStack::regMKL( int nstreams, const tk::ctr::RNGMKLParameters& param )
   using tk::ctr::MKLGaussianMVMethodType;
   using tk::ctr::MKLBetaMethodType;
   using tk::ctr::MKLGammaMethodType;
+  using tk::ctr::GaussianTransformType;
   using tag::uniform_method;
   using tag::gaussian_method;
   using tag::gaussianmv_method;
@@ -135,6 +167,7 @@ RNGStack::regMKL( int nstreams, const tk::ctr::RNGMKLParameters& param )
   MKLGaussianMVMethodType gmv_def = MKLGaussianMVMethodType::BOXMULLER;
   MKLBetaMethodType b_def = MKLBetaMethodType::CJA;
   MKLGammaMethodType ga_def = MKLGammaMethodType::GNORM;
+  GaussianTransformType t_def = GaussianTransformType::LIBRARY;
 
   tk::ctr::RNG opt;
   tk::ctr::MKLUniformMethod um_opt;
@@ -145,8 +178,9 @@ RNGStack::regMKL( int nstreams, const tk::ctr::RNGMKLParameters& param )
 
   //! Lambda to register a MKL random number generator into factory
   auto regMKLRNG = [&]( RNGType rng ) {
-    recordModel< tk::RNG, tk::MKLRNG >
+    regModel< tk::MKLRNG >
       ( m_factory, rng,
+        opt.param< tag::gaussian_transform >( rng, t_def, param ),
         nstreams,
         opt.param( rng ),
         opt.param< tag::seed >( rng, s_def, param ),
@@ -190,94 +224,104 @@ RNGStack::regRNGSSE( int nstreams, const tk::ctr::RNGSSEParameters& param )
 //! \param[in] param RNGSSE RNG parameters to use to configure the RNGs
 // *****************************************************************************
 {
-  using tk::RNG;
   using tk::RNGSSE;
   using tk::ctr::RNGType;
   using tk::ctr::RNGSSESeqLenType;
+  using tk::ctr::GaussianTransformType;
   using tag::seqlen;
+  using tag::gaussian_transform;
 
   tk::ctr::RNG opt;
 
   // Defaults for RNGSSE RNGs
   RNGSSESeqLenType l_def = RNGSSESeqLenType::SHORT;
+  GaussianTransformType t_def = GaussianTransformType::LIBRARY;
 
   // Register RNGSSE RNGs
-  recordModel< RNG, RNGSSE< gm19_state, unsigned, gm19_generate_ > >
+  regModel< RNGSSE< gm19_state, unsigned, gm19_generate_ > >
     ( m_factory, RNGType::RNGSSE_GM19,
+      opt.param< gaussian_transform >( RNGType::RNGSSE_GM19, t_def, param ),
       nstreams,
       &gm19_init_sequence_ );
 
-  recordModel< RNG, RNGSSE< gm29_state, unsigned, &gm29_generate_ > >
+  regModel< RNGSSE< gm29_state, unsigned, &gm29_generate_ > >
     ( m_factory, RNGType::RNGSSE_GM29,
+      opt.param< gaussian_transform >( RNGType::RNGSSE_GM29, t_def, param ),
       nstreams,
       &gm29_init_short_sequence_,
       opt.param< seqlen >( RNGType::RNGSSE_GM29, l_def, param ),
       &gm29_init_long_sequence_,
       &gm29_init_medium_sequence_ );
 
-  recordModel< RNG, RNGSSE< gm31_state, unsigned, gm31_generate_ > >
+  regModel< RNGSSE< gm31_state, unsigned, gm31_generate_ > >
     ( m_factory, RNGType::RNGSSE_GM31,
+      opt.param< gaussian_transform >( RNGType::RNGSSE_GM31, t_def, param ),
       nstreams,
       &gm31_init_short_sequence_,
       opt.param< seqlen >( RNGType::RNGSSE_GM31, l_def, param ),
       &gm31_init_long_sequence_,
       &gm31_init_medium_sequence_ );
 
-  recordModel< RNG, RNGSSE< gm55_state, unsigned long long, gm55_generate_ > >
+  regModel< RNGSSE< gm55_state, unsigned long long, gm55_generate_ > >
     ( m_factory, RNGType::RNGSSE_GM55,
+      opt.param< gaussian_transform >( RNGType::RNGSSE_GM55, t_def, param ),
       nstreams,
       &gm55_init_short_sequence_,
       opt.param< seqlen >( RNGType::RNGSSE_GM55, l_def, param ),
       &gm55_init_long_sequence_ );
 
-  recordModel< RNG, RNGSSE< gm61_state, unsigned long long, gm61_generate_ > >
+  regModel< RNGSSE< gm61_state, unsigned long long, gm61_generate_ > >
     ( m_factory, RNGType::RNGSSE_GM61,
+      opt.param< gaussian_transform >( RNGType::RNGSSE_GM61, t_def, param ),
       nstreams,
       &gm61_init_sequence_,
       opt.param< seqlen >( RNGType::RNGSSE_GM61, l_def, param ),
       &gm61_init_long_sequence_ );
 
-  recordModel< RNG, RNGSSE< gq58x1_state, unsigned, gq58x1_generate_ > >
+  regModel< RNGSSE< gq58x1_state, unsigned, gq58x1_generate_ > >
     ( m_factory, RNGType::RNGSSE_GQ581,
+      opt.param< gaussian_transform >( RNGType::RNGSSE_GQ581, t_def, param ),
       nstreams,
       &gq58x1_init_short_sequence_,
       opt.param< seqlen >( RNGType::RNGSSE_GQ581, l_def, param ),
       &gq58x1_init_long_sequence_,
       &gq58x1_init_medium_sequence_ );
 
-  recordModel< RNG, RNGSSE< gq58x3_state, unsigned, gq58x3_generate_ > >
+  regModel< RNGSSE< gq58x3_state, unsigned, gq58x3_generate_ > >
     ( m_factory, RNGType::RNGSSE_GQ583,
+      opt.param< gaussian_transform >( RNGType::RNGSSE_GQ583, t_def, param ),
       nstreams,
       &gq58x3_init_short_sequence_,
       opt.param< seqlen >( RNGType::RNGSSE_GQ583, l_def, param ),
       &gq58x3_init_long_sequence_,
       &gq58x3_init_medium_sequence_ );
 
-  recordModel< RNG, RNGSSE< gq58x4_state, unsigned, gq58x4_generate_ > >
+  regModel< RNGSSE< gq58x4_state, unsigned, gq58x4_generate_ > >
     ( m_factory, RNGType::RNGSSE_GQ584,
+      opt.param< gaussian_transform >( RNGType::RNGSSE_GQ584, t_def, param ),
       nstreams,
       &gq58x4_init_short_sequence_,
       opt.param< seqlen >( RNGType::RNGSSE_GQ584, l_def, param ),
       &gq58x4_init_long_sequence_,
       &gq58x4_init_medium_sequence_ );
 
-  recordModel< RNG,
-               RNGSSE< mt19937_state, unsigned long long, mt19937_generate_ > >
+  regModel< RNGSSE< mt19937_state, unsigned long long, mt19937_generate_ > >
     ( m_factory, RNGType::RNGSSE_MT19937,
+      opt.param< gaussian_transform >( RNGType::RNGSSE_MT19937, t_def, param ),
       nstreams,
       &mt19937_init_sequence_ );
 
-  recordModel< RNG,
-               RNGSSE< lfsr113_state, unsigned long long, lfsr113_generate_ > >
+  regModel< RNGSSE< lfsr113_state, unsigned long long, lfsr113_generate_ > >
     ( m_factory, RNGType::RNGSSE_LFSR113,
+      opt.param< gaussian_transform >( RNGType::RNGSSE_LFSR113, t_def, param ),
       nstreams,
       &lfsr113_init_sequence_,
       opt.param< seqlen >( RNGType::RNGSSE_LFSR113, l_def, param ),
       &lfsr113_init_long_sequence_ );
 
-  recordModel< RNG,
-               RNGSSE<mrg32k3a_state, unsigned long long, mrg32k3a_generate_> >
+  regModel< RNGSSE<mrg32k3a_state, unsigned long long, mrg32k3a_generate_> >
     ( m_factory, RNGType::RNGSSE_MRG32K3A,
+      opt.param< gaussian_transform >( RNGType::RNGSSE_MRG32K3A, t_def, param ),
       nstreams,
       &mrg32k3a_init_sequence_ );
 }
@@ -301,19 +345,25 @@ RNGStack::regRandom123( int nstreams,
 {
   using tk::ctr::RNGType;
 
-  // Defaults for MKL RNGs
+  // Defaults for Random123 RNGs
   uint32_t s_def = 0;
+  tk::ctr::GaussianTransformType t_def =
+    tk::ctr::GaussianTransformType::LIBRARY;
 
   tk::ctr::RNG opt;
 
   // Register Random123 RNGs
-  recordModel< tk::RNG, tk::Random123< r123::Threefry2x64 > >
-             ( m_factory, RNGType::R123_THREEFRY,
-               nstreams,
-               opt.param< tag::seed >( RNGType::R123_THREEFRY, s_def, param ) );
-
-  recordModel< tk::RNG, tk::Random123< r123::Philox2x64 > >
-             ( m_factory, RNGType::R123_PHILOX,
-               nstreams,
-               opt.param< tag::seed >( RNGType::R123_PHILOX, s_def, param ) );
+  regModel< tk::Random123< r123::Threefry2x64 > >
+           ( m_factory, RNGType::R123_THREEFRY,
+             opt.param< tag::gaussian_transform >
+                      ( RNGType::R123_THREEFRY, t_def, param ),
+             nstreams,
+             opt.param< tag::seed >( RNGType::R123_THREEFRY, s_def, param ) );
+
+  regModel< tk::Random123< r123::Philox2x64 > >
+           ( m_factory, RNGType::R123_PHILOX,
+             opt.param< tag::gaussian_transform >
+                      ( RNGType::R123_PHILOX, t_def, param ),
+             nstreams,
+             opt.param< tag::seed >( RNGType::R123_PHILOX, s_def, param ) );
 }
@@ -44,7 +44,8 @@ class RNGStack {
                        #ifdef HAS_RNGSSE2
                        const ctr::RNGSSEParameters& rngsseparam,
                        #endif
-                       const ctr::RNGRandom123Parameters& r123param );
+                       const ctr::RNGRandom123Parameters& r123param,
+                       std::size_t nstream = 1 );
 
     //! Instantiate selected RNGs
     std::map< std::underlying_type< tk::ctr::RNGType >::type, tk::RNG >
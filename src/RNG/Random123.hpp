@@ -6,25 +6,34 @@
              2019-2020 Triad National Security, LLC.
              All rights reserved. See the LICENSE file for details.
   \brief     Interface to Random123 random number generators
-  \details   Interface to Random123 random number generators
+  \details   Interface to Random123 random number generators. Random numbers
+    are generated in bulk: all words of each block generated from a counter
+    are used, the key is assembled once per call, and multiple counters are
+    generated per loop iteration, which allows the compiler to interleave the
+    rounds of independent blocks. Gaussian random numbers are transformed from
+    uniform ones in bulk by the Box-Muller transform.
 */
 // *****************************************************************************
 #ifndef Random123_h
 #define Random123_h
 
 #include <cstring>
+#include <cmath>
 #include <random>
 #include <limits>
 #include <array>
 #include <cfenv>
 
+#include "NoWarning/pup.hpp"
 #include "NoWarning/uniform.hpp"
 #include "NoWarning/beta_distribution.hpp"
 #include <boost/random/gamma_distribution.hpp>
 
 #include "Exception.hpp"
+#include "AlignedAllocator.hpp"
 #include "Keywords.hpp"
 #include "Macro.hpp"
+#include "ISA.hpp"
 
 namespace tk {
 
@@ -38,32 +47,50 @@ class Random123 {
     using ctr_type = typename CBRNG::ctr_type;
     using key_type = typename CBRNG::key_type;
     using value_type = typename CBRNG::ctr_type::value_type;
-    using arg_type = std::vector< std::array< value_type, CBRNG_DATA_SIZE > >;
+    //! \brief Counters and keys of streams, each padded to a cache line to
+    //!   avoid false sharing between threads generating from neighboring
+    //!   streams
+    using arg_type = std::vector<
+      tk::CacheLinePadded< std::array< value_type, CBRNG_DATA_SIZE > > >;
+
+    //! Number of words generated from a counter
+    static constexpr std::size_t nword = ctr_type::static_size;
+    //! Number of counters generated per loop iteration in bulk generation
+    static constexpr std::size_t nbatch = 4;
 
     //! Adaptor to use a std distribution with the Random123 generator
+    //! \details All words of a block are handed out before the next counter
+    //!   is generated. Words left over at destruction are discarded.
     //! \see C++ concepts: UniformRandomNumberGenerator
     struct Adaptor {
       using result_type = unsigned long;
-      Adaptor( CBRNG& r, arg_type& d, int t ) : rng(r), data(d), tid(t) {}
+      Adaptor( CBRNG& r, arg_type& d, int t ) :
+        rng( r ),
+        data( d[ static_cast< std::size_t >( t ) ] ),
+        key( {{ static_cast< value_type >( t ) }} ),
+        res(),
+        next( nword ) { data[2] = static_cast< value_type >( t ); }
       static constexpr result_type min() { return 0u; }
       static constexpr result_type max() {
         return std::numeric_limits< result_type >::max();
       }
       result_type operator()()
       {
-        auto& d = data[ static_cast< std::size_t >( tid ) ];
-        d[2] = static_cast< result_type >( tid );
-        ctr_type ctr = {{ d[0], d[1] }};      // assemble counter
-        key_type key = {{ d[2] }};            // assemble key
-        auto res = rng( ctr, key );           // generate
-        ctr.incr();
-        d[0] = ctr[0];
-        d[1] = ctr[1];
-        return res[0];
+        if (next == nword) {
+          ctr_type ctr = {{ data[0], data[1] }};      // assemble counter
+          res = rng( ctr, key );                      // generate
+          ctr.incr();
+          data[0] = ctr[0];
+          data[1] = ctr[1];
+          next = 0;
+        }
+        return res[ next++ ];
       }
       CBRNG& rng;
-      arg_type& data;
-      int tid;
+      typename arg_type::value_type& data;
+      key_type key;
+      ctr_type res;
+      std::size_t next;
     };
 
   public:
@@ -79,41 +106,58 @@ class Random123 {
     //! \param[in] tid Thread (or more precisely) stream ID
     //! \param[in] num Number of RNGs to generate
     //! \param[in,out] r Pointer to memory to write the random numbers to
-    void uniform( int tid, ncomp_t num, double* r ) const {
+    //! \details All words of each block generated from a counter are used,
+    //!   and nbatch counters are generated per iteration. The words of the
+    //!   last block not fitting into r are discarded, so the state of the
+    //!   stream only depends on the number of blocks generated.
+    TK_MULTIVERSION void uniform( int tid, ncomp_t num, double* r ) const {
       auto& d = m_data[ static_cast< std::size_t >( tid ) ];
-      for (ncomp_t i=0; i<num; ++i) {
-        d[2] = static_cast< unsigned long >( tid );
-        ctr_type ctr = {{ d[0], d[1] }};      // assemble counter
-        key_type key = {{ d[2] }};            // assemble key
-        auto res = m_rng( ctr, key );         // generate
-        r[i] = r123::u01fixedpt< double, value_type >( res[0] );
+      d[2] = static_cast< value_type >( tid );
+      const key_type key = {{ d[2] }};            // assemble key
+      ctr_type ctr = {{ d[0], d[1] }};            // assemble counter
+      ncomp_t i = 0;
+      for (; i + nbatch*nword <= num; i += nbatch*nword) {
+        std::array< ctr_type, nbatch > res;
+        for (std::size_t b=0; b<nbatch; ++b) {
+          res[b] = m_rng( ctr, key );             // generate
+          ctr.incr();
+        }
+        for (std::size_t b=0; b<nbatch; ++b)
+          for (std::size_t w=0; w<nword; ++w)
+            r[ i + b*nword + w ] =
+              r123::u01fixedpt< double, value_type >( res[b][w] );
+      }
+      for (; i < num; i += nword) {
+        auto res = m_rng( ctr, key );             // generate
         ctr.incr();
-        d[0] = ctr[0];
-        d[1] = ctr[1];
+        for (std::size_t w=0; w<nword && i+w<num; ++w)
+          r[ i + w ] = r123::u01fixedpt< double, value_type >( res[w] );
       }
+      d[0] = ctr[0];
+      d[1] = ctr[1];
     }
 
     //! Gaussian RNG: Generate Gaussian random numbers
     //! \param[in] tid Thread (or more precisely stream) ID
     //! \param[in] num Number of RNGs to generate
     //! \param[in,out] r Pointer to memory to write the random numbers to
-    //! \details Generating Gaussian random numbers is implemented via an
-    //!   adaptor, modeling std::UniformRandomNumberGenerator, outsourcing the
-    //!   transformation of uniform random numbers to Gaussian ones, to the
-    //!   standard library. The adaptor is instantiated here because a standard
-    //!   distribution, such as e.g., std::normal_distribution, generates
-    //!   numbers using operator() with no arguments, thus the RNG state and the
-    //!   thread ID (this latter only known here) must be stored in the adaptor
-    //!   functor's state. Even though creating the adaptor seems like a
-    //!   potentially costly operation for every call, using the standard
-    //!   library implementation is still faster than a hand-coded
-    //!   implementation of the Box-Muller algorithm. Note that libc++ uses a
-    //!   cache, as Box-Muller, implemented using the polar algorithm generates
-    //!   2 Gaussian numbers for each pair of uniform ones, caching every 2nd.
-    void gaussian( int tid, ncomp_t num, double* r ) const {
-      Adaptor generator( m_rng, m_data, tid );
-      std::normal_distribution<> gauss_dist( 0.0, 1.0 );
-      for (ncomp_t i=0; i<num; ++i) r[i] = gauss_dist( generator );
+    //! \details Uniform random numbers are generated in bulk into r, then
+    //!   transformed pairwise in place to Gaussian ones by the Box-Muller
+    //!   transform. As opposed to the polar (rejection) algorithm, used by
+    //!   std::normal_distribution, the transform has no branches, thus its
+    //!   loop can be vectorized. The uniform numbers are in the open interval
+    //!   (0,1), so their logarithm is finite. If num is odd, the last number
+    //!   is the first of an extra pair.
+    TK_MULTIVERSION void gaussian( int tid, ncomp_t num, double* r ) const {
+      const auto n = num / 2 * 2;
+      uniform( tid, n, r );
+      boxmuller( n, r );
+      if (n < num) {
+        double u[2];
+        uniform( tid, 2, u );
+        boxmuller( 2, u );
+        r[n] = u[0];
+      }
     }
 
     //! \brief Multi-variate Gaussian RNG: Generate multi-variate Gaussian
@@ -189,7 +233,31 @@ class Random123 {
     //! Accessor to the number of threads we operate on
     uint64_t nthreads() const noexcept { return m_data.size(); }
 
+    //! Pack/Unpack the state of a stream
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in] tid Thread (or more precisely stream) ID
+    //! \details The state of a stream is its counter, restoring which the
+    //!   stream continues with the same random numbers.
+    void pupstate( PUP::er& p, int tid ) const {
+      auto& d = m_data[ static_cast< std::size_t >( tid ) ];
+      PUParray( p, d.data(), d.size() );
+    }
+
   private:
+    //! Transform pairs of uniform random numbers to Gaussian ones in place
+    //! \param[in] num Number of random numbers to transform, even
+    //! \param[in,out] r Uniform random numbers in (0,1) on input, Gaussian
+    //!   random numbers with zero mean and unit variance on output
+    static void boxmuller( ncomp_t num, double* r ) {
+      const double twopi = 8.0 * std::atan( 1.0 );
+      for (ncomp_t i=0; i<num; i+=2) {
+        const auto rad = std::sqrt( -2.0 * std::log( r[i] ) );
+        const auto phi = twopi * r[i+1];
+        r[i] = rad * std::cos( phi );
+        r[i+1] = rad * std::sin( phi );
+      }
+    }
+
     mutable CBRNG m_rng;        //!< Random123 RNG object
     mutable arg_type m_data;    //!< RNG arguments
 };
@@ -0,0 +1,137 @@
+// *****************************************************************************
+/*!
+  \file      src/RNG/Ziggurat.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Library-independent Gaussian transform using the ziggurat method
+  \details   Library-independent Gaussian transform using the ziggurat method.
+    tk::Ziggurat wraps a random number generator of any library and replaces
+    its Gaussian generator by the ziggurat method of Marsaglia and Tsang,
+    https://doi.org/10.18637/jss.v005.i08, in the formulation of Doornik,
+    "An Improved Ziggurat Method to Generate Normal Random Samples", 2005,
+    which does not depend on the number of bits of the integers generated.
+    The uniform random numbers the transform consumes are generated in bulk by
+    the wrapped generator, so the Gaussian throughput is about the same,
+    whatever library generates them.
+*/
+// *****************************************************************************
+#ifndef Ziggurat_h
+#define Ziggurat_h
+
+#include <array>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+#include "Keywords.hpp"
+
+namespace tk {
+
+//! \brief Random number generator whose Gaussian random numbers are generated
+//!   by the ziggurat method from the uniform ones of another generator
+//! \details Engine is a random number generator modeling tk::RNG's concept.
+//!   All its constructors and all its member functions, except gaussian(), are
+//!   inherited unchanged.
+template< class Engine >
+class Ziggurat : public Engine {
+
+  private:
+    using ncomp_t = kw::ncomp::info::expect::type;
+
+    //! Number of layers of the ziggurat
+    static constexpr std::size_t N = 128;
+    //! Start of the tail, i.e., right edge of the base layer
+    static constexpr double R = 3.442619855899;
+    //! Area of each layer
+    static constexpr double V = 9.91256303526217e-3;
+
+    //! Layers of the ziggurat
+    struct Layers {
+      std::array< double, N+1 > x;  //!< Right edges of layers
+      std::array< double, N > r;    //!< Ratio of right edges of layers
+      Layers() {
+        auto f = std::exp( -0.5 * R * R );
+        x[0] = V / f;    // base layer including the tail, as if rectangular
+        x[1] = R;
+        x[N] = 0.0;
+        for (std::size_t i=2; i<N; ++i) {
+          x[i] = std::sqrt( -2.0 * std::log( V / x[i-1] + f ) );
+          f = std::exp( -0.5 * x[i] * x[i] );
+        }
+        for (std::size_t i=0; i<N; ++i) r[i] = x[i+1] / x[i];
+      }
+    };
+
+    //! Access layers of the ziggurat, set up on first use
+    //! \return Layers of the ziggurat
+    static const Layers& layers() {
+      static const Layers l;
+      return l;
+    }
+
+  public:
+    using Engine::Engine;
+
+    //! Gaussian RNG: Generate Gaussian random numbers by the ziggurat method
+    //! \param[in] stream Thread (or more precisely stream) ID
+    //! \param[in] num Number of RNGs to generate
+    //! \param[in,out] r Pointer to memory to write the random numbers to
+    //! \details Each number takes two uniform random numbers, one selecting a
+    //!   layer and one the position in it, unless it falls outside the
+    //!   rectangular core of the layer, which happens for about 1.2% of the
+    //!   numbers and takes additional ones. The two uniform numbers per
+    //!   Gaussian are generated at once, the additional ones in smaller bulks
+    //!   when the first ones are exhausted.
+    void gaussian( int stream, ncomp_t num, double* r ) const {
+      const auto& z = layers();
+      std::vector< double > u( 2*num );
+      std::size_t k = 0;
+      this->uniform( stream, u.size(), u.data() );
+
+      // Hand out the next uniform random number, generating more if needed
+      auto next = [&]() {
+        if (k == u.size()) {
+          u.resize( std::max< std::size_t >( 64, u.size()/32 ) );
+          this->uniform( stream, u.size(), u.data() );
+          k = 0;
+        }
+        return u[k++];
+      };
+
+      for (ncomp_t n=0; n<num; ++n) {
+        for (;;) {
+          const auto v = 2.0*next() - 1.0;
+          const auto i = std::min( N-1, static_cast<std::size_t>( next()*N ) );
+          if (std::abs(v) < z.r[i]) { r[n] = v * z.x[i]; break; }
+          if (i == 0) { r[n] = tail( next, v < 0.0 ); break; }
+          const auto x = v * z.x[i];
+          const auto f0 = std::exp( -0.5 * (z.x[i]*z.x[i] - x*x) );
+          const auto f1 = std::exp( -0.5 * (z.x[i+1]*z.x[i+1] - x*x) );
+          if (f1 + next()*(f0 - f1) < 1.0) { r[n] = x; break; }
+        }
+      }
+    }
+
+  private:
+    //! Generate a Gaussian random number from the tail beyond R
+    //! \param[in] next Function returning the next uniform random number
+    //! \param[in] negative True to generate from the negative tail
+    //! \return Gaussian random number from the tail
+    //! \details The uniform random numbers are in [0,1), so their complement
+    //!   is taken before taking their logarithm.
+    template< class Next >
+    static double tail( Next& next, bool negative ) {
+      double x, y;
+      do {
+        x = std::log( 1.0 - next() ) / R;
+        y = std::log( 1.0 - next() );
+      } while (-2.0*y < x*x);
+      return negative ? x - R : R - x;
+    }
+};
+
+} // tk::
+
+#endif // Ziggurat_h
@@ -0,0 +1,221 @@
+// *****************************************************************************
+/*!
+  \file      src/RNGTest/Benchmark.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Random number generator throughput benchmark
+  \details   This file defines the random number generator throughput
+    benchmark, which measures the number of random numbers generated per second
+    per core by any supported random number generator, called through the
+    tk::RNG interface, for all distributions, a range of batch sizes, and
+    thread counts.
+*/
+// *****************************************************************************
+
+#include <string>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+
+#ifdef _OPENMP
+  #include <omp.h>
+#endif
+
+#include "Benchmark.hpp"
+#include "Timer.hpp"
+#include "Exception.hpp"
+#include "RNGStack.hpp"
+#include "RNGTest/Options/Battery.hpp"
+#include "NoWarning/rngtest.decl.h"
+#include "QuinoaConfig.hpp"
+
+extern CProxy_Main mainProxy;
+
+namespace rngtest {
+
+//! Number of random numbers generated per thread for a single measurement
+static const std::size_t s_nnum = 1UL << 22;
+
+//! Batch sizes, i.e., number of random numbers requested in a single call
+static const std::vector< std::size_t > s_batch{ 1, 16, 256, 4096 };
+
+//! Dimension of the multi-variate Gaussian
+static const std::size_t s_dim = 3;
+
+//! Maximum number of threads used for measurements
+//! \return Maximum number of OpenMP threads, 1 if OpenMP is not enabled
+static std::size_t maxthreads() {
+  #ifdef _OPENMP
+  return static_cast< std::size_t >( omp_get_max_threads() );
+  #else
+  return 1;
+  #endif
+}
+
+} // rngtest::
+
+using rngtest::Benchmark;
+
+Benchmark::Benchmark() : m_ncomplete( 0 ), m_time()
+// *****************************************************************************
+// Constructor
+// *****************************************************************************
+{
+  const auto& rngs = g_inputdeck.get< tag::selected, tag::rng >();
+  ErrChk( !rngs.empty(), "No RNGs selected" );
+
+  auto print = printer();
+
+  std::stringstream ss;
+  ss << "RNGs benchmarked (" << rngs.size() << ")";
+  print.section( ss.str() );
+  #ifdef HAS_MKL
+  print.MKLParams( rngs, g_inputdeck.get< tag::param, tag::rngmkl >() );
+  #endif
+  print.RNGSSEParams( rngs, g_inputdeck.get< tag::param, tag::rngsse >() );
+  print.Random123Params( rngs, g_inputdeck.get< tag::param, tag::rng123 >() );
+  print.endpart();
+  print.part( ctr::Battery().name( ctr::BatteryType::BENCHMARK ) );
+  print.benchhead( "Throughputs measured" );
+
+  // Measure one generator at a time so measurements do not compete
+  for (const auto& r : rngs) thisProxy.measure( r );
+}
+
+void
+Benchmark::measure( tk::ctr::RNGType r )
+// *****************************************************************************
+// Measure the throughputs of a generator
+//! \param[in] r Generator to measure
+//! \details A new instance of the generator is created with a stream for each
+//!   thread, so that the threads do not share generator states.
+// *****************************************************************************
+{
+  tk::ctr::RNG opt;
+  const auto nthread = maxthreads();
+
+  tk::RNGStack stack(
+    #ifdef HAS_MKL
+    g_inputdeck.get< tag::param, tag::rngmkl >(),
+    #endif
+    #ifdef HAS_RNGSSE2
+    g_inputdeck.get< tag::param, tag::rngsse >(),
+    #endif
+    g_inputdeck.get< tag::param, tag::rng123 >(),
+    nthread );
+  const auto rngs = stack.selected( { r } );
+  Assert( rngs.size() == 1, "Exactly one RNG must be instantiated" );
+  const auto& rng = rngs.begin()->second;
+
+  const std::vector< std::pair< Dist, std::string > > dists{
+    { Dist::UNIFORM, "uniform" },
+    { Dist::GAUSSIAN, "Gaussian" },
+    { Dist::GAUSSIANMV, "multi-variate Gaussian" },
+    { Dist::BETA, "beta" },
+    { Dist::GAMMA, "gamma" } };
+
+  std::vector< std::string > names, values;
+  for (const auto& [ dist, distname ] : dists) {
+    // only MKL implements multi-variate Gaussian random numbers
+    if (dist == Dist::GAUSSIANMV && opt.lib(r) != tk::ctr::RNGLibType::MKL)
+      continue;
+    for (auto batch : s_batch) {
+      tk::real n1 = 1.0;
+      for (std::size_t t=1; t<=nthread; t*=2) {
+        const auto n = throughput( rng, dist, batch, t );
+        if (t == 1) n1 = n;
+        if (dist == Dist::UNIFORM && batch == s_batch.back() && t == 1)
+          m_time[ opt.name(r) ] = 1.0e6 / n;
+        std::stringstream ns, vs;
+        ns << distname << ", batch " << batch << ", " << t << " thread"
+           << (t > 1 ? "s" : "");
+        vs << std::setprecision(3) << n;
+        // parallel efficiency: per-thread throughput relative to one thread,
+        // revealing contention between threads, e.g., false sharing
+        if (t > 1)
+          vs << " (" << std::setprecision(3) << 100.0 * n / n1 << "%)";
+        names.push_back( ns.str() );
+        values.push_back( vs.str() );
+      }
+    }
+  }
+
+  evaluate( { names, values, { opt.name(r) } } );
+}
+
+tk::real
+Benchmark::throughput( const tk::RNG& rng,
+                       Dist dist,
+                       std::size_t batch,
+                       std::size_t nthread ) const
+// *****************************************************************************
+// Measure the throughput of a distribution of a generator
+//! \param[in] rng Generator to measure
+//! \param[in] dist Distribution to measure
+//! \param[in] batch Number of random numbers requested in a single call
+//! \param[in] nthread Number of threads generating random numbers concurrently,
+//!   each using its own stream
+//! \return Number of random numbers generated per second per thread
+// *****************************************************************************
+{
+  const auto dim = dist == Dist::GAUSSIANMV ? s_dim : 1;
+  const auto ncall = std::max< std::size_t >( 1, s_nnum / (batch*dim) );
+
+  // Zero mean and identity covariance, upper triangle packed by rows
+  std::vector< double > mean( s_dim, 0.0 ), cov( s_dim*(s_dim+1)/2, 0.0 );
+  for (std::size_t i=0, k=0; i<s_dim; k+=s_dim-i, ++i) cov[k] = 1.0;
+
+  tk::Timer timer;
+
+  const auto n = static_cast< std::ptrdiff_t >( nthread );
+  #pragma omp parallel for num_threads( nthread )
+  for (std::ptrdiff_t t=0; t<n; ++t) {
+    const auto stream = static_cast< int >( t );
+    std::vector< double > r( batch*dim );
+    for (std::size_t c=0; c<ncall; ++c) {
+      if (dist == Dist::UNIFORM)
+        rng.uniform( stream, batch, r.data() );
+      else if (dist == Dist::GAUSSIAN)
+        rng.gaussian( stream, batch, r.data() );
+      else if (dist == Dist::GAUSSIANMV)
+        rng.gaussianmv( stream, batch, dim, mean.data(), cov.data(),
+                        r.data() );
+      else if (dist == Dist::BETA)
+        rng.beta( stream, batch, 2.0, 3.0, 0.0, 1.0, r.data() );
+      else
+        rng.gamma( stream, batch, 2.0, 1.0, r.data() );
+    }
+  }
+
+  const auto time = timer.dsec();
+  return static_cast< tk::real >( ncall * batch * dim ) / time;
+}
+
+void
+Benchmark::evaluate( std::vector< std::vector< std::string > > status )
+// *****************************************************************************
+// Output the throughputs measured for a generator
+//! \param[in] status Status vectors of strings for a generator, see
+//!   RNGTestPrint::throughput()
+// *****************************************************************************
+{
+  auto print = printer();
+
+  print.throughput( status );
+
+  if (++m_ncomplete == g_inputdeck.get< tag::selected, tag::rng >().size()) {
+    // Cost assessment only for more than one RNG
+    if (m_time.size() > 1)
+      print.cost( "Generator cost",
+                  "Measured times in seconds to generate 10^6 uniform random "
+                  "numbers in batches of " + std::to_string( s_batch.back() ) +
+                  " on a single thread in increasing order (low is good)",
+                  m_time );
+    // Quit
+    mainProxy.finalize();
+  }
+}
+
+#include "NoWarning/benchmark.def.h"
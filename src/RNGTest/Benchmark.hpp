@@ -0,0 +1,91 @@
+// *****************************************************************************
+/*!
+  \file      src/RNGTest/Benchmark.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Random number generator throughput benchmark
+  \details   This file declares the random number generator throughput
+    benchmark, which measures the number of random numbers generated per second
+    per core by any supported random number generator, called through the
+    tk::RNG interface, for all distributions, a range of batch sizes, and
+    thread counts.
+*/
+// *****************************************************************************
+#ifndef Benchmark_h
+#define Benchmark_h
+
+#include <vector>
+#include <map>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+#include "Types.hpp"
+#include "RNG.hpp"
+#include "RNGTestPrint.hpp"
+#include "Options/RNG.hpp"
+#include "RNGTest/InputDeck/InputDeck.hpp"
+#include "NoWarning/benchmark.decl.h"
+
+namespace rngtest {
+
+extern ctr::InputDeck g_inputdeck;
+extern ctr::InputDeck g_inputdeck_defaults;
+
+//! \brief Random number generator throughput benchmark used polymorphically
+//!   with Battery
+//! \details This class is a Charm++ chare that measures the throughput of all
+//!   selected random number generators, one generator at a time, on the PE it
+//!   is created on, using OpenMP threads for measuring the throughput with
+//!   multiple threads, if OpenMP is enabled.
+class Benchmark : public CBase_Benchmark {
+
+  public:
+    using Proxy = CProxy_Benchmark;
+
+    //! Constructor
+    explicit Benchmark();
+
+    //! Collect number of p-values from a test: no-op, there are no p-values
+    void npval( std::size_t ) {}
+
+    //! Collect test name(s) from a test: no-op, measurements are named in
+    //! the status passed to evaluate()
+    void names( std::vector< std::string > ) {}
+
+    //! Output the throughputs measured for a generator
+    void evaluate( std::vector< std::vector< std::string > > status );
+
+    //! Measure the throughputs of a generator
+    void measure( tk::ctr::RNGType r );
+
+  private:
+    //! Distributions benchmarked
+    enum class Dist : uint8_t { UNIFORM=0, GAUSSIAN, GAUSSIANMV, BETA, GAMMA };
+
+    std::size_t m_ncomplete;                //!< Number of RNGs measured
+    std::map< std::string, tk::real > m_time; //!< Reference time per RNG
+
+    //! Measure the throughput of a distribution of a generator
+    tk::real throughput( const tk::RNG& rng,
+                         Dist dist,
+                         std::size_t batch,
+                         std::size_t nthread ) const;
+
+    //! Create pretty printer specialized to RNGTest
+    //! \return Pretty printer
+    RNGTestPrint printer() const {
+      const auto& def =
+        g_inputdeck_defaults.get< tag::cmd, tag::io, tag::screen >();
+      auto nrestart = g_inputdeck.get< tag::cmd, tag::io, tag::nrestart >();
+      return RNGTestPrint( g_inputdeck.get< tag::cmd >().logname( def, nrestart ),
+        g_inputdeck.get< tag::cmd, tag::verbose >() ? std::cout : std::clog,
+        std::ios_base::app );
+    }
+};
+
+} // rngtest::
+
+#endif // Benchmark_h
@@ -45,7 +45,7 @@ extern TestStack g_testStack;
 using rngtest::BigCrush;
 
 void
-BigCrush::addTests( std::vector< std::function< StatTest() > >& tests,
+BigCrush::addTests( std::vector< StatTestCtor >& tests,
                     tk::ctr::RNGType rng,
                     CProxy_TestU01Suite& proxy )
 // *****************************************************************************
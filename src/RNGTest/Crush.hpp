@@ -18,11 +18,11 @@
 
 #include "Options/RNG.hpp"
 #include "RNGTest/Options/Battery.hpp"
+#include "StatTest.hpp"
 
 namespace rngtest {
 
 class CProxy_TestU01Suite;
-class StatTest;
 
 //! Class registering the TestU01 library's Crush battery
 class Crush {
@@ -34,7 +34,7 @@ class Crush {
     { return ctr::Battery().name( rngtest::ctr::BatteryType::CRUSH ); }
 
     //! Add statistical tests to battery
-    void addTests( std::vector< std::function< StatTest() > >& tests,
+    void addTests( std::vector< StatTestCtor >& tests,
                    tk::ctr::RNGType rng,
                    CProxy_TestU01Suite& proxy );
 };
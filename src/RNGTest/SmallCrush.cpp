@@ -41,7 +41,7 @@ extern TestStack g_testStack;
 using rngtest::SmallCrush;
 
 void
-SmallCrush::addTests( std::vector< std::function< StatTest() > >& tests,
+SmallCrush::addTests( std::vector< StatTestCtor >& tests,
                       tk::ctr::RNGType rng,
                       CProxy_TestU01Suite& proxy )
 // *****************************************************************************
@@ -18,6 +18,8 @@
 #ifndef StatTest_h
 #define StatTest_h
 
+#include <string>
+#include <utility>
 #include <functional>
 #include <memory>
 
@@ -121,6 +123,19 @@ class StatTest {
     std::unique_ptr< Concept > self;    //!< Base pointer used polymorphically
 };
 
+//! \brief Statistical test constructor with the key identifying the test
+//! \details The constructor function takes the PE the test is to be created
+//!   on. The key identifies the test across runs, see costkey().
+using StatTestCtor =
+  std::pair< std::string, std::function< StatTest( int ) > >;
+
+//! Compute key identifying a statistical test of an RNG across runs
+//! \param[in] rng RNG name
+//! \param[in] test Name of the (first) statistic computed by the test
+//! \return Key identifying the test
+inline std::string costkey( const std::string& rng, const std::string& test )
+{ return rng + ", " + test; }
+
 } // rngtest::
 
 #endif // StatTest_h
@@ -40,7 +40,7 @@ class TestU01 : public CBase_TestU01< TestU01Props > {
     void run() { m_props.proxy().evaluate( m_props.run() ); }
 
     //! Query and contribute test run time measured in seconds
-    void time() { m_props.proxy().time( m_props.time() ); }
+    void time() { m_props.proxy().time( m_props.key(), m_props.time() ); }
 
   private:
     TestU01Props m_props;               //!< TestU01 test properties
@@ -21,6 +21,7 @@
 #include "RNG.hpp"
 #include "Timer.hpp"
 #include "Options/RNG.hpp"
+#include "StatTest.hpp"
 #include "TestU01Util.hpp"
 #include "TestStack.hpp"
 #include "TestU01Wrappers.hpp"
@@ -182,6 +183,11 @@ class TestU01Props {
     std::pair< std::string, tk::real > time()
     { return { tk::ctr::RNG().name(m_rng), m_time }; }
 
+    //! Test key accessor
+    //! \return Key identifying the test across runs, see costkey()
+    std::string key() const
+    { return costkey( tk::ctr::RNG().name(m_rng), m_names.front() ); }
+
   private:
     //! \brief Pack/Unpack TestU01 external generator pointer
     //! \details Admittedly, the code below is ugly and looks stupid at first
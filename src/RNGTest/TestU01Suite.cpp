@@ -14,6 +14,10 @@
 
 #include <string>
 #include <iostream>
+#include <fstream>
+#include <sstream>
+#include <numeric>
+#include <algorithm>
 #include <cstddef>
 
 #include "NoWarning/format.hpp"
@@ -41,12 +45,14 @@ using rngtest::TestU01Suite;
 TestU01Suite::TestU01Suite( ctr::BatteryType suite ) :
   m_ctrs(),
   m_tests(),
+  m_order(),
   m_name(),
   m_npval(0),
   m_ncomplete(0),
   m_ntest(0),
   m_nfail(),
   m_time(),
+  m_cost(),
   m_failed()
 // *****************************************************************************
 // Constructor
@@ -63,7 +69,8 @@ TestU01Suite::TestU01Suite( ctr::BatteryType suite ) :
   else Throw( "Non-TestU01 RNG test suite passed to TestU01Suite" );
 
   // Construct all tests and store handles
-  for (const auto& t : m_ctrs) m_tests.emplace_back( t() );
+  loadcost();
+  schedule();
 
   // Collect number of results from all tests (one per RNG)
   for (std::size_t i=0; i<ntest(); ++i) m_tests[i].npval();
@@ -114,8 +121,9 @@ TestU01Suite::names( std::vector< std::string > n )
                      m_npval*rngs.size(),
                      m_ctrs.size() );
 
-    // Run battery of RNG tests
-    for (const auto& t : m_tests) t.run();
+    // Run battery of RNG tests, longest first, so that the tests queued on a
+    // PE start in the same order
+    for (auto i : m_order) m_tests[i].run();
 
     // Initialize space for counting the number failed tests per RNG. Note
     // that we could use tk::ctr::RNGType as the map-key here instead of the
@@ -155,13 +163,15 @@ TestU01Suite::evaluate( std::vector< std::vector< std::string > > status )
 }
 
 void
-TestU01Suite::time( std::pair< std::string, tk::real > t )
+TestU01Suite::time( std::string key, std::pair< std::string, tk::real > t )
 // *****************************************************************************
 // Collect test times measured in seconds from a statistical test
+//! \param[in] key Key identifying the test across runs
 //! \param[in] t Measured time to do the test for an RNG
 // *****************************************************************************
 {
   m_time[ t.first ] += t.second;
+  m_cost[ key ] = t.second;
 
   if ( ++m_ncomplete == m_ctrs.size() ) assess();
 }
@@ -192,10 +202,109 @@ TestU01Suite::assess()
                 m_nfail );
   }
 
+  // Store measured test run times for scheduling the next run
+  savecost();
+
   // Quit
   mainProxy.finalize();
 }
 
+void
+TestU01Suite::schedule()
+// *****************************************************************************
+// Construct all tests, distributing them across PEs by their run times
+//! \details The tests are non-migratable chares, so their placement decides
+//!   the load balance: tests are assigned in the order of decreasing run time,
+//!   each to the PE with the least run time assigned so far, i.e., the longest
+//!   processing time first rule, which yields a makespan within 4/3 of the
+//!   optimum. Run times are those measured in previous runs, see loadcost().
+//!   Tests without a measured run time are assumed to take the average run
+//!   time of those measured; if none are, all tests are assumed to cost the
+//!   same, which distributes them round-robin.
+// *****************************************************************************
+{
+  tk::real sum = 0.0;
+  std::size_t n = 0;
+  for (const auto& c : m_ctrs) {
+    auto it = m_cost.find( c.first );
+    if (it != end(m_cost)) {
+      sum += it->second;
+      ++n;
+    }
+  }
+  const auto unknown = n > 0 ? sum / static_cast< tk::real >( n ) : 1.0;
+
+  std::vector< tk::real > cost;
+  for (const auto& c : m_ctrs) {
+    auto it = m_cost.find( c.first );
+    cost.push_back( it != end(m_cost) ? it->second : unknown );
+  }
+
+  // Order tests longest first
+  m_order.resize( m_ctrs.size() );
+  std::iota( begin(m_order), end(m_order), 0 );
+  std::stable_sort( begin(m_order), end(m_order),
+    [&]( std::size_t a, std::size_t b ){ return cost[a] > cost[b]; } );
+
+  // Assign each test to the least loaded PE, keep handles in battery order
+  std::vector< tk::real > load( static_cast< std::size_t >( CkNumPes() ), 0.0 );
+  std::vector< int > pe( m_ctrs.size() );
+  for (auto i : m_order) {
+    auto p = std::min_element( begin(load), end(load) );
+    *p += cost[i];
+    pe[i] = static_cast< int >( p - begin(load) );
+  }
+  for (std::size_t i=0; i<m_ctrs.size(); ++i)
+    m_tests.emplace_back( m_ctrs[i].second( pe[i] ) );
+}
+
+void
+TestU01Suite::loadcost()
+// *****************************************************************************
+// Read test run times measured in previous runs
+//! \details The file, if it exists, stores a test per line as the battery
+//!   name, the run time in seconds, and the test key, separated by tabs. The
+//!   run times of tests of other batteries are ignored.
+// *****************************************************************************
+{
+  std::ifstream f( g_inputdeck.get< tag::cmd, tag::io, tag::testcost >() );
+  std::string line;
+  while (std::getline( f, line )) {
+    std::stringstream ss( line );
+    std::string battery, time, key;
+    if (std::getline( ss, battery, '\t' ) && battery == m_name &&
+        std::getline( ss, time, '\t' ) && std::getline( ss, key ))
+      m_cost[ key ] = std::stod( time );
+  }
+}
+
+void
+TestU01Suite::savecost() const
+// *****************************************************************************
+// Write test run times measured
+//! \details The run times of tests of other batteries are kept, those of this
+//!   battery are replaced, see also loadcost().
+// *****************************************************************************
+{
+  const auto& filename = g_inputdeck.get< tag::cmd, tag::io, tag::testcost >();
+
+  std::vector< std::string > other;
+  std::ifstream in( filename );
+  std::string line;
+  while (std::getline( in, line ))
+    if (line.substr( 0, line.find('\t') ) != m_name) other.push_back( line );
+  in.close();
+
+  std::ofstream out( filename );
+  if (!out.good()) {
+    printer().note< tk::QUIET >( "Cannot write test run times to " + filename );
+    return;
+  }
+  for (const auto& l : other) out << l << '\n';
+  for (const auto& [ key, time ] : m_cost)
+    out << m_name << '\t' << time << '\t' << key << '\n';
+}
+
 std::size_t
 TestU01Suite::ntest() const
 // *****************************************************************************
@@ -74,17 +74,19 @@ class TestU01Suite : public CBase_TestU01Suite {
     void evaluate( std::vector< std::vector< std::string > > status );
 
     //! Collect test run time from a test
-    void time( std::pair< std::string, tk::real > t );
+    void time( std::string key, std::pair< std::string, tk::real > t );
 
  private:
-    std::vector< std::function< StatTest() > > m_ctrs; //! Tests constructors
+    std::vector< StatTestCtor > m_ctrs; //!< Tests constructors
     std::vector< StatTest > m_tests;   //!< Constructed statistical tests
+    std::vector< std::size_t > m_order; //!< Test indices, longest first
     std::string m_name;                //!< Test suite name
     std::size_t m_npval;               //!< Number of results from all tests
     std::size_t m_ncomplete;           //!< Number of completed tests
     std::size_t m_ntest;               //!< Number of tests info received from
     std::map< std::string, std::size_t > m_nfail; //! Number of failed tests/RNG
     std::map< std::string, tk::real > m_time;     //!< Measured time/RNG
+    std::map< std::string, tk::real > m_cost;     //!< Measured time/test key
 
     //! Information bundle for a failed test
     struct Failed {
@@ -111,6 +113,15 @@ class TestU01Suite : public CBase_TestU01Suite {
     //! Return number of statistical tests
     std::size_t ntest() const;
 
+    //! Construct all tests, distributing them across PEs by their run times
+    void schedule();
+
+    //! Read test run times measured in previous runs
+    void loadcost();
+
+    //! Write test run times measured
+    void savecost() const;
+
     //! Output final assessment
     void assess();
 
@@ -0,0 +1,179 @@
+// *****************************************************************************
+/*!
+  \file      src/Statistics/DenseBins.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Dense bins of a PDF estimator with fixed sample space extents
+  \details   Dense bins of a PDF estimator with fixed sample space extents. If
+    the extents of the sample space of a PDF are known in advance, e.g., for
+    bounded variables such as mass fractions, the bins within the extents are
+    stored in a contiguous array, indexed directly by the bin ids. Compared to
+    the hash map, used by the PDF estimators for the bins of an unbounded
+    sample space, this avoids hashing and memory allocation per sample. Bins
+    outside of the extents are left to the sparse hash map of the estimator,
+    so no samples are lost. See also tk::UniPDF, tk::BiPDF, and tk::TriPDF.
+*/
+// *****************************************************************************
+#ifndef DenseBins_h
+#define DenseBins_h
+
+#include <array>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+#include "Types.hpp"
+#include "PUPUtil.hpp"
+
+namespace tk {
+
+//! Dense bins of a PDF estimator with fixed sample space extents
+//! \tparam Dim Number of sample space dimensions
+template< std::size_t Dim >
+class DenseBins {
+
+  public:
+    //! Bin ids in all sample space dimensions
+    using key_type = std::array< long, Dim >;
+
+    //! Maximum number of dense bins, more are left to the sparse hash map
+    static constexpr std::size_t maxbins = 1UL << 24;
+
+    //! Empty constructor: no dense bins
+    explicit DenseBins() : m_lo(), m_nbin(), m_count() {
+      m_lo.fill( 0 );
+      m_nbin.fill( 0 );
+    }
+
+    //! Constructor: configure dense bins covering the sample space extents
+    //! \param[in] binsize Sample space bin sizes
+    //! \param[in] ext Sample space extents, {min,max} in each dimension. If
+    //!   empty, or covering too many bins, no dense bins are configured.
+    explicit DenseBins( const std::array< tk::real, Dim >& binsize,
+                        const std::vector< tk::real >& ext ) : DenseBins()
+    {
+      if (ext.size() != 2*Dim) return;
+      std::size_t n = 1;
+      for (std::size_t d=0; d<Dim; ++d) {
+        m_lo[d] = std::lround( ext[d*2+0] / binsize[d] );
+        m_nbin[d] = std::lround( ext[d*2+1] / binsize[d] ) - m_lo[d] + 1;
+        if (m_nbin[d] < 1) return;
+        n *= static_cast< std::size_t >( m_nbin[d] );
+        if (n > maxbins) return;
+      }
+      m_count.resize( n, 0.0 );
+    }
+
+    //! Query if there are no dense bins configured
+    //! \return True if there are no dense bins
+    bool empty() const noexcept { return m_count.empty(); }
+
+    //! Add to the count of a bin, if it is within the extents
+    //! \param[in] b Bin ids
+    //! \param[in] c Count to add
+    //! \return True if the bin is within the extents and the count has been
+    //!   added, false if the bin is to be stored elsewhere
+    bool add( const key_type& b, tk::real c ) {
+      std::size_t i = 0;
+      for (std::size_t d=0; d<Dim; ++d) {
+        const auto j = b[d] - m_lo[d];
+        if (j < 0 || j >= m_nbin[d]) return false;
+        i = i * static_cast< std::size_t >( m_nbin[d] ) +
+            static_cast< std::size_t >( j );
+      }
+      m_count[i] += c;
+      return true;
+    }
+
+    //! Zero bins
+    void zero() noexcept { std::fill( begin(m_count), end(m_count), 0.0 ); }
+
+    //! Adopt the layout of other dense bins, if not yet configured
+    //! \param[in] d Dense bins whose layout to adopt
+    void layout( const DenseBins& d ) {
+      if (empty() && !d.empty()) {
+        m_lo = d.m_lo;
+        m_nbin = d.m_nbin;
+        m_count.assign( d.m_count.size(), 0.0 );
+      }
+    }
+
+    //! Add counts from other dense bins
+    //! \param[in] d Dense bins whose counts to add
+    //! \param[in] sparse Function called as sparse(b,c) with bin ids and count
+    //!   for bins of d outside of my extents
+    template< class Sparse >
+    void merge( const DenseBins& d, Sparse&& sparse ) {
+      if (m_lo == d.m_lo && m_nbin == d.m_nbin) {
+        for (std::size_t i=0; i<m_count.size(); ++i) m_count[i] += d.m_count[i];
+      } else {
+        d.each( [&]( const key_type& b, tk::real c ){
+                  if (!add( b, c )) sparse( b, c ); } );
+      }
+    }
+
+    //! Visit the bins with nonzero counts
+    //! \param[in] f Function called as f(b,c) with bin ids and count
+    template< class F >
+    void each( F&& f ) const {
+      for (std::size_t i=0; i<m_count.size(); ++i)
+        if (m_count[i] > 0.0) f( key(i), m_count[i] );
+    }
+
+    /** @name Pack/Unpack: Serialize DenseBins object for Charm++ */
+    ///@{
+    //! \brief Pack/Unpack serialize member function
+    //! \details Only the range of bins between the first and the last bin with
+    //!   a nonzero count are packed, as a contiguous array.
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    void pup( PUP::er& p ) {
+      p | m_lo;
+      p | m_nbin;
+      auto n = m_count.size();
+      std::size_t first = 0, last = 0;
+      if (!p.isUnpacking()) {
+        auto nz = []( tk::real c ){ return c > 0.0; };
+        auto f = std::find_if( begin(m_count), end(m_count), nz );
+        if (f != end(m_count)) {
+          first = static_cast< std::size_t >( f - begin(m_count) );
+          last = n - static_cast< std::size_t >(
+                   std::find_if( rbegin(m_count), rend(m_count), nz ) -
+                   rbegin(m_count) );
+        }
+      }
+      p | n;
+      p | first;
+      p | last;
+      if (p.isUnpacking()) m_count.assign( n, 0.0 );
+      if (last > first) PUParray( p, m_count.data() + first, last - first );
+    }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] d DenseBins object reference
+    friend void operator|( PUP::er& p, DenseBins& d ) { d.pup(p); }
+    ///@}
+
+  private:
+    key_type m_lo;                      //!< Lowest bin ids within extents
+    key_type m_nbin;                    //!< Number of bins in each dimension
+    std::vector< tk::real > m_count;    //!< Bin counts, last dimension fastest
+
+    //! Compute bin ids from index of dense bin
+    //! \param[in] i Index of dense bin
+    //! \return Bin ids
+    key_type key( std::size_t i ) const {
+      key_type b;
+      for (std::size_t d=Dim; d-->0; ) {
+        const auto n = static_cast< std::size_t >( m_nbin[d] );
+        b[d] = m_lo[d] + static_cast< long >( i % n );
+        i /= n;
+      }
+      return b;
+    }
+};
+
+} // tk::
+
+#endif // DenseBins_h
@@ -0,0 +1,238 @@
+// *****************************************************************************
+/*!
+  \file      src/Statistics/FlatBins.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Flat hash map of the sparse bins of multivariate PDF estimators
+  \details   Flat hash map of the sparse bins of multivariate PDF estimators.
+    The bins of an unbounded sample space, whose bin ids are small integer
+    arrays, are stored in a single array of (bin ids, count) pairs, addressed
+    by open addressing with linear probing. Compared to std::unordered_map,
+    which allocates a node per bin and chains the nodes of a bucket, this
+    takes no memory allocation per bin, less memory per bin, and finding a bin
+    mostly touches a single cache line. Bins are never erased individually,
+    so no tombstones are needed. See also tk::BiPDF and tk::TriPDF.
+*/
+// *****************************************************************************
+#ifndef FlatBins_h
+#define FlatBins_h
+
+#include <array>
+#include <vector>
+#include <limits>
+#include <cstdint>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+
+#include "Types.hpp"
+#include "Exception.hpp"
+
+namespace tk {
+
+//! Flat hash map of the sparse bins of a multivariate PDF estimator
+//! \tparam Dim Number of sample space dimensions
+//! \details The interface is the subset of that of std::unordered_map used
+//!   by the PDF estimators, their serialization, and the PDF writers. A bin
+//!   whose first bin id is the smallest long denotes an empty slot, which is
+//!   never the bin id of a finite sample.
+template< std::size_t Dim >
+class FlatBins {
+
+  public:
+    //! Bin ids in all sample space dimensions
+    using key_type = std::array< long, Dim >;
+    //! Sample count of a bin
+    using mapped_type = tk::real;
+    //! Bin ids and sample count of a bin
+    using value_type = std::pair< key_type, mapped_type >;
+
+    //! Iterator over the occupied slots
+    class const_iterator {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = FlatBins::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const value_type*;
+        using reference = const value_type&;
+
+        //! Constructor: point to the first occupied slot at or after p
+        //! \param[in] p Slot to start at
+        //! \param[in] e Slot past the last one
+        explicit const_iterator( pointer p = nullptr, pointer e = nullptr )
+          : m_p( p ), m_e( e ) { skip(); }
+
+        reference operator*() const { return *m_p; }
+        pointer operator->() const { return m_p; }
+        const_iterator& operator++() { ++m_p; skip(); return *this; }
+        const_iterator operator++(int)
+        { auto i = *this; ++(*this); return i; }
+        bool operator==( const const_iterator& i ) const
+        { return m_p == i.m_p; }
+        bool operator!=( const const_iterator& i ) const
+        { return m_p != i.m_p; }
+
+      private:
+        pointer m_p;    //!< Current slot
+        pointer m_e;    //!< Slot past the last one
+
+        //! Advance to the next occupied slot
+        void skip() { while (m_p != m_e && m_p->first[0] == m_empty) ++m_p; }
+    };
+
+    //! Constructor: empty hash map, allocating no slots
+    explicit FlatBins() : m_slot(), m_size( 0 ) {}
+
+    //! Number of bins stored
+    //! \return Number of bins stored
+    std::size_t size() const noexcept { return m_size; }
+
+    //! Query if no bins are stored
+    //! \return True if no bins are stored
+    bool empty() const noexcept { return m_size == 0; }
+
+    //! Iterator to the first bin
+    //! \return Iterator to the first bin
+    const_iterator begin() const
+    { return const_iterator( m_slot.data(), m_slot.data() + m_slot.size() ); }
+
+    //! Iterator past the last bin
+    //! \return Iterator past the last bin
+    const_iterator end() const {
+      const auto e = m_slot.data() + m_slot.size();
+      return const_iterator( e, e );
+    }
+
+    //! Remove all bins, keeping the slots allocated
+    void clear() {
+      for (auto& s : m_slot) s.first[0] = m_empty;
+      m_size = 0;
+    }
+
+    //! Allocate slots for a number of bins
+    //! \param[in] n Number of bins to store without allocating more slots
+    void reserve( std::size_t n ) {
+      std::size_t c = m_minslots;
+      while (c * m_maxload_den < n * m_maxload_num + m_maxload_num) c *= 2;
+      if (c > m_slot.size()) rehash( c );
+    }
+
+    //! Access the count of a bin, inserting an empty bin if not yet stored
+    //! \param[in] key Bin ids
+    //! \return Reference to the count of the bin
+    mapped_type& operator[]( const key_type& key ) {
+      return m_slot[ insert( key ) ].second;
+    }
+
+    //! Insert a bin with a count, if not yet stored
+    //! \param[in] key Bin ids
+    //! \param[in] count Sample count of the bin
+    //! \return True if the bin has been inserted, false if already stored
+    bool emplace( const key_type& key, mapped_type count ) {
+      const auto n = m_size;
+      auto& c = m_slot[ insert( key ) ].second;
+      if (m_size == n) return false;
+      c = count;
+      return true;
+    }
+
+    //! Find a bin
+    //! \param[in] key Bin ids
+    //! \return Iterator to the bin, end() if not stored
+    const_iterator find( const key_type& key ) const {
+      if (m_slot.empty()) return end();
+      const auto mask = m_slot.size() - 1;
+      for (auto i = hash( key ) & mask; ; i = (i+1) & mask) {
+        const auto& s = m_slot[i];
+        if (s.first == key)
+          return const_iterator( &s, m_slot.data() + m_slot.size() );
+        if (s.first[0] == m_empty) return end();
+      }
+    }
+
+    //! Add a sample to each of a batch of bins
+    //! \param[in,out] keys Bin ids of the samples, sorted on return
+    //! \details The bin ids are sorted first, so each distinct bin of the
+    //!   batch is looked up once, adding the number of its samples.
+    void add( std::vector< key_type >& keys ) {
+      std::sort( keys.begin(), keys.end() );
+      for (std::size_t i=0; i<keys.size(); ) {
+        std::size_t j = i+1;
+        while (j < keys.size() && keys[j] == keys[i]) ++j;
+        (*this)[ keys[i] ] += static_cast< mapped_type >( j-i );
+        i = j;
+      }
+    }
+
+  private:
+    //! Bin id denoting an empty slot
+    static constexpr long m_empty = std::numeric_limits< long >::min();
+    //! Smallest number of slots allocated
+    static constexpr std::size_t m_minslots = 16;
+    //! Numerator of the largest fraction of slots occupied
+    static constexpr std::size_t m_maxload_num = 7;
+    //! Denominator of the largest fraction of slots occupied
+    static constexpr std::size_t m_maxload_den = 10;
+
+    //! Slots, number of slots a power of two or zero
+    std::vector< value_type > m_slot;
+    //! Number of bins stored
+    std::size_t m_size;
+
+    //! Hash bin ids
+    //! \param[in] key Bin ids
+    //! \return Hash of the bin ids
+    //! \details Each bin id is mixed in by a multiplication with an odd
+    //!   constant, whose high bits are folded into the low bits used to
+    //!   address the slots, so that neighboring bins, which are mostly
+    //!   occupied together, are spread over the slots.
+    static std::size_t hash( const key_type& key ) noexcept {
+      std::uint64_t h = 0;
+      for (std::size_t d=0; d<Dim; ++d) {
+        h = (h ^ static_cast< std::uint64_t >( key[d] )) *
+            0x9e3779b97f4a7c15ULL;
+        h ^= h >> 32;
+      }
+      return static_cast< std::size_t >( h );
+    }
+
+    //! Find or insert a bin
+    //! \param[in] key Bin ids
+    //! \return Slot of the bin, with a zero count if inserted
+    std::size_t insert( const key_type& key ) {
+      Assert( key[0] != m_empty, "Bin id reserved for empty slots" );
+      if ((m_size+1) * m_maxload_den > m_slot.size() * m_maxload_num)
+        rehash( m_slot.empty() ? m_minslots : 2*m_slot.size() );
+      const auto mask = m_slot.size() - 1;
+      for (auto i = hash( key ) & mask; ; i = (i+1) & mask) {
+        auto& s = m_slot[i];
+        if (s.first == key) return i;
+        if (s.first[0] == m_empty) {
+          s = { key, 0.0 };
+          ++m_size;
+          return i;
+        }
+      }
+    }
+
+    //! Reallocate slots and reinsert all bins
+    //! \param[in] n New number of slots, a power of two
+    void rehash( std::size_t n ) {
+      std::vector< value_type > old( n );
+      for (auto& s : old) s.first[0] = m_empty;
+      old.swap( m_slot );
+      const auto mask = n - 1;
+      for (const auto& s : old)
+        if (s.first[0] != m_empty) {
+          auto i = hash( s.first ) & mask;
+          while (m_slot[i].first[0] != m_empty) i = (i+1) & mask;
+          m_slot[i] = s;
+        }
+    }
+};
+
+} // tk::
+
+#endif // FlatBins_h
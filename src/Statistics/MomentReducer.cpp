@@ -0,0 +1,43 @@
+// *****************************************************************************
+/*!
+  \file      src/Statistics/MomentReducer.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Custom Charm++ reducer for merging single-pass moments across PEs
+  \details   Custom Charm++ reducer for merging partial results of single-pass
+    moment accumulation across PEs.
+*/
+// *****************************************************************************
+
+#include <vector>
+
+#include "MomentReducer.hpp"
+#include "Statistics.hpp"
+
+namespace tk {
+
+CkReductionMsg*
+mergeMoments( int nmsg, CkReductionMsg **msgs )
+// *****************************************************************************
+// Charm++ custom reducer for merging partial results of single-pass moment
+// accumulation during reduction across PEs
+//! \param[in] nmsg Number of messages in msgs
+//! \param[in] msgs Charm++ reduction message containing the partial results
+//! \return Merged partial results built for further aggregation if needed
+//! \see tk::Statistics::accumulateFused()
+// *****************************************************************************
+{
+  std::vector< tk::real > m;
+
+  for (int i=0; i<nmsg; ++i)
+    tk::Statistics::mergeFused( m,
+      static_cast< const tk::real* >( msgs[i]->getData() ) );
+
+  // Forward merged partial results
+  return CkReductionMsg::buildNew(
+           static_cast< int >( m.size() * sizeof(tk::real) ), m.data() );
+}
+
+} // tk::
@@ -0,0 +1,27 @@
+// *****************************************************************************
+/*!
+  \file      src/Statistics/MomentReducer.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Custom Charm++ reducer for merging single-pass moments across PEs
+  \details   Custom Charm++ reducer for merging partial results of single-pass
+    moment accumulation across PEs.
+*/
+// *****************************************************************************
+#ifndef MomentReducer_h
+#define MomentReducer_h
+
+#include "NoWarning/charm++.hpp"
+
+namespace tk {
+
+//! \brief Charm++ custom reducer for merging partial results of single-pass
+//!   moment accumulation during reduction across PEs
+CkReductionMsg*
+mergeMoments( int nmsg, CkReductionMsg **msgs );
+
+} // tk::
+
+#endif // MomentReducer_h
@@ -0,0 +1,157 @@
+// *****************************************************************************
+/*!
+  \file      src/Statistics/SparseBins.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Compact serialization of the sparse bins of PDF estimators
+  \details   Compact serialization of the sparse bins of PDF estimators. The
+    bins of the hash maps of tk::UniPDF, tk::BiPDF, and tk::TriPDF are packed
+    as a list sorted by bin ids, in which the bin ids are delta-encoded with
+    respect to the previous bin and written, together with the counts, as
+    variable-length integers. Since neighboring bins are mostly occupied and
+    the counts are small integers, most bins then take a few bytes instead of
+    the (dimension+1)*8 bytes of the bin ids and the count, which reduces the
+    size of the messages of PDF reductions, e.g., of walker::Collector, by a
+    large factor.
+*/
+// *****************************************************************************
+#ifndef SparseBins_h
+#define SparseBins_h
+
+#include <array>
+#include <vector>
+#include <cmath>
+#include <cstring>
+#include <cstdint>
+#include <algorithm>
+#include <type_traits>
+
+#include "Types.hpp"
+#include "Exception.hpp"
+#include "PUPUtil.hpp"
+
+namespace tk {
+
+namespace detail {
+
+//! Append an unsigned integer as a variable-length integer to a byte stream
+//! \param[in,out] b Byte stream to append to
+//! \param[in] v Integer to append, 7 bits per byte, least significant first
+inline void putVarint( std::vector< char >& b, std::uint64_t v ) {
+  while (v >= 0x80) {
+    b.push_back( static_cast< char >( (v & 0x7f) | 0x80 ) );
+    v >>= 7;
+  }
+  b.push_back( static_cast< char >( v ) );
+}
+
+//! Read a variable-length integer from a byte stream
+//! \param[in,out] p Position in byte stream, advanced past the integer
+//! \return Integer read
+inline std::uint64_t getVarint( const char*& p ) {
+  std::uint64_t v = 0;
+  unsigned shift = 0;
+  std::uint64_t c;
+  do {
+    c = static_cast< unsigned char >( *p++ );
+    v |= (c & 0x7f) << shift;
+    shift += 7;
+  } while (c & 0x80);
+  return v;
+}
+
+//! Bin ids of a bin of a univariate PDF as an array
+inline std::array< long, 1 > ids( long k ) { return {{ k }}; }
+
+//! Bin ids of a bin of a multivariate PDF as an array
+template< std::size_t D >
+const std::array< long, D >& ids( const std::array< long, D >& k ) { return k; }
+
+} // detail::
+
+//! Pack/Unpack the sparse bins of a PDF estimator as a compact byte stream
+//! \param[in] p Charm++'s pack/unpack object
+//! \param[in,out] m Hash map of bin ids (long or std::array< long, D >) to
+//!   counts to pack/unpack
+//! \details The bins are sorted by their ids. Each bin id is written as the
+//!   zig-zag encoded difference to that of the previous bin, and each count,
+//!   which is a whole number unless the PDF has been scaled, is written as a
+//!   variable-length integer shifted by one bit, whose lowest bit set denotes
+//!   that the count is written verbatim instead.
+template< class Map >
+void pup_sparse( PUP::er& p, Map& m ) {
+  using key_type = typename Map::key_type;
+  constexpr std::size_t D = sizeof(key_type) / sizeof(long);
+
+  std::vector< char > b;
+  auto n = m.size();
+
+  if (!p.isUnpacking()) {
+    std::vector< std::pair< key_type, tk::real > > sorted( m.begin(), m.end() );
+    std::sort( begin(sorted), end(sorted),
+               []( const auto& x, const auto& y ){
+                 return x.first < y.first; } );
+    b.reserve( n * (D+1) * 2 );
+    std::array< long, D > prev;
+    prev.fill( 0 );
+    for (const auto& [key,count] : sorted) {
+      const auto& id = detail::ids( key );
+      for (std::size_t d=0; d<D; ++d) {
+        const auto delta = static_cast< std::uint64_t >( id[d] ) -
+                           static_cast< std::uint64_t >( prev[d] );
+        // zig-zag encode signed delta
+        detail::putVarint( b, (delta << 1) ^ (0 - (delta >> 63)) );
+        prev[d] = id[d];
+      }
+      if (count >= 0.0 && count < 9.0e15 &&
+          !(std::abs( std::round( count ) - count ) > 0.0)) {
+        detail::putVarint( b, static_cast< std::uint64_t >( count ) << 1 );
+      } else {
+        detail::putVarint( b, 1 );
+        char r[ sizeof(tk::real) ];
+        std::memcpy( r, &count, sizeof(tk::real) );
+        b.insert( end(b), r, r + sizeof(tk::real) );
+      }
+    }
+  }
+
+  p | n;
+  PUP::pup_contiguous( p, b );
+
+  if (p.isUnpacking()) {
+    m.clear();
+    m.reserve( n );
+    const char* q = b.data();
+    std::array< long, D > prev;
+    prev.fill( 0 );
+    for (std::size_t i=0; i<n; ++i) {
+      key_type key;
+      std::array< long, D > id;
+      for (std::size_t d=0; d<D; ++d) {
+        const auto z = detail::getVarint( q );
+        const auto delta = (z >> 1) ^ (0 - (z & 1));
+        id[d] = static_cast< long >( static_cast< std::uint64_t >( prev[d] ) +
+                                     delta );
+        prev[d] = id[d];
+      }
+      if constexpr( std::is_same_v< key_type, long > ) key = id[0];
+      else key = id;
+      const auto c = detail::getVarint( q );
+      tk::real count;
+      if (c & 1) {
+        std::memcpy( &count, q, sizeof(tk::real) );
+        q += sizeof(tk::real);
+      } else {
+        count = static_cast< tk::real >( c >> 1 );
+      }
+      m.emplace( key, count );
+    }
+    Assert( q == b.data() + b.size(), "Sparse bins stream corrupt" );
+  }
+}
+
+} // tk::
+
+#endif // SparseBins_h
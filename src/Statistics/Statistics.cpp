@@ -22,10 +22,12 @@
 #include <iosfwd>
 #include <cctype>
 #include <cfenv>
+#include <limits>
 
 #include "Types.hpp"
 #include "Exception.hpp"
 #include "Statistics.hpp"
+#include "ISA.hpp"
 #include "Particles.hpp"
 #include "SystemComponents.hpp"
 #include "UniPDF.hpp"
@@ -38,16 +40,22 @@ Statistics::Statistics( const tk::Particles& particles,
                         const ctr::OffsetMap& offset,
                         const std::vector< ctr::Product >& stat,
                         const std::vector< ctr::Probability >& pdf,
-                        const std::vector< std::vector< tk::real > >& binsize )
+                        const std::vector< std::vector< tk::real > >& binsize,
+                        const std::vector< std::vector< tk::real > >& extent )
   : m_particles( particles ),
     m_instOrd(),
     m_ordinary(),
     m_ordTerm(),
     m_nord( 0 ),
+    m_ordTree(),
     m_instCen(),
     m_central(),
     m_ctr(),
     m_ncen( 0 ),
+    m_cenTree(),
+    m_fusVar(),
+    m_fusIdx(),
+    m_fused(),
     m_instOrdUniPDF(),
     m_ordupdf(),
     m_instCenUniPDF(),
@@ -70,12 +78,15 @@ Statistics::Statistics( const tk::Particles& particles,
 //! \param[in] stat List of requested statistical moments
 //! \param[in] pdf List of requested probability density functions (PDF)
 //! \param[in] binsize List of binsize vectors configuring the PDF estimators
+//! \param[in] extent List of sample space extents configuring the PDF
+//!   estimators, empty for a PDF with no user-specified extents
 // *****************************************************************************
 {
   // Prepare for computing ordinary and central moments, PDFs
   setupOrdinary( offset, stat );
   setupCentral( offset, stat );
-  setupPDF( offset, pdf, binsize );
+  setupFused( offset, stat );
+  setupPDF( offset, pdf, binsize, extent );
 }
 
 void
@@ -122,6 +133,8 @@ Statistics::setupOrdinary( const ctr::OffsetMap& offset,
     // Put in zero as center for ordinary moments in central products
     m_ordinary[ m_nord ] = 0.0;
   }
+
+  m_ordTree = productTree( m_instOrd, {} );
 }
 
 void
@@ -157,33 +170,90 @@ Statistics::setupCentral( const ctr::OffsetMap& offset,
         ++m_ncen;
       }
     }
+
+  m_cenTree = productTree( m_instCen, m_ctr );
+}
+
+void
+Statistics::setupFused( const ctr::OffsetMap& offset,
+                        const std::vector< ctr::Product >& stat )
+// *****************************************************************************
+//  Prepare for accumulating ordinary and central moments in a single pass
+//! \param[in] offset Map of offsets in memory to address variable fields
+//! \param[in] stat List of requested statistical moments
+//! \details Collect the distinct variables of the central moments and, for
+//!   each central moment, the pair of variables whose co-moment it is. Nothing
+//!   is set up if a central moment has more than two terms, in which case the
+//!   moments cannot be estimated in a single pass.
+// *****************************************************************************
+{
+  // Central moments can only be estimated about ordinary moments
+  if (!m_nord) return;
+
+  const auto none = std::numeric_limits< std::size_t >::max();
+  for (const auto& product : stat) {
+    if (central(product)) {
+      if (product.size() > 2) {
+        m_fusVar.clear();
+        m_fusIdx.clear();
+        return;
+      }
+      std::array< std::size_t, 2 > idx{{ none, none }};
+      // A single-term central moment, <x>, is zero, no variable required
+      if (product.size() == 2) {
+        std::size_t j = 0;
+        for (const auto& term : product) {
+          auto o = offset.find( term.var );
+          Assert( o != end( offset ), "No such depvar" );
+          const tk::real* iptr = m_particles.cptr( term.field, o->second );
+          auto v = std::find( begin(m_fusVar), end(m_fusVar), iptr );
+          idx[j++] = static_cast< std::size_t >( v - begin(m_fusVar) );
+          if (v == end(m_fusVar)) m_fusVar.push_back( iptr );
+        }
+      }
+      m_fusIdx.push_back( idx );
+    }
+  }
+
+  // Denote single-term central moments with the number of variables
+  for (auto& idx : m_fusIdx)
+    if (idx[0] == none) idx = {{ m_fusVar.size(), m_fusVar.size() }};
 }
 
 void
 Statistics::setupPDF( const ctr::OffsetMap& offset,
                       const std::vector< ctr::Probability >& pdf,
-                      const std::vector< std::vector< tk::real > >& binsize )
+                      const std::vector< std::vector< tk::real > >& binsize,
+                      const std::vector< std::vector< tk::real > >& extent )
 // *****************************************************************************
 //  Prepare for computing PDFs
 //! \param[in] offset Map of offsets in memory to address variable fields
 //! \param[in] pdf List of requested probability density functions (PDF)
 //! \param[in] binsize List of binsize vectors configuring the PDF estimators
+//! \param[in] extent List of sample space extents configuring the PDF
+//!   estimators, empty for a PDF with no user-specified extents
+//! \details The bins of PDFs within user-specified sample space extents are
+//!   stored densely.
 // *****************************************************************************
 {
+  Assert( extent.empty() || extent.size() == binsize.size(),
+          "Number of PDF extents and that of bin sizes must equal" );
+
   std::size_t i = 0;
   for (const auto& probability : pdf) {
     if (ordinary(probability)) {
 
       // Detect number of sample space dimensions and create ordinary PDFs
+      const auto& ext = extent.empty() ? std::vector< tk::real >() : extent[i];
       const auto& bs = binsize[i++];
       if (bs.size() == 1) {
-        m_ordupdf.emplace_back( bs[0] );
+        m_ordupdf.emplace_back( bs[0], ext );
         m_instOrdUniPDF.emplace_back( std::vector< const tk::real* >() );
       } else if (bs.size() == 2) {
-        m_ordbpdf.emplace_back( bs );
+        m_ordbpdf.emplace_back( bs, ext );
         m_instOrdBiPDF.emplace_back( std::vector< const tk::real* >() );
       } else if (bs.size() == 3) {
-        m_ordtpdf.emplace_back( bs );
+        m_ordtpdf.emplace_back( bs, ext );
         m_instOrdTriPDF.emplace_back( std::vector< const tk::real* >() );
       }
 
@@ -202,17 +272,18 @@ Statistics::setupPDF( const ctr::OffsetMap& offset,
       // Detect number of sample space dimensions and create central PDFs,
       // create new storage for instantaneous variable pointer, create new
       // storage for center pointer
+      const auto& ext = extent.empty() ? std::vector< tk::real >() : extent[i];
       const auto& bs = binsize[i++];
       if (bs.size() == 1) {
-        m_cenupdf.emplace_back( bs[0] );
+        m_cenupdf.emplace_back( bs[0], ext );
         m_instCenUniPDF.emplace_back( std::vector< const tk::real* >() );
         m_ctrUniPDF.emplace_back( std::vector< const tk::real* >() );
       } else if (bs.size() == 2) {
-        m_cenbpdf.emplace_back( bs );
+        m_cenbpdf.emplace_back( bs, ext );
         m_instCenBiPDF.emplace_back( std::vector< const tk::real* >() );
         m_ctrBiPDF.emplace_back( std::vector< const tk::real* >() );
       } else if (bs.size() == 3) {
-        m_centpdf.emplace_back( bs );
+        m_centpdf.emplace_back( bs, ext );
         m_instCenTriPDF.emplace_back( std::vector< const tk::real* >() );
         m_ctrTriPDF.emplace_back( std::vector< const tk::real* >() );
       }
@@ -259,6 +330,113 @@ Statistics::mean( const tk::ctr::Term& term ) const
   Throw( std::string("Cannot find mean for variable ") + term );
 }
 
+Statistics::ProductTree
+Statistics::productTree(
+  const std::vector< std::vector< const tk::real* > >& inst,
+  const std::vector< std::vector< const tk::real* > >& ctr )
+// *****************************************************************************
+//  Build product tree of moments
+//! \param[in] inst Instantaneous variable pointers of the terms of each moment
+//! \param[in] ctr Centers of the terms of each moment, pointing to the
+//!   ordinary moments, empty for ordinary moments
+//! \return Product tree evaluating the products of all moments
+//! \details Two terms are the same factor if both their variables and their
+//!   centers are the same. Centers are stored as pointers, so changes of the
+//!   ordinary moments they point to are honored by accumulate().
+// *****************************************************************************
+{
+  Assert( ctr.empty() || ctr.size() == inst.size(), "Size mismatch" );
+
+  ProductTree t;
+  std::map< std::pair< const tk::real*, const tk::real* >, std::size_t > fac;
+  std::map< std::array< std::size_t, 2 >, std::size_t > node;
+
+  for (std::size_t i=0; i<inst.size(); ++i) {
+    Assert( !inst[i].empty(), "Moment has no terms" );
+    // Find distinct factors of moment, sorted
+    std::vector< std::size_t > f;
+    for (std::size_t j=0; j<inst[i].size(); ++j) {
+      auto c = ctr.empty() ? nullptr : ctr[i][j];
+      auto [it,inserted] =
+        fac.emplace( std::make_pair( inst[i][j], c ), fac.size() );
+      if (inserted) {
+        t.var.push_back( inst[i][j] );
+        t.ctr.push_back( c );
+      }
+      f.push_back( it->second );
+    }
+    std::sort( begin(f), end(f) );
+    // Walk down the tree along the factors, adding nodes not yet in the tree
+    auto n = std::numeric_limits< std::size_t >::max();
+    for (auto k : f) {
+      auto [it,inserted] = node.emplace( std::array< std::size_t, 2 >{{n,k}},
+                                         t.node.size() );
+      if (inserted) t.node.push_back( {{ n, k }} );
+      n = it->second;
+    }
+    t.moment.push_back( n );
+  }
+
+  // Denote root nodes with the number of nodes
+  for (auto& n : t.node)
+    if (n[0] == std::numeric_limits< std::size_t >::max()) n[0] = t.node.size();
+
+  return t;
+}
+
+TK_MULTIVERSION void
+Statistics::accumulate( const ProductTree& tree, tk::real* sum ) const
+// *****************************************************************************
+//  Accumulate sums of the products of a product tree over all particles
+//! \param[in] tree Product tree whose moments to accumulate
+//! \param[in,out] sum Partial sums of the moments of the tree, added to
+//! \details The particles are processed in blocks of m_block: first the
+//!   factors of the particles of a block are gathered, then each node of the
+//!   tree is evaluated for the whole block and finally the products of the
+//!   moments are summed. The loops over the particles of a block are
+//!   contiguous and carry no dependencies, so they can be vectorized.
+// *****************************************************************************
+{
+  const auto B = m_block;
+  const auto nf = tree.var.size();
+  const auto nn = tree.node.size();
+  std::vector< tk::real > f( nf*B ), v( nn*B );
+
+  const auto npar = m_particles.nunk();
+  for (std::size_t p=0; p<npar; p+=B) {
+    const auto nb = std::min< std::size_t >( B, npar-p );
+    // Gather factors, without centers for ordinary factors
+    for (std::size_t k=0; k<nf; ++k) {
+      const auto c = tree.ctr[k] ? *tree.ctr[k] : 0.0;
+      auto x = f.data() + k*B;
+      for (std::size_t b=0; b<nb; ++b)
+        x[b] = m_particles.var( tree.var[k], p+b ) - c;
+    }
+    // Evaluate nodes, parents first
+    for (std::size_t n=0; n<nn; ++n) {
+      const auto& [parent,k] = tree.node[n];
+      auto x = v.data() + n*B;
+      const auto y = f.data() + k*B;
+      if (parent == nn) {
+        #pragma omp simd
+        for (std::size_t b=0; b<nb; ++b) x[b] = y[b];
+      } else {
+        const auto z = v.data() + parent*B;
+        #pragma omp simd
+        for (std::size_t b=0; b<nb; ++b) x[b] = z[b] * y[b];
+      }
+    }
+    // Sum products of moments
+    for (std::size_t i=0; i<tree.moment.size(); ++i) {
+      const auto x = v.data() + tree.moment[i]*B;
+      tk::real s = 0.0;
+      #pragma omp simd reduction(+:s)
+      for (std::size_t b=0; b<nb; ++b) s += x[b];
+      sum[i] += s;
+    }
+  }
+}
+
 void
 Statistics::accumulateOrd()
 // *****************************************************************************
@@ -274,17 +452,7 @@ Statistics::accumulateOrd()
 
     // Accumulate sum for ordinary moments. This is a partial sum, so no
     // division by the number of samples.
-    const auto npar = m_particles.nunk();
-    for (auto p=decltype(npar){0}; p<npar; ++p) {
-      for (std::size_t i=0; i<m_nord; ++i) {
-       auto prod = m_particles.var( m_instOrd[i][0], p );
-        const auto s = m_instOrd[i].size();
-        for (auto j=decltype(s){1}; j<s; ++j) {
-          prod *= m_particles.var( m_instOrd[i][j], p );
-        }
-        m_ordinary[i] += prod;
-      }
-    }
+    accumulate( m_ordTree, m_ordinary.data() );
   }
 
   feclearexcept( FE_UNDERFLOW );
@@ -314,61 +482,234 @@ Statistics::accumulateCen( const std::vector< tk::real >& om )
 
     // Accumulate sum for central moments. This is a partial sum, so no division
     // by the number of samples.
-    const auto npar = m_particles.nunk();
-    for (auto p=decltype(npar){0}; p<npar; ++p) {
-      for (std::size_t i=0; i<m_ncen; ++i) {
-        auto prod = m_particles.var( m_instCen[i][0], p ) - *(m_ctr[i][0]);
-        const auto s = m_instCen[i].size();
-        for (auto j=decltype(s){1}; j<s; ++j) {
-          prod *= m_particles.var( m_instCen[i][j], p ) - *(m_ctr[i][j]);
-        }
-        m_central[i] += prod;
-      }
+    accumulate( m_cenTree, m_central.data() );
+  }
+}
+
+TK_MULTIVERSION void
+Statistics::accumulateFused()
+// *****************************************************************************
+//  Accumulate ordinary and central moments in a single pass
+//! \details Instead of estimating the ordinary moments first and, after they
+//!   are collected from all PEs, the central moments about them in a second
+//!   pass over the particles, the means of the variables of the central
+//!   moments and their co-moments are updated for each particle using the
+//!   numerically stable algorithm by Welford. The partial results of
+//!   different threads, chares, and PEs can then be combined using the
+//!   pairwise update by Chan et al., see mergeFused(). This is only possible
+//!   for central moments of up to second order, see setupFused(). The partial
+//!   results, m_fused, are self-describing, laid out as
+//!   [ nord, nv, ncen, n, sums(nord), means(nv), co-moments(ncen),
+//!   variable indices(2*ncen) ], where nord, nv, ncen, and n are the number of
+//!   ordinary moments, variables, central moments, and samples, respectively,
+//!   sums are the partial sums of the ordinary moments, co-moments are the
+//!   sums of the products of the fluctuations of each central moment, and the
+//!   variable indices of each central moment index the means.
+// *****************************************************************************
+{
+  Assert( m_fusIdx.size() == m_ncen,
+          "Central moments cannot be estimated in a single pass" );
+
+  fenv_t fe;
+  feholdexcept( &fe );
+
+  const auto nv = m_fusVar.size();
+  m_fused.assign( 4 + m_nord + nv + 3*m_ncen, 0.0 );
+  m_fused[0] = static_cast< tk::real >( m_nord );
+  m_fused[1] = static_cast< tk::real >( nv );
+  m_fused[2] = static_cast< tk::real >( m_ncen );
+  auto sum = m_fused.data() + 4;
+  auto mean = sum + m_nord;
+  auto com = mean + nv;
+  auto idx = com + m_ncen;
+  for (std::size_t i=0; i<m_ncen; ++i) {
+    idx[i*2+0] = static_cast< tk::real >( m_fusIdx[i][0] );
+    idx[i*2+1] = static_cast< tk::real >( m_fusIdx[i][1] );
+  }
+
+  // Accumulate partial sums for ordinary moments
+  accumulate( m_ordTree, sum );
+
+  // Fluctuations about the means before their update
+  std::vector< tk::real > d( nv );
+
+  const auto npar = m_particles.nunk();
+  for (auto p=decltype(npar){0}; p<npar; ++p) {
+    // Update means and co-moments
+    const auto r = 1.0 / static_cast< tk::real >( p+1 );
+    for (std::size_t v=0; v<nv; ++v) {
+      d[v] = m_particles.var( m_fusVar[v], p ) - mean[v];
+      mean[v] += d[v] * r;
+    }
+    for (std::size_t i=0; i<m_ncen; ++i) {
+      const auto& [a,b] = m_fusIdx[i];
+      if (a < nv)
+        com[i] += d[a] * (m_particles.var( m_fusVar[b], p ) - mean[b]);
     }
   }
+
+  m_fused[3] = static_cast< tk::real >( npar );
+
+  feclearexcept( FE_UNDERFLOW );
+  feupdateenv( &fe );
+}
+
+std::size_t
+Statistics::fusedSize( const tk::real* f )
+// *****************************************************************************
+//  Size of partial results of single-pass moment accumulation
+//! \param[in] f Partial results of single-pass moment accumulation
+//! \return Number of reals in f
+//! \see accumulateFused()
+// *****************************************************************************
+{
+  return 4 + static_cast< std::size_t >( f[0] ) +
+             static_cast< std::size_t >( f[1] ) +
+             3 * static_cast< std::size_t >( f[2] );
+}
+
+void
+Statistics::mergeFused( std::vector< tk::real >& a, const tk::real* b )
+// *****************************************************************************
+//  Merge partial results of single-pass moment accumulation
+//! \param[in,out] a Partial results to merge into, may be empty
+//! \param[in] b Partial results to merge
+//! \details The means and co-moments of two sets of samples are combined
+//!   using the pairwise update of Chan, Golub, and LeVeque, "Algorithms for
+//!   computing the sample variance: analysis and recommendations", The
+//!   American Statistician, 37:242-247, 1983.
+//! \see accumulateFused()
+// *****************************************************************************
+{
+  // Nothing to merge into: copy
+  if (a.empty() || !(a[3] > 0.0)) {
+    a.assign( b, b + fusedSize( b ) );
+    return;
+  }
+
+  Assert( fusedSize( a.data() ) == fusedSize( b ),
+          "Partial results of single-pass moment accumulation incompatible" );
+
+  const auto na = a[3];
+  const auto nb = b[3];
+  if (!(nb > 0.0)) return;
+  const auto n = na + nb;
+
+  const auto nord = static_cast< std::size_t >( a[0] );
+  const auto nv = static_cast< std::size_t >( a[1] );
+  const auto ncen = static_cast< std::size_t >( a[2] );
+  auto sum = a.data() + 4;
+  auto mean = sum + nord;
+  auto com = mean + nv;
+  const auto idx = com + ncen;
+  const auto bsum = b + 4;
+  const auto bmean = bsum + nord;
+  const auto bcom = bmean + nv;
+
+  for (std::size_t i=0; i<nord; ++i) sum[i] += bsum[i];
+
+  std::vector< tk::real > delta( nv );
+  for (std::size_t v=0; v<nv; ++v) delta[v] = bmean[v] - mean[v];
+
+  for (std::size_t i=0; i<ncen; ++i) {
+    const auto u = static_cast< std::size_t >( idx[i*2+0] );
+    const auto w = static_cast< std::size_t >( idx[i*2+1] );
+    if (u < nv) com[i] += bcom[i] + delta[u]*delta[w]*na*nb/n;
+  }
+
+  for (std::size_t v=0; v<nv; ++v) mean[v] += delta[v]*nb/n;
+
+  a[3] = n;
 }
 
 void
-Statistics::accumulateOrdPDF()
+Statistics::fusedMoments( const tk::real* f,
+                          std::vector< tk::real >& ord,
+                          std::vector< tk::real >& cen )
+// *****************************************************************************
+//  Finish estimating moments from merged single-pass partial results
+//! \param[in] f Partial results of single-pass moment accumulation merged
+//!   over all samples
+//! \param[in,out] ord Ordinary moments estimated
+//! \param[in,out] cen Central moments estimated
+//! \see accumulateFused()
+// *****************************************************************************
+{
+  const auto nord = static_cast< std::size_t >( f[0] );
+  const auto nv = static_cast< std::size_t >( f[1] );
+  const auto ncen = static_cast< std::size_t >( f[2] );
+  const auto n = f[3];
+
+  Assert( nord == ord.size(), "Number of ordinary moments incorrect" );
+  Assert( ncen == cen.size(), "Number of central moments incorrect" );
+  Assert( n > 0.0, "No samples to estimate moments from" );
+
+  const auto sum = f + 4;
+  const auto com = sum + nord + nv;
+  for (std::size_t i=0; i<nord; ++i) ord[i] = sum[i] / n;
+  for (std::size_t i=0; i<ncen; ++i) cen[i] = com[i] / n;
+}
+
+void
+Statistics::accumulateOrdPDF( std::size_t stride )
 // *****************************************************************************
 //  Accumulate (i.e., only do the sum for) ordinary PDFs
+//! \param[in] stride Sample every stride-th particle only
 // *****************************************************************************
 {
+  fenv_t fe;
+  feholdexcept( &fe );
+
   if (!m_ordupdf.empty() || !m_ordbpdf.empty() || !m_ordtpdf.empty()) {
     // Zero PDF accumulators
     for (auto& pdf : m_ordupdf) pdf.zero();
     for (auto& pdf : m_ordbpdf) pdf.zero();
     for (auto& pdf : m_ordtpdf) pdf.zero();
 
-    // Accumulate partial sum for PDFs
+    // Accumulate partial sum for univariate PDFs
     const auto npar = m_particles.nunk();
-    for (auto p=decltype(npar){0}; p<npar; ++p) {
+    for (auto p=decltype(npar){0}; p<npar; p+=stride) {
       std::size_t i = 0;
-      // Accumulate partial sum for univariate PDFs
       for (auto& pdf : m_ordupdf) {
         pdf.add( m_particles.var( m_instOrdUniPDF[i++][0], p ) );
       }
-      // Accumulate partial sum for bivariate PDFs
-      i = 0;
-      for (auto& pdf : m_ordbpdf) {
-        const auto inst = m_instOrdBiPDF[i++];
-        pdf.add( {{ m_particles.var( inst[0], p ),
-                    m_particles.var( inst[1], p ) }} );
+    }
+
+    // Accumulate partial sum for bivariate PDFs in batches of samples
+    std::vector< std::array< tk::real, 2 > > s2;
+    for (std::size_t i=0; i<m_ordbpdf.size(); ++i) {
+      const auto& inst = m_instOrdBiPDF[i];
+      for (auto p=decltype(npar){0}; p<npar; ) {
+        s2.clear();
+        for (; p<npar && s2.size()<m_pdfbatch; p+=stride)
+          s2.push_back( {{ m_particles.var( inst[0], p ),
+                           m_particles.var( inst[1], p ) }} );
+        m_ordbpdf[i].add( s2 );
       }
-      // Accumulate partial sum for trivariate PDFs
-      i = 0;
-      for (auto& pdf : m_ordtpdf) {
-        const auto inst = m_instOrdTriPDF[i++];
-        pdf.add( {{ m_particles.var( inst[0], p ),
-                    m_particles.var( inst[1], p ),
-                    m_particles.var( inst[2], p ) }} );
+    }
+
+    // Accumulate partial sum for trivariate PDFs in batches of samples
+    std::vector< std::array< tk::real, 3 > > s3;
+    for (std::size_t i=0; i<m_ordtpdf.size(); ++i) {
+      const auto& inst = m_instOrdTriPDF[i];
+      for (auto p=decltype(npar){0}; p<npar; ) {
+        s3.clear();
+        for (; p<npar && s3.size()<m_pdfbatch; p+=stride)
+          s3.push_back( {{ m_particles.var( inst[0], p ),
+                           m_particles.var( inst[1], p ),
+                           m_particles.var( inst[2], p ) }} );
+        m_ordtpdf[i].add( s3 );
       }
     }
   }
+
+  feclearexcept( FE_UNDERFLOW );
+  feupdateenv( &fe );
 }
 
 void
-Statistics::accumulateCenPDF( const std::vector< tk::real >& om )
+Statistics::accumulateCenPDF( const std::vector< tk::real >& om,
+                              std::size_t stride )
 // *****************************************************************************
 //  Accumulate (i.e., only do the sum for) central PDFs
 //! \details The ordinary moments container, m_ordinary, is overwritten here
@@ -379,8 +720,12 @@ Statistics::accumulateCenPDF( const std::vector< tk::real >& om )
 //!   PEs and thus are the same to be passed here on all PEs. For example
 //!   client-code, see walker::Distributor.
 //! \param[in] om Ordinary moments
+//! \param[in] stride Sample every stride-th particle only
 // *****************************************************************************
 {
+  fenv_t fe;
+  feholdexcept( &fe );
+
   if (!m_cenupdf.empty() || !m_cenbpdf.empty() || !m_centpdf.empty()) {
     // Overwrite ordinary moments by those computed across all PEs
     for (std::size_t i=0; i<om.size(); ++i) m_ordinary[i] = om[i];
@@ -390,35 +735,47 @@ Statistics::accumulateCenPDF( const std::vector< tk::real >& om )
     for (auto& pdf : m_cenbpdf) pdf.zero();
     for (auto& pdf : m_centpdf) pdf.zero();
 
-    // Accumulate partial sum for PDFs
+    // Accumulate partial sum for univariate PDFs
     const auto npar = m_particles.nunk();
-    for (auto p=decltype(npar){0}; p<npar; ++p) {
+    for (auto p=decltype(npar){0}; p<npar; p+=stride) {
       std::size_t i = 0;
-      // Accumulate partial sum for univariate PDFs
       for (auto& pdf : m_cenupdf) {
         pdf.add(
           m_particles.var( m_instCenUniPDF[i][0], p ) - *(m_ctrUniPDF[i][0]) );
         ++i;
       }
-      // Accumulate partial sum for bivariate PDFs
-      i = 0;
-      for (auto& pdf : m_cenbpdf) {
-        const auto& inst = m_instCenBiPDF[i];
-        const auto& cen = m_ctrBiPDF[i];
-        pdf.add( {{ m_particles.var( inst[0], p ) - *(cen[0]),
-                    m_particles.var( inst[1], p ) - *(cen[1]) }} );
-        ++i;
+    }
+
+    // Accumulate partial sum for bivariate PDFs in batches of samples
+    std::vector< std::array< tk::real, 2 > > s2;
+    for (std::size_t i=0; i<m_cenbpdf.size(); ++i) {
+      const auto& inst = m_instCenBiPDF[i];
+      const auto& cen = m_ctrBiPDF[i];
+      for (auto p=decltype(npar){0}; p<npar; ) {
+        s2.clear();
+        for (; p<npar && s2.size()<m_pdfbatch; p+=stride)
+          s2.push_back( {{ m_particles.var( inst[0], p ) - *(cen[0]),
+                           m_particles.var( inst[1], p ) - *(cen[1]) }} );
+        m_cenbpdf[i].add( s2 );
       }
-      // Accumulate partial sum for trivariate PDFs
-      i = 0;
-      for (auto& pdf : m_centpdf) {
-        const auto inst = m_instCenTriPDF[i];
-        const auto& cen = m_ctrTriPDF[i];
-        pdf.add( {{ m_particles.var( inst[0], p ) - *(cen[0]),
-                    m_particles.var( inst[1], p ) - *(cen[1]),
-                    m_particles.var( inst[2], p ) - *(cen[2]) }} );
-        ++i;
+    }
+
+    // Accumulate partial sum for trivariate PDFs in batches of samples
+    std::vector< std::array< tk::real, 3 > > s3;
+    for (std::size_t i=0; i<m_centpdf.size(); ++i) {
+      const auto& inst = m_instCenTriPDF[i];
+      const auto& cen = m_ctrTriPDF[i];
+      for (auto p=decltype(npar){0}; p<npar; ) {
+        s3.clear();
+        for (; p<npar && s3.size()<m_pdfbatch; p+=stride)
+          s3.push_back( {{ m_particles.var( inst[0], p ) - *(cen[0]),
+                           m_particles.var( inst[1], p ) - *(cen[1]),
+                           m_particles.var( inst[2], p ) - *(cen[2]) }} );
+        m_centpdf[i].add( s3 );
       }
     }
   }
+
+  feclearexcept( FE_UNDERFLOW );
+  feupdateenv( &fe );
 }
@@ -63,6 +63,7 @@
 #ifndef Statistics_h
 #define Statistics_h
 
+#include <array>
 #include <vector>
 #include <cstddef>
 
@@ -85,7 +86,8 @@ class Statistics {
                          const ctr::OffsetMap& offset,
                          const std::vector< ctr::Product >& stat,
                          const std::vector< ctr::Probability >& pdf,
-                         const std::vector< std::vector< tk::real > >& binsize );
+                         const std::vector< std::vector< tk::real > >& binsize,
+                         const std::vector< std::vector< tk::real > >& extent );
 
     //! Accumulate (i.e., only do the sum for) ordinary moments
     void accumulateOrd();
@@ -93,11 +95,15 @@ class Statistics {
     //! Accumulate (i.e., only do the sum for) central moments
     void accumulateCen( const std::vector< tk::real >& om );
 
+    //! Accumulate ordinary and central moments in a single pass
+    void accumulateFused();
+
     //! Accumulate (i.e., only do the sum for) ordinary PDFs
-    void accumulateOrdPDF();
+    void accumulateOrdPDF( std::size_t stride = 1 );
 
     //! Accumulate (i.e., only do the sum for) central PDFs
-    void accumulateCenPDF( const std::vector< tk::real >& om );
+    void accumulateCenPDF( const std::vector< tk::real >& om,
+                           std::size_t stride = 1 );
 
     //! Ordinary moments accessor
     const std::vector< tk::real >& ord() const noexcept { return m_ordinary; }
@@ -105,6 +111,21 @@ class Statistics {
     //! Central moments accessor
     const std::vector< tk::real >& ctr() const noexcept { return m_central; }
 
+    //! \brief Partial results of single-pass moment accumulation accessor
+    //! \see accumulateFused()
+    const std::vector< tk::real >& fused() const noexcept { return m_fused; }
+
+    //! Size of partial results of single-pass moment accumulation
+    static std::size_t fusedSize( const tk::real* f );
+
+    //! Merge partial results of single-pass moment accumulation
+    static void mergeFused( std::vector< tk::real >& a, const tk::real* b );
+
+    //! Finish estimating moments from merged single-pass partial results
+    static void fusedMoments( const tk::real* f,
+                              std::vector< tk::real >& ord,
+                              std::vector< tk::real >& cen );
+
     //! Ordinary univariate PDFs accessor
     const std::vector< tk::UniPDF >& oupdf() const noexcept { return m_ordupdf; }
 
@@ -124,6 +145,30 @@ class Statistics {
     const std::vector< tk::TriPDF >& ctpdf() const noexcept { return m_centpdf; }
 
   private:
+    //! \brief Products of the variables of statistical moments, arranged as a
+    //!   tree whose nodes are the distinct prefixes of the products
+    //! \details The factors of each product are sorted, so products sharing
+    //!   factors share the nodes of their common prefix, e.g., <XY> is
+    //!   evaluated once for <XY>, <XYY>, and <XYZ>. Each node is the product
+    //!   of its parent node and a factor, a variable, optionally minus its
+    //!   center. Parents precede their children.
+    struct ProductTree {
+      //! Instantaneous variable pointers of the distinct factors
+      std::vector< const tk::real* > var;
+      //! Centers of the distinct factors, nullptr for ordinary factors
+      std::vector< const tk::real* > ctr;
+      //! Parent node and factor of each node, parent node.size() for a root
+      std::vector< std::array< std::size_t, 2 > > node;
+      //! Node whose product is each moment
+      std::vector< std::size_t > moment;
+    };
+
+    //! Number of particles whose products are evaluated together
+    static constexpr std::size_t m_block = 64;
+
+    //! Number of samples added together to multivariate PDFs
+    static constexpr std::size_t m_pdfbatch = 1024;
+
     /** @name Setup functions, called from the constructor */
     ///@{
     //! Setup ordinary moments
@@ -134,15 +179,28 @@ class Statistics {
     void setupCentral( const ctr::OffsetMap& offset,
                        const std::vector< ctr::Product >& stat );
 
+    //! Setup single-pass moment accumulation
+    void setupFused( const ctr::OffsetMap& offset,
+                     const std::vector< ctr::Product >& stat );
+
     //! Setup PDFs
     void setupPDF( const ctr::OffsetMap& offset,
                    const std::vector< ctr::Probability >& pdf,
-                   const std::vector< std::vector< tk::real > >& binsize  );
+                   const std::vector< std::vector< tk::real > >& binsize,
+                   const std::vector< std::vector< tk::real > >& extent );
     ///@}
 
     //! Return mean for fluctuation
     std::size_t mean(const tk::ctr::Term& term) const;
 
+    //! Build product tree of moments
+    static ProductTree
+    productTree( const std::vector< std::vector< const tk::real* > >& inst,
+                 const std::vector< std::vector< const tk::real* > >& ctr );
+
+    //! Accumulate sums of the products of a product tree over all particles
+    void accumulate( const ProductTree& tree, tk::real* sum ) const;
+
     //! Particle properties
     const tk::Particles& m_particles;
 
@@ -156,6 +214,8 @@ class Statistics {
     std::vector< tk::ctr::Term > m_ordTerm;
     //! Number of ordinary moments
     std::size_t m_nord;
+    //! Product tree of ordinary moments
+    ProductTree m_ordTree;
 
     //! Instantaneous variable pointers for computing central moments
     std::vector< std::vector< const tk::real* > > m_instCen;
@@ -165,6 +225,16 @@ class Statistics {
     std::vector< std::vector< const tk::real* > > m_ctr;
     //! Number of central moments
     std::size_t m_ncen;
+    //! Product tree of central moments
+    ProductTree m_cenTree;
+
+    //! Instantaneous variable pointers of distinct variables in central moments
+    std::vector< const tk::real* > m_fusVar;
+    //! \brief Indices into m_fusVar of the two terms of each central moment,
+    //!   m_fusVar.size() for a single-term central moment, which is zero
+    std::vector< std::array< std::size_t, 2 > > m_fusIdx;
+    //! Partial results of single-pass moment accumulation
+    std::vector< tk::real > m_fused;
     ///@}
 
     /** @name Data for univariate probability density function estimation */
@@ -8,20 +8,24 @@
   \brief     Joint trivariate PDF estimator
   \details   Joint trivariate PDF estimator. This class can be used to estimate
     a joint probability density function (PDF) of three scalar variables from an
-    ensemble. The implementation uses the standard container std::unordered_map,
-    which is a hash-based associative container with linear algorithmic
-    complexity for insertion of a new sample.
+    ensemble. The bins are stored in the flat hash map tk::FlatBins, which
+    takes constant time for insertion of a new sample. If the extents of the
+    sample space are given, the bins within the extents are stored densely,
+    see tk::DenseBins.
 */
 // *****************************************************************************
 #ifndef TriPDF_h
 #define TriPDF_h
 
 #include <array>
-#include <unordered_map>
+#include <vector>
 #include <algorithm>
 
 #include "Types.hpp"
 #include "PUPUtil.hpp"
+#include "DenseBins.hpp"
+#include "SparseBins.hpp"
+#include "FlatBins.hpp"
 
 namespace tk {
 
@@ -35,34 +39,31 @@ class TriPDF {
     //! Key type
     using key_type = std::array< long, dim >;
 
-    //! Pair type
-    using pair_type = std::pair< const key_type, tk::real >;
-
-    // Hash functor for key_type
-    struct key_hash {
-      std::size_t operator()( const key_type& key ) const {
-        return std::hash< long >()( key[0] ) ^
-               std::hash< long >()( key[1] ) ^
-               std::hash< long >()( key[2] );
-      }
-    };
-
     //! \brief Joint trivariate PDF
-    //! \details The underlying container type is an unordered_map where the key
+    //! \details The underlying container type is a flat hash map where the key
     //!   is three bin ids corresponding to the three sample space dimensions,
-    //!   and the mapped value is the sample counter. The hasher functor,
-    //!   defined by key_hash provides an XORed hash of the three bin ids.
-    using map_type = std::unordered_map< key_type, tk::real, key_hash >;
+    //!   and the mapped value is the sample counter.
+    using map_type = FlatBins< dim >;
+
+    //! Pair type
+    using pair_type = map_type::value_type;
 
     //! Empty constructor for Charm++
-    explicit TriPDF() : m_binsize( {{ 0, 0, 0 }} ), m_nsample( 0 ), m_pdf() {}
+    explicit TriPDF() :
+      m_binsize( {{ 0, 0, 0 }} ), m_nsample( 0 ), m_pdf(), m_dense(),
+      m_keys() {}
 
     //! Constructor: Initialize joint trivariate PDF container
     //! \param[in] bs Sample space bin size in all three directions
-    explicit TriPDF( const std::vector< tk::real >& bs ) :
+    //! \param[in] ext Optional sample space extents,
+    //!   {xmin,xmax,ymin,ymax,zmin,zmax}, within which bins are stored densely
+    explicit TriPDF( const std::vector< tk::real >& bs,
+                     const std::vector< tk::real >& ext = {} ) :
       m_binsize( {{ bs[0], bs[1], bs[2] }} ),
       m_nsample( 0 ),
-      m_pdf() {}
+      m_pdf(),
+      m_dense( m_binsize, ext ),
+      m_keys() {}
 
     //! Accessor to number of samples
     //! \return Number of samples collected
@@ -72,21 +73,52 @@ class TriPDF {
     //! \param[in] sample Sample to add
     void add( std::array< tk::real, dim > sample ) {
       ++m_nsample;
-      ++m_pdf[ {{ std::lround( sample[0] / m_binsize[0] ),
-                  std::lround( sample[1] / m_binsize[1] ),
-                  std::lround( sample[2] / m_binsize[2] ) }} ];
+      const key_type b{{ std::lround( sample[0] / m_binsize[0] ),
+                         std::lround( sample[1] / m_binsize[1] ),
+                         std::lround( sample[2] / m_binsize[2] ) }};
+      if (!m_dense.add( b, 1.0 )) ++m_pdf[ b ];
+    }
+
+    //! Add a batch of samples to trivariate PDF
+    //! \param[in] samples Samples to add
+    //! \details The bin ids of the samples not in the dense bins are
+    //!   collected first and then added to the sparse bins together, see
+    //!   tk::FlatBins::add().
+    void add( const std::vector< std::array< tk::real, dim > >& samples ) {
+      m_nsample += samples.size();
+      m_keys.clear();
+      for (const auto& s : samples) {
+        key_type b;
+        for (std::size_t d=0; d<dim; ++d)
+          b[d] = std::lround( s[d] / m_binsize[d] );
+        if (!m_dense.add( b, 1.0 )) m_keys.push_back( b );
+      }
+      m_pdf.add( m_keys );
     }
 
     //! Add multiple samples from a PDF
     //! \param[in] p PDF whose samples to add
     void addPDF( const TriPDF& p ) {
       m_binsize = p.binsize();
+      if (m_nsample == 0 && m_pdf.empty()) m_dense.layout( p.m_dense );
       m_nsample += p.nsample();
-      for (const auto& e : p.map()) m_pdf[ e.first ] += e.second;
+      m_dense.merge( p.m_dense,
+        [&]( const key_type& b, tk::real c ){ m_pdf[ b ] += c; } );
+      for (const auto& e : p.map())
+        if (!m_dense.add( e.first, e.second )) m_pdf[ e.first ] += e.second;
     }
 
     //! Zero bins
-    void zero() noexcept { m_nsample = 0; m_pdf.clear(); }
+    void zero() noexcept { m_nsample = 0; m_pdf.clear(); m_dense.zero(); }
+
+    //! Move the counts of the dense bins to the underlying PDF map
+    //! \details This must be called before the map is accessed, e.g., for
+    //!   output, if the sample space extents are given, since map() and
+    //!   extents() only see the map.
+    void fold() {
+      m_dense.each( [&]( const key_type& b, tk::real c ){ m_pdf[ b ] += c; } );
+      m_dense.zero();
+    }
 
     //! Constant accessor to underlying PDF map
     //! \return Constant reference to underlying map
@@ -102,13 +134,13 @@ class TriPDF {
     //! \return {xmin,xmax,ymin,ymax,zmin,zmax} Minima and maxima of bin the ids
     std::array< long, 2*dim > extents() const {
       Assert( !m_pdf.empty(), "PDF empty" );
-      auto x = std::minmax_element( begin(m_pdf), end(m_pdf),
+      auto x = std::minmax_element( m_pdf.begin(), m_pdf.end(),
                  []( const pair_type& a, const pair_type& b )
                  { return a.first[0] < b.first[0]; } );
-      auto y = std::minmax_element( begin(m_pdf), end(m_pdf),
+      auto y = std::minmax_element( m_pdf.begin(), m_pdf.end(),
                  []( const pair_type& a, const pair_type& b )
                  { return a.first[1] < b.first[1]; } );
-      auto z = std::minmax_element( begin(m_pdf), end(m_pdf),
+      auto z = std::minmax_element( m_pdf.begin(), m_pdf.end(),
                  []( const pair_type& a, const pair_type& b )
                  { return a.first[2] < b.first[2]; } );
       return {{ x.first->first[0], x.second->first[0],
@@ -123,7 +155,8 @@ class TriPDF {
     void pup( PUP::er& p ) {
       p | m_binsize;
       p | m_nsample;
-      p | m_pdf;
+      pup_sparse( p, m_pdf );
+      p | m_dense;
     }
     //! \brief Pack/Unpack serialize operator|
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
@@ -135,6 +168,8 @@ class TriPDF {
     std::array< tk::real, dim > m_binsize;   //!< Sample space bin sizes
     std::size_t m_nsample;                   //!< Number of samples collected
     map_type m_pdf;                          //!< Probability density function
+    DenseBins< dim > m_dense;                //!< Bins within given extents
+    std::vector< key_type > m_keys;          //!< Bin ids of a batch of samples
 };
 
 } // tk::
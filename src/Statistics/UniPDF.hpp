@@ -10,7 +10,8 @@
     probability density function of (PDF) a scalar variable from an ensemble.
     The implementation uses the standard container std::unordered_map, which is
     a hash-based associative container with linear algorithmic complexity for
-    insertion of a new sample.
+    insertion of a new sample. If the extents of the sample space are given,
+    the bins within the extents are stored densely, see tk::DenseBins.
 */
 // *****************************************************************************
 #ifndef UniPDF_h
@@ -19,11 +20,12 @@
 #include <array>
 #include <unordered_map>
 #include <algorithm>
-#include <cfenv>
 
 #include "Types.hpp"
 #include "Exception.hpp"
 #include "PUPUtil.hpp"
+#include "DenseBins.hpp"
+#include "SparseBins.hpp"
 
 namespace tk {
 
@@ -48,12 +50,14 @@ class UniPDF {
     using map_type = std::unordered_map< key_type, tk::real >;
 
     //! Empty constructor for Charm++
-    explicit UniPDF() : m_binsize( 0 ), m_nsample( 0 ), m_pdf() {}
+    explicit UniPDF() : m_binsize( 0 ), m_nsample( 0 ), m_pdf(), m_dense() {}
 
     //! Constructor: Initialize univariate PDF container
     //! \param[in] bs Sample space bin size
-    explicit UniPDF( tk::real bs ) :
-      m_binsize( bs ), m_nsample( 0 ), m_pdf() {}
+    //! \param[in] ext Optional sample space extents, {min,max}, within which
+    //!   bins are stored densely
+    explicit UniPDF( tk::real bs, const std::vector< tk::real >& ext = {} ) :
+      m_binsize( bs ), m_nsample( 0 ), m_pdf(), m_dense( {{ bs }}, ext ) {}
 
     //! Accessor to number of samples
     //! \return Number of samples collected
@@ -61,26 +65,41 @@ class UniPDF {
 
     //! Add sample to univariate PDF
     //! \param[in] sample Sample to insert
+    //! \note Floating-point exceptions, e.g., underflow computing the bin id,
+    //!   are not masked here, for each sample, but must be masked by the
+    //!   caller, once for all samples added.
     void add( tk::real sample ) {
       Assert( m_binsize > 0, "Bin size must be positive" );
       ++m_nsample;
-      fenv_t fe;
-      feholdexcept( &fe );
-      ++m_pdf[ std::lround( sample / m_binsize ) ];
-      feclearexcept( FE_UNDERFLOW );
-      feupdateenv( &fe );
+      const auto b = std::lround( sample / m_binsize );
+      if (!m_dense.add( {{ b }}, 1.0 )) ++m_pdf[ b ];
     }
 
     //! Add multiple samples from a PDF
     //! \param[in] p PDF whose samples to add
     void addPDF( const UniPDF& p ) {
       m_binsize = p.binsize();
+      if (m_nsample == 0 && m_pdf.empty()) m_dense.layout( p.m_dense );
       m_nsample += p.nsample();
-      for (const auto& e : p.map()) m_pdf[ e.first ] += e.second;
+      m_dense.merge( p.m_dense, [&]( const DenseBins< dim >::key_type& b,
+                                     tk::real c ){ m_pdf[ b[0] ] += c; } );
+      for (const auto& e : p.map())
+        if (!m_dense.add( {{ e.first }}, e.second ))
+          m_pdf[ e.first ] += e.second;
     }
 
     //! Zero bins
-    void zero() noexcept { m_nsample = 0; m_pdf.clear(); }
+    void zero() noexcept { m_nsample = 0; m_pdf.clear(); m_dense.zero(); }
+
+    //! Move the counts of the dense bins to the underlying PDF map
+    //! \details This must be called before the map is accessed, e.g., for
+    //!   output, if the sample space extents are given, since map(),
+    //!   extents(), and integral() only see the map.
+    void fold() {
+      m_dense.each( [&]( const DenseBins< dim >::key_type& b, tk::real c ){
+                      m_pdf[ b[0] ] += c; } );
+      m_dense.zero();
+    }
 
     //! Constant accessor to underlying PDF map
     //! \return Constant reference to underlying map
@@ -115,7 +134,8 @@ class UniPDF {
     void pup( PUP::er& p ) {
       p | m_binsize;
       p | m_nsample;
-      p | m_pdf;
+      pup_sparse( p, m_pdf );
+      p | m_dense;
     }
     //! \brief Pack/Unpack serialize operator|
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
@@ -127,6 +147,7 @@ class UniPDF {
     tk::real m_binsize;         //!< Sample space bin size
     std::size_t m_nsample;      //!< Number of samples collected
     map_type m_pdf;             //!< Probability density function
+    DenseBins< dim > m_dense;   //!< Bins within given sample space extents
 };
 
 //! Output univariate PDF to output stream
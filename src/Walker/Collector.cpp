@@ -13,6 +13,7 @@
 // *****************************************************************************
 
 #include "Collector.hpp"
+#include "Statistics.hpp"
 
 namespace walker {
 
@@ -27,6 +28,10 @@ namespace walker {
 //!   formatting the internet ...
 CkReduction::reducerType PDFMerger;
 
+//! \brief Charm++ merger reducer of moments accumulated in a single pass
+//! \details Defined here for the same reason as PDFMerger.
+CkReduction::reducerType MomentMerger;
+
 }
 
 using walker::Collector;
@@ -54,12 +59,7 @@ Collector::chareOrd( const std::vector< tk::real >& ord,
   for (std::size_t i=0; i<m_ordinary.size(); ++i) m_ordinary[i] += ord[i];
 
   // Add contribution from worker chares to partial sums on my PE
-  std::size_t i = 0;
-  for (const auto& p : updf) m_ordupdf[i++].addPDF( p );
-  i = 0;
-  for (const auto& p : bpdf) m_ordbpdf[i++].addPDF( p );
-  i = 0;
-  for (const auto& p : tpdf) m_ordtpdf[i++].addPDF( p );
+  addOrdPDF( updf, bpdf, tpdf );
 
   // If all chares on my PE have contributed, send partial sums to host
   if (m_nord == m_nchare) {
@@ -74,26 +74,107 @@ Collector::chareOrd( const std::vector< tk::real >& ord,
     // Zero counters for next collection operation
     std::fill( begin(m_ordinary), end(m_ordinary), 0.0 );
 
-    // Serialize vector of PDFs to raw stream
-    auto stream = tk::serialize( m_ordupdf, m_ordbpdf, m_ordtpdf );
+    // Contribute ordinary PDFs of partial sums to host
+    contributeOrdPDF();
+
+    m_nord = 0;
+  }
+}
+
+void
+Collector::chareFused( const std::vector< tk::real >& fused,
+                       const std::vector< tk::UniPDF >& updf,
+                       const std::vector< tk::BiPDF >& bpdf,
+                       const std::vector< tk::TriPDF >& tpdf )
+// *****************************************************************************
+// Chares contribute ordinary and central moments accumulated in a single pass
+// and ordinary PDFs
+//! \param[in] fused Partial results of single-pass moment accumulation, see
+//!   tk::Statistics::accumulateFused()
+//! \param[in] updf Vector of partial sums for the estimation of univariate
+//!   ordinary PDFs
+//! \param[in] bpdf Vector of partial sums for the estimation of bivariate
+//!   ordinary PDFs
+//! \param[in] tpdf Vector of partial sums for the estimation of trivariate
+//!   ordinary PDFs
+//! \note This function does not have to be declared as a Charm++ entry
+//!   method since it is always called by chares on the same PE.
+// *****************************************************************************
+{
+  ++m_nord;
+
+  tk::Statistics::mergeFused( m_fused, fused.data() );
+
+  // Add contribution from worker chares to partial sums on my PE
+  addOrdPDF( updf, bpdf, tpdf );
+
+  // If all chares on my PE have contributed, send partial results to host
+  if (m_nord == m_nchare) {
 
     // Create Charm++ callback function for reduction.
-    // Distributor::estimateOrdPDF() will be the final target of the reduction
+    // Distributor::estimateFused() will be the final target of the reduction
     // where the results of the reduction will appear.
-    CkCallback c2( CkIndex_Distributor::estimateOrdPDF(nullptr), m_hostproxy );
+    CkCallback c( CkIndex_Distributor::estimateFused(nullptr), m_hostproxy );
 
-    // Contribute serialized PDFs of partial sums to host via Charm++ reduction
-    contribute( stream.first, stream.second.get(), PDFMerger, c2 );
+    // Contribute partial results to host via Charm++ reduction
+    contribute( static_cast< int >( m_fused.size() * sizeof(tk::real) ),
+                m_fused.data(), MomentMerger, c );
 
-    // Zero counters for next collection operation
-    for (auto& p : m_ordupdf) p.zero();
-    for (auto& p : m_ordbpdf) p.zero();
-    for (auto& p : m_ordtpdf) p.zero();
+    // Clear partial results for next collection operation
+    m_fused.clear();
+
+    // Contribute ordinary PDFs of partial sums to host
+    contributeOrdPDF();
 
     m_nord = 0;
   }
 }
 
+void
+Collector::addOrdPDF( const std::vector< tk::UniPDF >& updf,
+                      const std::vector< tk::BiPDF >& bpdf,
+                      const std::vector< tk::TriPDF >& tpdf )
+// *****************************************************************************
+// Add ordinary PDFs contributed by a chare to my partial sums
+//! \param[in] updf Vector of partial sums for the estimation of univariate
+//!   ordinary PDFs
+//! \param[in] bpdf Vector of partial sums for the estimation of bivariate
+//!   ordinary PDFs
+//! \param[in] tpdf Vector of partial sums for the estimation of trivariate
+//!   ordinary PDFs
+// *****************************************************************************
+{
+  std::size_t i = 0;
+  for (const auto& p : updf) m_ordupdf[i++].addPDF( p );
+  i = 0;
+  for (const auto& p : bpdf) m_ordbpdf[i++].addPDF( p );
+  i = 0;
+  for (const auto& p : tpdf) m_ordtpdf[i++].addPDF( p );
+}
+
+void
+Collector::contributeOrdPDF()
+// *****************************************************************************
+// Contribute ordinary PDFs collected on my PE to host
+// *****************************************************************************
+{
+  // Serialize vector of PDFs to raw stream
+  auto stream = tk::serialize( m_ordupdf, m_ordbpdf, m_ordtpdf );
+
+  // Create Charm++ callback function for reduction.
+  // Distributor::estimateOrdPDF() will be the final target of the reduction
+  // where the results of the reduction will appear.
+  CkCallback c( CkIndex_Distributor::estimateOrdPDF(nullptr), m_hostproxy );
+
+  // Contribute serialized PDFs of partial sums to host via Charm++ reduction
+  contribute( stream.first, stream.second.get(), PDFMerger, c );
+
+  // Zero counters for next collection operation
+  for (auto& p : m_ordupdf) p.zero();
+  for (auto& p : m_ordbpdf) p.zero();
+  for (auto& p : m_ordtpdf) p.zero();
+}
+
 void
 Collector::chareCen( const std::vector< tk::real >& cen,
                      const std::vector< tk::UniPDF >& updf,
@@ -18,6 +18,7 @@
 
 #include "Types.hpp"
 #include "PDFReducer.hpp"
+#include "MomentReducer.hpp"
 #include "Distributor.hpp"
 #include "Walker/InputDeck/InputDeck.hpp"
 
@@ -25,6 +26,7 @@ namespace walker {
 
 extern ctr::InputDeck g_inputdeck;
 extern CkReduction::reducerType PDFMerger;
+extern CkReduction::reducerType MomentMerger;
 
 #if defined(__clang__)
   #pragma clang diagnostic push
@@ -50,6 +52,7 @@ class Collector : public CBase_Collector {
       m_ncen( 0 ),
       m_ordinary( g_inputdeck.momentNames( tk::ctr::ordinary ).size(), 0.0 ),
       m_central( g_inputdeck.momentNames( tk::ctr::central ).size(), 0.0 ),
+      m_fused(),
       m_ordupdf(
         tk::ctr::numPDF< 1 >( g_inputdeck.get< tag::discr, tag::binsize >(),
                               g_inputdeck.get< tag::pdf >(),
@@ -76,6 +79,9 @@ class Collector : public CBase_Collector {
                               tk::ctr::Moment::CENTRAL ) )
     {}
 
+    //! Migrate constructor
+    explicit Collector( CkMigrateMessage* m ) : CBase_Collector( m ) {}
+
     //! \brief Configure Charm++ reduction types for collecting PDFs
     //! \details Since this is a [initnode] routine, see collector.ci, the
     //!   Charm++ runtime system executes the routine exactly once on every
@@ -86,6 +92,15 @@ class Collector : public CBase_Collector {
     static void registerPDFMerger()
     { PDFMerger = CkReduction::addReducer( tk::mergePDF ); }
 
+    //! \brief Configure Charm++ reduction type for collecting moments
+    //!   accumulated in a single pass
+    //! \details Since this is a [initnode] routine, see collector.ci, the
+    //!   Charm++ runtime system executes the routine exactly once on every
+    //!   logical node early on in the Charm++ init sequence. Must be static as
+    //!   it is called without an object.
+    static void registerMomentMerger()
+    { MomentMerger = CkReduction::addReducer( tk::mergeMoments ); }
+
     //! Chares register on my PE
     //! \note This function does not have to be declared as a Charm++ entry
     //!   method since it is always called by chares on the same PE.
@@ -103,6 +118,41 @@ class Collector : public CBase_Collector {
                    const std::vector< tk::BiPDF >& bpdf,
                    const std::vector< tk::TriPDF >& tpdf );
 
+    //! \brief Chares contribute ordinary and central moments accumulated in a
+    //!   single pass and ordinary PDFs
+    void chareFused( const std::vector< tk::real >& fused,
+                     const std::vector< tk::UniPDF >& updf,
+                     const std::vector< tk::BiPDF >& bpdf,
+                     const std::vector< tk::TriPDF >& tpdf );
+
+    /** @name Charm++ pack/unpack serializer member functions */
+    ///@{
+    //! \brief Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \note This is a Charm++ group, pup() is thus only for
+    //!    checkpoint/restart.
+    void pup( PUP::er &p ) override {
+      p | m_hostproxy;
+      p | m_nchare;
+      p | m_nord;
+      p | m_ncen;
+      p | m_ordinary;
+      p | m_central;
+      p | m_fused;
+      p | m_ordupdf;
+      p | m_ordbpdf;
+      p | m_ordtpdf;
+      p | m_cenupdf;
+      p | m_cenbpdf;
+      p | m_centpdf;
+      p | m_extra;
+    }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] c Collector object reference
+    friend void operator|( PUP::er& p, Collector& c ) { c.pup(p); }
+    //@}
+
   private:
     CProxy_Distributor m_hostproxy;             //!< Host proxy    
     std::size_t m_nchare;  //!< Number of chares contributing to my PE
@@ -110,6 +160,7 @@ class Collector : public CBase_Collector {
     std::size_t m_ncen;    //!< Number of chares contributed central moments
     std::vector< tk::real > m_ordinary;         //!< Ordinary moments
     std::vector< tk::real > m_central;          //!< Central moments
+    std::vector< tk::real > m_fused;            //!< Single-pass moments
     std::vector< tk::UniPDF > m_ordupdf;        //!< Ordinary univariate PDFs
     std::vector< tk::BiPDF > m_ordbpdf;         //!< Ordinary bivariate PDFs
     std::vector< tk::TriPDF > m_ordtpdf;        //!< Ordinary trivariate PDFs
@@ -117,6 +168,14 @@ class Collector : public CBase_Collector {
     std::vector< tk::BiPDF > m_cenbpdf;         //!< Central bivariate PDFs
     std::vector< tk::TriPDF > m_centpdf;        //!< Central trivariate PDFs
     std::vector< tk::real > m_extra;            //!< Extra statistics data
+
+    //! Add ordinary PDFs contributed by a chare to my partial sums
+    void addOrdPDF( const std::vector< tk::UniPDF >& updf,
+                    const std::vector< tk::BiPDF >& bpdf,
+                    const std::vector< tk::TriPDF >& tpdf );
+
+    //! Contribute ordinary PDFs collected on my PE to host
+    void contributeOrdPDF();
 };
 
 #if defined(__clang__)
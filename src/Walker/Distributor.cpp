@@ -34,15 +34,17 @@
 #include "StatCtr.hpp"
 #include "Exception.hpp"
 #include "Particles.hpp"
-#include "LoadDistributor.hpp"
 #include "Distributor.hpp"
 #include "Integrator.hpp"
 #include "DiffEqStack.hpp"
 #include "TxtStatWriter.hpp"
+#include "BinStatWriter.hpp"
 #include "PDFReducer.hpp"
 #include "PDFWriter.hpp"
+#include "Statistics.hpp"
 #include "Options/PDFFile.hpp"
 #include "Options/PDFPolicy.hpp"
+#include "Options/StatFile.hpp"
 #include "Walker/InputDeck/InputDeck.hpp"
 #include "NoWarning/walker.decl.h"
 
@@ -69,7 +71,15 @@ Distributor::Distributor() :
   m_cenbpdf(),
   m_centpdf(),
   m_tables(),
-  m_moments()
+  m_moments(),
+  m_lagged(),
+  m_statstamp(),
+  m_nstatstep( 0 ),
+  m_nstatout( 0 ),
+  m_stepped( false ),
+  m_stepstat( false ),
+  m_statready( false ),
+  m_pdft( 0.0 )
 // *****************************************************************************
 // Constructor
 // *****************************************************************************
@@ -78,14 +88,9 @@ Distributor::Distributor() :
   const auto& cmd = g_inputdeck.get< tag::cmd >();
 
   // Compute load distribution given total work (= number of particles) and
-  // user-specified virtualization
+  // user-specified virtualization or number of particles per work unit
   uint64_t chunksize = 0, remainder = 0;
-  auto nchare = tk::linearLoadDistributor(
-                  cmd.get< tag::virtualization >(),
-                  g_inputdeck.get< tag::discr, tag::npar >(),
-                  CkNumPes(),
-                  chunksize,
-                  remainder );
+  auto nchare = g_inputdeck.workunits( CkNumPes(), chunksize, remainder );
   Assert( chunksize != 0, "Chunksize must not be zero" );
 
   // Compute total number of particles distributed over all workers. Note that
@@ -101,12 +106,19 @@ Distributor::Distributor() :
   info( print, chunksize, nchare );
 
   // Output header for statistics output file
-  tk::TxtStatWriter sw( !m_nameOrdinary.empty() || !m_nameCentral.empty() ?
-                        cmd.get< tag::io, tag::stat >() :
-                        std::string(),
-                        g_inputdeck.get< tag::flformat, tag::stat >(),
-                        g_inputdeck.get< tag::prec, tag::stat >() );
-  sw.header( m_nameOrdinary, m_nameCentral, m_tables.first );
+  const auto statfile = !m_nameOrdinary.empty() || !m_nameCentral.empty() ?
+                        cmd.get< tag::io, tag::stat >() : std::string();
+  if (g_inputdeck.get< tag::selected, tag::statfile >() ==
+      tk::ctr::StatFileType::BINARY)
+  {
+    tk::BinStatWriter sw( statfile );
+    sw.header( m_nameOrdinary, m_nameCentral, m_tables.first );
+  } else {
+    tk::TxtStatWriter sw( statfile,
+                          g_inputdeck.get< tag::flformat, tag::stat >(),
+                          g_inputdeck.get< tag::prec, tag::stat >() );
+    sw.header( m_nameOrdinary, m_nameCentral, m_tables.first );
+  }
 
   // Print out time integration header
   print.endsubsection();
@@ -120,8 +132,9 @@ Distributor::Distributor() :
   for (const auto& product : g_inputdeck.get< tag::stat >())
     m_moments[ product ] = 0.0;
 
-  // Activate SDAG-wait for estimation of ordinary statistics
-  thisProxy.wait4ord();
+  // Activate SDAG-wait for estimation of ordinary statistics, unless they are
+  // estimated together with the central ones in a single pass
+  if (!g_inputdeck.singlepass()) thisProxy.wait4ord();
   // Activate SDAG-wait for estimation of PDFs at select times
   thisProxy.wait4pdf();
 
@@ -138,6 +151,17 @@ Distributor::Distributor() :
                               static_cast<int>( nchare ) );
 }
 
+Distributor::Distributor( CkMigrateMessage* m ) : CBase_Distributor( m )
+// *****************************************************************************
+//  Migrate constructor: returning from a checkpoint
+//! \param[in] m Charm++ migrate message
+// *****************************************************************************
+{
+  auto print = printer();
+  print.diag( "Restarted from checkpoint" );
+  header( print );
+}
+
 void
 Distributor::info( const WalkerPrint& print,
                    uint64_t chunksize,
@@ -190,6 +214,8 @@ Distributor::info( const WalkerPrint& print,
     print.item( "PDF", cmd.get< tag::io, tag::pdf >() );
   if (!g_inputdeck.get< tag::param, tag::position, tag::depvar >().empty())
     print.item( "Particle positions", cmd.get< tag::io, tag::particles >() );
+  print.item( "Checkpoint/restart directory",
+              cmd.get< tag::io, tag::restart >() + '/' );
 
   // Print discretization parameters
   print.section( "Discretization parameters" );
@@ -210,6 +236,12 @@ Distributor::info( const WalkerPrint& print,
     print.item( "PDF", interval.get< tag::pdf >() );
   if (!g_inputdeck.get< tag::param, tag::position, tag::depvar >().empty())
     print.item( "Particles", interval.get< tag::particles >() );
+  if (!g_inputdeck.get< tag::param, tag::position, tag::depvar >().empty() &&
+      interval.get< tag::sort >() > 0)
+    print.item( "Particles sorting", interval.get< tag::sort >() );
+  print.item( "Checkpoint/restart", cmd.get< tag::rsfreq >() );
+  if (cmd.get< tag::memfreq >() > 0)
+    print.item( "In-memory checkpoint", cmd.get< tag::memfreq >() );
 
   // Print out statistics estimated
   print.statistics( "Statistical moments and distributions" );
@@ -222,6 +254,20 @@ Distributor::info( const WalkerPrint& print,
   print.item( "User load (# of particles)",
               g_inputdeck.get< tag::discr, tag::npar >() );
   print.item( "Chunksize (load per work unit)", chunksize );
+  print.item( "Threads per work unit",
+              g_inputdeck.get< tag::cmd, tag::threads >() );
+  print.item( "Fixed chunksize (PE-independent)",
+              g_inputdeck.get< tag::discr, tag::chunk >() > 0 );
+  print.item( "Number of RNG streams", g_inputdeck.nstream( CkNumPes() ) );
+  print.item( "Single-pass statistics", g_inputdeck.singlepass() );
+  print.item( "Lazy statistics", g_inputdeck.lazy() );
+  print.item( "Asynchronous statistics", g_inputdeck.async() );
+  if (g_inputdeck.get< tag::discr, tag::fuse >() > 0)
+    print.item( "Fused advance (particles per block)",
+                g_inputdeck.get< tag::discr, tag::fuse >() );
+  if (!g_inputdeck.get< tag::pdf >().empty())
+    print.item( "PDF sample fraction",
+                g_inputdeck.get< tag::discr, tag::pdfsample >() );
   print.item( "Actual load (# of particles)",
               std::to_string( nchare * chunksize ) +
               " (=" +
@@ -284,6 +330,26 @@ Distributor::estimateCen( tk::real* cen, [[maybe_unused]] int n )
   estimateCenDone();
 }
 
+void
+Distributor::estimateFused( CkReductionMsg* msg )
+// *****************************************************************************
+// Estimate ordinary and central moments accumulated in a single pass
+//! \param[in] msg Partial results of single-pass moment accumulation merged
+//!   over all chares, see tk::Statistics::accumulateFused()
+// *****************************************************************************
+{
+  // Finish computing moments, i.e., divide sums by the number of samples
+  tk::Statistics::fusedMoments( static_cast< const tk::real* >(msg->getData()),
+                                m_ordinary, m_central );
+
+  delete msg;
+
+  // Activate SDAG triggers signaling that moments have been estimated. Since
+  // no central PDFs are estimated in single-pass mode, signal them done too.
+  estimateCenDone();
+  estimateCenPDFDone();
+}
+
 void
 Distributor::estimateOrdPDF( CkReductionMsg* msg )
 // *****************************************************************************
@@ -299,6 +365,11 @@ Distributor::estimateOrdPDF( CkReductionMsg* msg )
 
   delete msg;
 
+  // Move counts in dense bins to the sparse maps for output
+  for (auto& p : m_ordupdf) p.fold();
+  for (auto& p : m_ordbpdf) p.fold();
+  for (auto& p : m_ordtpdf) p.fold();
+
   // Activate SDAG trigger signaling that ordinary PDFs have been estimated
   estimateOrdPDFDone();
 }
@@ -318,41 +389,81 @@ Distributor::estimateCenPDF( CkReductionMsg* msg )
 
   delete msg;
 
+  // Move counts in dense bins to the sparse maps for output
+  for (auto& p : m_cenupdf) p.fold();
+  for (auto& p : m_cenbpdf) p.fold();
+  for (auto& p : m_centpdf) p.fold();
+
   // Activate SDAG trigger signaling that central PDFs have been estimated
   estimateCenPDFDone();
 }
 
 void
-Distributor::outStat()
+Distributor::outStat( uint64_t it, tk::real t )
 // *****************************************************************************
 // Output statistics to file
+//! \param[in] it Iteration count of the time step the statistics belong to
+//! \param[in] t Physical time at the beginning of that time step
 // *****************************************************************************
 {
   // lambda to sample tables to write to statistics file
-  auto extra = [this]() -> std::vector< tk::real > {
+  auto extra = [this,t]() -> std::vector< tk::real > {
     std::vector< tk::real > x( m_tables.second.size() );
     std::size_t j = 0;
-    for (const auto& t : m_tables.second) x[ j++ ] = tk::sample(m_t,t);
+    for (const auto& tab : m_tables.second) x[ j++ ] = tk::sample(t,tab);
     return x;
   };
 
   // Append statistics file at selected times
-  if (!((m_it+1) % g_inputdeck.get< tag::interval, tag::stat >())) {
-    tk::TxtStatWriter sw( !m_nameOrdinary.empty() || !m_nameCentral.empty() ?
-                          g_inputdeck.get< tag::cmd, tag::io, tag::stat >() :
-                          std::string(),
-                          g_inputdeck.get< tag::flformat, tag::stat >(),
-                          g_inputdeck.get< tag::prec, tag::stat >(),
-                          std::ios_base::app );
-    if (sw.stat( m_it, m_t, m_ordinary, m_central, extra() ))
-      m_output.get< tag::stat >() = true;
+  if (!((it+1) % g_inputdeck.get< tag::interval, tag::stat >())) {
+    const auto statfile = !m_nameOrdinary.empty() || !m_nameCentral.empty() ?
+      g_inputdeck.get< tag::cmd, tag::io, tag::stat >() : std::string();
+    std::size_t n = 0;
+    if (g_inputdeck.get< tag::selected, tag::statfile >() ==
+        tk::ctr::StatFileType::BINARY)
+    {
+      tk::BinStatWriter sw( statfile, std::ios_base::app );
+      n = sw.stat( it, t, m_ordinary, m_central, extra() );
+    } else {
+      tk::TxtStatWriter sw( statfile,
+                            g_inputdeck.get< tag::flformat, tag::stat >(),
+                            g_inputdeck.get< tag::prec, tag::stat >(),
+                            std::ios_base::app );
+      n = sw.stat( it, t, m_ordinary, m_central, extra() );
+    }
+    if (n) m_output.get< tag::stat >() = true;
   }
 }
 
+std::ios_base::openmode
+Distributor::pdfmode( std::uint64_t it ) const
+// *****************************************************************************
+// Configure the file open mode of a PDF output
+//! \param[in] it Iteration count of the PDF output
+//! \return Mode to open the PDF file with: binary PDFs are appended to the
+//!   file of the previous output, unless this is the first output or the PDF
+//!   output file policy is to write a file for each output, all other file
+//!   types are overwritten
+// *****************************************************************************
+{
+  if (g_inputdeck.get< tag::selected, tag::filetype >() !=
+      tk::ctr::PDFFileType::BINARY)
+    return std::ios_base::out;
+
+  if (it == 0 || g_inputdeck.get< tag::selected, tag::pdfpolicy >() ==
+                 tk::ctr::PDFPolicyType::MULTIPLE)
+    return std::ios_base::out | std::ios_base::binary;
+
+  return std::ios_base::out | std::ios_base::app | std::ios_base::binary;
+}
+
 void
-Distributor::outPDF()
+Distributor::outPDF( uint64_t it, tk::real t, tk::real dt )
 // *****************************************************************************
 // Output PDFs to file
+//! \param[in] it Iteration count of the time step the PDFs belong to
+//! \param[in] t Physical time at the beginning of that time step
+//! \param[in] dt Time step size of that time step
 // *****************************************************************************
 {
   const auto term = g_inputdeck.get< tag::discr, tag::term >();
@@ -363,21 +474,22 @@ Distributor::outPDF()
   // output PDFs at t=0 (regardless of whether it was requested), or at
   // selected times, or in the last time step (regardless of whether it was
   // requested
-  if ( m_it == 0 ||
-       !((m_it+1) % pdffreq) ||
-       (std::fabs(m_t+m_dt-term) < eps || (m_it+1) >= nstep) )
+  if ( it == 0 ||
+       !((it+1) % pdffreq) ||
+       (std::fabs(t+dt-term) < eps || (it+1) >= nstep) )
   {
     // Generate iteration count and physical time for PDF output. In the first
     // iteration, the particles are NOT advanced, see Integration::advance(),
     // and we write it=0 and time=0.0 into the PDF files. For the rest of the
     // iterations we write the iteration count and the physical time
     // corresponding to the iteration just completed.
-    auto it = m_it == 0 ? m_it : m_it + 1;
-    auto t = m_it == 0 ? m_t : m_t + m_dt;
+    auto pit = it == 0 ? it : it + 1;
+    auto pt = it == 0 ? t : t + dt;
+    m_pdft = t;
 
-    outUniPDF( it, t );                 // Output univariate PDFs to file(s)
-    outBiPDF( it, t );                  // Output bivariate PDFs to file(s)
-    outTriPDF( it, t );                 // Output trivariate PDFs to file(s)
+    outUniPDF( pit, pt );               // Output univariate PDFs to file(s)
+    outBiPDF( pit, pt );                // Output bivariate PDFs to file(s)
+    outTriPDF( pit, pt );               // Output trivariate PDFs to file(s)
     m_output.get< tag::pdf >() = true;  // Signal that PDFs were written
   }
 }
@@ -415,18 +527,28 @@ Distributor::writeUniPDF( std::uint64_t it,
   // Augment PDF filename by time stamp if PDF output file policy is multiple
   if (g_inputdeck.get< tag::selected, tag::pdfpolicy >() ==
       tk::ctr::PDFPolicyType::MULTIPLE)
-    filename += '_' + std::to_string( m_t );
+    filename += '_' + std::to_string( m_pdft );
+
+  const auto& filetype = g_inputdeck.get< tag::selected, tag::filetype >();
 
-  // Augment PDF filename by '.txt' extension
-  filename += ".txt";
+  // Augment PDF filename by '.bin' extension if binary, '.txt' otherwise
+  if (filetype == tk::ctr::PDFFileType::BINARY)
+    filename += ".bin";
+  else
+    filename += ".txt";
 
-  // Create new PDF file (overwrite if exists)
+  // Create new PDF file (overwrite if exists, unless appending binary)
+  const auto mode = pdfmode( it );
   tk::PDFWriter pdfw( filename,
                       g_inputdeck.get< tag::flformat, tag::pdf >(),
-                      g_inputdeck.get< tag::prec, tag::pdf >() );
+                      g_inputdeck.get< tag::prec, tag::pdf >(),
+                      mode );
 
   // Output PDF
-  pdfw.writeTxt( p, nfo );
+  if (filetype == tk::ctr::PDFFileType::BINARY)
+    pdfw.writeBin( p, nfo, !(mode & std::ios_base::app) );
+  else
+    pdfw.writeTxt( p, nfo );
 }
 
 void
@@ -462,7 +584,7 @@ Distributor::writeBiPDF( std::uint64_t it,
   // Augment PDF filename by time stamp if PDF output file policy is multiple
   if (g_inputdeck.get< tag::selected, tag::pdfpolicy >() ==
       tk::ctr::PDFPolicyType::MULTIPLE)
-    filename += '_' + std::to_string( m_t );
+    filename += '_' + std::to_string( m_pdft );
 
   const auto& filetype = g_inputdeck.get< tag::selected, tag::filetype >();
 
@@ -474,12 +596,16 @@ Distributor::writeBiPDF( std::uint64_t it,
     filename += ".gmsh";
   else if (filetype == tk::ctr::PDFFileType::EXODUSII)
     filename += ".exo";
+  else if (filetype == tk::ctr::PDFFileType::BINARY)
+    filename += ".bin";
   else Throw( "Unkown PDF file type attempting to output bivariate PDF" );
 
-  // Create new PDF file (overwrite if exists)
+  // Create new PDF file (overwrite if exists, unless appending binary)
+  const auto mode = pdfmode( it );
   tk::PDFWriter pdfw( filename,
                       g_inputdeck.get< tag::flformat, tag::pdf >(),
-                      g_inputdeck.get< tag::prec, tag::pdf >() );
+                      g_inputdeck.get< tag::prec, tag::pdf >(),
+                      mode );
 
   // Output PDF
   if (filetype == tk::ctr::PDFFileType::TXT)
@@ -493,6 +619,8 @@ Distributor::writeBiPDF( std::uint64_t it,
   else if (filetype == tk::ctr::PDFFileType::EXODUSII)
     pdfw.writeExodusII( p, nfo,
                         g_inputdeck.get< tag::selected, tag::pdfctr >() );
+  else if (filetype == tk::ctr::PDFFileType::BINARY)
+    pdfw.writeBin( p, nfo, !(mode & std::ios_base::app) );
 }
 
 void
@@ -528,7 +656,7 @@ Distributor::writeTriPDF( std::uint64_t it,
   // Augment PDF filename by time stamp if PDF output file policy is multiple
   if (g_inputdeck.get< tag::selected, tag::pdfpolicy >() ==
       tk::ctr::PDFPolicyType::MULTIPLE)
-    filename += '_' + std::to_string( m_t );
+    filename += '_' + std::to_string( m_pdft );
 
   const auto& filetype = g_inputdeck.get< tag::selected, tag::filetype >();
 
@@ -540,12 +668,16 @@ Distributor::writeTriPDF( std::uint64_t it,
     filename += ".gmsh";
   else if (filetype == tk::ctr::PDFFileType::EXODUSII)
     filename += ".exo";
+  else if (filetype == tk::ctr::PDFFileType::BINARY)
+    filename += ".bin";
   else Throw( "Unkown PDF file type attempting to output trivariate PDF" );
 
-  // Create new PDF file (overwrite if exists)
+  // Create new PDF file (overwrite if exists, unless appending binary)
+  const auto mode = pdfmode( it );
   tk::PDFWriter pdfw( filename,
                       g_inputdeck.get< tag::flformat, tag::pdf >(),
-                      g_inputdeck.get< tag::prec, tag::pdf >() );
+                      g_inputdeck.get< tag::prec, tag::pdf >(),
+                      mode );
 
   // Output PDF
   if (filetype == tk::ctr::PDFFileType::TXT)
@@ -559,6 +691,8 @@ Distributor::writeTriPDF( std::uint64_t it,
   else if (filetype == tk::ctr::PDFFileType::EXODUSII)
     pdfw.writeExodusII( p, nfo,
                         g_inputdeck.get< tag::selected, tag::pdfctr >() );
+  else if (filetype == tk::ctr::PDFFileType::BINARY)
+    pdfw.writeBin( p, nfo, !(mode & std::ios_base::app) );
 }
 
 void
@@ -615,9 +749,143 @@ Distributor::outTriPDF( std::uint64_t it, tk::real t )
 }
 
 void
-Distributor::evaluateTime()
+Distributor::estimated()
+// *****************************************************************************
+// Output statistics and PDFs estimated and continue with the time step
+//! \details Without asynchronous statistics the statistics estimated belong
+//!   to the time step just completed, which is then evaluated. With them, the
+//!   statistics belong to the oldest time step whose statistics are still
+//!   being estimated, and are output as soon as all integrators have finished
+//!   that time step, since it is only then that its time stamp is recorded.
+// *****************************************************************************
+{
+  if (g_inputdeck.async()) {
+    m_statready = true;
+    if (!m_statstamp.empty()) outAsync();
+  } else {
+    outStat( m_it, m_t );       // Output statistics to file
+    outPDF( m_it, m_t, m_dt );  // output PDFs to file
+    evaluateTime();             // evaluate time step, compute new time step
+  }
+}
+
+void
+Distributor::outAsync()
+// *****************************************************************************
+// Output statistics and PDFs estimated asynchronously
+//! \details The reductions of the statistics are assumed to be delivered in
+//!   the order they were started, so the statistics estimated belong to the
+//!   oldest time stamp recorded. The moments are stored until the time step
+//!   they are used in starts, and the estimators are re-armed for the next
+//!   time step estimating statistics.
+// *****************************************************************************
+{
+  Assert( !m_statstamp.empty(), "No time stamp of statistics to output" );
+
+  const auto [ it, t, dt ] = m_statstamp.front();
+  m_statstamp.pop_front();
+  m_statready = false;
+
+  outStat( it, t );
+  outPDF( it, t, dt );
+
+  m_lagged.emplace_back( it, std::map< tk::ctr::Product, tk::real >() );
+  moments( m_lagged.back().second );
+  ++m_nstatout;
+
+  // Re-activate SDAG-wait for estimation of PDFs for next step (single-pass)
+  thisProxy.wait4pdf();
+
+  proceed();
+}
+
+void
+Distributor::stepped( int stat )
+// *****************************************************************************
+//  Charm++ reduction target indicating that all Integrator chares have
+//  finished a time step with asynchronous statistics
+//! \param[in] stat 1 if statistics are being estimated in this time step, 0
+//!   if not
+// *****************************************************************************
+{
+  if (stat) {
+    m_statstamp.emplace_back( m_it, m_t, m_dt );
+    ++m_nstatstep;
+  }
+  m_stepped = true;
+  m_stepstat = stat == 1;
+
+  // Output statistics that have been estimated before their time stamp
+  if (m_statready) outAsync(); else proceed();
+}
+
+void
+Distributor::proceed()
+// *****************************************************************************
+// Continue if all statistics needed by the next time step are output
+//! \details The next time step may start as soon as the statistics of all
+//!   time steps but the one just completed are output, so the integrators use
+//!   moments lagging by one time step, except in the first time step, which
+//!   uses the moments of the initial conditions. Before finishing and before
+//!   saving a checkpoint all statistics are waited for, so no reductions are
+//!   in flight and no statistics are lost.
+// *****************************************************************************
+{
+  if (!m_stepped) return;
+
+  // Predict if time stepping stops or a checkpoint is saved after this step
+  const auto term = g_inputdeck.get< tag::discr, tag::term >();
+  const auto eps = std::numeric_limits< tk::real >::epsilon();
+  const auto nstep = g_inputdeck.get< tag::discr, tag::nstep >();
+  const auto rsfreq = g_inputdeck.get< tag::cmd, tag::rsfreq >();
+  const auto memfreq = g_inputdeck.get< tag::cmd, tag::memfreq >();
+  const auto it = m_it + 1;
+  const auto t = std::min( m_t + m_dt, term );
+  const bool sync = m_it == 0 || std::fabs(t-term) < eps || it >= nstep ||
+                    !(it % rsfreq) || (memfreq > 0 && !(it % memfreq));
+
+  const auto need = sync || !m_stepstat ? m_nstatstep : m_nstatstep - 1;
+  if (m_nstatout < need) return;
+  m_stepped = false;
+
+  // Use the latest moments estimated before the time step just completed
+  const auto last = std::max< uint64_t >( m_it, 1 );
+  while (!m_lagged.empty() && m_lagged.front().first < last) {
+    m_moments = std::move( m_lagged.front().second );
+    m_lagged.pop_front();
+  }
+
+  evaluateTime( /* estimated = */ false );
+}
+
+void
+Distributor::moments( std::map< tk::ctr::Product, tk::real >& m )
+// *****************************************************************************
+// Update moments from the statistics estimated, zero the estimators
+//! \param[in,out] m Map of moments to update
+// *****************************************************************************
+{
+  std::size_t ord = 0;
+  std::size_t cen = 0;
+  for (const auto& product : g_inputdeck.get< tag::stat >())
+    if (tk::ctr::ordinary( product ))
+      m[ product ] = m_ordinary[ ord++ ];
+    else
+      m[ product ] = m_central[ cen++ ];
+
+  // Zero statistics counters and accumulators
+  std::fill( begin(m_ordinary), end(m_ordinary), 0.0 );
+  std::fill( begin(m_central), end(m_central), 0.0 );
+}
+
+void
+Distributor::evaluateTime( bool estimated )
 // *****************************************************************************
 // Evaluate time step, compute new time step size, decide if it is time to quit
+//! \param[in] estimated True if statistics have been estimated in this time
+//!   step. If false, e.g., if statistics are estimated lazily, the moments of
+//!   the previous estimation are kept and the SDAG-waits for the statistics
+//!   remain active for the next time step.
 // *****************************************************************************
 {
   const auto term = g_inputdeck.get< tag::discr, tag::term >();
@@ -638,32 +906,57 @@ Distributor::evaluateTime()
   // Finish if either max iterations or max time reached 
   if ( std::fabs(m_t-term) > eps && m_it < nstep ) {
 
-    if (g_inputdeck.stat()) {
-      // Update map of statistical moments
-      std::size_t ord = 0;
-      std::size_t cen = 0;
-      for (const auto& product : g_inputdeck.get< tag::stat >())
-        if (tk::ctr::ordinary( product ))
-          m_moments[ product ] = m_ordinary[ ord++ ];
-        else
-          m_moments[ product ] = m_central[ cen++ ];
-
-      // Zero statistics counters and accumulators
-      std::fill( begin(m_ordinary), end(m_ordinary), 0.0 );
-      std::fill( begin(m_central), end(m_central), 0.0 );
+    if (estimated && g_inputdeck.stat()) {
+      // Update map of statistical moments, zero estimators
+      moments( m_moments );
 
       // Re-activate SDAG-wait for estimation of ordinary stats for next step
-      thisProxy.wait4ord();
+      if (!g_inputdeck.singlepass()) thisProxy.wait4ord();
       // Re-activate SDAG-wait for estimation of PDFs for next step
       thisProxy.wait4pdf();
     }
 
-    // Continue with next time step with all integrators
-    m_intproxy.advance( m_dt, m_t, m_it, m_moments );
+    // Save checkpoint at selected times, then continue with next time step
+    const auto memfreq = g_inputdeck.get< tag::cmd, tag::memfreq >();
+    if (!(m_it % g_inputdeck.get< tag::cmd, tag::rsfreq >()))
+      checkpoint();
+    else if (memfreq > 0 && !(m_it % memfreq))
+      memcheckpoint();
+    else
+      next();
 
   } else finish();
 }
 
+void
+Distributor::checkpoint()
+// *****************************************************************************
+// Save checkpoint/restart files
+//! \details The checkpoint is saved between two time steps, when no messages
+//!   are in flight, and time stepping continues via resume(), both after the
+//!   checkpoint has been saved and after a run has been restarted from it.
+// *****************************************************************************
+{
+  const auto& restart = g_inputdeck.get< tag::cmd, tag::io, tag::restart >();
+  CkCallback res( CkIndex_Distributor::resume(), thisProxy );
+  CkStartCheckpoint( restart.c_str(), res );
+}
+
+void
+Distributor::memcheckpoint()
+// *****************************************************************************
+// Save double in-memory checkpoint
+//! \details The state of each chare is stored in the memory of its own node
+//!   and of a buddy node. Time stepping continues via resume(), both after
+//!   the checkpoint has been saved and after a run, whose node has failed,
+//!   has been restarted from it on the remaining nodes.
+// *****************************************************************************
+{
+  CkCallback res( CkIndex_Distributor::resume(), thisProxy );
+  CkStartMemCheckpoint( res );
+}
+
+
 void
 Distributor::finish()
 // *****************************************************************************
@@ -684,6 +977,17 @@ Distributor::finish()
      print.note( "Normal finish, maximum time reached: " +
                  std::to_string( term ) );
 
+  // Report particle throughput, including the cost of statistics
+  const auto sec = m_timer[0].dsec();
+  if (sec > 0.0)
+    print.diag( "Particle throughput: " + std::to_string(
+      m_npar * static_cast< tk::real >( m_it ) / sec /
+      static_cast< tk::real >( CkNumPes() ) ) + " particle-steps/s/PE" );
+
+  // Free the particles of a run of an ensemble before the next run starts
+  if (!g_inputdeck.get< tag::cmd, tag::io, tag::ensemble >().empty())
+    m_intproxy.ckDestroy();
+
   // Quit
   mainProxy.finalize();
 }
@@ -693,11 +997,11 @@ Distributor::nostat()
 // *****************************************************************************
 //  Charm++ reduction target enabling shortcutting sync points if no stats
 //! \details This reduction target is called if there are no statistics nor PDFs
-//!   to be estimated and thus some synchronization points can be skipped. Upon
-//!   this call we simply finish up the time step as usual.
+//!   to be estimated (in this time step) and thus some synchronization points
+//!   can be skipped. Upon this call we simply finish up the time step as usual.
 // *****************************************************************************
 {
-  evaluateTime();
+  evaluateTime( /* estimated = */ false );
 }
 
 void
@@ -20,6 +20,8 @@
 
 #include <vector>
 #include <map>
+#include <deque>
+#include <tuple>
 #include <iosfwd>
 #include <cstdint>
 
@@ -70,6 +72,12 @@ class Distributor : public CBase_Distributor {
     //! Constructor
     explicit Distributor();
 
+    //! Migrate constructor: returning from a checkpoint
+    explicit Distributor( CkMigrateMessage* m );
+
+    //! Resume time stepping after a checkpoint has been saved or restarted
+    void resume() { next(); }
+
     //! \brief Reduction target indicating that all Integrator chares have
     //!   registered with the statistics merger (collector)
     //! \details This function is a Charm++ reduction target that is called when
@@ -84,6 +92,9 @@ class Distributor : public CBase_Distributor {
     //! Estimate central moments
     void estimateCen( tk::real* cen, int n );
 
+    //! Estimate ordinary and central moments accumulated in a single pass
+    void estimateFused( CkReductionMsg* msg );
+
     //! Estimate ordinary PDFs
     void estimateOrdPDF( CkReductionMsg* msg );
 
@@ -93,6 +104,48 @@ class Distributor : public CBase_Distributor {
     //! Charm++ reduction target enabling shortcutting sync points if no stats
     void nostat();
 
+    //! \brief Reduction target indicating that all Integrator chares have
+    //!   finished a time step with asynchronous statistics
+    void stepped( int stat );
+
+    /** @name Charm++ pack/unpack serializer member functions */
+    ///@{
+    //! \brief Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \note This is a Charm++ chare, only migrated for checkpoint/restart.
+    void pup( PUP::er &p ) override {
+      p | m_output;
+      p | m_it;
+      p | m_npar;
+      p | m_t;
+      p | m_dt;
+      p | m_intproxy;
+      p | m_timer;
+      p | m_nameOrdinary;
+      p | m_nameCentral;
+      p | m_ordinary;
+      p | m_central;
+      p | m_ordupdf;
+      p | m_ordbpdf;
+      p | m_ordtpdf;
+      p | m_cenupdf;
+      p | m_cenbpdf;
+      p | m_centpdf;
+      p | m_tables;
+      p | m_moments;
+      p | m_lagged;
+      p | m_nstatstep;
+      p | m_nstatout;
+      p | m_stepped;
+      p | m_stepstat;
+      p | m_statready;
+    }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] d Distributor object reference
+    friend void operator|( PUP::er& p, Distributor& d ) { d.pup(p); }
+    //@}
+
   private:
     //! Type alias for output indicators
     using OutputIndicators = tk::TaggedTuple< brigand::list<
@@ -122,6 +175,26 @@ class Distributor : public CBase_Distributor {
                std::vector< tk::Table > > m_tables;
     //! Map used to lookup moments
     std::map< tk::ctr::Product, tk::real > m_moments;
+    //! \brief Moments estimated asynchronously, associated to the iteration
+    //!   count of their time step, not yet used by the integrators
+    std::deque< std::pair< uint64_t,
+                           std::map< tk::ctr::Product, tk::real > > > m_lagged;
+    //! \brief Iteration count, physical time, and time step size of the time
+    //!   steps whose statistics are being estimated asynchronously
+    std::deque< std::tuple< uint64_t, tk::real, tk::real > > m_statstamp;
+    //! Number of time steps that started estimating statistics
+    uint64_t m_nstatstep;
+    //! Number of time steps whose statistics have been output
+    uint64_t m_nstatout;
+    //! True if all integrators finished the time step with async statistics
+    bool m_stepped;
+    //! True if statistics are being estimated in the last time step completed
+    bool m_stepstat;
+    //! True if statistics have been estimated before their time step finished
+    bool m_statready;
+    //! \brief Physical time at the beginning of the time step whose PDFs are
+    //!   being output, used to name PDF files with the multiple-file policy
+    tk::real m_pdft;
 
     //! Print information at startup
     void info( const WalkerPrint& print,
@@ -138,7 +211,10 @@ class Distributor : public CBase_Distributor {
     void report();
 
     //! Output statistics to file
-    void outStat();
+    void outStat( uint64_t it, tk::real t );
+
+    //! Configure the file open mode of a PDF output
+    std::ios_base::openmode pdfmode( std::uint64_t it ) const;
 
     //! Write univariate PDF to file
     void writeUniPDF( std::uint64_t it,
@@ -161,7 +237,7 @@ class Distributor : public CBase_Distributor {
                       std::size_t idx );
 
     //! Output PDFs to file
-    void outPDF();
+    void outPDF( uint64_t it, tk::real t, tk::real dt );
 
     //! Output all requested univariate PDFs to file(s)
     void outUniPDF( std::uint64_t it, tk::real t );
@@ -172,8 +248,29 @@ class Distributor : public CBase_Distributor {
     //! Output all requested trivariate PDFs to file(s)
     void outTriPDF( std::uint64_t it, tk::real t );
 
+    //! Output statistics and PDFs estimated and continue with the time step
+    void estimated();
+
+    //! Output statistics and PDFs estimated asynchronously
+    void outAsync();
+
+    //! Continue if all statistics needed by the next time step are output
+    void proceed();
+
+    //! Update moments from the statistics estimated, zero the estimators
+    void moments( std::map< tk::ctr::Product, tk::real >& m );
+
     //! Evaluate time step, compute new time step size
-    void evaluateTime();
+    void evaluateTime( bool estimated = true );
+
+    //! Save checkpoint/restart files
+    void checkpoint();
+
+    //! Save double in-memory checkpoint
+    void memcheckpoint();
+
+    //! Continue with the next time step with all integrators
+    void next() { m_intproxy.advance( m_dt, m_t, m_it, m_moments ); }
 
     //! Create pretty printer specialized to Walker
     //! \return Pretty printer
@@ -15,13 +15,40 @@
 */
 // *****************************************************************************
 
+#include <array>
+#include <cmath>
+#include <algorithm>
+#include <string>
+#include <cstdint>
+
 #include "Integrator.hpp"
 #include "Collector.hpp"
+#include "RNG.hpp"
+#include "Exception.hpp"
+#include "Reorder.hpp"
 
 namespace walker {
 
+extern std::map< tk::ctr::RawRNGType, tk::RNG > g_rng;
 extern std::vector< DiffEq > g_diffeqs;
 
+//! Add partial sums of moments accumulated by a thread to those of another
+//! \param[in,out] a Partial sums to add to
+//! \param[in] b Partial sums to add
+static void
+addSums( std::vector< tk::real >& a, const std::vector< tk::real >& b ) {
+  for (std::size_t i=0; i<a.size(); ++i) a[i] += b[i];
+}
+
+//! Add partial sums of PDFs accumulated by a thread to those of another
+//! \param[in,out] a Partial sums to add to
+//! \param[in] b Partial sums to add
+template< class PDF >
+static void
+addPDFs( std::vector< PDF >& a, const std::vector< PDF >& b ) {
+  for (std::size_t i=0; i<a.size(); ++i) a[i].addPDF( b[i] );
+}
+
 }
 
 using walker::Integrator;
@@ -33,12 +60,9 @@ Integrator::Integrator( CProxy_Distributor hostproxy,
   m_host( hostproxy ),
   m_coll( collproxy ),
   m_particlewriter( particlewriterproxy ),
-  m_particles( npar, g_inputdeck.get< tag::component >().nprop() ),
-  m_stat( m_particles,
-          g_inputdeck.get< tag::component >().offsetmap( g_inputdeck ),
-          g_inputdeck.get< tag::stat >(),
-          g_inputdeck.get< tag::pdf >(),
-          g_inputdeck.get< tag::discr, tag::binsize >() ),
+  m_particles(),
+  m_stat(),
+  m_diffeqs(),
   m_dt( 0.0 ),
   m_t( 0.0 ),
   m_it( 0 ),
@@ -48,8 +72,24 @@ Integrator::Integrator( CProxy_Distributor hostproxy,
 //! \param[in] hostproxy Host proxy to call back to
 //! \param[in] collproxy Collector proxy to send results to
 //! \param[in] npar Number of particles this integrator advances
+//! \details The particles are split into a population per thread, each
+//!   advanced by the thread using its own random number generator stream and
+//!   its own copy of the differential equations, whose coefficients may be
+//!   updated during time stepping.
 // *****************************************************************************
 {
+  const auto nthread = g_inputdeck.get< tag::cmd, tag::threads >();
+  const auto nprop = g_inputdeck.get< tag::component >().nprop();
+
+  m_particles.reserve( nthread );
+  for (std::size_t t=0; t<nthread; ++t)
+    m_particles.emplace_back( npar/nthread + (t < npar%nthread ? 1 : 0),
+                              nprop );
+
+  setupStatistics();
+
+  if (nthread > 1) m_diffeqs.assign( nthread, g_diffeqs );
+
   // register with the local branch of the statistics collector
   m_coll.ckLocalBranch()->checkin();
   // Tell the Charm++ runtime system to call back to
@@ -62,6 +102,25 @@ Integrator::Integrator( CProxy_Distributor hostproxy,
   contribute( CkCallback(CkReductionTarget(Distributor, registered), m_host) );
 }
 
+void
+Integrator::setupStatistics()
+// *****************************************************************************
+// Instantiate statistics estimators for all particle populations
+// *****************************************************************************
+{
+  const auto offsetmap =
+    g_inputdeck.get< tag::component >().offsetmap( g_inputdeck );
+
+  m_stat.clear();
+  m_stat.reserve( m_particles.size() );
+  for (const auto& p : m_particles)
+    m_stat.emplace_back( p, offsetmap,
+                         g_inputdeck.get< tag::stat >(),
+                         g_inputdeck.get< tag::pdf >(),
+                         g_inputdeck.get< tag::discr, tag::binsize >(),
+                         g_inputdeck.get< tag::discr, tag::extent >() );
+}
+
 void
 Integrator::setup( tk::real dt,
                    tk::real t,
@@ -85,7 +144,13 @@ Integrator::ic()
 // Set initial conditions
 // *****************************************************************************
 {
-  for (const auto& eq : g_diffeqs) eq.initialize( CkMyPe(), m_particles );
+  const auto n = static_cast< std::ptrdiff_t >( m_particles.size() );
+  #pragma omp parallel for
+  for (std::ptrdiff_t i=0; i<n; ++i) {
+    const auto t = static_cast< std::size_t >( i );
+    for (const auto& eq : diffeqs(t))
+      eq.initialize( stream(t), m_particles[t] );
+  }
 }
 
 void
@@ -104,26 +169,44 @@ Integrator::advance( tk::real dt,
   // Advance all equations one step in time. At the 0th iteration skip advance
   // but estimate statistics and (potentially) PDFs (at the interval given by
   // the user).
-  if (it > 0)
-    for (const auto& e : g_diffeqs)
-      e.advance( m_particles, CkMyPe(), dt, t, moments );
+  if (it > 0) {
+    const auto fuse = g_inputdeck.get< tag::discr, tag::fuse >();
+    const auto n = static_cast< std::ptrdiff_t >( m_particles.size() );
+    #pragma omp parallel for
+    for (std::ptrdiff_t i=0; i<n; ++i) {
+      const auto h = static_cast< std::size_t >( i );
+      if (fuse > 0)
+        advanceFused( h, fuse, dt, t, moments );
+      else
+        for (const auto& e : diffeqs(h))
+          e.advance( m_particles[h], stream(h), dt, t, moments );
+    }
+  }
 
   // Save time stepping data
   m_dt = dt;
   m_t = t;
   m_it = it;
 
-  // Contribute number of particles we hit the particles output frequency
   auto poseq =
     !g_inputdeck.get< tag::param, tag::position, tag::depvar >().empty();
+
+  // Sort particles by position if we hit the particles sorting frequency
+  const auto sortfreq = g_inputdeck.get< tag::interval, tag::sort >();
+  if (poseq && sortfreq > 0 && it > 0 && !(it % sortfreq)) sortParticles();
+
+  // Contribute number of particles we hit the particles output frequency
   const auto parfreq = g_inputdeck.get< tag::interval, tag::particles >();
 
   CkCallback c( CkIndex_Integrator::out(), thisProxy[thisIndex] );
 
-  if (poseq && !((m_it+1) % parfreq))
-    m_particlewriter[ CkMyNode() ].npar( m_particles.nunk(), c );
-  else
+  if (poseq && !((m_it+1) % parfreq)) {
+    std::size_t npar = 0;
+    for (const auto& p : m_particles) npar += p.nunk();
+    m_particlewriter[ CkMyNode() ].npar( npar, c );
+  } else {
     c.send();
+  }
 }
 
 void
@@ -140,12 +223,32 @@ Integrator::out()
 
   // Output particles data to file if we hit the particles output frequency
   if (poseq && !((m_it+1) % parfreq)) {
+    const auto& comp = g_inputdeck.get< tag::component >();
     // query position eq offset in particle array (0: only first particle pos)
-    auto po = g_inputdeck.get< tag::component >().offset< tag::position >( 0 );
-    // output particle positions to file
-    m_particlewriter[ CkMyNode() ].
-      writeCoords( m_itp++, m_particles.extract(0,po),
-        m_particles.extract(1,po), m_particles.extract(2,po), c );
+    auto po = comp.offset< tag::position >( 0 );
+    // output the first particle velocity, if any, with the positions
+    std::vector< std::string > names;
+    std::vector< std::vector< tk::real > > fields;
+    if (!g_inputdeck.get< tag::param, tag::velocity, tag::depvar >().empty()) {
+      auto vo = comp.offset< tag::velocity >( 0 );
+      names = { "u", "v", "w" };
+      for (tk::ctr::ncomp_t i=0; i<3; ++i)
+        fields.push_back( extract(i,vo) );
+    }
+    // particle ids unique across integrators, all advancing the same number
+    // of particles
+    std::size_t npar = 0;
+    for (const auto& p : m_particles) npar += p.nunk();
+    std::vector< uint64_t > id( npar );
+    for (std::size_t p=0; p<npar; ++p)
+      id[p] = static_cast< uint64_t >( thisIndex ) * npar + p;
+    // output particle positions, velocities, and ids to file, handing them
+    // over to the particle writer on this compute node by address
+    auto r = new tk::ParticleWriter::Request{ m_itp++, extract(0,po),
+      extract(1,po), extract(2,po), std::move(names), std::move(fields),
+      std::move(id), c };
+    m_particlewriter[ CkMyNode() ].writeLocal(
+      static_cast< uint64_t >( reinterpret_cast< std::uintptr_t >( r ) ) );
   } else {
     c.send();
   }
@@ -155,23 +258,70 @@ void
 Integrator::accumulate()
 // *****************************************************************************
 // Start collecting statistics
+//! \details With asynchronous statistics the partial sums of this time step
+//!   are handed over to the collector, which merges them into its own
+//!   buffers, and the distributor is signaled right away that the particles
+//!   may be advanced in the next time step while the statistics are reduced.
 // *****************************************************************************
 {
-  if (!g_inputdeck.stat()) {// if no stats to estimate, skip to end of time step
+  const bool stat = g_inputdeck.stat() && statstep( m_it, m_t, m_dt );
+
+  if (stat) {
+    if (g_inputdeck.singlepass())
+      // Accumulate ordinary and central moments in a single pass
+      accumulateFused( m_it, m_t, m_dt );
+    else
+      // Accumulate sums for ordinary moments (every time step)
+      accumulateOrd( m_it, m_t, m_dt );
+  }
+
+  if (g_inputdeck.async()) {
+    // Signal end of time step and whether statistics are being estimated
+    int s = stat ? 1 : 0;
+    contribute( sizeof(int), &s, CkReduction::max_int,
+                CkCallback(CkReductionTarget(Distributor,stepped), m_host) );
+  } else if (!stat) {
+    // If no stats to estimate (in this time step), skip to end of time step
     contribute( CkCallback(CkReductionTarget(Distributor, nostat), m_host) );
-  } else {
-    // Accumulate sums for ordinary moments (every time step)
-    accumulateOrd( m_it, m_t, m_dt );
   }
 }
 
 void
-Integrator::accumulateOrd( uint64_t it, tk::real t, tk::real dt )
+Integrator::sortParticles()
 // *****************************************************************************
-// Accumulate sums for ordinary moments and ordinary PDFs
+// Sort particles in memory along the Hilbert curve through positions
+//! \details Each particle population is sorted by its own thread along the
+//!   Hilbert space-filling curve through the positions of the particles, moving
+//!   all particle properties together. Particles close in space are then close
+//!   in memory, which improves the locality of accessing particles by
+//!   position, e.g., binning PDFs over position. Since the statistics
+//!   estimators only hold pointers to the beginning of the particle
+//!   properties, they remain valid.
+// *****************************************************************************
+{
+  const auto& comp = g_inputdeck.get< tag::component >();
+  // query position eq offset in particle array (0: only first particle pos)
+  const auto po = comp.offset< tag::position >( 0 );
+
+  const auto n = static_cast< std::ptrdiff_t >( m_particles.size() );
+  #pragma omp parallel for
+  for (std::ptrdiff_t i=0; i<n; ++i) {
+    auto& p = m_particles[ static_cast< std::size_t >( i ) ];
+    const std::array< std::vector< tk::real >, 3 >
+      coord{{ p.extract(0,po), p.extract(1,po), p.extract(2,po) }};
+    p.reorder( tk::renumberHilbert( coord ) );
+  }
+}
+
+bool
+Integrator::pdfstep( uint64_t it, tk::real t, tk::real dt ) const
+// *****************************************************************************
+// Query if PDFs are to be estimated in this time step
 //! \param[in] it Iteration count
 //! \param[in] t Physical time
 //! \param[in] dt Time step size
+//! \return True if PDFs are to be estimated: at the first and last iterations
+//!   and at select times
 // *****************************************************************************
 {
   const auto term = g_inputdeck.get< tag::discr, tag::term >();
@@ -179,22 +329,130 @@ Integrator::accumulateOrd( uint64_t it, tk::real t, tk::real dt )
   const auto nstep = g_inputdeck.get< tag::discr, tag::nstep >();
   const auto pdffreq = g_inputdeck.get< tag::interval, tag::pdf >();
 
-  // Accumulate partial sums for ordinary moments
-  m_stat.accumulateOrd();
-  // Accumulate sums for ordinary PDFs at first and last iterations and at
-  // select times
-  if ( g_inputdeck.pdf() &&
-       ( it == 0 ||
-         !((it+1) % pdffreq) ||
-         (std::fabs(t+dt-term) < eps && (it+1) >= nstep) ) )
-    m_stat.accumulateOrdPDF();
+  return g_inputdeck.pdf() &&
+         ( it == 0 ||
+           !((it+1) % pdffreq) ||
+           (std::fabs(t+dt-term) < eps && (it+1) >= nstep) );
+}
+
+bool
+Integrator::statstep( uint64_t it, tk::real t, tk::real dt ) const
+// *****************************************************************************
+// Query if statistics are to be estimated in this time step
+//! \param[in] it Iteration count
+//! \param[in] t Physical time
+//! \param[in] dt Time step size
+//! \return True if statistics are to be estimated: in every time step, unless
+//!   estimated lazily, in which case only if they are output in this time step
+// *****************************************************************************
+{
+  const auto statfreq = g_inputdeck.get< tag::interval, tag::stat >();
+
+  return !g_inputdeck.lazy() || !((it+1) % statfreq) || pdfstep( it, t, dt );
+}
+
+std::size_t
+Integrator::pdfstride() const
+// *****************************************************************************
+// Sample stride of particles for PDF estimation
+//! \return Every how many particles are sampled for PDF estimation, given by
+//!   the user-set sample fraction of the particles
+// *****************************************************************************
+{
+  const auto f = g_inputdeck.get< tag::discr, tag::pdfsample >();
+  if (!(f > 0.0) || !(f < 1.0)) return 1;
+  return std::max< std::size_t >( 1, static_cast< std::size_t >(
+                                       std::lround( 1.0/f ) ) );
+}
+
+void
+Integrator::accumulateFused( uint64_t it, tk::real t, tk::real dt )
+// *****************************************************************************
+// Accumulate ordinary and central moments in a single pass and ordinary PDFs
+//! \param[in] it Iteration count
+//! \param[in] t Physical time
+//! \param[in] dt Time step size
+// *****************************************************************************
+{
+  const bool pdf = pdfstep( it, t, dt );
+  const auto stride = pdfstride();
+
+  const auto n = static_cast< std::ptrdiff_t >( m_stat.size() );
+  #pragma omp parallel for
+  for (std::ptrdiff_t i=0; i<n; ++i) {
+    auto& s = m_stat[ static_cast< std::size_t >( i ) ];
+    // Accumulate partial results for ordinary and central moments
+    s.accumulateFused();
+    // Accumulate sums for ordinary PDFs at first and last iterations and at
+    // select times
+    if (pdf) s.accumulateOrdPDF( stride );
+  }
+
+  // Send accumulated moments and ordinary PDFs to collector for estimation,
+  // merged over all threads
+  if (m_stat.size() == 1) {
+    m_coll.ckLocalBranch()->chareFused( m_stat[0].fused(),
+                                        m_stat[0].oupdf(),
+                                        m_stat[0].obpdf(),
+                                        m_stat[0].otpdf() );
+  } else {
+    auto fused = m_stat[0].fused();
+    auto updf = m_stat[0].oupdf();
+    auto bpdf = m_stat[0].obpdf();
+    auto tpdf = m_stat[0].otpdf();
+    for (std::size_t i=1; i<m_stat.size(); ++i) {
+      tk::Statistics::mergeFused( fused, m_stat[i].fused().data() );
+      addPDFs( updf, m_stat[i].oupdf() );
+      addPDFs( bpdf, m_stat[i].obpdf() );
+      addPDFs( tpdf, m_stat[i].otpdf() );
+    }
+    m_coll.ckLocalBranch()->chareFused( fused, updf, bpdf, tpdf );
+  }
+}
+
+void
+Integrator::accumulateOrd( uint64_t it, tk::real t, tk::real dt )
+// *****************************************************************************
+// Accumulate sums for ordinary moments and ordinary PDFs
+//! \param[in] it Iteration count
+//! \param[in] t Physical time
+//! \param[in] dt Time step size
+// *****************************************************************************
+{
+  const bool pdf = pdfstep( it, t, dt );
+  const auto stride = pdfstride();
+
+  const auto n = static_cast< std::ptrdiff_t >( m_stat.size() );
+  #pragma omp parallel for
+  for (std::ptrdiff_t i=0; i<n; ++i) {
+    auto& s = m_stat[ static_cast< std::size_t >( i ) ];
+    // Accumulate partial sums for ordinary moments
+    s.accumulateOrd();
+    // Accumulate sums for ordinary PDFs at first and last iterations and at
+    // select times
+    if (pdf) s.accumulateOrdPDF( stride );
+  }
 
   // Send accumulated ordinary moments and ordinary PDFs to collector for
-  // estimation
-  m_coll.ckLocalBranch()->chareOrd( m_stat.ord(),
-                                    m_stat.oupdf(),
-                                    m_stat.obpdf(),
-                                    m_stat.otpdf() );
+  // estimation, summed over all threads
+  if (m_stat.size() == 1) {
+    m_coll.ckLocalBranch()->chareOrd( m_stat[0].ord(),
+                                      m_stat[0].oupdf(),
+                                      m_stat[0].obpdf(),
+                                      m_stat[0].otpdf() );
+  } else {
+    auto ord = m_stat[0].ord();
+    auto updf = m_stat[0].oupdf();
+    auto bpdf = m_stat[0].obpdf();
+    auto tpdf = m_stat[0].otpdf();
+    for (std::size_t i=1; i<m_stat.size(); ++i) {
+      addSums( ord, m_stat[i].ord() );
+      addPDFs( updf, m_stat[i].oupdf() );
+      addPDFs( bpdf, m_stat[i].obpdf() );
+      addPDFs( tpdf, m_stat[i].otpdf() );
+    }
+    m_coll.ckLocalBranch()->chareOrd( ord, updf, bpdf, tpdf );
+  }
 }
 
 void
@@ -210,26 +468,167 @@ Integrator::accumulateCen( uint64_t it,
 //! \param[in] ord Estimated ordinary moments (collected from all PEs)
 // *****************************************************************************
 {
-  const auto term = g_inputdeck.get< tag::discr, tag::term >();
-  const auto eps = std::numeric_limits< tk::real >::epsilon();
-  const auto nstep = g_inputdeck.get< tag::discr, tag::nstep >();
-  const auto pdffreq = g_inputdeck.get< tag::interval, tag::pdf >();
+  const bool pdf = pdfstep( it, t, dt );
+  const auto stride = pdfstride();
+
+  const auto n = static_cast< std::ptrdiff_t >( m_stat.size() );
+  #pragma omp parallel for
+  for (std::ptrdiff_t i=0; i<n; ++i) {
+    auto& s = m_stat[ static_cast< std::size_t >( i ) ];
+    // Accumulate partial sums for central moments
+    s.accumulateCen( ord );
+    // Accumulate partial sums for central PDFs at first and last iteraions
+    // and at select times
+    if (pdf) s.accumulateCenPDF( ord, stride );
+  }
 
-  // Accumulate partial sums for central moments
-  m_stat.accumulateCen( ord );
-  // Accumulate partial sums for central PDFs at first and last iteraions and
-  // at select times
-  if ( g_inputdeck.pdf() &&
-       ( it == 0 ||
-         !((it+1) % pdffreq) ||
-         (std::fabs(t+dt-term) < eps && (it+1) >= nstep) ) )
-    m_stat.accumulateCenPDF( ord );
-
-  // Send accumulated central moments to host for estimation
-  m_coll.ckLocalBranch()->chareCen( m_stat.ctr(),
-                                    m_stat.cupdf(),
-                                    m_stat.cbpdf(),
-                                    m_stat.ctpdf() );
+  // Send accumulated central moments to host for estimation, summed over all
+  // threads
+  if (m_stat.size() == 1) {
+    m_coll.ckLocalBranch()->chareCen( m_stat[0].ctr(),
+                                      m_stat[0].cupdf(),
+                                      m_stat[0].cbpdf(),
+                                      m_stat[0].ctpdf() );
+  } else {
+    auto cen = m_stat[0].ctr();
+    auto updf = m_stat[0].cupdf();
+    auto bpdf = m_stat[0].cbpdf();
+    auto tpdf = m_stat[0].ctpdf();
+    for (std::size_t i=1; i<m_stat.size(); ++i) {
+      addSums( cen, m_stat[i].ctr() );
+      addPDFs( updf, m_stat[i].cupdf() );
+      addPDFs( bpdf, m_stat[i].cbpdf() );
+      addPDFs( tpdf, m_stat[i].ctpdf() );
+    }
+    m_coll.ckLocalBranch()->chareCen( cen, updf, bpdf, tpdf );
+  }
+}
+
+void
+Integrator::advanceFused(
+  std::size_t thread,
+  std::size_t blksize,
+  tk::real dt,
+  tk::real t,
+  const std::map< tk::ctr::Product, tk::real >& moments )
+// *****************************************************************************
+// Advance the particles of a thread by all equations a block at a time
+//! \param[in] thread Thread index
+//! \param[in] blksize Number of particles advanced by all equations together
+//! \param[in] dt Size of time step
+//! \param[in] t Physical time
+//! \param[in] moments Map of statistical moments
+//! \details All properties of a block of particles are copied to a buffer,
+//!   which is advanced by all equations in the order configured, as they are
+//!   advanced without fusion, and copied back. Coupled equations thus find
+//!   the properties they are coupled to in cache, instead of streaming all
+//!   particles through memory once per equation.
+// *****************************************************************************
+{
+  auto& particles = m_particles[ thread ];
+  const auto npar = particles.nunk();
+  const auto nprop = particles.nprop();
+  const auto& eqs = diffeqs( thread );
+  const auto s = stream( thread );
+
+  tk::Particles blk( std::min( blksize, npar ), nprop );
+  for (std::size_t p0=0; p0<npar; p0+=blksize) {
+    const auto n = std::min( blksize, npar-p0 );
+    if (n != blk.nunk()) blk = tk::Particles( n, nprop );
+    for (std::size_t c=0; c<nprop; ++c)
+      for (std::size_t p=0; p<n; ++p) blk( p, c, 0 ) = particles( p0+p, c, 0 );
+    for (const auto& e : eqs) e.advance( blk, s, dt, t, moments );
+    for (std::size_t c=0; c<nprop; ++c)
+      for (std::size_t p=0; p<n; ++p) particles( p0+p, c, 0 ) = blk( p, c, 0 );
+  }
+}
+
+const std::vector< walker::DiffEq >&
+Integrator::diffeqs( std::size_t thread ) const
+// *****************************************************************************
+// Access differential equations advanced by a thread
+//! \param[in] thread Thread index
+//! \return Copy of the differential equations of the thread if multi-threaded,
+//!   the global-scope differential equations if single-threaded
+// *****************************************************************************
+{
+  return m_diffeqs.empty() ? g_diffeqs : m_diffeqs[ thread ];
+}
+
+int
+Integrator::stream( std::size_t thread ) const
+// *****************************************************************************
+// Random number generator stream of a thread
+//! \param[in] thread Thread index
+//! \return Stream index, unique across all threads of all work units
+//! \details The stream is keyed on the index of the work unit, not on the PE
+//!   it is advanced on, so the particles of a thread receive the same random
+//!   numbers independent of the number of PEs and after migration.
+// *****************************************************************************
+{
+  return thisIndex * static_cast< int >( m_particles.size() ) +
+         static_cast< int >( thread );
+}
+
+std::vector< tk::real >
+Integrator::extract( tk::ctr::ncomp_t component,
+                     tk::ctr::ncomp_t offset ) const
+// *****************************************************************************
+// Extract a particle property from all populations
+//! \param[in] component Component index
+//! \param[in] offset System offset
+//! \return Particle property of all particles of all threads in thread order
+// *****************************************************************************
+{
+  std::vector< tk::real > v;
+  for (const auto& p : m_particles) {
+    auto e = p.extract( component, offset );
+    v.insert( end(v), begin(e), end(e) );
+  }
+  return v;
+}
+
+void
+Integrator::pup( PUP::er &p )
+// *****************************************************************************
+// Pack/Unpack serialize member function
+//! \param[in,out] p Charm++'s PUP::er serializer object reference
+//! \details Besides the particle properties, the states of the random number
+//!   generator streams of the threads and the random numbers generated in
+//!   advance by the differential equations are packed. A run restarted from a
+//!   checkpoint on the same number of PEs and threads thus continues with the
+//!   same random numbers as the run that saved the checkpoint, yielding bitwise
+//!   identical results. The statistics estimators are not packed but
+//!   instantiated again: they hold pointers into the particle properties and
+//!   their sums are only used within a time step.
+// *****************************************************************************
+{
+  p | m_host;
+  p | m_coll;
+  p | m_particlewriter;
+  p | m_particles;
+  p | m_dt;
+  p | m_t;
+  p | m_it;
+  p | m_itp;
+
+  if (p.isUnpacking()) {
+    setupStatistics();
+    m_diffeqs.clear();
+    const auto nthread = m_particles.size();
+    if (nthread > 1) m_diffeqs.assign( nthread, g_diffeqs );
+    for (const auto& r : g_rng)
+      ErrChk( static_cast< std::size_t >( stream( nthread-1 ) ) <
+                r.second.nthreads(),
+              "Not enough random number generator streams for work unit " +
+              std::to_string( thisIndex ) + " after restart: fix the number "
+              "of particles per work unit, see keyword 'chunk'" );
+  }
+
+  for (std::size_t t=0; t<m_particles.size(); ++t) {
+    for (const auto& r : g_rng) r.second.pupstate( p, stream(t) );
+    for (const auto& e : diffeqs(t)) e.pupstate( p );
+  }
 }
 
 #include "NoWarning/integrator.def.h"
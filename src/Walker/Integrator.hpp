@@ -53,13 +53,7 @@ class Integrator : public CBase_Integrator {
 
     //! Migrate constructor
     // cppcheck-suppress uninitMemberVar
-    explicit Integrator( CkMigrateMessage* ) :
-      m_particles( 0, g_inputdeck.get< tag::component >().nprop() ),
-      m_stat( m_particles,
-              g_inputdeck.get< tag::component >().offsetmap( g_inputdeck ),
-              g_inputdeck.get< tag::stat >(),
-              g_inputdeck.get< tag::pdf >(),
-              g_inputdeck.get< tag::discr, tag::binsize >() ) {}
+    explicit Integrator( CkMigrateMessage* ) {}
 
     //! Perform setup: set initial conditions and advance a time step
     void setup( tk::real dt,
@@ -88,19 +82,71 @@ class Integrator : public CBase_Integrator {
                         tk::real dt,
                         const std::vector< tk::real >& ord );
 
+    /** @name Charm++ pack/unpack serializer member functions */
+    ///@{
+    //! \brief Pack/Unpack serialize member function
+    void pup( PUP::er &p ) override;
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] i Integrator object reference
+    friend void operator|( PUP::er& p, Integrator& i ) { i.pup(p); }
+    //@}
+
   private:
     CProxy_Distributor m_host;     //!< Host proxy
     CProxy_Collector m_coll;       //!< Collector proxy
     tk::CProxy_ParticleWriter m_particlewriter;  //!< Particle writer proxy
-    tk::Particles m_particles;     //!< Particle properties
-    tk::Statistics m_stat;         //!< Statistics
+    //! \brief Particle properties, one population per thread, each advanced
+    //!   by a thread using its own random number generator stream
+    std::vector< tk::Particles > m_particles;
+    //! Statistics, one per thread, accumulated from its particle population
+    std::vector< tk::Statistics > m_stat;
+    //! \brief Differential equations, one copy per thread if multi-threaded,
+    //!   empty if single-threaded, using the global-scope equations
+    std::vector< std::vector< DiffEq > > m_diffeqs;
     tk::real m_dt;                 //!< Time step size
     tk::real m_t;                  //!< Physical time
     uint64_t m_it;                 //!< Iteration count
     uint64_t m_itp;                //!< Particle position output iteration count
 
+    //! Instantiate statistics estimators for all particle populations
+    void setupStatistics();
+
+    //! Sort particles in memory along the Hilbert curve through positions
+    void sortParticles();
+
     // Accumulate sums for ordinary moments and ordinary PDFs
     void accumulateOrd( uint64_t it, tk::real t, tk::real dt );
+
+    //! \brief Accumulate ordinary and central moments in a single pass and
+    //!   ordinary PDFs
+    void accumulateFused( uint64_t it, tk::real t, tk::real dt );
+
+    //! Query if PDFs are to be estimated in this time step
+    bool pdfstep( uint64_t it, tk::real t, tk::real dt ) const;
+
+    //! Query if statistics are to be estimated in this time step
+    bool statstep( uint64_t it, tk::real t, tk::real dt ) const;
+
+    //! Sample stride of particles for PDF estimation
+    std::size_t pdfstride() const;
+
+    //! Advance the particles of a thread by all equations a block at a time
+    void advanceFused( std::size_t thread,
+                       std::size_t blksize,
+                       tk::real dt,
+                       tk::real t,
+                       const std::map< tk::ctr::Product, tk::real >& moments );
+
+    //! Access differential equations advanced by a thread
+    const std::vector< DiffEq >& diffeqs( std::size_t thread ) const;
+
+    //! Random number generator stream of a thread
+    int stream( std::size_t thread ) const;
+
+    //! Extract a particle property from all populations
+    std::vector< tk::real > extract( tk::ctr::ncomp_t component,
+                                     tk::ctr::ncomp_t offset ) const;
 };
 
 #if defined(__clang__)
@@ -0,0 +1,122 @@
+################################################################################
+#
+# \file      tests/regression/inciter/scaling/check_timing.cmake
+# \copyright 2012-2015 J. Bakosi,
+#            2016-2018 Los Alamos National Security, LLC.,
+#            2019-2020 Triad National Security, LLC.
+#            All rights reserved. See the LICENSE file for details.
+# \brief     Check the timings of a scaling benchmark against a baseline
+#
+################################################################################
+
+# Run as the postprocessor of a scaling benchmark, see CMakeLists.txt in this
+# directory, as
+#
+#   cmake -DPERF=<log> -DPERFFREQ=<n> -DBASELINE=<file> -DTOLERANCE=<percent>
+#         -DRESULT=<file> -P check_timing.cmake
+#
+# PERF - Performance log written by inciter, whose rows are appended every
+#        PERFFREQ time steps, see Transporter::perf().
+#
+# BASELINE - File with the known good timings of the benchmark, in the format
+#            of RESULT. If it does not exist, the timings are only reported.
+#
+# TOLERANCE - Percentage the time per step may exceed that of the baseline.
+#
+# RESULT - File to write the timings measured to, which can be copied to
+#          BASELINE to accept them.
+#
+# The first row is skipped as it includes the warm-up of the first time steps.
+# Times are handled as integer nanoseconds since cmake has no floating point
+# arithmetic.
+
+cmake_minimum_required(VERSION 3.1.0)
+
+# Convert a number in scientific format, e.g., 1.234567e-03, from seconds to
+# integer nanoseconds
+function(to_ns value result)
+  if (NOT value MATCHES "^([0-9])\\.([0-9]+)e([+-])0*([0-9]+)$")
+    message(FATAL_ERROR "Cannot parse time '${value}' in ${PERF}")
+  endif()
+  set(digits "${CMAKE_MATCH_1}${CMAKE_MATCH_2}")
+  string(LENGTH "${CMAKE_MATCH_2}" nfrac)
+  math(EXPR e "${CMAKE_MATCH_3}${CMAKE_MATCH_4} - ${nfrac} + 9")
+  string(REGEX REPLACE "^0+([0-9])" "\\1" ns "${digits}")
+  while (e GREATER 0)
+    math(EXPR ns "${ns} * 10")
+    math(EXPR e "${e} - 1")
+  endwhile()
+  while (e LESS 0)
+    math(EXPR ns "${ns} / 10")
+    math(EXPR e "${e} + 1")
+  endwhile()
+  set(${result} ${ns} PARENT_SCOPE)
+endfunction()
+
+if (NOT EXISTS ${PERF})
+  message(FATAL_ERROR "Performance log '${PERF}' not found, run inciter with "
+                      "--perffreq")
+endif()
+
+# Sum the average time of all phases, i.e., the wall-clock time of the steps,
+# and the maximum busy time, across the rows of the log
+file(STRINGS ${PERF} rows REGEX "^[0-9]")
+list(LENGTH rows nrow)
+if (nrow LESS 2)
+  message(FATAL_ERROR "Need at least 2 rows in '${PERF}', found ${nrow}")
+endif()
+list(REMOVE_AT rows 0)
+math(EXPR nrow "${nrow} - 1")
+
+set(step 0)
+set(busy 0)
+foreach(row IN LISTS rows)
+  string(REGEX REPLACE " +" ";" col "${row}")
+  # columns: it, min/avg/max of each phase, busy_avg, busy_max, ...
+  list(LENGTH col ncol)
+  math(EXPR nphase "(${ncol} - 6) / 3")
+  math(EXPR last "${nphase} - 1")
+  foreach(p RANGE ${last})
+    math(EXPR c "2 + 3*${p}")
+    list(GET col ${c} t)
+    to_ns(${t} ns)
+    math(EXPR step "${step} + ${ns}")
+  endforeach()
+  math(EXPR c "1 + 3*${nphase} + 1")
+  list(GET col ${c} t)
+  to_ns(${t} ns)
+  math(EXPR busy "${busy} + ${ns}")
+endforeach()
+
+# Average per time step
+math(EXPR nstep "${nrow} * ${PERFFREQ}")
+math(EXPR step "${step} / ${nstep}")
+math(EXPR busy "${busy} / ${nstep}")
+
+file(WRITE ${RESULT} "step_ns ${step}\nbusy_max_ns ${busy}\n")
+message("Time per step: ${step} ns, busiest chare: ${busy} ns, averaged over "
+        "${nstep} steps")
+
+# Remove log so rows of reruns do not mix with those of this run
+file(RENAME ${PERF} ${PERF}.last)
+
+if (NOT EXISTS ${BASELINE})
+  message("No baseline '${BASELINE}', copy '${RESULT}' there to accept the "
+          "timings measured")
+  return()
+endif()
+
+file(STRINGS ${BASELINE} base REGEX "^step_ns ")
+string(REGEX REPLACE "^step_ns ([0-9]+).*" "\\1" base "${base}")
+if (NOT base MATCHES "^[0-9]+$")
+  message(FATAL_ERROR "No step_ns in baseline '${BASELINE}'")
+endif()
+
+math(EXPR limit "${base} * (100 + ${TOLERANCE}) / 100")
+math(EXPR ratio "${step} * 100 / ${base}")
+if (step GREATER limit)
+  message(FATAL_ERROR "Performance regression: time per step ${step} ns is "
+          "${ratio}% of the baseline ${base} ns, tolerance ${TOLERANCE}%")
+endif()
+message("Time per step is ${ratio}% of the baseline ${base} ns, within the "
+        "tolerance of ${TOLERANCE}%")
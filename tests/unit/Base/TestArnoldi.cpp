@@ -0,0 +1,160 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Base/TestArnoldi.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for Base/Arnoldi.hpp
+  \details   Unit tests for Base/Arnoldi.hpp
+*/
+// *****************************************************************************
+
+#include <cmath>
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "Arnoldi.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct Arnoldi_common {
+  // cppcheck-suppress unusedStructMember
+  double precision = 1.0e-12;    // required floating-point precision
+
+  //! Dense matrix stored row by row
+  using Matrix = std::vector< std::vector< tk::real > >;
+
+  //! Matrix-vector product
+  static std::vector< tk::real > mult( const Matrix& A,
+                                       const std::vector< tk::real >& x )
+  {
+    std::vector< tk::real > y( A.size(), 0.0 );
+    for (std::size_t i=0; i<A.size(); ++i)
+      for (std::size_t j=0; j<x.size(); ++j)
+        y[i] += A[i][j] * x[j];
+    return y;
+  }
+
+  //! Dot product
+  static tk::real dot( const std::vector< tk::real >& a,
+                       const std::vector< tk::real >& b )
+  {
+    tk::real s = 0.0;
+    for (std::size_t i=0; i<a.size(); ++i) s += a[i]*b[i];
+    return s;
+  }
+
+  //! \brief Run GMRES (zero initial guess, no restart) with tk::Arnoldi
+  //! \param[in] A Matrix
+  //! \param[in] b Right hand side
+  //! \param[in] m Number of iterations
+  //! \param[out] res Residual norm estimates returned after each iteration
+  //! \return Approximate solution after m iterations
+  static std::vector< tk::real > gmres( const Matrix& A,
+                                        const std::vector< tk::real >& b,
+                                        std::size_t m,
+                                        std::vector< tk::real >& res )
+  {
+    tk::Arnoldi arnoldi;
+    auto beta = std::sqrt( dot(b,b) );
+    arnoldi.start( beta );
+    std::vector< std::vector< tk::real > > v( 1, b );
+    for (auto& x : v[0]) x /= beta;
+    for (std::size_t j=0; j<m; ++j) {
+      auto w = mult( A, v[j] );
+      std::vector< tk::real > h( j+1 );
+      for (std::size_t i=0; i<=j; ++i) h[i] = dot( w, v[i] );
+      for (std::size_t i=0; i<=j; ++i)
+        for (std::size_t k=0; k<w.size(); ++k) w[k] -= h[i] * v[i][k];
+      auto hnext = std::sqrt( dot(w,w) );
+      res.push_back( arnoldi.add( h, hnext ) );
+      if (hnext > 0.0) for (auto& x : w) x /= hnext;
+      v.push_back( w );
+    }
+    auto y = arnoldi.solve();
+    std::vector< tk::real > x( b.size(), 0.0 );
+    for (std::size_t i=0; i<y.size(); ++i)
+      for (std::size_t k=0; k<x.size(); ++k) x[k] += y[i] * v[i][k];
+    return x;
+  }
+};
+
+//! Test group shortcuts
+using Arnoldi_group = test_group< Arnoldi_common, MAX_TESTS_IN_GROUP >;
+using Arnoldi_object = Arnoldi_group::object;
+
+//! Define test group
+static Arnoldi_group Arnoldi( "Base/Arnoldi" );
+
+//! Test definitions for group
+
+//! Test that GMRES with full Krylov subspace solves a nonsymmetric system
+template<> template<>
+void Arnoldi_object::test< 1 >() {
+  set_test_name( "full subspace solves nonsymmetric system" );
+
+  Matrix A{{ { 4.0, 1.0, 0.0, 2.0 },
+             { -1.0, 5.0, 1.0, 0.0 },
+             { 0.5, 0.0, 3.0, -1.0 },
+             { 1.0, 2.0, 0.0, 6.0 } }};
+  std::vector< tk::real > xc{ 1.0, -2.0, 3.0, 0.5 };
+  auto b = mult( A, xc );
+
+  std::vector< tk::real > res;
+  auto x = gmres( A, b, 4, res );
+
+  for (std::size_t i=0; i<x.size(); ++i)
+    ensure_equals( "solution incorrect", x[i], xc[i], precision );
+  ensure( "final residual estimate not zero", res.back() < precision );
+}
+
+//! Test that the residual estimate equals the true residual norm
+template<> template<>
+void Arnoldi_object::test< 2 >() {
+  set_test_name( "residual estimate" );
+
+  Matrix A{{ { 2.0, -1.0, 0.0, 0.0, 1.0 },
+             { -1.0, 3.0, -1.0, 0.0, 0.0 },
+             { 0.0, 2.0, 4.0, -1.0, 0.0 },
+             { 0.0, 0.0, -1.0, 2.0, 0.5 },
+             { 1.0, 0.0, 0.0, -2.0, 5.0 } }};
+  std::vector< tk::real > b{ 1.0, 0.0, -1.0, 2.0, 1.0 };
+
+  for (std::size_t m=1; m<=5; ++m) {
+    std::vector< tk::real > res;
+    auto x = gmres( A, b, m, res );
+    auto r = mult( A, x );
+    for (std::size_t k=0; k<r.size(); ++k) r[k] = b[k] - r[k];
+    ensure_equals( "residual estimate incorrect",
+                   res.back(), std::sqrt( dot(r,r) ), precision );
+    if (m > 1)
+      ensure( "residual increased", res[m-1] <= res[m-2] + precision );
+  }
+}
+
+//! Test lucky breakdown: identity converges in a single iteration
+template<> template<>
+void Arnoldi_object::test< 3 >() {
+  set_test_name( "breakdown with identity" );
+
+  Matrix A{{ { 1.0, 0.0, 0.0 },
+             { 0.0, 1.0, 0.0 },
+             { 0.0, 0.0, 1.0 } }};
+  std::vector< tk::real > b{ 3.0, -4.0, 12.0 };
+
+  std::vector< tk::real > res;
+  auto x = gmres( A, b, 1, res );
+
+  ensure_equals( "residual estimate not zero", res[0], 0.0, precision );
+  for (std::size_t i=0; i<x.size(); ++i)
+    ensure_equals( "solution incorrect", x[i], b[i], precision );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
@@ -0,0 +1,99 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Base/TestBenchmark.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for Base/Benchmark.hpp
+  \details   Unit tests for Base/Benchmark.hpp
+*/
+// *****************************************************************************
+
+#include <sstream>
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "Benchmark.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct Benchmark_common {};
+
+//! Test group shortcuts
+using Benchmark_group = test_group< Benchmark_common, MAX_TESTS_IN_GROUP >;
+using Benchmark_object = Benchmark_group::object;
+
+//! Define test group
+static Benchmark_group Benchmark( "Base/Benchmark" );
+
+//! Test definitions for group
+
+//! Test that only benchmarks selected by the filter are run
+template<> template<>
+void Benchmark_object::test< 1 >() {
+  set_test_name( "filter" );
+
+  tk::Benchmark b( 1.0e-4, "riemann" );
+  std::size_t n = 0;
+  bool ran = b.run( "eos:pressure", 1, 8, [&](){ ++n; } );
+
+  ensure( "benchmark not selected run", !ran );
+  ensure_equals( "calls of benchmark not selected", n, 0UL );
+  ensure( "benchmark selected not run",
+          b.run( "riemann:hllc", 1, 8, [&](){ ++n; } ) );
+  ensure_equals( "number of results", b.results().size(), 1UL );
+  ensure_equals( "name of result", b.results()[0].name,
+                 std::string( "riemann:hllc" ) );
+}
+
+//! Test that a benchmark is repeated for at least the minimum time
+template<> template<>
+void Benchmark_object::test< 2 >() {
+  set_test_name( "repetitions and rates" );
+
+  tk::Benchmark b( 1.0e-3 );
+  std::vector< tk::real > v( 1000, 1.0 );
+  std::size_t n = 0;
+  b.run( "sum", v.size(), v.size()*sizeof(tk::real), [&](){
+    tk::real s = 0.0;
+    for (auto x : v) s += x;
+    tk::doNotOptimize( s );
+    ++n; } );
+
+  const auto& r = b.results().at(0);
+  ensure( "too few calls", n > r.reps );
+  ensure( "nonpositive time", r.time > 0.0 );
+  ensure_equals( "time per operation", r.nsop(), r.time*1.0e9/1000.0, 1.0e-6 );
+  ensure_equals( "bandwidth", r.gbs(), 8000.0/r.time/1.0e9, 1.0e-6 );
+}
+
+//! Test that the JSON output holds the context and the results
+template<> template<>
+void Benchmark_object::test< 3 >() {
+  set_test_name( "json" );
+
+  tk::Benchmark b( 1.0e-4 );
+  b.run( "a", 1, 0, [](){} );
+  b.run( "b", 1, 0, [](){} );
+  std::stringstream ss;
+  b.json( ss, { { "executable", "my\"bench" } } );
+  const auto s = ss.str();
+
+  ensure( "context missing",
+          s.find( "\"executable\": \"my\\\"bench\"" ) != std::string::npos );
+  ensure( "first result missing",
+          s.find( "{\"name\": \"a\"" ) != std::string::npos );
+  ensure( "second result missing",
+          s.find( "{\"name\": \"b\"" ) != std::string::npos );
+  ensure( "time unit missing",
+          s.find( "\"time_unit\": \"ns\"" ) != std::string::npos );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
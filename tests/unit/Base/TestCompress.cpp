@@ -0,0 +1,104 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Base/TestCompress.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for Base/Compress.hpp
+  \details   Unit tests for Base/Compress.hpp
+*/
+// *****************************************************************************
+
+#include <random>
+#include <cstring>
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "Types.hpp"
+#include "Compress.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct Compress_common {
+
+  //! Compress and decompress data and verify the round trip
+  //! \param[in] d Data to compress
+  //! \return Size of compressed data
+  std::size_t roundtrip( const std::vector< char >& d ) {
+    auto c = tk::compress( d.data(), d.size() );
+    auto r = tk::decompress( c );
+    ensure( "round trip incorrect", r == d );
+    return c.size();
+  }
+
+  //! Convert an array of numbers to bytes
+  //! \param[in] v Array of numbers
+  //! \return Bytes of numbers
+  template< class T >
+  std::vector< char > bytes( const std::vector< T >& v ) {
+    std::vector< char > d( v.size() * sizeof(T) );
+    std::memcpy( d.data(), v.data(), d.size() );
+    return d;
+  }
+};
+
+//! Test group shortcuts
+using Compress_group = test_group< Compress_common, MAX_TESTS_IN_GROUP >;
+using Compress_object = Compress_group::object;
+
+//! Define test group
+static Compress_group Compress( "Base/Compress" );
+
+//! Test definitions for group
+
+//! Test round trip of empty and short data not filling a word
+template<> template<>
+void Compress_object::test< 1 >() {
+  set_test_name( "empty and short data" );
+
+  roundtrip( {} );
+  roundtrip( { 'a' } );
+  roundtrip( { 'a', 'a', 'a', 'b', 'b' } );
+}
+
+//! Test that integer arrays, e.g., connectivity, compress
+template<> template<>
+void Compress_object::test< 2 >() {
+  set_test_name( "integers" );
+
+  std::vector< std::size_t > inpoel( 40000 );
+  for (std::size_t i=0; i<inpoel.size(); ++i) inpoel[i] = i/4 + i%4;
+  auto d = bytes( inpoel );
+
+  ensure( "integers not compressed", roundtrip( d ) < d.size()/3 );
+}
+
+//! Test round trip of random bytes, with long runs and all byte values
+template<> template<>
+void Compress_object::test< 3 >() {
+  set_test_name( "random bytes" );
+
+  std::mt19937 gen( 7 );
+  std::uniform_int_distribution< int > dist( 0, 255 );
+  std::vector< char > d;
+  for (std::size_t i=0; i<10000; ++i)
+    d.push_back( static_cast< char >( dist(gen) ) );
+  d.insert( d.end(), 1000, '\0' );
+  d.insert( d.end(), 129, '\xff' );
+  d.insert( d.end(), 130, '\x80' );
+
+  roundtrip( d );
+  std::vector< tk::real > x( 1000 );
+  for (std::size_t i=0; i<x.size(); ++i)
+    x[i] = 0.001 * static_cast< tk::real >( i );
+  roundtrip( bytes( x ) );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
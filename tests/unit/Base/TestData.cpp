@@ -13,6 +13,7 @@
 #include <limits>
 #include <array>
 #include <vector>
+#include <cstdint>
 
 #include "NoWarning/tut.hpp"
 
@@ -998,8 +999,8 @@ void Data_object::test< 21 >() {
   p1.fill( 0.1 );       p2.fill( 0.3 );
   e1.fill( 0.3 );       e2.fill( 0.1 );
 
-  auto p = p1 - p2;
-  auto e = e1 - e2;
+  tk::Data< tk::UnkEqComp > p = p1 - p2;
+  tk::Data< tk::EqCompUnk > e = e1 - e2;
 
   using unittest::veceq;
 
@@ -1107,8 +1108,8 @@ void Data_object::test< 23 >() {
   p1.fill( 0.1 );       p2.fill( 0.3 );
   e1.fill( 0.3 );       e2.fill( 0.1 );
 
-  auto p = p1 + p2;
-  auto e = e1 + e2;
+  tk::Data< tk::UnkEqComp > p = p1 + p2;
+  tk::Data< tk::EqCompUnk > e = e1 + e2;
 
   using unittest::veceq;
 
@@ -1216,8 +1217,8 @@ void Data_object::test< 25 >() {
   p1.fill( 0.1 );       p2.fill( 0.3 );
   e1.fill( 0.3 );       e2.fill( 0.1 );
 
-  auto p = p1 * p2;
-  auto e = e1 * e2;
+  tk::Data< tk::UnkEqComp > p = p1 * p2;
+  tk::Data< tk::EqCompUnk > e = e1 * e2;
 
   using unittest::veceq;
 
@@ -1310,8 +1311,8 @@ void Data_object::test< 27 >() {
   p1.fill( 0.1 );
   e1.fill( 0.3 );
 
-  auto p = p1 * 0.2;
-  auto e = e1 * 0.3;
+  tk::Data< tk::UnkEqComp > p = p1 * 0.2;
+  tk::Data< tk::EqCompUnk > e = e1 * 0.3;
 
   using unittest::veceq;
 
@@ -1405,8 +1406,8 @@ void Data_object::test< 29 >() {
   p1.fill( 0.1 );       p2.fill( 0.2 );
   e1.fill( 0.3 );       e2.fill( 0.6 );
 
-  auto p = p1 / p2;
-  auto e = e1 / e2;
+  tk::Data< tk::UnkEqComp > p = p1 / p2;
+  tk::Data< tk::EqCompUnk > e = e1 / e2;
 
   using unittest::veceq;
 
@@ -1499,8 +1500,8 @@ void Data_object::test< 31 >() {
   p1.fill( 0.1 );
   e1.fill( 0.3 );
 
-  auto p = p1 / 0.2;
-  auto e = e1 / 0.3;
+  tk::Data< tk::UnkEqComp > p = p1 / 0.2;
+  tk::Data< tk::EqCompUnk > e = e1 / 0.3;
 
   using unittest::veceq;
 
@@ -1546,8 +1547,8 @@ void Data_object::test< 32 >() {
   p1.fill( 0.1 );
   e1.fill( 0.3 );
 
-  auto p = 0.2 * p1;
-  auto e = 0.3 * e1;
+  tk::Data< tk::UnkEqComp > p = 0.2 * p1;
+  tk::Data< tk::EqCompUnk > e = 0.3 * e1;
 
   using unittest::veceq;
 
@@ -1752,8 +1753,6 @@ void Data_object::test< 38 >() {
          std::vector< tk::real >{ 5.0, 6.0 }, p[2] );
   veceq( "<UnkEqComp>::push_back() at 3 incorrect",
          std::vector< tk::real >{ 0.2, 0.3 }, p[3] );
-
-  // tk::Data::push_back() unimplemented with EqCompUnk data layout
 }
 
 //! Test tk::Data::resize()
@@ -1790,8 +1789,6 @@ void Data_object::test< 39 >() {
          std::vector< tk::real >{ 0.0, 0.0 }, p[5] );
   veceq( "<UnkEqComp>::resize() at 6 incorrect",
          std::vector< tk::real >{ 0.0, 0.0 }, p[6] );
-
-  // tk::Data::resize() unimplemented with EqCompUnk data layout
 }
 
 //! Test tk::Data::resize()
@@ -1828,8 +1825,6 @@ void Data_object::test< 40 >() {
          std::vector< tk::real >{ -2.13, -2.13 }, p[5] );
   veceq( "<UnkEqComp>::resize() at 6 incorrect",
          std::vector< tk::real >{ -2.13, -2.13 }, p[6] );
-
-  // tk::Data::resize() unimplemented with EqCompUnk data layout
 }
 
 //! Test tk::Data::rm()
@@ -2034,6 +2029,277 @@ void Data_object::test< 43 >() {
             pe.extract( 0, 1, std::array<std::size_t,3>{{3,5,7}} ) );
 }
 
+//! Test tk::Data's blocked (BlkEqCompUnk) data layout
+template<> template<>
+void Data_object::test< 44 >() {
+  set_test_name( "blocked layout access, resize, push_back, rm" );
+
+  // Use a number of unknowns that leaves the last block partially filled
+  const std::size_t nu = tk::DataBlkWidth + 3;
+  tk::Data< tk::BlkEqCompUnk > pb( nu, 3 );
+
+  ensure_equals( "<BlkEqCompUnk>::nunk() incorrect", pb.nunk(), nu );
+  ensure_equals( "<BlkEqCompUnk>::nprop() incorrect", pb.nprop(), 3 );
+  ensure_equals( "<BlkEqCompUnk>::layout() incorrect", pb.layout(),
+                 "block-major" );
+
+  for (std::size_t i=0; i<nu; ++i)
+    for (std::size_t c=0; c<3; ++c)
+      pb( i, c, 0 ) = static_cast< tk::real >( 10*i + c );
+
+  // Access via var(cptr()) must agree with operator()
+  for (std::size_t c=0; c<3; ++c) {
+    const auto p = pb.cptr( c, 0 );
+    for (std::size_t i=0; i<nu; ++i)
+      ensure_equals( "<BlkEqCompUnk>::var(cptr()) != operator()",
+                     pb.var( p, i ), pb( i, c, 0 ), prec );
+  }
+
+  // Unknowns of a component are contiguous within a block
+  ensure_equals( "<BlkEqCompUnk> component not contiguous in block",
+                 &pb( 1, 2, 0 ) - &pb( 0, 2, 0 ), 1 );
+
+  // Enlarge with non-default value, existing data must be kept
+  pb.resize( nu+2, 0.5 );
+  using unittest::veceq;
+  veceq( "<BlkEqCompUnk>::resize() at 0 incorrect",
+         std::vector< tk::real >{ 0.0, 1.0, 2.0 }, pb[0] );
+  veceq( "<BlkEqCompUnk>::resize() at nu-1 incorrect",
+         std::vector< tk::real >{ 10.0*(nu-1), 10.0*(nu-1)+1, 10.0*(nu-1)+2 },
+         pb[nu-1] );
+  veceq( "<BlkEqCompUnk>::resize() at nu+1 incorrect",
+         std::vector< tk::real >{ 0.5, 0.5, 0.5 }, pb[nu+1] );
+
+  pb.push_back( { 7.0, 8.0, 9.0 } );
+  ensure_equals( "<BlkEqCompUnk>::push_back() nunk incorrect", pb.nunk(),
+                 nu+3 );
+  veceq( "<BlkEqCompUnk>::push_back() incorrect",
+         std::vector< tk::real >{ 7.0, 8.0, 9.0 }, pb[nu+2] );
+
+  // Remove the first unknown and one in the second block
+  pb.rm( { 0, tk::DataBlkWidth+1 } );
+  ensure_equals( "<BlkEqCompUnk>::rm() nunk incorrect", pb.nunk(), nu+1 );
+  veceq( "<BlkEqCompUnk>::rm() at 0 incorrect",
+         std::vector< tk::real >{ 10.0, 11.0, 12.0 }, pb[0] );
+  veceq( "<BlkEqCompUnk>::rm() at last incorrect",
+         std::vector< tk::real >{ 7.0, 8.0, 9.0 }, pb[nu] );
+}
+
+//! Test that tk::Data's storage is aligned
+template<> template<>
+void Data_object::test< 45 >() {
+  set_test_name( "storage alignment" );
+
+  tk::Data< tk::UnkEqComp > pp( 3, 5 );
+  tk::Data< tk::EqCompUnk > pe( 7, 2 );
+  tk::Data< tk::BlkEqCompUnk > pb( 11, 3 );
+
+  ensure_equals( "<UnkEqComp> storage misaligned",
+    reinterpret_cast< std::uintptr_t >( pp.data().data() ) % tk::DataAlign,
+    0UL );
+  ensure_equals( "<EqCompUnk> storage misaligned",
+    reinterpret_cast< std::uintptr_t >( pe.data().data() ) % tk::DataAlign,
+    0UL );
+  ensure_equals( "<BlkEqCompUnk> storage misaligned",
+    reinterpret_cast< std::uintptr_t >( pb.data().data() ) % tk::DataAlign,
+    0UL );
+
+  // Alignment must also hold after reallocation
+  pp.resize( 1000 );
+  ensure_equals( "<UnkEqComp> storage misaligned after resize",
+    reinterpret_cast< std::uintptr_t >( pp.data().data() ) % tk::DataAlign,
+    0UL );
+}
+
+//! Test single-precision storage with double-precision arithmetic
+template<> template<>
+void Data_object::test< 46 >() {
+  set_test_name( "single precision storage" );
+
+  using FData = tk::Data< tk::UnkEqComp, tk::AlignedAllocator< float > >;
+
+  tk::Data< tk::UnkEqComp > d( 3, 2 );
+  d.fill( 1.0/3.0 );
+
+  // conversion from double-precision data rounds entries to float
+  FData f = d;
+  ensure_equals( "float storage not rounded", f(1,1,0), 1.0f/3.0f );
+  ensure_equals( "storage not aligned",
+    reinterpret_cast< std::uintptr_t >( f.data().data() ) % tk::DataAlign,
+    0UL );
+
+  // arithmetic mixing storage precisions is carried out in tk::real
+  tk::Data< tk::UnkEqComp > r = d - f;
+  ensure_equals( "mixed-precision difference incorrect", r(2,0,0),
+                 1.0/3.0 - static_cast< tk::real >( 1.0f/3.0f ), prec );
+
+  // accumulation into float storage
+  f += d;
+  ensure_equals( "float accumulation incorrect", f(0,1,0),
+                 static_cast< float >( static_cast< tk::real >(1.0f/3.0f) +
+                                       1.0/3.0 ) );
+}
+
+//! Test component, unknown, and system views of all layouts
+template<> template<>
+void Data_object::test< 47 >() {
+  set_test_name( "component, unknown, and system views" );
+
+  auto check = [this]( auto& d, const std::string& layout ) {
+    for (std::size_t u=0; u<d.nunk(); ++u)
+      for (std::size_t c=0; c<d.nprop(); ++c)
+        d(u,c,0) = static_cast< tk::real >( u*10 + c );
+
+    // read-only views must see the same data as the function call operator
+    const auto& cd = d;
+    auto cv = cd.cview( 1, 1 );
+    ensure_equals( layout + "::cview size incorrect", cv.size(), d.nunk() );
+    for (std::size_t u=0; u<d.nunk(); ++u)
+      ensure_equals( layout + "::cview incorrect", cv[u], d(u,1,1), prec );
+    auto uv = cd.uview( 9, 1 );
+    ensure_equals( layout + "::uview size incorrect", uv.size(), d.nprop()-1 );
+    for (std::size_t c=0; c<uv.size(); ++c)
+      ensure_equals( layout + "::uview incorrect", uv[c], d(9,c,1), prec );
+    auto sv = cd.sview( 1 );
+    for (std::size_t u=0; u<d.nunk(); ++u)
+      for (std::size_t c=0; c<sv.ncomp(); ++c)
+        ensure_equals( layout + "::sview incorrect", sv(u,c), d(u,c,1), prec );
+
+    // writes via views must be visible to the function call operator
+    d.cview( 0, 2 )[ 10 ] = -1.0;
+    ensure_equals( layout + "::cview write incorrect", d(10,2,0), -1.0, prec );
+    d.uview( 3, 0 )[ 1 ] = -2.0;
+    ensure_equals( layout + "::uview write incorrect", d(3,1,0), -2.0, prec );
+    d.sview( 2 )( 8, 0 ) = -3.0;
+    ensure_equals( layout + "::sview write incorrect", d(8,0,2), -3.0, prec );
+  };
+
+  tk::Data< tk::UnkEqComp > pp( 11, 3 );
+  tk::Data< tk::EqCompUnk > pe( 11, 3 );
+  tk::Data< tk::BlkEqCompUnk > pb( 11, 3 );
+  check( pp, "<UnkEqComp>" );
+  check( pe, "<EqCompUnk>" );
+  check( pb, "<BlkEqCompUnk>" );
+}
+
+//! Test reordering unknowns of all layouts
+template<> template<>
+void Data_object::test< 48 >() {
+  set_test_name( "reorder" );
+
+  auto check = [this]( auto& d, const std::string& layout ) {
+    for (std::size_t u=0; u<d.nunk(); ++u)
+      for (std::size_t c=0; c<d.nprop(); ++c)
+        d(u,c,0) = static_cast< tk::real >( u*10 + c );
+
+    // reverse the order of the unknowns
+    std::vector< std::size_t > map( d.nunk() );
+    for (std::size_t u=0; u<map.size(); ++u) map[u] = map.size()-1-u;
+    d.reorder( map );
+
+    for (std::size_t u=0; u<d.nunk(); ++u)
+      for (std::size_t c=0; c<d.nprop(); ++c)
+        ensure_equals( layout + "::reorder() incorrect", d(map[u],c,0),
+                       static_cast< tk::real >( u*10 + c ), prec );
+  };
+
+  tk::Data< tk::UnkEqComp > pp( 11, 3 );
+  tk::Data< tk::EqCompUnk > pe( 11, 3 );
+  tk::Data< tk::BlkEqCompUnk > pb( 11, 3 );
+  check( pp, "<UnkEqComp>" );
+  check( pe, "<EqCompUnk>" );
+  check( pb, "<BlkEqCompUnk>" );
+}
+
+//! Test bulk append, remove, and renumbering of unknowns of all layouts
+template<> template<>
+void Data_object::test< 49 >() {
+  set_test_name( "append, rmsorted, rmflagged, remap" );
+
+  auto check = [this]( auto d, const std::string& layout ) {
+    for (std::size_t u=0; u<d.nunk(); ++u)
+      for (std::size_t c=0; c<d.nprop(); ++c)
+        d(u,c,0) = static_cast< tk::real >( u*10 + c );
+
+    // unknowns 11, 12 appended to 0..10
+    d.append( { 110.0, 111.0, 112.0, 120.0, 121.0, 122.0 } );
+    ensure_equals( layout + "::append() nunk incorrect", d.nunk(), 13 );
+    for (std::size_t u=0; u<d.nunk(); ++u)
+      for (std::size_t c=0; c<d.nprop(); ++c)
+        ensure_equals( layout + "::append() incorrect", d(u,c,0),
+                       static_cast< tk::real >( u*10 + c ), prec );
+
+    // remove 0, 5, 12, leaving 1..4, 6..11
+    auto r = d;
+    r.rmsorted( { 0, 5, 12 } );
+    auto f = d;
+    std::vector< char > flag( d.nunk(), 0 );
+    flag[0] = flag[5] = flag[12] = 1;
+    f.rmflagged( flag );
+    std::vector< std::size_t > kept{ 1, 2, 3, 4, 6, 7, 8, 9, 10, 11 };
+    ensure_equals( layout + "::rmsorted() nunk incorrect", r.nunk(), 10 );
+    ensure_equals( layout + "::rmflagged() nunk incorrect", f.nunk(), 10 );
+    for (std::size_t u=0; u<kept.size(); ++u)
+      for (std::size_t c=0; c<d.nprop(); ++c) {
+        auto v = static_cast< tk::real >( kept[u]*10 + c );
+        ensure_equals( layout + "::rmsorted() incorrect", r(u,c,0), v, prec );
+        ensure_equals( layout + "::rmflagged() incorrect", f(u,c,0), v, prec );
+      }
+
+    // reverse the order of the odd unknowns, remove the even ones, and append
+    // two more
+    const auto rm = std::numeric_limits< std::size_t >::max();
+    std::vector< std::size_t > map( d.nunk(), rm );
+    for (std::size_t u=1; u<map.size(); u+=2) map[u] = (map.size()-1-u)/2;
+    auto m = d;
+    m.remap( map, 8, -1.0 );
+    ensure_equals( layout + "::remap() nunk incorrect", m.nunk(), 8 );
+    for (std::size_t u=0; u<8; ++u)
+      for (std::size_t c=0; c<d.nprop(); ++c)
+        ensure_equals( layout + "::remap() incorrect", m(u,c,0),
+          u < 6 ? static_cast< tk::real >( (11-u*2)*10 + c ) : -1.0, prec );
+  };
+
+  check( tk::Data< tk::UnkEqComp >( 11, 3 ), "<UnkEqComp>" );
+  check( tk::Data< tk::EqCompUnk >( 11, 3 ), "<EqCompUnk>" );
+  check( tk::Data< tk::BlkEqCompUnk >( 11, 3 ), "<BlkEqCompUnk>" );
+}
+
+//! Test resize and push_back with the EqCompUnk data layout
+template<> template<>
+void Data_object::test< 50 >() {
+  set_test_name( "resize and push_back with EqCompUnk" );
+
+  tk::Data< tk::EqCompUnk > p( 3, 2 );
+  p(0,0,0) = 1.0;  p(0,1,0) = 2.0;
+  p(1,0,0) = 3.0;  p(1,1,0) = 4.0;
+  p(2,0,0) = 5.0;  p(2,1,0) = 6.0;
+
+  using unittest::veceq;
+
+  p.resize( 5, -2.0 );
+  ensure_equals( "nunk after <EqCompUnk>::resize() incorrect", p.nunk(), 5 );
+  veceq( "<EqCompUnk>::resize() at 0 incorrect",
+         std::vector< tk::real >{ 1.0, 2.0 }, p[0] );
+  veceq( "<EqCompUnk>::resize() at 2 incorrect",
+         std::vector< tk::real >{ 5.0, 6.0 }, p[2] );
+  veceq( "<EqCompUnk>::resize() at 4 incorrect",
+         std::vector< tk::real >{ -2.0, -2.0 }, p[4] );
+
+  p.resize( 2 );
+  ensure_equals( "nunk after <EqCompUnk>::resize() incorrect", p.nunk(), 2 );
+  veceq( "<EqCompUnk>::resize() at 1 incorrect",
+         std::vector< tk::real >{ 3.0, 4.0 }, p[1] );
+
+  p.push_back( { 0.2, 0.3 } );
+  ensure_equals( "nunk after <EqCompUnk>::push_back() incorrect", p.nunk(),
+                 3 );
+  veceq( "<EqCompUnk>::push_back() at 0 incorrect",
+         std::vector< tk::real >{ 1.0, 2.0 }, p[0] );
+  veceq( "<EqCompUnk>::push_back() at 2 incorrect",
+         std::vector< tk::real >{ 0.2, 0.3 }, p[2] );
+}
+
 } // tut::
 
 #endif  // DOXYGEN_GENERATING_OUTPUT
@@ -0,0 +1,111 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Base/TestExternalSort.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for Base/ExternalSort.hpp
+  \details   Unit tests for Base/ExternalSort.hpp
+*/
+// *****************************************************************************
+
+#include <array>
+#include <cstdio>
+#include <fstream>
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "ExternalSort.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct ExternalSort_common {
+
+  //! Record sorted: a key and the position of the record in the input
+  using Record = std::array< std::size_t, 2 >;
+
+  //! Write records with keys cycling through a number of distinct keys
+  //! \param[in] name File to write
+  //! \param[in] n Number of records to write
+  //! \param[in] nkey Number of distinct keys
+  void write( const std::string& name, std::size_t n, std::size_t nkey ) {
+    std::vector< Record > rec( n );
+    for (std::size_t i=0; i<n; ++i) rec[i] = {{ (i*7919) % nkey, i }};
+    std::ofstream os( name, std::ios::binary );
+    tk::writeRecords( os, rec );
+  }
+
+  //! Read all records from a file
+  //! \param[in] name File to read
+  //! \return Records read
+  std::vector< Record > read( const std::string& name ) {
+    std::ifstream is( name, std::ios::binary );
+    std::vector< Record > rec, all;
+    while (tk::readRecords( is, rec, 10 ))
+      all.insert( end(all), begin(rec), end(rec) );
+    return all;
+  }
+
+  //! Sort a file by key in chunks and verify the sorted file
+  //! \param[in] n Number of records
+  //! \param[in] nkey Number of distinct keys
+  //! \param[in] chunk Number of records sorted in memory at a time
+  void sort( std::size_t n, std::size_t nkey, std::size_t chunk ) {
+    std::string in( "test_externalsort.in" ), out( "test_externalsort.out" );
+    write( in, n, nkey );
+    tk::externalSort< Record >( in, out, chunk,
+      []( const Record& a, const Record& b ){ return a[0] < b[0]; } );
+    auto rec = read( out );
+    std::remove( in.c_str() );
+    std::remove( out.c_str() );
+
+    ensure_equals( "number of records sorted incorrect", rec.size(), n );
+    for (std::size_t i=1; i<rec.size(); ++i) {
+      ensure( "records not sorted", rec[i-1][0] <= rec[i][0] );
+      if (rec[i-1][0] == rec[i][0])
+        ensure( "sort not stable", rec[i-1][1] < rec[i][1] );
+    }
+    std::ifstream run( out + ".run0" );
+    ensure( "run not removed", !run.good() );
+  }
+};
+
+//! Test group shortcuts
+using ExternalSort_group =
+  test_group< ExternalSort_common, MAX_TESTS_IN_GROUP >;
+using ExternalSort_object = ExternalSort_group::object;
+
+//! Define test group
+static ExternalSort_group ExternalSort( "Base/ExternalSort" );
+
+//! Test definitions for group
+
+//! Test sorting records fitting in a single chunk
+template<> template<>
+void ExternalSort_object::test< 1 >() {
+  set_test_name( "single run" );
+  sort( 1000, 1000, 4096 );
+}
+
+//! Test sorting records in many runs, merged, with keys repeated across runs
+template<> template<>
+void ExternalSort_object::test< 2 >() {
+  set_test_name( "many runs" );
+  sort( 10000, 97, 64 );
+}
+
+//! Test sorting an empty file
+template<> template<>
+void ExternalSort_object::test< 3 >() {
+  set_test_name( "empty file" );
+  sort( 0, 1, 16 );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
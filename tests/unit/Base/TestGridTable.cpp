@@ -0,0 +1,155 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Base/TestGridTable.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for Base/GridTable.hpp
+  \details   Unit tests for Base/GridTable.hpp
+*/
+// *****************************************************************************
+
+#include <array>
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "GridTable.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct GridTable_common {
+  // cppcheck-suppress unusedStructMember
+  double precision = 1.0e-12;    // required floating-point precision
+
+  //! \brief Tabulate f0 = 1 + 2x + 3y + xy, reproduced exactly by bilinear
+  //!   interpolation, and f1 = x*x on x in [0,2] and y in [-1,1]
+  tk::GridTable table() const {
+    const std::size_t nx = 5, ny = 3;
+    std::vector< tk::real > v;
+    for (std::size_t i=0; i<nx; ++i)
+      for (std::size_t j=0; j<ny; ++j) {
+        auto x = 0.5 * static_cast< tk::real >( i );
+        auto y = -1.0 + static_cast< tk::real >( j );
+        v.push_back( f0( x, y ) );
+        v.push_back( x*x );
+      }
+    return tk::GridTable( 2, {{0.0, 2.0}}, nx, {{-1.0, 1.0}}, ny, v );
+  }
+
+  //! Bilinear function tabulated
+  static tk::real f0( tk::real x, tk::real y )
+  { return 1.0 + 2.0*x + 3.0*y + x*y; }
+};
+
+//! Test group shortcuts
+using GridTable_group = test_group< GridTable_common, MAX_TESTS_IN_GROUP >;
+using GridTable_object = GridTable_group::object;
+
+//! Define test group
+static GridTable_group GridTable( "Base/GridTable" );
+
+//! Test definitions for group
+
+//! Test sampling at and between grid points
+template<> template<>
+void GridTable_object::test< 1 >() {
+  set_test_name( "sample inside grid" );
+
+  auto t = table();
+  ensure_equals( "number of functions incorrect", t.nfunc(), 2UL );
+  for (std::size_t i=0; i<=20; ++i)
+    for (std::size_t j=0; j<=20; ++j) {
+      auto x = 0.1 * static_cast< tk::real >( i );
+      auto y = -1.0 + 0.1 * static_cast< tk::real >( j );
+      ensure_equals( "bilinear function not reproduced", t.sample( x, y, 0 ),
+                     f0( x, y ), precision );
+    }
+
+  // at grid points the tabulated value, between them the linear interpolant
+  ensure_equals( "at grid point", t.sample( 1.5, 0.0, 1 ), 2.25, precision );
+  ensure_equals( "between grid points", t.sample( 1.25, 0.3, 1 ),
+                 (1.0 + 2.25)/2.0, precision );
+  ensure_equals( "at last grid point", t.sample( 2.0, 1.0, 1 ), 4.0,
+                 precision );
+}
+
+//! Test that points outside of the grid sample the nearest boundary value
+template<> template<>
+void GridTable_object::test< 2 >() {
+  set_test_name( "sample outside grid" );
+
+  auto t = table();
+  ensure_equals( "below x", t.sample( -1.0, 0.5, 0 ), f0( 0.0, 0.5 ),
+                 precision );
+  ensure_equals( "beyond x", t.sample( 3.0, 0.5, 0 ), f0( 2.0, 0.5 ),
+                 precision );
+  ensure_equals( "below y", t.sample( 0.7, -5.0, 0 ), f0( 0.7, -1.0 ),
+                 precision );
+  ensure_equals( "beyond x and y", t.sample( 9.0, 9.0, 0 ), f0( 2.0, 1.0 ),
+                 precision );
+}
+
+//! Test that sampling all functions and batches equals sampling each
+template<> template<>
+void GridTable_object::test< 3 >() {
+  set_test_name( "sample all functions and batches" );
+
+  auto t = table();
+  std::vector< tk::real > x{ -0.5, 0.3, 1.1, 1.99, 2.5 },
+                          y{ 0.2, -0.9, 0.0, 0.77, 2.0 }, f( x.size() );
+  for (std::size_t i=0; i<x.size(); ++i) {
+    std::array< tk::real, 2 > a;
+    t.sample( x[i], y[i], a );
+    ensure_equals( "function 0 incorrect", a[0], t.sample( x[i], y[i], 0 ),
+                   precision );
+    ensure_equals( "function 1 incorrect", a[1], t.sample( x[i], y[i], 1 ),
+                   precision );
+  }
+
+  t.sample( x.size(), x, y, 1, f );
+  for (std::size_t i=0; i<x.size(); ++i)
+    ensure_equals( "batch sample incorrect", f[i], t.sample( x[i], y[i], 1 ),
+                   precision );
+}
+
+//! Test that copies share the table
+template<> template<>
+void GridTable_object::test< 4 >() {
+  set_test_name( "copies share table" );
+
+  tk::GridTable e;
+  ensure( "default table must be empty", e.empty() );
+  ensure_equals( "empty table has functions", e.nfunc(), 0UL );
+
+  auto t = table();
+  auto c = t;
+  ensure( "copy must not be empty", !c.empty() );
+  ensure_equals( "copy samples differently", c.sample( 0.3, 0.4, 0 ),
+                 t.sample( 0.3, 0.4, 0 ), precision );
+  ensure( "ranges differ", c.xrange() == t.xrange() &&
+                           c.yrange() == t.yrange() );
+}
+
+//! Test that an inconsistent table throws
+template<> template<>
+void GridTable_object::test< 5 >() {
+  set_test_name( "throws with inconsistent size" );
+
+  try {
+    tk::GridTable( 2, {{0.0, 1.0}}, 2, {{0.0, 1.0}}, 2,
+                   std::vector< tk::real >( 7, 0.0 ) );
+    fail( "should throw exception" );
+  }
+  catch ( tk::Exception& ) {
+    // exception thrown, test ok
+  }
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
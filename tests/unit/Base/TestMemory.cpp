@@ -0,0 +1,106 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Base/TestMemory.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for Base/Memory.hpp
+  \details   Unit tests for Base/Memory.hpp
+*/
+// *****************************************************************************
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "Memory.hpp"
+#include "Fields.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct Memory_common {};
+
+//! Test group shortcuts
+using Memory_group = test_group< Memory_common, MAX_TESTS_IN_GROUP >;
+using Memory_object = Memory_group::object;
+
+//! Define test group
+static Memory_group Memory( "Base/Memory" );
+
+//! Test definitions for group
+
+//! Test that tk::bytes() counts the capacity of a vector of scalars
+template<> template<>
+void Memory_object::test< 1 >() {
+  set_test_name( "bytes of vector counts capacity" );
+
+  std::vector< std::size_t > v( 10 );
+  v.reserve( 100 );
+
+  ensure_equals( "bytes of vector", tk::bytes( v ),
+                 sizeof(v) + v.capacity() * sizeof(std::size_t) );
+}
+
+//! Test that tk::bytes() counts the heap storage of nested containers
+template<> template<>
+void Memory_object::test< 2 >() {
+  set_test_name( "bytes of nested containers" );
+
+  std::vector< std::vector< tk::real > > v( 3, std::vector< tk::real >( 4 ) );
+  std::array< std::vector< tk::real >, 3 > a{{ {1.0}, {1.0, 2.0}, {} }};
+
+  ensure_equals( "bytes of vector of vectors", tk::bytes( v ),
+                 sizeof(v) + 3 * tk::bytes( v[0] ) );
+  ensure_equals( "bytes of array of vectors", tk::bytes( a ),
+                 tk::bytes( a[0] ) + tk::bytes( a[1] ) + tk::bytes( a[2] ) );
+}
+
+//! Test that tk::bytes() of node-based containers grows with the entries
+template<> template<>
+void Memory_object::test< 3 >() {
+  set_test_name( "bytes of hash map and map" );
+
+  std::unordered_map< int, std::vector< std::size_t > > h;
+  std::map< int, std::vector< std::size_t > > m;
+  auto h0 = tk::bytes( h );
+  auto m0 = tk::bytes( m );
+  for (int i=0; i<10; ++i) {
+    h[i] = { 1, 2, 3 };
+    m[i] = { 1, 2, 3 };
+  }
+
+  ensure( "hash map entries not counted",
+          tk::bytes( h ) >= h0 + 10 * tk::bytes( h[0] ) );
+  ensure( "map entries not counted",
+          tk::bytes( m ) >= m0 + 10 * tk::bytes( m[0] ) );
+}
+
+//! Test that tk::bytes() of multiple containers is the sum of their bytes
+template<> template<>
+void Memory_object::test< 4 >() {
+  set_test_name( "bytes of multiple containers" );
+
+  std::vector< int > v( 7 );
+  std::unordered_set< std::size_t > s{ 1, 2, 3 };
+  tk::Fields f( 10, 3 );
+
+  ensure_equals( "bytes of fields", tk::bytes( f ), tk::bytes( f.data() ) );
+  ensure_equals( "bytes of multiple containers", tk::bytes( v, s, f ),
+                 tk::bytes( v ) + tk::bytes( s ) + tk::bytes( f ) );
+}
+
+//! Test that the high-water mark of the resident set size is not below it
+template<> template<>
+void Memory_object::test< 5 >() {
+  set_test_name( "resident set size and its high-water mark" );
+
+  ensure( "resident set size above its high-water mark",
+          tk::rss() <= tk::rsshwm() || tk::rss() == 0 );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
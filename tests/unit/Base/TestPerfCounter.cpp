@@ -0,0 +1,104 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Base/TestPerfCounter.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for Base/PerfCounter.hpp
+  \details   Unit tests for Base/PerfCounter.hpp
+*/
+// *****************************************************************************
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "PerfCounter.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct PerfCounter_common {};
+
+//! Test group shortcuts
+using PerfCounter_group = test_group< PerfCounter_common, MAX_TESTS_IN_GROUP >;
+using PerfCounter_object = PerfCounter_group::object;
+
+//! Define test group
+static PerfCounter_group PerfCounter( "Base/PerfCounter" );
+
+//! Test definitions for group
+
+//! Test that registering the same name yields the same region id
+template<> template<>
+void PerfCounter_object::test< 1 >() {
+  set_test_name( "region ids" );
+
+  auto a = tk::perfRegion( "TestPerfCounter:a" );
+  auto b = tk::perfRegion( "TestPerfCounter:b" );
+
+  ensure( "different names yield same id", a != b );
+  ensure_equals( "same name yields different id",
+                 tk::perfRegion( "TestPerfCounter:a" ), a );
+}
+
+//! Test that a region is not sampled unless enabled
+template<> template<>
+void PerfCounter_object::test< 2 >() {
+  set_test_name( "disabled" );
+
+  tk::perfCounters( false );
+  { tk::PerfRegion pr( tk::perfRegion( "TestPerfCounter:off" ) ); }
+
+  auto rows = tk::perfRows( 0 );
+  ensure( "disabled region sampled", !rows.count( "TestPerfCounter:off" ) );
+}
+
+//! Test that calls and times of a region are accumulated if enabled
+template<> template<>
+void PerfCounter_object::test< 3 >() {
+  set_test_name( "calls and times accumulated" );
+
+  tk::perfCounters( true );
+  const auto id = tk::perfRegion( "TestPerfCounter:on" );
+  for (int i=0; i<3; ++i) tk::PerfRegion pr( id );
+  tk::perfCounters( false );
+
+  auto rows = tk::perfRows( 7 );
+  ensure( "enabled region not sampled", rows.count( "TestPerfCounter:on" ) );
+  const auto& r = rows.at( "TestPerfCounter:on" );
+  ensure_equals( "row length", r.size(), std::size_t(tk::PRSTRIDE) );
+  ensure_equals( "pe", r[tk::PRPE], 7.0, 1.0e-15 );
+  ensure_equals( "calls", r[tk::PRCALLS], 3.0, 1.0e-15 );
+  ensure( "negative time", r[tk::PRTIME] >= 0.0 );
+}
+
+//! Test that the summary sums rows across PEs in order of decreasing time
+template<> template<>
+void PerfCounter_object::test< 4 >() {
+  set_test_name( "summary across PEs" );
+
+  std::vector< tk::real > a( 2*tk::PRSTRIDE, 0.0 ), b( tk::PRSTRIDE, 0.0 );
+  a[tk::PRCALLS] = a[tk::PRSTRIDE+tk::PRCALLS] = 2.0;
+  a[tk::PRTIME] = a[tk::PRSTRIDE+tk::PRTIME] = 1.0;
+  b[tk::PRCALLS] = 1.0;
+  b[tk::PRTIME] = 3.0;
+  b[tk::PRCTR+tk::PCYCLES] = 100.0;
+  b[tk::PRCTR+tk::PINSTR] = 150.0;
+
+  auto s = tk::perfSummary( {{ "a", a }, { "b", b }} );
+
+  ensure_equals( "number of regions", s.size(), 2UL );
+  ensure_equals( "slowest region not first", s[0].first, std::string("b") );
+  ensure( "calls not summed", s[1].second.find( "4 calls" ) == 0 );
+  ensure( "IPC not computed", s[0].second.find( "IPC 1.5" ) !=
+                              std::string::npos );
+  ensure( "missing counters not reported",
+          s[1].second.find( "not available" ) != std::string::npos );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
@@ -0,0 +1,124 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Base/TestStepControl.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for Base/StepControl.hpp
+  \details   Unit tests for Base/StepControl.hpp
+*/
+// *****************************************************************************
+
+#include <cmath>
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "StepControl.hpp"
+#include "Fields.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct StepControl_common {
+  // cppcheck-suppress unusedStructMember
+  double precision = 1.0e-12;    // required floating-point precision
+};
+
+// Test group shortcuts
+// The 2nd template argument is the max number of tests in this group. If
+// omitted, the default is 50, specified in tut/tut.hpp.
+using StepControl_group = test_group< StepControl_common, MAX_TESTS_IN_GROUP >;
+using StepControl_object = StepControl_group::object;
+
+//! Define test group
+static StepControl_group StepControl( "Base/StepControl" );
+
+//! Test definitions for group
+
+//! Test that error control is only enabled with a positive tolerance
+template<> template<>
+void StepControl_object::test< 1 >() {
+  set_test_name( "enabled by tolerance" );
+
+  ensure( "error control must be disabled by default",
+          !tk::StepControl().enabled() );
+  ensure( "error control must be enabled",
+          tk::StepControl( 1.0e-3 ).enabled() );
+}
+
+//! Test the error estimate of a step of du/dt = -u
+template<> template<>
+void StepControl_object::test< 2 >() {
+  set_test_name( "error of linear decay" );
+
+  // one unknown, two components, the second one constant
+  const tk::real dt = 0.1, c0 = 1.0/3.0, tol = 1.0e-3;
+  tk::Fields un( 1, 2 ), u1( 1, 2 ), u( 1, 2 );
+  un(0,0,0) = 1.0;
+  u1(0,0,0) = 1.0 - c0*dt;
+  u(0,0,0) = std::exp( -dt );
+  un(0,1,0) = u1(0,1,0) = u(0,1,0) = 2.0;
+
+  // the estimate is the difference of the solution and the Euler step
+  tk::StepControl s( tol );
+  auto e = s.error( u, un, u1, c0, 1 );
+  ensure_equals( "error estimate incorrect", e,
+                 std::abs( std::exp(-dt) - 1.0 + dt ) / tol / 2.0, precision );
+
+  // a constant solution has no error
+  tk::Fields v( u ), v1( u1 ), vn( un );
+  v(0,0,0) = v1(0,0,0) = vn(0,0,0) = 0.0;
+  ensure_equals( "error estimate of constant not zero",
+                 s.error( v, vn, v1, c0, 1 ), 0.0, precision );
+
+  // unknowns beyond nunk are ignored
+  ensure_equals( "error estimate of no unknowns not zero",
+                 s.error( u, un, u1, c0, 0 ), 0.0, precision );
+}
+
+//! Test that the stride selects the components estimated
+template<> template<>
+void StepControl_object::test< 3 >() {
+  set_test_name( "component stride" );
+
+  const tk::real c0 = 0.5, tol = 1.0;
+  tk::Fields un( 1, 4 ), u1( 1, 4 ), u( 1, 4 );
+  for (std::size_t c=0; c<4; ++c) un(0,c,0) = u1(0,c,0) = u(0,c,0) = 0.0;
+  // error in the components not estimated with stride 2
+  u(0,1,0) = 1.0;
+  u(0,3,0) = 1.0;
+
+  tk::StepControl s( tol );
+  ensure_equals( "error estimate with stride incorrect",
+                 s.error( u, un, u1, c0, 1, 2 ), 0.0, precision );
+  ensure_equals( "error estimate without stride incorrect",
+                 s.error( u, un, u1, c0, 1 ), 0.5, precision );
+}
+
+//! Test the step sizes selected by the controller
+template<> template<>
+void StepControl_object::test< 4 >() {
+  set_test_name( "step size selection" );
+
+  tk::StepControl s( 1.0e-3 );
+  ensure_equals( "step size at tolerance incorrect", s.dt( 1.0, 1.0 ), 0.9,
+                 precision );
+  ensure_equals( "step size increase not bounded", s.dt( 1.0, 0.0 ), 2.0,
+                 precision );
+  ensure_equals( "step size decrease not bounded", s.dt( 1.0, 1.0e+6 ), 0.2,
+                 precision );
+
+  // the previous error enters the next step size
+  tk::StepControl p( 1.0e-3 );
+  p.dt( 1.0, 0.5 );
+  ensure_equals( "step size of PI controller incorrect", p.dt( 1.0, 1.0 ),
+                 0.9 * std::pow( 0.5, 0.2 ), precision );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
@@ -0,0 +1,108 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Base/TestTable.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for Base/Table.hpp
+  \details   Unit tests for Base/Table.hpp
+*/
+// *****************************************************************************
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "Table.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct Table_common {
+  //! Table with nonuniformly spaced knots, including a repeated knot
+  const tk::Table table{{ {0.0, 1.0}, {0.5, 2.0}, {0.5, 4.0}, {0.75, 3.0},
+                          {2.0, 0.5}, {4.0, 1.5} }};
+};
+
+//! Test group shortcuts
+using Table_group = test_group< Table_common, MAX_TESTS_IN_GROUP >;
+using Table_object = Table_group::object;
+
+//! Define test group
+static Table_group Table( "Base/Table" );
+
+//! Test definitions for group
+
+//! Test sampling at knots, between knots, and outside of the table
+template<> template<>
+void Table_object::test< 1 >() {
+  set_test_name( "sample" );
+
+  ensure_equals( "below first x", tk::sample( -1.0, table ), 1.0, 1.0e-15 );
+  ensure_equals( "at first x", tk::sample( 0.0, table ), 1.0, 1.0e-15 );
+  ensure_equals( "between x", tk::sample( 0.25, table ), 1.5, 1.0e-15 );
+  ensure_equals( "at repeated x", tk::sample( 0.5, table ), 4.0, 1.0e-15 );
+  ensure_equals( "at inner x", tk::sample( 2.0, table ), 0.5, 1.0e-15 );
+  ensure_equals( "between x", tk::sample( 3.0, table ), 1.0, 1.0e-15 );
+  ensure_equals( "at last x", tk::sample( 4.0, table ), 1.5, 1.0e-15 );
+  ensure_equals( "beyond last x", tk::sample( 5.0, table ), 1.5, 1.0e-15 );
+}
+
+//! Test that the indexed table samples the same values as tk::sample()
+template<> template<>
+void Table_object::test< 2 >() {
+  set_test_name( "indexed table samples as sample()" );
+
+  tk::IndexedTable t( table );
+  tk::IndexedTable::Window w;
+  for (std::size_t i=0; i<=600; ++i) {
+    auto x = -1.0 + static_cast< tk::real >( i ) / 100.0;
+    auto s = tk::sample( x, table );
+    ensure_equals( "indexed sample incorrect", t.sample( x ), s, 1.0e-14 );
+    ensure_equals( "cached sample incorrect", t.sample( x, w ), s, 1.0e-14 );
+  }
+}
+
+//! Test that the segment sampled is reused while x is within it
+template<> template<>
+void Table_object::test< 3 >() {
+  set_test_name( "indexed table window" );
+
+  tk::IndexedTable t( table );
+  auto w = t.window( 1.0 );
+  ensure( "window does not contain x", w.contains( 1.0 ) );
+  ensure_equals( "window lower end incorrect", w.lo, 0.75, 1.0e-15 );
+  ensure_equals( "window upper end incorrect", w.hi, 2.0, 1.0e-15 );
+  ensure( "window contains upper end", !w.contains( 2.0 ) );
+  ensure( "default window contains x",
+          !tk::IndexedTable::Window().contains( 0.0 ) );
+}
+
+//! Test sampling a table with a single entry
+template<> template<>
+void Table_object::test< 4 >() {
+  set_test_name( "indexed table with a single entry" );
+
+  tk::IndexedTable t( tk::Table{{ {1.0, 3.0} }} );
+  ensure_equals( "below x", t.sample( 0.0 ), 3.0, 1.0e-15 );
+  ensure_equals( "at x", t.sample( 1.0 ), 3.0, 1.0e-15 );
+  ensure_equals( "beyond x", t.sample( 2.0 ), 3.0, 1.0e-15 );
+}
+
+//! Test that copies of an indexed table share the table
+template<> template<>
+void Table_object::test< 5 >() {
+  set_test_name( "copies of indexed table share data" );
+
+  tk::IndexedTable t( table );
+  const auto c = t;
+  ensure( "copy does not share table", &c.table() == &t.table() );
+  ensure_equals( "copy samples incorrectly", c.sample( 1.0 ), t.sample( 1.0 ),
+                 1.0e-15 );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
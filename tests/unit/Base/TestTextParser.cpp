@@ -0,0 +1,141 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Base/TestTextParser.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for Base/TextParser.hpp
+  \details   Unit tests for Base/TextParser.hpp
+*/
+// *****************************************************************************
+
+#include <sstream>
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "TextParser.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct TextParser_common {
+
+  //! Parse lines of an integer followed by a real number
+  //! \param[in,out] is Stream to parse
+  //! \param[in] nline Number of lines to parse
+  //! \param[out] id Integers parsed
+  //! \param[out] x Real numbers parsed
+  //! \param[in] chunksize Number of bytes read at a time
+  //! \return True on success
+  bool parse( std::istream& is,
+              std::size_t nline,
+              std::vector< int >& id,
+              std::vector< tk::real >& x,
+              std::size_t chunksize )
+  {
+    using Out = std::pair< std::vector< int >, std::vector< tk::real > >;
+    return tk::parseLines< Out >( is, nline,
+      []( const char* p, Out& o ){
+        int i;
+        tk::real r;
+        if (!(p = tk::parseInt( p, i ))) return false;
+        if (!(p = tk::parseReal( p, r ))) return false;
+        o.first.push_back( i );
+        o.second.push_back( r );
+        return true; },
+      [&]( const Out& o ){
+        id.insert( end(id), begin(o.first), end(o.first) );
+        x.insert( end(x), begin(o.second), end(o.second) ); },
+      chunksize );
+  }
+};
+
+//! Test group shortcuts
+using TextParser_group = test_group< TextParser_common, MAX_TESTS_IN_GROUP >;
+using TextParser_object = TextParser_group::object;
+
+//! Define test group
+static TextParser_group TextParser( "Base/TextParser" );
+
+//! Test definitions for group
+
+//! Test parsing numbers in a line
+template<> template<>
+void TextParser_object::test< 1 >() {
+  set_test_name( "parse numbers" );
+
+  const char* line = " -12\t+7 3.5e-1 42\n8";
+  int a, b;
+  std::size_t c;
+  tk::real r;
+  auto p = tk::parseInt( line, a );
+  p = tk::parseInt( p, b );
+  p = tk::parseReal( p, r );
+  p = tk::parseInt( p, c );
+  ensure_equals( "first integer incorrect", a, -12 );
+  ensure_equals( "second integer incorrect", b, 7 );
+  ensure_equals( "real incorrect", r, 0.35, 1.0e-15 );
+  ensure_equals( "unsigned integer incorrect", c, 42UL );
+  ensure( "number parsed past end of line", tk::parseInt( p, a ) == nullptr );
+  ensure( "real parsed past end of line", tk::parseReal( p, r ) == nullptr );
+  ensure( "non-number parsed", tk::parseInt( "x1", a ) == nullptr );
+}
+
+//! Test parsing lines across chunks, leaving the stream after the last line
+template<> template<>
+void TextParser_object::test< 2 >() {
+  set_test_name( "parse lines in chunks" );
+
+  std::stringstream ss;
+  for (int i=0; i<5000; ++i) ss << i << ' ' << 0.5*i << '\n';
+  ss << "$End\n";
+
+  std::vector< int > id;
+  std::vector< tk::real > x;
+  ensure( "parsing failed", parse( ss, 5000, id, x, 100 ) );
+
+  ensure_equals( "number of lines parsed incorrect", id.size(), 5000UL );
+  for (std::size_t i=0; i<id.size(); ++i) {
+    ensure_equals( "integer incorrect", id[i], static_cast< int >( i ) );
+    ensure_equals( "real incorrect", x[i], 0.5*static_cast< tk::real >( i ),
+                   1.0e-15 );
+  }
+  std::string s;
+  getline( ss, s );
+  ensure_equals( "stream not positioned after last line", s, "$End" );
+}
+
+//! Test parsing a last line not terminated by a new line
+template<> template<>
+void TextParser_object::test< 3 >() {
+  set_test_name( "parse last line without new line" );
+
+  std::stringstream ss( "1 1.0\n2 2.0" );
+  std::vector< int > id;
+  std::vector< tk::real > x;
+  ensure( "parsing failed", parse( ss, 2, id, x, 1UL << 24 ) );
+  ensure( "integers incorrect", id == std::vector< int >{ 1, 2 } );
+}
+
+//! Test that malformed lines and premature end of stream are detected
+template<> template<>
+void TextParser_object::test< 4 >() {
+  set_test_name( "detect malformed lines" );
+
+  std::vector< int > id;
+  std::vector< tk::real > x;
+
+  std::stringstream missing( "1 1.0\n2\n3 3.0\n" );
+  ensure( "missing number not detected", !parse( missing, 3, id, x, 64 ) );
+
+  std::stringstream premature( "1 1.0\n2 2.0\n" );
+  ensure( "premature end not detected", !parse( premature, 3, id, x, 64 ) );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
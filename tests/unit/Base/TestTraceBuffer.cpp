@@ -0,0 +1,104 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Base/TestTraceBuffer.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for Base/TraceBuffer.hpp
+  \details   Unit tests for Base/TraceBuffer.hpp
+*/
+// *****************************************************************************
+
+#include <sstream>
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "TraceBuffer.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct TraceBuffer_common {};
+
+//! Test group shortcuts
+using TraceBuffer_group = test_group< TraceBuffer_common, MAX_TESTS_IN_GROUP >;
+using TraceBuffer_object = TraceBuffer_group::object;
+
+//! Define test group
+static TraceBuffer_group TraceBuffer( "Base/TraceBuffer" );
+
+//! Test definitions for group
+
+//! Test that registering the same name yields the same event id
+template<> template<>
+void TraceBuffer_object::test< 1 >() {
+  set_test_name( "event ids" );
+
+  auto a = tk::traceEvent( "TestTraceBuffer:a" );
+  auto b = tk::traceEvent( "TestTraceBuffer:b" );
+
+  ensure( "different names yield same id", a != b );
+  ensure_equals( "same name yields different id",
+                 tk::traceEvent( "TestTraceBuffer:a" ), a );
+}
+
+//! Test that a buffer of zero capacity records nothing
+template<> template<>
+void TraceBuffer_object::test< 2 >() {
+  set_test_name( "disabled" );
+
+  tk::TraceBuffer t;
+  t.record( tk::traceEvent( "TestTraceBuffer:a" ), 0, 1, 0.0, 1.0 );
+
+  ensure( "empty buffer enabled", !t.enabled() );
+  ensure_equals( "events held", t.size(), 0UL );
+}
+
+//! Test that a full buffer holds the most recent events, oldest first
+template<> template<>
+void TraceBuffer_object::test< 3 >() {
+  set_test_name( "ring buffer overwrites oldest" );
+
+  auto ev = tk::traceEvent( "TestTraceBuffer:a" );
+  tk::TraceBuffer t( 3 );
+  for (uint64_t i=0; i<5; ++i)
+    t.record( ev, 7, i, static_cast< tk::real >( i ), i + 0.5 );
+
+  ensure_equals( "events held", t.size(), 3UL );
+  ensure_equals( "events dropped", t.dropped(), 2UL );
+  std::vector< uint64_t > it;
+  t.visit( [&]( const tk::TraceEvent& e ){
+    ensure_equals( "chare id", e.id, 7 );
+    ensure_equals( "duration", e.dur, 0.5, 1.0e-12 );
+    it.push_back( e.it ); } );
+  ensure( "events not oldest first", it == std::vector< uint64_t >{ 2, 3, 4 } );
+}
+
+//! Test writing events in the Chrome trace event format
+template<> template<>
+void TraceBuffer_object::test< 4 >() {
+  set_test_name( "write trace events" );
+
+  tk::TraceBuffer t( 2 );
+  t.record( tk::traceEvent( "TestTraceBuffer:b" ), 3, 9, 1.0, 1.25 );
+  std::stringstream ss;
+  t.write( ss, 5 );
+  const auto s = ss.str();
+
+  ensure( "event name not written",
+          s.find( "\"name\":\"TestTraceBuffer:b\"" ) != std::string::npos );
+  ensure( "complete event not written",
+          s.find( "\"ph\":\"X\",\"ts\":1000000.000,\"dur\":250000.000,"
+                  "\"pid\":5,\"tid\":3" ) != std::string::npos );
+  ensure( "iteration not written",
+          s.find( "\"args\":{\"it\":9}" ) != std::string::npos );
+  ensure( "events not closed", s.find( "]}" ) != std::string::npos );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
@@ -128,6 +128,28 @@ void Vector_object::test< 6 >() {
   ensure_equals( "unit incorrect", tk::length(v2), 1.0, precision );
 }
 
+//! Test inverting a 3x3 matrix against Cramer's rule
+template<> template<>
+void Vector_object::test< 7 >() {
+  set_test_name( "inverse" );
+
+  std::array< std::array< tk::real, 3 >, 3 >
+    a{{ {{ 4.0, -1.0, 0.5 }}, {{ 2.0, 5.0, -1.0 }}, {{ 0.0, 1.0, 3.0 }} }};
+  std::array< tk::real, 3 > b{{ 1.0, -2.0, 3.0 }};
+
+  const auto ai = tk::inverse( a );
+  const auto x = tk::cramer( a, b );
+  for (std::size_t i=0; i<3; ++i) {
+    tk::real y = ai[i][0]*b[0] + ai[i][1]*b[1] + ai[i][2]*b[2];
+    ensure_equals( "inverse times vector incorrect", y, x[i], 1.0e-14 );
+    for (std::size_t j=0; j<3; ++j) {
+      tk::real d = ai[i][0]*a[0][j] + ai[i][1]*a[1][j] + ai[i][2]*a[2][j];
+      ensure_equals( "inverse times matrix incorrect", d, i==j ? 1.0 : 0.0,
+                     1.0e-14 );
+    }
+  }
+}
+
 } // tut::
 
 #endif  // DOXYGEN_GENERATING_OUTPUT
@@ -1775,6 +1775,34 @@ void ExodusIIMeshReader_object::test< 8 >() {
   ensure( "element connectivity incorrect", inpoel == box24_inpoel );
 }
 
+//! Test reading coordinates of unordered node ids
+template<> template<>
+void ExodusIIMeshReader_object::test< 9 >() {
+  set_test_name( "read coordinates of unordered node ids" );
+
+  // Will use this mesh from the regression test suite
+  std::string infile( tk::regression_dir()+"/meshconv/gmsh_output/box_24.exo" );
+  // Create mesh reader
+  tk::ExodusIIMeshReader er( infile );
+
+  // Read node ids in reverse order, with a gap and a repeated id
+  auto n = box24_coord.size()/3;
+  std::vector< std::size_t > gid;
+  for (std::size_t p=0; p<n; ++p) if (p != n/2) gid.push_back( n-1-p );
+  gid.push_back( 0 );
+  auto coord = er.readCoords( gid );
+
+  // Test if the mesh node coordinates are correct
+  for (std::size_t i=0; i<gid.size(); ++i) {
+    ensure_equals( "node x coordinate incorrect", coord[0][i],
+                   box24_coord[ gid[i]*3+0 ] );
+    ensure_equals( "node y coordinate incorrect", coord[1][i],
+                   box24_coord[ gid[i]*3+1 ] );
+    ensure_equals( "node z coordinate incorrect", coord[2][i],
+                   box24_coord[ gid[i]*3+2 ] );
+  }
+}
+
 } // tut::
 
 #endif  // DOXYGEN_GENERATING_OUTPUT
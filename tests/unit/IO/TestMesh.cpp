@@ -10,6 +10,8 @@
 */
 // *****************************************************************************
 
+#include <cmath>
+
 #include "NoWarning/tut.hpp"
 
 #include "TUTConfig.hpp"
@@ -34,7 +36,12 @@ struct Mesh_common {
   //! Generic test function for testing writing and reading a tetrahedron mesh
   //! \param[in] reader Reader type
   //! \param[in] ascii Boolean selecting ASCII (TEXT) or binary mesh type
-  void testPureTetMesh( tk::MeshReaderType reader, bool ascii = false ) {
+  //! \param[in] compression Deflate level, ExodusII only: if nonzero, also
+  //!   write a node field rounded to a relative tolerance
+  void testPureTetMesh( tk::MeshReaderType reader,
+                        bool ascii = false,
+                        uint32_t compression = 0 )
+  {
     // Coordinates for simple tetrahedron-mesh
     std::vector< tk::real > coord { 0,   0,   0,
                                     1,   0,   0,
@@ -90,6 +97,17 @@ struct Mesh_common {
       outmesh.z().push_back( coord[p*3+2] );
     }
 
+    // Fill output mesh node field, see below
+    const tk::real lossytol = 1.0e-4;
+    if (compression > 0) {
+      outmesh.vartimes().push_back( 0.0 );
+      outmesh.nodevarnames().push_back( "u" );
+      outmesh.nodevars().emplace_back( 1, std::vector< tk::real >() );
+      for (std::size_t p=0; p<coord.size()/3; ++p)
+        outmesh.nodevars()[0][0].push_back(
+          std::sin( 1.0 + coord[p*3] + 2.0*coord[p*3+1] + 4.0*coord[p*3+2] ) );
+    }
+
     std::string filename;
 
     // Write out mesh to file in format selected. The writer must be in its own
@@ -114,6 +132,12 @@ struct Mesh_common {
       filename = "out.mesh";
       tk::NetgenMeshWriter( filename ).writeMesh( outmesh );
 
+    } else if (reader == tk::MeshReaderType::EXODUSII && compression > 0) {
+
+      filename = "out_compressed.exo";
+      tk::ExodusIIMeshWriter( filename, tk::ExoWriter::CREATE, compression,
+                              lossytol ).writeMesh( outmesh );
+
     } else if (reader == tk::MeshReaderType::EXODUSII) {
 
       filename = "out.exo";
@@ -169,6 +193,21 @@ struct Mesh_common {
     ensure( "element connectivity incorrect",
             outmesh.tetinpoel() == inmesh.tetinpoel() );
 
+    // Test if the node field is within the tolerance of what was written out
+    if (compression > 0) {
+      ensure_equals( "number of node fields incorrect",
+                     inmesh.nodevars().size(), 1UL );
+      ensure_equals( "number of node fields incorrect",
+                     inmesh.nodevars()[0].size(), 1UL );
+      const auto& u = outmesh.nodevars()[0][0];
+      const auto& v = inmesh.nodevars()[0][0];
+      ensure_equals( "number of node field values incorrect",
+                     v.size(), u.size() );
+      for (std::size_t p=0; p<u.size(); ++p)
+        ensure_equals( "node field value incorrect", v[p], u[p],
+                       lossytol*std::abs(u[p]) );
+    }
+
     // remove mesh file from disk
     tk::rm( filename );
   }
@@ -214,6 +253,37 @@ void Mesh_object::test< 4 >() {
   testPureTetMesh( tk::MeshReaderType::NETGEN );
 }
 
+//! Write and read compressed ExodusII mesh with field rounded to a tolerance
+template<> template<>
+void Mesh_object::test< 5 >() {
+  set_test_name( "write/read compressed ExodusII tet-mesh" );
+  testPureTetMesh( tk::MeshReaderType::EXODUSII, false, 4 );
+}
+
+//! Test rounding values to the fewest mantissa bits within a tolerance
+template<> template<>
+void Mesh_object::test< 6 >() {
+  set_test_name( "round mantissa within relative tolerance" );
+
+  std::vector< tk::real > v{ 0.0, 1.0, -3.0, 1.0/3.0, -2.0/3.0, 1.0e+300,
+                             1.0e-300, 123456.789, -0.1 };
+  for (auto tol : { 0.4, 1.0e-2, 1.0e-6, 1.0e-12 }) {
+    auto r = v;
+    tk::roundMantissa( r, tol );
+    for (std::size_t i=0; i<v.size(); ++i)
+      ensure_equals( "rounded value incorrect", r[i], v[i],
+                     tol*std::abs(v[i]) );
+  }
+
+  // A tolerance of 1/8 keeps 2 mantissa bits and rounds to nearest
+  std::vector< tk::real > r{ 1.0/3.0, 1.125, 1.25, -7.0 };
+  tk::roundMantissa( r, 0.125 );
+  ensure_equals( "rounded 1/3 incorrect", r[0], 0.3125, 0.0 );
+  ensure_equals( "rounded 1.125 incorrect", r[1], 1.25, 0.0 );
+  ensure_equals( "rounded 1.25 incorrect", r[2], 1.25, 0.0 );
+  ensure_equals( "rounded -7 incorrect", r[3], -7.0, 0.0 );
+}
+
 } // tut::
 
 #endif  // DOXYGEN_GENERATING_OUTPUT
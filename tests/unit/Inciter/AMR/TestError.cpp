@@ -211,6 +211,38 @@ struct AMRError_common {
       ensure( "edge error > 1.0", r < 1.0+pr );
     }
   }
+
+  //! Test that the error in all edges equals the per-edge error indicator
+  void TestErrorInEdges( inciter::ctr::AMRErrorType errtype ) {
+    tk::shiftToZero( inpoel );
+    auto npoin = *std::max_element( begin(inpoel), end(inpoel) ) + 1;
+    auto esup = tk::genEsup( inpoel, 4 );
+    auto inpoed = tk::genInpoed( inpoel, 4, esup );
+
+    AMR::Error err;
+    using AMR::edge_t;
+
+    // generate a vector field with different nonlinear components
+    tk::Fields u( npoin, 3 );
+    for (std::size_t p=0; p<npoin; ++p) {
+       u(p,0,0) = coord[0][p]*coord[1][p];
+       u(p,1,0) = 1.0 + coord[2][p]*coord[2][p];
+       u(p,2,0) = -0.5*coord[0][p] + coord[1][p]*coord[2][p];
+    }
+    std::vector< std::size_t > comps{ 0, 2 };
+
+    auto r = err.scalars( u, inpoed, comps, coord, inpoel, esup, errtype );
+    ensure_equals( "number of edge errors incorrect", r.size(),
+                   inpoed.size()/2 );
+    for (std::size_t e=0; e<inpoed.size()/2; ++e) {
+      edge_t edge{ inpoed[e*2],inpoed[e*2+1] };
+      tk::real cmax = 0.0;
+      for (auto c : comps)
+        cmax = std::max( cmax,
+                 err.scalar( u, edge, c, coord, inpoel, esup, errtype ) );
+      ensure_equals( "edge error incorrect", r[e], cmax, pr );
+    }
+  }
 };
 
 //! Test group shortcuts
@@ -236,6 +268,20 @@ void AMRError_object::test< 2 >() {
   TestErrorIndicator( inciter::ctr::AMRErrorType::HESSIAN );
 }
 
+//! Test jump error indicator in all edges for tetrahedron mesh
+template<> template<>
+void AMRError_object::test< 3 >() {
+  set_test_name( "jump indicator in all edges" );
+  TestErrorInEdges( inciter::ctr::AMRErrorType::JUMP );
+}
+
+//! Test Hessian error indicator in all edges for tetrahedron mesh
+template<> template<>
+void AMRError_object::test< 4 >() {
+  set_test_name( "Hessian indicator in all edges" );
+  TestErrorInEdges( inciter::ctr::AMRErrorType::HESSIAN );
+}
+
 } // tut::
 
 #endif  // DOXYGEN_GENERATING_OUTPUT
@@ -0,0 +1,127 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Inciter/AMR/TestIdMap.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for AMR containers in Inciter/AMR/id_map.hpp
+  \details   Unit tests for AMR containers in Inciter/AMR/id_map.hpp
+*/
+// *****************************************************************************
+
+#include <map>
+#include <array>
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "AMR/id_map.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct AMRIdMap_common {};
+
+//! Test group shortcuts
+using AMRIdMap_group = test_group< AMRIdMap_common, MAX_TESTS_IN_GROUP >;
+using AMRIdMap_object = AMRIdMap_group::object;
+
+//! Define test group
+static AMRIdMap_group AMRIdMap( "Inciter/AMR/id_map" );
+
+//! Test definitions for group
+
+//! Test that id_map_t behaves as std::map on insertion, lookup, and erase
+template<> template<>
+void AMRIdMap_object::test< 1 >() {
+  set_test_name( "id_map_t as std::map" );
+
+  AMR::id_map_t< int > m;
+  std::map< std::size_t, int > r;
+  for (std::size_t i : { 5, 1, 3, 8, 0 }) {
+    m.insert( { i, static_cast< int >( i*10 ) } );
+    r.insert( { i, static_cast< int >( i*10 ) } );
+  }
+  ensure( "duplicate inserted", !m.insert( { 3, 0 } ).second );
+  m.erase( 8 );  r.erase( 8 );
+  m.erase( 1 );  r.erase( 1 );
+  m[2] = 20;     r[2] = 20;
+
+  ensure_equals( "size incorrect", m.size(), r.size() );
+  ensure( "erased id found", m.find(1) == m.end() && m.count(8) == 0 );
+  ensure_equals( "value incorrect", m.at(3), 30 );
+  std::vector< std::pair< std::size_t, int > > a( begin(m), end(m) ),
+                                               b( begin(r), end(r) );
+  ensure( "iteration order incorrect", a == b );
+}
+
+//! Test that iteration visits ids inserted while iterating
+template<> template<>
+void AMRIdMap_object::test< 2 >() {
+  set_test_name( "id_map_t insert while iterating" );
+
+  AMR::id_map_t< std::array< std::size_t, 2 > > m;
+  m.insert( { 0, {{ 0, 0 }} } );
+  const auto& first = m.at(0);
+  std::size_t n = 0;
+  for (const auto& kv : m) {
+    if (kv.first < 100) m.insert( { kv.first+1, {{ kv.first, 1 }} } );
+    ++n;
+  }
+  ensure_equals( "number of visited ids incorrect", n, 101UL );
+  ensure( "reference invalidated", &first == &m.at(0) );
+}
+
+//! Test id_set_t iteration order and erase
+template<> template<>
+void AMRIdMap_object::test< 3 >() {
+  set_test_name( "id_set_t" );
+
+  AMR::id_set_t s;
+  for (std::size_t i : { 7, 2, 4, 2 }) s.insert( i );
+  s.erase( 7 );
+
+  ensure_equals( "size incorrect", s.size(), 2UL );
+  ensure( "erased id found", s.find(7) == s.end() );
+  ensure( "ids incorrect",
+          std::vector< std::size_t >( begin(s), end(s) ) ==
+            std::vector< std::size_t >{ 2, 4 } );
+}
+
+//! Test edge_table_t against std::map under many insertions and erasures
+template<> template<>
+void AMRIdMap_object::test< 4 >() {
+  set_test_name( "edge_table_t as std::map" );
+
+  AMR::edge_table_t< std::size_t > t;
+  std::map< AMR::edge_t, std::size_t > r;
+  for (std::size_t i=0; i<1000; ++i) {
+    AMR::edge_t e( i % 97, 200 + i );
+    t[e] = i;
+    r[e] = i;
+    if (i % 3 == 0) {
+      AMR::edge_t d( (i/2) % 97, 200 + i/2 );
+      ensure_equals( "erase count incorrect", t.erase(d), r.erase(d) );
+    }
+  }
+
+  ensure_equals( "size incorrect", t.size(), r.size() );
+  for (const auto& [e,v] : r) {
+    auto it = t.find( e );
+    ensure( "edge not found", it != end(t) );
+    ensure_equals( "value incorrect", it->second, v );
+  }
+  std::size_t n = 0;
+  for (const auto& kv : t) {
+    ensure_equals( "value incorrect", r.at( kv.first ), kv.second );
+    ++n;
+  }
+  ensure_equals( "number of iterated edges incorrect", n, r.size() );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
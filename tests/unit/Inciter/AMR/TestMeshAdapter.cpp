@@ -0,0 +1,107 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Inciter/AMR/TestMeshAdapter.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for Inciter/AMR/mesh_adapter.hpp
+  \details   Unit tests for Inciter/AMR/mesh_adapter.hpp
+*/
+// *****************************************************************************
+
+#include <vector>
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "AMR/mesh_adapter.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct AMRMeshAdapter_common {
+  //! Tetrahedron mesh connectivity of a unit cube with 24 cells
+  const std::vector< std::size_t > inpoel {{
+    11,13, 8,10,  9,13,12,11, 13,12,11, 8,  9,13,11,10,
+     0,13, 4,10,  6, 5, 9,11, 13, 7, 4, 9,  7, 6, 9,12,
+     6,12, 2,11,  0, 3,13, 8, 12, 3, 2, 8,  2, 1,11, 8,
+     3, 7,13,12,  5, 4, 9,10,  0, 1, 8,10,  1, 5,11,10,
+     5, 9,11,10,  1,11, 8,10,  4,13, 9,10, 13, 7, 9,12,
+    12, 2,11, 8,  6, 9,12,11, 13, 3,12, 8, 13, 0, 8,10 }};
+};
+
+//! Test group shortcuts
+using AMRMeshAdapter_group =
+  test_group< AMRMeshAdapter_common, MAX_TESTS_IN_GROUP >;
+using AMRMeshAdapter_object = AMRMeshAdapter_group::object;
+
+//! Define test group
+static AMRMeshAdapter_group AMRMeshAdapter( "Inciter/AMR/mesh_adapter" );
+
+//! Test definitions for group
+
+//! Test that the leaf families follow uniform refinement and derefinement
+template<> template<>
+void AMRMeshAdapter_object::test< 1 >() {
+  set_test_name( "leaf families" );
+
+  AMR::mesh_adapter_t m( inpoel );
+  ensure( "leaf families of initial mesh not empty",
+          m.tet_store.leaf_families.empty() );
+
+  m.mark_uniform_refinement();
+  m.perform_refinement();
+  ensure_equals( "number of leaf families after refinement incorrect",
+                 m.tet_store.leaf_families.size(), 24UL );
+
+  m.mark_uniform_refinement();
+  m.perform_refinement();
+  ensure_equals( "number of leaf families after 2nd refinement incorrect",
+                 m.tet_store.leaf_families.size(), 192UL );
+  for (auto p : m.tet_store.leaf_families)
+    ensure_equals( "refinement level of leaf family incorrect",
+                   m.tet_store.data(p).refinement_level, 1UL );
+
+  m.mark_uniform_derefinement();
+  m.perform_derefinement();
+  ensure_equals( "number of leaf families after derefinement incorrect",
+                 m.tet_store.leaf_families.size(), 24UL );
+  for (auto p : m.tet_store.leaf_families)
+    ensure_equals( "refinement level of leaf family incorrect",
+                   m.tet_store.data(p).refinement_level, 0UL );
+}
+
+//! Test that uniform derefinement undoes two levels of uniform refinement
+template<> template<>
+void AMRMeshAdapter_object::test< 2 >() {
+  set_test_name( "two-level uniform derefinement" );
+
+  AMR::mesh_adapter_t m( inpoel );
+  auto ref0 = m.tet_store.get_active_inpoel();
+
+  m.mark_uniform_refinement();
+  m.perform_refinement();
+  auto ref1 = m.tet_store.get_active_inpoel();
+
+  m.mark_uniform_refinement();
+  m.perform_refinement();
+  ensure_equals( "number of cells after 2nd refinement incorrect",
+                 m.tet_store.get_active_inpoel().size()/4, 1536UL );
+
+  m.mark_uniform_derefinement();
+  m.perform_derefinement();
+  ensure( "mesh after derefinement incorrect",
+          m.tet_store.get_active_inpoel() == ref1 );
+
+  m.mark_uniform_derefinement();
+  m.perform_derefinement();
+  ensure( "mesh after 2nd derefinement incorrect",
+          m.tet_store.get_active_inpoel() == ref0 );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
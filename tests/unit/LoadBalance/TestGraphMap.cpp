@@ -0,0 +1,239 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/LoadBalance/TestGraphMap.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for LoadBalance/GraphMap
+  \details   Unit tests for LoadBalance/GraphMap
+*/
+// *****************************************************************************
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "GraphMap.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct GraphMap_common {
+
+  //! Generate the communication graph of chares on a 2D structured grid
+  //! \param[in] nx Number of chares in x
+  //! \param[in] ny Number of chares in y
+  //! \return Communication graph with unit weights, chare id = j*nx+i
+  tk::ChareGraph grid( std::size_t nx, std::size_t ny ) {
+    tk::ChareGraph adj( nx*ny );
+    for (std::size_t j=0; j<ny; ++j)
+      for (std::size_t i=0; i<nx; ++i) {
+        auto c = j*nx+i;
+        if (i>0) adj[c].emplace_back( c-1, 1.0 );
+        if (i+1<nx) adj[c].emplace_back( c+1, 1.0 );
+        if (j>0) adj[c].emplace_back( c-nx, 1.0 );
+        if (j+1<ny) adj[c].emplace_back( c+nx, 1.0 );
+      }
+    return adj;
+  }
+
+  //! Compute the communication weight between chares on different PEs
+  //! \param[in] adj Communication graph of chares
+  //! \param[in] pe PE of each chare
+  //! \return Sum of weights of communication graph edges cut by PEs
+  tk::real cut( const tk::ChareGraph& adj, const std::vector< int >& pe ) {
+    tk::real w = 0.0;
+    for (std::size_t c=0; c<adj.size(); ++c)
+      for (const auto& [ d, x ] : adj[c])
+        if (pe[c] != pe[d]) w += x;
+    return w / 2.0;
+  }
+
+  //! Count the number of chares on each PE
+  //! \param[in] pe PE of each chare
+  //! \param[in] npe Number of PEs
+  //! \return Number of chares on each PE
+  std::vector< std::size_t > count( const std::vector< int >& pe, int npe ) {
+    std::vector< std::size_t > n( static_cast< std::size_t >( npe ), 0 );
+    for (auto p : pe) {
+      ensure( "PE out of range", p >= 0 && p < npe );
+      ++n[ static_cast< std::size_t >( p ) ];
+    }
+    return n;
+  }
+};
+
+//! Test group shortcuts
+using GraphMap_group = test_group< GraphMap_common, MAX_TESTS_IN_GROUP >;
+using GraphMap_object = GraphMap_group::object;
+
+//! Define test group
+static GraphMap_group GraphMap( "LoadBalance/GraphMap" );
+
+//! Test definitions for group
+
+//! Test that a single PE takes all chares
+template<> template<>
+void GraphMap_object::test< 1 >() {
+  set_test_name( "single PE" );
+
+  auto adj = grid( 3, 2 );
+  auto pe = tk::graphMap( std::vector< tk::real >( adj.size(), 1.0 ), adj, 1 );
+
+  ensure( "PEs incorrect", pe == std::vector< int >( adj.size(), 0 ) );
+}
+
+//! Test that a chain of chares numbered out of order is cut into PEs of
+//! neighbors
+template<> template<>
+void GraphMap_object::test< 2 >() {
+  set_test_name( "chain numbered out of order" );
+
+  // chain of chares: 0 - 4 - 1 - 5 - 2 - 6 - 3 - 7
+  std::vector< std::size_t > chain{ 0, 4, 1, 5, 2, 6, 3, 7 };
+  tk::ChareGraph adj( chain.size() );
+  for (std::size_t i=0; i+1<chain.size(); ++i) {
+    adj[ chain[i] ].emplace_back( chain[i+1], 2.0 );
+    adj[ chain[i+1] ].emplace_back( chain[i], 2.0 );
+  }
+
+  auto pe = tk::graphMap( std::vector< tk::real >( adj.size(), 1.0 ), adj, 4 );
+
+  for (auto n : count( pe, 4 ))
+    ensure_equals( "number of chares on PE incorrect", n, 2UL );
+  ensure_equals( "communication cut incorrect", cut( adj, pe ), 6.0, 1.0e-12 );
+  for (std::size_t i=1; i<chain.size(); ++i)
+    ensure( "PEs not contiguous along chain",
+            pe[ chain[i] ] >= pe[ chain[i-1] ] );
+}
+
+//! Test that a grid of chares is mapped to balanced PEs with small cut
+template<> template<>
+void GraphMap_object::test< 3 >() {
+  set_test_name( "balanced grid with small cut" );
+
+  auto adj = grid( 8, 8 );
+  auto pe = tk::graphMap( std::vector< tk::real >( adj.size(), 1.0 ), adj, 4 );
+
+  for (auto n : count( pe, 4 ))
+    ensure_equals( "number of chares on PE incorrect", n, 16UL );
+  // Strips of 2x8 cut 24 edges, blocks of 4x4 cut 16, a round-robin
+  // placement would cut all 112
+  ensure( "communication cut too large", cut( adj, pe ) <= 24.0 );
+}
+
+//! Test that more PEs than chares place each chare on its own PE
+template<> template<>
+void GraphMap_object::test< 4 >() {
+  set_test_name( "more PEs than chares" );
+
+  auto adj = grid( 3, 1 );
+  auto pe = tk::graphMap( std::vector< tk::real >( adj.size(), 1.0 ), adj, 5 );
+
+  auto n = count( pe, 5 );
+  for (std::size_t p=0; p<adj.size(); ++p)
+    ensure_equals( "number of chares on PE incorrect", n[p], 1UL );
+}
+
+//! Test that the load of chares is balanced across PEs
+template<> template<>
+void GraphMap_object::test< 5 >() {
+  set_test_name( "weighted load" );
+
+  // the last chare of a chain of 10 is as heavy as all others together
+  auto adj = grid( 10, 1 );
+  std::vector< tk::real > load( adj.size(), 1.0 );
+  load[9] = 9.0;
+
+  auto pe = tk::graphMap( load, adj, 2 );
+
+  auto n = count( pe, 2 );
+  ensure_equals( "number of chares on PE incorrect", n[1], 1UL );
+  ensure_equals( "PE of heavy chare incorrect", pe[9], 1 );
+}
+
+//! Test that PEs are assigned even if chares have no load
+template<> template<>
+void GraphMap_object::test< 6 >() {
+  set_test_name( "zero load" );
+
+  auto adj = grid( 4, 1 );
+  auto pe = tk::graphMap( std::vector< tk::real >( adj.size(), 0.0 ), adj, 2 );
+
+  for (auto n : count( pe, 2 ))
+    ensure( "PE without chares", n > 0 );
+}
+
+//! Test that a balanced placement is kept by rebalancing
+template<> template<>
+void GraphMap_object::test< 7 >() {
+  set_test_name( "rebalance keeps balanced" );
+
+  auto adj = grid( 4, 1 );
+  std::vector< int > pe{ 0, 0, 1, 1 };
+  auto newpe = tk::rebalance( std::vector< tk::real >( 4, 1.0 ),
+                              std::vector< tk::real >( 4, 1.0 ), adj, pe, 2,
+                              0.0 );
+
+  ensure( "PEs changed", newpe == pe );
+}
+
+//! Test that rebalancing moves neighbors together off the overloaded PE
+template<> template<>
+void GraphMap_object::test< 8 >() {
+  set_test_name( "rebalance overloaded PE" );
+
+  auto adj = grid( 8, 1 );
+  std::vector< int > pe( 8, 0 );
+  auto newpe = tk::rebalance( std::vector< tk::real >( 8, 1.0 ),
+                              std::vector< tk::real >( 8, 1.0 ), adj, pe, 2,
+                              0.0 );
+
+  for (auto n : count( newpe, 2 ))
+    ensure_equals( "number of chares on PE incorrect", n, 4UL );
+  ensure( "communication cut too large", cut( adj, newpe ) <= 3.0 );
+}
+
+//! Test that rebalancing does not move chares too costly to migrate
+template<> template<>
+void GraphMap_object::test< 9 >() {
+  set_test_name( "rebalance with costly migration" );
+
+  auto adj = grid( 4, 1 );
+  std::vector< int > pe{ 0, 0, 0, 1 };
+  std::vector< tk::real > load( 4, 1.0 );
+
+  // Moving a chare reduces the makespan by 1, migrating it costs 2
+  auto newpe = tk::rebalance( load, std::vector< tk::real >( 4, 2.0 ), adj,
+                              pe, 2, 1.0 );
+  ensure( "costly chare moved", newpe == pe );
+
+  // Migration costs 0.5: a single chare moves
+  newpe = tk::rebalance( load, std::vector< tk::real >( 4, 0.5 ), adj, pe, 2,
+                         1.0 );
+  auto n = count( newpe, 2 );
+  ensure_equals( "number of chares on PE 0 incorrect", n[0], 2UL );
+  ensure_equals( "chare moved incorrect", newpe[2], 1 );
+}
+
+//! Test that rebalancing moves the chare cheapest to migrate
+template<> template<>
+void GraphMap_object::test< 10 >() {
+  set_test_name( "rebalance cheapest migration" );
+
+  // 3 chares without communication on PE 0, PE 1 empty, chare 1 the smallest
+  tk::ChareGraph adj( 3 );
+  std::vector< int > pe{ 0, 0, 0 };
+  std::vector< tk::real > load{ 1.0, 1.0, 1.0 };
+  std::vector< tk::real > bytes{ 4.0, 1.0, 3.0 };
+
+  auto newpe = tk::rebalance( load, bytes, adj, pe, 2, 0.1 );
+
+  ensure( "PEs incorrect", newpe == std::vector< int >{ 0, 1, 0 } );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
@@ -159,6 +159,41 @@ void LoadDistributor_object::test< 7 >() {
   #endif
 }
 
+//! Test that auto-tuning does not over-decompose without latency
+template<> template<>
+void LoadDistributor_object::test< 8 >() {
+  set_test_name( "auto virt without latency" );
+
+  ensure_equals( "virtualization incorrect",
+    tk::autoVirtualization( 80000, 8, 1.0e-7, 0.0, 1.0e-6, 6 ), 0.0, 1.0e-12 );
+}
+
+//! Test that auto-tuning over-decomposes to hide a large latency
+template<> template<>
+void LoadDistributor_object::test< 9 >() {
+  set_test_name( "auto virt hides latency" );
+
+  // The work of a PE between two communication phases is 1.7e-4 s, which
+  // is shorter than the latency
+  auto v = tk::autoVirtualization( 80000, 8, 1.0e-7, 2.0e-4, 1.0e-6, 6 );
+  ensure( "virtualization out of bounds", v > 0.0 && v < 1.0 );
+
+  uint64_t chunksize, remainder;
+  auto nchare = tk::linearLoadDistributor( v, 80000, 8, chunksize, remainder );
+  ensure_equals( "number of chares incorrect", nchare, 24UL );
+}
+
+//! Test that auto-tuning does not over-decompose a single chare
+template<> template<>
+void LoadDistributor_object::test< 10 >() {
+  set_test_name( "auto virt on a single PE" );
+
+  ensure_equals( "virtualization incorrect",
+    tk::autoVirtualization( 8000, 1, 1.0e-7, 1.0, 0.0, 6 ), 0.0, 1.0e-12 );
+  ensure_equals( "virtualization incorrect",
+    tk::autoVirtualization( 5, 8, 1.0e-7, 1.0, 0.0, 6 ), 0.0, 1.0e-12 );
+}
+
 #if defined(STRICT_GNUC)
   #pragma GCC diagnostic pop
 #endif
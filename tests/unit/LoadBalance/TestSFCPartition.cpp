@@ -0,0 +1,196 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/LoadBalance/TestSFCPartition.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for LoadBalance/SFCPartition
+  \details   Unit tests for LoadBalance/SFCPartition
+*/
+// *****************************************************************************
+
+#include <random>
+#include <algorithm>
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "SFCPartition.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct SFCPartition_common {
+
+  //! Partition keys distributed among a number of callers
+  //! \param[in] key Keys of each caller
+  //! \param[in] weight Weights of each caller's keys, empty for unit weights
+  //! \param[in] npart Number of parts
+  //! \param[in] tol Relative tolerance on the weight of parts
+  //! \return Part of each key of each caller
+  std::vector< std::vector< std::size_t > >
+  partition( const std::vector< std::vector< std::uint64_t > >& key,
+             const std::vector< std::vector< tk::real > >& weight,
+             std::size_t npart,
+             tk::real tol )
+  {
+    std::vector< std::pair< std::vector< std::uint64_t >,
+                            std::vector< tk::real > > > cum;
+    for (std::size_t c=0; c<key.size(); ++c)
+      cum.push_back( tk::sfcCumulate( key[c], weight[c] ) );
+    tk::SFCSplitter s( npart, tol );
+    std::size_t it = 0;
+    while (!s.done()) {
+      // sum-reduce the weights below probes across callers
+      std::vector< tk::real > below( s.probes().size(), 0.0 );
+      for (const auto& [ sorted, cumw ] : cum) {
+        auto b = tk::sfcWeightBelow( sorted, cumw, s.probes() );
+        for (std::size_t p=0; p<b.size(); ++p) below[p] += b[p];
+      }
+      s.update( below );
+      ensure( "too many iterations finding splitters", ++it < 100 );
+    }
+    auto split = s.splitters();
+    ensure_equals( "number of splitters incorrect", split.size(), npart-1 );
+    std::vector< std::vector< std::size_t > > part;
+    for (const auto& k : key) part.push_back( tk::sfcPart( k, split ) );
+    return part;
+  }
+
+  //! Generate random keys of a number of callers
+  //! \param[in] ncaller Number of callers
+  //! \param[in] nkey Number of keys per caller
+  //! \return Random keys within the range of 63-bit Hilbert keys
+  std::vector< std::vector< std::uint64_t > >
+  randomKeys( std::size_t ncaller, std::size_t nkey ) {
+    std::mt19937_64 gen( 1234 );
+    std::uniform_int_distribution< std::uint64_t > dist( 0, (1UL<<63) - 1 );
+    std::vector< std::vector< std::uint64_t > > key( ncaller );
+    for (auto& k : key)
+      for (std::size_t i=0; i<nkey; ++i) k.push_back( dist(gen) );
+    return key;
+  }
+};
+
+//! Test group shortcuts
+using SFCPartition_group =
+  test_group< SFCPartition_common, MAX_TESTS_IN_GROUP >;
+using SFCPartition_object = SFCPartition_group::object;
+
+//! Define test group
+static SFCPartition_group SFCPartition( "LoadBalance/SFCPartition" );
+
+//! Test definitions for group
+
+//! Test that a single part needs only the total weight
+template<> template<>
+void SFCPartition_object::test< 1 >() {
+  set_test_name( "single part" );
+
+  tk::SFCSplitter s( 1 );
+  ensure_equals( "number of initial probes incorrect", s.probes().size(), 1UL );
+  s.update( { 10.0 } );
+  ensure( "splitter not done", s.done() );
+  ensure( "splitters not empty", s.splitters().empty() );
+
+  auto part = tk::sfcPart( { 3, 1, 2 }, s.splitters() );
+  ensure( "parts incorrect", part == std::vector< std::size_t >( 3, 0 ) );
+}
+
+//! Test that distinct consecutive keys are split exactly with zero tolerance
+template<> template<>
+void SFCPartition_object::test< 2 >() {
+  set_test_name( "exact split of consecutive keys" );
+
+  // 3 callers holding the keys 0...59 interleaved
+  std::vector< std::vector< std::uint64_t > > key( 3 );
+  for (std::uint64_t k=0; k<60; ++k) key[k%3].push_back( 59-k );
+
+  auto part = partition( key, { {}, {}, {} }, 6, 0.0 );
+
+  for (std::size_t c=0; c<key.size(); ++c)
+    for (std::size_t i=0; i<key[c].size(); ++i)
+      ensure_equals( "part of key incorrect", part[c][i], key[c][i]/10 );
+}
+
+//! Test that random keys are split into parts balanced within tolerance
+template<> template<>
+void SFCPartition_object::test< 3 >() {
+  set_test_name( "balanced split of random keys" );
+
+  const std::size_t npart = 7;
+  const tk::real tol = 0.01;
+  auto key = randomKeys( 4, 2500 );
+
+  auto part = partition( key, { {}, {}, {}, {} }, npart, tol );
+
+  // Test if parts are balanced and contiguous along the curve
+  std::vector< std::pair< std::uint64_t, std::size_t > > kp;
+  std::vector< tk::real > w( npart, 0.0 );
+  for (std::size_t c=0; c<key.size(); ++c)
+    for (std::size_t i=0; i<key[c].size(); ++i) {
+      kp.emplace_back( key[c][i], part[c][i] );
+      w[ part[c][i] ] += 1.0;
+    }
+  auto mean = 10000.0 / static_cast< tk::real >( npart );
+  for (auto x : w)
+    ensure_equals( "part weight not balanced", x, mean, 2.0*tol*mean + 1.0 );
+  std::sort( begin(kp), end(kp) );
+  for (std::size_t i=1; i<kp.size(); ++i)
+    ensure( "parts not contiguous along curve",
+            kp[i].second >= kp[i-1].second );
+}
+
+//! Test that weighted random keys are split into parts balanced in weight
+template<> template<>
+void SFCPartition_object::test< 4 >() {
+  set_test_name( "balanced split of weighted random keys" );
+
+  const std::size_t npart = 5;
+  const tk::real tol = 0.01;
+  auto key = randomKeys( 3, 2000 );
+
+  // Weight keys in the lower half of the key range ten times more
+  std::vector< std::vector< tk::real > > weight( key.size() );
+  tk::real total = 0.0;
+  for (std::size_t c=0; c<key.size(); ++c)
+    for (auto k : key[c]) {
+      weight[c].push_back( k < (1UL<<62) ? 10.0 : 1.0 );
+      total += weight[c].back();
+    }
+
+  auto part = partition( key, weight, npart, tol );
+
+  std::vector< tk::real > w( npart, 0.0 );
+  for (std::size_t c=0; c<key.size(); ++c)
+    for (std::size_t i=0; i<key[c].size(); ++i)
+      w[ part[c][i] ] += weight[c][i];
+  auto mean = total / static_cast< tk::real >( npart );
+  for (auto x : w)
+    ensure_equals( "part weight not balanced", x, mean, 2.0*tol*mean + 10.0 );
+}
+
+//! Test that parts are found with some callers holding no keys
+template<> template<>
+void SFCPartition_object::test< 5 >() {
+  set_test_name( "callers without keys" );
+
+  auto key = randomKeys( 1, 1000 );
+  key.emplace_back();
+
+  auto part = partition( key, { {}, {} }, 4, 0.01 );
+
+  ensure( "part of caller without keys not empty", part[1].empty() );
+  std::vector< std::size_t > n( 4, 0 );
+  for (auto p : part[0]) ++n[p];
+  for (auto x : n)
+    ensure_equals( "part size not balanced", static_cast< tk::real >( x ),
+                   250.0, 6.0 );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
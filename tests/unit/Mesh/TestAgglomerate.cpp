@@ -0,0 +1,129 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Mesh/TestAgglomerate.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for Mesh/Agglomerate
+  \details   Unit tests for Mesh/Agglomerate. The tests use a chain of five
+    nodes, 0-1-2-3-4, on the x axis, with unit distance, unit volumes, and
+    dual-face normals (1,0,0) along the edges.
+*/
+// *****************************************************************************
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "Agglomerate.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct Agglomerate_common {
+  // cppcheck-suppress unusedStructMember
+  double precision = 1.0e-14;    // required floating-point precision
+
+  //! Node coordinates of the chain
+  std::array< std::vector< tk::real >, 3 > coord{{
+    { 0.0, 1.0, 2.0, 3.0, 4.0 },
+    { 0.0, 0.0, 0.0, 0.0, 0.0 },
+    { 0.0, 0.0, 0.0, 0.0, 0.0 } }};
+  //! Dual-cell volumes of the chain
+  std::vector< tk::real > vol{ 1.0, 1.0, 1.0, 1.0, 1.0 };
+  //! Edges of the chain, the second one reversed
+  std::vector< tk::lid_t > edgenode{ 0,1, 2,1, 2,3, 3,4 };
+  //! Dual-face normals of the chain, oriented along the edges
+  std::vector< tk::real > dfn{  1.0, 0.0, 0.0,  1.0, 0.0, 0.0,
+                               -1.0, 0.0, 0.0, -1.0, 0.0, 0.0,
+                                1.0, 0.0, 0.0,  1.0, 0.0, 0.0,
+                                1.0, 0.0, 0.0,  1.0, 0.0, 0.0 };
+};
+
+//! Test group shortcuts
+using Agglomerate_group =
+  test_group< Agglomerate_common, MAX_TESTS_IN_GROUP >;
+using Agglomerate_object = Agglomerate_group::object;
+
+//! Define test group
+static Agglomerate_group Agglomerate( "Mesh/Agglomerate" );
+
+//! Test definitions for group
+
+//! Test that a node left alone is attached to a neighbor agglomerate
+template<> template<>
+void Agglomerate_object::test< 1 >() {
+  set_test_name( "agglomerate free chain" );
+
+  std::size_t ncoarse = 0;
+  auto map = tk::agglomerate( 5, edgenode, std::vector< char >(5,0), ncoarse );
+
+  ensure_equals( "number of agglomerates incorrect", ncoarse, 2UL );
+  ensure( "agglomerates incorrect",
+          map == std::vector< std::size_t >{ 0, 0, 1, 1, 1 } );
+}
+
+//! Test that frozen nodes are singletons
+template<> template<>
+void Agglomerate_object::test< 2 >() {
+  set_test_name( "agglomerate with frozen nodes" );
+
+  std::size_t ncoarse = 0;
+  auto map = tk::agglomerate( 5, edgenode, { 1, 0, 0, 0, 1 }, ncoarse );
+
+  ensure_equals( "number of agglomerates incorrect", ncoarse, 3UL );
+  ensure( "agglomerates incorrect",
+          map == std::vector< std::size_t >{ 0, 1, 1, 1, 2 } );
+}
+
+//! Test coarse volumes, centroids, edges, and oriented dual-face normals
+template<> template<>
+void Agglomerate_object::test< 3 >() {
+  set_test_name( "coarsen free chain" );
+
+  auto c = tk::coarsen( coord, vol, edgenode, dfn, std::vector< char >(5,0) );
+
+  ensure( "volumes incorrect", c.vol == std::vector< tk::real >{ 2.0, 3.0 } );
+  ensure_equals( "centroid incorrect", c.coord[0][0], 0.5, precision );
+  ensure_equals( "centroid incorrect", c.coord[0][1], 3.0, precision );
+  ensure( "frozen flags incorrect", c.frozen == std::vector< char >{ 0, 0 } );
+  ensure( "edges incorrect", c.edgenode == std::vector< tk::lid_t >{ 0, 1 } );
+  ensure_equals( "number of normals incorrect", c.dfn.size(), 6UL );
+  ensure_equals( "normal incorrect", c.dfn[0], 1.0, precision );
+  ensure_equals( "normal incorrect", c.dfn[3], 1.0, precision );
+}
+
+//! Test that the dual-face normals of coarse cells sum to those of fine cells
+template<> template<>
+void Agglomerate_object::test< 4 >() {
+  set_test_name( "coarse dual cells conserve normals" );
+
+  std::vector< char > frozen{ 1, 0, 0, 0, 1 };
+  auto c = tk::coarsen( coord, vol, edgenode, dfn, frozen );
+
+  // sum of normals leaving each node (x component) of the fine and coarse
+  // levels
+  std::vector< tk::real > fine( 5, 0.0 ), coarse( c.vol.size(), 0.0 );
+  for (std::size_t e=0; e<edgenode.size()/2; ++e) {
+    fine[ edgenode[e*2+0] ] += dfn[e*6];
+    fine[ edgenode[e*2+1] ] -= dfn[e*6];
+  }
+  for (std::size_t e=0; e<c.edgenode.size()/2; ++e) {
+    coarse[ c.edgenode[e*2+0] ] += c.dfn[e*6];
+    coarse[ c.edgenode[e*2+1] ] -= c.dfn[e*6];
+  }
+  std::vector< tk::real > sum( c.vol.size(), 0.0 );
+  for (std::size_t p=0; p<5; ++p) sum[ c.map[p] ] += fine[p];
+
+  ensure_equals( "number of coarse edges incorrect", c.edgenode.size(), 4UL );
+  ensure( "frozen flags incorrect",
+          c.frozen == std::vector< char >{ 1, 0, 1 } );
+  for (std::size_t i=0; i<c.vol.size(); ++i)
+    ensure_equals( "sum of normals incorrect", coarse[i], sum[i], precision );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
@@ -0,0 +1,165 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Mesh/TestBVH.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for Mesh/BVH
+  \details   Unit tests for Mesh/BVH.
+*/
+// *****************************************************************************
+
+#include <set>
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "BVH.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct BVH_common {
+
+  //! \brief Generate a structured mesh of n^3 unit cubes each split into 6
+  //!   tetrahedra sharing the main diagonal of the cube
+  //! \param[in] n Number of cubes per side
+  //! \param[out] coord Node coordinates
+  //! \param[out] inpoel Element connectivity
+  static void cubes( std::size_t n,
+                     std::array< std::vector< tk::real >, 3 >& coord,
+                     std::vector< std::size_t >& inpoel )
+  {
+    const auto m = n+1;
+    auto id = [m]( std::size_t i, std::size_t j, std::size_t k )
+      { return (k*m + j)*m + i; };
+    for (auto& c : coord) c.resize( m*m*m );
+    for (std::size_t k=0; k<m; ++k)
+      for (std::size_t j=0; j<m; ++j)
+        for (std::size_t i=0; i<m; ++i) {
+          coord[0][ id(i,j,k) ] = static_cast< tk::real >( i );
+          coord[1][ id(i,j,k) ] = static_cast< tk::real >( j );
+          coord[2][ id(i,j,k) ] = static_cast< tk::real >( k );
+        }
+    for (std::size_t k=0; k<n; ++k)
+      for (std::size_t j=0; j<n; ++j)
+        for (std::size_t i=0; i<n; ++i) {
+          std::array< std::size_t, 8 > c{{
+            id(i,j,k), id(i+1,j,k), id(i+1,j+1,k), id(i,j+1,k),
+            id(i,j,k+1), id(i+1,j,k+1), id(i+1,j+1,k+1), id(i,j+1,k+1) }};
+          // paths from corner 0 to corner 6 along the edges of the cube
+          const std::array< std::array< std::size_t, 2 >, 6 > path{{
+            {{1,2}}, {{2,3}}, {{3,7}}, {{7,4}}, {{4,5}}, {{5,1}} }};
+          for (const auto& p : path)
+            inpoel.insert( end(inpoel), { c[0], c[p[0]], c[p[1]], c[6] } );
+        }
+  }
+};
+
+//! Test group shortcuts
+using BVH_group = test_group< BVH_common, MAX_TESTS_IN_GROUP >;
+using BVH_object = BVH_group::object;
+
+//! Define test group
+static BVH_group BVH( "Mesh/BVH" );
+
+//! Test definitions for group
+
+//! Test that an empty connectivity yields an empty hierarchy
+template<> template<>
+void BVH_object::test< 1 >() {
+  set_test_name( "empty" );
+
+  std::array< std::vector< tk::real >, 3 > coord;
+  tk::BVH tree( coord, {} );
+
+  ensure( "hierarchy not empty", tree.empty() );
+  ensure( "empty hierarchy found an element",
+          !tree.find( 0.0, 0.0, 0.0, []( std::size_t ){ return true; } ) );
+}
+
+//! Test that the box of the hierarchy bounds the mesh
+template<> template<>
+void BVH_object::test< 2 >() {
+  set_test_name( "bounding box" );
+
+  std::array< std::vector< tk::real >, 3 > coord;
+  std::vector< std::size_t > inpoel;
+  cubes( 3, coord, inpoel );
+  tk::BVH tree( coord, inpoel );
+
+  const auto& b = tree.box();
+  for (std::size_t j=0; j<3; ++j) {
+    ensure_equals( "min of box incorrect", b[j], 0.0, 1.0e-15 );
+    ensure_equals( "max of box incorrect", b[j+3], 3.0, 1.0e-15 );
+  }
+}
+
+//! Test that exactly the elements whose boxes contain a point are visited
+template<> template<>
+void BVH_object::test< 3 >() {
+  set_test_name( "elements visited" );
+
+  std::array< std::vector< tk::real >, 3 > coord;
+  std::vector< std::size_t > inpoel;
+  cubes( 4, coord, inpoel );
+  tk::BVH tree( coord, inpoel );
+
+  const std::array< std::array< tk::real, 3 >, 3 > points{{
+    {{ 0.3, 0.2, 0.1 }}, {{ 2.5, 1.5, 3.7 }}, {{ 3.9, 3.9, 0.5 }} }};
+
+  for (const auto& p : points) {
+    // elements in cube containing the point only, as boxes are the cubes
+    std::set< std::size_t > expected;
+    const auto i = static_cast< std::size_t >( p[0] );
+    const auto j = static_cast< std::size_t >( p[1] );
+    const auto k = static_cast< std::size_t >( p[2] );
+    for (std::size_t t=0; t<6; ++t) expected.insert( ((k*4 + j)*4 + i)*6 + t );
+
+    std::set< std::size_t > visited;
+    auto found = tree.find( p[0], p[1], p[2],
+                   [&]( std::size_t e ){ visited.insert(e); return false; } );
+
+    ensure( "search not exhausted", !found );
+    ensure( "elements visited incorrect", visited == expected );
+  }
+}
+
+//! Test that the search stops at the element accepted
+template<> template<>
+void BVH_object::test< 4 >() {
+  set_test_name( "search stops" );
+
+  std::array< std::vector< tk::real >, 3 > coord;
+  std::vector< std::size_t > inpoel;
+  cubes( 4, coord, inpoel );
+  tk::BVH tree( coord, inpoel );
+
+  std::size_t nvisit = 0;
+  auto found = tree.find( 1.5, 1.5, 1.5,
+                 [&]( std::size_t e ){ ++nvisit; return e == 21*6+3; } );
+
+  ensure( "element not found", found );
+  ensure( "search did not stop at element", nvisit <= 6 );
+}
+
+//! Test that a point outside of the mesh finds no elements
+template<> template<>
+void BVH_object::test< 5 >() {
+  set_test_name( "point outside" );
+
+  std::array< std::vector< tk::real >, 3 > coord;
+  std::vector< std::size_t > inpoel;
+  cubes( 2, coord, inpoel );
+  tk::BVH tree( coord, inpoel );
+
+  ensure( "point outside found an element",
+          !tree.find( 2.5, 1.0, 1.0, []( std::size_t ){ return true; } ) );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
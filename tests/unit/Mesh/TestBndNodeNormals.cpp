@@ -0,0 +1,104 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Mesh/TestBndNodeNormals.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for Mesh/BndNodeNormals
+  \details   Unit tests for Mesh/BndNodeNormals.
+*/
+// *****************************************************************************
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "BndNodeNormals.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct BndNodeNormals_common {
+
+  // Boundary point normals of two side sets sharing node 4
+  tk::BndNodeNormals::Normals bnorm{
+    { 3, { { 7, {{ 1.0, 0.0, 0.0, 2.0 }} },
+           { 4, {{ 0.0, 1.0, 0.0, 2.0 }} },
+           { 2, {{ 0.0, 0.0, 1.0, 2.0 }} } } },
+    { 1, { { 4, {{ 0.0, 0.0, -1.0, 2.0 }} },
+           { 9, {{ -1.0, 0.0, 0.0, 2.0 }} } } } };
+};
+
+// Test group shortcuts
+// The 2nd template argument is the max number of tests in this group. If
+// omitted, the default is 50, specified in tut/tut.hpp.
+using BndNodeNormals_group =
+  test_group< BndNodeNormals_common, MAX_TESTS_IN_GROUP >;
+using BndNodeNormals_object = BndNodeNormals_group::object;
+
+//! Define test group
+static BndNodeNormals_group BndNodeNormals( "Mesh/BndNodeNormals" );
+
+//! Test definitions for group
+
+//! Test if entries are grouped by side set and sorted by node id
+template<> template<>
+void BndNodeNormals_object::test< 1 >() {
+  set_test_name( "entries grouped by side set and sorted" );
+
+  tk::BndNodeNormals bn( bnorm, { 2, 4, 7, 9 } );
+
+  ensure_equals( "number of side sets incorrect", bn.nside(), 2UL );
+  ensure_equals( "number of entries incorrect", bn.size(), 5UL );
+
+  auto k = bn.find( 1 );
+  ensure_equals( "side set 1 index incorrect", k, 0UL );
+  auto [b,e] = bn.range( k );
+  ensure_equals( "side set 1 size incorrect", e-b, 2UL );
+  ensure_equals( "side set 1 node 0 incorrect", bn.node()[b], 4UL );
+  ensure_equals( "side set 1 node 1 incorrect", bn.node()[b+1], 9UL );
+  ensure_equals( "side set 1 node 0 normal incorrect", bn.nz()[b], -1.0,
+                 1.0e-15 );
+  ensure_equals( "side set 1 node 1 normal incorrect", bn.nx()[b+1], -1.0,
+                 1.0e-15 );
+
+  k = bn.find( 3 );
+  ensure_equals( "side set 3 index incorrect", k, 1UL );
+  std::tie(b,e) = bn.range( k );
+  ensure_equals( "side set 3 size incorrect", e-b, 3UL );
+  ensure_equals( "side set 3 node 0 incorrect", bn.node()[b], 2UL );
+  ensure_equals( "side set 3 node 1 incorrect", bn.node()[b+1], 4UL );
+  ensure_equals( "side set 3 node 2 incorrect", bn.node()[b+2], 7UL );
+  ensure_equals( "side set 3 node 0 normal incorrect", bn.nz()[b], 1.0,
+                 1.0e-15 );
+  ensure_equals( "side set 3 node 1 normal incorrect", bn.ny()[b+1], 1.0,
+                 1.0e-15 );
+  ensure_equals( "side set 3 node 2 normal incorrect", bn.nx()[b+2], 1.0,
+                 1.0e-15 );
+}
+
+//! Test if nodes not in the set and missing side sets are left out
+template<> template<>
+void BndNodeNormals_object::test< 2 >() {
+  set_test_name( "node filter and missing side sets" );
+
+  tk::BndNodeNormals bn( bnorm, { 4 } );
+
+  ensure_equals( "number of entries incorrect", bn.size(), 2UL );
+  ensure_equals( "missing side set found", bn.find( 2 ), bn.nside() );
+  for (auto s : { 1, 3 }) {
+    auto [b,e] = bn.range( bn.find( s ) );
+    ensure_equals( "side set size incorrect", e-b, 1UL );
+    ensure_equals( "node incorrect", bn.node()[b], 4UL );
+  }
+
+  tk::BndNodeNormals empty;
+  ensure_equals( "empty has side sets", empty.nside(), 0UL );
+  ensure_equals( "empty has entries", empty.size(), 0UL );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
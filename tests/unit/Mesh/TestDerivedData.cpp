@@ -3200,6 +3200,107 @@ void DerivedData_object::test< 61 >() {
                   geoElem(0,3,0), correct_ecent[2][0], prec);
 }
 
+//! Update face-geometry of a tetrahedron after moving one of its vertices
+template<> template<>
+void DerivedData_object::test< 62 >() {
+  set_test_name( "Face-geometry update (updGeoFaceTri)" );
+
+  // coordinates of tetrahedron vertices
+  tk::UnsMesh::Coords coord {{ {1.0, 0.0, 0.0, 0.0},
+                               {0.0, 0.0, 1.0, 0.0},
+                               {0.0, 0.0, 0.0, 1.0} }};
+
+  // face-node connectivity
+  std::vector< std::size_t > inpofa { 0, 1, 2,
+                                      0, 3, 1,
+                                      1, 3, 2,
+                                      2, 3, 0 };
+
+  auto geoFace = tk::genGeoFaceTri( 4, inpofa, coord );
+
+  // move the apex and update only the faces adjacent to it
+  coord[0][3] = 0.2;
+  coord[1][3] = 0.3;
+  coord[2][3] = 2.0;
+  tk::updGeoFaceTri( inpofa, coord, tk::genEsup(inpofa,3), {3}, geoFace );
+
+  auto correct = tk::genGeoFaceTri( 4, inpofa, coord );
+
+  tk::real prec = std::numeric_limits< tk::real >::epsilon();
+
+  for (std::size_t f=0; f<4; ++f)
+    for (std::size_t i=0; i<7; ++i)
+      ensure_equals( "incorrect entry " + std::to_string(f) + "," +
+                     std::to_string(i) + " in updated geoFace",
+                     geoFace(f,i,0), correct(f,i,0), prec );
+}
+
+//! Update element-geometry of a mesh after moving one of its nodes
+template<> template<>
+void DerivedData_object::test< 63 >() {
+  set_test_name( "Element-geometry update (updGeoElemTet)" );
+
+  // Mesh connectivity for simple tetrahedron-only mesh
+  std::vector< std::size_t > inpoel { 12, 14,  9, 11,
+                                      10, 14, 13, 12,
+                                      14, 13, 12,  9,
+                                      10, 14, 12, 11,
+                                      1,  14,  5, 11,
+                                      7,   6, 10, 12,
+                                      14,  8,  5, 10,
+                                      8,   7, 10, 13,
+                                      7,  13,  3, 12,
+                                      1,   4, 14,  9,
+                                      13,  4,  3,  9,
+                                      3,   2, 12,  9,
+                                      4,   8, 14, 13,
+                                      6,   5, 10, 11,
+                                      1,   2,  9, 11,
+                                      2,   6, 12, 11,
+                                      6,  10, 12, 11,
+                                      2,  12,  9, 11,
+                                      5,  14, 10, 11,
+                                      14,  8, 10, 13,
+                                      13,  3, 12,  9,
+                                      7,  10, 13, 12,
+                                      14,  4, 13,  9,
+                                      14,  1,  9, 11 };
+
+  // Shift node IDs to start from zero
+  tk::shiftToZero( inpoel );
+
+  // Mesh node coordinates of the unit cube
+  tk::UnsMesh::Coords coord{{
+    { 0, 1, 1, 0, 0, 1, 1, 0, 0.5, 0.5, 0.5, 1,   0.5, 0 },
+    { 0, 0, 1, 1, 0, 0, 1, 1, 0.5, 0.5, 0,   0.5, 1,   0.5 },
+    { 0, 0, 0, 0, 1, 1, 1, 1, 0,   1,   0.5, 0.5, 0.5, 0.5 } }};
+
+  auto geoElem = tk::genGeoElemTet( inpoel, coord );
+
+  // push the centers of the faces x=0 and z=0 into the cube
+  coord[0][13] = 0.1;
+  coord[2][8] = 0.2;
+  auto dv = tk::updGeoElemTet( inpoel, coord, tk::genEsup(inpoel,4),
+                               {13,8}, geoElem );
+
+  auto correct = tk::genGeoElemTet( inpoel, coord );
+
+  tk::real prec = 10.0*std::numeric_limits< tk::real >::epsilon();
+
+  tk::real vol = 0.0;
+  for (std::size_t e=0; e<inpoel.size()/4; ++e) {
+    vol += correct(e,0,0);
+    for (std::size_t i=0; i<4; ++i)
+      ensure_equals( "incorrect entry " + std::to_string(e) + "," +
+                     std::to_string(i) + " in updated geoElem",
+                     geoElem(e,i,0), correct(e,i,0), prec );
+  }
+
+  // each face center pushed in cuts off a pyramid over a unit square face
+  ensure_equals( "incorrect volume change", dv, -(0.1+0.2)/3.0, prec );
+  ensure_equals( "incorrect mesh volume", vol, 1.0 + dv, prec );
+}
+
 // Test conform() repeatedly on meshes refining an edge
 template<> template<>
 void DerivedData_object::test< 71 >() {
@@ -3386,6 +3487,213 @@ void DerivedData_object::test< 75 >() {
   #endif
 }
 
+//! Update points surrounding points after refining and derefining a tet
+template<> template<>
+void DerivedData_object::test< 76 >() {
+  set_test_name( "update psup after refinement and derefinement" );
+
+  // Mesh connectivity for simple tetrahedron-only mesh
+  std::vector< std::size_t > inpoel { 12, 14,  9, 11,
+                                      10, 14, 13, 12,
+                                      14, 13, 12,  9,
+                                      10, 14, 12, 11,
+                                      1,  14,  5, 11,
+                                      7,   6, 10, 12,
+                                      14,  8,  5, 10,
+                                      8,   7, 10, 13,
+                                      7,  13,  3, 12,
+                                      1,   4, 14,  9,
+                                      13,  4,  3,  9,
+                                      3,   2, 12,  9,
+                                      4,   8, 14, 13,
+                                      6,   5, 10, 11,
+                                      1,   2,  9, 11,
+                                      2,   6, 12, 11,
+                                      6,  10, 12, 11,
+                                      2,  12,  9, 11,
+                                      5,  14, 10, 11,
+                                      14,  8, 10, 13,
+                                      13,  3, 12,  9,
+                                      7,  10, 13, 12,
+                                      14,  4, 13,  9,
+                                      14,  1,  9, 11 };
+
+  // Shift node IDs to start from zero
+  tk::shiftToZero( inpoel );
+  auto npoin = tk::npoin_in_graph( inpoel );
+
+  // Refine the first tet by adding a node at its centroid: replace the tet by
+  // its first child and append its other three children
+  auto refinpoel = inpoel;
+  std::array< std::size_t, 4 > t{{ inpoel[0], inpoel[1], inpoel[2],
+                                   inpoel[3] }};
+  auto n = npoin;
+  refinpoel[3] = n;
+  refinpoel.insert( end(refinpoel), { t[0], t[1], n, t[3],
+                                      t[0], n, t[2], t[3],
+                                      n, t[1], t[2], t[3] } );
+
+  // Update psup of original mesh to refined mesh and compare to genPsup
+  auto esup = tk::genEsup( inpoel, 4 );
+  auto psup = tk::genPsup( inpoel, 4, esup );
+  auto refesup = tk::genEsup( refinpoel, 4 );
+  auto refpsup = tk::genPsup( refinpoel, 4, refesup );
+  std::vector< std::size_t > map( npoin );
+  for (std::size_t p=0; p<npoin; ++p) map[p] = p;
+  auto updpsup =
+    tk::updatePsup( refinpoel, 4, refesup, psup, map, { t[0], t[1], t[2],
+                                                        t[3], n } );
+  ensure( "updated psup1 after refinement incorrect",
+          updpsup.first == refpsup.first );
+  ensure( "updated psup2 after refinement incorrect",
+          updpsup.second == refpsup.second );
+
+  // Update psup of refined mesh to original mesh, removing the added node
+  map.push_back( std::numeric_limits< std::size_t >::max() );
+  auto derpsup =
+    tk::updatePsup( inpoel, 4, esup, refpsup, map, { t[0], t[1], t[2],
+                                                     t[3] } );
+  ensure( "updated psup1 after derefinement incorrect",
+          derpsup.first == psup.first );
+  ensure( "updated psup2 after derefinement incorrect",
+          derpsup.second == psup.second );
+}
+
+//! Shapefunctions from inverse Jacobians of a single tetrahedron at many points
+template<> template<>
+void DerivedData_object::test< 77 >() {
+  set_test_name( "shapeTet at many points agrees with intet" );
+
+  // A skewed tetrahedron
+  std::array< std::vector< tk::real >, 3 > coord{{ { 0.1, 1.2, 0.3, 0.2 },
+                                                   { 0.0, 0.1, 0.9, 0.3 },
+                                                   { 0.2, 0.1, 0.0, 1.1 } }};
+  std::vector< std::size_t > inpoel { 0, 1, 2, 3 };
+
+  // Points inside, outside, and on the other side of each face
+  std::array< std::vector< tk::real >, 3 > p{{
+    { 0.4, 1.5, 0.3, -0.2, 0.45, 0.2 },
+    { 0.3, 0.2, 0.5,  0.3, 0.25, 0.5 },
+    { 0.3, 0.6, 0.1,  0.2, 0.05, 0.9 } }};
+
+  auto invjac = tk::genInvJacTet( coord, inpoel );
+  ensure_equals( "invjac size incorrect", invjac.size(), tk::InvJacTetSize );
+
+  std::array< std::vector< tk::real >, 4 > N;
+  tk::shapeTet( invjac, 0, p, N );
+
+  std::size_t nin = 0;
+  for (std::size_t i=0; i<p[0].size(); ++i) {
+    std::array< tk::real, 4 > Nc, Ns;
+    auto in = tk::intet( coord, inpoel, { p[0][i], p[1][i], p[2][i] }, 0, Nc );
+    tk::shapeTet( invjac, 0, p[0][i], p[1][i], p[2][i], Ns );
+    for (std::size_t a=0; a<4; ++a) {
+      ensure_equals( "batched shapefunction incorrect", N[a][i], Nc[a],
+                     1.0e-12 );
+      ensure_equals( "single shapefunction incorrect", Ns[a], Nc[a], 1.0e-12 );
+    }
+    ensure_equals( "point in tet incorrect", tk::intet( Ns ), in );
+    if (in) ++nin;
+  }
+  ensure_equals( "number of points in tet incorrect", nin, 2UL );
+}
+
+//! Shapefunctions from inverse Jacobians of many tetrahedra at a point each
+template<> template<>
+void DerivedData_object::test< 78 >() {
+  set_test_name( "shapeTet one point per tet agrees with intet" );
+
+  // Mesh connectivity for simple tetrahedron-only mesh
+  std::vector< std::size_t > inpoel { 12, 14,  9, 11,
+                                      10, 14, 13, 12,
+                                      14, 13, 12,  9,
+                                      10, 14, 12, 11,
+                                      1,  14,  5, 11,
+                                      7,   6, 10, 12,
+                                      14,  8,  5, 10,
+                                      8,   7, 10, 13,
+                                      7,  13,  3, 12,
+                                      1,   4, 14,  9,
+                                      13,  4,  3,  9,
+                                      3,   2, 12,  9,
+                                      4,   8, 14, 13,
+                                      6,   5, 10, 11,
+                                      1,   2,  9, 11,
+                                      2,   6, 12, 11,
+                                      6,  10, 12, 11,
+                                      2,  12,  9, 11,
+                                      5,  14, 10, 11,
+                                      14,  8, 10, 13,
+                                      13,  3, 12,  9,
+                                      7,  10, 13, 12,
+                                      14,  4, 13,  9,
+                                      14,  1,  9, 11 };
+
+  // Shift node IDs to start from zero
+  tk::shiftToZero( inpoel );
+
+  // Mesh node coordinates, see the mesh in Gmsh format above
+  std::array< std::vector< tk::real >, 3 > coord{{
+    { 0, 1, 1, 0, 0, 1, 1, 0, 0.5, 0.5, 0.5, 1,   0.5, 0 },
+    { 0, 0, 1, 1, 0, 0, 1, 1, 0.5, 0.5, 0,   0.5, 1,   0.5 },
+    { 0, 0, 0, 0, 1, 1, 1, 1, 0,   1,   0.5, 0.5, 0.5, 0.5 } }};
+
+  // Query the same point against every tetrahedron
+  const auto nelem = inpoel.size()/4;
+  std::vector< std::size_t > e( nelem );
+  std::array< std::vector< tk::real >, 3 > p;
+  for (std::size_t i=0; i<nelem; ++i) {
+    e[i] = i;
+    p[0].push_back( 0.6 );
+    p[1].push_back( 0.55 );
+    p[2].push_back( 0.3 );
+  }
+
+  auto invjac = tk::genInvJacTet( coord, inpoel );
+  std::array< std::vector< tk::real >, 4 > N;
+  tk::shapeTet( invjac, e, p, N );
+
+  std::size_t nin = 0;
+  for (std::size_t i=0; i<nelem; ++i) {
+    std::array< tk::real, 4 > Nc;
+    auto in = tk::intet( coord, inpoel, { 0.6, 0.55, 0.3 }, i, Nc );
+    for (std::size_t a=0; a<4; ++a)
+      ensure_equals( "shapefunction incorrect", N[a][i], Nc[a], 1.0e-12 );
+    ensure_equals( "point in tet incorrect",
+                   tk::intet( {{ N[0][i], N[1][i], N[2][i], N[3][i] }} ), in );
+    if (in) ++nin;
+  }
+  ensure_equals( "number of tets containing point incorrect", nin, 1UL );
+}
+
+//! Test layers of elements surrounding a set of elements
+template<> template<>
+void DerivedData_object::test< 79 >() {
+  set_test_name( "genHalo on a strip of triangles" );
+
+  // Strip of six triangles, triangle i connecting nodes i, i+1, i+2
+  std::vector< std::size_t > inpoel { 0, 1, 2,
+                                      1, 2, 3,
+                                      2, 3, 4,
+                                      3, 4, 5,
+                                      4, 5, 6,
+                                      5, 6, 7 };
+  auto esup = tk::genEsup( inpoel, 3 );
+
+  // Layers grow until the strip is exhausted
+  auto halo = tk::genHalo( inpoel, 3, esup, { 0 }, 5 );
+  using L = std::vector< std::vector< std::size_t > >;
+  ensure( "layers from the end of the strip incorrect",
+          halo == L{ {1,2}, {3,4}, {5} } );
+
+  // Layers grow on both sides of the set, only as many as requested
+  halo = tk::genHalo( inpoel, 3, esup, { 2, 3 }, 1 );
+  ensure( "single layer incorrect", halo == L{ {0,1,4,5} } );
+
+  halo = tk::genHalo( inpoel, 3, esup, { 0, 1, 2, 3, 4, 5 }, 2 );
+  ensure( "layers of the whole mesh must be empty", halo.empty() );
+}
+
 #if defined(STRICT_GNUC)
   #pragma GCC diagnostic pop
 #endif
@@ -0,0 +1,115 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Mesh/TestDtLevels.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for Mesh/DtLevels
+  \details   Unit tests for Mesh/DtLevels. All unit tests start from a chain
+     of six mesh nodes, 0-1-2-3-4-5, given by its points surrounding points.
+*/
+// *****************************************************************************
+
+#include <limits>
+
+#include "TUTConfig.hpp"
+#include "NoWarning/tut.hpp"
+
+#include "DtLevels.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct DtLevels_common {
+  const tk::real pr = 10.0*std::numeric_limits< tk::real >::epsilon();
+
+  // points surrounding points of the chain of nodes, see tk::genPsup()
+  std::pair< std::vector< std::size_t >, std::vector< std::size_t > > psup{
+    { 0, 1, 0, 2, 1, 3, 2, 4, 3, 5, 4 },
+    { 0, 1, 3, 5, 7, 9, 10 } };
+};
+
+// Test group shortcuts
+// The 2nd template argument is the max number of tests in this group. If
+// omitted, the default is 50, specified in tut/tut.hpp.
+using DtLevels_group = test_group< DtLevels_common, MAX_TESTS_IN_GROUP >;
+using DtLevels_object = DtLevels_group::object;
+
+//! Define test group
+static DtLevels_group DtLevels( "Mesh/DtLevels" );
+
+//! Test definitions for group
+
+//! Test that uniform time step sizes yield a single level
+template<> template<>
+void DtLevels_object::test< 1 >() {
+  set_test_name( "uniform time step sizes" );
+
+  auto l = tk::dtlevels( std::vector< tk::real >( 6, 0.1 ), 0.1, 4, psup );
+
+  ensure( "all nodes must be on level 0",
+          l == std::vector< std::size_t >( 6, 0 ) );
+  ensure_equals( "speedup incorrect", tk::dtspeedup( {6,0,0,0} ), 1.0, pr );
+}
+
+//! Test that levels are the largest powers of two not exceeding the dt
+template<> template<>
+void DtLevels_object::test< 2 >() {
+  set_test_name( "levels of powers of two" );
+
+  // neighbors differ by at most one already
+  std::vector< tk::real > dtp{ 1.0, 1.999, 2.0, 4.5, 7.999, 8.0 };
+  auto l = tk::dtlevels( dtp, 1.0, 5, psup );
+
+  ensure( "levels incorrect", l == std::vector< std::size_t >{0,0,1,2,2,3} );
+}
+
+//! Test that levels of neighbors are made to differ by at most one
+template<> template<>
+void DtLevels_object::test< 3 >() {
+  set_test_name( "neighbor levels differ by at most one" );
+
+  std::vector< tk::real > dtp{ 1.0, 1.0, 16.0, 16.0, 16.0, 16.0 };
+  auto l = tk::dtlevels( dtp, 1.0, 5, psup );
+  ensure( "smoothed levels incorrect",
+          l == std::vector< std::size_t >{0,0,1,2,3,4} );
+
+  // a small dt in the middle of the chain lowers its neighbors on both sides
+  dtp = { 16.0, 16.0, 16.0, 1.0, 16.0, 16.0 };
+  l = tk::dtlevels( dtp, 1.0, 5, psup );
+  ensure( "levels around small dt incorrect",
+          l == std::vector< std::size_t >{3,2,1,0,1,2} );
+}
+
+//! Test that levels are capped by the number of levels
+template<> template<>
+void DtLevels_object::test< 4 >() {
+  set_test_name( "number of levels" );
+
+  std::vector< tk::real > dtp{ 1.0, 1.0, 16.0, 16.0, 16.0, 16.0 };
+  auto l = tk::dtlevels( dtp, 1.0, 3, psup );
+  ensure( "capped levels incorrect",
+          l == std::vector< std::size_t >{0,0,1,2,2,2} );
+
+  l = tk::dtlevels( dtp, 1.0, 1, psup );
+  ensure( "single level incorrect", l == std::vector< std::size_t >( 6, 0 ) );
+}
+
+//! Test the estimate of the speedup
+template<> template<>
+void DtLevels_object::test< 5 >() {
+  set_test_name( "speedup estimate" );
+
+  // 10 nodes on level 0, 90 nodes taking 8x larger time steps
+  ensure_equals( "speedup incorrect", tk::dtspeedup( {10,0,0,90} ),
+                 100.0/(10.0 + 90.0/8.0), pr );
+  ensure_equals( "speedup of no nodes incorrect", tk::dtspeedup( {} ), 1.0,
+                 pr );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
@@ -294,6 +294,60 @@ void Gradients_object::test< 2 >() {
   }
 }
 
+//! Test gradients using precomputed shape function derivatives
+template<> template<>
+void Gradients_object::test< 3 >() {
+  set_test_name( "batched gradients of tetrahedra mesh" );
+
+  // Shift node IDs to start from zero
+  tk::shiftToZero( inpoel );
+
+  // find out number of points in mesh connectivity
+  auto minmax = std::minmax_element( begin(inpoel), end(inpoel) );
+  Assert( *minmax.first == 0, "node ids should start from zero" );
+  auto npoin = *minmax.second + 1;
+
+  // Generate elements surrounding points and edges
+  auto esup = tk::genEsup( inpoel, 4 );
+  auto esued = tk::genEsued( inpoel, 4, esup );
+
+  // generate a nonlinear vector field, whose node gradients are not exact
+  tk::Fields u( npoin, 3 );
+  for (std::size_t p=0; p<npoin; ++p) {
+     const auto x = coord[0][p], y = coord[1][p], z = coord[2][p];
+     u(p,0,0) = x*y + z;
+     u(p,1,0) = 1.5*y*y - z*x;
+     u(p,2,0) = -0.5*x*y*z;
+  }
+
+  auto sg = tk::shapegrads( coord, inpoel );
+  ensure_equals( "number of element Jacobians incorrect", sg.J.size(),
+                 inpoel.size()/4 );
+
+  // batched node gradients must equal those computed node by node, in the
+  // order of the components requested
+  std::vector< std::size_t > comps{ 2, 0 };
+  auto grad = tk::nodegrads( sg, inpoel, esup, u, comps );
+  ensure_equals( "number of node gradients incorrect", grad.size(),
+                 npoin*comps.size() );
+  for (std::size_t p=0; p<npoin; ++p)
+    for (std::size_t i=0; i<comps.size(); ++i) {
+      auto g = nodegrad( p, coord, inpoel, esup, u, comps[i] );
+      for (std::size_t j=0; j<3; ++j)
+        ensure_equals( "batched node gradient incorrect",
+                       grad[p*comps.size()+i][j], g[j], pr );
+    }
+
+  // edge gradients from precomputed shape functions must equal the original
+  for (const auto& [edge,surr_elems] : esued)
+    for (std::size_t c=0; c<3; ++c) {
+      auto g = edgegrad( coord, inpoel, surr_elems, u, c );
+      auto h = edgegrad( sg, inpoel, surr_elems, u, c );
+      for (std::size_t j=0; j<3; ++j)
+        ensure_equals( "edge gradient incorrect", h[j], g[j], pr );
+    }
+}
+
 } // tut::
 
 #endif  // DOXYGEN_GENERATING_OUTPUT
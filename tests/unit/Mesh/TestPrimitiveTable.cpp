@@ -0,0 +1,108 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Mesh/TestPrimitiveTable.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for Mesh/PrimitiveTable
+  \details   Unit tests for Mesh/PrimitiveTable.
+*/
+// *****************************************************************************
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "PrimitiveTable.hpp"
+#include "UnsMesh.hpp"
+#include "DerivedData.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct PrimitiveTable_common {
+
+  // Mesh connectivity for simple tetrahedron-only mesh
+  std::vector< std::size_t > inpoel { 12, 14,  9, 11,
+                                      10, 14, 13, 12,
+                                      14, 13, 12,  9,
+                                      10, 14, 12, 11,
+                                      1,  14,  5, 11,
+                                      7,   6, 10, 12,
+                                      14,  8,  5, 10,
+                                      8,   7, 10, 13,
+                                      7,  13,  3, 12,
+                                      1,   4, 14,  9,
+                                      13,  4,  3,  9,
+                                      3,   2, 12,  9,
+                                      4,   8, 14, 13,
+                                      6,   5, 10, 11,
+                                      1,   2,  9, 11,
+                                      2,   6, 12, 11,
+                                      6,  10, 12, 11,
+                                      2,  12,  9, 11,
+                                      5,  14, 10, 11,
+                                      14,  8, 10, 13,
+                                      13,  3, 12,  9,
+                                      7,  10, 13, 12,
+                                      14,  4, 13,  9,
+                                      14,  1,  9, 11 };
+};
+
+// Test group shortcuts
+// The 2nd template argument is the max number of tests in this group. If
+// omitted, the default is 50, specified in tut/tut.hpp.
+using PrimitiveTable_group =
+  test_group< PrimitiveTable_common, MAX_TESTS_IN_GROUP >;
+using PrimitiveTable_object = PrimitiveTable_group::object;
+
+//! Define test group
+static PrimitiveTable_group PrimitiveTable( "Mesh/PrimitiveTable" );
+
+//! Test definitions for group
+
+//! Test if unique faces of a tetrahedron mesh equal those of a FaceSet
+template<> template<>
+void PrimitiveTable_object::test< 1 >() {
+  set_test_name( "unique faces equal those of FaceSet" );
+
+  tk::FaceTable table;
+  tk::UnsMesh::FaceSet set;
+  for (std::size_t e=0; e<inpoel.size()/4; ++e)
+    for (const auto& f : tk::lpofa) {
+      tk::UnsMesh::Face t{{ inpoel[e*4+f[0]], inpoel[e*4+f[1]],
+                            inpoel[e*4+f[2]] }};
+      table.insert( t );
+      set.insert( t );
+    }
+  table.finalize();
+
+  ensure_equals( "number of unique faces incorrect", table.size(), set.size() );
+  for (const auto& f : set)
+    ensure( "face not found", table.contains( f ) );
+  ensure( "faces not sorted", std::is_sorted( table.begin(), table.end() ) );
+}
+
+//! Test if node order does not matter and missing primitives are not found
+template<> template<>
+void PrimitiveTable_object::test< 2 >() {
+  set_test_name( "node order independence and negative queries" );
+
+  tk::EdgeTable table;
+  table.insert( {{ 3, 1 }} );
+  table.insert( {{ 1, 3 }} );
+  table.insert( {{ 2, 7 }} );
+  table.finalize();
+
+  ensure_equals( "number of unique edges incorrect", table.size(), 2UL );
+  ensure( "edge 1-3 not found", table.contains( {{ 1, 3 }} ) );
+  ensure( "edge 3-1 not found", table.contains( {{ 3, 1 }} ) );
+  ensure( "edge 7-2 not found", table.contains( {{ 7, 2 }} ) );
+  ensure( "edge 1-2 found", !table.contains( {{ 1, 2 }} ) );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
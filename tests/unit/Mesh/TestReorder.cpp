@@ -796,6 +796,161 @@ void Reorder_object::test< 18 >() {
   #endif
 }
 
+//! Renumber tetrahedron mesh with reverse Cuthill-McKee
+template<> template<>
+void Reorder_object::test< 19 >() {
+  set_test_name( "renumber tetrahedron mesh with RCM" );
+
+  // Shift node IDs to start from zero
+  auto inpoel = tetinpoel;
+  tk::shiftToZero( inpoel );
+
+  // Lambda to compute graph bandwidth of mesh
+  auto bandwidth = []( const std::vector< std::size_t >& ip ){
+    std::size_t b = 0;
+    for (std::size_t e=0; e<ip.size()/4; ++e)
+      for (std::size_t i=0; i<4; ++i)
+        for (std::size_t j=0; j<4; ++j)
+          b = std::max( b, ip[e*4+i] > ip[e*4+j] ? ip[e*4+i]-ip[e*4+j] : 0 );
+    return b;
+  };
+
+  // Renumber tetrahedron mesh
+  const auto psup = tk::genPsup( inpoel, 4, tk::genEsup( inpoel, 4 ) );
+  auto map = tk::renumberRCM( psup );
+
+  // Test if mapping is a permutation
+  auto sorted = map;
+  std::sort( begin(sorted), end(sorted) );
+  for (std::size_t i=0; i<sorted.size(); ++i)
+    ensure_equals( "RCM map is not a permutation", sorted[i], i );
+
+  // Test if bandwidth has not increased
+  auto b = bandwidth( inpoel );
+  tk::remap( inpoel, map );
+  ensure( "RCM increased bandwidth", bandwidth( inpoel ) <= b );
+}
+
+//! Renumber nodes of unit cube along Morton curve
+template<> template<>
+void Reorder_object::test< 20 >() {
+  set_test_name( "renumber along Morton curve" );
+
+  // First eight points of mesh are the corners of the unit cube
+  std::array< std::vector< tk::real >, 3 > coord;
+  for (std::size_t d=0; d<3; ++d)
+    coord[d].assign( begin(tetcoord[d]), begin(tetcoord[d])+8 );
+
+  auto map = tk::renumberMorton( coord );
+
+  // Morton order of the corners with x most significant: new id = 4x + 2y + z
+  for (std::size_t p=0; p<8; ++p)
+    ensure_equals( "Morton order of unit cube corners incorrect", map[p],
+      static_cast< std::size_t >( 4*coord[0][p] + 2*coord[1][p] + coord[2][p] ) );
+}
+
+//! Renumber nodes of a structured grid along Hilbert curve
+template<> template<>
+void Reorder_object::test< 21 >() {
+  set_test_name( "renumber along Hilbert curve" );
+
+  // Generate nodes of a structured grid of 4x4x4 nodes
+  const std::size_t n = 4;
+  std::array< std::vector< tk::real >, 3 > coord;
+  for (std::size_t i=0; i<n; ++i)
+    for (std::size_t j=0; j<n; ++j)
+      for (std::size_t k=0; k<n; ++k) {
+        coord[0].push_back( static_cast< tk::real >( i ) );
+        coord[1].push_back( static_cast< tk::real >( j ) );
+        coord[2].push_back( static_cast< tk::real >( k ) );
+      }
+
+  auto map = tk::renumberHilbert( coord );
+
+  // Construct new->old map, testing if mapping is a permutation
+  std::vector< std::size_t > order( map.size(), map.size() );
+  for (std::size_t p=0; p<map.size(); ++p) order[ map[p] ] = p;
+  for (auto p : order)
+    ensure( "Hilbert map is not a permutation", p < map.size() );
+
+  // Test if consecutive points along the Hilbert curve are grid neighbors
+  for (std::size_t i=1; i<order.size(); ++i) {
+    tk::real d = 0.0;
+    for (std::size_t c=0; c<3; ++c)
+      d += std::abs( coord[c][order[i]] - coord[c][order[i-1]] );
+    ensure_equals( "consecutive points on Hilbert curve not neighbors",
+                   d, 1.0, 1.0e-14 );
+  }
+}
+
+//! Reorder elements consistent with node order
+template<> template<>
+void Reorder_object::test< 22 >() {
+  set_test_name( "reorder elements consistent with nodes" );
+
+  // Shift node IDs to start from zero
+  auto inpoel = tetinpoel;
+  tk::shiftToZero( inpoel );
+  const auto orig = inpoel;
+
+  auto map = tk::reorderElements( inpoel, 4 );
+
+  ensure_equals( "element connectivity size changed", inpoel.size(),
+                 orig.size() );
+
+  // Test if element connectivity has been moved according to the map
+  for (std::size_t e=0; e<map.size(); ++e)
+    for (std::size_t i=0; i<4; ++i)
+      ensure_equals( "element not moved according to map",
+                     inpoel[map[e]*4+i], orig[e*4+i] );
+
+  // Test if lowest node ids of elements are non-decreasing
+  std::size_t prev = 0;
+  for (std::size_t e=0; e<inpoel.size()/4; ++e) {
+    auto m = *std::min_element( begin(inpoel)+e*4, begin(inpoel)+e*4+4 );
+    ensure( "lowest element node ids decreasing", m >= prev );
+    prev = m;
+  }
+}
+
+//! Compute Hilbert keys of parts of a point set within a common bounding box
+template<> template<>
+void Reorder_object::test< 23 >() {
+  set_test_name( "Hilbert keys of points within bounding box" );
+
+  // Generate nodes of a structured grid of 4x4x4 nodes
+  const std::size_t n = 4;
+  std::array< std::vector< tk::real >, 3 > coord, lo, hi;
+  for (std::size_t i=0; i<n; ++i)
+    for (std::size_t j=0; j<n; ++j)
+      for (std::size_t k=0; k<n; ++k) {
+        std::array< tk::real, 3 > x{{ static_cast< tk::real >( i ),
+                                      static_cast< tk::real >( j ),
+                                      static_cast< tk::real >( k ) }};
+        auto& part = i < n/2 ? lo : hi;
+        for (std::size_t c=0; c<3; ++c) {
+          coord[c].push_back( x[c] );
+          part[c].push_back( x[c] );
+        }
+      }
+
+  const std::array< tk::real, 6 > box{{ 0.0, 0.0, 0.0, 3.0, 3.0, 3.0 }};
+  auto key = tk::hilbertKeys( coord, box );
+  auto klo = tk::hilbertKeys( lo, box );
+  auto khi = tk::hilbertKeys( hi, box );
+
+  // Test if keys of the parts equal those of the whole point set
+  klo.insert( end(klo), begin(khi), end(khi) );
+  ensure( "Hilbert keys of parts differ from those of the whole", klo == key );
+
+  // Test if keys order the points the same as renumberHilbert()
+  auto map = tk::renumberHilbert( coord );
+  for (std::size_t p=0; p<key.size(); ++p)
+    for (std::size_t q=0; q<key.size(); ++q)
+      if (key[p] < key[q])
+        ensure( "Hilbert key order inconsistent", map[p] < map[q] );
+}
+
 #if defined(STRICT_GNUC)
   #pragma GCC diagnostic pop
 #endif
@@ -0,0 +1,186 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Mesh/TestSlice.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for Mesh/Slice
+  \details   Unit tests for Mesh/Slice. All unit tests start from the unit cube
+     split into five tetrahedra: four corner tetrahedra and one in the center.
+*/
+// *****************************************************************************
+
+#include <cmath>
+#include <limits>
+
+#include "TUTConfig.hpp"
+#include "NoWarning/tut.hpp"
+
+#include "Slice.hpp"
+#include "Vector.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct Slice_common {
+  const tk::real pr = 10.0*std::numeric_limits< tk::real >::epsilon();
+
+  // mesh node coordinates of the unit cube
+  tk::UnsMesh::Coords coord {{
+    {{ 0, 1, 1, 0, 0, 1, 1, 0 }},
+    {{ 0, 0, 1, 1, 0, 0, 1, 1 }},
+    {{ 0, 0, 0, 0, 1, 1, 1, 1 }} }};
+
+  // mesh connectivity of five tetrahedra
+  std::vector< std::size_t > inpoel { 0, 1, 3, 4,
+                                      1, 2, 3, 6,
+                                      1, 4, 5, 6,
+                                      3, 4, 6, 7,
+                                      1, 3, 4, 6 };
+
+  //! Compute the area vectors of the triangles of a slice
+  static std::vector< std::array< tk::real, 3 > >
+  areas( const tk::Slice& s ) {
+    const auto& c = s.coord;
+    std::vector< std::array< tk::real, 3 > > a;
+    for (std::size_t t=0; t<s.triinpoel.size()/3; ++t) {
+      auto A = s.triinpoel[t*3+0];
+      auto B = s.triinpoel[t*3+1];
+      auto C = s.triinpoel[t*3+2];
+      auto n = tk::cross(
+        {{ c[0][B]-c[0][A], c[1][B]-c[1][A], c[2][B]-c[2][A] }},
+        {{ c[0][C]-c[0][A], c[1][C]-c[1][A], c[2][C]-c[2][A] }} );
+      a.push_back( {{ n[0]/2.0, n[1]/2.0, n[2]/2.0 }} );
+    }
+    return a;
+  }
+};
+
+// Test group shortcuts
+// The 2nd template argument is the max number of tests in this group. If
+// omitted, the default is 50, specified in tut/tut.hpp.
+using Slice_group = test_group< Slice_common, MAX_TESTS_IN_GROUP >;
+using Slice_object = Slice_group::object;
+
+//! Define test group
+static Slice_group Slice( "Mesh/Slice" );
+
+//! Test definitions for group
+
+//! Test that a plane not intersecting the mesh yields an empty slice
+template<> template<>
+void Slice_object::test< 1 >() {
+  set_test_name( "plane outside of mesh" );
+
+  auto s = tk::slice( inpoel, coord, tk::planedist( coord, {{2,0,0}},
+                                                           {{1,0,0}} ) );
+
+  ensure( "slice triangles must be empty", s.triinpoel.empty() );
+  ensure( "slice nodes must be empty", s.coord[0].empty() );
+  ensure( "slice edges must be empty", s.edge.empty() );
+  ensure( "slice weights must be empty", s.weight.empty() );
+}
+
+//! Test slicing a single tetrahedron with a single node on one side
+template<> template<>
+void Slice_object::test< 2 >() {
+  set_test_name( "single triangle of a tetrahedron" );
+
+  std::vector< std::size_t > tet{ 0, 1, 3, 4 };
+  auto s = tk::slice( tet, coord, tk::planedist( coord, {{0.5,0,0}},
+                                                        {{2,0,0}} ) );
+
+  ensure_equals( "number of slice triangles incorrect",
+                 s.triinpoel.size(), 3 );
+  ensure_equals( "number of slice nodes incorrect", s.coord[0].size(), 3 );
+  ensure_equals( "number of slice edges incorrect", s.edge.size(), 6 );
+  for (std::size_t i=0; i<3; ++i) {
+    ensure_equals( "slice node x coordinate incorrect", s.coord[0][i], 0.5,
+                   pr );
+    ensure_equals( "first end point of edge must be on the positive side",
+                   s.edge[i*2+0], 1 );
+    ensure_equals( "interpolation weight incorrect", s.weight[i], 0.5, pr );
+  }
+  auto a = areas( s );
+  ensure_equals( "triangle area incorrect", a[0][0], 0.125, pr );
+  ensure_equals( "triangle area y component incorrect", a[0][1], 0.0, pr );
+  ensure_equals( "triangle area z component incorrect", a[0][2], 0.0, pr );
+}
+
+//! Test slicing the cube with a plane parallel to a face
+template<> template<>
+void Slice_object::test< 3 >() {
+  set_test_name( "slice of cube parallel to a face" );
+
+  auto s = tk::slice( inpoel, coord, tk::planedist( coord, {{0.5,0,0}},
+                                                           {{1,0,0}} ) );
+
+  // 1 triangle in each corner, a quadrilateral in the center tetrahedron
+  ensure_equals( "number of slice triangles incorrect",
+                 s.triinpoel.size(), 18 );
+  // nodes on shared edges must be unique
+  ensure_equals( "number of slice nodes incorrect", s.coord[0].size(), 8 );
+
+  std::array< tk::real, 3 > area{{ 0, 0, 0 }};
+  for (const auto& a : areas(s)) {
+    ensure( "triangle must be oriented towards increasing distance",
+            a[0] > 0.0 );
+    for (std::size_t j=0; j<3; ++j) area[j] += a[j];
+  }
+  ensure_equals( "slice area incorrect", area[0], 1.0, pr );
+  ensure_equals( "slice area y component incorrect", area[1], 0.0, pr );
+  ensure_equals( "slice area z component incorrect", area[2], 0.0, pr );
+}
+
+//! Test slicing the cube with an oblique plane
+template<> template<>
+void Slice_object::test< 4 >() {
+  set_test_name( "oblique slice of cube" );
+
+  auto s = tk::slice( inpoel, coord, tk::planedist( coord, {{0.5,0.5,0.5}},
+                                                           {{1,1,1}} ) );
+
+  // the slice is a regular hexagon with sides of sqrt(2)/2
+  std::array< tk::real, 3 > area{{ 0, 0, 0 }};
+  for (const auto& a : areas(s)) {
+    ensure( "triangle must be oriented towards increasing distance",
+            a[0] + a[1] + a[2] > -pr );
+    for (std::size_t j=0; j<3; ++j) area[j] += a[j];
+  }
+  ensure_equals( "slice area incorrect", tk::length( area ),
+                 3.0*std::sqrt(3.0)/4.0, pr );
+}
+
+//! Test interpolating linear fields onto slice nodes
+template<> template<>
+void Slice_object::test< 5 >() {
+  set_test_name( "interpolate linear fields" );
+
+  auto s = tk::slice( inpoel, coord, tk::planedist( coord, {{0.3,0.2,0.6}},
+                                                           {{1,2,-1}} ) );
+  ensure( "slice must not be empty", !s.triinpoel.empty() );
+
+  for (std::size_t j=0; j<3; ++j) {
+    auto f = tk::interpolate( s, coord[j] );
+    ensure_equals( "size of interpolated field incorrect", f.size(),
+                   s.coord[j].size() );
+    for (std::size_t i=0; i<f.size(); ++i)
+      ensure_equals( "interpolated coordinate incorrect", f[i], s.coord[j][i],
+                     pr );
+  }
+
+  // iso-surface of a linear field is the plane
+  std::vector< tk::real > d( coord[0].size() );
+  for (std::size_t i=0; i<d.size(); ++i)
+    d[i] = 2.0*coord[0][i] + coord[1][i] - 1.2;
+  auto iso = tk::slice( inpoel, coord, d );
+  auto g = tk::interpolate( iso, d );
+  for (auto v : g) ensure_equals( "iso-value incorrect", v, 0.0, pr );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
@@ -0,0 +1,190 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/RNG/TestRNGBlock.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for RNG/RNGBlock.hpp
+  \details   Unit tests for RNG/RNGBlock.hpp
+*/
+// *****************************************************************************
+
+#include <memory>
+
+#include "NoWarning/tut.hpp"
+#include "NoWarning/pup.hpp"
+
+#include "TUTConfig.hpp"
+#include "RNGBlock.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct RNGBlock_common {
+
+  using ncomp_t = kw::ncomp::info::expect::type;
+
+  //! \brief Generator modeling tk::RNG's concept, generating consecutive
+  //!   numbers per stream and counting the number of calls
+  //! \details Uniform numbers are the negative of the Gaussian ones, counting
+  //!   down from a separate counter per stream.
+  struct Counter {
+    explicit Counter( std::size_t n ) :
+      m_next( std::make_shared< std::vector< double > >( n, 0.0 ) ),
+      m_unext( std::make_shared< std::vector< double > >( n, 0.0 ) ),
+      m_calls( std::make_shared< std::size_t >( 0 ) ) {}
+    void uniform( int stream, ncomp_t num, double* r ) const {
+      ++*m_calls;
+      auto& n = (*m_unext)[ static_cast< std::size_t >( stream ) ];
+      for (ncomp_t i=0; i<num; ++i) r[i] = n--;
+    }
+    void gaussian( int stream, ncomp_t num, double* r ) const {
+      ++*m_calls;
+      auto& n = (*m_next)[ static_cast< std::size_t >( stream ) ];
+      for (ncomp_t i=0; i<num; ++i) r[i] = n++;
+    }
+    void gaussianmv( int, ncomp_t, ncomp_t, const double* const,
+                     const double* const, double* ) const {}
+    void beta( int, ncomp_t, double, double, double, double, double* ) const
+    {}
+    void gamma( int, ncomp_t, double, double, double* ) const {}
+    std::size_t nthreads() const noexcept { return m_next->size(); }
+    void pupstate( PUP::er&, int ) const {}
+    std::shared_ptr< std::vector< double > > m_next;
+    std::shared_ptr< std::vector< double > > m_unext;
+    std::shared_ptr< std::size_t > m_calls;
+  };
+};
+
+//! Test group shortcuts
+using RNGBlock_group = test_group< RNGBlock_common, MAX_TESTS_IN_GROUP >;
+using RNGBlock_object = RNGBlock_group::object;
+
+//! Define test group
+static RNGBlock_group RNGBlock( "RNG/RNGBlock" );
+
+//! Test definitions for group
+
+//! Test that random numbers are handed out in order, generated in blocks
+template<> template<>
+void RNGBlock_object::test< 1 >() {
+  set_test_name( "numbers handed out in order from blocks" );
+
+  Counter c( 1 );
+  tk::RNG rng( c );
+  tk::RNGBlock b( rng, 8 );
+
+  for (std::size_t p=0; p<12; ++p) {
+    const auto r = b.gaussian( 0, 3 );
+    // the last number of a block is skipped if 3 numbers do not fit
+    auto first = static_cast< tk::real >( p*3 + (p*3)/6*2 );
+    for (std::size_t i=0; i<3; ++i)
+      ensure_equals( "random number incorrect", r[i],
+                     first + static_cast< tk::real >( i ), 1.0e-15 );
+  }
+  ensure_equals( "number of calls to generator incorrect", *c.m_calls, 6UL );
+}
+
+//! Test that a request larger than the block size is generated at once
+template<> template<>
+void RNGBlock_object::test< 2 >() {
+  set_test_name( "request larger than block" );
+
+  Counter c( 1 );
+  tk::RNG rng( c );
+  tk::RNGBlock b( rng, 4 );
+
+  const auto r = b.gaussian( 0, 10 );
+  for (std::size_t i=0; i<10; ++i)
+    ensure_equals( "random number incorrect", r[i],
+                   static_cast< tk::real >( i ), 1.0e-15 );
+  ensure_equals( "number of calls to generator incorrect", *c.m_calls, 1UL );
+}
+
+//! Test that streams are handed out from separate blocks
+template<> template<>
+void RNGBlock_object::test< 3 >() {
+  set_test_name( "separate blocks per stream" );
+
+  Counter c( 2 );
+  tk::RNG rng( c );
+  tk::RNGBlock b( rng, 4 );
+
+  ensure_equals( "stream 0 incorrect", *b.gaussian( 0, 1 ), 0.0, 1.0e-15 );
+  ensure_equals( "stream 1 incorrect", *b.gaussian( 1, 1 ), 0.0, 1.0e-15 );
+  ensure_equals( "stream 0 incorrect", *b.gaussian( 0, 1 ), 1.0, 1.0e-15 );
+  ensure_equals( "number of calls to generator incorrect", *c.m_calls, 2UL );
+}
+
+//! Test that numbers not yet handed out survive packing and unpacking
+template<> template<>
+void RNGBlock_object::test< 4 >() {
+  set_test_name( "pack/unpack" );
+
+  Counter c( 1 );
+  tk::RNG rng( c );
+  tk::RNGBlock b( rng, 8 );
+  b.gaussian( 0, 3 );
+
+  PUP::sizer s;
+  b.pup( s );
+  std::vector< char > buf( s.size() );
+  PUP::toMem t( buf.data() );
+  b.pup( t );
+
+  tk::RNGBlock u( rng, 8 );
+  PUP::fromMem f( buf.data() );
+  u.pup( f );
+
+  const auto r = u.gaussian( 0, 5 );
+  for (std::size_t i=0; i<5; ++i)
+    ensure_equals( "random number incorrect", r[i],
+                   3.0 + static_cast< tk::real >( i ), 1.0e-15 );
+  ensure_equals( "number of calls to generator incorrect", *c.m_calls, 1UL );
+}
+
+//! Test that uniform numbers are handed out from their own blocks
+template<> template<>
+void RNGBlock_object::test< 5 >() {
+  set_test_name( "separate blocks per distribution" );
+
+  Counter c( 1 );
+  tk::RNG rng( c );
+  tk::RNGBlock b( rng, 4 );
+
+  ensure_equals( "gaussian incorrect", *b.gaussian( 0, 1 ), 0.0, 1.0e-15 );
+  ensure_equals( "uniform incorrect", *b.uniform( 0, 1 ), 0.0, 1.0e-15 );
+  ensure_equals( "uniform incorrect", *b.uniform( 0, 1 ), -1.0, 1.0e-15 );
+  ensure_equals( "gaussian incorrect", *b.gaussian( 0, 1 ), 1.0, 1.0e-15 );
+  ensure_equals( "number of calls to generator incorrect", *c.m_calls, 2UL );
+}
+
+//! Test that refill discards the numbers not yet handed out
+template<> template<>
+void RNGBlock_object::test< 6 >() {
+  set_test_name( "refill" );
+
+  Counter c( 2 );
+  tk::RNG rng( c );
+  tk::RNGBlock b( rng, 4 );
+
+  b.gaussian( 0, 1 );
+  b.uniform( 0, 1 );
+  b.gaussian( 1, 1 );
+  b.refill( 0 );
+
+  ensure_equals( "gaussian after refill incorrect",
+                 *b.gaussian( 0, 1 ), 4.0, 1.0e-15 );
+  ensure_equals( "uniform after refill incorrect",
+                 *b.uniform( 0, 1 ), -4.0, 1.0e-15 );
+  ensure_equals( "other stream affected by refill",
+                 *b.gaussian( 1, 1 ), 1.0, 1.0e-15 );
+  ensure_equals( "number of calls to generator incorrect", *c.m_calls, 5UL );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
@@ -0,0 +1,121 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/RNG/TestZiggurat.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019-2020 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for RNG/Ziggurat.hpp
+  \details   Unit tests for RNG/Ziggurat.hpp
+*/
+// *****************************************************************************
+
+#include <cmath>
+#include <string>
+#include <algorithm>
+
+#include "NoWarning/tut.hpp"
+
+#include "NoWarning/threefry.hpp"
+#include "NoWarning/philox.hpp"
+
+#include "TUTConfig.hpp"
+#include "Random123.hpp"
+#include "Ziggurat.hpp"
+#include "TestRNG.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct Ziggurat_common {};
+
+//! Test group shortcuts
+using Ziggurat_group = test_group< Ziggurat_common, MAX_TESTS_IN_GROUP >;
+using Ziggurat_object = Ziggurat_group::object;
+
+//! Define test group
+static Ziggurat_group Ziggurat( "RNG/Ziggurat" );
+
+//! Test definitions for group
+
+//! Test Gaussian generator statistics from threefry using a single thread
+template<> template<>
+void Ziggurat_object::test< 1 >() {
+  set_test_name( "Gaussian threefry from a single stream" );
+
+  tk::Ziggurat< tk::Random123< r123::Threefry2x64 > > r( 1 );
+  RNG_common::test_gaussian( r );
+}
+
+//! Test Gaussian generator statistics from threefry using multiple threads
+template<> template<>
+void Ziggurat_object::test< 2 >() {
+  set_test_name( "Gaussian threefry from 4 emulated streams" );
+
+  tk::Ziggurat< tk::Random123< r123::Threefry2x64 > > r( 4 );
+  RNG_common::test_gaussian( r );
+}
+
+//! Test Gaussian generator statistics from philox using a single thread
+template<> template<>
+void Ziggurat_object::test< 3 >() {
+  set_test_name( "Gaussian philox from a single stream" );
+
+  tk::Ziggurat< tk::Random123< r123::Philox2x64 > > r( 1 );
+  RNG_common::test_gaussian( r );
+}
+
+//! Test that the uniform generator of the wrapped generator is unchanged
+template<> template<>
+void Ziggurat_object::test< 4 >() {
+  set_test_name( "uniform philox unchanged" );
+
+  tk::Ziggurat< tk::Random123< r123::Philox2x64 > > z( 1 );
+  tk::Random123< r123::Philox2x64 > r( 1 );
+  std::vector< double > a( 100 ), b( 100 );
+  z.uniform( 0, a.size(), a.data() );
+  r.uniform( 0, b.size(), b.data() );
+  for (std::size_t i=0; i<a.size(); ++i)
+    ensure_equals( "uniform random number incorrect", a[i], b[i], 1.0e-15 );
+}
+
+//! Test that the tail of the Gaussian is sampled with the correct probability
+template<> template<>
+void Ziggurat_object::test< 5 >() {
+  set_test_name( "Gaussian tail probability" );
+
+  tk::Ziggurat< tk::Random123< r123::Threefry2x64 > > r( 1 );
+  std::size_t num = 1000000;
+  std::vector< double > numbers( num );
+  r.gaussian( 0, num, numbers.data() );
+  // P(|x| > 3.442619855899), the tail of the base layer, is about 5.76e-4,
+  // so about 576 numbers are expected with a standard deviation of about 24
+  auto n = std::count_if( begin(numbers), end(numbers),
+             []( double x ){ return std::abs(x) > 3.442619855899; } );
+  ensure( "number of samples in tail incorrect: " + std::to_string(n),
+          n > 450 && n < 700 );
+}
+
+//! Test copy constructor for threefry
+template<> template<>
+void Ziggurat_object::test< 6 >() {
+  set_test_name( "copy constructor with threefry" );
+
+  tk::Ziggurat< tk::Random123< r123::Threefry2x64 > > r( 4 );
+  RNG_common::test_copy_ctor( r );
+}
+
+//! Test move constructor for threefry
+template<> template<>
+void Ziggurat_object::test< 7 >() {
+  set_test_name( "move constructor with threefry" );
+
+  tk::Ziggurat< tk::Random123< r123::Threefry2x64 > > r( 4 );
+  RNG_common::test_move_ctor( r );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT